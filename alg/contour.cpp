@@ -22,14 +22,19 @@
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
 #include <climits>
 #include <limits>
+#include <list>
+#include <map>
+#include <tuple>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -218,6 +223,296 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                         ContourLineCollector                         */
+/************************************************************************/
+
+namespace
+{
+
+//! A contour line, with its level
+struct ContourLine
+{
+    double level = 0;
+    marching_squares::LineString ls{};
+    bool closed = false;
+};
+
+//! Line writer that stores the lines generated for a strip of the raster
+struct ContourLineCollector
+{
+    std::vector<ContourLine> lines{};
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        ContourLine line;
+        line.level = level;
+        line.ls = std::move(ls);
+        line.closed = closed;
+        lines.push_back(std::move(line));
+    }
+};
+
+/************************************************************************/
+/*                         ContourLineStitcher                          */
+/************************************************************************/
+
+/** Joins the lines of consecutive strips of the raster that end on their
+ * common boundary, and writes lines as soon as they can no longer grow, so
+ * that only the lines crossing the current boundary are kept in memory.
+ */
+class ContourLineStitcher
+{
+  public:
+    explicit ContourLineStitcher(GDALRingAppender &writer) : writer_(writer)
+    {
+    }
+
+    /** Add the lines of the next strip, whose top and bottom boundaries are
+     * at yTop and yBottom, or NaN at the edges of the raster.
+     */
+    void addStrip(std::vector<ContourLine> &lines, double yTop, double yBottom)
+    {
+        for (auto &line : lines)
+        {
+            if (line.closed ||
+                (!touches(line, yTop) && !touches(line, yBottom)))
+                write(line);
+            else
+                addPending(std::move(line));
+        }
+
+        // Lines that do not reach the bottom boundary are complete
+        for (auto it = pending_.begin(); it != pending_.end();)
+        {
+            if (touches(*it, yBottom))
+            {
+                ++it;
+            }
+            else
+            {
+                unindex(it);
+                write(*it);
+                it = pending_.erase(it);
+            }
+        }
+    }
+
+    /** Write the remaining lines */
+    void finish()
+    {
+        for (auto &line : pending_)
+            write(line);
+        pending_.clear();
+        endpoints_.clear();
+    }
+
+  private:
+    using Lines = std::list<ContourLine>;
+    using Key = std::tuple<double, double, double>;
+
+    GDALRingAppender &writer_;
+    Lines pending_{};
+    std::map<Key, Lines::iterator> endpoints_{};
+
+    CPL_DISALLOW_COPY_ASSIGN(ContourLineStitcher)
+
+    static bool touches(const ContourLine &line, double y)
+    {
+        return line.ls.front().y == y || line.ls.back().y == y;
+    }
+
+    static Key key(double level, const marching_squares::Point &pt)
+    {
+        return Key(level, pt.x, pt.y);
+    }
+
+    void write(ContourLine &line)
+    {
+        writer_.addLine(line.level, line.ls, line.closed);
+    }
+
+    void index(Lines::iterator it)
+    {
+        endpoints_[key(it->level, it->ls.front())] = it;
+        endpoints_[key(it->level, it->ls.back())] = it;
+    }
+
+    void unindex(Lines::iterator it)
+    {
+        endpoints_.erase(key(it->level, it->ls.front()));
+        endpoints_.erase(key(it->level, it->ls.back()));
+    }
+
+    void addPending(ContourLine &&line)
+    {
+        // Join with the pending lines that share an end point
+        for (bool joined = true; joined;)
+        {
+            joined = false;
+            for (const bool atFront : {true, false})
+            {
+                const marching_squares::Point pt =
+                    atFront ? line.ls.front() : line.ls.back();
+                const auto oIter = endpoints_.find(key(line.level, pt));
+                if (oIter == endpoints_.end())
+                    continue;
+                const auto other = oIter->second;
+                unindex(other);
+                auto &ls = other->ls;
+                if (atFront)
+                {
+                    line.ls.pop_front();
+                    if (ls.back() == pt)
+                        line.ls.splice(line.ls.begin(), ls);
+                    else
+                        for (const auto &otherPt : ls)
+                            line.ls.push_front(otherPt);
+                }
+                else
+                {
+                    line.ls.pop_back();
+                    if (ls.front() == pt)
+                        line.ls.splice(line.ls.end(), ls);
+                    else
+                        for (auto rit = ls.rbegin(); rit != ls.rend(); ++rit)
+                            line.ls.push_back(*rit);
+                }
+                pending_.erase(other);
+                joined = true;
+                break;
+            }
+            if (joined && line.ls.front() == line.ls.back())
+            {
+                line.closed = true;
+                write(line);
+                return;
+            }
+        }
+        pending_.push_back(std::move(line));
+        index(std::prev(pending_.end()));
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                 ContourGenerateLinesMultiThreaded()                  */
+/************************************************************************/
+
+/** Generate contour lines, by strips of lines processed in parallel, whose
+ * lines are then joined when they cross strip boundaries.
+ */
+static bool ContourGenerateLinesMultiThreaded(
+    GDALRasterBandH hBand, bool useNoData, double noDataValue,
+    marching_squares::FixedLevelRangeIterator &levels,
+    GDALRingAppender &appender, CPLJobQueue *poJobQueue, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const int nXSize = GDALGetRasterBandXSize(hBand);
+    const int nYSize = GDALGetRasterBandYSize(hBand);
+
+    // Read lines by batches of about 64 MB, split into one strip per thread
+    constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+    const int nBatchLines = static_cast<int>(std::min<size_t>(
+        nYSize, std::max<size_t>(nThreads, BATCH_BYTES / sizeof(double) /
+                                               static_cast<size_t>(nXSize))));
+    // One extra line for the line preceding the batch
+    std::vector<double> adfLines(static_cast<size_t>(nBatchLines + 1) *
+                                 nXSize);
+
+    ContourLineStitcher stitcher(appender);
+    for (int nYOff = 0; nYOff < nYSize; nYOff += nBatchLines)
+    {
+        if (!pfnProgress(static_cast<double>(nYOff) / nYSize,
+                         "Processing line", pProgressArg))
+            return false;
+
+        const int nLines = std::min(nBatchLines, nYSize - nYOff);
+        const int nFirstLine = std::max(0, nYOff - 1);
+        if (GDALRasterIO(hBand, GF_Read, 0, nFirstLine, nXSize,
+                         nYOff + nLines - nFirstLine, adfLines.data(), nXSize,
+                         nYOff + nLines - nFirstLine, GDT_Float64, 0,
+                         0) != CE_None)
+        {
+            return false;
+        }
+        const double *padfBatch =
+            adfLines.data() + static_cast<size_t>(nYOff - nFirstLine) * nXSize;
+
+        const int nJobs = std::min(nThreads, nLines);
+        const auto GetStripStart = [nLines, nJobs](int iJob)
+        {
+            return static_cast<int>(static_cast<int64_t>(iJob) * nLines /
+                                    nJobs);
+        };
+        std::vector<std::vector<ContourLine>> aoStripLines(nJobs);
+        std::vector<std::string> aosErrors(nJobs);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const int nStart = GetStripStart(iJob);
+            const int nEnd = GetStripStart(iJob + 1);
+            const auto job = [&, iJob, nStart, nEnd]()
+            {
+                try
+                {
+                    ContourLineCollector collector;
+                    {
+                        SegmentMerger<ContourLineCollector,
+                                      FixedLevelRangeIterator>
+                            merger(collector, levels, /* polygonize */ false);
+                        ContourGenerator<decltype(merger),
+                                         FixedLevelRangeIterator>
+                            cg(nXSize, nYSize, useNoData, noDataValue, merger,
+                               levels);
+                        cg.setStartLine(
+                            nYOff + nStart,
+                            nYOff + nStart > 0
+                                ? padfBatch +
+                                      static_cast<ptrdiff_t>(nStart - 1) *
+                                          nXSize
+                                : nullptr);
+                        for (int i = nStart; i < nEnd; ++i)
+                            cg.feedLine(padfBatch +
+                                        static_cast<size_t>(i) * nXSize);
+                        // merger flushes its remaining lines when destroyed
+                    }
+                    aoStripLines[iJob] = std::move(collector.lines);
+                }
+                catch (const std::exception &e)
+                {
+                    aosErrors[iJob] = e.what();
+                }
+            };
+            poJobQueue->SubmitJob(job);
+        }
+        poJobQueue->WaitCompletion();
+
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            if (!aosErrors[iJob].empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         aosErrors[iJob].c_str());
+                return false;
+            }
+            const int nStart = nYOff + GetStripStart(iJob);
+            const int nEnd = nYOff + GetStripStart(iJob + 1);
+            // Points on the boundary between two strips are on the line of
+            // pixel centers shared by their squares.
+            stitcher.addStrip(aoStripLines[iJob],
+                              nStart > 0 ? nStart - 0.5 : NaN,
+                              nEnd < nYSize ? nEnd - 0.5 : NaN);
+            aoStripLines[iJob].clear();
+        }
+    }
+    stitcher.finish();
+
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -563,6 +858,16 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=number_of_threads|ALL_CPUS
+ *
+ * (GDAL >= 3.11) Number of threads used to generate contour lines. Defaults
+ * to the value of the GDAL_NUM_THREADS configuration option, or 1. When
+ * greater than 1, the raster is split into strips of lines processed in
+ * parallel, and the lines crossing strip boundaries are then joined. Lines
+ * are written as soon as they are complete. The set of output lines is the
+ * same as with a single thread, but their order and orientation may differ.
+ * Only used in line contouring mode.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -680,6 +985,11 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const int nThreads = CPLParseNumThreads(
+        CSLFetchNameValueDef(options, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1")),
+        128);
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -895,12 +1205,26 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 fixedLevels.erase(uniqueIt, fixedLevels.end());
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                auto poThreadPool =
+                    nThreads > 1 && GDALGetRasterBandYSize(hBand) > 1
+                        ? GDALGetGlobalThreadPool(nThreads)
+                        : nullptr;
+                if (poThreadPool)
+                {
+                    auto poJobQueue = poThreadPool->CreateJobQueue();
+                    ok = ContourGenerateLinesMultiThreaded(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        poJobQueue.get(), nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
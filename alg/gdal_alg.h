@@ -44,6 +44,11 @@ int CPL_DLL CPL_STDCALL GDALDitherRGB2PCT(
 int CPL_DLL CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff,
                                           int nYOff, int nXSize, int nYSize);
 
+CPLErr CPL_DLL CPL_STDCALL GDALContentHashImage(GDALRasterBandH hBand,
+                                                int nXOff, int nYOff,
+                                                int nXSize, int nYSize,
+                                                GUInt64 *pnHash);
+
 CPLErr CPL_DLL CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                                                 GDALRasterBandH hProximityBand,
                                                 char **papszOptions,
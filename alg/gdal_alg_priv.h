@@ -157,6 +157,8 @@ constexpr const char *GDAL_APPROX_TRANSFORMER_CLASS_NAME =
 constexpr const char *GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME =
     "GDALGenImgProjTransformer";
 constexpr const char *GDAL_RPC_TRANSFORMER_CLASS_NAME = "GDALRPCTransformer";
+constexpr const char *GDAL_WARP_PLAN_TRANSFORMER_CLASS_NAME =
+    "GDALWarpPlanTransformer";
 
 bool GDALIsTransformer(void *hTransformerArg, const char *pszClassName);
 
@@ -192,6 +194,29 @@ bool GDALTransformIsAffineNoRotation(GDALTransformerFunc pfnTransformer,
 
 bool GDALTransformHasFastClone(void *pTransformerArg);
 
+/* Warp plan transformer, in gdalwarpplan.cpp */
+
+void *GDALCreateWarpPlanTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                    void *pBaseTransformArg, int nDstXSize,
+                                    int nDstYSize, int nStep, double dfMaxError,
+                                    const char *pszFilename);
+int GDALWarpPlanTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                          double *padfX, double *padfY, double *padfZ,
+                          int *panSuccess);
+void GDALDestroyWarpPlanTransformer(void *pTransformArg);
+
+/* Prepared warp cutline, in gdalcutline.cpp */
+
+void *GDALCreatePreparedCutline(OGRGeometryH hCutline);
+void GDALDestroyPreparedCutline(void *hPreparedCutline);
+int GDALPreparedCutlineClassifyWindow(void *hPreparedCutline,
+                                      double dfBlendDist, int nXOff, int nYOff,
+                                      int nXSize, int nYSize);
+CPLErr GDALWarpCutlineMaskerPrepared(void *pMaskFuncArg,
+                                     void *hPreparedCutline, int nXOff,
+                                     int nYOff, int nXSize, int nYSize,
+                                     float *pafMask, int *pnValidityFlag);
+
 typedef struct _CPLQuadTree CPLQuadTree;
 
 typedef struct
@@ -200,6 +225,7 @@ typedef struct
 
     bool bReversed;
     double dfOversampleFactor;
+    int nNumThreads;  // Used for the inverse transform with in-memory arrays
 
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
@@ -21,6 +21,12 @@
 
 #include <algorithm>
 #include <complex>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Size of the square blocks of values put in the cache
+constexpr int BLOCK_SIZE = 64;
 
 template <typename T> bool areEqualReal(double dfNoDataValue, T dfOut);
 
@@ -41,8 +47,6 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
                                    gdal::Vector2i point,
                                    gdal::Vector2i dimensions, T *padfOut)
 {
-    constexpr int BLOCK_SIZE = 64;
-
     const int nX = point.x();
     const int nY = point.y();
     const int nWidth = dimensions.x();
@@ -423,3 +427,59 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
     }
     return res;
 }
+
+/************************************************************************/
+/*                        GDALInterpolateAtPoints()                     */
+/************************************************************************/
+
+// Same as GDALInterpolateAtPoint() on an array of points, whose result is
+// stored in padfOutputReal[i] (and padfOutputImag[i] if not null), and
+// panSuccess[i] (if not null). Points are processed in the order of the
+// cached blocks that contain them, so that each block is generally read only
+// once, whatever the order of the input points.
+// Returns true if all points could be interpolated.
+bool GDALInterpolateAtPoints(GDALRasterBand *pBand,
+                             GDALRIOResampleAlg eResampleAlg,
+                             std::unique_ptr<DoublePointsCache> &cache,
+                             size_t nPointCount, const double *padfX,
+                             const double *padfY, double *padfOutputReal,
+                             double *padfOutputImag, int *panSuccess)
+{
+    const int nRasterXSize = pBand->GetXSize();
+    const int nRasterYSize = pBand->GetYSize();
+
+    // Sort key is the index of the block in row-major order, or UINT64_MAX
+    // for points outside of the raster, which are processed last.
+    std::vector<std::pair<uint64_t, size_t>> anKeys;
+    anKeys.reserve(nPointCount);
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        const double dfX = padfX[i];
+        const double dfY = padfY[i];
+        uint64_t nKey = std::numeric_limits<uint64_t>::max();
+        if (dfX >= 0 && dfX <= nRasterXSize && dfY >= 0 && dfY <= nRasterYSize)
+        {
+            const auto nBlockX =
+                static_cast<uint64_t>(static_cast<int>(dfX) / BLOCK_SIZE);
+            const auto nBlockY =
+                static_cast<uint64_t>(static_cast<int>(dfY) / BLOCK_SIZE);
+            nKey = (nBlockY << 32) | nBlockX;
+        }
+        anKeys.emplace_back(nKey, i);
+    }
+    std::sort(anKeys.begin(), anKeys.end());
+
+    bool bRet = true;
+    for (const auto &oKey : anKeys)
+    {
+        const size_t i = oKey.second;
+        const bool bSuccess = GDALInterpolateAtPoint(
+            pBand, eResampleAlg, cache, padfX[i], padfY[i], padfOutputReal + i,
+            padfOutputImag ? padfOutputImag + i : nullptr);
+        if (panSuccess)
+            panSuccess[i] = bSuccess;
+        if (!bSuccess)
+            bRet = false;
+    }
+    return bRet;
+}
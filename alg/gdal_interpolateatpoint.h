@@ -41,6 +41,14 @@ bool CPL_DLL GDALInterpolateAtPoint(GDALRasterBand *pBand,
                                     double *pdfOutputReal,
                                     double *pdfOutputImag);
 
+bool CPL_DLL GDALInterpolateAtPoints(GDALRasterBand *pBand,
+                                     GDALRIOResampleAlg eResampleAlg,
+                                     std::unique_ptr<DoublePointsCache> &cache,
+                                     size_t nPointCount, const double *padfX,
+                                     const double *padfY,
+                                     double *padfOutputReal,
+                                     double *padfOutputImag, int *panSuccess);
+
 /*! @endcond */
 
 #endif /* ndef GDAL_INTERPOLATEATPOINT_H_INCLUDED */
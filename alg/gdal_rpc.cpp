@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -352,20 +353,15 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                         RPCNormalizePoint()                          */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+static void RPCNormalizePoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                               double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
+                              double &dfNormalizedLong, double &dfNormalizedLat,
+                              double &dfNormalizedHeight)
 
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -377,14 +373,11 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
         diffLong -= 360;
     }
 
-    const double dfNormalizedLong =
-        diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
-    const double dfNormalizedLat =
-        (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
-        psRPCTransformInfo->sRPC.dfLAT_SCALE;
-    const double dfNormalizedHeight =
-        (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
-        psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
+    dfNormalizedLong = diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
+    dfNormalizedLat = (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
+                      psRPCTransformInfo->sRPC.dfLAT_SCALE;
+    dfNormalizedHeight = (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
+                         psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
 
     // The absolute values of the 3 above normalized values are supposed to be
     // below 1. Warn (as debug message) if it is not the case. We allow for some
@@ -434,6 +427,28 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    double dfNormalizedLong = 0.0;
+    double dfNormalizedLat = 0.0;
+    double dfNormalizedHeight = 0.0;
+    RPCNormalizePoint(psRPCTransformInfo, dfLong, dfLat, dfHeight,
+                      dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight);
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
@@ -465,6 +480,129 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/************************************************************************/
+
+// Same as RPCTransformPoint() applied to an array of points. With SSE2, two
+// points are evaluated at once, each one in a lane of the registers, which
+// avoids the horizontal sums of RPCEvaluate4().
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               int nPointCount, const double *padfLong,
+                               const double *padfLat, const double *padfHeight,
+                               double *padfPixel, double *padfLine)
+
+{
+    int i = 0;
+#ifdef USE_SSE2_OPTIM
+    const double *padfCoefs = psRPCTransformInfo->padfCoeffs;
+    for (; i + 1 < nPointCount; i += 2)
+    {
+        double adfLong[2], adfLat[2], adfHeight[2];
+        for (int j = 0; j < 2; ++j)
+        {
+            RPCNormalizePoint(psRPCTransformInfo, padfLong[i + j],
+                              padfLat[i + j], padfHeight[i + j], adfLong[j],
+                              adfLat[j], adfHeight[j]);
+        }
+        const auto L = XMMReg2Double::Load2Val(adfLong);
+        const auto P = XMMReg2Double::Load2Val(adfLat);
+        const auto H = XMMReg2Double::Load2Val(adfHeight);
+
+        // Same order as RPCComputeTerms(), except the constant term.
+        const XMMReg2Double aTerms[19] = {
+            L,         P,         H,         L * P,     L * H,
+            P * H,     L * L,     P * P,     H * H,     L * P * H,
+            L * L * L, L * P * P, L * H * H, L * L * P, P * P * P,
+            P * H * H, L * L * H, P * P * H, H * H * H};
+
+        auto lineNum = XMMReg2Double::Load1ValHighAndLow(padfCoefs);
+        auto lineDen = XMMReg2Double::Load1ValHighAndLow(padfCoefs + 20);
+        auto sampNum = XMMReg2Double::Load1ValHighAndLow(padfCoefs + 40);
+        auto sampDen = XMMReg2Double::Load1ValHighAndLow(padfCoefs + 60);
+        for (int k = 1; k < 20; ++k)
+        {
+            const auto &term = aTerms[k - 1];
+            lineNum +=
+                term * XMMReg2Double::Load1ValHighAndLow(padfCoefs + k);
+            lineDen +=
+                term * XMMReg2Double::Load1ValHighAndLow(padfCoefs + k + 20);
+            sampNum +=
+                term * XMMReg2Double::Load1ValHighAndLow(padfCoefs + k + 40);
+            sampDen +=
+                term * XMMReg2Double::Load1ValHighAndLow(padfCoefs + k + 60);
+        }
+
+        double adfLineNum[2], adfLineDen[2], adfSampNum[2], adfSampDen[2];
+        lineNum.Store2Val(adfLineNum);
+        lineDen.Store2Val(adfLineDen);
+        sampNum.Store2Val(adfSampNum);
+        sampDen.Store2Val(adfSampDen);
+        for (int j = 0; j < 2; ++j)
+        {
+            // RPCs are using the center of upper left pixel = 0,0 convention
+            // convert to top left corner = 0,0 convention used in GDAL.
+            padfPixel[i + j] = adfSampNum[j] / adfSampDen[j] *
+                                   psRPCTransformInfo->sRPC.dfSAMP_SCALE +
+                               psRPCTransformInfo->sRPC.dfSAMP_OFF + 0.5;
+            padfLine[i + j] = adfLineNum[j] / adfLineDen[j] *
+                                  psRPCTransformInfo->sRPC.dfLINE_SCALE +
+                              psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
+        }
+    }
+#endif
+    for (; i < nPointCount; ++i)
+    {
+        RPCTransformPoint(psRPCTransformInfo, padfLong[i], padfLat[i],
+                          padfHeight[i], padfPixel + i, padfLine + i);
+    }
+}
+
+/************************************************************************/
+/*                       RPCTransformValidPoints()                      */
+/************************************************************************/
+
+// Transform in place the (long, lat, height) points for which panSuccess[i]
+// is set, by chunks of points packed for RPCTransformPoints().
+static void
+RPCTransformValidPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                        int nPointCount, double *padfX, double *padfY,
+                        const double *padfHeight, const int *panSuccess)
+
+{
+    constexpr int CHUNK_SIZE = 64;
+    int anIdx[CHUNK_SIZE];
+    double adfLong[CHUNK_SIZE];
+    double adfLat[CHUNK_SIZE];
+    double adfHeight[CHUNK_SIZE];
+    double adfPixel[CHUNK_SIZE];
+    double adfLine[CHUNK_SIZE];
+
+    int i = 0;
+    while (i < nPointCount)
+    {
+        int nValid = 0;
+        for (; i < nPointCount && nValid < CHUNK_SIZE; ++i)
+        {
+            if (panSuccess[i])
+            {
+                anIdx[nValid] = i;
+                adfLong[nValid] = padfX[i];
+                adfLat[nValid] = padfY[i];
+                adfHeight[nValid] = padfHeight[i];
+                ++nValid;
+            }
+        }
+        RPCTransformPoints(psRPCTransformInfo, nValid, adfLong, adfLat,
+                           adfHeight, adfPixel, adfLine);
+        for (int k = 0; k < nValid; ++k)
+        {
+            padfX[anIdx[k]] = adfPixel[k];
+            padfY[anIdx[k]] = adfLine[k];
+        }
+    }
+}
+
 /************************************************************************/
 /*                     GDALSerializeRPCDEMResample()                    */
 /************************************************************************/
@@ -1115,30 +1253,259 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
 }
 
 /************************************************************************/
-/*                      RPCInverseTransformPoint()                      */
+/*                           RPCInverseState                            */
 /************************************************************************/
 
-static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
-                                     double dfPixel, double dfLine,
-                                     double dfUserHeight, double *pdfLong,
-                                     double *pdfLat)
+// State of the iterative inverse transformation of a point.
+struct RPCInverseState
+{
+    double dfPixel = 0;
+    double dfLine = 0;
+    double dfUserHeight = 0;
+    double dfResultX = 0;
+    double dfResultY = 0;
+    double dfPixelDeltaX = 0;
+    double dfPixelDeltaY = 0;
+    double dfLastResultX = 0;
+    double dfLastResultY = 0;
+    double dfLastPixelDeltaX = 0;
+    double dfLastPixelDeltaY = 0;
+    bool bLastPixelDeltaValid = false;
+    int nCountConsecutiveErrorBelow2 = 0;
+};
 
+/************************************************************************/
+/*                          RPCInverseInit()                            */
+/************************************************************************/
+
+static void RPCInverseInit(const GDALRPCTransformInfo *psTransform,
+                           double dfPixel, double dfLine, double dfUserHeight,
+                           RPCInverseState &sState)
 {
-    // Memo:
-    // Known to work with 40 iterations with DEM on all points (int coord and
-    // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
+    sState = RPCInverseState();
+    sState.dfPixel = dfPixel;
+    sState.dfLine = dfLine;
+    sState.dfUserHeight = dfUserHeight;
 
     /* -------------------------------------------------------------------- */
     /*      Compute an initial approximation based on linear                */
     /*      interpolation from our reference point.                         */
     /* -------------------------------------------------------------------- */
-    double dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
+    sState.dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
                        psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
                        psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
 
-    double dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
+    sState.dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
                        psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
                        psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
+}
+
+/************************************************************************/
+/*                        RPCInverseGetHeight()                         */
+/************************************************************************/
+
+// Return the DEM height at the current guess of the iteration, or false if
+// the iteration must error out.
+static bool RPCInverseGetHeight(GDALRPCTransformInfo *psTransform, int iIter,
+                                const RPCInverseState &sState,
+                                double *pdfDEMH)
+{
+    const double dfResultX = sState.dfResultX;
+    const double dfResultY = sState.dfResultY;
+    double dfDEMH = 0.0;
+    double dfDEMPixel = 0.0;
+    double dfDEMLine = 0.0;
+    if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY, &dfDEMH,
+                                   &dfDEMPixel, &dfDEMLine))
+    {
+        if (psTransform->poDS)
+        {
+            CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
+                     dfDEMLine);
+        }
+
+        // The first time, the guess might be completely out of the
+        // validity of the DEM, so pickup the "reference Z" as the
+        // first guess or the closest point of the DEM by snapping to it.
+        if (iIter == 0)
+        {
+            bool bUseRefZ = true;
+            if (psTransform->poDS)
+            {
+                if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
+                    dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
+                else if (dfDEMPixel < 0)
+                    dfDEMPixel = 0.5;
+                if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
+                    dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
+                else if (dfDEMPixel < 0)
+                    dfDEMPixel = 0.5;
+                if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
+                                        &dfDEMH))
+                {
+                    bUseRefZ = false;
+                    CPLDebug("RPC",
+                             "Iteration %d for (pixel, line) = (%g, %g): "
+                             "No elevation value at %.15g %.15g. "
+                             "Using elevation %g at DEM (pixel, line) = "
+                             "(%g, %g) (snapping to boundaries) instead",
+                             iIter, sState.dfPixel, sState.dfLine, dfResultX,
+                             dfResultY, dfDEMH, dfDEMPixel, dfDEMLine);
+                }
+            }
+            if (bUseRefZ)
+            {
+                dfDEMH = psTransform->dfRefZ;
+                CPLDebug("RPC",
+                         "Iteration %d for (pixel, line) = (%g, %g): "
+                         "No elevation value at %.15g %.15g. "
+                         "Using elevation %g of reference point instead",
+                         iIter, sState.dfPixel, sState.dfLine, dfResultX,
+                         dfResultY, dfDEMH);
+            }
+        }
+        else
+        {
+            CPLDebug("RPC",
+                     "Iteration %d for (pixel, line) = (%g, %g): "
+                     "No elevation value at %.15g %.15g. Erroring out",
+                     iIter, sState.dfPixel, sState.dfLine, dfResultX,
+                     dfResultY);
+            return false;
+        }
+    }
+    *pdfDEMH = dfDEMH;
+    return true;
+}
+
+/************************************************************************/
+/*                         RPCInverseUpdate()                           */
+/************************************************************************/
+
+// Update the guess of the iteration from the pixel/line coordinates to which
+// it transforms. Return true if the iteration has converged.
+static bool RPCInverseUpdate(const GDALRPCTransformInfo *psTransform,
+                             int iIter, double dfHeight, double dfBackPixel,
+                             double dfBackLine, RPCInverseState &sState)
+{
+    const double dfPixelDeltaX = dfBackPixel - sState.dfPixel;
+    const double dfPixelDeltaY = dfBackLine - sState.dfLine;
+    sState.dfPixelDeltaX = dfPixelDeltaX;
+    sState.dfPixelDeltaY = dfPixelDeltaY;
+
+    if (psTransform->bRPCInverseVerbose)
+    {
+        CPLDebug("RPC",
+                 "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
+                 "long=%f, lat=%f, height=%f",
+                 iIter, dfPixelDeltaX, dfPixelDeltaY, sState.dfResultX,
+                 sState.dfResultY, dfHeight);
+    }
+
+    const double dfError =
+        std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
+    if (dfError < psTransform->dfPixErrThreshold)
+    {
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Converged!");
+        }
+        return true;
+    }
+    else if (psTransform->poDS != nullptr && sState.bLastPixelDeltaValid &&
+             dfPixelDeltaX * sState.dfLastPixelDeltaX < 0 &&
+             dfPixelDeltaY * sState.dfLastPixelDeltaY < 0)
+    {
+        // When there is a DEM, if the error changes sign, we might
+        // oscillate forever, so take a mean position as a new guess.
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Oscillation detected. "
+                            "Taking mean of 2 previous results as new guess");
+        }
+        const double dfLastPixelDeltaX = sState.dfLastPixelDeltaX;
+        const double dfLastPixelDeltaY = sState.dfLastPixelDeltaY;
+        sState.dfResultX = (fabs(dfPixelDeltaX) * sState.dfLastResultX +
+                            fabs(dfLastPixelDeltaX) * sState.dfResultX) /
+                           (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
+        sState.dfResultY = (fabs(dfPixelDeltaY) * sState.dfLastResultY +
+                            fabs(dfLastPixelDeltaY) * sState.dfResultY) /
+                           (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
+        sState.bLastPixelDeltaValid = false;
+        sState.nCountConsecutiveErrorBelow2 = 0;
+        return false;
+    }
+
+    double dfBoostFactor = 1.0;
+    if (psTransform->poDS != nullptr &&
+        sState.nCountConsecutiveErrorBelow2 >= 5 && dfError < 2)
+    {
+        // When there is a DEM, if we remain below a given threshold
+        // (somewhat arbitrarily set to 2 pixels) for some time, apply a
+        // "boost factor" for the new guessed result, in the hope we will go
+        // out of the somewhat current stuck situation.
+        dfBoostFactor = 10;
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Applying boost factor 10");
+        }
+    }
+
+    if (dfError < 2)
+        sState.nCountConsecutiveErrorBelow2++;
+    else
+        sState.nCountConsecutiveErrorBelow2 = 0;
+
+    const double dfNewResultX =
+        sState.dfResultX -
+        (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
+         dfBoostFactor) -
+        (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
+         dfBoostFactor);
+    const double dfNewResultY =
+        sState.dfResultY -
+        (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
+         dfBoostFactor) -
+        (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
+         dfBoostFactor);
+
+    sState.dfLastResultX = sState.dfResultX;
+    sState.dfLastResultY = sState.dfResultY;
+    sState.dfResultX = dfNewResultX;
+    sState.dfResultY = dfNewResultY;
+    sState.dfLastPixelDeltaX = dfPixelDeltaX;
+    sState.dfLastPixelDeltaY = dfPixelDeltaY;
+    sState.bLastPixelDeltaValid = true;
+    return false;
+}
+
+/************************************************************************/
+/*                      RPCInverseMaxIterations()                       */
+/************************************************************************/
+
+static int RPCInverseMaxIterations(const GDALRPCTransformInfo *psTransform)
+{
+    return (psTransform->nMaxIterations > 0) ? psTransform->nMaxIterations
+           : (psTransform->poDS != nullptr)  ? 20
+                                             : 10;
+}
+
+/************************************************************************/
+/*                      RPCInverseTransformPoint()                      */
+/************************************************************************/
+
+static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
+                                     double dfPixel, double dfLine,
+                                     double dfUserHeight, double *pdfLong,
+                                     double *pdfLat)
+
+{
+    // Memo:
+    // Known to work with 40 iterations with DEM on all points (int coord and
+    // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
+
+    RPCInverseState sState;
+    RPCInverseInit(psTransform, dfPixel, dfLine, dfUserHeight, sState);
 
     if (psTransform->bRPCInverseVerbose)
     {
@@ -1168,200 +1535,137 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
     /*      Now iterate, trying to find a closer LL location that will      */
     /*      back transform to the indicated pixel and line.                 */
     /* -------------------------------------------------------------------- */
-    double dfPixelDeltaX = 0.0;
-    double dfPixelDeltaY = 0.0;
-    double dfLastResultX = 0.0;
-    double dfLastResultY = 0.0;
-    double dfLastPixelDeltaX = 0.0;
-    double dfLastPixelDeltaY = 0.0;
-    bool bLastPixelDeltaValid = false;
-    const int nMaxIterations = (psTransform->nMaxIterations > 0)
-                                   ? psTransform->nMaxIterations
-                               : (psTransform->poDS != nullptr) ? 20
-                                                                : 10;
-    int nCountConsecutiveErrorBelow2 = 0;
+    const int nMaxIterations = RPCInverseMaxIterations(psTransform);
 
     int iIter = 0;  // Used after for.
     for (; iIter < nMaxIterations; iIter++)
     {
-        double dfBackPixel = 0.0;
-        double dfBackLine = 0.0;
-
         // Update DEMH.
         double dfDEMH = 0.0;
-        double dfDEMPixel = 0.0;
-        double dfDEMLine = 0.0;
-        if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
-                                       &dfDEMH, &dfDEMPixel, &dfDEMLine))
+        if (!RPCInverseGetHeight(psTransform, iIter, sState, &dfDEMH))
         {
-            if (psTransform->poDS)
-            {
-                CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
-                         dfDEMLine);
-            }
-
-            // The first time, the guess might be completely out of the
-            // validity of the DEM, so pickup the "reference Z" as the
-            // first guess or the closest point of the DEM by snapping to it.
-            if (iIter == 0)
-            {
-                bool bUseRefZ = true;
-                if (psTransform->poDS)
-                {
-                    if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
-                        dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
-                        dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
-                                            &dfDEMH))
-                    {
-                        bUseRefZ = false;
-                        CPLDebug("RPC",
-                                 "Iteration %d for (pixel, line) = (%g, %g): "
-                                 "No elevation value at %.15g %.15g. "
-                                 "Using elevation %g at DEM (pixel, line) = "
-                                 "(%g, %g) (snapping to boundaries) instead",
-                                 iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                                 dfDEMH, dfDEMPixel, dfDEMLine);
-                    }
-                }
-                if (bUseRefZ)
-                {
-                    dfDEMH = psTransform->dfRefZ;
-                    CPLDebug("RPC",
-                             "Iteration %d for (pixel, line) = (%g, %g): "
-                             "No elevation value at %.15g %.15g. "
-                             "Using elevation %g of reference point instead",
-                             iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                             dfDEMH);
-                }
-            }
-            else
-            {
-                CPLDebug("RPC",
-                         "Iteration %d for (pixel, line) = (%g, %g): "
-                         "No elevation value at %.15g %.15g. Erroring out",
-                         iIter, dfPixel, dfLine, dfResultX, dfResultY);
-                if (fpLog)
-                    VSIFCloseL(fpLog);
-                return false;
-            }
+            if (fpLog)
+                VSIFCloseL(fpLog);
+            return false;
         }
 
+        const double dfResultX = sState.dfResultX;
+        const double dfResultY = sState.dfResultY;
+        double dfBackPixel = 0.0;
+        double dfBackLine = 0.0;
         RPCTransformPoint(psTransform, dfResultX, dfResultY,
                           dfUserHeight + dfDEMH, &dfBackPixel, &dfBackLine);
 
-        dfPixelDeltaX = dfBackPixel - dfPixel;
-        dfPixelDeltaY = dfBackLine - dfLine;
+        const bool bConverged =
+            RPCInverseUpdate(psTransform, iIter, dfUserHeight + dfDEMH,
+                             dfBackPixel, dfBackLine, sState);
 
-        if (psTransform->bRPCInverseVerbose)
-        {
-            CPLDebug("RPC",
-                     "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
-                     "long=%f, lat=%f, height=%f",
-                     iIter, dfPixelDeltaX, dfPixelDeltaY, dfResultX, dfResultY,
-                     dfUserHeight + dfDEMH);
-        }
         if (fpLog != nullptr)
         {
             VSIFPrintfL(fpLog,
                         "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
                         iIter, dfResultX, dfResultY, dfUserHeight + dfDEMH,
-                        dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
+                        dfResultX, dfResultY, sState.dfPixelDeltaX,
+                        sState.dfPixelDeltaY);
         }
 
-        const double dfError =
-            std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
-        if (dfError < psTransform->dfPixErrThreshold)
+        if (bConverged)
         {
-            iIter = -1;
-            if (psTransform->bRPCInverseVerbose)
-            {
-                CPLDebug("RPC", "Converged!");
-            }
-            break;
+            *pdfLong = dfResultX;
+            *pdfLat = dfResultY;
+            if (fpLog != nullptr)
+                VSIFCloseL(fpLog);
+            return true;
         }
-        else if (psTransform->poDS != nullptr && bLastPixelDeltaValid &&
-                 dfPixelDeltaX * dfLastPixelDeltaX < 0 &&
-                 dfPixelDeltaY * dfLastPixelDeltaY < 0)
+    }
+    if (fpLog != nullptr)
+        VSIFCloseL(fpLog);
+
+    CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
+             iIter, sState.dfResultX, sState.dfResultY, sState.dfPixelDeltaX,
+             sState.dfPixelDeltaY);
+    return false;
+}
+
+/************************************************************************/
+/*                      RPCInverseTransformPoints()                     */
+/************************************************************************/
+
+// Same as RPCInverseTransformPoint() applied to an array of points, but
+// iterating on all the points at once: at each iteration, the heights of the
+// points that have not converged yet are fetched in the DEM, and then the
+// RPC polynomials are evaluated on all of them with RPCTransformPoints().
+// Converged or failed points are removed from the set of active points.
+static void RPCInverseTransformPoints(GDALRPCTransformInfo *psTransform,
+                                      int nPointCount, const double *padfPixel,
+                                      const double *padfLine,
+                                      const double *padfUserHeight,
+                                      double *padfLong, double *padfLat,
+                                      int *panSuccess)
+{
+    std::vector<RPCInverseState> asStates(nPointCount);
+    std::vector<int> anActive(nPointCount);
+    for (int i = 0; i < nPointCount; i++)
+    {
+        RPCInverseInit(psTransform, padfPixel[i], padfLine[i],
+                       padfUserHeight[i], asStates[i]);
+        anActive[i] = i;
+        panSuccess[i] = FALSE;
+    }
+
+    std::vector<double> adfX(nPointCount);
+    std::vector<double> adfY(nPointCount);
+    std::vector<double> adfHeight(nPointCount);
+    std::vector<double> adfBackPixel(nPointCount);
+    std::vector<double> adfBackLine(nPointCount);
+
+    const int nMaxIterations = RPCInverseMaxIterations(psTransform);
+    int iIter = 0;
+    for (; iIter < nMaxIterations && !anActive.empty(); iIter++)
+    {
+        size_t nActive = 0;
+        for (const int i : anActive)
         {
-            // When there is a DEM, if the error changes sign, we might
-            // oscillate forever, so take a mean position as a new guess.
-            if (psTransform->bRPCInverseVerbose)
-            {
-                CPLDebug("RPC",
-                         "Oscillation detected. "
-                         "Taking mean of 2 previous results as new guess");
-            }
-            dfResultX = (fabs(dfPixelDeltaX) * dfLastResultX +
-                         fabs(dfLastPixelDeltaX) * dfResultX) /
-                        (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
-            dfResultY = (fabs(dfPixelDeltaY) * dfLastResultY +
-                         fabs(dfLastPixelDeltaY) * dfResultY) /
-                        (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
-            bLastPixelDeltaValid = false;
-            nCountConsecutiveErrorBelow2 = 0;
-            continue;
+            double dfDEMH = 0.0;
+            if (!RPCInverseGetHeight(psTransform, iIter, asStates[i], &dfDEMH))
+                continue;
+            anActive[nActive] = i;
+            adfX[nActive] = asStates[i].dfResultX;
+            adfY[nActive] = asStates[i].dfResultY;
+            adfHeight[nActive] = asStates[i].dfUserHeight + dfDEMH;
+            ++nActive;
         }
+        anActive.resize(nActive);
 
-        double dfBoostFactor = 1.0;
-        if (psTransform->poDS != nullptr && nCountConsecutiveErrorBelow2 >= 5 &&
-            dfError < 2)
+        RPCTransformPoints(psTransform, static_cast<int>(nActive), adfX.data(),
+                           adfY.data(), adfHeight.data(), adfBackPixel.data(),
+                           adfBackLine.data());
+
+        size_t nStillActive = 0;
+        for (size_t k = 0; k < nActive; ++k)
         {
-            // When there is a DEM, if we remain below a given threshold
-            // (somewhat arbitrarily set to 2 pixels) for some time, apply a
-            // "boost factor" for the new guessed result, in the hope we will go
-            // out of the somewhat current stuck situation.
-            dfBoostFactor = 10;
-            if (psTransform->bRPCInverseVerbose)
+            const int i = anActive[k];
+            if (RPCInverseUpdate(psTransform, iIter, adfHeight[k],
+                                 adfBackPixel[k], adfBackLine[k], asStates[i]))
             {
-                CPLDebug("RPC", "Applying boost factor 10");
+                padfLong[i] = adfX[k];
+                padfLat[i] = adfY[k];
+                panSuccess[i] = TRUE;
+            }
+            else
+            {
+                anActive[nStillActive++] = i;
             }
         }
-
-        if (dfError < 2)
-            nCountConsecutiveErrorBelow2++;
-        else
-            nCountConsecutiveErrorBelow2 = 0;
-
-        const double dfNewResultX =
-            dfResultX -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
-             dfBoostFactor);
-        const double dfNewResultY =
-            dfResultY -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
-             dfBoostFactor);
-
-        dfLastResultX = dfResultX;
-        dfLastResultY = dfResultY;
-        dfResultX = dfNewResultX;
-        dfResultY = dfNewResultY;
-        dfLastPixelDeltaX = dfPixelDeltaX;
-        dfLastPixelDeltaY = dfPixelDeltaY;
-        bLastPixelDeltaValid = true;
+        anActive.resize(nStillActive);
     }
-    if (fpLog != nullptr)
-        VSIFCloseL(fpLog);
 
-    if (iIter != -1)
+    for (const int i : anActive)
     {
         CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
-                 iIter, dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        return false;
+                 iIter, asStates[i].dfResultX, asStates[i].dfResultY,
+                 asStates[i].dfPixelDeltaX, asStates[i].dfPixelDeltaY);
     }
-
-    *pdfLong = dfResultX;
-    *pdfLat = dfResultY;
-    return true;
 }
 
 /************************************************************************/
@@ -1438,6 +1742,9 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
         return FALSE;
     }
 
+    // Heights of the points, which are transformed by batches at the end.
+    std::vector<double> adfHeight(nPointCount);
+
     int bGotNoDataValue = FALSE;
     const double dfNoDataValue =
         psTransform->poDS->GetRasterBand(1)->GetNoDataValue(&bGotNoDataValue);
@@ -1559,11 +1866,9 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = adfElevData[k_valid_sample];
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        adfHeight[i] =
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale;
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1579,11 +1884,9 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = psTransform->dfDEMMissingValue;
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        adfHeight[i] =
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale;
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1639,16 +1942,18 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
             padfY[i] = HUGE_VAL;
             continue;
         }
-        RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                          dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                      psTransform->dfHeightScale,
-                          padfX + i, padfY + i);
+        adfHeight[i] =
+            dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
+                        psTransform->dfHeightScale;
 
         panSuccess[i] = TRUE;
     }
 
     VSIFree(padfDEMBuffer);
 
+    RPCTransformValidPoints(psTransform, nPointCount, padfX, padfY,
+                            adfHeight.data(), panSuccess);
+
     return bRet;
 }
 
@@ -1911,6 +2216,9 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        // Fetch the heights of all points first, so that the RPC polynomials
+        // can then be evaluated by batches.
+        std::vector<double> adfHeight(nPointCount);
         int bRet = TRUE;
         for (int i = 0; i < nPointCount; i++)
         {
@@ -1933,12 +2241,13 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
                 continue;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
+            adfHeight[i] = (padfZ ? padfZ[i] : 0.0) + dfHeight;
             panSuccess[i] = TRUE;
         }
 
+        RPCTransformValidPoints(psTransform, nPointCount, padfX, padfY,
+                                adfHeight.data(), panSuccess);
+
         return bRet;
     }
 
@@ -1956,14 +2265,38 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
     /*      function uses an iterative method from an initial linear        */
     /*      approximation.                                                  */
     /* -------------------------------------------------------------------- */
+    // The verbose output and the log file of the inverse transformation are
+    // only meaningful when points are processed one at a time.
+    std::vector<double> adfResultX;
+    std::vector<double> adfResultY;
+    std::vector<int> anInverseSuccess;
+    const bool bBatched = nPointCount > 1 && !psTransform->bRPCInverseVerbose &&
+                          psTransform->pszRPCInverseLog == nullptr;
+    if (bBatched)
+    {
+        adfResultX.resize(nPointCount);
+        adfResultY.resize(nPointCount);
+        anInverseSuccess.resize(nPointCount);
+        RPCInverseTransformPoints(psTransform, nPointCount, padfX, padfY, padfZ,
+                                  adfResultX.data(), adfResultY.data(),
+                                  anInverseSuccess.data());
+    }
+
     int bRet = TRUE;
     for (int i = 0; i < nPointCount; i++)
     {
         double dfResultX = 0.0;
         double dfResultY = 0.0;
 
-        if (!RPCInverseTransformPoint(psTransform, padfX[i], padfY[i], padfZ[i],
-                                      &dfResultX, &dfResultY))
+        if (bBatched)
+        {
+            dfResultX = adfResultX[i];
+            dfResultY = adfResultY[i];
+        }
+        if (bBatched ? !anInverseSuccess[i]
+                     : !RPCInverseTransformPoint(psTransform, padfX[i],
+                                                 padfY[i], padfZ[i],
+                                                 &dfResultX, &dfResultY))
         {
             bRet = FALSE;
             panSuccess[i] = FALSE;
@@ -16,7 +16,9 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <utility>
 
 #include "cpl_atomic_ops.h"
@@ -30,6 +32,7 @@
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "gdalgenericinverse.h"
+#include "gdal_thread_pool.h"
 
 CPL_C_START
 CPLXMLNode *GDALSerializeTPSTransformer(void *pTransformArg);
@@ -40,14 +43,22 @@ struct TPSTransformInfo
 {
     GDALTransformerInfo sTI{};
 
-    VizGeorefSpline2D *poForward{};
-    VizGeorefSpline2D *poReverse{};
+    // Splines may be shared with transformers created by
+    // GDALCreateSimilarTPSTransformer()
+    std::shared_ptr<VizGeorefSpline2D> poForward{};
+    std::shared_ptr<VizGeorefSpline2D> poReverse{};
     bool bForwardSolved{};
     bool bReverseSolved{};
     double dfSrcApproxErrorReverse{};
 
     bool bReversed{};
 
+    // Ratio between the pixel/line coordinates of the GCPs used to fit the
+    // splines, and the pixel/line coordinates of this transformer.
+    double dfPixelLineRatio = 1.0;
+
+    int nThreads = 1;
+
     std::vector<gdal::GCP> asGCPs{};
 
     volatile int nRefCount{};
@@ -71,6 +82,33 @@ static void *GDALCreateSimilarTPSTransformer(void *hTransformArg,
         // is thread-safe.
         CPLAtomicInc(&(psInfo->nRefCount));
     }
+    else if (dfRatioX == dfRatioY)
+    {
+        // Thin plate splines are invariant by a uniform scaling of their
+        // input coordinates, and linear in their output values, so the
+        // splines fitted on the GCPs scaled by dfRatioX are the ones of the
+        // source transformer, with pixel/line coordinates scaled. This avoids
+        // solving again the linear systems, which is expensive for large
+        // numbers of GCPs.
+        TPSTransformInfo *psNewInfo = new TPSTransformInfo();
+        psNewInfo->sTI = psInfo->sTI;
+        psNewInfo->poForward = psInfo->poForward;
+        psNewInfo->poReverse = psInfo->poReverse;
+        psNewInfo->bForwardSolved = psInfo->bForwardSolved;
+        psNewInfo->bReverseSolved = psInfo->bReverseSolved;
+        psNewInfo->dfSrcApproxErrorReverse = psInfo->dfSrcApproxErrorReverse;
+        psNewInfo->bReversed = psInfo->bReversed;
+        psNewInfo->dfPixelLineRatio = psInfo->dfPixelLineRatio * dfRatioX;
+        psNewInfo->nThreads = psInfo->nThreads;
+        psNewInfo->asGCPs = psInfo->asGCPs;
+        for (auto &gcp : psNewInfo->asGCPs)
+        {
+            gcp.Pixel() /= dfRatioX;
+            gcp.Line() /= dfRatioY;
+        }
+        psNewInfo->nRefCount = 1;
+        psInfo = psNewInfo;
+    }
     else
     {
         auto newGCPs = psInfo->asGCPs;
@@ -145,8 +183,8 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
     psInfo->asGCPs = gdal::GCP::fromC(pasGCPList, nGCPCount);
 
     psInfo->bReversed = CPL_TO_BOOL(bReversed);
-    psInfo->poForward = new VizGeorefSpline2D(2);
-    psInfo->poReverse = new VizGeorefSpline2D(2);
+    psInfo->poForward = std::make_shared<VizGeorefSpline2D>(2);
+    psInfo->poReverse = std::make_shared<VizGeorefSpline2D>(2);
 
     memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
@@ -239,12 +277,11 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
             CSLFetchNameValue(papszOptions, "NUM_THREADS");
         if (pszWarpThreads == nullptr)
             pszWarpThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-        if (EQUAL(pszWarpThreads, "ALL_CPUS"))
-            nThreads = CPLGetNumCPUs();
-        else
-            nThreads = atoi(pszWarpThreads);
+        nThreads = CPLParseNumThreads(pszWarpThreads, 128);
     }
 
+    psInfo->nThreads = nThreads;
+
     if (nThreads > 1)
     {
         // Compute direct and reverse transforms in parallel.
@@ -295,13 +332,76 @@ void GDALDestroyTPSTransformer(void *pTransformArg)
 
     if (CPLAtomicDec(&(psInfo->nRefCount)) == 0)
     {
-        delete psInfo->poForward;
-        delete psInfo->poReverse;
-
         delete psInfo;
     }
 }
 
+/************************************************************************/
+/*                       GDALTPSTransformPoints()                       */
+/************************************************************************/
+
+// Transform points of index [nStart, nEnd[
+static void GDALTPSTransformPoints(const TPSTransformInfo *psInfo,
+                                   int bDstToSrc, int nStart, int nEnd,
+                                   double *x, double *y, int *panSuccess)
+{
+    // Pixel/line coordinates are on the input side of the transformation
+    // when bDstToSrc == bReversed, and on the output side otherwise.
+    const double dfRatio = psInfo->dfPixelLineRatio;
+    const bool bPixelLineIsInput = CPL_TO_BOOL(bDstToSrc) == psInfo->bReversed;
+
+    for (int i = nStart; i < nEnd; i++)
+    {
+        double xy_out[2] = {0.0, 0.0};
+        double xIn = x[i];
+        double yIn = y[i];
+        if (bPixelLineIsInput)
+        {
+            xIn *= dfRatio;
+            yIn *= dfRatio;
+        }
+
+        if (bDstToSrc)
+        {
+            // Compute initial guess
+            psInfo->poReverse->get_point(xIn, yIn, xy_out);
+
+            const auto ForwardTransformer = [](double xIn2, double yIn2,
+                                               double &xOut, double &yOut,
+                                               void *pUserData)
+            {
+                double xyOut[2] = {0.0, 0.0};
+                const TPSTransformInfo *l_psInfo =
+                    static_cast<const TPSTransformInfo *>(pUserData);
+                l_psInfo->poForward->get_point(xIn2, yIn2, xyOut);
+                xOut = xyOut[0];
+                yOut = xyOut[1];
+                return true;
+            };
+
+            // Refine the initial guess
+            GDALGenericInverse2D(
+                xIn, yIn, xy_out[0], xy_out[1], ForwardTransformer,
+                const_cast<TPSTransformInfo *>(psInfo), xy_out[0], xy_out[1],
+                /* computeJacobianMatrixOnlyAtFirstIter = */ true,
+                /* toleranceOnOutputCoordinates = */ 0,
+                psInfo->dfSrcApproxErrorReverse);
+        }
+        else
+        {
+            psInfo->poForward->get_point(xIn, yIn, xy_out);
+        }
+        if (!bPixelLineIsInput)
+        {
+            xy_out[0] /= dfRatio;
+            xy_out[1] /= dfRatio;
+        }
+        x[i] = xy_out[0];
+        y[i] = xy_out[1];
+        panSuccess[i] = TRUE;
+    }
+}
+
 /************************************************************************/
 /*                          GDALTPSTransform()                          */
 /************************************************************************/
@@ -335,45 +435,41 @@ int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
 
     TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
 
-    for (int i = 0; i < nPointCount; i++)
+    // Evaluating the splines costs one radial basis function per GCP and per
+    // point, so with large numbers of GCPs, split the points between several
+    // threads, with at least about one million basis function evaluations
+    // per job.
+    const size_t nGCPCount = std::max<size_t>(1, psInfo->asGCPs.size());
+    const int nMinPointsPerJob =
+        static_cast<int>(std::max<size_t>(16, 1000 * 1000 / nGCPCount));
+    const int nJobs =
+        std::min(psInfo->nThreads, nPointCount / nMinPointsPerJob);
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(psInfo->nThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue)
     {
-        double xy_out[2] = {0.0, 0.0};
-
-        if (bDstToSrc)
-        {
-            // Compute initial guess
-            psInfo->poReverse->get_point(x[i], y[i], xy_out);
-
-            const auto ForwardTransformer = [](double xIn, double yIn,
-                                               double &xOut, double &yOut,
-                                               void *pUserData)
-            {
-                double xyOut[2] = {0.0, 0.0};
-                TPSTransformInfo *l_psInfo =
-                    static_cast<TPSTransformInfo *>(pUserData);
-                l_psInfo->poForward->get_point(xIn, yIn, xyOut);
-                xOut = xyOut[0];
-                yOut = xyOut[1];
-                return true;
-            };
-
-            // Refine the initial guess
-            GDALGenericInverse2D(
-                x[i], y[i], xy_out[0], xy_out[1], ForwardTransformer, psInfo,
-                xy_out[0], xy_out[1],
-                /* computeJacobianMatrixOnlyAtFirstIter = */ true,
-                /* toleranceOnOutputCoordinates = */ 0,
-                psInfo->dfSrcApproxErrorReverse);
-            x[i] = xy_out[0];
-            y[i] = xy_out[1];
-        }
-        else
+        for (int iJob = 0; iJob < nJobs; ++iJob)
         {
-            psInfo->poForward->get_point(x[i], y[i], xy_out);
-            x[i] = xy_out[0];
-            y[i] = xy_out[1];
+            const int nStart =
+                static_cast<int>(static_cast<int64_t>(nPointCount) * iJob /
+                                 nJobs);
+            const int nEnd =
+                static_cast<int>(static_cast<int64_t>(nPointCount) *
+                                 (iJob + 1) / nJobs);
+            poQueue->SubmitJob(
+                [psInfo, bDstToSrc, nStart, nEnd, x, y, panSuccess]()
+                {
+                    GDALTPSTransformPoints(psInfo, bDstToSrc, nStart, nEnd, x,
+                                           y, panSuccess);
+                });
         }
-        panSuccess[i] = TRUE;
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        GDALTPSTransformPoints(psInfo, bDstToSrc, 0, nPointCount, x, y,
+                               panSuccess);
     }
 
     return TRUE;
@@ -16,13 +16,319 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#define HAVE_SSE2_CHECKSUM
+#endif
+
+namespace
+{
+
+constexpr int anPrimes[11] = {7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43};
+
+/************************************************************************/
+/*                          ChecksumTermsSum()                          */
+/************************************************************************/
+
+// Return the sum of panVals[i] % anPrimes[(iPrime + i) % 11], which is the
+// contribution of nCount consecutive values to the checksum.
+int64_t ChecksumTermsSum(const GInt32 *panVals, size_t nCount, int iPrime)
+{
+    int64_t nSum = 0;
+    size_t i = 0;
+#ifdef HAVE_SSE2_CHECKSUM
+    // The remainders are computed on 2 doubles at a time as
+    // x - trunc((x +/- 0.5) / p) * p. Shifting x by half a unit away from
+    // zero keeps the quotient at least 0.5 / 43 away from an integer, which
+    // is far larger than the rounding error of the multiplication by the
+    // inverse of p, so this is exactly the C++ remainder of integers.
+    // The divisors repeat every 11 values, hence every 11 vectors of 4 values.
+    constexpr int PERIOD = 44;
+    if (nCount >= PERIOD)
+    {
+        double adfPrimes[PERIOD];
+        double adfInvPrimes[PERIOD];
+        for (int k = 0; k < PERIOD; ++k)
+        {
+            adfPrimes[k] = anPrimes[(iPrime + k) % 11];
+            adfInvPrimes[k] = 1.0 / adfPrimes[k];
+        }
+        const __m128d signMask = _mm_set1_pd(-0.0);
+        const __m128d half = _mm_set1_pd(0.5);
+        const auto Remainder = [signMask, half](__m128d x, const double *padfP,
+                                                const double *padfInvP)
+        {
+            const __m128d xShifted =
+                _mm_add_pd(x, _mm_or_pd(_mm_and_pd(x, signMask), half));
+            const __m128d q = _mm_cvtepi32_pd(_mm_cvttpd_epi32(
+                _mm_mul_pd(xShifted, _mm_loadu_pd(padfInvP))));
+            return _mm_sub_pd(x, _mm_mul_pd(q, _mm_loadu_pd(padfP)));
+        };
+
+        // Sums of remainders, whose absolute value is lower than 43, are
+        // exact in doubles.
+        __m128d sum = _mm_setzero_pd();
+        for (; i + PERIOD <= nCount; i += PERIOD)
+        {
+            for (int k = 0; k < PERIOD; k += 4)
+            {
+                const __m128i v = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(panVals + i + k));
+                sum = _mm_add_pd(sum, Remainder(_mm_cvtepi32_pd(v),
+                                                adfPrimes + k,
+                                                adfInvPrimes + k));
+                sum = _mm_add_pd(
+                    sum, Remainder(_mm_cvtepi32_pd(_mm_srli_si128(v, 8)),
+                                   adfPrimes + k + 2, adfInvPrimes + k + 2));
+            }
+        }
+        double adfSum[2];
+        _mm_storeu_pd(adfSum, sum);
+        nSum = static_cast<int64_t>(adfSum[0]) +
+               static_cast<int64_t>(adfSum[1]);
+        // i is a multiple of 11, so iPrime is unchanged
+    }
+#endif
+    for (; i < nCount; ++i)
+    {
+        nSum += panVals[i] % anPrimes[iPrime];
+        if (++iPrime == 11)
+            iPrime = 0;
+    }
+    return nSum;
+}
+
+/************************************************************************/
+/*                            IntFromDouble()                           */
+/************************************************************************/
+
+int IntFromDouble(double dfVal)
+{
+    int nVal;
+    if (!std::isfinite(dfVal))
+    {
+        nVal = INT_MIN;
+    }
+    else
+    {
+        // Standard behavior of GDALCopyWords when converting
+        // from floating point to Int32.
+        dfVal += 0.5;
+
+        if (dfVal < -2147483647.0)
+            nVal = -2147483647;
+        else if (dfVal > 2147483647)
+            nVal = 2147483647;
+        else
+            nVal = static_cast<GInt32>(floor(dfVal));
+    }
+    return nVal;
+}
+
+/************************************************************************/
+/*                          GetThreadSafeBand()                         */
+/************************************************************************/
+
+// Return the number of threads to use according to GDAL_NUM_THREADS, and, if
+// it is greater than 1, a reference on a thread-safe dataset from which
+// hBand can be read from several threads, in *ppoThreadSafeDS.
+// This is only done for datasets opened in read-only mode, since the
+// thread-safe dataset would not see pending changes of the source dataset.
+int GetThreadSafeBand(GDALRasterBandH hBand, int nJobs,
+                      GDALDataset **ppoThreadSafeDS)
+{
+    *ppoThreadSafeDS = nullptr;
+    const int nThreads = std::min(
+        nJobs,
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128));
+    if (nThreads <= 1)
+        return 1;
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    GDALDataset *poDS = poBand->GetDataset();
+    const int nBand = poBand->GetBand();
+    if (poDS == nullptr || poDS->GetAccess() != GA_ReadOnly || nBand <= 0 ||
+        poDS->GetRasterBand(nBand) != poBand)
+    {
+        return 1;
+    }
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        *ppoThreadSafeDS = GDALGetThreadSafeDataset(poDS, GDAL_OF_RASTER);
+    }
+    if (*ppoThreadSafeDS == nullptr)
+    {
+        CPLDebug("GDAL", "Dataset cannot be made thread-safe. "
+                         "Using a single thread");
+        return 1;
+    }
+    return nThreads;
+}
+
+/************************************************************************/
+/*                           RunJobs()                                  */
+/************************************************************************/
+
+// Run pfnJob(iJob, hBand) for iJob in [0, nJobs[, on several threads if
+// hBand can be read from several threads. Return false if a job failed.
+bool RunJobs(GDALRasterBandH hBand, int nJobs,
+             const std::function<bool(int, GDALRasterBandH)> &pfnJob)
+{
+    GDALDataset *poThreadSafeDS = nullptr;
+    const int nThreads = GetThreadSafeBand(hBand, nJobs, &poThreadSafeDS);
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    bool bOK = true;
+    if (poPool)
+    {
+        GDALRasterBandH hThreadSafeBand =
+            GDALRasterBand::ToHandle(poThreadSafeDS->GetRasterBand(
+                GDALRasterBand::FromHandle(hBand)->GetBand()));
+        std::atomic<bool> bError{false};
+        auto poQueue = poPool->CreateJobQueue();
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            poQueue->SubmitJob(
+                [&pfnJob, &bError, iJob, hThreadSafeBand]()
+                {
+                    if (!bError && !pfnJob(iJob, hThreadSafeBand))
+                        bError = true;
+                });
+        }
+        poQueue->WaitCompletion();
+        bOK = !bError;
+    }
+    else
+    {
+        for (int iJob = 0; bOK && iJob < nJobs; ++iJob)
+            bOK = pfnJob(iJob, hBand);
+    }
+    if (poThreadSafeDS)
+        poThreadSafeDS->ReleaseRef();
+    return bOK;
+}
+
+/************************************************************************/
+/*                               XXH64()                                */
+/************************************************************************/
+
+// One-shot implementation of the XXH64 hash function of xxHash
+// (https://github.com/Cyan4973/xxHash), with the reference values of
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t XXHRotl64(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t XXHRead64(const GByte *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    CPL_LSBPTR64(&v);
+    return v;
+}
+
+inline uint32_t XXHRead32(const GByte *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    CPL_LSBPTR32(&v);
+    return v;
+}
+
+inline uint64_t XXHRound(uint64_t nAcc, uint64_t nInput)
+{
+    nAcc += nInput * XXH_PRIME64_2;
+    nAcc = XXHRotl64(nAcc, 31);
+    return nAcc * XXH_PRIME64_1;
+}
+
+inline uint64_t XXHMergeRound(uint64_t nAcc, uint64_t nVal)
+{
+    nAcc ^= XXHRound(0, nVal);
+    return nAcc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t XXH64(const void *pData, size_t nLen, uint64_t nSeed)
+{
+    const GByte *p = static_cast<const GByte *>(pData);
+    const GByte *const pEnd = p + nLen;
+    uint64_t h;
+    if (nLen >= 32)
+    {
+        uint64_t v1 = nSeed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = nSeed + XXH_PRIME64_2;
+        uint64_t v3 = nSeed;
+        uint64_t v4 = nSeed - XXH_PRIME64_1;
+        const GByte *const pLimit = pEnd - 32;
+        do
+        {
+            v1 = XXHRound(v1, XXHRead64(p));
+            v2 = XXHRound(v2, XXHRead64(p + 8));
+            v3 = XXHRound(v3, XXHRead64(p + 16));
+            v4 = XXHRound(v4, XXHRead64(p + 24));
+            p += 32;
+        } while (p <= pLimit);
+        h = XXHRotl64(v1, 1) + XXHRotl64(v2, 7) + XXHRotl64(v3, 12) +
+            XXHRotl64(v4, 18);
+        h = XXHMergeRound(h, v1);
+        h = XXHMergeRound(h, v2);
+        h = XXHMergeRound(h, v3);
+        h = XXHMergeRound(h, v4);
+    }
+    else
+    {
+        h = nSeed + XXH_PRIME64_5;
+    }
+    h += static_cast<uint64_t>(nLen);
+
+    for (; p + 8 <= pEnd; p += 8)
+    {
+        h ^= XXHRound(0, XXHRead64(p));
+        h = XXHRotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (p + 4 <= pEnd)
+    {
+        h ^= static_cast<uint64_t>(XXHRead32(p)) * XXH_PRIME64_1;
+        h = XXHRotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    for (; p < pEnd; ++p)
+    {
+        h ^= (*p) * XXH_PRIME64_5;
+        h = XXHRotl64(h, 11) * XXH_PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
 
 /************************************************************************/
 /*                         GDALChecksumImage()                          */
@@ -36,6 +342,13 @@
  * so decimal portions of such raster data will not affect the checksum.
  * Real and Imaginary components of complex bands influence the result.
  *
+ * The region is read by chunks aligned on the blocks of the band. Starting
+ * with GDAL 3.11, if the GDAL_NUM_THREADS configuration option is set, and
+ * the dataset of the band is opened in read-only mode and is, or can be
+ * turned into, a thread-safe dataset (see GDALGetThreadSafeDataset()),
+ * chunks are read and processed by several threads. The result does not
+ * depend on the number of threads.
+ *
  * @param hBand the raster band to read from.
  * @param nXOff pixel offset of window to read.
  * @param nYOff line offset of window to read.
@@ -51,308 +364,284 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
 {
     VALIDATE_POINTER1(hBand, "GDALChecksumImage", 0);
 
-    const static int anPrimes[11] = {7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43};
+    if (nXSize <= 0 || nYSize <= 0)
+        return 0;
 
-    int nChecksum = 0;
-    int iPrime = 0;
     const GDALDataType eDataType = GDALGetRasterDataType(hBand);
     const bool bComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eDataType));
     const bool bIsFloatingPoint =
         (eDataType == GDT_Float16 || eDataType == GDT_Float32 ||
          eDataType == GDT_Float64 || eDataType == GDT_CFloat16 ||
          eDataType == GDT_CFloat32 || eDataType == GDT_CFloat64);
+    const GDALDataType eDstDataType =
+        bIsFloatingPoint ? (bComplex ? GDT_CFloat64 : GDT_Float64)
+                         : (bComplex ? GDT_CInt32 : GDT_Int32);
+    const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
+    const int nValsPerIter = bComplex ? 2 : 1;
 
-    const auto IntFromDouble = [](double dfVal)
+    /* -------------------------------------------------------------------- */
+    /*      Split the region into chunks aligned on blocks.                 */
+    /* -------------------------------------------------------------------- */
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
+    nBlockXSize = std::max(1, nBlockXSize);
+    const int nChunkYSize = std::max(1, nBlockYSize);
+    int nChunkXSize = nXSize;
+    if (nBlockXSize < nXSize)
     {
-        int nVal;
-        if (!std::isfinite(dfVal))
+        const GIntBig nMaxChunkSize =
+            std::max(static_cast<GIntBig>(10 * 1000 * 1000),
+                     GDALGetCacheMax64() / 10);
+        if (static_cast<GIntBig>(nXSize) * nChunkYSize >=
+            nMaxChunkSize / nDstDataTypeSize)
         {
-            nVal = INT_MIN;
+            // A full line of height nChunkYSize does not fit in the maximum
+            // allowed memory: use a size that is a multiple of nBlockXSize
+            nChunkXSize = static_cast<int>(std::min(
+                static_cast<GIntBig>(nXSize),
+                nBlockXSize *
+                    std::max(static_cast<GIntBig>(1),
+                             nMaxChunkSize /
+                                 (static_cast<GIntBig>(nBlockXSize) *
+                                  nChunkYSize * nDstDataTypeSize))));
+        }
+    }
+
+    // Boundaries of chunks, in raster coordinates
+    const auto GetBoundaries = [](int nOff, int nSize, int nChunkSize)
+    {
+        std::vector<int> anBoundaries{nOff};
+        if (nChunkSize >= nSize)
+        {
+            anBoundaries.push_back(nOff + nSize);
         }
         else
         {
-            // Standard behavior of GDALCopyWords when converting
-            // from floating point to Int32.
-            dfVal += 0.5;
-
-            if (dfVal < -2147483647.0)
-                nVal = -2147483647;
-            else if (dfVal > 2147483647)
-                nVal = 2147483647;
-            else
-                nVal = static_cast<GInt32>(floor(dfVal));
+            for (int i = (nOff / nChunkSize + 1) * nChunkSize;
+                 i < nOff + nSize; i += nChunkSize)
+                anBoundaries.push_back(i);
+            anBoundaries.push_back(nOff + nSize);
         }
-        return nVal;
+        return anBoundaries;
     };
+    const std::vector<int> anXBoundaries =
+        GetBoundaries(nXOff, nXSize, nChunkXSize);
+    const std::vector<int> anYBoundaries =
+        GetBoundaries(nYOff, nYSize, nChunkYSize);
+    const int nXChunks = static_cast<int>(anXBoundaries.size()) - 1;
+    const int nYChunks = static_cast<int>(anYBoundaries.size()) - 1;
+    if (static_cast<GIntBig>(nXChunks) * nYChunks > INT_MAX)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too many chunks");
+        return -1;
+    }
+    const int nChunks = nXChunks * nYChunks;
 
-    if (bIsFloatingPoint && nXOff == 0 && nYOff == 0)
+    /* -------------------------------------------------------------------- */
+    /*      The checksum is the sum, modulo 65536, of the remainders of     */
+    /*      the values by a prime number that depends on their index in     */
+    /*      the region, so chunks can be processed independently.           */
+    /* -------------------------------------------------------------------- */
+    std::vector<int64_t> anSums(nChunks);
+    const auto ProcessChunk = [&](int iChunk, GDALRasterBandH hBandToRead)
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CFloat64 : GDT_Float64;
-        int nBlockXSize = 0;
-        int nBlockYSize = 0;
-        GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
-        const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
-        int nChunkXSize = nBlockXSize;
-        const int nChunkYSize = nBlockYSize;
-        if (nBlockXSize < nXSize)
+        const int iXStart = anXBoundaries[iChunk % nXChunks];
+        const int nChunkActualXSize =
+            anXBoundaries[iChunk % nXChunks + 1] - iXStart;
+        const int iYStart = anYBoundaries[iChunk / nXChunks];
+        const int nChunkActualYSize =
+            anYBoundaries[iChunk / nXChunks + 1] - iYStart;
+        const size_t nLineVals =
+            static_cast<size_t>(nValsPerIter) * nChunkActualXSize;
+
+        std::vector<GInt32> anVals;
+        std::vector<double> adfVals;
+        try
         {
-            const GIntBig nMaxChunkSize =
-                std::max(static_cast<GIntBig>(10 * 1000 * 1000),
-                         GDALGetCacheMax64() / 10);
-            if (nDstDataTypeSize > 0 &&
-                static_cast<GIntBig>(nXSize) * nChunkYSize <
-                    nMaxChunkSize / nDstDataTypeSize)
-            {
-                // A full line of height nChunkYSize can fit in the maximum
-                // allowed memory
-                nChunkXSize = nXSize;
-            }
-            else
-            {
-                // Otherwise compute a size that is a multiple of nBlockXSize
-                nChunkXSize = static_cast<int>(std::min(
-                    static_cast<GIntBig>(nXSize),
-                    nBlockXSize *
-                        std::max(static_cast<GIntBig>(1),
-                                 nMaxChunkSize /
-                                     (static_cast<GIntBig>(nBlockXSize) *
-                                      nChunkYSize * nDstDataTypeSize))));
-            }
+            anVals.resize(nLineVals * nChunkActualYSize);
+            if (bIsFloatingPoint)
+                adfVals.resize(anVals.size());
         }
-
-        double *padfLineData = static_cast<double *>(
-            VSI_MALLOC3_VERBOSE(nChunkXSize, nChunkYSize, nDstDataTypeSize));
-        if (padfLineData == nullptr)
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for checksum computation");
+            return false;
+        }
+        if (GDALRasterIO(hBandToRead, GF_Read, iXStart, iYStart,
+                         nChunkActualXSize, nChunkActualYSize,
+                         bIsFloatingPoint ? static_cast<void *>(adfVals.data())
+                                          : anVals.data(),
+                         nChunkActualXSize, nChunkActualYSize, eDstDataType, 0,
+                         0) != CE_None)
+        {
+            return false;
+        }
+        if (bIsFloatingPoint)
         {
-            return -1;
+            for (size_t i = 0; i < anVals.size(); ++i)
+                anVals[i] = IntFromDouble(adfVals[i]);
         }
-        const int nValsPerIter = bComplex ? 2 : 1;
 
-        const int nYBlocks = DIV_ROUND_UP(nYSize, nChunkYSize);
-        const int nXBlocks = DIV_ROUND_UP(nXSize, nChunkXSize);
-        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        int64_t nSum = 0;
+        for (int iY = 0; iY < nChunkActualYSize; ++iY)
         {
-            const int iYStart = iYBlock * nChunkYSize;
-            const int iYEnd =
-                iYBlock == nYBlocks - 1 ? nYSize : iYStart + nChunkYSize;
-            const int nChunkActualHeight = iYEnd - iYStart;
-            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-            {
-                const int iXStart = iXBlock * nChunkXSize;
-                const int iXEnd =
-                    iXBlock == nXBlocks - 1 ? nXSize : iXStart + nChunkXSize;
-                const int nChunkActualXSize = iXEnd - iXStart;
-                if (GDALRasterIO(
-                        hBand, GF_Read, iXStart, iYStart, nChunkActualXSize,
-                        nChunkActualHeight, padfLineData, nChunkActualXSize,
-                        nChunkActualHeight, eDstDataType, 0, 0) != CE_None)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO,
-                             "Checksum value could not be computed due to I/O "
-                             "read error.");
-                    nChecksum = -1;
-                    iYBlock = nYBlocks;
-                    break;
-                }
-                const size_t xIters =
-                    static_cast<size_t>(nValsPerIter) * nChunkActualXSize;
-                for (int iY = iYStart; iY < iYEnd; ++iY)
-                {
-                    // Initialize iPrime so that it is consistent with a
-                    // per full line iteration strategy
-                    iPrime = (nValsPerIter *
-                              (static_cast<int64_t>(iY) * nXSize + iXStart)) %
-                             11;
-                    const size_t nOffset = nValsPerIter *
-                                           static_cast<size_t>(iY - iYStart) *
-                                           nChunkActualXSize;
-                    for (size_t i = 0; i < xIters; ++i)
-                    {
-                        const double dfVal = padfLineData[nOffset + i];
-                        nChecksum += IntFromDouble(dfVal) % anPrimes[iPrime++];
-                        if (iPrime > 10)
-                            iPrime = 0;
-                    }
-                    nChecksum &= 0xffff;
-                }
-            }
+            // Index of the first value of the line in the region
+            const int64_t nIdx =
+                nValsPerIter *
+                (static_cast<int64_t>(iYStart + iY - nYOff) * nXSize +
+                 (iXStart - nXOff));
+            nSum += ChecksumTermsSum(anVals.data() + iY * nLineVals,
+                                     nLineVals, static_cast<int>(nIdx % 11));
         }
+        anSums[iChunk] = nSum;
+        return true;
+    };
 
-        CPLFree(padfLineData);
-    }
-    else if (bIsFloatingPoint)
+    if (!RunJobs(hBand, nChunks, ProcessChunk))
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CFloat64 : GDT_Float64;
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Checksum value could not be computed due to I/O "
+                 "read error.");
+        return -1;
+    }
 
-        double *padfLineData = static_cast<double *>(VSI_MALLOC2_VERBOSE(
-            nXSize, GDALGetDataTypeSizeBytes(eDstDataType)));
-        if (padfLineData == nullptr)
-        {
-            return -1;
-        }
+    int64_t nSum = 0;
+    for (const int64_t nChunkSum : anSums)
+        nSum += nChunkSum;
+    return static_cast<int>(((nSum % 65536) + 65536) % 65536);
+}
 
-        for (int iLine = nYOff; iLine < nYOff + nYSize; iLine++)
-        {
-            if (GDALRasterIO(hBand, GF_Read, nXOff, iLine, nXSize, 1,
-                             padfLineData, nXSize, 1, eDstDataType, 0,
-                             0) != CE_None)
-            {
-                CPLError(CE_Failure, CPLE_FileIO,
-                         "Checksum value couldn't be computed due to "
-                         "I/O read error.");
-                nChecksum = -1;
-                break;
-            }
-            const size_t nCount = bComplex ? static_cast<size_t>(nXSize) * 2
-                                           : static_cast<size_t>(nXSize);
+/************************************************************************/
+/*                       GDALContentHashImage()                         */
+/************************************************************************/
 
-            for (size_t i = 0; i < nCount; i++)
-            {
-                const double dfVal = padfLineData[i];
-                nChecksum += IntFromDouble(dfVal) % anPrimes[iPrime++];
-                if (iPrime > 10)
-                    iPrime = 0;
+/**
+ * Compute a 64-bit hash of the content of an image region.
+ *
+ * Contrary to GDALChecksumImage(), the hash is computed on the values of the
+ * pixels in the native data type of the band, so any change of a pixel value
+ * changes it, with a very high probability. It does not depend on the block
+ * layout or compression of the band, so it can be used to check whether two
+ * rasters have identical content, whatever their storage.
+ *
+ * The region is split into groups of lines, whose values, in little-endian
+ * byte order, are hashed with the XXH64 function of xxHash. The final hash is
+ * the XXH64 hash of the data type, dimensions of the region and size of the
+ * groups of lines, followed by the hashes of the groups. The value of the
+ * hash is thus specific to this function, and is not the XXH64 hash of the
+ * whole region.
+ *
+ * If the GDAL_NUM_THREADS configuration option is set, and the dataset of the
+ * band is opened in read-only mode and is, or can be turned into, a
+ * thread-safe dataset (see GDALGetThreadSafeDataset()), groups of lines are
+ * read and hashed by several threads. The result does not depend on the
+ * number of threads.
+ *
+ * @param hBand the raster band to read from.
+ * @param nXOff pixel offset of window to read.
+ * @param nYOff line offset of window to read.
+ * @param nXSize pixel size of window to read.
+ * @param nYSize line size of window to read.
+ * @param[out] pnHash Pointer to the hash value. Must not be NULL.
+ *
+ * @return CE_None in case of success, CE_Failure otherwise.
+ * @since GDAL 3.11
+ */
 
-                nChecksum &= 0xffff;
-            }
-        }
+CPLErr CPL_STDCALL GDALContentHashImage(GDALRasterBandH hBand, int nXOff,
+                                        int nYOff, int nXSize, int nYSize,
+                                        GUInt64 *pnHash)
 
-        CPLFree(padfLineData);
-    }
-    else if (nXOff == 0 && nYOff == 0)
+{
+    VALIDATE_POINTER1(hBand, "GDALContentHashImage", CE_Failure);
+    VALIDATE_POINTER1(pnHash, "GDALContentHashImage", CE_Failure);
+
+    *pnHash = 0;
+    if (nXSize <= 0 || nYSize <= 0 || nXOff < 0 || nYOff < 0 ||
+        nXSize > GDALGetRasterBandXSize(hBand) - nXOff ||
+        nYSize > GDALGetRasterBandYSize(hBand) - nYOff)
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CInt32 : GDT_Int32;
-        int nBlockXSize = 0;
-        int nBlockYSize = 0;
-        GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
-        const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
-        int nChunkXSize = nBlockXSize;
-        const int nChunkYSize = nBlockYSize;
-        if (nBlockXSize < nXSize)
-        {
-            const GIntBig nMaxChunkSize =
-                std::max(static_cast<GIntBig>(10 * 1000 * 1000),
-                         GDALGetCacheMax64() / 10);
-            if (nDstDataTypeSize > 0 &&
-                static_cast<GIntBig>(nXSize) * nChunkYSize <
-                    nMaxChunkSize / nDstDataTypeSize)
-            {
-                // A full line of height nChunkYSize can fit in the maximum
-                // allowed memory
-                nChunkXSize = nXSize;
-            }
-            else
-            {
-                // Otherwise compute a size that is a multiple of nBlockXSize
-                nChunkXSize = static_cast<int>(std::min(
-                    static_cast<GIntBig>(nXSize),
-                    nBlockXSize *
-                        std::max(static_cast<GIntBig>(1),
-                                 nMaxChunkSize /
-                                     (static_cast<GIntBig>(nBlockXSize) *
-                                      nChunkYSize * nDstDataTypeSize))));
-            }
-        }
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid window for content hash computation");
+        return CE_Failure;
+    }
+
+    const GDALDataType eDataType = GDALGetRasterDataType(hBand);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nLineSize = static_cast<size_t>(nXSize) * nDTSize;
+
+    /* -------------------------------------------------------------------- */
+    /*      The groups of lines only depend on the dimensions of the        */
+    /*      region, so that the hash does not depend on the block layout.   */
+    /* -------------------------------------------------------------------- */
+    constexpr size_t LEAF_SIZE = 1024 * 1024;
+    const int nLinesPerLeaf = static_cast<int>(std::min<size_t>(
+        nYSize, std::max<size_t>(1, LEAF_SIZE / nLineSize)));
+    const int nLeaves = DIV_ROUND_UP(nYSize, nLinesPerLeaf);
 
-        int *panChunkData = static_cast<GInt32 *>(
-            VSI_MALLOC3_VERBOSE(nChunkXSize, nChunkYSize, nDstDataTypeSize));
-        if (panChunkData == nullptr)
+    std::vector<uint64_t> anLeafHashes(nLeaves);
+    const auto ProcessLeaf = [&](int iLeaf, GDALRasterBandH hBandToRead)
+    {
+        const int iYStart = nYOff + iLeaf * nLinesPerLeaf;
+        const int nLeafYSize =
+            std::min(nLinesPerLeaf, nYOff + nYSize - iYStart);
+        std::vector<GByte> abyData;
+        try
         {
-            return -1;
+            abyData.resize(nLineSize * nLeafYSize);
         }
-        const int nValsPerIter = bComplex ? 2 : 1;
-
-        const int nYBlocks = DIV_ROUND_UP(nYSize, nChunkYSize);
-        const int nXBlocks = DIV_ROUND_UP(nXSize, nChunkXSize);
-        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        catch (const std::exception &)
         {
-            const int iYStart = iYBlock * nChunkYSize;
-            const int iYEnd =
-                iYBlock == nYBlocks - 1 ? nYSize : iYStart + nChunkYSize;
-            const int nChunkActualHeight = iYEnd - iYStart;
-            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-            {
-                const int iXStart = iXBlock * nChunkXSize;
-                const int iXEnd =
-                    iXBlock == nXBlocks - 1 ? nXSize : iXStart + nChunkXSize;
-                const int nChunkActualXSize = iXEnd - iXStart;
-                if (GDALRasterIO(
-                        hBand, GF_Read, iXStart, iYStart, nChunkActualXSize,
-                        nChunkActualHeight, panChunkData, nChunkActualXSize,
-                        nChunkActualHeight, eDstDataType, 0, 0) != CE_None)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO,
-                             "Checksum value could not be computed due to I/O "
-                             "read error.");
-                    nChecksum = -1;
-                    iYBlock = nYBlocks;
-                    break;
-                }
-                const size_t xIters =
-                    static_cast<size_t>(nValsPerIter) * nChunkActualXSize;
-                for (int iY = iYStart; iY < iYEnd; ++iY)
-                {
-                    // Initialize iPrime so that it is consistent with a
-                    // per full line iteration strategy
-                    iPrime = (nValsPerIter *
-                              (static_cast<int64_t>(iY) * nXSize + iXStart)) %
-                             11;
-                    const size_t nOffset = nValsPerIter *
-                                           static_cast<size_t>(iY - iYStart) *
-                                           nChunkActualXSize;
-                    for (size_t i = 0; i < xIters; ++i)
-                    {
-                        nChecksum +=
-                            panChunkData[nOffset + i] % anPrimes[iPrime++];
-                        if (iPrime > 10)
-                            iPrime = 0;
-                    }
-                    nChecksum &= 0xffff;
-                }
-            }
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for content hash computation");
+            return false;
         }
-
-        CPLFree(panChunkData);
-    }
-    else
-    {
-        const GDALDataType eDstDataType = bComplex ? GDT_CInt32 : GDT_Int32;
-
-        int *panLineData = static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(
-            nXSize, GDALGetDataTypeSizeBytes(eDstDataType)));
-        if (panLineData == nullptr)
+        if (GDALRasterIO(hBandToRead, GF_Read, nXOff, iYStart, nXSize,
+                         nLeafYSize, abyData.data(), nXSize, nLeafYSize,
+                         eDataType, 0, 0) != CE_None)
         {
-            return -1;
+            return false;
         }
-
-        for (int iLine = nYOff; iLine < nYOff + nYSize; iLine++)
+#ifdef CPL_MSB
+        const int nWordSize =
+            GDALDataTypeIsComplex(eDataType) ? nDTSize / 2 : nDTSize;
+        if (nWordSize > 1)
         {
-            if (GDALRasterIO(hBand, GF_Read, nXOff, iLine, nXSize, 1,
-                             panLineData, nXSize, 1, eDstDataType, 0,
-                             0) != CE_None)
-            {
-                CPLError(CE_Failure, CPLE_FileIO,
-                         "Checksum value could not be computed due to I/O "
-                         "read error.");
-                nChecksum = -1;
-                break;
-            }
-            const size_t nCount = bComplex ? static_cast<size_t>(nXSize) * 2
-                                           : static_cast<size_t>(nXSize);
-
-            for (size_t i = 0; i < nCount; i++)
-            {
-                nChecksum += panLineData[i] % anPrimes[iPrime++];
-                if (iPrime > 10)
-                    iPrime = 0;
-
-                nChecksum &= 0xffff;
-            }
+            GDALSwapWordsEx(abyData.data(), nWordSize,
+                            abyData.size() / nWordSize, nWordSize);
         }
+#endif
+        anLeafHashes[iLeaf] = XXH64(abyData.data(), abyData.size(), 0);
+        return true;
+    };
 
-        CPLFree(panLineData);
+    if (!RunJobs(hBand, nLeaves, ProcessLeaf))
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Content hash could not be computed due to I/O "
+                 "read error.");
+        return CE_Failure;
     }
 
-    // coverity[return_overflow]
-    return nChecksum;
+    /* -------------------------------------------------------------------- */
+    /*      Hash the description of the region and the hashes of leaves.    */
+    /* -------------------------------------------------------------------- */
+    std::vector<GByte> abyRoot;
+    const auto AppendUInt64 = [&abyRoot](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        abyRoot.insert(abyRoot.end(), pabyVal, pabyVal + sizeof(nVal));
+    };
+    AppendUInt64(static_cast<uint64_t>(eDataType));
+    AppendUInt64(static_cast<uint64_t>(nXSize));
+    AppendUInt64(static_cast<uint64_t>(nYSize));
+    AppendUInt64(static_cast<uint64_t>(nLinesPerLeaf));
+    for (const uint64_t nLeafHash : anLeafHashes)
+        AppendUInt64(nLeafHash);
+
+    *pnHash = XXH64(abyRoot.data(), abyRoot.size(), 0);
+    return CE_None;
 }
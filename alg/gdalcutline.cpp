@@ -18,12 +18,16 @@
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "memdataset.h"
 #include "ogr_api.h"
@@ -214,6 +218,323 @@ static int CutlineTransformer(void *pTransformArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                         GDALPreparedCutline                          */
+/*                                                                      */
+/*      Cutline state computed once per warping operation, to quickly   */
+/*      classify chunks as outside, inside or crossing the cutline,     */
+/*      and to only rasterize the part of the cutline relevant to       */
+/*      chunks crossing it.                                             */
+/************************************************************************/
+
+namespace
+{
+struct GDALPreparedCutlinePolygon
+{
+    OGREnvelope sEnvelope{};
+    // First ring is the exterior ring.
+    std::vector<const OGRLinearRing *> apoRings{};
+    std::vector<OGREnvelope> asRingEnvelopes{};
+};
+}  // namespace
+
+struct GDALPreparedCutline
+{
+    OGRGeometry *poCutline = nullptr;
+    OGREnvelope sEnvelope{};
+    std::vector<GDALPreparedCutlinePolygon> asPolygons{};
+
+    // Only available with GEOS. Queries on it must be done under oMutex.
+    OGRPreparedGeometryH hPrepared = nullptr;
+    std::mutex oMutex{};
+
+    GDALPreparedCutline() = default;
+
+    ~GDALPreparedCutline()
+    {
+        OGRDestroyPreparedGeometry(hPrepared);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALPreparedCutline)
+};
+
+/************************************************************************/
+/*                     GDALCreatePreparedCutline()                      */
+/************************************************************************/
+
+static std::unique_ptr<GDALPreparedCutline>
+CreatePreparedCutline(OGRGeometryH hCutline, bool bPrepareGEOS)
+{
+    OGRGeometry *poCutline = OGRGeometry::FromHandle(hCutline);
+    if (poCutline == nullptr)
+        return nullptr;
+
+    auto psPrepared = std::make_unique<GDALPreparedCutline>();
+    psPrepared->poCutline = poCutline;
+    poCutline->getEnvelope(&psPrepared->sEnvelope);
+
+    const auto AddPolygon = [&psPrepared](const OGRPolygon *poPolygon)
+    {
+        if (poPolygon->IsEmpty())
+            return;
+        GDALPreparedCutlinePolygon sPolygon;
+        poPolygon->getEnvelope(&sPolygon.sEnvelope);
+        for (const auto *poRing : *poPolygon)
+        {
+            OGREnvelope sRingEnvelope;
+            poRing->getEnvelope(&sRingEnvelope);
+            sPolygon.apoRings.push_back(poRing);
+            sPolygon.asRingEnvelopes.push_back(sRingEnvelope);
+        }
+        psPrepared->asPolygons.push_back(std::move(sPolygon));
+    };
+
+    const auto eType = wkbFlatten(poCutline->getGeometryType());
+    if (eType == wkbPolygon)
+    {
+        AddPolygon(poCutline->toPolygon());
+    }
+    else if (eType == wkbMultiPolygon)
+    {
+        for (const auto *poPolygon : *(poCutline->toMultiPolygon()))
+            AddPolygon(poPolygon);
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    if (bPrepareGEOS && OGRGeometryFactory::haveGEOS())
+        psPrepared->hPrepared = OGRCreatePreparedGeometry(hCutline);
+
+    return psPrepared;
+}
+
+/** Prepare a (multi)polygon cutline, in source pixel coordinates, for
+ * repeated use by GDALWarpCutlineMaskerPrepared().
+ *
+ * The cutline must remain valid, and unmodified, while the returned object
+ * is in use.
+ *
+ * @return an object to free with GDALDestroyPreparedCutline(), or nullptr if
+ * the cutline is not a (multi)polygon.
+ */
+void *GDALCreatePreparedCutline(OGRGeometryH hCutline)
+{
+    return CreatePreparedCutline(hCutline, true).release();
+}
+
+/************************************************************************/
+/*                     GDALDestroyPreparedCutline()                     */
+/************************************************************************/
+
+/** Free an object returned by GDALCreatePreparedCutline() */
+void GDALDestroyPreparedCutline(void *hPreparedCutline)
+{
+    delete static_cast<GDALPreparedCutline *>(hPreparedCutline);
+}
+
+/************************************************************************/
+/*                  GDALPreparedCutlineClassifyWindow()                 */
+/************************************************************************/
+
+/** Classify a window, in source pixel coordinates and expanded by
+ * dfBlendDist, with respect to the cutline.
+ *
+ * @return GCMVF_NO_INTERSECTION, GCMVF_CHUNK_FULLY_WITHIN_CUTLINE or
+ * GCMVF_PARTIAL_INTERSECTION (when the window crosses the cutline, or when
+ * this cannot be determined cheaply).
+ */
+int GDALPreparedCutlineClassifyWindow(void *hPreparedCutline,
+                                      double dfBlendDist, int nXOff, int nYOff,
+                                      int nXSize, int nYSize)
+{
+    auto psPrepared = static_cast<GDALPreparedCutline *>(hPreparedCutline);
+
+    OGREnvelope sWindow;
+    sWindow.MinX = nXOff - dfBlendDist;
+    sWindow.MinY = nYOff - dfBlendDist;
+    sWindow.MaxX = static_cast<double>(nXOff) + nXSize + dfBlendDist;
+    sWindow.MaxY = static_cast<double>(nYOff) + nYSize + dfBlendDist;
+
+    // Fast envelope tests.
+    if (!psPrepared->sEnvelope.Intersects(sWindow))
+        return GCMVF_NO_INTERSECTION;
+    bool bIntersectsExteriorRingEnvelope = false;
+    for (const auto &sPolygon : psPrepared->asPolygons)
+    {
+        if (sPolygon.sEnvelope.Intersects(sWindow))
+        {
+            bIntersectsExteriorRingEnvelope = true;
+            break;
+        }
+    }
+    if (!bIntersectsExteriorRingEnvelope)
+        return GCMVF_NO_INTERSECTION;
+
+    if (psPrepared->hPrepared == nullptr
+#ifdef DEBUG
+        // Env var just for debugging purposes
+        || CPLTestBool(
+               CPLGetConfigOption("GDALCUTLINE_SKIP_CONTAINMENT_TEST", "NO"))
+#endif
+    )
+    {
+        return GCMVF_PARTIAL_INTERSECTION;
+    }
+
+    OGRLinearRing *poRing = new OGRLinearRing();
+    poRing->addPoint(sWindow.MinX, sWindow.MinY);
+    poRing->addPoint(sWindow.MinX, sWindow.MaxY);
+    poRing->addPoint(sWindow.MaxX, sWindow.MaxY);
+    poRing->addPoint(sWindow.MaxX, sWindow.MinY);
+    poRing->addPoint(sWindow.MinX, sWindow.MinY);
+    OGRPolygon oWindowFootprint;
+    oWindowFootprint.addRingDirectly(poRing);
+    OGRGeometryH hWindowFootprint = OGRGeometry::ToHandle(&oWindowFootprint);
+
+    // Prepared geometries use a single GEOS context, and build their
+    // spatial index lazily: they cannot be queried concurrently.
+    std::lock_guard<std::mutex> oLock(psPrepared->oMutex);
+    if (!OGRPreparedGeometryIntersects(psPrepared->hPrepared,
+                                       hWindowFootprint))
+        return GCMVF_NO_INTERSECTION;
+    if (psPrepared->sEnvelope.Contains(sWindow) &&
+        OGRPreparedGeometryContains(psPrepared->hPrepared, hWindowFootprint))
+        return GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
+    return GCMVF_PARTIAL_INTERSECTION;
+}
+
+/************************************************************************/
+/*                          ClipRingToWindow()                          */
+/*                                                                      */
+/*      Sutherland-Hodgman clipping of a ring to a rectangle. The       */
+/*      result may contain degenerate edges along the rectangle         */
+/*      borders, which is harmless for even-odd rasterization as long   */
+/*      as those borders are outside of the rasterized area.            */
+/************************************************************************/
+
+static void ClipRingToWindow(const OGRLinearRing *poRing,
+                             const OGREnvelope &sWindow,
+                             std::vector<OGRRawPoint> &aoPoints,
+                             std::vector<OGRRawPoint> &aoTmp)
+{
+    aoPoints.clear();
+    const int nPoints = poRing->getNumPoints();
+    // Skip closing point.
+    for (int i = 0; i + 1 < nPoints; ++i)
+        aoPoints.emplace_back(poRing->getX(i), poRing->getY(i));
+
+    // iEdge: 0 = left, 1 = right, 2 = top, 3 = bottom
+    const auto IsInside = [&sWindow](const OGRRawPoint &p, int iEdge)
+    {
+        switch (iEdge)
+        {
+            case 0:
+                return p.x >= sWindow.MinX;
+            case 1:
+                return p.x <= sWindow.MaxX;
+            case 2:
+                return p.y >= sWindow.MinY;
+            default:
+                return p.y <= sWindow.MaxY;
+        }
+    };
+    const auto Intersect =
+        [&sWindow](const OGRRawPoint &a, const OGRRawPoint &b, int iEdge)
+    {
+        if (iEdge <= 1)
+        {
+            const double dfX = iEdge == 0 ? sWindow.MinX : sWindow.MaxX;
+            const double dfT = (dfX - a.x) / (b.x - a.x);
+            return OGRRawPoint(dfX, a.y + dfT * (b.y - a.y));
+        }
+        const double dfY = iEdge == 2 ? sWindow.MinY : sWindow.MaxY;
+        const double dfT = (dfY - a.y) / (b.y - a.y);
+        return OGRRawPoint(a.x + dfT * (b.x - a.x), dfY);
+    };
+
+    for (int iEdge = 0; iEdge < 4 && !aoPoints.empty(); ++iEdge)
+    {
+        aoTmp.clear();
+        const size_t nCount = aoPoints.size();
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            const OGRRawPoint &cur = aoPoints[i];
+            const OGRRawPoint &prev = aoPoints[i == 0 ? nCount - 1 : i - 1];
+            const bool bCurInside = IsInside(cur, iEdge);
+            const bool bPrevInside = IsInside(prev, iEdge);
+            if (bCurInside)
+            {
+                if (!bPrevInside)
+                    aoTmp.push_back(Intersect(prev, cur, iEdge));
+                aoTmp.push_back(cur);
+            }
+            else if (bPrevInside)
+            {
+                aoTmp.push_back(Intersect(prev, cur, iEdge));
+            }
+        }
+        std::swap(aoPoints, aoTmp);
+    }
+
+    if (aoPoints.size() < 3)
+    {
+        aoPoints.clear();
+    }
+    else
+    {
+        // Close the ring.
+        const OGRRawPoint sFirst = aoPoints[0];
+        aoPoints.push_back(sFirst);
+    }
+}
+
+/************************************************************************/
+/*                         ClipCutlineToWindow()                        */
+/*                                                                      */
+/*      Return the part of the cutline relevant to rasterize the        */
+/*      window. Rings whose envelope does not intersect the window      */
+/*      are discarded, and others are clipped to it, so that the cost   */
+/*      of the rasterization no longer depends on the whole cutline.    */
+/************************************************************************/
+
+static std::unique_ptr<OGRMultiPolygon>
+ClipCutlineToWindow(const GDALPreparedCutline *psPrepared,
+                    const OGREnvelope &sWindow)
+{
+    auto poClipped = std::make_unique<OGRMultiPolygon>();
+    std::vector<OGRRawPoint> aoPoints;
+    std::vector<OGRRawPoint> aoTmp;
+    for (const auto &sPolygon : psPrepared->asPolygons)
+    {
+        if (!sPolygon.sEnvelope.Intersects(sWindow))
+            continue;
+        auto poPolygon = std::make_unique<OGRPolygon>();
+        for (size_t i = 0; i < sPolygon.apoRings.size(); ++i)
+        {
+            // Holes that do not intersect the window do not change the
+            // rasterization within it.
+            if (!sPolygon.asRingEnvelopes[i].Intersects(sWindow))
+                continue;
+            ClipRingToWindow(sPolygon.apoRings[i], sWindow, aoPoints, aoTmp);
+            if (aoPoints.empty())
+            {
+                if (i == 0)
+                    break;
+                continue;
+            }
+            auto poRing = std::make_unique<OGRLinearRing>();
+            poRing->setPoints(static_cast<int>(aoPoints.size()),
+                              aoPoints.data());
+            poPolygon->addRingDirectly(poRing.release());
+        }
+        if (!poPolygon->IsEmpty())
+            poClipped->addGeometryDirectly(poPolygon.release());
+    }
+    return poClipped;
+}
+
 /************************************************************************/
 /*                       GDALWarpCutlineMasker()                        */
 /*                                                                      */
@@ -262,14 +583,6 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         return CE_Failure;
     }
 
-    GDALDriverH hMemDriver = GDALGetDriverByName("MEM");
-    if (hMemDriver == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "GDALWarpCutlineMasker needs MEM driver");
-        return CE_Failure;
-    }
-
     /* -------------------------------------------------------------------- */
     /*      Check the polygon.                                              */
     /* -------------------------------------------------------------------- */
@@ -283,29 +596,63 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         return CE_Failure;
     }
 
-    OGREnvelope sEnvelope;
-    OGR_G_GetEnvelope(hPolygon, &sEnvelope);
+    // Not worth building a GEOS prepared geometry for a single call.
+    auto psPrepared = CreatePreparedCutline(hPolygon, false);
+
+    return GDALWarpCutlineMaskerPrepared(psWO, psPrepared.get(), nXOff, nYOff,
+                                         nXSize, nYSize,
+                                         static_cast<float *>(pValidityMask),
+                                         pnValidityFlag);
+}
 
-    float *pafMask = static_cast<float *>(pValidityMask);
+/************************************************************************/
+/*                    GDALWarpCutlineMaskerPrepared()                   */
+/************************************************************************/
 
-    if (sEnvelope.MaxX + psWO->dfCutlineBlendDist < nXOff ||
-        sEnvelope.MinX - psWO->dfCutlineBlendDist > nXOff + nXSize ||
-        sEnvelope.MaxY + psWO->dfCutlineBlendDist < nYOff ||
-        sEnvelope.MinY - psWO->dfCutlineBlendDist > nYOff + nYSize)
+/** Same as GDALWarpCutlineMaskerEx(), with the cutline of the warp options
+ * (pMaskFuncArg) prepared with GDALCreatePreparedCutline().
+ */
+CPLErr GDALWarpCutlineMaskerPrepared(void *pMaskFuncArg,
+                                     void *hPreparedCutline, int nXOff,
+                                     int nYOff, int nXSize, int nYSize,
+                                     float *pafMask, int *pnValidityFlag)
+{
+    const GDALWarpOptions *psWO =
+        static_cast<const GDALWarpOptions *>(pMaskFuncArg);
+
+    if (pnValidityFlag)
+        *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
+
+    if (nXSize < 1 || nYSize < 1)
+        return CE_None;
+
+    auto psPrepared = static_cast<GDALPreparedCutline *>(hPreparedCutline);
+    OGRGeometryH hPolygon = OGRGeometry::ToHandle(psPrepared->poCutline);
+
+    const int nClass = GDALPreparedCutlineClassifyWindow(
+        psPrepared, psWO->dfCutlineBlendDist, nXOff, nYOff, nXSize, nYSize);
+    if (nClass == GCMVF_NO_INTERSECTION)
     {
         if (pnValidityFlag)
             *pnValidityFlag = GCMVF_NO_INTERSECTION;
 
         // We are far from the blend line - everything is masked to zero.
-        // It would be nice to realize no work is required for this whole
-        // chunk!
         memset(pafMask, 0, sizeof(float) * nXSize * nYSize);
         return CE_None;
     }
 
     // And now check if the chunk to warp is fully contained within the cutline
     // to save rasterization.
-    if (OGRGeometryFactory::haveGEOS()
+    if (nClass == GCMVF_CHUNK_FULLY_WITHIN_CUTLINE)
+    {
+        if (pnValidityFlag)
+            *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
+
+        CPLDebug("WARP", "Source chunk fully contained within cutline.");
+        return CE_None;
+    }
+
+    if (psPrepared->hPrepared == nullptr && OGRGeometryFactory::haveGEOS()
 #ifdef DEBUG
         // Env var just for debugging purposes
         && !CPLTestBool(
@@ -328,8 +675,8 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         oChunkFootprint.addRingDirectly(poRing);
         OGREnvelope sChunkEnvelope;
         oChunkFootprint.getEnvelope(&sChunkEnvelope);
-        if (sEnvelope.Contains(sChunkEnvelope) &&
-            OGRGeometry::FromHandle(hPolygon)->Contains(&oChunkFootprint))
+        if (psPrepared->sEnvelope.Contains(sChunkEnvelope) &&
+            psPrepared->poCutline->Contains(&oChunkFootprint))
         {
             if (pnValidityFlag)
                 *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
@@ -339,6 +686,14 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         }
     }
 
+    GDALDriverH hMemDriver = GDALGetDriverByName("MEM");
+    if (hMemDriver == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALWarpCutlineMasker needs MEM driver");
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Create a byte buffer into which we can burn the                 */
     /*      mask polygon and wrap it up as a memory dataset.                */
@@ -355,6 +710,26 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
     GDALSetGeoTransform(hMemDS, adfGeoTransform);
 
+    /* -------------------------------------------------------------------- */
+    /*      Restrict the cutline to the chunk, with a margin of 2 pixels    */
+    /*      so that clipping artifacts are out of the rasterized area,      */
+    /*      even in ALL_TOUCHED mode.                                       */
+    /* -------------------------------------------------------------------- */
+    constexpr double MARGIN = 2;
+    OGREnvelope sWindow;
+    sWindow.MinX = nXOff - MARGIN;
+    sWindow.MinY = nYOff - MARGIN;
+    sWindow.MaxX = static_cast<double>(nXOff) + nXSize + MARGIN;
+    sWindow.MaxY = static_cast<double>(nYOff) + nYSize + MARGIN;
+
+    std::unique_ptr<OGRMultiPolygon> poClipped;
+    OGRGeometryH hGeomToBurn = hPolygon;
+    if (!sWindow.Contains(psPrepared->sEnvelope))
+    {
+        poClipped = ClipCutlineToWindow(psPrepared, sWindow);
+        hGeomToBurn = OGRGeometry::ToHandle(poClipped.get());
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Burn the polygon into the mask with 1.0 values.                 */
     /* -------------------------------------------------------------------- */
@@ -368,9 +743,13 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     int anXYOff[2] = {nXOff, nYOff};
 
-    CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+    CPLErr eErr = CE_None;
+    if (!OGR_G_IsEmpty(hGeomToBurn))
+    {
+        eErr = GDALRasterizeGeometries(
+            hMemDS, 1, &nTargetBand, 1, &hGeomToBurn, CutlineTransformer,
+            anXYOff, &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+    }
 
     CSLDestroy(papszRasterizeOptions);
 
@@ -381,19 +760,18 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     /*      In the case with no blend distance, we just apply this as a     */
     /*      mask, zeroing out everything outside the polygon.               */
     /* -------------------------------------------------------------------- */
-    if (psWO->dfCutlineBlendDist == 0.0)
+    if (eErr == CE_None && psWO->dfCutlineBlendDist == 0.0)
     {
         for (int i = nXSize * nYSize - 1; i >= 0; i--)
         {
             if (pabyPolyMask[i] == 0)
-                static_cast<float *>(pValidityMask)[i] = 0.0;
+                pafMask[i] = 0.0;
         }
     }
-    else
+    else if (eErr == CE_None)
     {
         eErr = BlendMaskGenerator(nXOff, nYOff, nXSize, nYSize, pabyPolyMask,
-                                  static_cast<float *>(pValidityMask), hPolygon,
-                                  psWO->dfCutlineBlendDist);
+                                  pafMask, hPolygon, psWO->dfCutlineBlendDist);
     }
 
     /* -------------------------------------------------------------------- */
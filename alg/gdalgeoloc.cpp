@@ -34,8 +34,10 @@
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -656,279 +658,417 @@ int GDALGeoLoc<Accessors>::Transform(void *pTransformArg, int bDstToSrc,
         const bool bGeolocMaxAccuracy = CPLTestBool(
             CPLGetConfigOption("GDAL_GEOLOC_USE_MAX_ACCURACY", "YES"));
 
-        // Keep those objects in this outer scope, so they are re-used, to
-        // save memory allocations.
-        OGRPoint oPoint;
-        OGRLinearRing oRing;
-        oRing.setNumPoints(5);
+        return InverseTransformBatch(psTransform, bGeolocMaxAccuracy,
+                                     nPointCount, padfX, padfY, panSuccess);
+    }
 
-        auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    return bSuccess;
+}
 
-        for (int i = 0; i < nPointCount; i++)
-        {
-            if (padfX[i] == HUGE_VAL || padfY[i] == HUGE_VAL)
-            {
-                bSuccess = FALSE;
-                panSuccess[i] = FALSE;
-                continue;
-            }
+/************************************************************************/
+/*                       GDALGeoLocHilbertIndex()                       */
+/************************************************************************/
 
-            if (psTransform->bSwapXY)
+// Index of (nX, nY) along a Hilbert curve covering [0, 2^32[ x [0, 2^32[.
+static uint64_t GDALGeoLocHilbertIndex(uint32_t nX, uint32_t nY)
+{
+    uint64_t nIdx = 0;
+    for (uint32_t s = 1U << 31; s > 0; s >>= 1)
+    {
+        const uint32_t rx = (nX & s) ? 1 : 0;
+        const uint32_t ry = (nY & s) ? 1 : 0;
+        nIdx += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
             {
-                std::swap(padfX[i], padfY[i]);
+                nX = ~nX;
+                nY = ~nY;
             }
+            std::swap(nX, nY);
+        }
+    }
+    return nIdx;
+}
 
-            const double dfGeoX = padfX[i];
-            const double dfGeoY = padfY[i];
+/************************************************************************/
+/*                       InverseTransformBatch()                        */
+/************************************************************************/
 
+// Transform geox/geoy to pixel/line using the backmap.
+// When the backmap and geolocation arrays are stored in temporary datasets,
+// the points are processed along a Hilbert curve of their backmap cells, so
+// that consecutive points hit the same cached tiles. When they are stored in
+// memory, large batches of points are processed in parallel, if several
+// threads are allowed.
+template <class Accessors>
+int GDALGeoLoc<Accessors>::InverseTransformBatch(
+    const GDALGeoLocTransformInfo *psTransform, bool bGeolocMaxAccuracy,
+    int nPointCount, double *padfX, double *padfY, int *panSuccess)
+{
+    if (!psTransform->bUseArray && nPointCount > 1)
+    {
+        std::vector<std::pair<uint64_t, int>> anKeyAndIndex;
+        anKeyAndIndex.reserve(nPointCount);
+        for (int i = 0; i < nPointCount; i++)
+        {
+            double dfGeoX = padfX[i];
+            double dfGeoY = padfY[i];
+            if (psTransform->bSwapXY)
+                std::swap(dfGeoX, dfGeoY);
             const double dfBMX =
-                ((padfX[i] - psTransform->adfBackMapGeoTransform[0]) /
+                ((dfGeoX - psTransform->adfBackMapGeoTransform[0]) /
                  psTransform->adfBackMapGeoTransform[1]);
             const double dfBMY =
-                ((padfY[i] - psTransform->adfBackMapGeoTransform[3]) /
+                ((dfGeoY - psTransform->adfBackMapGeoTransform[3]) /
                  psTransform->adfBackMapGeoTransform[5]);
+            // Points out of the backmap (or invalid) are processed last.
+            uint64_t nKey = std::numeric_limits<uint64_t>::max();
+            if (dfBMX >= 0 && dfBMY >= 0 &&
+                dfBMX < psTransform->nBackMapWidth &&
+                dfBMY < psTransform->nBackMapHeight)
+            {
+                nKey = GDALGeoLocHilbertIndex(static_cast<uint32_t>(dfBMX),
+                                              static_cast<uint32_t>(dfBMY));
+            }
+            anKeyAndIndex.emplace_back(nKey, i);
+        }
+        std::sort(anKeyAndIndex.begin(), anKeyAndIndex.end());
+
+        std::vector<int> anIndices;
+        anIndices.reserve(nPointCount);
+        for (const auto &oKeyAndIndex : anKeyAndIndex)
+            anIndices.push_back(oKeyAndIndex.second);
+
+        return InverseTransformUsingBackmap(psTransform, bGeolocMaxAccuracy,
+                                            anIndices.data(), 0, nPointCount,
+                                            padfX, padfY, panSuccess);
+    }
 
-            if (!(dfBMX >= 0 && dfBMY >= 0 &&
-                  dfBMX + 1 < psTransform->nBackMapWidth &&
-                  dfBMY + 1 < psTransform->nBackMapHeight))
+    constexpr int MIN_POINTS_PER_JOB = 1024;
+    const int nJobs =
+        std::min(psTransform->nNumThreads, nPointCount / MIN_POINTS_PER_JOB);
+    if (psTransform->bUseArray && nJobs > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool =
+            GDALGetGlobalThreadPool(psTransform->nNumThreads);
+        auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poQueue)
+        {
+            std::atomic<bool> bSuccess{true};
+            for (int iJob = 0; iJob < nJobs; ++iJob)
             {
-                bSuccess = FALSE;
-                panSuccess[i] = FALSE;
-                padfX[i] = HUGE_VAL;
-                padfY[i] = HUGE_VAL;
-                continue;
+                const int nStart = static_cast<int>(
+                    static_cast<int64_t>(iJob) * nPointCount / nJobs);
+                const int nEnd = static_cast<int>(
+                    static_cast<int64_t>(iJob + 1) * nPointCount / nJobs);
+                poQueue->SubmitJob(
+                    [=, &bSuccess]()
+                    {
+                        if (!InverseTransformUsingBackmap(
+                                psTransform, bGeolocMaxAccuracy, nullptr,
+                                nStart, nEnd, padfX, padfY, panSuccess))
+                        {
+                            bSuccess = false;
+                        }
+                    });
             }
+            poQueue->WaitCompletion();
+            return bSuccess ? TRUE : FALSE;
+        }
+    }
+
+    return InverseTransformUsingBackmap(psTransform, bGeolocMaxAccuracy,
+                                        nullptr, 0, nPointCount, padfX, padfY,
+                                        panSuccess);
+}
+
+/************************************************************************/
+/*                    InverseTransformUsingBackmap()                    */
+/************************************************************************/
+
+// Transform geox/geoy to pixel/line of the points of index
+// panIndices[nStart...nEnd-1] (or nStart...nEnd-1 if panIndices is null),
+// using the backmap.
+template <class Accessors>
+int GDALGeoLoc<Accessors>::InverseTransformUsingBackmap(
+    const GDALGeoLocTransformInfo *psTransform, bool bGeolocMaxAccuracy,
+    const int *panIndices, int nStart, int nEnd, double *padfX, double *padfY,
+    int *panSuccess)
+{
+    // Keep those objects in this outer scope, so they are re-used, to
+    // save memory allocations.
+    OGRPoint oPoint;
+    OGRLinearRing oRing;
+    oRing.setNumPoints(5);
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+
+    const double dfGeorefConventionOffset =
+        psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
+
+    int bSuccess = TRUE;
+    for (int j = nStart; j < nEnd; j++)
+    {
+        const int i = panIndices ? panIndices[j] : j;
+
+        if (padfX[i] == HUGE_VAL || padfY[i] == HUGE_VAL)
+        {
+            bSuccess = FALSE;
+            panSuccess[i] = FALSE;
+            continue;
+        }
+
+        if (psTransform->bSwapXY)
+        {
+            std::swap(padfX[i], padfY[i]);
+        }
+
+        const double dfGeoX = padfX[i];
+        const double dfGeoY = padfY[i];
+
+        const double dfBMX =
+            ((padfX[i] - psTransform->adfBackMapGeoTransform[0]) /
+             psTransform->adfBackMapGeoTransform[1]);
+        const double dfBMY =
+            ((padfY[i] - psTransform->adfBackMapGeoTransform[3]) /
+             psTransform->adfBackMapGeoTransform[5]);
+
+        if (!(dfBMX >= 0 && dfBMY >= 0 &&
+              dfBMX + 1 < psTransform->nBackMapWidth &&
+              dfBMY + 1 < psTransform->nBackMapHeight))
+        {
+            bSuccess = FALSE;
+            panSuccess[i] = FALSE;
+            padfX[i] = HUGE_VAL;
+            padfY[i] = HUGE_VAL;
+            continue;
+        }
+
+        const int iBMX = static_cast<int>(dfBMX);
+        const int iBMY = static_cast<int>(dfBMY);
+
+        const auto fBMX_0_0 = pAccessors->backMapXAccessor.Get(iBMX, iBMY);
+        const auto fBMY_0_0 = pAccessors->backMapYAccessor.Get(iBMX, iBMY);
+        if (fBMX_0_0 == INVALID_BMXY)
+        {
+            bSuccess = FALSE;
+            panSuccess[i] = FALSE;
+            padfX[i] = HUGE_VAL;
+            padfY[i] = HUGE_VAL;
+            continue;
+        }
 
-            const int iBMX = static_cast<int>(dfBMX);
-            const int iBMY = static_cast<int>(dfBMY);
+        const auto fBMX_1_0 = pAccessors->backMapXAccessor.Get(iBMX + 1, iBMY);
+        const auto fBMY_1_0 = pAccessors->backMapYAccessor.Get(iBMX + 1, iBMY);
+        const auto fBMX_0_1 = pAccessors->backMapXAccessor.Get(iBMX, iBMY + 1);
+        const auto fBMY_0_1 = pAccessors->backMapYAccessor.Get(iBMX, iBMY + 1);
+        const auto fBMX_1_1 =
+            pAccessors->backMapXAccessor.Get(iBMX + 1, iBMY + 1);
+        const auto fBMY_1_1 =
+            pAccessors->backMapYAccessor.Get(iBMX + 1, iBMY + 1);
+        if (fBMX_1_0 != INVALID_BMXY && fBMX_0_1 != INVALID_BMXY &&
+            fBMX_1_1 != INVALID_BMXY)
+        {
+            padfX[i] =
+                (1 - (dfBMY - iBMY)) *
+                    (fBMX_0_0 + (dfBMX - iBMX) * (fBMX_1_0 - fBMX_0_0)) +
+                (dfBMY - iBMY) *
+                    (fBMX_0_1 + (dfBMX - iBMX) * (fBMX_1_1 - fBMX_0_1));
+            padfY[i] =
+                (1 - (dfBMY - iBMY)) *
+                    (fBMY_0_0 + (dfBMX - iBMX) * (fBMY_1_0 - fBMY_0_0)) +
+                (dfBMY - iBMY) *
+                    (fBMY_0_1 + (dfBMX - iBMX) * (fBMY_1_1 - fBMY_0_1));
+        }
+        else if (fBMX_1_0 != INVALID_BMXY)
+        {
+            padfX[i] = fBMX_0_0 + (dfBMX - iBMX) * (fBMX_1_0 - fBMX_0_0);
+            padfY[i] = fBMY_0_0 + (dfBMX - iBMX) * (fBMY_1_0 - fBMY_0_0);
+        }
+        else if (fBMX_0_1 != INVALID_BMXY)
+        {
+            padfX[i] = fBMX_0_0 + (dfBMY - iBMY) * (fBMX_0_1 - fBMX_0_0);
+            padfY[i] = fBMY_0_0 + (dfBMY - iBMY) * (fBMY_0_1 - fBMY_0_0);
+        }
+        else
+        {
+            padfX[i] = fBMX_0_0;
+            padfY[i] = fBMY_0_0;
+        }
 
-            const auto fBMX_0_0 = pAccessors->backMapXAccessor.Get(iBMX, iBMY);
-            const auto fBMY_0_0 = pAccessors->backMapYAccessor.Get(iBMX, iBMY);
-            if (fBMX_0_0 == INVALID_BMXY)
+        const double dfGeoLocPixel =
+            (padfX[i] - psTransform->dfPIXEL_OFFSET) /
+                psTransform->dfPIXEL_STEP -
+            dfGeorefConventionOffset;
+        const double dfGeoLocLine =
+            (padfY[i] - psTransform->dfLINE_OFFSET) /
+                psTransform->dfLINE_STEP -
+            dfGeorefConventionOffset;
+#if 0
+        CPLDebug("GEOLOC", "%f %f %f %f", padfX[i], padfY[i], dfGeoLocPixel, dfGeoLocLine);
+        if( !psTransform->bOriginIsTopLeftCorner )
+        {
+            if( dfGeoLocPixel + dfGeorefConventionOffset > psTransform->nGeoLocXSize-1 ||
+                dfGeoLocLine + dfGeorefConventionOffset > psTransform->nGeoLocYSize-1 )
             {
-                bSuccess = FALSE;
                 panSuccess[i] = FALSE;
                 padfX[i] = HUGE_VAL;
                 padfY[i] = HUGE_VAL;
                 continue;
             }
+        }
+#endif
+        if (!bGeolocMaxAccuracy)
+        {
+            panSuccess[i] = TRUE;
+            continue;
+        }
 
-            const auto fBMX_1_0 =
-                pAccessors->backMapXAccessor.Get(iBMX + 1, iBMY);
-            const auto fBMY_1_0 =
-                pAccessors->backMapYAccessor.Get(iBMX + 1, iBMY);
-            const auto fBMX_0_1 =
-                pAccessors->backMapXAccessor.Get(iBMX, iBMY + 1);
-            const auto fBMY_0_1 =
-                pAccessors->backMapYAccessor.Get(iBMX, iBMY + 1);
-            const auto fBMX_1_1 =
-                pAccessors->backMapXAccessor.Get(iBMX + 1, iBMY + 1);
-            const auto fBMY_1_1 =
-                pAccessors->backMapYAccessor.Get(iBMX + 1, iBMY + 1);
-            if (fBMX_1_0 != INVALID_BMXY && fBMX_0_1 != INVALID_BMXY &&
-                fBMX_1_1 != INVALID_BMXY)
-            {
-                padfX[i] =
-                    (1 - (dfBMY - iBMY)) *
-                        (fBMX_0_0 + (dfBMX - iBMX) * (fBMX_1_0 - fBMX_0_0)) +
-                    (dfBMY - iBMY) *
-                        (fBMX_0_1 + (dfBMX - iBMX) * (fBMX_1_1 - fBMX_0_1));
-                padfY[i] =
-                    (1 - (dfBMY - iBMY)) *
-                        (fBMY_0_0 + (dfBMX - iBMX) * (fBMY_1_0 - fBMY_0_0)) +
-                    (dfBMY - iBMY) *
-                        (fBMY_0_1 + (dfBMX - iBMX) * (fBMY_1_1 - fBMY_0_1));
-            }
-            else if (fBMX_1_0 != INVALID_BMXY)
-            {
-                padfX[i] = fBMX_0_0 + (dfBMX - iBMX) * (fBMX_1_0 - fBMX_0_0);
-                padfY[i] = fBMY_0_0 + (dfBMX - iBMX) * (fBMY_1_0 - fBMY_0_0);
-            }
-            else if (fBMX_0_1 != INVALID_BMXY)
-            {
-                padfX[i] = fBMX_0_0 + (dfBMY - iBMY) * (fBMX_0_1 - fBMX_0_0);
-                padfY[i] = fBMY_0_0 + (dfBMY - iBMY) * (fBMY_0_1 - fBMY_0_0);
-            }
-            else
-            {
-                padfX[i] = fBMX_0_0;
-                padfY[i] = fBMY_0_0;
-            }
-
-            const double dfGeoLocPixel =
-                (padfX[i] - psTransform->dfPIXEL_OFFSET) /
-                    psTransform->dfPIXEL_STEP -
-                dfGeorefConventionOffset;
-            const double dfGeoLocLine =
-                (padfY[i] - psTransform->dfLINE_OFFSET) /
-                    psTransform->dfLINE_STEP -
-                dfGeorefConventionOffset;
-#if 0
-            CPLDebug("GEOLOC", "%f %f %f %f", padfX[i], padfY[i], dfGeoLocPixel, dfGeoLocLine);
-            if( !psTransform->bOriginIsTopLeftCorner )
+        // Now that we have an approximate solution, identify a matching
+        // cell in the geolocation array, where we can use inverse bilinear
+        // interpolation to find the exact solution.
+
+        // NOTE: if the geolocation array is an affine transformation,
+        // the approximate solution should match the exact one, if the
+        // backmap has correctly been built.
+
+        oPoint.setX(dfGeoX);
+        oPoint.setY(dfGeoY);
+        // The thresholds and radius are rather empirical and have been
+        // tuned on the product
+        // S5P_TEST_L2__NO2____20190509T220707_20190509T234837_08137_01_010400_20200220T091343.nc
+        // that includes the north pole.
+        // Amended with the test case of
+        // https://github.com/OSGeo/gdal/issues/5823
+        const int nSearchRadius =
+            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                    fabs(dfGeoY) >= 85
+                ? 5
+                : 3;
+        const int nGeoLocPixel = static_cast<int>(std::floor(dfGeoLocPixel));
+        const int nGeoLocLine = static_cast<int>(std::floor(dfGeoLocLine));
+
+        bool bDone = false;
+        // Using the above approximate nGeoLocPixel, nGeoLocLine, try to
+        // find a forward cell that includes (dfGeoX, dfGeoY), with an
+        // increasing search radius, up to nSearchRadius.
+        for (int r = 0; !bDone && r <= nSearchRadius; r++)
+        {
+            for (int iter = 0; !bDone && iter < (r == 0 ? 1 : 8 * r);
+                 ++iter)
             {
-                if( dfGeoLocPixel + dfGeorefConventionOffset > psTransform->nGeoLocXSize-1 ||
-                    dfGeoLocLine + dfGeorefConventionOffset > psTransform->nGeoLocYSize-1 )
+                // For r=1, the below formulas will give the following
+                // offsets:
+                // (-1,1), (0,1), (1,1), (1,0), (1,-1), (0,-1), (1,-1)
+                const int sx = (r == 0)         ? 0
+                               : (iter < 2 * r) ? -r + iter
+                               : (iter < 4 * r) ? r
+                               : (iter < 6 * r) ? r - (iter - 4 * r)
+                                                : -r;
+                const int sy = (r == 0)         ? 0
+                               : (iter < 2 * r) ? r
+                               : (iter < 4 * r) ? r - (iter - 2 * r)
+                               : (iter < 6 * r) ? -r
+                                                : -r + (iter - 6 * r);
+                if (nGeoLocPixel >=
+                        static_cast<int>(psTransform->nGeoLocXSize) - sx ||
+                    nGeoLocLine >=
+                        static_cast<int>(psTransform->nGeoLocYSize) - sy)
                 {
-                    panSuccess[i] = FALSE;
-                    padfX[i] = HUGE_VAL;
-                    padfY[i] = HUGE_VAL;
                     continue;
                 }
-            }
-#endif
-            if (!bGeolocMaxAccuracy)
-            {
-                panSuccess[i] = TRUE;
-                continue;
-            }
-
-            // Now that we have an approximate solution, identify a matching
-            // cell in the geolocation array, where we can use inverse bilinear
-            // interpolation to find the exact solution.
-
-            // NOTE: if the geolocation array is an affine transformation,
-            // the approximate solution should match the exact one, if the
-            // backmap has correctly been built.
-
-            oPoint.setX(dfGeoX);
-            oPoint.setY(dfGeoY);
-            // The thresholds and radius are rather empirical and have been
-            // tuned on the product
-            // S5P_TEST_L2__NO2____20190509T220707_20190509T234837_08137_01_010400_20200220T091343.nc
-            // that includes the north pole.
-            // Amended with the test case of
-            // https://github.com/OSGeo/gdal/issues/5823
-            const int nSearchRadius =
-                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                        fabs(dfGeoY) >= 85
-                    ? 5
-                    : 3;
-            const int nGeoLocPixel =
-                static_cast<int>(std::floor(dfGeoLocPixel));
-            const int nGeoLocLine = static_cast<int>(std::floor(dfGeoLocLine));
-
-            bool bDone = false;
-            // Using the above approximate nGeoLocPixel, nGeoLocLine, try to
-            // find a forward cell that includes (dfGeoX, dfGeoY), with an
-            // increasing search radius, up to nSearchRadius.
-            for (int r = 0; !bDone && r <= nSearchRadius; r++)
-            {
-                for (int iter = 0; !bDone && iter < (r == 0 ? 1 : 8 * r);
-                     ++iter)
+                const int iX = nGeoLocPixel + sx;
+                const int iY = nGeoLocLine + sy;
+                if (iX >= -1 || iY >= -1)
                 {
-                    // For r=1, the below formulas will give the following
-                    // offsets:
-                    // (-1,1), (0,1), (1,1), (1,0), (1,-1), (0,-1), (1,-1)
-                    const int sx = (r == 0)         ? 0
-                                   : (iter < 2 * r) ? -r + iter
-                                   : (iter < 4 * r) ? r
-                                   : (iter < 6 * r) ? r - (iter - 4 * r)
-                                                    : -r;
-                    const int sy = (r == 0)         ? 0
-                                   : (iter < 2 * r) ? r
-                                   : (iter < 4 * r) ? r - (iter - 2 * r)
-                                   : (iter < 6 * r) ? -r
-                                                    : -r + (iter - 6 * r);
-                    if (nGeoLocPixel >=
-                            static_cast<int>(psTransform->nGeoLocXSize) - sx ||
-                        nGeoLocLine >=
-                            static_cast<int>(psTransform->nGeoLocYSize) - sy)
+                    double x0, y0, x1, y1, x2, y2, x3, y3;
+
+                    if (!PixelLineToXY(psTransform, iX, iY, x0, y0) ||
+                        !PixelLineToXY(psTransform, iX + 1, iY, x2, y2) ||
+                        !PixelLineToXY(psTransform, iX, iY + 1, x1, y1) ||
+                        !PixelLineToXY(psTransform, iX + 1, iY + 1, x3, y3))
                     {
                         continue;
                     }
-                    const int iX = nGeoLocPixel + sx;
-                    const int iY = nGeoLocLine + sy;
-                    if (iX >= -1 || iY >= -1)
-                    {
-                        double x0, y0, x1, y1, x2, y2, x3, y3;
-
-                        if (!PixelLineToXY(psTransform, iX, iY, x0, y0) ||
-                            !PixelLineToXY(psTransform, iX + 1, iY, x2, y2) ||
-                            !PixelLineToXY(psTransform, iX, iY + 1, x1, y1) ||
-                            !PixelLineToXY(psTransform, iX + 1, iY + 1, x3, y3))
-                        {
-                            continue;
-                        }
 
-                        int nIters = 1;
-                        // For a bounding box crossing the anti-meridian, check
-                        // both around -180 and +180 deg.
-                        if (psTransform
-                                ->bGeographicSRSWithMinus180Plus180LongRange &&
-                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
-                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
-                            (std::fabs(x1 - x0) > 180 ||
-                             std::fabs(x2 - x0) > 180 ||
-                             std::fabs(x3 - x0) > 180))
+                    int nIters = 1;
+                    // For a bounding box crossing the anti-meridian, check
+                    // both around -180 and +180 deg.
+                    if (psTransform
+                            ->bGeographicSRSWithMinus180Plus180LongRange &&
+                        std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                        std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                        (std::fabs(x1 - x0) > 180 ||
+                         std::fabs(x2 - x0) > 180 ||
+                         std::fabs(x3 - x0) > 180))
+                    {
+                        nIters = 2;
+                        if (x0 > 0)
+                            x0 -= 360;
+                        if (x1 > 0)
+                            x1 -= 360;
+                        if (x2 > 0)
+                            x2 -= 360;
+                        if (x3 > 0)
+                            x3 -= 360;
+                    }
+                    for (int iIter = 0; !bDone && iIter < nIters; ++iIter)
+                    {
+                        if (iIter == 1)
                         {
-                            nIters = 2;
-                            if (x0 > 0)
-                                x0 -= 360;
-                            if (x1 > 0)
-                                x1 -= 360;
-                            if (x2 > 0)
-                                x2 -= 360;
-                            if (x3 > 0)
-                                x3 -= 360;
+                            x0 += 360;
+                            x1 += 360;
+                            x2 += 360;
+                            x3 += 360;
                         }
-                        for (int iIter = 0; !bDone && iIter < nIters; ++iIter)
+                        oRing.setPoint(0, x0, y0);
+                        oRing.setPoint(1, x2, y2);
+                        oRing.setPoint(2, x3, y3);
+                        oRing.setPoint(3, x1, y1);
+                        oRing.setPoint(4, x0, y0);
+                        if (oRing.isPointInRing(&oPoint) ||
+                            oRing.isPointOnRingBoundary(&oPoint))
                         {
-                            if (iIter == 1)
-                            {
-                                x0 += 360;
-                                x1 += 360;
-                                x2 += 360;
-                                x3 += 360;
-                            }
-                            oRing.setPoint(0, x0, y0);
-                            oRing.setPoint(1, x2, y2);
-                            oRing.setPoint(2, x3, y3);
-                            oRing.setPoint(3, x1, y1);
-                            oRing.setPoint(4, x0, y0);
-                            if (oRing.isPointInRing(&oPoint) ||
-                                oRing.isPointOnRingBoundary(&oPoint))
-                            {
-                                double dfX = static_cast<double>(iX);
-                                double dfY = static_cast<double>(iY);
-                                GDALInverseBilinearInterpolation(
-                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
-                                    y3, dfX, dfY);
-
-                                dfX = (dfX + dfGeorefConventionOffset) *
-                                          psTransform->dfPIXEL_STEP +
-                                      psTransform->dfPIXEL_OFFSET;
-                                dfY = (dfY + dfGeorefConventionOffset) *
-                                          psTransform->dfLINE_STEP +
-                                      psTransform->dfLINE_OFFSET;
+                            double dfX = static_cast<double>(iX);
+                            double dfY = static_cast<double>(iY);
+                            GDALInverseBilinearInterpolation(
+                                dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                y3, dfX, dfY);
+
+                            dfX = (dfX + dfGeorefConventionOffset) *
+                                      psTransform->dfPIXEL_STEP +
+                                  psTransform->dfPIXEL_OFFSET;
+                            dfY = (dfY + dfGeorefConventionOffset) *
+                                      psTransform->dfLINE_STEP +
+                                  psTransform->dfLINE_OFFSET;
 
 #ifdef DEBUG_GEOLOC_REALLY_VERBOSE
-                                CPLDebug("GEOLOC",
-                                         "value before adjustment: %f %f, "
-                                         "after adjustment: %f %f",
-                                         padfX[i], padfY[i], dfX, dfY);
+                            CPLDebug("GEOLOC",
+                                     "value before adjustment: %f %f, "
+                                     "after adjustment: %f %f",
+                                     padfX[i], padfY[i], dfX, dfY);
 #endif
 
-                                padfX[i] = dfX;
-                                padfY[i] = dfY;
+                            padfX[i] = dfX;
+                            padfY[i] = dfY;
 
-                                bDone = true;
-                            }
+                            bDone = true;
                         }
                     }
                 }
             }
-            if (!bDone)
-            {
-                bSuccess = FALSE;
-                panSuccess[i] = FALSE;
-                padfX[i] = HUGE_VAL;
-                padfY[i] = HUGE_VAL;
-                continue;
-            }
-
-            panSuccess[i] = TRUE;
         }
+        if (!bDone)
+        {
+            bSuccess = FALSE;
+            panSuccess[i] = FALSE;
+            padfX[i] = HUGE_VAL;
+            padfY[i] = HUGE_VAL;
+            continue;
+        }
+
+        panSuccess[i] = TRUE;
     }
 
     return bSuccess;
@@ -1617,6 +1757,7 @@ static void *GDALCreateSimilarGeoLocTransformer(void *hTransformArg,
         static_cast<GDALGeoLocTransformInfo *>(GDALCreateGeoLocTransformer(
             nullptr, papszGeolocationInfo, psInfo->bReversed));
     psInfoNew->dfOversampleFactor = psInfo->dfOversampleFactor;
+    psInfoNew->nNumThreads = psInfo->nNumThreads;
 
     CSLDestroy(papszGeolocationInfo);
 
@@ -1785,6 +1926,12 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    psTransform->nNumThreads = CPLParseNumThreads(
+        CSLFetchNameValueDef(
+            papszTransformOptions, "GEOLOC_NUM_THREADS",
+            CPLGetConfigOption("GDAL_GEOLOC_NUM_THREADS", "1")),
+        128);
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
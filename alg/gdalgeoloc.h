@@ -45,6 +45,16 @@ template <class Accessors> struct GDALGeoLoc
     static int Transform(void *pTransformArg, int bDstToSrc, int nPointCount,
                          double *padfX, double *padfY, double * /* padfZ */,
                          int *panSuccess);
+
+    static int InverseTransformBatch(const GDALGeoLocTransformInfo *psTransform,
+                                     bool bGeolocMaxAccuracy, int nPointCount,
+                                     double *padfX, double *padfY,
+                                     int *panSuccess);
+
+    static int InverseTransformUsingBackmap(
+        const GDALGeoLocTransformInfo *psTransform, bool bGeolocMaxAccuracy,
+        const int *panIndices, int nStart, int nEnd, double *padfX,
+        double *padfY, int *panSuccess);
 };
 
 /*! @endcond */
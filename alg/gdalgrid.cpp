@@ -23,7 +23,10 @@
 
 #include <limits>
 #include <map>
+#include <memory>
+#include <new>
 #include <utility>
+#include <vector>
 #include <algorithm>
 
 #include "cpl_conv.h"
@@ -31,7 +34,6 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
-#include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
@@ -40,20 +42,124 @@
 constexpr double TO_RADIANS = M_PI / 180.0;
 
 /************************************************************************/
-/*                        GDALGridGetPointBounds()                      */
+/*                     GDALGridPointIndex::Build()                      */
 /************************************************************************/
 
-static void GDALGridGetPointBounds(const void *hFeature, CPLRectObj *pBounds)
+bool GDALGridPointIndex::Build(GUInt32 nPoints, const double *padfX,
+                               const double *padfY, const CPLRectObj &sExtent)
 {
-    const GDALGridPoint *psPoint = static_cast<const GDALGridPoint *>(hFeature);
-    GDALGridXYArrays *psXYArrays = psPoint->psXYArrays;
-    const int i = psPoint->i;
-    const double dfX = psXYArrays->padfX[i];
-    const double dfY = psXYArrays->padfY[i];
-    pBounds->minx = dfX;
-    pBounds->miny = dfY;
-    pBounds->maxx = dfX;
-    pBounds->maxy = dfY;
+    m_padfX = padfX;
+    m_padfY = padfY;
+    m_dfMinX = sExtent.minx;
+    m_dfMinY = sExtent.miny;
+
+    // Aim at about 4 points per cell, assuming a rather uniform distribution.
+    const double dfWidth = sExtent.maxx - sExtent.minx;
+    const double dfHeight = sExtent.maxy - sExtent.miny;
+    double dfCellSize = 2 * sqrt(dfWidth * dfHeight / std::max(1U, nPoints));
+    if (!(dfCellSize > 0))
+        dfCellSize = 4 * std::max(dfWidth, dfHeight) / std::max(1U, nPoints);
+    if (!(dfCellSize > 0))
+        dfCellSize = 1;
+    const auto GetCellCount = [&dfCellSize](double dfSize)
+    { return std::floor(dfSize / dfCellSize) + 1; };
+    // Avoid too many cells for very elongated extents.
+    while (GetCellCount(dfWidth) * GetCellCount(dfHeight) >
+           std::max(1.0, nPoints / 2.0))
+        dfCellSize *= 2;
+    m_nCellsX = static_cast<int>(GetCellCount(dfWidth));
+    m_nCellsY = static_cast<int>(GetCellCount(dfHeight));
+    m_dfInvCellSize = 1.0 / dfCellSize;
+
+    // Sort the point indices by cell with a counting sort, which keeps them
+    // in increasing order within a cell.
+    try
+    {
+        m_anCellStart.assign(
+            static_cast<size_t>(m_nCellsX) * m_nCellsY + 1, 0);
+        for (GUInt32 i = 0; i < nPoints; i++)
+            ++m_anCellStart[GetCell(padfX[i], padfY[i]) + 1];
+        for (size_t iCell = 1; iCell < m_anCellStart.size(); ++iCell)
+            m_anCellStart[iCell] += m_anCellStart[iCell - 1];
+
+        std::vector<GUInt32> anCellPos(m_anCellStart.begin(),
+                                       m_anCellStart.end() - 1);
+        m_anPointIdx.resize(nPoints);
+        for (GUInt32 i = 0; i < nPoints; i++)
+            m_anPointIdx[anCellPos[GetCell(padfX[i], padfY[i])]++] = i;
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for point index");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALGridPointIndex::GetCell()                     */
+/************************************************************************/
+
+size_t GDALGridPointIndex::GetCell(double dfX, double dfY) const
+{
+    const int nCellX = static_cast<int>(std::min(
+        std::max(0.0, (dfX - m_dfMinX) * m_dfInvCellSize), m_nCellsX - 1.0));
+    const int nCellY = static_cast<int>(std::min(
+        std::max(0.0, (dfY - m_dfMinY) * m_dfInvCellSize), m_nCellsY - 1.0));
+    return static_cast<size_t>(nCellY) * m_nCellsX + nCellX;
+}
+
+/************************************************************************/
+/*                    GDALGridPointIndex::Search()                      */
+/************************************************************************/
+
+/** Return the indices of the points within the rectangle, inclusive.
+ *
+ * The returned array is owned by the calling thread and is valid until its
+ * next call to Search().
+ */
+const GUInt32 *GDALGridPointIndex::Search(const CPLRectObj &sAoi,
+                                          int &nCount) const
+{
+    thread_local std::vector<GUInt32> anResult;
+    anResult.clear();
+    nCount = 0;
+
+    const double dfCellMinX = (sAoi.minx - m_dfMinX) * m_dfInvCellSize;
+    const double dfCellMaxX = (sAoi.maxx - m_dfMinX) * m_dfInvCellSize;
+    const double dfCellMinY = (sAoi.miny - m_dfMinY) * m_dfInvCellSize;
+    const double dfCellMaxY = (sAoi.maxy - m_dfMinY) * m_dfInvCellSize;
+    if (!(dfCellMaxX >= 0 && dfCellMinX < m_nCellsX && dfCellMaxY >= 0 &&
+          dfCellMinY < m_nCellsY))
+        return nullptr;
+    const int nCellMinX = static_cast<int>(std::max(0.0, dfCellMinX));
+    const int nCellMaxX =
+        static_cast<int>(std::min(dfCellMaxX, m_nCellsX - 1.0));
+    const int nCellMinY = static_cast<int>(std::max(0.0, dfCellMinY));
+    const int nCellMaxY =
+        static_cast<int>(std::min(dfCellMaxY, m_nCellsY - 1.0));
+
+    // The cells of a row of the search window are contiguous.
+    for (int nCellY = nCellMinY; nCellY <= nCellMaxY; ++nCellY)
+    {
+        const size_t nRowOffset = static_cast<size_t>(nCellY) * m_nCellsX;
+        const GUInt32 nStart = m_anCellStart[nRowOffset + nCellMinX];
+        const GUInt32 nEnd = m_anCellStart[nRowOffset + nCellMaxX + 1];
+        for (GUInt32 j = nStart; j < nEnd; ++j)
+        {
+            const GUInt32 i = m_anPointIdx[j];
+            const double dfX = m_padfX[i];
+            const double dfY = m_padfY[i];
+            if (dfX >= sAoi.minx && dfX <= sAoi.maxx && dfY >= sAoi.miny &&
+                dfY <= sAoi.maxy)
+            {
+                anResult.push_back(i);
+            }
+        }
+    }
+    nCount = static_cast<int>(anResult.size());
+    return anResult.data();
 }
 
 /************************************************************************/
@@ -257,8 +363,8 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -272,13 +378,12 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
 
@@ -288,7 +393,6 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -299,7 +403,6 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             }
         }
     }
-    CPLFree(papsPoints);
 
     double dfNominator = 0.0;
     double dfDenominator = 0.0;
@@ -366,8 +469,8 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -380,13 +483,12 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
 
@@ -396,7 +498,6 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -409,7 +510,6 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -646,7 +746,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -658,7 +758,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
     double dfAccumulator = 0.0;
 
     GUInt32 n = 0;  // Used after for.
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -666,13 +766,12 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -685,7 +784,6 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -749,8 +847,8 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
@@ -762,13 +860,12 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
             const double dfRXSquare = dfRX * dfRX;
@@ -784,7 +881,6 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -893,7 +989,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     const double dfR12Square = dfRadius1Square * dfRadius2Square;
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *hQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -906,7 +1002,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     GUInt32 i = 0;
 
     double dfSearchRadius = psExtraParams->dfInitialSearchRadius;
-    if (hQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
             dfSearchRadius =
@@ -919,32 +1015,36 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
             sAoi.maxx = dfXPoint + dfSearchRadius;
             sAoi.maxy = dfYPoint + dfSearchRadius;
             int nFeatureCount = 0;
-            GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-                CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount));
+            const GUInt32 *panPoints =
+                poPointIndex->Search(sAoi, nFeatureCount);
             if (nFeatureCount != 0)
             {
                 // Nearest distance will be initialized with the distance to the
                 // first point in array.
                 double dfNearestRSquare = std::numeric_limits<double>::max();
+                GUInt32 nNearestIdx = 0;
                 for (int k = 0; k < nFeatureCount; k++)
                 {
-                    const int idx = papsPoints[k]->i;
+                    const GUInt32 idx = panPoints[k];
                     const double dfRX = padfX[idx] - dfXPoint;
                     const double dfRY = padfY[idx] - dfYPoint;
 
+                    // On ties, select the point of highest index, as the
+                    // exhaustive search does, whatever the order of the
+                    // points returned by the index.
                     const double dfR2 = dfRX * dfRX + dfRY * dfRY;
-                    if (dfR2 <= dfNearestRSquare)
+                    if (dfR2 < dfNearestRSquare ||
+                        (dfR2 == dfNearestRSquare && idx > nNearestIdx))
                     {
                         dfNearestRSquare = dfR2;
+                        nNearestIdx = idx;
                         dfNearestValue = padfZ[idx];
                     }
                 }
 
-                CPLFree(papsPoints);
                 break;
             }
 
-            CPLFree(papsPoints);
             if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
                 break;
             dfSearchRadius *= 2;
@@ -1051,7 +1151,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1061,7 +1161,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
 
     double dfMinimumValue = std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1069,13 +1169,12 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -1089,7 +1188,6 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1163,8 +1261,8 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1172,15 +1270,14 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
             const double dfRXSquare = dfRX * dfRX;
@@ -1196,7 +1293,6 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1345,7 +1441,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1355,7 +1451,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
 
     double dfMaximumValue = -std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1363,13 +1459,12 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -1383,7 +1478,6 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1501,7 +1595,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1512,7 +1606,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
     double dfMaximumValue = -std::numeric_limits<double>::max();
     double dfMinimumValue = std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1520,13 +1614,12 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -1542,7 +1635,6 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1616,8 +1708,8 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1625,15 +1717,14 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
             const double dfRXSquare = dfRX * dfRX;
@@ -1649,7 +1740,6 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1773,7 +1863,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1782,7 +1872,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
     const double dfCoeff2 = bRotated ? sin(dfAngle) : 0.0;
 
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1790,13 +1880,12 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -1808,7 +1897,6 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1878,8 +1966,8 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1887,15 +1975,14 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
             const double dfRXSquare = dfRX * dfRX;
@@ -1911,7 +1998,6 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2033,7 +2119,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -2043,7 +2129,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
 
     double dfAccumulator = 0.0;
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2051,13 +2137,12 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX = padfX[i] - dfXPoint;
                 const double dfRY = padfY[i] - dfYPoint;
 
@@ -2070,7 +2155,6 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -2142,8 +2226,8 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
+    CPLAssert(poPointIndex);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2151,15 +2235,14 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     sAoi.maxx = dfXPoint + dfSearchRadius;
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
-    GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+    const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
         {
-            const int i = papsPoints[k]->i;
+            const int i = panPoints[k];
             const double dfRX = padfX[i] - dfXPoint;
             const double dfRY = padfY[i] - dfYPoint;
             const double dfRXSquare = dfRX * dfRX;
@@ -2175,7 +2258,6 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2299,7 +2381,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const GDALGridPointIndex *poPointIndex = psExtraParams->poPointIndex;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -2309,7 +2391,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
 
     double dfAccumulator = 0.0;
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (poPointIndex != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2317,13 +2399,12 @@ CPLErr GDALGridDataMetricAverageDistancePts(
         sAoi.maxx = dfXPoint + dfSearchRadius;
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
-        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        const GUInt32 *panPoints = poPointIndex->Search(sAoi, nFeatureCount);
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount - 1; k++)
             {
-                const int i = papsPoints[k]->i;
+                const int i = panPoints[k];
                 const double dfRX1 = padfX[i] - dfXPoint;
                 const double dfRY1 = padfY[i] - dfYPoint;
 
@@ -2335,7 +2416,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
                     // Search all the remaining points within the ellipse and
                     // compute distances between them and the first point.
                     {
-                        const int ji = papsPoints[j]->i;
+                        const int ji = panPoints[j];
                         double dfRX2 = padfX[ji] - dfXPoint;
                         double dfRY2 = padfY[ji] - dfYPoint;
 
@@ -2353,7 +2434,6 @@ CPLErr GDALGridDataMetricAverageDistancePts(
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -2690,8 +2770,6 @@ struct GDALGridContext
     GDALGridFunction pfnGDALGridMethod;
 
     GUInt32 nPoints;
-    GDALGridPoint *pasGridPoints;
-    GDALGridXYArrays sXYArrays;
 
     GDALGridExtraParameters sExtraParameters;
     double *padfX;
@@ -2702,7 +2780,7 @@ struct GDALGridContext
     CPLWorkerThreadPool *poWorkerThreadPool;
 };
 
-static void GDALGridContextCreateQuadTree(GDALGridContext *psContext);
+static void GDALGridContextCreatePointIndex(GDALGridContext *psContext);
 
 /**
  * Creates a context to do regular gridding from the scattered data.
@@ -2755,7 +2833,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     CPLAssert(padfX);
     CPLAssert(padfY);
     CPLAssert(padfZ);
-    bool bCreateQuadTree = false;
+    bool bCreatePointIndex = false;
 
     const unsigned int nPointCountThreshold =
         atoi(CPLGetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD", "100"));
@@ -2918,7 +2996,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 pfnGDALGridMethod =
                     GDALGridInverseDistanceToAPowerNearestNeighbor;
             }
-            bCreateQuadTree = true;
+            bCreatePointIndex = true;
             break;
         }
         case GGA_MovingAverage:
@@ -2939,12 +3017,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridMovingAveragePerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridMovingAverage;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -2966,7 +3044,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                    sizeof(GDALGridNearestNeighborOptions));
 
             pfnGDALGridMethod = GDALGridNearestNeighbor;
-            bCreateQuadTree = (nPoints > nPointCountThreshold &&
+            bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                poOptionsOld->dfAngle == 0.0 &&
                                (poOptionsOld->dfRadius1 > 0.0 ||
                                 poOptionsOld->dfRadius2 > 0.0));
@@ -2989,12 +3067,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricMinimumPerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricMinimum;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -3018,12 +3096,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricMaximumPerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricMaximum;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -3048,12 +3126,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricRangePerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricRange;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -3078,12 +3156,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricCountPerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricCount;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -3109,12 +3187,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             {
                 pfnGDALGridMethod =
                     GDALGridDataMetricAverageDistancePerQuadrant;
-                bCreateQuadTree = true;
+                bCreatePointIndex = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricAverageDistance;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -3136,7 +3214,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             memcpy(poOptionsNew, poOptions, sizeof(GDALGridDataMetricsOptions));
 
             pfnGDALGridMethod = GDALGridDataMetricAverageDistancePts;
-            bCreateQuadTree = (nPoints > nPointCountThreshold &&
+            bCreatePointIndex = (nPoints > nPointCountThreshold &&
                                poOptionsOld->dfAngle == 0.0 &&
                                (poOptionsOld->dfRadius1 > 0.0 ||
                                 poOptionsOld->dfRadius2 > 0.0));
@@ -3194,10 +3272,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     psContext->poOptions = poOptionsNew;
     psContext->pfnGDALGridMethod = pfnGDALGridMethod;
     psContext->nPoints = nPoints;
-    psContext->pasGridPoints = nullptr;
-    psContext->sXYArrays.padfX = padfX;
-    psContext->sXYArrays.padfY = padfY;
-    psContext->sExtraParameters.hQuadTree = nullptr;
+    psContext->sExtraParameters.poPointIndex = nullptr;
     psContext->sExtraParameters.dfInitialSearchRadius = 0.0;
     psContext->sExtraParameters.pafX = pafXAligned;
     psContext->sExtraParameters.pafY = pafYAligned;
@@ -3211,12 +3286,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
         pafXAligned ? false : !bCallerWillKeepPointArraysAlive;
 
     /* -------------------------------------------------------------------- */
-    /*  Create quadtree if requested and possible.                          */
+    /*  Create point index if requested and possible.                       */
     /* -------------------------------------------------------------------- */
-    if (bCreateQuadTree)
+    if (bCreatePointIndex)
     {
-        GDALGridContextCreateQuadTree(psContext);
-        if (psContext->sExtraParameters.hQuadTree == nullptr &&
+        GDALGridContextCreatePointIndex(psContext);
+        if (psContext->sExtraParameters.poPointIndex == nullptr &&
             (eAlgorithm == GGA_InverseDistanceToAPowerNearestNeighbor ||
              pfnGDALGridMethod == GDALGridMovingAveragePerQuadrant))
         {
@@ -3262,14 +3337,8 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     /* -------------------------------------------------------------------- */
     /*  Start thread pool.                                                  */
     /* -------------------------------------------------------------------- */
-    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
-    int nThreads = 0;
-    if (EQUAL(pszThreads, "ALL_CPUS"))
-        nThreads = CPLGetNumCPUs();
-    else
-        nThreads = atoi(pszThreads);
-    if (nThreads > 128)
-        nThreads = 128;
+    const int nThreads = CPLParseNumThreads(
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
     if (nThreads > 1)
     {
         psContext->poWorkerThreadPool = new CPLWorkerThreadPool();
@@ -3290,53 +3359,41 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
 }
 
 /************************************************************************/
-/*                      GDALGridContextCreateQuadTree()                 */
+/*                  GDALGridContextCreatePointIndex()                   */
 /************************************************************************/
 
-void GDALGridContextCreateQuadTree(GDALGridContext *psContext)
+void GDALGridContextCreatePointIndex(GDALGridContext *psContext)
 {
     const GUInt32 nPoints = psContext->nPoints;
-    psContext->pasGridPoints = static_cast<GDALGridPoint *>(
-        VSI_MALLOC2_VERBOSE(nPoints, sizeof(GDALGridPoint)));
-    if (psContext->pasGridPoints != nullptr)
+    const double *const padfX = psContext->padfX;
+    const double *const padfY = psContext->padfY;
+
+    // Determine point extents.
+    CPLRectObj sRect;
+    sRect.minx = padfX[0];
+    sRect.miny = padfY[0];
+    sRect.maxx = padfX[0];
+    sRect.maxy = padfY[0];
+    for (GUInt32 i = 1; i < nPoints; i++)
     {
-        const double *const padfX = psContext->padfX;
-        const double *const padfY = psContext->padfY;
-
-        // Determine point extents.
-        CPLRectObj sRect;
-        sRect.minx = padfX[0];
-        sRect.miny = padfY[0];
-        sRect.maxx = padfX[0];
-        sRect.maxy = padfY[0];
-        for (GUInt32 i = 1; i < nPoints; i++)
-        {
-            if (padfX[i] < sRect.minx)
-                sRect.minx = padfX[i];
-            if (padfY[i] < sRect.miny)
-                sRect.miny = padfY[i];
-            if (padfX[i] > sRect.maxx)
-                sRect.maxx = padfX[i];
-            if (padfY[i] > sRect.maxy)
-                sRect.maxy = padfY[i];
-        }
-
-        // Initial value for search radius is the typical dimension of a
-        // "pixel" of the point array (assuming rather uniform distribution).
-        psContext->sExtraParameters.dfInitialSearchRadius = sqrt(
-            (sRect.maxx - sRect.minx) * (sRect.maxy - sRect.miny) / nPoints);
+        if (padfX[i] < sRect.minx)
+            sRect.minx = padfX[i];
+        if (padfY[i] < sRect.miny)
+            sRect.miny = padfY[i];
+        if (padfX[i] > sRect.maxx)
+            sRect.maxx = padfX[i];
+        if (padfY[i] > sRect.maxy)
+            sRect.maxy = padfY[i];
+    }
 
-        psContext->sExtraParameters.hQuadTree =
-            CPLQuadTreeCreate(&sRect, GDALGridGetPointBounds);
+    // Initial value for search radius is the typical dimension of a
+    // "pixel" of the point array (assuming rather uniform distribution).
+    psContext->sExtraParameters.dfInitialSearchRadius =
+        sqrt((sRect.maxx - sRect.minx) * (sRect.maxy - sRect.miny) / nPoints);
 
-        for (GUInt32 i = 0; i < nPoints; i++)
-        {
-            psContext->pasGridPoints[i].psXYArrays = &(psContext->sXYArrays);
-            psContext->pasGridPoints[i].i = i;
-            CPLQuadTreeInsert(psContext->sExtraParameters.hQuadTree,
-                              psContext->pasGridPoints + i);
-        }
-    }
+    auto poPointIndex = std::make_unique<GDALGridPointIndex>();
+    if (poPointIndex->Build(nPoints, padfX, padfY, sRect))
+        psContext->sExtraParameters.poPointIndex = poPointIndex.release();
 }
 
 /************************************************************************/
@@ -3355,9 +3412,7 @@ void GDALGridContextFree(GDALGridContext *psContext)
     if (psContext)
     {
         CPLFree(psContext->poOptions);
-        CPLFree(psContext->pasGridPoints);
-        if (psContext->sExtraParameters.hQuadTree != nullptr)
-            CPLQuadTreeDestroy(psContext->sExtraParameters.hQuadTree);
+        delete psContext->sExtraParameters.poPointIndex;
         if (psContext->bFreePadfXYZArrays)
         {
             CPLFree(psContext->padfX);
@@ -3427,7 +3482,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
     // by sampling along the edges.  If all points on edges are within
     // triangles, then interior points will also be.
     if (psContext->eAlgorithm == GGA_Linear &&
-        psContext->sExtraParameters.hQuadTree == nullptr)
+        psContext->sExtraParameters.poPointIndex == nullptr)
     {
         bool bNeedNearest = false;
         int nStartLeft = 0;
@@ -3476,7 +3531,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         if (bNeedNearest)
         {
             CPLDebug("GDAL_GRID", "Will need nearest neighbour");
-            GDALGridContextCreateQuadTree(psContext);
+            GDALGridContextCreatePointIndex(psContext);
         }
     }
 
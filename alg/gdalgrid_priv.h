@@ -14,6 +14,8 @@
 #ifndef GDALGRID_PRIV_H
 #define GDALGRID_PRIV_H
 
+#include <vector>
+
 #include "cpl_error.h"
 #include "cpl_quad_tree.h"
 
@@ -21,21 +23,37 @@
 
 //! @cond Doxygen_Suppress
 
-typedef struct
+/** Index of the points, for fast search of the points within a rectangle.
+ *
+ * The extent of the points is divided into a regular grid of cells, and the
+ * point indices are stored sorted by cell, with the cells in row-major order.
+ * The candidate points of each row of a search window are thus contiguous in
+ * memory, and a search does no allocation once its result buffer has grown.
+ */
+class GDALGridPointIndex
 {
-    const double *padfX;
-    const double *padfY;
-} GDALGridXYArrays;
+  public:
+    bool Build(GUInt32 nPoints, const double *padfX, const double *padfY,
+               const CPLRectObj &sExtent);
+    const GUInt32 *Search(const CPLRectObj &sAoi, int &nCount) const;
 
-typedef struct
-{
-    GDALGridXYArrays *psXYArrays;
-    int i;
-} GDALGridPoint;
+  private:
+    const double *m_padfX = nullptr;
+    const double *m_padfY = nullptr;
+    double m_dfMinX = 0;
+    double m_dfMinY = 0;
+    double m_dfInvCellSize = 1;
+    int m_nCellsX = 0;
+    int m_nCellsY = 0;
+    std::vector<GUInt32> m_anCellStart{};  // Size is number of cells + 1
+    std::vector<GUInt32> m_anPointIdx{};
+
+    size_t GetCell(double dfX, double dfY) const;
+};
 
 typedef struct
 {
-    CPLQuadTree *hQuadTree;
+    GDALGridPointIndex *poPointIndex;
     double dfInitialSearchRadius;
     float *pafX;  // Aligned to be usable with AVX
     float *pafY;
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <limits>
 #include <new>
+#include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -598,6 +599,70 @@ template <class T> static inline T ClampAndRound(double dfVal, T nMaxValue)
         return static_cast<T>(dfVal + 0.5);
 }
 
+/* We restrict to 64bit processors because they are guaranteed to have SSE2 */
+/* Could possibly be used too on 32bit, but we would need to check at runtime */
+#if defined(__x86_64) || defined(_M_X64) || defined(USE_NEON_OPTIMIZATIONS)
+#define USE_SSE2
+#include "gdalsse_priv.h"
+#endif
+
+/************************************************************************/
+/*                     WeightedBroveyFloat64SIMD()                      */
+/************************************************************************/
+
+/* Process values of a Float64 working buffer 4 at a time, whatever the */
+/* number of bands and the sign of the weights, and return the number of */
+/* processed values. Operations are done in the same order as the scalar */
+/* loop of WeightedBrovey3(), so results are identical. */
+
+template <class OutDataType>
+static size_t
+WeightedBroveyFloat64SIMD(const GDALPansharpenOptions *psOptions,
+                          const double *pPanBuffer,
+                          const double *pUpsampledSpectralBuffer,
+                          OutDataType *pDataBuf, size_t nValues,
+                          size_t nBandValues)
+{
+#ifdef USE_SSE2
+    const XMMReg4Double zero = XMMReg4Double::Zero();
+    size_t j = 0;  // Used after for.
+    for (; j + 3 < nValues; j += 4)
+    {
+        XMMReg4Double pseudoPanchro = zero;
+        for (int i = 0; i < psOptions->nInputSpectralBands; i++)
+        {
+            pseudoPanchro +=
+                XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + i) *
+                XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                        i * nBandValues + j);
+        }
+
+        const XMMReg4Double factor = XMMReg4Double::And(
+            XMMReg4Double::NotEquals(pseudoPanchro, zero),
+            XMMReg4Double::Load4Val(pPanBuffer + j) / pseudoPanchro);
+
+        for (int i = 0; i < psOptions->nOutPansharpenedBands; i++)
+        {
+            const XMMReg4Double val =
+                XMMReg4Double::Load4Val(
+                    pUpsampledSpectralBuffer +
+                    psOptions->panOutPansharpenedBands[i] * nBandValues + j) *
+                factor;
+            val.Store4Val(pDataBuf + i * nBandValues + j);
+        }
+    }
+    return j;
+#else
+    CPL_IGNORE_RET_VAL(psOptions);
+    CPL_IGNORE_RET_VAL(pPanBuffer);
+    CPL_IGNORE_RET_VAL(pUpsampledSpectralBuffer);
+    CPL_IGNORE_RET_VAL(pDataBuf);
+    CPL_IGNORE_RET_VAL(nValues);
+    CPL_IGNORE_RET_VAL(nBandValues);
+    return 0;
+#endif
+}
+
 /************************************************************************/
 /*                         WeightedBrovey()                             */
 /************************************************************************/
@@ -616,7 +681,17 @@ void GDALPansharpenOperation::WeightedBrovey3(
         return;
     }
 
-    for (size_t j = 0; j < nValues; j++)
+    size_t j = 0;  // Used after for.
+    if constexpr (std::is_same_v<WorkDataType, double> && !bHasBitDepth &&
+                  (std::is_same_v<OutDataType, double> ||
+                   std::is_same_v<OutDataType, float>))
+    {
+        j = WeightedBroveyFloat64SIMD(psOptions, pPanBuffer,
+                                      pUpsampledSpectralBuffer, pDataBuf,
+                                      nValues, nBandValues);
+    }
+
+    for (; j < nValues; j++)
     {
         double dfFactor = 0.0;
         // if( pPanBuffer[j] == 0 )
@@ -649,12 +724,7 @@ void GDALPansharpenOperation::WeightedBrovey3(
     }
 }
 
-/* We restrict to 64bit processors because they are guaranteed to have SSE2 */
-/* Could possibly be used too on 32bit, but we would need to check at runtime */
-#if defined(__x86_64) || defined(_M_X64) || defined(USE_NEON_OPTIMIZATIONS)
-
-#define USE_SSE2
-#include "gdalsse_priv.h"
+#ifdef USE_SSE2
 
 template <class T, int NINPUT, int NOUTPUT>
 size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
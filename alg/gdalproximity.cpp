@@ -18,13 +18,18 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -33,6 +38,308 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+/************************************************************************/
+/*                         IsProximityTarget()                          */
+/************************************************************************/
+
+static bool IsProximityTarget(GInt32 nVal, int nTargetValues,
+                              const int *panTargetValues)
+{
+    if (nTargetValues == 0)
+        return nVal != 0;
+    for (int i = 0; i < nTargetValues; i++)
+    {
+        if (nVal == panTargetValues[i])
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     ExactDistanceTransformLine()                     */
+/*                                                                      */
+/*      One-dimensional squared Euclidean distance transform of a      */
+/*      line (Felzenszwalb & Huttenlocher), given for each pixel the    */
+/*      distance to the nearest target in its column (negative if       */
+/*      there is none).                                                 */
+/************************************************************************/
+
+namespace
+{
+struct EDTScratch
+{
+    std::vector<int> anV{};
+    std::vector<double> adfZ{};
+    std::vector<double> adfF{};
+};
+}  // namespace
+
+static void ExactDistanceTransformLine(const GInt32 *panColDist, int nXSize,
+                                       EDTScratch &oScratch,
+                                       double *padfDistSq)
+{
+    int *panV = oScratch.anV.data();
+    double *padfZ = oScratch.adfZ.data();
+    double *padfF = oScratch.adfF.data();
+
+    // Build the lower envelope of the parabolas rooted at each pixel having
+    // a target in its column.
+    int k = -1;
+    for (int q = 0; q < nXSize; q++)
+    {
+        if (panColDist[q] < 0)
+            continue;
+        const double dfFq =
+            static_cast<double>(panColDist[q]) * panColDist[q] +
+            static_cast<double>(q) * q;
+        double dfS = -std::numeric_limits<double>::infinity();
+        while (k >= 0)
+        {
+            dfS = (dfFq - padfF[k]) / (2.0 * (q - panV[k]));
+            if (dfS <= padfZ[k])
+                k--;
+            else
+                break;
+        }
+        if (k < 0)
+            dfS = -std::numeric_limits<double>::infinity();
+        k++;
+        panV[k] = q;
+        padfF[k] = dfFq;
+        padfZ[k] = dfS;
+    }
+
+    if (k < 0)
+    {
+        for (int x = 0; x < nXSize; x++)
+            padfDistSq[x] = -1.0;
+        return;
+    }
+
+    for (int x = 0, j = 0; x < nXSize; x++)
+    {
+        while (j < k && padfZ[j + 1] < x)
+            j++;
+        const double dfDX = static_cast<double>(x) - panV[j];
+        const double dfDYSq = padfF[j] - static_cast<double>(panV[j]) * panV[j];
+        padfDistSq[x] = dfDX * dfDX + dfDYSq;
+    }
+}
+
+/************************************************************************/
+/*                       ComputeExactProximity()                        */
+/*                                                                      */
+/*      Separable exact Euclidean distance transform. A top to bottom   */
+/*      pass stores in the work band the distance to the nearest        */
+/*      target above each pixel, in its column. A bottom to top pass    */
+/*      completes those column distances, and runs the row transform    */
+/*      on batches of lines, in parallel. Memory use is bounded by the  */
+/*      size of a batch.                                                */
+/************************************************************************/
+
+static CPLErr ComputeExactProximity(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hWorkProximityBand,
+    GDALRasterBandH hProximityBand, int nXSize, int nYSize, double dfMaxDist,
+    double dfDistMult, const double *pdfSrcNoData, float fNoDataValue,
+    bool bFixedBufVal, double dfFixedBufVal, int nTargetValues,
+    const int *panTargetValues, int nThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    // Source values, column distances and output proximity for each pixel
+    // of a batch.
+    constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+    const size_t nBytesPerLine =
+        static_cast<size_t>(nXSize) *
+        (sizeof(GInt32) + sizeof(GInt32) + sizeof(float) + sizeof(double));
+    const int nBatchLines = static_cast<int>(std::min<size_t>(
+        nYSize, std::max<size_t>(1, BATCH_BYTES / nBytesPerLine)));
+    nThreads = std::min(nThreads, nBatchLines);
+
+    std::vector<GInt32> anSrc;
+    std::vector<GInt32> anColDist;
+    std::vector<float> afProximity;
+    std::vector<GInt32> anNearestTarget;
+    std::vector<EDTScratch> aoScratch;
+    std::vector<std::vector<double>> aadfDistSq;
+    try
+    {
+        const size_t nBatchPixels = static_cast<size_t>(nXSize) * nBatchLines;
+        anSrc.resize(nBatchPixels);
+        anColDist.resize(nBatchPixels);
+        afProximity.resize(nBatchPixels);
+        anNearestTarget.resize(nXSize, -1);
+        aoScratch.resize(nThreads);
+        aadfDistSq.resize(nThreads);
+        for (int i = 0; i < nThreads; i++)
+        {
+            aoScratch[i].anV.resize(nXSize);
+            aoScratch[i].adfZ.resize(nXSize + 1);
+            aoScratch[i].adfF.resize(nXSize);
+            aadfDistSq[i].resize(nXSize);
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating proximity buffers");
+        return CE_Failure;
+    }
+
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    /* -------------------------------------------------------------------- */
+    /*      Top to bottom: distance to the nearest target above.            */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iY0 = 0; eErr == CE_None && iY0 < nYSize; iY0 += nBatchLines)
+    {
+        const int nLines = std::min(nBatchLines, nYSize - iY0);
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY0, nXSize, nLines,
+                            anSrc.data(), nXSize, nLines, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        for (int iLine = 0; iLine < nLines; iLine++)
+        {
+            const size_t nOff = static_cast<size_t>(iLine) * nXSize;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (IsProximityTarget(anSrc[nOff + i], nTargetValues,
+                                      panTargetValues))
+                    anNearestTarget[i] = iY0 + iLine;
+                anColDist[nOff + i] = anNearestTarget[i] < 0
+                                          ? -1
+                                          : iY0 + iLine - anNearestTarget[i];
+            }
+        }
+
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Write, 0, iY0, nXSize,
+                            nLines, anColDist.data(), nXSize, nLines,
+                            GDT_Int32, 0, 0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 * (iY0 + nLines) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Bottom to top: complete column distances, and transform rows.   */
+    /* -------------------------------------------------------------------- */
+    std::fill(anNearestTarget.begin(), anNearestTarget.end(), -1);
+
+    const auto ProcessLines =
+        [&](int iThread, int iFirstLine, int iLastLine)
+    {
+        double *padfDistSq = aadfDistSq[iThread].data();
+        for (int iLine = iFirstLine; iLine < iLastLine; iLine++)
+        {
+            const size_t nOff = static_cast<size_t>(iLine) * nXSize;
+            ExactDistanceTransformLine(anColDist.data() + nOff, nXSize,
+                                       aoScratch[iThread], padfDistSq);
+            for (int i = 0; i < nXSize; i++)
+            {
+                float &fProx = afProximity[nOff + i];
+                const GInt32 nVal = anSrc[nOff + i];
+                if (anColDist[nOff + i] == 0 &&
+                    IsProximityTarget(nVal, nTargetValues, panTargetValues))
+                {
+                    fProx = 0.0f;
+                }
+                else if (padfDistSq[i] < 0 ||
+                         padfDistSq[i] > dfMaxDist * dfMaxDist ||
+                         (pdfSrcNoData != nullptr && nVal == *pdfSrcNoData))
+                {
+                    fProx = fNoDataValue;
+                }
+                else if (bFixedBufVal)
+                {
+                    fProx = static_cast<float>(dfFixedBufVal);
+                }
+                else
+                {
+                    fProx = static_cast<float>(
+                        static_cast<float>(sqrt(padfDistSq[i])) * dfDistMult);
+                }
+            }
+        }
+    };
+
+    for (int iY1 = nYSize; eErr == CE_None && iY1 > 0; iY1 -= nBatchLines)
+    {
+        const int iY0 = std::max(0, iY1 - nBatchLines);
+        const int nLines = iY1 - iY0;
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY0, nXSize, nLines,
+                            anSrc.data(), nXSize, nLines, GDT_Int32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hWorkProximityBand, GF_Read, 0, iY0, nXSize,
+                                nLines, anColDist.data(), nXSize, nLines,
+                                GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        for (int iLine = nLines - 1; iLine >= 0; iLine--)
+        {
+            const size_t nOff = static_cast<size_t>(iLine) * nXSize;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (anColDist[nOff + i] == 0 &&
+                    IsProximityTarget(anSrc[nOff + i], nTargetValues,
+                                      panTargetValues))
+                    anNearestTarget[i] = iY0 + iLine;
+                if (anNearestTarget[i] >= 0)
+                {
+                    const GInt32 nBelow = anNearestTarget[i] - (iY0 + iLine);
+                    if (anColDist[nOff + i] < 0 ||
+                        nBelow < anColDist[nOff + i])
+                        anColDist[nOff + i] = nBelow;
+                }
+            }
+        }
+
+        const int nJobs = std::min(nThreads, nLines);
+        if (poJobQueue && nJobs > 1)
+        {
+            for (int i = 0; i < nJobs; i++)
+            {
+                const int iFirstLine = static_cast<int>(
+                    static_cast<int64_t>(i) * nLines / nJobs);
+                const int iLastLine = static_cast<int>(
+                    static_cast<int64_t>(i + 1) * nLines / nJobs);
+                poJobQueue->SubmitJob(
+                    [&ProcessLines, i, iFirstLine, iLastLine]()
+                    { ProcessLines(i, iFirstLine, iLastLine); });
+            }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            ProcessLines(0, 0, nLines);
+        }
+
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iY0, nXSize, nLines,
+                            afProximity.data(), nXSize, nLines, GDT_Float32, 0,
+                            0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 + 0.5 * (nYSize - iY0) /
+                                   static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -89,6 +396,19 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  EXACT=YES/NO
+
+(GDAL >= 3.11) If this option is set, an exact separable Euclidean
+distance transform is used, instead of the default approximate
+propagation of nearest targets. Memory use is bounded, as lines are
+processed by batches.
+
+  NUM_THREADS=n/ALL_CPUS
+
+(GDAL >= 3.11) Number of threads used to process each batch of lines when
+EXACT=YES. Defaults to the value of the GDAL_NUM_THREADS configuration
+option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -204,6 +524,15 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         bFixedBufVal = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Exact distance transform, and its number of threads.            */
+    /* -------------------------------------------------------------------- */
+    const bool bExact = CPLFetchBool(papszOptions, "EXACT", false);
+    const int nThreads = CPLParseNumThreads(
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1")),
+        128);
+
     /* -------------------------------------------------------------------- */
     /*      Get the target value(s).                                        */
     /* -------------------------------------------------------------------- */
@@ -238,7 +567,8 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     /* -------------------------------------------------------------------- */
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
-    /*      temporary file for this purpose.                                */
+    /*      temporary file for this purpose. The exact transform also       */
+    /*      needs to store distances up to the raster height.               */
     /* -------------------------------------------------------------------- */
     GDALRasterBandH hWorkProximityBand = hProximityBand;
     GDALDatasetH hWorkProximityDS = nullptr;
@@ -253,7 +583,8 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     bool bTempFileAlreadyDeleted = false;
 
     if (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+        eProxType == GDT_UInt32 ||
+        (bExact && (eProxType == GDT_Int8 || eProxType == GDT_Int16)))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
@@ -278,6 +609,16 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         hWorkProximityBand = GDALGetRasterBand(hWorkProximityDS, 1);
     }
 
+    if (bExact)
+    {
+        eErr = ComputeExactProximity(
+            hSrcBand, hWorkProximityBand, hProximityBand, nXSize, nYSize,
+            dfMaxDist, dfDistMult, pdfSrcNoData, fNoDataValue, bFixedBufVal,
+            dfFixedBufVal, nTargetValues, panTargetValues, nThreads,
+            pfnProgress, pProgressArg);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate buffer for two scanlines of distances as floats        */
     /*      (the current and last line).                                    */
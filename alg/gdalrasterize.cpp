@@ -20,18 +20,24 @@
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
+#include <cmath>
 #include <limits>
+#include <memory>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -764,6 +770,61 @@ static void gv_rasterize_one_shape(
     delete sInfo.poSetVisitedPoints;
 }
 
+/************************************************************************/
+/*                    GDALRasterizeGetGeomRowRange()                    */
+/*                                                                      */
+/*      Compute the range of raster rows a geometry may burn, with a    */
+/*      safety margin of one row on each side. If the geometry cannot   */
+/*      be reliably transformed, the full raster height is returned.    */
+/************************************************************************/
+
+static std::pair<int, int>
+GDALRasterizeGetGeomRowRange(const OGRGeometry *poShape, int nRasterYSize,
+                             GDALTransformerFunc pfnTransformer,
+                             void *pTransformArg)
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return {1, 0};
+
+    std::vector<double> aPointX;
+    std::vector<double> aPointY;
+    std::vector<double> aPointVariant;
+    std::vector<int> aPartSize;
+    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
+                                 aPartSize, GBV_UserBurnValue);
+    if (aPointX.empty())
+        return {1, 0};
+
+    if (pfnTransformer != nullptr)
+    {
+        std::vector<int> anSuccess(aPointX.size());
+        if (!pfnTransformer(pTransformArg, FALSE,
+                            static_cast<int>(aPointX.size()), aPointX.data(),
+                            aPointY.data(), nullptr, anSuccess.data()) ||
+            std::find(anSuccess.begin(), anSuccess.end(), FALSE) !=
+                anSuccess.end())
+        {
+            return {-1, nRasterYSize};
+        }
+    }
+
+    double dfYMin = std::numeric_limits<double>::infinity();
+    double dfYMax = -std::numeric_limits<double>::infinity();
+    for (const double dfY : aPointY)
+    {
+        if (std::isnan(dfY))
+            return {-1, nRasterYSize};
+        dfYMin = std::min(dfYMin, dfY);
+        dfYMax = std::max(dfYMax, dfY);
+    }
+
+    if (dfYMax < -1 || dfYMin > nRasterYSize + 1)
+        return {1, 0};
+    return {static_cast<int>(std::max(-1.0, std::floor(dfYMin) - 1)),
+            static_cast<int>(std::min(static_cast<double>(nRasterYSize),
+                                      std::ceil(dfYMax) + 1))};
+}
+
 /************************************************************************/
 /*                        GDALRasterizeOptions()                        */
 /*                                                                      */
@@ -925,6 +986,11 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * with tiled images to be efficient. The auto mode (the default) will chose
  * the algorithm based on input and output properties.
  * </li>
+ * <li>"NUM_THREADS": (GDAL >= 3.11) Number of threads, or ALL_CPUS, used to
+ * burn each chunk in OPTIM=RASTER mode. Defaults to the value of the
+ * GDAL_NUM_THREADS configuration option, or 1. Requires the transformer to
+ * be clonable with GDALCloneTransformer(), which is the case of the default
+ * one. Results are identical to single-threaded ones.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1193,6 +1259,183 @@ static CPLErr GDALRasterizeGeometriesInternal(
             return CE_Failure;
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      Set up multi-threading. Each chunk is split into swaths of */
+        /*      rows burnt in parallel, each with its own transformer. */
+        /* --------------------------------------------------------------------
+         */
+        int nThreads = std::min(
+            nYChunkSize,
+            CPLParseNumThreads(
+                CSLFetchNameValueDef(
+                    papszOptions, "NUM_THREADS",
+                    CPLGetConfigOption("GDAL_NUM_THREADS", "1")),
+                128));
+        std::vector<void *> apTransformArgs{pTransformArg};
+        for (int i = 1; i < nThreads; ++i)
+        {
+            void *pClone;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                pClone = GDALCloneTransformer(pTransformArg);
+            }
+            if (pClone == nullptr)
+            {
+                CPLDebug("GDAL", "Transformer cannot be cloned. "
+                                 "Rasterizing with a single thread");
+                nThreads = 1;
+                break;
+            }
+            apTransformArgs.push_back(pClone);
+        }
+        const auto DestroyTransformerClones = [&apTransformArgs]()
+        {
+            for (size_t i = 1; i < apTransformArgs.size(); ++i)
+                GDALDestroyTransformer(apTransformArgs[i]);
+        };
+        auto poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+        if (!poJobQueue)
+            nThreads = 1;
+
+        /* --------------------------------------------------------------------
+         */
+        /*      When there are several chunks or swaths, bin the geometries */
+        /*      per chunk, so that each one only goes through the geometries */
+        /*      it may intersect. */
+        /* --------------------------------------------------------------------
+         */
+        const int nRasterYSize = poDS->GetRasterYSize();
+        const int nChunks = (nRasterYSize + nYChunkSize - 1) / nYChunkSize;
+        const bool bBinning = nChunks > 1 || nThreads > 1;
+        std::vector<std::pair<int, int>> anGeomRowRange;
+        std::vector<std::vector<int>> aanChunkGeoms;
+        if (bBinning)
+        {
+            try
+            {
+                anGeomRowRange.resize(nGeomCount);
+                aanChunkGeoms.resize(nChunks);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating geometry bins");
+                DestroyTransformerClones();
+                VSIFree(pabyChunkBuf);
+                if (bNeedToFreeTransformer)
+                    GDALDestroyTransformer(pTransformArg);
+                return CE_Failure;
+            }
+
+            const auto ComputeRowRanges =
+                [&anGeomRowRange, pahGeometries, nRasterYSize, pfnTransformer,
+                 &apTransformArgs](int iThread, int iStart, int iEnd)
+            {
+                for (int iShape = iStart; iShape < iEnd; ++iShape)
+                {
+                    anGeomRowRange[iShape] = GDALRasterizeGetGeomRowRange(
+                        OGRGeometry::FromHandle(pahGeometries[iShape]),
+                        nRasterYSize, pfnTransformer,
+                        apTransformArgs[iThread]);
+                }
+            };
+            if (poJobQueue)
+            {
+                CPLErrorAccumulator oErrorAccumulator;
+                const int nPerThread = (nGeomCount + nThreads - 1) / nThreads;
+                for (int i = 0; i < nThreads; ++i)
+                {
+                    const int iStart = i * nPerThread;
+                    const int iEnd = std::min(nGeomCount, iStart + nPerThread);
+                    if (iStart < iEnd)
+                    {
+                        poJobQueue->SubmitJob(
+                            [&ComputeRowRanges, &oErrorAccumulator, i, iStart,
+                             iEnd]()
+                            {
+                                auto oAccumulator =
+                                    oErrorAccumulator.InstallForCurrentScope();
+                                CPL_IGNORE_RET_VAL(oAccumulator);
+                                ComputeRowRanges(i, iStart, iEnd);
+                            });
+                    }
+                }
+                poJobQueue->WaitCompletion();
+                oErrorAccumulator.ReplayErrors();
+            }
+            else
+            {
+                ComputeRowRanges(0, 0, nGeomCount);
+            }
+
+            for (int iShape = 0; iShape < nGeomCount; ++iShape)
+            {
+                const auto &oRange = anGeomRowRange[iShape];
+                if (oRange.first > oRange.second)
+                    continue;
+                const int iFirstChunk = std::max(0, oRange.first) / nYChunkSize;
+                const int iLastChunk =
+                    std::min(nRasterYSize - 1, oRange.second) / nYChunkSize;
+                for (int iChunk = iFirstChunk; iChunk <= iLastChunk; ++iChunk)
+                    aanChunkGeoms[iChunk].push_back(iShape);
+            }
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Burn the geometries of a chunk into a swath of its rows. */
+        /* --------------------------------------------------------------------
+         */
+        const auto BurnSwath =
+            [&](int iThread, int iChunk, int iChunkYOff, int nThisYChunkSize,
+                int nSwathYOff, int nSwathYSize)
+        {
+            const int nDTSize = GDALGetDataTypeSizeBytes(eType);
+            const GSpacing nLineSpace =
+                static_cast<GSpacing>(poDS->GetRasterXSize()) * nDTSize;
+            const GSpacing nBandSpace = nLineSpace * nThisYChunkSize;
+            const auto BurnShape = [&](int iShape)
+            {
+                gv_rasterize_one_shape(
+                    pabyChunkBuf + nSwathYOff * nLineSpace, 0,
+                    iChunkYOff + nSwathYOff, poDS->GetRasterXSize(),
+                    nSwathYSize, nBandCount, eType, 0, nLineSpace, nBandSpace,
+                    bAllTouched, OGRGeometry::FromHandle(pahGeometries[iShape]),
+                    eBurnValueType,
+                    padfGeomBurnValues
+                        ? padfGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    panGeomBurnValues
+                        ? panGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    eBurnValueSource, eMergeAlg, pfnTransformer,
+                    apTransformArgs[iThread]);
+            };
+
+            if (bBinning)
+            {
+                const int nRowStart = iChunkYOff + nSwathYOff;
+                const int nRowEnd = nRowStart + nSwathYSize - 1;
+                for (const int iShape : aanChunkGeoms[iChunk])
+                {
+                    const auto &oRange = anGeomRowRange[iShape];
+                    if (oRange.second >= nRowStart && oRange.first <= nRowEnd)
+                        BurnShape(iShape);
+                }
+            }
+            else
+            {
+                for (int iShape = 0; iShape < nGeomCount; iShape++)
+                    BurnShape(iShape);
+            }
+        };
+
         /* ====================================================================
          */
         /*      Loop over image in designated chunks. */
@@ -1200,12 +1443,12 @@ static CPLErr GDALRasterizeGeometriesInternal(
          */
         pfnProgress(0.0, nullptr, pProgressArg);
 
-        for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
-             iY += nYChunkSize)
+        for (int iY = 0, iChunk = 0; iY < nRasterYSize && eErr == CE_None;
+             iY += nYChunkSize, ++iChunk)
         {
             int nThisYChunkSize = nYChunkSize;
-            if (nThisYChunkSize + iY > poDS->GetRasterYSize())
-                nThisYChunkSize = poDS->GetRasterYSize() - iY;
+            if (nThisYChunkSize + iY > nRasterYSize)
+                nThisYChunkSize = nRasterYSize - iY;
 
             eErr = poDS->RasterIO(
                 GF_Read, 0, iY, poDS->GetRasterXSize(), nThisYChunkSize,
@@ -1214,22 +1457,35 @@ static CPLErr GDALRasterizeGeometriesInternal(
             if (eErr != CE_None)
                 break;
 
-            for (int iShape = 0; iShape < nGeomCount; iShape++)
+            const int nSwaths = std::min(nThreads, nThisYChunkSize);
+            if (nSwaths > 1)
             {
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    OGRGeometry::FromHandle(pahGeometries[iShape]),
-                    eBurnValueType,
-                    padfGeomBurnValues
-                        ? padfGeomBurnValues +
-                              static_cast<size_t>(iShape) * nBandCount
-                        : nullptr,
-                    panGeomBurnValues
-                        ? panGeomBurnValues +
-                              static_cast<size_t>(iShape) * nBandCount
-                        : nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
+                CPLErrorAccumulator oErrorAccumulator;
+                for (int i = 0; i < nSwaths; ++i)
+                {
+                    const int nSwathYOff = static_cast<int>(
+                        static_cast<int64_t>(i) * nThisYChunkSize / nSwaths);
+                    const int nSwathYSize =
+                        static_cast<int>(static_cast<int64_t>(i + 1) *
+                                         nThisYChunkSize / nSwaths) -
+                        nSwathYOff;
+                    poJobQueue->SubmitJob(
+                        [&BurnSwath, &oErrorAccumulator, i, iChunk, iY,
+                         nThisYChunkSize, nSwathYOff, nSwathYSize]()
+                        {
+                            auto oAccumulator =
+                                oErrorAccumulator.InstallForCurrentScope();
+                            CPL_IGNORE_RET_VAL(oAccumulator);
+                            BurnSwath(i, iChunk, iY, nThisYChunkSize,
+                                      nSwathYOff, nSwathYSize);
+                        });
+                }
+                poJobQueue->WaitCompletion();
+                oErrorAccumulator.ReplayErrors();
+            }
+            else
+            {
+                BurnSwath(0, iChunk, iY, nThisYChunkSize, 0, nThisYChunkSize);
             }
 
             eErr = poDS->RasterIO(
@@ -1238,13 +1494,15 @@ static CPLErr GDALRasterizeGeometriesInternal(
                 nBandCount, panBandList, 0, 0, 0, nullptr);
 
             if (!pfnProgress((iY + nThisYChunkSize) /
-                                 static_cast<double>(poDS->GetRasterYSize()),
+                                 static_cast<double>(nRasterYSize),
                              "", pProgressArg))
             {
                 CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
                 eErr = CE_Failure;
             }
         }
+
+        DestroyTransformerClones();
     }
     /* -------------------------------------------------------------------- */
     /*      The new algorithm                                               */
@@ -17,7 +17,11 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
@@ -27,6 +31,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -125,6 +130,601 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                        ResolveBigNeighbours()                        */
+/*                                                                      */
+/*      If our biggest neighbour is still smaller than the              */
+/*      threshold, then try tracking to that polygons biggest           */
+/*      neighbour, and so forth.  On return, anBigNeighbour[] holds     */
+/*      the id of the polygon each small polygon must be merged         */
+/*      into, or -1.                                                    */
+/************************************************************************/
+
+static void ResolveBigNeighbours(const GInt32 *panPolyIdMap,
+                                 const std::int64_t *panPolyValue,
+                                 const std::vector<int> &anPolySizes,
+                                 int nSizeThreshold,
+                                 std::vector<int> &anBigNeighbour)
+{
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        if (panPolyIdMap[iPoly] != iPoly)
+            continue;
+
+        // Ignore nodata polygons.
+        if (panPolyValue[iPoly] == GP_NODATA_MARKER)
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (anPolySizes[iPoly] >= nSizeThreshold)
+        {
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (anPolySizes[iFinalId] >= nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = anBigNeighbour[iPolyCur];
+            anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                       GDALSieveFilterByStrips()                      */
+/*                                                                      */
+/*      Multithreaded implementation of GDALSieveFilter().  The         */
+/*      raster is split into horizontal strips, each labelled by its    */
+/*      own polygon enumerator in a worker thread.  Polygons of all     */
+/*      strips are given ids in a single id space, and the polygons     */
+/*      touching each other across strip borders are then merged       */
+/*      with a union-find.  The largest neighbour search and the        */
+/*      rewriting of pixel values are also done per strip.  Raster I/O */
+/*      is serialized, so the result is identical to the single        */
+/*      threaded implementation.                                        */
+/************************************************************************/
+
+namespace
+{
+struct GDALSieveStrip
+{
+    int nYOff = 0;
+    int nYSize = 0;
+    // First id of the polygons of this strip in the global id space.
+    int nIdOffset = 0;
+    int nPolygonCount = 0;
+
+    std::unique_ptr<GDALRasterPolygonEnumerator> poEnum{};
+    std::vector<int> anPolySizes{};
+
+    // Masked values and strip local polygon ids of the first and last lines.
+    std::vector<std::int64_t> anFirstLineVal{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<std::int64_t> anLastLineVal{};
+    std::vector<GInt32> anLastLineId{};
+
+    // Largest neighbour seen in this strip, for polygons smaller than the
+    // threshold.
+    std::unordered_map<int, int> oMapBigNeighbour{};
+};
+}  // namespace
+
+static int SieveFindRoot(std::vector<int> &anParent, int nId)
+{
+    while (anParent[nId] != nId)
+    {
+        anParent[nId] = anParent[anParent[nId]];
+        nId = anParent[nId];
+    }
+    return nId;
+}
+
+static CPLErr GDALSieveFilterByStrips(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
+    int nStrips, CPLWorkerThreadPool *poThreadPool,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    std::vector<GDALSieveStrip> aoStrips;
+    try
+    {
+        aoStrips.resize(nStrips);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+    for (int i = 0; i < nStrips; i++)
+    {
+        aoStrips[i].nYOff =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * i / nStrips);
+        aoStrips[i].nYSize =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * (i + 1) / nStrips) -
+            aoStrips[i].nYOff;
+    }
+
+    // GDAL datasets are not thread-safe: all raster I/O goes through this
+    // mutex.
+    std::mutex oIOMutex;
+    std::atomic<bool> bError{false};
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nLinesDone{0};
+
+    // Read a source line, keep a copy of it before masking if panRawVal is
+    // not null, and apply the mask.
+    const auto ReadLine = [&](int iY, std::int64_t *panVal,
+                              std::int64_t *panRawVal, GByte *pabyMaskLine)
+    {
+        std::lock_guard<std::mutex> oLock(oIOMutex);
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panVal,
+                                   nXSize, 1, GDT_Int64, 0, 0);
+        if (eErr == CE_None && panRawVal)
+            memcpy(panRawVal, panVal, sizeof(panVal[0]) * nXSize);
+        if (eErr == CE_None && hMaskBand != nullptr)
+            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize, panVal);
+        return eErr == CE_None;
+    };
+
+    // Run pfnJob on each strip, and report progress between dfProgressStart
+    // and dfProgressEnd.
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    const auto RunPass =
+        [&](double dfProgressStart, double dfProgressEnd, const auto &pfnJob)
+    {
+        nLinesDone = 0;
+        for (auto &oStrip : aoStrips)
+        {
+            GDALSieveStrip *poStrip = &oStrip;
+            poJobQueue->SubmitJob(
+                [poStrip, &pfnJob, &bError]()
+                {
+                    try
+                    {
+                        if (!pfnJob(*poStrip))
+                            bError = true;
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "GDALSieveFilter(): Out of memory");
+                        bError = true;
+                    }
+                });
+        }
+        while (poJobQueue->WaitEvent())
+        {
+            if (!bStop && !bError &&
+                !pfnProgress(dfProgressStart +
+                                 (dfProgressEnd - dfProgressStart) *
+                                     (nLinesDone / static_cast<double>(nYSize)),
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bStop = true;
+            }
+        }
+        poJobQueue->WaitCompletion();
+        if (!bStop && !bError &&
+            !pfnProgress(dfProgressEnd, "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            bStop = true;
+        }
+        return !bStop && !bError;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: label each strip, and accumulate the polygon        */
+    /*      sizes.                                                          */
+    /* -------------------------------------------------------------------- */
+    const auto LabelStrip = [&](GDALSieveStrip &oStrip)
+    {
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<GByte> abyMaskLine(hMaskBand ? nXSize : 0);
+
+        oStrip.poEnum =
+            std::make_unique<GDALRasterPolygonEnumerator>(nConnectedness);
+        auto &oEnum = *(oStrip.poEnum);
+        for (int iY = oStrip.nYOff; iY < oStrip.nYOff + oStrip.nYSize; iY++)
+        {
+            if (bStop || bError)
+                return false;
+            if (!ReadLine(iY, anThisLineVal.data(), nullptr,
+                          abyMaskLine.data()))
+                return false;
+            const bool bFirstLine = iY == oStrip.nYOff;
+            if (!oEnum.ProcessLine(
+                    bFirstLine ? nullptr : anLastLineVal.data(),
+                    anThisLineVal.data(),
+                    bFirstLine ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), nXSize))
+                return false;
+
+            if (oEnum.nNextPolygonId >
+                static_cast<int>(oStrip.anPolySizes.size()))
+                oStrip.anPolySizes.resize(oEnum.nNextPolygonId);
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const int iPoly = anThisLineId[iX];
+                if (iPoly >= 0 && oStrip.anPolySizes[iPoly] < MY_MAX_INT)
+                    oStrip.anPolySizes[iPoly] += 1;
+            }
+
+            if (bFirstLine)
+            {
+                oStrip.anFirstLineVal = anThisLineVal;
+                oStrip.anFirstLineId = anThisLineId;
+            }
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+            ++nLinesDone;
+        }
+        oStrip.anLastLineVal = std::move(anLastLineVal);
+        oStrip.anLastLineId = std::move(anLastLineId);
+
+        oEnum.CompleteMerges();
+        oStrip.nPolygonCount = oEnum.nNextPolygonId;
+        oStrip.anPolySizes.resize(oStrip.nPolygonCount);
+        return true;
+    };
+    if (!RunPass(0.0, 0.25, LabelStrip))
+        return CE_Failure;
+
+    /* -------------------------------------------------------------------- */
+    /*      Assign global polygon ids, with each polygon mapped to its      */
+    /*      final id within its strip.                                      */
+    /* -------------------------------------------------------------------- */
+    GIntBig nTotalPolygons = 0;
+    for (auto &oStrip : aoStrips)
+    {
+        oStrip.nIdOffset = static_cast<int>(nTotalPolygons);
+        nTotalPolygons += oStrip.nPolygonCount;
+        if (nTotalPolygons > MY_MAX_INT)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "GDALSieveFilter(): too many polygons");
+            return CE_Failure;
+        }
+    }
+
+    if (nTotalPolygons == 0)
+    {
+        // Can happen if all pixels are masked
+        if (hSrcBand == hDstBand)
+        {
+            pfnProgress(1.0, "", pProgressArg);
+            return CE_None;
+        }
+        else
+        {
+            return GDALRasterBandCopyWholeRaster(hSrcBand, hDstBand, nullptr,
+                                                 pfnProgress, pProgressArg);
+        }
+    }
+
+    std::vector<int> anPolyIdMap;
+    std::vector<std::int64_t> anPolyValue;
+    std::vector<int> anPolySizes;
+    std::vector<int> anBigNeighbour;
+    try
+    {
+        anPolyIdMap.resize(static_cast<size_t>(nTotalPolygons));
+        anPolyValue.resize(static_cast<size_t>(nTotalPolygons));
+        anPolySizes.resize(static_cast<size_t>(nTotalPolygons));
+        anBigNeighbour.resize(static_cast<size_t>(nTotalPolygons), -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+
+    for (auto &oStrip : aoStrips)
+    {
+        for (int iPoly = 0; iPoly < oStrip.nPolygonCount; iPoly++)
+        {
+            anPolyIdMap[oStrip.nIdOffset + iPoly] =
+                oStrip.nIdOffset + oStrip.poEnum->panPolyIdMap[iPoly];
+            anPolyValue[oStrip.nIdOffset + iPoly] =
+                oStrip.poEnum->panPolyValue[iPoly];
+        }
+        oStrip.poEnum.reset();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Merge the polygons that touch each other across strip borders.  */
+    /* -------------------------------------------------------------------- */
+    for (int iStrip = 1; iStrip < nStrips; iStrip++)
+    {
+        const auto &oAbove = aoStrips[iStrip - 1];
+        const auto &oBelow = aoStrips[iStrip];
+        for (int iX = 0; iX < nXSize; iX++)
+        {
+            const int iPolyBelow = oBelow.anFirstLineId[iX];
+            if (iPolyBelow < 0)
+                continue;
+            const int iXStart = nConnectedness == 8 ? std::max(0, iX - 1) : iX;
+            const int iXEnd =
+                nConnectedness == 8 ? std::min(nXSize - 1, iX + 1) : iX;
+            for (int iXAbove = iXStart; iXAbove <= iXEnd; iXAbove++)
+            {
+                const int iPolyAbove = oAbove.anLastLineId[iXAbove];
+                if (iPolyAbove < 0 || oAbove.anLastLineVal[iXAbove] !=
+                                          oBelow.anFirstLineVal[iX])
+                    continue;
+                const int iRootAbove =
+                    SieveFindRoot(anPolyIdMap, oAbove.nIdOffset + iPolyAbove);
+                const int iRootBelow =
+                    SieveFindRoot(anPolyIdMap, oBelow.nIdOffset + iPolyBelow);
+                if (iRootAbove < iRootBelow)
+                    anPolyIdMap[iRootBelow] = iRootAbove;
+                else
+                    anPolyIdMap[iRootAbove] = iRootBelow;
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Make every polygon id point to its final id, and push the       */
+    /*      sizes of merged polygon fragments into the final id's count.    */
+    /* -------------------------------------------------------------------- */
+    for (const auto &oStrip : aoStrips)
+    {
+        for (int iPoly = oStrip.nIdOffset;
+             iPoly < oStrip.nIdOffset + oStrip.nPolygonCount; iPoly++)
+        {
+            const int iFinalId = SieveFindRoot(anPolyIdMap, iPoly);
+            anPolyIdMap[iPoly] = iFinalId;
+
+            GIntBig nSize = anPolySizes[iFinalId];
+            nSize += oStrip.anPolySizes[iPoly - oStrip.nIdOffset];
+            anPolySizes[iFinalId] =
+                static_cast<int>(std::min<GIntBig>(nSize, MY_MAX_INT));
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: identify the largest neighbour of each small       */
+    /*      polygon.  For each polygon, the first largest neighbour met     */
+    /*      in raster order wins, as in the single threaded                 */
+    /*      implementation.                                                 */
+    /* -------------------------------------------------------------------- */
+    const auto CompareNeighbourInStrip =
+        [&anPolySizes, nSizeThreshold](int nPolyId1, int nPolyId2,
+                                       GDALSieveStrip &oStrip)
+    {
+        if (nPolyId1 < 0 || nPolyId2 < 0 || nPolyId1 == nPolyId2)
+            return;
+
+        const auto UpdateBigNeighbour = [&](int nPolyId, int nNeighbourId)
+        {
+            if (anPolySizes[nPolyId] >= nSizeThreshold)
+                return;
+            auto oIter = oStrip.oMapBigNeighbour.find(nPolyId);
+            if (oIter == oStrip.oMapBigNeighbour.end())
+                oStrip.oMapBigNeighbour[nPolyId] = nNeighbourId;
+            else if (anPolySizes[oIter->second] < anPolySizes[nNeighbourId])
+                oIter->second = nNeighbourId;
+        };
+        UpdateBigNeighbour(nPolyId1, nPolyId2);
+        UpdateBigNeighbour(nPolyId2, nPolyId1);
+    };
+
+    // Strip local polygon ids of a line to final global ids.
+    const auto ToFinalIds = [&anPolyIdMap, nXSize](const GInt32 *panLineId,
+                                                   int nIdOffset, int *panOut)
+    {
+        for (int iX = 0; iX < nXSize; iX++)
+            panOut[iX] = panLineId[iX] < 0
+                             ? -1
+                             : anPolyIdMap[nIdOffset + panLineId[iX]];
+    };
+
+    const auto FindNeighboursInStrip = [&](GDALSieveStrip &oStrip)
+    {
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<int> anLastLineFinalId(nXSize);
+        std::vector<int> anThisLineFinalId(nXSize);
+        std::vector<GByte> abyMaskLine(hMaskBand ? nXSize : 0);
+
+        // The last line of the strip above is compared to our first line.
+        const GDALSieveStrip *poAbove =
+            oStrip.nYOff > 0 ? &oStrip - 1 : nullptr;
+        if (poAbove)
+            ToFinalIds(poAbove->anLastLineId.data(), poAbove->nIdOffset,
+                       anLastLineFinalId.data());
+
+        GDALRasterPolygonEnumerator oEnum(nConnectedness);
+        for (int iY = oStrip.nYOff; iY < oStrip.nYOff + oStrip.nYSize; iY++)
+        {
+            if (bStop || bError)
+                return false;
+            if (!ReadLine(iY, anThisLineVal.data(), nullptr,
+                          abyMaskLine.data()))
+                return false;
+            const bool bFirstLine = iY == oStrip.nYOff;
+            if (!oEnum.ProcessLine(
+                    bFirstLine ? nullptr : anLastLineVal.data(),
+                    anThisLineVal.data(),
+                    bFirstLine ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), nXSize))
+                return false;
+            ToFinalIds(anThisLineId.data(), oStrip.nIdOffset,
+                       anThisLineFinalId.data());
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (iY > 0)
+                {
+                    CompareNeighbourInStrip(anThisLineFinalId[iX],
+                                            anLastLineFinalId[iX], oStrip);
+
+                    if (iX > 0 && nConnectedness == 8)
+                        CompareNeighbourInStrip(anThisLineFinalId[iX],
+                                                anLastLineFinalId[iX - 1],
+                                                oStrip);
+
+                    if (iX < nXSize - 1 && nConnectedness == 8)
+                        CompareNeighbourInStrip(anThisLineFinalId[iX],
+                                                anLastLineFinalId[iX + 1],
+                                                oStrip);
+                }
+
+                if (iX > 0)
+                    CompareNeighbourInStrip(anThisLineFinalId[iX],
+                                            anThisLineFinalId[iX - 1], oStrip);
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+            std::swap(anLastLineFinalId, anThisLineFinalId);
+            ++nLinesDone;
+        }
+        return true;
+    };
+    if (!RunPass(0.25, 0.5, FindNeighboursInStrip))
+        return CE_Failure;
+
+    for (auto &oStrip : aoStrips)
+    {
+        for (const auto &[nPolyId, nNeighbourId] : oStrip.oMapBigNeighbour)
+        {
+            if (anBigNeighbour[nPolyId] == -1 ||
+                anPolySizes[anBigNeighbour[nPolyId]] <
+                    anPolySizes[nNeighbourId])
+                anBigNeighbour[nPolyId] = nNeighbourId;
+        }
+        oStrip.oMapBigNeighbour.clear();
+    }
+
+    ResolveBigNeighbours(anPolyIdMap.data(), anPolyValue.data(), anPolySizes,
+                         nSizeThreshold, anBigNeighbour);
+
+    /* -------------------------------------------------------------------- */
+    /*      Third pass: apply the merges, and write the strips.             */
+    /* -------------------------------------------------------------------- */
+    const auto ApplyMergesInStrip = [&](GDALSieveStrip &oStrip)
+    {
+        std::vector<std::int64_t> anLastLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineVal(nXSize);
+        std::vector<std::int64_t> anThisLineWriteVal(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+        std::vector<GByte> abyMaskLine(hMaskBand ? nXSize : 0);
+
+        GDALRasterPolygonEnumerator oEnum(nConnectedness);
+        for (int iY = oStrip.nYOff; iY < oStrip.nYOff + oStrip.nYSize; iY++)
+        {
+            if (bStop || bError)
+                return false;
+            if (!ReadLine(iY, anThisLineVal.data(), anThisLineWriteVal.data(),
+                          abyMaskLine.data()))
+                return false;
+            const bool bFirstLine = iY == oStrip.nYOff;
+            if (!oEnum.ProcessLine(
+                    bFirstLine ? nullptr : anLastLineVal.data(),
+                    anThisLineVal.data(),
+                    bFirstLine ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), nXSize))
+                return false;
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (anThisLineId[iX] >= 0)
+                {
+                    const int iThisPoly =
+                        anPolyIdMap[oStrip.nIdOffset + anThisLineId[iX]];
+                    if (anBigNeighbour[iThisPoly] != -1)
+                        anThisLineWriteVal[iX] =
+                            anPolyValue[anBigNeighbour[iThisPoly]];
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> oLock(oIOMutex);
+                if (GDALRasterIO(hDstBand, GF_Write, 0, iY, nXSize, 1,
+                                 anThisLineWriteVal.data(), nXSize, 1,
+                                 GDT_Int64, 0, 0) != CE_None)
+                    return false;
+            }
+
+            std::swap(anLastLineVal, anThisLineVal);
+            std::swap(anLastLineId, anThisLineId);
+            ++nLinesDone;
+        }
+        return true;
+    };
+    if (!RunPass(0.5, 1.0, ApplyMergesInStrip))
+        return CE_Failure;
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -166,8 +766,17 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * Starting with GDAL 3.11, the raster can be processed by horizontal strips
+ * labelled in parallel, whose polygons are then merged across strip
+ * borders.  Raster I/O remains serialized, and the result is identical to
+ * the single threaded processing.
+ *
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL &gt;= 3.11) Number of worker
+ * threads. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -179,7 +788,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
                                    int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -189,6 +798,31 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    /* -------------------------------------------------------------------- */
+    /*      Process by strips in worker threads if asked to.                */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = CPLParseNumThreads(
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1")),
+        128);
+    if (nThreads > 1)
+    {
+        // A few strips per thread to balance the load, but not too thin ones,
+        // as polygons crossing strip borders are split.
+        constexpr int MIN_LINES_PER_STRIP = 32;
+        const int nStrips =
+            std::min(4 * nThreads,
+                     GDALGetRasterBandYSize(hSrcBand) / MIN_LINES_PER_STRIP);
+        auto poThreadPool =
+            nStrips > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (poThreadPool)
+        {
+            return GDALSieveFilterByStrips(
+                hSrcBand, hMaskBand, hDstBand, nSizeThreshold, nConnectedness,
+                nStrips, poThreadPool, pfnProgress, pProgressArg);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
@@ -468,81 +1102,8 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /*      threshold, then try tracking to that polygons biggest           */
     /*      neighbour, and so forth.                                        */
     /* -------------------------------------------------------------------- */
-    int nFailedMerges = 0;
-    int nIsolatedSmall = 0;
-    int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
-    {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
-        {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
-        {
-            nIsolatedSmall++;
-            continue;
-        }
-
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
-
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
-            {
-                break;
-            }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
-            {
-                bFoundBigEnoughPoly = true;
-                break;
-            }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
-
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
-        }
-    }
-
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
+    ResolveBigNeighbours(oFirstEnum.panPolyIdMap, oFirstEnum.panPolyValue,
+                         anPolySizes, nSizeThreshold, anBigNeighbour);
 
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
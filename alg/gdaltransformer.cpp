@@ -25,8 +25,14 @@
 #include <cstring>
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -59,6 +65,7 @@ static void *GDALCreateApproxTransformer2(GDALTransformerFunc pfnRawTransformer,
                                           void *pRawTransformerArg,
                                           double dfMaxErrorForward,
                                           double dfMaxErrorReverse);
+static void GDALApproxTransformerEnable2DIfRequested(void *pCBData);
 
 /************************************************************************/
 /*                            GDALIsTransformer()                       */
@@ -1798,6 +1805,11 @@ static void GDALGCPAntimeridianUnwrap(int nGCPCount, GDAL_GCP *pasGCPList,
  * an approximate transformer for the source transformer.. Must be defined
  * together with SRC_APPROX_ERROR_IN_SRS_UNIT to be taken into account.
  * </li>
+ * <li> NUM_THREADS=number_of_threads|ALL_CPUS. Used by the GCP_TPS method to
+ * solve the forward and reverse systems in parallel, and (GDAL &gt;= 3.11) to
+ * transform large batches of points in parallel. Defaults to the value of the
+ * GDAL_NUM_THREADS configuration option.
+ * </li>
  * <li>
  * DST_APPROX_ERROR_IN_SRS_UNIT=err_threshold_in_SRS_units. (GDAL &gt;= 2.2) Use
  * an approximate transformer for the destination transformer. Must be defined
@@ -1835,6 +1847,11 @@ static void GDALGCPAntimeridianUnwrap(int nGCPCount, GDAL_GCP *pasGCPList,
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> GEOLOC_NUM_THREADS=number_of_threads|ALL_CPUS. (GDAL &gt;= 3.11)
+ * Number of threads used to compute the inverse transformation of batches of
+ * points, when the backmap is stored in in-memory arrays. Defaults to the
+ * value of the GDAL_GEOLOC_NUM_THREADS configuration option, or 1.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -3774,6 +3791,281 @@ static void *GDALDeserializeReprojectionTransformer(CPLXMLNode *psTree)
 /* ==================================================================== */
 /************************************************************************/
 
+/* Optional 2D approximation, enabled with GDAL_APPROX_TRANSFORMER_2D=YES for
+ * approximate transformers wrapping a GenImgProj transformer (that is working
+ * in pixel/line spaces).
+ *
+ * The input space is split into square tiles of TILE_SIZE pixels, built
+ * lazily on first use. Each tile is covered by a quadtree whose leaves are
+ * cells where the bilinear interpolation of the transformed corners is within
+ * the maximum error (Manhattan distance) of the exact transformation at the
+ * center and middle of the edges of the cell. Leaves where this cannot be
+ * achieved with cells of at least MIN_CELL_SIZE pixels, or where a point
+ * cannot be transformed, are flagged for exact transformation.
+ *
+ * Built tiles are immutable, and shared by the transformers returned by
+ * GDALCloneTransformer(), hence by all threads of a warping operation.
+ */
+
+namespace
+{
+
+struct GDALApproxQuadTreeNode
+{
+    // Transformed corners, in top-left, top-right, bottom-left, bottom-right
+    // order.
+    double adfX[4] = {0, 0, 0, 0};
+    double adfY[4] = {0, 0, 0, 0};
+    double adfZ[4] = {0, 0, 0, 0};
+    // Children are consecutive, in the same order as corners.
+    int iFirstChild = -1;
+    bool bExact = false;
+};
+
+struct GDALApproxQuadTreeTile
+{
+    double dfX0 = 0;
+    double dfY0 = 0;
+    std::vector<GDALApproxQuadTreeNode> aoNodes{};
+
+    bool Interpolate(double &dfX, double &dfY, double &dfZ) const;
+};
+
+class GDALApproxTransformCache
+{
+  public:
+    static constexpr int TILE_SIZE = 256;
+    static constexpr double MIN_CELL_SIZE = 4;
+    static constexpr size_t MAX_TILES = 16384;
+
+    GDALApproxTransformCache() = default;
+
+    const GDALApproxQuadTreeTile *
+    GetTile(GDALTransformerFunc pfnBaseTransformer, void *pBaseCBData,
+            int bDstToSrc, double dfMaxError, int64_t nTileX, int64_t nTileY);
+
+  private:
+    std::mutex m_oMutex{};
+    std::map<std::tuple<int, int64_t, int64_t>,
+             std::unique_ptr<GDALApproxQuadTreeTile>>
+        m_oMapTiles{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALApproxTransformCache)
+};
+
+/************************************************************************/
+/*                 GDALApproxQuadTreeTile::Interpolate()                */
+/************************************************************************/
+
+// Returns false if the point must be transformed exactly.
+bool GDALApproxQuadTreeTile::Interpolate(double &dfX, double &dfY,
+                                         double &dfZ) const
+{
+    double dfCellX0 = dfX0;
+    double dfCellY0 = dfY0;
+    double dfCellSize = GDALApproxTransformCache::TILE_SIZE;
+    const GDALApproxQuadTreeNode *psNode = &aoNodes[0];
+    while (psNode->iFirstChild >= 0)
+    {
+        dfCellSize /= 2;
+        int iQuadrant = 0;
+        if (dfX >= dfCellX0 + dfCellSize)
+        {
+            dfCellX0 += dfCellSize;
+            iQuadrant += 1;
+        }
+        if (dfY >= dfCellY0 + dfCellSize)
+        {
+            dfCellY0 += dfCellSize;
+            iQuadrant += 2;
+        }
+        psNode = &aoNodes[psNode->iFirstChild + iQuadrant];
+    }
+    if (psNode->bExact)
+        return false;
+
+    const double dfU = (dfX - dfCellX0) / dfCellSize;
+    const double dfV = (dfY - dfCellY0) / dfCellSize;
+    const auto Bilinear = [dfU, dfV](const double *padf)
+    {
+        return (padf[0] * (1 - dfU) + padf[1] * dfU) * (1 - dfV) +
+               (padf[2] * (1 - dfU) + padf[3] * dfU) * dfV;
+    };
+    dfX = Bilinear(psNode->adfX);
+    dfY = Bilinear(psNode->adfY);
+    dfZ = Bilinear(psNode->adfZ);
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALApproxTransformCache::GetTile()                 */
+/************************************************************************/
+
+// Returns nullptr if the tile cannot be built.
+const GDALApproxQuadTreeTile *GDALApproxTransformCache::GetTile(
+    GDALTransformerFunc pfnBaseTransformer, void *pBaseCBData, int bDstToSrc,
+    double dfMaxError, int64_t nTileX, int64_t nTileY)
+{
+    const auto oKey = std::make_tuple(bDstToSrc, nTileX, nTileY);
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMapTiles.find(oKey);
+        if (oIter != m_oMapTiles.end())
+            return oIter->second.get();
+        if (m_oMapTiles.size() >= MAX_TILES)
+            return nullptr;
+    }
+
+    // Build the tile without holding the mutex, with the base transformer
+    // of the calling thread.
+    auto poTile = std::make_unique<GDALApproxQuadTreeTile>();
+    poTile->dfX0 = static_cast<double>(nTileX) * TILE_SIZE;
+    poTile->dfY0 = static_cast<double>(nTileY) * TILE_SIZE;
+
+    struct Cell
+    {
+        int iNode;
+        double dfX0, dfY0, dfSize;
+        bool abOK[4];
+    };
+
+    // Transform the corners of the root node.
+    {
+        GDALApproxQuadTreeNode sRoot;
+        double adfZ[4] = {0, 0, 0, 0};
+        int anSuccess[4] = {FALSE, FALSE, FALSE, FALSE};
+        for (int i = 0; i < 4; ++i)
+        {
+            sRoot.adfX[i] = poTile->dfX0 + (i % 2) * TILE_SIZE;
+            sRoot.adfY[i] = poTile->dfY0 + (i / 2) * TILE_SIZE;
+        }
+        if (!pfnBaseTransformer(pBaseCBData, bDstToSrc, 4, sRoot.adfX,
+                                sRoot.adfY, adfZ, anSuccess))
+        {
+            std::fill_n(anSuccess, 4, FALSE);
+        }
+        std::copy_n(adfZ, 4, sRoot.adfZ);
+        poTile->aoNodes.push_back(sRoot);
+
+        Cell sCell;
+        sCell.iNode = 0;
+        sCell.dfX0 = poTile->dfX0;
+        sCell.dfY0 = poTile->dfY0;
+        sCell.dfSize = TILE_SIZE;
+        for (int i = 0; i < 4; ++i)
+            sCell.abOK[i] = anSuccess[i] != FALSE;
+
+        std::vector<Cell> asStack{sCell};
+        while (!asStack.empty())
+        {
+            const Cell sCur = asStack.back();
+            asStack.pop_back();
+
+            // Top middle, left middle, center, right middle, bottom middle
+            const double dfHalf = sCur.dfSize / 2;
+            double adfTX[5] = {sCur.dfX0 + dfHalf, sCur.dfX0,
+                               sCur.dfX0 + dfHalf, sCur.dfX0 + sCur.dfSize,
+                               sCur.dfX0 + dfHalf};
+            double adfTY[5] = {sCur.dfY0, sCur.dfY0 + dfHalf,
+                               sCur.dfY0 + dfHalf, sCur.dfY0 + dfHalf,
+                               sCur.dfY0 + sCur.dfSize};
+            double adfTZ[5] = {0, 0, 0, 0, 0};
+            int anTSuccess[5] = {FALSE, FALSE, FALSE, FALSE, FALSE};
+            if (!pfnBaseTransformer(pBaseCBData, bDstToSrc, 5, adfTX, adfTY,
+                                    adfTZ, anTSuccess))
+            {
+                std::fill_n(anTSuccess, 5, FALSE);
+            }
+
+            const bool bAllOK = sCur.abOK[0] && sCur.abOK[1] &&
+                                sCur.abOK[2] && sCur.abOK[3] &&
+                                anTSuccess[0] && anTSuccess[1] &&
+                                anTSuccess[2] && anTSuccess[3] && anTSuccess[4];
+            if (bAllOK)
+            {
+                const auto &sNode = poTile->aoNodes[sCur.iNode];
+                const auto Error = [&sNode, &adfTX, &adfTY](int iTest, int i,
+                                                            int j)
+                {
+                    return fabs((sNode.adfX[i] + sNode.adfX[j]) / 2 -
+                                adfTX[iTest]) +
+                           fabs((sNode.adfY[i] + sNode.adfY[j]) / 2 -
+                                adfTY[iTest]);
+                };
+                const double dfCenterError =
+                    fabs((sNode.adfX[0] + sNode.adfX[1] + sNode.adfX[2] +
+                          sNode.adfX[3]) /
+                             4 -
+                         adfTX[2]) +
+                    fabs((sNode.adfY[0] + sNode.adfY[1] + sNode.adfY[2] +
+                          sNode.adfY[3]) /
+                             4 -
+                         adfTY[2]);
+                const double dfError = std::max(
+                    {Error(0, 0, 1), Error(1, 0, 2), dfCenterError,
+                     Error(3, 1, 3), Error(4, 2, 3)});
+                if (dfError <= dfMaxError)
+                    continue;
+            }
+
+            if (dfHalf < MIN_CELL_SIZE)
+            {
+                poTile->aoNodes[sCur.iNode].bExact = true;
+                continue;
+            }
+
+            // Subdivide. The 9 points of the cell, in row-major order.
+            const auto &sNode = poTile->aoNodes[sCur.iNode];
+            const double adf9X[9] = {sNode.adfX[0], adfTX[0], sNode.adfX[1],
+                                     adfTX[1],      adfTX[2], adfTX[3],
+                                     sNode.adfX[2], adfTX[4], sNode.adfX[3]};
+            const double adf9Y[9] = {sNode.adfY[0], adfTY[0], sNode.adfY[1],
+                                     adfTY[1],      adfTY[2], adfTY[3],
+                                     sNode.adfY[2], adfTY[4], sNode.adfY[3]};
+            const double adf9Z[9] = {sNode.adfZ[0], adfTZ[0], sNode.adfZ[1],
+                                     adfTZ[1],      adfTZ[2], adfTZ[3],
+                                     sNode.adfZ[2], adfTZ[4], sNode.adfZ[3]};
+            const bool ab9OK[9] = {sCur.abOK[0],      anTSuccess[0] != FALSE,
+                                   sCur.abOK[1],      anTSuccess[1] != FALSE,
+                                   anTSuccess[2] != FALSE,
+                                   anTSuccess[3] != FALSE,
+                                   sCur.abOK[2],      anTSuccess[4] != FALSE,
+                                   sCur.abOK[3]};
+
+            const int iFirstChild = static_cast<int>(poTile->aoNodes.size());
+            poTile->aoNodes[sCur.iNode].iFirstChild = iFirstChild;
+            for (int iChild = 0; iChild < 4; ++iChild)
+            {
+                const int iCol = iChild % 2;
+                const int iRow = iChild / 2;
+                GDALApproxQuadTreeNode sChild;
+                Cell sChildCell;
+                sChildCell.iNode = iFirstChild + iChild;
+                sChildCell.dfX0 = sCur.dfX0 + iCol * dfHalf;
+                sChildCell.dfY0 = sCur.dfY0 + iRow * dfHalf;
+                sChildCell.dfSize = dfHalf;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const int iIdx = (iRow + i / 2) * 3 + iCol + i % 2;
+                    sChild.adfX[i] = adf9X[iIdx];
+                    sChild.adfY[i] = adf9Y[iIdx];
+                    sChild.adfZ[i] = adf9Z[iIdx];
+                    sChildCell.abOK[i] = ab9OK[iIdx];
+                }
+                poTile->aoNodes.push_back(sChild);
+                asStack.push_back(sChildCell);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    // Another thread may have built the same tile meanwhile.
+    auto oInsert = m_oMapTiles.emplace(oKey, std::move(poTile));
+    return oInsert.first->second.get();
+}
+
+}  // namespace
+
 typedef struct
 {
     GDALTransformerInfo sTI;
@@ -3784,6 +4076,10 @@ typedef struct
     double dfMaxErrorReverse;
 
     int bOwnSubtransformer;
+
+    // Not null if the 2D approximation is enabled. May be shared with
+    // clones.
+    std::shared_ptr<GDALApproxTransformCache> *ppoCache;
 } ApproxTransformInfo;
 
 /************************************************************************/
@@ -3815,6 +4111,15 @@ static void *GDALCreateSimilarApproxTransformer(void *hTransformArg,
         }
     }
     psClonedInfo->bOwnSubtransformer = TRUE;
+    if (psInfo->ppoCache)
+    {
+        // The cache can only be shared if the base transformer is the same
+        psClonedInfo->ppoCache =
+            new std::shared_ptr<GDALApproxTransformCache>(
+                dfSrcRatioX == 1.0 && dfSrcRatioY == 1.0
+                    ? *(psInfo->ppoCache)
+                    : std::make_shared<GDALApproxTransformCache>());
+    }
 
     return psClonedInfo;
 }
@@ -3911,10 +4216,33 @@ void *GDALCreateApproxTransformer(GDALTransformerFunc pfnBaseTransformer,
                                   void *pBaseTransformArg, double dfMaxError)
 
 {
-    return GDALCreateApproxTransformer2(pfnBaseTransformer, pBaseTransformArg,
-                                        dfMaxError, dfMaxError);
+    void *pApproxCBData = GDALCreateApproxTransformer2(
+        pfnBaseTransformer, pBaseTransformArg, dfMaxError, dfMaxError);
+    GDALApproxTransformerEnable2DIfRequested(pApproxCBData);
+    return pApproxCBData;
+}
+
+/************************************************************************/
+/*              GDALApproxTransformerEnable2DIfRequested()              */
+/************************************************************************/
+
+static void GDALApproxTransformerEnable2DIfRequested(void *pCBData)
+{
+    ApproxTransformInfo *psATInfo = static_cast<ApproxTransformInfo *>(pCBData);
+    if (psATInfo->ppoCache == nullptr &&
+        CPLTestBool(CPLGetConfigOption("GDAL_APPROX_TRANSFORMER_2D", "NO")) &&
+        GDALIsTransformer(psATInfo->pBaseCBData,
+                          GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
+    {
+        psATInfo->ppoCache = new std::shared_ptr<GDALApproxTransformCache>(
+            std::make_shared<GDALApproxTransformCache>());
+    }
 }
 
+/************************************************************************/
+/*                    GDALCreateApproxTransformer2()                    */
+/************************************************************************/
+
 static void *
 GDALCreateApproxTransformer2(GDALTransformerFunc pfnBaseTransformer,
                              void *pBaseTransformArg, double dfMaxErrorForward,
@@ -3928,6 +4256,7 @@ GDALCreateApproxTransformer2(GDALTransformerFunc pfnBaseTransformer,
     psATInfo->dfMaxErrorForward = dfMaxErrorForward;
     psATInfo->dfMaxErrorReverse = dfMaxErrorReverse;
     psATInfo->bOwnSubtransformer = FALSE;
+    psATInfo->ppoCache = nullptr;
 
     memcpy(psATInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
@@ -3977,9 +4306,23 @@ void GDALDestroyApproxTransformer(void *pCBData)
     if (psATInfo->bOwnSubtransformer)
         GDALDestroyTransformer(psATInfo->pBaseCBData);
 
+    delete psATInfo->ppoCache;
+
     CPLFree(pCBData);
 }
 
+/************************************************************************/
+/*                   GDALResetApproxTransformerCache()                  */
+/************************************************************************/
+
+/** Discard the 2D approximation, if any, after a change of the base
+ * transformer. Clones that shared it keep it. */
+static void GDALResetApproxTransformerCache(ApproxTransformInfo *psInfo)
+{
+    if (psInfo->ppoCache)
+        *(psInfo->ppoCache) = std::make_shared<GDALApproxTransformCache>();
+}
+
 /************************************************************************/
 /*                  GDALRefreshApproxTransformer()                      */
 /************************************************************************/
@@ -3994,6 +4337,7 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+    GDALResetApproxTransformerCache(psInfo);
 }
 
 /************************************************************************/
@@ -4247,6 +4591,80 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                       GDALApproxTransform2D()                        */
+/************************************************************************/
+
+static int GDALApproxTransform2D(ApproxTransformInfo *psATInfo, int bDstToSrc,
+                                 int nPoints, double *x, double *y, double *z,
+                                 int *panSuccess)
+{
+    GDALApproxTransformCache *poCache = psATInfo->ppoCache->get();
+    const double dfMaxError =
+        (bDstToSrc) ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
+    constexpr double TILE_SIZE = GDALApproxTransformCache::TILE_SIZE;
+
+    std::vector<int> anExact;
+    const GDALApproxQuadTreeTile *poTile = nullptr;
+    int64_t nLastTileX = 0;
+    int64_t nLastTileY = 0;
+    bool bHasLastTile = false;
+    for (int i = 0; i < nPoints; ++i)
+    {
+        // A non-zero input Z may change the output, e.g. with vertical
+        // shifts.
+        if (z[i] != 0 || !(std::fabs(x[i]) < 1e15) ||
+            !(std::fabs(y[i]) < 1e15))
+        {
+            anExact.push_back(i);
+            continue;
+        }
+        const int64_t nTileX =
+            static_cast<int64_t>(std::floor(x[i] / TILE_SIZE));
+        const int64_t nTileY =
+            static_cast<int64_t>(std::floor(y[i] / TILE_SIZE));
+        if (!bHasLastTile || nTileX != nLastTileX || nTileY != nLastTileY)
+        {
+            poTile = poCache->GetTile(psATInfo->pfnBaseTransformer,
+                                      psATInfo->pBaseCBData, bDstToSrc,
+                                      dfMaxError, nTileX, nTileY);
+            nLastTileX = nTileX;
+            nLastTileY = nTileY;
+            bHasLastTile = true;
+        }
+        if (poTile && poTile->Interpolate(x[i], y[i], z[i]))
+            panSuccess[i] = TRUE;
+        else
+            anExact.push_back(i);
+    }
+
+    if (anExact.empty())
+        return TRUE;
+
+    const int nExact = static_cast<int>(anExact.size());
+    std::vector<double> adfX(nExact);
+    std::vector<double> adfY(nExact);
+    std::vector<double> adfZ(nExact);
+    std::vector<int> anSuccess(nExact);
+    for (int i = 0; i < nExact; ++i)
+    {
+        adfX[i] = x[anExact[i]];
+        adfY[i] = y[anExact[i]];
+        adfZ[i] = z[anExact[i]];
+    }
+    const int bRet = psATInfo->pfnBaseTransformer(
+        psATInfo->pBaseCBData, bDstToSrc, nExact, adfX.data(), adfY.data(),
+        adfZ.data(), anSuccess.data());
+    for (int i = 0; i < nExact; ++i)
+    {
+        x[anExact[i]] = adfX[i];
+        y[anExact[i]] = adfY[i];
+        z[anExact[i]] = adfZ[i];
+        panSuccess[anExact[i]] = anSuccess[i];
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                        GDALApproxTransform()                         */
 /************************************************************************/
@@ -4278,6 +4696,15 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
     /*      acceptable.                                                     */
     /* -------------------------------------------------------------------- */
     int bRet = FALSE;
+    if (psATInfo->ppoCache &&
+        ((bDstToSrc) ? psATInfo->dfMaxErrorReverse
+                     : psATInfo->dfMaxErrorForward) > 0.0)
+    {
+        bRet = GDALApproxTransform2D(psATInfo, bDstToSrc, nPoints, x, y, z,
+                                     panSuccess);
+        goto end;
+    }
+
     if (y[0] != y[nPoints - 1] || y[0] != y[nMiddle] ||
         x[0] == x[nPoints - 1] || x[0] == x[nMiddle] ||
         (psATInfo->dfMaxErrorForward == 0.0 &&
@@ -4373,6 +4800,7 @@ static void *GDALDeserializeApproxTransformer(CPLXMLNode *psTree)
     void *pApproxCBData = GDALCreateApproxTransformer2(
         pfnBaseTransform, pBaseCBData, dfMaxErrorForward, dfMaxErrorReverse);
     GDALApproxTransformerOwnsSubtransformer(pApproxCBData, TRUE);
+    GDALApproxTransformerEnable2DIfRequested(pApproxCBData);
 
     return pApproxCBData;
 }
@@ -4890,6 +5318,12 @@ void GDALSetTransformerDstGeoTransform(void *pTransformArg,
     if (psInfo)
     {
         GDALSetGenImgProjTransformerDstGeoTransform(psInfo, padfGeoTransform);
+        if (GDALIsTransformer(pTransformArg,
+                              GDAL_APPROX_TRANSFORMER_CLASS_NAME))
+        {
+            GDALResetApproxTransformerCache(
+                static_cast<ApproxTransformInfo *>(pTransformArg));
+        }
     }
 }
 
@@ -1289,6 +1289,30 @@ CPLErr GDALWarpDstAlphaMasker(void *pMaskFuncArg, int nBandCount,
  * ties with MODE resampling. By default, the first value encountered will be used.
  * Alternatively, the minimum or maximum value can be selected.</li>
  *
+ * <li>MULTI_CHUNKS_IN_FLIGHT: (GDAL >= 3.11) Maximum number of chunks processed
+ * at the same time by GDALWarpOperation::ChunkAndWarpMulti(). Each chunk in
+ * flight holds its own source and destination buffers. Defaults to 3 when
+ * INIT_DEST is set and the source and destination datasets are different,
+ * in which case destination writes are overlapped with source reads, and
+ * to 2 otherwise.</li>
+ *
+ * <li>WARP_PLAN_STEP=n: (GDAL >= 3.11) Enables the use, by the warp kernel, of
+ * a "warp plan": a grid of the source coordinates of destination pixels every
+ * n pixels (16 by default if only WARP_PLAN_FILENAME is set), computed once
+ * per warp operation and bilinearly interpolated where this is accurate
+ * to WARP_PLAN_MAX_ERROR. Source windows of chunks are still computed with
+ * the exact transformer. Not compatible with APPLY_VERTICAL_SHIFT.</li>
+ *
+ * <li>WARP_PLAN_FILENAME=filename: (GDAL >= 3.11) GeoTIFF file where the warp
+ * plan is saved, and from which it is loaded in later warp operations if it
+ * matches the destination raster size, WARP_PLAN_STEP, WARP_PLAN_MAX_ERROR
+ * and the serialized transformer.</li>
+ *
+ * <li>WARP_PLAN_MAX_ERROR=val: (GDAL >= 3.11) Maximum error, in source pixels
+ * (as a Manhattan distance), of the interpolation in a warp plan grid cell,
+ * checked at the center of the cell. Points in cells where it is exceeded
+ * are exactly transformed. Defaults to 0.125.</li>
+ *
  * </ul>
  */
 
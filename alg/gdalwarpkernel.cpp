@@ -194,6 +194,14 @@ static CPLErr GWKSumPreserving(GDALWarpKernel *);
 static CPLErr GWKCubicNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKCubicSplineNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKBilinearNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
+static CPLErr GWKBilinearUnifiedMaskByte(GDALWarpKernel *);
+static CPLErr GWKCubicUnifiedMaskByte(GDALWarpKernel *);
+static CPLErr GWKBilinearUnifiedMaskShort(GDALWarpKernel *);
+static CPLErr GWKCubicUnifiedMaskShort(GDALWarpKernel *);
+static CPLErr GWKBilinearUnifiedMaskUShort(GDALWarpKernel *);
+static CPLErr GWKCubicUnifiedMaskUShort(GDALWarpKernel *);
+static CPLErr GWKBilinearUnifiedMaskFloat(GDALWarpKernel *);
+static CPLErr GWKCubicUnifiedMaskFloat(GDALWarpKernel *);
 
 /************************************************************************/
 /*                           GWKJobStruct                               */
@@ -313,15 +321,9 @@ void *GWKThreadsCreate(char **papszWarpOptions,
     if (pszWarpThreads == nullptr)
         pszWarpThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
 
-    int nThreads = 0;
-    if (EQUAL(pszWarpThreads, "ALL_CPUS"))
-        nThreads = CPLGetNumCPUs();
-    else
-        nThreads = atoi(pszWarpThreads);
+    int nThreads = CPLParseNumThreads(pszWarpThreads, 128);
     if (nThreads <= 1)
         nThreads = 0;
-    if (nThreads > 128)
-        nThreads = 128;
 
     GWKThreadData *psThreadData = new GWKThreadData();
     auto poThreadPool =
@@ -473,8 +475,9 @@ static CPLErr GWKRun(GDALWarpKernel *poWK, const char *pszFuncName,
     int nThreads = std::min(psThreadData->nMaxThreads, nDstYSize / 2);
     // Config option mostly useful for tests to be able to test multithreading
     // with small rasters
-    const int nWarpChunkSize =
-        atoi(CPLGetConfigOption("WARP_THREAD_CHUNK_SIZE", "65536"));
+    static thread_local CPLConfigOptionCache<int> oWarpChunkSize(
+        "WARP_THREAD_CHUNK_SIZE", "65536", atoi);
+    const int nWarpChunkSize = oWarpChunkSize.Get();
     if (nWarpChunkSize > 0)
     {
         GIntBig nChunks =
@@ -1283,6 +1286,30 @@ CPLErr GDALWarpKernel::PerformWarp()
         return GWKCubicNoMasksOrDstDensityOnlyDouble(this);
 #endif
 
+    // Source validity only described by a unified mask and/or density
+    // (typically an alpha band): compute all bands of a pixel at once.
+    const bool bUnifiedSrcMasksOnly =
+        papanBandSrcValid == nullptr && !bNoMasksOrDstDensityOnly &&
+        (eResample == GRA_Bilinear || eResample == GRA_Cubic) &&
+        dfXScale >= 0.95 && dfYScale >= 0.95 && nSrcXSize > 1 &&
+        nSrcYSize > 1 && !bApplyVerticalShift;
+
+    if (eWorkingDataType == GDT_Byte && bUnifiedSrcMasksOnly)
+        return eResample == GRA_Bilinear ? GWKBilinearUnifiedMaskByte(this)
+                                         : GWKCubicUnifiedMaskByte(this);
+
+    if (eWorkingDataType == GDT_Int16 && bUnifiedSrcMasksOnly)
+        return eResample == GRA_Bilinear ? GWKBilinearUnifiedMaskShort(this)
+                                         : GWKCubicUnifiedMaskShort(this);
+
+    if (eWorkingDataType == GDT_UInt16 && bUnifiedSrcMasksOnly)
+        return eResample == GRA_Bilinear ? GWKBilinearUnifiedMaskUShort(this)
+                                         : GWKCubicUnifiedMaskUShort(this);
+
+    if (eWorkingDataType == GDT_Float32 && bUnifiedSrcMasksOnly)
+        return eResample == GRA_Bilinear ? GWKBilinearUnifiedMaskFloat(this)
+                                         : GWKCubicUnifiedMaskFloat(this);
+
     if (eResample == GRA_Average)
         return GWKAverageOrMode(this);
 
@@ -3321,6 +3348,215 @@ static bool GWKCubicResampleSrcMaskIsDensity4SampleReal(
     return true;
 }
 
+/************************************************************************/
+/*             GWKBilinearResampleUnifiedMask4SampleMultiBandT()        */
+/*                                                                      */
+/*     Bilinear interpolation of all bands at once, when the source     */
+/*     validity is only described by panUnifiedSrcValid and/or          */
+/*     pafUnifiedSrcDensity. The weights of the 4 samples are then      */
+/*     shared by all bands and only computed once. Gives the same       */
+/*     result as GWKBilinearResample4Sample() called on each band.      */
+/************************************************************************/
+
+template <class T>
+static void GWKBilinearResampleUnifiedMask4SampleMultiBandT(
+    const GDALWarpKernel *poWK, double dfSrcX, double dfSrcY,
+    double *pdfDensity, double *padfReal)
+
+{
+    // Save as local variables to avoid following pointers.
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+
+    int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+    int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+    double dfRatioX = 1.5 - (dfSrcX - iSrcX);
+    double dfRatioY = 1.5 - (dfSrcY - iSrcY);
+    bool bShifted = false;
+
+    if (iSrcX == -1)
+    {
+        iSrcX = 0;
+        dfRatioX = 1;
+    }
+    if (iSrcY == -1)
+    {
+        iSrcY = 0;
+        dfRatioY = 1;
+    }
+    GPtrDiff_t iSrcOffset = iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+
+    const GPtrDiff_t nSrcPixels =
+        static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize;
+
+    // Shift so we don't overrun the array.
+    if (nSrcPixels == iSrcOffset + 1 ||
+        nSrcPixels == iSrcOffset + nSrcXSize + 1)
+    {
+        bShifted = true;
+        --iSrcOffset;
+    }
+
+    // Collect the valid samples in the same order as
+    // GWKBilinearResample4Sample(), so that accumulations are identical.
+    GPtrDiff_t anSampleOffset[4] = {0, 0, 0, 0};
+    double adfSampleWeight[4] = {0.0, 0.0, 0.0, 0.0};
+    int nSamples = 0;
+    double dfAccumulatorDensity = 0.0;
+    double dfAccumulatorDivisor = 0.0;
+
+    for (int iRow = 0; iRow < 2; ++iRow)
+    {
+        const GPtrDiff_t iRowOffset = iSrcOffset + iRow * nSrcXSize;
+        if (iSrcY + iRow < 0 || iSrcY + iRow >= nSrcYSize || iRowOffset < 0 ||
+            iRowOffset >= nSrcPixels)
+        {
+            continue;
+        }
+        const double dfRatioRow = iRow == 0 ? dfRatioY : 1.0 - dfRatioY;
+
+        for (int iCol = 0; iCol < 2; ++iCol)
+        {
+            if (iSrcX + iCol < 0 || iSrcX + iCol >= nSrcXSize)
+                continue;
+
+            // Shifting corrected.
+            const GPtrDiff_t iOffset = iRowOffset + (bShifted ? 1 : iCol);
+            if (poWK->panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iOffset))
+            {
+                continue;
+            }
+            const double dfDensity =
+                poWK->pafUnifiedSrcDensity != nullptr
+                    ? static_cast<double>(poWK->pafUnifiedSrcDensity[iOffset])
+                    : 1.0;
+            if (!(dfDensity > SRC_DENSITY_THRESHOLD))
+                continue;
+
+            const double dfMult =
+                (iCol == 0 ? dfRatioX : 1.0 - dfRatioX) * dfRatioRow;
+            dfAccumulatorDivisor += dfMult;
+            dfAccumulatorDensity += dfDensity * dfMult;
+            anSampleOffset[nSamples] = iOffset;
+            adfSampleWeight[nSamples] = dfMult;
+            ++nSamples;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Return result.                                                  */
+    /* -------------------------------------------------------------------- */
+    if (dfAccumulatorDivisor != 1.0 && dfAccumulatorDivisor < 0.00001)
+    {
+        *pdfDensity = 0.0;
+        return;
+    }
+
+    const bool bNormalize = dfAccumulatorDivisor != 1.0;
+    *pdfDensity = bNormalize ? dfAccumulatorDensity / dfAccumulatorDivisor
+                             : dfAccumulatorDensity;
+
+    for (int iBand = 0; iBand < poWK->nBands; iBand++)
+    {
+        const T *pSrc = reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+        double dfAccumulatorReal = 0.0;
+        for (int i = 0; i < nSamples; ++i)
+            dfAccumulatorReal += pSrc[anSampleOffset[i]] * adfSampleWeight[i];
+        padfReal[iBand] = bNormalize ? dfAccumulatorReal / dfAccumulatorDivisor
+                                     : dfAccumulatorReal;
+    }
+}
+
+/************************************************************************/
+/*               GWKCubicResampleUnifiedMask4SampleMultiBandT()         */
+/*                                                                      */
+/*     Bi-cubic counterpart of                                          */
+/*     GWKBilinearResampleUnifiedMask4SampleMultiBandT(). As in         */
+/*     GWKCubicResample4Sample(), falls back to bilinear if any of the  */
+/*     16 samples is invalid.                                           */
+/************************************************************************/
+
+template <class T>
+static void GWKCubicResampleUnifiedMask4SampleMultiBandT(
+    const GDALWarpKernel *poWK, double dfSrcX, double dfSrcY,
+    double *pdfDensity, double *padfReal)
+
+{
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int iSrcX = static_cast<int>(dfSrcX - 0.5);
+    const int iSrcY = static_cast<int>(dfSrcY - 0.5);
+
+    // Get the bilinear interpolation at the image borders.
+    if (iSrcX - 1 < 0 || iSrcX + 2 >= nSrcXSize || iSrcY - 1 < 0 ||
+        iSrcY + 2 >= poWK->nSrcYSize)
+    {
+        GWKBilinearResampleUnifiedMask4SampleMultiBandT<T>(
+            poWK, dfSrcX, dfSrcY, pdfDensity, padfReal);
+        return;
+    }
+
+    const GPtrDiff_t iTopLeftOffset =
+        iSrcX - 1 + static_cast<GPtrDiff_t>(iSrcY - 1) * nSrcXSize;
+
+    // Fetch the density of the 4x4 kernel.
+    double adfDensity[16];
+    for (int i = 0; i < 4; i++)
+    {
+        const GPtrDiff_t iOffset = iTopLeftOffset + i * nSrcXSize;
+        for (int j = 0; j < 4; j++)
+        {
+            if (poWK->panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iOffset + j))
+            {
+                adfDensity[i * 4 + j] = 0.0;
+            }
+            else if (poWK->pafUnifiedSrcDensity != nullptr)
+            {
+                adfDensity[i * 4 + j] =
+                    poWK->pafUnifiedSrcDensity[iOffset + j];
+            }
+            else
+            {
+                adfDensity[i * 4 + j] = 1.0;
+            }
+
+            /* ------------------------------------------------------------ */
+            /*      For now, if we have any pixels missing in the kernel    */
+            /*      area, we fallback on using bilinear interpolation.      */
+            /* ------------------------------------------------------------ */
+            if (adfDensity[i * 4 + j] < SRC_DENSITY_THRESHOLD)
+            {
+                GWKBilinearResampleUnifiedMask4SampleMultiBandT<T>(
+                    poWK, dfSrcX, dfSrcY, pdfDensity, padfReal);
+                return;
+            }
+        }
+    }
+
+    double adfCoeffsX[4] = {};
+    GWKCubicComputeWeights(dfSrcX - 0.5 - iSrcX, adfCoeffsX);
+
+    double adfCoeffsY[4] = {};
+    GWKCubicComputeWeights(dfSrcY - 0.5 - iSrcY, adfCoeffsY);
+
+    double adfValueDens[4] = {};
+    for (int i = 0; i < 4; i++)
+        adfValueDens[i] = CONVOL4(adfCoeffsX, adfDensity + i * 4);
+    *pdfDensity = CONVOL4(adfCoeffsY, adfValueDens);
+
+    for (int iBand = 0; iBand < poWK->nBands; iBand++)
+    {
+        const T *pSrc =
+            reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]) +
+            iTopLeftOffset;
+        double adfValueReal[4] = {};
+        for (int i = 0; i < 4; i++)
+            adfValueReal[i] = CONVOL4(adfCoeffsX, pSrc + i * nSrcXSize);
+        padfReal[iBand] = CONVOL4(adfCoeffsY, adfValueReal);
+    }
+}
+
 template <class T>
 static bool GWKCubicResampleNoMasks4SampleT(const GDALWarpKernel *poWK,
                                             int iBand, double dfSrcX,
@@ -5803,6 +6039,245 @@ static CPLErr GWKRealCase(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKRealCase", GWKRealCaseThread);
 }
 
+/************************************************************************/
+/*                 GWKResampleUnifiedMaskMultiBandThread()              */
+/*                                                                      */
+/*      Bilinear or cubic resampling with a unified source validity     */
+/*      mask and/or source density (typically an alpha band), but no    */
+/*      per-band validity masks: all bands of a destination pixel are   */
+/*      computed from a single evaluation of the sample weights,        */
+/*      instead of one per band as in GWKRealCaseThread().              */
+/************************************************************************/
+
+template <class T, GDALResampleAlg eResample>
+static void GWKResampleUnifiedMaskMultiBandThread(void *pData)
+
+{
+    GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int iYMin = psJob->iYMin;
+    const int iYMax = psJob->iYMax;
+
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate x,y,z coordinate arrays for transformation ... one     */
+    /*      scanlines worth of positions.                                   */
+    /* -------------------------------------------------------------------- */
+
+    // For x, 2 *, because we cache the precomputed values at the end.
+    double *padfX =
+        static_cast<double *>(CPLMalloc(2 * sizeof(double) * nDstXSize));
+    double *padfY =
+        static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
+    double *padfZ =
+        static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
+    int *pabSuccess = static_cast<int *>(CPLMalloc(sizeof(int) * nDstXSize));
+    std::vector<double> adfBandReal(poWK->nBands);
+
+    const double dfSrcCoordPrecision = CPLAtof(CSLFetchNameValueDef(
+        poWK->papszWarpOptions, "SRC_COORD_PRECISION", "0"));
+    const double dfErrorThreshold = CPLAtof(
+        CSLFetchNameValueDef(poWK->papszWarpOptions, "ERROR_THRESHOLD", "0"));
+
+    const bool bOneSourceCornerFailsToReproject =
+        GWKOneSourceCornerFailsToReproject(psJob);
+
+    // Precompute values.
+    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
+
+    /* ==================================================================== */
+    /*      Loop over output lines.                                         */
+    /* ==================================================================== */
+    for (int iDstY = iYMin; iDstY < iYMax; iDstY++)
+    {
+        /* ---------------------------------------------------------------- */
+        /*      Setup points to transform to source image space.            */
+        /* ---------------------------------------------------------------- */
+        memcpy(padfX, padfX + nDstXSize, sizeof(double) * nDstXSize);
+        const double dfY = iDstY + 0.5 + poWK->nDstYOff;
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+            padfY[iDstX] = dfY;
+        memset(padfZ, 0, sizeof(double) * nDstXSize);
+
+        /* ---------------------------------------------------------------- */
+        /*      Transform the points from destination pixel/line            */
+        /*      coordinates to source pixel/line coordinates.               */
+        /* ---------------------------------------------------------------- */
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
+                             padfY, padfZ, pabSuccess);
+        if (dfSrcCoordPrecision > 0.0)
+        {
+            GWKRoundSourceCoordinates(
+                nDstXSize, padfX, padfY, padfZ, pabSuccess, dfSrcCoordPrecision,
+                dfErrorThreshold, poWK->pfnTransformer, psJob->pTransformerArg,
+                0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
+        }
+
+        /* ================================================================ */
+        /*      Loop over pixels in output scanline.                        */
+        /* ================================================================ */
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        {
+            GPtrDiff_t iSrcOffset = 0;
+            if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX, iDstY,
+                                              padfX, padfY, nSrcXSize,
+                                              nSrcYSize, iSrcOffset))
+                continue;
+
+            /* ------------------------------------------------------------ */
+            /*      Do not try to apply transparent/invalid source pixels   */
+            /*      to the destination.                                     */
+            /* ------------------------------------------------------------ */
+            double dfDensity = 1.0;
+
+            if (poWK->pafUnifiedSrcDensity != nullptr)
+            {
+                dfDensity = poWK->pafUnifiedSrcDensity[iSrcOffset];
+                if (dfDensity < SRC_DENSITY_THRESHOLD)
+                {
+                    if (!bOneSourceCornerFailsToReproject)
+                    {
+                        continue;
+                    }
+                    else if (GWKAdjustSrcOffsetOnEdgeUnifiedSrcDensity(
+                                 psJob, iSrcOffset))
+                    {
+                        dfDensity = poWK->pafUnifiedSrcDensity[iSrcOffset];
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                }
+            }
+
+            if (poWK->panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+            {
+                if (!bOneSourceCornerFailsToReproject)
+                {
+                    continue;
+                }
+                else if (!GWKAdjustSrcOffsetOnEdge(psJob, iSrcOffset))
+                {
+                    continue;
+                }
+            }
+
+            /* ------------------------------------------------------------ */
+            /*      Collect the source values of all bands.                 */
+            /* ------------------------------------------------------------ */
+            double dfBandDensity = 0.0;
+            if (eResample == GRA_Bilinear)
+            {
+                GWKBilinearResampleUnifiedMask4SampleMultiBandT<T>(
+                    poWK, padfX[iDstX] - poWK->nSrcXOff,
+                    padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                    adfBandReal.data());
+            }
+            else
+            {
+                GWKCubicResampleUnifiedMask4SampleMultiBandT<T>(
+                    poWK, padfX[iDstX] - poWK->nSrcXOff,
+                    padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                    adfBandReal.data());
+            }
+
+            // If we didn't find any valid inputs skip to next pixel.
+            if (dfBandDensity < BAND_DENSITY_THRESHOLD)
+                continue;
+
+            /* ------------------------------------------------------------ */
+            /*      Apply the computed values to the destination pixel.     */
+            /* ------------------------------------------------------------ */
+            const GPtrDiff_t iDstOffset =
+                iDstX + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+            for (int iBand = 0; iBand < poWK->nBands; iBand++)
+            {
+                GWKSetPixelValueReal(poWK, iBand, iDstOffset, dfBandDensity,
+                                     adfBandReal[iBand]);
+            }
+
+            /* ------------------------------------------------------------ */
+            /*      Update destination density/validity masks.              */
+            /* ------------------------------------------------------------ */
+            GWKOverlayDensity(poWK, iDstOffset, dfDensity);
+
+            if (poWK->panDstValid != nullptr)
+            {
+                CPLMaskSet(poWK->panDstValid, iDstOffset);
+            }
+        }  // Next iDstX.
+
+        /* ---------------------------------------------------------------- */
+        /*      Report progress to the user, and optionally cancel out.     */
+        /* ---------------------------------------------------------------- */
+        if (psJob->pfnProgress && psJob->pfnProgress(psJob))
+            break;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Cleanup and return.                                             */
+    /* -------------------------------------------------------------------- */
+    CPLFree(padfX);
+    CPLFree(padfY);
+    CPLFree(padfZ);
+    CPLFree(pabSuccess);
+}
+
+static CPLErr GWKBilinearUnifiedMaskByte(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearUnifiedMaskByte",
+                  GWKResampleUnifiedMaskMultiBandThread<GByte, GRA_Bilinear>);
+}
+
+static CPLErr GWKCubicUnifiedMaskByte(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicUnifiedMaskByte",
+                  GWKResampleUnifiedMaskMultiBandThread<GByte, GRA_Cubic>);
+}
+
+static CPLErr GWKBilinearUnifiedMaskShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearUnifiedMaskShort",
+                  GWKResampleUnifiedMaskMultiBandThread<GInt16, GRA_Bilinear>);
+}
+
+static CPLErr GWKCubicUnifiedMaskShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicUnifiedMaskShort",
+                  GWKResampleUnifiedMaskMultiBandThread<GInt16, GRA_Cubic>);
+}
+
+static CPLErr GWKBilinearUnifiedMaskUShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKBilinearUnifiedMaskUShort",
+        GWKResampleUnifiedMaskMultiBandThread<GUInt16, GRA_Bilinear>);
+}
+
+static CPLErr GWKCubicUnifiedMaskUShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicUnifiedMaskUShort",
+                  GWKResampleUnifiedMaskMultiBandThread<GUInt16, GRA_Cubic>);
+}
+
+static CPLErr GWKBilinearUnifiedMaskFloat(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearUnifiedMaskFloat",
+                  GWKResampleUnifiedMaskMultiBandThread<float, GRA_Bilinear>);
+}
+
+static CPLErr GWKCubicUnifiedMaskFloat(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicUnifiedMaskFloat",
+                  GWKResampleUnifiedMaskMultiBandThread<float, GRA_Cubic>);
+}
+
 /************************************************************************/
 /*                 GWKCubicResampleNoMasks4MultiBandT()                 */
 /************************************************************************/
@@ -22,10 +22,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -35,6 +38,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_alg_priv.h"
@@ -54,6 +58,28 @@ struct GDALWarpPrivateData
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+
+    // Only set during ChunkAndWarpMulti(), when destination I/O is done
+    // under this mutex, instead of hIOMutex which is then only taken by
+    // WarpRegionToBuffer() for source reads.
+    CPLMutex *hDstIOMutex = nullptr;
+
+    // Warp plan transformer wrapping psOptions->pTransformerArg, used by the
+    // warp kernel. See WARP_PLAN_STEP warp option.
+    void *pWarpPlanTransformerArg = nullptr;
+
+    // Cutline prepared once for all chunks. See GDALCreatePreparedCutline().
+    void *pPreparedCutline = nullptr;
+
+    GDALWarpPrivateData() = default;
+
+    ~GDALWarpPrivateData()
+    {
+        GDALDestroyWarpPlanTransformer(pWarpPlanTransformerArg);
+        GDALDestroyPreparedCutline(pPreparedCutline);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpPrivateData)
 };
 
 static std::mutex gMutex{};
@@ -638,9 +664,64 @@ CPLErr GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions)
     }
     else
     {
-        psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
-                                        psOptions->pfnTransformer,
-                                        psOptions->pTransformerArg);
+        // Optional warp plan, used by the warp kernel.
+        GDALWarpPrivateData *psPrivate = GetWarpPrivateData(this);
+        GDALDestroyWarpPlanTransformer(psPrivate->pWarpPlanTransformerArg);
+        psPrivate->pWarpPlanTransformerArg = nullptr;
+
+        const char *pszWarpPlanStep =
+            CSLFetchNameValue(psOptions->papszWarpOptions, "WARP_PLAN_STEP");
+        const char *pszWarpPlanFilename = CSLFetchNameValue(
+            psOptions->papszWarpOptions, "WARP_PLAN_FILENAME");
+        if ((pszWarpPlanStep || pszWarpPlanFilename) &&
+            psOptions->hDstDS != nullptr &&
+            !GDALTransformIsTranslationOnPixelBoundaries(
+                psOptions->pfnTransformer, psOptions->pTransformerArg))
+        {
+            if (CPLFetchBool(psOptions->papszWarpOptions,
+                             "APPLY_VERTICAL_SHIFT", false))
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "WARP_PLAN_STEP/WARP_PLAN_FILENAME ignored, as not "
+                         "compatible with APPLY_VERTICAL_SHIFT");
+            }
+            else
+            {
+                psPrivate->pWarpPlanTransformerArg =
+                    GDALCreateWarpPlanTransformer(
+                        psOptions->pfnTransformer, psOptions->pTransformerArg,
+                        GDALGetRasterXSize(psOptions->hDstDS),
+                        GDALGetRasterYSize(psOptions->hDstDS),
+                        pszWarpPlanStep ? atoi(pszWarpPlanStep) : 16,
+                        CPLAtof(CSLFetchNameValueDef(
+                            psOptions->papszWarpOptions, "WARP_PLAN_MAX_ERROR",
+                            "0.125")),
+                        pszWarpPlanFilename);
+                if (psPrivate->pWarpPlanTransformerArg == nullptr)
+                    eErr = CE_Failure;
+            }
+        }
+
+        GDALDestroyPreparedCutline(psPrivate->pPreparedCutline);
+        psPrivate->pPreparedCutline = nullptr;
+        if (psOptions->hCutline != nullptr)
+        {
+            psPrivate->pPreparedCutline = GDALCreatePreparedCutline(
+                static_cast<OGRGeometryH>(psOptions->hCutline));
+        }
+
+        if (psPrivate->pWarpPlanTransformerArg)
+        {
+            psThreadData = GWKThreadsCreate(
+                psOptions->papszWarpOptions, GDALWarpPlanTransform,
+                psPrivate->pWarpPlanTransformerArg);
+        }
+        else
+        {
+            psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
+                                            psOptions->pfnTransformer,
+                                            psOptions->pTransformerArg);
+        }
         if (psThreadData == nullptr)
             eErr = CE_Failure;
 
@@ -1065,71 +1146,44 @@ CPLErr GDALChunkAndWarpImage(GDALWarpOperationH hOperation, int nDstXOff,
 }
 
 /************************************************************************/
-/*                          ChunkThreadMain()                           */
+/*                       WriteDestinationBuffer()                       */
 /************************************************************************/
 
-struct ChunkThreadData
+static CPLErr WriteDestinationBuffer(const GDALWarpOptions *psOptions,
+                                     int nDstXOff, int nDstYOff, int nDstXSize,
+                                     int nDstYSize, void *pDstBuffer)
 {
-    GDALWarpOperation *poOperation = nullptr;
-    GDALWarpChunk *pasChunkInfo = nullptr;
-    CPLJoinableThread *hThreadHandle = nullptr;
-    CPLErr eErr = CE_None;
-    double dfProgressBase = 0;
-    double dfProgressScale = 0;
-    CPLMutex *hIOMutex = nullptr;
-
-    CPLMutex *hCondMutex = nullptr;
-    volatile int bIOMutexTaken = 0;
-    CPLCond *hCond = nullptr;
-
-    CPLErrorAccumulator *poErrorAccumulator = nullptr;
-};
-
-static void ChunkThreadMain(void *pThreadData)
-
-{
-    volatile ChunkThreadData *psData =
-        static_cast<volatile ChunkThreadData *>(pThreadData);
-
-    GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
-
-    /* -------------------------------------------------------------------- */
-    /*      Acquire IO mutex.                                               */
-    /* -------------------------------------------------------------------- */
-    if (!CPLAcquireMutex(psData->hIOMutex, 600.0))
+    GDALDataset *poDstDS = GDALDataset::FromHandle(psOptions->hDstDS);
+    CPLErr eErr;
+    if (psOptions->nBandCount == 1)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Failed to acquire IOMutex in WarpRegion().");
-        psData->eErr = CE_Failure;
+        // Particular case to simplify the stack a bit.
+        eErr = poDstDS->GetRasterBand(psOptions->panDstBands[0])
+                   ->RasterIO(GF_Write, nDstXOff, nDstYOff, nDstXSize,
+                              nDstYSize, pDstBuffer, nDstXSize, nDstYSize,
+                              psOptions->eWorkingDataType, 0, 0, nullptr);
     }
     else
     {
-        if (psData->hCond != nullptr)
-        {
-            CPLAcquireMutex(psData->hCondMutex, 1.0);
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex(psData->hCondMutex);
-        }
-
-        auto oAccumulator =
-            psData->poErrorAccumulator->InstallForCurrentScope();
-        CPL_IGNORE_RET_VAL(oAccumulator);
-
-        psData->eErr = psData->poOperation->WarpRegion(
-            pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
-            pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
-            pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
-            pasChunkInfo->sExtraSy, psData->dfProgressBase,
-            psData->dfProgressScale);
+        eErr = poDstDS->RasterIO(GF_Write, nDstXOff, nDstYOff, nDstXSize,
+                                 nDstYSize, pDstBuffer, nDstXSize, nDstYSize,
+                                 psOptions->eWorkingDataType,
+                                 psOptions->nBandCount, psOptions->panDstBands,
+                                 0, 0, 0, nullptr);
+    }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Release the IO mutex. */
-        /* --------------------------------------------------------------------
-         */
-        CPLReleaseMutex(psData->hIOMutex);
+    if (eErr == CE_None &&
+        CPLFetchBool(psOptions->papszWarpOptions, "WRITE_FLUSH", false))
+    {
+        const CPLErr eOldErr = CPLGetLastErrorType();
+        const CPLString osLastErrMsg = CPLGetLastErrorMsg();
+        GDALFlushCache(psOptions->hDstDS);
+        const CPLErr eNewErr = CPLGetLastErrorType();
+        if (eNewErr != eOldErr ||
+            osLastErrMsg.compare(CPLGetLastErrorMsg()) != 0)
+            eErr = CE_Failure;
     }
+    return eErr;
 }
 
 /************************************************************************/
@@ -1146,7 +1200,15 @@ static void ChunkThreadMain(void *pThreadData)
  *
  * Externally this method operates the same as ChunkAndWarpImage(), but
  * internally this method uses multiple threads to interleave input/output
- * for one region while the processing is being done for another.
+ * for some regions while the processing is being done for another.
+ *
+ * Several chunks are in flight at the same time, each going through a source
+ * read stage, a warp stage (itself multi-threaded with the NUM_THREADS warp
+ * option) and a destination write stage. Only one chunk at a time is in each
+ * stage. When the destination buffer is initialized without reading the
+ * destination dataset (INIT_DEST warp option), destination writes, done in
+ * chunk order, are overlapped with source reads of later chunks. The number
+ * of chunks in flight can be set with the MULTI_CHUNKS_IN_FLIGHT warp option.
  *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
@@ -1166,9 +1228,24 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
+    /* -------------------------------------------------------------------- */
+    /*      Destination I/O can be done under its own mutex, concurrently   */
+    /*      with source reads, if the destination buffer does not need to   */
+    /*      be read from the destination dataset, and that one is not the   */
+    /*      source dataset.                                                 */
+    /* -------------------------------------------------------------------- */
+    const char *pszInitDest =
+        CSLFetchNameValue(psOptions->papszWarpOptions, "INIT_DEST");
+    const bool bSeparateDstIO = pszInitDest != nullptr &&
+                                pszInitDest[0] != '\0' &&
+                                psOptions->hSrcDS != psOptions->hDstDS;
+    CPLMutex *hDstIOMutex = nullptr;
+    if (bSeparateDstIO)
+    {
+        hDstIOMutex = CPLCreateMutex();
+        CPLReleaseMutex(hDstIOMutex);
+        GetWarpPrivateData(this)->hDstIOMutex = hDstIOMutex;
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Collect the list of chunks to operate on.                       */
@@ -1176,117 +1253,176 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
     /* -------------------------------------------------------------------- */
-    /*      Process them one at a time, updating the progress               */
-    /*      information for each region.                                    */
+    /*      Each chunk in flight holds its source and destination buffers.  */
+    /*      By default, allow one chunk per stage that can run concurrently.*/
     /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
-    CPLErrorAccumulator oErrorAccumulator;
-    for (int i = 0; i < 2; ++i)
-    {
-        asThreadData[i].poOperation = this;
-        asThreadData[i].hIOMutex = hIOMutex;
-        asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
-    }
+    const int nChunksInFlight = std::max(
+        1, std::min(std::max(1, nChunkListCount),
+                    atoi(CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                                              "MULTI_CHUNKS_IN_FLIGHT",
+                                              bSeparateDstIO ? "3" : "2"))));
+    CPLDebug("GDAL", "%d chunks in flight, %s destination I/O",
+             nChunksInFlight, bSeparateDstIO ? "separate" : "shared");
 
-    double dfPixelsProcessed = 0.0;
-    double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+    // Dedicated pool, as the warp kernel itself uses the global thread pool
+    // and the jobs below spend most of their time waiting on mutexes.
+    CPLWorkerThreadPool oPool;
+    CPLErr eErr = oPool.Setup(nChunksInFlight, nullptr, nullptr) ? CE_None
+                                                                  : CE_Failure;
 
-    CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
-    {
-        int iThread = iChunk % 2;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Launch thread for this chunk. */
-        /* --------------------------------------------------------------------
-         */
-        if (pasChunkList != nullptr && iChunk < nChunkListCount)
-        {
-            GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
-            const double dfChunkPixels =
-                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
-
-            asThreadData[iThread].dfProgressBase =
-                dfPixelsProcessed / dfTotalPixels;
-            asThreadData[iThread].dfProgressScale =
-                dfChunkPixels / dfTotalPixels;
+    /* -------------------------------------------------------------------- */
+    /*      Process chunks. As the jobs of the pool are started in the      */
+    /*      order they are submitted, waiting for the turn of a chunk to    */
+    /*      write its output cannot deadlock.                               */
+    /* -------------------------------------------------------------------- */
+    std::vector<CPLErr> aeChunkErr(nChunkListCount, CE_None);
+    std::atomic<bool> bStop{false};
+    std::mutex oWriteOrderMutex;
+    std::condition_variable oWriteOrderCV;
+    int iNextChunkToWrite = 0;
+    CPLErrorAccumulator oErrorAccumulator;
 
-            dfPixelsProcessed += dfChunkPixels;
+    const auto ProcessChunk = [this, hDstIOMutex, &aeChunkErr, &bStop,
+                               &oWriteOrderMutex, &oWriteOrderCV,
+                               &iNextChunkToWrite, &oErrorAccumulator](
+                                  int iChunk, double dfProgressBase,
+                                  double dfProgressScale)
+    {
+        auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
 
-            asThreadData[iThread].pasChunkInfo = pasThisChunk;
+        const GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        CPLErr eChunkErr = CE_None;
 
-            if (iChunk == 0)
+        if (hDstIOMutex == nullptr)
+        {
+            if (!bStop)
             {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
+                CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                         nChunkListCount);
+                if (!CPLAcquireMutex(hIOMutex, 600.0))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to acquire IOMutex in WarpRegion().");
+                    eChunkErr = CE_Failure;
+                }
+                else
+                {
+                    eChunkErr = WarpRegion(
+                        pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
+                        pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
+                        pasThisChunk->ssx, pasThisChunk->ssy,
+                        pasThisChunk->sExtraSx, pasThisChunk->sExtraSy,
+                        dfProgressBase, dfProgressScale);
+                    CPLReleaseMutex(hIOMutex);
+                }
+                CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                         nChunkListCount);
             }
-            else
+        }
+        else
+        {
+            void *pDstBuffer = nullptr;
+            if (!bStop)
             {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
+                CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                         nChunkListCount);
+                pDstBuffer = CreateDestinationBuffer(pasThisChunk->dsx,
+                                                     pasThisChunk->dsy);
+                eChunkErr =
+                    pDstBuffer == nullptr
+                        ? CE_Failure
+                        : WarpRegionToBuffer(
+                              pasThisChunk->dx, pasThisChunk->dy,
+                              pasThisChunk->dsx, pasThisChunk->dsy, pDstBuffer,
+                              psOptions->eWorkingDataType, pasThisChunk->sx,
+                              pasThisChunk->sy, pasThisChunk->ssx,
+                              pasThisChunk->ssy, pasThisChunk->sExtraSx,
+                              pasThisChunk->sExtraSy, dfProgressBase,
+                              dfProgressScale);
             }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
 
-            CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
-            asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
-            if (asThreadData[iThread].hThreadHandle == nullptr)
+            // Write chunks in order, so that the layout of the output file
+            // does not depend on thread scheduling.
             {
-                CPLError(
-                    CE_Failure, CPLE_AppDefined,
-                    "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
-                eErr = CE_Failure;
-                break;
+                std::unique_lock<std::mutex> oLock(oWriteOrderMutex);
+                oWriteOrderCV.wait(oLock, [&iNextChunkToWrite, iChunk]
+                                   { return iNextChunkToWrite == iChunk; });
             }
 
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if (iChunk == 0)
+            if (pDstBuffer != nullptr && eChunkErr == CE_None && !bStop)
             {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while (asThreadData[iThread].bIOMutexTaken == FALSE)
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
+                if (!CPLAcquireMutex(hDstIOMutex, 600.0))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to acquire DstIOMutex in WarpRegion().");
+                    eChunkErr = CE_Failure;
+                }
+                else
+                {
+                    eChunkErr = WriteDestinationBuffer(
+                        psOptions, pasThisChunk->dx, pasThisChunk->dy,
+                        pasThisChunk->dsx, pasThisChunk->dsy, pDstBuffer);
+                    CPLReleaseMutex(hDstIOMutex);
+                }
+                CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                         nChunkListCount);
             }
-        }
+            if (pDstBuffer != nullptr)
+                DestroyDestinationBuffer(pDstBuffer);
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Wait for previous chunks thread to complete. */
-        /* --------------------------------------------------------------------
-         */
-        if (iChunk > 0)
-        {
-            iThread = (iChunk - 1) % 2;
-
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
+            {
+                std::lock_guard<std::mutex> oLock(oWriteOrderMutex);
+                ++iNextChunkToWrite;
+            }
+            oWriteOrderCV.notify_all();
+        }
 
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
-                     nChunkListCount);
+        aeChunkErr[iChunk] = eChunkErr;
+        if (eChunkErr != CE_None)
+            bStop = true;
+    };
 
-            eErr = asThreadData[iThread].eErr;
+    double dfPixelsProcessed = 0.0;
+    const double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+    for (int iChunk = 0; eErr == CE_None && iChunk < nChunkListCount;
+         iChunk++)
+    {
+        const GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        const double dfChunkPixels =
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+        const double dfProgressBase = dfPixelsProcessed / dfTotalPixels;
+        const double dfProgressScale = dfChunkPixels / dfTotalPixels;
+        dfPixelsProcessed += dfChunkPixels;
 
-            if (eErr != CE_None)
-                break;
+        if (!oPool.SubmitJob(
+                [&ProcessChunk, iChunk, dfProgressBase, dfProgressScale]()
+                { ProcessChunk(iChunk, dfProgressBase, dfProgressScale); }))
+        {
+            eErr = CE_Failure;
+            // Let already submitted chunks waiting for their turn to write
+            // go on.
+            bStop = true;
         }
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Wait for all threads to complete.                               */
+    /*      Wait for all chunks to complete.                                */
     /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
+    oPool.WaitCompletion();
+
+    for (const CPLErr eChunkErr : aeChunkErr)
     {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        if (eErr != CE_None)
+            break;
+        eErr = eChunkErr;
     }
 
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
+    if (hDstIOMutex)
+    {
+        GetWarpPrivateData(this)->hDstIOMutex = nullptr;
+        CPLDestroyMutex(hDstIOMutex);
+    }
 
     WipeChunkList();
 
@@ -1719,34 +1855,8 @@ CPLErr GDALWarpOperation::WarpRegion(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None)
     {
-        if (psOptions->nBandCount == 1)
-        {
-            // Particular case to simplify the stack a bit.
-            eErr = poDstDS->GetRasterBand(psOptions->panDstBands[0])
-                       ->RasterIO(GF_Write, nDstXOff, nDstYOff, nDstXSize,
-                                  nDstYSize, pDstBuffer, nDstXSize, nDstYSize,
-                                  psOptions->eWorkingDataType, 0, 0, nullptr);
-        }
-        else
-        {
-            eErr = poDstDS->RasterIO(GF_Write, nDstXOff, nDstYOff, nDstXSize,
-                                     nDstYSize, pDstBuffer, nDstXSize,
-                                     nDstYSize, psOptions->eWorkingDataType,
-                                     psOptions->nBandCount,
-                                     psOptions->panDstBands, 0, 0, 0, nullptr);
-        }
-
-        if (eErr == CE_None &&
-            CPLFetchBool(psOptions->papszWarpOptions, "WRITE_FLUSH", false))
-        {
-            const CPLErr eOldErr = CPLGetLastErrorType();
-            const CPLString osLastErrMsg = CPLGetLastErrorMsg();
-            GDALFlushCache(psOptions->hDstDS);
-            const CPLErr eNewErr = CPLGetLastErrorType();
-            if (eNewErr != eOldErr ||
-                osLastErrMsg.compare(CPLGetLastErrorMsg()) != 0)
-                eErr = CE_Failure;
-        }
+        eErr = WriteDestinationBuffer(psOptions, nDstXOff, nDstYOff, nDstXSize,
+                                      nDstYSize, pDstBuffer);
         ReportTiming("Output buffer write");
     }
 
@@ -1865,6 +1975,34 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
     CPLAssert(eBufDataType == psOptions->eWorkingDataType);
 
+    /* -------------------------------------------------------------------- */
+    /*      When ChunkAndWarpMulti() does destination I/O under its own     */
+    /*      mutex, the IO mutex is only taken here, for source reads.       */
+    /* -------------------------------------------------------------------- */
+    CPLMutex *hDstIOMutex =
+        hIOMutex != nullptr ? GetWarpPrivateData(this)->hDstIOMutex : nullptr;
+    struct MutexReleaser
+    {
+        CPLMutex *hMutex = nullptr;
+
+        ~MutexReleaser()
+        {
+            if (hMutex)
+                CPLReleaseMutex(hMutex);
+        }
+    } oMutexReleaser;
+
+    if (hDstIOMutex != nullptr)
+    {
+        if (!CPLAcquireMutex(hIOMutex, 600.0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to acquire IOMutex in WarpRegion().");
+            return CE_Failure;
+        }
+        oMutexReleaser.hMutex = hIOMutex;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      If not given a corresponding source window compute one now.     */
     /* -------------------------------------------------------------------- */
@@ -1896,6 +2034,20 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Nothing to do if the source window is fully outside of the      */
+    /*      cutline: save reading it.                                       */
+    /* -------------------------------------------------------------------- */
+    void *pPreparedCutline = GetWarpPrivateData(this)->pPreparedCutline;
+    if (pPreparedCutline && nSrcXSize > 0 && nSrcYSize > 0 &&
+        GDALPreparedCutlineClassifyWindow(
+            pPreparedCutline, psOptions->dfCutlineBlendDist, nSrcXOff,
+            nSrcYOff, nSrcXSize, nSrcYSize) == GCMVF_NO_INTERSECTION)
+    {
+        CPLDebug("WARP", "Source window fully outside cutline. Skipping it.");
+        return CE_None;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Prepare a WarpKernel object to match this operation.            */
     /* -------------------------------------------------------------------- */
@@ -1907,8 +2059,17 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     oWK.nBands = psOptions->nBandCount;
     oWK.eWorkingDataType = psOptions->eWorkingDataType;
 
-    oWK.pfnTransformer = psOptions->pfnTransformer;
-    oWK.pTransformerArg = psOptions->pTransformerArg;
+    if (void *pWarpPlanTransformerArg =
+            GetWarpPrivateData(this)->pWarpPlanTransformerArg)
+    {
+        oWK.pfnTransformer = GDALWarpPlanTransform;
+        oWK.pTransformerArg = pWarpPlanTransformerArg;
+    }
+    else
+    {
+        oWK.pfnTransformer = psOptions->pfnTransformer;
+        oWK.pTransformerArg = psOptions->pTransformerArg;
+    }
 
     oWK.pfnProgress = psOptions->pfnProgress;
     oWK.pProgress = psOptions->pProgressArg;
@@ -2071,7 +2232,12 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
 
         int nValidityFlag = 0;
-        if (eErr == CE_None)
+        if (eErr == CE_None && pPreparedCutline)
+            eErr = GDALWarpCutlineMaskerPrepared(
+                psOptions, pPreparedCutline, oWK.nSrcXOff, oWK.nSrcYOff,
+                oWK.nSrcXSize, oWK.nSrcYSize, oWK.pafUnifiedSrcDensity,
+                &nValidityFlag);
+        else if (eErr == CE_None)
             eErr = GDALWarpCutlineMaskerEx(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nSrcXOff, oWK.nSrcYOff, oWK.nSrcXSize, oWK.nSrcYSize,
@@ -2310,6 +2476,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
+        oMutexReleaser.hMutex = nullptr;
         CPLReleaseMutex(hIOMutex);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
@@ -2343,17 +2510,19 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
             &oWK, psOptions->pPostWarpProcessorArg);
 
     /* -------------------------------------------------------------------- */
-    /*      Release Warp Mutex, and acquire io mutex.                       */
+    /*      Release Warp Mutex, and acquire io mutex (or destination io     */
+    /*      mutex, that we release ourselves, for the alpha band write).    */
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
         CPLReleaseMutex(hWarpMutex);
-        if (!CPLAcquireMutex(hIOMutex, 600.0))
+        if (!CPLAcquireMutex(hDstIOMutex ? hDstIOMutex : hIOMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire IOMutex in WarpRegion().");
             return CE_Failure;
         }
+        oMutexReleaser.hMutex = hDstIOMutex;
     }
 
     /* -------------------------------------------------------------------- */
@@ -0,0 +1,570 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Warp plan transformer: cached grid of source coordinates of a
+ *           destination raster, that can be persisted and reused.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_minixml.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*! @cond Doxygen_Suppress */
+
+/* The warp plan samples the destination to source transformation on a grid
+ * of nodes spaced by nStep destination pixels, covering the destination
+ * raster. A grid cell is usable for bilinear interpolation if its 4 corners
+ * could be transformed and if the interpolated value at its center is within
+ * dfMaxError pixels (Manhattan distance) of the exact one. Other points are
+ * transformed with the base transformer.
+ *
+ * When persisted, the grid is a GeoTIFF file of (nGridXSize, nGridYSize)
+ * pixels with 3 Float64 bands: source X, source Y (NaN for failed nodes), and
+ * whether the cell whose top-left corner is the node is usable. The
+ * destination raster size, the step, the maximum error and the serialized
+ * base transformer are stored as metadata items, and must match for the file
+ * to be reused.
+ */
+
+namespace
+{
+
+/************************************************************************/
+/*                          GDALWarpPlanGrid                            */
+/************************************************************************/
+
+struct GDALWarpPlanGrid
+{
+    int nDstXSize = 0;
+    int nDstYSize = 0;
+    int nStep = 0;
+    double dfMaxError = 0;
+    std::string osFilename{};
+
+    int nGridXSize = 0;
+    int nGridYSize = 0;
+    std::vector<double> adfSrcX{};
+    std::vector<double> adfSrcY{};
+    std::vector<GByte> abyCellOK{};
+
+    std::once_flag oBuildFlag{};
+
+    void Build(GDALTransformerFunc pfnBaseTransformer, void *pBaseTransformArg);
+
+  private:
+    void Compute(GDALTransformerFunc pfnBaseTransformer,
+                 void *pBaseTransformArg);
+    bool Load(const std::string &osTransformerXML);
+    void Save(const std::string &osTransformerXML) const;
+};
+
+/************************************************************************/
+/*                      GDALWarpPlanTransformInfo                       */
+/************************************************************************/
+
+struct GDALWarpPlanTransformInfo
+{
+    GDALTransformerInfo sTI{};
+
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseTransformArg = nullptr;
+    bool bOwnBaseTransformer = false;
+
+    std::shared_ptr<GDALWarpPlanGrid> poGrid{};
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       GDALWarpPlanGrid::Build()                      */
+/************************************************************************/
+
+void GDALWarpPlanGrid::Build(GDALTransformerFunc pfnBaseTransformer,
+                             void *pBaseTransformArg)
+{
+    std::string osTransformerXML;
+    if (!osFilename.empty())
+    {
+        CPLXMLNode *psTree =
+            GDALSerializeTransformer(pfnBaseTransformer, pBaseTransformArg);
+        if (psTree)
+        {
+            char *pszXML = CPLSerializeXMLTree(psTree);
+            osTransformerXML = pszXML;
+            CPLFree(pszXML);
+            CPLDestroyXMLNode(psTree);
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Warp plan cannot be persisted in %s, as the "
+                     "transformer cannot be serialized",
+                     osFilename.c_str());
+            osFilename.clear();
+        }
+    }
+
+    if (!osFilename.empty() && Load(osTransformerXML))
+    {
+        CPLDebug("WARP", "Warp plan loaded from %s", osFilename.c_str());
+        return;
+    }
+
+    Compute(pfnBaseTransformer, pBaseTransformArg);
+
+    if (!osFilename.empty())
+        Save(osTransformerXML);
+}
+
+/************************************************************************/
+/*                      GDALWarpPlanGrid::Compute()                     */
+/************************************************************************/
+
+void GDALWarpPlanGrid::Compute(GDALTransformerFunc pfnBaseTransformer,
+                               void *pBaseTransformArg)
+{
+    const size_t nNodes = static_cast<size_t>(nGridXSize) * nGridYSize;
+    adfSrcX.assign(nNodes, std::numeric_limits<double>::quiet_NaN());
+    adfSrcY.assign(nNodes, std::numeric_limits<double>::quiet_NaN());
+    abyCellOK.assign(nNodes, 0);
+
+    std::vector<double> adfX(nGridXSize);
+    std::vector<double> adfY(nGridXSize);
+    std::vector<double> adfZ(nGridXSize);
+    std::vector<int> abSuccess(nGridXSize);
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform grid nodes, one row at a time.                        */
+    /* -------------------------------------------------------------------- */
+    for (int iY = 0; iY < nGridYSize; ++iY)
+    {
+        for (int iX = 0; iX < nGridXSize; ++iX)
+        {
+            adfX[iX] = static_cast<double>(iX) * nStep;
+            adfY[iX] = static_cast<double>(iY) * nStep;
+            adfZ[iX] = 0;
+        }
+        pfnBaseTransformer(pBaseTransformArg, TRUE, nGridXSize, adfX.data(),
+                           adfY.data(), adfZ.data(), abSuccess.data());
+        for (int iX = 0; iX < nGridXSize; ++iX)
+        {
+            if (abSuccess[iX] && std::isfinite(adfX[iX]) &&
+                std::isfinite(adfY[iX]))
+            {
+                const size_t iNode = static_cast<size_t>(iY) * nGridXSize + iX;
+                adfSrcX[iNode] = adfX[iX];
+                adfSrcY[iNode] = adfY[iX];
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Check the interpolation error at the center of cells.           */
+    /* -------------------------------------------------------------------- */
+    const int nCellsX = nGridXSize - 1;
+    size_t nCellsOK = 0;
+    for (int iY = 0; iY + 1 < nGridYSize; ++iY)
+    {
+        for (int iX = 0; iX < nCellsX; ++iX)
+        {
+            adfX[iX] = (iX + 0.5) * nStep;
+            adfY[iX] = (iY + 0.5) * nStep;
+            adfZ[iX] = 0;
+        }
+        pfnBaseTransformer(pBaseTransformArg, TRUE, nCellsX, adfX.data(),
+                           adfY.data(), adfZ.data(), abSuccess.data());
+        for (int iX = 0; iX < nCellsX; ++iX)
+        {
+            const size_t iNode = static_cast<size_t>(iY) * nGridXSize + iX;
+            const size_t iNodeBelow = iNode + nGridXSize;
+            const double dfInterpX =
+                (adfSrcX[iNode] + adfSrcX[iNode + 1] + adfSrcX[iNodeBelow] +
+                 adfSrcX[iNodeBelow + 1]) /
+                4;
+            const double dfInterpY =
+                (adfSrcY[iNode] + adfSrcY[iNode + 1] + adfSrcY[iNodeBelow] +
+                 adfSrcY[iNodeBelow + 1]) /
+                4;
+            // NaN corners make the comparison false
+            if (abSuccess[iX] && std::fabs(dfInterpX - adfX[iX]) +
+                                         std::fabs(dfInterpY - adfY[iX]) <=
+                                     dfMaxError)
+            {
+                abyCellOK[iNode] = 1;
+                ++nCellsOK;
+            }
+        }
+    }
+
+    CPLDebug("WARP",
+             "Warp plan of %d x %d nodes (step %d): %.1f %% of cells "
+             "interpolated",
+             nGridXSize, nGridYSize, nStep,
+             nCellsX > 0 && nGridYSize > 1
+                 ? 100.0 * static_cast<double>(nCellsOK) / nCellsX /
+                       (nGridYSize - 1)
+                 : 0.0);
+}
+
+/************************************************************************/
+/*                       GDALWarpPlanGrid::Load()                       */
+/************************************************************************/
+
+bool GDALWarpPlanGrid::Load(const std::string &osTransformerXML)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return false;
+
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        osFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+    if (!poDS)
+        return false;
+
+    const auto MetadataMatches = [&poDS](const char *pszKey,
+                                         const std::string &osExpected)
+    {
+        const char *pszVal = poDS->GetMetadataItem(pszKey);
+        return pszVal != nullptr && osExpected == pszVal;
+    };
+
+    if (poDS->GetRasterXSize() != nGridXSize ||
+        poDS->GetRasterYSize() != nGridYSize || poDS->GetRasterCount() != 3 ||
+        !MetadataMatches("WARP_PLAN_DST_XSIZE", std::to_string(nDstXSize)) ||
+        !MetadataMatches("WARP_PLAN_DST_YSIZE", std::to_string(nDstYSize)) ||
+        !MetadataMatches("WARP_PLAN_STEP", std::to_string(nStep)) ||
+        !MetadataMatches("WARP_PLAN_MAX_ERROR",
+                         CPLSPrintf("%.17g", dfMaxError)) ||
+        !MetadataMatches("WARP_PLAN_TRANSFORMER", osTransformerXML))
+    {
+        CPLDebug("WARP",
+                 "Warp plan in %s does not match the current warp operation. "
+                 "Recomputing it",
+                 osFilename.c_str());
+        return false;
+    }
+
+    const size_t nNodes = static_cast<size_t>(nGridXSize) * nGridYSize;
+    std::vector<double> adfCellOK;
+    try
+    {
+        adfSrcX.resize(nNodes);
+        adfSrcY.resize(nNodes);
+        adfCellOK.resize(nNodes);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when loading warp plan");
+        return false;
+    }
+    double *apadfBands[] = {adfSrcX.data(), adfSrcY.data(), adfCellOK.data()};
+    for (int iBand = 0; iBand < 3; ++iBand)
+    {
+        if (poDS->GetRasterBand(iBand + 1)->RasterIO(
+                GF_Read, 0, 0, nGridXSize, nGridYSize, apadfBands[iBand],
+                nGridXSize, nGridYSize, GDT_Float64, 0, 0, nullptr) != CE_None)
+        {
+            return false;
+        }
+    }
+    abyCellOK.resize(nNodes);
+    for (size_t i = 0; i < nNodes; ++i)
+        abyCellOK[i] = adfCellOK[i] != 0 ? 1 : 0;
+    return true;
+}
+
+/************************************************************************/
+/*                       GDALWarpPlanGrid::Save()                       */
+/************************************************************************/
+
+void GDALWarpPlanGrid::Save(const std::string &osTransformerXML) const
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poDriver)
+        return;
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("COMPRESS", "DEFLATE");
+    aosOptions.SetNameValue("INTERLEAVE", "BAND");
+    std::unique_ptr<GDALDataset> poDS(
+        poDriver->Create(osFilename.c_str(), nGridXSize, nGridYSize, 3,
+                         GDT_Float64, aosOptions.List()));
+    bool bOK = poDS != nullptr;
+    if (bOK)
+    {
+        poDS->SetMetadataItem("WARP_PLAN_DST_XSIZE",
+                              std::to_string(nDstXSize).c_str());
+        poDS->SetMetadataItem("WARP_PLAN_DST_YSIZE",
+                              std::to_string(nDstYSize).c_str());
+        poDS->SetMetadataItem("WARP_PLAN_STEP", std::to_string(nStep).c_str());
+        poDS->SetMetadataItem("WARP_PLAN_MAX_ERROR",
+                              CPLSPrintf("%.17g", dfMaxError));
+        poDS->SetMetadataItem("WARP_PLAN_TRANSFORMER",
+                              osTransformerXML.c_str());
+
+        std::vector<double> adfCellOK(abyCellOK.begin(), abyCellOK.end());
+        const double *apadfBands[] = {adfSrcX.data(), adfSrcY.data(),
+                                      adfCellOK.data()};
+        for (int iBand = 0; bOK && iBand < 3; ++iBand)
+        {
+            bOK = poDS->GetRasterBand(iBand + 1)->RasterIO(
+                      GF_Write, 0, 0, nGridXSize, nGridYSize,
+                      const_cast<double *>(apadfBands[iBand]), nGridXSize,
+                      nGridYSize, GDT_Float64, 0, 0, nullptr) == CE_None;
+        }
+        bOK = poDS->Close() == CE_None && bOK;
+    }
+    if (!bOK)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "Cannot save warp plan to %s",
+                 osFilename.c_str());
+    }
+    else
+    {
+        CPLDebug("WARP", "Warp plan saved to %s", osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                        GDALWarpPlanTransform()                       */
+/************************************************************************/
+
+/** Transformer function of the warp plan transformer */
+int GDALWarpPlanTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                          double *padfX, double *padfY, double *padfZ,
+                          int *panSuccess)
+{
+    auto psInfo = static_cast<GDALWarpPlanTransformInfo *>(pTransformArg);
+    if (!bDstToSrc)
+    {
+        return psInfo->pfnBaseTransformer(psInfo->pBaseTransformArg, FALSE,
+                                          nPointCount, padfX, padfY, padfZ,
+                                          panSuccess);
+    }
+
+    GDALWarpPlanGrid &oGrid = *(psInfo->poGrid);
+    std::call_once(oGrid.oBuildFlag,
+                   [psInfo, &oGrid]()
+                   {
+                       oGrid.Build(psInfo->pfnBaseTransformer,
+                                   psInfo->pBaseTransformArg);
+                   });
+
+    // Indices of points outside of usable cells
+    std::vector<int> anExact;
+    const double dfInvStep = 1.0 / oGrid.nStep;
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        const double dfGridX = padfX[i] * dfInvStep;
+        const double dfGridY = padfY[i] * dfInvStep;
+        // Test written that way to catch NaN values
+        if (!(dfGridX >= 0 && dfGridX < oGrid.nGridXSize - 1 && dfGridY >= 0 &&
+              dfGridY < oGrid.nGridYSize - 1))
+        {
+            anExact.push_back(i);
+            continue;
+        }
+        const int iX = static_cast<int>(dfGridX);
+        const int iY = static_cast<int>(dfGridY);
+        const size_t iNode = static_cast<size_t>(iY) * oGrid.nGridXSize + iX;
+        if (!oGrid.abyCellOK[iNode])
+        {
+            anExact.push_back(i);
+            continue;
+        }
+        const double dfFracX = dfGridX - iX;
+        const double dfFracY = dfGridY - iY;
+        const auto Interpolate = [&oGrid, iNode, dfFracX,
+                                  dfFracY](const std::vector<double> &adf)
+        {
+            const double dfTop =
+                adf[iNode] + (adf[iNode + 1] - adf[iNode]) * dfFracX;
+            const double dfBottom =
+                adf[iNode + oGrid.nGridXSize] +
+                (adf[iNode + oGrid.nGridXSize + 1] -
+                 adf[iNode + oGrid.nGridXSize]) *
+                    dfFracX;
+            return dfTop + (dfBottom - dfTop) * dfFracY;
+        };
+        padfX[i] = Interpolate(oGrid.adfSrcX);
+        padfY[i] = Interpolate(oGrid.adfSrcY);
+        panSuccess[i] = TRUE;
+    }
+
+    if (anExact.empty())
+        return TRUE;
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform remaining points with the base transformer.           */
+    /* -------------------------------------------------------------------- */
+    const int nExact = static_cast<int>(anExact.size());
+    std::vector<double> adfX(nExact);
+    std::vector<double> adfY(nExact);
+    std::vector<double> adfZ(nExact);
+    std::vector<int> abSuccess(nExact);
+    for (int j = 0; j < nExact; ++j)
+    {
+        adfX[j] = padfX[anExact[j]];
+        adfY[j] = padfY[anExact[j]];
+        adfZ[j] = padfZ ? padfZ[anExact[j]] : 0;
+    }
+    const int nRet = psInfo->pfnBaseTransformer(
+        psInfo->pBaseTransformArg, TRUE, nExact, adfX.data(), adfY.data(),
+        adfZ.data(), abSuccess.data());
+    for (int j = 0; j < nExact; ++j)
+    {
+        padfX[anExact[j]] = adfX[j];
+        padfY[anExact[j]] = adfY[j];
+        if (padfZ)
+            padfZ[anExact[j]] = adfZ[j];
+        panSuccess[anExact[j]] = abSuccess[j];
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                   GDALSerializeWarpPlanTransformer()                 */
+/************************************************************************/
+
+// The warp plan is a cache that is recreated from warp options, so only
+// the base transformer is serialized.
+static CPLXMLNode *GDALSerializeWarpPlanTransformer(void *pTransformArg)
+{
+    auto psInfo = static_cast<GDALWarpPlanTransformInfo *>(pTransformArg);
+    return GDALSerializeTransformer(psInfo->pfnBaseTransformer,
+                                    psInfo->pBaseTransformArg);
+}
+
+/************************************************************************/
+/*                 GDALCreateSimilarWarpPlanTransformer()               */
+/************************************************************************/
+
+static void *GDALCreateSimilarWarpPlanTransformer(void *pTransformArg,
+                                                  double dfSrcRatioX,
+                                                  double dfSrcRatioY)
+{
+    auto psInfo = static_cast<GDALWarpPlanTransformInfo *>(pTransformArg);
+
+    // The grid is only valid for the full resolution source.
+    if (dfSrcRatioX != 1.0 || dfSrcRatioY != 1.0)
+    {
+        return GDALCreateSimilarTransformer(psInfo->pBaseTransformArg,
+                                            dfSrcRatioX, dfSrcRatioY);
+    }
+
+    void *pClonedBaseArg = GDALCloneTransformer(psInfo->pBaseTransformArg);
+    if (pClonedBaseArg == nullptr)
+        return nullptr;
+
+    auto psClonedInfo = new GDALWarpPlanTransformInfo();
+    psClonedInfo->sTI = psInfo->sTI;
+    psClonedInfo->pfnBaseTransformer = psInfo->pfnBaseTransformer;
+    psClonedInfo->pBaseTransformArg = pClonedBaseArg;
+    psClonedInfo->bOwnBaseTransformer = true;
+    psClonedInfo->poGrid = psInfo->poGrid;
+    return psClonedInfo;
+}
+
+/************************************************************************/
+/*                    GDALDestroyWarpPlanTransformer()                  */
+/************************************************************************/
+
+/** Destroy a transformer created with GDALCreateWarpPlanTransformer() */
+void GDALDestroyWarpPlanTransformer(void *pTransformArg)
+{
+    if (pTransformArg == nullptr)
+        return;
+    auto psInfo = static_cast<GDALWarpPlanTransformInfo *>(pTransformArg);
+    if (psInfo->bOwnBaseTransformer)
+        GDALDestroyTransformer(psInfo->pBaseTransformArg);
+    delete psInfo;
+}
+
+/************************************************************************/
+/*                    GDALCreateWarpPlanTransformer()                   */
+/************************************************************************/
+
+/** Create a warp plan transformer.
+ *
+ * Destination to source transformations of points of the destination raster
+ * are bilinearly interpolated from a grid of nodes every nStep pixels,
+ * computed on first use with the base transformer (or loaded from
+ * pszFilename, if it exists and matches the parameters and the serialized
+ * base transformer), where this is accurate to dfMaxError pixels. Other
+ * transformations are forwarded to the base transformer.
+ *
+ * The base transformer is not owned by the returned transformer, which must
+ * be destroyed with GDALDestroyWarpPlanTransformer().
+ *
+ * @param pfnBaseTransformer base transformer function.
+ * @param pBaseTransformArg base transformer argument.
+ * @param nDstXSize destination raster width.
+ * @param nDstYSize destination raster height.
+ * @param nStep spacing of grid nodes, in destination pixels.
+ * @param dfMaxError maximum error, in source pixels.
+ * @param pszFilename file to load the grid from or save it to, or nullptr.
+ * @return transformer argument, or nullptr in case of error.
+ */
+void *GDALCreateWarpPlanTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                    void *pBaseTransformArg, int nDstXSize,
+                                    int nDstYSize, int nStep, double dfMaxError,
+                                    const char *pszFilename)
+{
+    if (nDstXSize <= 0 || nDstYSize <= 0 || nStep <= 0 || !(dfMaxError >= 0))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid parameters for warp plan");
+        return nullptr;
+    }
+
+    auto poGrid = std::make_shared<GDALWarpPlanGrid>();
+    poGrid->nDstXSize = nDstXSize;
+    poGrid->nDstYSize = nDstYSize;
+    poGrid->nStep = nStep;
+    poGrid->dfMaxError = dfMaxError;
+    if (pszFilename)
+        poGrid->osFilename = pszFilename;
+    poGrid->nGridXSize = (nDstXSize - 1) / nStep + 2;
+    poGrid->nGridYSize = (nDstYSize - 1) / nStep + 2;
+    if (static_cast<double>(poGrid->nGridXSize) * poGrid->nGridYSize >
+        std::numeric_limits<int>::max())
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Too many nodes for warp plan");
+        return nullptr;
+    }
+
+    auto psInfo = new GDALWarpPlanTransformInfo();
+    memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
+           strlen(GDAL_GTI2_SIGNATURE));
+    psInfo->sTI.pszClassName = GDAL_WARP_PLAN_TRANSFORMER_CLASS_NAME;
+    psInfo->sTI.pfnTransform = GDALWarpPlanTransform;
+    psInfo->sTI.pfnCleanup = GDALDestroyWarpPlanTransformer;
+    psInfo->sTI.pfnSerialize = GDALSerializeWarpPlanTransformer;
+    psInfo->sTI.pfnCreateSimilar = GDALCreateSimilarWarpPlanTransformer;
+    psInfo->pfnBaseTransformer = pfnBaseTransformer;
+    psInfo->pBaseTransformArg = pBaseTransformArg;
+    psInfo->poGrid = std::move(poGrid);
+    return psInfo;
+}
+
+/*! @endcond */
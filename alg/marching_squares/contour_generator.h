@@ -54,6 +54,19 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start at line lineIdx instead of the first line, when the raster is
+    // processed by strips of lines. previousLine holds the values of line
+    // lineIdx - 1, and must be nullptr if lineIdx is 0.
+    void setStartLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (previousLine)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+        else
+            std::fill(previousLine_.begin(), previousLine_.end(), NaN);
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -34,36 +34,231 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
 using namespace gdal::polygonizer;
 
 /************************************************************************/
-/*                          GPMaskImageData()                           */
+/*                            GPLineReader                              */
 /*                                                                      */
-/*      Mask out image pixels to a special nodata value if the mask     */
-/*      band is zero.                                                   */
+/*      Feeds GDALPolygonizeT() with source lines, with pixels masked   */
+/*      out to a special nodata value where the mask band is zero.      */
+/*      Lines are read by strips of bounded size, and when a job queue  */
+/*      is available the next strip is read (and decompressed) by a     */
+/*      worker thread while the current one is being polygonized.       */
+/************************************************************************/
+
+namespace
+{
+template <class DataType> class GPLineReader
+{
+  public:
+    GPLineReader(GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+                 GDALDataType eDT, int nXSize, int nYSize,
+                 CPLJobQueue *poJobQueue)
+        : m_hSrcBand(hSrcBand), m_hMaskBand(hMaskBand), m_eDT(eDT),
+          m_nXSize(nXSize), m_nYSize(nYSize), m_poJobQueue(poJobQueue)
+    {
+    }
+
+    ~GPLineReader()
+    {
+        if (m_bPrefetchPending)
+            m_poJobQueue->WaitCompletion();
+    }
+
+    bool Init();
+    void Restart();
+    CPLErr ReadLine(int iY, DataType *panLine);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GPLineReader)
+
+    struct Strip
+    {
+        int nYOff = -1;
+        int nLines = 0;
+        std::vector<DataType> anValues{};
+        std::vector<GByte> abyMask{};
+        CPLErr eErr = CE_None;
+        std::unique_ptr<CPLErrorAccumulator> poErrorAccumulator{};
+    };
+
+    GDALRasterBandH m_hSrcBand = nullptr;
+    GDALRasterBandH m_hMaskBand = nullptr;
+    GDALDataType m_eDT = GDT_Unknown;
+    int m_nXSize = 0;
+    int m_nYSize = 0;
+    int m_nStripHeight = 1;
+    CPLJobQueue *m_poJobQueue = nullptr;
+    Strip m_aoStrips[2]{};
+    int m_iCurStrip = 0;
+    bool m_bPrefetchPending = false;
+
+    void FillStrip(Strip &oStrip, int nYOff) const;
+};
+
+/************************************************************************/
+/*                        GPLineReader::Init()                          */
+/************************************************************************/
+
+template <class DataType> bool GPLineReader<DataType>::Init()
+{
+    // Use the block height of the source band, but make sure each strip is
+    // large enough to amortize the per-request overhead, and small enough
+    // to keep memory usage bounded on very wide rasters.
+    constexpr size_t MIN_STRIP_BYTES = 1024 * 1024;
+    constexpr size_t MAX_STRIP_BYTES = 64 * 1024 * 1024;
+    const size_t nLineBytes =
+        static_cast<size_t>(m_nXSize) *
+        (sizeof(DataType) + (m_hMaskBand ? 1 : 0));
+    int nBlockYSize = 1;
+    GDALGetBlockSize(m_hSrcBand, nullptr, &nBlockYSize);
+    size_t nLines = std::max<size_t>(std::max(1, nBlockYSize),
+                                     MIN_STRIP_BYTES / nLineBytes);
+    nLines = std::min(nLines, std::max<size_t>(1, MAX_STRIP_BYTES / nLineBytes));
+    m_nStripHeight = static_cast<int>(
+        std::min(nLines, static_cast<size_t>(std::max(1, m_nYSize))));
+
+    const int nStrips = m_poJobQueue ? 2 : 1;
+    try
+    {
+        for (int i = 0; i < nStrips; ++i)
+        {
+            m_aoStrips[i].anValues.resize(static_cast<size_t>(m_nXSize) *
+                                          m_nStripHeight);
+            if (m_hMaskBand)
+                m_aoStrips[i].abyMask.resize(static_cast<size_t>(m_nXSize) *
+                                             m_nStripHeight);
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating polygonize line buffers");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GPLineReader::FillStrip()                       */
 /************************************************************************/
 
 template <class DataType>
-static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
-                              int iY, int nXSize, DataType *panImageLine)
+void GPLineReader<DataType>::FillStrip(Strip &oStrip, int nYOff) const
+{
+    oStrip.nYOff = nYOff;
+    oStrip.nLines = std::min(m_nStripHeight, m_nYSize - nYOff);
+    oStrip.eErr = GDALRasterIO(m_hSrcBand, GF_Read, 0, nYOff, m_nXSize,
+                               oStrip.nLines, oStrip.anValues.data(),
+                               m_nXSize, oStrip.nLines, m_eDT, 0, 0);
+    if (oStrip.eErr == CE_None && m_hMaskBand != nullptr)
+    {
+        oStrip.eErr = GDALRasterIO(m_hMaskBand, GF_Read, 0, nYOff, m_nXSize,
+                                   oStrip.nLines, oStrip.abyMask.data(),
+                                   m_nXSize, oStrip.nLines, GDT_Byte, 0, 0);
+        if (oStrip.eErr == CE_None)
+        {
+            const size_t nPixels =
+                static_cast<size_t>(m_nXSize) * oStrip.nLines;
+            for (size_t i = 0; i < nPixels; i++)
+            {
+                if (oStrip.abyMask[i] == 0)
+                    oStrip.anValues[i] = GP_NODATA_MARKER;
+            }
+        }
+    }
+    if (oStrip.eErr != CE_None)
+        oStrip.nYOff = -1;
+}
+
+/************************************************************************/
+/*                       GPLineReader::Restart()                        */
+/************************************************************************/
 
+/** Prepare for a new top-to-bottom scan. Already read strips are kept, so
+ * that a raster fitting in a single strip is only read once. */
+template <class DataType> void GPLineReader<DataType>::Restart()
 {
-    const CPLErr eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1,
-                                     pabyMaskLine, nXSize, 1, GDT_Byte, 0, 0);
-    if (eErr != CE_None)
-        return eErr;
+    if (m_bPrefetchPending)
+    {
+        m_poJobQueue->WaitCompletion();
+        m_bPrefetchPending = false;
+        // Do not report errors of a strip that nobody asked for.
+        m_aoStrips[1 - m_iCurStrip].nYOff = -1;
+    }
+}
+
+/************************************************************************/
+/*                      GPLineReader::ReadLine()                        */
+/************************************************************************/
 
-    for (int i = 0; i < nXSize; i++)
+/** Copy line iY in panLine. Lines must be requested in increasing order
+ * between calls to Restart(). */
+template <class DataType>
+CPLErr GPLineReader<DataType>::ReadLine(int iY, DataType *panLine)
+{
+    Strip *poStrip = &m_aoStrips[m_iCurStrip];
+    if (poStrip->nYOff < 0 || iY < poStrip->nYOff ||
+        iY >= poStrip->nYOff + poStrip->nLines)
     {
-        if (pabyMaskLine[i] == 0)
-            panImageLine[i] = GP_NODATA_MARKER;
+        const int nYOff = iY - (iY % m_nStripHeight);
+        Strip &oOther = m_aoStrips[1 - m_iCurStrip];
+        if (m_bPrefetchPending)
+        {
+            m_poJobQueue->WaitCompletion();
+            m_bPrefetchPending = false;
+            oOther.poErrorAccumulator->ReplayErrors();
+            oOther.poErrorAccumulator.reset();
+            if (oOther.eErr != CE_None)
+                return oOther.eErr;
+        }
+        if (oOther.nYOff == nYOff)
+        {
+            m_iCurStrip = 1 - m_iCurStrip;
+            poStrip = &oOther;
+        }
+        else if (poStrip->nYOff != nYOff)
+        {
+            FillStrip(*poStrip, nYOff);
+            if (poStrip->eErr != CE_None)
+                return poStrip->eErr;
+        }
+
+        // Read the next strip in the background.
+        const int nNextYOff = nYOff + m_nStripHeight;
+        if (m_poJobQueue && nNextYOff < m_nYSize)
+        {
+            Strip &oNext = m_aoStrips[1 - m_iCurStrip];
+            oNext.poErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+            m_bPrefetchPending = m_poJobQueue->SubmitJob(
+                [this, &oNext, nNextYOff]()
+                {
+                    auto oAccumulator =
+                        oNext.poErrorAccumulator->InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    FillStrip(oNext, nNextYOff);
+                });
+            if (!m_bPrefetchPending)
+            {
+                oNext.nYOff = -1;
+                oNext.poErrorAccumulator.reset();
+            }
+        }
     }
 
+    memcpy(panLine,
+           poStrip->anValues.data() +
+               static_cast<size_t>(iY - poStrip->nYOff) * m_nXSize,
+           sizeof(DataType) * m_nXSize);
     return CE_None;
 }
+}  // namespace
 
 /************************************************************************/
 /*                           GDALPolygonizeT()                          */
@@ -117,17 +312,33 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     GInt32 *panThisLineId =
         static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
 
-    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+    /* -------------------------------------------------------------------- */
+    /*      Source lines are read by strips. If several threads are         */
+    /*      allowed, the next strip is read by a worker thread, unless the  */
+    /*      source dataset also holds vector layers (and could thus be the  */
+    /*      one we write to).                                               */
+    /* -------------------------------------------------------------------- */
+    const int nThreads =
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    GDALDatasetH hSrcBandDS = GDALGetBandDataset(hSrcBand);
+    auto poThreadPool =
+        nThreads > 1 && (hSrcBandDS == nullptr ||
+                         GDALDatasetGetLayerCount(hSrcBandDS) == 0)
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    GPLineReader<DataType> oLineReader(hSrcBand, hMaskBand, eDT, nXSize,
+                                       nYSize, poJobQueue.get());
 
     if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
         panLastLineId == nullptr || panThisLineId == nullptr ||
-        pabyMaskLine == nullptr)
+        !oLineReader.Init())
     {
         CPLFree(panThisLineId);
         CPLFree(panLastLineId);
         CPLFree(panThisLineVal);
         CPLFree(panLastLineVal);
-        CPLFree(pabyMaskLine);
         return CE_Failure;
     }
 
@@ -178,13 +389,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
 
     for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
     {
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, eDT, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-
+        eErr = oLineReader.ReadLine(iY, panThisLineVal);
         if (eErr != CE_None)
             break;
 
@@ -227,6 +432,8 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     if (eErr == CE_None)
         oFirstEnum.CompleteMerges();
 
+    oLineReader.Restart();
+
     /* -------------------------------------------------------------------- */
     /*      We will use a new enumerator for the second pass primarily      */
     /*      so we can preserve the first pass map.                          */
@@ -267,11 +474,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
          */
         if (iY < nYSize)
         {
-            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
-                                panThisLineVal, nXSize, 1, eDT, 0, 0);
-            if (eErr == CE_None && hMaskBand != nullptr)
-                eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                       panThisLineVal);
+            eErr = oLineReader.ReadLine(iY, panThisLineVal);
         }
 
         if (eErr != CE_None)
@@ -380,7 +583,6 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     CPLFree(panLastLineVal);
     CPLFree(paoThisLineArm);
     CPLFree(paoLastLineArm);
-    CPLFree(pabyMaskLine);
 
     return eErr;
 }
@@ -471,6 +673,11 @@ GBool GDALFloatEquals(float A, float B)
  * sizes will be substantial.  The algorithm is primarily intended for
  * relatively simple thematic imagery, masks, and classification results.
  *
+ * Starting with GDAL 3.11, the source band is read by strips of bounded size,
+ * and if the GDAL_NUM_THREADS configuration option is set to a value greater
+ * than 1 (or ALL_CPUS), the next strip is read and decoded by a worker thread
+ * while the current one is processed.
+ *
  * @param hSrcBand the source raster band to be processed.
  * @param hMaskBand an optional mask band.  All pixels in the mask band with a
  * value other than zero will be considered suitable for collection as
@@ -545,6 +752,11 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * sizes will be substantial.  The algorithm is primarily intended for
  * relatively simple thematic imagery, masks, and classification results.
  *
+ * Starting with GDAL 3.11, the source band is read by strips of bounded size,
+ * and if the GDAL_NUM_THREADS configuration option is set to a value greater
+ * than 1 (or ALL_CPUS), the next strip is read and decoded by a worker thread
+ * while the current one is processed.
+ *
  * @param hSrcBand the source raster band to be processed.
  * @param hMaskBand an optional mask band.  All pixels in the mask band with a
  * value other than zero will be considered suitable for collection as
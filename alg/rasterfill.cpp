@@ -19,16 +19,20 @@
 #include <cstring>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -344,6 +348,155 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                         GDALFillNodataLine()                         */
+/*                                                                      */
+/*      Interpolate the nodata pixels of a line from the nearest        */
+/*      known values found by the top-down and bottom-up passes.        */
+/************************************************************************/
+
+static void GDALFillNodataLine(int nXSize, int iY, double dfMaxSearchDist,
+                               int nMaxSearchDist, bool bNearest,
+                               bool bHasNoData, float fNoData,
+                               GUInt32 nNoDataVal, const GUInt32 *panTopDownY,
+                               const float *pafTopDownValue,
+                               const GUInt32 *panLastY,
+                               const float *pafLastValue, GByte *pabyMask,
+                               float *pafScanline, GByte *pabyFiltMask)
+{
+    memset(pabyFiltMask, 0, nXSize);
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        int nThisMaxSearchDist = nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        enum Quadrants
+        {
+            QUAD_TOP_LEFT = 0,
+            QUAD_BOTTOM_LEFT = 1,
+            QUAD_TOP_RIGHT = 2,
+            QUAD_BOTTOM_RIGHT = 3,
+        };
+
+        constexpr int QUAD_COUNT = 4;
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        {
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
+        }
+
+        // Step left and right by one pixel searching for the closest
+        // target value for each quadrant.
+        for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+        {
+            const int iLeftX = std::max(0, iX - iStep);
+            const int iRightX = std::min(nXSize - 1, iX + iStep);
+
+            // Top left includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT], afQuadValue[QUAD_TOP_LEFT],
+                       iLeftX, panTopDownY[iLeftX], iX, iY,
+                       pafTopDownValue[iLeftX], nNoDataVal);
+
+            // Bottom left.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                       afQuadValue[QUAD_BOTTOM_LEFT], iLeftX, panLastY[iLeftX],
+                       iX, iY, pafLastValue[iLeftX], nNoDataVal);
+
+            // Top right and bottom right do no include center pixel.
+            if (iStep == 0)
+                continue;
+
+            // Top right includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
+                       afQuadValue[QUAD_TOP_RIGHT], iRightX,
+                       panTopDownY[iRightX], iX, iY,
+                       pafTopDownValue[iRightX], nNoDataVal);
+
+            // Bottom right.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                       afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                       panLastY[iRightX], iX, iY, pafLastValue[iRightX],
+                       nNoDataVal);
+
+            // Every four steps, recompute maximum distance.
+            if ((iStep & 0x3) == 0)
+                nThisMaxSearchDist = static_cast<int>(floor(
+                    std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                             std::max(adfQuadDist[2], adfQuadDist[3]))));
+        }
+
+        bool bHasSrcValues = false;
+        if (bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += afQuadValue[iQuad] * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -384,6 +537,9 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.11). Number of
+ * threads used to interpolate batches of lines. Defaults to the value of
+ * the GDAL_NUM_THREADS configuration option, or 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -594,25 +750,18 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
     GUInt32 *panThisY =
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
-    GUInt32 *panTopDownY =
-        static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
     float *pafLastValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafThisValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    float *pafTopDownValue =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafScanline =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
-    GByte *pabyFiltMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
 
     CPLErr eErr = CE_None;
 
-    if (panLastY == nullptr || panThisY == nullptr || panTopDownY == nullptr ||
-        pafLastValue == nullptr || pafThisValue == nullptr ||
-        pafTopDownValue == nullptr || pafScanline == nullptr ||
-        pabyMask == nullptr || pabyFiltMask == nullptr)
+    if (panLastY == nullptr || panThisY == nullptr || pafLastValue == nullptr ||
+        pafThisValue == nullptr || pafScanline == nullptr || pabyMask == nullptr)
     {
         eErr = CE_Failure;
         goto end;
@@ -709,259 +858,217 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         }
     }
 
-    for (int iX = 0; iX < nXSize; iX++)
-    {
-        panLastY[iX] = nNoDataVal;
-    }
-
     /* ==================================================================== */
     /*      Now we will do collect similar this/last information from       */
     /*      bottom to top and use it in combination with the top to         */
-    /*      bottom search info to interpolate.                              */
+    /*      bottom search info to interpolate. Lines are processed by       */
+    /*      batches: the bottom-up state is collected sequentially for      */
+    /*      each line of the batch, and lines are then interpolated in      */
+    /*      parallel.                                                       */
     /* ==================================================================== */
-    for (int iY = nYSize - 1; iY >= 0 && eErr == CE_None; iY--)
+    if (eErr == CE_None)
     {
-        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1, pabyMask,
-                            nXSize, 1, GDT_Byte, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1, pafScanline,
-                            nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Figure out the most recent pixel for each column. */
-        /* --------------------------------------------------------------------
-         */
-
-        for (int iX = 0; iX < nXSize; iX++)
+        constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+        const size_t nBytesPerLine =
+            static_cast<size_t>(nXSize) *
+            (2 * sizeof(GByte) + 3 * sizeof(float) + 2 * sizeof(GUInt32));
+        const int nBatchLines = static_cast<int>(std::min<size_t>(
+            nYSize, std::max<size_t>(1, BATCH_BYTES / nBytesPerLine)));
+
+        std::vector<GByte> abyBatchMask;
+        std::vector<GByte> abyBatchFiltMask;
+        std::vector<float> afBatchScanline;
+        std::vector<GUInt32> anBatchTopDownY;
+        std::vector<float> afBatchTopDownValue;
+        std::vector<GUInt32> anBatchLastY;
+        std::vector<float> afBatchLastValue;
+        try
         {
-            if (pabyMask[iX])
-            {
-                pafThisValue[iX] = pafScanline[iX];
-                panThisY[iX] = iY;
-            }
-            else if (panLastY[iX] - iY <= dfMaxSearchDist)
-            {
-                pafThisValue[iX] = pafLastValue[iX];
-                panThisY[iX] = panLastY[iX];
-            }
-            else
-            {
-                panThisY[iX] = nNoDataVal;
-            }
+            const size_t nBatchPixels =
+                static_cast<size_t>(nXSize) * nBatchLines;
+            abyBatchMask.resize(nBatchPixels);
+            abyBatchFiltMask.resize(nBatchPixels);
+            afBatchScanline.resize(nBatchPixels);
+            anBatchTopDownY.resize(nBatchPixels);
+            afBatchTopDownValue.resize(nBatchPixels);
+            anBatchLastY.resize(nBatchPixels);
+            afBatchLastValue.resize(nBatchPixels);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory allocating fill nodata buffers");
+            eErr = CE_Failure;
         }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Load the last y and corresponding value from the top down pass.
-         */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hYBand, GF_Read, 0, iY, nXSize, 1, panTopDownY,
-                            nXSize, 1, GDT_UInt32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        eErr = GDALRasterIO(hValBand, GF_Read, 0, iY, nXSize, 1,
-                            pafTopDownValue, nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
+        const int nThreads = std::min(
+            nBatchLines,
+            CPLParseNumThreads(
+                CSLFetchNameValueDef(
+                    papszOptions, "NUM_THREADS",
+                    CPLGetConfigOption("GDAL_NUM_THREADS", "1")),
+                128));
+        auto poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Attempt to interpolate any pixels that are nodata. */
-        /* --------------------------------------------------------------------
-         */
-        memset(pabyFiltMask, 0, nXSize);
         for (int iX = 0; iX < nXSize; iX++)
         {
-            int nThisMaxSearchDist = nMaxSearchDist;
-
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
-
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
-
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
-
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
+            panLastY[iX] = nNoDataVal;
+        }
 
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
-
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
-
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
-
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
-
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
-
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
-
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
+        for (int iY1 = nYSize; iY1 > 0 && eErr == CE_None; iY1 -= nBatchLines)
+        {
+            const int iY0 = std::max(0, iY1 - nBatchLines);
+            const int nLines = iY1 - iY0;
+
+            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY0, nXSize, nLines,
+                                abyBatchMask.data(), nXSize, nLines, GDT_Byte,
+                                0, 0);
+            if (eErr == CE_None)
+                eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY0, nXSize,
+                                    nLines, afBatchScanline.data(), nXSize,
+                                    nLines, GDT_Float32, 0, 0);
+
+            /* ----------------------------------------------------------------
+             */
+            /*      Load the last y and corresponding value from the top */
+            /*      down pass. */
+            /* ----------------------------------------------------------------
+             */
+            if (eErr == CE_None)
+                eErr = GDALRasterIO(hYBand, GF_Read, 0, iY0, nXSize, nLines,
+                                    anBatchTopDownY.data(), nXSize, nLines,
+                                    GDT_UInt32, 0, 0);
+            if (eErr == CE_None)
+                eErr = GDALRasterIO(hValBand, GF_Read, 0, iY0, nXSize, nLines,
+                                    afBatchTopDownValue.data(), nXSize, nLines,
+                                    GDT_Float32, 0, 0);
+            if (eErr != CE_None)
+                break;
 
-            bool bHasSrcValues = false;
-            if (bNearest)
+            /* ----------------------------------------------------------------
+             */
+            /*      Figure out the most recent pixel for each column, */
+            /*      keeping for each line the state of the line below it. */
+            /* ----------------------------------------------------------------
+             */
+            for (int iLine = nLines - 1; iLine >= 0; iLine--)
             {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+                const int iY = iY0 + iLine;
+                const size_t nOff = static_cast<size_t>(iLine) * nXSize;
+                memcpy(anBatchLastY.data() + nOff, panLastY,
+                       nXSize * sizeof(GUInt32));
+                memcpy(afBatchLastValue.data() + nOff, pafLastValue,
+                       nXSize * sizeof(float));
+
+                const GByte *pabyLineMask = abyBatchMask.data() + nOff;
+                const float *pafLine = afBatchScanline.data() + nOff;
+                for (int iX = 0; iX < nXSize; iX++)
                 {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
+                    if (pabyLineMask[iX])
                     {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
-                        }
+                        pafThisValue[iX] = pafLine[iX];
+                        panThisY[iX] = iY;
                     }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
+                    else if (panLastY[iX] - iY <= dfMaxSearchDist)
                     {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
+                        pafThisValue[iX] = pafLastValue[iX];
+                        panThisY[iX] = panLastY[iX];
                     }
                     else
-                        pafScanline[iX] = fNoData;
+                    {
+                        panThisY[iX] = nNoDataVal;
+                    }
                 }
+
+                std::swap(pafThisValue, pafLastValue);
+                std::swap(panThisY, panLastY);
             }
-            else
-            {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
 
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            /* ----------------------------------------------------------------
+             */
+            /*      Attempt to interpolate any pixels that are nodata. */
+            /* ----------------------------------------------------------------
+             */
+            const auto FillLines = [&](int iFirstLine, int iLastLine)
+            {
+                for (int iLine = iFirstLine; iLine < iLastLine; iLine++)
                 {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += afQuadValue[iQuad] * dfWeight;
-                        }
-                    }
+                    const size_t nOff = static_cast<size_t>(iLine) * nXSize;
+                    GDALFillNodataLine(
+                        nXSize, iY0 + iLine, dfMaxSearchDist, nMaxSearchDist,
+                        bNearest, bHasNoData, fNoData, nNoDataVal,
+                        anBatchTopDownY.data() + nOff,
+                        afBatchTopDownValue.data() + nOff,
+                        anBatchLastY.data() + nOff,
+                        afBatchLastValue.data() + nOff,
+                        abyBatchMask.data() + nOff,
+                        afBatchScanline.data() + nOff,
+                        abyBatchFiltMask.data() + nOff);
                 }
+            };
 
-                if (bHasSrcValues)
+            const int nJobs = std::min(nThreads, nLines);
+            if (poJobQueue && nJobs > 1)
+            {
+                for (int i = 0; i < nJobs; i++)
                 {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
+                    const int iFirstLine = static_cast<int>(
+                        static_cast<int64_t>(i) * nLines / nJobs);
+                    const int iLastLine = static_cast<int>(
+                        static_cast<int64_t>(i + 1) * nLines / nJobs);
+                    poJobQueue->SubmitJob(
+                        [&FillLines, iFirstLine, iLastLine]()
+                        { FillLines(iFirstLine, iLastLine); });
                 }
+                poJobQueue->WaitCompletion();
+            }
+            else
+            {
+                FillLines(0, nLines);
             }
-        }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Write out the updated data and mask information. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
-                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
+            /* ----------------------------------------------------------------
+             */
+            /*      Write out the updated data and mask information. */
+            /* ----------------------------------------------------------------
+             */
+            eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY0, nXSize, nLines,
+                                afBatchScanline.data(), nXSize, nLines,
+                                GDT_Float32, 0, 0);
 
-        if (eErr != CE_None)
-            break;
+            if (eErr == CE_None && poTmpMaskDS != nullptr)
+            {
+                // Update (copy of) mask band when it has been provided by the
+                // user
+                eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY0, nXSize,
+                                    nLines, abyBatchMask.data(), nXSize,
+                                    nLines, GDT_Byte, 0, 0);
+            }
 
-        if (poTmpMaskDS != nullptr)
-        {
-            // Update (copy of) mask band when it has been provided by the
-            // user
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
-                                nXSize, 1, GDT_Byte, 0, 0);
+            if (eErr == CE_None)
+                eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY0, nXSize,
+                                    nLines, abyBatchFiltMask.data(), nXSize,
+                                    nLines, GDT_Byte, 0, 0);
 
             if (eErr != CE_None)
                 break;
-        }
-
-        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
-                            pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
-
-        if (eErr != CE_None)
-            break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      report progress. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(
-                dfProgressRatio *
-                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
-                "Filling...", pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
+            /* ----------------------------------------------------------------
+             */
+            /*      report progress. */
+            /* ----------------------------------------------------------------
+             */
+            if (!pfnProgress(dfProgressRatio *
+                                 (0.5 + 0.5 * (nYSize - iY0) /
+                                            static_cast<double>(nYSize)),
+                             "Filling...", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+            }
         }
     }
 
@@ -996,13 +1103,10 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
 end:
     CPLFree(panLastY);
     CPLFree(panThisY);
-    CPLFree(panTopDownY);
     CPLFree(pafLastValue);
     CPLFree(pafThisValue);
-    CPLFree(pafTopDownValue);
     CPLFree(pafScanline);
     CPLFree(pabyMask);
-    CPLFree(pabyFiltMask);
 
     return eErr;
 }
@@ -5,12 +5,13 @@
  ****************************************************************************/
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
-#include <thread>
+#include <new>
 
 #include "cpl_worker_thread_pool.h"
+#include "memdataset.h"
 
-#include "combiner.h"
 #include "cumulative.h"
 #include "notifyqueue.h"
 #include "util.h"
@@ -34,6 +35,11 @@ Cumulative::~Cumulative() = default;
 
 /// Compute the cumulative viewshed of a raster band.
 ///
+/// The source raster is loaded in memory once and shared by all the
+/// executors. Each observer only processes the cells within the maximum
+/// distance, if any, and its visible cells are directly added to the
+/// 32-bit output buffer.
+///
 /// @param srcFilename  Source filename.
 /// @param pfnProgress  Pointer to the progress function. Can be null.
 /// @param pProgressArg  Argument passed to the progress function
@@ -42,9 +48,11 @@ bool Cumulative::run(const std::string &srcFilename,
                      GDALProgressFunc pfnProgress, void *pProgressArg)
 {
     // In cumulative mode, we run the executors in normal mode and want "1" where things
-    // are visible.
+    // are visible. Cells out of the range of an observer aren't visited, so they must
+    // not be counted either.
     m_opts.outputMode = OutputMode::Normal;
     m_opts.visibleVal = 1;
+    m_opts.outOfRangeVal = 0;
 
     DatasetPtr srcDS(
         GDALDataset::FromHandle(GDALOpen(srcFilename.c_str(), GA_ReadOnly)));
@@ -60,46 +68,59 @@ bool Cumulative::run(const std::string &srcFilename,
     m_extent.xStop = GDALGetRasterBandXSize(pSrcBand);
     m_extent.yStop = GDALGetRasterBandYSize(pSrcBand);
 
+    std::array<double, 6> adfInvTransform;
+    srcDS->GetGeoTransform(m_adfTransform.data());
+    if (!GDALInvGeoTransform(m_adfTransform.data(), adfInvTransform.data()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
+        return false;
+    }
+
+    // Load the source raster once, rather than having each executor read it.
+    m_demType = pSrcBand->GetRasterDataType();
+    try
+    {
+        m_demBuf.resize(m_extent.size() * GDALGetDataTypeSizeBytes(m_demType));
+        m_finalBuf = Buf32(m_extent.size());
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for cumulative viewshed.");
+        return false;
+    }
+    if (pSrcBand->RasterIO(GF_Read, 0, 0, m_extent.xSize(), m_extent.ySize(),
+                           m_demBuf.data(), m_extent.xSize(), m_extent.ySize(),
+                           m_demType, 0, 0, nullptr) != CE_None)
+        return false;
+
     // Make a bunch of observer locations based on the spacing and stick them on a queue
-    // to be handled by viewshed executors.
+    // to be handled by viewshed executors. Each observer only computes the part of the
+    // raster within the maximum distance.
+    size_t expectedLines = 0;
     for (int x = 0; x < m_extent.xStop; x += m_opts.observerSpacing)
         for (int y = 0; y < m_extent.yStop; y += m_opts.observerSpacing)
-            m_observerQueue.push({x, y});
+        {
+            Window extent = calcMaxDistanceExtent(
+                x, y, m_extent, m_opts.maxDistance, adfInvTransform);
+            if (extent.size() == 0)
+                continue;
+            expectedLines += extent.ySize();
+            m_observerQueue.push({x, y, extent});
+        }
     m_observerQueue.done();
 
     // Run executors.
     const int numThreads = m_opts.numJobs;
     std::atomic<bool> err = false;
-    std::atomic<int> running = numThreads;
-    Progress progress(pfnProgress, pProgressArg,
-                      m_observerQueue.size() * m_extent.ySize());
+    Progress progress(pfnProgress, pProgressArg, expectedLines);
     CPLWorkerThreadPool executorPool(numThreads);
     for (int i = 0; i < numThreads; ++i)
-        executorPool.SubmitJob(
-            [this, &srcFilename, &progress, &err, &running]
-            { runExecutor(srcFilename, progress, err, running); });
-
-    // Run combiners that create 8-bit sums of executor jobs.
-    CPLWorkerThreadPool combinerPool(numThreads);
-    std::vector<Combiner> combiners(numThreads,
-                                    Combiner(m_datasetQueue, m_rollupQueue));
-    for (Combiner &c : combiners)
-        combinerPool.SubmitJob([&c] { c.run(); });
-
-    // Run 32-bit rollup job that combines the 8-bit results from the combiners.
-    std::thread sum([this] { rollupRasters(); });
-
-    // When the combiner jobs are done, all the data is in the rollup queue.
-    combinerPool.WaitCompletion();
-    if (m_datasetQueue.isStopped())
-        return false;
-    m_rollupQueue.done();
-
-    // Wait for finalBuf to be fully filled.
-    sum.join();
-    // The executors should exit naturally, but we wait here so that we don't outrun their
-    // completion and exit with outstanding threads.
+        executorPool.SubmitJob([this, &progress, &err]
+                               { runExecutor(progress, err); });
     executorPool.WaitCompletion();
+    if (err)
+        return false;
 
     // Scale the data so that we can write an 8-bit raster output.
     scaleOutput();
@@ -114,70 +135,76 @@ bool Cumulative::run(const std::string &srcFilename,
     return true;
 }
 
-/// Run an executor (single viewshed)
-/// @param srcFilename  Source filename
+/// Run an executor (single viewshed) for each observer of the queue.
 /// @param progress  Progress supporting support.
 /// @param err  Shared error flag.
-/// @param running  Shared count of number of executors running.
-void Cumulative::runExecutor(const std::string &srcFilename, Progress &progress,
-                             std::atomic<bool> &err, std::atomic<int> &running)
+void Cumulative::runExecutor(Progress &progress, std::atomic<bool> &err)
 {
-    DatasetPtr srcDs(GDALDataset::Open(srcFilename.c_str(), GA_ReadOnly));
+    // Each executor wraps the shared source buffer in its own dataset, so that
+    // no dataset is used by several threads.
+    MEMDataset *memDs = MEMDataset::Create("", m_extent.xSize(),
+                                           m_extent.ySize(), 0, m_demType,
+                                           nullptr);
+    DatasetPtr srcDs(memDs);
     if (!srcDs)
     {
         err = true;
     }
     else
     {
+        memDs->AddMEMBand(MEMCreateRasterBandEx(
+            memDs, 1, const_cast<GByte *>(m_demBuf.data()), m_demType, 0, 0,
+            false));
+        memDs->SetGeoTransform(m_adfTransform.data());
+
         Location loc;
         while (!err && m_observerQueue.pop(loc))
         {
-            GDALDriver *memDriver =
-                GetGDALDriverManager()->GetDriverByName("MEM");
-            DatasetPtr dstDs(memDriver ? memDriver->Create("", m_extent.xSize(),
-                                                           m_extent.ySize(), 1,
-                                                           GDT_Byte, nullptr)
-                                       : nullptr);
+            DatasetPtr dstDs(MEMDataset::Create("", loc.extent.xSize(),
+                                                loc.extent.ySize(), 1,
+                                                GDT_Byte, nullptr));
             if (!dstDs)
             {
                 err = true;
             }
             else
             {
-                ViewshedExecutor executor(
-                    *srcDs->GetRasterBand(1), *dstDs->GetRasterBand(1), loc.x,
-                    loc.y, m_extent, m_extent, m_opts, progress);
+                // normalize horizontal index to [ 0, loc.extent.xSize() )
+                Window curExtent = loc.extent;
+                curExtent.shiftX(-loc.extent.xStart);
+
+                ViewshedExecutor executor(*srcDs->GetRasterBand(1),
+                                          *dstDs->GetRasterBand(1), loc.x,
+                                          loc.y, loc.extent, curExtent, m_opts,
+                                          progress);
                 err = !executor.run();
                 if (!err)
-                    m_datasetQueue.push(std::move(dstDs));
+                    accumulate(loc.extent,
+                               static_cast<const uint8_t *>(
+                                   dstDs->GetInternalHandle("MEMORY1")));
             }
         }
     }
 
-    // Job done. Set the output queue state.  If all the executor jobs have completed,
-    // set the dataset output queue done.
+    // Make the other executors exit early on error.
     if (err)
-        m_datasetQueue.stop();
-    else
-    {
-        running--;
-        if (!running)
-            m_datasetQueue.done();
-    }
+        m_observerQueue.stop();
 }
 
-// Add 8-bit rasters into the 32-bit raster buffer.
-void Cumulative::rollupRasters()
+/// Add the values of an 8-bit viewshed raster into the 32-bit raster buffer.
+/// Several executors may do so at the same time.
+/// @param extent  Extent of the viewshed raster in the output raster.
+/// @param srcP  Viewshed raster data.
+void Cumulative::accumulate(const Window &extent, const uint8_t *srcP)
 {
-    DatasetPtr pDS;
-
-    m_finalBuf.resize(m_extent.size());
-    while (m_rollupQueue.pop(pDS))
+    for (int y = extent.yStart; y < extent.yStop; ++y)
     {
-        uint8_t *srcP =
-            static_cast<uint8_t *>(pDS->GetInternalHandle("MEMORY1"));
-        for (size_t i = 0; i < m_extent.size(); ++i)
-            m_finalBuf[i] += srcP[i];
+        std::atomic<uint32_t> *dstP =
+            &m_finalBuf[static_cast<size_t>(y) * m_extent.xSize() +
+                        extent.xStart];
+        for (int x = 0; x < extent.xSize(); ++x, ++srcP, ++dstP)
+            if (*srcP)
+                dstP->fetch_add(*srcP, std::memory_order_relaxed);
     }
 }
 
@@ -186,15 +213,15 @@ void Cumulative::rollupRasters()
 void Cumulative::scaleOutput()
 {
     uint32_t m = 0;  // This gathers all the bits set.
-    for (uint32_t &val : m_finalBuf)
-        m = std::max(val, m);
+    for (const std::atomic<uint32_t> &val : m_finalBuf)
+        m = std::max<uint32_t>(val, m);
 
     if (m == 0)
         return;
 
     double factor =
         std::numeric_limits<uint8_t>::max() / static_cast<double>(m);
-    for (uint32_t &val : m_finalBuf)
+    for (std::atomic<uint32_t> &val : m_finalBuf)
         val = static_cast<uint32_t>(std::floor(factor * val));
 }
 
@@ -207,10 +234,18 @@ bool Cumulative::writeOutput(DatasetPtr pDstDS)
         return false;
 
     GDALRasterBand *pDstBand = pDstDS->GetRasterBand(1);
-    return (pDstBand->RasterIO(GF_Write, 0, 0, m_extent.xSize(),
-                               m_extent.ySize(), m_finalBuf.data(),
-                               m_extent.xSize(), m_extent.ySize(), GDT_UInt32,
-                               0, 0, nullptr) == 0);
+    std::vector<uint32_t> line(m_extent.xSize());
+    for (int y = 0; y < m_extent.ySize(); ++y)
+    {
+        const auto srcIt =
+            m_finalBuf.begin() + static_cast<size_t>(y) * m_extent.xSize();
+        std::copy(srcIt, srcIt + m_extent.xSize(), line.begin());
+        if (pDstBand->RasterIO(GF_Write, 0, y, m_extent.xSize(), 1,
+                               line.data(), m_extent.xSize(), 1, GDT_UInt32,
+                               0, 0, nullptr) != CE_None)
+            return false;
+    }
+    return true;
 }
 
 }  // namespace viewshed
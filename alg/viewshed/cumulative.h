@@ -7,6 +7,7 @@
 #ifndef VIEWSHED_CUMULATIVE_H_INCLUDED
 #define VIEWSHED_CUMULATIVE_H_INCLUDED
 
+#include <array>
 #include <atomic>
 #include <vector>
 
@@ -36,28 +37,26 @@ class Cumulative
                      void *pProgressArg = nullptr);
 
   private:
-    friend class Combiner;  // Provides access to the queue types.
-
     struct Location
     {
         int x;
         int y;
+        Window extent;  //!< Extent of the viewshed of the observer
     };
 
-    using Buf32 = std::vector<uint32_t>;
+    using Buf32 = std::vector<std::atomic<uint32_t>>;
     using ObserverQueue = NotifyQueue<Location>;
-    using DatasetQueue = NotifyQueue<DatasetPtr>;
 
     Window m_extent{};
     Options m_opts;
     ObserverQueue m_observerQueue{};
-    DatasetQueue m_datasetQueue{};
-    DatasetQueue m_rollupQueue{};
+    std::vector<GByte> m_demBuf{};
+    GDALDataType m_demType{GDT_Unknown};
+    std::array<double, 6> m_adfTransform{0, 1, 0, 0, 0, 1};
     Buf32 m_finalBuf{};
 
-    void runExecutor(const std::string &srcFilename, Progress &progress,
-                     std::atomic<bool> &err, std::atomic<int> &running);
-    void rollupRasters();
+    void runExecutor(Progress &progress, std::atomic<bool> &err);
+    void accumulate(const Window &extent, const uint8_t *srcP);
     void scaleOutput();
     bool writeOutput(DatasetPtr pDstDS);
 
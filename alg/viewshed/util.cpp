@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 
 #include "gdal_priv.h"
 #include "util.h"
@@ -84,5 +86,53 @@ DatasetPtr createOutputDataset(GDALRasterBand &srcBand, const Options &opts,
     return dataset;
 }
 
+/// Restrict an extent to the cells within the maximum distance of an
+/// observer.
+///
+/// @param  nX  X position of the observer, in raster space.
+/// @param  nY  Y position of the observer, in raster space.
+/// @param  extent  Extent to restrict.
+/// @param  maxDistance  Maximum distance. No restriction if not positive.
+/// @param  adfInvTransform  Inverse geotransform of the source raster.
+/// @return  The restricted extent, empty if it doesn't intersect the
+///   input extent.
+Window calcMaxDistanceExtent(int nX, int nY, const Window &extent,
+                             double maxDistance,
+                             const std::array<double, 6> &adfInvTransform)
+{
+    if (maxDistance <= 0)
+        return extent;
+
+    constexpr double EPSILON = 1e-8;
+
+    //ABELL - This assumes that the transformation is only a scaling. Should be fixed.
+    //  Find the distance in the direction of the transformed unit vector in the X and Y
+    //  directions and use those factors to determine the limiting values in the raster space.
+    int nXStart = static_cast<int>(
+        std::floor(nX - adfInvTransform[1] * maxDistance + EPSILON));
+    int nXStop = static_cast<int>(
+        std::ceil(nX + adfInvTransform[1] * maxDistance - EPSILON) + 1);
+    int nYStart =
+        static_cast<int>(std::floor(
+            nY - std::fabs(adfInvTransform[5]) * maxDistance + EPSILON)) -
+        (adfInvTransform[5] > 0 ? 1 : 0);
+    int nYStop = static_cast<int>(
+        std::ceil(nY + std::fabs(adfInvTransform[5]) * maxDistance -
+                  EPSILON) +
+        (adfInvTransform[5] < 0 ? 1 : 0));
+
+    // If the limits are invalid, return an empty window.
+    Window out;
+    if (nXStart >= extent.xStop || nXStop < 0 || nYStart >= extent.yStop ||
+        nYStop < 0)
+        return out;
+
+    out.xStart = std::max(nXStart, extent.xStart);
+    out.xStop = std::min(nXStop, extent.xStop);
+    out.yStart = std::max(nYStart, extent.yStart);
+    out.yStop = std::min(nYStop, extent.yStop);
+    return out;
+}
+
 }  // namespace viewshed
 }  // namespace gdal
@@ -239,42 +239,8 @@ bool Viewshed::calcExtents(int nX, int nY,
         CPLError(CE_Warning, CPLE_AppDefined,
                  "NOTE: The observer location falls outside of the DEM area");
 
-    constexpr double EPSILON = 1e-8;
-    if (oOpts.maxDistance > 0)
-    {
-        //ABELL - This assumes that the transformation is only a scaling. Should be fixed.
-        //  Find the distance in the direction of the transformed unit vector in the X and Y
-        //  directions and use those factors to determine the limiting values in the raster space.
-        int nXStart = static_cast<int>(
-            std::floor(nX - adfInvTransform[1] * oOpts.maxDistance + EPSILON));
-        int nXStop = static_cast<int>(
-            std::ceil(nX + adfInvTransform[1] * oOpts.maxDistance - EPSILON) +
-            1);
-        int nYStart =
-            static_cast<int>(std::floor(
-                nY - std::fabs(adfInvTransform[5]) * oOpts.maxDistance +
-                EPSILON)) -
-            (adfInvTransform[5] > 0 ? 1 : 0);
-        int nYStop = static_cast<int>(
-            std::ceil(nY + std::fabs(adfInvTransform[5]) * oOpts.maxDistance -
-                      EPSILON) +
-            (adfInvTransform[5] < 0 ? 1 : 0));
-
-        // If the limits are invalid, set the window size to zero to trigger the error below.
-        if (nXStart >= oOutExtent.xStop || nXStop < 0 ||
-            nYStart >= oOutExtent.yStop || nYStop < 0)
-        {
-            oOutExtent = Window();
-        }
-        else
-        {
-            oOutExtent.xStart = std::max(nXStart, 0);
-            oOutExtent.xStop = std::min(nXStop, oOutExtent.xStop);
-
-            oOutExtent.yStart = std::max(nYStart, 0);
-            oOutExtent.yStop = std::min(nYStop, oOutExtent.yStop);
-        }
-    }
+    oOutExtent = calcMaxDistanceExtent(nX, nY, oOutExtent, oOpts.maxDistance,
+                                       adfInvTransform);
 
     if (oOutExtent.xSize() == 0 || oOutExtent.ySize() == 0)
     {
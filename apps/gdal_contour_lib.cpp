@@ -53,6 +53,7 @@ struct GDALContourOptions
     std::string osDestDataSource{};
     std::string osSrcDataSource{};
     GIntBig nGroupTransactions = 100 * 1000;
+    std::string osNumThreads{};
     GDALProgressFunc pfnProgress = GDALDummyProgress;
     void *pProgressData = nullptr;
 };
@@ -425,6 +426,12 @@ CPLErr GDALContourProcessOptions(GDALContourOptions *psOptions,
                                                "COMMIT_INTERVAL=" CPL_FRMT_GIB,
                                                psOptions->nGroupTransactions);
     }
+    if (!psOptions->osNumThreads.empty())
+    {
+        *ppapszStringOptions = CSLAppendPrintf(
+            *ppapszStringOptions, "NUM_THREADS=%s",
+            psOptions->osNumThreads.c_str());
+    }
 
     return CE_None;
 }
@@ -547,6 +554,11 @@ GDALContourAppOptionsGetParser(GDALContourOptions *psOptions,
             })
         .help(_("Group <n> features per transaction."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to generate contour lines."));
+
     // Written that way so that in library mode, users can still use the -q
     // switch, even if it has no effect
     argParser->add_quiet_argument(
@@ -20,7 +20,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 #include "commonutils.h"
@@ -29,9 +31,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_mem.h"
@@ -108,6 +112,9 @@ struct GDALFootprintOptions
     bool bAbsolutePath = false;
 
     std::string osSrcNoData{};
+
+    /*! Number of threads (or ALL_CPUS). Empty means GDAL_NUM_THREADS */
+    std::string osNumThreads{};
 };
 
 static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
@@ -153,6 +160,11 @@ static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
             .help(_("Set nodata value(s) for input bands."));
     }
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to compute the footprint."));
+
     argParser->add_argument("-t_cs")
         .choices("pixel", "georef")
         .default_value("georef")
@@ -799,59 +811,36 @@ static double GetMinDistanceBetweenTwoPoints(const OGRGeometry *poGeom)
 }
 
 /************************************************************************/
-/*                       GDALFootprintProcess()                         */
+/*                         GDALFootprintMask                            */
 /************************************************************************/
 
-static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
-                                 const GDALFootprintOptions *psOptions)
+namespace
 {
-    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
-    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
-    if (!psOptions->oOutputSRS.IsEmpty())
-        poDstSRS = &(psOptions->oOutputSRS);
-    if (poDstSRS)
-    {
-        auto poSrcSRS = poSrcDS->GetSpatialRef();
-        if (!poSrcSRS)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Output layer has CRS, but input is not georeferenced");
-            return false;
-        }
-        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
-        if (!poCT_SRS)
-            return false;
-    }
+struct GDALFootprintMask
+{
+    /*! Temporary nodata mask bands, referenced by poMaskBand */
+    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands{};
 
-    std::vector<int> anBands = psOptions->anBands;
-    const int nBandCount = poSrcDS->GetRasterCount();
-    if (anBands.empty())
-    {
-        for (int i = 1; i <= nBandCount; ++i)
-            anBands.push_back(i);
-    }
+    /*! Mask band to vectorize. nullptr in case of error */
+    std::unique_ptr<GDALRasterBand> poMaskBand{};
+};
+}  // namespace
+
+/************************************************************************/
+/*                       GDALFootprintGetMask()                         */
+/************************************************************************/
 
+/** Return the (combined) mask band of the selected bands of poSrcDS */
+static GDALFootprintMask
+GDALFootprintGetMask(GDALDataset *poSrcDS, const std::vector<int> &anBands,
+                     const std::vector<double> &adfSrcNoData,
+                     const GDALFootprintOptions *psOptions)
+{
+    GDALFootprintMask oRet;
+    auto &apoTmpNoDataMaskBands = oRet.apoTmpNoDataMaskBands;
+    const int nBandCount = poSrcDS->GetRasterCount();
     std::vector<GDALRasterBand *> apoSrcMaskBands;
-    const CPLStringList aosSrcNoData(
-        CSLTokenizeString2(psOptions->osSrcNoData.c_str(), " ", 0));
-    std::vector<double> adfSrcNoData;
-    if (!psOptions->osSrcNoData.empty())
-    {
-        if (aosSrcNoData.size() != 1 &&
-            static_cast<size_t>(aosSrcNoData.size()) != anBands.size())
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Number of values in -srcnodata should be 1 or the number "
-                     "of bands");
-            return false;
-        }
-        for (int i = 0; i < aosSrcNoData.size(); ++i)
-        {
-            adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
-        }
-    }
     bool bGlobalMask = true;
-    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
     for (size_t i = 0; i < anBands.size(); ++i)
     {
         const int nBand = anBands[i];
@@ -859,7 +848,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Invalid band number: %d",
                      nBand);
-            return false;
+            return {};
         }
         auto poBand = poSrcDS->GetRasterBand(nBand);
         if (!adfSrcNoData.empty())
@@ -915,13 +904,13 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                                 psOptions->nOvrIndex,
                                 poBand->GetOverviewCount() - 1);
                         }
-                        return false;
+                        return {};
                     }
                     if (poOvrBand->GetMaskFlags() != GMF_NODATA)
                     {
                         CPLError(CE_Failure, CPLE_AppDefined,
                                  "poOvrBand->GetMaskFlags() != GMF_NODATA");
-                        return false;
+                        return {};
                     }
                     poMaskBand = poOvrBand->GetMaskBand();
                 }
@@ -948,7 +937,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                                 psOptions->nOvrIndex,
                                 poBand->GetMaskBand()->GetOverviewCount() - 1);
                         }
-                        return false;
+                        return {};
                     }
                 }
             }
@@ -956,12 +945,303 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         }
     }
 
+    if (bGlobalMask || anBands.size() == 1)
+    {
+        oRet.poMaskBand =
+            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
+    }
+    else
+    {
+        oRet.poMaskBand = std::make_unique<GDALFootprintCombinedMaskBand>(
+            apoSrcMaskBands, psOptions->bCombineBandsUnion);
+    }
+    return oRet;
+}
+
+/************************************************************************/
+/*                      GDALFootprintWindowBand                         */
+/************************************************************************/
+
+/** Horizontal strip of a mask band. Reads of the source band are serialized
+ * through a mutex if it is not thread-safe. */
+class GDALFootprintWindowBand final : public GDALRasterBand
+{
+    GDALRasterBand *m_poSrcBand = nullptr;
+    const int m_nYOff;
+    std::mutex *m_poIOMutex = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALFootprintWindowBand)
+
+  public:
+    GDALFootprintWindowBand(GDALRasterBand *poSrcBand, int nYOff, int nYSize,
+                            std::mutex *poIOMutex)
+        : m_poSrcBand(poSrcBand), m_nYOff(nYOff), m_poIOMutex(poIOMutex)
+    {
+        nRasterXSize = m_poSrcBand->GetXSize();
+        nRasterYSize = nYSize;
+        eDataType = GDT_Byte;
+        nBlockXSize = nRasterXSize;
+        nBlockYSize = 1;
+    }
+
+  protected:
+    CPLErr IReadBlock(int, int nBlockYOff, void *pData) override
+    {
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        return IRasterIO(GF_Read, 0, nBlockYOff, nRasterXSize, 1, pData,
+                         nRasterXSize, 1, GDT_Byte, 1, nRasterXSize,
+                         &sExtraArg);
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override
+    {
+        if (eRWFlag != GF_Read)
+            return CE_Failure;
+        std::unique_lock<std::mutex> oLock;
+        if (m_poIOMutex)
+            oLock = std::unique_lock<std::mutex>(*m_poIOMutex);
+        return m_poSrcBand->RasterIO(GF_Read, nXOff, nYOff + m_nYOff, nXSize,
+                                     nYSize, pData, nBufXSize, nBufYSize,
+                                     eBufType, nPixelSpace, nLineSpace,
+                                     psExtraArg);
+    }
+};
+
+/************************************************************************/
+/*                  GDALFootprintPolygonizeByStrips()                   */
+/************************************************************************/
+
+/** Vectorize poMaskBand by horizontal strips in worker threads, and union
+ * the polygons of the strips. poMemLayer receives one feature per polygon,
+ * in pixel coordinates of poMaskBand.
+ */
+static bool GDALFootprintPolygonizeByStrips(
+    GDALDataset *poSrcDS, const std::vector<int> &anBands,
+    const std::vector<double> &adfSrcNoData,
+    const GDALFootprintOptions *psOptions, GDALRasterBand *poMaskBand,
+    int nLinesPerStrip, CPLWorkerThreadPool *poThreadPool,
+    OGRMemLayer *poMemLayer)
+{
+    // Use per-thread instances of the source dataset when possible, so that
+    // reading (and decompressing) the mask runs in parallel. Otherwise
+    // only the vectorization does.
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poTSDS.reset(GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER));
+    }
+    std::mutex oIOMutex;
+
+    struct Strip
+    {
+        int nYOff = 0;
+        int nYSize = 0;
+        std::unique_ptr<OGRGeometry> poGeom{};
+    };
+
+    const int nYSize = poMaskBand->GetYSize();
+    std::vector<Strip> aoStrips;
+    for (int nYOff = 0; nYOff < nYSize; nYOff += nLinesPerStrip)
+    {
+        Strip oStrip;
+        oStrip.nYOff = nYOff;
+        oStrip.nYSize = std::min(nLinesPerStrip, nYSize - nYOff);
+        aoStrips.push_back(std::move(oStrip));
+    }
+
+    std::atomic<bool> bError{false};
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nLinesDone{0};
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (auto &oStrip : aoStrips)
+    {
+        Strip *poStrip = &oStrip;
+        poJobQueue->SubmitJob(
+            [&, poStrip]()
+            {
+                if (bError || bStop)
+                    return;
+
+                GDALFootprintMask oMask;
+                GDALRasterBand *poStripSrcBand = poMaskBand;
+                if (poTSDS)
+                {
+                    oMask = GDALFootprintGetMask(poTSDS.get(), anBands,
+                                                 adfSrcNoData, psOptions);
+                    if (!oMask.poMaskBand)
+                    {
+                        bError = true;
+                        return;
+                    }
+                    poStripSrcBand = oMask.poMaskBand.get();
+                }
+
+                GDALFootprintWindowBand oWindowBand(
+                    poStripSrcBand, poStrip->nYOff, poStrip->nYSize,
+                    poTSDS ? nullptr : &oIOMutex);
+                auto hBand = GDALRasterBand::ToHandle(&oWindowBand);
+                OGRMemLayer oLayer("", nullptr, wkbUnknown);
+                if (GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(&oLayer),
+                                   /* iPixValField = */ -1,
+                                   /* papszOptions = */ nullptr, nullptr,
+                                   nullptr) != CE_None)
+                {
+                    bError = true;
+                    return;
+                }
+
+                auto poMP = std::make_unique<OGRMultiPolygon>();
+                for (auto &&poFeature : oLayer)
+                {
+                    auto poGeom = std::unique_ptr<OGRGeometry>(
+                        poFeature->StealGeometry());
+                    if (poGeom && poGeom->getGeometryType() == wkbPolygon)
+                        poMP->addGeometry(std::move(poGeom));
+                }
+                const std::array<double, 6> adfGT{
+                    {0.0, 1.0, 0.0, double(poStrip->nYOff), 0.0, 1.0}};
+                GeoTransformCoordinateTransformation oCT(adfGT);
+                if (poMP->transform(&oCT) != OGRERR_NONE)
+                {
+                    bError = true;
+                    return;
+                }
+                poStrip->poGeom = std::move(poMP);
+                nLinesDone += poStrip->nYSize;
+            });
+    }
+    while (poJobQueue->WaitEvent())
+    {
+        if (!bStop && !bError &&
+            !psOptions->pfnProgress(nLinesDone / static_cast<double>(nYSize),
+                                    "", psOptions->pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            bStop = true;
+        }
+    }
+    poJobQueue->WaitCompletion();
+    if (bError || bStop)
+        return false;
+
+    // Cascaded union: merge adjacent strips two by two, in parallel.
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+    for (auto &oStrip : aoStrips)
+        apoGeoms.push_back(std::move(oStrip.poGeom));
+    while (apoGeoms.size() > 1)
+    {
+        std::vector<std::unique_ptr<OGRGeometry>> apoMerged(
+            (apoGeoms.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < apoGeoms.size(); i += 2)
+        {
+            poJobQueue->SubmitJob(
+                [&apoGeoms, &apoMerged, &bError, i]()
+                {
+                    apoMerged[i / 2].reset(
+                        apoGeoms[i]->Union(apoGeoms[i + 1].get()));
+                    if (!apoMerged[i / 2])
+                        bError = true;
+                });
+        }
+        if ((apoGeoms.size() % 2) == 1)
+            apoMerged.back() = std::move(apoGeoms.back());
+        poJobQueue->WaitCompletion();
+        if (bError)
+            return false;
+        apoGeoms = std::move(apoMerged);
+    }
+
+    const auto AddPolygon = [poMemLayer](const OGRGeometry *poPoly)
+    {
+        auto poFeature =
+            std::make_unique<OGRFeature>(poMemLayer->GetLayerDefn());
+        poFeature->SetGeometry(poPoly);
+        CPL_IGNORE_RET_VAL(poMemLayer->CreateFeature(poFeature.get()));
+    };
+    const auto &poGeom = apoGeoms[0];
+    const auto eType = wkbFlatten(poGeom->getGeometryType());
+    if (eType == wkbPolygon)
+    {
+        AddPolygon(poGeom.get());
+    }
+    else if (eType == wkbMultiPolygon)
+    {
+        for (const auto *poPoly : poGeom->toMultiPolygon())
+            AddPolygon(poPoly);
+    }
+
+    return psOptions->pfnProgress(1.0, "", psOptions->pProgressData) != 0;
+}
+
+/************************************************************************/
+/*                       GDALFootprintProcess()                         */
+/************************************************************************/
+
+static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
+                                 const GDALFootprintOptions *psOptions)
+{
+    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
+    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
+    if (!psOptions->oOutputSRS.IsEmpty())
+        poDstSRS = &(psOptions->oOutputSRS);
+    if (poDstSRS)
+    {
+        auto poSrcSRS = poSrcDS->GetSpatialRef();
+        if (!poSrcSRS)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Output layer has CRS, but input is not georeferenced");
+            return false;
+        }
+        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
+        if (!poCT_SRS)
+            return false;
+    }
+
+    std::vector<int> anBands = psOptions->anBands;
+    const int nBandCount = poSrcDS->GetRasterCount();
+    if (anBands.empty())
+    {
+        for (int i = 1; i <= nBandCount; ++i)
+            anBands.push_back(i);
+    }
+
+    const CPLStringList aosSrcNoData(
+        CSLTokenizeString2(psOptions->osSrcNoData.c_str(), " ", 0));
+    std::vector<double> adfSrcNoData;
+    if (!psOptions->osSrcNoData.empty())
+    {
+        if (aosSrcNoData.size() != 1 &&
+            static_cast<size_t>(aosSrcNoData.size()) != anBands.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Number of values in -srcnodata should be 1 or the number "
+                     "of bands");
+            return false;
+        }
+        for (int i = 0; i < aosSrcNoData.size(); ++i)
+        {
+            adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
+        }
+    }
+    auto oMask = GDALFootprintGetMask(poSrcDS, anBands, adfSrcNoData,
+                                      psOptions);
+    if (!oMask.poMaskBand)
+        return false;
+    GDALRasterBand *poMaskForRasterize = oMask.poMaskBand.get();
+
     std::unique_ptr<OGRCoordinateTransformation> poCT_GT;
     std::array<double, 6> adfGeoTransform{{0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
     if (psOptions->bOutCSGeoref &&
         poSrcDS->GetGeoTransform(adfGeoTransform.data()) == CE_None)
     {
-        auto poMaskBand = apoSrcMaskBands[0];
+        auto poMaskBand = poMaskForRasterize;
         adfGeoTransform[1] *=
             double(poSrcDS->GetRasterXSize()) / poMaskBand->GetXSize();
         adfGeoTransform[2] *=
@@ -984,7 +1264,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
     {
         // Transform from overview pixel coordinates to full resolution
         // pixel coordinates
-        auto poMaskBand = apoSrcMaskBands[0];
+        auto poMaskBand = poMaskForRasterize;
         adfGeoTransform[1] =
             double(poSrcDS->GetRasterXSize()) / poMaskBand->GetXSize();
         adfGeoTransform[2] = 0;
@@ -995,28 +1275,53 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             adfGeoTransform);
     }
 
-    std::unique_ptr<GDALRasterBand> poMaskForRasterize;
-    if (bGlobalMask || anBands.size() == 1)
+    // Split the mask in strips of whole blocks, with a few strips per
+    // thread so that they are evenly distributed.
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    const int nThreads =
+        EQUAL(pszNumThreads, "ALL_CPUS")
+            ? CPLGetNumCPUs()
+            : std::clamp(atoi(pszNumThreads), 1, 1024);
+    const int nYSize = poMaskForRasterize->GetYSize();
+    int nBlockYSize = 1;
+    int nBlockXSizeUnused = 1;
+    poMaskForRasterize->GetBlockSize(&nBlockXSizeUnused, &nBlockYSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    constexpr int MIN_LINES_PER_STRIP = 256;
+    int nLinesPerStrip =
+        std::max(MIN_LINES_PER_STRIP, DIV_ROUND_UP(nYSize, 4 * nThreads));
+    nLinesPerStrip = DIV_ROUND_UP(nLinesPerStrip, nBlockYSize) * nBlockYSize;
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && nLinesPerStrip < nYSize &&
+                OGRGeometryFactory::haveGEOS()
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+
+    auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
+    if (poThreadPool)
     {
-        poMaskForRasterize =
-            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
+        if (!GDALFootprintPolygonizeByStrips(
+                poSrcDS, anBands, adfSrcNoData, psOptions, poMaskForRasterize,
+                nLinesPerStrip, poThreadPool, poMemLayer.get()))
+        {
+            return false;
+        }
     }
     else
     {
-        poMaskForRasterize = std::make_unique<GDALFootprintCombinedMaskBand>(
-            apoSrcMaskBands, psOptions->bCombineBandsUnion);
-    }
-
-    auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
-    auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
-    const CPLErr eErr =
-        GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
-                       /* iPixValField = */ -1,
-                       /* papszOptions = */ nullptr, psOptions->pfnProgress,
-                       psOptions->pProgressData);
-    if (eErr != CE_None)
-    {
-        return false;
+        auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize);
+        const CPLErr eErr =
+            GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
+                           /* iPixValField = */ -1,
+                           /* papszOptions = */ nullptr, psOptions->pfnProgress,
+                           psOptions->pProgressData);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
     }
 
     if (!psOptions->bSplitPolys)
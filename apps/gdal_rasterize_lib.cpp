@@ -290,6 +290,15 @@ GDALRasterizeOptionsGetParser(GDALRasterizeOptions *psOptions,
             })
         .help(_("Force the algorithm used."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s) {
+                psOptions->aosRasterizeOptions.SetNameValue("NUM_THREADS",
+                                                            s.c_str());
+            })
+        .help(_("Number of threads used to burn geometries."));
+
     argParser->add_creation_options_argument(psOptions->aosCreationOptions)
         .action([psOptions](const std::string &)
                 { psOptions->bCreateOutput = true; });
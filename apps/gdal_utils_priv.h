@@ -19,6 +19,9 @@
 #include "cpl_string.h"
 #include "gdal_utils.h"
 
+#include <string>
+#include <vector>
+
 /* This file is only meant at being used by the XXXX_bin.cpp and XXXX_lib.cpp */
 
 CPL_C_START
@@ -36,6 +39,12 @@ struct GDALInfoOptionsForBinary
 
     /* Allowed input drivers. */
     CPLStringList aosAllowedInputDrivers{};
+
+    /* All filenames to open, when several are specified. */
+    std::vector<std::string> aosFilenames{};
+
+    /* Value of -num_threads. */
+    std::string osNumThreads{};
 };
 
 struct GDALDEMProcessingOptionsForBinary
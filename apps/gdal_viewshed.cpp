@@ -221,7 +221,7 @@ void validateArgs(Options &localOpts, const GDALArgumentParser &argParser)
 
     if (opts.outputMode == viewshed::OutputMode::Cumulative)
     {
-        for (const char *opt : {"-ox", "-oy", "-vv", "-iv", "-md"})
+        for (const char *opt : {"-ox", "-oy", "-vv", "-iv"})
             if (argParser.is_used(opt))
             {
                 std::string err = "Option " + std::string(opt) +
@@ -24,6 +24,7 @@
 #include "gdalalg_raster_reproject.h"
 #include "gdalalg_raster_resize.h"
 #include "gdalalg_raster_stack.h"
+#include "gdalalg_raster_tile.h"
 
 /************************************************************************/
 /*                         GDALRasterAlgorithm                          */
@@ -55,6 +56,7 @@ class GDALRasterAlgorithm final : public GDALAlgorithm
         RegisterSubAlgorithm<GDALRasterResizeAlgorithmStandalone>();
         RegisterSubAlgorithm<GDALRasterContourAlgorithm>();
         RegisterSubAlgorithm<GDALRasterStackAlgorithm>();
+        RegisterSubAlgorithm<GDALRasterTileAlgorithm>();
     }
 
   private:
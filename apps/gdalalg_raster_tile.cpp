@@ -0,0 +1,1352 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  gdal "raster tile" subcommand
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdalalg_raster_tile.h"
+
+#include "cpl_conv.h"
+#include "cpl_error_internal.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdal_utils.h"
+#include "gdalwarper.h"
+#include "ogr_spatialref.h"
+#include "tilematrixset.hpp"
+#include "vrtdataset.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <set>
+#include <thread>
+
+//! @cond Doxygen_Suppress
+
+#ifndef _
+#define _(x) (x)
+#endif
+
+namespace
+{
+
+/************************************************************************/
+/*                         GetWarpResampleAlg()                         */
+/************************************************************************/
+
+GDALResampleAlg GetWarpResampleAlg(const std::string &osResampling)
+{
+    static const struct
+    {
+        const char *pszName;
+        GDALResampleAlg eAlg;
+    } asMethods[] = {
+        {"nearest", GRA_NearestNeighbour},
+        {"bilinear", GRA_Bilinear},
+        {"cubic", GRA_Cubic},
+        {"cubicspline", GRA_CubicSpline},
+        {"lanczos", GRA_Lanczos},
+        {"average", GRA_Average},
+        {"rms", GRA_RMS},
+        {"mode", GRA_Mode},
+        {"min", GRA_Min},
+        {"max", GRA_Max},
+        {"med", GRA_Med},
+        {"q1", GRA_Q1},
+        {"q3", GRA_Q3},
+        {"sum", GRA_Sum},
+    };
+    for (const auto &sMethod : asMethods)
+    {
+        if (EQUAL(osResampling.c_str(), sMethod.pszName))
+            return sMethod.eAlg;
+    }
+    return GRA_NearestNeighbour;
+}
+
+/************************************************************************/
+/*                        IsRasterIOResampling()                        */
+/************************************************************************/
+
+/** Whether the resampling method is supported by GDALDataset::RasterIO() */
+bool IsRasterIOResampling(const std::string &osResampling)
+{
+    for (const char *pszName : {"nearest", "bilinear", "cubic", "cubicspline",
+                                "lanczos", "average", "rms", "mode"})
+    {
+        if (EQUAL(osResampling.c_str(), pszName))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                              TileRange                               */
+/************************************************************************/
+
+struct TileRange
+{
+    int nMinX = 0;
+    int nMinY = 0;
+    int nMaxX = -1;  // included
+    int nMaxY = -1;  // included
+
+    uint64_t GetCount() const
+    {
+        return static_cast<uint64_t>(nMaxX - nMinX + 1) *
+               static_cast<uint64_t>(nMaxY - nMinY + 1);
+    }
+};
+
+/************************************************************************/
+/*                             WarpContext                              */
+/************************************************************************/
+
+/** Per-thread state needed to warp source pixels to the tiles of the
+ * maximum zoom level. */
+struct WarpContext
+{
+    std::unique_ptr<GDALDataset> poSrcDSOwned{};
+    std::unique_ptr<GDALDataset> poDstSkeletonDS{};
+    void *hTransformArg = nullptr;
+    std::unique_ptr<GDALWarpOperation> poWarper{};
+
+    WarpContext() = default;
+
+    ~WarpContext()
+    {
+        poWarper.reset();
+        if (hTransformArg)
+            GDALDestroyGenImgProjTransformer(hTransformArg);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(WarpContext)
+};
+
+/************************************************************************/
+/*                           GDALRasterTiler                            */
+/************************************************************************/
+
+/** Generates the tiles of a pyramid, given its characteristics computed by
+ * GDALRasterTileAlgorithm::RunImpl().
+ *
+ * The maximum zoom level is processed per metatile, that is a group of
+ * (typically 8x8) tiles: source pixels are warped once for the whole
+ * metatile, which is then split into tiles. Lower zoom levels are generated
+ * from the 4 child tiles of the zoom level just below, once it is complete.
+ * Each metatile is processed as a job of the global thread pool, with a
+ * per-thread handle on the source dataset.
+ */
+class GDALRasterTiler
+{
+  public:
+    // Source
+    GDALDataset *m_poSrcDS = nullptr;
+    // Name under which the source dataset can be reopened by worker threads.
+    // Empty in single-threaded mode.
+    std::string m_osSrcName{};
+    CPLStringList m_aosSrcAllowedDrivers{};
+    CPLStringList m_aosSrcOpenOptions{};
+    std::vector<int> m_anSrcBands{};
+    int m_nSrcAlphaBand = 0;
+    std::vector<double> m_adfSrcNoData{};
+
+    // Warping of the maximum zoom level
+    std::string m_osDstSRSWKT{};
+    double m_adfDstGeoTransform[6] = {0, 0, 0, 0, 0, 0};
+    int m_nDstXSize = 0;
+    int m_nDstYSize = 0;
+    GDALResampleAlg m_eWarpResampleAlg = GRA_NearestNeighbour;
+    GDALRIOResampleAlg m_eOvrResampleAlg = GRIORA_NearestNeighbour;
+
+    // Tiles
+    int m_nTileWidth = 0;
+    int m_nTileHeight = 0;
+    int m_nMinZoom = 0;
+    int m_nMaxZoom = 0;
+    std::vector<TileRange> m_aoRanges{};  // indexed by zoom level
+    std::vector<int> m_anMatrixHeight{};  // indexed by zoom level
+    int m_nMetatileSize = 8;
+    bool m_bTMS = false;
+
+    // Output
+    std::string m_osOutputDirectory{};
+    GDALDriver *m_poDriver = nullptr;
+    GDALDriver *m_poMEMDriver = nullptr;
+    std::string m_osExtension{};
+    CPLStringList m_aosCreationOptions{};
+    bool m_bWriteAlpha = true;
+
+    GDALRasterTiler() = default;
+
+    bool Run(int nThreads, GDALProgressFunc pfnProgress, void *pProgressData);
+
+  private:
+    std::unique_ptr<CPLJobQueue> m_poQueue{};
+    CPLErrorAccumulator m_oErrors{};
+    std::atomic<bool> m_bStop{false};
+    std::atomic<bool> m_bFailed{false};
+    GDALProgressFunc m_pfnProgress = nullptr;
+    void *m_pProgressData = nullptr;
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    int m_nPendingJobs = 0;
+    uint64_t m_nTilesDone = 0;
+    uint64_t m_nTotalTiles = 0;
+    std::map<std::thread::id, std::unique_ptr<WarpContext>> m_oMapContexts{};
+    std::set<std::string> m_oSetCreatedDirs{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterTiler)
+
+    int GetColorBandCount() const
+    {
+        return static_cast<int>(m_anSrcBands.size());
+    }
+
+    size_t GetTileBufferSize() const
+    {
+        return static_cast<size_t>(GetColorBandCount() + 1) * m_nTileWidth *
+               m_nTileHeight;
+    }
+
+    std::unique_ptr<WarpContext> CreateWarpContext();
+    WarpContext *GetWarpContext();
+    bool EnsureDirectory(const std::string &osDir);
+    std::string GetTileFilename(int nZoom, int nX, int nY) const;
+    bool WriteTile(int nZoom, int nX, int nY,
+                   const std::vector<GByte> &abyTile);
+    int ReadTile(int nZoom, int nX, int nY, std::vector<GByte> &abyTile);
+    bool ProcessMaxZoomMetatile(const TileRange &oMetatile);
+    bool ProcessOverviewMetatile(int nZoom, const TileRange &oMetatile);
+    void SubmitJob(uint64_t nTiles, std::function<bool()> fn);
+    bool ReportProgress();
+    bool WaitJobs();
+};
+
+/************************************************************************/
+/*                 GDALRasterTiler::CreateWarpContext()                 */
+/************************************************************************/
+
+std::unique_ptr<WarpContext> GDALRasterTiler::CreateWarpContext()
+{
+    auto poCtxt = std::make_unique<WarpContext>();
+    GDALDataset *poSrcDS = m_poSrcDS;
+    if (!m_osSrcName.empty())
+    {
+        poCtxt->poSrcDSOwned.reset(GDALDataset::Open(
+            m_osSrcName.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+            m_aosSrcAllowedDrivers.List(), m_aosSrcOpenOptions.List(),
+            nullptr));
+        if (!poCtxt->poSrcDSOwned)
+            return nullptr;
+        poSrcDS = poCtxt->poSrcDSOwned.get();
+    }
+
+    CPLStringList aosTO;
+    aosTO.SetNameValue("DST_SRS", m_osDstSRSWKT.c_str());
+    poCtxt->hTransformArg = GDALCreateGenImgProjTransformer2(
+        GDALDataset::ToHandle(poSrcDS), nullptr, aosTO.List());
+    if (!poCtxt->hTransformArg)
+        return nullptr;
+    GDALSetGenImgProjTransformerDstGeoTransform(poCtxt->hTransformArg,
+                                                m_adfDstGeoTransform);
+
+    // The warper only needs the destination dataset to check the band
+    // numbers: pixels are directly warped into our buffers.
+    const int nColorBands = GetColorBandCount();
+    auto poSkeletonDS = std::make_unique<VRTDataset>(m_nDstXSize, m_nDstYSize);
+    for (int i = 0; i < nColorBands + 1; ++i)
+        poSkeletonDS->AddBand(GDT_Byte, nullptr);
+    poCtxt->poDstSkeletonDS = std::move(poSkeletonDS);
+
+    GDALWarpOptions *psWO = GDALCreateWarpOptions();
+    psWO->hSrcDS = GDALDataset::ToHandle(poSrcDS);
+    psWO->hDstDS = GDALDataset::ToHandle(poCtxt->poDstSkeletonDS.get());
+    psWO->eResampleAlg = m_eWarpResampleAlg;
+    psWO->eWorkingDataType = GDT_Byte;
+    psWO->nBandCount = nColorBands;
+    psWO->panSrcBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * nColorBands));
+    psWO->panDstBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * nColorBands));
+    for (int i = 0; i < nColorBands; ++i)
+    {
+        psWO->panSrcBands[i] = m_anSrcBands[i];
+        psWO->panDstBands[i] = i + 1;
+    }
+    psWO->nSrcAlphaBand = m_nSrcAlphaBand;
+    psWO->nDstAlphaBand = nColorBands + 1;
+    if (!m_adfSrcNoData.empty())
+    {
+        psWO->padfSrcNoDataReal =
+            static_cast<double *>(CPLMalloc(sizeof(double) * nColorBands));
+        std::copy(m_adfSrcNoData.begin(), m_adfSrcNoData.end(),
+                  psWO->padfSrcNoDataReal);
+    }
+    psWO->pfnTransformer = GDALGenImgProjTransform;
+    psWO->pTransformerArg = poCtxt->hTransformArg;
+    psWO->papszWarpOptions =
+        CSLSetNameValue(psWO->papszWarpOptions, "INIT_DEST", "0");
+    psWO->papszWarpOptions = CSLSetNameValue(
+        psWO->papszWarpOptions, "ERROR_OUT_IF_EMPTY_SOURCE_WINDOW", "FALSE");
+
+    poCtxt->poWarper = std::make_unique<GDALWarpOperation>();
+    const CPLErr eErr = poCtxt->poWarper->Initialize(psWO);
+    GDALDestroyWarpOptions(psWO);
+    if (eErr != CE_None)
+        return nullptr;
+
+    return poCtxt;
+}
+
+/************************************************************************/
+/*                  GDALRasterTiler::GetWarpContext()                   */
+/************************************************************************/
+
+WarpContext *GDALRasterTiler::GetWarpContext()
+{
+    const auto nThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard oLock(m_oMutex);
+        const auto oIter = m_oMapContexts.find(nThreadId);
+        if (oIter != m_oMapContexts.end())
+            return oIter->second.get();
+    }
+
+    auto poCtxt = CreateWarpContext();
+    if (!poCtxt)
+        return nullptr;
+    std::lock_guard oLock(m_oMutex);
+    auto &poRet = m_oMapContexts[nThreadId];
+    poRet = std::move(poCtxt);
+    return poRet.get();
+}
+
+/************************************************************************/
+/*                  GDALRasterTiler::EnsureDirectory()                  */
+/************************************************************************/
+
+bool GDALRasterTiler::EnsureDirectory(const std::string &osDir)
+{
+    std::lock_guard oLock(m_oMutex);
+    if (m_oSetCreatedDirs.find(osDir) != m_oSetCreatedDirs.end())
+        return true;
+    VSIStatBufL sStat;
+    if (VSIStatL(osDir.c_str(), &sStat) != 0 &&
+        VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                 osDir.c_str());
+        return false;
+    }
+    m_oSetCreatedDirs.insert(osDir);
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALRasterTiler::GetTileFilename()                  */
+/************************************************************************/
+
+std::string GDALRasterTiler::GetTileFilename(int nZoom, int nX, int nY) const
+{
+    if (m_bTMS)
+        nY = m_anMatrixHeight[nZoom] - 1 - nY;
+    const std::string osZoomDir = CPLFormFilenameSafe(
+        m_osOutputDirectory.c_str(), std::to_string(nZoom).c_str(), nullptr);
+    const std::string osXDir = CPLFormFilenameSafe(
+        osZoomDir.c_str(), std::to_string(nX).c_str(), nullptr);
+    return CPLFormFilenameSafe(osXDir.c_str(), std::to_string(nY).c_str(),
+                               m_osExtension.c_str());
+}
+
+/************************************************************************/
+/*                     GDALRasterTiler::WriteTile()                     */
+/************************************************************************/
+
+/** Write a tile from a band-sequential buffer of the color bands followed
+ * by the alpha band. Fully transparent tiles are not written. */
+bool GDALRasterTiler::WriteTile(int nZoom, int nX, int nY,
+                                const std::vector<GByte> &abyTile)
+{
+    const int nColorBands = GetColorBandCount();
+    const size_t nPixels = static_cast<size_t>(m_nTileWidth) * m_nTileHeight;
+    const GByte *pabyAlpha = abyTile.data() + nColorBands * nPixels;
+    if (std::all_of(pabyAlpha, pabyAlpha + nPixels,
+                    [](GByte nVal) { return nVal == 0; }))
+    {
+        return true;
+    }
+
+    const int nFileBands = m_bWriteAlpha ? nColorBands + 1 : nColorBands;
+    std::unique_ptr<GDALDataset> poMemDS(m_poMEMDriver->Create(
+        "", m_nTileWidth, m_nTileHeight, nFileBands, GDT_Byte, nullptr));
+    if (!poMemDS)
+        return false;
+    for (int i = 0; i < nFileBands; ++i)
+    {
+        GDALColorInterp eInterp = GCI_AlphaBand;
+        if (i < nColorBands)
+        {
+            eInterp = nColorBands == 1
+                          ? GCI_GrayIndex
+                          : static_cast<GDALColorInterp>(GCI_RedBand + i);
+        }
+        poMemDS->GetRasterBand(i + 1)->SetColorInterpretation(eInterp);
+    }
+    if (poMemDS->RasterIO(GF_Write, 0, 0, m_nTileWidth, m_nTileHeight,
+                          const_cast<GByte *>(abyTile.data()), m_nTileWidth,
+                          m_nTileHeight, GDT_Byte, nFileBands, nullptr, 0, 0,
+                          0, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    const std::string osFilename = GetTileFilename(nZoom, nX, nY);
+    if (!EnsureDirectory(CPLGetPathSafe(osFilename.c_str())))
+        return false;
+    std::unique_ptr<GDALDataset> poOutDS(m_poDriver->CreateCopy(
+        osFilename.c_str(), poMemDS.get(), false, m_aosCreationOptions.List(),
+        nullptr, nullptr));
+    return poOutDS && poOutDS->Close() == CE_None;
+}
+
+/************************************************************************/
+/*                      GDALRasterTiler::ReadTile()                     */
+/************************************************************************/
+
+/** Read an already written tile into a band-sequential buffer of the color
+ * bands followed by the alpha band.
+ *
+ * @return 1 in case of success, 0 if the tile does not exist, -1 on error.
+ */
+int GDALRasterTiler::ReadTile(int nZoom, int nX, int nY,
+                              std::vector<GByte> &abyTile)
+{
+    const std::string osFilename = GetTileFilename(nZoom, nX, nY);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return 0;
+
+    const char *const apszAllowedDrivers[] = {m_poDriver->GetDescription(),
+                                              nullptr};
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        osFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+        apszAllowedDrivers, nullptr, nullptr));
+    if (!poDS)
+        return -1;
+
+    const int nColorBands = GetColorBandCount();
+    const int nFileBands = m_bWriteAlpha ? nColorBands + 1 : nColorBands;
+    if (poDS->GetRasterXSize() != m_nTileWidth ||
+        poDS->GetRasterYSize() != m_nTileHeight ||
+        poDS->GetRasterCount() != nFileBands)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s has not the expected dimensions or number of bands",
+                 osFilename.c_str());
+        return -1;
+    }
+    if (poDS->RasterIO(GF_Read, 0, 0, m_nTileWidth, m_nTileHeight,
+                       abyTile.data(), m_nTileWidth, m_nTileHeight, GDT_Byte,
+                       nFileBands, nullptr, 0, 0, 0, nullptr) != CE_None)
+    {
+        return -1;
+    }
+    if (!m_bWriteAlpha)
+    {
+        const size_t nPixels =
+            static_cast<size_t>(m_nTileWidth) * m_nTileHeight;
+        std::fill_n(abyTile.data() + nColorBands * nPixels, nPixels,
+                    static_cast<GByte>(255));
+    }
+    return 1;
+}
+
+/************************************************************************/
+/*               GDALRasterTiler::ProcessMaxZoomMetatile()              */
+/************************************************************************/
+
+bool GDALRasterTiler::ProcessMaxZoomMetatile(const TileRange &oMetatile)
+{
+    WarpContext *poCtxt = GetWarpContext();
+    if (!poCtxt)
+        return false;
+
+    const TileRange &oRange = m_aoRanges[m_nMaxZoom];
+    const int nXOff = (oMetatile.nMinX - oRange.nMinX) * m_nTileWidth;
+    const int nYOff = (oMetatile.nMinY - oRange.nMinY) * m_nTileHeight;
+    const int nXSize = (oMetatile.nMaxX - oMetatile.nMinX + 1) * m_nTileWidth;
+    const int nYSize = (oMetatile.nMaxY - oMetatile.nMinY + 1) * m_nTileHeight;
+    const int nBands = GetColorBandCount() + 1;
+
+    std::vector<GByte> abyBuffer;
+    std::vector<GByte> abyTile;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nBands) * nXSize * nYSize);
+        abyTile.resize(GetTileBufferSize());
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for metatile");
+        return false;
+    }
+
+    if (poCtxt->poWarper->InitializeDestinationBuffer(abyBuffer.data(), nXSize,
+                                                      nYSize) != CE_None ||
+        poCtxt->poWarper->WarpRegionToBuffer(nXOff, nYOff, nXSize, nYSize,
+                                             abyBuffer.data(),
+                                             GDT_Byte) != CE_None)
+    {
+        return false;
+    }
+
+    for (int nY = oMetatile.nMinY; nY <= oMetatile.nMaxY; ++nY)
+    {
+        for (int nX = oMetatile.nMinX; nX <= oMetatile.nMaxX; ++nX)
+        {
+            const size_t nSrcX =
+                static_cast<size_t>(nX - oMetatile.nMinX) * m_nTileWidth;
+            const size_t nSrcY =
+                static_cast<size_t>(nY - oMetatile.nMinY) * m_nTileHeight;
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                for (int iLine = 0; iLine < m_nTileHeight; ++iLine)
+                {
+                    const size_t nSrcOffset =
+                        (static_cast<size_t>(iBand) * nYSize + nSrcY + iLine) *
+                            nXSize +
+                        nSrcX;
+                    const size_t nDstOffset =
+                        (static_cast<size_t>(iBand) * m_nTileHeight + iLine) *
+                        m_nTileWidth;
+                    memcpy(abyTile.data() + nDstOffset,
+                           abyBuffer.data() + nSrcOffset, m_nTileWidth);
+                }
+            }
+            if (!WriteTile(m_nMaxZoom, nX, nY, abyTile))
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*               GDALRasterTiler::ProcessOverviewMetatile()             */
+/************************************************************************/
+
+bool GDALRasterTiler::ProcessOverviewMetatile(int nZoom,
+                                              const TileRange &oMetatile)
+{
+    const int nBands = GetColorBandCount() + 1;
+    std::unique_ptr<GDALDataset> poMemDS(
+        m_poMEMDriver->Create("", 2 * m_nTileWidth, 2 * m_nTileHeight, nBands,
+                              GDT_Byte, nullptr));
+    if (!poMemDS)
+        return false;
+    // So that RasterIO() resampling takes into account transparency
+    poMemDS->GetRasterBand(nBands)->SetColorInterpretation(GCI_AlphaBand);
+
+    std::vector<GByte> abyChild;
+    std::vector<GByte> abyTile;
+    try
+    {
+        abyChild.resize(GetTileBufferSize());
+        abyTile.resize(GetTileBufferSize());
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for tiles");
+        return false;
+    }
+
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    sExtraArg.eResampleAlg = m_eOvrResampleAlg;
+
+    for (int nY = oMetatile.nMinY; nY <= oMetatile.nMaxY && !m_bStop; ++nY)
+    {
+        for (int nX = oMetatile.nMinX; nX <= oMetatile.nMaxX; ++nX)
+        {
+            for (int iBand = 1; iBand <= nBands; ++iBand)
+            {
+                if (poMemDS->GetRasterBand(iBand)->Fill(0) != CE_None)
+                    return false;
+            }
+
+            bool bHasChild = false;
+            for (int iChild = 0; iChild < 4; ++iChild)
+            {
+                const int iChildX = iChild % 2;
+                const int iChildY = iChild / 2;
+                const int nRet = ReadTile(nZoom + 1, 2 * nX + iChildX,
+                                          2 * nY + iChildY, abyChild);
+                if (nRet < 0)
+                    return false;
+                if (nRet == 0)
+                    continue;
+                bHasChild = true;
+                if (poMemDS->RasterIO(GF_Write, iChildX * m_nTileWidth,
+                                      iChildY * m_nTileHeight, m_nTileWidth,
+                                      m_nTileHeight, abyChild.data(),
+                                      m_nTileWidth, m_nTileHeight, GDT_Byte,
+                                      nBands, nullptr, 0, 0, 0,
+                                      nullptr) != CE_None)
+                {
+                    return false;
+                }
+            }
+            if (!bHasChild)
+                continue;
+
+            if (poMemDS->RasterIO(GF_Read, 0, 0, 2 * m_nTileWidth,
+                                  2 * m_nTileHeight, abyTile.data(),
+                                  m_nTileWidth, m_nTileHeight, GDT_Byte, nBands,
+                                  nullptr, 0, 0, 0, &sExtraArg) != CE_None ||
+                !WriteTile(nZoom, nX, nY, abyTile))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     GDALRasterTiler::SubmitJob()                     */
+/************************************************************************/
+
+/** Run fn in a worker thread, or in the current one if there is no job
+ * queue. nTiles is the number of tiles processed by fn, used for progress
+ * reporting. */
+void GDALRasterTiler::SubmitJob(uint64_t nTiles, std::function<bool()> fn)
+{
+    {
+        std::lock_guard oLock(m_oMutex);
+        ++m_nPendingJobs;
+    }
+
+    auto job = [this, nTiles, fn = std::move(fn)]()
+    {
+        bool bOK = true;
+        if (!m_bStop)
+        {
+            auto oAccumulator = m_oErrors.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            bOK = fn();
+        }
+        std::lock_guard oLock(m_oMutex);
+        if (!bOK)
+        {
+            m_bFailed = true;
+            m_bStop = true;
+        }
+        m_nTilesDone += nTiles;
+        --m_nPendingJobs;
+        m_oCV.notify_all();
+    };
+
+    if (m_poQueue)
+    {
+        m_poQueue->SubmitJob(std::move(job));
+    }
+    else
+    {
+        job();
+        ReportProgress();
+    }
+}
+
+/************************************************************************/
+/*                   GDALRasterTiler::ReportProgress()                  */
+/************************************************************************/
+
+/** Must be called from the main thread */
+bool GDALRasterTiler::ReportProgress()
+{
+    if (!m_pfnProgress || m_bStop)
+        return !m_bStop;
+    double dfRatio;
+    {
+        std::lock_guard oLock(m_oMutex);
+        dfRatio = m_nTotalTiles ? static_cast<double>(m_nTilesDone) /
+                                      static_cast<double>(m_nTotalTiles)
+                                : 1.0;
+    }
+    if (!m_pfnProgress(dfRatio, "", m_pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+        m_bFailed = true;
+        m_bStop = true;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GDALRasterTiler::WaitJobs()                     */
+/************************************************************************/
+
+/** Wait for the completion of all submitted jobs, while reporting progress.
+ */
+bool GDALRasterTiler::WaitJobs()
+{
+    while (true)
+    {
+        ReportProgress();
+        std::unique_lock oLock(m_oMutex);
+        if (m_nPendingJobs == 0)
+            break;
+        const uint64_t nTilesDone = m_nTilesDone;
+        m_oCV.wait(oLock,
+                   [this, nTilesDone] {
+                       return m_nPendingJobs == 0 ||
+                              m_nTilesDone != nTilesDone;
+                   });
+    }
+    return !m_bFailed;
+}
+
+/************************************************************************/
+/*                        GDALRasterTiler::Run()                        */
+/************************************************************************/
+
+bool GDALRasterTiler::Run(int nThreads, GDALProgressFunc pfnProgress,
+                          void *pProgressData)
+{
+    m_pfnProgress = pfnProgress;
+    m_pProgressData = pProgressData;
+    m_poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!m_poMEMDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "MEM driver not available");
+        return false;
+    }
+
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            m_poQueue = poThreadPool->CreateJobQueue();
+    }
+    if (!m_poQueue)
+        m_osSrcName.clear();
+
+    for (int nZoom = m_nMinZoom; nZoom <= m_nMaxZoom; ++nZoom)
+        m_nTotalTiles += m_aoRanges[nZoom].GetCount();
+
+    for (int nZoom = m_nMaxZoom; nZoom >= m_nMinZoom && !m_bStop; --nZoom)
+    {
+        const TileRange &oRange = m_aoRanges[nZoom];
+        for (int nY = oRange.nMinY; nY <= oRange.nMaxY && !m_bStop;
+             nY += m_nMetatileSize)
+        {
+            for (int nX = oRange.nMinX; nX <= oRange.nMaxX && !m_bStop;
+                 nX += m_nMetatileSize)
+            {
+                TileRange oMetatile;
+                oMetatile.nMinX = nX;
+                oMetatile.nMinY = nY;
+                oMetatile.nMaxX =
+                    std::min(oRange.nMaxX, nX + m_nMetatileSize - 1);
+                oMetatile.nMaxY =
+                    std::min(oRange.nMaxY, nY + m_nMetatileSize - 1);
+                if (nZoom == m_nMaxZoom)
+                {
+                    SubmitJob(oMetatile.GetCount(), [this, oMetatile]()
+                              { return ProcessMaxZoomMetatile(oMetatile); });
+                }
+                else
+                {
+                    SubmitJob(oMetatile.GetCount(),
+                              [this, nZoom, oMetatile]() {
+                                  return ProcessOverviewMetatile(nZoom,
+                                                                 oMetatile);
+                              });
+                }
+            }
+        }
+        // A zoom level must be complete before the one above is generated
+        WaitJobs();
+    }
+
+    m_poQueue.reset();
+    m_oMapContexts.clear();
+    m_oErrors.ReplayErrors();
+
+    if (!m_bFailed && m_pfnProgress)
+        m_pfnProgress(1.0, "", m_pProgressData);
+    return !m_bFailed;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*           GDALRasterTileAlgorithm::GDALRasterTileAlgorithm()         */
+/************************************************************************/
+
+GDALRasterTileAlgorithm::GDALRasterTileAlgorithm()
+    : GDALAlgorithm(NAME, DESCRIPTION, HELP_URL)
+{
+    AddProgressArg();
+    AddOutputFormatArg(&m_outputFormat)
+        .SetDefault(m_outputFormat)
+        .AddMetadataItem(GAAMDI_REQUIRED_CAPABILITIES,
+                         {GDAL_DCAP_RASTER, GDAL_DCAP_CREATECOPY});
+    AddOpenOptionsArg(&m_openOptions);
+    AddInputFormatsArg(&m_inputFormats)
+        .AddMetadataItem(GAAMDI_REQUIRED_CAPABILITIES, {GDAL_DCAP_RASTER});
+    AddInputDatasetArg(&m_inputDataset, GDAL_OF_RASTER);
+    AddArg(GDAL_ARG_NAME_OUTPUT, 'o', _("Output directory"),
+           &m_outputDirectory)
+        .SetPositional()
+        .SetRequired()
+        .SetMetaVar("<OUTPUT-DIRECTORY>");
+    AddCreationOptionsArg(&m_creationOptions);
+
+    AddArg("tiling-scheme", 0, _("Tiling scheme"), &m_tilingScheme)
+        .SetDefault(m_tilingScheme)
+        .SetAutoCompleteFunction(
+            [](const std::string &)
+            {
+                std::vector<std::string> ret;
+                for (const auto &osName :
+                     gdal::TileMatrixSet::listPredefinedTileMatrixSets())
+                {
+                    ret.push_back(osName);
+                }
+                return ret;
+            });
+    auto &minZoomArg =
+        AddArg("min-zoom", 0, _("Minimum zoom level"), &m_minZoomLevel);
+    minZoomArg.AddValidationAction(
+        [&minZoomArg]()
+        {
+            if (minZoomArg.Get<int>() < 0)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "min-zoom should be positive or zero.");
+                return false;
+            }
+            return true;
+        });
+    auto &maxZoomArg =
+        AddArg("max-zoom", 0, _("Maximum zoom level"), &m_maxZoomLevel);
+    maxZoomArg.AddValidationAction(
+        [&maxZoomArg]()
+        {
+            if (maxZoomArg.Get<int>() < 0)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "max-zoom should be positive or zero.");
+                return false;
+            }
+            return true;
+        });
+    AddArg("convention", 0,
+           _("Convention for numbering tiles along the Y axis"), &m_convention)
+        .SetChoices("xyz", "tms")
+        .SetDefault(m_convention);
+    AddArg("resampling", 'r', _("Resampling method for the maximum zoom level"),
+           &m_resampling)
+        .SetChoices("nearest", "bilinear", "cubic", "cubicspline", "lanczos",
+                    "average", "rms", "mode", "min", "max", "med", "q1", "q3",
+                    "sum")
+        .SetDefault(m_resampling)
+        .SetHiddenChoices("near");
+    AddArg("overview-resampling", 0,
+           _("Resampling method for zoom levels below the maximum one"),
+           &m_overviewResampling)
+        .SetChoices("nearest", "bilinear", "cubic", "cubicspline", "lanczos",
+                    "average", "rms", "mode")
+        .SetHiddenChoices("near");
+    auto &metatileArg =
+        AddArg("metatile-size", 0,
+               _("Number of tiles, along each axis, warped at once"),
+               &m_metatileSize)
+            .SetDefault(m_metatileSize);
+    metatileArg.AddValidationAction(
+        [&metatileArg]()
+        {
+            const int nVal = metatileArg.Get<int>();
+            if (nVal < 1 || nVal > 64)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "metatile-size should be in [1,64] range.");
+                return false;
+            }
+            return true;
+        });
+    auto &numThreadsArg =
+        AddArg("num-threads", 'j', _("Number of jobs (or ALL_CPUS)"),
+               &m_numThreads)
+            .SetDefault(m_numThreads);
+    numThreadsArg.AddValidationAction(
+        [&numThreadsArg]()
+        {
+            const auto &osVal = numThreadsArg.Get<std::string>();
+            if (!EQUAL(osVal.c_str(), "ALL_CPUS") &&
+                CPLGetValueType(osVal.c_str()) != CPL_VALUE_INTEGER)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "num-threads should be ALL_CPUS or an integer.");
+                return false;
+            }
+            return true;
+        });
+}
+
+/************************************************************************/
+/*                   GDALRasterTileAlgorithm::RunImpl()                 */
+/************************************************************************/
+
+bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
+                                      void *pProgressData)
+{
+    GDALDataset *poSrcDS = m_inputDataset.GetDatasetRef();
+    CPLAssert(poSrcDS);
+
+    GDALRasterTiler oTiler;
+
+    /* -------------------------------------------------------------------- */
+    /*      Output format.                                                  */
+    /* -------------------------------------------------------------------- */
+    oTiler.m_poDriver =
+        GetGDALDriverManager()->GetDriverByName(m_outputFormat.c_str());
+    if (!oTiler.m_poDriver)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined, "Unknown driver '%s'",
+                    m_outputFormat.c_str());
+        return false;
+    }
+    const char *pszExtensions =
+        oTiler.m_poDriver->GetMetadataItem(GDAL_DMD_EXTENSIONS);
+    const CPLStringList aosExtensions(
+        CSLTokenizeString(pszExtensions ? pszExtensions : ""));
+    if (!aosExtensions.empty())
+        oTiler.m_osExtension = aosExtensions[0];
+    if (oTiler.m_osExtension.empty())
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Driver '%s' does not declare a file extension",
+                    m_outputFormat.c_str());
+        return false;
+    }
+    oTiler.m_aosCreationOptions = CPLStringList(m_creationOptions);
+    const bool bJPEG = EQUAL(oTiler.m_poDriver->GetDescription(), "JPEG");
+    const bool bWEBP = EQUAL(oTiler.m_poDriver->GetDescription(), "WEBP");
+    oTiler.m_bWriteAlpha = !bJPEG;
+
+    /* -------------------------------------------------------------------- */
+    /*      Tiling scheme.                                                  */
+    /* -------------------------------------------------------------------- */
+    const auto poTMS = gdal::TileMatrixSet::parse(m_tilingScheme.c_str());
+    if (!poTMS || poTMS->tileMatrixList().empty())
+    {
+        ReportError(CE_Failure, CPLE_AppDefined, "Invalid tiling scheme: %s",
+                    m_tilingScheme.c_str());
+        return false;
+    }
+    if (!poTMS->haveAllLevelsSameTopLeft() ||
+        !poTMS->haveAllLevelsSameTileSize() ||
+        !poTMS->hasOnlyPowerOfTwoVaryingScales() ||
+        poTMS->hasVariableMatrixWidth())
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Unsupported tiling scheme: only the ones with all zoom "
+                    "levels sharing the same top-left corner and tile size, "
+                    "with a factor of 2 between the resolution of successive "
+                    "zoom levels, are supported.");
+        return false;
+    }
+    const auto &tmList = poTMS->tileMatrixList();
+    const int nZoomLevelCount = static_cast<int>(tmList.size());
+    oTiler.m_nTileWidth = tmList[0].mTileWidth;
+    oTiler.m_nTileHeight = tmList[0].mTileHeight;
+    for (const auto &tm : tmList)
+        oTiler.m_anMatrixHeight.push_back(tm.mMatrixHeight);
+
+    OGRSpatialReference oTargetSRS;
+    oTargetSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    if (oTargetSRS.SetFromUserInput(
+            poTMS->crs().c_str(),
+            OGRSpatialReference::SET_FROM_USER_INPUT_LIMITATIONS_get()) !=
+        OGRERR_NONE)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Cannot parse CRS of tiling scheme: %s",
+                    poTMS->crs().c_str());
+        return false;
+    }
+    oTiler.m_osDstSRSWKT = oTargetSRS.exportToWkt();
+    const bool bInvertAxis = oTargetSRS.EPSGTreatsAsLatLong() != FALSE ||
+                             oTargetSRS.EPSGTreatsAsNorthingEasting() != FALSE;
+
+    /* -------------------------------------------------------------------- */
+    /*      Source bands.                                                   */
+    /* -------------------------------------------------------------------- */
+    if (!poSrcDS->GetSpatialRef() && !poSrcDS->GetGCPSpatialRef())
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Input dataset has no coordinate reference system.");
+        return false;
+    }
+
+    std::string osSrcName = poSrcDS->GetDescription();
+    const std::string osExpandedFilename =
+        VSIMemGenerateHiddenFilename("gdalalg_raster_tile_expanded.vrt");
+    std::unique_ptr<GDALDataset> poExpandedDS;
+    if (poSrcDS->GetRasterCount() == 1 &&
+        poSrcDS->GetRasterBand(1)->GetColorTable())
+    {
+        const char *const apszOptions[] = {"-of",    "VRT", "-expand",
+                                           "rgba",   nullptr};
+        auto psOptions = GDALTranslateOptionsNew(
+            const_cast<char **>(apszOptions), nullptr);
+        poExpandedDS.reset(GDALDataset::FromHandle(
+            GDALTranslate(osExpandedFilename.c_str(),
+                          GDALDataset::ToHandle(poSrcDS), psOptions, nullptr)));
+        GDALTranslateOptionsFree(psOptions);
+        if (!poExpandedDS)
+            return false;
+        poSrcDS = poExpandedDS.get();
+        osSrcName = osExpandedFilename;
+    }
+    struct ExpandedFileRemover
+    {
+        std::unique_ptr<GDALDataset> &poDS;
+        const std::string &osFilename;
+
+        ~ExpandedFileRemover()
+        {
+            if (poDS)
+            {
+                poDS.reset();
+                VSIUnlink(osFilename.c_str());
+            }
+        }
+    } oExpandedFileRemover{poExpandedDS, osExpandedFilename};
+
+    const int nSrcBands = poSrcDS->GetRasterCount();
+    if (nSrcBands < 1 || nSrcBands > 4)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Only input datasets with 1 to 4 bands are supported.");
+        return false;
+    }
+    for (int i = 1; i <= nSrcBands; ++i)
+    {
+        if (poSrcDS->GetRasterBand(i)->GetRasterDataType() != GDT_Byte)
+        {
+            ReportError(CE_Failure, CPLE_NotSupported,
+                        "Only input datasets of Byte data type are "
+                        "supported. You may use 'gdal raster convert' with "
+                        "scaling first.");
+            return false;
+        }
+    }
+    // 2 or 4 bands: the last one is assumed to be alpha
+    const int nColorBands = (nSrcBands == 2 || nSrcBands == 4) ? nSrcBands - 1
+                                                               : nSrcBands;
+    if (nColorBands < nSrcBands)
+        oTiler.m_nSrcAlphaBand = nSrcBands;
+    if (nColorBands == 1 && bWEBP)
+    {
+        // WEBP only supports RGB(A)
+        oTiler.m_anSrcBands = {1, 1, 1};
+    }
+    else
+    {
+        for (int i = 1; i <= nColorBands; ++i)
+            oTiler.m_anSrcBands.push_back(i);
+    }
+    if (oTiler.m_nSrcAlphaBand == 0)
+    {
+        for (int nBand : oTiler.m_anSrcBands)
+        {
+            int bHasNoData = FALSE;
+            const double dfNoData =
+                poSrcDS->GetRasterBand(nBand)->GetNoDataValue(&bHasNoData);
+            if (!bHasNoData)
+            {
+                oTiler.m_adfSrcNoData.clear();
+                break;
+            }
+            oTiler.m_adfSrcNoData.push_back(dfNoData);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the extent in the CRS of the tiling scheme.             */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosTO;
+    aosTO.SetNameValue("DST_SRS", oTiler.m_osDstSRSWKT.c_str());
+
+    // Hack to compensate for GDALSuggestedWarpOutput2() failure (or not
+    // ideal suggestion) when reprojecting latitude = +/- 90 to EPSG:3857.
+    // Same as in the COG driver.
+    std::unique_ptr<GDALDataset> poExtentDS;
+    double adfSrcGeoTransform[6];
+    const char *pszAuthCode = oTargetSRS.GetAuthorityCode(nullptr);
+    const auto poSrcSRS = poSrcDS->GetSpatialRef();
+    if (pszAuthCode && atoi(pszAuthCode) == 3857 && poSrcSRS &&
+        poSrcSRS->IsGeographic() && !poSrcSRS->IsDerivedGeographic() &&
+        poSrcDS->GetGeoTransform(adfSrcGeoTransform) == CE_None &&
+        adfSrcGeoTransform[2] == 0 && adfSrcGeoTransform[4] == 0 &&
+        adfSrcGeoTransform[5] < 0)
+    {
+        constexpr double MAX_LAT = 85.0511287798066;
+        const double dfMaxLat = adfSrcGeoTransform[3];
+        const double dfMinLat =
+            adfSrcGeoTransform[3] +
+            poSrcDS->GetRasterYSize() * adfSrcGeoTransform[5];
+        if (dfMaxLat > MAX_LAT || dfMinLat < -MAX_LAT)
+        {
+            CPLStringList aosOptions;
+            aosOptions.AddString("-of");
+            aosOptions.AddString("VRT");
+            aosOptions.AddString("-projwin");
+            aosOptions.AddString(CPLSPrintf("%.17g", adfSrcGeoTransform[0]));
+            aosOptions.AddString(
+                CPLSPrintf("%.17g", std::min(dfMaxLat, MAX_LAT)));
+            aosOptions.AddString(
+                CPLSPrintf("%.17g", adfSrcGeoTransform[0] +
+                                        poSrcDS->GetRasterXSize() *
+                                            adfSrcGeoTransform[1]));
+            aosOptions.AddString(
+                CPLSPrintf("%.17g", std::max(dfMinLat, -MAX_LAT)));
+            auto psOptions =
+                GDALTranslateOptionsNew(aosOptions.List(), nullptr);
+            poExtentDS.reset(GDALDataset::FromHandle(GDALTranslate(
+                "", GDALDataset::ToHandle(poSrcDS), psOptions, nullptr)));
+            GDALTranslateOptionsFree(psOptions);
+        }
+    }
+
+    GDALDataset *poExtentSrcDS = poExtentDS ? poExtentDS.get() : poSrcDS;
+    void *hTransformArg = GDALCreateGenImgProjTransformer2(
+        GDALDataset::ToHandle(poExtentSrcDS), nullptr, aosTO.List());
+    if (!hTransformArg)
+        return false;
+    double adfSuggestedGeoTransform[6];
+    double adfExtent[4];
+    int nSuggestedXSize = 0;
+    int nSuggestedYSize = 0;
+    const CPLErr eErr = GDALSuggestedWarpOutput2(
+        GDALDataset::ToHandle(poExtentSrcDS), GDALGenImgProjTransform,
+        hTransformArg, adfSuggestedGeoTransform, &nSuggestedXSize,
+        &nSuggestedYSize, adfExtent, 0);
+    GDALDestroyGenImgProjTransformer(hTransformArg);
+    poExtentDS.reset();
+    if (eErr != CE_None)
+        return false;
+    const double dfMinX = adfExtent[0];
+    const double dfMinY = adfExtent[1];
+    const double dfMaxX = adfExtent[2];
+    const double dfMaxY = adfExtent[3];
+
+    /* -------------------------------------------------------------------- */
+    /*      Zoom levels.                                                    */
+    /* -------------------------------------------------------------------- */
+    int nMaxZoom = m_maxZoomLevel;
+    if (nMaxZoom >= nZoomLevelCount)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "max-zoom should be in [0,%d] range.",
+                    nZoomLevelCount - 1);
+        return false;
+    }
+    if (nMaxZoom < 0)
+    {
+        // Zoom level whose resolution is the closest to the one of the source
+        const double dfComputedRes = adfSuggestedGeoTransform[1];
+        nMaxZoom = 0;
+        while (nMaxZoom < nZoomLevelCount - 1 &&
+               dfComputedRes < tmList[nMaxZoom].mResX &&
+               std::fabs(dfComputedRes - tmList[nMaxZoom].mResX) /
+                       tmList[nMaxZoom].mResX >
+                   1e-8)
+        {
+            ++nMaxZoom;
+        }
+        if (nMaxZoom > 0 &&
+            tmList[nMaxZoom - 1].mResX / dfComputedRes <
+                dfComputedRes / tmList[nMaxZoom].mResX)
+        {
+            --nMaxZoom;
+        }
+    }
+
+    int nMinZoom = m_minZoomLevel;
+    if (nMinZoom < 0)
+    {
+        // Highest zoom level where the dataset fits in about one tile
+        nMinZoom = nMaxZoom;
+        while (nMinZoom > 0 &&
+               (dfMaxX - dfMinX >
+                    tmList[nMinZoom].mResX * oTiler.m_nTileWidth ||
+                dfMaxY - dfMinY >
+                    tmList[nMinZoom].mResY * oTiler.m_nTileHeight))
+        {
+            --nMinZoom;
+        }
+    }
+    if (nMinZoom > nMaxZoom)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "min-zoom (%d) should be lower or equal to max-zoom (%d).",
+                    nMinZoom, nMaxZoom);
+        return false;
+    }
+    oTiler.m_nMinZoom = nMinZoom;
+    oTiler.m_nMaxZoom = nMaxZoom;
+
+    /* -------------------------------------------------------------------- */
+    /*      Tile ranges.                                                    */
+    /* -------------------------------------------------------------------- */
+    const auto &tmMax = tmList[nMaxZoom];
+    const double dfOriX = bInvertAxis ? tmMax.mTopLeftY : tmMax.mTopLeftX;
+    const double dfOriY = bInvertAxis ? tmMax.mTopLeftX : tmMax.mTopLeftY;
+    const double dfTileExtentX = tmMax.mResX * tmMax.mTileWidth;
+    const double dfTileExtentY = tmMax.mResY * tmMax.mTileHeight;
+    constexpr double TOLERANCE_IN_PIXEL = 0.499;
+    const double dfEpsX = TOLERANCE_IN_PIXEL * tmMax.mResX;
+    const double dfEpsY = TOLERANCE_IN_PIXEL * tmMax.mResY;
+    const auto Clamp = [](double dfVal, int nMaxVal)
+    {
+        return static_cast<int>(
+            std::clamp(dfVal, -1.0, static_cast<double>(nMaxVal)));
+    };
+    TileRange oRange;
+    oRange.nMinX = Clamp(std::floor((dfMinX - dfOriX + dfEpsX) / dfTileExtentX),
+                         tmMax.mMatrixWidth);
+    oRange.nMinY = Clamp(std::floor((dfOriY - dfMaxY + dfEpsY) / dfTileExtentY),
+                         tmMax.mMatrixHeight);
+    oRange.nMaxX =
+        Clamp(std::ceil((dfMaxX - dfOriX - dfEpsX) / dfTileExtentX) - 1,
+              tmMax.mMatrixWidth);
+    oRange.nMaxY =
+        Clamp(std::ceil((dfOriY - dfMinY - dfEpsY) / dfTileExtentY) - 1,
+              tmMax.mMatrixHeight);
+    oRange.nMinX = std::max(0, oRange.nMinX);
+    oRange.nMinY = std::max(0, oRange.nMinY);
+    oRange.nMaxX = std::min(tmMax.mMatrixWidth - 1, oRange.nMaxX);
+    oRange.nMaxY = std::min(tmMax.mMatrixHeight - 1, oRange.nMaxY);
+    if (oRange.nMaxX < oRange.nMinX || oRange.nMaxY < oRange.nMinY)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Raster extent completely outside of tiling scheme "
+                    "extent.");
+        return false;
+    }
+
+    const int64_t nDstXSize =
+        static_cast<int64_t>(oRange.nMaxX - oRange.nMinX + 1) *
+        tmMax.mTileWidth;
+    const int64_t nDstYSize =
+        static_cast<int64_t>(oRange.nMaxY - oRange.nMinY + 1) *
+        tmMax.mTileHeight;
+    if (nDstXSize > INT_MAX || nDstYSize > INT_MAX)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Too many tiles at zoom level %d.", nMaxZoom);
+        return false;
+    }
+    oTiler.m_nDstXSize = static_cast<int>(nDstXSize);
+    oTiler.m_nDstYSize = static_cast<int>(nDstYSize);
+    oTiler.m_adfDstGeoTransform[0] = dfOriX + oRange.nMinX * dfTileExtentX;
+    oTiler.m_adfDstGeoTransform[1] = tmMax.mResX;
+    oTiler.m_adfDstGeoTransform[3] = dfOriY - oRange.nMinY * dfTileExtentY;
+    oTiler.m_adfDstGeoTransform[5] = -tmMax.mResY;
+
+    oTiler.m_aoRanges.resize(nMaxZoom + 1);
+    oTiler.m_aoRanges[nMaxZoom] = oRange;
+    for (int nZoom = nMaxZoom - 1; nZoom >= nMinZoom; --nZoom)
+    {
+        const TileRange &oChildRange = oTiler.m_aoRanges[nZoom + 1];
+        TileRange &oZoomRange = oTiler.m_aoRanges[nZoom];
+        oZoomRange.nMinX = oChildRange.nMinX / 2;
+        oZoomRange.nMinY = oChildRange.nMinY / 2;
+        oZoomRange.nMaxX = oChildRange.nMaxX / 2;
+        oZoomRange.nMaxY = oChildRange.nMaxY / 2;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Resampling and threading.                                       */
+    /* -------------------------------------------------------------------- */
+    oTiler.m_eWarpResampleAlg = GetWarpResampleAlg(m_resampling);
+    std::string osOvrResampling = m_overviewResampling;
+    if (osOvrResampling.empty())
+    {
+        osOvrResampling =
+            IsRasterIOResampling(m_resampling) ? m_resampling : "average";
+    }
+    oTiler.m_eOvrResampleAlg =
+        GDALRasterIOGetResampleAlg(osOvrResampling.c_str());
+    oTiler.m_nMetatileSize = m_metatileSize;
+    oTiler.m_bTMS = m_convention == "tms";
+    oTiler.m_osOutputDirectory = m_outputDirectory;
+
+    const int nThreads =
+        EQUAL(m_numThreads.c_str(), "ALL_CPUS")
+            ? CPLGetNumCPUs()
+            : std::clamp(atoi(m_numThreads.c_str()), 1, 1024);
+    if (nThreads > 1)
+    {
+        // Worker threads need their own handle on the source dataset.
+        oTiler.m_aosSrcAllowedDrivers = CPLStringList(m_inputFormats);
+        oTiler.m_aosSrcOpenOptions = CPLStringList(m_openOptions);
+        std::unique_ptr<GDALDataset> poTestDS;
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            poTestDS.reset(GDALDataset::Open(
+                osSrcName.c_str(), GDAL_OF_RASTER,
+                oTiler.m_aosSrcAllowedDrivers.List(),
+                oTiler.m_aosSrcOpenOptions.List(), nullptr));
+        }
+        if (poTestDS)
+            oTiler.m_osSrcName = std::move(osSrcName);
+        else
+            CPLDebug("GDAL", "Cannot reopen input dataset. "
+                             "Using a single thread");
+    }
+    oTiler.m_poSrcDS = poSrcDS;
+
+    if (VSIMkdirRecursive(m_outputDirectory.c_str(), 0755) != 0)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(m_outputDirectory.c_str(), &sStat) != 0 ||
+            !VSI_ISDIR(sStat.st_mode))
+        {
+            ReportError(CE_Failure, CPLE_FileIO,
+                        "Cannot create output directory %s",
+                        m_outputDirectory.c_str());
+            return false;
+        }
+    }
+
+    return oTiler.Run(oTiler.m_osSrcName.empty() ? 1 : nThreads, pfnProgress,
+                      pProgressData);
+}
+
+//! @endcond
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  gdal "raster tile" subcommand
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALALG_RASTER_TILE_INCLUDED
+#define GDALALG_RASTER_TILE_INCLUDED
+
+#include "gdalalgorithm.h"
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                       GDALRasterTileAlgorithm                        */
+/************************************************************************/
+
+class GDALRasterTileAlgorithm final : public GDALAlgorithm
+{
+  public:
+    static constexpr const char *NAME = "tile";
+    static constexpr const char *DESCRIPTION =
+        "Generate tiles in separate files from a raster dataset.";
+    static constexpr const char *HELP_URL = "/programs/gdal_raster_tile.html";
+
+    static std::vector<std::string> GetAliases()
+    {
+        return {};
+    }
+
+    GDALRasterTileAlgorithm();
+
+  private:
+    bool RunImpl(GDALProgressFunc pfnProgress, void *pProgressData) override;
+
+    GDALArgDatasetValue m_inputDataset{};
+    std::vector<std::string> m_openOptions{};
+    std::vector<std::string> m_inputFormats{};
+    std::string m_outputDirectory{};
+    std::string m_outputFormat = "PNG";
+    std::vector<std::string> m_creationOptions{};
+
+    std::string m_tilingScheme = "WebMercatorQuad";
+    int m_minZoomLevel = -1;
+    int m_maxZoomLevel = -1;
+    std::string m_convention = "xyz";
+    std::string m_resampling = "cubic";
+    std::string m_overviewResampling{};
+    int m_metatileSize = 8;
+    std::string m_numThreads = "ALL_CPUS";
+};
+
+//! @endcond
+
+#endif
@@ -66,6 +66,11 @@ bool GDALRasterWriteAlgorithm::RunStep(GDALProgressFunc pfnProgress,
     GDALTranslateOptionsSetProgress(psOptions, pfnProgress, pProgressData);
 
     GDALDatasetH hSrcDS = GDALDataset::ToHandle(m_inputDataset.GetDatasetRef());
+    // Computing the output of the previous steps is generally costly (warping,
+    // resampling, etc.), so overlap it with the encoding and writing done by
+    // the output driver.
+    CPLConfigOptionSetter oSetter("GDAL_COPY_WHOLE_RASTER_READ_AHEAD", "YES",
+                                  /* bSetOnlyIfUndefined = */ true);
     auto poRetDS = GDALDataset::FromHandle(GDALTranslate(
         m_outputDataset.GetName().c_str(), hSrcDS, psOptions, nullptr));
     GDALTranslateOptionsFree(psOptions);
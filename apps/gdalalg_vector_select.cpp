@@ -15,7 +15,10 @@
 #include "gdal_priv.h"
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
+#include "ogrlayerarrow.h"
 
+#include <cstring>
 #include <set>
 
 //! @cond Doxygen_Suppress
@@ -46,6 +49,140 @@ GDALVectorSelectAlgorithm::GDALVectorSelectAlgorithm(bool standaloneStep)
 namespace
 {
 
+/************************************************************************/
+/*                   GDALVectorSelectArrowStream                        */
+/************************************************************************/
+
+/** ArrowArrayStream that forwards the batches of a source stream, restricted
+ * to a subset of their columns. The returned schemas and arrays point to the
+ * children of the source ones, which they keep alive until released.
+ */
+struct GDALVectorSelectArrowStream
+{
+    OGRArrowArrayStream m_oSrcStream{};
+    std::vector<int> m_anKeptChildren{};
+    std::string m_osLastError{};
+
+    struct SchemaHolder
+    {
+        struct ArrowSchema m_sSrc{};
+        std::vector<struct ArrowSchema *> m_apsChildren{};
+    };
+
+    struct ArrayHolder
+    {
+        struct ArrowArray m_sSrc{};
+        std::vector<struct ArrowArray *> m_apsChildren{};
+    };
+
+    static int GetSchema(struct ArrowArrayStream *stream,
+                         struct ArrowSchema *out_schema)
+    {
+        auto poThis =
+            static_cast<GDALVectorSelectArrowStream *>(stream->private_data);
+        auto poHolder = std::make_unique<SchemaHolder>();
+        const int nRet = poThis->m_oSrcStream.get_schema(&poHolder->m_sSrc);
+        if (nRet != 0)
+            return nRet;
+        const auto &sSrc = poHolder->m_sSrc;
+        for (int iChild : poThis->m_anKeptChildren)
+        {
+            if (iChild >= sSrc.n_children)
+            {
+                poThis->m_osLastError = "Inconsistent schema";
+                poHolder->m_sSrc.release(&poHolder->m_sSrc);
+                return EIO;
+            }
+            poHolder->m_apsChildren.push_back(sSrc.children[iChild]);
+        }
+
+        memset(out_schema, 0, sizeof(*out_schema));
+        out_schema->format = sSrc.format;
+        out_schema->name = sSrc.name;
+        out_schema->metadata = sSrc.metadata;
+        out_schema->flags = sSrc.flags;
+        out_schema->n_children =
+            static_cast<int64_t>(poHolder->m_apsChildren.size());
+        out_schema->children = poHolder->m_apsChildren.data();
+        out_schema->release = ReleaseSchema;
+        out_schema->private_data = poHolder.release();
+        return 0;
+    }
+
+    static void ReleaseSchema(struct ArrowSchema *schema)
+    {
+        auto poHolder = static_cast<SchemaHolder *>(schema->private_data);
+        if (poHolder->m_sSrc.release)
+            poHolder->m_sSrc.release(&poHolder->m_sSrc);
+        delete poHolder;
+        schema->release = nullptr;
+    }
+
+    static int GetNext(struct ArrowArrayStream *stream,
+                       struct ArrowArray *out_array)
+    {
+        auto poThis =
+            static_cast<GDALVectorSelectArrowStream *>(stream->private_data);
+        auto poHolder = std::make_unique<ArrayHolder>();
+        const int nRet = poThis->m_oSrcStream.get_next(&poHolder->m_sSrc);
+        if (nRet != 0 || poHolder->m_sSrc.release == nullptr)
+        {
+            memset(out_array, 0, sizeof(*out_array));
+            return nRet;
+        }
+        const auto &sSrc = poHolder->m_sSrc;
+        for (int iChild : poThis->m_anKeptChildren)
+        {
+            if (iChild >= sSrc.n_children)
+            {
+                poThis->m_osLastError = "Inconsistent array";
+                poHolder->m_sSrc.release(&poHolder->m_sSrc);
+                return EIO;
+            }
+            poHolder->m_apsChildren.push_back(sSrc.children[iChild]);
+        }
+
+        memset(out_array, 0, sizeof(*out_array));
+        out_array->length = sSrc.length;
+        out_array->null_count = sSrc.null_count;
+        out_array->offset = sSrc.offset;
+        out_array->n_buffers = sSrc.n_buffers;
+        out_array->buffers = sSrc.buffers;
+        out_array->n_children =
+            static_cast<int64_t>(poHolder->m_apsChildren.size());
+        out_array->children = poHolder->m_apsChildren.data();
+        out_array->release = ReleaseArray;
+        out_array->private_data = poHolder.release();
+        return 0;
+    }
+
+    static void ReleaseArray(struct ArrowArray *array)
+    {
+        auto poHolder = static_cast<ArrayHolder *>(array->private_data);
+        if (poHolder->m_sSrc.release)
+            poHolder->m_sSrc.release(&poHolder->m_sSrc);
+        delete poHolder;
+        array->release = nullptr;
+    }
+
+    static const char *GetLastError(struct ArrowArrayStream *stream)
+    {
+        auto poThis =
+            static_cast<GDALVectorSelectArrowStream *>(stream->private_data);
+        if (!poThis->m_osLastError.empty())
+            return poThis->m_osLastError.c_str();
+        auto psSrcStream = poThis->m_oSrcStream.get();
+        return psSrcStream->get_last_error(psSrcStream);
+    }
+
+    static void Release(struct ArrowArrayStream *stream)
+    {
+        delete static_cast<GDALVectorSelectArrowStream *>(stream->private_data);
+        stream->private_data = nullptr;
+        stream->release = nullptr;
+    }
+};
+
 /************************************************************************/
 /*                   GDALVectorSelectAlgorithmLayer                     */
 /************************************************************************/
@@ -282,8 +419,64 @@ class GDALVectorSelectAlgorithmLayer final
         return TranslateFeature(poSrcFeature.get()).release();
     }
 
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions) override
+    {
+        if (!TestCapability(OLCFastGetArrowStream))
+            return OGRLayer::GetArrowStream(out_stream, papszOptions);
+
+        auto poStream = std::make_unique<GDALVectorSelectArrowStream>();
+        if (!m_oSrcLayer.GetArrowStream(poStream->m_oSrcStream.get(),
+                                        papszOptions))
+        {
+            return false;
+        }
+
+        // Find the columns of the source stream that are kept: the FID one,
+        // and the ones of the selected fields and geometry fields.
+        struct ArrowSchema sSchema;
+        if (poStream->m_oSrcStream.get_schema(&sSchema) != 0)
+            return false;
+        const char *pszFIDColumn = m_oSrcLayer.GetFIDColumn();
+        if (pszFIDColumn[0] == '\0')
+            pszFIDColumn = DEFAULT_ARROW_FID_NAME;
+        for (int i = 0; i < static_cast<int>(sSchema.n_children); ++i)
+        {
+            const char *pszName = sSchema.children[i]->name;
+            bool bKeep = strcmp(pszName, pszFIDColumn) == 0 ||
+                         m_poFeatureDefn->GetFieldIndex(pszName) >= 0;
+            for (int j = 0; !bKeep && j < m_poFeatureDefn->GetGeomFieldCount();
+                 ++j)
+            {
+                const char *pszGeomName =
+                    m_poFeatureDefn->GetGeomFieldDefn(j)->GetNameRef();
+                if (pszGeomName[0] == '\0')
+                    pszGeomName = DEFAULT_ARROW_GEOMETRY_NAME;
+                bKeep = strcmp(pszName, pszGeomName) == 0;
+            }
+            if (bKeep)
+                poStream->m_anKeptChildren.push_back(i);
+        }
+        sSchema.release(&sSchema);
+
+        memset(out_stream, 0, sizeof(*out_stream));
+        out_stream->get_schema = GDALVectorSelectArrowStream::GetSchema;
+        out_stream->get_next = GDALVectorSelectArrowStream::GetNext;
+        out_stream->get_last_error = GDALVectorSelectArrowStream::GetLastError;
+        out_stream->release = GDALVectorSelectArrowStream::Release;
+        out_stream->private_data = poStream.release();
+        return true;
+    }
+
     int TestCapability(const char *pszCap) override
     {
+        // GetArrowStream() forwards the selected columns of the batches of
+        // the source layer, but it cannot apply filters set on this layer.
+        if (EQUAL(pszCap, OLCFastGetArrowStream))
+        {
+            return !m_poAttrQuery && !m_poFilterGeom &&
+                   m_oSrcLayer.TestCapability(pszCap);
+        }
         if (EQUAL(pszCap, OLCRandomRead) || EQUAL(pszCap, OLCCurveGeometries) ||
             EQUAL(pszCap, OLCMeasuredGeometries) ||
             EQUAL(pszCap, OLCZGeometries) ||
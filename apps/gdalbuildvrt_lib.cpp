@@ -18,6 +18,7 @@
 #include "gdal_utils.h"
 #include "gdal_utils_priv.h"
 #include "gdalargumentparser.h"
+#include "gdaldatasetprefetcher.h"
 
 #include <cassert>
 #include <cmath>
@@ -293,6 +294,7 @@ class VRTBuilder
     GDALDataset *Build(GDALProgressFunc pfnProgress, void *pProgressData);
 
     std::string m_osProgramName{};
+    int m_nNumThreads = 1;
 };
 
 /************************************************************************/
@@ -1590,6 +1592,12 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // Sources are analysed sequentially, in input order, but they can be
+    // opened ahead in worker threads.
+    GDALDatasetPrefetcher oPrefetcher(pahSrcDS ? 1 : m_nNumThreads,
+                                      GDAL_OF_RASTER, papszOpenOptions);
+    int iNextToSubmit = 0;
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1600,10 +1608,25 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        // nInputFiles may grow when AnalyseRaster() expands subdatasets
+        for (iNextToSubmit = std::max(iNextToSubmit, i);
+             iNextToSubmit < nInputFiles && oPrefetcher.CanSubmit();
+             ++iNextToSubmit)
+        {
+            oPrefetcher.Submit(ppszInputFilenames[iNextToSubmit]);
+        }
+
+        std::unique_ptr<GDALDataset> poDSOwned;
+        GDALDatasetH hDS = nullptr;
+        if (pahSrcDS)
+        {
+            hDS = pahSrcDS[i];
+        }
+        else
+        {
+            poDSOwned = oPrefetcher.Get(dsFileName);
+            hDS = GDALDataset::ToHandle(poDSOwned.get());
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1615,8 +1638,7 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
                 bFoundValid = true;
                 bFirst = FALSE;
             }
-            if (pahSrcDS == nullptr)
-                GDALClose(hDS);
+            poDSOwned.reset();
             if (!osErrorMsg.empty() && osErrorMsg != "SILENTLY_IGNORE")
             {
                 if (bStrict)
@@ -1816,6 +1838,7 @@ struct GDALBuildVRTOptions
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    std::string osNumThreads{};
 
     /*! allow or suppress progress monitor and other non-error output */
     bool bQuiet = true;
@@ -1967,6 +1990,8 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.osResampling.empty() ? nullptr : sOptions.osResampling.c_str(),
         sOptions.aosOpenOptions.List(), sOptions.aosCreateOptions);
     oBuilder.m_osProgramName = sOptions.osProgramName;
+    oBuilder.m_nNumThreads =
+        GDALDatasetPrefetcher::GetNumThreads(sOptions.osNumThreads);
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData));
@@ -2238,6 +2263,11 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
                 "when the value of the mask band of the source is less or "
                 "equal to the threshold."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to open input datasets."));
+
     argParser->add_argument("-program_name")
         .store_into(psOptions->osProgramName)
         .hidden();
@@ -0,0 +1,125 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Open datasets ahead in worker threads
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdaldatasetprefetcher.h"
+
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                       GDALDatasetPrefetcher()                        */
+/************************************************************************/
+
+GDALDatasetPrefetcher::GDALDatasetPrefetcher(int nThreads, unsigned nOpenFlags,
+                                             CSLConstList papszOpenOptions)
+    : m_nOpenFlags(nOpenFlags), m_aosOpenOptions(papszOpenOptions)
+{
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            m_poQueue = poThreadPool->CreateJobQueue();
+        // Keep each worker busy, while bounding the number of datasets that
+        // are opened at the same time.
+        m_nMaxPending = 2 * static_cast<size_t>(nThreads);
+    }
+}
+
+/************************************************************************/
+/*                      ~GDALDatasetPrefetcher()                        */
+/************************************************************************/
+
+GDALDatasetPrefetcher::~GDALDatasetPrefetcher()
+{
+    // Datasets that have not been retrieved are closed by m_apoJobs
+    if (m_poQueue)
+        m_poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+/** Return the number of threads from the value of a -num_threads option,
+ * or from the GDAL_NUM_THREADS configuration option if it is empty.
+ * Defaults to 1.
+ */
+int GDALDatasetPrefetcher::GetNumThreads(const std::string &osNumThreads)
+{
+    const char *pszNumThreads =
+        osNumThreads.empty() ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+                             : osNumThreads.c_str();
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszNumThreads), 1, 1024);
+}
+
+/************************************************************************/
+/*                               Submit()                               */
+/************************************************************************/
+
+/** Submit a dataset to open. Must only be called if CanSubmit() is true. */
+void GDALDatasetPrefetcher::Submit(const std::string &osFilename)
+{
+    CPLAssert(CanSubmit());
+    auto poJob = std::make_shared<Job>();
+    poJob->m_osFilename = osFilename;
+    m_apoJobs.push_back(poJob);
+    m_poQueue->SubmitJob(
+        [this, poJob]()
+        {
+            {
+                auto oAccumulator = poJob->m_oErrors.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                poJob->m_poDS.reset(GDALDataset::Open(
+                    poJob->m_osFilename.c_str(), m_nOpenFlags, nullptr,
+                    m_aosOpenOptions.List(), nullptr));
+            }
+            std::lock_guard oLock(m_oMutex);
+            poJob->m_bDone = true;
+            m_oCV.notify_all();
+        });
+}
+
+/************************************************************************/
+/*                                 Get()                                */
+/************************************************************************/
+
+/** Return the dataset for osFilename, which must be the oldest submitted
+ * one that has not been retrieved yet. If it has not been submitted, it is
+ * opened in the calling thread.
+ */
+std::unique_ptr<GDALDataset>
+GDALDatasetPrefetcher::Get(const std::string &osFilename)
+{
+    if (m_apoJobs.empty() || m_apoJobs.front()->m_osFilename != osFilename)
+    {
+        CPLAssert(m_apoJobs.empty());
+        return std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osFilename.c_str(), m_nOpenFlags, nullptr,
+                              m_aosOpenOptions.List(), nullptr));
+    }
+
+    auto poJob = std::move(m_apoJobs.front());
+    m_apoJobs.pop_front();
+    {
+        std::unique_lock oLock(m_oMutex);
+        m_oCV.wait(oLock, [&poJob] { return poJob->m_bDone; });
+    }
+    poJob->m_oErrors.ReplayErrors();
+    return std::move(poJob->m_poDS);
+}
+
+//! @endcond
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Open datasets ahead in worker threads
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALDATASETPREFETCHER_H_INCLUDED
+#define GDALDATASETPREFETCHER_H_INCLUDED
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_error_internal.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_priv.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/************************************************************************/
+/*                        GDALDatasetPrefetcher                         */
+/************************************************************************/
+
+/** Opens datasets in worker threads of the global thread pool, ahead of the
+ * (single) thread that consumes them.
+ *
+ * Datasets must be retrieved with Get() in the order they were submitted
+ * with Submit(). Errors emitted while opening a dataset are replayed in the
+ * calling thread of Get(), so that the output of utilities does not depend
+ * on the number of threads.
+ *
+ * This is mostly useful for datasets on network file systems, for which
+ * opening is dominated by the latency of reading their header.
+ */
+class GDALDatasetPrefetcher
+{
+    struct Job
+    {
+        std::string m_osFilename{};
+        std::unique_ptr<GDALDataset> m_poDS{};
+        CPLErrorAccumulator m_oErrors{};
+        bool m_bDone = false;
+    };
+
+    const unsigned m_nOpenFlags;
+    const CPLStringList m_aosOpenOptions;
+    size_t m_nMaxPending = 0;
+    std::unique_ptr<CPLJobQueue> m_poQueue{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::shared_ptr<Job>> m_apoJobs{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALDatasetPrefetcher)
+
+  public:
+    GDALDatasetPrefetcher(int nThreads, unsigned nOpenFlags,
+                          CSLConstList papszOpenOptions);
+    ~GDALDatasetPrefetcher();
+
+    static int GetNumThreads(const std::string &osNumThreads);
+
+    /** Whether there is room for another submission */
+    bool CanSubmit() const
+    {
+        return m_poQueue && m_apoJobs.size() < m_nMaxPending;
+    }
+
+    void Submit(const std::string &osFilename);
+
+    std::unique_ptr<GDALDataset> Get(const std::string &osFilename);
+};
+
+//! @endcond
+
+#endif  // GDALDATASETPREFETCHER_H_INCLUDED
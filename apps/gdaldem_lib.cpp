@@ -97,6 +97,8 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_float.h"
@@ -104,8 +106,10 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -171,6 +175,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};
 };
 
 /************************************************************************/
@@ -292,8 +297,8 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg,
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
-    void *pData, bool bComputeAtEdges, GDALProgressFunc pfnProgress,
-    void *pProgressData)
+    void *pData, bool bComputeAtEdges, int nNumThreads,
+    GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -369,10 +374,6 @@ static CPLErr GDALGeneric3x3Processing(
     if (!bDstHasNoData)
         fDstNoDataValue = 0.0;
 
-    int nLine1Off = 0;
-    int nLine2Off = nXSize;
-    int nLine3Off = 2 * nXSize;
-
     // Move a 3x3 pafWindow over each cell
     // (where the cell in question is #4)
     //
@@ -467,148 +468,221 @@ static CPLErr GDALGeneric3x3Processing(
         return eErr;
     }
 
-    int i = 1;  // Used after for.
-    for (; i < nYSize - 1; i++)
+    /* -------------------------------------------------------------------- */
+    /*      Process the interior lines by batches. Each batch is read       */
+    /*      with a one line halo on top and bottom, and its output lines    */
+    /*      are computed in parallel when several threads are allowed.      */
+    /* -------------------------------------------------------------------- */
+    const auto ProcessLine = [&](const T *pafLines, bool bLinesHaveNoData,
+                                 float *pafOut)
     {
-        /* Read third line of the line buffer */
-        eErr =
-            GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
-                         pafThreeLineWin + nLine3Off, nXSize, 1, eReadDT, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+        constexpr int nLine1Off = 0;
+        const int nLine2Off = nXSize;
+        const int nLine3Off = 2 * nXSize;
 
-            return eErr;
+        if (bComputeAtEdges && nXSize >= 2)
+        {
+            int j = 0;
+            T afWin[9] = {INTERPOL(pafLines[nLine1Off + j],
+                                   pafLines[nLine1Off + j + 1], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          pafLines[nLine1Off + j],
+                          pafLines[nLine1Off + j + 1],
+                          INTERPOL(pafLines[nLine2Off + j],
+                                   pafLines[nLine2Off + j + 1], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          pafLines[nLine2Off + j],
+                          pafLines[nLine2Off + j + 1],
+                          INTERPOL(pafLines[nLine3Off + j],
+                                   pafLines[nLine3Off + j + 1], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          pafLines[nLine3Off + j],
+                          pafLines[nLine3Off + j + 1]};
+
+            pafOut[j] = ComputeVal(bLinesHaveNoData, fSrcNoDataValue,
+                                   CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
+                                   fDstNoDataValue, pfnAlg, pData,
+                                   bComputeAtEdges);
+        }
+        else
+        {
+            // Exclude the edges
+            pafOut[0] = fDstNoDataValue;
         }
 
-        // In case none of the 3 lines have nodata values, then no need to
-        // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (cpl::NumericLimits<T>::is_integer && bSrcHasNoData)
+        int j = 1;
+        if (pfnAlg_multisample && !bLinesHaveNoData)
         {
-            bool bLastLineHasNoDataValue = false;
-            int iX = 0;
-            for (; iX + 3 < nXSize; iX += 4)
-            {
-                if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 1] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 2] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                {
-                    bLastLineHasNoDataValue = true;
-                    break;
-                }
-            }
-            if (!bLastLineHasNoDataValue)
-            {
-                for (; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                    }
-                }
-            }
-            abLineHasNoDataValue[nLine3Off / nXSize] = bLastLineHasNoDataValue;
+            j = pfnAlg_multisample(pafLines, nLine1Off, nLine2Off, nLine3Off,
+                                   nXSize, pData, pafOut);
+        }
 
-            bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                        abLineHasNoDataValue[1] ||
-                                        abLineHasNoDataValue[2];
+        for (; j < nXSize - 1; j++)
+        {
+            T afWin[9] = {pafLines[nLine1Off + j - 1],
+                          pafLines[nLine1Off + j],
+                          pafLines[nLine1Off + j + 1],
+                          pafLines[nLine2Off + j - 1],
+                          pafLines[nLine2Off + j],
+                          pafLines[nLine2Off + j + 1],
+                          pafLines[nLine3Off + j - 1],
+                          pafLines[nLine3Off + j],
+                          pafLines[nLine3Off + j + 1]};
+
+            pafOut[j] = ComputeVal(bLinesHaveNoData, fSrcNoDataValue,
+                                   CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
+                                   fDstNoDataValue, pfnAlg, pData,
+                                   bComputeAtEdges);
         }
 
         if (bComputeAtEdges && nXSize >= 2)
         {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
+            j = nXSize - 1;
 
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+            T afWin[9] = {pafLines[nLine1Off + j - 1],
+                          pafLines[nLine1Off + j],
+                          INTERPOL(pafLines[nLine1Off + j],
+                                   pafLines[nLine1Off + j - 1], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          pafLines[nLine2Off + j - 1],
+                          pafLines[nLine2Off + j],
+                          INTERPOL(pafLines[nLine2Off + j],
+                                   pafLines[nLine2Off + j - 1], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          pafLines[nLine3Off + j - 1],
+                          pafLines[nLine3Off + j],
+                          INTERPOL(pafLines[nLine3Off + j],
+                                   pafLines[nLine3Off + j - 1], bSrcHasNoData,
+                                   fSrcNoDataValue)};
+
+            pafOut[j] = ComputeVal(bLinesHaveNoData, fSrcNoDataValue,
+                                   CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
+                                   fDstNoDataValue, pfnAlg, pData,
+                                   bComputeAtEdges);
         }
         else
         {
             // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
+            if (nXSize > 1)
+                pafOut[nXSize - 1] = fDstNoDataValue;
         }
+    };
 
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    const auto LineHasNoData = [nXSize, fSrcNoDataValue](const T *pafLine)
+    {
+        for (int iX = 0; iX < nXSize; iX++)
         {
-            j = pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
-                                   nLine3Off, nXSize, pData, pafOutputBuf);
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
         }
+        return false;
+    };
 
-        for (; j < nXSize - 1; j++)
+    const int nInteriorLines = std::max(0, nYSize - 2);
+    constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+    const int nBatchLines = static_cast<int>(std::min<size_t>(
+        std::max(1, nInteriorLines),
+        std::max<size_t>(1, BATCH_BYTES / (static_cast<size_t>(nXSize) *
+                                           (sizeof(T) + sizeof(float))))));
+    const int nThreads = std::min(nNumThreads, nBatchLines);
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    std::vector<T> aSrcLines;
+    std::vector<float> afOutputLines;
+    std::vector<bool> abBatchLineHasNoData;
+    if (nInteriorLines > 0)
+    {
+        try
         {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
+            aSrcLines.resize(static_cast<size_t>(nBatchLines + 2) * nXSize);
+            afOutputLines.resize(static_cast<size_t>(nBatchLines) * nXSize);
+            abBatchLineHasNoData.resize(nBatchLines + 2);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory allocating line buffers");
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+            return CE_Failure;
+        }
 
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+        // The first two lines of the first batch are the preloaded ones.
+        memcpy(aSrcLines.data(), pafThreeLineWin,
+               2 * static_cast<size_t>(nXSize) * sizeof(T));
+        abBatchLineHasNoData[0] = abLineHasNoDataValue[0];
+        abBatchLineHasNoData[1] = abLineHasNoDataValue[1];
+    }
+
+    int i = 1;  // Used after for.
+    while (i < nYSize - 1)
+    {
+        const int nLines = std::min(nBatchLines, nYSize - 1 - i);
+
+        /* Read the lines after the two already available ones */
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, nLines,
+                            aSrcLines.data() + 2 * static_cast<size_t>(nXSize),
+                            nXSize, nLines, eReadDT, 0, 0);
+        if (eErr != CE_None)
+        {
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+
+            return eErr;
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
+        // In case none of the 3 lines have nodata values, then no need to
+        // check it in ComputeVal()
+        for (int k = 2; k < nLines + 2; k++)
         {
-            j = nXSize - 1;
+            abBatchLineHasNoData[k] =
+                CPL_TO_BOOL(bSrcHasNoData) &&
+                (!cpl::NumericLimits<T>::is_integer ||
+                 LineHasNoData(aSrcLines.data() +
+                               static_cast<size_t>(k) * nXSize));
+        }
 
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
+        const auto ProcessLines = [&](int iFirst, int iLast)
+        {
+            for (int k = iFirst; k < iLast; k++)
+            {
+                ProcessLine(aSrcLines.data() + static_cast<size_t>(k) * nXSize,
+                            abBatchLineHasNoData[k] ||
+                                abBatchLineHasNoData[k + 1] ||
+                                abBatchLineHasNoData[k + 2],
+                            afOutputLines.data() +
+                                static_cast<size_t>(k) * nXSize);
+            }
+        };
 
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+        const int nJobs = std::min(nThreads, nLines);
+        if (poJobQueue && nJobs > 1)
+        {
+            for (int iJob = 0; iJob < nJobs; iJob++)
+            {
+                const int iFirst = static_cast<int>(
+                    static_cast<int64_t>(iJob) * nLines / nJobs);
+                const int iLast = static_cast<int>(
+                    static_cast<int64_t>(iJob + 1) * nLines / nJobs);
+                poJobQueue->SubmitJob([&ProcessLines, iFirst, iLast]()
+                                      { ProcessLines(iFirst, iLast); });
+            }
+            poJobQueue->WaitCompletion();
         }
         else
         {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+            ProcessLines(0, nLines);
         }
 
         /* -----------------------------------------
-         * Write Line to Raster
+         * Write Lines to Raster
          */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, nLines,
+                            afOutputLines.data(), nXSize, nLines, GDT_Float32,
+                            0, 0);
         if (eErr != CE_None)
         {
             CPLFree(pafOutputBuf);
@@ -617,7 +691,9 @@ static CPLErr GDALGeneric3x3Processing(
             return eErr;
         }
 
-        if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
+        i += nLines;
+
+        if (!pfnProgress(1.0 * i / nYSize, nullptr, pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
@@ -628,10 +704,21 @@ static CPLErr GDALGeneric3x3Processing(
             return eErr;
         }
 
-        const int nTemp = nLine1Off;
-        nLine1Off = nLine2Off;
-        nLine2Off = nLine3Off;
-        nLine3Off = nTemp;
+        // Keep the last two lines as the halo of the next batch.
+        memmove(aSrcLines.data(),
+                aSrcLines.data() + static_cast<size_t>(nLines) * nXSize,
+                2 * static_cast<size_t>(nXSize) * sizeof(T));
+        abBatchLineHasNoData[0] = abBatchLineHasNoData[nLines];
+        abBatchLineHasNoData[1] = abBatchLineHasNoData[nLines + 1];
+    }
+
+    // The bottom edge works on the last two lines.
+    int nLine1Off = 0;
+    int nLine2Off = nXSize;
+    if (nInteriorLines > 0)
+    {
+        memcpy(pafThreeLineWin, aSrcLines.data(),
+               2 * static_cast<size_t>(nXSize) * sizeof(T));
     }
 
     if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
@@ -3068,6 +3155,11 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value>|ALL_CPUS")
+            .store_into(psOptions->osNumThreads)
+            .help(_("Number of threads used to process lines."));
+
         if (psOptionsForBinary)
         {
             subParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -4015,17 +4107,25 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         if (bDstHasNoData)
             GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
 
+        const int nNumThreads = CPLParseNumThreads(
+            !psOptions->osNumThreads.empty()
+                ? psOptions->osNumThreads.c_str()
+                : CPLGetConfigOption("GDAL_NUM_THREADS", "1"),
+            128);
+
         if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 || eSrcDT == GDT_UInt16)
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                psOptions->bComputeAtEdges, nNumThreads, pfnProgress,
+                pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, nullptr, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                psOptions->bComputeAtEdges, nNumThreads, pfnProgress,
+                pProgressData);
         }
     }
 
@@ -15,9 +15,20 @@
 #include "gdal.h"
 #include "cpl_string.h"
 #include "cpl_multiproc.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
 #include "commonutils.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils_priv.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
 /************************************************************************/
 /*                               GDALExit()                             */
 /*  This function exits and cleans up GDAL and OGR resources            */
@@ -51,6 +62,166 @@ static void Usage()
     GDALExit(1);
 }
 
+/************************************************************************/
+/*                       GDALInfoOpenSubdataset()                       */
+/************************************************************************/
+
+/** Return the subdataset of index nSubdataset of hDataset, which is closed,
+ * or hDataset itself if there is no such subdataset, in which case a warning
+ * is stored in osWarning.
+ */
+static GDALDatasetH GDALInfoOpenSubdataset(GDALDatasetH hDataset,
+                                           int nSubdataset,
+                                           std::string &osWarning)
+{
+    char **papszSubdatasets = GDALGetMetadata(hDataset, "SUBDATASETS");
+    const int nSubdatasets = CSLCount(papszSubdatasets) / 2;
+
+    if (nSubdatasets > 0 && nSubdataset <= nSubdatasets)
+    {
+        char szKeyName[1024];
+        char *pszSubdatasetName;
+
+        snprintf(szKeyName, sizeof(szKeyName), "SUBDATASET_%d_NAME",
+                 nSubdataset);
+        szKeyName[sizeof(szKeyName) - 1] = '\0';
+        pszSubdatasetName =
+            CPLStrdup(CSLFetchNameValue(papszSubdatasets, szKeyName));
+        GDALClose(hDataset);
+        hDataset = GDALOpen(pszSubdatasetName, GA_ReadOnly);
+        CPLFree(pszSubdatasetName);
+    }
+    else
+    {
+        osWarning = CPLSPrintf("subdataset %d of %d requested. "
+                               "Reading the main dataset.",
+                               nSubdataset, nSubdatasets);
+    }
+    return hDataset;
+}
+
+/************************************************************************/
+/*                      GDALInfoProcessDatasets()                       */
+/************************************************************************/
+
+/** Report on several datasets, in worker threads of the global thread pool
+ * if -num_threads is greater than 1.
+ *
+ * Reports and errors are printed in the order of the input datasets. At most
+ * 2 * nThreads reports are pending at the same time, which bounds the memory
+ * usage whatever the number of datasets.
+ *
+ * @return the exit code.
+ */
+static int
+GDALInfoProcessDatasets(const GDALInfoOptionsForBinary &sOptionsForBinary,
+                        const GDALInfoOptions *psOptions)
+{
+    struct Job
+    {
+        std::string osFilename{};
+        std::string osOutput{};
+        std::string osWarning{};
+        CPLErrorAccumulator oErrors{};
+        bool bOpened = false;
+        bool bDone = false;
+    };
+
+    const char *pszNumThreads =
+        sOptionsForBinary.osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : sOptionsForBinary.osNumThreads.c_str();
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : std::clamp(atoi(pszNumThreads), 1, 1024);
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::unique_ptr<CPLJobQueue> poQueue;
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poQueue = poThreadPool->CreateJobQueue();
+    }
+
+    const auto RunJob = [&sOptionsForBinary, psOptions, &oMutex,
+                         &oCV](const std::shared_ptr<Job> &poJob)
+    {
+        {
+            auto oAccumulator = poJob->oErrors.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            GDALDatasetH hDataset = GDALOpenEx(
+                poJob->osFilename.c_str(),
+                GDAL_OF_READONLY | GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+                sOptionsForBinary.aosAllowedInputDrivers,
+                sOptionsForBinary.aosOpenOptions, nullptr);
+            if (hDataset)
+            {
+                poJob->bOpened = true;
+                if (sOptionsForBinary.nSubdataset > 0)
+                    hDataset = GDALInfoOpenSubdataset(
+                        hDataset, sOptionsForBinary.nSubdataset,
+                        poJob->osWarning);
+
+                char *pszOutput = GDALInfo(hDataset, psOptions);
+                if (pszOutput)
+                    poJob->osOutput = pszOutput;
+                CPLFree(pszOutput);
+
+                // Also writes the .aux.xml file if statistics or histograms
+                // have been computed.
+                GDALClose(hDataset);
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        poJob->bDone = true;
+        oCV.notify_all();
+    };
+
+    const auto &aosFilenames = sOptionsForBinary.aosFilenames;
+    const size_t nMaxPending = 2 * static_cast<size_t>(nThreads);
+    std::deque<std::shared_ptr<Job>> apoJobs;
+    size_t iNext = 0;
+    int nRet = 0;
+    while (iNext < aosFilenames.size() || !apoJobs.empty())
+    {
+        while (iNext < aosFilenames.size() && apoJobs.size() < nMaxPending)
+        {
+            auto poJob = std::make_shared<Job>();
+            poJob->osFilename = aosFilenames[iNext++];
+            apoJobs.push_back(poJob);
+            if (poQueue)
+                poQueue->SubmitJob([&RunJob, poJob]() { RunJob(poJob); });
+            else
+                RunJob(poJob);
+        }
+
+        auto poJob = std::move(apoJobs.front());
+        apoJobs.pop_front();
+        {
+            std::unique_lock oLock(oMutex);
+            oCV.wait(oLock, [&poJob] { return poJob->bDone; });
+        }
+
+        poJob->oErrors.ReplayErrors();
+        if (!poJob->bOpened)
+        {
+            fprintf(stderr, "gdalinfo failed - unable to open '%s'.\n",
+                    poJob->osFilename.c_str());
+            nRet = 1;
+            continue;
+        }
+        if (!poJob->osWarning.empty())
+            fprintf(stderr, "gdalinfo warning: %s\n",
+                    poJob->osWarning.c_str());
+        printf("%s", poJob->osOutput.c_str());
+    }
+
+    return nRet;
+}
+
 /************************************************************************/
 /*                                main()                                */
 /************************************************************************/
@@ -90,6 +261,23 @@ MAIN_START(argc, argv)
         Usage();
     }
 
+    if (sOptionsForBinary.aosFilenames.size() > 1)
+    {
+        const int nRet =
+            GDALInfoProcessDatasets(sOptionsForBinary, psOptions.get());
+        psOptions.reset();
+
+        GDALDumpOpenDatasets(stderr);
+
+        GDALDestroyDriverManager();
+
+        CPLDumpSharedList(nullptr);
+
+        GDALDestroy();
+
+        exit(nRet);
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Open dataset.                                                   */
 /* -------------------------------------------------------------------- */
@@ -189,31 +377,11 @@ MAIN_START(argc, argv)
          */
         if (sOptionsForBinary.nSubdataset > 0)
         {
-            char **papszSubdatasets = GDALGetMetadata(hDataset, "SUBDATASETS");
-            const int nSubdatasets = CSLCount(papszSubdatasets) / 2;
-
-            if (nSubdatasets > 0 &&
-                sOptionsForBinary.nSubdataset <= nSubdatasets)
-            {
-                char szKeyName[1024];
-                char *pszSubdatasetName;
-
-                snprintf(szKeyName, sizeof(szKeyName), "SUBDATASET_%d_NAME",
-                         sOptionsForBinary.nSubdataset);
-                szKeyName[sizeof(szKeyName) - 1] = '\0';
-                pszSubdatasetName =
-                    CPLStrdup(CSLFetchNameValue(papszSubdatasets, szKeyName));
-                GDALClose(hDataset);
-                hDataset = GDALOpen(pszSubdatasetName, GA_ReadOnly);
-                CPLFree(pszSubdatasetName);
-            }
-            else
-            {
-                fprintf(stderr,
-                        "gdalinfo warning: subdataset %d of %d requested. "
-                        "Reading the main dataset.\n",
-                        sOptionsForBinary.nSubdataset, nSubdatasets);
-            }
+            std::string osWarning;
+            hDataset = GDALInfoOpenSubdataset(
+                hDataset, sOptionsForBinary.nSubdataset, osWarning);
+            if (!osWarning.empty())
+                fprintf(stderr, "gdalinfo warning: %s\n", osWarning.c_str());
         }
 
         char *pszGDALInfoOutput = GDALInfo(hDataset, psOptions.get());
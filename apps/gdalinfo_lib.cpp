@@ -126,6 +126,10 @@ struct GDALInfoOptions
     std::string osWKTFormat = "WKT2";
 
     bool bStdoutOutput = false;
+
+    /*! whether to display the progress of histogram computation (in text
+        mode) */
+    bool bShowProgress = true;
 };
 
 static int GDALInfoReportCorner(const GDALInfoOptions *psOptions,
@@ -141,6 +145,10 @@ static void GDALInfoReportMetadata(const GDALInfoOptions *psOptions,
                                    bool bJson, json_object *poMetadata,
                                    CPLString &osStr);
 
+static void GDALInfoComputeStatisticsAndHistogram(GDALRasterBandH hBand,
+                                                  bool bApproxStats,
+                                                  GDALProgressFunc pfnProgress);
+
 #ifndef Concat_defined
 #define Concat_defined
 static void Concat(CPLString &osRet, bool bStdoutOutput, const char *pszFormat,
@@ -345,10 +353,23 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
 
     if (psOptionsForBinary)
     {
+        argParser->add_argument("-num_threads")
+            .metavar("<value>|ALL_CPUS")
+            .store_into(psOptionsForBinary->osNumThreads)
+            .help(_("Number of threads used to process input datasets, when "
+                    "several are specified."));
+
         argParser->add_argument("dataset_name")
             .metavar("<dataset_name>")
-            .store_into(psOptionsForBinary->osFilename)
-            .help("Input dataset.");
+            .nargs(argparse::nargs_pattern::at_least_one)
+            .action(
+                [psOptionsForBinary](const std::string &s)
+                {
+                    if (psOptionsForBinary->aosFilenames.empty())
+                        psOptionsForBinary->osFilename = s;
+                    psOptionsForBinary->aosFilenames.push_back(s);
+                })
+            .help(_("Input dataset(s)."));
     }
 
     return argParser;
@@ -1232,10 +1253,19 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
             }
         }
 
+        GDALProgressFunc pfnHistogramProgress =
+            bJson || !psOptions->bShowProgress ? GDALDummyProgress
+                                               : GDALTermProgress;
+
         double dfMinStat = 0.0;
         double dfMaxStat = 0.0;
         double dfMean = 0.0;
         double dfStdDev = 0.0;
+        if (psOptions->bStats && psOptions->bReportHistograms)
+        {
+            GDALInfoComputeStatisticsAndHistogram(
+                hBand, psOptions->bApproxStats, pfnHistogramProgress);
+        }
         CPLErr eErr = GDALGetRasterStatistics(hBand, psOptions->bApproxStats,
                                               psOptions->bStats, &dfMinStat,
                                               &dfMaxStat, &dfMean, &dfStdDev);
@@ -1295,14 +1325,9 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
             int nBucketCount = 0;
             GUIntBig *panHistogram = nullptr;
 
-            if (bJson)
-                eErr = GDALGetDefaultHistogramEx(
-                    hBand, &dfMinStat, &dfMaxStat, &nBucketCount, &panHistogram,
-                    TRUE, GDALDummyProgress, nullptr);
-            else
-                eErr = GDALGetDefaultHistogramEx(
-                    hBand, &dfMinStat, &dfMaxStat, &nBucketCount, &panHistogram,
-                    TRUE, GDALTermProgress, nullptr);
+            eErr = GDALGetDefaultHistogramEx(
+                hBand, &dfMinStat, &dfMaxStat, &nBucketCount, &panHistogram,
+                TRUE, pfnHistogramProgress, nullptr);
             if (eErr == CE_None)
             {
                 json_object *poHistogram = nullptr;
@@ -2272,6 +2297,43 @@ static void GDALInfoReportMetadata(const GDALInfoOptions *psOptions,
                           bJson, poMetadata, osStr);
 }
 
+/************************************************************************/
+/*                GDALInfoComputeStatisticsAndHistogram()               */
+/************************************************************************/
+
+/** When neither statistics nor the default histogram are available yet,
+ * compute both of them with a single pass over the pixels if the band
+ * supports it. They are then retrieved as usual by the caller.
+ */
+static void GDALInfoComputeStatisticsAndHistogram(GDALRasterBandH hBand,
+                                                  bool bApproxStats,
+                                                  GDALProgressFunc pfnProgress)
+{
+    auto poBand = GDALRasterBand::FromHandle(hBand);
+
+    // Approximate statistics would be computed on an overview
+    if (bApproxStats && poBand->GetOverviewCount() > 0)
+        return;
+
+    double dfMin = 0;
+    double dfMax = 0;
+    if (poBand->GetStatistics(bApproxStats, /* bForce = */ FALSE, &dfMin,
+                              &dfMax, nullptr, nullptr) != CE_Warning)
+        return;
+
+    int nBucketCount = 0;
+    GUIntBig *panHistogram = nullptr;
+    const CPLErr eErr = poBand->GetDefaultHistogram(
+        &dfMin, &dfMax, &nBucketCount, &panHistogram, /* bForce = */ FALSE,
+        nullptr, nullptr);
+    CPLFree(panHistogram);
+    if (eErr != CE_Warning)
+        return;
+
+    CPL_IGNORE_RET_VAL(
+        poBand->ComputeStatisticsAndDefaultHistogram(pfnProgress, nullptr));
+}
+
 /************************************************************************/
 /*                             GDALInfoOptionsNew()                     */
 /************************************************************************/
@@ -2333,6 +2395,14 @@ GDALInfoOptionsNew(char **papszArgv,
     if (!psOptions->bShowNodata)
         psOptions->bShowMask = false;
 
+    if (psOptionsForBinary && psOptionsForBinary->aosFilenames.size() > 1)
+    {
+        // Reports of several datasets are collected by gdalinfo_bin.cpp
+        // and printed in input order.
+        psOptions->bStdoutOutput = false;
+        psOptions->bShowProgress = false;
+    }
+
     return psOptions.release();
 }
 
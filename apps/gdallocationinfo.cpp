@@ -38,6 +38,225 @@ static std::string GetSRSAsWKT(const char *pszUserInput)
     return oSRS.exportToWkt();
 }
 
+/************************************************************************/
+/*                          ProcessBulkInput()                          */
+/************************************************************************/
+
+// Read the input coordinates from stdin by chunks of points, and report the
+// pixel values in -valonly mode, sampling all the points of a chunk at once
+// with GDALRasterInterpolateAtPoints().
+static int ProcessBulkInput(GDALDatasetH hSrcDS,
+                            OGRCoordinateTransformationH hCT,
+                            bool bUseGeoTransform,
+                            const std::vector<int> &anBandList, int nOverview,
+                            GDALRIOResampleAlg eInterpolation,
+                            const std::string &osFieldSep, bool bEcho,
+                            bool bIgnoreExtraInput)
+{
+    double adfInvGeoTransform[6] = {0, 1, 0, 0, 0, 1};
+    if (bUseGeoTransform)
+    {
+        double adfGeoTransform[6] = {};
+        if (GDALGetGeoTransform(hSrcDS, adfGeoTransform) != CE_None)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot get geotransform");
+            return 1;
+        }
+        if (!GDALInvGeoTransform(adfGeoTransform, adfInvGeoTransform))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot invert geotransform");
+            return 1;
+        }
+    }
+
+    const int nRasterXSize = GDALGetRasterXSize(hSrcDS);
+    const int nRasterYSize = GDALGetRasterYSize(hSrcDS);
+    const int nBands = static_cast<int>(anBandList.size());
+
+    constexpr size_t CHUNK_SIZE = 1000 * 1000;
+    std::vector<double> adfXIn, adfYIn, adfX, adfY, adfPixel, adfLine;
+    std::vector<double> adfPixelToQuery, adfLineToQuery;
+    std::vector<std::string> aosExtraContent;
+    std::vector<int> abTransformOK, abInRaster;
+    std::vector<double> adfReal, adfImag;
+    std::vector<std::vector<int>> aanSuccess(nBands);
+    std::vector<std::vector<std::string>> aaosValues(nBands);
+
+    int nRetCode = 0;
+    int nLine = 0;
+    char szLine[1024];
+    bool bEOF = false;
+    while (!bEOF)
+    {
+        adfXIn.clear();
+        adfYIn.clear();
+        aosExtraContent.clear();
+        while (adfXIn.size() < CHUNK_SIZE)
+        {
+            if (!fgets(szLine, sizeof(szLine) - 1, stdin))
+            {
+                bEOF = true;
+                break;
+            }
+            const CPLStringList aosTokens(CSLTokenizeString(szLine));
+            const int nCount = aosTokens.size();
+            ++nLine;
+            if (nCount < 2)
+            {
+                fprintf(stderr, "Not enough values at line %d\n", nLine);
+                continue;
+            }
+            adfXIn.push_back(CPLAtof(aosTokens[0]));
+            adfYIn.push_back(CPLAtof(aosTokens[1]));
+            std::string osExtraContent;
+            if (!bIgnoreExtraInput)
+            {
+                for (int i = 2; i < nCount; ++i)
+                {
+                    if (!osExtraContent.empty())
+                        osExtraContent += ' ';
+                    osExtraContent += aosTokens[i];
+                }
+                while (!osExtraContent.empty() &&
+                       isspace(static_cast<int>(osExtraContent.back())))
+                {
+                    osExtraContent.pop_back();
+                }
+            }
+            aosExtraContent.push_back(std::move(osExtraContent));
+        }
+
+        const size_t nPoints = adfXIn.size();
+        if (nPoints == 0)
+            break;
+
+        // Turn the locations into pixel and line locations.
+        adfX = adfXIn;
+        adfY = adfYIn;
+        abTransformOK.assign(nPoints, TRUE);
+        if (hCT)
+        {
+            OCTTransformEx(hCT, static_cast<int>(nPoints), adfX.data(),
+                           adfY.data(), nullptr, abTransformOK.data());
+        }
+        adfPixel.resize(nPoints);
+        adfLine.resize(nPoints);
+        abInRaster.resize(nPoints);
+        for (size_t j = 0; j < nPoints; ++j)
+        {
+            adfPixel[j] = adfInvGeoTransform[0] +
+                          adfInvGeoTransform[1] * adfX[j] +
+                          adfInvGeoTransform[2] * adfY[j];
+            adfLine[j] = adfInvGeoTransform[3] +
+                         adfInvGeoTransform[4] * adfX[j] +
+                         adfInvGeoTransform[5] * adfY[j];
+            const double dfPixelFloor = floor(adfPixel[j]);
+            const double dfLineFloor = floor(adfLine[j]);
+            abInRaster[j] = abTransformOK[j] && dfPixelFloor >= 0 &&
+                            dfLineFloor >= 0 && dfPixelFloor < nRasterXSize &&
+                            dfLineFloor < nRasterYSize;
+        }
+
+        // Sample each band at all points at once.
+        for (int i = 0; i < nBands; i++)
+        {
+            aanSuccess[i].assign(nPoints, FALSE);
+            aaosValues[i].resize(nPoints);
+
+            GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, anBandList[i]);
+            double dfXRatio = 1.0;
+            double dfYRatio = 1.0;
+            if (nOverview >= 0 && hBand != nullptr)
+            {
+                GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
+                if (hOvrBand != nullptr)
+                {
+                    dfXRatio = static_cast<double>(
+                                   GDALGetRasterBandXSize(hOvrBand)) /
+                               nRasterXSize;
+                    dfYRatio = static_cast<double>(
+                                   GDALGetRasterBandYSize(hOvrBand)) /
+                               nRasterYSize;
+                }
+                else
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot get overview %d of band %d", nOverview + 1,
+                             anBandList[i]);
+                }
+                hBand = hOvrBand;
+            }
+            if (hBand == nullptr)
+                continue;
+
+            adfPixelToQuery.resize(nPoints);
+            adfLineToQuery.resize(nPoints);
+            for (size_t j = 0; j < nPoints; ++j)
+            {
+                // Points outside of the raster are not queried.
+                adfPixelToQuery[j] =
+                    abInRaster[j] ? adfPixel[j] * dfXRatio
+                                  : std::numeric_limits<double>::quiet_NaN();
+                adfLineToQuery[j] = adfLine[j] * dfYRatio;
+            }
+
+            const bool bIsComplex = CPL_TO_BOOL(
+                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
+            adfReal.resize(nPoints);
+            adfImag.resize(nPoints);
+            CPL_IGNORE_RET_VAL(GDALRasterInterpolateAtPoints(
+                hBand, nPoints, adfPixelToQuery.data(), adfLineToQuery.data(),
+                eInterpolation, adfReal.data(), adfImag.data(),
+                aanSuccess[i].data()));
+            for (size_t j = 0; j < nPoints; ++j)
+            {
+                if (!aanSuccess[i][j])
+                    continue;
+                if (bIsComplex)
+                    aaosValues[i][j] = CPLSPrintf("%.15g+%.15gi", adfReal[j],
+                                                  adfImag[j]);
+                else
+                    aaosValues[i][j] = CPLSPrintf("%.15g", adfReal[j]);
+            }
+        }
+
+        // Report values, in the order of the input points.
+        for (size_t j = 0; j < nPoints; ++j)
+        {
+            if (bEcho)
+            {
+                printf("%.15g%s%.15g%s", adfXIn[j], osFieldSep.c_str(),
+                       adfYIn[j], osFieldSep.c_str());
+            }
+            if (!abInRaster[j])
+            {
+                for (int i = 1; i < nBands; i++)
+                {
+                    printf("%s", osFieldSep.c_str());
+                }
+                nRetCode = 1;
+            }
+            else
+            {
+                for (int i = 0; i < nBands; i++)
+                {
+                    if (!aanSuccess[i][j])
+                        continue;
+                    if (i > 0)
+                        printf("%s", osFieldSep.c_str());
+                    printf("%s", aaosValues[i][j].c_str());
+                }
+            }
+            if (!aosExtraContent[j].empty() && osFieldSep != "\n")
+                printf("%s%s", osFieldSep.c_str(), aosExtraContent[j].c_str());
+            printf("\n");
+        }
+    }
+
+    return nRetCode;
+}
+
 /************************************************************************/
 /*                                main()                                */
 /************************************************************************/
@@ -57,6 +276,7 @@ MAIN_START(argc, argv)
     std::string osFieldSep;
     bool bIgnoreExtraInput = false;
     bool bEcho = false;
+    bool bBulk = false;
 
     GDALAllRegister();
     argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
@@ -105,6 +325,12 @@ MAIN_START(argc, argv)
         .help(_("Set this flag to avoid extra non-numeric content at end of "
                 "input lines."));
 
+    argParser.add_argument("-bulk")
+        .flag()
+        .store_into(bBulk)
+        .help(_("Read all input points from the standard input before "
+                "querying them, in -valonly mode."));
+
     argParser.add_argument("-b")
         .append()
         .metavar("<band>")
@@ -221,6 +447,18 @@ MAIN_START(argc, argv)
         exit(1);
     }
 
+    if (bBulk && !bValOnly)
+    {
+        fprintf(stderr, "-bulk can only be used with -valonly\n");
+        exit(1);
+    }
+    if (bBulk && bIsXYSpecifiedAsArgument)
+    {
+        fprintf(stderr, "-bulk can only be used when points are read from "
+                        "the standard input\n");
+        exit(1);
+    }
+
     if (osFieldSep.empty())
     {
         osFieldSep = "\n";
@@ -290,8 +528,16 @@ MAIN_START(argc, argv)
     char szLine[1024];
     int nLine = 0;
     std::string osExtraContent;
+    int nRetCode = 0;
 
-    if (std::isnan(dfGeoX))
+    if (bBulk)
+    {
+        nRetCode = ProcessBulkInput(hSrcDS, hCT, !osSourceSRS.empty(),
+                                    anBandList, nOverview, eInterpolation,
+                                    osFieldSep, bEcho, bIgnoreExtraInput);
+        inputAvailable = false;
+    }
+    else if (std::isnan(dfGeoX))
     {
         // Is it an interactive terminal ?
         if (CPLIsInteractive(stdin))
@@ -345,7 +591,6 @@ MAIN_START(argc, argv)
         }
     }
 
-    int nRetCode = 0;
     while (inputAvailable)
     {
         int iPixel, iLine;
@@ -23,13 +23,17 @@
 #include "ogr_spatialref.h"
 #include "commonutils.h"
 #include "gdalargumentparser.h"
+#include "gdaldatasetprefetcher.h"
 
 #include <ctype.h>
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <limits>
+#include <map>
 #include <set>
+#include <vector>
 
 typedef enum
 {
@@ -84,6 +88,10 @@ struct GDALTileIndexOptions
     double dfMaxPixelSize = std::numeric_limits<double>::quiet_NaN();
     std::vector<GDALTileIndexRasterMetadata> aoFetchMD{};
     std::set<std::string> oSetFilenameFilters{};
+    std::string osNumThreads{};
+    bool bSync = false;
+    std::string osMTimeFieldName{};
+    bool bFootprint = false;
 };
 
 /************************************************************************/
@@ -173,6 +181,19 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .store_into(psOptions->bOverwrite)
         .help(_("Overwrite the output tile index file if it already exists."));
 
+    argParser->add_argument("-sync")
+        .flag()
+        .store_into(psOptions->bSync)
+        .help(_("Synchronize an existing tile index with the input files: "
+                "remove entries of files no longer listed, and re-index "
+                "modified files."));
+
+    argParser->add_argument("-mtime_field")
+        .metavar("<field_name>")
+        .store_into(psOptions->osMTimeFieldName)
+        .help(_("Name of the field in the tile index file where the "
+                "modification time of source files will be stored."));
+
     argParser->add_argument("-recursive")
         .flag()
         .store_into(psOptions->bRecursive)
@@ -198,6 +219,17 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .help(_("Maximum pixel size in term of geospatial extent per pixel "
                 "(resolution) that a raster should have to be selected."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to open input datasets."));
+
+    argParser->add_argument("-footprint")
+        .flag()
+        .store_into(psOptions->bFootprint)
+        .help(_("Use the footprint of valid pixels of rasters as geometry, "
+                "instead of their extent."));
+
     argParser->add_output_format_argument(psOptions->osFormat);
 
     argParser->add_argument("-tileindex")
@@ -376,6 +408,10 @@ struct GDALTileIndexTileIterator
     int iCurSrc = 0;
     VSIDIR *psDir = nullptr;
 
+    // Modification time of the file returned by the last call to next()
+    bool bMTimeKnown = false;
+    GIntBig nMTime = 0;
+
     CPL_DISALLOW_COPY_ASSIGN(GDALTileIndexTileIterator)
 
     GDALTileIndexTileIterator(const GDALTileIndexOptions *psOptionsIn,
@@ -396,6 +432,8 @@ struct GDALTileIndexTileIterator
 
     std::string next()
     {
+        bMTimeKnown = false;
+        nMTime = 0;
         while (true)
         {
             if (!psDir)
@@ -407,8 +445,9 @@ struct GDALTileIndexTileIterator
 
                 VSIStatBufL sStatBuf;
                 const std::string osCurName = papszSrcDSNames[iCurSrc++];
-                if (VSIStatL(osCurName.c_str(), &sStatBuf) == 0 &&
-                    VSI_ISDIR(sStatBuf.st_mode))
+                const bool bStatOK =
+                    VSIStatL(osCurName.c_str(), &sStatBuf) == 0;
+                if (bStatOK && VSI_ISDIR(sStatBuf.st_mode))
                 {
                     auto poSrcDS = std::unique_ptr<GDALDataset>(
                         GDALDataset::Open(osCurName.c_str(), GDAL_OF_RASTER,
@@ -429,6 +468,11 @@ struct GDALTileIndexTileIterator
                 }
                 else
                 {
+                    if (bStatOK)
+                    {
+                        bMTimeKnown = true;
+                        nMTime = static_cast<GIntBig>(sStatBuf.st_mtime);
+                    }
                     return osCurName;
                 }
             }
@@ -470,12 +514,64 @@ struct GDALTileIndexTileIterator
                 continue;
             }
 
+            bMTimeKnown = CPL_TO_BOOL(psEntry->bMTimeKnown);
+            nMTime = psEntry->nMTime;
             return osFilename;
         }
         return std::string();
     }
 };
 
+/************************************************************************/
+/*                      GDALTileIndexGetFootprint()                     */
+/************************************************************************/
+
+/** Return the footprint of the valid pixels of poSrcDS, in the target SRS
+ * if not empty, or nullptr if it is empty or in case of error.
+ */
+static std::unique_ptr<OGRGeometry>
+GDALTileIndexGetFootprint(GDALDataset *poSrcDS, const std::string &osTargetSRS,
+                          const std::string &osNumThreads)
+{
+    CPLStringList aosArgv;
+    aosArgv.AddString("-no_location");
+    if (!osTargetSRS.empty())
+    {
+        aosArgv.AddString("-t_srs");
+        aosArgv.AddString(osTargetSRS.c_str());
+    }
+    if (!osNumThreads.empty())
+    {
+        aosArgv.AddString("-num_threads");
+        aosArgv.AddString(osNumThreads.c_str());
+    }
+    std::unique_ptr<GDALFootprintOptions, decltype(&GDALFootprintOptionsFree)>
+        psFootprintOptions(GDALFootprintOptionsNew(aosArgv.List(), nullptr),
+                           GDALFootprintOptionsFree);
+    auto poMemDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!psFootprintOptions || !poMemDriver)
+        return nullptr;
+
+    auto poMemDS = std::unique_ptr<GDALDataset>(
+        poMemDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+    if (!poMemDS ||
+        !GDALFootprint(nullptr, GDALDataset::ToHandle(poMemDS.get()),
+                       GDALDataset::ToHandle(poSrcDS), psFootprintOptions.get(),
+                       nullptr))
+    {
+        return nullptr;
+    }
+
+    auto poFeature = std::unique_ptr<OGRFeature>(
+        poMemDS->GetLayer(0)->GetNextFeature());
+    if (!poFeature || !poFeature->GetGeometryRef() ||
+        poFeature->GetGeometryRef()->IsEmpty())
+    {
+        return nullptr;
+    }
+    return std::unique_ptr<OGRGeometry>(poFeature->StealGeometry());
+}
+
 /************************************************************************/
 /*                           GDALTileIndex()                            */
 /************************************************************************/
@@ -706,7 +802,8 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         }
 
         poLayer = poTileIndexDS->CreateLayer(
-            osLayerName.c_str(), oSRS.IsEmpty() ? nullptr : &oSRS, wkbPolygon,
+            osLayerName.c_str(), oSRS.IsEmpty() ? nullptr : &oSRS,
+            psOptions->bFootprint ? wkbMultiPolygon : wkbPolygon,
             psOptions->aosLCO.List());
         if (!poLayer)
             return nullptr;
@@ -739,6 +836,23 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         }
     }
 
+    if (!psOptions->osMTimeFieldName.empty() &&
+        poLayerDefn->GetFieldIndex(psOptions->osMTimeFieldName.c_str()) < 0)
+    {
+        OGRFieldDefn oField(psOptions->osMTimeFieldName.c_str(), OFTInteger64);
+        if (poLayer->CreateField(&oField) != OGRERR_NONE)
+            return nullptr;
+    }
+
+    if (psOptions->bSync && bExistingLayer &&
+        !poLayer->TestCapability(OLCDeleteFeature))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "-sync requires the tile index layer to support deleting "
+                 "features.");
+        return nullptr;
+    }
+
     if (!psOptions->osGTIFilename.empty())
     {
         if (!psOptions->aosMetadata.empty())
@@ -932,8 +1046,23 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         }
     }
 
+    const int i_MTime =
+        psOptions->osMTimeFieldName.empty()
+            ? -1
+            : poLayerDefn->GetFieldIndex(psOptions->osMTimeFieldName.c_str());
+
     // Load in memory existing file names in tile index.
-    std::set<std::string> oSetExistingFiles;
+    struct ExistingFile
+    {
+        GIntBig nFID = OGRNullFID;
+        bool bMTimeKnown = false;
+        GIntBig nMTime = 0;
+        // Whether it has been found again in the input files (-sync mode)
+        bool bListed = false;
+    };
+
+    std::map<std::string, ExistingFile> oMapExistingFiles;
+    std::vector<GIntBig> anFIDsToDelete;
     OGRSpatialReference oAlreadyExistingSRS;
     if (bExistingLayer)
     {
@@ -941,7 +1070,7 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         {
             if (poFeature->IsFieldSetAndNotNull(ti_field))
             {
-                if (oSetExistingFiles.empty())
+                if (oMapExistingFiles.empty())
                 {
                     auto poSrcDS =
                         std::unique_ptr<GDALDataset>(GDALDataset::Open(
@@ -954,7 +1083,21 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
                             oAlreadyExistingSRS = *poSrcSRS;
                     }
                 }
-                oSetExistingFiles.insert(poFeature->GetFieldAsString(ti_field));
+                ExistingFile oExisting;
+                oExisting.nFID = poFeature->GetFID();
+                if (i_MTime >= 0 && poFeature->IsFieldSetAndNotNull(i_MTime))
+                {
+                    oExisting.bMTimeKnown = true;
+                    oExisting.nMTime = poFeature->GetFieldAsInteger64(i_MTime);
+                }
+                const bool bInserted =
+                    oMapExistingFiles
+                        .insert({poFeature->GetFieldAsString(ti_field),
+                                 oExisting})
+                        .second;
+                // In -sync mode, remove duplicated entries
+                if (!bInserted && psOptions->bSync)
+                    anFIDsToDelete.push_back(oExisting.nFID);
             }
         }
     }
@@ -983,44 +1126,115 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         psOptions->bMaskBand || !psOptions->aosMetadata.empty() ||
         !psOptions->osGTIFilename.empty();
 
+    /* -------------------------------------------------------------------- */
+    /*      List the GDAL files to process, and open them ahead in worker   */
+    /*      threads if asked to. They are processed in their listing order. */
+    /* -------------------------------------------------------------------- */
+    struct SourceFile
+    {
+        std::string osSrcFilename{};
+        std::string osFileNameToWrite{};
+        bool bAlreadyInIndex = false;
+        bool bMTimeKnown = false;
+        GIntBig nMTime = 0;
+        // FID of the entry of a modified file to replace (-sync mode)
+        GIntBig nFIDToReplace = OGRNullFID;
+    };
+
+    std::deque<SourceFile> aoSourceFiles;
+    bool bNoMoreSourceFiles = false;
+    GDALDatasetPrefetcher oPrefetcher(
+        GDALDatasetPrefetcher::GetNumThreads(psOptions->osNumThreads),
+        GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr);
+
+    const auto ListSourceFiles = [&]()
+    {
+        while (!bNoMoreSourceFiles &&
+               (aoSourceFiles.empty() || oPrefetcher.CanSubmit()))
+        {
+            SourceFile oFile;
+            oFile.osSrcFilename = oGDALTileIndexTileIterator.next();
+            if (oFile.osSrcFilename.empty())
+            {
+                bNoMoreSourceFiles = true;
+                break;
+            }
+
+            VSIStatBuf sStatBuf;
+
+            // Make sure it is a file before building absolute path name.
+            if (!osCurrentPath.empty() &&
+                CPLIsFilenameRelative(oFile.osSrcFilename.c_str()) &&
+                VSIStat(oFile.osSrcFilename.c_str(), &sStatBuf) == 0)
+            {
+                oFile.osFileNameToWrite = CPLProjectRelativeFilenameSafe(
+                    osCurrentPath.c_str(), oFile.osSrcFilename.c_str());
+            }
+            else
+            {
+                oFile.osFileNameToWrite = oFile.osSrcFilename;
+            }
+
+            oFile.bMTimeKnown = oGDALTileIndexTileIterator.bMTimeKnown;
+            oFile.nMTime = oGDALTileIndexTileIterator.nMTime;
+
+            auto oIter = oMapExistingFiles.find(oFile.osFileNameToWrite);
+            if (oIter != oMapExistingFiles.end())
+            {
+                auto &oExisting = oIter->second;
+                oExisting.bListed = true;
+                if (psOptions->bSync && i_MTime >= 0 && oFile.bMTimeKnown &&
+                    (!oExisting.bMTimeKnown ||
+                     oExisting.nMTime != oFile.nMTime))
+                {
+                    oFile.nFIDToReplace = oExisting.nFID;
+                }
+                else
+                {
+                    oFile.bAlreadyInIndex = true;
+                }
+            }
+            if (!oFile.bAlreadyInIndex && oPrefetcher.CanSubmit())
+                oPrefetcher.Submit(oFile.osSrcFilename);
+            aoSourceFiles.push_back(std::move(oFile));
+        }
+    };
+
     /* -------------------------------------------------------------------- */
     /*      loop over GDAL files, processing.                               */
     /* -------------------------------------------------------------------- */
     while (true)
     {
-        const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
-        if (osSrcFilename.empty())
+        ListSourceFiles();
+        if (aoSourceFiles.empty())
             break;
+        const SourceFile oFile = std::move(aoSourceFiles.front());
+        aoSourceFiles.pop_front();
+        const std::string &osSrcFilename = oFile.osSrcFilename;
+        const std::string &osFileNameToWrite = oFile.osFileNameToWrite;
 
-        std::string osFileNameToWrite;
-        VSIStatBuf sStatBuf;
-
-        // Make sure it is a file before building absolute path name.
-        if (!osCurrentPath.empty() &&
-            CPLIsFilenameRelative(osSrcFilename.c_str()) &&
-            VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
-        {
-            osFileNameToWrite = CPLProjectRelativeFilenameSafe(
-                osCurrentPath.c_str(), osSrcFilename.c_str());
-        }
-        else
+        // Checks that file is not already in tileindex.
+        if (oFile.bAlreadyInIndex)
         {
-            osFileNameToWrite = osSrcFilename.c_str();
+            if (!psOptions->bSync)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "File %s is already in tileindex. Skipping it.",
+                         osFileNameToWrite.c_str());
+            }
+            continue;
         }
 
-        // Checks that file is not already in tileindex.
-        if (oSetExistingFiles.find(osFileNameToWrite) !=
-            oSetExistingFiles.end())
+        // Remove the outdated entry of a modified file
+        if (oFile.nFIDToReplace != OGRNullFID &&
+            poLayer->DeleteFeature(oFile.nFIDToReplace) != OGRERR_NONE)
         {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "File %s is already in tileindex. Skipping it.",
-                     osFileNameToWrite.c_str());
-            continue;
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to delete feature in tile index.");
+            return nullptr;
         }
 
-        auto poSrcDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-            osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-            nullptr, nullptr, nullptr));
+        auto poSrcDS = oPrefetcher.Get(osSrcFilename);
         if (poSrcDS == nullptr)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
@@ -1172,6 +1386,8 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
 
         auto poFeature = std::make_unique<OGRFeature>(poLayerDefn);
         poFeature->SetField(ti_field, osFileNameToWrite.c_str());
+        if (i_MTime >= 0 && oFile.bMTimeKnown)
+            poFeature->SetField(i_MTime, oFile.nMTime);
 
         if (i_SrcSRSName >= 0 && poSrcSRS)
         {
@@ -1271,12 +1487,37 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
             }
         }
 
-        auto poPoly = std::make_unique<OGRPolygon>();
-        auto poRing = std::make_unique<OGRLinearRing>();
-        for (int k = 0; k < 5; k++)
-            poRing->addPoint(adfX[k], adfY[k]);
-        poPoly->addRing(std::move(poRing));
-        poFeature->SetGeometryDirectly(poPoly.release());
+        if (psOptions->bFootprint)
+        {
+            auto poGeom = GDALTileIndexGetFootprint(
+                poSrcDS.get(), oTargetSRS.IsEmpty() ? std::string()
+                                                    : psOptions->osTargetSRS,
+                psOptions->osNumThreads);
+            if (!poGeom)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Cannot compute footprint of %s, skipping.",
+                         osSrcFilename.c_str());
+                continue;
+            }
+            if (wkbFlatten(poLayer->GetGeomType()) == wkbPolygon &&
+                poGeom->getGeometryType() == wkbMultiPolygon &&
+                poGeom->toMultiPolygon()->getNumGeometries() == 1)
+            {
+                poGeom.reset(poGeom->toMultiPolygon()->getGeometryRef(0)
+                                 ->clone());
+            }
+            poFeature->SetGeometryDirectly(poGeom.release());
+        }
+        else
+        {
+            auto poPoly = std::make_unique<OGRPolygon>();
+            auto poRing = std::make_unique<OGRLinearRing>();
+            for (int k = 0; k < 5; k++)
+                poRing->addPoint(adfX[k], adfY[k]);
+            poPoly->addRing(std::move(poRing));
+            poFeature->SetGeometryDirectly(poPoly.release());
+        }
 
         if (poLayer->CreateFeature(poFeature.get()) != OGRERR_NONE)
         {
@@ -1286,6 +1527,32 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      In -sync mode, remove entries of files that are no longer       */
+    /*      listed, and duplicated entries.                                 */
+    /* -------------------------------------------------------------------- */
+    if (psOptions->bSync)
+    {
+        for (const auto &[osFilename, oExisting] : oMapExistingFiles)
+        {
+            if (!oExisting.bListed)
+            {
+                CPLDebug("gdaltindex", "Removing %s from tile index",
+                         osFilename.c_str());
+                anFIDsToDelete.push_back(oExisting.nFID);
+            }
+        }
+        for (const GIntBig nFID : anFIDsToDelete)
+        {
+            if (poLayer->DeleteFeature(nFID) != OGRERR_NONE)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to delete feature in tile index.");
+                return nullptr;
+            }
+        }
+    }
+
     return GDALDataset::ToHandle(poTileIndexDS.release());
 }
 
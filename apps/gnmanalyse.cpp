@@ -22,7 +22,9 @@ enum operation
     op_unknown = 0, /** no operation */
     op_dijkstra,    /** create shortest path using Dijkstra algorithm */
     op_kpaths,      /** create k shortest paths using Yens algorithm */
-    op_resource     /** create resource distribution layer */
+    op_resource,    /** create resource distribution layer */
+    op_chpath,      /** create shortest path using contraction hierarchy */
+    op_matrix       /** create many-to-many shortest path costs layer */
 };
 
 /************************************************************************/
@@ -39,6 +41,9 @@ static void Usage(bool bIsError, const char *pszAdditionalMsg = nullptr,
         "                  [kpaths <start_gfid> <end_gfid> <k> "
         "[-alo NAME=VALUE]...]\n"
         "                  [resource [-alo <NAME>=<VALUE>]...]\n"
+        "                  [chpath <start_gfid> <end_gfid> "
+        "[-alo <NAME>=<VALUE>]...]\n"
+        "                  [matrix [-alo <NAME>=<VALUE>]...]\n"
         "                  [-ds <ds_name>][-f <ds_format>][-l <layer_name>]\n"
         "                  [-dsco <NAME>=<VALUE>]... [-lco <NAME>=<VALUE>]...\n"
         "                  <gnm_name>\n");
@@ -68,6 +73,12 @@ static void Usage(bool bIsError, const char *pszAdditionalMsg = nullptr,
             "connected components search is performed using breadth-first "
             "search and starting from that features which are marked by rules "
             "as \'EMITTERS\'\n"
+            "   chpath start_gfid end_gfid: calculates the best path between "
+            "two points using a contraction hierarchy of the network, which "
+            "is much faster than Dijkstra algorithm once built\n"
+            "   matrix: calculates the costs of the best paths between the "
+            "sources and the targets given with -alo source=<gfid> and -alo "
+            "target=<gfid>, using a contraction hierarchy\n"
             "   -ds ds_name: the name&path of the dataset to save the layer "
             "with resulting paths. Not need to be existed dataset\n"
             "   -f ds_format: define this to set the format of newly created "
@@ -454,6 +465,19 @@ MAIN_START(nArgc, papszArgv)
             stOper = op_resource;
         }
 
+        else if (EQUAL(papszArgv[iArg], "chpath"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(2);
+            stOper = op_chpath;
+            nFromFID = atoi(papszArgv[++iArg]);
+            nToFID = atoi(papszArgv[++iArg]);
+        }
+
+        else if (EQUAL(papszArgv[iArg], "matrix"))
+        {
+            stOper = op_matrix;
+        }
+
         else if (EQUAL(papszArgv[iArg], "-ds"))
         {
             CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
@@ -500,7 +524,7 @@ MAIN_START(nArgc, papszArgv)
     // do the work
     // ////////////////////////////////////////////////////////////////
 
-    if (stOper == op_dijkstra)
+    if (stOper == op_dijkstra || stOper == op_chpath)
     {
         if (pszDataSource == nullptr)
             Usage(true, "No network dataset provided");
@@ -519,8 +543,11 @@ MAIN_START(nArgc, papszArgv)
             goto exit;
         }
 
-        poResultLayer =
-            poDS->GetPath(nFromFID, nToFID, GATDijkstraShortestPath, papszALO);
+        poResultLayer = poDS->GetPath(nFromFID, nToFID,
+                                      stOper == op_chpath
+                                          ? GATContractionHierarchyShortestPath
+                                          : GATDijkstraShortestPath,
+                                      papszALO);
         if (nullptr == pszDataset)
         {
             ReportOnLayer(poResultLayer, bQuiet == FALSE);
@@ -580,7 +607,7 @@ MAIN_START(nArgc, papszArgv)
             }
         }
     }
-    else if (stOper == op_resource)
+    else if (stOper == op_resource || stOper == op_matrix)
     {
         if (pszDataSource == nullptr)
             Usage(true, "No network dataset provided");
@@ -596,8 +623,11 @@ MAIN_START(nArgc, papszArgv)
             goto exit;
         }
 
-        poResultLayer =
-            poDS->GetPath(nFromFID, nToFID, GATConnectedComponents, papszALO);
+        poResultLayer = poDS->GetPath(nFromFID, nToFID,
+                                      stOper == op_matrix
+                                          ? GATShortestPathMatrix
+                                          : GATConnectedComponents,
+                                      papszALO);
 
         if (nullptr == pszDataset)
         {
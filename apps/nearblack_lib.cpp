@@ -29,15 +29,17 @@
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #include "nearblack_lib.h"
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
+static void ProcessLine(GByte *pabyLine, GByte *pabyMask, GByte *pabyNonBlack,
+                        int iStart, int iEnd, int nSrcBands, int nDstBands,
                         int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
+                        GByte byReplacedNonBlack, int *panLastLineCounts,
                         bool bDoHorizontalCheck, bool bDoVerticalCheck,
                         bool bBottomUp, int iLineFromTopOrBottom);
 
@@ -318,6 +320,60 @@ GDALDatasetH CPL_DLL GDALNearblack(const char *pszDest, GDALDatasetH hDstDS,
     return hDstDS;
 }
 
+/************************************************************************/
+/*                     GDALNearblackColorMatcher()                      */
+/************************************************************************/
+
+GDALNearblackColorMatcher::GDALNearblackColorMatcher(const Colors &oColors,
+                                                     int nSrcBands,
+                                                     int nNearDist)
+    : m_nColors(static_cast<int>(oColors.size())), m_nSrcBands(nSrcBands)
+{
+    for (const Color &oColor : oColors)
+    {
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
+        {
+            m_anLow.push_back(oColor[iBand] - nNearDist);
+            m_anHigh.push_back(oColor[iBand] + nNearDist);
+        }
+    }
+}
+
+/************************************************************************/
+/*                          ComputeNonBlack()                           */
+/************************************************************************/
+
+/** Set pabyNonBlack[i] to 1 if the i-th pixel is not near any color, or to
+ * 0 otherwise. Tests are branchless and done once per pixel, so that the
+ * callers do not need to re-evaluate them when scanning a line in several
+ * directions.
+ */
+void GDALNearblackColorMatcher::ComputeNonBlack(const GByte *pabyPixels,
+                                                int nPixels, int nPixelStride,
+                                                GByte *pabyNonBlack) const
+{
+    const int *panLow = m_anLow.data();
+    const int *panHigh = m_anHigh.data();
+    for (int i = 0; i < nPixels; ++i)
+    {
+        const GByte *pabyPixel =
+            pabyPixels + static_cast<size_t>(i) * nPixelStride;
+        int bNonBlack = 1;
+        for (int iColor = 0, k = 0; iColor < m_nColors; iColor++)
+        {
+            int bFar = 0;
+            for (int iBand = 0; iBand < m_nSrcBands; iBand++, k++)
+            {
+                const int nPix = pabyPixel[iBand];
+                bFar |= static_cast<int>(nPix < panLow[k]) |
+                        static_cast<int>(nPix > panHigh[k]);
+            }
+            bNonBlack &= bFar;
+        }
+        pabyNonBlack[i] = static_cast<GByte>(bNonBlack);
+    }
+}
+
 /************************************************************************/
 /*                   GDALNearblackTwoPassesAlgorithm()                  */
 /*                                                                      */
@@ -335,100 +391,182 @@ bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
     const int nYSize = GDALGetRasterYSize(hSrcDataset);
 
     const int nMaxNonBlack = psOptions->nMaxNonBlack;
-    const int nNearDist = psOptions->nNearDist;
     const bool bNearWhite = psOptions->bNearWhite;
     const bool bSetAlpha = psOptions->bSetAlpha;
 
+    const GDALNearblackColorMatcher oMatcher(oColors, nBands,
+                                             psOptions->nNearDist);
+    GByte byReplacedNonBlack = 0;
+    {
+        const std::vector<GByte> abyReplaced(nDstBands, bNearWhite ? 255 : 0);
+        oMatcher.ComputeNonBlack(abyReplaced.data(), 1, nDstBands,
+                                 &byReplacedNonBlack);
+    }
+
     /* -------------------------------------------------------------------- */
-    /*      Allocate a line buffer.                                         */
+    /*      Allocate buffers for a chunk of lines.                          */
     /* -------------------------------------------------------------------- */
+    constexpr size_t CHUNK_MAX_BYTES = 16 * 1024 * 1024;
+    const size_t nLineBytes = static_cast<size_t>(nXSize) * nDstBands;
+    const int nChunkLines = static_cast<int>(std::clamp<size_t>(
+        CHUNK_MAX_BYTES / nLineBytes, 1, static_cast<size_t>(nYSize)));
 
-    std::vector<GByte> abyLine(static_cast<size_t>(nXSize) * nDstBands);
-    GByte *pabyLine = abyLine.data();
-
+    std::vector<GByte> abyChunk;
+    std::vector<GByte> abyNonBlack;
     std::vector<GByte> abyMask;
-    GByte *pabyMask = nullptr;
-    if (bSetMask)
+    try
     {
-        abyMask.resize(nXSize);
-        pabyMask = abyMask.data();
+        abyChunk.resize(nLineBytes * nChunkLines);
+        abyNonBlack.resize(static_cast<size_t>(nXSize) * nChunkLines);
+        if (bSetMask)
+            abyMask.resize(static_cast<size_t>(nXSize) * nChunkLines);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers: %s", e.what());
+        return false;
     }
 
     std::vector<int> anLastLineCounts(nXSize);
     int *panLastLineCounts = anLastLineCounts.data();
 
-    /* -------------------------------------------------------------------- */
-    /*      Processing data one line at a time.                             */
-    /* -------------------------------------------------------------------- */
-    int iLine;
-
-    for (iLine = 0; iLine < nYSize; iLine++)
+    // Classifying pixels is independent from one line to another, and can
+    // thus be done in parallel, contrary to the processing of lines.
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    const int nThreads =
+        EQUAL(pszNumThreads, "ALL_CPUS")
+            ? CPLGetNumCPUs()
+            : std::clamp(atoi(pszNumThreads), 1, 1024);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && nChunkLines > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                        : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const auto ComputeNonBlackLines = [&](int nLines)
     {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hSrcDataset, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1,
-            GDT_Byte, nBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
+        const auto ComputeRange = [&](int iFirstLine, int iLastLine)
         {
-            return false;
-        }
-
-        if (bSetAlpha)
-        {
-            for (int iCol = 0; iCol < nXSize; iCol++)
+            for (int i = iFirstLine; i < iLastLine; ++i)
             {
-                pabyLine[iCol * nDstBands + nDstBands - 1] = 255;
+                oMatcher.ComputeNonBlack(
+                    abyChunk.data() + i * nLineBytes, nXSize, nDstBands,
+                    abyNonBlack.data() + static_cast<size_t>(i) * nXSize);
             }
+        };
+        const int nJobs = poJobQueue ? std::min(nThreads, nLines) : 1;
+        if (nJobs <= 1)
+        {
+            ComputeRange(0, nLines);
+            return;
+        }
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const int iFirstLine = static_cast<int>(
+                static_cast<GIntBig>(nLines) * iJob / nJobs);
+            const int iLastLine = static_cast<int>(
+                static_cast<GIntBig>(nLines) * (iJob + 1) / nJobs);
+            poJobQueue->SubmitJob([&ComputeRange, iFirstLine, iLastLine]()
+                                  { ComputeRange(iFirstLine, iLastLine); });
         }
+        poJobQueue->WaitCompletion();
+    };
 
-        if (bSetMask)
+    const auto ReadChunk = [&](GDALDatasetH hDS, int nBandCount, int iYOff,
+                               int nLines)
+    {
+        if (GDALDatasetRasterIO(hDS, GF_Read, 0, iYOff, nXSize, nLines,
+                                abyChunk.data(), nXSize, nLines, GDT_Byte,
+                                nBandCount, nullptr, nDstBands,
+                                static_cast<int>(nLineBytes), 1) != CE_None)
         {
-            for (int iCol = 0; iCol < nXSize; iCol++)
-            {
-                pabyMask[iCol] = 255;
-            }
+            return false;
         }
+        return true;
+    };
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    true,   // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
+    const auto WriteChunk = [&](int iYOff, int nLines)
+    {
+        if (GDALDatasetRasterIO(hDstDS, GF_Write, 0, iYOff, nXSize, nLines,
+                                abyChunk.data(), nXSize, nLines, GDT_Byte,
+                                nDstBands, nullptr, nDstBands,
+                                static_cast<int>(nLineBytes), 1) != CE_None)
+        {
+            return false;
+        }
 
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
+        /***** write out the mask band lines *****/
 
-        if (eErr != CE_None)
+        if (bSetMask &&
+            GDALRasterIO(hMaskBand, GF_Write, 0, iYOff, nXSize, nLines,
+                         abyMask.data(), nXSize, nLines, GDT_Byte, 0,
+                         0) != CE_None)
         {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "ERROR writing out line to mask band.");
             return false;
         }
+        return true;
+    };
 
-        /***** write out the mask band line *****/
+    /* -------------------------------------------------------------------- */
+    /*      Processing data one chunk of lines at a time.                   */
+    /* -------------------------------------------------------------------- */
+    for (int iYOff = 0; iYOff < nYSize; iYOff += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - iYOff);
+        if (!ReadChunk(hSrcDataset, nBands, iYOff, nLines))
+            return false;
 
-        if (bSetMask)
+        if (bSetAlpha)
         {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            const size_t nPixels = static_cast<size_t>(nXSize) * nLines;
+            for (size_t iPixel = 0; iPixel < nPixels; iPixel++)
             {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "ERROR writing out line to mask band.");
-                return false;
+                abyChunk[iPixel * nDstBands + nDstBands - 1] = 255;
             }
         }
 
+        if (bSetMask)
+        {
+            memset(abyMask.data(), 255, static_cast<size_t>(nXSize) * nLines);
+        }
+
+        ComputeNonBlackLines(nLines);
+
+        for (int i = 0; i < nLines; ++i)
+        {
+            GByte *pabyLine = abyChunk.data() + i * nLineBytes;
+            GByte *pabyMask =
+                bSetMask ? abyMask.data() + static_cast<size_t>(i) * nXSize
+                         : nullptr;
+            GByte *pabyNonBlack =
+                abyNonBlack.data() + static_cast<size_t>(i) * nXSize;
+            ProcessLine(pabyLine, pabyMask, pabyNonBlack, 0, nXSize - 1,
+                        nBands, nDstBands, nMaxNonBlack, bNearWhite,
+                        byReplacedNonBlack, panLastLineCounts,
+                        true,   // bDoHorizontalCheck
+                        true,   // bDoVerticalCheck
+                        false,  // bBottomUp
+                        iYOff + i);
+            ProcessLine(pabyLine, pabyMask, pabyNonBlack, nXSize - 1, 0,
+                        nBands, nDstBands, nMaxNonBlack, bNearWhite,
+                        byReplacedNonBlack, panLastLineCounts,
+                        true,   // bDoHorizontalCheck
+                        false,  // bDoVerticalCheck
+                        false,  // bBottomUp
+                        iYOff + i);
+        }
+
+        if (!WriteChunk(iYOff, nLines))
+            return false;
+
         if (!(psOptions->pfnProgress(
-                0.5 * ((iLine + 1) / static_cast<double>(nYSize)), nullptr,
-                psOptions->pProgressData)))
+                0.5 * ((iYOff + nLines) / static_cast<double>(nYSize)),
+                nullptr, psOptions->pProgressData)))
         {
             return false;
         }
@@ -439,64 +577,53 @@ bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
     /* -------------------------------------------------------------------- */
     memset(panLastLineCounts, 0, sizeof(int) * nXSize);
 
-    for (iLine = nYSize - 1; hDstDS != nullptr && iLine >= 0; iLine--)
+    for (int iYEnd = nYSize; iYEnd > 0; iYEnd -= nChunkLines)
     {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hDstDS, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1, GDT_Byte,
-            nDstBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
+        const int nLines = std::min(nChunkLines, iYEnd);
+        const int iYOff = iYEnd - nLines;
+        if (!ReadChunk(hDstDS, nDstBands, iYOff, nLines))
             return false;
-        }
-
-        /***** read the mask band line back in *****/
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                return false;
-            }
-        }
+        /***** read the mask band lines back in *****/
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,  // bDoHorizontalCheck
-                    true,  // bDoVerticalCheck
-                    true,  // bBottomUp
-                    nYSize - 1 - iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    true,   // bBottomUp
-                    nYSize - 1 - iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
+        if (bSetMask &&
+            GDALRasterIO(hMaskBand, GF_Read, 0, iYOff, nXSize, nLines,
+                         abyMask.data(), nXSize, nLines, GDT_Byte, 0,
+                         0) != CE_None)
         {
             return false;
         }
 
-        /***** write out the mask band line *****/
+        ComputeNonBlackLines(nLines);
 
-        if (bSetMask)
+        for (int i = nLines - 1; i >= 0; --i)
         {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                return false;
-            }
+            GByte *pabyLine = abyChunk.data() + i * nLineBytes;
+            GByte *pabyMask =
+                bSetMask ? abyMask.data() + static_cast<size_t>(i) * nXSize
+                         : nullptr;
+            GByte *pabyNonBlack =
+                abyNonBlack.data() + static_cast<size_t>(i) * nXSize;
+            ProcessLine(pabyLine, pabyMask, pabyNonBlack, 0, nXSize - 1,
+                        nBands, nDstBands, nMaxNonBlack, bNearWhite,
+                        byReplacedNonBlack, panLastLineCounts,
+                        true,  // bDoHorizontalCheck
+                        true,  // bDoVerticalCheck
+                        true,  // bBottomUp
+                        nYSize - 1 - (iYOff + i));
+            ProcessLine(pabyLine, pabyMask, pabyNonBlack, nXSize - 1, 0,
+                        nBands, nDstBands, nMaxNonBlack, bNearWhite,
+                        byReplacedNonBlack, panLastLineCounts,
+                        true,   // bDoHorizontalCheck
+                        false,  // bDoVerticalCheck
+                        true,   // bBottomUp
+                        nYSize - 1 - (iYOff + i));
         }
 
-        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iLine) /
+        if (!WriteChunk(iYOff, nLines))
+            return false;
+
+        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iYOff) /
                                                static_cast<double>(nYSize),
                                      nullptr, psOptions->pProgressData)))
         {
@@ -513,10 +640,10 @@ bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
 /*      Process a single scanline of image data.                        */
 /************************************************************************/
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
+static void ProcessLine(GByte *pabyLine, GByte *pabyMask, GByte *pabyNonBlack,
+                        int iStart, int iEnd, int nSrcBands, int nDstBands,
                         int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
+                        GByte byReplacedNonBlack, int *panLastLineCounts,
                         bool bDoHorizontalCheck, bool bDoVerticalCheck,
                         bool bBottomUp, int iLineFromTopOrBottom)
 {
@@ -538,35 +665,7 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
 
             /***** is the pixel valid data? ****/
 
-            bool bIsNonBlack = false;
-
-            /***** loop over the colors *****/
-
-            for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                 iColor++)
-            {
-
-                const Color &oColor = oColors[iColor];
-
-                bIsNonBlack = false;
-
-                /***** loop over the bands *****/
-
-                for (int iBand = 0; iBand < nSrcBands; iBand++)
-                {
-                    const int nPix = pabyLine[i * nDstBands + iBand];
-
-                    if (oColor[iBand] - nPix > nNearDist ||
-                        nPix > nNearDist + oColor[iBand])
-                    {
-                        bIsNonBlack = true;
-                        break;
-                    }
-                }
-
-                if (!bIsNonBlack)
-                    break;
-            }
+            const bool bIsNonBlack = pabyNonBlack[i] != 0;
 
             if (bIsNonBlack)
             {
@@ -589,6 +688,7 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
             /***** replace the pixel values *****/
             for (int iBand = 0; iBand < nSrcBands; iBand++)
                 pabyLine[i * nDstBands + iBand] = nReplacevalue;
+            pabyNonBlack[i] = byReplacedNonBlack;
 
             /***** alpha *****/
             if (nDstBands > nSrcBands)
@@ -625,35 +725,7 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
             {
                 /***** is the pixel valid data? ****/
 
-                bool bIsNonBlack = false;
-
-                /***** loop over the colors *****/
-
-                for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                     iColor++)
-                {
-
-                    const Color &oColor = oColors[iColor];
-
-                    bIsNonBlack = false;
-
-                    /***** loop over the bands *****/
-
-                    for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    {
-                        const int nPix = pabyLine[i * nDstBands + iBand];
-
-                        if (oColor[iBand] - nPix > nNearDist ||
-                            nPix > nNearDist + oColor[iBand])
-                        {
-                            bIsNonBlack = true;
-                            break;
-                        }
-                    }
-
-                    if (bIsNonBlack == false)
-                        break;
-                }
+                const bool bIsNonBlack = pabyNonBlack[i] != 0;
 
                 if (bIsNonBlack)
                 {
@@ -684,6 +756,7 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
 
                 for (int iBand = 0; iBand < nSrcBands; iBand++)
                     pabyLine[i * nDstBands + iBand] = nReplacevalue;
+                pabyNonBlack[i] = byReplacedNonBlack;
 
                 /***** alpha *****/
 
@@ -842,6 +915,11 @@ GDALNearblackOptionsGetParser(GDALNearblackOptions *psOptions,
         .help(_("Adds a mask band to the output file if -o is used, or to the "
                 "input file otherwise."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to classify pixels."));
+
     argParser->add_argument("-alg")
         .choices("floodfill", "twopasses")
         .metavar("floodfill|twopasses")
@@ -47,6 +47,27 @@ struct GDALNearblackOptions
     Colors oColors{};
 
     CPLStringList aosCreationOptions{};
+
+    /*! Number of threads (or ALL_CPUS). Empty means GDAL_NUM_THREADS */
+    std::string osNumThreads{};
+};
+
+/** Classifies pixels as "non black", i.e. far from all colors */
+class GDALNearblackColorMatcher
+{
+    int m_nColors = 0;
+    int m_nSrcBands = 0;
+
+    // Inclusive range of values near each color, for each band
+    std::vector<int> m_anLow{};
+    std::vector<int> m_anHigh{};
+
+  public:
+    GDALNearblackColorMatcher(const Colors &oColors, int nSrcBands,
+                              int nNearDist);
+
+    void ComputeNonBlack(const GByte *pabyPixels, int nPixels,
+                         int nPixelStride, GByte *pabyNonBlack) const;
 };
 
 bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
@@ -227,6 +227,14 @@ MAIN_START(nArgc, papszArgv)
             nRetCode = 1;
     }
 
+    if (CPLTestBool(CPLGetConfigOption("OGR_PROFILING_STATS_ENABLED", "NO")))
+    {
+        char *pszReport = OGRProfilingStatsGetAsText(nullptr);
+        if (pszReport)
+            fprintf(stderr, "%s", pszReport);
+        CPLFree(pszReport);
+    }
+
 exit:
     CSLDestroy(papszArgv);
     GDALDestroy();
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <future>
 #include <limits>
 #include <map>
@@ -39,6 +40,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -47,12 +49,14 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_profiling.h"
 #include "ogr_recordbatch.h"
 #include "ogr_spatialref.h"
 #include "ogrlayerarrow.h"
@@ -588,6 +592,7 @@ class LayerTranslator
     const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
     OGREnvelope m_oClipSrcEnv{};
     bool m_bClipSrcIsRectangle = false;
+    OGRPreparedGeometryUniquePtr m_poClipSrcPrepared{};
 
     OGRGeometry *m_poClipDstOri = nullptr;
     bool m_bWarnedClipDstSRS = false;
@@ -595,6 +600,7 @@ class LayerTranslator
     const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
     OGREnvelope m_oClipDstEnv{};
     bool m_bClipDstIsRectangle = false;
+    OGRPreparedGeometryUniquePtr m_poClipDstPrepared{};
 
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
@@ -613,6 +619,13 @@ class LayerTranslator
         const OGRGeometry *poGeom = nullptr;
         const OGREnvelope *poEnv = nullptr;
         bool bGeomIsRectangle = false;
+        // Prepared version of poGeom, or nullptr if not available.
+        OGRPreparedGeometry *poPreparedGeom = nullptr;
+
+        bool Contains(const OGRGeometry *poOther,
+                      const OGREnvelope &oOtherEnv) const;
+        bool Intersects(const OGRGeometry *poOther,
+                        const OGREnvelope &oOtherEnv) const;
     };
 
     ClipGeomDesc GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
@@ -4189,6 +4202,33 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
     // OGR2OGR_USE_ARROW_API config option is mostly for testing purposes
     // or as a safety belt if things turned bad...
     bool bUseWriteArrowBatch = false;
+
+    // -select can be handled by ignoring the non-selected fields of the
+    // source layer, provided that the selected fields are regular attribute
+    // fields listed in the order of the source layer (as output fields are
+    // created from the Arrow schema), and that there is no -where clause that
+    // would require non-selected fields.
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    bool bSelFieldsCompatibleWithArrow = false;
+    if (m_bSelFieldsSet && bJustCreatedLayer && !m_pszWHERE &&
+        poSrcLayer->TestCapability(OLCIgnoreFields))
+    {
+        bSelFieldsCompatibleWithArrow = true;
+        int iLastSrcField = -1;
+        for (int iField = 0; m_papszSelFields && m_papszSelFields[iField];
+             iField++)
+        {
+            const int iSrcField =
+                poSrcFDefn->GetFieldIndex(m_papszSelFields[iField]);
+            if (iSrcField <= iLastSrcField)
+            {
+                bSelFieldsCompatibleWithArrow = false;
+                break;
+            }
+            iLastSrcField = iSrcField;
+        }
+    }
+
     if (((poSrcLayer->TestCapability(OLCFastGetArrowStream) &&
           // As we don't control the input array size when the input or output
           // drivers are Arrow/Parquet (as they don't use the generic
@@ -4200,7 +4240,8 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
          CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "NO"))) &&
         !psOptions->bSkipFailures && !psOptions->poClipSrc &&
         !psOptions->poClipDst && psOptions->oGCPs.nGCPCount == 0 &&
-        !psOptions->bWrapDateline && !m_papszSelFields &&
+        !psOptions->bWrapDateline &&
+        (!m_bSelFieldsSet || bSelFieldsCompatibleWithArrow) &&
         !m_bAddMissingFields && m_eGType == GEOMTYPE_UNCHANGED &&
         psOptions->eGeomOp == GEOMOP_NONE &&
         m_eGeomTypeConversion == GTC_DEFAULT && m_nCoordDim < 0 &&
@@ -4230,6 +4271,24 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
             }
         }
 
+        if (m_bSelFieldsSet)
+        {
+            CPLStringList aosIgnoredFields;
+            for (int iSrcField = 0; iSrcField < poSrcFDefn->GetFieldCount();
+                 iSrcField++)
+            {
+                const char *pszFieldName =
+                    poSrcFDefn->GetFieldDefn(iSrcField)->GetNameRef();
+                if (CSLFindString(m_papszSelFields, pszFieldName) < 0)
+                    aosIgnoredFields.AddString(pszFieldName);
+            }
+            if (poSrcLayer->SetIgnoredFields(const_cast<const char **>(
+                    aosIgnoredFields.List())) != OGRERR_NONE)
+            {
+                return false;
+            }
+        }
+
         const CPLStringList aosGetArrowStreamOptions(BuildGetArrowStreamOptions(
             poSrcLayer, poDstLayer, psOptions, bPreserveFID));
         if (poSrcLayer->GetArrowStream(streamSrc.get(),
@@ -4251,8 +4310,6 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
                 if (poDstLayer->IsArrowSchemaSupported(&schemaSrc, nullptr,
                                                        osErrorMsg))
                 {
-                    const OGRFeatureDefn *poSrcFDefn =
-                        poSrcLayer->GetLayerDefn();
                     const OGRFeatureDefn *poDstFDefn =
                         poDstLayer->GetLayerDefn();
                     if (bJustCreatedLayer && poDstFDefn &&
@@ -5997,6 +6054,145 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
     return true;
 }
 
+/************************************************************************/
+/*                        GetNumWorkerThreads()                         */
+/************************************************************************/
+
+// Number of threads used to reproject or process geometries
+static int GetNumWorkerThreads()
+{
+    const int nNumCPUs = CPLGetNumCPUs();
+    if (nNumCPUs <= 1)
+    {
+        return 1;
+    }
+    else
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            if (EQUAL(pszNumThreads, "ALL_CPUS"))
+                return CPLGetNumCPUs();
+            return std::min(atoi(pszNumThreads), 1024);
+        }
+        else
+        {
+            return std::max(2, nNumCPUs / 2);
+        }
+    }
+}
+
+/************************************************************************/
+/*                        GetNextSourceFeature()                        */
+/************************************************************************/
+
+/** Call poSrcLayer->GetNextFeatureInto(), accounting for it in the profiling
+ * statistics. poFeature is reused if not null. */
+static bool GetNextSourceFeature(OGRLayer *poSrcLayer,
+                                 std::unique_ptr<OGRFeature> &poFeature)
+{
+    OGRProfilingTimer oTimer(poSrcLayer, OGRProfilingStage::READ);
+    const bool bRet = poSrcLayer->GetNextFeatureInto(poFeature);
+    if (oTimer.IsEnabled())
+    {
+        if (bRet)
+            oTimer.AddBytes(
+                OGRProfilingStats::GetGeometriesWkbSize(poFeature.get()));
+        else
+            oTimer.SetFeatureCount(0);
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                         ReprojectGeometry()                          */
+/************************************************************************/
+
+// Reproject poGeom with poCT and/or papszTransformOptions.
+// Returns nullptr in case of failure.
+static std::unique_ptr<OGRGeometry> ReprojectGeometry(
+    std::unique_ptr<OGRGeometry> poGeom, OGRCoordinateTransformation *poCT,
+    char **papszTransformOptions, bool bReprojCanInvalidateValidity,
+    bool bConvertCurvesToLinear, int eGType,
+    const OGRGeometryFactory::TransformWithOptionsCache &oCache)
+{
+    // If we need to change the geometry type to linear, and
+    // we have a geometry with curves, then convert it to
+    // linear first, to avoid invalidities due to the fact
+    // that validity of arc portions isn't always kept while
+    // reprojecting and then discretizing.
+    if (bReprojCanInvalidateValidity && bConvertCurvesToLinear)
+    {
+        if (poGeom->hasCurveGeometry(TRUE))
+        {
+            OGRwkbGeometryType eTargetType =
+                OGR_GT_GetLinear(poGeom->getGeometryType());
+            poGeom.reset(
+                OGRGeometryFactory::forceTo(poGeom.release(), eTargetType));
+        }
+    }
+    else if (bReprojCanInvalidateValidity && eGType != GEOMTYPE_UNCHANGED &&
+             !OGR_GT_IsNonLinear(static_cast<OGRwkbGeometryType>(eGType)) &&
+             poGeom->hasCurveGeometry(TRUE))
+    {
+        poGeom.reset(OGRGeometryFactory::forceTo(
+            poGeom.release(), static_cast<OGRwkbGeometryType>(eGType)));
+    }
+
+    // At most 2 iterations
+    for (int iIter = 0;; ++iIter)
+    {
+        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+            OGRGeometryFactory::transformWithOptions(
+                poGeom.get(), poCT, papszTransformOptions, oCache));
+        if (poReprojectedGeom == nullptr)
+            return nullptr;
+
+        // Check if a curve geometry is no longer valid after
+        // reprojection
+        const auto eType = poGeom->getGeometryType();
+        const auto eFlatType = wkbFlatten(eType);
+
+        const auto IsValid = [](const OGRGeometry *poGeomToTest)
+        {
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            return poGeomToTest->IsValid();
+        };
+
+        if (iIter == 0 && bReprojCanInvalidateValidity &&
+            OGRGeometryFactory::haveGEOS() &&
+            (eFlatType == wkbCurvePolygon || eFlatType == wkbCompoundCurve ||
+             eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface) &&
+            poGeom->hasCurveGeometry(TRUE) && IsValid(poGeom.get()))
+        {
+            OGRwkbGeometryType eTargetType =
+                OGR_GT_GetLinear(poGeom->getGeometryType());
+            auto poGeomTmp =
+                std::unique_ptr<OGRGeometry>(OGRGeometryFactory::forceTo(
+                    poReprojectedGeom->clone(), eTargetType));
+            if (!IsValid(poGeomTmp.get()))
+            {
+                CPLDebug("OGR2OGR", "Curve geometry no longer valid after "
+                                    "reprojection: transforming it into "
+                                    "linear one before reprojecting");
+                poGeom.reset(
+                    OGRGeometryFactory::forceTo(poGeom.release(), eTargetType));
+                poGeom.reset(
+                    OGRGeometryFactory::forceTo(poGeom.release(), eType));
+            }
+            else
+            {
+                return poReprojectedGeom;
+            }
+        }
+        else
+        {
+            return poReprojectedGeom;
+        }
+    }
+}
+
 /************************************************************************/
 /*                 LayerTranslator::TranslateArrow()                    */
 /************************************************************************/
@@ -6040,29 +6236,7 @@ bool LayerTranslator::TranslateArrow(
     GIntBig nCount = 0;
     bool bGoOn = true;
     std::vector<GByte> abyModifiedWKB;
-    const int nNumReprojectionThreads = []()
-    {
-        const int nNumCPUs = CPLGetNumCPUs();
-        if (nNumCPUs <= 1)
-        {
-            return 1;
-        }
-        else
-        {
-            const char *pszNumThreads =
-                CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-            if (pszNumThreads)
-            {
-                if (EQUAL(pszNumThreads, "ALL_CPUS"))
-                    return CPLGetNumCPUs();
-                return std::min(atoi(pszNumThreads), 1024);
-            }
-            else
-            {
-                return std::max(2, nNumCPUs / 2);
-            }
-        }
-    }();
+    const int nNumReprojectionThreads = GetNumWorkerThreads();
 
     // Somewhat arbitrary threshold (config option only/mostly for autotest purposes)
     const int MIN_FEATURES_FOR_THREADED_REPROJ = atoi(CPLGetConfigOption(
@@ -6109,6 +6283,11 @@ bool LayerTranslator::TranslateArrow(
         // Coordinate reprojection
         if (m_bTransform)
         {
+            OGRProfilingTimer oTimer(
+                psInfo->m_poDstLayer,
+                OGRProfilingStage::COORDINATE_TRANSFORMATION);
+            oTimer.SetFeatureCount(nArrayLength);
+
             struct GeomArrayReleaser
             {
                 const void *origin_buffers_2 = nullptr;
@@ -6191,7 +6370,7 @@ bool LayerTranslator::TranslateArrow(
                 {
                     const size_t iShifted =
                         static_cast<size_t>(i + psGeomArray->offset);
-                    if (!pabyValidity || (pabyValidity[iShifted >> 8] &
+                    if (!pabyValidity || (pabyValidity[iShifted >> 3] &
                                           (1 << (iShifted % 8))) != 0)
                     {
                         const auto nWKBSize =
@@ -6240,8 +6419,14 @@ bool LayerTranslator::TranslateArrow(
         }
 
         // Write batch to target layer
-        const bool bWriteOK = psInfo->m_poDstLayer->WriteArrowBatch(
-            &schema, &array, aosOptionsWriteArrowBatch.List());
+        bool bWriteOK;
+        {
+            OGRProfilingTimer oTimer(psInfo->m_poDstLayer,
+                                     OGRProfilingStage::WRITE_ARROW);
+            oTimer.SetFeatureCount(nArrayLength);
+            bWriteOK = psInfo->m_poDstLayer->WriteArrowBatch(
+                &schema, &array, aosOptionsWriteArrowBatch.List());
+        }
 
         if (array.release)
             array.release(&array);
@@ -6338,6 +6523,14 @@ bool LayerTranslator::Translate(
 
     std::unique_ptr<OGRFeature> poFeature;
     std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
+    // Resolve once the conversion of each field done by SetFrom()
+    std::unique_ptr<OGRFieldCopyPlan> poFieldCopyPlan;
+    if (!psInfo->m_bCanAvoidSetFrom)
+    {
+        poFieldCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+            poSrcFDefn, poDstFDefn, panMap,
+            /* bUseISO8601ForDateTimeAsString = */ true);
+    }
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
@@ -6356,6 +6549,242 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
+    // When -simplify/-segmentize, reprojection and/or -makevalid are the
+    // first operations applied to the geometry, run them in parallel on
+    // batches of features read ahead from the source layer. The result is the
+    // same as when running them in the loop below. Features are still read
+    // and written in order from the calling thread.
+    const bool bCanParallelizeGeomOps =
+        poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+        nSrcGeomFieldCount == 1 && nDstGeomFieldCount == 1 &&
+        !bExplodeCollections && iSrcZField < 0 &&
+        m_nCoordDim == COORD_DIM_UNCHANGED;
+    const bool bParallelGeomOp =
+        bCanParallelizeGeomOps &&
+        (m_eGeomOp == GEOMOP_SEGMENTIZE ||
+         m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY) &&
+        m_dfGeomOpParam > 0;
+    OGRCoordinateTransformation *const poLayerCT =
+        psInfo->m_aoReprojectionInfo.empty()
+            ? nullptr
+            : psInfo->m_aoReprojectionInfo[0].m_poCT.get();
+    char **const papszLayerTransformOptions =
+        psInfo->m_aoReprojectionInfo.empty()
+            ? nullptr
+            : psInfo->m_aoReprojectionInfo[0].m_aosTransformOptions.List();
+    const bool bConvertCurvesToLinear =
+        !psInfo->m_bSupportCurves ||
+        m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+        m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR;
+
+    // Coordinate transformations are not thread-safe, so each worker thread
+    // uses its own clone of the layer one.
+    struct ReprojectionContext
+    {
+        std::unique_ptr<OGRCoordinateTransformation> poCT{};
+        OGRGeometryFactory::TransformWithOptionsCache oCache{};
+    };
+
+    std::vector<std::unique_ptr<ReprojectionContext>> apoReprojectionContexts;
+    std::mutex oReprojectionContextsMutex;
+    bool bParallelReprojection =
+        bCanParallelizeGeomOps && bSetupCTOK && !psInfo->m_bPerFeatureCT &&
+        (poLayerCT != nullptr || papszLayerTransformOptions != nullptr) &&
+        m_poClipSrcOri == nullptr && m_poGCPCoordTrans == nullptr &&
+        (m_eGeomOp == GEOMOP_NONE || bParallelGeomOp);
+    if (bParallelReprojection)
+    {
+        auto poContext = std::make_unique<ReprojectionContext>();
+        if (poLayerCT)
+        {
+            poContext->poCT.reset(poLayerCT->Clone());
+            if (!poContext->poCT)
+                bParallelReprojection = false;
+        }
+        apoReprojectionContexts.push_back(std::move(poContext));
+    }
+    const bool bLayerReprojCanInvalidateValidity =
+        bParallelReprojection &&
+        psInfo->m_aoReprojectionInfo[0].m_bCanInvalidateValidity;
+
+    const bool bParallelMakeValid =
+        bCanParallelizeGeomOps && m_bMakeValid &&
+        (m_eGeomOp == GEOMOP_NONE || bParallelGeomOp) && !m_poClipSrcOri &&
+        ((!m_bTransform && !m_bWrapDateline && m_poGCPCoordTrans == nullptr) ||
+         bParallelReprojection) &&
+        !m_poClipDstOri &&
+        psOptions->dfXYRes == OGRGeomCoordinatePrecision::UNKNOWN &&
+        OGRGeometryFactory::haveGEOS();
+    const int nGeomOpsThreads =
+        bParallelGeomOp || bParallelReprojection || bParallelMakeValid
+            ? GetNumWorkerThreads()
+            : 1;
+    CPLWorkerThreadPool *poGeomOpsThreadPool =
+        nGeomOpsThreads > 1 ? GDALGetGlobalThreadPool(nGeomOpsThreads)
+                            : nullptr;
+    const bool bParallelGeomOps = poGeomOpsThreadPool != nullptr;
+
+    struct ReadAheadFeature
+    {
+        std::unique_ptr<OGRFeature> poFeature{};
+        bool bReprojectionFailed = false;
+        bool bMakeValidFailed = false;
+    };
+
+    std::deque<ReadAheadFeature> oReadAheadQueue;
+    bool bReadAheadFailed = false;
+    const GIntBig nReadAheadBatchSize = std::max<GIntBig>(
+        1, CPLAtoGIntBig(
+               CPLGetConfigOption("OGR2OGR_PARALLEL_BATCH_SIZE", "1000")));
+
+    // Apply the operations that can be run in parallel to a read-ahead feature
+    const auto ProcessReadAheadFeature =
+        [this, poDstLayer, bParallelGeomOp, bParallelReprojection,
+         bParallelMakeValid, bLayerReprojCanInvalidateValidity,
+         bConvertCurvesToLinear,
+         papszLayerTransformOptions](ReadAheadFeature &oFeature,
+                                     ReprojectionContext *poContext)
+    {
+        auto poGeom =
+            std::unique_ptr<OGRGeometry>(oFeature.poFeature->StealGeometry());
+        if (!poGeom)
+            return;
+
+        if (bParallelGeomOp)
+        {
+            OGRProfilingTimer oTimer(poDstLayer,
+                                     OGRProfilingStage::GEOMETRY_OPERATIONS);
+            if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+            {
+                poGeom->segmentize(m_dfGeomOpParam);
+            }
+            else
+            {
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poGeom->SimplifyPreserveTopology(m_dfGeomOpParam));
+                if (poNewGeom)
+                    poGeom = std::move(poNewGeom);
+            }
+        }
+
+        if (bParallelReprojection)
+        {
+            OGRProfilingTimer oTimer(
+                poDstLayer, OGRProfilingStage::COORDINATE_TRANSFORMATION);
+            const auto eGeomType = poGeom->getGeometryType();
+            poGeom = ReprojectGeometry(
+                std::move(poGeom), poContext->poCT.get(),
+                papszLayerTransformOptions, bLayerReprojCanInvalidateValidity,
+                bConvertCurvesToLinear, m_eGType, poContext->oCache);
+            if (!poGeom)
+            {
+                // Set a placeholder geometry, so that the error is reported
+                // when the feature is processed.
+                oFeature.bReprojectionFailed = true;
+                oFeature.poFeature->SetGeometryDirectly(
+                    OGRGeometryFactory::createGeometry(eGeomType));
+                return;
+            }
+        }
+
+        if (bParallelMakeValid)
+        {
+            OGRProfilingTimer oTimer(poDstLayer,
+                                     OGRProfilingStage::GEOMETRY_OPERATIONS);
+            const bool bIsGeomCollection =
+                wkbFlatten(poGeom->getGeometryType()) == wkbGeometryCollection;
+            auto poNewGeom =
+                std::unique_ptr<OGRGeometry>(poGeom->MakeValid());
+            if (!poNewGeom)
+            {
+                oFeature.bMakeValidFailed = true;
+            }
+            else
+            {
+                poGeom = std::move(poNewGeom);
+                if (!bIsGeomCollection)
+                {
+                    poGeom.reset(
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                            poGeom.get()));
+                }
+            }
+        }
+
+        oFeature.poFeature->SetGeometryDirectly(poGeom.release());
+    };
+
+    const auto ReadAheadFeatures = [&]()
+    {
+        GIntBig nToRead = nReadAheadBatchSize;
+        if (m_nLimit >= 0)
+            nToRead = std::min(nToRead, m_nLimit - psInfo->m_nFeaturesRead);
+        std::vector<ReadAheadFeature> aoFeatures;
+        for (GIntBig i = 0; i < nToRead; ++i)
+        {
+            std::unique_ptr<OGRFeature> poSrcFeature;
+            if (!GetNextSourceFeature(poSrcLayer, poSrcFeature))
+            {
+                bReadAheadFailed = CPLGetLastErrorType() == CE_Failure;
+                break;
+            }
+            aoFeatures.emplace_back();
+            aoFeatures.back().poFeature = std::move(poSrcFeature);
+        }
+
+        const size_t nFeatures = aoFeatures.size();
+        auto poJobQueue = poGeomOpsThreadPool->CreateJobQueue();
+        // Use several chunks per thread, as the cost of operations can vary a
+        // lot from one geometry to another.
+        const size_t nChunks =
+            std::min(nFeatures, static_cast<size_t>(nGeomOpsThreads) * 4);
+        CPLErrorAccumulator oErrorAccumulator;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t iStart = iChunk * nFeatures / nChunks;
+            const size_t iEnd = (iChunk + 1) * nFeatures / nChunks;
+            poJobQueue->SubmitJob(
+                [&, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+
+                    std::unique_ptr<ReprojectionContext> poContext;
+                    if (bParallelReprojection)
+                    {
+                        std::lock_guard oLock(oReprojectionContextsMutex);
+                        if (apoReprojectionContexts.empty())
+                        {
+                            poContext = std::make_unique<ReprojectionContext>();
+                            if (poLayerCT)
+                                poContext->poCT.reset(poLayerCT->Clone());
+                        }
+                        else
+                        {
+                            poContext =
+                                std::move(apoReprojectionContexts.back());
+                            apoReprojectionContexts.pop_back();
+                        }
+                    }
+
+                    for (size_t i = iStart; i < iEnd; ++i)
+                        ProcessReadAheadFeature(aoFeatures[i], poContext.get());
+
+                    if (poContext)
+                    {
+                        std::lock_guard oLock(oReprojectionContextsMutex);
+                        apoReprojectionContexts.push_back(std::move(poContext));
+                    }
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+
+        for (auto &oFeature : aoFeatures)
+            oReadAheadQueue.push_back(std::move(oFeature));
+    };
+
     while (true)
     {
         if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
@@ -6363,16 +6792,40 @@ bool LayerTranslator::Translate(
             break;
         }
 
+        bool bReprojectionFailed = false;
+        bool bMakeValidFailed = false;
         if (poFeatureIn != nullptr)
             poFeature.reset(poFeatureIn);
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else if (bParallelGeomOps)
+        {
+            if (oReadAheadQueue.empty() && !bReadAheadFailed)
+                ReadAheadFeatures();
+            if (oReadAheadQueue.empty())
+            {
+                poFeature.reset();
+            }
+            else
+            {
+                auto &oFeature = oReadAheadQueue.front();
+                poFeature = std::move(oFeature.poFeature);
+                bReprojectionFailed = oFeature.bReprojectionFailed;
+                bMakeValidFailed = oFeature.bMakeValidFailed;
+                oReadAheadQueue.pop_front();
+            }
+        }
         else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+        {
+            // Reuse the feature object of the previous iteration, if it has
+            // not been moved to the target layer.
+            if (!GetNextSourceFeature(poSrcLayer, poFeature))
+                poFeature.reset();
+        }
 
         if (poFeature == nullptr)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (CPLGetLastErrorType() == CE_Failure || bReadAheadFailed)
             {
                 bRet = false;
             }
@@ -6510,9 +6963,8 @@ bool LayerTranslator::Translate(
 
                 poDstFeature->Reset();
 
-                if (poDstFeature->SetFrom(
-                        poFeature.get(), panMap, /* bForgiving = */ TRUE,
-                        /* bUseISO8601ForDateTimeAsString = */ true) !=
+                if (poDstFeature->SetFrom(poFeature.get(), *poFieldCopyPlan,
+                                          /* bForgiving = */ TRUE) !=
                     OGRERR_NONE)
                 {
                     if (psOptions->nGroupTransactions)
@@ -6722,15 +7174,25 @@ bool LayerTranslator::Translate(
                     poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
                 }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+                if (bParallelGeomOps && bParallelGeomOp)
+                {
+                    // Already done in ReadAheadFeatures()
+                }
+                else if (m_eGeomOp == GEOMOP_SEGMENTIZE)
                 {
                     if (m_dfGeomOpParam > 0)
+                    {
+                        OGRProfilingTimer oTimer(
+                            poDstLayer, OGRProfilingStage::GEOMETRY_OPERATIONS);
                         poDstGeometry->segmentize(m_dfGeomOpParam);
+                    }
                 }
                 else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
                 {
                     if (m_dfGeomOpParam > 0)
                     {
+                        OGRProfilingTimer oTimer(
+                            poDstLayer, OGRProfilingStage::GEOMETRY_OPERATIONS);
                         auto poNewGeom = std::unique_ptr<OGRGeometry>(
                             poDstGeometry->SimplifyPreserveTopology(
                                 m_dfGeomOpParam));
@@ -6755,11 +7217,11 @@ bool LayerTranslator::Translate(
                     OGREnvelope oDstEnv;
                     poDstGeometry->getEnvelope(&oDstEnv);
 
-                    if (!(clipGeomDesc.bGeomIsRectangle &&
-                          clipGeomDesc.poEnv->Contains(oDstEnv)))
+                    if (!clipGeomDesc.Contains(poDstGeometry.get(), oDstEnv))
                     {
                         std::unique_ptr<OGRGeometry> poClipped;
-                        if (clipGeomDesc.poEnv->Intersects(oDstEnv))
+                        if (clipGeomDesc.Intersects(poDstGeometry.get(),
+                                                    oDstEnv))
                         {
                             poClipped.reset(clipGeomDesc.poGeom->Intersection(
                                 poDstGeometry.get()));
@@ -6802,118 +7264,45 @@ bool LayerTranslator::Translate(
 
                 if (poCT != nullptr || papszTransformOptions != nullptr)
                 {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+                    // Already done in ReadAheadFeatures() otherwise
+                    if (!(bParallelGeomOps && bParallelReprojection))
                     {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
+                        OGRProfilingTimer oTimer(
+                            poDstLayer,
+                            OGRProfilingStage::COORDINATE_TRANSFORMATION);
+                        poDstGeometry = ReprojectGeometry(
+                            std::move(poDstGeometry), poCT,
+                            papszTransformOptions, bReprojCanInvalidateValidity,
+                            bConvertCurvesToLinear, eGType,
+                            m_transformWithOptionsCache);
                     }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
+                    else if (bReprojectionFailed)
                     {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        poDstGeometry.reset();
                     }
-
-                    for (int iIter = 0; iIter < 2; ++iIter)
+                    if (poDstGeometry == nullptr)
                     {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
+                        if (psOptions->nGroupTransactions)
                         {
-                            if (psOptions->nGroupTransactions)
+                            if (psOptions->nLayerTransaction)
                             {
-                                if (psOptions->nLayerTransaction)
+                                if (poDstLayer->CommitTransaction() !=
+                                        OGRERR_NONE &&
+                                    !psOptions->bSkipFailures)
                                 {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
+                                    return false;
                                 }
                             }
-
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
                         }
 
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
-
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Failed to reproject feature " CPL_FRMT_GIB
+                                 " (geometry probably out of source or "
+                                 "destination SRS).",
+                                 nSrcFID);
+                        if (!psOptions->bSkipFailures)
                         {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
+                            return false;
                         }
                     }
                 }
@@ -6939,11 +7328,12 @@ bool LayerTranslator::Translate(
                         OGREnvelope oDstEnv;
                         poDstGeometry->getEnvelope(&oDstEnv);
 
-                        if (!(clipGeomDesc.bGeomIsRectangle &&
-                              clipGeomDesc.poEnv->Contains(oDstEnv)))
+                        if (!clipGeomDesc.Contains(poDstGeometry.get(),
+                                                   oDstEnv))
                         {
                             std::unique_ptr<OGRGeometry> poClipped;
-                            if (clipGeomDesc.poEnv->Intersects(oDstEnv))
+                            if (clipGeomDesc.Intersects(poDstGeometry.get(),
+                                                        oDstEnv))
                             {
                                 poClipped.reset(
                                     clipGeomDesc.poGeom->Intersection(
@@ -7005,8 +7395,17 @@ bool LayerTranslator::Translate(
                         }
                     }
 
-                    if (m_bMakeValid)
+                    if (m_bMakeValid && bParallelGeomOps &&
+                        bParallelMakeValid)
+                    {
+                        // Already done in ReadAheadFeatures()
+                        if (bMakeValidFailed)
+                            goto end_loop;
+                    }
+                    else if (m_bMakeValid)
                     {
+                        OGRProfilingTimer oTimer(
+                            poDstLayer, OGRProfilingStage::GEOMETRY_OPERATIONS);
                         const bool bIsGeomCollection =
                             wkbFlatten(poDstGeometry->getGeometryType()) ==
                             wkbGeometryCollection;
@@ -7187,6 +7586,7 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
             }
         }
         m_oClipDstEnv = OGREnvelope();
+        m_poClipDstPrepared.reset();
     }
 
     const auto poGeom = m_poClipDstReprojectedToDstSRS
@@ -7196,11 +7596,14 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
     {
         poGeom->getEnvelope(&m_oClipDstEnv);
         m_bClipDstIsRectangle = poGeom->IsRectangle();
+        m_poClipDstPrepared.reset(
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(poGeom)));
     }
     ClipGeomDesc ret;
     ret.poGeom = poGeom;
     ret.poEnv = poGeom ? &m_oClipDstEnv : nullptr;
     ret.bGeomIsRectangle = m_bClipDstIsRectangle;
+    ret.poPreparedGeom = m_poClipDstPrepared.get();
     return ret;
 }
 
@@ -7244,6 +7647,7 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
             }
         }
         m_oClipSrcEnv = OGREnvelope();
+        m_poClipSrcPrepared.reset();
     }
 
     const auto poGeom = m_poClipSrcReprojectedToSrcSRS
@@ -7253,14 +7657,58 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
     {
         poGeom->getEnvelope(&m_oClipSrcEnv);
         m_bClipSrcIsRectangle = poGeom->IsRectangle();
+        m_poClipSrcPrepared.reset(
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(poGeom)));
     }
     ClipGeomDesc ret;
     ret.poGeom = poGeom;
     ret.poEnv = poGeom ? &m_oClipSrcEnv : nullptr;
-    ret.bGeomIsRectangle = m_bClipDstIsRectangle;
+    ret.bGeomIsRectangle = m_bClipSrcIsRectangle;
+    ret.poPreparedGeom = m_poClipSrcPrepared.get();
     return ret;
 }
 
+/************************************************************************/
+/*                LayerTranslator::ClipGeomDesc::Contains()             */
+/************************************************************************/
+
+/** Returns whether the clip geometry fully contains poOther, in which case
+ * poOther does not need to be clipped.
+ */
+bool LayerTranslator::ClipGeomDesc::Contains(const OGRGeometry *poOther,
+                                             const OGREnvelope &oOtherEnv) const
+{
+    if (!poEnv->Contains(oOtherEnv))
+        return false;
+    if (bGeomIsRectangle)
+        return true;
+    // The intersection with a 3D clip geometry would add Z values.
+    if (poGeom->Is3D() && !poOther->Is3D())
+        return false;
+    return poPreparedGeom &&
+           OGRPreparedGeometryContains(
+               poPreparedGeom,
+               OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poOther)));
+}
+
+/************************************************************************/
+/*               LayerTranslator::ClipGeomDesc::Intersects()            */
+/************************************************************************/
+
+/** Returns whether the clip geometry may intersect poOther, that is whether
+ * it is worth computing their intersection.
+ */
+bool LayerTranslator::ClipGeomDesc::Intersects(
+    const OGRGeometry *poOther, const OGREnvelope &oOtherEnv) const
+{
+    if (!poEnv->Intersects(oOtherEnv))
+        return false;
+    return !poPreparedGeom ||
+           OGRPreparedGeometryIntersects(
+               poPreparedGeom,
+               OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poOther)));
+}
+
 /************************************************************************/
 /*                   GDALVectorTranslateOptionsGetParser()              */
 /************************************************************************/
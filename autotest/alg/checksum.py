@@ -45,3 +45,62 @@ def test_checksum(tmp_vsimem, source):
     mem_ds.WriteRaster(1, 1, 20, 20, src_ds.ReadRaster())
     assert mem_ds.GetRasterBand(1).Checksum(1, 1, 20, 20) == 4672
     assert mem_ds.GetRasterBand(1).Checksum() == 4568
+
+
+@pytest.mark.parametrize("source", ["byte", "float32"])
+def test_checksum_multithreaded(tmp_vsimem, source):
+
+    tmpfilename = str(tmp_vsimem / "tmp.tif")
+
+    src_ds = gdal.Open(f"../gcore/data/{source}.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfilename, src_ds, options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    )
+    ds = gdal.Open(tmpfilename)
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert ds.GetRasterBand(1).Checksum() == 4672
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref = ds.GetRasterBand(1).Checksum(1, 2, 17, 15)
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert ds.GetRasterBand(1).Checksum(1, 2, 17, 15) == ref
+
+
+@pytest.mark.parametrize("source", ["byte", "float32"])
+def test_checksum_content_hash(tmp_vsimem, source):
+
+    tmpfilename = str(tmp_vsimem / "tmp.tif")
+
+    src_ds = gdal.Open(f"../gcore/data/{source}.tif")
+    ref = src_ds.GetRasterBand(1).ContentHash()
+    assert ref != 0
+
+    # Independent of the block layout and compression
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfilename,
+        src_ds,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=DEFLATE"],
+    )
+    ds = gdal.Open(tmpfilename)
+    assert ds.GetRasterBand(1).ContentHash() == ref
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert ds.GetRasterBand(1).ContentHash() == ref
+    assert ds.GetRasterBand(1).ContentHash(1, 2, 17, 15) != ref
+    ds = None
+
+    mem_ds = gdal.GetDriverByName("MEM").Create(
+        "", 21, 21, 1, src_ds.GetRasterBand(1).DataType
+    )
+    mem_ds.WriteRaster(1, 1, 20, 20, src_ds.ReadRaster())
+    assert mem_ds.GetRasterBand(1).ContentHash(1, 1, 20, 20) == ref
+
+    # Changes when a single value changes
+    val = mem_ds.GetRasterBand(1).ReadRaster(10, 10, 1, 1)
+    mem_ds.GetRasterBand(1).WriteRaster(10, 10, 1, 1, bytes(b ^ 0xFF for b in val))
+    assert mem_ds.GetRasterBand(1).ContentHash(1, 1, 20, 20) != ref
+
+    # Depends on the data type
+    other_ds = gdal.Translate("", src_ds, format="MEM", outputType=gdal.GDT_Float64)
+    assert other_ds.GetRasterBand(1).ContentHash() != ref
+
+    with pytest.raises(Exception, match="Invalid window"):
+        src_ds.GetRasterBand(1).ContentHash(1, 0, 20, 20)
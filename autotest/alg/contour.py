@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import math
 import struct
 
 import gdaltest
@@ -607,3 +608,54 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test that multi-threaded contour line generation gives the same lines as
+# the single-threaded one
+
+
+@pytest.mark.parametrize("use_nodata", [False, True])
+def test_contour_num_threads(use_nodata):
+
+    width = 101
+    height = 87
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, gdal.GDT_Float32)
+    values = []
+    for j in range(height):
+        for i in range(width):
+            values.append(
+                100 * math.sin(i / 13.0) * math.cos(j / 11.0) + 0.5 * (i + j)
+            )
+    if use_nodata:
+        for j in range(20, 30):
+            for i in range(40, 55):
+                values[j * width + i] = -9999
+        src_ds.GetRasterBand(1).SetNoDataValue(-9999)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack("f" * len(values), *values)
+    )
+
+    def get_lines(num_threads):
+        ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("ELEV", ogr.OFTReal))
+        options = [
+            "LEVEL_INTERVAL=10",
+            "ID_FIELD=0",
+            "ELEV_FIELD=1",
+            f"NUM_THREADS={num_threads}",
+        ]
+        if use_nodata:
+            options.append("NODATA=-9999")
+        assert (
+            gdal.ContourGenerateEx(src_ds.GetRasterBand(1), lyr, options=options)
+            == gdal.CE_None
+        )
+        return sorted((f["ELEV"], round(f.GetGeometryRef().Length(), 6)) for f in lyr)
+
+    ref = get_lines(1)
+    assert len(ref) > 0
+    assert get_lines(4) == ref
+    assert get_lines(7) == ref
@@ -17,7 +17,7 @@
 import gdaltest
 import pytest
 
-from osgeo import gdal
+from osgeo import gdal, ogr
 
 pytestmark = pytest.mark.skipif(
     not gdaltest.vrt_has_open_support(),
@@ -104,3 +104,51 @@ def test_cutline_4():
 
 
 ###############################################################################
+# Test that chunks inside, outside or crossing a cutline are masked
+# consistently, whatever the chunk size.
+
+
+@pytest.mark.parametrize("warp_memory_limit", [20000, 64 * 1024 * 1024])
+@pytest.mark.parametrize("all_touched", [False, True])
+def test_cutline_chunks(warp_memory_limit, all_touched):
+
+    # Cutline in source pixel coordinates: a concave polygon with a hole,
+    # and a small polygon far from it.
+    cutline = (
+        "MULTIPOLYGON(((5.3 5.3,95.3 5.3,95.3 95.3,50.3 40.3,5.3 95.3,5.3 5.3),"
+        "(20.3 20.3,20.3 30.3,80.3 30.3,80.3 20.3,20.3 20.3)),"
+        "((70.3 90.3,72.3 90.3,72.3 92.3,70.3 92.3,70.3 90.3)))"
+    )
+
+    src_ds = gdal.Open("../gcore/data/utmsmall.tif")
+    warp_options = ["INIT_DEST=0", "CUTLINE=" + cutline]
+    if all_touched:
+        warp_options.append("CUTLINE_ALL_TOUCHED=YES")
+    out_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        warpOptions=warp_options,
+        warpMemoryLimit=warp_memory_limit,
+    )
+
+    # Reference mask: rasterization of the whole cutline
+    mask_ds = gdal.GetDriverByName("MEM").Create("", 100, 100)
+    mask_ds.SetGeoTransform([0, 1, 0, 0, 0, 1])
+    vector_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    lyr = vector_ds.CreateLayer("cutline")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt(cutline))
+    lyr.CreateFeature(f)
+    gdal.RasterizeLayer(
+        mask_ds,
+        [1],
+        lyr,
+        burn_values=[1],
+        options=["ALL_TOUCHED=YES"] if all_touched else [],
+    )
+
+    src_data = src_ds.GetRasterBand(1).ReadRaster()
+    mask_data = mask_ds.GetRasterBand(1).ReadRaster()
+    expected = bytes(v if m else 0 for v, m in zip(src_data, mask_data))
+    assert out_ds.GetRasterBand(1).ReadRaster() == expected
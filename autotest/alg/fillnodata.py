@@ -386,3 +386,44 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that interpolating lines in parallel gives the same result as with a
+# single thread
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+def test_fillnodata_num_threads(interpolation):
+
+    width = 67
+    height = 53
+    data = array.array(
+        "f", [(x * 7 + y * 3) % 50 for y in range(height) for x in range(width)]
+    )
+    for y in range(10, 40):
+        for x in range(5 + y % 7, 50):
+            data[y * width + x] = -1
+    data_bytes = data.tobytes()
+
+    def fill(num_threads):
+        ds = gdal.GetDriverByName("MEM").Create(
+            "", width, height, 1, gdal.GDT_Float32
+        )
+        ds.GetRasterBand(1).SetNoDataValue(-1)
+        ds.GetRasterBand(1).WriteRaster(0, 0, width, height, data_bytes)
+        gdal.FillNodata(
+            targetBand=ds.GetRasterBand(1),
+            maxSearchDist=20,
+            maskBand=None,
+            smoothingIterations=2,
+            options=[
+                "INTERPOLATION=" + interpolation,
+                "NUM_THREADS=" + num_threads,
+            ],
+        )
+        return ds.GetRasterBand(1).ReadRaster()
+
+    expected = fill("1")
+    assert fill("4") == expected
+    assert fill("ALL_CPUS") == expected
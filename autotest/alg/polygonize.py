@@ -427,3 +427,44 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that reading the source by strips in a worker thread gives the same
+# result as the single-threaded path, on a raster spanning several strips.
+
+
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_polygonize_multithreaded_strip_reading(with_mask):
+
+    width = 1024
+    height = 2000
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    rows = [bytes(((x // 64) + i) % 3 for x in range(width)) for i in range(3)]
+    data = b"".join(rows[(y // 100) % 3] for y in range(height))
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, width, height, data)
+
+    mask_band = None
+    if with_mask:
+        mask_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+        mask_ds.GetRasterBand(1).Fill(255)
+        mask_ds.GetRasterBand(1).WriteRaster(
+            100, 300, 500, 1200, b"\x00" * (500 * 1200)
+        )
+        mask_band = mask_ds.GetRasterBand(1)
+
+    def polygonize():
+        mem_ds = ogr.GetDriverByName("Memory").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        assert (
+            gdal.Polygonize(src_ds.GetRasterBand(1), mask_band, mem_layer, 0) == 0
+        )
+        return [(f["DN"], f.GetGeometryRef().ExportToWkt()) for f in mem_layer]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        expected = polygonize()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = polygonize()
+    assert len(got) == len(expected)
+    assert got == expected
@@ -12,6 +12,8 @@
 ###############################################################################
 
 
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -109,3 +111,46 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test EXACT=YES against a brute force computation
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_proximity_exact(num_threads):
+
+    width = 37
+    height = 29
+    src = [0] * (width * height)
+    for i in range(0, width * height, 97):
+        src[i] = 1 + (i % 2)
+    src[5 * width + 30] = 3
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, width, height, bytes(src))
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float32
+    )
+
+    gdal.ComputeProximity(
+        src_ds.GetRasterBand(1),
+        dst_ds.GetRasterBand(1),
+        options=[
+            "VALUES=1,3",
+            "MAXDIST=9",
+            "NODATA=-1",
+            "EXACT=YES",
+            "NUM_THREADS=" + num_threads,
+        ],
+    )
+    got = struct.unpack("f" * (width * height), dst_ds.GetRasterBand(1).ReadRaster())
+
+    targets = [
+        (i % width, i // width) for i in range(width * height) if src[i] in (1, 3)
+    ]
+    for y in range(height):
+        for x in range(width):
+            dist = min(((x - tx) ** 2 + (y - ty) ** 2) ** 0.5 for tx, ty in targets)
+            expected = dist if dist <= 9 else -1
+            assert got[y * width + x] == pytest.approx(expected, abs=1e-5), (x, y)
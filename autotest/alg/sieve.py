@@ -13,6 +13,8 @@
 ###############################################################################
 
 
+import random
+
 import pytest
 
 from osgeo import gdal
@@ -340,3 +342,73 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that processing by strips in several threads gives the same result as
+# the single threaded processing
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_sieve_num_threads(connectedness, with_mask):
+
+    rng = random.Random(connectedness)
+    width = 150
+    height = 300
+
+    drv = gdal.GetDriverByName("MEM")
+    src_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    src_ds.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(
+            7 if ((x // 15) + (y // 40)) % 3 == 0 else rng.randint(0, 3)
+            for y in range(height)
+            for x in range(width)
+        ),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    mask_band = None
+    if with_mask:
+        mask_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+        mask_ds.WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            bytes(int(rng.randint(0, 9) != 0) for i in range(width * height)),
+        )
+        mask_band = mask_ds.GetRasterBand(1)
+
+    ref_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    gdal.SieveFilter(
+        src_band,
+        mask_band,
+        ref_ds.GetRasterBand(1),
+        10,
+        connectedness,
+        options=["NUM_THREADS=1"],
+    )
+    ref_data = ref_ds.ReadRaster()
+    assert ref_data != src_ds.ReadRaster()
+
+    dst_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    gdal.SieveFilter(
+        src_band,
+        mask_band,
+        dst_ds.GetRasterBand(1),
+        10,
+        connectedness,
+        options=["NUM_THREADS=4"],
+    )
+    assert dst_ds.ReadRaster() == ref_data
+
+    # In place
+    gdal.SieveFilter(
+        src_band, mask_band, src_band, 10, connectedness, options=["NUM_THREADS=4"]
+    )
+    assert src_ds.ReadRaster() == ref_data
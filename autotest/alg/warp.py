@@ -2028,3 +2028,120 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
     with gdal.Open(vrt_filename) as ds:
         with pytest.raises(Exception):
             gdal.Warp("", ds, format="MEM", multithread=True)
+
+
+###############################################################################
+# Test that the multi-band bilinear/cubic kernels used when the source has a
+# unified validity mask and/or alpha band give the same result as the general
+# case
+
+
+@pytest.mark.parametrize("dt", ("Byte", "Int16", "UInt16", "Float32"))
+@pytest.mark.parametrize("resampling", ("bilinear", "cubic"))
+@pytest.mark.parametrize("mask_type", ("alpha", "dataset_mask", "both"))
+def test_warp_unified_src_mask_multiband(dt, resampling, mask_type):
+
+    nbands = 3
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "",
+        20,
+        20,
+        nbands + (1 if mask_type != "dataset_mask" else 0),
+        gdal.GetDataTypeByName(dt),
+    )
+    src_ds.SetGeoTransform([0, 1, 0, 20, 0, -1])
+    for i in range(nbands):
+        data = bytes(
+            [(x * 7 + y * 13 + i * 50) % 251 for y in range(20) for x in range(20)]
+        )
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 20, 20, data, buf_type=gdal.GDT_Byte
+        )
+    if mask_type != "dataset_mask":
+        alpha_band = src_ds.GetRasterBand(nbands + 1)
+        alpha_band.SetColorInterpretation(gdal.GCI_AlphaBand)
+        alpha_band.Fill(255)
+        alpha_band.WriteRaster(5, 5, 3, 2, b"\x00" * 3 + b"\x80" * 3)
+    if mask_type != "alpha":
+        src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        mask_band = src_ds.GetRasterBand(1).GetMaskBand()
+        mask_band.Fill(255)
+        mask_band.WriteRaster(12, 9, 2, 4, b"\x00" * 8)
+
+    def warp(options):
+        out_ds = gdal.Warp(
+            "",
+            src_ds,
+            options=f"-of MEM -ts 53 47 -r {resampling} -dstalpha " + options,
+        )
+        return [
+            out_ds.GetRasterBand(i + 1).ReadRaster()
+            for i in range(out_ds.RasterCount)
+        ]
+
+    assert warp("") == warp("-wo USE_GENERAL_CASE=TRUE")
+
+
+###############################################################################
+# Test GDAL_APPROX_TRANSFORMER_2D=YES
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_warp_approx_transformer_2d(num_threads):
+
+    # Band 1 value is the source column, band 2 the source line, so that
+    # bilinear resampling exposes the source coordinates of target pixels.
+    src_ds = gdal.GetDriverByName("MEM").Create("", 400, 400, 2, gdal.GDT_Float32)
+    src_ds.SetGeoTransform([400000, 100, 0, 5000000, 0, -100])
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    src_ds.SetSpatialRef(srs)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        400,
+        400,
+        struct.pack("f" * 400 * 400, *[x for y in range(400) for x in range(400)]),
+    )
+    src_ds.GetRasterBand(2).WriteRaster(
+        0,
+        0,
+        400,
+        400,
+        struct.pack("f" * 400 * 400, *[y for y in range(400) for x in range(400)]),
+    )
+
+    def warp(error_threshold):
+        out_ds = gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            dstSRS="EPSG:4326",
+            resampleAlg="bilinear",
+            srcNodata=-1,
+            dstNodata=-1,
+            errorThreshold=error_threshold,
+            multithread=True,
+            warpOptions=["NUM_THREADS=" + num_threads],
+            warpMemoryLimit=500000,
+        )
+        return [
+            struct.unpack(
+                "f" * (out_ds.RasterXSize * out_ds.RasterYSize),
+                out_ds.GetRasterBand(i + 1).ReadRaster(),
+            )
+            for i in range(2)
+        ]
+
+    exact = warp(0)
+    with gdal.config_option("GDAL_APPROX_TRANSFORMER_2D", "YES"):
+        approx = warp(0.125)
+
+    for band in range(2):
+        max_diff = max(
+            abs(a - b)
+            for a, b in zip(exact[band], approx[band])
+            if a != -1 and b != -1 and 1 <= a <= 398
+        )
+        # The error threshold is only checked at a few points of each cell
+        assert max_diff <= 0.25
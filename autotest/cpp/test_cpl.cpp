@@ -41,11 +41,16 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <future>
 #include <limits>
 #include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -1310,6 +1315,66 @@ TEST_F(test_cpl, CPLGetThreadLocalConfigOptions)
     CSLDestroy(options);
 }
 
+/************************************************************************/
+/*         CPLGetConfigOptionsGeneration() / CPLConfigOptionCache       */
+/************************************************************************/
+TEST_F(test_cpl, CPLConfigOptionCache)
+{
+    CPLConfigOptionCache<int> oCache("FOOFOO_INT", "1", atoi);
+    EXPECT_EQ(oCache.Get(), 1);
+
+    const GIntBig nGeneration = CPLGetConfigOptionsGeneration();
+    CPLSetConfigOption("FOOFOO_INT", "2");
+    EXPECT_GT(CPLGetConfigOptionsGeneration(), nGeneration);
+    EXPECT_EQ(oCache.Get(), 2);
+
+    CPLSetThreadLocalConfigOption("FOOFOO_INT", "3");
+    EXPECT_EQ(oCache.Get(), 3);
+    CPLSetThreadLocalConfigOption("FOOFOO_INT", nullptr);
+    EXPECT_EQ(oCache.Get(), 2);
+
+    CPLSetConfigOption("FOOFOO_INT", nullptr);
+    EXPECT_EQ(oCache.Get(), 1);
+}
+
+/************************************************************************/
+/*          CPLGetConfigOption() concurrent with CPLSetConfigOption()   */
+/************************************************************************/
+TEST_F(test_cpl, CPLGetConfigOption_concurrent_with_set)
+{
+    CPLSetConfigOption("FOOFOO_STABLE", "STABLE");
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bOK{true};
+    std::vector<std::thread> aoThreads;
+    for (int i = 0; i < 4; ++i)
+    {
+        aoThreads.emplace_back(
+            [&bStop, &bOK]()
+            {
+                while (!bStop)
+                {
+                    if (!EQUAL(CPLGetConfigOption("FOOFOO_STABLE", ""),
+                               "STABLE"))
+                        bOK = false;
+                    const char *pszVal =
+                        CPLGetConfigOption("FOOFOO_CHANGING", "0");
+                    if (!EQUAL(pszVal, "0") && !EQUAL(pszVal, "1"))
+                        bOK = false;
+                }
+            });
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        CPLSetConfigOption("FOOFOO_CHANGING", (i % 2) == 0 ? "1" : nullptr);
+    }
+    bStop = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_TRUE(bOK);
+    CPLSetConfigOption("FOOFOO_STABLE", nullptr);
+    CPLSetConfigOption("FOOFOO_CHANGING", nullptr);
+}
+
 TEST_F(test_cpl, CPLExpandTilde)
 {
     EXPECT_STREQ(CPLExpandTilde("/foo/bar"), "/foo/bar");
@@ -3505,6 +3570,44 @@ TEST_F(test_cpl, CPLJSonStreamingWriter)
         x.Add(-std::numeric_limits<double>::infinity());
         ASSERT_EQ(x.GetString(), std::string("\"-Infinity\""));
     }
+    {
+        // Check that formatting matches the one of "%.*g"
+        const double adfVals[] = {0.1,      -1.0 / 3,  1e-7,   123456789012.0,
+                                  1e21,     2.5e-310, 1e300,  -0.0,
+                                  100000.0, 1234567.0};
+        for (const double dfVal : adfVals)
+        {
+            for (int nPrecision : {1, 5, 9, 15, 17, 20})
+            {
+                CPLJSonStreamingWriter x(nullptr, nullptr);
+                x.Add(dfVal, nPrecision);
+                char szFormatting[10];
+                snprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
+                         nPrecision);
+                EXPECT_EQ(x.GetString(),
+                          std::string(CPLSPrintf(szFormatting, dfVal)))
+                    << nPrecision;
+            }
+            {
+                CPLJSonStreamingWriter x(nullptr, nullptr);
+                x.Add(static_cast<float>(dfVal));
+                EXPECT_EQ(x.GetString(),
+                          std::string(CPLSPrintf(
+                              "%.9g", static_cast<double>(
+                                          static_cast<float>(dfVal)))));
+            }
+        }
+    }
+    {
+        CPLJSonStreamingWriter x(nullptr, nullptr);
+        x.Add(std::numeric_limits<std::int64_t>::min());
+        ASSERT_EQ(x.GetString(), std::string("-9223372036854775808"));
+    }
+    {
+        CPLJSonStreamingWriter x(nullptr, nullptr);
+        x.Add(std::numeric_limits<std::uint64_t>::max());
+        ASSERT_EQ(x.GetString(), std::string("18446744073709551615"));
+    }
     {
         CPLJSonStreamingWriter x(nullptr, nullptr);
         x.Add(std::string("foo\\bar\"baz\b\f\n\r\t"
@@ -4822,6 +4925,157 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test CPLJobQueue::WaitCompletion() called from a worker thread
+TEST_F(test_cpl, CPLJobQueue_nested_wait_completion)
+{
+    CPLWorkerThreadPool oThreadPool;
+    oThreadPool.Setup(4, nullptr, nullptr, /* waitAllStarted = */ false);
+
+    std::atomic<int> nCounter{0};
+    {
+        auto poOuterQueue = oThreadPool.CreateJobQueue();
+        for (int i = 0; i < 8; ++i)
+        {
+            poOuterQueue->SubmitJob(
+                [&oThreadPool, &nCounter]()
+                {
+                    auto poInnerQueue = oThreadPool.CreateJobQueue();
+                    for (int j = 0; j < 50; ++j)
+                        poInnerQueue->SubmitJob([&nCounter]() { ++nCounter; });
+                    poInnerQueue->WaitCompletion();
+                    ASSERT_FALSE(poInnerQueue->WaitEvent());
+                });
+        }
+        poOuterQueue->WaitCompletion();
+    }
+    ASSERT_EQ(nCounter, 8 * 50);
+}
+
+// Test CPLJobQueue priorities
+TEST_F(test_cpl, CPLJobQueue_priority)
+{
+    CPLWorkerThreadPool oThreadPool;
+    oThreadPool.Setup(1, nullptr, nullptr);
+
+    // Keep the single worker thread busy while jobs are submitted
+    std::promise<void> oRelease;
+    std::shared_future<void> oReleased(oRelease.get_future());
+    std::atomic<bool> bStarted{false};
+    auto poBlockingQueue = oThreadPool.CreateJobQueue();
+    poBlockingQueue->SubmitJob(
+        [oReleased, &bStarted]()
+        {
+            bStarted = true;
+            oReleased.wait();
+        });
+    while (!bStarted)
+        std::this_thread::yield();
+
+    std::mutex oMutex;
+    std::string osOrder;
+    auto poLowQueue = oThreadPool.CreateJobQueue(CPLJobPriority::LOW);
+    auto poHighQueue = oThreadPool.CreateJobQueue(CPLJobPriority::HIGH);
+    EXPECT_EQ(poLowQueue->GetPriority(), CPLJobPriority::LOW);
+    for (int i = 0; i < 3; ++i)
+    {
+        poLowQueue->SubmitJob(
+            [&oMutex, &osOrder]()
+            {
+                std::lock_guard oLock(oMutex);
+                osOrder += 'L';
+            });
+        poHighQueue->SubmitJob(
+            [&oMutex, &osOrder]()
+            {
+                std::lock_guard oLock(oMutex);
+                osOrder += 'H';
+            });
+    }
+    oRelease.set_value();
+    poLowQueue->WaitCompletion();
+    poHighQueue->WaitCompletion();
+    EXPECT_EQ(osOrder, "HHHLLL");
+}
+
+// Test CPLJobQueue maximum concurrency
+TEST_F(test_cpl, CPLJobQueue_max_concurrency)
+{
+    CPLWorkerThreadPool oThreadPool;
+    oThreadPool.Setup(4, nullptr, nullptr);
+
+    std::atomic<int> nRunning{0};
+    std::atomic<int> nMaxRunning{0};
+    std::atomic<int> nCounter{0};
+    {
+        auto poQueue = oThreadPool.CreateJobQueue(CPLJobPriority::NORMAL, 2);
+        for (int i = 0; i < 20; ++i)
+        {
+            poQueue->SubmitJob(
+                [&nRunning, &nMaxRunning, &nCounter]()
+                {
+                    const int nCur = ++nRunning;
+                    int nMax = nMaxRunning;
+                    while (nCur > nMax &&
+                           !nMaxRunning.compare_exchange_weak(nMax, nCur))
+                    {
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    --nRunning;
+                    ++nCounter;
+                });
+        }
+        poQueue->WaitCompletion();
+    }
+    EXPECT_EQ(nCounter, 20);
+    EXPECT_LE(nMaxRunning, 2);
+}
+
+// Test CPLJobQueue::SubmitJobWithFuture() and CancelPendingJobs()
+TEST_F(test_cpl, CPLJobQueue_future_and_cancel)
+{
+    CPLWorkerThreadPool oThreadPool;
+    oThreadPool.Setup(1, nullptr, nullptr);
+
+    {
+        auto poQueue = oThreadPool.CreateJobQueue();
+        auto oFuture = poQueue->SubmitJobWithFuture([]() { return 42; });
+        EXPECT_EQ(oFuture.get(), 42);
+        EXPECT_FALSE(poQueue->IsCancelled());
+    }
+
+    std::promise<void> oRelease;
+    std::shared_future<void> oReleased(oRelease.get_future());
+    std::atomic<bool> bStarted{false};
+    auto poBlockingQueue = oThreadPool.CreateJobQueue();
+    poBlockingQueue->SubmitJob(
+        [oReleased, &bStarted]()
+        {
+            bStarted = true;
+            oReleased.wait();
+        });
+    while (!bStarted)
+        std::this_thread::yield();
+
+    std::atomic<int> nCounter{0};
+    // With a concurrency cap, so that some jobs are held by the queue itself
+    auto poQueue = oThreadPool.CreateJobQueue(CPLJobPriority::NORMAL, 2);
+    for (int i = 0; i < 10; ++i)
+        poQueue->SubmitJob([&nCounter]() { ++nCounter; });
+    auto oFuture = poQueue->SubmitJobWithFuture([]() { return 1; });
+    EXPECT_EQ(poQueue->CancelPendingJobs(), 11);
+    EXPECT_TRUE(poQueue->IsCancelled());
+    EXPECT_THROW(oFuture.get(), std::future_error);
+    oRelease.set_value();
+    poQueue->WaitCompletion();
+    EXPECT_FALSE(poQueue->WaitEvent());
+    EXPECT_EQ(nCounter, 0);
+
+    // Jobs submitted after cancellation are run
+    poQueue->SubmitJob([&nCounter]() { ++nCounter; });
+    poQueue->WaitCompletion();
+    EXPECT_EQ(nCounter, 1);
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -5763,4 +6017,23 @@ TEST_F(test_cpl, VSIGlob)
     VSIUnlink(osFilenameRadix.c_str());
 }
 
+TEST_F(test_cpl, CPLParseNumThreads)
+{
+    EXPECT_EQ(CPLParseNumThreads(nullptr, 128), 1);
+    EXPECT_EQ(CPLParseNumThreads("", 128), 1);
+    EXPECT_EQ(CPLParseNumThreads("invalid", 128), 1);
+    EXPECT_EQ(CPLParseNumThreads("0", 128), 1);
+    EXPECT_EQ(CPLParseNumThreads("-1", 128), 1);
+    EXPECT_EQ(CPLParseNumThreads("3", 128), 3);
+    EXPECT_EQ(CPLParseNumThreads("128", 128), 128);
+    EXPECT_EQ(CPLParseNumThreads("129", 128), 128);
+    EXPECT_EQ(CPLParseNumThreads("129", 1024), 129);
+    EXPECT_EQ(CPLParseNumThreads("1025", 1024), 1024);
+    EXPECT_EQ(CPLParseNumThreads("99999999999999999999", 1024), 1024);
+    EXPECT_EQ(CPLParseNumThreads("ALL_CPUS", 128),
+              std::clamp(CPLGetNumCPUs(), 1, 128));
+    EXPECT_EQ(CPLParseNumThreads("all_cpus", 128),
+              CPLParseNumThreads("ALL_CPUS", 128));
+}
+
 }  // namespace
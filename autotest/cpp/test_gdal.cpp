@@ -19,7 +19,9 @@
 #include "gdal.h"
 #include "tilematrixset.hpp"
 #include "gdalcachedpixelaccessor.h"
+#include "gdal_thread_pool.h"
 
+#include <chrono>
 #include <limits>
 #include <string>
 
@@ -3720,6 +3722,73 @@ TEST_F(test_gdal, GDALDeinterleave4ComponentsUInt16)
     VSIFree(panDest3);
 }
 
+// Test GDALInterleave() and GDALDeinterleave() round-trip, for all data types
+// and 1 to 5 components
+TEST_F(test_gdal, GDALInterleaveDeinterleaveRoundTrip)
+{
+    constexpr int MAX_COMPONENTS = 5;
+    constexpr size_t ITERS = 67;
+    for (int nDT = GDT_Byte; nDT < GDT_TypeCount; ++nDT)
+    {
+        const auto eDT = static_cast<GDALDataType>(nDT);
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        for (int nComponents = 1; nComponents <= MAX_COMPONENTS; ++nComponents)
+        {
+            std::vector<std::vector<GByte>> aabySrc(nComponents);
+            std::vector<const void *> apSrc;
+            for (int iComp = 0; iComp < nComponents; ++iComp)
+            {
+                aabySrc[iComp].resize(ITERS * nDTSize);
+                for (size_t i = 0; i < aabySrc[iComp].size(); ++i)
+                    aabySrc[iComp][i] = static_cast<GByte>(i * 7 + iComp);
+                apSrc.push_back(aabySrc[iComp].data());
+            }
+
+            std::vector<GByte> abyInterleaved(ITERS * nDTSize * nComponents);
+            GDALInterleave(apSrc.data(), eDT, nComponents,
+                           abyInterleaved.data(), eDT, ITERS);
+            for (size_t i = 0; i < ITERS; ++i)
+            {
+                for (int iComp = 0; iComp < nComponents; ++iComp)
+                {
+                    EXPECT_EQ(memcmp(abyInterleaved.data() +
+                                         (i * nComponents + iComp) * nDTSize,
+                                     aabySrc[iComp].data() + i * nDTSize,
+                                     nDTSize),
+                              0)
+                        << GDALGetDataTypeName(eDT) << " " << nComponents;
+                }
+            }
+
+            std::vector<std::vector<GByte>> aabyDst(nComponents);
+            std::vector<void *> apDst;
+            for (int iComp = 0; iComp < nComponents; ++iComp)
+            {
+                aabyDst[iComp].resize(ITERS * nDTSize);
+                apDst.push_back(aabyDst[iComp].data());
+            }
+            GDALDeinterleave(abyInterleaved.data(), eDT, nComponents,
+                             apDst.data(), eDT, ITERS);
+            EXPECT_EQ(aabyDst, aabySrc)
+                << GDALGetDataTypeName(eDT) << " " << nComponents;
+        }
+    }
+}
+
+// Test GDALInterleave() with data type conversion
+TEST_F(test_gdal, GDALInterleaveGeneralCase)
+{
+    const GByte abySrc0[] = {0, 2, 4};
+    const GByte abySrc1[] = {1, 3, 5};
+    const void *apSrc[] = {abySrc0, abySrc1};
+    GUInt16 anDest[6] = {0};
+    GDALInterleave(apSrc, GDT_Byte, 2, anDest, GDT_UInt16, 3);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(anDest[i], i);
+    }
+}
+
 // Test GDALDataset::ReportError()
 TEST_F(test_gdal, GDALDatasetReportError)
 {
@@ -5251,4 +5320,887 @@ TEST_F(test_gdal, GDALExpandPackedBitsToByteAt0Or255)
     EXPECT_EQ(out, expectedOut);
 }
 
+// Test the bNoCachePromotion hint of GDALRasterIOExtraArg
+TEST_F(test_gdal, RasterIO_bNoCachePromotion)
+{
+    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_COUNT = 20;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        std::vector<int> anReadCount = std::vector<int>(BLOCK_COUNT);
+
+        TestRasterBand()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int nBlockXOff, int, void *pImage) override
+        {
+            anReadCount[nBlockXOff]++;
+            memset(pImage, 0, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            SetBand(1, new TestRasterBand());
+        }
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    // Room for a few blocks only
+    GDALSetCacheMax64(5 * BLOCK_SIZE * BLOCK_SIZE);
+
+    TestDataset oDS;
+    auto poBand = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(1));
+    std::vector<GByte> abyBuffer(BLOCK_SIZE * BLOCK_SIZE);
+    const auto ReadBlock = [poBand, &abyBuffer](int iBlock, bool bNoPromotion)
+    {
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        sExtraArg.bNoCachePromotion = bNoPromotion;
+        return poBand->RasterIO(GF_Read, iBlock * BLOCK_SIZE, 0, BLOCK_SIZE,
+                                BLOCK_SIZE, abyBuffer.data(), BLOCK_SIZE,
+                                BLOCK_SIZE, GDT_Byte, 0, 0, &sExtraArg);
+    };
+
+    EXPECT_EQ(ReadBlock(0, false), CE_None);
+    EXPECT_EQ(poBand->anReadCount[0], 1);
+
+    // Streaming reads should not evict block 0
+    for (int i = 1; i < BLOCK_COUNT; ++i)
+        EXPECT_EQ(ReadBlock(i, true), CE_None);
+    EXPECT_EQ(ReadBlock(0, false), CE_None);
+    EXPECT_EQ(poBand->anReadCount[0], 1);
+
+    // Whereas regular reads do with the LRU policy
+    if (EQUAL(CPLGetConfigOption("GDAL_RB_CACHE_POLICY", "LRU"), "LRU"))
+    {
+        for (int i = 1; i < BLOCK_COUNT; ++i)
+            EXPECT_EQ(ReadBlock(i, false), CE_None);
+        EXPECT_EQ(ReadBlock(0, false), CE_None);
+        EXPECT_EQ(poBand->anReadCount[0], 2);
+    }
+
+    oDS.FlushCache(false);
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test block cache statistics and quota of datasets
+TEST_F(test_gdal, BlockCacheStatisticsAndQuota)
+{
+    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_COUNT = 20;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        TestRasterBand()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int, int, void *pImage) override
+        {
+            memset(pImage, 0, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            SetBand(1, new TestRasterBand());
+        }
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    // Room for all blocks of both datasets
+    GDALSetCacheMax64(4 * BLOCK_COUNT * BLOCK_SIZE * BLOCK_SIZE);
+
+    const auto ReadBlock = [](GDALDataset &oDS, int iBlock)
+    {
+        GDALRasterBlock *poBlock =
+            oDS.GetRasterBand(1)->GetLockedBlockRef(iBlock, 0);
+        ASSERT_NE(poBlock, nullptr);
+        poBlock->DropLock();
+    };
+
+    TestDataset oDS1;
+    TestDataset oDS2;
+
+    GIntBig nCachedBytes = -1;
+    GIntBig nHits = -1;
+    GIntBig nMisses = -1;
+    GIntBig nEvictions = -1;
+    oDS1.GetBlockCacheStatistics(&nCachedBytes, &nHits, &nMisses, &nEvictions);
+    EXPECT_EQ(nCachedBytes, 0);
+    EXPECT_EQ(nHits, 0);
+    EXPECT_EQ(nMisses, 0);
+    EXPECT_EQ(nEvictions, 0);
+    EXPECT_EQ(oDS1.GetBlockCacheQuota(), 0);
+
+    ReadBlock(oDS1, 0);
+    ReadBlock(oDS1, 0);
+    ReadBlock(oDS1, 1);
+    oDS1.GetBlockCacheStatistics(&nCachedBytes, &nHits, &nMisses, &nEvictions);
+    EXPECT_GE(nCachedBytes, 2 * BLOCK_SIZE * BLOCK_SIZE);
+    EXPECT_EQ(nHits, 1);
+    EXPECT_EQ(nMisses, 2);
+    EXPECT_EQ(nEvictions, 0);
+
+    GIntBig nBandCachedBytes = -1;
+    GDALGetRasterBandBlockCacheStatistics(
+        GDALRasterBand::ToHandle(oDS1.GetRasterBand(1)), &nBandCachedBytes,
+        nullptr, nullptr, nullptr);
+    EXPECT_EQ(nBandCachedBytes, nCachedBytes);
+
+    for (int i = 0; i < BLOCK_COUNT; ++i)
+        ReadBlock(oDS2, i);
+
+    // Room for 3 blocks, including their overhead
+    const GIntBig nQuota = 3 * (BLOCK_SIZE * BLOCK_SIZE + 1024);
+    GDALDatasetSetBlockCacheQuota(GDALDataset::ToHandle(&oDS1), nQuota);
+    EXPECT_EQ(GDALDatasetGetBlockCacheQuota(GDALDataset::ToHandle(&oDS1)),
+              nQuota);
+
+    for (int i = 0; i < BLOCK_COUNT; ++i)
+        ReadBlock(oDS1, i);
+    oDS1.GetBlockCacheStatistics(&nCachedBytes, &nHits, &nMisses, &nEvictions);
+    EXPECT_LE(nCachedBytes, nQuota);
+    EXPECT_EQ(nEvictions, nMisses - 3);
+
+    // Blocks of the other dataset must not have been evicted
+    oDS2.GetBlockCacheStatistics(&nCachedBytes, nullptr, nullptr,
+                                 &nEvictions);
+    EXPECT_GE(nCachedBytes, BLOCK_COUNT * BLOCK_SIZE * BLOCK_SIZE);
+    EXPECT_EQ(nEvictions, 0);
+
+    oDS1.DropCache();
+    oDS2.DropCache();
+    oDS1.GetBlockCacheStatistics(&nCachedBytes, nullptr, nullptr, nullptr);
+    EXPECT_EQ(nCachedBytes, 0);
+
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDALDataset::PrefetchAsync()
+TEST_F(test_gdal, PrefetchAsync)
+{
+    constexpr int BLOCK_SIZE = 32;
+    constexpr int BLOCK_COUNT = 8;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        std::atomic<int> nReadCount{0};
+
+        TestRasterBand()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int nBlockXOff, int nBlockYOff,
+                          void *pImage) override
+        {
+            ++nReadCount;
+            memset(pImage, nBlockXOff + nBlockYOff, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            SetBand(1, new TestRasterBand());
+            SetBand(2, new TestRasterBand());
+        }
+    };
+
+    TestDataset oDS;
+    auto poBand1 = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(1));
+    auto poBand2 = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(2));
+
+    // Invalid requests
+    {
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(oDS.PrefetchAsync(0, nullptr, 1, nullptr).valid());
+        const GDALPrefetchWindow sOutOfRaster = {0, 0, BLOCK_SIZE * 100, 1};
+        EXPECT_FALSE(oDS.PrefetchAsync(1, &sOutOfRaster, 1, nullptr).valid());
+        const int nInvalidBand = 3;
+        const GDALPrefetchWindow sWindow = {0, 0, 1, 1};
+        EXPECT_FALSE(
+            oDS.PrefetchAsync(1, &sWindow, 1, &nInvalidBand).valid());
+    }
+
+    // 2x2 blocks of the first band, and 1 block of the first band
+    const GDALPrefetchWindow asWindows[] = {
+        {BLOCK_SIZE / 2, BLOCK_SIZE / 2, BLOCK_SIZE, BLOCK_SIZE},
+        {4 * BLOCK_SIZE, 4 * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE}};
+    auto oFuture = oDS.PrefetchAsync(2, asWindows, 1, nullptr);
+    ASSERT_TRUE(oFuture.valid());
+    EXPECT_EQ(oFuture.get(), CE_None);
+    EXPECT_EQ(poBand1->nReadCount, 5);
+    EXPECT_EQ(poBand2->nReadCount, 0);
+
+    // Read from the cache
+    std::vector<GByte> abyBuffer(BLOCK_SIZE * BLOCK_SIZE);
+    EXPECT_EQ(poBand1->RasterIO(GF_Read, BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE,
+                                BLOCK_SIZE, abyBuffer.data(), BLOCK_SIZE,
+                                BLOCK_SIZE, GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    EXPECT_EQ(abyBuffer[0], 2);
+    EXPECT_EQ(poBand1->nReadCount, 5);
+
+    // C API with completion callback
+    struct CompletionData
+    {
+        std::atomic<int> nCalls{0};
+        std::atomic<CPLErr> eErr{CE_Failure};
+    };
+
+    CompletionData sCompletionData;
+    const int anBands[] = {2};
+    EXPECT_TRUE(GDALDatasetPrefetchAsync(
+        GDALDataset::ToHandle(&oDS), 1, &asWindows[1], 1, anBands,
+        [](CPLErr eErr, void *pUserData)
+        {
+            auto psData = static_cast<CompletionData *>(pUserData);
+            psData->eErr = eErr;
+            ++psData->nCalls;
+        },
+        &sCompletionData));
+    GDALDatasetWaitForPendingPrefetch(GDALDataset::ToHandle(&oDS));
+    EXPECT_EQ(sCompletionData.nCalls, 1);
+    EXPECT_EQ(sCompletionData.eErr, CE_None);
+    EXPECT_EQ(poBand1->nReadCount, 5);
+    EXPECT_EQ(poBand2->nReadCount, 1);
+
+    // Pending requests are waited for by DropCache()
+    oDS.PrefetchAsync(1, &asWindows[0], 2, nullptr);
+    oDS.DropCache();
+    EXPECT_EQ(poBand2->nReadCount, 5);
+}
+
+// Test that GDALDataset::PrefetchAsync() requests submitted while another
+// one of the same dataset is running do not hold workers of the thread pool
+TEST_F(test_gdal, PrefetchAsync_busy_dataset)
+{
+    constexpr int BLOCK_SIZE = 32;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        std::promise<void> oStartedPromise{};
+        std::shared_future<void> oGate{};
+
+        explicit TestRasterBand(std::shared_future<void> oGateIn)
+            : oGate(std::move(oGateIn))
+        {
+            nRasterXSize = BLOCK_SIZE * 2;
+            nRasterYSize = BLOCK_SIZE * 2;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int nBlockXOff, int nBlockYOff,
+                          void *pImage) override
+        {
+            // The first block blocks until the gate is opened
+            if (nBlockXOff == 0 && nBlockYOff == 0)
+            {
+                oStartedPromise.set_value();
+                oGate.wait();
+            }
+            memset(pImage, 0, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        explicit TestDataset(std::shared_future<void> oGate)
+        {
+            nRasterXSize = BLOCK_SIZE * 2;
+            nRasterYSize = BLOCK_SIZE * 2;
+            SetBand(1, new TestRasterBand(std::move(oGate)));
+        }
+    };
+
+    std::promise<void> oGatePromise;
+    TestDataset oDS(oGatePromise.get_future().share());
+    auto poBand = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(1));
+    auto oStarted = poBand->oStartedPromise.get_future();
+
+    const GDALPrefetchWindow sFirstBlock = {0, 0, 1, 1};
+    const GDALPrefetchWindow sLastBlock = {BLOCK_SIZE, BLOCK_SIZE, 1, 1};
+    std::vector<std::future<CPLErr>> aoFutures;
+    aoFutures.push_back(oDS.PrefetchAsync(1, &sFirstBlock, 1, nullptr));
+    oStarted.wait();
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(1);
+    ASSERT_NE(poPool, nullptr);
+    // More requests than workers in the pool
+    const int nThreads = poPool->GetThreadCount();
+    for (int i = 0; i < nThreads; ++i)
+        aoFutures.push_back(oDS.PrefetchAsync(1, &sLastBlock, 1, nullptr));
+
+    // A worker must still be available for other jobs
+    std::promise<void> oJobPromise;
+    auto oJobFuture = oJobPromise.get_future();
+    const bool bSubmitted =
+        poPool->SubmitJob([&oJobPromise]() { oJobPromise.set_value(); });
+    EXPECT_TRUE(bSubmitted);
+    const bool bJobRun =
+        bSubmitted && oJobFuture.wait_for(std::chrono::seconds(10)) ==
+                          std::future_status::ready;
+    oGatePromise.set_value();
+    if (bSubmitted)
+        oJobFuture.wait();
+    EXPECT_TRUE(bJobRun);
+
+    for (auto &oFuture : aoFutures)
+    {
+        ASSERT_TRUE(oFuture.valid());
+        EXPECT_EQ(oFuture.get(), CE_None);
+    }
+}
+
+// Test multi-threaded reading of blocks in GDALDataset::BlockBasedRasterIO()
+TEST_F(test_gdal, BlockBasedRasterIO_multithreaded)
+{
+    constexpr int BLOCK_SIZE = 16;
+    constexpr int BLOCK_COUNT = 8;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        std::atomic<int> nReadCount{0};
+        std::atomic<int> nReadCountInCallerThread{0};
+        // Number of blocks not read by the thread that read the same block
+        // of the first band
+        std::atomic<int> nReadCountInOtherThread{0};
+        const GIntBig nCallerThreadPID = CPLGetPID();
+        std::vector<std::atomic<GIntBig>> &anBlockReaderPID;
+
+        explicit TestRasterBand(
+            std::vector<std::atomic<GIntBig>> &anBlockReaderPIDIn)
+            : anBlockReaderPID(anBlockReaderPIDIn)
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int nBlockXOff, int nBlockYOff,
+                          void *pImage) override
+        {
+            ++nReadCount;
+            if (CPLGetPID() == nCallerThreadPID)
+                ++nReadCountInCallerThread;
+            auto &nBlockReaderPID =
+                anBlockReaderPID[nBlockYOff * BLOCK_COUNT + nBlockXOff];
+            if (nBand == 1)
+                nBlockReaderPID = CPLGetPID();
+            else if (nBlockReaderPID != CPLGetPID())
+                ++nReadCountInOtherThread;
+            memset(pImage, nBlockYOff * BLOCK_COUNT + nBlockXOff,
+                   BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+        std::vector<std::atomic<GIntBig>> m_anBlockReaderPID;
+
+      public:
+        explicit TestDataset(GDALDriver *poDriverIn)
+            : m_anBlockReaderPID(BLOCK_COUNT * BLOCK_COUNT)
+        {
+            poDriver = poDriverIn;
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            SetBand(1, new TestRasterBand(m_anBlockReaderPID));
+            SetBand(2, new TestRasterBand(m_anBlockReaderPID));
+        }
+
+      protected:
+        CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                         int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                         GDALDataType eBufType, int nBandCount,
+                         BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                         GSpacing nLineSpace, GSpacing nBandSpace,
+                         GDALRasterIOExtraArg *psExtraArg) override
+        {
+            return BlockBasedRasterIO(
+                eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                nBufYSize, eBufType, nBandCount, panBandMap, nPixelSpace,
+                nLineSpace, nBandSpace, psExtraArg);
+        }
+    };
+
+    GDALDriver oDriver;
+    oDriver.SetMetadataItem(GDAL_DCAP_CONCURRENT_READ_BLOCK, "YES");
+    TestDataset oDS(&oDriver);
+    auto poBand1 = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(1));
+    auto poBand2 = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(2));
+
+    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+    constexpr int SIZE = BLOCK_SIZE * BLOCK_COUNT;
+    std::vector<GByte> abyBuffer(2 * SIZE * SIZE);
+    // Pixel interleaved buffer
+    EXPECT_EQ(oDS.RasterIO(GF_Read, 0, 0, SIZE, SIZE, abyBuffer.data(), SIZE,
+                           SIZE, GDT_Byte, 2, nullptr, 2, 2 * SIZE, 1, nullptr),
+              CE_None);
+    EXPECT_EQ(poBand1->nReadCount, BLOCK_COUNT * BLOCK_COUNT);
+    EXPECT_EQ(poBand2->nReadCount, BLOCK_COUNT * BLOCK_COUNT);
+    EXPECT_EQ(poBand1->nReadCountInCallerThread, 0);
+    EXPECT_EQ(poBand2->nReadCountInCallerThread, 0);
+    // Both bands of a block are read by the same thread
+    EXPECT_EQ(poBand2->nReadCountInOtherThread, 0);
+    for (int iY = 0; iY < SIZE; ++iY)
+    {
+        for (int iX = 0; iX < SIZE; ++iX)
+        {
+            const GByte nExpected = static_cast<GByte>(
+                (iY / BLOCK_SIZE) * BLOCK_COUNT + iX / BLOCK_SIZE);
+            ASSERT_EQ(abyBuffer[2 * (iY * SIZE + iX)], nExpected);
+            ASSERT_EQ(abyBuffer[2 * (iY * SIZE + iX) + 1], nExpected);
+        }
+    }
+}
+
+// Test that errors of blocks written by worker threads are returned by
+// FlushCache()
+TEST_F(test_gdal, write_behind_error)
+{
+    constexpr int BLOCK_SIZE = 16;
+    constexpr int BLOCK_COUNT = 4;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        TestRasterBand()
+        {
+            eAccess = GA_Update;
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+        bool IsWriteBlockThreadSafe() const override
+        {
+            return true;
+        }
+
+      protected:
+        CPLErr IReadBlock(int, int, void *pImage) override
+        {
+            memset(pImage, 0, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+
+        CPLErr IWriteBlock(int, int, void *) override
+        {
+            return CE_Failure;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            eAccess = GA_Update;
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE * BLOCK_COUNT;
+            SetBand(1, new TestRasterBand());
+        }
+    };
+
+    CPLConfigOptionSetter oSetter("GDAL_WRITE_BEHIND_NUM_THREADS", "2", false);
+    TestDataset oDS;
+    auto poBand = oDS.GetRasterBand(1);
+    constexpr int SIZE = BLOCK_SIZE * BLOCK_COUNT;
+    std::vector<GByte> abyBuffer(SIZE * SIZE, 1);
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, SIZE, SIZE, abyBuffer.data(),
+                               SIZE, SIZE, GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    // The block is written by a worker thread, so its error is deferred
+    EXPECT_EQ(poBand->FlushBlock(0, 0), CE_None);
+
+    CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(poBand->FlushCache(false), CE_Failure);
+    EXPECT_EQ(poBand->FlushCache(false), CE_None);
+}
+
+TEST_F(test_gdal, RasterIOResampled_multithreaded)
+{
+    constexpr int SIZE = 2048;
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", SIZE, SIZE, 1, GDT_Byte, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+    std::vector<GByte> abySrc(SIZE * SIZE);
+    for (int iY = 0; iY < SIZE; ++iY)
+    {
+        for (int iX = 0; iX < SIZE; ++iX)
+            abySrc[iY * SIZE + iX] =
+                static_cast<GByte>((iX * 7 + iY * 13) % 251);
+    }
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, SIZE, SIZE, abySrc.data(), SIZE,
+                               SIZE, GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    // The source is processed in several chunks, which are resampled in
+    // parallel when GDAL_NUM_THREADS is set. Results must not depend on it.
+    constexpr int BUF_XSIZE = 317;
+    constexpr int BUF_YSIZE = 301;
+    for (const bool bNoData : {false, true})
+    {
+        if (bNoData)
+            poBand->SetNoDataValue(0);
+        for (const auto eResampleAlg : {GRIORA_Bilinear, GRIORA_Cubic,
+                                        GRIORA_Average, GRIORA_Mode})
+        {
+            for (const GDALDataType eBufType : {GDT_Byte, GDT_Float32})
+            {
+                const int nDTSize = GDALGetDataTypeSizeBytes(eBufType);
+                std::vector<GByte> abyRef(BUF_XSIZE * BUF_YSIZE * nDTSize);
+                std::vector<GByte> abyMT(abyRef.size());
+                GDALRasterIOExtraArg sExtraArg;
+                INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+                sExtraArg.eResampleAlg = eResampleAlg;
+                ASSERT_EQ(poBand->RasterIO(GF_Read, 1, 2, SIZE - 3, SIZE - 5,
+                                           abyRef.data(), BUF_XSIZE, BUF_YSIZE,
+                                           eBufType, 0, 0, &sExtraArg),
+                          CE_None);
+                {
+                    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4",
+                                                  false);
+                    ASSERT_EQ(poBand->RasterIO(
+                                  GF_Read, 1, 2, SIZE - 3, SIZE - 5,
+                                  abyMT.data(), BUF_XSIZE, BUF_YSIZE, eBufType,
+                                  0, 0, &sExtraArg),
+                              CE_None);
+                }
+                EXPECT_TRUE(abyRef == abyMT)
+                    << "bNoData=" << bNoData
+                    << ", eResampleAlg=" << static_cast<int>(eResampleAlg)
+                    << ", eBufType=" << GDALGetDataTypeName(eBufType);
+            }
+        }
+    }
+}
+
+// Test that ComputeStatistics() and ComputeRasterMinMax() on the generic
+// code path do not depend on GDAL_NUM_THREADS
+TEST_F(test_gdal, ComputeStatistics_multithreaded)
+{
+    constexpr int SIZE = 1000;
+    constexpr float NODATA = -9999.0f;
+    std::vector<float> afValues(SIZE * SIZE);
+    for (int i = 0; i < SIZE * SIZE; ++i)
+    {
+        afValues[i] = (i % 7 == 0)
+                          ? NODATA
+                          : static_cast<float>((i * 37) % 1001) * 0.25f;
+    }
+
+    for (const bool bMask : {false, true})
+    {
+        GDALDatasetUniquePtr poDS(
+            GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+                ->Create("", SIZE, SIZE, 1, GDT_Float32, nullptr));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, SIZE, SIZE, afValues.data(),
+                                   SIZE, SIZE, GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+        if (bMask)
+        {
+            // Mask out the same pixels as the nodata value
+            ASSERT_EQ(poBand->CreateMaskBand(GMF_PER_DATASET), CE_None);
+            std::vector<GByte> abyMask(SIZE * SIZE);
+            for (int i = 0; i < SIZE * SIZE; ++i)
+                abyMask[i] = afValues[i] == NODATA ? 0 : 255;
+            ASSERT_EQ(poBand->GetMaskBand()->RasterIO(
+                          GF_Write, 0, 0, SIZE, SIZE, abyMask.data(), SIZE,
+                          SIZE, GDT_Byte, 0, 0, nullptr),
+                      CE_None);
+        }
+        else
+        {
+            poBand->SetNoDataValue(NODATA);
+        }
+
+        double dfSum = 0;
+        int nValid = 0;
+        for (const float fVal : afValues)
+        {
+            if (fVal != NODATA)
+            {
+                dfSum += fVal;
+                ++nValid;
+            }
+        }
+        const double dfRefMean = dfSum / nValid;
+        double dfSumSq = 0;
+        for (const float fVal : afValues)
+        {
+            if (fVal != NODATA)
+                dfSumSq += (fVal - dfRefMean) * (fVal - dfRefMean);
+        }
+        const double dfRefStdDev = std::sqrt(dfSumSq / nValid);
+
+        double adfStats[4] = {0, 0, 0, 0};
+        ASSERT_EQ(poBand->ComputeStatistics(false, &adfStats[0], &adfStats[1],
+                                            &adfStats[2], &adfStats[3],
+                                            nullptr, nullptr),
+                  CE_None);
+        EXPECT_EQ(adfStats[0], 0.25);
+        EXPECT_EQ(adfStats[1], 250.0);
+        EXPECT_NEAR(adfStats[2], dfRefMean, 1e-10 * dfRefMean);
+        EXPECT_NEAR(adfStats[3], dfRefStdDev, 1e-10 * dfRefStdDev);
+        EXPECT_STREQ(poBand->GetMetadataItem("STATISTICS_VALID_PERCENT"),
+                     "85.71");
+
+        double adfMinMax[2] = {0, 0};
+        ASSERT_EQ(poBand->ComputeRasterMinMax(false, adfMinMax), CE_None);
+
+        {
+            CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+            double adfStatsMT[4] = {0, 0, 0, 0};
+            ASSERT_EQ(poBand->ComputeStatistics(
+                          false, &adfStatsMT[0], &adfStatsMT[1],
+                          &adfStatsMT[2], &adfStatsMT[3], nullptr, nullptr),
+                      CE_None);
+            for (int i = 0; i < 4; ++i)
+                EXPECT_EQ(adfStatsMT[i], adfStats[i]) << "bMask=" << bMask;
+
+            double adfMinMaxMT[2] = {0, 0};
+            ASSERT_EQ(poBand->ComputeRasterMinMax(false, adfMinMaxMT),
+                      CE_None);
+            EXPECT_EQ(adfMinMaxMT[0], adfMinMax[0]);
+            EXPECT_EQ(adfMinMaxMT[1], adfMinMax[1]);
+        }
+        EXPECT_EQ(adfMinMax[0], 0.25);
+        EXPECT_EQ(adfMinMax[1], 250.0);
+    }
+}
+
+TEST_F(test_gdal, PinBlock)
+{
+    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_COUNT = 20;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        std::vector<int> anReadCount = std::vector<int>(BLOCK_COUNT);
+
+        TestRasterBand()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int nBlockXOff, int, void *pImage) override
+        {
+            anReadCount[nBlockXOff]++;
+            memset(pImage, nBlockXOff, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            SetBand(1, new TestRasterBand());
+        }
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    // Room for a few blocks only
+    GDALSetCacheMax64(5 * BLOCK_SIZE * BLOCK_SIZE);
+
+    TestDataset oDS;
+    auto poBand = cpl::down_cast<TestRasterBand *>(oDS.GetRasterBand(1));
+    {
+        auto oPinnedBlock = poBand->PinBlock(1, 0);
+        ASSERT_TRUE(oPinnedBlock);
+        EXPECT_EQ(oPinnedBlock.GetDataType(), GDT_Byte);
+        EXPECT_EQ(oPinnedBlock.GetXSize(), BLOCK_SIZE);
+        EXPECT_EQ(oPinnedBlock.GetYSize(), BLOCK_SIZE);
+        const GByte *pabyData =
+            static_cast<const GByte *>(oPinnedBlock.GetData());
+        EXPECT_EQ(pabyData[0], 1);
+        EXPECT_EQ(pabyData[BLOCK_SIZE * BLOCK_SIZE - 1], 1);
+
+        // Reading other blocks must not evict the pinned block
+        std::vector<GByte> abyBuffer(BLOCK_SIZE * BLOCK_SIZE);
+        for (int i = 0; i < BLOCK_COUNT; ++i)
+        {
+            EXPECT_EQ(poBand->RasterIO(GF_Read, i * BLOCK_SIZE, 0, BLOCK_SIZE,
+                                       BLOCK_SIZE, abyBuffer.data(),
+                                       BLOCK_SIZE, BLOCK_SIZE, GDT_Byte, 0, 0,
+                                       nullptr),
+                      CE_None);
+        }
+        EXPECT_EQ(poBand->anReadCount[1], 1);
+        EXPECT_EQ(pabyData[0], 1);
+
+        GDALPinnedBlock oOtherPinnedBlock;
+        oOtherPinnedBlock = std::move(oPinnedBlock);
+        EXPECT_EQ(oOtherPinnedBlock.GetData(), pabyData);
+    }
+
+    // C API
+    GDALPinnedBlockH hPinnedBlock =
+        GDALRasterBandPinBlock(GDALRasterBand::ToHandle(poBand), 2, 0);
+    ASSERT_NE(hPinnedBlock, nullptr);
+    EXPECT_EQ(
+        static_cast<const GByte *>(GDALPinnedBlockGetData(hPinnedBlock))[0],
+        2);
+    GDALPinnedBlockUnpin(hPinnedBlock);
+
+    {
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(poBand->PinBlock(BLOCK_COUNT, 0));
+        EXPECT_EQ(GDALRasterBandPinBlock(GDALRasterBand::ToHandle(poBand),
+                                         BLOCK_COUNT, 0),
+                  nullptr);
+    }
+
+    oDS.FlushCache(false);
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDALGetCacheArenaStatistics()
+TEST_F(test_gdal, GDALGetCacheArenaStatistics)
+{
+    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_COUNT = 10;
+
+    class TestRasterBand : public GDALRasterBand
+    {
+      public:
+        TestRasterBand()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            nBlockXSize = BLOCK_SIZE;
+            nBlockYSize = BLOCK_SIZE;
+            eDataType = GDT_Byte;
+        }
+
+      protected:
+        CPLErr IReadBlock(int, int, void *pImage) override
+        {
+            memset(pImage, 0, BLOCK_SIZE * BLOCK_SIZE);
+            return CE_None;
+        }
+    };
+
+    class TestDataset : public GDALDataset
+    {
+      public:
+        TestDataset()
+        {
+            nRasterXSize = BLOCK_SIZE * BLOCK_COUNT;
+            nRasterYSize = BLOCK_SIZE;
+            SetBand(1, new TestRasterBand());
+        }
+    };
+
+    const auto nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(10 * 1024 * 1024);
+
+    GIntBig nReservedBefore = -1;
+    GIntBig nUsedBefore = -1;
+    GDALGetCacheArenaStatistics(&nReservedBefore, &nUsedBefore);
+    EXPECT_GE(nReservedBefore, nUsedBefore);
+    EXPECT_GE(nUsedBefore, 0);
+
+    TestDataset oDS;
+    auto poBand = oDS.GetRasterBand(1);
+    for (int i = 0; i < BLOCK_COUNT; ++i)
+    {
+        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(i, 0);
+        ASSERT_NE(poBlock, nullptr);
+        poBlock->DropLock();
+    }
+
+    GIntBig nReserved = -1;
+    GIntBig nUsed = -1;
+    GDALGetCacheArenaStatistics(&nReserved, &nUsed);
+    EXPECT_GE(nReserved, nUsed);
+    if (EQUAL(CPLGetConfigOption("GDAL_RB_CACHE_ALLOCATOR", "DEFAULT"),
+              "ARENA"))
+    {
+        EXPECT_GE(nUsed - nUsedBefore, BLOCK_COUNT * BLOCK_SIZE * BLOCK_SIZE);
+    }
+    else
+    {
+        EXPECT_EQ(nReserved, 0);
+        EXPECT_EQ(nUsed, 0);
+    }
+
+    oDS.FlushCache(false);
+    GDALGetCacheArenaStatistics(nullptr, &nUsed);
+    EXPECT_EQ(nUsed, nUsedBefore);
+
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
 }  // namespace
@@ -3171,6 +3171,123 @@ TEST_F(test_ogr, importFromWkbReuse)
     }
 }
 
+// Test parsing of the numeric values of coordinates in WKT
+TEST_F(test_ogr, importFromWkt_coordinate_values)
+{
+    const auto check = [](const char *pszWKT, int nPoint, double dfX,
+                          double dfY, double dfZ, double dfM)
+    {
+        OGRGeometry *poGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                  OGRERR_NONE)
+            << pszWKT;
+        ASSERT_TRUE(poGeom != nullptr);
+        const auto poLS = poGeom->toLineString();
+        EXPECT_EQ(poLS->getX(nPoint), dfX) << pszWKT;
+        EXPECT_EQ(poLS->getY(nPoint), dfY) << pszWKT;
+        EXPECT_EQ(poLS->getZ(nPoint), dfZ) << pszWKT;
+        EXPECT_EQ(poLS->getM(nPoint), dfM) << pszWKT;
+        delete poGeom;
+    };
+
+    check("LINESTRING (1 2,-3.5 .25)", 1, -3.5, 0.25, 0, 0);
+    check("LINESTRING (1e2 -2.5E-1,3 4)", 0, 100, -0.25, 0, 0);
+    check("LINESTRING Z (1 2 3,4\t5\n6)", 1, 4, 5, 6, 0);
+    check("LINESTRING M (1 2 3,4 5 -6e1)", 1, 4, 5, 0, -60);
+    check("LINESTRING ZM (1 2 3 4,5 6 7 8)", 1, 5, 6, 7, 8);
+    check("LINESTRING (1 2 3 4,5 6 7 8)", 1, 5, 6, 7, 8);
+    check("LINESTRING (0.1000000000000000055511151231257827 2,3 4)", 0, 0.1,
+          2, 0, 0);
+    // Tokens with trailing non-numeric characters are still parsed as
+    // their numeric prefix
+    check("LINESTRING (1.5abc 2,3 4)", 0, 1.5, 2, 0, 0);
+}
+
+// Test that re-importing WKB into an existing multi-ring polygon or
+// collection recycles its parts correctly
+TEST_F(test_ogr, importFromWkbReuseParts)
+{
+    const auto reimport = [](OGRGeometry *poDst, const char *pszWKT)
+    {
+        OGRGeometry *poSrc = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poSrc),
+                  OGRERR_NONE);
+        ASSERT_TRUE(poSrc != nullptr);
+        std::vector<GByte> abyWkb(poSrc->WkbSize());
+        poSrc->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+        size_t nBytesConsumed = 0;
+        EXPECT_EQ(poDst->importFromWkb(abyWkb.data(), abyWkb.size(),
+                                       wkbVariantIso, nBytesConsumed),
+                  OGRERR_NONE);
+        EXPECT_EQ(nBytesConsumed, abyWkb.size());
+        EXPECT_STREQ(poDst->exportToWkt().c_str(),
+                     poSrc->exportToWkt().c_str());
+        delete poSrc;
+    };
+
+    {
+        OGRPolygon oPoly;
+        reimport(&oPoly, "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))");
+        reimport(&oPoly, "POLYGON ((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 "
+                         "0.2,0.1 0.1),(0.5 0.5,0.5 0.6,0.6 0.6,0.5 0.5))");
+        reimport(&oPoly, "POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1))");
+        reimport(&oPoly, "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))");
+        reimport(&oPoly, "POLYGON EMPTY");
+        reimport(&oPoly, "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))");
+    }
+
+    {
+        OGRMultiPolygon oMP;
+        reimport(&oMP, "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 "
+                       "2),(2.1 2.1,2.1 2.2,2.2 2.2,2.1 2.1)))");
+        reimport(&oMP, "MULTIPOLYGON (((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 "
+                       "0.2,0.1 0.1)))");
+        reimport(&oMP, "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 "
+                       "2)),((4 4,4 5,5 5,4 4)))");
+    }
+
+    {
+        OGRGeometryCollection oGC;
+        reimport(&oGC, "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,1 1),"
+                       "GEOMETRYCOLLECTION (POINT (3 4)))");
+        // Same types at the same indices
+        reimport(&oGC, "GEOMETRYCOLLECTION (POINT (5 6),LINESTRING (2 2,3 3,4 "
+                       "4),GEOMETRYCOLLECTION (POINT (7 8),POINT (9 10)))");
+        // Different types at the same indices
+        reimport(&oGC, "GEOMETRYCOLLECTION (LINESTRING (0 0,1 1),POINT (1 2),"
+                       "POLYGON ((0 0,0 1,1 1,0 0)))");
+        reimport(&oGC, "GEOMETRYCOLLECTION (POINT (1 2))");
+        reimport(&oGC, "GEOMETRYCOLLECTION EMPTY");
+    }
+}
+
+// Test OGRSimpleCurve::getRawPoints(), getRawZ() and getRawM()
+TEST_F(test_ogr, OGRSimpleCurve_getRawPoints)
+{
+    OGRLineString oLS;
+    EXPECT_EQ(oLS.getRawZ(), nullptr);
+    EXPECT_EQ(oLS.getRawM(), nullptr);
+
+    oLS.addPoint(1, 2);
+    oLS.addPoint(3, 4);
+    ASSERT_NE(oLS.getRawPoints(), nullptr);
+    EXPECT_EQ(oLS.getRawPoints()[1].x, 3);
+    EXPECT_EQ(oLS.getRawPoints()[1].y, 4);
+    EXPECT_EQ(oLS.getRawZ(), nullptr);
+    EXPECT_EQ(oLS.getRawM(), nullptr);
+
+    oLS.setPoint(1, 3, 4, 5, 6);
+    ASSERT_NE(oLS.getRawZ(), nullptr);
+    ASSERT_NE(oLS.getRawM(), nullptr);
+    EXPECT_EQ(oLS.getRawZ()[1], 5);
+    EXPECT_EQ(oLS.getRawM()[1], 6);
+
+    oLS.flattenTo2D();
+    EXPECT_EQ(oLS.getRawZ(), nullptr);
+    EXPECT_EQ(oLS.getRawM(), nullptr);
+    EXPECT_EQ(oLS.getRawPoints()[0].x, 1);
+}
+
 // Test sealing functionality on OGRFieldDefn
 TEST_F(test_ogr, OGRFieldDefn_sealing)
 {
@@ -4628,6 +4745,216 @@ TEST_F(test_ogr, GetDefaultArcStepSize)
     }
 }
 
+// Test OGRLayer::GetNextFeatureInto()
+TEST_F(test_ogr, GetNextFeatureInto)
+{
+    const auto Check = [](OGRLayer *poLayer, bool bExpectReuse)
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoExpected;
+        poLayer->ResetReading();
+        for (auto &&poFeature : poLayer)
+            apoExpected.emplace_back(poFeature.release());
+        ASSERT_TRUE(!apoExpected.empty());
+
+        poLayer->ResetReading();
+        std::unique_ptr<OGRFeature> poFeature;
+        const OGRFeature *poFirstFeature = nullptr;
+        size_t i = 0;
+        while (poLayer->GetNextFeatureInto(poFeature))
+        {
+            ASSERT_TRUE(poFeature != nullptr);
+            ASSERT_LT(i, apoExpected.size());
+            EXPECT_TRUE(poFeature->Equal(apoExpected[i].get()));
+            if (i == 0)
+            {
+                poFirstFeature = poFeature.get();
+            }
+            else if (bExpectReuse)
+            {
+                EXPECT_EQ(poFeature.get(), poFirstFeature);
+            }
+            ++i;
+        }
+        EXPECT_EQ(i, apoExpected.size());
+
+        // A feature that does not belong to the layer is replaced
+        poLayer->ResetReading();
+        OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn("other");
+        poOtherDefn->Reference();
+        poFeature = std::make_unique<OGRFeature>(poOtherDefn);
+        ASSERT_TRUE(poLayer->GetNextFeatureInto(poFeature));
+        EXPECT_EQ(poFeature->GetDefnRef(), poLayer->GetLayerDefn());
+        EXPECT_TRUE(poFeature->Equal(apoExpected[0].get()));
+        poFeature.reset();
+        poOtherDefn->Release();
+    };
+
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GetGDALDriverManager()->GetDriverByName("MEM")->Create(
+                "", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poLayer = poDS->CreateLayer("test");
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldDefn), OGRERR_NONE);
+        for (int i = 0; i < 3; ++i)
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            if (i != 1)
+                oFeature.SetField(0, CPLSPrintf("value%d", i));
+            oFeature.SetGeometryDirectly(new OGRPoint(i, i));
+            ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE);
+        }
+        Check(poLayer, false);
+    }
+
+    if (GDALGetDriverByName("ESRI Shapefile"))
+    {
+        std::string file(data_ + SEP + "poly.shp");
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poLayer = poDS->GetLayer(0);
+        Check(poLayer, true);
+        poLayer->SetAttributeFilter("EAS_ID > 170");
+        Check(poLayer, true);
+    }
+
+    if (GDALGetDriverByName("GPKG"))
+    {
+        std::string file(data_ + SEP + "poly-1-feature.gpkg");
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        Check(poDS->GetLayer(0), true);
+    }
+}
+
+// Test that OGRFeature::Reset() also unsets null fields
+TEST_F(test_ogr, OGRFeature_Reset_null_field)
+{
+    OGRFeatureDefn *poDefn = new OGRFeatureDefn("test");
+    poDefn->Reference();
+    {
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFeature oFeature(poDefn);
+        oFeature.SetFieldNull(0);
+        EXPECT_TRUE(oFeature.IsFieldNull(0));
+        oFeature.Reset();
+        EXPECT_FALSE(oFeature.IsFieldSet(0));
+        EXPECT_FALSE(oFeature.IsFieldNull(0));
+    }
+    poDefn->Release();
+}
+
+// Test OGRFeature::SetFrom() with a OGRFieldCopyPlan
+TEST_F(test_ogr, OGRFeature_SetFrom_OGRFieldCopyPlan)
+{
+    OGRFeatureDefn *poSrcDefn = new OGRFeatureDefn("src");
+    poSrcDefn->Reference();
+    OGRFeatureDefn *poDstDefn = new OGRFeatureDefn("dst");
+    poDstDefn->Reference();
+
+    const struct
+    {
+        OGRFieldType eSrcType;
+        OGRFieldType eDstType;
+        OGRFieldSubType eDstSubType;
+    } asFields[] = {
+        {OFTInteger, OFTInteger, OFSTNone},
+        {OFTInteger64, OFTInteger64, OFSTNone},
+        {OFTReal, OFTReal, OFSTNone},
+        {OFTString, OFTString, OFSTNone},
+        {OFTDateTime, OFTDateTime, OFSTNone},
+        {OFTInteger, OFTReal, OFSTNone},
+        {OFTInteger64, OFTString, OFSTNone},
+        {OFTString, OFTInteger, OFSTNone},
+        {OFTDateTime, OFTString, OFSTNone},
+        {OFTIntegerList, OFTString, OFSTJSON},
+        {OFTRealList, OFTRealList, OFSTNone},
+        {OFTString, OFTString, OFSTNone},
+    };
+    std::vector<int> anMap;
+    for (const auto &sField : asFields)
+    {
+        const int i = poSrcDefn->GetFieldCount();
+        OGRFieldDefn oSrcFieldDefn(CPLSPrintf("src%d", i), sField.eSrcType);
+        poSrcDefn->AddFieldDefn(&oSrcFieldDefn);
+        OGRFieldDefn oDstFieldDefn(CPLSPrintf("dst%d", i), sField.eDstType);
+        oDstFieldDefn.SetSubType(sField.eDstSubType);
+        poDstDefn->AddFieldDefn(&oDstFieldDefn);
+        anMap.push_back(i);
+    }
+    // Ignore the last source field
+    anMap.back() = -1;
+    {
+        OGRGeomFieldDefn oGeomFieldDefn("geom", wkbPoint);
+        poSrcDefn->AddGeomFieldDefn(&oGeomFieldDefn);
+        poDstDefn->AddGeomFieldDefn(&oGeomFieldDefn);
+    }
+
+    OGRFeature oSrcFeature(poSrcDefn);
+    oSrcFeature.SetField(0, 1);
+    oSrcFeature.SetField(1, static_cast<GIntBig>(1234567890123));
+    oSrcFeature.SetField(2, 1.5);
+    oSrcFeature.SetField(3, "foo");
+    oSrcFeature.SetField(4, 2025, 1, 2, 3, 4, 5.5f, 100);
+    oSrcFeature.SetField(5, 3);
+    oSrcFeature.SetField(6, static_cast<GIntBig>(-1234567890123));
+    oSrcFeature.SetField(7, "12");
+    oSrcFeature.SetField(8, 2025, 1, 2, 3, 4, 5.5f, 100);
+    const int anValues[] = {1, 2};
+    oSrcFeature.SetField(9, 2, anValues);
+    oSrcFeature.SetFieldNull(10);
+    oSrcFeature.SetField(11, "ignored");
+    oSrcFeature.SetGeometryDirectly(new OGRPoint(1, 2));
+    oSrcFeature.SetStyleString("PEN(c:#FF0000)");
+
+    const OGRFieldCopyPlan oPlan(poSrcDefn, poDstDefn, anMap.data(), true);
+    OGRFeature oDstFeature(poDstDefn);
+    oDstFeature.SetField(10, 1, &(anValues[0]));
+    ASSERT_EQ(oDstFeature.SetFrom(&oSrcFeature, oPlan), OGRERR_NONE);
+
+    OGRFeature oRefFeature(poDstDefn);
+    oRefFeature.SetField(10, 1, &(anValues[0]));
+    ASSERT_EQ(oRefFeature.SetFrom(&oSrcFeature, anMap.data(), TRUE, true),
+              OGRERR_NONE);
+
+    EXPECT_TRUE(oDstFeature.Equal(&oRefFeature));
+    EXPECT_EQ(oDstFeature.GetFieldAsInteger64(1), 1234567890123);
+    EXPECT_STREQ(oDstFeature.GetFieldAsString(3), "foo");
+    EXPECT_EQ(oDstFeature.GetFieldAsDouble(5), 3.0);
+    EXPECT_STREQ(oDstFeature.GetFieldAsString(6), "-1234567890123");
+    EXPECT_EQ(oDstFeature.GetFieldAsInteger(7), 12);
+    EXPECT_STREQ(oDstFeature.GetFieldAsString(8), "2025-01-02T03:04:05.500Z");
+    EXPECT_TRUE(oDstFeature.IsFieldNull(10));
+    EXPECT_FALSE(oDstFeature.IsFieldSet(11));
+    ASSERT_NE(oDstFeature.GetGeometryRef(), nullptr);
+    EXPECT_STREQ(oDstFeature.GetStyleString(), "PEN(c:#FF0000)");
+
+    // Unset fields are unset in the target feature
+    oSrcFeature.UnsetField(3);
+    ASSERT_EQ(oDstFeature.SetFrom(&oSrcFeature, oPlan), OGRERR_NONE);
+    EXPECT_FALSE(oDstFeature.IsFieldSet(3));
+
+    // A feature of another definition falls back to the field map
+    {
+        OGRFeatureDefn *poOtherDefn = poSrcDefn->Clone();
+        poOtherDefn->Reference();
+        OGRFeature oOtherFeature(poOtherDefn);
+        oOtherFeature.SetField(3, "bar");
+        ASSERT_EQ(oDstFeature.SetFrom(&oOtherFeature, oPlan), OGRERR_NONE);
+        EXPECT_STREQ(oDstFeature.GetFieldAsString(3), "bar");
+        EXPECT_FALSE(oDstFeature.IsFieldSet(0));
+        poOtherDefn->Release();
+    }
+
+    poSrcDefn->Release();
+    poDstDefn->Release();
+}
+
 TEST_F(test_ogr, OGRPolygon_two_vertex_constructor)
 {
     OGRPolygon p(1, 2, 3, 4);
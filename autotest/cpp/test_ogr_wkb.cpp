@@ -47,6 +47,12 @@ class OGRWKBGetEnvelopeFixture
                             "LINESTRING_EMPTY"),
             std::make_tuple("LINESTRING Z (3 4 5,1 2 6)", 1, 2, 3, 4,
                             "LINESTRING_3D"),
+            std::make_tuple("LINESTRING(0 0,5 -1,2 7,-3 4,1 1)", -3, -1, 5, 7,
+                            "LINESTRING_ODD_POINT_COUNT"),
+            std::make_tuple("LINESTRING M (0 0 1,5 -1 2,2 7 3,-3 4 4)", -3, -1,
+                            5, 7, "LINESTRING_M"),
+            std::make_tuple("LINESTRING ZM (0 0 1 2,5 -1 2 3,2 7 3 4)", 0, -1,
+                            5, 7, "LINESTRING_ZM"),
             std::make_tuple("POLYGON((0 1,0 2,3 2,0 1))", 0, 1, 3, 2,
                             "POLYGON"),
             std::make_tuple("POLYGON EMPTY", INF, INF, -INF, -INF,
@@ -858,4 +864,192 @@ TEST_F(test_ogr_wkb, OGRWKBTransformFixture_ct_failure)
     }
 }
 
+TEST_F(test_ogr_wkb, OGRWKBGeometryView)
+{
+    for (const char *pszWKT :
+         {"POINT (1 2)", "POINT EMPTY", "POINT ZM (1 2 3 4)",
+          "LINESTRING (0 0,3 4,3 10)", "LINESTRING Z EMPTY",
+          "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))",
+          "POLYGON M ((0 0 1,0 10 2,10 10 3,0 0 4))", "POLYGON EMPTY",
+          "MULTIPOINT ((1 2),(3 4))",
+          "MULTILINESTRING ((0 0,1 1),(2 2,3 3,4 4))",
+          "MULTIPOLYGON (((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+          "((20 20,20 30,30 30,20 20)))",
+          "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,1 1),"
+          "GEOMETRYCOLLECTION (POLYGON ((0 0,0 1,1 1,0 0))))",
+          "GEOMETRYCOLLECTION EMPTY"})
+    {
+        auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(pszWKT);
+        ASSERT_EQ(eErr, OGRERR_NONE) << pszWKT;
+        for (const auto eByteOrder : {wkbNDR, wkbXDR})
+        {
+            std::vector<GByte> abyWkb(poGeom->WkbSize() + 1);
+            poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+            const OGRWKBGeometryView oView(abyWkb.data(), abyWkb.size());
+            ASSERT_TRUE(oView.IsValid()) << pszWKT;
+            EXPECT_EQ(oView.GetWkbSize(), abyWkb.size() - 1) << pszWKT;
+            EXPECT_EQ(oView.GetGeometryType(), poGeom->getGeometryType())
+                << pszWKT;
+            EXPECT_EQ(oView.Is3D(), CPL_TO_BOOL(poGeom->Is3D())) << pszWKT;
+            EXPECT_EQ(oView.IsMeasured(), CPL_TO_BOOL(poGeom->IsMeasured()))
+                << pszWKT;
+            EXPECT_EQ(oView.IsEmpty(), CPL_TO_BOOL(poGeom->IsEmpty()))
+                << pszWKT;
+            if (!poGeom->IsEmpty())
+            {
+                OGREnvelope sEnvelope;
+                poGeom->getEnvelope(&sEnvelope);
+                EXPECT_TRUE(oView.GetEnvelope() == sEnvelope) << pszWKT;
+            }
+            EXPECT_NEAR(oView.GetArea(), OGR_G_Area(poGeom.get()), 1e-10)
+                << pszWKT;
+            EXPECT_NEAR(oView.GetLength(), OGR_G_Length(poGeom.get()), 1e-10)
+                << pszWKT;
+            auto poGeomFromView = oView.ToGeometry();
+            ASSERT_TRUE(poGeomFromView != nullptr) << pszWKT;
+            EXPECT_STREQ(poGeomFromView->exportToWkt().c_str(),
+                         poGeom->exportToWkt().c_str());
+        }
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_accessors)
+{
+    auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(
+        "GEOMETRYCOLLECTION (POINT (1 2),"
+        "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+        "LINESTRING (5 6,7 8))");
+    ASSERT_EQ(eErr, OGRERR_NONE);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbXDR, abyWkb.data(), wkbVariantIso);
+    const OGRWKBGeometryView oView(abyWkb.data(), abyWkb.size());
+    ASSERT_TRUE(oView.IsValid());
+    ASSERT_EQ(oView.GetNumGeometries(), 3U);
+    EXPECT_EQ(oView.GetNumRings(), 0U);
+    EXPECT_EQ(oView.GetPoints().size(), 0U);
+    EXPECT_FALSE(oView.GetGeometry(3).IsValid());
+
+    {
+        const auto oPoint = oView.GetGeometry(0);
+        EXPECT_EQ(oPoint.GetGeometryType(), wkbPoint);
+        const auto oPoints = oPoint.GetPoints();
+        ASSERT_EQ(oPoints.size(), 1U);
+        EXPECT_EQ(oPoints.getX(0), 1);
+        EXPECT_EQ(oPoints.getY(0), 2);
+        EXPECT_EQ(oPoints.getZ(0), 0);
+        EXPECT_EQ(oPoints.getM(0), 0);
+    }
+
+    {
+        const auto oPoly = oView.GetGeometry(1);
+        EXPECT_EQ(oPoly.GetGeometryType(), wkbPolygon);
+        ASSERT_EQ(oPoly.GetNumRings(), 2U);
+        EXPECT_EQ(oPoly.GetRing(2).size(), 0U);
+        const auto oRing = oPoly.GetRing(1);
+        ASSERT_EQ(oRing.size(), 5U);
+        EXPECT_EQ(oRing.getX(1), 2);
+        EXPECT_EQ(oRing.getY(1), 1);
+        EXPECT_EQ(oRing.getZ(1), 0);
+        EXPECT_TRUE(oPoly.ContainsPoint(5, 5));
+        EXPECT_FALSE(oPoly.ContainsPoint(1.5, 1.5));
+        EXPECT_FALSE(oPoly.ContainsPoint(15, 5));
+        EXPECT_TRUE(oView.ContainsPoint(5, 5));
+    }
+
+    {
+        const auto oLS = oView.GetGeometry(2);
+        EXPECT_EQ(oLS.GetGeometryType(), wkbLineString);
+        const auto oPoints = oLS.GetPoints();
+        ASSERT_EQ(oPoints.size(), 2U);
+        EXPECT_EQ(oPoints.getX(1), 7);
+        EXPECT_EQ(oPoints.getY(1), 8);
+        EXPECT_FALSE(oLS.ContainsPoint(5, 6));
+    }
+
+    {
+        OGRLineString oLS;
+        oLS.addPoint(1, 2, 3, 4);
+        oLS.addPoint(5, 6, 7, 8);
+        std::vector<GByte> abyLSWkb(oLS.WkbSize());
+        static_cast<OGRGeometry &>(oLS).exportToWkb(wkbNDR, abyLSWkb.data(),
+                                                    wkbVariantIso);
+        const OGRWKBGeometryView oLSView(abyLSWkb.data(), abyLSWkb.size());
+        EXPECT_EQ(oLSView.GetGeometryType(), wkbLineStringZM);
+        const auto oPoints = oLSView.GetPoints();
+        ASSERT_EQ(oPoints.size(), 2U);
+        EXPECT_EQ(oPoints.getX(1), 5);
+        EXPECT_EQ(oPoints.getY(1), 6);
+        EXPECT_EQ(oPoints.getZ(1), 7);
+        EXPECT_EQ(oPoints.getM(1), 8);
+    }
+
+    // Truncated WKB
+    for (size_t i = 0; i < abyWkb.size(); ++i)
+    {
+        EXPECT_FALSE(OGRWKBGeometryView(abyWkb.data(), i).IsValid());
+    }
+
+    // Unhandled geometry type
+    {
+        auto [poCurve, eErrCurve] =
+            OGRGeometryFactory::createFromWkt("CIRCULARSTRING (0 0,1 1,2 0)");
+        ASSERT_EQ(eErrCurve, OGRERR_NONE);
+        std::vector<GByte> abyCurveWkb(poCurve->WkbSize());
+        poCurve->exportToWkb(wkbNDR, abyCurveWkb.data(), wkbVariantIso);
+        const OGRWKBGeometryView oCurveView(abyCurveWkb.data(),
+                                            abyCurveWkb.size());
+        EXPECT_FALSE(oCurveView.IsValid());
+        EXPECT_TRUE(oCurveView.ToGeometry() == nullptr);
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRSimpleCurve_getEnvelope_vs_OGRWKBGetBoundingBox)
+{
+    for (int nPoints = 1; nPoints < 10; ++nPoints)
+    {
+        OGRLineString oLS;
+        double dfMinX = std::numeric_limits<double>::infinity();
+        double dfMinY = std::numeric_limits<double>::infinity();
+        double dfMaxX = -std::numeric_limits<double>::infinity();
+        double dfMaxY = -std::numeric_limits<double>::infinity();
+        for (int i = 0; i < nPoints; ++i)
+        {
+            const double dfX = ((i * 7) % 5) - 2.5;
+            const double dfY = ((i * 3) % 4) + 10;
+            oLS.addPoint(dfX, dfY);
+            dfMinX = std::min(dfMinX, dfX);
+            dfMinY = std::min(dfMinY, dfY);
+            dfMaxX = std::max(dfMaxX, dfX);
+            dfMaxY = std::max(dfMaxY, dfY);
+        }
+        if (nPoints >= 3)
+        {
+            // NaN coordinates after the first point are ignored
+            oLS.addPoint(std::numeric_limits<double>::quiet_NaN(),
+                         std::numeric_limits<double>::quiet_NaN());
+        }
+
+        OGREnvelope sEnvelope;
+        oLS.getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, dfMinX) << nPoints;
+        EXPECT_EQ(sEnvelope.MinY, dfMinY) << nPoints;
+        EXPECT_EQ(sEnvelope.MaxX, dfMaxX) << nPoints;
+        EXPECT_EQ(sEnvelope.MaxY, dfMaxY) << nPoints;
+
+        for (const auto eByteOrder : {wkbNDR, wkbXDR})
+        {
+            std::vector<GByte> abyWkb(oLS.WkbSize());
+            static_cast<OGRGeometry &>(oLS).exportToWkb(
+                eByteOrder, abyWkb.data(), wkbVariantIso);
+            OGREnvelope sWKBEnvelope;
+            EXPECT_TRUE(OGRWKBGetBoundingBox(abyWkb.data(), abyWkb.size(),
+                                             sWKBEnvelope));
+            EXPECT_EQ(sWKBEnvelope.MinX, dfMinX) << nPoints;
+            EXPECT_EQ(sWKBEnvelope.MinY, dfMinY) << nPoints;
+            EXPECT_EQ(sWKBEnvelope.MaxX, dfMaxX) << nPoints;
+            EXPECT_EQ(sWKBEnvelope.MaxY, dfMaxY) << nPoints;
+        }
+    }
+}
+
 }  // namespace
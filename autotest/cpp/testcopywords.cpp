@@ -15,8 +15,10 @@
 #include "gdal.h"
 
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -1335,4 +1337,94 @@ TEST_F(TestCopyWords, Int16ToInt16)
     }
 }
 
+// Check that conversions of arrays large enough to go through the
+// vectorized code paths give the same result as word-by-word conversions
+TEST_F(TestCopyWords, LargeArraysSameAsWordByWord)
+{
+    const double adfValues[] = {0,
+                                -0.0,
+                                0.5,
+                                -0.5,
+                                1.5,
+                                -1.5,
+                                2.5,
+                                127.5,
+                                254.5,
+                                255.5,
+                                256,
+                                -1,
+                                32767.5,
+                                -32768.5,
+                                65535.5,
+                                65536,
+                                -65536,
+                                123.456,
+                                -123.456,
+                                2147483647.5,
+                                -2147483648.5,
+                                1e10,
+                                -1e10,
+                                3.5e38,
+                                -3.5e38,
+                                1e300,
+                                -1e300,
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::quiet_NaN()};
+    constexpr int nValues = static_cast<int>(CPL_ARRAYSIZE(adfValues));
+    constexpr int N = 300;
+    const GDALDataType aeTypes[] = {GDT_Byte,  GDT_Int16,   GDT_UInt16,
+                                    GDT_Int32, GDT_Float32, GDT_Float64};
+    for (const GDALDataType eIn : aeTypes)
+    {
+        const int nInSize = GDALGetDataTypeSizeBytes(eIn);
+        for (const GDALDataType eOut : aeTypes)
+        {
+            const int nOutSize = GDALGetDataTypeSizeBytes(eOut);
+            for (int nStride = 1; nStride <= 3; nStride += 2)
+            {
+                std::vector<GByte> abyIn(N * nInSize * nStride);
+                for (int i = 0; i < N; ++i)
+                {
+                    GDALCopyWords(&adfValues[(i * 7) % nValues], GDT_Float64,
+                                  0, &abyIn[i * nInSize * nStride], eIn, 0,
+                                  1);
+                }
+
+                // Strided input and packed output, and packed input and
+                // strided output.
+                std::vector<GByte> abyOutPacked(N * nOutSize);
+                GDALCopyWords(abyIn.data(), eIn, nInSize * nStride,
+                              abyOutPacked.data(), eOut, nOutSize, N);
+                std::vector<GByte> abyInPacked(N * nInSize);
+                GDALCopyWords(abyIn.data(), eIn, nInSize * nStride,
+                              abyInPacked.data(), eIn, nInSize, N);
+                std::vector<GByte> abyOutStrided(N * nOutSize * nStride);
+                GDALCopyWords(abyInPacked.data(), eIn, nInSize,
+                              abyOutStrided.data(), eOut, nOutSize * nStride,
+                              N);
+
+                for (int i = 0; i < N; ++i)
+                {
+                    GByte abyExpected[8];
+                    GDALCopyWords(&abyInPacked[i * nInSize], eIn, 0,
+                                  abyExpected, eOut, 0, 1);
+                    EXPECT_EQ(memcmp(&abyOutPacked[i * nOutSize], abyExpected,
+                                     nOutSize),
+                              0)
+                        << GDALGetDataTypeName(eIn) << " -> "
+                        << GDALGetDataTypeName(eOut) << ", i=" << i
+                        << ", stride=" << nStride;
+                    EXPECT_EQ(memcmp(&abyOutStrided[i * nOutSize * nStride],
+                                     abyExpected, nOutSize),
+                              0)
+                        << GDALGetDataTypeName(eIn) << " -> "
+                        << GDALGetDataTypeName(eOut) << ", i=" << i
+                        << ", stride=" << nStride;
+                }
+            }
+        }
+    }
+}
+
 }  // namespace
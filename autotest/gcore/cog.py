@@ -831,6 +831,56 @@ def test_cog_invalidation_by_data_change():
         gdal.GetDriverByName("GTiff").Delete(filename)
 
 
+###############################################################################
+# Test PARTIAL_REFRESH_OVERVIEWS=YES open option
+
+
+@pytest.mark.parametrize("partial_refresh", [True, False])
+@gdaltest.enable_exceptions()
+def test_cog_update_partial_refresh_overviews(tmp_vsimem, partial_refresh):
+
+    filename = str(tmp_vsimem / "cog.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 256, 256)
+    src_ds.GetRasterBand(1).Fill(10)
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename,
+        src_ds,
+        options=["BLOCKSIZE=32", "RESAMPLING=AVERAGE", "COMPRESS=DEFLATE"],
+    )
+
+    open_options = ["IGNORE_COG_LAYOUT_BREAK=YES"]
+    if partial_refresh:
+        open_options += ["PARTIAL_REFRESH_OVERVIEWS=YES", "OVERVIEW_RESAMPLING=AVERAGE"]
+    ds = gdal.OpenEx(filename, gdal.GA_Update, open_options=open_options)
+    assert ds.GetRasterBand(1).GetOverviewCount() == 3
+    ovr_checksums_before = [
+        ds.GetRasterBand(1).GetOverview(i).Checksum() for i in range(3)
+    ]
+    patch = b"\xc8" * (40 * 50)
+    ds.GetRasterBand(1).WriteRaster(70, 100, 40, 50, patch)
+    src_ds.GetRasterBand(1).WriteRaster(70, 100, 40, 50, patch)
+    with gdal.quiet_errors():
+        ds.Close()
+
+    ref_filename = str(tmp_vsimem / "ref.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        ref_filename,
+        src_ds,
+        options=["BLOCKSIZE=32", "RESAMPLING=AVERAGE", "COMPRESS=DEFLATE"],
+    )
+    ref_ds = gdal.Open(ref_filename)
+
+    with gdal.quiet_errors():
+        ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+    for i in range(3):
+        got = ds.GetRasterBand(1).GetOverview(i).Checksum()
+        if partial_refresh:
+            assert got == ref_ds.GetRasterBand(1).GetOverview(i).Checksum()
+        else:
+            assert got == ovr_checksums_before[i]
+
+
 ###############################################################################
 # Test editing and invalidating a COG file
 
@@ -2261,3 +2311,39 @@ def test_cog_write_interleave_tile_webp_error(tmp_vsimem):
             gdal.Open("data/rgbsmall.tif"),
             options=["INTERLEAVE=TILE", "COMPRESS=WEBP"],
         )
+
+
+###############################################################################
+# Test that overview tiles copied verbatim from the temporary overview file
+# give the same result as decompressing and recompressing them
+
+
+@pytest.mark.parametrize(
+    "creation_options",
+    [
+        ["COMPRESS=LZW"],
+        ["COMPRESS=DEFLATE", "LEVEL=1", "PREDICTOR=YES", "OVERVIEW_PREDICTOR=YES"],
+        ["COMPRESS=DEFLATE", "INTERLEAVE=TILE"],
+    ],
+)
+def test_cog_raw_copy_of_overview_tiles(tmp_path, creation_options):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", options="-of MEM -outsize 1000 1000 -r bilinear"
+    )
+
+    ref_filename = str(tmp_path / "ref.tif")
+    with gdal.config_option("COG_TMP_COMPRESSION", "LZW"):
+        gdal.GetDriverByName("COG").CreateCopy(
+            ref_filename, src_ds, options=creation_options + ["BLOCKSIZE=128"]
+        )
+
+    out_filename = str(tmp_path / "out.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        out_filename, src_ds, options=creation_options + ["BLOCKSIZE=128"]
+    )
+
+    _check_cog(out_filename)
+    with gdal.Open(out_filename) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 3
+    assert open(ref_filename, "rb").read() == open(out_filename, "rb").read()
@@ -374,6 +374,90 @@ def test_geoloc_affine_transformation_with_noise(step, convention):
     gdal.Unlink("/vsimem/lat.tif")
 
 
+###############################################################################
+# Test that batched inverse transformations, processed in Hilbert order or
+# in parallel, give the same results as the default point by point processing
+
+
+@pytest.mark.parametrize(
+    "use_temp_datasets,num_threads", [("NO", "1"), ("YES", "1"), ("NO", "4")]
+)
+def test_geoloc_inverse_transform_batch(tmp_vsimem, use_temp_datasets, num_threads):
+
+    r = random.Random(0)
+
+    lon_filename = str(tmp_vsimem / "lon.tif")
+    lat_filename = str(tmp_vsimem / "lat.tif")
+    size = 100
+    lon_ds = gdal.GetDriverByName("GTiff").Create(
+        lon_filename, size, size, 1, gdal.GDT_Float32
+    )
+    lat_ds = gdal.GetDriverByName("GTiff").Create(
+        lat_filename, size, size, 1, gdal.GDT_Float32
+    )
+    for y in range(size):
+        lon_ds.WriteRaster(
+            0,
+            y,
+            size,
+            1,
+            array.array(
+                "f",
+                [
+                    -80 + 0.1 * x + 0.02 * y + r.uniform(-0.01, 0.01)
+                    for x in range(size)
+                ],
+            ),
+        )
+        lat_ds.WriteRaster(
+            0,
+            y,
+            size,
+            1,
+            array.array(
+                "f",
+                [
+                    50 - 0.1 * y + 0.02 * x + r.uniform(-0.01, 0.01)
+                    for x in range(size)
+                ],
+            ),
+        )
+    lon_ds = None
+    lat_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": lon_filename,
+        "X_BAND": "1",
+        "Y_DATASET": lat_filename,
+        "Y_BAND": "1",
+        "SRS": "EPSG:4326",
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+
+    points = [(r.uniform(-81, -68), r.uniform(40, 53)) for i in range(5000)]
+
+    def transform(options):
+        tr = gdal.Transformer(ds, None, options)
+        return tr.TransformPoints(True, points)
+
+    with gdaltest.config_option("GDAL_GEOLOC_USE_TEMP_DATASETS", "NO"):
+        ref_points, ref_success = transform([])
+    assert sum(ref_success) > 1000
+    assert sum(ref_success) < len(points)
+
+    with gdaltest.config_option("GDAL_GEOLOC_USE_TEMP_DATASETS", use_temp_datasets):
+        got_points, got_success = transform([f"GEOLOC_NUM_THREADS={num_threads}"])
+    assert got_success == ref_success
+    for got, ref, success in zip(got_points, ref_points, ref_success):
+        if success:
+            assert got == pytest.approx(ref, abs=1e-6)
+
+
 ###############################################################################
 # Test GEOLOC_ARRAY transformer option to have the warped dataset != geolocation dataset
 
@@ -12,6 +12,8 @@
 ###############################################################################
 
 
+import pytest
+
 from osgeo import gdal
 
 ###############################################################################
@@ -83,3 +85,36 @@ def test_identify_4():
             "../gdrivers/data/envi/aea.dat", sibling_files=["aea.dat", "aea.hdr"]
         )
         assert dr is not None, "Did not get a driver!"
+
+
+###############################################################################
+# Test that drivers declaring DMD_OPEN_SIGNATURES are skipped for files that
+# do not match them
+
+
+def test_identify_open_signatures():
+
+    drv = gdal.GetDriverByName("GTiff")
+    assert "49492A00" in drv.GetMetadataItem(gdal.DMD_OPEN_SIGNATURES)
+
+    drv = gdal.GetDriverByName("BMP")
+    if drv is None:
+        pytest.skip("BMP driver not available")
+    assert drv.GetMetadataItem(gdal.DMD_OPEN_SIGNATURES) is None
+
+    assert gdal.IdentifyDriverEx("data/1bit.bmp").GetDescription() == "BMP"
+
+    # Declare a signature that does not match: the driver is no longer probed
+    drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, "FFFF")
+    try:
+        assert gdal.IdentifyDriverEx("data/1bit.bmp", allowed_drivers=["BMP"]) is None
+        with pytest.raises(Exception):
+            gdal.OpenEx("data/1bit.bmp", allowed_drivers=["BMP"])
+
+        # "BM"
+        drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, "FFFF 424D")
+        assert gdal.OpenEx("data/1bit.bmp", allowed_drivers=["BMP"]) is not None
+    finally:
+        drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, None)
+
+    assert gdal.OpenEx("data/1bit.bmp", allowed_drivers=["BMP"]) is not None
@@ -19,7 +19,7 @@ import threading
 import gdaltest
 import pytest
 
-from osgeo import gdal
+from osgeo import gdal, osr
 
 pytestmark = pytest.mark.require_driver("LIBERTIFF")
 
@@ -866,3 +866,115 @@ def test_libertiff_corrupted_lzw():
     ds = libertiff_open("data/gtiff/lzw_corrupted.tif")
     with pytest.raises(Exception):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test CreateCopy()
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["COMPRESS=DEFLATE", "BLOCKSIZE=16"],
+        ["COMPRESS=DEFLATE", "LEVEL=1", "NUM_THREADS=4", "BLOCKSIZE=32"],
+        ["COMPRESS=DEFLATE", "INTERLEAVE=BAND", "BLOCKSIZE=16", "NUM_THREADS=2"],
+        ["BIGTIFF=YES", "BLOCKSIZE=16"],
+    ],
+)
+@pytest.mark.parametrize(
+    "datatype", [gdal.GDT_Byte, gdal.GDT_Int16, gdal.GDT_Float64]
+)
+def test_libertiff_create_copy(tmp_vsimem, options, datatype):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM", outputType=datatype)
+    src_ds.SetMetadataItem("FOO", "BAR")
+    src_ds.GetRasterBand(1).SetNoDataValue(1)
+    src_ds.GetRasterBand(2).SetOffset(1.5)
+    src_ds.GetRasterBand(2).SetScale(2.5)
+    src_ds.GetRasterBand(3).SetDescription("blue")
+
+    out_filename = tmp_vsimem / "out.tif"
+    out_ds = gdal.GetDriverByName("LIBERTIFF").CreateCopy(
+        out_filename, src_ds, options=options
+    )
+    assert out_ds.GetDriver().GetDescription() == "LIBERTIFF"
+    out_ds.Close()
+
+    # Check with both the LIBERTIFF and GTiff readers
+    for driver in ["LIBERTIFF", "GTiff"]:
+        ds = gdal.OpenEx(out_filename, allowed_drivers=[driver])
+        assert ds.RasterCount == 3
+        assert ds.GetRasterBand(1).DataType == datatype
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+        assert ds.GetGeoTransform() == pytest.approx(src_ds.GetGeoTransform())
+        assert ds.GetSpatialRef().GetAuthorityCode(None) == "4326"
+        assert ds.GetMetadataItem("FOO") == "BAR"
+        assert ds.GetMetadataItem("AREA_OR_POINT") == "Area"
+        assert ds.GetRasterBand(1).GetNoDataValue() == 1
+        assert ds.GetRasterBand(2).GetOffset() == 1.5
+        assert ds.GetRasterBand(2).GetScale() == 2.5
+        assert ds.GetRasterBand(3).GetDescription() == "blue"
+        assert ds.GetRasterBand(1).GetColorInterpretation() == gdal.GCI_RedBand
+        block_size = int(
+            {x.split("=")[0]: x.split("=")[1] for x in options}.get("BLOCKSIZE", 256)
+        )
+        assert ds.GetRasterBand(1).GetBlockSize() == [block_size, block_size]
+        if driver == "GTiff":
+            compress = {x.split("=")[0]: x.split("=")[1] for x in options}.get(
+                "COMPRESS"
+            )
+            assert ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE") == compress
+            interleave = "BAND" if "INTERLEAVE=BAND" in options else "PIXEL"
+            assert ds.GetMetadataItem("INTERLEAVE", "IMAGE_STRUCTURE") == interleave
+        ds.Close()
+
+    f = gdal.VSIFOpenL(out_filename, "rb")
+    header = gdal.VSIFReadL(1, 4, f)
+    gdal.VSIFCloseL(f)
+    assert header[2] == (43 if "BIGTIFF=YES" in options else 42)
+
+
+def test_libertiff_create_copy_color_table_and_point(tmp_vsimem):
+
+    src_ds = gdal.Open("data/test_average_palette.tif")
+    mem_ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+    mem_ds.SetMetadataItem("AREA_OR_POINT", "Point")
+    mem_ds.SetGeoTransform([2, 1, 0, 49, 0, -1])
+    out_filename = tmp_vsimem / "out.tif"
+    gdal.GetDriverByName("LIBERTIFF").CreateCopy(out_filename, mem_ds)
+
+    ds = libertiff_open(out_filename)
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+    ct = ds.GetRasterBand(1).GetColorTable()
+    assert ct is not None
+    src_ct = src_ds.GetRasterBand(1).GetColorTable()
+    for i in range(src_ct.GetCount()):
+        assert ct.GetColorEntry(i)[0:3] == src_ct.GetColorEntry(i)[0:3]
+    assert ds.GetMetadataItem("AREA_OR_POINT") == "Point"
+    assert ds.GetGeoTransform() == pytest.approx((2, 1, 0, 49, 0, -1))
+
+
+def test_libertiff_create_copy_errors(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    drv = gdal.GetDriverByName("LIBERTIFF")
+    with pytest.raises(Exception, match="COMPRESS=JPEG not supported"):
+        drv.CreateCopy(tmp_vsimem / "out.tif", src_ds, options=["COMPRESS=JPEG"])
+    with pytest.raises(Exception, match="BLOCKSIZE must be a multiple of 16"):
+        drv.CreateCopy(tmp_vsimem / "out.tif", src_ds, options=["BLOCKSIZE=17"])
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1, 1, gdal.GDT_CInt16)
+    with pytest.raises(Exception, match="does not support data type CInt16"):
+        drv.CreateCopy(tmp_vsimem / "out.tif", src_ds)
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    srs = osr.SpatialReference()
+    srs.SetFromUserInput("+proj=tmerc +lat_0=1.5 +k=0.99")
+    src_ds.SetSpatialRef(srs)
+    with pytest.raises(Exception, match="only supports writing CRS"):
+        drv.CreateCopy(tmp_vsimem / "out.tif", src_ds, strict=True)
+    with gdaltest.error_raised(gdal.CE_Warning, "only supports writing CRS"):
+        assert drv.CreateCopy(tmp_vsimem / "out.tif", src_ds) is not None
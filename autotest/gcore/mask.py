@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import math
 import os
 import struct
 
@@ -1069,3 +1070,96 @@ def test_mask_write_to_nodata_values_mask_band():
         match=r"GDALRasterBand::RasterIO\(\): attempt to write to a nodata implicit mask band.",
     ):
         ds.GetRasterBand(1).GetMaskBand().WriteRaster(0, 0, 1, 1, b"\0")
+
+
+###############################################################################
+# Test nodata masks of floating-point bands, with contiguous and strided
+# output buffers
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Float32, gdal.GDT_Float64])
+@pytest.mark.parametrize("nodata", [1.5, float("nan")])
+def test_mask_nodata_float(dt, nodata):
+
+    fmt = "f" if dt == gdal.GDT_Float32 else "d"
+    values = [nodata, 1.5 * (1 + 1e-8), 2.5, float("nan"), 0, float("inf")] * 3
+    ds = gdal.GetDriverByName("MEM").Create("", len(values), 1, 1, dt)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, len(values), 1, struct.pack(fmt * len(values), *values)
+    )
+    ds.GetRasterBand(1).SetNoDataValue(nodata)
+    if math.isnan(nodata):
+        expected = [0, 255, 255, 0, 255, 255] * 3
+    else:
+        expected = [0, 0, 255, 255, 255, 255] * 3
+    msk = ds.GetRasterBand(1).GetMaskBand()
+    assert list(msk.ReadRaster()) == expected
+    assert list(msk.ReadRaster(buf_pixel_space=2)[::2]) == expected
+
+
+###############################################################################
+# Test NODATA_VALUES mask with NaN nodata values
+
+
+def test_mask_nodata_values_nan():
+
+    ds = gdal.GetDriverByName("MEM").Create("", 3, 1, 2, gdal.GDT_Float32)
+    nan = float("nan")
+    ds.GetRasterBand(1).WriteRaster(0, 0, 3, 1, struct.pack("f" * 3, nan, nan, 1))
+    ds.GetRasterBand(2).WriteRaster(0, 0, 3, 1, struct.pack("f" * 3, nan, 2, nan))
+    ds.SetMetadataItem("NODATA_VALUES", "nan nan")
+    assert ds.GetRasterBand(1).GetMaskFlags() == gdal.GMF_NODATA | gdal.GMF_PER_DATASET
+    assert list(ds.GetRasterBand(1).GetMaskBand().ReadRaster()) == [0, 255, 255]
+
+
+###############################################################################
+# Test GetDataCoverageStatus() on a nodata mask band
+
+
+def test_mask_nodata_data_coverage_status(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        96,
+        32,
+        options=["SPARSE_OK=YES", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+    )
+    ds.GetRasterBand(1).SetNoDataValue(0)
+    ds.GetRasterBand(1).WriteRaster(0, 0, 32, 32, b"\x01" * (32 * 32))
+    ds.GetRasterBand(1).WriteRaster(32, 0, 32, 32, b"\x00\x01" * (16 * 32))
+    ds = None
+
+    with gdal.Open(filename) as ds:
+        msk = ds.GetRasterBand(1).GetMaskBand()
+
+        # Empty block of the source band
+        flags, pct = msk.GetDataCoverageStatus(64, 0, 32, 32)
+        assert flags == gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY
+        assert pct == 0
+
+        # Not read yet
+        flags, _ = msk.GetDataCoverageStatus(0, 0, 96, 32)
+        assert flags & gdal.GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED
+
+        msk.ReadRaster()
+
+        flags, pct = msk.GetDataCoverageStatus(0, 0, 32, 32)
+        assert flags == gdal.GDAL_DATA_COVERAGE_STATUS_DATA
+        assert pct == 100
+
+        flags, pct = msk.GetDataCoverageStatus(32, 0, 32, 32)
+        assert (
+            flags
+            == gdal.GDAL_DATA_COVERAGE_STATUS_DATA
+            | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY
+        )
+        assert pct == 50
+
+        flags, pct = msk.GetDataCoverageStatus(0, 0, 96, 32)
+        assert (
+            flags
+            == gdal.GDAL_DATA_COVERAGE_STATUS_DATA
+            | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY
+        )
+        assert pct == 50
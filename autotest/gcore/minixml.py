@@ -233,6 +233,31 @@ def test_minixml_processing_instruction():
     assert xml == got_xml, "serialize xml tree failed."
 
 
+###############################################################################
+# Parse long runs of text, and check line numbers reported in errors
+
+
+def test_minixml_long_text_runs():
+
+    text = "x" * 100000
+    xml = (
+        f"<a attr='{text}&amp;'>\n<b>{text}\n&lt;</b>\n"
+        f"<!--\n{text}-->\n<![CDATA[\n{text}<>]]></a>"
+    )
+    tree = gdal.ParseXMLString(xml)
+    assert tree == [
+        gdal.CXT_Element,
+        "a",
+        [gdal.CXT_Attribute, "attr", [gdal.CXT_Text, text + "&"]],
+        [gdal.CXT_Element, "b", [gdal.CXT_Text, text + "\n<"]],
+        [gdal.CXT_Comment, "\n" + text],
+        [gdal.CXT_Text, "\n" + text + "<>"],
+    ]
+
+    with pytest.raises(Exception, match="Line 5: </c>"):
+        gdal.ParseXMLString("<a>\n<b>x\ny</b>\n<!--\n-->\n</c>")
+
+
 ###############################################################################
 # Cleanup
 
@@ -1453,3 +1453,57 @@ def test_pixfun_max_no_nodata():
 
 
 ###############################################################################
+
+
+###############################################################################
+# Verify that large requests, processed by chunks of lines on several
+# threads, give the same result as single-threaded processing.
+
+
+@pytest.mark.parametrize("pixfn", ["norm_diff", "sum", "max"])
+def test_pixfun_multithreaded(tmp_vsimem, pixfn):
+
+    nx, ny = 1100, 1000
+    nir = numpy.arange(nx * ny, dtype=numpy.int16).reshape((ny, nx)) % 1000
+    red = (numpy.arange(nx * ny, dtype=numpy.int16).reshape((ny, nx)) * 7) % 500
+
+    sources = ""
+    for name, ar in (("nir", nir), ("red", red)):
+        filename = tmp_vsimem / f"{name}.tif"
+        with gdal.GetDriverByName("GTiff").Create(
+            filename, nx, ny, 1, gdal.GDT_Int16
+        ) as src_ds:
+            src_ds.GetRasterBand(1).WriteArray(ar)
+        sources += f"""
+    <SimpleSource>
+      <SourceFilename>{filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>"""
+
+    vrt_ds = gdal.Open(
+        f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+  <VRTRasterBand dataType="Float32" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>{pixfn}</PixelFunctionType>
+    <SourceTransferType>Int16</SourceTransferType>{sources}
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref = vrt_ds.GetRasterBand(1).ReadAsArray()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = vrt_ds.GetRasterBand(1).ReadAsArray()
+    numpy.testing.assert_array_equal(got, ref)
+
+    nir = nir.astype(numpy.float64)
+    red = red.astype(numpy.float64)
+    if pixfn == "norm_diff":
+        with numpy.errstate(divide="ignore", invalid="ignore"):
+            expected = numpy.where(
+                nir + red == 0, numpy.inf, (nir - red) / (nir + red)
+            )
+    elif pixfn == "sum":
+        expected = nir + red
+    else:
+        expected = numpy.maximum(nir, red)
+    numpy.testing.assert_allclose(got, expected.astype(numpy.float32))
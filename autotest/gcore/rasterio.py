@@ -3419,3 +3419,104 @@ def test_rasterio_gdt_unknown():
         # Caught at the SWIG level
         with pytest.raises(Exception, match="Illegal value for data type"):
             ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() with GDAL_COPY_WHOLE_RASTER_READ_AHEAD=YES
+
+
+@pytest.mark.parametrize("interleave", ["BAND", "PIXEL"])
+def test_rasterio_copy_whole_raster_read_ahead(tmp_vsimem, interleave):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    ref_checksums = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    tab_pct = [0]
+
+    def callback(pct, msg, user_data):
+        assert pct >= user_data[0]
+        user_data[0] = pct
+        return 1
+
+    # Force many small swaths
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "1000", "GDAL_COPY_WHOLE_RASTER_READ_AHEAD": "YES"}
+    ):
+        out_ds = gdal.Translate(
+            tmp_vsimem / "out.tif",
+            src_ds,
+            creationOptions=["INTERLEAVE=" + interleave],
+            callback=callback,
+            callback_data=tab_pct,
+        )
+    assert tab_pct[0] == 1.0
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == ref_checksums
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() with several swaths read at the same time
+
+
+@pytest.mark.parametrize("read_ahead", ["2", "4", "ALL_CPUS", "1000"])
+@pytest.mark.parametrize("interleave", ["BAND", "PIXEL"])
+def test_rasterio_copy_whole_raster_read_ahead_multiple_swaths(
+    tmp_vsimem, read_ahead, interleave
+):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    ref_checksums = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    # Force many small swaths
+    with gdaltest.config_options(
+        {
+            "GDAL_SWATH_SIZE": "1000",
+            "GDAL_COPY_WHOLE_RASTER_READ_AHEAD": read_ahead,
+        }
+    ):
+        out_ds = gdal.Translate(
+            tmp_vsimem / "out.tif",
+            src_ds,
+            creationOptions=["INTERLEAVE=" + interleave],
+        )
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == ref_checksums
+
+
+###############################################################################
+# Test drivers declaring GDAL_DCAP_CONCURRENT_READ_BLOCK, whose blocks are read
+# by several threads in GDALDataset::BlockBasedRasterIO()
+
+
+@pytest.mark.parametrize("driver_name", ["JPEG", "PNG", "GPKG", "MBTiles"])
+def test_rasterio_concurrent_read_block(tmp_vsimem, driver_name):
+
+    drv = gdal.GetDriverByName(driver_name)
+    if drv is None:
+        pytest.skip(f"{driver_name} driver not available")
+    assert drv.GetMetadataItem(gdal.DCAP_CONCURRENT_READ_BLOCK) == "YES"
+
+    if driver_name == "JPEG":
+        filename = "../gdrivers/data/jpeg/rgbsmall_rgb.jpg"
+    elif driver_name == "PNG":
+        filename = "../gdrivers/data/png/rgba16.png"
+    elif driver_name == "GPKG":
+        filename = str(tmp_vsimem / "out.gpkg")
+        gdal.Translate(
+            filename,
+            "data/rgbsmall.tif",
+            format="GPKG",
+            creationOptions=["BLOCKSIZE=16", "TILE_FORMAT=PNG"],
+        )
+    else:
+        filename = "../gdrivers/data/mbtiles/world_l1.mbtiles"
+
+    def read(num_threads):
+        ds = gdal.Open(filename)
+        assert ds.GetDriver().ShortName == driver_name
+        assert ds.RasterCount > 1
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            # Not the full raster, to avoid the drivers' whole image paths
+            return ds.ReadRaster(1, 1, ds.RasterXSize - 2, ds.RasterYSize - 2)
+
+    ref = read("1")
+    assert read("4") == ref
+    assert read("ALL_CPUS") == ref
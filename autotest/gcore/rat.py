@@ -161,3 +161,32 @@ def test_rat_4():
 
 
 ##############################################################################
+# Test ReadAsArray() / WriteArray() with a start row
+
+
+def test_rat_read_write_array_start():
+
+    np = pytest.importorskip("numpy")
+    pytest.importorskip("osgeo.gdal_array")
+
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("int", gdal.GFT_Integer, gdal.GFU_Generic)
+    rat.CreateColumn("real", gdal.GFT_Real, gdal.GFU_Generic)
+    rat.CreateColumn("str", gdal.GFT_String, gdal.GFU_Generic)
+    rat.SetRowCount(5)
+
+    assert rat.WriteArray(np.array([1, 2, 3], dtype=np.int32), 0, 2) == 0
+    assert rat.WriteArray(np.array([1.5, 2.5]), 1, 3) == 0
+    assert rat.WriteArray(np.array([b"a", b"bc"]), 2, 1) == 0
+    # Written as a real column, read as a string column
+    assert rat.WriteArray(np.array([7.5]), 2, 4) == 0
+
+    assert list(rat.ReadAsArray(0)) == [0, 0, 1, 2, 3]
+    assert list(rat.ReadAsArray(0, 3, 2)) == [2, 3]
+    assert list(rat.ReadAsArray(1, 3)) == [1.5, 2.5]
+    assert list(rat.ReadAsArray(2, 1, 4)) == [b"a", b"bc", b"", b"7.5"]
+    # Read an integer column as strings
+    assert rat.GetValueAsString(3, 0) == "2"
+
+    with pytest.raises(Exception):
+        rat.WriteArray(np.array([1, 2], dtype=np.int32), 0, 4)
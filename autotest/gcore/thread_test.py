@@ -596,3 +596,57 @@ def test_thread_safe_GetGCPs():
         for t in threads:
             t.join()
         assert res[0]
+
+
+@pytest.mark.parametrize("cache_size", ["1MB", "1"])
+def test_thread_safe_shared_block_cache(tmp_vsimem, cache_size):
+
+    tmpfilename = str(tmp_vsimem / "tiled.tif")
+    gdal.Translate(
+        tmpfilename,
+        "data/stefan_full_rgba.tif",
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    with gdal.Open(tmpfilename, gdal.GA_Update) as ds:
+        ds.BuildOverviews("NEAR", [2])
+
+    with gdal.Open(tmpfilename) as src_ds:
+        expected_cs = src_ds.GetRasterBand(1).Checksum()
+        expected_mask_cs = src_ds.GetRasterBand(1).GetMaskBand().Checksum()
+        expected_ovr_cs = src_ds.GetRasterBand(1).GetOverview(0).Checksum()
+        expected_data = src_ds.ReadRaster(3, 5, 50, 40)
+
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_BLOCK_CACHE", cache_size):
+        ds = gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+
+    with ds:
+        launch_threads(lambda: ds.GetRasterBand(1), expected_cs)
+        launch_threads(lambda: ds.GetRasterBand(1).GetMaskBand(), expected_mask_cs)
+        launch_threads(lambda: ds.GetRasterBand(1).GetOverview(0), expected_ovr_cs)
+        assert ds.ReadRaster(3, 5, 50, 40) == expected_data
+        assert ds.GetRasterBand(2).ReadRaster(
+            3, 5, 50, 40, buf_type=gdal.GDT_UInt16
+        ) == gdal.Open(tmpfilename).GetRasterBand(2).ReadRaster(
+            3, 5, 50, 40, buf_type=gdal.GDT_UInt16
+        )
+
+
+def test_thread_write_behind():
+
+    # Dirty blocks evicted from the cache, and flushed, by worker threads
+    with gdaltest.SetCacheMax(100000), gdal.config_option(
+        "GDAL_WRITE_BEHIND_NUM_THREADS", "4"
+    ):
+        ds = gdal.GetDriverByName("MEM").Create("", 1000, 1000, 3)
+        for i in range(3):
+            ds.GetRasterBand(i + 1).Fill(i + 1)
+        for i in range(3):
+            band = ds.GetRasterBand(i + 1)
+            assert band.ComputeRasterMinMax(False) == (i + 1, i + 1)
+
+        for i in range(3):
+            ds.GetRasterBand(i + 1).Fill(10 + i)
+        assert ds.FlushCache() == gdal.CE_None
+        for i in range(3):
+            band = ds.GetRasterBand(i + 1)
+            assert band.ComputeRasterMinMax(False) == (10 + i, 10 + i)
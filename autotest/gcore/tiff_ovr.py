@@ -739,6 +739,80 @@ def test_tiff_ovr_mode_multiband(multiband, read_only):
     gdal.GetDriverByName("GTiff").Delete("/vsimem/test.tif")
 
 
+###############################################################################
+# Check mode resampling against a reference implementation, for the
+# histogram based code paths of Byte and 16-bit data
+
+
+@pytest.mark.parametrize("dt,fmt", [(gdal.GDT_Byte, "B"), (gdal.GDT_UInt16, "H")])
+@pytest.mark.parametrize("factor", [2, 8])
+def test_tiff_ovr_mode_vs_reference(dt, fmt, factor):
+
+    size = 64
+    # Few distinct values, so that there are ties and non-trivial modes
+    vals = [
+        ((x // 3) * 7 + (y // 2) * 5 + x * y) % 6
+        for y in range(size)
+        for x in range(size)
+    ]
+    if dt == gdal.GDT_UInt16:
+        vals = [v * 10000 + 1 for v in vals]
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size, 1, dt)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, size, size, struct.pack(fmt * (size * size), *vals)
+    )
+    ds.BuildOverviews("MODE", [factor])
+    ovr = ds.GetRasterBand(1).GetOverview(0)
+    got = struct.unpack(fmt * (ovr.XSize * ovr.YSize), ovr.ReadRaster())
+
+    expected = []
+    for oy in range(size // factor):
+        for ox in range(size // factor):
+            counts = {}
+            max_count = 0
+            mode = None
+            for y in range(oy * factor, (oy + 1) * factor):
+                for x in range(ox * factor, (ox + 1) * factor):
+                    v = vals[y * size + x]
+                    counts[v] = counts.get(v, 0) + 1
+                    if counts[v] > max_count:
+                        max_count = counts[v]
+                        mode = v
+            expected.append(mode)
+
+    assert list(got) == expected
+
+
+###############################################################################
+# Check that the Byte histogram of mode resampling is reset between source
+# windows of 256 pixels or more and smaller ones. 250 / 16 overview levels
+# alternate 16 and 15 pixel wide windows.
+
+
+def test_tiff_ovr_mode_byte_mixed_window_sizes():
+
+    size = 250
+    vals = [
+        (x * 7 + y * 13 + (x // 5) * (y // 3)) % 11
+        for y in range(size)
+        for x in range(size)
+    ]
+
+    def compute(dt, fmt):
+        ds = gdal.GetDriverByName("MEM").Create("", size, size, 1, dt)
+        ds.GetRasterBand(1).WriteRaster(
+            0, 0, size, size, struct.pack(fmt * (size * size), *vals)
+        )
+        ds.BuildOverviews("MODE", [16])
+        ovr = ds.GetRasterBand(1).GetOverview(0)
+        assert ovr.XSize == 16
+        return struct.unpack(fmt * (ovr.XSize * ovr.YSize), ovr.ReadRaster())
+
+    # The UInt16 code path resets its own histogram after every window
+    assert compute(gdal.GDT_Byte, "B") == compute(gdal.GDT_UInt16, "H")
+
+
 ###############################################################################
 # Check that we can create overviews on a newly create file (#2621)
 
@@ -2389,6 +2463,39 @@ def test_tiff_ovr_multithreading_multiband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test that computing several levels in a single scan of the full resolution
+# dataset gives the same result as computing them one after the other
+
+
+@pytest.mark.parametrize(
+    "resampling", ["NEAREST", "AVERAGE", "GAUSS", "CUBIC", "MODE", "LANCZOS"]
+)
+@pytest.mark.parametrize("num_threads", ["1", "8"])
+def test_tiff_ovr_multiband_streaming(tmp_vsimem, resampling, num_threads):
+
+    def build(streaming):
+        filename = str(tmp_vsimem / f"test_{streaming}.tif")
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        )
+        with gdaltest.config_options(
+            {"GDAL_NUM_THREADS": num_threads, "GDAL_OVR_STREAMING": streaming}
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        ds = None
+        ds = gdal.Open(filename)
+        return [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(4)
+            for j in range(4)
+        ]
+
+    assert build("YES") == build("NO")
+
+
 ###############################################################################
 
 
@@ -4988,6 +4988,61 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding of pixel-interleaved tiles into band-sequential
+# buffers, with various band counts, data types and band orders
+
+
+@pytest.mark.parametrize("nbands", [2, 5])
+@pytest.mark.parametrize("dtype", [gdal.GDT_UInt16, gdal.GDT_Float32])
+def test_tiff_read_multi_threaded_contig_deinterleave(tmp_vsimem, nbands, dtype):
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", 100, 90, nbands, dtype)
+    for band in range(nbands):
+        ref_ds.GetRasterBand(band + 1).WriteRaster(
+            0,
+            0,
+            100,
+            90,
+            array.array("H", [band * 1000 + i for i in range(100 * 90)]).tobytes(),
+            buf_type=gdal.GDT_UInt16,
+        )
+
+    tmpfile = str(tmp_vsimem / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfile,
+        ref_ds,
+        options=[
+            "COMPRESS=DEFLATE",
+            "TILED=YES",
+            "BLOCKXSIZE=32",
+            "BLOCKYSIZE=16",
+            "INTERLEAVE=PIXEL",
+        ],
+    )
+
+    band_list = [i + 1 for i in range(1, nbands)] + [1]
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(tmpfile)
+        for window in [
+            (0, 0, 100, 90),
+            (32, 16, 64, 32),
+            (64, 80, 36, 10),
+            (20, 40, 35, 50),
+        ]:
+            for bands in [None, band_list]:
+                for buf_type in [None, gdal.GDT_Float64]:
+                    assert ds.ReadRaster(
+                        *window, band_list=bands, buf_type=buf_type
+                    ) == ref_ds.ReadRaster(*window, band_list=bands, buf_type=buf_type)
+
+        # Reading all bands of whole tiles does not cache them
+        ds.FlushCache()
+        cache_used = gdal.GetCacheUsed()
+        ds.ReadRaster(32, 16, 64, 32, band_list=band_list)
+        assert gdal.GetCacheUsed() == cache_used
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
@@ -5156,6 +5211,227 @@ def test_tiff_read_multi_threaded_vsicurl_window_not_aligned_on_blocks():
         gdal.VSICurlClearCache()
 
 
+###############################################################################
+# Test multi-threaded decoding with /vsicurl with GDAL_HTTP_ADVISE_READ_MAX_GAP
+# and GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS
+
+
+@pytest.mark.parametrize(
+    "config_options,expected_range_requests",
+    [
+        ({}, 2),
+        ({"GDAL_HTTP_ADVISE_READ_MAX_GAP": "1000000"}, 1),
+        # Clamped to CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT
+        ({"GDAL_HTTP_ADVISE_READ_MAX_GAP": "18446744073709551615"}, 1),
+        ({"GDAL_HTTP_ADVISE_READ_MAX_GAP": "-1"}, 2),
+        # The gap between the 2 tiles makes AdviseRead() exceed the limit,
+        # so tiles are read individually
+        (
+            {
+                "GDAL_HTTP_ADVISE_READ_MAX_GAP": "1000000",
+                "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT": "200000",
+            },
+            2,
+        ),
+        ({"GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS": "1"}, 2),
+    ],
+)
+@pytest.mark.skipif(platform.system() == "Darwin", reason="fails randomly")
+@pytest.mark.require_curl()
+@pytest.mark.skipif(
+    not check_libtiff_internal_or_at_least(4, 0, 11),
+    reason="libtiff >= 4.0.11 required",
+)
+def test_tiff_read_multi_threaded_vsicurl_advise_read_options(
+    tmp_path, config_options, expected_range_requests
+):
+
+    webserver_process = None
+    webserver_port = 0
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    # 4x4 tiles of 64 KB each
+    tmp_filename = str(tmp_path / "tmp.tif")
+    gdal.Translate(
+        tmp_filename,
+        "data/utmsmall.tif",
+        options="-co TILED=YES -co BLOCKXSIZE=256 -co BLOCKYSIZE=256 "
+        "-outsize 1024 1024",
+    )
+    with gdal.Open(tmp_filename) as ds:
+        # Tiles 0 and 4, which are not consecutive in the file
+        expected_data = ds.ReadRaster(0, 0, 256, 512)
+
+    try:
+        filesize = os.stat(tmp_filename).st_size
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", "/test.tif", 200, {"Content-Length": "%d" % filesize})
+
+        def method(request):
+            if request.headers["Range"].startswith("bytes="):
+                rng = request.headers["Range"][len("bytes=") :]
+                assert len(rng.split("-")) == 2
+                start = int(rng.split("-")[0])
+                end = int(rng.split("-")[1])
+
+                request.protocol_version = "HTTP/1.1"
+                request.send_response(206)
+                request.send_header("Content-type", "application/octet-stream")
+                request.send_header(
+                    "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+                )
+                request.send_header("Content-Length", end - start + 1)
+                request.send_header("Connection", "close")
+                request.end_headers()
+                with open(tmp_filename, "rb") as f:
+                    f.seek(start, 0)
+                    request.wfile.write(f.read(end - start + 1))
+
+        # One request for the header, and the ones for the tiles
+        for i in range(1 + expected_range_requests):
+            handler.add("GET", "/test.tif", custom_method=method)
+
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "GDAL_NUM_THREADS": "2",
+                    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                    **config_options,
+                }
+            ):
+                ds = gdal.Open("/vsicurl/http://127.0.0.1:%d/test.tif" % webserver_port)
+                assert ds is not None, "could not open dataset"
+
+                assert ds.ReadRaster(0, 0, 256, 512) == expected_data
+
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS limits the number of
+# connections opened at the same time by AdviseRead()
+
+
+@pytest.mark.parametrize("max_concurrent_requests", ["0", "1"])
+@pytest.mark.skipif(platform.system() == "Darwin", reason="fails randomly")
+@pytest.mark.require_curl()
+@pytest.mark.skipif(
+    not check_libtiff_internal_or_at_least(4, 0, 11),
+    reason="libtiff >= 4.0.11 required",
+)
+def test_tiff_read_multi_threaded_vsicurl_advise_read_max_concurrent_requests(
+    tmp_path, max_concurrent_requests
+):
+
+    import select
+    import time
+
+    webserver_process = None
+    webserver_port = 0
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    # 4x4 tiles of 64 KB each
+    tmp_filename = str(tmp_path / "tmp.tif")
+    gdal.Translate(
+        tmp_filename,
+        "data/utmsmall.tif",
+        options="-co TILED=YES -co BLOCKXSIZE=256 -co BLOCKYSIZE=256 "
+        "-outsize 1024 1024",
+    )
+    with gdal.Open(tmp_filename) as ds:
+        # Tiles 0, 4, 8 and 12, which are not consecutive in the file
+        expected_data = ds.ReadRaster(0, 0, 256, 1024)
+
+    try:
+        filesize = os.stat(tmp_filename).st_size
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", "/test.tif", 200, {"Content-Length": "%d" % filesize})
+
+        range_starts = []
+        other_connection_pending = []
+
+        def method(request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = int(rng.split("-")[1])
+            range_starts.append(start)
+
+            # The server handles one connection at a time. Check whether
+            # another one is waiting to be accepted.
+            if start > 0:
+                deadline = time.time() + 0.5
+                pending = False
+                while not pending and time.time() < deadline:
+                    pending = bool(
+                        select.select([request.server.socket], [], [], 0.05)[0]
+                    )
+                other_connection_pending.append(pending)
+
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header("Content-type", "application/octet-stream")
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            with open(tmp_filename, "rb") as f:
+                f.seek(start, 0)
+                request.wfile.write(f.read(end - start + 1))
+
+        # One request for the header, and one per tile
+        for i in range(1 + 4):
+            handler.add("GET", "/test.tif", custom_method=method)
+
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "GDAL_NUM_THREADS": "2",
+                    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                    "GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS": (
+                        max_concurrent_requests
+                    ),
+                }
+            ):
+                ds = gdal.Open("/vsicurl/http://127.0.0.1:%d/test.tif" % webserver_port)
+                assert ds is not None, "could not open dataset"
+
+                assert ds.ReadRaster(0, 0, 256, 1024) == expected_data
+
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+    assert len(other_connection_pending) == 4
+    if max_concurrent_requests == "1":
+        # Ranges are requested one after the other, in file order
+        assert range_starts[1:] == sorted(range_starts[1:])
+        assert not any(other_connection_pending)
+    else:
+        assert other_connection_pending[0]
+
+
 ###############################################################################
 # Test that we honor GDAL_DISABLE_READDIR_ON_OPEN when working on a dataset opened with OVERVIEW_LEVEL open option
 
@@ -5357,6 +5633,55 @@ def test_tiff_read_missing_extrasamples_multi_threaded():
     assert gdal.GetLastErrorMsg() == ""
 
 
+###############################################################################
+# Test that a multithreaded read of the imagery also decodes the internal mask
+# into the block cache
+
+
+@pytest.mark.parametrize(
+    "output_format,read_mask_with_data,expect_mask_cached",
+    [
+        ("COG", None, True),
+        ("COG", "NO", False),
+        ("GTiff", None, False),
+        ("GTiff", "YES", True),
+    ],
+)
+def test_tiff_read_multi_threaded_mask_with_data(
+    tmp_vsimem, output_format, read_mask_with_data, expect_mask_cached
+):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 80, 3)
+    src_ds.WriteRaster(0, 0, 100, 80, os.urandom(100 * 80 * 3))
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    src_ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+        0, 0, 100, 80, b"".join(bytes([255 * ((i // 7) % 2)]) for i in range(8000))
+    )
+    filename = str(tmp_vsimem / "out.tif")
+    if output_format == "COG":
+        options = ["BLOCKSIZE=32", "COMPRESS=DEFLATE", "OVERVIEWS=NONE"]
+    else:
+        options = ["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32", "COMPRESS=DEFLATE"]
+    gdal.GetDriverByName(output_format).CreateCopy(filename, src_ds, options=options)
+
+    with gdal.Open(filename) as ds:
+        expected_data = ds.ReadRaster(1, 2, 97, 75)
+        expected_mask = ds.GetRasterBand(1).GetMaskBand().ReadRaster(1, 2, 97, 75)
+
+    with gdal.config_options(
+        {"GDAL_NUM_THREADS": "4", "GTIFF_READ_MASK_WITH_DATA": read_mask_with_data}
+    ):
+        with gdal.Open(filename) as ds:
+            cache_used_before = gdal.GetCacheUsed()
+            assert ds.ReadRaster(1, 2, 97, 75) == expected_data
+            cache_used = gdal.GetCacheUsed() - cache_used_before
+            mask_band = ds.GetRasterBand(1).GetMaskBand()
+            assert mask_band.ReadRaster(1, 2, 97, 75) == expected_mask
+
+    # 4x3 blocks of 32x32 pixels, for the 3 imagery bands and the mask band
+    assert cache_used == (4 if expect_mask_cached else 3) * 12 * 32 * 32
+
+
 ###############################################################################
 # Test that we honor GDAL_DISABLE_READDIR_ON_OPEN when working on a dataset opened with OVERVIEW_LEVEL open option
 
@@ -5619,3 +5944,82 @@ def test_tiff_read_multithreaded_read_missing_tilebytecounts_and_offsets():
         match="missing_tilebytecounts_and_offsets.tif: Error while getting location of block 0",
     ):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test GTIFF_HEADER_CACHE_DIR
+
+
+@gdaltest.enable_exceptions()
+def test_tiff_read_header_cache(tmp_vsimem):
+
+    src_ds = gdal.Translate(
+        "", "data/byte.tif", options="-of MEM -outsize 1024 1024 -r bilinear"
+    )
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    src_ds.GetRasterBand(1).GetMaskBand().Fill(255)
+    filename = str(tmp_vsimem / "cog.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=256", "COMPRESS=LZW"]
+    )
+    with gdal.Open(filename) as ds:
+        ref_cs = [ds.GetRasterBand(1).GetOverview(i).Checksum() for i in range(2)]
+        ref_cs += [ds.GetRasterBand(1).GetMaskBand().Checksum()]
+
+    cache_dir = str(tmp_vsimem / "cache")
+    gdal.Mkdir(cache_dir, 0o755)
+    with gdal.config_option("GTIFF_HEADER_CACHE_DIR", cache_dir):
+        # Cache miss: creates the cache file
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(
+                1
+            ).Checksum()
+        cache_files = gdal.ReadDir(cache_dir)
+        assert len(cache_files) == 1
+        assert cache_files[0].endswith(".hdr")
+
+        # The cached header area must be a prefix of the file, and must end
+        # before the first tile
+        f = gdal.VSIFOpenL(cache_dir + "/" + cache_files[0], "rb")
+        cache_content = gdal.VSIFReadL(1, 100 * 1024 * 1024, f)
+        gdal.VSIFCloseL(f)
+        lines = cache_content.split(b"\n", 5)
+        assert lines[0] == b"GDAL_GTIFF_HEADER_CACHE_V1"
+        assert lines[1] == filename.encode("UTF-8")
+        header_size = int(lines[4])
+        assert 0 < header_size < gdal.VSIStatL(filename).size
+        header = lines[5]
+        assert len(header) == header_size
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert gdal.VSIFReadL(1, header_size, f) == header
+        gdal.VSIFCloseL(f)
+
+        # Cache hit
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(
+                1
+            ).Checksum()
+            cs = [ds.GetRasterBand(1).GetOverview(i).Checksum() for i in range(2)]
+            cs += [ds.GetRasterBand(1).GetMaskBand().Checksum()]
+            assert cs == ref_cs
+
+        # Cache hit with a corrupted cache file: the cache is used as is, which
+        # demonstrates that the file itself is not read for the header area
+        corrupted = bytearray(cache_content)
+        corrupted[-header_size + 8 :] = b"\xff" * (header_size - 8)
+        gdal.FileFromMemBuffer(cache_dir + "/" + cache_files[0], bytes(corrupted))
+        with pytest.raises(Exception):
+            with gdal.Open(filename) as ds:
+                ds.GetRasterBand(1).Checksum()
+
+    # Cache entry for an obsolete version of the file is ignored
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=512", "COMPRESS=LZW"]
+    )
+    with gdal.config_option("GTIFF_HEADER_CACHE_DIR", cache_dir):
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(
+                1
+            ).Checksum()
+        assert len(gdal.ReadDir(cache_dir)) == 2
+
@@ -12035,3 +12035,136 @@ def test_tiff_write_interleave_tile(tmp_vsimem, COPY_SRC_OVERVIEWS):
                 )
                 assert offset > last_offset
                 last_offset = offset
+
+
+###############################################################################
+# Test round-tripping of random data through the horizontal and floating-point
+# predictors, with widths and pixel sizes exercising the SIMD code paths and
+# their scalar tails
+
+
+@pytest.mark.parametrize(
+    "dt,predictor",
+    [
+        (gdal.GDT_Byte, 2),
+        (gdal.GDT_UInt16, 2),
+        (gdal.GDT_UInt32, 2),
+        (gdal.GDT_UInt64, 2),
+        (gdal.GDT_Float32, 3),
+        (gdal.GDT_Float64, 3),
+    ],
+)
+@pytest.mark.parametrize("nbands", [1, 2, 3, 4, 5])
+@pytest.mark.parametrize("width", [1, 15, 67, 256])
+def test_tiff_write_predictor_random_data_round_trip(
+    tmp_vsimem, dt, predictor, nbands, width
+):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, 5, nbands, dt)
+    data = os.urandom(width * 5 * nbands * gdal.GetDataTypeSizeBytes(dt))
+    src_ds.WriteRaster(0, 0, width, 5, data, band_list=list(range(1, nbands + 1)))
+    data = src_ds.ReadRaster()
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        out_filename,
+        src_ds,
+        options=["COMPRESS=LZW", "PREDICTOR=%d" % predictor, "INTERLEAVE=PIXEL"],
+    )
+    with gdal.Open(out_filename) as ds:
+        assert ds.ReadRaster() == data
+    if gdal.GetDriverByName("LIBERTIFF"):
+        with gdal.OpenEx(out_filename, allowed_drivers=["LIBERTIFF"]) as ds:
+            assert ds.ReadRaster() == data
+
+
+###############################################################################
+# Test DEDUPLICATE_BLOCKS=YES creation option
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32", "COMPRESS=DEFLATE"],
+        [
+            "TILED=YES",
+            "BLOCKXSIZE=32",
+            "BLOCKYSIZE=32",
+            "COMPRESS=DEFLATE",
+            "NUM_THREADS=4",
+        ],
+        ["BLOCKYSIZE=8", "COMPRESS=LZW"],
+        ["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32", "INTERLEAVE=BAND"],
+    ],
+)
+def test_tiff_write_deduplicate_blocks(tmp_vsimem, options):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 90, 2)
+    src_ds.GetRasterBand(1).Fill(10)
+    src_ds.GetRasterBand(2).Fill(10)
+    src_ds.GetRasterBand(1).WriteRaster(40, 30, 20, 20, b"\x01" * (20 * 20))
+
+    ref_filename = str(tmp_vsimem / "ref.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(ref_filename, src_ds, options=options)
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=options + ["DEDUPLICATE_BLOCKS=YES"]
+    )
+    assert gdal.VSIStatL(filename).size < gdal.VSIStatL(ref_filename).size
+
+    with gdal.Open(filename) as ds:
+        assert ds.ReadRaster() == src_ds.ReadRaster()
+        band = ds.GetRasterBand(1)
+        offset = band.GetMetadataItem("BLOCK_OFFSET_0_0", "TIFF")
+        assert offset is not None
+        assert band.GetMetadataItem("BLOCK_OFFSET_0_1", "TIFF") == offset
+        size = band.GetMetadataItem("BLOCK_SIZE_0_0", "TIFF")
+        assert band.GetMetadataItem("BLOCK_SIZE_0_1", "TIFF") == size
+    if gdal.GetDriverByName("LIBERTIFF"):
+        with gdal.OpenEx(filename, allowed_drivers=["LIBERTIFF"]) as ds:
+            assert ds.ReadRaster() == src_ds.ReadRaster()
+
+
+###############################################################################
+# Test DEDUPLICATE_BLOCKS=YES when rewriting blocks during the creation session
+
+
+def test_tiff_write_deduplicate_blocks_rewrite(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        64,
+        64,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=DEFLATE",
+            "DEDUPLICATE_BLOCKS=YES",
+        ],
+    )
+    ds.GetRasterBand(1).Fill(10)
+    ds.FlushCache()
+    # Rewrite the tile whose data is shared by the other ones, and one of
+    # the tiles referencing it
+    ds.GetRasterBand(1).WriteRaster(0, 0, 16, 16, b"\x01" * (16 * 16))
+    ds.GetRasterBand(1).WriteRaster(16, 0, 16, 16, b"\x02" * (16 * 16))
+    ds.FlushCache()
+    # Rewrite a tile with the content of another one
+    ds.GetRasterBand(1).WriteRaster(32, 0, 16, 16, b"\x01" * (16 * 16))
+    ds = None
+
+    expected = bytearray(b"\x0a" * (64 * 64))
+    for y in range(16):
+        expected[y * 64 : y * 64 + 16] = b"\x01" * 16
+        expected[y * 64 + 16 : y * 64 + 32] = b"\x02" * 16
+        expected[y * 64 + 32 : y * 64 + 48] = b"\x01" * 16
+    with gdal.Open(filename) as ds:
+        assert ds.ReadRaster() == expected
+        band = ds.GetRasterBand(1)
+        offset = band.GetMetadataItem("BLOCK_OFFSET_0_0", "TIFF")
+        assert band.GetMetadataItem("BLOCK_OFFSET_2_0", "TIFF") == offset
+        offset = band.GetMetadataItem("BLOCK_OFFSET_3_0", "TIFF")
+        assert band.GetMetadataItem("BLOCK_OFFSET_0_1", "TIFF") == offset
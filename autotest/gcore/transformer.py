@@ -785,7 +785,7 @@ def test_transformer_12():
 # Test inverse RPC transform at DEM edge (#6377)
 
 
-def test_transformer_13():
+def _create_transformer_13_ds():
 
     ds = gdal.GetDriverByName("MEM").Create("", 6600, 4400)
     rpc = [
@@ -805,7 +805,12 @@ def test_transformer_13():
         "SAMP_SCALE=3297.19448149873",
     ]
     ds.SetMetadata(rpc, "RPC")
+    return ds
+
+
+def test_transformer_13():
 
+    ds = _create_transformer_13_ds()
     tr = gdal.Transformer(
         ds, None, ["METHOD=RPC", "RPC_DEM=data/transformer_13_dem.tif"]
     )
@@ -817,6 +822,49 @@ def test_transformer_13():
     )
 
 
+###############################################################################
+# Test that transforming batches of points with a RPC transformer and a DEM
+# gives the same results as transforming points one at a time
+
+
+@pytest.mark.parametrize("resampling", ["near", "bilinear", "cubic"])
+def test_transformer_rpc_batch(resampling):
+
+    ds = _create_transformer_13_ds()
+    tr = gdal.Transformer(
+        ds,
+        None,
+        [
+            "METHOD=RPC",
+            "RPC_DEM=data/transformer_13_dem.tif",
+            f"RPC_DEMINTERPOLATION={resampling}",
+        ],
+    )
+
+    points = [(x * 6600 / 20, y * 4400 / 10, 0) for y in range(11) for x in range(21)]
+    got_points, got_success = tr.TransformPoints(False, points)
+    assert sum(got_success) > len(points) // 2
+    for got, success, point in zip(got_points, got_success, points):
+        ref_success, ref = tr.TransformPoint(0, point[0], point[1], point[2])
+        assert success == ref_success
+        if success:
+            assert got == pytest.approx(ref, abs=1e-7)
+
+    # Long/lat to pixel/line transform, which is done on a line of points with
+    # the same latitude by GDALRPCTransformWholeLineWithDEM(), and on the other
+    # points by the generic code path
+    for geo_points in (
+        [(got[0], got_points[0][1], 0) for got in got_points[0:21]],
+        [got for got, success in zip(got_points, got_success) if success],
+    ):
+        got_pl, got_pl_success = tr.TransformPoints(True, geo_points)
+        for got, success, point in zip(got_pl, got_pl_success, geo_points):
+            ref_success, ref = tr.TransformPoint(1, point[0], point[1], point[2])
+            assert success == ref_success
+            if success:
+                assert got == pytest.approx(ref, abs=1e-7)
+
+
 ###############################################################################
 # Test inverse RPC transform when iterations do oscillations (#6377)
 
@@ -1147,6 +1195,40 @@ def test_transformer_tps_precision():
     assert maxDiffResult < 1e-3, "at least one transformation exceeds the error bound"
 
 
+###############################################################################
+# Test multi-threaded evaluation of the TPS transformer
+
+
+def test_transformer_tps_num_threads():
+
+    ds = gdal.Open("data/gcps_2115.vrt")
+    gcps = ds.GetGCPs()
+    points = []
+    for i in range(len(gcps) - 1):
+        points.append(
+            (
+                0.5 * (gcps[i].GCPPixel + gcps[i + 1].GCPPixel),
+                0.5 * (gcps[i].GCPLine + gcps[i + 1].GCPLine),
+                0,
+            )
+        )
+    points = points * 3
+
+    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS", "NUM_THREADS=1"])
+    expected_geo, expected_success = tr.TransformPoints(False, points)
+    assert all(expected_success)
+    expected_pl, expected_success = tr.TransformPoints(True, expected_geo)
+    assert all(expected_success)
+
+    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS", "NUM_THREADS=4"])
+    got_geo, got_success = tr.TransformPoints(False, points)
+    assert all(got_success)
+    assert got_geo == expected_geo
+    got_pl, got_success = tr.TransformPoints(True, expected_geo)
+    assert all(got_success)
+    assert got_pl == expected_pl
+
+
 ###############################################################################
 def test_transformer_image_no_srs():
 
@@ -213,6 +213,98 @@ def test_virtualmem_1():
     ds = None
 
 
+###############################################################################
+# Test read-ahead of linear and tiled virtual mem interfaces
+
+
+@pytest.mark.skipif(sys.platform != "linux", reason="Incorrect platform")
+@pytest.mark.parametrize("read_ahead", ["NO", "YES", "32768"])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_virtualmem_read_ahead(read_ahead, num_threads):
+
+    ds = gdal.Open("../gdrivers/data/small_world.tif")
+    ar = ds.ReadAsArray()
+    tilesize = 64
+    tilepercol = (ds.RasterYSize + tilesize - 1) // tilesize
+    tileperrow = (ds.RasterXSize + tilesize - 1) // tilesize
+    expected = numpy.zeros(
+        (3, tilepercol * tilesize, tileperrow * tilesize), dtype=numpy.uint8
+    )
+    expected[:, 0 : ds.RasterYSize, 0 : ds.RasterXSize] = ar
+    # (band, tile row, tile col, y, x)
+    expected = expected.reshape(3, tilepercol, tilesize, tileperrow, tilesize)
+    expected = expected.transpose(0, 1, 3, 2, 4)
+
+    with gdal.config_options(
+        {"GDAL_VIRTUAL_MEM_READAHEAD": read_ahead, "GDAL_NUM_THREADS": num_threads}
+    ):
+        ar_flat_bsq = ds.GetVirtualMemArray(
+            gdal.GF_Read,
+            0,
+            0,
+            ds.RasterXSize,
+            ds.RasterYSize,
+            ds.RasterXSize,
+            ds.RasterYSize,
+            gdal.GDT_Byte,
+            [1, 2, 3],
+            1,
+            1024 * 1024,
+            0,
+        )
+        ar_bsq = ds.GetTiledVirtualMemArray(
+            gdal.GF_Read,
+            0,
+            0,
+            ds.RasterXSize,
+            ds.RasterYSize,
+            tilesize,
+            tilesize,
+            gdal.GDT_Byte,
+            [1, 2, 3],
+            gdal.GTO_BSQ,
+            1024 * 1024,
+        )
+        ar_tip = ds.GetTiledVirtualMemArray(
+            gdal.GF_Read,
+            0,
+            0,
+            ds.RasterXSize,
+            ds.RasterYSize,
+            tilesize,
+            tilesize,
+            gdal.GDT_Byte,
+            [1, 2, 3],
+            gdal.GTO_TIP,
+            1024 * 1024,
+        )
+
+    # Sequential access
+    for band in range(3):
+        for y in range(ds.RasterYSize):
+            assert numpy.array_equal(ar_flat_bsq[band][y], ar[band][y])
+    for band in range(3):
+        for tiley in range(tilepercol):
+            for tilex in range(tileperrow):
+                assert numpy.array_equal(
+                    ar_bsq[band][tiley][tilex], expected[band][tiley][tilex]
+                )
+
+    # Strided access: tile column by tile column
+    for tilex in range(tileperrow):
+        for tiley in range(tilepercol):
+            for band in range(3):
+                assert numpy.array_equal(
+                    ar_tip[tiley][tilex][:, :, band], expected[band][tiley][tilex]
+                )
+
+    # We need to destroy the array before dataset destruction
+    ar_flat_bsq = None
+    ar_bsq = None
+    ar_tip = None
+    ds = None
+
+
 ###############################################################################
 # Test write mode
 @pytest.mark.skipif(sys.platform != "linux", reason="Incorrect platform")
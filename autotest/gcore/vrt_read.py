@@ -742,6 +742,42 @@ def test_vrt_read_20():
         os.unlink(f)
 
 
+###############################################################################
+# Test concurrent opening of the same sources of the dataset pool from
+# several threads
+
+
+def test_vrt_read_dataset_pool_concurrent_open(tmp_vsimem):
+
+    import threading
+
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, ["data/byte.tif"] * 4)
+
+    errors = []
+
+    def worker():
+        try:
+            for _ in range(5):
+                ds = gdal.Open(vrt_filename)
+                if ds.GetRasterBand(1).Checksum() != 4672:
+                    errors.append("wrong checksum")
+                ds.Close()
+        except Exception as e:
+            errors.append(str(e))
+
+    with gdal.config_options(
+        {"VRT_SHARED_SOURCE": "0", "GDAL_MAX_DATASET_POOL_RAM_USAGE": "1%"}
+    ):
+        threads = [threading.Thread(target=worker) for _ in range(8)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+    assert errors == []
+
+
 ###############################################################################
 # Test implicit virtual overviews
 
@@ -869,6 +905,47 @@ def test_vrt_read_virtual_overview_no_srcrect_dstrect(tmp_vsimem):
     assert ds.GetRasterBand(1).GetOverview(0).Checksum() == ref_cs
 
 
+###############################################################################
+# Test VRT_MOSAIC_OVERVIEWS
+
+
+@pytest.mark.parametrize("mode", ["VIRTUAL", "PERSISTENT"])
+def test_vrt_read_mosaic_overviews(tmp_vsimem, mode):
+
+    src_ds = gdal.Translate("", "data/byte.tif", width=512, height=512, format="MEM")
+    tile_filenames = []
+    for j in range(2):
+        for i in range(2):
+            tile_filename = str(tmp_vsimem / f"tile_{i}_{j}.tif")
+            gdal.Translate(tile_filename, src_ds, srcWin=[i * 256, j * 256, 256, 256])
+            tile_filenames.append(tile_filename)
+
+    vrt_filename = str(tmp_vsimem / "mosaic.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames)
+
+    # Disabled by default
+    with gdal.Open(vrt_filename) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 0
+
+    with gdal.config_option("VRT_MOSAIC_OVERVIEWS", mode):
+        with gdal.Open(vrt_filename) as ds:
+            band = ds.GetRasterBand(1)
+            assert band.GetOverviewCount() == 2
+            assert band.GetOverview(0).XSize == 256
+            assert band.GetOverview(1).XSize == 128
+            assert band.GetOverview(1).ReadRaster() == src_ds.GetRasterBand(
+                1
+            ).ReadRaster(buf_xsize=128, buf_ysize=128)
+
+    if mode == "PERSISTENT":
+        assert gdal.VSIStatL(vrt_filename + ".ovr") is not None
+        # The sidecar is used even without the configuration option
+        with gdal.Open(vrt_filename) as ds:
+            assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    else:
+        assert gdal.VSIStatL(vrt_filename + ".ovr") is None
+
+
 ###############################################################################
 # Test that we honour NBITS with SimpleSource and ComplexSource
 
@@ -3001,3 +3078,100 @@ def test_vrt_resampling_with_alpha_and_overviews(tmp_vsimem):
     assert ds.ReadRaster(
         buf_xsize=10, buf_ysize=1
     ) == b"\xFF\xFF\xFF\xFF\xFB\xF1\xF0\xF0\xF0\xF0" + (b"\xFF" * 10)
+
+
+###############################################################################
+# Test reading a mosaic with enough sources for a spatial index of their
+# destination windows to be used, including after sources are added or
+# replaced
+
+
+def test_vrt_read_many_sources_spatial_index(tmp_vsimem):
+
+    tile_filenames = []
+    for j in range(10):
+        for i in range(10):
+            filename = str(tmp_vsimem / f"tile_{i}_{j}.tif")
+            ds = gdal.GetDriverByName("GTiff").Create(filename, 4, 4)
+            ds.SetGeoTransform([i * 4, 1, 0, -j * 4, 0, -1])
+            ds.GetRasterBand(1).Fill(j * 10 + i)
+            ds = None
+            tile_filenames.append(filename)
+
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames)
+
+    expected = bytearray(40 * 40)
+    for y in range(40):
+        for x in range(40):
+            expected[y * 40 + x] = (y // 4) * 10 + (x // 4)
+
+    ds = gdal.Open(vrt_filename)
+    band = ds.GetRasterBand(1)
+    assert band.ReadRaster() == expected
+    assert band.ReadRaster(5, 6, 7, 3) == b"".join(
+        expected[y * 40 + 5 : y * 40 + 12] for y in range(6, 9)
+    )
+
+    def source_xml(filename, xoff, yoff):
+        return (
+            f'<SimpleSource><SourceFilename relativeToVRT="0">{filename}'
+            "</SourceFilename><SourceBand>1</SourceBand>"
+            '<SrcRect xOff="0" yOff="0" xSize="4" ySize="4"/>'
+            f'<DstRect xOff="{xoff}" yOff="{yoff}" xSize="4" ySize="4"/>'
+            "</SimpleSource>"
+        )
+
+    # Replace the source of the first tile
+    band.SetMetadataItem(
+        "source_0", source_xml(tile_filenames[99], 0, 0), "vrt_sources"
+    )
+    assert band.ReadRaster(0, 0, 1, 1) == b"\x63"
+    assert band.ReadRaster(4, 0, 1, 1) == b"\x01"
+
+    # Add a source on top of the last tile
+    band.SetMetadataItem(
+        "source_100", source_xml(tile_filenames[55], 36, 36), "new_vrt_sources"
+    )
+    assert band.ReadRaster(36, 36, 1, 1) == b"\x37"
+    assert band.ReadRaster(32, 32, 1, 1) == b"\x58"
+
+
+###############################################################################
+# Test opening a VRT whose sources are parsed one at a time
+
+
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_vrt_read_source_streaming(tmp_vsimem, with_mask):
+
+    tile_filenames = []
+    for i in range(3):
+        filename = str(tmp_vsimem / f"tile_{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 4, 4)
+        ds.SetGeoTransform([i * 4, 1, 0, 0, 0, -1])
+        ds.GetRasterBand(1).Fill(i + 1)
+        if with_mask:
+            ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+            ds.GetRasterBand(1).GetMaskBand().Fill(255)
+        ds = None
+        tile_filenames.append(filename)
+
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames).Close()
+
+    ds = gdal.Open(vrt_filename)
+    ref_xml = ds.GetMetadata("xml:VRT")[0]
+    ref_data = ds.ReadRaster()
+    ref_mask = ds.GetRasterBand(1).GetMaskBand().ReadRaster()
+    ds = None
+
+    with gdal.config_option("VRT_SOURCE_STREAMING_THRESHOLD", "0"):
+        ds = gdal.Open(vrt_filename)
+    assert ds.GetRasterBand(1).GetMetadata("vrt_sources").keys() == {
+        "source_0",
+        "source_1",
+        "source_2",
+    }
+    assert ds.GetMetadata("xml:VRT")[0] == ref_xml
+    assert ds.ReadRaster() == ref_data
+    assert ds.GetRasterBand(1).GetMaskBand().ReadRaster() == ref_mask
@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1636,3 +1637,231 @@ def test_vsicurl_header_option(server):
         full_filename = f"/vsicurl?header.foo=bar&header.Accept=application%2Fjson&url=http%3A%2F%2Flocalhost%3A{server.port}%2Ftest_vsicurl_header_option.bin"
         statres = gdal.VSIStatL(full_filename)
         assert statres.size == 3
+
+
+###############################################################################
+# Test GDAL_HTTP_SHARE_CACHE and GDAL_HTTP_MAX_HOST_CONNECTIONS
+
+
+@pytest.mark.parametrize("share_cache", ["YES", "NO"])
+def test_vsicurl_share_cache_max_host_connections(server, share_cache):
+
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_share_cache.bin",
+        200,
+        {"Content-Length": "3"},
+    )
+    handler.add(
+        "GET",
+        "/test_vsicurl_share_cache.bin",
+        200,
+        {"Content-Length": "3"},
+        "foo",
+    )
+
+    with gdal.config_options(
+        {
+            "GDAL_HTTP_SHARE_CACHE": share_cache,
+            "GDAL_HTTP_MAX_HOST_CONNECTIONS": "1",
+        }
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_vsicurl_share_cache.bin" % server.port,
+            "rb",
+        )
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+        finally:
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that the size of requests grows faster on a sustained sequential read,
+# and that readahead decisions are reported in network statistics
+
+
+def test_vsicurl_sequential_readahead(server):
+
+    gdal.VSICurlClearCache()
+
+    chunk_size = 16384
+    data = "0123456789abcdef" * (23 * chunk_size // 16)
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD", "/test_sequential_readahead.bin", 200, {"Content-Length": len(data)}
+    )
+    # Read sizes of 1, 2, 4 and then 16 chunks
+    for start_block, end_block in ((0, 1), (1, 3), (3, 7), (7, 23)):
+        start = start_block * chunk_size
+        end = end_block * chunk_size - 1
+        handler.add(
+            "GET",
+            "/test_sequential_readahead.bin",
+            206,
+            {"Content-Range": "bytes %d-%d/%d" % (start, end, len(data))},
+            data[start : end + 1],
+            expected_headers={"Range": "bytes=%d-%d" % (start, end)},
+        )
+
+    gdal.NetworkStatsReset()
+    with gdal.config_option(
+        "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_sequential_readahead.bin" % server.port,
+            "rb",
+        )
+        assert f
+        try:
+            got = b""
+            while True:
+                buf = gdal.VSIFReadL(1, 4096, f)
+                if not buf:
+                    break
+                got += buf
+        finally:
+            gdal.VSIFCloseL(f)
+    assert got == data.encode("ascii")
+
+    j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    gdal.NetworkStatsReset()
+    assert j["handlers"]["vsicurl"]["readahead"] == {
+        "sequential_count": 3,
+        "random_count": 1,
+        "max_request_bytes": 16 * chunk_size,
+    }
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+
+
+def test_vsicurl_persistent_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_cache.bin" % server.port
+
+    def read(handler):
+        with gdal.config_options(
+            {
+                "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+                "CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE": "1MB",
+            }
+        ), webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f
+            try:
+                return gdal.VSIFReadL(1, 3, f)
+            finally:
+                gdal.VSIFCloseL(f)
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_persistent_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"first"'},
+    )
+    handler.add(
+        "GET",
+        "/test_persistent_cache.bin",
+        206,
+        {"Content-Range": "bytes 0-2/3", "ETag": '"first"'},
+        "foo",
+    )
+    assert read(handler) == b"foo"
+    assert len(gdal.ReadDir(cache_dir)) == 1
+
+    # Served from the persistent cache
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_persistent_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"first"'},
+    )
+    assert read(handler) == b"foo"
+
+    # Remote file modified: the cached content must not be used
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_persistent_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"second"'},
+    )
+    handler.add(
+        "GET",
+        "/test_persistent_cache.bin",
+        206,
+        {"Content-Range": "bytes 0-2/3", "ETag": '"second"'},
+        "bar",
+    )
+    assert read(handler) == b"bar"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that large reads are split into parts downloaded in parallel
+
+
+def test_vsicurl_parallel_read(server):
+
+    gdal.VSICurlClearCache()
+
+    part_size = 16384
+    data = ("0123456789abcdef" * (3 * part_size // 16)).encode("ascii")
+    requested_ranges = []
+
+    def method(request):
+        requested_ranges.append(request.headers["Range"])
+        start, end = (
+            int(x) for x in request.headers["Range"][len("bytes=") :].split("-")
+        )
+        request.send_response(206)
+        request.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, len(data)))
+        request.send_header("Content-Length", end - start + 1)
+        request.end_headers()
+        request.wfile.write(data[start : end + 1])
+
+    handler = webserver.SequentialHandler()
+    handler.add("HEAD", "/test_parallel_read.bin", 200, {"Content-Length": len(data)})
+    for i in range(3):
+        handler.add("GET", "/test_parallel_read.bin", custom_method=method)
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE": str(part_size),
+            "CPL_VSIL_CURL_PARALLEL_READ_MAX_CONCURRENT_REQUESTS": "4",
+        }
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_parallel_read.bin" % server.port,
+            "rb",
+        )
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+        finally:
+            gdal.VSIFCloseL(f)
+
+    assert sorted(requested_ranges) == [
+        "bytes=%d-%d" % (i * part_size, (i + 1) * part_size - 1) for i in range(3)
+    ]
+
+    gdal.VSICurlClearCache()
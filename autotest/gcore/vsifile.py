@@ -12,7 +12,10 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import gzip
+import json
 import os
+import random
 import sys
 import time
 
@@ -887,6 +890,113 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test index of access points of .gz files
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsigzip_index(tmp_path, num_threads):
+
+    r = random.Random(0)
+    data = b"".join(b"%d,%f\n" % (i, r.random()) for i in range(200000))
+    filename = str(tmp_path / "test.csv.gz")
+    with open(filename, "wb") as f:
+        f.write(gzip.compress(data))
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPAN": "64K",
+            "GDAL_NUM_THREADS": num_threads,
+        }
+    ):
+        for i in range(2):
+            if i == 0:
+                assert not os.path.exists(filename + ".gzidx")
+            else:
+                assert os.path.exists(filename + ".gzidx")
+
+            with gdal.VSIFile("/vsigzip/" + filename, "rb") as f:
+                f.seek(0, os.SEEK_END)
+                assert f.tell() == len(data)
+                assert f.read(1) == b""
+
+                for offset in (len(data) // 2, 100, len(data) - 10):
+                    f.seek(offset)
+                    assert f.read(100000) == data[offset : offset + 100000]
+
+                f.seek(0)
+                assert f.read() == data
+
+        assert gdal.VSIStatL("/vsigzip/" + filename).size == len(data)
+
+
+def test_vsigzip_index_dir(tmp_path):
+
+    r = random.Random(0)
+    data = b"".join(b"%d,%f\n" % (i, r.random()) for i in range(100000))
+    filename = str(tmp_path / "test.csv.gz")
+    with open(filename, "wb") as f:
+        f.write(gzip.compress(data))
+
+    index_dir = tmp_path / "index"
+    os.mkdir(index_dir)
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_DIR": str(index_dir),
+            "CPL_VSIL_GZIP_INDEX_SPAN": "64K",
+        }
+    ):
+        with gdal.VSIFile("/vsigzip/" + filename, "rb") as f:
+            assert f.read() == data
+    assert len(os.listdir(index_dir)) == 1
+    assert not os.path.exists(filename + ".gzidx")
+
+
+def test_vsigzip_index_invalidation(tmp_path):
+
+    r = random.Random(0)
+    data = b"".join(b"%d,%f\n" % (i, r.random()) for i in range(100000))
+    filename = str(tmp_path / "test.csv.gz")
+    with open(filename, "wb") as f:
+        f.write(gzip.compress(data))
+
+    # /vsigzip/ caches the state of the last opened file, based on its name,
+    # so use different names to designate the successive versions of the file.
+    def check(path):
+        with gdal.VSIFile("/vsigzip/" + path, "rb") as f:
+            f.seek(len(data) // 2)
+            assert f.read(1000) == data[len(data) // 2 : len(data) // 2 + 1000]
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX": "YES", "CPL_VSIL_GZIP_INDEX_SPAN": "64K"}
+    ):
+        check(filename)
+        index_size = os.stat(filename + ".gzidx").st_size
+
+        # Modify the file: the index must be rebuilt
+        data = data[::-1] + b"x" * 100000
+        with open(filename, "wb") as f:
+            f.write(gzip.compress(data))
+        check(str(tmp_path) + "/./test.csv.gz")
+        assert os.stat(filename + ".gzidx").st_size != index_size
+
+        # Corrupted index: ignored and rebuilt
+        with open(filename + ".gzidx", "r+b") as f:
+            f.truncate(100)
+        check(str(tmp_path) + "/././test.csv.gz")
+        assert os.stat(filename + ".gzidx").st_size > 100
+
+        # Files made of several members are not indexed
+        os.unlink(filename + ".gzidx")
+        with open(filename, "wb") as f:
+            f.write(gzip.compress(data[0:1000]))
+            f.write(gzip.compress(data[1000:]))
+        check(str(tmp_path) + "/./././test.csv.gz")
+        assert not os.path.exists(filename + ".gzidx")
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -1766,3 +1876,165 @@ def test_vsifile_MultipartUpload():
             match=r"MultipartUploadAbort\(\) not supported by this file system",
         ):
             gdal.MultipartUploadAbort("", "")
+
+
+###############################################################################
+# Test /vsishm/
+
+
+def test_vsifile_vsishm(tmp_path):
+
+    with gdal.config_option("CPL_VSISHM_ROOT", str(tmp_path / "shm")):
+        with gdal.VSIFile("/vsishm/test.bin", "wb") as f:
+            f.write(b"hello")
+        assert (tmp_path / "shm" / "test.bin").read_bytes() == b"hello"
+
+        assert gdal.VSIStatL("/vsishm/test.bin").size == 5
+        assert "test.bin" in gdal.ReadDir("/vsishm/")
+
+        with gdal.VSIFile("/vsishm/test.bin", "rb") as f:
+            assert f.read() == b"hello"
+
+        assert gdal.Rename("/vsishm/test.bin", "/vsishm/test2.bin") == 0
+        assert gdal.VSIStatL("/vsishm/test.bin") is None
+
+        # Cannot escape from the root
+        assert gdal.VSIStatL("/vsishm/../shm/test2.bin") is None
+
+        assert gdal.Unlink("/vsishm/test2.bin") == 0
+        assert not (tmp_path / "shm" / "test2.bin").exists()
+
+
+@pytest.mark.skipif(sys.platform != "linux", reason="Linux specific test")
+def test_vsifile_vsishm_default_root():
+
+    filename = "/vsishm/test_vsifile_vsishm_default_root.bin"
+    with gdal.VSIFile(filename, "wb") as f:
+        f.write(b"hello")
+    try:
+        root = f"/dev/shm/gdal_vsishm_{os.geteuid()}"
+        assert os.path.exists(root + "/test_vsifile_vsishm_default_root.bin")
+        assert (os.stat(root).st_mode & 0o777) == 0o700
+    finally:
+        gdal.Unlink(filename)
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="POSIX specific test")
+def test_vsifile_vsishm_root_accessible_to_others(tmp_path):
+
+    root = tmp_path / "shm"
+    root.mkdir()
+    os.chmod(root, 0o755)
+    with gdal.config_option("CPL_VSISHM_ROOT", str(root)):
+        with pytest.raises(Exception, match="not accessible to other users"):
+            gdal.VSIFile("/vsishm/test.bin", "wb")
+    assert not (root / "test.bin").exists()
+
+    os.chmod(root, 0o700)
+    with gdal.config_option("CPL_VSISHM_ROOT", str(root)):
+        with gdal.VSIFile("/vsishm/test.bin", "wb") as f:
+            f.write(b"hello")
+        assert gdal.Unlink("/vsishm/test.bin") == 0
+
+
+###############################################################################
+# Test O_DIRECT reads of local files
+
+
+@pytest.mark.skipif(sys.platform != "linux", reason="Linux specific test")
+def test_vsifile_unix_direct_io(tmp_path):
+
+    r = random.Random(0)
+    data = bytes(r.getrandbits(8) for _ in range(100000))
+    filename = str(tmp_path / "test.bin")
+    with open(filename, "wb") as f:
+        f.write(data)
+
+    with gdal.config_option("CPL_VSIL_UNIX_DIRECT_IO_THRESHOLD", "10000"):
+        with gdal.VSIFile(filename, "rb") as f:
+            assert f.read(100) == data[0:100]
+            assert f.read(20000) == data[100:20100]
+            assert f.tell() == 20100
+            f.seek(12345)
+            assert f.read(50000) == data[12345:62345]
+            f.seek(90001)
+            assert f.read(20000) == data[90001:]
+            assert f.tell() == len(data)
+            assert f.eof()
+
+
+###############################################################################
+# Test io_uring reads of local files (falls back to regular reads when
+# unavailable)
+
+
+def test_vsifile_unix_io_uring(tmp_path):
+
+    filename = str(tmp_path / "test.tif")
+    src_ds = gdal.Open("data/byte.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    )
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_UNIX_IO_URING": "YES",
+            "CPL_VSIL_UNIX_IO_URING_QUEUE_DEPTH": "2",
+            "CPL_VSIL_UNIX_DIRECT_IO_THRESHOLD": "100",
+        }
+    ):
+        ds = gdal.Open(filename)
+        assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+        assert ds.ReadRaster() == src_ds.ReadRaster()
+
+
+###############################################################################
+# Test VSIIOStatsGetAsSerializedJSON() and VSIIOStatsGetAsPrometheusText()
+
+
+def test_vsifile_io_stats():
+
+    gdal.IOStatsReset()
+    try:
+        with gdal.config_option("CPL_VSIL_IO_STATS_ENABLED", "YES"):
+            gdal.FileFromMemBuffer("/vsimem/test_vsifile_io_stats.bin", "0123456789")
+            f = gdal.VSIFOpenL("/vsimem/test_vsifile_io_stats.bin", "rb")
+            assert f
+            gdal.VSIFSeekL(f, 2, 0)
+            assert gdal.VSIFReadL(1, 3, f) == b"234"
+            assert gdal.VSIFReadL(1, 10, f) == b"56789"
+            gdal.VSIFCloseL(f)
+            gdal.Unlink("/vsimem/test_vsifile_io_stats.bin")
+
+            j = json.loads(gdal.IOStatsGetAsSerializedJSON())
+            vsimem = j["filesystems"]["vsimem"]
+            assert vsimem["operations"]["Read"]["count"] == 2
+            assert vsimem["operations"]["Read"]["bytes"] == 8
+            assert vsimem["operations"]["Seek"]["count"] == 1
+            histogram = vsimem["operations"]["Read"]["latency_histogram_us"]
+            assert sum(histogram.values()) == 2
+            assert "/vsimem/test_vsifile_io_stats.bin" in vsimem["files"]
+
+            j = json.loads(gdal.IOStatsGetAsSerializedJSON(["PER_PATH=NO"]))
+            assert "files" not in j["filesystems"]["vsimem"]
+
+            text = gdal.IOStatsGetAsPrometheusText()
+            assert (
+                'gdal_vsi_operation_duration_seconds_count{filesystem="vsimem",operation="Read"} 2'
+                in text
+            )
+            assert (
+                'gdal_vsi_operation_bytes_total{filesystem="vsimem",operation="Read"} 8'
+                in text
+            )
+            assert (
+                'gdal_vsi_operation_duration_seconds_bucket{filesystem="vsimem",operation="Read",le="+Inf"} 2'
+                in text
+            )
+
+            text = gdal.IOStatsGetAsPrometheusText(["PER_PATH=YES"])
+            assert 'path="/vsimem/test_vsifile_io_stats.bin"' in text
+    finally:
+        gdal.IOStatsReset()
+
+    assert json.loads(gdal.IOStatsGetAsSerializedJSON()) == {"filesystems": {}}
@@ -1843,6 +1843,88 @@ def test_vsis3_opendir(aws_test_config, webserver_port):
     )
 
 
+###############################################################################
+# Test OpenDir() with NUM_THREADS, listing first-level subdirectories
+# concurrently
+
+
+def test_vsis3_opendir_num_threads(aws_test_config, webserver_port):
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "GET",
+        "/vsis3_opendir_num_threads/?delimiter=%2F",
+        200,
+        {"Content-type": "application/xml"},
+        """<?xml version="1.0" encoding="UTF-8"?>
+            <ListBucketResult>
+                <Prefix/>
+                <Marker/>
+                <Contents>
+                    <Key>test.txt</Key>
+                    <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                    <Size>40</Size>
+                </Contents>
+                <CommonPrefixes>
+                    <Prefix>subdir1/</Prefix>
+                </CommonPrefixes>
+                <CommonPrefixes>
+                    <Prefix>subdir2/</Prefix>
+                </CommonPrefixes>
+            </ListBucketResult>
+        """,
+    )
+    for subdir in ("subdir1", "subdir2"):
+        handler.add(
+            "GET",
+            f"/vsis3_opendir_num_threads/?prefix={subdir}%2F",
+            200,
+            {"Content-type": "application/xml"},
+            f"""<?xml version="1.0" encoding="UTF-8"?>
+                <ListBucketResult>
+                    <Prefix>{subdir}/</Prefix>
+                    <Marker/>
+                    <Contents>
+                        <Key>{subdir}/a.txt</Key>
+                        <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                        <Size>5</Size>
+                    </Contents>
+                    <Contents>
+                        <Key>{subdir}/subsubdir/b.txt</Key>
+                        <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                        <Size>6</Size>
+                    </Contents>
+                </ListBucketResult>
+            """,
+        )
+    with webserver.install_http_handler(handler):
+        d = gdal.OpenDir(
+            "/vsis3/vsis3_opendir_num_threads",
+            -1,
+            ["NUM_THREADS=2", "SYNTHETIZE_MISSING_DIRECTORIES=YES"],
+        )
+        assert d is not None
+        entries = []
+        while True:
+            entry = gdal.GetNextDirEntry(d)
+            if entry is None:
+                break
+            entries.append((entry.name, entry.mode, entry.size))
+        gdal.CloseDir(d)
+
+    assert entries == [
+        ("test.txt", 32768, 40),
+        ("subdir1", 16384, 0),
+        ("subdir1/a.txt", 32768, 5),
+        ("subdir1/subsubdir", 16384, 0),
+        ("subdir1/subsubdir/b.txt", 32768, 6),
+        ("subdir2", 16384, 0),
+        ("subdir2/a.txt", 32768, 5),
+        ("subdir2/subsubdir", 16384, 0),
+        ("subdir2/subsubdir/b.txt", 32768, 6),
+    ]
+
+
 ###############################################################################
 # Test OpenDir(['SYNTHETIZE_MISSING_DIRECTORIES=YES']) with a fake AWS server
 
@@ -932,6 +932,37 @@ def test_vsizip_byte_sozip():
         gdal.Unlink(zipfilename)
 
 
+###############################################################################
+# Test multithreaded decompression of SOZip files
+
+
+def test_vsizip_sozip_multithreaded_read(tmp_vsimem):
+
+    data = b"".join(b"%d\n" % i for i in range(100000))
+    srcfilename = str(tmp_vsimem / "src.txt")
+    gdal.FileFromMemBuffer(srcfilename, data)
+    dstfilename = f"/vsizip/{tmp_vsimem}/test.zip/test.txt"
+    options = ["SOZIP_ENABLED=YES", "SOZIP_CHUNK_SIZE=1024"]
+    assert gdal.CopyFile(srcfilename, dstfilename, options=options) == 0
+    assert gdal.GetFileMetadata(dstfilename, "ZIP")["SOZIP_VALID"] == "YES"
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        with gdal.VSIFile(dstfilename, "rb") as f:
+            # Sequential reads
+            got = b""
+            while True:
+                chunk = f.read(1000)
+                if not chunk:
+                    break
+                got += chunk
+            assert got == data
+
+            # Random reads
+            for offset in (len(data) // 2, 100, len(data) - 10, 12345):
+                f.seek(offset)
+                assert f.read(5000) == data[offset : offset + 5000]
+
+
 ###############################################################################
 
 
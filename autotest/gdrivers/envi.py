@@ -1156,3 +1156,48 @@ fwhm = {0.0003, 0.0002, 0.0001}""",
     assert ds.GetRasterBand(2).GetMetadataItem("FWHM_UM", "IMAGERY") == "0.200"
     ds = None
     gdal.GetDriverByName("ENVI").Delete("/vsimem/test.bin")
+
+
+###############################################################################
+# Test RAW_USE_MMAP on a big endian pixel interleaved file
+
+
+def test_envi_read_raw_use_mmap(tmp_path):
+
+    width = 1024
+    height = 1024
+    nbands = 3
+    filename = str(tmp_path / "test.bin")
+    with open(str(tmp_path / "test.hdr"), "wt") as f:
+        f.write(f"""ENVI
+samples = {width}
+lines = {height}
+bands = {nbands}
+header offset = 0
+file type = ENVI Standard
+data type = 2
+interleave = bip
+byte order = 1""")
+    with open(filename, "wb") as f:
+        f.write(
+            struct.pack(
+                ">%dh" % (width * height * nbands),
+                *[(i * 7) % 65536 - 32768 for i in range(width * height * nbands)],
+            )
+        )
+
+    def read(options):
+        with gdal.config_options(options):
+            ds = gdal.Open(filename)
+            return (
+                ds.ReadRaster(),
+                ds.ReadRaster(1, 2, 100, 200, buf_type=gdal.GDT_Float32),
+                ds.GetRasterBand(2).ReadRaster(),
+                ds.GetRasterBand(3).ReadRaster(
+                    10, 20, 1000, 1000, buf_type=gdal.GDT_Int32
+                ),
+            )
+
+    ref = read({"RAW_USE_MMAP": "NO"})
+    assert read({"RAW_USE_MMAP": "YES"}) == ref
+    assert read({"RAW_USE_MMAP": "YES", "GDAL_NUM_THREADS": "4"}) == ref
@@ -4406,3 +4406,116 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test that JPEG tiles of a GTiff dataset are copied without being re-encoded
+
+
+@pytest.mark.require_driver("JPEG")
+@pytest.mark.require_creation_option("GTiff", "JPEG")
+def test_gpkg_copy_src_compressed_data(tmp_vsimem):
+
+    tmp_gtiff = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.Translate(
+        tmp_gtiff,
+        "../gcore/data/rgbsmall.tif",
+        width=300,
+        height=280,
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=256",
+            "BLOCKYSIZE=256",
+            "COMPRESS=JPEG",
+            "JPEG_QUALITY=95",
+        ],
+    )
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    tmp_gpkg = str(tmp_vsimem / "tmp.gpkg")
+    gdaltest.gpkg_dr.CreateCopy(tmp_gpkg, src_ds, options=["TILE_FORMAT=JPEG"])
+
+    out_ds = gdal.Open(tmp_gpkg)
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+    check_tile_format(out_ds, "JPEG", 3, False)
+    with out_ds.ExecuteSQL("SELECT COUNT(*) FROM tmp") as sql_lyr:
+        assert sql_lyr.GetNextFeature().GetField(0) == 4
+    out_ds = None
+
+    # An explicit QUALITY requires re-encoding
+    gdaltest.gpkg_dr.CreateCopy(
+        tmp_gpkg, src_ds, options=["TILE_FORMAT=JPEG", "QUALITY=50"]
+    )
+    out_ds = gdal.Open(tmp_gpkg)
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] != expected_cs
+    out_ds = None
+
+    # JPEG tiles cannot be stored as PNG tiles
+    gdaltest.gpkg_dr.CreateCopy(tmp_gpkg, src_ds, options=["TILE_FORMAT=PNG"])
+    out_ds = gdal.Open(tmp_gpkg)
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+    check_tile_format(out_ds, "PNG", 3, False)
+
+
+###############################################################################
+# Test reading several tiles at once, possibly decoded in worker threads
+
+
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gpkg_read_several_tiles(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tmp_gpkg = str(tmp_vsimem / "tmp.gpkg")
+    gdaltest.gpkg_dr.CreateCopy(
+        tmp_gpkg, src_ds, options=["TILE_FORMAT=PNG", "BLOCKSIZE=16"]
+    )
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(tmp_gpkg)
+        assert ds.ReadRaster(band_list=[1, 2, 3]) == src_ds.ReadRaster()
+        ds = None
+
+        ds = gdal.Open(tmp_gpkg)
+        assert ds.GetRasterBand(2).ReadRaster(
+            3, 5, 40, 30
+        ) == src_ds.GetRasterBand(2).ReadRaster(3, 5, 40, 30)
+        # Blocks of other bands have been populated
+        assert ds.GetRasterBand(1).ReadRaster(
+            3, 5, 40, 30
+        ) == src_ds.GetRasterBand(1).ReadRaster(3, 5, 40, 30)
+        ds = None
+
+
+###############################################################################
+# Test writing tiles encoded in worker threads
+
+
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG"])
+def test_gpkg_write_tiles_multithreaded(tmp_vsimem, num_threads, tile_format):
+
+    if gdal.GetDriverByName(tile_format) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tmp_gpkg = str(tmp_vsimem / "tmp.gpkg")
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdaltest.gpkg_dr.CreateCopy(
+            tmp_gpkg,
+            src_ds,
+            options=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=16"],
+        )
+        ds.BuildOverviews("AVERAGE", [2, 4])
+        ds = None
+
+    ds = gdal.Open(tmp_gpkg)
+    sql = "SELECT COUNT(*) FROM tmp GROUP BY zoom_level ORDER BY zoom_level"
+    with ds.ExecuteSQL(sql) as sql_lyr:
+        assert [f.GetField(0) for f in sql_lyr] == [1, 4, 16]
+    if tile_format == "PNG":
+        assert ds.ReadRaster(band_list=[1, 2, 3]) == src_ds.ReadRaster()
+    else:
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] != [0, 0, 0]
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
@@ -2278,6 +2278,51 @@ def test_grib_grib2_sidecar_vsisubfile():
     )
 
 
+# Test writing a sidecar file
+
+
+def test_grib_grib2_write_sidecar(tmp_path):
+
+    filename = str(tmp_path / "test.grib2")
+    shutil.copy("data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", filename)
+
+    ds = gdal.OpenEx(filename, open_options=["WRITE_IDX=YES"])
+    assert ds.GetRasterBand(1).GetDescription() == '1[-] HYBL="Hybrid level"'
+    ds = None
+
+    with open(filename + ".idx") as f:
+        lines = f.read().splitlines()
+    with open("data/grib/gfs.t06z.pgrb2.10p0.f010.grib2.idx") as f:
+        ref_lines = f.read().splitlines()
+    assert len(lines) == len(ref_lines)
+    for line, ref_line in zip(lines, ref_lines):
+        # Message number, offset and reference time
+        assert line.split(":")[0:3] == ref_line.split(":")[0:3]
+        assert line.endswith(":10 hour fcst:")
+
+    ds_idx = gdal.Open(filename)
+    ds_no_idx = gdal.OpenEx(filename, open_options=["USE_IDX=NO"])
+    assert ds_idx.RasterCount == ds_no_idx.RasterCount
+    assert ds_idx.GetRasterBand(1).GetDescription().startswith("REFD:")
+    assert ds_idx.ReadRaster() == ds_no_idx.ReadRaster()
+
+
+def test_grib_grib2_write_sidecar_subgrids(tmp_path):
+
+    filename = str(tmp_path / "test.grib2")
+    shutil.copy("data/grib/subgrids.grib2", filename)
+
+    gdal.OpenEx(filename, open_options=["WRITE_IDX=YES"])
+
+    with open(filename + ".idx") as f:
+        lines = f.read().splitlines()
+    assert [line.split(":")[0] for line in lines] == ["1.1", "1.2"]
+
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).Checksum() == 4672
+    assert ds.GetRasterBand(2).Checksum() == 4563
+
+
 # Test reading a (broken) mix of GRIBv2/GRIBv1 bands
 
 
@@ -2948,6 +2948,56 @@ def test_gti_read_multi_threaded_disabled_because_truncated_source(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test reading tile by tile, with the in-memory index of the tile index and
+# prefetching of the sources of the next tile
+
+
+@pytest.mark.parametrize("prefetch", ["YES", "NO"])
+@pytest.mark.parametrize("max_features_in_memory_index", ["0", "100000"])
+def test_gti_read_tile_by_tile_prefetch(
+    tmp_vsimem, prefetch, max_features_in_memory_index
+):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=512, height=256, format="MEM"
+    )
+    tile_size = 64
+    tiles_ds = []
+    for j in range(256 // tile_size):
+        for i in range(512 // tile_size):
+            tile_filename = str(tmp_vsimem / f"{i}_{j}.tif")
+            gdal.Translate(
+                tile_filename,
+                src_ds,
+                srcWin=[i * tile_size, j * tile_size, tile_size, tile_size],
+            )
+            tiles_ds.append(gdal.Open(tile_filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles_ds)
+    del index_ds
+    del tiles_ds
+
+    with gdal.config_option(
+        "GTI_IN_MEMORY_INDEX_MAX_FEATURES", max_features_in_memory_index
+    ):
+        vrt_ds = gdal.OpenEx(index_filename, open_options=[f"PREFETCH={prefetch}"])
+
+        # Requests not aligned on source tiles, walked in row order
+        req_size = 48
+        for y in range(0, 256, req_size):
+            for x in range(0, 512, req_size):
+                xsize = min(req_size, 512 - x)
+                ysize = min(req_size, 256 - y)
+                assert vrt_ds.ReadRaster(x, y, xsize, ysize) == src_ds.ReadRaster(
+                    x, y, xsize, ysize
+                ), (x, y)
+
+        assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+        vrt_ds.Close()
+
+
 ###############################################################################
 
 
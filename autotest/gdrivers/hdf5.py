@@ -1618,3 +1618,27 @@ def test_hdf5_force_opening_no_match():
 
     drv = gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["HDF5"])
     assert drv is None
+
+
+###############################################################################
+# Test that reading chunks without libhdf5 (default) gives the same result as
+# through it
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/netcdf/byte_chunked_multiple.nc",
+        "data/netcdf/byte_chunked_not_multiple.nc",
+        "data/netcdf/byte_hdf5_starting_at_offset_1024.nc",
+    ],
+)
+def test_hdf5_direct_chunk_read(filename):
+    def read():
+        ds = gdal.OpenEx(filename, allowed_drivers=["HDF5"])
+        assert ds.GetRasterBand(1).Checksum() == 4672
+        return ds.ReadRaster()
+
+    with gdal.config_option("GDAL_HDF5_DIRECT_CHUNK_READ", "NO"):
+        expected = read()
+    assert read() == expected
@@ -887,3 +887,38 @@ def test_hdf5_multidim_read_cfloat16():
         24.0,
         24.0,
     )
+
+
+###############################################################################
+# Test that reading chunks without libhdf5 (default) gives the same result as
+# through it
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_hdf5_multidim_direct_chunk_read(num_threads):
+    def read():
+        ds = gdal.OpenEx(
+            "data/hdf5/dummy_HDFEOS_swath_chunked.h5", gdal.OF_MULTIDIM_RASTER
+        )
+        ar = ds.GetRootGroup().OpenMDArrayFromFullname(
+            "/HDFEOS/SWATHS/MySwath/Data Fields/MyDataField"
+        )
+        return [
+            ar.Read(),
+            ar.Read(array_start_idx=[1, 2, 3], count=[10, 11, 12]),
+            ar.Read(
+                array_start_idx=[19, 29, 39],
+                count=[5, 6, 7],
+                array_step=[-1, -1, -1],
+            ),
+            ar.Read(
+                array_start_idx=[2, 3, 5],
+                count=[7, 9, 11],
+                buffer_stride=[1, 7, 7 * 9],
+            ),
+        ]
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        with gdal.config_option("GDAL_HDF5_DIRECT_CHUNK_READ", "NO"):
+            expected = read()
+        assert read() == expected
@@ -3945,3 +3945,36 @@ def test_jp2openjpeg_write_check_golden_file(tmp_path, src_filename, creation_op
         )
     assert os.stat(src_filename).st_size == os.stat(out_filename).st_size
     assert open(src_filename, "rb").read() == open(out_filename, "rb").read()
+
+
+###############################################################################
+# Test reading a single-tiled image alternately at several resolution levels,
+# with the codecs cached per level
+
+
+def test_jp2openjpeg_single_tile_cached_codecs(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "out.jp2")
+    gdal.Translate(
+        filename,
+        "data/byte.tif",
+        width=2000,
+        height=1500,
+        creationOptions=["BLOCKXSIZE=2000", "BLOCKYSIZE=1500"],
+    )
+
+    def read_all_levels():
+        ds = gdal.Open(filename)
+        band = ds.GetRasterBand(1)
+        assert band.GetBlockSize() == [1024, 1024]
+        assert band.GetOverviewCount() >= 3
+        ret = []
+        for ovr_idx in (-1, 0, 2, -1, 1, 0, -1):
+            b = band if ovr_idx < 0 else band.GetOverview(ovr_idx)
+            ret.append(b.ReadRaster(0, 0, b.XSize // 3, b.YSize // 3))
+            ret.append(b.Checksum())
+        return ret
+
+    with gdal.config_option("USE_OPENJPEG_SINGLE_TILE_OPTIM", "NO"):
+        expected = read_all_levels()
+    assert read_all_levels() == expected
@@ -1661,6 +1661,40 @@ def test_jpeg_read_pix4d_xmp_crs_vertcs_ellipsoidal():
     assert srs.GetAuthorityCode(None) == "6319"
 
 
+###############################################################################
+# Test reading windows, with cropped decompression when supported
+
+
+def test_jpeg_read_window(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.jpg")
+    gdal.Translate(
+        filename,
+        "../gcore/data/byte.tif",
+        format="JPEG",
+        width=1024,
+        height=512,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+    with gdal.Open(filename) as ds:
+        ref = ds.ReadRaster()
+
+    def get_ref_window(xoff, yoff, xsize, ysize):
+        return b"".join(
+            ref[(yoff + y) * 1024 + xoff : (yoff + y) * 1024 + xoff + xsize]
+            for y in range(ysize)
+        )
+
+    with gdal.Open(filename) as ds:
+        assert ds.ReadRaster(301, 200, 100, 50) == get_ref_window(301, 200, 100, 50)
+        # Horizontally adjacent window, as in a tiled scan of the image
+        assert ds.ReadRaster(401, 200, 100, 50) == get_ref_window(401, 200, 100, 50)
+        assert ds.ReadRaster(0, 0, 100, 50) == get_ref_window(0, 0, 100, 50)
+        assert ds.GetRasterBand(1).ReadRaster(0, 511, 1024, 1) == get_ref_window(
+            0, 511, 1024, 1
+        )
+
+
 ###############################################################################
 # Cleanup
 
@@ -13,7 +13,9 @@
 ###############################################################################
 
 import ctypes
+import os
 import struct
+import sys
 
 import gdaltest
 import pytest
@@ -792,3 +794,85 @@ def test_mem_gdt_unknown():
             Exception, match="Illegal GDT_Unknown/GDT_TypeCount argument"
         ):
             ds.AddBand(gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test dataset RasterIO() between band-separated MEM datasets and
+# pixel-interleaved buffers
+
+
+@pytest.mark.parametrize("band_count", [2, 3, 4, 5])
+@pytest.mark.parametrize(
+    "dt,struct_type",
+    [(gdal.GDT_Byte, "B"), (gdal.GDT_Int16, "h"), (gdal.GDT_Float64, "d")],
+)
+def test_mem_rasterio_band_separated_pixel_interleaved(band_count, dt, struct_type):
+
+    width = 5
+    height = 3
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, band_count, dt)
+    for i in range(band_count):
+        ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack(
+                struct_type * (width * height),
+                *[i * 50 + j for j in range(width * height)],
+            ),
+        )
+    dt_size = gdal.GetDataTypeSizeBytes(dt)
+    kwargs = {
+        "buf_pixel_space": dt_size * band_count,
+        "buf_line_space": dt_size * band_count * width,
+        "buf_band_space": dt_size,
+    }
+
+    # Whole strips
+    data = ds.ReadRaster(**kwargs)
+    values = struct.unpack(struct_type * (width * height * band_count), data)
+    expected = [i * 50 + j for j in range(width * height) for i in range(band_count)]
+    assert list(values) == expected
+
+    # Write back the same values through the pixel-interleaved buffer
+    ds2 = gdal.GetDriverByName("MEM").Create("", width, height, band_count, dt)
+    ds2.WriteRaster(0, 0, width, height, data, **kwargs)
+    for i in range(band_count):
+        assert (
+            ds2.GetRasterBand(i + 1).ReadRaster()
+            == ds.GetRasterBand(i + 1).ReadRaster()
+        )
+
+    # Sub-window
+    kwargs["buf_line_space"] = dt_size * band_count * 2
+    data = ds.ReadRaster(1, 1, 2, 2, **kwargs)
+    values = struct.unpack(struct_type * (2 * 2 * band_count), data)
+    expected = [
+        i * 50 + y * width + x
+        for y in range(1, 3)
+        for x in range(1, 3)
+        for i in range(band_count)
+    ]
+    assert list(values) == expected
+
+
+###############################################################################
+# Test MMAP_FILENAME creation option
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="mmap of files not available")
+def test_mem_mmap_filename(tmp_path):
+
+    filename = str(tmp_path / "scratch.bin")
+    ds = gdal.GetDriverByName("MEM").Create(
+        "", 20, 10, 2, options=["MMAP_FILENAME=" + filename]
+    )
+    assert os.path.getsize(filename) == 20 * 10 * 2
+    assert ds.GetRasterBand(1).Checksum() == 0
+    ds.GetRasterBand(2).Fill(255)
+    assert ds.GetRasterBand(2).ReadRaster() == b"\xff" * 200
+    ds = None
+
+    with open(filename, "rb") as f:
+        assert f.read() == b"\x00" * 200 + b"\xff" * 200
@@ -2336,6 +2336,40 @@ def test_mem_md_array_statistics_float32():
     assert stats.valid_count == 5
 
 
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize(
+    "datatype,fmt", [(gdal.GDT_Int16, "h"), (gdal.GDT_Float32, "f")]
+)
+def test_mem_md_array_statistics_several_chunks(num_threads, datatype, fmt):
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 50)
+    dim1 = rg.CreateDimension("dim1", None, None, 40)
+    ar = rg.CreateMDArray(
+        "myarray", [dim0, dim1], gdal.ExtendedDataType.Create(datatype)
+    )
+    values = [(i * 7) % 101 - 30 for i in range(50 * 40)]
+    if datatype == gdal.GDT_Float32:
+        values[10] = float("nan")
+    ar.Write(struct.pack(fmt * len(values), *values))
+
+    valid_values = [v for v in values if v == v]
+    mean = sum(valid_values) / len(valid_values)
+    std_dev = (sum((v - mean) ** 2 for v in valid_values) / len(valid_values)) ** 0.5
+
+    with gdal.config_options(
+        {"GDAL_SWATH_SIZE": "400", "GDAL_NUM_THREADS": num_threads}
+    ):
+        stats = ar.ComputeStatistics(False)
+    assert stats.min == min(valid_values)
+    assert stats.max == max(valid_values)
+    assert stats.mean == pytest.approx(mean, rel=1e-12)
+    assert stats.std_dev == pytest.approx(std_dev, rel=1e-12)
+    assert stats.valid_count == len(valid_values)
+
+
 def test_mem_md_array_copy_autoscale():
 
     drv = gdal.GetDriverByName("MEM")
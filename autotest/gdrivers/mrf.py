@@ -660,6 +660,43 @@ def test_mrf_setspatialref():
     gdal.GetDriverByName("MRF").Delete(filename)
 
 
+@pytest.mark.parametrize("compress", ["DEFLATE", "LERC", "QB3"])
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_mrf_write_num_threads(tmp_vsimem, compress, interleave):
+
+    drv = gdal.GetDriverByName("MRF")
+    if compress not in drv.GetMetadataItem("DMD_CREATIONOPTIONLIST"):
+        pytest.skip(f"{compress} compression not available")
+
+    src_ds = gdal.Open("data/small_world.tif")
+    co = ["COMPRESS=" + compress, "INTERLEAVE=" + interleave, "BLOCKSIZE=64"]
+    ref_filename = str(tmp_vsimem / "ref.mrf")
+    ref_ds = drv.CreateCopy(ref_filename, src_ds, options=co)
+    ref_ds.BuildOverviews("AVERAGE", [2, 4])
+    ref_ds = None
+
+    filename = str(tmp_vsimem / "out.mrf")
+    ds = drv.CreateCopy(filename, src_ds, options=co + ["NUM_THREADS=4"])
+    ds.BuildOverviews("AVERAGE", [2, 4])
+    ds = None
+
+    ref_ds = gdal.Open(ref_filename)
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+    for i in range(2):
+        assert (
+            ds.GetRasterBand(1).GetOverview(i).ReadRaster()
+            == ref_ds.GetRasterBand(1).GetOverview(i).ReadRaster()
+        )
+
+    # Update mode, with the open option
+    ds = gdal.OpenEx(filename, gdal.OF_UPDATE, open_options=["NUM_THREADS=4"])
+    ds.WriteRaster(0, 0, 400, 200, src_ds.ReadRaster(0, 0, 400, 200))
+    ds = None
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
 def test_mrf_cleanup():
 
     files = (
@@ -6744,3 +6744,70 @@ def test_netcdf_LIST_ALL_ARRAYS():
             ('NETCDF:"data/netcdf/byte.nc":Band1', "[20x20] Band1 (8-bit integer)"),
         ]
     )
+
+
+###############################################################################
+# Test that reading classic files without the netCDF library (default) gives
+# the same result as through it
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/netcdf/byte.nc",
+        "data/netcdf/trmm.nc",
+        "data/netcdf/netcdf-4d.nc",
+        "data/netcdf/foo_5dimensional.nc",
+        "NC2",
+    ],
+)
+def test_netcdf_direct_read_classic(tmp_path, filename):
+
+    if filename == "NC2":
+        filename = str(tmp_path / "test_nc2.nc")
+        gdal.Translate(
+            filename,
+            "../gcore/data/uint16.tif",
+            format="netCDF",
+            creationOptions=["FORMAT=NC2"],
+        )
+
+    def get_checksums():
+        ds = gdal.Open(filename)
+        return [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+        ], ds.ReadRaster()
+
+    with gdal.config_option("GDAL_NETCDF_DIRECT_READ", "NO"):
+        expected = get_checksums()
+    assert get_checksums() == expected
+
+
+###############################################################################
+# Test reading several classic files concurrently
+
+
+def test_netcdf_direct_read_classic_multithreaded(tmp_path):
+
+    import threading
+
+    filenames = []
+    for i in range(4):
+        filename = str(tmp_path / f"test{i}.nc")
+        gdal.Translate(filename, "../gcore/data/byte.tif", format="netCDF")
+        filenames.append(filename)
+
+    errors = []
+
+    def worker(filename):
+        for _ in range(10):
+            ds = gdal.Open(filename)
+            if ds.GetRasterBand(1).Checksum() != 4672:
+                errors.append(filename)
+
+    threads = [threading.Thread(target=worker, args=(f,)) for f in filenames]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert not errors
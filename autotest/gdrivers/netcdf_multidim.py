@@ -4183,3 +4183,70 @@ def test_netcdf_multidim_WGS84_and_EGM96_height(tmp_path):
         srs = ar.GetSpatialRef()
         assert srs.GetAuthorityCode(None) == "9707"
         assert srs.GetDataAxisToSRSAxisMapping() == [1, 2]
+
+
+###############################################################################
+# Test reading through the multidimensional chunk cache
+
+
+def test_netcdf_multidim_chunk_cache(tmp_path):
+
+    tmp_filename = str(tmp_path / "out.nc")
+    with gdal.GetDriverByName("netCDF").CreateMultiDimensional(
+        tmp_filename, options=["FORMAT=NC4"]
+    ) as ds:
+        rg = ds.GetRootGroup()
+        dim_t = rg.CreateDimension("time", None, None, 21)
+        dim_y = rg.CreateDimension("y", None, None, 5)
+        dim_x = rg.CreateDimension("x", None, None, 7)
+        var = rg.CreateMDArray(
+            "var",
+            [dim_t, dim_y, dim_x],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["BLOCKSIZE=2,2,3"],
+        )
+        assert (
+            var.Write(array.array("H", [i for i in range(21 * 5 * 7)]))
+            == gdal.CE_None
+        )
+
+    def read_all(ar):
+        dt_float64 = gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+        return [
+            ar.Read(),
+            # Time series at one location
+            ar.Read(array_start_idx=[0, 3, 4], count=[21, 1, 1]),
+            ar.Read(array_start_idx=[0, 3, 5], count=[21, 1, 1]),
+            # Strided read, with data type conversion
+            ar.Read(
+                array_start_idx=[1, 0, 1],
+                count=[7, 3, 2],
+                array_step=[3, 2, 4],
+                buffer_datatype=dt_float64,
+            ),
+            # Transposed buffer
+            ar.Read(
+                array_start_idx=[2, 1, 2],
+                count=[3, 2, 4],
+                buffer_stride=[1, 3 * 4, 3],
+            ),
+            # Negative steps are not handled by the cache
+            ar.Read(
+                array_start_idx=[20, 4, 6], count=[3, 2, 2], array_step=[-5, -1, -2]
+            ),
+        ]
+
+    with gdal.config_option("GDAL_MDARRAY_CHUNK_CACHE", "NO"):
+        with gdal.OpenEx(tmp_filename, gdal.OF_MULTIDIM_RASTER) as ds:
+            expected = read_all(ds.GetRootGroup().OpenMDArray("var"))
+
+    with gdal.OpenEx(tmp_filename, gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("var")
+        assert ar.GetBlockSize() == [2, 2, 3]
+        assert read_all(ar) == expected
+        # Second time from the cache
+        assert read_all(ar) == expected
+
+    with gdal.config_option("GDAL_MDARRAY_CHUNK_CACHE_PREFETCH", "0"):
+        with gdal.OpenEx(tmp_filename, gdal.OF_MULTIDIM_RASTER) as ds:
+            assert read_all(ds.GetRootGroup().OpenMDArray("var")) == expected
@@ -481,3 +481,31 @@ def test_png_read_interlace_16_bit():
 
     ds = gdal.Open("data/png/uint16_interlaced.png")
     assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test FILTER creation option
+
+
+@pytest.mark.parametrize(
+    "filter", ["DEFAULT", "NONE", "SUB", "UP", "AVERAGE", "PAETH", "FAST", "ALL"]
+)
+def test_png_create_filter(tmp_vsimem, filter):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "out.png")
+    gdal.GetDriverByName("PNG").CreateCopy(
+        filename, src_ds, options=["FILTER=" + filter]
+    )
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+
+
+def test_png_create_filter_invalid(tmp_vsimem):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "out.png")
+    with pytest.raises(Exception, match="Illegal FILTER value"):
+        gdal.GetDriverByName("PNG").CreateCopy(
+            filename, src_ds, options=["FILTER=invalid"]
+        )
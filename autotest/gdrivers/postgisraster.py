@@ -648,6 +648,124 @@ def test_postgisraster_test_outdb_client_side_if_possible():
     assert cs == [30111, 32302, 40026]
 
 
+###############################################################################
+# Test that multi-threaded decoding of tiles gives the same result as
+# sequential decoding
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+@pytest.mark.parametrize("force_ireadblock", [False, True])
+def test_postgisraster_test_num_threads(num_threads, force_ireadblock):
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(
+            gdaltest.postgisraster_connection_string
+            + "table='small_world_constraint' mode=2"
+        )
+        if force_ireadblock:
+            with gdaltest.SetCacheMax(0):
+                cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+        else:
+            cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+    assert cs == [30111, 32302, 40026]
+
+
+###############################################################################
+# Test binary (server side out-db resolution) and hex-encoded (client side)
+# transfer of multi-byte tiles, with and without threads
+
+
+@pytest.fixture(scope="module")
+def int16_tiles_table():
+
+    ds = ogr.Open(gdaltest.postgisraster_connection_string_without_schema, update=1)
+    ds.ExecuteSQL("DROP TABLE IF EXISTS gis_schema.int16_tiles")
+    # 2x2 tiles of 10x10 pixels, whose values do not fit on one byte
+    ds.ExecuteSQL(
+        "CREATE TABLE gis_schema.int16_tiles AS SELECT x * 2 + y + 1 AS rid, "
+        "ST_AddBand(ST_MakeEmptyRaster(10, 10, x * 10, -y * 10, 1, -1, 0, 0, "
+        "26711), '16BSI'::text, 1000 * (x * 2 + y + 1) - 3000, NULL) AS rast "
+        "FROM generate_series(0, 1) AS x, generate_series(0, 1) AS y"
+    )
+    ds.ExecuteSQL("ALTER TABLE gis_schema.int16_tiles ADD PRIMARY KEY (rid)")
+    ds = None
+
+    yield "int16_tiles"
+
+    ds = ogr.Open(gdaltest.postgisraster_connection_string_without_schema, update=1)
+    ds.ExecuteSQL("DROP TABLE IF EXISTS gis_schema.int16_tiles")
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("outdb_resolution", ["server_side", "client_side"])
+@pytest.mark.parametrize("force_ireadblock", [False, True])
+def test_postgisraster_test_int16_tiles(
+    int16_tiles_table, num_threads, outdb_resolution, force_ireadblock
+):
+
+    import struct
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(
+            gdaltest.postgisraster_connection_string
+            + f"table='{int16_tiles_table}' mode=2 "
+            + f"outdb_resolution={outdb_resolution}"
+        )
+        assert ds
+        assert (ds.RasterXSize, ds.RasterYSize) == (20, 20)
+        band = ds.GetRasterBand(1)
+        assert band.DataType == gdal.GDT_Int16
+        if force_ireadblock:
+            with gdaltest.SetCacheMax(0):
+                data = band.ReadRaster()
+        else:
+            data = band.ReadRaster()
+
+    got = struct.unpack("h" * 400, data)
+    expected = [
+        1000 * ((i % 20) // 10 * 2 + (i // 20) // 10 + 1) - 3000 for i in range(400)
+    ]
+    assert list(got) == expected
+
+
+###############################################################################
+# Test that errors raised while decoding tiles in worker threads are reported
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_postgisraster_test_outdb_missing_file(num_threads):
+
+    ds = ogr.Open(gdaltest.postgisraster_connection_string_without_schema, update=1)
+    ds.ExecuteSQL("DROP TABLE IF EXISTS gis_schema.small_world_outdb_missing")
+    gdal.ErrorReset()
+    with gdal.quiet_errors():
+        ds.ExecuteSQL(
+            "CREATE TABLE gis_schema.small_world_outdb_missing AS SELECT rid, "
+            "ST_SetBandPath(rast, 1, '/i_do/not/exist.tif', 1, true) AS rast "
+            "FROM gis_schema.small_world_outdb_constraint"
+        )
+    if gdal.GetLastErrorMsg() != "":
+        ds = None
+        pytest.skip("ST_SetBandPath() not available")
+
+    try:
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            rds = gdal.Open(
+                gdaltest.postgisraster_connection_string
+                + "table='small_world_outdb_missing' mode=2 "
+                + "outdb_resolution=client_side"
+            )
+            assert rds
+            gdal.ErrorReset()
+            with gdal.quiet_errors():
+                rds.GetRasterBand(1).Checksum()
+            assert "/i_do/not/exist.tif" in gdal.GetLastErrorMsg()
+            rds = None
+    finally:
+        ds.ExecuteSQL("DROP TABLE IF EXISTS gis_schema.small_world_outdb_missing")
+        ds = None
+
+
 ###############################################################################
 # Test gdal subdataset informational functions
 
@@ -305,6 +305,61 @@ def test_stacit_post_paging(tmp_vsimem, webserver_port):
     )
 
 
+###############################################################################
+# Test CACHE_DIRECTORY open option
+
+
+@pytest.mark.require_curl
+def test_stacit_cache_directory(tmp_vsimem, webserver_port):
+
+    doc = {
+        "type": "FeatureCollection",
+        "stac_version": "1.0.0-beta.2",
+        "stac_extensions": [],
+        "features": json.loads(open("data/stacit/test.json", "rb").read())["features"],
+    }
+
+    url = f"http://localhost:{webserver_port}/search"
+    open_options = ["CACHE_DIRECTORY=" + str(tmp_vsimem / "cache")]
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET", "/search", 200, {"Content-type": "application/json"}, json.dumps(doc)
+    )
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            url, allowed_drivers=["STACIT"], open_options=open_options
+        )
+    assert ds is not None
+    assert ds.RasterXSize == 40
+    cache_files = gdal.ReadDir(str(tmp_vsimem / "cache"))
+    assert len(cache_files) == 1
+    assert cache_files[0].startswith("stacit_")
+
+    # The API is not queried again
+    with webserver.install_http_handler(webserver.SequentialHandler()):
+        ds = gdal.OpenEx(
+            url, allowed_drivers=["STACIT"], open_options=open_options
+        )
+    assert ds is not None
+    assert ds.RasterXSize == 40
+    assert ds.GetRasterBand(1).DataType == gdal.GDT_Byte
+    assert ds.GetRasterBand(1).Checksum() == 9239
+
+    # Expired cache
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET", "/search", 200, {"Content-type": "application/json"}, json.dumps(doc)
+    )
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            url,
+            allowed_drivers=["STACIT"],
+            open_options=open_options + ["CACHE_MAX_AGE=0"],
+        )
+    assert ds is not None
+
+
 ###############################################################################
 # Test force opening a STACIT file
 
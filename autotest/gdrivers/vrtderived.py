@@ -1264,6 +1264,63 @@ def test_vrt_pixelfn_expression_invalid(
     assert exception in "".join(messages)
 
 
+###############################################################################
+# Test that expressions compiled into vectorized operations give the same
+# results as muparser
+
+
+@pytest.mark.parametrize(
+    "expression",
+    [
+        "(B1 - B2) / (B1 + B2)",
+        "B1 > 50 ? B1 * 2 : -B2^2 + B3",
+        "B1 / sum(BANDS) + avg(B1, B3)",
+        "min(B1, B2, B3) + max(BANDS) - 2^-1",
+        "sqrt(abs(B1 - B3)) * sign(B2 - 50) + sin(B1) * _pi",
+        "(B1 >= 10 && B2 != 3) || B3 == 7",
+        "B3 ? B1 : B2",
+        "1e2 + .5 * B1",
+    ],
+)
+def test_vrt_pixelfn_expression_vectorized(tmp_vsimem, expression):
+    np = pytest.importorskip("numpy")
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("Expression dialect muparser is not available")
+
+    drv = gdal.GetDriverByName("GTiff")
+    nx, ny = 300, 20
+    sources = ""
+    for i in range(3):
+        src_fname = tmp_vsimem / f"source_{i}.tif"
+        ar = (np.arange(nx * ny, dtype=np.float64).reshape((ny, nx)) * (i + 1)) % 101
+        ar[0][i] = float("nan")
+        with drv.Create(src_fname, nx, ny, 1, gdal.GDT_Float64) as ds:
+            ds.GetRasterBand(1).WriteArray(ar)
+        sources += f"""<SimpleSource>
+                     <SourceFilename relativeToVRT="0">{src_fname}</SourceFilename>
+                     <SourceBand>1</SourceBand>
+                   </SimpleSource>"""
+
+    xml_expression = expression.replace("&", "&amp;").replace("<", "&lt;")
+    xml_expression = xml_expression.replace(">", "&gt;")
+    xml = f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+              <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+                 <PixelFunctionType>expression</PixelFunctionType>
+                 <PixelFunctionArguments expression="{xml_expression}" dialect="muparser" />
+                 {sources}
+              </VRTRasterBand>
+            </VRTDataset>"""
+
+    with gdal.Open(xml) as ds:
+        with gdal.config_option("VRT_VECTORIZED_EXPRESSION", "NO"):
+            expected = ds.ReadAsArray()
+    with gdal.Open(xml) as ds:
+        got = ds.ReadAsArray()
+
+    np.testing.assert_allclose(got, expected, rtol=1e-14)
+
+
 ###############################################################################
 # Cleanup.
 
@@ -2433,3 +2433,75 @@ def test_vrtpansharpen_slightly_different_extent(tmp_vsimem):
         for i in range(vrt_ds.RasterCount)
     ]
     assert mm == [(20.0, 20.0), (40.0, 40.0)]
+
+
+###############################################################################
+# Test the Float64 code path (vectorized when possible) against a reference
+# computation, with a negative weight and a number of pixels not multiple of 4
+
+
+@pytest.mark.parametrize("out_dt", [gdal.GDT_Float32, gdal.GDT_Float64])
+def test_vrtpansharpen_float64_reference(tmp_vsimem, out_dt):
+
+    pytest.importorskip("osgeo.gdal_array")
+    np = pytest.importorskip("numpy")
+
+    ms_ar = np.array(
+        [
+            [[10.5, 20, 0, 40, 50.25], [1, 2, 3, 4, 5]],
+            [[5, 7.5, 0, 11, 13], [6, 7, 8, 9, 10]],
+            [[1, 100, 0, 1000, 3], [11, 12, 13, 14, 15]],
+        ]
+    )
+    pan_ar = np.arange(1, 41, dtype=np.float64).reshape(4, 10) * 1.5
+
+    ds = gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "pan.tif", 10, 4, 1, gdal.GDT_Float64
+    )
+    ds.SetGeoTransform([0, 0.5, 0, 0, 0, -0.5])
+    ds.GetRasterBand(1).WriteArray(pan_ar)
+    ds = None
+    ds = gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "ms.tif", 5, 2, 3, gdal.GDT_Float64
+    )
+    ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    for i in range(3):
+        ds.GetRasterBand(i + 1).WriteArray(ms_ar[i])
+    ds = None
+
+    weights = [0.5, -0.1, 0.6]
+    vrt_ds = gdal.Open(f"""<VRTDataset subClass="VRTPansharpenedDataset">
+        <PansharpeningOptions>
+            <AlgorithmOptions><Weights>{",".join(str(w) for w in weights)}</Weights></AlgorithmOptions>
+            <Resampling>Nearest</Resampling>
+            <PanchroBand>
+                    <SourceFilename>{tmp_vsimem / "pan.tif"}</SourceFilename>
+                    <SourceBand>1</SourceBand>
+            </PanchroBand>
+            <SpectralBand dstBand="1">
+                    <SourceFilename>{tmp_vsimem / "ms.tif"}</SourceFilename>
+                    <SourceBand>1</SourceBand>
+            </SpectralBand>
+            <SpectralBand dstBand="2">
+                    <SourceFilename>{tmp_vsimem / "ms.tif"}</SourceFilename>
+                    <SourceBand>2</SourceBand>
+            </SpectralBand>
+            <SpectralBand>
+                    <SourceFilename>{tmp_vsimem / "ms.tif"}</SourceFilename>
+                    <SourceBand>3</SourceBand>
+            </SpectralBand>
+        </PansharpeningOptions>
+    </VRTDataset>""")
+
+    upsampled = ms_ar.repeat(2, axis=1).repeat(2, axis=2)
+    pseudo_panchro = np.zeros(pan_ar.shape)
+    for i in range(3):
+        pseudo_panchro += weights[i] * upsampled[i]
+    with np.errstate(divide="ignore", invalid="ignore"):
+        factor = np.where(pseudo_panchro != 0, pan_ar / pseudo_panchro, 0)
+
+    got = vrt_ds.ReadAsArray(buf_type=out_dt)
+    assert got.shape == (2, 4, 10)
+    rtol = 1e-6 if out_dt == gdal.GDT_Float32 else 1e-12
+    for i in range(2):
+        np.testing.assert_allclose(got[i], upsampled[i] * factor, rtol=rtol)
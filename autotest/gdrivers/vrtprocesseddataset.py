@@ -1934,3 +1934,150 @@ def test_vrtprocesseddataset_scaled_inputs(tmp_vsimem, input_scaled, dtype, unsc
 
     np.testing.assert_array_equal(result.mask, expected.mask)
     np.testing.assert_array_equal(result[~result.mask], expected[~expected.mask])
+
+
+###############################################################################
+# Test VRT_PROCESSED_DATASET_CACHE_SIZE
+
+
+def test_vrtprocesseddataset_result_cache(tmp_vsimem):
+
+    src_filename = tmp_vsimem / "src.tif"
+    src_ds = gdal.GetDriverByName("GTiff").Create(src_filename, 10, 5, 2)
+    src_ds.GetRasterBand(1).WriteArray(
+        np.arange(50, dtype=np.uint8).reshape(5, 10)
+    )
+    src_ds.GetRasterBand(2).Fill(3)
+    src_ds.Close()
+
+    # Inline VRT whose source is lazily opened, so that we can check that
+    # a cache hit does not need to access it.
+    xml = f"""
+    <VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <VRTDataset rasterXSize="10" rasterYSize="5">
+          <VRTRasterBand dataType="Byte" band="1">
+            <SimpleSource>
+              <SourceFilename>{src_filename}</SourceFilename>
+              <SourceBand>1</SourceBand>
+              <SourceProperties RasterXSize="10" RasterYSize="5" DataType="Byte" BlockXSize="10" BlockYSize="1" />
+            </SimpleSource>
+          </VRTRasterBand>
+          <VRTRasterBand dataType="Byte" band="2">
+            <SimpleSource>
+              <SourceFilename>{src_filename}</SourceFilename>
+              <SourceBand>2</SourceBand>
+              <SourceProperties RasterXSize="10" RasterYSize="5" DataType="Byte" BlockXSize="10" BlockYSize="1" />
+            </SimpleSource>
+          </VRTRasterBand>
+        </VRTDataset>
+    </Input>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">1,2,3</Argument>
+            <Argument name="coefficients_2">0,0,1</Argument>
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>"""
+
+    expected = np.arange(50, dtype=np.float64).reshape(5, 10) * 2 + 1 + 9
+
+    with gdal.config_option("VRT_PROCESSED_DATASET_CACHE_SIZE", "10MB"):
+        with gdal.Open(xml) as ds:
+            np.testing.assert_equal(ds.GetRasterBand(1).ReadAsArray(), expected)
+
+        gdal.Unlink(src_filename)
+
+        # Served from the cache
+        with gdal.Open(xml) as ds:
+            np.testing.assert_equal(ds.GetRasterBand(1).ReadAsArray(), expected)
+            np.testing.assert_equal(ds.GetRasterBand(2).ReadAsArray(), 3)
+
+    # Cache disabled: the missing source is noticed
+    with gdal.Open(xml) as ds:
+        with pytest.raises(Exception):
+            ds.GetRasterBand(1).ReadAsArray()
+
+
+###############################################################################
+# Test Hillshade and Slope algorithms against gdaldem, with blocks smaller
+# than the raster so that neighbouring pixels come from the halo
+
+
+@pytest.mark.parametrize("compute_edges", [False, True])
+@pytest.mark.parametrize(
+    "algorithm,args,gdaldem_options",
+    [
+        ("Hillshade", {}, {}),
+        (
+            "Hillshade",
+            {"z_factor": 2, "azimuth": 45, "alg": "ZevenbergenThorne"},
+            {"zFactor": 2, "azimuth": 45, "alg": "ZevenbergenThorne"},
+        ),
+        ("Hillshade", {"variant": "combined"}, {"combined": True}),
+        ("Hillshade", {"variant": "multidirectional"}, {"multiDirectional": True}),
+        ("Slope", {}, {}),
+        ("Slope", {"slope_format": "percent"}, {"slopeFormat": "percent"}),
+    ],
+)
+def test_vrtprocesseddataset_dem(
+    tmp_vsimem, algorithm, args, gdaldem_options, compute_edges
+):
+
+    src_filename = str(tmp_vsimem / "dem.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename, 23, 17, 1, gdal.GDT_Int16
+    )
+    src_ds.SetGeoTransform([0, 10, 0, 0, 0, -10])
+    yy, xx = np.mgrid[0:17, 0:23]
+    dem = (100 * np.sin(xx / 4.0) * np.cos(yy / 3.0) + 2 * xx * yy).astype(np.int16)
+    dem[8, 10] = -32768
+    src_ds.GetRasterBand(1).WriteArray(dem)
+    src_ds.GetRasterBand(1).SetNoDataValue(-32768)
+    src_ds.Close()
+
+    dem_ds = gdal.DEMProcessing(
+        "",
+        src_filename,
+        algorithm.lower(),
+        format="MEM",
+        computeEdges=compute_edges,
+        **gdaldem_options,
+    )
+    expected = dem_ds.GetRasterBand(1).ReadAsArray()
+    dt = "Byte" if algorithm == "Hillshade" else "Float32"
+
+    arguments = "".join(f'<Argument name="{k}">{v}</Argument>' for k, v in args.items())
+    if compute_edges:
+        arguments += '<Argument name="compute_edges">true</Argument>'
+    ds = gdal.Open(
+        f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <BlockXSize>5</BlockXSize>
+    <BlockYSize>4</BlockYSize>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <OutputBands count="FROM_LAST_STEP" dataType="{dt}"/>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>{algorithm}</Algorithm>
+            {arguments}
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>
+        """
+    )
+    got = ds.GetRasterBand(1).ReadAsArray()
+    if algorithm == "Hillshade":
+        # gdaldem uses an approximate reciprocal square root
+        diff = got.astype(np.int32) - expected.astype(np.int32)
+        assert np.max(np.abs(diff)) <= 1
+    else:
+        np.testing.assert_allclose(got, expected, atol=1e-3)
+
+    # Reading the whole raster at once gives the same result
+    ds.FlushCache()
+    got_whole = ds.ReadRaster(buf_type=gdal.GDT_Float64)
+    got_whole = np.frombuffer(got_whole, dtype=np.float64).reshape(17, 23)
+    np.testing.assert_allclose(got_whole, got, atol=1e-3 if dt == "Float32" else 0.5)
@@ -744,6 +744,36 @@ def test_vrtwarp_irasterio_optim_window_splitting():
     assert warped_vrt_ds.ReadRaster() == expected_data
 
 
+###############################################################################
+# Test VRTWarpedDataset::IRasterIO() code path with GDAL_VRT_WARP_NUM_THREADS
+
+
+@pytest.mark.parametrize("dstAlpha", [False, True])
+def test_vrtwarp_irasterio_optim_multi_threaded(dstAlpha):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=1000, height=1000
+    )
+    warped_vrt_ds = gdal.Warp(
+        "", src_ds, format="VRT", dstSRS="EPSG:3857", dstAlpha=dstAlpha
+    )
+
+    with gdaltest.config_option("GDAL_VRT_WARP_USE_DATASET_RASTERIO", "NO"):
+        expected_data = warped_vrt_ds.ReadRaster()
+        expected_data_window = warped_vrt_ds.ReadRaster(
+            100, 150, 600, 500, band_list=[3, 1], buf_type=gdal.GDT_UInt16
+        )
+
+    with gdaltest.config_option("GDAL_VRT_WARP_NUM_THREADS", "4"):
+        assert warped_vrt_ds.ReadRaster() == expected_data
+        assert (
+            warped_vrt_ds.ReadRaster(
+                100, 150, 600, 500, band_list=[3, 1], buf_type=gdal.GDT_UInt16
+            )
+            == expected_data_window
+        )
+
+
 ###############################################################################
 # Test gdal.AutoCreateWarpedVRT() on a Int16 band with nodata = 32767
 
@@ -1187,3 +1187,71 @@ def test_wms_force_opening_url(tmp_vsimem, webserver_port):
     )
     with webserver.install_http_handler(handler):
         gdal.OpenEx(f"http://localhost:{webserver_port}", allowed_drivers=["WMS"])
+
+
+###############################################################################
+# Test TMS with the sqlite cache type, parallel decoding and tile prefetching
+
+
+@pytest.mark.require_curl
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_wms_sqlite_cache(tmp_path, num_threads):
+
+    import sqlite3
+
+    for x in range(2):
+        for y in range(2):
+            os.makedirs(tmp_path / "tiles" / "1" / str(x), exist_ok=True)
+            src_ds = gdal.GetDriverByName("MEM").Create("", 256, 256, 3)
+            src_ds.GetRasterBand(1).Fill(1 + x + 2 * y)
+            gdal.GetDriverByName("PNG").CreateCopy(
+                tmp_path / "tiles" / "1" / str(x) / f"{y}.png", src_ds
+            )
+
+    cache_dir = tmp_path / "cache"
+
+    def get_xml(extra=""):
+        return f"""<GDAL_WMS>
+    <Service name="TMS">
+        <ServerUrl>file://{tmp_path.as_posix()}/tiles/${{z}}/${{x}}/${{y}}.png</ServerUrl>
+    </Service>
+    <DataWindow>
+        <UpperLeftX>-20037508.34</UpperLeftX>
+        <UpperLeftY>20037508.34</UpperLeftY>
+        <LowerRightX>20037508.34</LowerRightX>
+        <LowerRightY>-20037508.34</LowerRightY>
+        <TileLevel>1</TileLevel>
+        <TileCountX>1</TileCountX>
+        <TileCountY>1</TileCountY>
+        <YOrigin>top</YOrigin>
+    </DataWindow>
+    <Projection>EPSG:3857</Projection>
+    <BlockSizeX>256</BlockSizeX>
+    <BlockSizeY>256</BlockSizeY>
+    <BandsCount>3</BandsCount>
+    <Cache><Path>{cache_dir}</Path><Type>sqlite</Type><Unique>false</Unique></Cache>
+    {extra}
+</GDAL_WMS>"""
+
+    def count_cached_tiles():
+        with sqlite3.connect(cache_dir / "cache.sqlite") as conn:
+            return conn.execute("SELECT COUNT(*) FROM tiles").fetchone()[0]
+
+    # Reading a single block fetches its neighbours
+    with gdal.Open(get_xml("<PrefetchTiles>1</PrefetchTiles>")) as ds:
+        assert ds.GetRasterBand(1).ReadBlock(0, 0)
+    assert count_cached_tiles() == 4
+
+    os.unlink(cache_dir / "cache.sqlite")
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        with gdal.Open(get_xml()) as ds:
+            data = ds.GetRasterBand(1).ReadRaster()
+            assert (data[0], data[511], data[-512], data[-1]) == (1, 2, 3, 4)
+    assert count_cached_tiles() == 4
+
+    # Tiles are now read from the cache
+    with gdal.Open(get_xml("<OfflineMode>true</OfflineMode>")) as ds:
+        data = ds.GetRasterBand(1).ReadRaster()
+        assert (data[0], data[511], data[-512], data[-1]) == (1, 2, 3, 4)
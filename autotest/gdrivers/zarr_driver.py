@@ -2373,6 +2373,81 @@ def test_zarr_create_array_endian_v3(options, expected_json, gdal_data_type):
         gdal.RmdirRecursive("/vsimem/test.zarr")
 
 
+@pytest.mark.parametrize("compress", ["NONE", "GZIP"])
+def test_zarr_create_array_sharding_v3(compress):
+
+    try:
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            "/vsimem/test.zarr", options=["FORMAT=ZARR_V3"]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 5)
+        dim1 = rg.CreateDimension("dim1", None, None, 7)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+            ["BLOCKSIZE=2,2", "SHARD_SIZE=4,4", "COMPRESS=" + compress],
+        )
+        assert ar.Write(array.array("B", [i for i in range(35)])) == gdal.CE_None
+        assert ar.GetStructuralInfo()["SHARD_SIZE"] == "4,4"
+
+        with gdal.quiet_errors():
+            assert (
+                rg.CreateMDArray(
+                    "invalid",
+                    [dim0, dim1],
+                    gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                    ["BLOCKSIZE=2,2", "SHARD_SIZE=3,4"],
+                )
+                is None
+            )
+        ds = None
+
+        f = gdal.VSIFOpenL("/vsimem/test.zarr/test/zarr.json", "rb")
+        j = json.loads(gdal.VSIFReadL(1, 10000, f))
+        gdal.VSIFCloseL(f)
+        assert j["chunk_grid"]["configuration"]["chunk_shape"] == [4, 4]
+        assert j["codecs"][0]["name"] == "sharding_indexed"
+        assert j["codecs"][0]["configuration"]["chunk_shape"] == [2, 2]
+
+        # One file per shard
+        assert gdal.VSIStatL("/vsimem/test.zarr/test/c/0/0") is not None
+        assert gdal.VSIStatL("/vsimem/test.zarr/test/c/1/1") is not None
+
+        ds = gdal.OpenEx("/vsimem/test.zarr", gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.GetBlockSize() == [2, 2]
+        assert ar.Read() == array.array("B", [i for i in range(35)])
+        assert ar.Read(array_start_idx=[3, 5], count=[2, 2]) == array.array(
+            "B", [26, 27, 33, 34]
+        )
+        assert ar.AdviseRead() == gdal.CE_None
+        assert ar.Read() == array.array("B", [i for i in range(35)])
+        ds = None
+
+        # Partial update of a shard
+        ds = gdal.OpenEx("/vsimem/test.zarr", gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert (
+            ar.Write(
+                array.array("B", [100, 101]), array_start_idx=[4, 0], count=[1, 2]
+            )
+            == gdal.CE_None
+        )
+        ds = None
+
+        ds = gdal.OpenEx("/vsimem/test.zarr", gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        expected = [i for i in range(35)]
+        expected[28] = 100
+        expected[29] = 101
+        assert ar.Read() == array.array("B", expected)
+
+    finally:
+        gdal.RmdirRecursive("/vsimem/test.zarr")
+
+
 @pytest.mark.parametrize(
     "j, error_msg",
     [
@@ -4226,6 +4301,56 @@ def test_zarr_advise_read(compression, format):
         gdal.RmdirRecursive(filename)
 
 
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize(
+    "format,options",
+    [
+        ("ZARR_V2", ["COMPRESS=GZIP"]),
+        ("ZARR_V2", ["CHUNK_MEMORY_LAYOUT=F"]),
+        ("ZARR_V3", ["COMPRESS=GZIP"]),
+        ("ZARR_V3", ["CHUNK_MEMORY_LAYOUT=F"]),
+    ],
+)
+def test_zarr_write_multithreaded(tmp_vsimem, num_threads, format, options):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    dim0_size = 100
+    dim1_size = 150
+    data = array.array("H", [i for i in range(dim0_size * dim1_size)])
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=" + format]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+        dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["BLOCKSIZE=10,20"] + options,
+        )
+        assert ar.Write(data) == gdal.CE_None
+
+        # Read back and update chunks that may still be being written
+        assert ar.Read() == data
+        assert (
+            ar.Write(array.array("H", [1, 2]), array_start_idx=[0, 0], count=[1, 2])
+            == gdal.CE_None
+        )
+        assert ar.Read(array_start_idx=[0, 0], count=[1, 3]) == array.array(
+            "H", [1, 2, 2]
+        )
+        ds = None
+
+    data[0] = 1
+    data[1] = 2
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == data
+
+
 def test_zarr_read_invalid_nczarr_dim():
 
     try:
@@ -5943,3 +6068,65 @@ def test_zarr_write_cleanup_create_dir_if_bad_blocksize_append_subdataset(
     assert os.path.exists(out_dirname)
     ds = gdal.Open(out_dirname)
     assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test reading a Kerchunk JSON reference file
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("version", [0, 1])
+def test_zarr_read_kerchunk_json_ref(tmp_path, version):
+
+    # Build a raw file with 8 bytes of garbage followed by two 10x20 uint8 chunks
+    data = bytes(range(200))
+    with open(tmp_path / "data.bin", "wb") as f:
+        f.write(b"\xff" * 8 + data)
+
+    zarray = {
+        "chunks": [10, 20],
+        "compressor": None,
+        "dtype": "|u1",
+        "fill_value": 0,
+        "filters": None,
+        "order": "C",
+        "shape": [20, 20],
+        "zarr_format": 2,
+    }
+    refs = {
+        ".zgroup": json.dumps({"zarr_format": 2}),
+        "ar/.zarray": zarray,
+        "ar/.zattrs": "base64:"
+        + base64.b64encode(
+            json.dumps({"_ARRAY_DIMENSIONS": ["y", "x"]}).encode()
+        ).decode(),
+        "ar/0.0": ["{{u}}", 8, 100],
+        "ar/1.0": ["data.bin", 108, 100],
+    }
+    if version == 1:
+        j = {"version": 1, "templates": {"u": "data.bin"}, "refs": refs}
+    else:
+        refs["ar/0.0"] = ["data.bin", 8, 100]
+        j = refs
+    with open(tmp_path / "refs.json", "w") as f:
+        json.dump(j, f)
+
+    ds = gdal.OpenEx(str(tmp_path / "refs.json"), gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("ar")
+    assert [dim.GetName() for dim in ar.GetDimensions()] == ["y", "x"]
+    assert ar.Read() == data
+
+    ds = gdal.Open(f'ZARR:"{tmp_path}/refs.json":/ar')
+    assert ds.GetRasterBand(1).ReadRaster() == data
+
+    base = f"/vsikerchunk_json_ref/{{{tmp_path}/refs.json}}"
+    assert set(gdal.ReadDir(base)) == {".zgroup", "ar"}
+    assert set(gdal.ReadDir(base + "/ar")) == {".zarray", ".zattrs", "0.0", "1.0"}
+    assert gdal.VSIStatL(base + "/ar/1.0").size == 100
+    assert gdal.VSIStatL(base + "/ar").IsDirectory()
+    assert gdal.VSIStatL(base + "/ar/2.0") is None
+
+    with pytest.raises(Exception):
+        gdal.OpenEx(
+            str(tmp_path / "refs.json"), gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE
+        )
@@ -186,6 +186,73 @@ def test_gnm_graph_connectedcomponents():
     dn = None
 
 
+###############################################################################
+# Contraction hierarchy shortest path
+
+
+def test_gnm_graph_contraction_hierarchy():
+
+    ds = gdal.OpenEx("tmp/test_gnm")
+    dn = gnm.CastToNetwork(ds)
+    assert dn is not None, "cast to GNMNetwork failed"
+
+    lyr = dn.GetPath(61, 50, gnm.GATDijkstraShortestPath)
+    assert lyr is not None, "failed to get path"
+    expected_count = lyr.GetFeatureCount()
+    dn.ReleaseResultSet(lyr)
+    assert expected_count > 0
+
+    # All edges have the same cost, so paths of the same cost have the same
+    # number of features, even if they differ.
+    lyr = dn.GetPath(61, 50, gnm.GATContractionHierarchyShortestPath)
+    assert lyr is not None, "failed to get path"
+    assert lyr.GetFeatureCount() == expected_count
+    dn.ReleaseResultSet(lyr)
+
+    # Path in reverse direction, reusing the contraction hierarchy
+    lyr = dn.GetPath(50, 61, gnm.GATContractionHierarchyShortestPath)
+    assert lyr is not None, "failed to get path"
+    assert lyr.GetFeatureCount() > 0
+    dn.ReleaseResultSet(lyr)
+
+    dn = None
+
+
+###############################################################################
+# Many-to-many shortest path costs
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_gnm_graph_matrix(num_threads):
+
+    ds = gdal.OpenEx("tmp/test_gnm")
+    dn = gnm.CastToNetwork(ds)
+    assert dn is not None, "cast to GNMNetwork failed"
+
+    lyr = dn.GetPath(
+        -1,
+        -1,
+        gnm.GATShortestPathMatrix,
+        options=[
+            "source=61",
+            "source=50",
+            "target=50",
+            "target=61",
+            "num_threads=" + num_threads,
+        ],
+    )
+    assert lyr is not None, "failed to get matrix"
+    costs = {(f["source"], f["target"]): f["cost"] for f in lyr}
+    dn.ReleaseResultSet(lyr)
+
+    assert costs[(61, 61)] == 0
+    assert costs[(50, 50)] == 0
+    assert costs[(61, 50)] > 0
+    assert costs[(50, 61)] > 0
+
+    dn = None
+
+
 ###############################################################################
 # Network deleting
 
@@ -922,3 +922,47 @@ def test_ogr_arrow_check_geoarrow_types(
 
     schema = pyarrow.feather.read_table(filename).schema
     assert str(schema.field("geometry").type) == expected_arrow_type
+
+
+###############################################################################
+# Test skipping of record batches with the spatial filter, and memory mapping
+
+
+@pytest.mark.parametrize("memory_map", ["YES", "NO"])
+def test_ogr_arrow_spatial_filter_skip_batches(tmp_path, memory_map):
+
+    filename = str(tmp_path / "out.feather")
+    with ogr.GetDriverByName("ARROW").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer(
+            "test",
+            geom_type=ogr.wkbPoint,
+            options=["BATCH_SIZE=2", "COMPRESSION=NONE", "FID=fid"],
+        )
+        for i in range(10):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+            lyr.CreateFeature(f)
+
+    with gdaltest.config_option("OGR_ARROW_MEMORY_MAP", memory_map):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert lyr.GetFeatureCount() == 10
+
+            lyr.SetSpatialFilterRect(4.5, 4.5, 7.5, 7.5)
+            assert [f.GetFID() for f in lyr] == [5, 6, 7]
+
+            lyr.SetSpatialFilterRect(100, 100, 200, 200)
+            assert [f.GetFID() for f in lyr] == []
+
+            lyr.SetSpatialFilterRect(-1, -1, 0.5, 0.5)
+            assert [f.GetFID() for f in lyr] == [0]
+
+            lyr.SetSpatialFilter(None)
+            stream = lyr.GetArrowStream()
+            num_rows = 0
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                num_rows += array.GetLength()
+            assert num_rows == 10
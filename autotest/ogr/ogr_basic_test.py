@@ -26,6 +26,7 @@
 # Boston, MA 02111-1307, USA.
 ###############################################################################
 
+import json
 import math
 import os
 import struct
@@ -1237,3 +1238,53 @@ def test_driver_open_throw_2():
 
         with pytest.raises(RuntimeError, match="not recognized"):
             drv.Open("data/poly.shp")
+
+
+###############################################################################
+# Test OGRProfilingStatsGetAsSerializedJSON() and OGRProfilingStatsGetAsText()
+
+
+def test_ogr_profiling_stats():
+
+    ogr.ProfilingStatsReset()
+    try:
+        with gdal.config_option("OGR_PROFILING_STATS_ENABLED", "YES"):
+            ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+            lyr = ds.CreateLayer("test_profiling")
+            lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+            for i in range(3):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["id"] = i
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i})"))
+                lyr.CreateFeature(f)
+
+            lyr.SetAttributeFilter("id >= 1")
+            lyr.SetSpatialFilterRect(1.5, 1.5, 2.5, 2.5)
+            assert [f["id"] for f in lyr] == [2]
+
+            j = json.loads(ogr.ProfilingStatsGetAsSerializedJSON())
+            assert len(j["layers"]) == 1
+            assert j["layers"][0]["name"] == "test_profiling"
+            stages = j["layers"][0]["stages"]
+            assert stages["write"]["calls"] == 3
+            assert stages["write"]["features"] == 3
+            assert stages["write"]["bytes"] == 3 * 21
+            assert stages["read"]["calls"] == 2
+            assert stages["read"]["features"] == 1
+            assert stages["read"]["bytes"] == 21
+            assert stages["spatial_filter"]["calls"] == 3
+            assert stages["attribute_filter"]["calls"] == 1
+            assert "read_arrow" not in stages
+
+            text = ogr.ProfilingStatsGetAsText()
+            assert "Layer 'test_profiling':" in text
+            assert "write" in text
+
+            # Statistics are kept after the layer is destroyed
+            ds = None
+            j = json.loads(ogr.ProfilingStatsGetAsSerializedJSON())
+            assert j["layers"][0]["stages"]["write"]["calls"] == 3
+    finally:
+        ogr.ProfilingStatsReset()
+
+    assert json.loads(ogr.ProfilingStatsGetAsSerializedJSON()) == {"layers": []}
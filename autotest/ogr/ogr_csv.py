@@ -3498,6 +3498,142 @@ def test_ogr_csv_unbalanced_double_quotes():
             lyr.GetNextFeature()
 
 
+###############################################################################
+# Test multi-threaded reading
+
+
+@pytest.mark.parametrize("with_attribute_filter", [False, True])
+def test_ogr_csv_read_multithreaded(tmp_vsimem, with_attribute_filter):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id,real,str,WKT\n"
+    for i in range(2500):
+        content += '%d,%s,"foo,\n""%d""",%s\n' % (
+            i,
+            "" if (i % 7) == 0 else "%.3f" % (i / 3),
+            i,
+            "" if (i % 5) == 0 else "POINT (%d %d)" % (i, i),
+        )
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_features(num_threads):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            with gdal.OpenEx(
+                filename, gdal.OF_VECTOR, open_options=["AUTODETECT_TYPE=YES"]
+            ) as ds:
+                lyr = ds.GetLayer(0)
+                if with_attribute_filter:
+                    lyr.SetAttributeFilter("real > 500")
+                ret = [f.DumpReadableAsString() for f in lyr]
+                lyr.ResetReading()
+                assert [f.DumpReadableAsString() for f in lyr] == ret
+                f = lyr.GetFeature(1234)
+                assert f["id"] == 1233
+                assert f["str"] == 'foo,\n"1233"'
+                return ret
+
+    ref = get_features("1")
+    assert len(ref) == (856 if with_attribute_filter else 2500)
+    assert get_features("4") == ref
+
+
+###############################################################################
+# Test that the warning about invalid values is emitted once with several
+# threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_csv_read_multithreaded_warning_once(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id\n" + "".join("invalid%d\n" % i for i in range(2500))
+    gdal.FileFromMemBuffer(filename, content)
+    gdal.FileFromMemBuffer(filename[0:-3] + "csvt", "Integer")
+
+    warnings = []
+
+    def handler(lvl, no, msg):
+        if lvl == gdal.CE_Warning:
+            warnings.append(msg)
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            with gdaltest.error_handler(handler):
+                assert len([f for f in lyr]) == 2500
+    assert len(warnings) == 1
+    assert "Invalid value type found" in warnings[0]
+
+
+###############################################################################
+# Test sidecar spatial index
+
+
+def test_ogr_csv_sidecar_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id,str,WKT\n"
+    for i in range(1000):
+        content += '%d,"foo,\n%d",%s\n' % (
+            i,
+            i,
+            "" if (i % 5) == 0 else "POINT (%d %d)" % (i % 40, i // 40),
+        )
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_features(ds):
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(10.5, 5.5, 20.5, 10.5)
+        ret = [(f.GetFID(), f["id"], f["str"]) for f in lyr]
+        assert lyr.GetFeatureCount() == len(ret)
+        return ret
+
+    with ogr.Open(filename) as ds:
+        assert ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter) == 0
+        ref = get_features(ds)
+    assert len(ref) == 40
+    assert ref[0] == (252, "251", "foo,\n251")
+
+    with ogr.Open(filename) as ds:
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+        assert filename + ".sidx" in ds.GetFileList()
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 1
+        assert get_features(ds) == ref
+        lyr.SetSpatialFilter(None)
+        assert lyr.GetFeatureCount() == 1000
+
+    with ogr.Open(filename) as ds:
+        assert get_features(ds) == ref
+        assert ds.GetLayer(0).GetFeature(500)["id"] == "499"
+
+    with gdaltest.config_option("OGR_SIDECAR_SPATIAL_INDEX", "NO"):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 0
+            assert get_features(ds) == ref
+
+    with ogr.Open(filename) as ds:
+        ds.ExecuteSQL("DROP SPATIAL INDEX ON test")
+    assert gdal.VSIStatL(filename + ".sidx") is None
+
+    # Build on first spatially filtered scan
+    with gdaltest.config_option("OGR_SIDECAR_SPATIAL_INDEX", "AUTO"):
+        with ogr.Open(filename) as ds:
+            assert get_features(ds) == ref
+    assert gdal.VSIStatL(filename + ".sidx") is not None
+
+    # An index is ignored once the CSV file has been modified
+    gdal.FileFromMemBuffer(filename, content + '1000,bar,"POINT (15 8)"\n')
+    with ogr.Open(filename) as ds:
+        assert ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter) == 0
+        assert get_features(ds) == ref + [(1001, "1000", "bar")]
+
+    with ogr.Open(filename) as ds:
+        with pytest.raises(Exception, match="No such layer"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON non_existing")
+
+
 ###############################################################################
 
 
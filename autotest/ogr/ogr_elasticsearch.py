@@ -3469,3 +3469,92 @@ def test_ogr_elasticsearch_upsert_feature(es_url, handle_get, handle_post):
     assert gdal.GetLastErrorMsg() == ""
 
     ds = None
+
+
+###############################################################################
+# Test reading with a sliced scroll
+
+
+def test_ogr_elasticsearch_scroll_slices(es_url, handle_get, handle_post):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"5.0.0"}}""")
+
+    handle_get("""/fakeelasticsearch/_cat/indices?h=i""", "a_layer  \n")
+    handle_get(
+        """/fakeelasticsearch/a_layer/_mapping?pretty""",
+        """
+{
+    "a_layer":
+    {
+        "mappings":
+        {
+            "FeatureCollection":
+            {
+                "properties":
+                {
+                    "type": { "type": "text" },
+                    "properties" :
+                    {
+                        "properties":
+                        {
+                            "str_field": { "type": "text"}
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+""",
+    )
+
+    handle_get(
+        """/fakeelasticsearch/a_layer/FeatureCollection/_search?scroll=1m&size=100""",
+        """{ "hits": { "hits": [] } }""",
+    )
+
+    ds = gdal.OpenEx(
+        f"ES:{es_url}/fakeelasticsearch", open_options=["SCROLL_SLICES=2"]
+    )
+    lyr = ds.GetLayer(0)
+
+    def hits(scroll_id, values):
+        return json.dumps(
+            {
+                "_scroll_id": scroll_id,
+                "hits": {
+                    "hits": [
+                        {
+                            "_id": v,
+                            "_source": {
+                                "type": "Feature",
+                                "properties": {"str_field": v},
+                            },
+                        }
+                        for v in values
+                    ]
+                },
+            }
+        )
+
+    for slice_id in range(2):
+        handle_post(
+            """/fakeelasticsearch/a_layer/FeatureCollection/_search?scroll=1m&size=100""",
+            post_body='{ "slice": { "id": %d, "max": 2 } }' % slice_id,
+            contents=hits("scroll%d" % slice_id, ["a%d" % slice_id]),
+        )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll0""",
+        hits("scroll0", []),
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll1""",
+        hits("scroll1b", ["b1"]),
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll1b""",
+        hits("scroll1b", []),
+    )
+
+    values = [f["str_field"] for f in lyr]
+    assert sorted(values) == ["a0", "a1", "b1"]
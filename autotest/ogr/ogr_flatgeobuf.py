@@ -1167,6 +1167,97 @@ def test_ogr_flatgeobuf_arrow_stream_empty_file():
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that attribute filters evaluated on Arrow batches select the same
+# features as GetNextFeature()
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "int16 = 3",
+        "int16 <> 3",
+        "int16 < 3",
+        "int16 <= 3",
+        "int16 > 3",
+        "int16 >= 3",
+        "int16 BETWEEN 2 AND 5",
+        "int16 IN (1, 4, 7)",
+        "int16 = 3.5",
+        "int16 < 3.5",
+        "int16 IS NULL",
+        "int16 IS NOT NULL",
+        "int64 >= 5000000000",
+        "int64 IN (5000000001, 5000000003)",
+        "float64 > 2.5",
+        "float64 = 2",
+        "float64 BETWEEN 1 AND 3",
+        "float32 <= 1.5",
+        "str = 'ABC3'",
+        "str <> 'abc3'",
+        "str < 'abc3'",
+        "str >= 'abc3'",
+        "str IN ('abc1', 'ABC5')",
+        "str BETWEEN 'abc2' AND 'abc4'",
+        "str IS NULL",
+        "int16 > 2 AND float64 < 4",
+        "int16 < 2 OR str = 'abc7'",
+        "NOT (int16 > 2)",
+        "NOT (int16 > 2 AND str IS NOT NULL)",
+        "int16 > 2 OR NOT (float64 < 4)",
+        "str LIKE 'abc%'",
+    ],
+)
+def test_ogr_flatgeobuf_arrow_stream_numpy_attribute_filter(tmp_vsimem, filter):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    fld_defn = ogr.FieldDefn("int16", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    fld_defn = ogr.FieldDefn("float32", ogr.OFTReal)
+    fld_defn.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 6:
+            f["int16"] = i
+            f["int64"] = 5000000000 + i
+            f["float32"] = i * 0.5
+            f["float64"] = i * 0.5
+        if i != 8:
+            f["str"] = "abc%d" % i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(filter)
+    expected_fids = [f.GetFID() for f in lyr]
+
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    fids = []
+    for batch in stream:
+        fids += list(batch["OGC_FID"])
+    assert fids == expected_fids
+
+    lyr.SetSpatialFilterRect(2.5, 2.5, 10, 10)
+    expected_fids = [f.GetFID() for f in lyr]
+
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    fids = []
+    for batch in stream:
+        fids += list(batch["OGC_FID"])
+    assert fids == expected_fids
+
+
 def test_ogr_flatgeobuf_issue_7401():
     # Verify null geom handling without spatial index
     ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource("/vsimem/test.fgb")
@@ -1650,3 +1741,51 @@ def test_ogr_flatgeobuf_write_empty_file_no_spatial_index(tmp_vsimem):
         assert lyr.GetFeatureCount() == 0
         assert lyr.GetExtent(can_return_null=True) is None
         assert lyr.GetSpatialRef().GetAuthorityCode(None) == "32631"
+
+
+###############################################################################
+# Test that multi-threaded writing of the spatial index and multi-threaded
+# (batched) reading give the same results as single-threaded ones
+
+
+def test_ogr_flatgeobuf_multi_threading(tmp_vsimem):
+
+    filenames = {}
+    for num_threads in ("1", "4"):
+        filename = str(tmp_vsimem / f"test_{num_threads}.fgb")
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            with ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename) as ds:
+                lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+                lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+                for i in range(2500):
+                    f = ogr.Feature(lyr.GetLayerDefn())
+                    f["str"] = "foo%d" % i
+                    # Many duplicated points, to check that the sort is
+                    # deterministic
+                    f.SetGeometry(
+                        ogr.CreateGeometryFromWkt(
+                            "POINT (%d %d)" % ((i * 7919) % 101, (i * 104729) % 97)
+                        )
+                    )
+                    lyr.CreateFeature(f)
+        filenames[num_threads] = filename
+
+    def read_file(filename, num_threads, spatial_filter):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            with ogr.Open(filename) as ds:
+                lyr = ds.GetLayer(0)
+                if spatial_filter:
+                    lyr.SetSpatialFilterRect(0, 0, 90.5, 80.5)
+                return [
+                    (f.GetFID(), f["str"], f.GetGeometryRef().ExportToWkt())
+                    for f in lyr
+                ]
+
+    content = read_file(filenames["1"], "1", False)
+    assert len(content) == 2500
+    assert read_file(filenames["4"], "1", False) == content
+    assert read_file(filenames["4"], "4", False) == content
+
+    content = read_file(filenames["1"], "1", True)
+    assert len(content) > 1000
+    assert read_file(filenames["4"], "4", True) == content
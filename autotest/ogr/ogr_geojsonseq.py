@@ -522,3 +522,46 @@ def test_ogr_geojsonseq_WRITE_BBOX(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"bbox": [ 2.0, 49.0, 3.0, 50.0 ]' in data
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+@pytest.mark.parametrize("rs_separated", [False, True])
+def test_ogr_geojsonseq_read_multithreaded(tmp_vsimem, rs_separated):
+
+    ext = "geojsons" if rs_separated else "geojsonl"
+    filename = str(tmp_vsimem / ("test." + ext))
+    sep = "\x1e" if rs_separated else ""
+    content = ""
+    for i in range(2500):
+        if (i % 100) == 99:
+            content += sep + '{"type":"Point","coordinates":[%d,%d]}\n' % (i, i)
+        elif (i % 100) == 50:
+            content += sep + "invalid\n"
+        else:
+            props = '{"id":%d,"str":"foo%d"' % (i, i)
+            if i == 2000:
+                props += ',"late_field":1.5'
+            props += "}"
+            geom = '{"type":"Point","coordinates":[%d,%d]}' % (i, -i)
+            content += sep + '{"type":"Feature","properties":%s,"geometry":%s}\n' % (
+                props,
+                geom,
+            )
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_features(num_threads):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            with gdal.quiet_errors(), ogr.Open(filename) as ds:
+                lyr = ds.GetLayer(0)
+                assert lyr.GetLayerDefn().GetFieldIndex("late_field") >= 0
+                ret = [f.DumpReadableAsString() for f in lyr]
+                lyr.ResetReading()
+                assert [f.DumpReadableAsString() for f in lyr] == ret
+                return ret
+
+    ref = get_features("1")
+    assert len(ref) == 2475
+    assert get_features("4") == ref
@@ -674,3 +674,28 @@ def test_ogr_geos_set_unary_union_GEOMETRYCOLLECTIONZ_POLYGONZ():
     )
     g = g.UnaryUnion()
     assert g.ExportToIsoWkt() == "POLYGON Z ((0 0 10,0 1 10,1 1 10,0 0 10))"
+
+
+###############################################################################
+# Test conversion of 3D geometries with holes and of collections with empty
+# parts from/to GEOS
+
+
+def test_ogr_geos_conversion_3d_with_holes():
+
+    g = ogr.CreateGeometryFromWkt(
+        "POLYGON Z ((0 0 1,0 10 2,10 10 3,10 0 4,0 0 1),(1 1 5,2 1 6,2 2 7,1 1 5))"
+    )
+    assert (
+        g.Boundary().ExportToIsoWkt()
+        == "MULTILINESTRING Z ((0 0 1,0 10 2,10 10 3,10 0 4,0 0 1),(1 1 5,2 1 6,2 2 7,1 1 5))"
+    )
+
+
+def test_ogr_geos_conversion_collection_with_empty_parts():
+
+    g = ogr.CreateGeometryFromWkt(
+        "GEOMETRYCOLLECTION (POINT EMPTY,LINESTRING (0 0,1 1),POLYGON EMPTY)"
+    )
+    assert g.Intersects(ogr.CreateGeometryFromWkt("POINT (0.5 0.5)"))
+    assert not g.Intersects(ogr.CreateGeometryFromWkt("POINT (2 2)"))
@@ -5025,3 +5025,50 @@ def test_ogr_gml_write_error(tmp_vsimem):
     with pytest.raises(Exception, match="Could not write line"):
         lyr.CreateFeature(f)
     ds.Close()
+
+
+###############################################################################
+# Test building geometries with several threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_gml_read_multithreaded(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.gml")
+    ds = ogr.GetDriverByName("GML").CreateDataSource(
+        filename, options=["FORMAT=GML3"]
+    )
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i == 10:
+            f.SetGeometry(None)
+        else:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt("LINESTRING (%d 0,%d 1,%d 2)" % (i, i, i))
+            )
+        lyr.CreateFeature(f)
+    ds = None
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        for _ in range(2):
+            count = 0
+            for i, f in enumerate(lyr):
+                assert f["id"] == i
+                if i == 10:
+                    assert f.GetGeometryRef() is None
+                else:
+                    assert (
+                        f.GetGeometryRef().ExportToIsoWkt()
+                        == "LINESTRING (%d 0,%d 1,%d 2)" % (i, i, i)
+                    )
+                count += 1
+            assert count == 1000
+            lyr.ResetReading()
+
+        lyr.SetSpatialFilterRect(499.5, -1, 502.5, 3)
+        assert [f["id"] for f in lyr] == [500, 501, 502]
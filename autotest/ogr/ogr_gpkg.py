@@ -8426,6 +8426,67 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test multi-threaded Arrow stream on a table with holes in the FID numbering
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, num_threads
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.StartTransaction()
+    for i in range(1000, 2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(i)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    # A whole batch without any feature, and scattered holes
+    expected_fids = [i for i in range(1000, 2000) if not (1200 <= i < 1350)]
+    expected_fids = [i for i in expected_fids if i % 7 != 0]
+    for i in range(1000, 2000):
+        if i not in expected_fids:
+            assert lyr.DeleteFeature(i) == ogr.OGRERR_NONE
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    with gdaltest.config_option("OGR_GPKG_NUM_THREADS", str(num_threads)):
+        stream = lyr.GetArrowStreamAsNumPy(
+            options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+        )
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass != gdal.CE_Debug:
+            got_msg.append(msg)
+        return
+
+    with gdaltest.error_handler(my_handler):
+        batches = [batch for batch in stream]
+
+    assert len(got_msg) == 0
+
+    got_fids = []
+    for batch in batches:
+        assert len(batch["fid"]) > 0
+        for fid, wkb in zip(batch["fid"], batch["geom"]):
+            assert (
+                ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt()
+                == f"POINT ({fid} {fid})"
+            )
+            got_fids.append(fid)
+    assert got_fids == expected_fids
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -11013,3 +11074,61 @@ def test_ogr_gpkg_set_next_by_index(tmp_vsimem):
         lyr.SetNextByIndex(0)
         f = lyr.GetNextFeature()
         assert f["foo"] == "bar"
+
+
+###############################################################################
+# Test WriteArrowBatch() with geometries encoded in worker threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_write_arrow_threaded_geometry_encoding(tmp_vsimem, num_threads):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    for i in range(2500):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["int"] = i
+        if i == 10:
+            pass
+        elif i == 11:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("LINESTRING EMPTY"))
+        elif i == 12:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("CIRCULARSTRING (0 0,1 1,2 0)"))
+        elif i % 2 == 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {-i})"))
+        else:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(f"LINESTRING Z ({i} 0 1,{i + 1} 1 2)")
+            )
+        src_lyr.CreateFeature(f)
+
+    filename = tmp_vsimem / "test_ogr_gpkg_write_arrow_threaded.gpkg"
+    with gdal.config_option("OGR_GPKG_NUM_THREADS", num_threads):
+        with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer("test")
+            lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+            lyr.WriteArrow(src_lyr, options=["FID=OGC_FID"])
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 2500
+        assert lyr.GetExtent() == (0, 2500, -2498, 1)
+        for src_f, f in zip(src_lyr, lyr):
+            assert f.GetFID() == src_f.GetFID()
+            assert f["int"] == src_f["int"]
+            src_g = src_f.GetGeometryRef()
+            g = f.GetGeometryRef()
+            if src_g is None:
+                assert g is None
+            else:
+                assert g.ExportToIsoWkt() == src_g.ExportToIsoWkt()
+        sql_lyr = ds.ExecuteSQL(
+            "SELECT extension_name FROM gpkg_extensions WHERE "
+            "extension_name = 'gpkg_geom_CIRCULARSTRING'"
+        )
+        assert sql_lyr.GetFeatureCount() == 1
+        ds.ReleaseResultSet(sql_lyr)
+        lyr.SetSpatialFilterRect(1000.5, -1, 1001.5, 2)
+        assert [f["int"] for f in lyr] == [1001]
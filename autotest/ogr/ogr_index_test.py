@@ -31,7 +31,7 @@ import os
 import ogrtest
 import pytest
 
-from osgeo import ogr
+from osgeo import gdal, ogr
 
 pytestmark = pytest.mark.require_driver("MapInfo File")
 
@@ -443,3 +443,71 @@ def test_ogr_index_11(tmp_path):
     ogr_index_11_check(lyr, [0, 1, 2, 3, 4])
 
     ds = None
+
+
+###############################################################################
+# Test range, BETWEEN, prefix LIKE and compound queries using indexes
+
+
+def test_ogr_index_range_and_prefix_queries(tmp_path):
+
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(
+        tmp_path / "ogr_index_range.dbf"
+    )
+    lyr = ds.CreateLayer("ogr_index_range", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("otherfield", ogr.OFTInteger))
+
+    for i in range(50):
+        prefix = "foo" if (i % 3) == 0 else "Bar" if (i % 3) == 1 else "bar"
+        ogrtest.quick_create_feature(
+            lyr, [i - 10, "%s%d" % (prefix, i), i % 7], None
+        )
+
+    filters = [
+        "intfield > 5",
+        "intfield >= 5",
+        "intfield < -5",
+        "intfield <= -5",
+        "intfield > 5.5",
+        "intfield < 5.5",
+        "intfield < -2147483649",
+        "10 > intfield",
+        "intfield BETWEEN 3 AND 12",
+        "intfield BETWEEN 3.5 AND 11.5",
+        "intfield NOT BETWEEN 3 AND 12",
+        "strfield LIKE 'bar1%'",
+        "strfield LIKE 'bar_%'",
+        "strfield ILIKE 'BAR1%'",
+        "strfield LIKE 'foo'",
+        "strfield LIKE '%1'",
+        "intfield > 5 AND otherfield = 2",
+        "intfield > 5 AND strfield LIKE 'foo%'",
+        "intfield < 0 OR strfield LIKE 'bar2%'",
+        "intfield < 0 OR otherfield = 2",
+        "intfield IN (1, 2, 3) AND intfield > 1",
+    ]
+
+    def get_fids(filter):
+        lyr.SetAttributeFilter(filter)
+        return [f.GetFID() for f in lyr]
+
+    expected = {filter: get_fids(filter) for filter in filters}
+
+    ds.ExecuteSQL("CREATE INDEX ON ogr_index_range USING intfield")
+    ds.ExecuteSQL("CREATE INDEX ON ogr_index_range USING strfield")
+
+    for filter in filters:
+        assert get_fids(filter) == expected[filter], filter
+        lyr.SetAttributeFilter(filter)
+        assert lyr.GetFeatureCount() == len(expected[filter]), filter
+
+    with gdal.config_option("OGR_SQL_LIKE_AS_ILIKE", "YES"):
+        lyr.SetAttributeFilter("strfield LIKE 'bar1%'")
+        assert len(expected["strfield ILIKE 'BAR1%'"]) > len(
+            expected["strfield LIKE 'bar1%'"]
+        )
+        assert [f.GetFID() for f in lyr] == expected["strfield ILIKE 'BAR1%'"]
+
+    ds = None
@@ -546,3 +546,61 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that the hash join gives the same results as the join through
+# attribute filters
+
+
+@pytest.mark.parametrize(
+    "primary_type,secondary_type,keys",
+    [
+        (ogr.OFTInteger, ogr.OFTInteger, [3, 1, None, 2, 5, 1]),
+        (ogr.OFTInteger, ogr.OFTInteger64, [3, 1, None, 2, 5, 1]),
+        (ogr.OFTString, ogr.OFTString, ["c", "A", None, "b", "e", "a"]),
+    ],
+)
+def test_ogr_join_hash_join(primary_type, secondary_type, keys):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("lyr1")
+    lyr.CreateField(ogr.FieldDefn("k", primary_type))
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i, key in enumerate(keys):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["k"] = key
+        f["id"] = i
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("lyr2")
+    lyr.CreateField(ogr.FieldDefn("k", secondary_type))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    secondary_keys = (
+        ["a", None, "B", "a", "c", "D"]
+        if secondary_type == ogr.OFTString
+        else [1, None, 2, 1, 3, 4]
+    )
+    for i, key in enumerate(secondary_keys):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["k"] = key
+        f["val"] = "val%d" % i
+        lyr.CreateFeature(f)
+
+    def get_results():
+        with ds.ExecuteSQL(
+            "SELECT id, val FROM lyr1 LEFT JOIN lyr2 ON lyr1.k = lyr2.k"
+        ) as sql_lyr:
+            return [(f["id"], f["val"]) for f in sql_lyr]
+
+    with gdal.config_option("OGR_SQL_USE_HASH_JOIN", "NO"):
+        expected = get_results()
+    assert expected == [
+        (0, "val4"),
+        (1, "val0"),
+        (2, None),
+        (3, "val2"),
+        (4, None),
+        (5, "val0"),
+    ]
+    assert get_results() == expected
@@ -593,3 +593,69 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Check that the in-memory spatial index of the method layer does not change
+# the result of the operations
+
+
+def _square(x, y, size):
+    return ogr.CreateGeometryFromWkt(
+        f"POLYGON(({x} {y},{x} {y + size},{x + size} {y + size},"
+        f"{x + size} {y},{x} {y}))"
+    )
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("method_filter", [False, True])
+def test_algebra_INDEX_METHOD_LAYER(mem_ds, method, method_filter):
+
+    input_lyr = mem_ds.CreateLayer("input")
+    input_lyr.CreateField(ogr.FieldDefn("input_id", ogr.OFTInteger))
+    method_lyr = mem_ds.CreateLayer("method")
+    method_lyr.CreateField(ogr.FieldDefn("method_id", ogr.OFTInteger))
+    for i in range(5):
+        for j in range(5):
+            feat = ogr.Feature(input_lyr.GetLayerDefn())
+            feat["input_id"] = i * 5 + j
+            feat.SetGeometry(_square(i, j, 1.5))
+            input_lyr.CreateFeature(feat)
+
+            feat = ogr.Feature(method_lyr.GetLayerDefn())
+            feat["method_id"] = i * 5 + j
+            feat.SetGeometry(_square(i + 0.25, j + 0.25, 0.5))
+            method_lyr.CreateFeature(feat)
+    # Feature without geometry
+    method_lyr.CreateFeature(ogr.Feature(method_lyr.GetLayerDefn()))
+
+    if method_filter:
+        method_lyr.SetSpatialFilterRect(1, 1, 3.5, 3.5)
+
+    result_no_index = mem_ds.CreateLayer("result_no_index")
+    assert (
+        getattr(input_lyr, method)(
+            method_lyr, result_no_index, options=["INDEX_METHOD_LAYER=NO"]
+        )
+        == ogr.OGRERR_NONE
+    )
+
+    result_index = mem_ds.CreateLayer("result_index")
+    assert (
+        getattr(input_lyr, method)(
+            method_lyr, result_index, options=["INDEX_METHOD_LAYER=YES"]
+        )
+        == ogr.OGRERR_NONE
+    )
+
+    assert result_index.GetFeatureCount() > 0
+    assert is_same(result_no_index, result_index)
+
+    # Check that the spatial filter of the method layer is preserved
+    if method_filter:
+        assert method_lyr.GetFeatureCount() == 9
+    else:
+        assert method_lyr.GetFeatureCount() == 26
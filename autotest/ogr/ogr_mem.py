@@ -1362,6 +1362,222 @@ def test_ogr_mem_arrow_stream_pyarrow_geoarrow_metadata():
     assert "crs" in metadata
     assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
 
+###############################################################################
+# Test GetArrowStream(GEOMETRY_ENCODING=GEOARROW[_INTERLEAVED]) and reading
+# the result back with WriteArrowBatch()
+
+
+@pytest.mark.parametrize("encoding", ["GEOARROW", "GEOARROW_INTERLEAVED"])
+@pytest.mark.parametrize(
+    "geom_type,wkts",
+    [
+        (ogr.wkbPoint, ["POINT (1 2)", None, "POINT EMPTY", "POINT (3 4)"]),
+        (ogr.wkbPoint25D, ["POINT Z (1 2 3)", "POINT Z EMPTY"]),
+        (ogr.wkbPointM, ["POINT M (1 2 4)"]),
+        (ogr.wkbPointZM, ["POINT ZM (1 2 3 4)"]),
+        (
+            ogr.wkbLineString,
+            [
+                "LINESTRING (1 2,3 4)",
+                "LINESTRING EMPTY",
+                None,
+                "LINESTRING (5 6,7 8,9 10)",
+            ],
+        ),
+        (
+            ogr.wkbPolygon,
+            [
+                "POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.2,0.2 0.3,0.3 0.3,0.2 0.2))",
+                "POLYGON EMPTY",
+                "POLYGON ((10 10,10 11,11 11,10 10))",
+            ],
+        ),
+        (
+            ogr.wkbMultiPoint,
+            ["MULTIPOINT ((1 2),(3 4))", "MULTIPOINT EMPTY", "MULTIPOINT ((5 6))"],
+        ),
+        (
+            ogr.wkbMultiLineString,
+            [
+                "MULTILINESTRING ((1 2,3 4),(5 6,7 8))",
+                "MULTILINESTRING EMPTY",
+                "MULTILINESTRING ((9 10,11 12))",
+            ],
+        ),
+        (
+            ogr.wkbMultiPolygon25D,
+            [
+                "MULTIPOLYGON Z (((0 0 1,0 1 1,1 1 1,0 0 1)),"
+                + "((10 10 2,10 11 2,11 11 2,10 10 2),"
+                + "(10.2 10.2 2,10.2 10.3 2,10.3 10.3 2,10.2 10.2 2)))",
+                "MULTIPOLYGON Z EMPTY",
+                None,
+                "MULTIPOLYGON Z (((20 20 3,20 21 3,21 21 3,20 20 3)))",
+            ],
+        ),
+    ],
+)
+def test_ogr_mem_arrow_geoarrow_native_encoding(geom_type, wkts, encoding):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = ds.CreateLayer("src_lyr", geom_type=geom_type)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    dst_lyr = ds.CreateLayer("dst_lyr", geom_type=geom_type)
+    dst_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+
+    # Use small batches to test non-zero offsets of child arrays
+    stream = src_lyr.GetArrowStream(
+        ["INCLUDE_FID=NO", "GEOMETRY_ENCODING=" + encoding, "MAX_FEATURES_IN_BATCH=2"]
+    )
+    schema = stream.GetSchema()
+
+    success, error_msg = dst_lyr.IsArrowSchemaSupported(schema)
+    assert success, error_msg
+
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert dst_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+
+    got_wkts = []
+    for f in dst_lyr:
+        g = f.GetGeometryRef()
+        got_wkts.append(g.ExportToIsoWkt() if g else None)
+    assert got_wkts == wkts
+
+
+###############################################################################
+# Test GetArrowStream(GEOMETRY_ENCODING=GEOARROW) with geometries not matching
+# the layer geometry type
+
+
+def test_ogr_mem_arrow_geoarrow_native_encoding_promotion_and_mismatch():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = ds.CreateLayer("src_lyr", geom_type=ogr.wkbMultiPolygon)
+    for wkt in ["POLYGON ((0 0,0 1,1 1,0 0))", "POINT (1 2)"]:
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    dst_lyr = ds.CreateLayer("dst_lyr", geom_type=ogr.wkbMultiPolygon)
+
+    stream = src_lyr.GetArrowStream(["INCLUDE_FID=NO", "GEOMETRY_ENCODING=GEOARROW"])
+    schema = stream.GetSchema()
+    with gdal.quiet_errors():
+        gdal.ErrorReset()
+        array = stream.GetNextRecordBatch()
+        assert "Geometry of type Point found" in gdal.GetLastErrorMsg()
+    assert dst_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+
+    f = dst_lyr.GetNextFeature()
+    assert f.GetGeometryRef().ExportToIsoWkt() == "MULTIPOLYGON (((0 0,0 1,1 1,0 0)))"
+    f = dst_lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize(
+    "encoding,expected_type",
+    [
+        (
+            "GEOARROW",
+            "list<rings: list<vertices: struct<x: double not null, "
+            + "y: double not null, z: double not null>>>",
+        ),
+        (
+            "GEOARROW_INTERLEAVED",
+            "list<rings: list<vertices: fixed_size_list<xyz: double not null>[3]>>",
+        ),
+    ],
+)
+def test_ogr_mem_arrow_stream_pyarrow_geoarrow_native_encoding(
+    encoding, expected_type
+):
+    pyarrow = pytest.importorskip("pyarrow")
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    lyr = ds.CreateLayer("foo", srs=srs, geom_type=ogr.wkbPolygon25D)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON Z ((0 0 1,0 1 1,1 1 1,0 0 1))"))
+    lyr.CreateFeature(f)
+
+    stream = lyr.GetArrowStreamAsPyArrow(
+        ["INCLUDE_FID=NO", "GEOMETRY_ENCODING=" + encoding]
+    )
+    assert str(stream.schema["wkb_geometry"].type) == expected_type
+    md = stream.schema["wkb_geometry"].metadata
+    assert md[b"ARROW:extension:name"] == b"geoarrow.polygon"
+    metadata = json.loads(md[b"ARROW:extension:metadata"])
+    assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
+
+    table = pyarrow.Table.from_batches(stream, schema=stream.schema)
+    table.validate(full=True)
+    assert len(table) == 1
+
+
+###############################################################################
+# Test GetArrowStream(PREFETCH_BATCHES=...)
+
+
+@pytest.mark.parametrize("attr_filter", [None, "FID IN (1, 3, 8)"])
+def test_ogr_mem_arrow_stream_prefetch_batches(attr_filter):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("foo")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i})"))
+        lyr.CreateFeature(f)
+    if attr_filter:
+        lyr.SetAttributeFilter(attr_filter)
+
+    def get_features(options):
+        stream = lyr.GetArrowStream(["INCLUDE_FID=NO"] + options)
+        schema = stream.GetSchema()
+        # Use a separate dataset, as the source one must not be used while
+        # the stream is active
+        dst_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+        dst_lyr = dst_ds.CreateLayer("dst")
+        dst_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        while True:
+            array = stream.GetNextRecordBatch()
+            if array is None:
+                break
+            assert dst_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+        return [(f["id"], f.GetGeometryRef().ExportToWkt()) for f in dst_lyr]
+
+    expected = get_features(["MAX_FEATURES_IN_BATCH=3"])
+    assert len(expected) == (3 if attr_filter else 10)
+    assert (
+        get_features(["MAX_FEATURES_IN_BATCH=3", "PREFETCH_BATCHES=2"]) == expected
+    )
+
+    # Release the stream before it is fully consumed
+    stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=1", "PREFETCH_BATCHES=2"])
+    array = stream.GetNextRecordBatch()
+    assert array is not None
+    del array
+    del stream
+
+    # Check that the layer can be read again normally
+    lyr.ResetReading()
+    assert len([f for f in lyr]) == len(expected)
+
 
 ###############################################################################
 # Test upserting a feature.
@@ -2983,3 +3199,112 @@ def test_ogr_mem_lyr_get_dataset():
     ds = ogr.GetDriverByName("Memory").CreateDataSource("foo")
     lyr = ds.CreateLayer("test")
     assert lyr.GetDataset().GetDescription() == "foo"
+
+
+###############################################################################
+# Test STORAGE=ARROW layer creation option
+
+
+def test_ogr_mem_storage_arrow():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=["STORAGE=ARROW"])
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch)
+    assert lyr.TestCapability(ogr.OLCCreateField)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = i
+        if i != 5:
+            f["str"] = "val%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+        assert f.GetFID() == i
+
+    assert not lyr.TestCapability(ogr.OLCCreateField)
+    with gdal.quiet_errors():
+        assert lyr.CreateField(ogr.FieldDefn("other", ogr.OFTString)) != 0
+
+    assert lyr.GetFeatureCount() == 10
+    lyr.ResetReading()
+    for i in range(10):
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == i
+        assert f["int"] == i
+        assert f["str"] == (None if i == 5 else "val%d" % i)
+        assert f.GetGeometryRef().ExportToWkt() == "POINT (%d %d)" % (i, i)
+    assert lyr.GetNextFeature() is None
+
+    lyr.SetAttributeFilter("int >= 8")
+    assert [f.GetFID() for f in lyr] == [8, 9]
+    lyr.SetAttributeFilter(None)
+
+    lyr.SetSpatialFilterRect(1.5, 1.5, 3.5, 3.5)
+    assert [f.GetFID() for f in lyr] == [2, 3]
+    lyr.SetSpatialFilterRect(100, 100, 200, 200)
+    assert lyr.GetFeatureCount() == 0
+    lyr.SetSpatialFilter(None)
+
+    # Features created without a FID get the next one after the highest FID
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetFID(100)
+    assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    f = ogr.Feature(lyr.GetLayerDefn())
+    assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    assert f.GetFID() == 101
+    assert lyr.GetFeatureCount() == 12
+
+
+###############################################################################
+# Test STORAGE=ARROW with the Arrow interface
+
+
+def test_ogr_mem_storage_arrow_arrow_interface():
+    pa = pytest.importorskip("pyarrow")
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = ds.CreateLayer(
+        "src", geom_type=ogr.wkbPoint, options=["STORAGE=ARROW"]
+    )
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    for i in range(3):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["int"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        src_lyr.CreateFeature(f)
+
+    table = src_lyr.GetArrowStreamAsPyArrow().read_all()
+    assert table["OGC_FID"].to_pylist() == [0, 1, 2]
+    assert table["int"].to_pylist() == [0, 1, 2]
+
+    table = src_lyr.GetArrowStreamAsPyArrow(["INCLUDE_FID=NO"]).read_all()
+    assert table.schema.names == ["int", "wkb_geometry"]
+
+    # Batches with the same schema as the layer
+    dst_lyr = ds.CreateLayer(
+        "dst", geom_type=ogr.wkbPoint, options=["STORAGE=ARROW"]
+    )
+    dst_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    assert dst_lyr.WriteArrow(src_lyr) == ogr.OGRERR_NONE
+    assert dst_lyr.WriteArrow(src_lyr, options=["FID=OGC_FID"]) == ogr.OGRERR_NONE
+    assert dst_lyr.GetFeatureCount() == 6
+    f = ogr.Feature(dst_lyr.GetLayerDefn())
+    dst_lyr.CreateFeature(f)
+    assert f.GetFID() == 3
+
+    # Batch with another schema, that requires a conversion
+    batch = pa.RecordBatch.from_arrays(
+        [pa.array([10, 11], type=pa.int64())], names=["int"]
+    )
+    assert dst_lyr.WritePyArrow(batch) == ogr.OGRERR_NONE
+    assert dst_lyr.GetFeatureCount() == 9
+
+    table = dst_lyr.GetArrowStreamAsPyArrow().read_all()
+    assert table["int"].to_pylist() == [0, 1, 2, 0, 1, 2, None, 10, 11]
+    assert dst_lyr.GetNextFeature().GetGeometryRef().ExportToWkt() == "POINT (0 0)"
+
+    table = dst_lyr.GetArrowStreamAsPyArrow(["MAX_FEATURES_IN_BATCH=2"]).read_all()
+    assert table.num_rows == 9
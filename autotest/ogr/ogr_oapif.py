@@ -385,6 +385,58 @@ def test_ogr_oapif_fc_links_next_geojson():
     assert f["foo"] == "baz4"
 
 
+###############################################################################
+# Test concurrent fetching of pages when the "next" links use offset-based
+# paging
+
+
+@pytest.mark.parametrize("max_prefetched_pages", [0, 1, 4])
+def test_ogr_oapif_offset_paging_prefetch(max_prefetched_pages):
+
+    def page(offset, count, with_next):
+        j = {
+            "type": "FeatureCollection",
+            "numberMatched": 5,
+            "features": [
+                {"type": "Feature", "properties": {"foo": "f%d" % i}}
+                for i in range(offset, offset + count)
+            ],
+        }
+        if with_next:
+            j["links"] = [
+                {
+                    "rel": "next",
+                    "type": "application/geo+json",
+                    "href": "/oapif/collections/foo/items?limit=2&offset=%d"
+                    % (offset + count),
+                }
+            ]
+        return json.dumps(j).encode("utf8")
+
+    filedata = {
+        "/oapif/collections": b'{ "collections" : [ { "name": "foo" }] }',
+        "/oapif/collections/foo/items?limit=2": page(0, 2, True),
+        "/oapif/collections/foo/items?limit=2&offset=2": page(2, 2, True),
+        "/oapif/collections/foo/items?limit=2&offset=4": page(4, 1, False),
+    }
+    handler = webserver.FileHandler(filedata, content_type="application/geo+json")
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            "OAPIF:http://localhost:%d/oapif" % gdaltest.webserver_port,
+            open_options=[
+                "PAGE_SIZE=2",
+                "MAX_PREFETCHED_PAGES=%d" % max_prefetched_pages,
+            ],
+        )
+        lyr = ds.GetLayer(0)
+        for _ in range(2):
+            assert [f["foo"] for f in lyr] == ["f0", "f1", "f2", "f3", "f4"]
+            lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f["foo"] == "f0"
+        ds = None
+
+
 ###############################################################################
 
 
@@ -2967,3 +2967,89 @@ def test_ogr_openfilegdb_vsizip_random_zip_name_and_no_gdb_subdir():
 
     with ogr.Open("/vsizip/data/filegdb/testopenfilegdb.zip") as ds:
         assert ds.GetLayerCount() == 37
+
+
+###############################################################################
+# Test the specialized GetNextArrowArray() implementation against the generic
+# one
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+    ],
+)
+@pytest.mark.parametrize("filter_type", [None, "spatial", "attribute"])
+def test_ogr_openfilegdb_arrow_stream(filename, filter_type):
+    pa = pytest.importorskip("pyarrow")
+
+    def get_table(lyr, options):
+        stream = lyr.GetArrowStreamAsPyArrow(options)
+        return pa.Table.from_batches([batch for batch in stream], stream.schema)
+
+    with ogr.Open(filename) as ds:
+        for lyr in ds:
+            assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+            if filter_type == "spatial":
+                extent = lyr.GetExtent(can_return_null=True)
+                if extent is None:
+                    continue
+                minx, maxx, miny, maxy = extent
+                lyr.SetSpatialFilterRect(
+                    minx, miny, (minx + maxx) / 2, (miny + maxy) / 2
+                )
+            elif filter_type == "attribute":
+                lyr.SetAttributeFilter("FID % 2 = 1")
+
+            for options in (["MAX_FEATURES_IN_BATCH=2"], ["INCLUDE_FID=NO"]):
+                if filter_type == "attribute" and "INCLUDE_FID=NO" in options:
+                    continue
+                table = get_table(lyr, options)
+                with gdaltest.config_option(
+                    "OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"
+                ):
+                    ref_table = get_table(lyr, options)
+                assert table.equals(ref_table), lyr.GetName()
+
+
+###############################################################################
+# Test multi-threaded sequential reading
+
+
+@pytest.mark.parametrize("with_attribute_filter", [False, True])
+def test_ogr_openfilegdb_read_multithreaded(tmp_path, with_attribute_filter):
+
+    filename = str(tmp_path / "test.gdb")
+    with ogr.GetDriverByName("OpenFileGDB").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        lyr.StartTransaction()
+        for i in range(5000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = i
+            if (i % 3) != 0:
+                f["str"] = "foo%d" % i
+            if (i % 5) != 0:
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+            lyr.CreateFeature(f)
+        lyr.CommitTransaction()
+        for fid in (1, 1024, 1025, 2500, 4999):
+            assert lyr.DeleteFeature(fid) == ogr.OGRERR_NONE
+
+    def get_features(num_threads):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            with ogr.Open(filename) as ds:
+                lyr = ds.GetLayer(0)
+                if with_attribute_filter:
+                    lyr.SetAttributeFilter("str LIKE 'foo1%'")
+                ret = [f.DumpReadableAsString() for f in lyr]
+                lyr.ResetReading()
+                assert [f.DumpReadableAsString() for f in lyr] == ret
+                return ret
+
+    ref = get_features("1")
+    assert len(ref) == (741 if with_attribute_filter else 4995)
+    assert get_features("4") == ref
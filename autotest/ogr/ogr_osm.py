@@ -937,3 +937,134 @@ def test_ogr_osmconf_ini():
             config.read_file(open(osmconf_ini_filename))
             assert "general" in config
             assert "closed_ways_are_polygons" in config["general"]
+
+
+###############################################################################
+# Test that threaded way assembly and memory-mapping of the nodes file give
+# the same result as sequential reading
+
+
+def _ogr_osm_read_all_features(filename):
+
+    ret = []
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        while True:
+            f, lyr = ds.GetNextFeature()
+            if f is None:
+                break
+            geom = f.GetGeometryRef()
+            ret.append(
+                (
+                    lyr.GetName(),
+                    f.GetFID(),
+                    f["osm_id"],
+                    geom.ExportToIsoWkt() if geom else None,
+                )
+            )
+    return ret
+
+
+@pytest.mark.parametrize(
+    "filename", ["data/osm/test.pbf", "data/osm/base-64.osm.pbf"]
+)
+@pytest.mark.parametrize("num_threads", ["4", "ALL_CPUS"])
+@pytest.mark.parametrize("mmap_nodes_file", ["YES", "NO"])
+def test_ogr_osm_threads_and_mmap_same_as_sequential(
+    filename, num_threads, mmap_nodes_file
+):
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "1", "OSM_MMAP_NODES_FILE": "NO"}
+    ):
+        expected = _ogr_osm_read_all_features(filename)
+    assert expected
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "OSM_MMAP_NODES_FILE": mmap_nodes_file}
+    ):
+        got = _ogr_osm_read_all_features(filename)
+    assert got == expected
+
+
+###############################################################################
+# Same as above, but with a file large enough for ways to be assembled by
+# several threads, and with a nodes file transferred onto disk
+
+
+def _ogr_osm_write_sparse_ids_file(filename, node_count=3000, way_count=5000):
+
+    # Node ids are spread by 64 so that each node lands in its own sector of
+    # the nodes file, which makes it exceed 1 MB
+    lines = ['<?xml version="1.0" encoding="UTF-8"?>', '<osm version="0.6">']
+    for i in range(node_count):
+        lines.append(
+            '<node id="%d" lat="%.7f" lon="%.7f"/>'
+            % (1 + 64 * i, 49 + (i % 100) * 1e-3, 2 + (i // 100) * 1e-3)
+        )
+    for i in range(way_count):
+        refs = [(i + k * 7) % node_count for k in range(4)]
+        if i % 5 == 0:
+            refs.append(refs[0])
+            tag = '<tag k="building" v="yes"/>'
+        else:
+            tag = '<tag k="highway" v="road"/>'
+        lines.append('<way id="%d">' % (i + 1))
+        for ref in refs:
+            lines.append('<nd ref="%d"/>' % (1 + 64 * ref))
+        lines.append(tag)
+        lines.append("</way>")
+    lines.append("</osm>")
+    with open(filename, "wt") as f:
+        f.write("\n".join(lines))
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("mmap_nodes_file", ["YES", "NO"])
+@pytest.mark.parametrize("compress_nodes", ["YES", "NO"])
+def test_ogr_osm_threads_and_mmap_on_disk_nodes_file(
+    tmp_path, num_threads, mmap_nodes_file, compress_nodes
+):
+
+    if not ogrtest.osm_drv_parse_osm:
+        pytest.skip("Expat support missing")
+
+    filename = str(tmp_path / "sparse_ids.osm")
+    _ogr_osm_write_sparse_ids_file(filename)
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "1", "OSM_MMAP_NODES_FILE": "NO"}
+    ):
+        expected = _ogr_osm_read_all_features(filename)
+    assert len([x for x in expected if x[0] == "lines"]) == 4000
+    assert len([x for x in expected if x[0] == "multipolygons"]) == 1000
+
+    debug_msg_list = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msg_list.append(msg)
+
+    gdal.PushErrorHandler(handler)
+    gdal.SetCurrentErrorHandlerCatchDebug(True)
+    try:
+        with gdaltest.config_options(
+            {
+                "CPL_DEBUG": "OSM",
+                "GDAL_NUM_THREADS": num_threads,
+                "OSM_MMAP_NODES_FILE": mmap_nodes_file,
+                "OSM_COMPRESS_NODES": compress_nodes,
+                "OSM_MAX_TMPFILE_SIZE": "1",
+            }
+        ):
+            got = _ogr_osm_read_all_features(filename)
+    finally:
+        gdal.PopErrorHandler()
+
+    assert got == expected
+
+    # The uncompressed nodes file has been transferred onto disk
+    if compress_nodes == "NO":
+        assert any(
+            "too big for RAM" in msg and "osm_tmp_nodes" in msg
+            for msg in debug_msg_list
+        )
@@ -3743,6 +3743,72 @@ def test_ogr_parquet_sort_by_bbox(tmp_vsimem):
     check_file(outfilename2)
 
 
+###############################################################################
+
+
+@pytest.mark.require_driver("GPKG")
+def test_ogr_parquet_sort_by_bbox_hilbert(tmp_vsimem):
+
+    COUNT_NON_SPATIAL = 11
+    COUNT_SPATIAL = 1000
+    ROW_GROUP_SIZE = 100
+
+    def create_file(filename, options):
+        with ogr.GetDriverByName("Parquet").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer(
+                "test",
+                geom_type=ogr.wkbPoint,
+                options=[f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}"] + options,
+            )
+            lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+            for i in range(COUNT_NON_SPATIAL):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["i"] = i
+                lyr.CreateFeature(f)
+            for i in range(COUNT_SPATIAL):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["i"] = i + COUNT_NON_SPATIAL
+                x = (i * 7919) % COUNT_SPATIAL
+                y = (i * 104729) % 997
+                f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({x} {y})"))
+                lyr.CreateFeature(f)
+
+    def get_sum_area_row_groups(filename):
+        with gdaltest.config_option("OGR_PARQUET_SHOW_ROW_GROUP_EXTENT", "YES"):
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            assert sum([f["feature_count"] for f in lyr]) == COUNT_SPATIAL
+            return sum([f.GetGeometryRef().GetArea() for f in lyr])
+
+    unsorted_filename = str(tmp_vsimem / "unsorted.parquet")
+    create_file(unsorted_filename, [])
+
+    sorted_filename = str(tmp_vsimem / "sorted.parquet")
+    with pytest.raises(Exception, match="Unsupported value for SORT_BY_BBOX_METHOD"):
+        with gdaltest.enable_exceptions():
+            create_file(
+                sorted_filename, ["SORT_BY_BBOX=YES", "SORT_BY_BBOX_METHOD=FOO"]
+            )
+    create_file(sorted_filename, ["SORT_BY_BBOX=YES", "SORT_BY_BBOX_METHOD=HILBERT"])
+
+    ds = ogr.Open(sorted_filename)
+    lyr = ds.GetLayer(0)
+    for i in range(COUNT_NON_SPATIAL):
+        f = lyr.GetNextFeature()
+        assert f["i"] == i
+        assert f.GetGeometryRef() is None
+    set_i = set()
+    for f in lyr:
+        assert f.GetGeometryRef() is not None
+        set_i.add(f["i"])
+    assert set_i == set(range(COUNT_NON_SPATIAL, COUNT_NON_SPATIAL + COUNT_SPATIAL))
+    ds = None
+
+    assert get_sum_area_row_groups(sorted_filename) < 0.5 * get_sum_area_row_groups(
+        unsorted_filename
+    )
+
+
 ###############################################################################
 # Check GeoArrow struct encoding
 
@@ -4215,3 +4281,48 @@ def test_ogr_parquet_arrow_stream_numpy_datetime_as_string(tmp_vsimem):
         assert (
             batch["timestamp_ms_gmt_minus_0215"][0] == b"2019-01-01T14:00:00.500-02:15"
         )
+
+
+###############################################################################
+# Test that row groups skipped using the page index do not alter results
+
+
+@pytest.mark.parametrize("use_page_index", ["YES", "NO"])
+def test_ogr_parquet_attribute_filter_page_index(tmp_vsimem, use_page_index):
+
+    N = 400000
+    csv_filename = str(tmp_vsimem / "test.csv")
+    gdal.FileFromMemBuffer(
+        csv_filename,
+        "v,w\n" + "".join(f"{i},{N - 1 - i}\n" for i in range(N)),
+    )
+    gdal.FileFromMemBuffer(str(tmp_vsimem / "test.csvt"), "Integer,Integer")
+
+    outfilename = str(tmp_vsimem / "test.parquet")
+    gdal.VectorTranslate(
+        outfilename,
+        csv_filename,
+        format="Parquet",
+        layerCreationOptions=[f"ROW_GROUP_SIZE={N}"],
+    )
+
+    with gdal.config_option("OGR_PARQUET_USE_PAGE_INDEX", use_page_index):
+        with ogr.Open(outfilename) as ds:
+            lyr = ds.GetLayer(0)
+
+            # Row group statistics cannot exclude that, but page statistics can
+            lyr.SetAttributeFilter("v < 1000 AND w < 1000")
+            assert lyr.GetFeatureCount() == 0
+            assert lyr.GetNextFeature() is None
+
+            lyr.SetAttributeFilter("v < 1000 AND w >= 0")
+            assert lyr.GetFeatureCount() == 1000
+
+            lyr.SetAttributeFilter(f"v >= {N - 10} AND w < 10")
+            assert lyr.GetFeatureCount() == 10
+            f = lyr.GetNextFeature()
+            assert f["v"] == N - 10
+            assert f["w"] == 9
+
+            lyr.SetAttributeFilter("v IS NOT NULL AND w = 5")
+            assert lyr.GetFeatureCount() == 1
@@ -6329,3 +6329,94 @@ def test_ogr_pg_findfield(pg_ds):
             relaxedFieldNameMatch=True,
         )
     assert [f.GetField(0) for f in lyr] == ["foo", None, "foo"]
+
+
+###############################################################################
+# Test asynchronous prefetch of the next cursor page (OGR_PG_PREFETCH_CURSOR_PAGE)
+
+
+def _ogr_pg_read_tpoly(lyr):
+    return [
+        (f.GetFID(), f["EAS_ID"], f.GetGeometryRef().ExportToIsoWkt()) for f in lyr
+    ]
+
+
+@pytest.mark.usefixtures("tpoly")
+@pytest.mark.parametrize("cursor_page", ["1", "3", "10", "500"])
+def test_ogr_pg_prefetch_cursor_page(pg_ds, cursor_page):
+
+    results = {}
+    for prefetch in ("NO", "YES"):
+        with gdal.config_options(
+            {
+                "OGR_PG_CURSOR_PAGE": cursor_page,
+                "OGR_PG_PREFETCH_CURSOR_PAGE": prefetch,
+            }
+        ):
+            ds = reconnect(pg_ds, update=False)
+            lyr = ds.GetLayerByName("tpoly")
+            results[prefetch] = _ogr_pg_read_tpoly(lyr)
+            # Read twice to check that ResetReading() discards any pending
+            # prefetch
+            assert _ogr_pg_read_tpoly(lyr) == results[prefetch]
+
+            sql_lyr = ds.ExecuteSQL("SELECT * FROM tpoly ORDER BY eas_id")
+            results[prefetch + "_sql"] = _ogr_pg_read_tpoly(sql_lyr)
+            ds.ReleaseResultSet(sql_lyr)
+            ds = None
+
+    assert len(results["NO"]) == 10
+    assert results["YES"] == results["NO"]
+    assert results["YES_sql"] == results["NO_sql"]
+
+
+###############################################################################
+# Test that other requests issued on the connection while a cursor page is
+# being prefetched do not disturb the reading
+
+
+@pytest.mark.usefixtures("tpoly")
+def test_ogr_pg_prefetch_cursor_page_interleaved_requests(pg_ds):
+
+    with gdal.config_option("OGR_PG_PREFETCH_CURSOR_PAGE", "NO"):
+        ds = reconnect(pg_ds, update=False)
+        expected = _ogr_pg_read_tpoly(ds.GetLayerByName("tpoly"))
+        ds = None
+
+    with gdal.config_options(
+        {"OGR_PG_CURSOR_PAGE": "2", "OGR_PG_PREFETCH_CURSOR_PAGE": "YES"}
+    ):
+        ds = reconnect(pg_ds, update=False)
+        lyr = ds.GetLayerByName("tpoly")
+
+        got = []
+        for i, f in enumerate(lyr):
+            got.append(
+                (f.GetFID(), f["EAS_ID"], f.GetGeometryRef().ExportToIsoWkt())
+            )
+            if i == 2:
+                # Synchronous request while the next page is in flight
+                sql_lyr = ds.ExecuteSQL("SELECT COUNT(*) FROM tpoly")
+                assert sql_lyr.GetNextFeature().GetField(0) == 10
+                ds.ReleaseResultSet(sql_lyr)
+            elif i == 4:
+                # Another cursor on the same connection
+                sql_lyr = ds.ExecuteSQL("SELECT * FROM tpoly ORDER BY eas_id")
+                assert len(_ogr_pg_read_tpoly(sql_lyr)) == 10
+                ds.ReleaseResultSet(sql_lyr)
+        assert got == expected
+
+        # Random access while a page is prefetched
+        lyr.ResetReading()
+        for _ in range(3):
+            lyr.GetNextFeature()
+        assert lyr.SetNextByIndex(7) == ogr.OGRERR_NONE
+        f = lyr.GetNextFeature()
+        assert (f.GetFID(), f["EAS_ID"], f.GetGeometryRef().ExportToIsoWkt()) == (
+            expected[7]
+        )
+        f = lyr.GetNextFeature()
+        assert (f.GetFID(), f["EAS_ID"], f.GetGeometryRef().ExportToIsoWkt()) == (
+            expected[8]
+        )
+        ds = None
@@ -19,7 +19,7 @@ import ogrtest
 import pytest
 import test_cli_utilities
 
-from osgeo import gdal, ogr
+from osgeo import gdal, ogr, osr
 
 pytestmark = pytest.mark.require_driver("PMTiles")
 
@@ -569,6 +569,233 @@ def test_ogr_pmtiles_write():
             gdal.Unlink(filename)
 
 
+###############################################################################
+# Check that writing directly to PMTiles produces the same tiles as going
+# through MBTiles, whatever the number of threads and whether the sort of the
+# temporary features spills to a temporary file or not
+
+
+@pytest.mark.require_driver("MBTiles")
+# MBTiles vector writing mode requires SQLite and GEOS
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("sort_buffer_size", [None, "1KB"])
+def test_ogr_pmtiles_write_direct_same_as_mbtiles(
+    tmp_vsimem, num_threads, sort_buffer_size
+):
+
+    mbtiles_filename = str(tmp_vsimem / "test.mbtiles")
+    pmtiles_filename = str(tmp_vsimem / "out" / "test.pmtiles")
+    gdal.Mkdir(str(tmp_vsimem / "out"), 0o755)
+
+    debug_msg_list = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msg_list.append(msg)
+
+    options = "-s_srs EPSG:32631 -t_srs EPSG:3857 -dsco MAXZOOM=8"
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        gdal.VectorTranslate(mbtiles_filename, "data/poly.shp", options=options)
+        if sort_buffer_size:
+            options += " -dsco SORT_BUFFER_SIZE=" + sort_buffer_size
+        gdal.PushErrorHandler(handler)
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        try:
+            with gdaltest.config_option("CPL_DEBUG", "MVT"):
+                gdal.VectorTranslate(
+                    pmtiles_filename, "data/poly.shp", options=options
+                )
+        finally:
+            gdal.PopErrorHandler()
+
+    # The temporary features have been spilled to sorted runs
+    merged = any(msg.startswith("Merging") for msg in debug_msg_list)
+    assert merged == (sort_buffer_size is not None)
+
+    # No temporary file left behind
+    assert gdal.ReadDir(str(tmp_vsimem / "out")) == ["test.pmtiles"]
+
+    src_ds = ogr.Open(mbtiles_filename)
+    expected_md = src_ds.GetMetadata()
+    src_ds = None
+    expected_md["scheme"] = "xyz"
+    ds = ogr.Open(pmtiles_filename)
+    got_md = ds.GetMetadata()
+    del got_md["ZOOM_LEVEL"]
+    del expected_md["ZOOM_LEVEL"]
+    assert got_md == expected_md
+    ds = None
+
+    count = 0
+    src_ds_sqlite3 = gdal.OpenEx(mbtiles_filename, allowed_drivers=["SQLite"])
+    with src_ds_sqlite3.ExecuteSQL(
+        "SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles"
+    ) as lyr:
+        for f in lyr:
+            z = f["zoom_level"]
+            x = f["tile_column"]
+            # MBTiles y=0 origin is bottom-most tile, whereas PMTiles is top-most
+            y = (1 << z) - 1 - f["tile_row"]
+            tile_data = f.GetFieldAsBinary("tile_data")
+            fp = gdal.VSIFOpenL(
+                f"/vsipmtiles/{pmtiles_filename}/{z}/{x}/{y}.mvt", "rb"
+            )
+            assert fp, (z, x, y)
+            try:
+                got_data = gdal.VSIFReadL(1, len(tile_data) + 1, fp)
+            finally:
+                gdal.VSIFCloseL(fp)
+            assert got_data == tile_data, (z, x, y)
+            count += 1
+    src_ds_sqlite3 = None
+    assert count > 0
+
+    f = gdal.VSIFOpenL(f"/vsipmtiles/{pmtiles_filename}/pmtiles_header.json", "rb")
+    assert f
+    try:
+        data = gdal.VSIFReadL(1, 10000, f)
+    finally:
+        gdal.VSIFCloseL(f)
+    got = json.loads(data)
+    assert got["addressed_tiles_count"] == count
+    assert got["clustered"]
+
+
+###############################################################################
+# Test deduplication and run-length encoding of tiles when writing directly
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+@pytest.mark.parametrize("sort_buffer_size", [None, "1KB"])
+def test_ogr_pmtiles_write_direct_deduplication(tmp_vsimem, sort_buffer_size):
+
+    pmtiles_filename = str(tmp_vsimem / "test.pmtiles")
+    options = ["MINZOOM=2", "MAXZOOM=2"]
+    if sort_buffer_size:
+        options.append("SORT_BUFFER_SIZE=" + sort_buffer_size)
+    ds = ogr.GetDriverByName("PMTiles").CreateDataSource(
+        pmtiles_filename, options=options
+    )
+    lyr = ds.CreateLayer("test")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt(
+            "POLYGON((-20000000 -20000000,-20000000 20000000,20000000 20000000,20000000 -20000000,-20000000 -20000000))"
+        )
+    )
+    lyr.CreateFeature(f)
+    ds = None
+
+    f = gdal.VSIFOpenL(f"/vsipmtiles/{pmtiles_filename}/pmtiles_header.json", "rb")
+    assert f
+    try:
+        data = gdal.VSIFReadL(1, 10000, f)
+    finally:
+        gdal.VSIFCloseL(f)
+    got = json.loads(data)
+
+    expected = {
+        "addressed_tiles_count": 16,
+        "tile_contents_count": 9,
+        "tile_entries_count": 13,
+    }
+
+    for key in expected:
+        assert got[key] == expected[key], (key, got)
+
+    assert gdal.ReadDir(str(tmp_vsimem)) == ["test.pmtiles"]
+
+
+###############################################################################
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+@pytest.mark.parametrize("sort_buffer_size", ["0", "invalid"])
+def test_ogr_pmtiles_write_invalid_sort_buffer_size(tmp_vsimem, sort_buffer_size):
+
+    with pytest.raises(Exception, match="Invalid value for SORT_BUFFER_SIZE"):
+        ogr.GetDriverByName("PMTiles").CreateDataSource(
+            str(tmp_vsimem / "test.pmtiles"),
+            options=["SORT_BUFFER_SIZE=" + sort_buffer_size],
+        )
+
+
+###############################################################################
+# Test the cache of decoded tiles
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+def test_ogr_pmtiles_read_decoded_tile_cache(tmp_vsimem):
+
+    pmtiles_filename = str(tmp_vsimem / "test.pmtiles")
+    ds = ogr.GetDriverByName("PMTiles").CreateDataSource(
+        pmtiles_filename, options=["MINZOOM=5", "MAXZOOM=5"]
+    )
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(3857)
+    lyr = ds.CreateLayer("test", srs=srs)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    # One point at the center of each of 40 tiles
+    tile_dim = 2 * 20037508.342789244 / 32
+    centers = []
+    for x in range(8):
+        for y in range(5):
+            center = (
+                -20037508.342789244 + (x + 0.5) * tile_dim,
+                20037508.342789244 - (y + 0.5) * tile_dim,
+            )
+            centers.append(center)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["id"] = len(centers)
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%.3f %.3f)" % center))
+            lyr.CreateFeature(f)
+    ds = None
+
+    debug_msg_list = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msg_list.append(msg)
+
+    def read_layer(lyr):
+        del debug_msg_list[:]
+        gdal.PushErrorHandler(handler)
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        try:
+            with gdaltest.config_option("CPL_DEBUG", "PMTiles"):
+                ids = [f["id"] for f in lyr]
+        finally:
+            gdal.PopErrorHandler()
+        decoded = len([x for x in debug_msg_list if x.startswith("Decoding tile")])
+        reused = len([x for x in debug_msg_list if x.startswith("Reusing decoded")])
+        return ids, decoded, reused
+
+    ds = ogr.Open(pmtiles_filename)
+    lyr = ds.GetLayer(0)
+
+    ids, decoded, reused = read_layer(lyr)
+    assert sorted(ids) == list(range(1, 41))
+    assert (decoded, reused) == (40, 0)
+
+    # The first read tile has been evicted by the 39 other ones
+    x, y = centers[ids[0] - 1]
+    lyr.SetSpatialFilterRect(x - 1000, y - 1000, x + 1000, y + 1000)
+    assert read_layer(lyr) == ([ids[0]], 1, 0)
+
+    # Cache hit
+    assert read_layer(lyr) == ([ids[0]], 0, 1)
+
+    # The last read tile is still cached
+    x, y = centers[ids[-1] - 1]
+    lyr.SetSpatialFilterRect(x - 1000, y - 1000, x + 1000, y + 1000)
+    assert read_layer(lyr) == ([ids[-1]], 0, 1)
+
+
 ###############################################################################
 
 
@@ -31,6 +31,7 @@ import shutil
 import struct
 import sys
 import time
+from threading import Thread
 
 import gdaltest
 import ogrtest
@@ -1057,6 +1058,36 @@ def test_ogr_shape_read_multipolygon_as_invalid_polygon_no_warning():
         assert gdal.GetLastErrorMsg() == ""
 
 
+###############################################################################
+# Test that the identification of the SRS of a .prj file gives the same
+# result, whether it comes from the cache of the current thread, of another
+# thread or not.
+
+
+def test_ogr_shape_srs_identification_threads():
+    def get_srs(res, idx):
+        ds = ogr.Open("data/shp/cb_2022_us_county_20m_extract.shp")
+        srs = ds.GetLayer(0).GetSpatialRef()
+        res[idx] = (
+            srs.GetAuthorityCode(None),
+            srs.GetDataAxisToSRSAxisMapping(),
+            srs.ExportToWkt(),
+        )
+
+    res = [None] * 5
+    get_srs(res, 0)
+    assert res[0][0] == "4269"
+    get_srs(res, 1)
+
+    threads = [Thread(target=get_srs, args=(res, i)) for i in range(2, 5)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert res == [res[0]] * 5
+
+
 ###############################################################################
 # Test alternate date formatting (#2746)
 
@@ -5911,7 +5942,7 @@ def test_ogr_shape_arrow_stream():
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 5
@@ -6008,7 +6039,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     )
     assert len(batches) == 0
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[0:-1])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6017,14 +6048,14 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
     assert len(batches[0]["OGC_FID"]) == 10
     assert list(batches[0]["OGC_FID"]) == [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[1:])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6033,7 +6064,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
@@ -6105,6 +6136,93 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Test that the optimized GetArrowStream() code path returns the same content
+# as the generic one, with all field types, null values, deleted records and
+# ignored fields
+
+
+@pytest.mark.parametrize("geom_type", [ogr.wkbPoint, ogr.wkbPolygon25D])
+def test_ogr_shape_arrow_stream_optimized_vs_generic(tmp_vsimem, geom_type):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_optimized.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer("test", geom_type=geom_type, options=["AUTO_REPACK=NO"])
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 3 != 0:
+            f["str"] = "\u00e9t\u00e9 %d" % i
+            f["bool"] = i % 2
+            f["int32"] = -i * 1000
+            f["int64"] = i * 10000000000
+            f["real"] = i + 0.5
+            f["date"] = "2024/01/%02d" % (i + 1)
+        if i % 4 != 0:
+            if geom_type == ogr.wkbPoint:
+                wkt = "POINT (%d 2)" % i
+            else:
+                wkt = "POLYGON Z ((0 0 %d,0 1 0,1 1 0,0 0 %d))" % (i, i)
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    lyr.DeleteFeature(5)
+    ds.Close()
+
+    def get_batches(lyr, options):
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"] + options)
+        ret = []
+        for batch in stream:
+            ret.append(
+                {
+                    k: [bytes(x) if x is not None else None for x in v]
+                    if k in ("str", "wkb_geometry")
+                    else list(v)
+                    for k, v in batch.items()
+                }
+            )
+        return ret
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    for ignored_fields in ([], ["int32", "date"], ["OGR_GEOMETRY", "str"]):
+        lyr.SetIgnoredFields(ignored_fields)
+        for options in ([], ["MAX_FEATURES_IN_BATCH=3"]):
+            optimized = get_batches(lyr, options)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+                )
+                == "YES"
+            )
+
+            lyr.SetAttributeFilter("1 = 1")
+            generic = get_batches(lyr, options)
+            lyr.SetAttributeFilter(None)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+                )
+                == "NO"
+            )
+
+            assert optimized == generic
+            assert sum(len(batch["OGC_FID"]) for batch in optimized) == 9
+            for batch in optimized:
+                for fieldname in ignored_fields:
+                    assert fieldname not in batch
+
+
 ###############################################################################
 # Test DBF Logical field type
 
@@ -6193,3 +6311,45 @@ def test_ogr_shape_write_check_golden_file(tmp_path, src_directory):
         assert (
             open(src_filename, "rb").read() == open(out_filename, "rb").read()
         ), filename
+
+
+###############################################################################
+# Test interleaving writes, which are buffered, with reads and updates
+
+
+def test_ogr_shape_write_buffered_interleaved_with_reads(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("str", ogr.OFTString)
+    fld_defn.SetWidth(200)
+    lyr.CreateField(fld_defn)
+
+    N = 5000
+    for i in range(N):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = i
+        f["str"] = "x" * (1 + i % 199)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {-i})"))
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+        if (i % 997) == 0:
+            j = i // 2
+            f = lyr.GetFeature(j)
+            assert f["int"] == j
+            assert f["str"] == "x" * (1 + j % 199)
+            assert f.GetGeometryRef().ExportToWkt() == f"POINT ({j} {-j})"
+        if (i % 1999) == 0:
+            f = lyr.GetFeature(i)
+            f["int"] = -i
+            assert lyr.SetFeature(f) == ogr.OGRERR_NONE
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == N
+    for i, f in enumerate(lyr):
+        assert f["int"] == (-i if (i % 1999) == 0 else i)
+        assert f["str"] == "x" * (1 + i % 199)
+        assert f.GetGeometryRef().ExportToWkt() == f"POINT ({i} {-i})"
@@ -2493,3 +2493,138 @@ def test_ogr_sql_sqlite_execute_sql_error_on_spatial_filter_shp_layer(tmp_vsimem
         Exception, match="Cannot set spatial filter: no geometry field present in layer"
     ):
         ds.ExecuteSQL("SELECT 1 FROM test", spatialFilter=geom, dialect="SQLITE")
+
+
+###############################################################################
+# Test GetArrowStream() on the result of a SQLite dialect request
+
+
+@pytest.mark.parametrize("spatial_filter", [False, True])
+def test_ogr_sql_sqlite_arrow_stream(spatial_filter):
+    pytest.importorskip("osgeo.gdal_array")
+    numpy = pytest.importorskip("numpy")
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+
+    wkts = [
+        "POINT (1 2)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "POLYGON ((0 0,0 1,1 1,0 0))",
+        "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 0,10 1,11 1,10 0)))",
+        "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (3 4,5 6))",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        None,
+    ]
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 2 == 0:
+            f["str"] = "abc" * i
+            f["bool"] = i % 4 == 0
+            f["int32"] = i
+            f["int64"] = 1234567890123 * i
+            f["float64"] = 1.25 * i
+            f["date"] = "2022-05-31"
+            f["datetime"] = "2022-05-31T12:34:56.789"
+            f["binary"] = b"\xDE\xAD"
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+
+    def get_batches(sql_lyr):
+        stream = sql_lyr.GetArrowStreamAsNumPy(
+            options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=3"]
+        )
+        return [batch for batch in stream]
+
+    geom_filter = (
+        ogr.CreateGeometryFromWkt("POLYGON ((-1 -1,-1 3,3 3,3 -1,-1 -1))")
+        if spatial_filter
+        else None
+    )
+    with ds.ExecuteSQL(
+        "SELECT * FROM test", spatialFilter=geom_filter, dialect="SQLITE"
+    ) as sql_lyr:
+        assert sql_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+        geom_col = sql_lyr.GetGeometryColumn() or "wkb_geometry"
+        batches = get_batches(sql_lyr)
+        with gdaltest.config_option("OGR_SQLITE_STREAM_BASE_IMPL", "YES"):
+            assert sql_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+            ref_batches = get_batches(sql_lyr)
+
+    assert len(batches) == len(ref_batches)
+    for batch, ref_batch in zip(batches, ref_batches):
+        assert batch.keys() == ref_batch.keys()
+        for key in batch:
+            if key == geom_col:
+                for wkb, ref_wkb in zip(batch[key], ref_batch[key]):
+                    if ref_wkb is None:
+                        assert wkb is None
+                    else:
+                        assert ogr.CreateGeometryFromWkb(wkb).Equals(
+                            ogr.CreateGeometryFromWkb(ref_wkb)
+                        )
+            elif key in ("str", "binary"):
+                assert [bytes(x) if x is not None else None for x in batch[key]] == [
+                    bytes(x) if x is not None else None for x in ref_batch[key]
+                ]
+            else:
+                numpy.testing.assert_array_equal(batch[key], ref_batch[key])
+
+
+###############################################################################
+# Test push-down of IN (...) constraints and of the list of used columns
+# to the source layer
+
+
+def test_ogr_sql_sqlite_in_and_column_push_down():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("a", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("b", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("c", ogr.OFTReal))
+    for i in range(5):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["a"] = i
+        f["b"] = "val%d" % i
+        f["c"] = 1.5 * i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+    lyr.SetIgnoredFields(["c"])
+
+    with ds.ExecuteSQL(
+        "SELECT a FROM test WHERE a IN (1, 3, NULL) ORDER BY a", dialect="SQLITE"
+    ) as sql_lyr:
+        assert [f["a"] for f in sql_lyr] == [1, 3]
+
+    with ds.ExecuteSQL(
+        "SELECT a, b FROM test WHERE b IN ('val0', 'val4', 'other') "
+        "AND a <> 0 ORDER BY a",
+        dialect="SQLITE",
+    ) as sql_lyr:
+        assert [(f["a"], f["b"]) for f in sql_lyr] == [(4, "val4")]
+
+    with ds.ExecuteSQL(
+        "SELECT b FROM test WHERE a IN (2) AND geometry IS NOT NULL",
+        dialect="SQLITE",
+    ) as sql_lyr:
+        assert [f["b"] for f in sql_lyr] == ["val2"]
+
+    # Ignored fields of the source layer must be restored
+    lyr_defn = lyr.GetLayerDefn()
+    assert not lyr_defn.GetFieldDefn(0).IsIgnored()
+    assert not lyr_defn.GetFieldDefn(1).IsIgnored()
+    assert lyr_defn.GetFieldDefn(2).IsIgnored()
+    assert not lyr_defn.IsGeometryIgnored()
+    assert not lyr_defn.IsStyleIgnored()
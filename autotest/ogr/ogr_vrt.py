@@ -3447,3 +3447,97 @@ def test_ogr_vrt_srcregion_and_point_filter():
 
     lyr.SetSpatialFilter(None)
     assert lyr.GetFeatureCount() == 10
+
+
+###############################################################################
+# Test NumThreads and PreserveSourceOrder of OGRVRTUnionLayer
+
+
+@pytest.mark.parametrize("max_opened", [None, "2"])
+def test_ogr_vrt_union_layer_num_threads(tmp_path, max_opened):
+
+    nsrc = 20
+    src_layers = ""
+    for i in range(nsrc):
+        filename = str(tmp_path / f"src_{i}.shp")
+        with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer(f"src_{i}", geom_type=ogr.wkbPoint)
+            lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+            if i % 2 == 0:
+                lyr.CreateField(ogr.FieldDefn("even", ogr.OFTString))
+            for j in range(3 + i % 4):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["id"] = i * 100 + j
+                if i % 2 == 0:
+                    f["even"] = "yes"
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {j})"))
+                lyr.CreateFeature(f)
+        src_layers += f"""<OGRVRTLayer name="src_{i}">
+            <SrcDataSource>{filename}</SrcDataSource>
+        </OGRVRTLayer>"""
+
+    def get_vrt(extra):
+        return f"""<OGRVRTDataSource>
+            <OGRVRTUnionLayer name="union_layer">
+                <SourceLayerFieldName>source</SourceLayerFieldName>
+                {src_layers}
+                {extra}
+            </OGRVRTUnionLayer>
+        </OGRVRTDataSource>"""
+
+    def get_features(lyr):
+        return [
+            (
+                f.GetFID(),
+                f["source"],
+                f["id"],
+                f["even"],
+                f.GetGeometryRef().ExportToWkt(),
+            )
+            for f in lyr
+        ]
+
+    with gdaltest.config_option("OGR_VRT_MAX_OPENED", max_opened):
+        with ogr.Open(get_vrt("")) as ds:
+            lyr = ds.GetLayer(0)
+            expected = get_features(lyr)
+            expected_count = lyr.GetFeatureCount()
+            expected_extent = lyr.GetExtent()
+            lyr.SetAttributeFilter("id >= 1002")
+            expected_filtered = get_features(lyr)
+
+        with ogr.Open(get_vrt("<NumThreads>4</NumThreads>")) as ds:
+            lyr = ds.GetLayer(0)
+            assert lyr.GetLayerDefn().GetFieldCount() == 3
+            assert get_features(lyr) == expected
+            assert get_features(lyr) == expected
+            assert lyr.GetFeatureCount() == expected_count
+            assert lyr.GetExtent() == expected_extent
+
+            # Interrupt reading
+            lyr.ResetReading()
+            for i in range(5):
+                lyr.GetNextFeature()
+            assert lyr.GetFeatureCount() == expected_count
+            assert get_features(lyr) == expected
+
+            lyr.SetAttributeFilter("id >= 1002")
+            assert get_features(lyr) == expected_filtered
+            lyr.SetAttributeFilter(None)
+
+            lyr.SetSpatialFilterRect(4.5, -1, 7.5, 10)
+            assert set(f[1] for f in get_features(lyr)) == set(
+                ["src_5", "src_6", "src_7"]
+            )
+            lyr.SetSpatialFilter(None)
+
+        with ogr.Open(
+            get_vrt(
+                "<NumThreads>ALL_CPUS</NumThreads>"
+                "<PreserveSourceOrder>OFF</PreserveSourceOrder>"
+            )
+        ) as ds:
+            lyr = ds.GetLayer(0)
+            got = get_features(lyr)
+            assert sorted(x[1:] for x in got) == sorted(x[1:] for x in expected)
+            assert sorted(x[0] for x in got) == list(range(len(expected)))
@@ -1742,11 +1742,45 @@ def test_osr_get_name():
     assert sr.GetName() == "WGS 84"
 
 
+###############################################################################
+# Test that objects cached by a thread can be used by other ones
+
+
+def test_osr_basic_cache_shared_by_threads():
+
+    wkt = osr.SpatialReference(
+        'PROJCS["unnamed",GEOGCS["WGS 84",DATUM["WGS_1984",'
+        'SPHEROID["WGS 84",6378137,298.257223563]],PRIMEM["Greenwich",0],'
+        'UNIT["degree",0.0174532925199433]],PROJECTION["Mercator_1SP"],'
+        'PARAMETER["central_meridian",0],PARAMETER["scale_factor",1],'
+        'PARAMETER["false_easting",0],PARAMETER["false_northing",0],'
+        'UNIT["metre",1]]'
+    ).ExportToWkt()
+
+    def threaded_function(res, idx):
+        sr = osr.SpatialReference()
+        sr.ImportFromEPSG(32631)
+        sr2 = osr.SpatialReference()
+        sr2.ImportFromWkt(wkt)
+        res[idx] = (sr.ExportToWkt(["FORMAT=WKT2_2019"]), sr2.ExportToWkt())
+
+    res = [None] * 5
+    threaded_function(res, 0)
+    threads = [Thread(target=threaded_function, args=(res, i)) for i in range(1, 5)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert res == [res[0]] * 5
+    assert 'ID["EPSG",32631]' in res[0][0]
+
+
 def test_SetPROJSearchPath():
 
     # Do the test in a new thread, so that the EPSG code cache which is thread
     # locale is not used, and we can effectively test that the new search path
-    # is used
+    # is used (the process-wide cache is emptied when it changes)
     def threaded_function(arg):
         sr = osr.SpatialReference()
         try:
@@ -1784,7 +1818,7 @@ def test_Set_PROJ_DATA_config_option():
 
     # Do the test in a new thread, so that the EPSG code cache which is thread
     # locale is not used, and we can effectively test that the new search path
-    # is used
+    # is used (the process-wide cache is emptied when it changes)
     def threaded_function(arg):
         sr = osr.SpatialReference()
         try:
@@ -293,6 +293,53 @@ def test_osr_ct_8():
                 pytest.fail("Failed to transform from Pseudo Mercator to LL")
 
 
+###############################################################################
+# Test WGS84 -> WebMercator optimized transform against PROJ
+
+
+@pytest.mark.parametrize("axis_order", ["traditional", "authority"])
+def test_osr_ct_wgs84_to_webmercator(axis_order):
+
+    src_srs = osr.SpatialReference()
+    src_srs.ImportFromEPSG(4326)
+    if axis_order == "traditional":
+        src_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(3857)
+
+    ct = osr.CoordinateTransformation(src_srs, dst_srs)
+
+    options = osr.CoordinateTransformationOptions()
+    options.SetOperation(
+        "+proj=pipeline +step +proj=axisswap +order=2,1 "
+        "+step +proj=unitconvert +xy_in=deg +xy_out=rad "
+        "+step +proj=webmerc +ellps=WGS84"
+    )
+    ct_proj = osr.CoordinateTransformation(src_srs, dst_srs, options)
+
+    pnts = [
+        (0, 0),
+        (2.35, 48.85),
+        (2.35, 48.85),
+        (-179.99, -85.05),
+        (180, 85.0511287798066),
+        (190, 10),
+        (-540, 10),
+    ]
+    if axis_order == "authority":
+        pnts = [(y, x) for x, y in pnts]
+    result = ct.TransformPoints(pnts)
+    expected_result = ct_proj.TransformPoints(pnts)
+    for i in range(len(pnts)):
+        assert result[i] == pytest.approx(expected_result[i], abs=1e-6), i
+
+    with osr.ExceptionMgr(useExceptions=False), gdal.quiet_errors():
+        for lat in (90, -90, 90.5, float("nan")):
+            pnt = (0, lat) if axis_order == "traditional" else (lat, 0)
+            assert math.isinf(ct.TransformPoints([pnt])[0][0])
+
+
 ###############################################################################
 # Test coordinate transformation where only one CRS has a towgs84 clause (#1156)
 
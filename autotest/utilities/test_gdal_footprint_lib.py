@@ -741,3 +741,53 @@ def test_gdal_footprint_lib_writeAbsolutePath():
     lyr = out_ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert os.path.isabs(f["location"])
+
+
+###############################################################################
+# Test numThreads, i.e. vectorization by strips in worker threads
+
+
+@pytest.mark.parametrize("driver_name", ["GTiff", "MEM"])
+@pytest.mark.parametrize("split_polys", [False, True])
+def test_gdal_footprint_lib_numThreads(tmp_vsimem, driver_name, split_polys):
+
+    src_filename = str(tmp_vsimem / "src.tif") if driver_name == "GTiff" else ""
+    options = ["BLOCKYSIZE=16"] if driver_name == "GTiff" else []
+    src_ds = gdal.GetDriverByName(driver_name).Create(
+        src_filename, 1000, 1000, 1, options=options
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+
+    def fill(xoff, yoff, xsize, ysize, val):
+        src_ds.GetRasterBand(1).WriteRaster(
+            xoff, yoff, xsize, ysize, bytes([val]) * (xsize * ysize)
+        )
+
+    # Polygon with a hole crossing several strips, an island and a staircase
+    fill(100, 50, 800, 900, 255)
+    fill(400, 300, 200, 400, 0)
+    fill(450, 400, 50, 100, 1)
+    fill(950, 10, 40, 980, 255)
+    for i in range(0, 1000, 7):
+        fill(i // 20, i, 3, 7, 255)
+
+    def get_geoms(num_threads):
+        out_ds = gdal.Footprint(
+            "",
+            src_ds,
+            format="MEM",
+            targetCoordinateSystem="pixel",
+            maxPoints="unlimited",
+            splitPolys=split_polys,
+            numThreads=num_threads,
+        )
+        return [f.GetGeometryRef().Clone() for f in out_ds.GetLayer(0)]
+
+    ref_geoms = get_geoms(1)
+    geoms = get_geoms(4)
+    assert len(geoms) == len(ref_geoms)
+    if split_polys:
+        ref_geoms.sort(key=lambda g: g.GetEnvelope())
+        geoms.sort(key=lambda g: g.GetEnvelope())
+    for geom, ref_geom in zip(geoms, ref_geoms):
+        assert geom.Equals(ref_geom), (geom.ExportToWkt(), ref_geom.ExportToWkt())
@@ -1120,3 +1120,54 @@ def test_gdal_grid_lib_errors():
             algorithm="invdist",
             SQLStatement="invalid",
         )
+
+
+###############################################################################
+# Test that searching points through the point index gives the same results
+# as the exhaustive search
+
+
+@pytest.mark.parametrize(
+    "alg",
+    [
+        "nearest",
+        "nearest:radius1=3:radius2=3:nodata=-1",
+        "average:radius1=5:radius2=5:nodata=-1",
+        "minimum:radius1=4:radius2=4:nodata=-1",
+        "count:radius1=4:radius2=4",
+        "average_distance:radius1=4:radius2=4:nodata=-1",
+    ],
+)
+@pytest.mark.require_driver("GeoJSON")
+def test_gdal_grid_lib_point_index(alg):
+
+    # Deterministic pseudo-random points, denser in one corner, on an
+    # elongated extent
+    points = []
+    seed = 1
+    for i in range(2000):
+        seed = (seed * 1103515245 + 12345) % (1 << 31)
+        x = (seed % 100000) / 1000.0
+        seed = (seed * 1103515245 + 12345) % (1 << 31)
+        y = (seed % 100000) / 5000.0
+        if i % 3 == 0:
+            x /= 10
+            y /= 10
+        points.append(f"{x} {y} {i % 97}")
+    src = ogr.CreateGeometryFromWkt("MULTIPOINT(" + ",".join(points) + ")")
+
+    def run(threshold):
+        with gdaltest.config_option("GDAL_GRID_POINT_COUNT_THRESHOLD", threshold):
+            ds = gdal.Grid(
+                "",
+                src.ExportToJson(),
+                width=50,
+                height=20,
+                outputBounds=[0, 0, 100, 20],
+                outputType=gdal.GDT_Float64,
+                format="MEM",
+                algorithm=alg,
+            )
+        return struct.unpack("d" * 50 * 20, ds.ReadRaster())
+
+    assert run("0") == pytest.approx(run("1000000000"), rel=1e-12)
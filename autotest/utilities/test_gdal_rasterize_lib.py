@@ -812,3 +812,41 @@ def test_gdal_rasterize_no_options(tmp_vsimem):
 
     # Call rasterize
     ds = gdal.Rasterize(target_ds, ds)
+
+
+###############################################################################
+# Check that multi-threaded rasterization, with geometries binned by chunk,
+# gives the same result as the single-threaded path
+
+
+@pytest.mark.parametrize("extra_options", [[], ["-at"], ["-add"], ["-at", "-add"]])
+def test_gdal_rasterize_lib_num_threads(extra_options):
+
+    vector_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0)
+    lyr = vector_ds.CreateLayer("test")
+    wkts = []
+    for i in range(40):
+        x = (i * 37) % 180
+        y = (i * 53) % 180
+        wkts.append(f"POLYGON(({x} {y},{x + 25} {y + 3},{x + 17} {y + 31},{x} {y}))")
+        wkts.append(f"LINESTRING({y} {x},{x + 10} {y + 40},{x + 30} {y})")
+        wkts.append(f"POINT({x + 0.5} {y + 0.5})")
+    for wkt in wkts:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+
+    def rasterize(options):
+        ds = gdal.GetDriverByName("MEM").Create("", 200, 200)
+        ds.SetGeoTransform([0, 1, 0, 200, 0, -1])
+        gdal.Rasterize(
+            ds,
+            vector_ds,
+            options=["-burn", "1", "-optim", "RASTER"] + extra_options + options,
+        )
+        return ds.ReadRaster()
+
+    expected = rasterize(["-num_threads", "1"])
+    assert rasterize(["-num_threads", "1", "-chunkysize", "7"]) == expected
+    assert rasterize(["-num_threads", "4"]) == expected
+    assert rasterize(["-num_threads", "4", "-chunkysize", "7"]) == expected
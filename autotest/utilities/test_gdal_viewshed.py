@@ -230,6 +230,36 @@ def test_gdal_viewshed_cumulative(gdal_viewshed_path, tmp_path, viewshed_input):
 ###############################################################################
 
 
+def test_gdal_viewshed_cumulative_max_distance(
+    gdal_viewshed_path, tmp_path, viewshed_input
+):
+
+    def run(extra_args):
+        viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
+        _, err = gdaltest.runexternal_out_and_err(
+            gdal_viewshed_path
+            + " -om ACCUM -f GTiff -os 10 {} {} {}".format(
+                extra_args, viewshed_input, viewshed_out
+            )
+        )
+        assert err is None or err == ""
+        ds = gdal.Open(viewshed_out)
+        assert ds
+        assert ds.RasterXSize == gdal.Open(viewshed_input).RasterXSize
+        return ds.GetRasterBand(1).Checksum()
+
+    cs_ref = run("")
+    # A maximum distance larger than the raster gives the same result
+    assert run("-md 1e7") == cs_ref
+    # A smaller one restricts what each observer sees
+    cs_md = run("-md 1000")
+    assert cs_md != cs_ref
+    assert cs_md != 0
+
+
+###############################################################################
+
+
 def test_gdal_viewshed_value_options(gdal_viewshed_path, tmp_path, viewshed_input):
 
     viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
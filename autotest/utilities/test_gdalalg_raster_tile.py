@@ -0,0 +1,233 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+# Project:  GDAL/OGR Test Suite
+# Purpose:  'gdal raster tile' testing
+#
+###############################################################################
+# Copyright (c) 2025, GDAL contributors
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import pytest
+
+from osgeo import gdal
+
+pytestmark = pytest.mark.require_driver("PNG")
+
+
+def get_tile_alg():
+    reg = gdal.GetGlobalAlgorithmRegistry()
+    raster = reg.InstantiateAlg("raster")
+    return raster.InstantiateSubAlgorithm("tile")
+
+
+def list_tiles(dirname):
+    return sorted(x for x in gdal.ReadDirRecursive(dirname) if not x.endswith("/"))
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_gdalalg_raster_tile(tmp_vsimem, num_threads):
+
+    last_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        last_pct[0] = pct
+        return True
+
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--min-zoom=0",
+            "--max-zoom=2",
+            "--num-threads",
+            num_threads,
+            "../gdrivers/data/small_world.tif",
+            str(tmp_vsimem),
+        ],
+        my_progress,
+    )
+    assert last_pct[0] == 1.0
+
+    tiles = list_tiles(str(tmp_vsimem))
+    assert len(tiles) == 1 + 4 + 16
+    assert "0/0/0.png" in tiles
+    assert "2/3/3.png" in tiles
+
+    with gdal.Open(str(tmp_vsimem / "0" / "0" / "0.png")) as ds:
+        assert ds.RasterCount == 4
+        assert ds.RasterXSize == 256
+        assert ds.RasterYSize == 256
+
+    # Compare a tile of the maximum zoom level with gdalwarp output
+    with gdal.Open(str(tmp_vsimem / "2" / "1" / "1.png")) as ds:
+        got = ds.ReadRaster()
+    extent = 20037508.342789244
+    tile_extent = extent / 2
+    ref_ds = gdal.Warp(
+        "",
+        "../gdrivers/data/small_world.tif",
+        format="MEM",
+        dstSRS="EPSG:3857",
+        outputBounds=[
+            -extent + tile_extent,
+            0,
+            -extent + 2 * tile_extent,
+            tile_extent,
+        ],
+        width=256,
+        height=256,
+        resampleAlg="cubic",
+        dstAlpha=True,
+    )
+    expected = ref_ds.ReadRaster()
+    max_diff = max(abs(a - b) for a, b in zip(got, expected))
+    assert max_diff <= 1
+
+
+def test_gdalalg_raster_tile_same_output_whatever_num_threads(tmp_vsimem):
+
+    checksums = []
+    for num_threads in ("1", "4"):
+        out_dir = str(tmp_vsimem / num_threads)
+        alg = get_tile_alg()
+        assert alg.ParseRunAndFinalize(
+            [
+                "--min-zoom=0",
+                "--max-zoom=3",
+                "--metatile-size=2",
+                "-j",
+                num_threads,
+                "../gdrivers/data/small_world.tif",
+                out_dir,
+            ]
+        )
+        tiles = list_tiles(out_dir)
+        cs = []
+        for tile in tiles:
+            with gdal.Open(out_dir + "/" + tile) as ds:
+                cs.append(
+                    (
+                        tile,
+                        [
+                            ds.GetRasterBand(i + 1).Checksum()
+                            for i in range(ds.RasterCount)
+                        ],
+                    )
+                )
+        checksums.append(cs)
+    assert checksums[0] == checksums[1]
+
+
+def test_gdalalg_raster_tile_tms_convention(tmp_vsimem):
+
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--min-zoom=1",
+            "--max-zoom=1",
+            "--convention=tms",
+            "../gdrivers/data/small_world.tif",
+            str(tmp_vsimem / "tms"),
+        ]
+    )
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--min-zoom=1",
+            "--max-zoom=1",
+            "../gdrivers/data/small_world.tif",
+            str(tmp_vsimem / "xyz"),
+        ]
+    )
+    for x in range(2):
+        for y in range(2):
+            tms_filename = str(tmp_vsimem / "tms" / "1" / str(x) / f"{y}.png")
+            xyz_filename = str(tmp_vsimem / "xyz" / "1" / str(x) / f"{1 - y}.png")
+            with gdal.Open(tms_filename) as ds, gdal.Open(xyz_filename) as ds_ref:
+                assert ds.ReadRaster() == ds_ref.ReadRaster()
+
+
+def test_gdalalg_raster_tile_skip_transparent_tiles(tmp_vsimem):
+
+    # byte.tif covers a very small area: only one tile per zoom level
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--min-zoom=10",
+            "--max-zoom=12",
+            "../gcore/data/byte.tif",
+            str(tmp_vsimem),
+        ]
+    )
+    tiles = list_tiles(str(tmp_vsimem))
+    assert len(tiles) >= 3
+    assert set(x.split("/")[0] for x in tiles) == set(["10", "11", "12"])
+    for tile in tiles:
+        with gdal.Open(str(tmp_vsimem / tile)) as ds:
+            # Grey + alpha
+            assert ds.RasterCount == 2
+            assert ds.GetRasterBand(2).ComputeRasterMinMax()[1] == 255
+
+
+def test_gdalalg_raster_tile_color_table(tmp_vsimem):
+
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--min-zoom=0",
+            "--max-zoom=0",
+            "../gdrivers/data/small_world_pct.tif",
+            str(tmp_vsimem),
+        ]
+    )
+    with gdal.Open(str(tmp_vsimem / "0" / "0" / "0.png")) as ds:
+        assert ds.RasterCount == 4
+        assert ds.GetRasterBand(1).GetColorTable() is None
+
+
+@pytest.mark.require_driver("JPEG")
+def test_gdalalg_raster_tile_jpeg(tmp_vsimem):
+
+    alg = get_tile_alg()
+    assert alg.ParseRunAndFinalize(
+        [
+            "--format=JPEG",
+            "--min-zoom=0",
+            "--max-zoom=1",
+            "../gdrivers/data/small_world.tif",
+            str(tmp_vsimem),
+        ]
+    )
+    tiles = list_tiles(str(tmp_vsimem))
+    assert len(tiles) == 5
+    with gdal.Open(str(tmp_vsimem / "0" / "0" / "0.jpg")) as ds:
+        assert ds.RasterCount == 3
+
+
+def test_gdalalg_raster_tile_invalid_tiling_scheme(tmp_vsimem):
+
+    alg = get_tile_alg()
+    with pytest.raises(Exception):
+        alg.ParseRunAndFinalize(
+            [
+                "--tiling-scheme=invalid",
+                "../gcore/data/byte.tif",
+                str(tmp_vsimem),
+            ]
+        )
+
+
+def test_gdalalg_raster_tile_invalid_zoom(tmp_vsimem):
+
+    alg = get_tile_alg()
+    with pytest.raises(Exception, match="should be lower or equal to max-zoom"):
+        alg.ParseRunAndFinalize(
+            [
+                "--min-zoom=3",
+                "--max-zoom=2",
+                "../gcore/data/byte.tif",
+                str(tmp_vsimem),
+            ]
+        )
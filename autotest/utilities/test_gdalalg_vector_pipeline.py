@@ -790,3 +790,53 @@ def test_gdalalg_vector_pipeline_reproject_proj_string(tmp_vsimem):
         assert "Lambert Azimuthal Equal Area" in lyr.GetSpatialRef().ExportToWkt(
             ["FORMAT=WKT2"]
         ), lyr.GetSpatialRef().ExportToWkt(["FORMAT=WKT2"])
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_gdalalg_vector_pipeline_arrow_batches(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.gpkg")
+    gdal.VectorTranslate(src_filename, "../ogr/data/poly.shp")
+
+    def run(out_filename):
+        pipeline = get_pipeline_alg()
+        assert pipeline.ParseRunAndFinalize(
+            [
+                "read",
+                src_filename,
+                "!",
+                "filter",
+                "--where",
+                "EAS_ID > 160",
+                "!",
+                "select",
+                "EAS_ID,_ogr_geometry_",
+                "!",
+                "reproject",
+                "--dst-crs=EPSG:4326",
+                "!",
+                "write",
+                out_filename,
+            ]
+        )
+        with gdal.OpenEx(out_filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert lyr.GetSpatialRef().GetAuthorityCode(None) == "4326"
+            lyr_defn = lyr.GetLayerDefn()
+            assert [
+                lyr_defn.GetFieldDefn(i).GetName()
+                for i in range(lyr_defn.GetFieldCount())
+            ] == ["EAS_ID"]
+            return [
+                (f["EAS_ID"], f.GetGeometryRef().ExportToWkt()) for f in lyr
+            ]
+
+    # Batches of the source layer are filtered, projected and reprojected
+    # without going through OGRFeature
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        got = run(str(tmp_vsimem / "out_arrow.gpkg"))
+    with gdal.config_option("OGR_WARPED_LAYER_NATIVE_ARROW_STREAM", "NO"):
+        expected = run(str(tmp_vsimem / "out_features.gpkg"))
+    assert len(got) == 9
+    assert got == expected
@@ -212,3 +212,41 @@ def test_gdalalg_vector_select_fields_exclude_name_geom_fields_not_excluded(tmp_
             lyr_defn.GetFieldDefn(i).GetName() for i in range(lyr_defn.GetFieldCount())
         ] == ["AREA", "EAS_ID", "PRFEDEA"]
         assert lyr_defn.GetGeomFieldCount() == 1
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_select_arrow_stream(tmp_vsimem):
+
+    tmp_filename = str(tmp_vsimem / "tmp.gpkg")
+    gdal.VectorTranslate(tmp_filename, "../ogr/data/poly.shp")
+
+    select_alg = get_select_alg()
+    select_alg["input"] = tmp_filename
+    assert select_alg.ParseCommandLineArguments(
+        ["--fields=EAS_ID,_ogr_geometry_", "--of", "stream", "--output", "out"]
+    )
+    assert select_alg.Run()
+
+    lyr = select_alg["output"].GetDataset().GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    stream = lyr.GetArrowStream()
+    schema = stream.GetSchema()
+    assert [
+        schema.GetChild(i).GetName() for i in range(schema.GetChildrenCount())
+    ] == ["fid", "EAS_ID", "geom"]
+    count = 0
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert array.GetChildrenCount() == 3
+        count += array.GetLength()
+    assert count == 10
+
+    # Filters set on the select layer cannot be applied on the source stream
+    lyr.SetAttributeFilter("EAS_ID = 170")
+    assert not lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    stream = lyr.GetArrowStream()
+    array = stream.GetNextRecordBatch()
+    assert array.GetLength() == 1
@@ -923,3 +923,81 @@ def test_gdalbuildvrt_lib_nodata_invalid(tmp_vsimem, dtype, nodata):
         gdal.CE_Warning, "cannot represent the specified NoData value"
     ):
         gdal.BuildVRT("", [tmp_vsimem / "in.tif"], VRTNodata=nodata)
+
+
+###############################################################################
+# Test writing and reading the binary .vrtb encoding
+
+
+def test_gdalbuildvrt_lib_vrtb(tmp_vsimem):
+
+    src_filenames = []
+    for i in range(4):
+        src_filename = str(tmp_vsimem / f"src{i}.tif")
+        with gdal.GetDriverByName("GTiff").Create(src_filename, 10, 10) as ds:
+            ds.SetGeoTransform([(i % 2) * 10, 1, 0, -(i // 2) * 10, 0, -1])
+            ds.GetRasterBand(1).Fill(i + 1)
+            ds.GetRasterBand(1).SetNoDataValue(i + 1 if i == 3 else 255)
+        src_filenames.append(src_filename)
+
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    gdal.BuildVRT(vrt_filename, src_filenames, resampling="bilinear")
+    vrtb_filename = str(tmp_vsimem / "test.vrtb")
+    gdal.BuildVRT(vrtb_filename, src_filenames, resampling="bilinear")
+
+    f = gdal.VSIFOpenL(vrtb_filename, "rb")
+    assert f
+    try:
+        assert gdal.VSIFReadL(1, 8, f) == b"GDALVRTB"
+    finally:
+        gdal.VSIFCloseL(f)
+
+    with gdal.Open(vrt_filename) as ds, gdal.Open(vrtb_filename) as dsb:
+        assert dsb.GetDriver().ShortName == "VRT"
+        assert dsb.RasterXSize == ds.RasterXSize
+        assert dsb.RasterYSize == ds.RasterYSize
+        assert dsb.GetGeoTransform() == ds.GetGeoTransform()
+        assert dsb.GetRasterBand(1).Checksum() == ds.GetRasterBand(1).Checksum()
+        assert dsb.GetRasterBand(1).ReadRaster(
+            2, 2, 5, 5, 3, 3
+        ) == ds.GetRasterBand(1).ReadRaster(2, 2, 5, 5, 3, 3)
+        xml = ds.GetMetadata("xml:VRT")[0]
+        assert dsb.GetMetadata("xml:VRT")[0] == xml
+        assert "ComplexSource" in xml
+
+        # Round-trip through CreateCopy()
+        vrtb_copy_filename = str(tmp_vsimem / "copy.vrtb")
+        gdal.GetDriverByName("VRT").CreateCopy(vrtb_copy_filename, dsb).Close()
+        with gdal.Open(vrtb_copy_filename) as dsb_copy:
+            assert dsb_copy.GetMetadata("xml:VRT")[0] == xml
+
+
+###############################################################################
+# Test numThreads, i.e. opening input datasets ahead in worker threads
+
+
+@pytest.mark.parametrize("num_threads", [2, "ALL_CPUS"])
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem, num_threads):
+
+    src_filenames = []
+    for i in range(10):
+        src_filename = str(tmp_vsimem / f"src{i}.tif")
+        with gdal.GetDriverByName("GTiff").Create(src_filename, 10, 10) as ds:
+            ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+            ds.GetRasterBand(1).Fill(i + 1)
+        src_filenames.append(src_filename)
+    src_filenames.insert(5, str(tmp_vsimem / "non_existing.tif"))
+
+    gdal.ErrorReset()
+    with gdaltest.error_handler():
+        ref_ds = gdal.BuildVRT("", src_filenames)
+        ref_msg = gdal.GetLastErrorMsg()
+    ref_xml = ref_ds.GetMetadata("xml:VRT")[0]
+
+    gdal.ErrorReset()
+    with gdaltest.error_handler():
+        ds = gdal.BuildVRT("", src_filenames, numThreads=num_threads)
+        msg = gdal.GetLastErrorMsg()
+    assert ds.GetMetadata("xml:VRT")[0] == ref_xml
+    assert msg == ref_msg
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
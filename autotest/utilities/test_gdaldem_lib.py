@@ -782,3 +782,48 @@ def test_gdaldem_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that processing lines with several threads gives the same result
+
+
+@pytest.mark.parametrize(
+    "processing,options",
+    [
+        ("hillshade", {}),
+        ("hillshade", {"computeEdges": True}),
+        ("slope", {}),
+        ("aspect", {"computeEdges": True}),
+        ("TRI", {}),
+        ("TPI", {}),
+        ("roughness", {}),
+    ],
+)
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_num_threads(processing, options, datatype):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=datatype
+    )
+    # Add some nodata holes
+    src_ds.GetRasterBand(1).SetNoDataValue(-10)
+    src_ds.GetRasterBand(1).WriteRaster(
+        30, 40, 5, 3, b"\xf6\xff" * 15, buf_type=gdal.GDT_Int16
+    )
+
+    def run(num_threads):
+        ds = gdal.DEMProcessing(
+            "",
+            src_ds,
+            processing,
+            format="MEM",
+            numThreads=num_threads,
+            **options,
+        )
+        return ds.GetRasterBand(1).ReadRaster()
+
+    expected = run(1)
+    assert run(4) == expected
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        assert run(None) == expected
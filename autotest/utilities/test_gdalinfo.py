@@ -1074,3 +1074,51 @@ def test_gdalinfo_open_vector(gdalinfo_path):
     )
 
     assert "Did you intend to call ogrinfo" in err
+
+
+###############################################################################
+# Test several datasets with -stats -hist and -num_threads
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_gdalinfo_several_datasets(gdalinfo_path, tmp_path, num_threads):
+
+    filenames = []
+    for i in range(5):
+        filename = str(tmp_path / f"byte{i}.tif")
+        shutil.copy("../gcore/data/byte.tif", filename)
+        filenames.append(filename)
+
+    ret, err = gdaltest.runexternal_out_and_err(
+        f"{gdalinfo_path} -stats -hist -num_threads {num_threads} "
+        + " ".join(filenames[0:3])
+        + " does_not_exist.tif "
+        + " ".join(filenames[3:])
+    )
+    assert "unable to open 'does_not_exist.tif'" in err
+    assert ret.count("STATISTICS_MINIMUM=74") == 5
+    assert ret.count("256 buckets from -0.5 to 255.5") == 5
+    # Reports are in input order
+    pos = [ret.find(f"Files: {filename}") for filename in filenames]
+    assert -1 not in pos
+    assert pos == sorted(pos)
+
+    for filename in filenames:
+        assert os.path.exists(filename + ".aux.xml")
+
+    # Statistics and histogram computed in a single pass must match the ones
+    # computed separately
+    with gdal.config_option("GDAL_PAM_ENABLED", "NO"):
+        ds = gdal.Open("../gcore/data/byte.tif")
+        band = ds.GetRasterBand(1)
+        ref_stats = band.ComputeStatistics(False)
+        ref_hist = band.GetDefaultHistogram(force=True)
+        ds = None
+
+    ds = gdal.Open(filenames[0])
+    band = ds.GetRasterBand(1)
+    stats = band.GetStatistics(False, False)
+    hist = band.GetDefaultHistogram(force=False)
+    ds = None
+    assert stats == pytest.approx(ref_stats, rel=1e-12)
+    assert hist == ref_hist
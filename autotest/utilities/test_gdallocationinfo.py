@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import random
 import sys
 
 import pytest
@@ -302,6 +303,40 @@ def test_gdallocationinfo_out_of_raster_coordinates_valonly_multiband(
     assert "1,2,0,0,0\n-1,-1,,,\n1,2,0,0,0\n" in ret
 
 
+###############################################################################
+# Test -bulk mode
+
+
+@pytest.mark.parametrize("resampling", ["nearest", "bilinear", "cubic"])
+def test_gdallocationinfo_bulk(gdallocationinfo_path, resampling):
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdallocationinfo_path + " -bulk ../gcore/data/byte.tif"
+    )
+    assert "-bulk can only be used with -valonly" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdallocationinfo_path + " -bulk -valonly ../gcore/data/byte.tif 1 2"
+    )
+    assert "-bulk can only be used when points are read from the standard input" in err
+
+    # Points in random order, some of them outside of the raster, and with
+    # extra content
+    r = random.Random(0)
+    lines = []
+    for i in range(1000):
+        x = r.uniform(-5, 55)
+        y = r.uniform(-5, 55)
+        lines.append(f"{x} {y} extra_{i}" if (i % 3) == 0 else f"{x} {y}")
+    strin = "\n".join(lines)
+
+    cmd = f' -r {resampling} -E -valonly -field_sep "," ../gcore/data/rgbsmall.tif'
+    expected = gdaltest.runexternal(gdallocationinfo_path + cmd, strin=strin)
+    got = gdaltest.runexternal(gdallocationinfo_path + " -bulk" + cmd, strin=strin)
+    assert got.replace("\r\n", "\n") == expected.replace("\r\n", "\n")
+    assert len(got.replace("\r\n", "\n").split("\n")) == 1000 + 1
+
+
 ###############################################################################
 
 
@@ -993,3 +993,37 @@ def test_gdalmdimtranslate_dict_arguments():
     co_idx = opt.index("-co")
 
     assert opt[co_idx : co_idx + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test copying arrays by several chunks, possibly with a writer thread
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_gdalmdimtranslate_copy_by_chunks(num_threads):
+
+    src_ds = gdal.GetDriverByName("MEM").CreateMultiDimensional("")
+    rg = src_ds.GetRootGroup()
+    dim_y = rg.CreateDimension("y", None, None, 30)
+    dim_x = rg.CreateDimension("x", None, None, 40)
+    ar = rg.CreateMDArray(
+        "int_array",
+        [dim_y, dim_x],
+        gdal.ExtendedDataType.Create(gdal.GDT_Int32),
+    )
+    values = [i for i in range(30 * 40)]
+    assert ar.Write(struct.pack("i" * len(values), *values)) == gdal.CE_None
+    str_ar = rg.CreateMDArray(
+        "str_array", [dim_x], gdal.ExtendedDataType.CreateString()
+    )
+    str_values = ["value %d" % i for i in range(40)]
+    assert str_ar.Write(str_values) == gdal.CE_None
+
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "200", "GDAL_NUM_THREADS": num_threads}
+    ):
+        out_ds = gdal.MultiDimTranslate("", src_ds, format="MEM")
+    out_rg = out_ds.GetRootGroup()
+    out_ar = out_rg.OpenMDArray("int_array")
+    assert struct.unpack("i" * len(values), out_ar.Read()) == tuple(values)
+    assert out_rg.OpenMDArray("str_array").Read() == str_values
@@ -458,3 +458,123 @@ def test_gdaltindex_lib_ot(tmp_path, four_tiles):
     ds = ogr.Open(index_filename)
     lyr = ds.GetLayer(0)
     assert lyr.GetMetadataItem("DATA_TYPE") == "UInt16"
+
+
+###############################################################################
+# Test numThreads, i.e. opening input datasets ahead in worker threads
+
+
+@pytest.mark.parametrize("num_threads", [2, "ALL_CPUS"])
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles, num_threads):
+
+    ref_filename = str(tmp_path / "ref.shp")
+    gdal.TileIndex(ref_filename, four_tiles)
+
+    index_filename = str(tmp_path / "test.shp")
+    gdal.TileIndex(index_filename, four_tiles, numThreads=num_threads)
+
+    with ogr.Open(ref_filename) as ref_ds, ogr.Open(index_filename) as ds:
+        ref_lyr = ref_ds.GetLayer(0)
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 4
+        for ref_f, f in zip(ref_lyr, lyr):
+            assert f["location"] == ref_f["location"]
+            assert f.GetGeometryRef().Equals(ref_f.GetGeometryRef())
+
+    # Re-running adds nothing, as all files are already in the index
+    with gdaltest.error_handler():
+        gdal.TileIndex(index_filename, four_tiles, numThreads=num_threads)
+    with ogr.Open(index_filename) as ds:
+        assert ds.GetLayer(0).GetFeatureCount() == 4
+
+
+###############################################################################
+# Test sync and mtimeField, i.e. incremental updates of a tile index
+
+
+def test_gdaltindex_lib_sync(tmp_path, four_tiles):
+
+    src_dir = tmp_path / "src"
+    src_dir.mkdir()
+    for i, filename in enumerate(four_tiles):
+        gdal.Translate(str(src_dir / f"tile{i}.tif"), filename)
+
+    index_filename = str(tmp_path / "index.gpkg")
+    gdal.TileIndex(index_filename, [str(src_dir)], mtimeField="mtime")
+
+    def get_entries():
+        with ogr.Open(index_filename) as ds:
+            lyr = ds.GetLayer(0)
+            return {
+                os.path.basename(f["location"]): (
+                    f["mtime"],
+                    f.GetGeometryRef().GetEnvelope(),
+                )
+                for f in lyr
+            }
+
+    entries = get_entries()
+    assert len(entries) == 4
+    for name in entries:
+        mtime = gdal.VSIStatL(str(src_dir / name)).mtime
+        assert entries[name][0] == mtime
+
+    # Nothing to do: no warning about files already in the index
+    gdal.ErrorReset()
+    gdal.TileIndex(index_filename, [str(src_dir)], mtimeField="mtime", sync=True)
+    assert gdal.GetLastErrorMsg() == ""
+    assert get_entries() == entries
+
+    # Remove a file, modify another one and add a new one
+    gdal.Unlink(str(src_dir / "tile0.tif"))
+    with gdal.Open(str(src_dir / "tile1.tif"), gdal.GA_Update) as ds:
+        ds.SetGeoTransform([0, 0.1, 0, 10, 0, -0.1])
+    os.utime(src_dir / "tile1.tif", (1000000000, 1000000000))
+    gdal.Translate(str(src_dir / "tile4.tif"), four_tiles[0])
+
+    gdal.TileIndex(index_filename, [str(src_dir)], mtimeField="mtime", sync=True)
+    new_entries = get_entries()
+    assert set(new_entries.keys()) == set(
+        ["tile1.tif", "tile2.tif", "tile3.tif", "tile4.tif"]
+    )
+    assert new_entries["tile1.tif"] == (1000000000, (0.0, 1.0, 9.0, 10.0))
+    assert new_entries["tile2.tif"] == entries["tile2.tif"]
+    assert new_entries["tile3.tif"] == entries["tile3.tif"]
+    assert new_entries["tile4.tif"][1] == entries["tile0.tif"][1]
+
+    # Without sync, files already in the index are not re-indexed
+    with gdaltest.error_handler():
+        gdal.TileIndex(index_filename, [str(src_dir)], mtimeField="mtime")
+    assert get_entries() == new_entries
+
+
+###############################################################################
+# Test footprint
+
+
+@pytest.mark.require_geos
+def test_gdaltindex_lib_footprint(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    with gdal.GetDriverByName("GTiff").Create(src_filename, 10, 10) as ds:
+        ds.SetGeoTransform([2, 1, 0, 49, 0, -1])
+        ds.GetRasterBand(1).SetNoDataValue(0)
+        ds.GetRasterBand(1).WriteRaster(2, 3, 4, 5, b"\xFF" * 20)
+    empty_filename = str(tmp_vsimem / "empty.tif")
+    with gdal.GetDriverByName("GTiff").Create(empty_filename, 10, 10) as ds:
+        ds.SetGeoTransform([2, 1, 0, 49, 0, -1])
+        ds.GetRasterBand(1).SetNoDataValue(0)
+
+    index_filename = str(tmp_vsimem / "index.gpkg")
+    with gdaltest.error_handler():
+        ds = gdal.TileIndex(
+            index_filename, [src_filename, empty_filename], footprint=True
+        )
+    assert "Cannot compute footprint" in gdal.GetLastErrorMsg()
+    lyr = ds.GetLayer(0)
+    assert lyr.GetGeomType() == ogr.wkbMultiPolygon
+    assert lyr.GetFeatureCount() == 1
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef().Equals(
+        ogr.CreateGeometryFromWkt("MULTIPOLYGON (((4 46,8 46,8 41,4 41,4 46)))")
+    )
@@ -4396,3 +4396,81 @@ def test_gdalwarp_lib_init_dest_invalid(tmp_vsimem):
             outputBounds=(440000, 3750120, 441920, 3751320),
             warpOptions={"INIT_DEST": "NO_DATA"},
         )
+
+
+###############################################################################
+# Test -multi with several chunks in flight, with and without separate
+# destination I/O
+
+
+@pytest.mark.parametrize("init_dest", [True, False])
+@pytest.mark.parametrize("chunks_in_flight", [None, "1", "5"])
+def test_gdalwarp_lib_multi_chunks_in_flight(
+    tmp_vsimem, init_dest, chunks_in_flight
+):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    expected_ds = gdal.Warp("", src_ds, format="MEM", dstSRS="EPSG:4326")
+    expected_cs = expected_ds.GetRasterBand(1).Checksum()
+
+    dst_filename = str(tmp_vsimem / "out.tif")
+    if not init_dest:
+        gdal.Translate(dst_filename, expected_ds, scaleParams=[[0, 255, 0, 0]])
+
+    warp_options = []
+    if chunks_in_flight:
+        warp_options.append("MULTI_CHUNKS_IN_FLIGHT=" + chunks_in_flight)
+    out_ds = gdal.Warp(
+        dst_filename,
+        src_ds,
+        dstSRS="EPSG:4326",
+        multithread=True,
+        warpMemoryLimit=1000,
+        warpOptions=warp_options,
+    )
+    assert out_ds.GetRasterBand(1).Checksum() == expected_cs
+
+
+###############################################################################
+# Test WARP_PLAN_STEP and WARP_PLAN_FILENAME warp options
+
+
+def test_gdalwarp_lib_warp_plan(tmp_vsimem):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ref_ds = gdal.Warp(
+        "", src_ds, format="MEM", dstSRS="EPSG:4326", errorThreshold=0
+    )
+    ref_data = ref_ds.GetRasterBand(1).ReadRaster()
+
+    def check(step):
+        out_ds = gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            dstSRS="EPSG:4326",
+            errorThreshold=0,
+            warpOptions=[
+                f"WARP_PLAN_STEP={step}",
+                "WARP_PLAN_FILENAME=" + plan_filename,
+            ],
+        )
+        out_data = out_ds.GetRasterBand(1).ReadRaster()
+        # Interpolation errors up to 0.125 pixel may change a few pixels
+        # at the boundaries of source pixels.
+        diff_count = sum(1 for a, b in zip(out_data, ref_data) if a != b)
+        assert diff_count < len(ref_data) // 100
+
+        with gdal.Open(plan_filename) as plan_ds:
+            assert plan_ds.RasterCount == 3
+            assert plan_ds.GetMetadataItem("WARP_PLAN_STEP") == str(step)
+            assert plan_ds.GetMetadataItem("WARP_PLAN_DST_XSIZE") == str(
+                out_ds.RasterXSize
+            )
+
+    plan_filename = str(tmp_vsimem / "plan.tif")
+    # Computed and saved, then reused
+    check(4)
+    check(4)
+    # A plan computed for a different step is not reused
+    check(2)
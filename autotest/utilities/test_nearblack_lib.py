@@ -555,3 +555,32 @@ def test_nearblack_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test numThreads
+
+
+@pytest.mark.parametrize("num_threads", [2, "ALL_CPUS"])
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"maxNonBlack": 0, "setAlpha": True},
+        {"maxNonBlack": 2, "setMask": True},
+        {"colors": [(0, 0, 0), (255, 255, 255)], "nearDist": 30},
+    ],
+)
+def test_nearblack_lib_num_threads(num_threads, options):
+
+    src_ds = gdal.Open("../gdrivers/data/rgbsmall.tif")
+    ref_ds = gdal.Nearblack("", src_ds, format="MEM", numThreads=1, **options)
+    ds = gdal.Nearblack("", src_ds, format="MEM", numThreads=num_threads, **options)
+    assert ds.RasterCount == ref_ds.RasterCount
+    for i in range(ds.RasterCount):
+        assert (
+            ds.GetRasterBand(i + 1).Checksum() == ref_ds.GetRasterBand(i + 1).Checksum()
+        )
+        assert (
+            ds.GetRasterBand(i + 1).GetMaskBand().Checksum()
+            == ref_ds.GetRasterBand(i + 1).GetMaskBand().Checksum()
+        )
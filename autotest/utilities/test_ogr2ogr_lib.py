@@ -1211,6 +1211,43 @@ def test_ogr2ogr_lib_clipsrc_discard_lower_dimensionality():
     ds = None
 
 
+###############################################################################
+# Test -clipsrc/-clipdst with a non rectangular clip polygon, and features
+# inside, outside and crossing it
+
+
+@pytest.mark.require_geos
+@pytest.mark.parametrize("clipSrc", [True, False])
+def test_ogr2ogr_lib_clip_non_rectangle(clipSrc):
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srcLayer = srcDS.CreateLayer("test", geom_type=ogr.wkbLineString)
+    for wkt in [
+        "LINESTRING (1 1,2 1,2 2)",
+        "LINESTRING (7 7,8 8)",
+        "LINESTRING (1 2,12 2)",
+    ]:
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        srcLayer.CreateFeature(f)
+
+    # Triangle whose envelope contains the second feature
+    clip = "POLYGON ((0 0,0 10,10 0,0 0))"
+    ds = gdal.VectorTranslate(
+        "",
+        srcDS,
+        format="Memory",
+        clipSrc=clip if clipSrc else None,
+        clipDst=clip if not clipSrc else None,
+    )
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 2
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "LINESTRING (1 1,2 1,2 2)")
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "LINESTRING (1 2,8 2)")
+
+
 ###############################################################################
 # Test -clipsrc/-clipdst with a clip layer with an invalid polygon (specified "inline" as WKT)
 
@@ -1695,6 +1732,64 @@ def test_ogr2ogr_lib_simplify():
     assert dst_feature.GetGeometryRef().ExportToWkt() == "LINESTRING (0 0,10 0)"
 
 
+###############################################################################
+# Test that multi-threaded -simplify / -segmentize / reprojection / -makevalid
+# gives the same result as single-threaded processing
+
+
+@pytest.mark.require_geos
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"makeValid": True},
+        {"simplifyTolerance": 0.5},
+        {"makeValid": True, "simplifyTolerance": 0.5},
+        {"segmentizeMaxDist": 1},
+        {"dstSRS": "EPSG:32631"},
+        {"dstSRS": "EPSG:32631", "segmentizeMaxDist": 1, "makeValid": True},
+        {"dstSRS": "EPSG:32631", "makeValid": True, "transactionSize": 100},
+    ],
+)
+def test_ogr2ogr_lib_simplify_makevalid_multithreaded(options):
+
+    srs = osr.SpatialReference()
+    srs.SetFromUserInput("WGS84")
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("layer", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(2500):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 100 != 50:
+            x = i % 50
+            y = i // 50
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON (({x} {y},{x+10} {y+10},{x} {y+10},{x+10} {y},"
+                    f"{x+0.1} {y+0.1},{x} {y}))"
+                )
+            )
+        src_lyr.CreateFeature(f)
+
+    def translate(num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.VectorTranslate("", src_ds, format="Memory", **options)
+        lyr = ds.GetLayer(0)
+        return [(f["id"], f.GetGeometryRef()) for f in lyr]
+
+    ref = translate("1")
+    res = translate("4")
+    assert len(ref) == src_lyr.GetFeatureCount()
+    assert len(res) == len(ref)
+    for (ref_id, ref_geom), (res_id, res_geom) in zip(ref, res):
+        assert ref_id == res_id
+        if ref_geom is None:
+            assert res_geom is None
+        else:
+            assert ref_geom.Equals(res_geom)
+
+
 ###############################################################################
 # Test using transactionSize
 
@@ -2928,6 +3023,109 @@ def test_ogr2ogr_lib_reproject_arrow(tmp_vsimem, source_driver, force_reproj_thr
             ogrtest.check_feature_geometry(f, "POINT(3 36.14471809881776)")
 
 
+###############################################################################
+# Test -t_srs in Arrow code path with null geometries beyond the first 256
+# features
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("force_reproj_threading", [False, True])
+@pytest.mark.require_driver("GPKG")
+def test_ogr2ogr_lib_reproject_arrow_null_geometries(
+    tmp_vsimem, force_reproj_threading
+):
+
+    src_filename = str(tmp_vsimem / "in.gpkg")
+    with gdal.GetDriverByName("GPKG").Create(
+        src_filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as srcDS:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(32631)
+        srcLayer = srcDS.CreateLayer("test", srs=srs)
+        srcLayer.StartTransaction()
+        for i in range(1000):
+            f = ogr.Feature(srcLayer.GetLayerDefn())
+            if i % 3 != 0:
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(500000 4500000)"))
+            srcLayer.CreateFeature(f)
+        srcLayer.CommitTransaction()
+
+    config_options = {"CPL_DEBUG": "ON", "OGR2OGR_USE_ARROW_API": "YES"}
+    if force_reproj_threading:
+        config_options["OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ"] = "0"
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        got_msg.append(msg)
+        return
+
+    with gdaltest.error_handler(my_handler), gdaltest.config_options(config_options):
+        ds = gdal.VectorTranslate("", src_filename, format="Memory", dstSRS="EPSG:4326")
+
+    assert "OGR2OGR: Using WriteArrowBatch()" in got_msg
+
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1000
+    for i, f in enumerate(lyr):
+        if i % 3 == 0:
+            assert f.GetGeometryRef() is None
+        else:
+            ogrtest.check_feature_geometry(f, "POINT(3 40.65085651557158)")
+
+
+###############################################################################
+# Test -select in Arrow code path
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize(
+    "select,arrow_expected",
+    [("foo,baz", True), ("", True), ("baz,foo", False)],
+)
+def test_ogr2ogr_lib_arrow_select(tmp_vsimem, select, arrow_expected):
+
+    src_filename = str(tmp_vsimem / "in.gpkg")
+    with gdal.GetDriverByName("GPKG").Create(
+        src_filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as srcDS:
+        srcLayer = srcDS.CreateLayer("test")
+        for name in ("foo", "bar", "baz"):
+            srcLayer.CreateField(ogr.FieldDefn(name, ogr.OFTString))
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f["foo"] = "foo_val"
+        f["bar"] = "bar_val"
+        f["baz"] = "baz_val"
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(1 2)"))
+        srcLayer.CreateFeature(f)
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        got_msg.append(msg)
+        return
+
+    config_options = {"CPL_DEBUG": "ON", "OGR2OGR_USE_ARROW_API": "YES"}
+    with gdaltest.error_handler(my_handler), gdaltest.config_options(config_options):
+        ds = gdal.VectorTranslate(
+            "", src_filename, format="Memory", selectFields=select.split(",")
+        )
+
+    assert ("OGR2OGR: Using WriteArrowBatch()" in got_msg) == arrow_expected
+
+    lyr = ds.GetLayer(0)
+    lyr_defn = lyr.GetLayerDefn()
+    expected_fields = [x for x in select.split(",") if x]
+    assert sorted(
+        lyr_defn.GetFieldDefn(i).GetName() for i in range(lyr_defn.GetFieldCount())
+    ) == sorted(expected_fields)
+    f = lyr.GetNextFeature()
+    for name in expected_fields:
+        assert f[name] == name + "_val"
+    ogrtest.check_feature_geometry(f, "POINT(1 2)")
+
+
 ###############################################################################
 # Test -t_srs in Arrow code path in a situation where it cannot be triggered
 # currently (source CRS is crossing anti-meridian)
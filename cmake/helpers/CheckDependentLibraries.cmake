@@ -425,6 +425,11 @@ gdal_check_package(Blosc "Blosc compression" CAN_DISABLE)
 define_find_package2(ARCHIVE archive.h archive)
 gdal_check_package(ARCHIVE "Multi-format archive and compression library library (used for /vsi7z/" CAN_DISABLE)
 
+if (CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  define_find_package2(URING liburing.h uring)
+  gdal_check_package(URING "io_uring asynchronous I/O for local files (liburing)" CAN_DISABLE)
+endif ()
+
 define_find_package2(LIBAEC libaec.h aec)
 gdal_check_package(LIBAEC "Adaptive Entropy Coding implementing Golomb-Rice algorithm (used by GRIB)" CAN_DISABLE)
 
@@ -307,6 +307,13 @@ man_pages = [
         [author_evenr],
         1,
     ),
+    (
+        "programs/gdal_raster_tile",
+        "gdal-raster-tile",
+        "Generate tiles in separate files from a raster dataset",
+        [],
+        1,
+    ),
     (
         "programs/gdal_vector",
         "gdal-vector",
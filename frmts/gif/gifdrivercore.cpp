@@ -43,6 +43,9 @@ void BIGGIFDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
 
     poDriver->pfnIdentify = GIFDriverIdentify;
+    // "GIF87a" and "GIF89a"
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "474946383761 474946383961");
     poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
 }
 
@@ -70,6 +73,9 @@ void GIFDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
 
     poDriver->pfnIdentify = GIFDriverIdentify;
+    // "GIF87a" and "GIF89a"
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "474946383761 474946383961");
     poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
 }
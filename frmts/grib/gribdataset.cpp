@@ -28,6 +28,7 @@
 #endif
 
 #include <algorithm>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "cpl_time.h"
 #include "degrib/degrib/degrib2.h"
 #include "degrib/degrib/inventory.h"
@@ -1329,6 +1331,72 @@ class InventoryWrapperSidecar : public gdal::grib::InventoryWrapper
     }
 };
 
+/************************************************************************/
+/*                            WriteSidecar()                            */
+/************************************************************************/
+
+// Write an index file in the format produced by wgrib2 -s, so that
+// subsequent opens do not need to scan the whole GRIB file.
+static bool WriteSidecar(const std::string &osSideCarFilename,
+                         const gdal::grib::InventoryWrapper &oInventories)
+{
+    // Count fields per message, to know if the ".subgNum" suffix is needed
+    std::map<int, int> oMapFieldsPerMsg;
+    for (uInt4 i = 0; i < oInventories.length(); ++i)
+        ++oMapFieldsPerMsg[oInventories.get(i)->msgNum];
+
+    const auto Sanitize = [](const char *pszStr)
+    {
+        return CPLString(pszStr ? pszStr : "").replaceAll(':', '_');
+    };
+
+    std::string osContent;
+    for (uInt4 i = 0; i < oInventories.length(); ++i)
+    {
+        const inventoryType *psInv = oInventories.get(i);
+        osContent += std::to_string(psInv->msgNum);
+        if (oMapFieldsPerMsg[psInv->msgNum] > 1)
+        {
+            // .idx file use a 1-based indexing, whereas DEGRIB uses a
+            // 0-based one
+            osContent += '.';
+            osContent += std::to_string(psInv->subgNum + 1);
+        }
+        osContent += ':';
+        osContent += std::to_string(static_cast<GUIntBig>(psInv->start));
+
+        struct tm brokenDown;
+        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(psInv->refTime), &brokenDown);
+        osContent +=
+            CPLSPrintf(":d=%04d%02d%02d%02d:", brokenDown.tm_year + 1900,
+                       brokenDown.tm_mon + 1, brokenDown.tm_mday,
+                       brokenDown.tm_hour);
+        osContent += Sanitize(psInv->element);
+        osContent += ':';
+        osContent += Sanitize(psInv->shortFstLevel);
+        osContent += ':';
+        const double dfForeSec = psInv->foreSec;
+        if (dfForeSec == 0)
+            osContent += "anl";
+        else if (std::fmod(dfForeSec, 3600) == 0)
+            osContent += CPLSPrintf("%.0f hour fcst", dfForeSec / 3600);
+        else
+            osContent += CPLSPrintf("%.0f min fcst", dfForeSec / 60);
+        osContent += ":\n";
+    }
+
+    VSILFILE *fp = VSIFOpenL(osSideCarFilename.c_str(), "wb");
+    if (!fp)
+        return false;
+    bool bOK =
+        VSIFWriteL(osContent.data(), 1, osContent.size(), fp) ==
+        osContent.size();
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK)
+        VSIUnlink(osSideCarFilename.c_str());
+    return bOK;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              GRIBDataset                             */
@@ -1375,6 +1443,75 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                         AdviseReadMessages()                         */
+/************************************************************************/
+
+// Let the file handle know about the messages that will be decoded, so that
+// network file systems can fetch them with parallel range requests, instead
+// of one request per band.
+void GRIBDataset::AdviseReadMessages(int nBandCount, const int *panBandMap)
+{
+    // The extent of a message is deduced from the start of the next one
+    std::set<vsi_l_offset> oSetStarts;
+    for (int i = 0; i < nBands; ++i)
+    {
+        oSetStarts.insert(
+            cpl::down_cast<GRIBRasterBand *>(papoBands[i])->start);
+    }
+    if (VSIFSeekL(fp, 0, SEEK_END) != 0)
+        return;
+    const vsi_l_offset nFileSize = VSIFTellL(fp);
+
+    std::set<vsi_l_offset> oSetAdvised;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    const size_t nTotalBytesLimit = fp->GetAdviseReadTotalBytesLimit();
+    size_t nTotalBytes = 0;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        const auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(papoBands[panBandMap[i] - 1]);
+        if (poBand->m_Grib_Data || !oSetAdvised.insert(poBand->start).second)
+            continue;
+        const auto oIterNext = oSetStarts.upper_bound(poBand->start);
+        const vsi_l_offset nEnd =
+            oIterNext == oSetStarts.end() ? nFileSize : *oIterNext;
+        if (nEnd <= poBand->start ||
+            nEnd - poBand->start > nTotalBytesLimit - nTotalBytes)
+            break;
+        anOffsets.push_back(poBand->start);
+        anSizes.push_back(static_cast<size_t>(nEnd - poBand->start));
+        nTotalBytes += anSizes.back();
+    }
+    if (anOffsets.size() > 1)
+    {
+        fp->AdviseRead(static_cast<int>(anOffsets.size()), anOffsets.data(),
+                       anSizes.data());
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBandCount > 1)
+        AdviseReadMessages(nBandCount, panBandMap);
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                                Inventory()                           */
 /************************************************************************/
@@ -1432,6 +1569,27 @@ GRIBDataset::Inventory(GDALOpenInfo *poOpenInfo)
                  poOpenInfo->pszFilename);
         // Contains an GRIB2 message inventory of the file.
         pInventories = std::make_unique<InventoryWrapperGrib>(fp);
+
+        VSIStatBufL sStat;
+        if (pInventories->result() > 0 && pInventories->length() > 0 &&
+            nStartOffset == 0 && nSize < 0 &&
+            CPLTestBool(CSLFetchNameValueDef(
+                poOpenInfo->papszOpenOptions, "WRITE_IDX",
+                CPLGetConfigOption("GRIB_WRITE_IDX", "NO"))) &&
+            VSIStatL(osSideCarFilename.c_str(), &sStat) != 0)
+        {
+            if (WriteSidecar(osSideCarFilename, *pInventories))
+            {
+                CPLDebug("GRIB", "Wrote inventories to sidecar file %s",
+                         osSideCarFilename.c_str());
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Cannot write sidecar file %s",
+                         osSideCarFilename.c_str());
+            }
+        }
     }
 
     return pInventories;
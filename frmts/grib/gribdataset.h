@@ -85,6 +85,13 @@ class GRIBDataset final : public GDALPamDataset
 
     CPLErr GetGeoTransform(double *padfTransform) override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     const OGRSpatialReference *GetSpatialRef() const override
     {
         return m_poSRS.get();
@@ -97,6 +104,7 @@ class GRIBDataset final : public GDALPamDataset
 
   private:
     void SetGribMetaData(grib_MetaData *meta);
+    void AdviseReadMessages(int nBandCount, const int *panBandMap);
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     std::unique_ptr<gdal::grib::InventoryWrapper> Inventory(GDALOpenInfo *);
 
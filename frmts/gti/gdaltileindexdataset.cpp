@@ -328,6 +328,63 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Whereas the multi-threading rendering code path must be used. Updated by CollectSources().
     bool m_bLastMustUseMultiThreading = false;
 
+    //! In-memory snapshot of the features of m_poLayer, with a spatial index
+    //! of their extent, used instead of spatial filter queries on m_poLayer.
+    struct FeatureIndex
+    {
+        CPLQuadTree *hQuadTree = nullptr;
+
+        //! Features in the order of m_poLayer
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+
+        FeatureIndex() = default;
+
+        ~FeatureIndex()
+        {
+            if (hQuadTree)
+                CPLQuadTreeDestroy(hQuadTree);
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(FeatureIndex)
+    };
+
+    //! Built by GetFeatureIndex()
+    std::unique_ptr<FeatureIndex> m_poFeatureIndex{};
+
+    //! Whether GetFeatureIndex() has already been called
+    bool m_bFeatureIndexTried = false;
+
+    //! Whether sources of the predicted next request must be prefetched.
+    //! -1 = not yet evaluated
+    int m_nPrefetch = -1;
+
+    //! Window of the previous request, used to predict the next one.
+    double m_dfPrevRequestXOff = std::numeric_limits<double>::quiet_NaN();
+    double m_dfPrevRequestYOff = std::numeric_limits<double>::quiet_NaN();
+    double m_dfPrevRequestXSize = 0;
+    double m_dfPrevRequestYSize = 0;
+
+    //! Job queue for the prefetching of sources
+    std::unique_ptr<CPLJobQueue> m_poPrefetchJobQueue{};
+
+    //! Return the in-memory snapshot of the tile index, building it at the
+    //! first call, or nullptr if the tile index is too large for that.
+    const FeatureIndex *GetFeatureIndex();
+
+    //! Return, in the order of m_poLayer, the indices of the features of
+    //! m_poFeatureIndex that intersect the passed georeferenced window.
+    std::vector<int> GetIntersectingFeatures(double dfMinX, double dfMinY,
+                                             double dfMaxX,
+                                             double dfMaxY) const;
+
+    //! Predict the next request from the current one, and open in a
+    //! background thread the sources it will need.
+    void PrefetchSources(double dfXOff, double dfYOff, double dfXSize,
+                         double dfYSize);
+
+    //! Wait for the completion of prefetching jobs.
+    void WaitPrefetchCompletion();
+
     //! From a source dataset name, return its SourceDesc description structure.
     bool GetSourceDesc(const std::string &osTileName, SourceDesc &oSourceDesc,
                        std::mutex *pMutex);
@@ -2513,6 +2570,8 @@ GDALTileIndexDataset::~GDALTileIndexDataset()
 
 CPLErr GDALTileIndexDataset::FlushCache(bool bAtClosing)
 {
+    WaitPrefetchCompletion();
+
     CPLErr eErr = CE_None;
     if (bAtClosing && m_bXMLModified)
     {
@@ -3644,32 +3703,49 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     m_dfLastMaxYFilter = dfMaxY;
     m_bLastMustUseMultiThreading = false;
 
-    m_poLayer->SetSpatialFilterRect(dfMinX, dfMinY, dfMaxX, dfMaxY);
-    m_poLayer->ResetReading();
+    // Prefetching jobs use the cache of opened sources.
+    WaitPrefetchCompletion();
 
     m_aoSourceDesc.clear();
-    while (true)
+    if (const auto poFeatureIndex = GetFeatureIndex())
     {
-        auto poFeature =
-            std::unique_ptr<OGRFeature>(m_poLayer->GetNextFeature());
-        if (!poFeature)
-            break;
-        if (!poFeature->IsFieldSetAndNotNull(m_nLocationFieldIndex))
+        for (const int iFeature :
+             GetIntersectingFeatures(dfMinX, dfMinY, dfMaxX, dfMaxY))
         {
-            continue;
+            SourceDesc oSourceDesc;
+            oSourceDesc.poFeature.reset(
+                poFeatureIndex->apoFeatures[iFeature]->Clone());
+            m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
         }
+    }
+    else
+    {
+        m_poLayer->SetSpatialFilterRect(dfMinX, dfMinY, dfMaxX, dfMaxY);
+        m_poLayer->ResetReading();
 
-        SourceDesc oSourceDesc;
-        oSourceDesc.poFeature = std::move(poFeature);
-        m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
-
-        if (m_aoSourceDesc.size() > 10 * 1000 * 1000)
+        while (true)
         {
-            // Safety belt...
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "More than 10 million contributing sources to a "
-                     "single RasterIO() request is not supported");
-            return false;
+            auto poFeature =
+                std::unique_ptr<OGRFeature>(m_poLayer->GetNextFeature());
+            if (!poFeature)
+                break;
+            if (!poFeature->IsFieldSetAndNotNull(m_nLocationFieldIndex))
+            {
+                continue;
+            }
+
+            SourceDesc oSourceDesc;
+            oSourceDesc.poFeature = std::move(poFeature);
+            m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
+
+            if (m_aoSourceDesc.size() > 10 * 1000 * 1000)
+            {
+                // Safety belt...
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "More than 10 million contributing sources to a "
+                         "single RasterIO() request is not supported");
+                return false;
+            }
         }
     }
 
@@ -3893,6 +3969,212 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     return true;
 }
 
+/************************************************************************/
+/*                          GetFeatureIndex()                           */
+/************************************************************************/
+
+const GDALTileIndexDataset::FeatureIndex *
+GDALTileIndexDataset::GetFeatureIndex()
+{
+    if (m_bFeatureIndexTried)
+        return m_poFeatureIndex.get();
+    m_bFeatureIndexTried = true;
+
+    // Beyond that number of features, we rely on the spatial index of the
+    // tile index itself, to keep memory usage reasonable.
+    const GIntBig nMaxFeatures = std::strtoll(
+        CPLGetConfigOption("GTI_IN_MEMORY_INDEX_MAX_FEATURES", "100000"),
+        nullptr, 10);
+    if (nMaxFeatures <= 0)
+        return nullptr;
+    const GIntBig nFeatureCount = m_poLayer->GetFeatureCount(/* bForce = */
+                                                             false);
+    if (nFeatureCount > nMaxFeatures)
+        return nullptr;
+
+    auto poFeatureIndex = std::make_unique<FeatureIndex>();
+    std::vector<OGREnvelope> asEnvelopes;
+    OGREnvelope sGlobalEnvelope;
+
+    m_poLayer->SetSpatialFilter(nullptr);
+    m_poLayer->ResetReading();
+    for (auto &&poFeature : m_poLayer)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(m_nLocationFieldIndex))
+            continue;
+        const auto poGeom = poFeature->GetGeometryRef();
+        if (!poGeom || poGeom->IsEmpty())
+            continue;
+        if (static_cast<GIntBig>(poFeatureIndex->apoFeatures.size()) ==
+            nMaxFeatures)
+        {
+            return nullptr;
+        }
+        OGREnvelope sEnvelope;
+        poGeom->getEnvelope(&sEnvelope);
+        sGlobalEnvelope.Merge(sEnvelope);
+        asEnvelopes.push_back(sEnvelope);
+        poFeatureIndex->apoFeatures.emplace_back(poFeature.release());
+    }
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.MinX;
+    sGlobalBounds.miny = sGlobalEnvelope.MinY;
+    sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+    sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    poFeatureIndex->hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    for (size_t i = 0; i < asEnvelopes.size(); ++i)
+    {
+        CPLRectObj sBounds;
+        sBounds.minx = asEnvelopes[i].MinX;
+        sBounds.miny = asEnvelopes[i].MinY;
+        sBounds.maxx = asEnvelopes[i].MaxX;
+        sBounds.maxy = asEnvelopes[i].MaxY;
+        CPLQuadTreeInsertWithBounds(
+            poFeatureIndex->hQuadTree,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sBounds);
+    }
+
+    CPLDebugOnly("GTI", "Built in-memory index of %d features",
+                 static_cast<int>(poFeatureIndex->apoFeatures.size()));
+    m_poFeatureIndex = std::move(poFeatureIndex);
+    return m_poFeatureIndex.get();
+}
+
+/************************************************************************/
+/*                      GetIntersectingFeatures()                       */
+/************************************************************************/
+
+std::vector<int> GDALTileIndexDataset::GetIntersectingFeatures(
+    double dfMinX, double dfMinY, double dfMaxX, double dfMaxY) const
+{
+    CPLAssert(m_poFeatureIndex);
+
+    CPLRectObj sAoI;
+    sAoI.minx = std::min(dfMinX, dfMaxX);
+    sAoI.miny = std::min(dfMinY, dfMaxY);
+    sAoI.maxx = std::max(dfMinX, dfMaxX);
+    sAoI.maxy = std::max(dfMinY, dfMaxY);
+    int nFeatureCount = 0;
+    void **pahFeatures =
+        CPLQuadTreeSearch(m_poFeatureIndex->hQuadTree, &sAoI, &nFeatureCount);
+    std::vector<int> anFeatures;
+    anFeatures.reserve(nFeatureCount);
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anFeatures.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+
+    // Sources must be composited in the order of the tile index
+    std::sort(anFeatures.begin(), anFeatures.end());
+    return anFeatures;
+}
+
+/************************************************************************/
+/*                          PrefetchSources()                           */
+/************************************************************************/
+
+void GDALTileIndexDataset::PrefetchSources(double dfXOff, double dfYOff,
+                                           double dfXSize, double dfYSize)
+{
+    if (m_nPrefetch < 0)
+    {
+        m_nPrefetch = CPLTestBool(CSLFetchNameValueDef(
+            GetOpenOptions(), "PREFETCH",
+            CPLGetConfigOption("GTI_PREFETCH", "NO")));
+    }
+    if (!m_nPrefetch || !GetFeatureIndex())
+        return;
+
+    // Predict that the next request will continue the move from the
+    // previous request to the current one if they have the same size, or
+    // will otherwise be the window at the right of the current one, as
+    // done by tile services and block-by-block readers.
+    double dfNextXOff = dfXOff + dfXSize;
+    double dfNextYOff = dfYOff;
+    if (dfXSize == m_dfPrevRequestXSize && dfYSize == m_dfPrevRequestYSize &&
+        !(dfXOff == m_dfPrevRequestXOff && dfYOff == m_dfPrevRequestYOff))
+    {
+        dfNextXOff = dfXOff + (dfXOff - m_dfPrevRequestXOff);
+        dfNextYOff = dfYOff + (dfYOff - m_dfPrevRequestYOff);
+    }
+    m_dfPrevRequestXOff = dfXOff;
+    m_dfPrevRequestYOff = dfYOff;
+    m_dfPrevRequestXSize = dfXSize;
+    m_dfPrevRequestYSize = dfYSize;
+
+    if (dfNextXOff >= nRasterXSize || dfNextYOff >= nRasterYSize ||
+        dfNextXOff + dfXSize <= 0 || dfNextYOff + dfYSize <= 0)
+    {
+        return;
+    }
+
+    const double dfMinX = m_adfGeoTransform[GT_TOPLEFT_X] +
+                          dfNextXOff * m_adfGeoTransform[GT_WE_RES];
+    const double dfMaxX = dfMinX + dfXSize * m_adfGeoTransform[GT_WE_RES];
+    const double dfMaxY = m_adfGeoTransform[GT_TOPLEFT_Y] +
+                          dfNextYOff * m_adfGeoTransform[GT_NS_RES];
+    const double dfMinY = dfMaxY + dfYSize * m_adfGeoTransform[GT_NS_RES];
+
+    const auto anFeatures =
+        GetIntersectingFeatures(dfMinX, dfMinY, dfMaxX, dfMaxY);
+
+    // Limit the number of sources opened speculatively. Prefer the ones
+    // at the top of the stack.
+    constexpr size_t MAX_PREFETCHED_SOURCES = 100;
+    std::vector<std::string> aosTileNames;
+    for (size_t i = anFeatures.size(); i > 0 &&
+                                       aosTileNames.size() <
+                                           MAX_PREFETCHED_SOURCES;)
+    {
+        --i;
+        aosTileNames.push_back(GetAbsoluteFileName(
+            m_poFeatureIndex->apoFeatures[anFeatures[i]]->GetFieldAsString(
+                m_nLocationFieldIndex),
+            GetDescription()));
+    }
+    if (aosTileNames.empty())
+        return;
+
+    if (!m_poPrefetchJobQueue)
+    {
+        if (m_nNumThreads < 0)
+            m_nNumThreads = GetNumThreads();
+        auto psThreadPool = GDALGetGlobalThreadPool(std::max(1, m_nNumThreads));
+        if (!psThreadPool)
+        {
+            m_nPrefetch = false;
+            return;
+        }
+        m_poPrefetchJobQueue = psThreadPool->CreateJobQueue();
+    }
+
+    m_poPrefetchJobQueue->SubmitJob(
+        [this, aosTileNames = std::move(aosTileNames)]()
+        {
+            // Errors will be reported when the source is actually needed.
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            for (const auto &osTileName : aosTileNames)
+            {
+                SourceDesc oSourceDesc;
+                CPL_IGNORE_RET_VAL(GetSourceDesc(
+                    osTileName, oSourceDesc, &m_oQueueWorkingStates.oMutex));
+            }
+        });
+}
+
+/************************************************************************/
+/*                       WaitPrefetchCompletion()                       */
+/************************************************************************/
+
+void GDALTileIndexDataset::WaitPrefetchCompletion()
+{
+    if (m_poPrefetchJobQueue)
+        m_poPrefetchJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                          SortSourceDesc()                            */
 /************************************************************************/
@@ -4597,6 +4879,9 @@ CPLErr GDALTileIndexDataset::IRasterIO(
         return CE_Failure;
     }
 
+    // Open the sources of the next request while rendering this one.
+    PrefetchSources(dfXOff, dfYOff, dfXSize, dfYSize);
+
     // We might be called with nBandCount == 1 && panBandMap[0] == 0
     // to mean m_poMaskBand
     int nBandNrMax = 0;
@@ -4857,6 +5142,9 @@ void GDALRegister_GTI()
         "<Option name='NUM_THREADS' type='string' description="
         "'Number of worker threads for reading. Can be set to ALL_CPUS' "
         "default='ALL_CPUS'/>"
+        "  <Option name='PREFETCH' type='boolean' description="
+        "'Whether to open in advance the sources of the predicted next "
+        "request' default='NO'/>"
         "</OpenOptionList>");
 
 #ifdef BUILT_AS_PLUGIN
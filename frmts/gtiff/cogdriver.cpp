@@ -1112,11 +1112,53 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
     }
 
+    const char *pszOverviewCompress = CSLFetchNameValueDef(
+        papszOptions, "OVERVIEW_COMPRESS", osCompress.c_str());
+    const char *pszOvrPredictor =
+        CSLFetchNameValueDef(papszOptions, "OVERVIEW_PREDICTOR", "FALSE");
+    const char *pszOvrPredictorValue = GetPredictor(poSrcDS, pszOvrPredictor);
+
+    // When the overviews of the final product use a lossless codec with the
+    // same settings as the full resolution, generate the temporary overviews
+    // directly with those settings and the final tile size, so that the
+    // GTiff driver can copy their compressed tiles verbatim instead of
+    // decompressing and recompressing them.
+    const char *pszOvrBlockSizeConfig =
+        CPLGetConfigOption("GDAL_TIFF_OVR_BLOCKSIZE", nullptr);
+    const int nBlockSize = atoi(osBlockSize);
+    const bool bRawCopyOverviewTiles =
+        CPLGetConfigOption("COG_TMP_COMPRESSION", nullptr) == nullptr &&
+        EQUAL(pszOverviewCompress, osCompress) &&
+        (EQUAL(osCompress, "LZW") || EQUAL(osCompress, "DEFLATE") ||
+         EQUAL(osCompress, "ZSTD")) &&
+        (pszOvrBlockSizeConfig != nullptr ||
+         (nBlockSize >= 64 && nBlockSize <= 4096 &&
+          CPLIsPowerOfTwo(nBlockSize)));
+
     CPLStringList aosOverviewOptions;
-    aosOverviewOptions.SetNameValue(
-        "COMPRESS",
-        CPLGetConfigOption("COG_TMP_COMPRESSION",  // only for debug purposes
-                           HasZSTDCompression() ? "ZSTD" : "LZW"));
+    std::unique_ptr<CPLConfigOptionSetter> poOvrBlockSizeSetter;
+    if (bRawCopyOverviewTiles)
+    {
+        aosOverviewOptions.SetNameValue("COMPRESS", osCompress);
+        const char *pszLevel = CSLFetchNameValue(papszOptions, "LEVEL");
+        if (EQUAL(osCompress, "DEFLATE"))
+            aosOverviewOptions.SetNameValue("ZLEVEL", pszLevel);
+        else if (EQUAL(osCompress, "ZSTD"))
+            aosOverviewOptions.SetNameValue("ZSTD_LEVEL", pszLevel);
+        if (pszOvrBlockSizeConfig == nullptr)
+        {
+            poOvrBlockSizeSetter = std::make_unique<CPLConfigOptionSetter>(
+                "GDAL_TIFF_OVR_BLOCKSIZE", osBlockSize, true);
+        }
+    }
+    else
+    {
+        aosOverviewOptions.SetNameValue(
+            "COMPRESS",
+            CPLGetConfigOption(
+                "COG_TMP_COMPRESSION",  // only for debug purposes
+                HasZSTDCompression() ? "ZSTD" : "LZW"));
+    }
     aosOverviewOptions.SetNameValue(
         "NUM_THREADS", CSLFetchNameValue(papszOptions, "NUM_THREADS"));
     aosOverviewOptions.SetNameValue("BIGTIFF", "YES");
@@ -1173,7 +1215,15 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
 
         if (nBands > 1)
         {
-            aosOverviewOptions.SetNameValue("INTERLEAVE", "PIXEL");
+            aosOverviewOptions.SetNameValue(
+                "INTERLEAVE",
+                bRawCopyOverviewTiles && !EQUAL(pszInterleave, "PIXEL")
+                    ? "BAND"
+                    : "PIXEL");
+        }
+        if (bRawCopyOverviewTiles)
+        {
+            aosOverviewOptions.SetNameValue("PREDICTOR", pszOvrPredictorValue);
         }
         if (!m_osTmpMskOverviewFilename.empty())
         {
@@ -1193,6 +1243,7 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             return nullptr;
         }
     }
+    poOvrBlockSizeSetter.reset();
 
     CPLStringList aosOptions;
     aosOptions.SetNameValue("COPY_SRC_OVERVIEWS", "YES");
@@ -1265,6 +1316,9 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
                             CSLFetchNameValue(papszOptions, "GEOTIFF_VERSION"));
     aosOptions.SetNameValue("SPARSE_OK",
                             CSLFetchNameValue(papszOptions, "SPARSE_OK"));
+    aosOptions.SetNameValue(
+        "DEDUPLICATE_BLOCKS",
+        CSLFetchNameValue(papszOptions, "DEDUPLICATE_BLOCKS"));
     aosOptions.SetNameValue("NBITS", CSLFetchNameValue(papszOptions, "NBITS"));
 
     if (EQUAL(osOverviews, "NONE"))
@@ -1301,8 +1355,10 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
                                     CPLSPrintf("%d", nAlignedLevels));
         }
     }
-    const char *pszOverviewCompress = CSLFetchNameValueDef(
-        papszOptions, "OVERVIEW_COMPRESS", osCompress.c_str());
+    if (bRawCopyOverviewTiles && !m_osTmpOverviewFilename.empty())
+    {
+        aosOptions.SetNameValue("@RAW_COPY_OVERVIEW_TILES", "YES");
+    }
 
     CPLConfigOptionSetter ovrCompressSetter("COMPRESS_OVERVIEW",
                                             pszOverviewCompress, true);
@@ -1337,9 +1393,6 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             new CPLConfigOptionSetter("PHOTOMETRIC_OVERVIEW", "YCBCR", true));
     }
 
-    const char *osOvrPredictor =
-        CSLFetchNameValueDef(papszOptions, "OVERVIEW_PREDICTOR", "FALSE");
-    const char *pszOvrPredictorValue = GetPredictor(poSrcDS, osOvrPredictor);
     CPLConfigOptionSetter ovrPredictorSetter("PREDICTOR_OVERVIEW",
                                              pszOvrPredictorValue, true);
 
@@ -1632,6 +1685,9 @@ void GDALCOGDriver::InitializeCreationOptionList()
 #endif
         "   <Option name='SPARSE_OK' type='boolean' description='Should empty "
         "blocks be omitted on disk?' default='FALSE'/>"
+        "   <Option name='DEDUPLICATE_BLOCKS' type='boolean' "
+        "description='Whether blocks with identical content should share the "
+        "same data on disk' default='FALSE'/>"
         "   <Option name='STATISTICS' type='string-select' default='AUTO' "
         "description='Which to add statistics to the output file'>"
         "       <Value>AUTO</Value>"
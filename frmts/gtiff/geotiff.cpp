@@ -1367,6 +1367,9 @@ void GDALRegister_GTiff()
         "   </Option>"
         "   <Option name='SPARSE_OK' type='boolean' description='Should empty "
         "blocks be omitted on disk?' default='FALSE'/>"
+        "   <Option name='DEDUPLICATE_BLOCKS' type='boolean' "
+        "description='Whether blocks with identical content should share the "
+        "same data on disk' default='FALSE'/>"
         "   <Option name='ALPHA' type='string-select' description='Mark first "
         "extrasample as being alpha'>"
         "       <Value>NON-PREMULTIPLIED</Value>"
@@ -1484,6 +1487,12 @@ void GDALRegister_GTiff()
         "   <Option name='IGNORE_COG_LAYOUT_BREAK' type='boolean' "
         "description='Allow update mode on files with COG structure' "
         "default='FALSE'/>"
+        "   <Option name='PARTIAL_REFRESH_OVERVIEWS' type='boolean' "
+        "description='In update mode, whether to refresh at closing the parts "
+        "of the overviews covering modified blocks' default='FALSE'/>"
+        "   <Option name='OVERVIEW_RESAMPLING' type='string' "
+        "description='Resampling method used by PARTIAL_REFRESH_OVERVIEWS. "
+        "Defaults to the one recorded in the overviews, or NEAREST'/>"
         "   <Option name='COLOR_TABLE_MULTIPLIER' type='string-select' "
         "description='Multiplication factor to apply to go from GDAL color "
         "table to TIFF color table' "
@@ -1527,6 +1536,11 @@ void GDALRegister_GTiff()
     poDriver->pfnCreateCopy = GTiffDataset::CreateCopy;
     poDriver->pfnUnloadDriver = GDALDeregister_GTiff;
     poDriver->pfnIdentify = GTiffDataset::Identify;
+    // Classic TIFF and BigTIFF, with both byte orders for the version number
+    // as GTiffDataset::Identify() accepts.
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "49492A00 4949002A 49492B00 4949002B "
+                              "4D4D2A00 4D4D002A 4D4D2B00 4D4D002B");
     poDriver->pfnGetSubdatasetInfoFunc = GTiffDriverGetSubdatasetInfo;
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
@@ -184,6 +184,30 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
         CPLVirtualMemFree(m_psVirtualMemIOMapping);
     m_psVirtualMemIOMapping = nullptr;
 
+    /* -------------------------------------------------------------------- */
+    /*      Refresh the overviews where the imagery has been modified.      */
+    /* -------------------------------------------------------------------- */
+    if (m_bPartialRefreshOverviews)
+    {
+        // Make sure that all modified blocks have been written, so that they
+        // are recorded.
+        if (FlushCacheInternal(true, /* at closing */
+                               false /* do not call FlushDirectory */) !=
+            CE_None)
+        {
+            eErr = CE_Failure;
+        }
+        if (m_poMaskDS && m_poMaskDS->FlushCache(false) != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+        m_bPartialRefreshOverviews = false;
+        if (PartialRefreshOverviews() != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Fill in missing blocks with empty data.                         */
     /* -------------------------------------------------------------------- */
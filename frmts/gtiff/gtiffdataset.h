@@ -16,8 +16,12 @@
 
 #include "gdal_pam.h"
 
+#include <map>
 #include <mutex>
 #include <queue>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "cpl_mem_cache.h"
 #include "cpl_worker_thread_pool.h"  // CPLJobQueue, CPLWorkerThreadPool
@@ -119,6 +123,8 @@ class GTiffDataset final : public GDALPamDataset
     friend void GTIFFSetJXLAlphaDistance(GDALDatasetH hGTIFFDS,
                                          float fAlphaDistance);
 #endif
+    friend void GTIFFStoreHeaderCache(const std::string &osKey,
+                                      GTiffDataset *poDS);
 
     TIFF *m_hTIFF = nullptr;
     VSILFILE *m_fpL = nullptr;
@@ -151,6 +157,20 @@ class GTiffDataset final : public GDALPamDataset
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
         m_oCacheStrileToOffsetByteCount{1024};
 
+    // Blocks of the full resolution imagery grid written, in the imagery or
+    // in the mask, since opening with PARTIAL_REFRESH_OVERVIEWS=YES.
+    std::set<int> m_oSetModifiedBlocks{};
+    std::string m_osPartialRefreshResampling{};
+    bool m_bPartialRefreshOverviews = false;
+
+    // Content keys (size and SHA256 of the uncompressed data) of the striles
+    // written with DEDUPLICATE_BLOCKS=YES, and striles whose data is shared
+    // with other striles.
+    std::map<std::string, int> m_oMapDedupKeyToStrile{};
+    std::map<int, std::string> m_oMapDedupStrileToKey{};
+    std::vector<bool> m_abDedupSharedStriles{};
+    bool m_bDeduplicateBlocks = false;  // only set on the main dataset
+
     MaskOffset *m_panMaskOffsetLsb = nullptr;
     char *m_pszVertUnit = nullptr;
     char *m_pszFilename = nullptr;
@@ -337,6 +357,8 @@ class GTiffDataset final : public GDALPamDataset
                           int bPreserveDataBuffer);
     bool WriteEncodedStrip(uint32_t strip, GByte *pabyData,
                            int bPreserveDataBuffer);
+    bool DeduplicateStrile(int nStrile, const GByte *pabyData,
+                           GPtrDiff_t nSize);
 
     template <typename T>
     void WriteDealWithLercAndNan(T *pBuffer, int nActualBlockWidth,
@@ -350,6 +372,8 @@ class GTiffDataset final : public GDALPamDataset
 
     CPLErr FlushDirectory();
     CPLErr CleanOverviews();
+    void RecordModifiedBlock(const GTiffDataset *poDS, int nBlockId);
+    CPLErr PartialRefreshOverviews();
 
     void LoadMetadata();
     void LoadEXIFMetadata();
@@ -428,8 +452,13 @@ class GTiffDataset final : public GDALPamDataset
     static CPLErr CopyImageryAndMask(GTiffDataset *poDstDS,
                                      GDALDataset *poSrcDS,
                                      GDALRasterBand *poSrcMaskBand,
+                                     GTiffDataset *poSrcRawDS,
                                      GDALProgressFunc pfnProgress,
                                      void *pProgressData);
+    static bool CanCopyRawStripsOrTiles(GTiffDataset *poDstDS,
+                                        GTiffDataset *poSrcDS);
+    bool CopyRawStripOrTile(GTiffDataset *poSrcDS, int nBlockId,
+                            std::vector<GByte> &abyBuffer, bool &bError);
 
     bool GetOverviewParameters(int &nCompression, uint16_t &nPlanarConfig,
                                uint16_t &nPredictor, uint16_t &nPhotometric,
@@ -469,7 +498,8 @@ class GTiffDataset final : public GDALPamDataset
     CPLErr SetGCPs(int nGCPCountIn, const GDAL_GCP *pasGCPListIn,
                    const OGRSpatialReference *poSRS) override;
 
-    bool IsMultiThreadedReadCompatible() const;
+    bool IsMultiThreadedReadCompatible(bool bAllow1Bit = false) const;
+    bool CanReadMaskWithData(int nXBlocks, int nYBlocks);
     CPLErr MultiThreadedRead(int nXOff, int nYOff, int nXSize, int nYSize,
                              void *pData, GDALDataType eBufType, int nBandCount,
                              const int *panBandMap, GSpacing nPixelSpace,
@@ -12,6 +12,7 @@
  ****************************************************************************/
 
 #include "gtiffdataset.h"
+#include "gtiffheadercache.h"
 #include "gtiffrasterband.h"
 #include "gtiffjpegoverviewds.h"
 #include "gtiffrgbaband.h"
@@ -370,6 +371,9 @@ struct GTiffDecompressContext
     bool bUseBIPOptim = false;
     bool bUseDeinterleaveOptimNoBlockCache = false;
     bool bUseDeinterleaveOptimBlockCache = false;
+    // Offset in pabyData of the destination of each band of the dataset,
+    // when bUseDeinterleaveOptimNoBlockCache is set.
+    std::vector<GSpacing> anDstBandOffset{};
     bool bIsTiled = false;
     bool bTIFFIsBigEndian = false;
     int nBlocksPerRow = 0;
@@ -383,6 +387,10 @@ struct GTiffDecompressContext
 
     uint16_t *pExtraSamples = nullptr;
     uint16_t nExtraSampleCount = 0;
+
+    // Only fill the block cache, without writing into pabyData. Used to
+    // decode the mask tiles/strips together with the imagery ones.
+    bool bCacheOnly = false;
 };
 
 struct GTiffDecompressJob
@@ -471,6 +479,8 @@ struct GTiffDecompressJob
 
     if (psJob->nSize == 0)
     {
+        if (psContext->bCacheOnly)
+            return;
         {
             std::lock_guard<std::recursive_mutex> oLock(psContext->oMutex);
             if (!psContext->bSuccess)
@@ -771,20 +781,28 @@ struct GTiffDecompressJob
                 ? poDS->m_nBlockYSize
                 : poDS->nRasterYSize % poDS->m_nBlockYSize;
 
-        const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
-                                nBlockReqYSize * nBandsPerStrile * nDTSize;
+        // Single-band 1-bit data (only used for masks) is decoded packed,
+        // and expanded afterwards.
+        const bool bPackedBits = poDS->m_nBitsPerSample == 1;
+        const size_t nReqSize =
+            bPackedBits
+                ? static_cast<size_t>((poDS->m_nBlockXSize + 7) / 8) *
+                      nBlockReqYSize
+                : static_cast<size_t>(poDS->m_nBlockXSize) * nBlockReqYSize *
+                      nBandsPerStrile * nDTSize;
 
         GByte *pabyOutput;
         std::vector<GByte> abyOutput;
         if (poDS->m_nCompression == COMPRESSION_NONE &&
             !TIFFIsByteSwapped(poDS->m_hTIFF) && abyInput.size() >= nReqSize &&
-            (psContext->bSkipBlockCache || nBandsPerStrile > 1))
+            (psContext->bSkipBlockCache || nBandsPerStrile > 1 || bPackedBits))
         {
             pabyOutput = abyInput.data();
         }
         else
         {
-            if (psContext->bSkipBlockCache || nBandsPerStrile > 1)
+            if (psContext->bSkipBlockCache || nBandsPerStrile > 1 ||
+                bPackedBits)
             {
                 abyOutput.resize(nReqSize);
                 pabyOutput = abyOutput.data();
@@ -812,7 +830,29 @@ struct GTiffDecompressJob
             return;
         }
 
-        if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
+        if (bPackedBits)
+        {
+            CPLAssert(!psContext->bSkipBlockCache && nBandsPerStrile == 1);
+            const GByte *CPL_RESTRICT pabySrc = pabyOutput;
+            GByte *CPL_RESTRICT pabyDest =
+                static_cast<GByte *>(apoBlocks[0]->GetDataRef());
+            for (int iLine = 0; iLine < nBlockReqYSize; ++iLine)
+            {
+                if (poDS->m_bPromoteTo8Bits)
+                {
+                    GDALExpandPackedBitsToByteAt0Or255(pabySrc, pabyDest,
+                                                       poDS->m_nBlockXSize);
+                }
+                else
+                {
+                    GDALExpandPackedBitsToByteAt0Or1(pabySrc, pabyDest,
+                                                     poDS->m_nBlockXSize);
+                }
+                pabySrc += (poDS->m_nBlockXSize + 7) / 8;
+                pabyDest += poDS->m_nBlockXSize;
+            }
+        }
+        else if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
         {
             // Copy pixel-interleaved all-band buffer to cached blocks
 
@@ -850,6 +890,9 @@ struct GTiffDecompressJob
             }
         }
 
+        if (psContext->bCacheOnly)
+            return;
+
         const GByte *pSrcPtr =
             pabyOutput +
             (static_cast<size_t>(nYOffsetInBlock) * poDS->m_nBlockXSize +
@@ -879,20 +922,18 @@ struct GTiffDecompressJob
             if (psContext->bUseDeinterleaveOptimNoBlockCache)
             {
                 // Optimization
-                std::vector<void *> ppDestBuffers(psContext->nBandCount);
-                for (int i = 0; i < psContext->nBandCount; ++i)
+                std::vector<void *> ppDestBuffers(poDS->nBands);
+                for (int i = 0; i < poDS->nBands; ++i)
                 {
-                    ppDestBuffers[i] =
-                        pDstPtr +
-                        (psContext->panBandMap[i] - 1) * psContext->nBandSpace;
+                    ppDestBuffers[i] = pDstPtr + psContext->anDstBandOffset[i];
                 }
                 for (int y = 0; y < nYSize; ++y)
                 {
-                    GDALDeinterleave(
-                        pSrcPtr, psContext->eDT, psContext->nBandCount,
-                        ppDestBuffers.data(), psContext->eDT, nXSize);
+                    GDALDeinterleave(pSrcPtr, psContext->eDT, poDS->nBands,
+                                     ppDestBuffers.data(), psContext->eBufType,
+                                     nXSize);
                     pSrcPtr += nSrcLineInc;
-                    for (int i = 0; i < psContext->nBandCount; ++i)
+                    for (int i = 0; i < poDS->nBands; ++i)
                     {
                         ppDestBuffers[i] =
                             static_cast<GByte *>(ppDestBuffers[i]) +
@@ -929,6 +970,8 @@ struct GTiffDecompressJob
     }
 
     CPLAssert(!psContext->bSkipBlockCache);
+    if (psContext->bCacheOnly)
+        return;
 
     // Compose cached blocks into final buffer
     for (int i = 0; i < nBandsToWrite; ++i)
@@ -963,10 +1006,13 @@ struct GTiffDecompressJob
 /*                    IsMultiThreadedReadCompatible()                   */
 /************************************************************************/
 
-bool GTiffDataset::IsMultiThreadedReadCompatible() const
+// If bAllow1Bit is set, single-band 1-bit datasets are also accepted, but
+// ThreadDecompressionFunc() can only decode them in bCacheOnly mode.
+bool GTiffDataset::IsMultiThreadedReadCompatible(bool bAllow1Bit) const
 {
-    return cpl::down_cast<GTiffRasterBand *>(papoBands[0])
-               ->IsBaseGTiffClass() &&
+    return (cpl::down_cast<GTiffRasterBand *>(papoBands[0])
+                ->IsBaseGTiffClass() ||
+            (bAllow1Bit && nBands == 1 && m_nBitsPerSample == 1)) &&
            !m_bStreamingIn && !m_bStreamingOut &&
            (m_nCompression == COMPRESSION_NONE ||
             m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
@@ -981,6 +1027,36 @@ bool GTiffDataset::IsMultiThreadedReadCompatible() const
             m_nCompression == COMPRESSION_JPEG);
 }
 
+/************************************************************************/
+/*                        CanReadMaskWithData()                         */
+/************************************************************************/
+
+// Returns whether the tiles/strips of the internal per-dataset mask can be
+// fetched and decoded by MultiThreadedRead() together with the imagery ones.
+bool GTiffDataset::CanReadMaskWithData(int nXBlocks, int nYBlocks)
+{
+    const char *pszReadMaskWithData =
+        CPLGetConfigOption("GTIFF_READ_MASK_WITH_DATA", nullptr);
+    if (pszReadMaskWithData ? !CPLTestBool(pszReadMaskWithData)
+                            : !m_bMaskInterleavedWithImagery)
+    {
+        return false;
+    }
+    ScanDirectories();
+    if (m_poMaskDS == nullptr || eAccess != GA_ReadOnly ||
+        m_poMaskDS->GetRasterCount() != 1 ||
+        m_poMaskDS->m_nBlockXSize != m_nBlockXSize ||
+        m_poMaskDS->m_nBlockYSize != m_nBlockYSize ||
+        !m_poMaskDS->IsMultiThreadedReadCompatible(/* bAllow1Bit = */ true))
+    {
+        return false;
+    }
+    // Do not evict the imagery blocks from the block cache
+    const GIntBig nRequiredMem = static_cast<GIntBig>(nXBlocks) * nYBlocks *
+                                 m_nBlockXSize * m_nBlockYSize;
+    return nRequiredMem <= GDALGetCacheMax64() / 4;
+}
+
 /************************************************************************/
 /*                        MultiThreadedRead()                           */
 /************************************************************************/
@@ -1042,6 +1118,23 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     sContext.nPredictor = PREDICTOR_NONE;
     sContext.nBlocksPerRow = m_nBlocksPerRow;
 
+    // Whether each band of the dataset is requested exactly once, in any
+    // order.
+    bool bAllBandsOnce = nBandCount == nBands;
+    if (bAllBandsOnce)
+    {
+        std::vector<bool> abRequested(nBands);
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (abRequested[panBandMap[i] - 1])
+            {
+                bAllBandsOnce = false;
+                break;
+            }
+            abRequested[panBandMap[i] - 1] = true;
+        }
+    }
+
     if (m_bDirectIO)
     {
         sContext.bSkipBlockCache = true;
@@ -1049,23 +1142,24 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     else if (nXOff == 0 && nYOff == 0 && nXSize == nRasterXSize &&
              nYSize == nRasterYSize)
     {
-        if (m_nPlanarConfig == PLANARCONFIG_SEPARATE)
-        {
-            sContext.bSkipBlockCache = true;
-        }
-        else if (nBandCount == nBands)
+        if (m_nPlanarConfig == PLANARCONFIG_SEPARATE || bAllBandsOnce)
         {
             sContext.bSkipBlockCache = true;
-            for (int i = 0; i < nBands; ++i)
-            {
-                if (panBandMap[i] != i + 1)
-                {
-                    sContext.bSkipBlockCache = false;
-                    break;
-                }
-            }
         }
     }
+    else if (m_nPlanarConfig == PLANARCONFIG_CONTIG && bAllBandsOnce &&
+             (nXOff % m_nBlockXSize) == 0 && (nYOff % m_nBlockYSize) == 0 &&
+             ((nXOff + nXSize) % m_nBlockXSize == 0 ||
+              nXOff + nXSize == nRasterXSize) &&
+             ((nYOff + nYSize) % m_nBlockYSize == 0 ||
+              nYOff + nYSize == nRasterYSize))
+    {
+        // All bands of whole tiles/strips are requested: they are unlikely to
+        // be requested again by a read of a neighbouring window, so decode
+        // each pixel-interleaved tile/strip directly into the output buffer,
+        // rather than caching a de-interleaved copy of it per band.
+        sContext.bSkipBlockCache = true;
+    }
 
     if (m_nPlanarConfig == PLANARCONFIG_CONTIG && nBandCount == nBands &&
         nPixelSpace == nBands * static_cast<GSpacing>(sContext.nBufDTSize))
@@ -1081,17 +1175,22 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         }
     }
 
-    if (m_nPlanarConfig == PLANARCONFIG_CONTIG &&
-        (nBands == 3 || nBands == 4) && nBands == nBandCount &&
-        (sContext.eDT == GDT_Byte || sContext.eDT == GDT_Int16 ||
-         sContext.eDT == GDT_UInt16))
+    // GDALDeinterleave() has SIMD or vectorized code paths for 2 to 4 bands
+    // of the same data type, and otherwise is as fast as the general case.
+    if (m_nPlanarConfig == PLANARCONFIG_CONTIG && nBands > 1 &&
+        nBands == nBandCount)
     {
         if (sContext.bSkipBlockCache)
         {
-            if (sContext.eBufType == sContext.eDT &&
-                nPixelSpace == sContext.nBufDTSize)
+            if (bAllBandsOnce && nPixelSpace == sContext.nBufDTSize)
             {
                 sContext.bUseDeinterleaveOptimNoBlockCache = true;
+                sContext.anDstBandOffset.resize(nBands);
+                for (int i = 0; i < nBandCount; ++i)
+                {
+                    sContext.anDstBandOffset[panBandMap[i] - 1] =
+                        i * nBandSpace;
+                }
             }
         }
         else
@@ -1131,12 +1230,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         else
         {
             sContext.bCacheAllBands = true;
-            if ((nBands == 3 || nBands == 4) &&
-                (sContext.eDT == GDT_Byte || sContext.eDT == GDT_Int16 ||
-                 sContext.eDT == GDT_UInt16))
-            {
-                sContext.bUseDeinterleaveOptimBlockCache = true;
-            }
+            sContext.bUseDeinterleaveOptimBlockCache = true;
         }
     }
 
@@ -1243,32 +1337,75 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
             sContext.poHandle->Flush();
     }
 
-    if (GTIFFSupportsPredictor(m_nCompression))
+    const auto GetCodecParameters =
+        [](const GTiffDataset *poDS, GTiffDecompressContext &sCtxt)
     {
-        TIFFGetField(m_hTIFF, TIFFTAG_PREDICTOR, &sContext.nPredictor);
-    }
-    else if (m_nCompression == COMPRESSION_JPEG)
-    {
-        TIFFGetField(m_hTIFF, TIFFTAG_JPEGTABLES, &sContext.nJPEGTableSize,
-                     &sContext.pJPEGTable);
-        if (m_nPhotometric == PHOTOMETRIC_YCBCR)
+        if (GTIFFSupportsPredictor(poDS->m_nCompression))
         {
-            TIFFGetFieldDefaulted(m_hTIFF, TIFFTAG_YCBCRSUBSAMPLING,
-                                  &sContext.nYCrbCrSubSampling0,
-                                  &sContext.nYCrbCrSubSampling1);
+            TIFFGetField(poDS->m_hTIFF, TIFFTAG_PREDICTOR, &sCtxt.nPredictor);
         }
-    }
-    if (m_nPlanarConfig == PLANARCONFIG_CONTIG)
-    {
-        TIFFGetField(m_hTIFF, TIFFTAG_EXTRASAMPLES, &sContext.nExtraSampleCount,
-                     &sContext.pExtraSamples);
+        else if (poDS->m_nCompression == COMPRESSION_JPEG)
+        {
+            TIFFGetField(poDS->m_hTIFF, TIFFTAG_JPEGTABLES,
+                         &sCtxt.nJPEGTableSize, &sCtxt.pJPEGTable);
+            if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+            {
+                TIFFGetFieldDefaulted(poDS->m_hTIFF, TIFFTAG_YCBCRSUBSAMPLING,
+                                      &sCtxt.nYCrbCrSubSampling0,
+                                      &sCtxt.nYCrbCrSubSampling1);
+            }
+        }
+        if (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        {
+            TIFFGetField(poDS->m_hTIFF, TIFFTAG_EXTRASAMPLES,
+                         &sCtxt.nExtraSampleCount, &sCtxt.pExtraSamples);
+        }
+    };
+    GetCodecParameters(this, sContext);
+
+    // Most readers of the imagery of a dataset with an internal mask will
+    // read the mask afterwards. Fetch and decode the mask tiles/strips in the
+    // same batch as the imagery ones, into the block cache of the mask band,
+    // so that the mask read does not trigger new I/O.
+    GTiffDecompressContext sMaskContext;
+    std::vector<GTiffDecompressJob> asMaskJobs;
+    const bool bReadMaskWithData = CanReadMaskWithData(nXBlocks, nYBlocks);
+    static const int nMaskBand = 1;
+    if (bReadMaskWithData)
+    {
+        sMaskContext.poHandle = sContext.poHandle;
+        sMaskContext.bHasPRead = sContext.bHasPRead;
+        sMaskContext.poDS = m_poMaskDS;
+        sMaskContext.eDT = GDT_Byte;
+        sMaskContext.nXOff = nXOff;
+        sMaskContext.nYOff = nYOff;
+        sMaskContext.nXSize = nXSize;
+        sMaskContext.nYSize = nYSize;
+        sMaskContext.nBlockXStart = nBlockXStart;
+        sMaskContext.nBlockXEnd = nBlockXEnd;
+        sMaskContext.nBlockYStart = nBlockYStart;
+        sMaskContext.nBlockYEnd = nBlockYEnd;
+        sMaskContext.eBufType = GDT_Byte;
+        sMaskContext.nBufDTSize = 1;
+        sMaskContext.nBandCount = 1;
+        sMaskContext.panBandMap = &nMaskBand;
+        sMaskContext.bIsTiled = CPL_TO_BOOL(TIFFIsTiled(m_poMaskDS->m_hTIFF));
+        sMaskContext.bTIFFIsBigEndian = sContext.bTIFFIsBigEndian;
+        sMaskContext.nPredictor = PREDICTOR_NONE;
+        sMaskContext.nBlocksPerRow = m_poMaskDS->m_nBlocksPerRow;
+        sMaskContext.bCacheOnly = true;
+        GetCodecParameters(m_poMaskDS, sMaskContext);
+        asMaskJobs.reserve(static_cast<size_t>(nXBlocks) * nYBlocks);
     }
 
     // Create one job per tile/strip
     vsi_l_offset nFileSize = 0;
     std::vector<GTiffDecompressJob> asJobs(nBlocks);
-    std::vector<vsi_l_offset> anOffsets(nBlocks);
-    std::vector<size_t> anSizes(nBlocks);
+    const size_t nMaxAdviseReadRanges =
+        nBlocks +
+        (bReadMaskWithData ? static_cast<size_t>(nXBlocks) * nYBlocks : 0);
+    std::vector<vsi_l_offset> anOffsets(nMaxAdviseReadRanges);
+    std::vector<size_t> anSizes(nMaxAdviseReadRanges);
     int iJob = 0;
     int nAdviseReadRanges = 0;
     const size_t nAdviseReadTotalBytesLimit =
@@ -1443,6 +1580,53 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
 
                 ++iJob;
             }
+
+            if (bReadMaskWithData)
+            {
+                GTiffDecompressJob sMaskJob;
+                sMaskJob.psContext = &sMaskContext;
+                sMaskJob.iSrcBandIdxSeparate = -1;
+                sMaskJob.iDstBandIdxSeparate = -1;
+                sMaskJob.nXBlock = nBlockXStart + x;
+                sMaskJob.nYBlock = nBlockYStart + y;
+
+                auto poBlock =
+                    m_poMaskDS->GetRasterBand(1)->TryGetLockedBlockRef(
+                        sMaskJob.nXBlock, sMaskJob.nYBlock);
+                if (poBlock)
+                {
+                    poBlock->DropLock();
+                    continue;
+                }
+
+                // Errors and sparse blocks are left to the regular reading
+                // of the mask.
+                const int nMaskBlockId =
+                    sMaskJob.nXBlock +
+                    sMaskJob.nYBlock * sMaskContext.nBlocksPerRow;
+                bool bErrorInIsBlockAvailable = false;
+                if (!m_poMaskDS->IsBlockAvailable(
+                        nMaskBlockId, &sMaskJob.nOffset, &sMaskJob.nSize,
+                        &bErrorInIsBlockAvailable) ||
+                    bErrorInIsBlockAvailable || sMaskJob.nSize == 0 ||
+                    sMaskJob.nSize > 100U * 1024 * 1024)
+                {
+                    continue;
+                }
+                asMaskJobs.push_back(sMaskJob);
+
+                const size_t nMaskSize = static_cast<size_t>(sMaskJob.nSize);
+                if (nAdviseReadTotalBytesLimit == 0 ||
+                    (nAdviseReadAccBytes <= nAdviseReadTotalBytesLimit &&
+                     nMaskSize <=
+                         nAdviseReadTotalBytesLimit - nAdviseReadAccBytes))
+                {
+                    anOffsets[nAdviseReadRanges] = sMaskJob.nOffset;
+                    anSizes[nAdviseReadRanges] = nMaskSize;
+                    nAdviseReadAccBytes += nMaskSize;
+                    ++nAdviseReadRanges;
+                }
+            }
         }
     }
 
@@ -1463,6 +1647,10 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         {
             poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
         }
+        for (auto &sJob : asMaskJobs)
+        {
+            poQueue->SubmitJob(ThreadDecompressionFunc, &sJob);
+        }
 
         // Wait for all jobs to have been completed
         poQueue->WaitCompletion();
@@ -1471,6 +1659,18 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         ReacquireReadWriteLock();
 
         sContext.oErrorAccumulator.ReplayErrors();
+
+        if (!sMaskContext.bSuccess)
+        {
+            // Discard the possibly partially decoded mask blocks. Errors will
+            // be reported by the regular reading of the mask.
+            CPLDebug("GTiff", "Failed to decode mask together with imagery");
+            for (const auto &sJob : asMaskJobs)
+            {
+                m_poMaskDS->GetRasterBand(1)->FlushBlock(sJob.nXBlock,
+                                                         sJob.nYBlock, FALSE);
+            }
+        }
     }
 
     return sContext.bSuccess ? CE_None : CE_Failure;
@@ -3813,6 +4013,29 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
             return nullptr;
     }
 
+    // Use the persistent header cache for read-only COG files, whose
+    // IFDs and strile arrays are all located at the beginning of the file.
+    std::string osHeaderCacheKey;
+    bool bStoreHeaderCache = false;
+    if (!bStreaming && poOpenInfo->eAccess == GA_ReadOnly &&
+        poOpenInfo->nHeaderBytes > 16 &&
+        (strstr(reinterpret_cast<const char *>(poOpenInfo->pabyHeader) + 8,
+                "LAYOUT=IFDS_BEFORE_DATA") != nullptr ||
+         strstr(reinterpret_cast<const char *>(poOpenInfo->pabyHeader) + 16,
+                "LAYOUT=IFDS_BEFORE_DATA") != nullptr))
+    {
+        osHeaderCacheKey = GTIFFGetHeaderCacheKey(pszFilename);
+        if (!osHeaderCacheKey.empty())
+        {
+            VSILFILE *fpCached =
+                GTIFFOpenHeaderCacheHandle(osHeaderCacheKey, poOpenInfo->fpL);
+            if (fpCached)
+                poOpenInfo->fpL = fpCached;
+            else
+                bStoreHeaderCache = true;
+        }
+    }
+
     // Store errors/warnings and emit them later.
     TIFF *l_hTIFF;
     CPLErrorAccumulator oErrorAccumulator;
@@ -3976,6 +4199,15 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
     poDS->InitCreationOrOpenOptions(poOpenInfo->eAccess == GA_Update,
                                     poOpenInfo->papszOpenOptions);
 
+    if (poOpenInfo->eAccess == GA_Update &&
+        CPLFetchBool(poOpenInfo->papszOpenOptions, "PARTIAL_REFRESH_OVERVIEWS",
+                     false))
+    {
+        poDS->m_bPartialRefreshOverviews = true;
+        poDS->m_osPartialRefreshResampling = CSLFetchNameValueDef(
+            poOpenInfo->papszOpenOptions, "OVERVIEW_RESAMPLING", "");
+    }
+
     poDS->m_bLoadPam = true;
     poDS->m_bColorProfileMetadataChanged = false;
     poDS->m_bMetadataChanged = false;
@@ -4011,6 +4243,9 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
         poDS->LoadGeoreferencingAndPamIfNeeded();
     }
 
+    if (bStoreHeaderCache && poDS->m_bLayoutIFDSBeforeData)
+        GTIFFStoreHeaderCache(osHeaderCacheKey, poDS);
+
     return poDS;
 }
 
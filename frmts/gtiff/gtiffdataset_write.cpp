@@ -19,8 +19,10 @@
 #include <cerrno>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -32,6 +34,7 @@
 #include "cpl_error_internal.h"  // CPLErrorHandlerAccumulatorStruct
 #include "cpl_float.h"
 #include "cpl_md5.h"
+#include "cpl_sha256.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
@@ -760,6 +763,9 @@ bool GTiffDataset::WriteEncodedTile(uint32_t tile, GByte *pabyData,
     /* -------------------------------------------------------------------- */
     /*      Should we do compression in a worker thread ?                   */
     /* -------------------------------------------------------------------- */
+    if (DeduplicateStrile(static_cast<int>(tile), pabyData, cc))
+        return true;
+
     if (SubmitCompressionJob(tile, pabyData, cc, m_nBlockYSize))
         return true;
 
@@ -879,12 +885,111 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
     /* -------------------------------------------------------------------- */
     /*      Should we do compression in a worker thread ?                   */
     /* -------------------------------------------------------------------- */
+    if (DeduplicateStrile(static_cast<int>(strip), pabyData, cc))
+        return true;
+
     if (SubmitCompressionJob(strip, pabyData, cc, nStripHeight))
         return true;
 
     return TIFFWriteEncodedStrip(m_hTIFF, strip, pabyData, cc) == cc;
 }
 
+/************************************************************************/
+/*                         DeduplicateStrile()                          */
+/************************************************************************/
+
+// When DEDUPLICATE_BLOCKS=YES is set, checks whether the uncompressed data
+// of the strile to write is identical to the one of an already written
+// strile. If so, the offset and byte count of the latter are reused for
+// nStrile, and true is returned. Otherwise the caller must write the strile.
+bool GTiffDataset::DeduplicateStrile(int nStrile, const GByte *pabyData,
+                                     GPtrDiff_t nSize)
+{
+    const GTiffDataset *poRootDS = m_poBaseDS ? m_poBaseDS : this;
+    if (!poRootDS->m_bDeduplicateBlocks)
+        return false;
+
+    const bool bIsTiled = CPL_TO_BOOL(TIFFIsTiled(m_hTIFF));
+    toff_t *panOffsets = nullptr;
+    toff_t *panByteCounts = nullptr;
+    const auto GetStrileArrays = [this, bIsTiled, &panOffsets, &panByteCounts]()
+    {
+        return TIFFGetField(m_hTIFF,
+                            bIsTiled ? TIFFTAG_TILEOFFSETS
+                                     : TIFFTAG_STRIPOFFSETS,
+                            &panOffsets) &&
+               TIFFGetField(m_hTIFF,
+                            bIsTiled ? TIFFTAG_TILEBYTECOUNTS
+                                     : TIFFTAG_STRIPBYTECOUNTS,
+                            &panByteCounts) &&
+               panOffsets != nullptr && panByteCounts != nullptr;
+    };
+
+    // Forget about the previous content of the strile.
+    const auto oIterPrevKey = m_oMapDedupStrileToKey.find(nStrile);
+    if (oIterPrevKey != m_oMapDedupStrileToKey.end())
+    {
+        const auto oIter = m_oMapDedupKeyToStrile.find(oIterPrevKey->second);
+        if (oIter != m_oMapDedupKeyToStrile.end() && oIter->second == nStrile)
+            m_oMapDedupKeyToStrile.erase(oIter);
+        m_oMapDedupStrileToKey.erase(oIterPrevKey);
+    }
+    if (static_cast<size_t>(nStrile) < m_abDedupSharedStriles.size() &&
+        m_abDedupSharedStriles[nStrile])
+    {
+        // The data of the strile is shared with other striles, so it must
+        // not be rewritten in place: forces libtiff to append the new data.
+        m_abDedupSharedStriles[nStrile] = false;
+        WaitCompletionForBlock(nStrile);
+        if (GetStrileArrays())
+        {
+            panOffsets[nStrile] = 0;
+            panByteCounts[nStrile] = 0;
+        }
+    }
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(pabyData, static_cast<size_t>(nSize), abyHash);
+    std::string osKey(reinterpret_cast<const char *>(abyHash), sizeof(abyHash));
+    osKey += CPLSPrintf(":" CPL_FRMT_GIB, static_cast<GIntBig>(nSize));
+
+    const auto oIter = m_oMapDedupKeyToStrile.find(osKey);
+    if (oIter == m_oMapDedupKeyToStrile.end())
+    {
+        m_oMapDedupKeyToStrile[osKey] = nStrile;
+        m_oMapDedupStrileToKey[nStrile] = std::move(osKey);
+        return false;
+    }
+
+    const int nSrcStrile = oIter->second;
+    // Make sure that the identical strile has been written.
+    WaitCompletionForBlock(nSrcStrile);
+    if (!GetStrileArrays() || panByteCounts[nSrcStrile] == 0)
+        return false;
+
+    // Writing zero byte lets libtiff know that the strile arrays have been
+    // modified, so that they are serialized back when the directory is
+    // flushed.
+    const tmsize_t nWritten =
+        bIsTiled ? TIFFWriteRawTile(m_hTIFF, nStrile,
+                                    const_cast<GByte *>(pabyData), 0)
+                 : TIFFWriteRawStrip(m_hTIFF, nStrile,
+                                     const_cast<GByte *>(pabyData), 0);
+    if (nWritten != 0 || !GetStrileArrays())
+        return false;
+    panOffsets[nStrile] = panOffsets[nSrcStrile];
+    panByteCounts[nStrile] = panByteCounts[nSrcStrile];
+
+    if (m_abDedupSharedStriles.empty())
+    {
+        m_abDedupSharedStriles.resize(bIsTiled ? TIFFNumberOfTiles(m_hTIFF)
+                                               : TIFFNumberOfStrips(m_hTIFF));
+    }
+    m_abDedupSharedStriles[nSrcStrile] = true;
+    m_abDedupSharedStriles[nStrile] = true;
+    return true;
+}
+
 /************************************************************************/
 /*                        InitCompressionThreads()                      */
 /************************************************************************/
@@ -1927,6 +2032,10 @@ CPLErr GTiffDataset::WriteEncodedTileOrStrip(uint32_t tile_or_strip, void *data,
 {
     CPLErr eErr = CE_None;
 
+    GTiffDataset *poImageryDS = m_poImageryDS ? m_poImageryDS : this;
+    if (poImageryDS->m_bPartialRefreshOverviews)
+        poImageryDS->RecordModifiedBlock(this, tile_or_strip);
+
     if (TIFFIsTiled(m_hTIFF))
     {
         if (!(WriteEncodedTile(tile_or_strip, static_cast<GByte *>(data),
@@ -1947,6 +2056,172 @@ CPLErr GTiffDataset::WriteEncodedTileOrStrip(uint32_t tile_or_strip, void *data,
     return eErr;
 }
 
+/************************************************************************/
+/*                        RecordModifiedBlock()                         */
+/************************************************************************/
+
+// Records in m_oSetModifiedBlocks the blocks of this dataset covered by the
+// block nBlockId of poDS, which is this dataset or its mask.
+void GTiffDataset::RecordModifiedBlock(const GTiffDataset *poDS, int nBlockId)
+{
+    nBlockId %= poDS->m_nBlocksPerBand;
+    const int nXOff = (nBlockId % poDS->m_nBlocksPerRow) * poDS->m_nBlockXSize;
+    const int nYOff = (nBlockId / poDS->m_nBlocksPerRow) * poDS->m_nBlockYSize;
+    const int nXEnd = std::min(nXOff + poDS->m_nBlockXSize, nRasterXSize);
+    const int nYEnd = std::min(nYOff + poDS->m_nBlockYSize, nRasterYSize);
+    for (int nY = nYOff / m_nBlockYSize; nY <= (nYEnd - 1) / m_nBlockYSize;
+         ++nY)
+    {
+        for (int nX = nXOff / m_nBlockXSize; nX <= (nXEnd - 1) / m_nBlockXSize;
+             ++nX)
+        {
+            m_oSetModifiedBlocks.insert(nX + nY * m_nBlocksPerRow);
+        }
+    }
+}
+
+/************************************************************************/
+/*                      PartialRefreshOverviews()                       */
+/************************************************************************/
+
+// Recomputes the part of the overviews and mask overviews covering the
+// blocks of the full resolution imagery or mask written since opening.
+CPLErr GTiffDataset::PartialRefreshOverviews()
+{
+    std::set<int> oSetModifiedBlocks;
+    std::swap(oSetModifiedBlocks, m_oSetModifiedBlocks);
+
+    ScanDirectories();
+    if (m_nOverviewCount == 0 || oSetModifiedBlocks.empty())
+        return CE_None;
+
+    std::string osResampling(m_osPartialRefreshResampling);
+    if (osResampling.empty())
+    {
+        const char *pszResampling =
+            m_papoOverviewDS[0]->GetRasterBand(1)->GetMetadataItem(
+                "RESAMPLING");
+        osResampling = pszResampling ? pszResampling : "NEAREST";
+    }
+
+    std::vector<GDALRasterBand *> apoSrcBands;
+    std::vector<std::vector<GDALRasterBand *>> aapoOverviewBands;
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        apoSrcBands.push_back(papoBands[iBand]);
+        aapoOverviewBands.emplace_back();
+        for (int i = 0; i < m_nOverviewCount; ++i)
+        {
+            aapoOverviewBands.back().push_back(
+                m_papoOverviewDS[i]->GetRasterBand(iBand + 1));
+        }
+    }
+
+    std::vector<GDALRasterBand *> apoMaskSrcBands;
+    std::vector<std::vector<GDALRasterBand *>> aapoMaskOverviewBands;
+    if (m_poMaskDS && m_poMaskDS->GetRasterCount() == 1)
+    {
+        apoMaskSrcBands.push_back(m_poMaskDS->GetRasterBand(1));
+        aapoMaskOverviewBands.emplace_back();
+        for (int i = 0; i < m_nOverviewCount; ++i)
+        {
+            if (m_papoOverviewDS[i]->m_poMaskDS)
+            {
+                aapoMaskOverviewBands.back().push_back(
+                    m_papoOverviewDS[i]->m_poMaskDS->GetRasterBand(1));
+            }
+        }
+        if (aapoMaskOverviewBands.back().empty())
+        {
+            apoMaskSrcBands.clear();
+            aapoMaskOverviewBands.clear();
+        }
+    }
+
+    // Group the modified blocks into rectangles: runs of consecutive blocks
+    // in a block row, extended downwards while the next block row has the
+    // same run. Rectangles are expressed as [xmin, ymin, xmax, ymax] block
+    // indices.
+    std::vector<std::array<int, 4>> aanRects;
+    std::map<std::pair<int, int>, size_t> oMapPrevRowRuns;
+    std::map<std::pair<int, int>, size_t> oMapCurRowRuns;
+    int nCurBlockRow = -1;
+    for (auto oIter = oSetModifiedBlocks.begin();
+         oIter != oSetModifiedBlocks.end();)
+    {
+        const int nY = *oIter / m_nBlocksPerRow;
+        const int nXStart = *oIter % m_nBlocksPerRow;
+        int nXEnd = nXStart;
+        ++oIter;
+        while (oIter != oSetModifiedBlocks.end() &&
+               nXEnd + 1 < m_nBlocksPerRow &&
+               *oIter == nY * m_nBlocksPerRow + nXEnd + 1)
+        {
+            ++nXEnd;
+            ++oIter;
+        }
+        if (nY != nCurBlockRow)
+        {
+            oMapPrevRowRuns.clear();
+            if (nY == nCurBlockRow + 1)
+                std::swap(oMapPrevRowRuns, oMapCurRowRuns);
+            oMapCurRowRuns.clear();
+            nCurBlockRow = nY;
+        }
+        const auto oRun = std::pair(nXStart, nXEnd);
+        const auto oPrevIter = oMapPrevRowRuns.find(oRun);
+        if (oPrevIter != oMapPrevRowRuns.end())
+        {
+            aanRects[oPrevIter->second][3] = nY;
+            oMapCurRowRuns[oRun] = oPrevIter->second;
+        }
+        else
+        {
+            aanRects.push_back({nXStart, nY, nXEnd, nY});
+            oMapCurRowRuns[oRun] = aanRects.size() - 1;
+        }
+    }
+
+    CPLDebug("GTiff",
+             "Refreshing overviews with %s resampling over %d rectangles "
+             "covering %d modified blocks",
+             osResampling.c_str(), static_cast<int>(aanRects.size()),
+             static_cast<int>(oSetModifiedBlocks.size()));
+
+    CPLErr eErr = CE_None;
+    for (const auto &anRect : aanRects)
+    {
+        const int nXOff = anRect[0] * m_nBlockXSize;
+        const int nYOff = anRect[1] * m_nBlockYSize;
+        const int nXSize =
+            std::min((anRect[2] + 1) * m_nBlockXSize, nRasterXSize) - nXOff;
+        const int nYSize =
+            std::min((anRect[3] + 1) * m_nBlockYSize, nRasterYSize) - nYOff;
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("XOFF", CPLSPrintf("%d", nXOff));
+        aosOptions.SetNameValue("YOFF", CPLSPrintf("%d", nYOff));
+        aosOptions.SetNameValue("XSIZE", CPLSPrintf("%d", nXSize));
+        aosOptions.SetNameValue("YSIZE", CPLSPrintf("%d", nYSize));
+        // Mask overviews first, as they may be used for the imagery ones
+        if (!apoMaskSrcBands.empty() &&
+            GDALRegenerateOverviewsMultiBand(
+                apoMaskSrcBands, aapoMaskOverviewBands, osResampling.c_str(),
+                nullptr, nullptr, aosOptions.List()) != CE_None)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+        if (GDALRegenerateOverviewsMultiBand(
+                apoSrcBands, aapoOverviewBands, osResampling.c_str(), nullptr,
+                nullptr, aosOptions.List()) != CE_None)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                           FlushBlockBuf()                            */
 /************************************************************************/
@@ -6524,6 +6799,10 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
         poDS->m_bWriteEmptyTiles = true;
     }
 
+    poDS->m_bDeduplicateBlocks =
+        !bStreaming &&
+        CPLFetchBool(papszParamList, "DEDUPLICATE_BLOCKS", false);
+
     /* -------------------------------------------------------------------- */
     /*      Preserve creation options for consulting later (for instance    */
     /*      to decide if a TFW file should be written).                     */
@@ -6587,13 +6866,145 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     return poDS;
 }
 
+/************************************************************************/
+/*                      CanCopyRawStripsOrTiles()                       */
+/************************************************************************/
+
+// Returns whether the compressed tiles of poSrcDS can be written verbatim in
+// poDstDS, that is whether both datasets have the same tiling and use the
+// same lossless codec.
+bool GTiffDataset::CanCopyRawStripsOrTiles(GTiffDataset *poDstDS,
+                                           GTiffDataset *poSrcDS)
+{
+    if (poSrcDS->nRasterXSize != poDstDS->nRasterXSize ||
+        poSrcDS->nRasterYSize != poDstDS->nRasterYSize ||
+        poSrcDS->nBands != poDstDS->nBands ||
+        poSrcDS->m_nBlockXSize != poDstDS->m_nBlockXSize ||
+        poSrcDS->m_nBlockYSize != poDstDS->m_nBlockYSize ||
+        poSrcDS->m_nPlanarConfig != poDstDS->m_nPlanarConfig ||
+        poSrcDS->m_nSamplesPerPixel != poDstDS->m_nSamplesPerPixel ||
+        poSrcDS->m_nBitsPerSample != poDstDS->m_nBitsPerSample ||
+        poSrcDS->m_nSampleFormat != poDstDS->m_nSampleFormat ||
+        poSrcDS->m_nCompression != poDstDS->m_nCompression ||
+        poDstDS->m_panMaskOffsetLsb != nullptr)
+    {
+        return false;
+    }
+
+    if (poDstDS->m_nCompression != COMPRESSION_LZW &&
+        poDstDS->m_nCompression != COMPRESSION_ADOBE_DEFLATE &&
+        poDstDS->m_nCompression != COMPRESSION_ZSTD)
+    {
+        return false;
+    }
+
+    if (!poSrcDS->SetDirectory())
+        return false;
+    if (!TIFFIsTiled(poSrcDS->m_hTIFF) || !TIFFIsTiled(poDstDS->m_hTIFF) ||
+        CPL_TO_BOOL(TIFFIsBigEndian(poSrcDS->m_hTIFF)) !=
+            CPL_TO_BOOL(TIFFIsBigEndian(poDstDS->m_hTIFF)))
+    {
+        return false;
+    }
+
+    uint16_t nSrcPredictor = PREDICTOR_NONE;
+    uint16_t nDstPredictor = PREDICTOR_NONE;
+    TIFFGetFieldDefaulted(poSrcDS->m_hTIFF, TIFFTAG_PREDICTOR, &nSrcPredictor);
+    TIFFGetFieldDefaulted(poDstDS->m_hTIFF, TIFFTAG_PREDICTOR, &nDstPredictor);
+    return nSrcPredictor == nDstPredictor;
+}
+
+/************************************************************************/
+/*                         CopyRawStripOrTile()                         */
+/************************************************************************/
+
+// Writes the compressed tile nBlockId of poSrcDS as the tile nBlockId of
+// this dataset. Returns false if the source tile is sparse or is a partial
+// edge tile, whose padding might differ from the one written by
+// CopyImageryAndMask(), in which case the caller must use the regular
+// decoding/encoding path, or if an error occurred, in which case bError is
+// set.
+bool GTiffDataset::CopyRawStripOrTile(GTiffDataset *poSrcDS, int nBlockId,
+                                      std::vector<GByte> &abyBuffer,
+                                      bool &bError)
+{
+    const int iColumn = (nBlockId % m_nBlocksPerBand) % m_nBlocksPerRow;
+    const int iRow = (nBlockId % m_nBlocksPerBand) / m_nBlocksPerRow;
+    if ((iColumn + 1) * m_nBlockXSize > nRasterXSize ||
+        (iRow + 1) * m_nBlockYSize > nRasterYSize)
+    {
+        return false;
+    }
+
+    vsi_l_offset nOffset = 0;
+    vsi_l_offset nSize = 0;
+    if (!poSrcDS->IsBlockAvailable(nBlockId, &nOffset, &nSize, &bError) ||
+        nSize > static_cast<vsi_l_offset>(INT_MAX))
+    {
+        return false;
+    }
+
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nSize));
+    }
+    catch (const std::exception &)
+    {
+        ReportError(CE_Failure, CPLE_OutOfMemory,
+                    "Cannot allocate " CPL_FRMT_GUIB " bytes",
+                    static_cast<GUIntBig>(nSize));
+        bError = true;
+        return false;
+    }
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(poSrcDS->m_hTIFF));
+    const vsi_l_offset nCurOffset = VSIFTellL(fp);
+    const bool bOK = VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+                     VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp) ==
+                         abyBuffer.size();
+    VSIFSeekL(fp, nCurOffset, SEEK_SET);
+    if (!bOK)
+    {
+        ReportError(CE_Failure, CPLE_FileIO,
+                    "Cannot read strip/tile %d of source dataset", nBlockId);
+        bError = true;
+        return false;
+    }
+
+    // Raw strips/tiles are appended to the file, so pending compression
+    // jobs must be flushed first to preserve the block order.
+    auto poQueue = m_poBaseDS ? m_poBaseDS->m_poCompressQueue.get()
+                              : m_poCompressQueue.get();
+    if (poQueue)
+    {
+        poQueue->WaitCompletion();
+
+        // cppcheck-suppress constVariableReference
+        auto &oQueue =
+            m_poBaseDS ? m_poBaseDS->m_asQueueJobIdx : m_asQueueJobIdx;
+        while (!oQueue.empty())
+        {
+            WaitCompletionForJobIdx(oQueue.front());
+        }
+    }
+
+    WriteRawStripOrTile(nBlockId, abyBuffer.data(),
+                        static_cast<GPtrDiff_t>(abyBuffer.size()));
+    return true;
+}
+
 /************************************************************************/
 /*                           CopyImageryAndMask()                       */
 /************************************************************************/
 
+// If poSrcRawDS is not null, it is the GTiff dataset whose bands are
+// exposed by poSrcDS, and its compressed strips/tiles are copied verbatim
+// when compatible with poDstDS.
+
 CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                                         GDALDataset *poSrcDS,
                                         GDALRasterBand *poSrcMaskBand,
+                                        GTiffDataset *poSrcRawDS,
                                         GDALProgressFunc pfnProgress,
                                         void *pProgressData)
 {
@@ -6614,6 +7025,19 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
     const bool bIsOddBand =
         dynamic_cast<GTiffOddBitsBand *>(poDstDS->GetRasterBand(1)) != nullptr;
 
+    if (poSrcRawDS &&
+        (bIsOddBand || !CanCopyRawStripsOrTiles(poDstDS, poSrcRawDS)))
+    {
+        poSrcRawDS = nullptr;
+    }
+    if (poSrcRawDS)
+    {
+        CPLDebug("GTiff", "Copying compressed strips/tiles of %s verbatim",
+                 poSrcRawDS->GetDescription());
+    }
+    std::vector<GByte> abyRawBuffer;
+    bool bRawCopyError = false;
+
     if (poDstDS->m_poMaskDS)
     {
         CPLAssert(poDstDS->m_poMaskDS->m_nBlockXSize == poDstDS->m_nBlockXSize);
@@ -6644,23 +7068,37 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     const int nReqXSize =
                         std::min(nXSize - iX, poDstDS->m_nBlockXSize);
-                    if (nReqXSize < poDstDS->m_nBlockXSize ||
-                        nReqYSize < poDstDS->m_nBlockYSize)
+                    if (poSrcRawDS &&
+                        poDstDS->CopyRawStripOrTile(poSrcRawDS, iBlock,
+                                                    abyRawBuffer,
+                                                    bRawCopyError))
                     {
-                        memset(pBlockBuffer, 0,
-                               static_cast<size_t>(poDstDS->m_nBlockXSize) *
-                                   poDstDS->m_nBlockYSize * nDataTypeSize);
+                        // Done
                     }
-                    eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    else if (bRawCopyError)
                     {
-                        eErr = poDstDS->WriteEncodedTileOrStrip(
-                            iBlock, pBlockBuffer, false);
+                        eErr = CE_Failure;
+                    }
+                    else
+                    {
+                        if (nReqXSize < poDstDS->m_nBlockXSize ||
+                            nReqYSize < poDstDS->m_nBlockYSize)
+                        {
+                            memset(pBlockBuffer, 0,
+                                   static_cast<size_t>(poDstDS->m_nBlockXSize) *
+                                       poDstDS->m_nBlockYSize * nDataTypeSize);
+                        }
+                        eErr = poSrcDS->GetRasterBand(i + 1)->RasterIO(
+                            GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
+                            nReqXSize, nReqYSize, eType, nDataTypeSize,
+                            static_cast<GSpacing>(nDataTypeSize) *
+                                poDstDS->m_nBlockXSize,
+                            nullptr);
+                        if (eErr == CE_None)
+                        {
+                            eErr = poDstDS->WriteEncodedTileOrStrip(
+                                iBlock, pBlockBuffer, false);
+                        }
                     }
 
                     iBlock++;
@@ -6762,21 +7200,41 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
 
                 if (poDstDS->m_bTileInterleave)
                 {
-                    eErr = poSrcDS->RasterIO(
-                        GF_Read, iX, iY, nReqXSize, nReqYSize, pBlockBuffer,
-                        nReqXSize, nReqYSize, eType, l_nBands, nullptr,
-                        nDataTypeSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize,
-                        static_cast<GSpacing>(nDataTypeSize) *
-                            poDstDS->m_nBlockXSize * poDstDS->m_nBlockYSize,
-                        nullptr);
-                    if (eErr == CE_None)
+                    bool bBlockRead = false;
+                    for (int i = 0; eErr == CE_None && i < l_nBands; i++)
                     {
-                        for (int i = 0; eErr == CE_None && i < l_nBands; i++)
+                        const int nBlockId =
+                            iBlock + i * poDstDS->m_nBlocksPerBand;
+                        if (poSrcRawDS &&
+                            poDstDS->CopyRawStripOrTile(poSrcRawDS, nBlockId,
+                                                        abyRawBuffer,
+                                                        bRawCopyError))
+                        {
+                            continue;
+                        }
+                        if (bRawCopyError)
+                        {
+                            eErr = CE_Failure;
+                            break;
+                        }
+                        if (!bBlockRead)
+                        {
+                            eErr = poSrcDS->RasterIO(
+                                GF_Read, iX, iY, nReqXSize, nReqYSize,
+                                pBlockBuffer, nReqXSize, nReqYSize, eType,
+                                l_nBands, nullptr, nDataTypeSize,
+                                static_cast<GSpacing>(nDataTypeSize) *
+                                    poDstDS->m_nBlockXSize,
+                                static_cast<GSpacing>(nDataTypeSize) *
+                                    poDstDS->m_nBlockXSize *
+                                    poDstDS->m_nBlockYSize,
+                                nullptr);
+                            bBlockRead = true;
+                        }
+                        if (eErr == CE_None)
                         {
                             eErr = poDstDS->WriteEncodedTileOrStrip(
-                                iBlock + i * poDstDS->m_nBlocksPerBand,
+                                nBlockId,
                                 pBlockBuffer + static_cast<size_t>(i) *
                                                    poDstDS->m_nBlockXSize *
                                                    poDstDS->m_nBlockYSize *
@@ -6785,6 +7243,16 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                         }
                     }
                 }
+                else if (poSrcRawDS &&
+                         poDstDS->CopyRawStripOrTile(
+                             poSrcRawDS, iBlock, abyRawBuffer, bRawCopyError))
+                {
+                    // Done
+                }
+                else if (bRawCopyError)
+                {
+                    eErr = CE_Failure;
+                }
                 else if (!bIsOddBand)
                 {
                     eErr = poSrcDS->RasterIO(
@@ -7030,6 +7498,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
         CPLFetchBool(papszCreateOptions, "COPY_SRC_OVERVIEWS", false);
     std::unique_ptr<GDALDataset> poOvrDS;
     int nSrcOverviews = 0;
+    bool bRawCopyOverviewTiles = false;
     if (bCopySrcOverviews)
     {
         const char *pszOvrDS =
@@ -7053,6 +7522,10 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                 }
                 nSrcOverviews =
                     poOvrDS->GetRasterBand(1)->GetOverviewCount() + 1;
+                // Set by the COG driver when the overview dataset has been
+                // generated with the final compression settings.
+                bRawCopyOverviewTiles = CPLFetchBool(
+                    papszCreateOptions, "@RAW_COPY_OVERVIEW_TILES", false);
             }
         }
         else
@@ -8121,6 +8594,9 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
         poDS->m_bWriteEmptyTiles = true;
     }
 
+    poDS->m_bDeduplicateBlocks =
+        !bStreaming && CPLFetchBool(papszOptions, "DEDUPLICATE_BLOCKS", false);
+
     // Precreate (internal) mask, so that the IBuildOverviews() below
     // has a chance to create also the overviews of the mask.
     CPLErr eErr = CE_None;
@@ -8133,6 +8609,18 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             poDS->m_poMaskDS->m_bFillEmptyTilesAtClosing =
                 poDS->m_bFillEmptyTilesAtClosing;
             poDS->m_poMaskDS->m_bWriteEmptyTiles = poDS->m_bWriteEmptyTiles;
+
+            // With MASK_INTERLEAVED_WITH_IMAGERY=YES, readers expect the
+            // mask data of a block to immediately follow its imagery data.
+            if (poDS->m_bDeduplicateBlocks && bCopySrcOverviews &&
+                EQUAL(CSLFetchNameValueDef(papszOptions, "INTERLEAVE",
+                                           "PIXEL"),
+                      "PIXEL"))
+            {
+                CPLDebug("GTiff", "DEDUPLICATE_BLOCKS ignored since the "
+                                  "mask is interleaved with imagery");
+                poDS->m_bDeduplicateBlocks = false;
+            }
         }
     }
 
@@ -8315,8 +8803,14 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                                              dfNextCurPixels / dfTotalPixels,
                                              pfnProgress, pProgressData);
 
+                GTiffDataset *poSrcRawDS =
+                    bRawCopyOverviewTiles
+                        ? dynamic_cast<GTiffDataset *>(
+                              poSrcOvrBand->GetDataset())
+                        : nullptr;
                 eErr = CopyImageryAndMask(poDstDS, poSrcOvrDS, poSrcMaskBand,
-                                          GDALScaledProgress, pScaledData);
+                                          poSrcRawDS, GDALScaledProgress,
+                                          pScaledData);
 
                 dfCurPixels = dfNextCurPixels;
                 GDALDestroyScaledProgress(pScaledData);
@@ -8501,7 +8995,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
 
             eErr = CopyImageryAndMask(poDS, poSrcDS,
                                       poSrcDS->GetRasterBand(1)->GetMaskBand(),
-                                      GDALScaledProgress, pScaledData);
+                                      nullptr, GDALScaledProgress, pScaledData);
             if (poDS->m_poMaskDS)
             {
                 bWriteMask = false;
@@ -0,0 +1,522 @@
+/******************************************************************************
+ *
+ * Project:  GeoTIFF Driver
+ * Purpose:  Persistent cache of the header area (IFDs, tag values, strile
+ *           arrays) of Cloud Optimized GeoTIFF files.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gtiffheadercache.h"
+#include "gtiffdataset.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+
+// In a COG with LAYOUT=IFDS_BEFORE_DATA, all IFDs, out-of-line tag values
+// and [Tile|Strip][Offsets|ByteCounts] arrays are located before the first
+// strile. The cache stores that area, so that re-opening the file, even with
+// GTIFF_USE_DEFER_STRILE_LOADING, does not issue any further range request
+// for it.
+
+constexpr const char *HEADER_CACHE_SIGNATURE = "GDAL_GTIFF_HEADER_CACHE_V1";
+
+// Same limit as for the buffered stream of GTIFFMakeBufferedStream()
+constexpr vsi_l_offset MAX_HEADER_CACHE_SIZE = 10 * 1024 * 1024;
+
+/************************************************************************/
+/*                    GTIFFGetHeaderCacheFilename()                     */
+/************************************************************************/
+
+static std::string GTIFFGetHeaderCacheFilename(const std::string &osKey)
+{
+    const char *pszDir = CPLGetConfigOption("GTIFF_HEADER_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string();
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osFilename = CPLFormFilenameSafe(pszDir, pszHex, "hdr");
+    CPLFree(pszHex);
+    return osFilename;
+}
+
+/************************************************************************/
+/*                       GTIFFGetHeaderCacheKey()                       */
+/************************************************************************/
+
+std::string GTIFFGetHeaderCacheKey(const char *pszFilename)
+{
+    const char *pszDir = CPLGetConfigOption("GTIFF_HEADER_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string();
+
+    // For network file systems, the result of the stat operation is cached
+    // by the GDALOpenInfo initial file access, so this does not cause an
+    // extra request.
+    VSIStatBufL sStat;
+    if (VSIStatExL(pszFilename, &sStat,
+                   VSI_STAT_EXISTS_FLAG | VSI_STAT_SIZE_FLAG) != 0 ||
+        sStat.st_size == 0)
+    {
+        return std::string();
+    }
+
+    return CPLSPrintf("%s\n" CPL_FRMT_GUIB "\n" CPL_FRMT_GIB, pszFilename,
+                      static_cast<GUIntBig>(sStat.st_size),
+                      static_cast<GIntBig>(sStat.st_mtime));
+}
+
+namespace
+{
+
+/************************************************************************/
+/* ==================================================================== */
+/*                        GTiffHeaderCacheHandle                        */
+/* ==================================================================== */
+/************************************************************************/
+
+// Read-only handle that serves [0, m_abyHeader.size()[ from memory, and
+// forwards everything else to the underlying handle.
+class GTiffHeaderCacheHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(GTiffHeaderCacheHandle)
+
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    std::vector<GByte> m_abyHeader{};
+    vsi_l_offset m_nCurOffset = 0;
+    bool m_bEOF = false;
+
+    bool IsInHeader(vsi_l_offset nOffset, size_t nSize) const
+    {
+        return nOffset <= m_abyHeader.size() &&
+               nSize <= m_abyHeader.size() - static_cast<size_t>(nOffset);
+    }
+
+  public:
+    GTiffHeaderCacheHandle(VSIVirtualHandle *poBaseHandle,
+                           std::vector<GByte> &&abyHeader)
+        : m_poBaseHandle(poBaseHandle), m_abyHeader(std::move(abyHeader)),
+          m_nCurOffset(poBaseHandle->Tell())
+    {
+    }
+
+    ~GTiffHeaderCacheHandle() override
+    {
+        delete m_poBaseHandle;
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+    size_t GetAdviseReadTotalBytesLimit() const override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nCount) override;
+    void ClearErr() override;
+    int Eof() override;
+    int Error() override;
+    int Close() override;
+    VSIRangeStatus GetRangeStatus(vsi_l_offset nOffset,
+                                  vsi_l_offset nLength) override;
+    bool HasPRead() const override;
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override;
+    void Interrupt() override;
+};
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int GTiffHeaderCacheHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nCurOffset = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nCurOffset += nOffset;
+    }
+    else
+    {
+        if (m_poBaseHandle->Seek(nOffset, nWhence) != 0)
+            return -1;
+        m_nCurOffset = m_poBaseHandle->Tell();
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset GTiffHeaderCacheHandle::Tell()
+{
+    return m_nCurOffset;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t GTiffHeaderCacheHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
+{
+    if (nSize == 0 || nCount == 0)
+        return 0;
+    if (nCount > std::numeric_limits<size_t>::max() / nSize)
+        return 0;
+    const size_t nToRead = nSize * nCount;
+
+    size_t nRead = 0;
+    if (m_nCurOffset < m_abyHeader.size())
+    {
+        nRead = std::min(nToRead, m_abyHeader.size() -
+                                      static_cast<size_t>(m_nCurOffset));
+        memcpy(pBuffer, m_abyHeader.data() + m_nCurOffset, nRead);
+        m_nCurOffset += nRead;
+    }
+    if (nRead < nToRead)
+    {
+        if (m_poBaseHandle->Seek(m_nCurOffset, SEEK_SET) != 0)
+        {
+            m_bEOF = true;
+            return nRead / nSize;
+        }
+        const size_t nBaseRead = m_poBaseHandle->Read(
+            static_cast<GByte *>(pBuffer) + nRead, 1, nToRead - nRead);
+        m_nCurOffset += nBaseRead;
+        nRead += nBaseRead;
+        if (nRead < nToRead)
+            m_bEOF = true;
+    }
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int GTiffHeaderCacheHandle::ReadMultiRange(int nRanges, void **ppData,
+                                           const vsi_l_offset *panOffsets,
+                                           const size_t *panSizes)
+{
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (!IsInHeader(panOffsets[i], panSizes[i]))
+        {
+            return m_poBaseHandle->ReadMultiRange(nRanges, ppData, panOffsets,
+                                                  panSizes);
+        }
+    }
+    for (int i = 0; i < nRanges; ++i)
+    {
+        memcpy(ppData[i], m_abyHeader.data() + panOffsets[i], panSizes[i]);
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void GTiffHeaderCacheHandle::AdviseRead(int nRanges,
+                                        const vsi_l_offset *panOffsets,
+                                        const size_t *panSizes)
+{
+    m_poBaseHandle->AdviseRead(nRanges, panOffsets, panSizes);
+}
+
+/************************************************************************/
+/*                    GetAdviseReadTotalBytesLimit()                    */
+/************************************************************************/
+
+size_t GTiffHeaderCacheHandle::GetAdviseReadTotalBytesLimit() const
+{
+    return m_poBaseHandle->GetAdviseReadTotalBytesLimit();
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t GTiffHeaderCacheHandle::Write(const void *, size_t, size_t)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Write() not supported on a header cache handle");
+    return 0;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void GTiffHeaderCacheHandle::ClearErr()
+{
+    m_bEOF = false;
+    m_poBaseHandle->ClearErr();
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int GTiffHeaderCacheHandle::Eof()
+{
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int GTiffHeaderCacheHandle::Error()
+{
+    return m_poBaseHandle->Error();
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int GTiffHeaderCacheHandle::Close()
+{
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        delete m_poBaseHandle;
+        m_poBaseHandle = nullptr;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                           GetRangeStatus()                           */
+/************************************************************************/
+
+VSIRangeStatus GTiffHeaderCacheHandle::GetRangeStatus(vsi_l_offset nOffset,
+                                                      vsi_l_offset nLength)
+{
+    if (nOffset + nLength <= m_abyHeader.size())
+        return VSI_RANGE_STATUS_DATA;
+    return m_poBaseHandle->GetRangeStatus(nOffset, nLength);
+}
+
+/************************************************************************/
+/*                              HasPRead()                              */
+/************************************************************************/
+
+bool GTiffHeaderCacheHandle::HasPRead() const
+{
+    return m_poBaseHandle->HasPRead();
+}
+
+/************************************************************************/
+/*                               PRead()                                */
+/************************************************************************/
+
+size_t GTiffHeaderCacheHandle::PRead(void *pBuffer, size_t nSize,
+                                     vsi_l_offset nOffset) const
+{
+    if (IsInHeader(nOffset, nSize))
+    {
+        memcpy(pBuffer, m_abyHeader.data() + nOffset, nSize);
+        return nSize;
+    }
+    return m_poBaseHandle->PRead(pBuffer, nSize, nOffset);
+}
+
+/************************************************************************/
+/*                             Interrupt()                              */
+/************************************************************************/
+
+void GTiffHeaderCacheHandle::Interrupt()
+{
+    m_poBaseHandle->Interrupt();
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GTIFFOpenHeaderCacheHandle()                     */
+/************************************************************************/
+
+VSILFILE *GTIFFOpenHeaderCacheHandle(const std::string &osKey,
+                                     VSILFILE *fpBase)
+{
+    const std::string osCacheFilename = GTIFFGetHeaderCacheFilename(osKey);
+    if (osCacheFilename.empty())
+        return nullptr;
+
+    VSILFILE *fp = VSIFOpenL(osCacheFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+
+    // First line: signature, second line: key (filename, size and
+    // modification time on separate lines), then header size and bytes.
+    std::vector<GByte> abyHeader;
+    bool bOK = false;
+    const char *pszLine = CPLReadLineL(fp);
+    if (pszLine && strcmp(pszLine, HEADER_CACHE_SIGNATURE) == 0)
+    {
+        const CPLStringList aosKeyLines(
+            CSLTokenizeString2(osKey.c_str(), "\n", 0));
+        bOK = true;
+        for (int i = 0; bOK && i < aosKeyLines.size(); ++i)
+        {
+            pszLine = CPLReadLineL(fp);
+            bOK = pszLine && strcmp(pszLine, aosKeyLines[i]) == 0;
+        }
+        pszLine = bOK ? CPLReadLineL(fp) : nullptr;
+        const GUIntBig nSize =
+            pszLine ? CPLScanUIntBig(pszLine, static_cast<int>(strlen(pszLine)))
+                    : 0;
+        bOK = nSize > 0 && nSize <= MAX_HEADER_CACHE_SIZE;
+        if (bOK)
+        {
+            try
+            {
+                abyHeader.resize(static_cast<size_t>(nSize));
+            }
+            catch (const std::exception &)
+            {
+                bOK = false;
+            }
+        }
+        bOK = bOK &&
+              VSIFReadL(abyHeader.data(), 1, abyHeader.size(), fp) ==
+                  abyHeader.size();
+    }
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+
+    if (!bOK)
+    {
+        CPLDebug("GTiff", "Ignoring invalid or obsolete header cache file %s",
+                 osCacheFilename.c_str());
+        return nullptr;
+    }
+
+    CPLDebug("GTiff", "Using header cache file %s", osCacheFilename.c_str());
+    return new GTiffHeaderCacheHandle(fpBase, std::move(abyHeader));
+}
+
+/************************************************************************/
+/*                        GTIFFStoreHeaderCache()                       */
+/************************************************************************/
+
+void GTIFFStoreHeaderCache(const std::string &osKey, GTiffDataset *poDS)
+{
+    const std::string osCacheFilename = GTIFFGetHeaderCacheFilename(osKey);
+    if (osCacheFilename.empty())
+        return;
+
+    // Find the offset of the first strile of all IFDs, which is the end of
+    // the header area.
+    poDS->ScanDirectories();
+    std::vector<GTiffDataset *> apoDS{poDS};
+    for (int i = 0; i < poDS->m_nOverviewCount; ++i)
+        apoDS.push_back(poDS->m_papoOverviewDS[i]);
+    for (size_t i = 0, nCount = apoDS.size(); i < nCount; ++i)
+    {
+        if (apoDS[i]->m_poMaskDS)
+            apoDS.push_back(apoDS[i]->m_poMaskDS);
+    }
+
+    vsi_l_offset nHeaderSize = std::numeric_limits<vsi_l_offset>::max();
+    for (GTiffDataset *poIterDS : apoDS)
+    {
+        if (!poIterDS->SetDirectory())
+            return;
+        vsi_l_offset nOffset = 0;
+        bool bErrOccurred = false;
+        if (poIterDS->IsBlockAvailable(0, &nOffset, nullptr, &bErrOccurred))
+        {
+            nHeaderSize = std::min(nHeaderSize, nOffset);
+        }
+        else if (bErrOccurred)
+        {
+            return;
+        }
+    }
+    poDS->SetDirectory();
+    if (nHeaderSize == std::numeric_limits<vsi_l_offset>::max() ||
+        nHeaderSize > MAX_HEADER_CACHE_SIZE)
+    {
+        return;
+    }
+    // Do not include the leader of the first strile
+    if (poDS->m_bLeaderSizeAsUInt4 && nHeaderSize >= sizeof(uint32_t))
+        nHeaderSize -= sizeof(uint32_t);
+
+    std::vector<GByte> abyHeader;
+    try
+    {
+        abyHeader.resize(static_cast<size_t>(nHeaderSize));
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+
+    // The main handle is shared with libtiff, which seeks before each read,
+    // but restore the position nonetheless.
+    VSILFILE *fp = poDS->m_fpL;
+    const vsi_l_offset nCurOffset = VSIFTellL(fp);
+    const bool bReadOK =
+        VSIFSeekL(fp, 0, SEEK_SET) == 0 &&
+        VSIFReadL(abyHeader.data(), 1, abyHeader.size(), fp) ==
+            abyHeader.size();
+    VSIFSeekL(fp, nCurOffset, SEEK_SET);
+    if (!bReadOK)
+        return;
+
+    // Write to a temporary file that is then renamed, so that concurrent
+    // readers never see a partially written cache file.
+    const std::string osTmpFilename =
+        osCacheFilename +
+        CPLSPrintf("." CPL_FRMT_GIB "_%p.tmp", CPLGetPID(), poDS);
+    VSILFILE *fpCache = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fpCache == nullptr)
+    {
+        CPLDebug("GTiff", "Cannot create header cache file %s",
+                 osTmpFilename.c_str());
+        return;
+    }
+    std::string osPreamble(HEADER_CACHE_SIGNATURE);
+    osPreamble += '\n';
+    osPreamble += osKey;
+    osPreamble += CPLSPrintf("\n" CPL_FRMT_GUIB "\n",
+                             static_cast<GUIntBig>(abyHeader.size()));
+    bool bWriteOK =
+        VSIFWriteL(osPreamble.data(), 1, osPreamble.size(), fpCache) ==
+            osPreamble.size() &&
+        VSIFWriteL(abyHeader.data(), 1, abyHeader.size(), fpCache) ==
+            abyHeader.size();
+    bWriteOK = VSIFCloseL(fpCache) == 0 && bWriteOK;
+    if (!bWriteOK ||
+        VSIRename(osTmpFilename.c_str(), osCacheFilename.c_str()) != 0)
+    {
+        CPLDebug("GTiff", "Cannot write header cache file %s",
+                 osCacheFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+    CPLDebug("GTiff", "Header cache file %s written", osCacheFilename.c_str());
+}
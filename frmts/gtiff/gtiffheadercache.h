@@ -0,0 +1,37 @@
+/******************************************************************************
+ *
+ * Project:  GeoTIFF Driver
+ * Purpose:  Persistent cache of the header area (IFDs, tag values, strile
+ *           arrays) of Cloud Optimized GeoTIFF files.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GTIFFHEADERCACHE_H_INCLUDED
+#define GTIFFHEADERCACHE_H_INCLUDED
+
+#include "cpl_vsi.h"
+
+#include <string>
+
+class GTiffDataset;
+
+// Returns the key identifying the current version of pszFilename in the
+// header cache, or an empty string if GTIFF_HEADER_CACHE_DIR is not set or
+// the file cannot be stat'ed.
+std::string GTIFFGetHeaderCacheKey(const char *pszFilename);
+
+// Returns a handle serving the cached header area of the file identified by
+// osKey, and forwarding other accesses to fpBase, or nullptr if there is no
+// valid cache entry. On success, fpBase is owned by the returned handle.
+VSILFILE *GTIFFOpenHeaderCacheHandle(const std::string &osKey,
+                                     VSILFILE *fpBase);
+
+// Stores the header area of the COG file poDS, identified by osKey, in the
+// cache.
+void GTIFFStoreHeaderCache(const std::string &osKey, GTiffDataset *poDS);
+
+#endif /* GTIFFHEADERCACHE_H_INCLUDED */
@@ -30,6 +30,11 @@
 #include "tif_predict.h"
 #include "tiffiop.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TIFF_PREDICT_SSE2
+#endif
+
 #define PredictorState(tif) ((TIFFPredictorState *)(tif)->tif_data)
 
 static int horAcc8(TIFF *tif, uint8_t *cp0, tmsize_t cc);
@@ -337,6 +342,327 @@ static int PredictorSetupEncode(TIFF *tif)
         case 0:;                                                               \
     }
 
+#ifdef TIFF_PREDICT_SSE2
+
+/*
+ * SSE2 kernels for the horizontal predictor.
+ *
+ * Accumulation (decoding) is a prefix sum with a period of "bytestride"
+ * bytes (samples per pixel times bytes per sample). It is computed 16 bytes
+ * at a time with log2(16 / bytestride) shift-and-add steps, to which the
+ * last pixel of the previous vector is added. This is only possible when
+ * bytestride is 1, 2, 4 or 8.
+ * Differencing (encoding) has no dependency between output values and is
+ * done from the end of the row for any stride.
+ */
+
+/* Replicate the last "bytestride" bytes of v over the whole vector. */
+#define TIFF_PREDICT_BROADCAST_LAST_1(v)                                       \
+    _mm_shuffle_epi32(                                                         \
+        _mm_unpackhi_epi16(_mm_unpackhi_epi8(v, v), _mm_unpackhi_epi8(v, v)), \
+        0xFF)
+#define TIFF_PREDICT_BROADCAST_LAST_2(v)                                       \
+    _mm_shuffle_epi32(_mm_shufflehi_epi16(v, 0xFF), 0xFF)
+#define TIFF_PREDICT_BROADCAST_LAST_4(v) _mm_shuffle_epi32(v, 0xFF)
+#define TIFF_PREDICT_BROADCAST_LAST_8(v) _mm_unpackhi_epi64(v, v)
+
+/* In-register prefix sum of v with a period of bytestride bytes */
+#define TIFF_PREDICT_PREFIX_SUM(v, bytestride, add)                            \
+    do                                                                         \
+    {                                                                          \
+        /* Shift amounts of unused steps are zeroed to remain valid */         \
+        v = add(v, _mm_slli_si128(v, bytestride));                             \
+        if (bytestride < 8)                                                    \
+            v = add(v,                                                         \
+                    _mm_slli_si128(v, bytestride < 8 ? 2 * bytestride : 0)); \
+        if (bytestride < 4)                                                    \
+            v = add(v,                                                         \
+                    _mm_slli_si128(v, bytestride < 4 ? 4 * bytestride : 0)); \
+        if (bytestride < 2)                                                    \
+            v = add(v,                                                         \
+                    _mm_slli_si128(v, bytestride < 2 ? 8 * bytestride : 0)); \
+    } while (0)
+
+/*
+ * Defines horAccSSE2_<type>_<bytestride>(), which accumulates the cc bytes
+ * at cp and returns the number of bytes processed, which is a multiple of
+ * 16. The remaining bytes must be processed by the caller.
+ */
+#define TIFF_PREDICT_DEFINE_HORACC_SSE2(type, bytestride, add)                 \
+    TIFF_NOSANITIZE_UNSIGNED_INT_OVERFLOW                                      \
+    static tmsize_t horAccSSE2_##type##_##bytestride(uint8_t *cp,              \
+                                                     tmsize_t cc)              \
+    {                                                                          \
+        tmsize_t i = bytestride;                                               \
+        __m128i carry;                                                         \
+        {                                                                      \
+            /* Replicate the first pixel over a whole vector */                \
+            uint8_t first[16];                                                 \
+            int j;                                                             \
+            for (j = 0; j < 16; ++j)                                           \
+                first[j] = cp[j % (bytestride)];                               \
+            carry = _mm_loadu_si128((const __m128i *)first);                   \
+        }                                                                      \
+        for (; i + 16 <= cc; i += 16)                                          \
+        {                                                                      \
+            __m128i v = _mm_loadu_si128((const __m128i *)(cp + i));            \
+            TIFF_PREDICT_PREFIX_SUM(v, bytestride, add);                       \
+            v = add(v, carry);                                                 \
+            _mm_storeu_si128((__m128i *)(cp + i), v);                          \
+            carry = TIFF_PREDICT_BROADCAST_LAST_##bytestride(v);               \
+        }                                                                      \
+        return i - (bytestride);                                               \
+    }
+
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint8, 1, _mm_add_epi8)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint8, 2, _mm_add_epi8)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint8, 4, _mm_add_epi8)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint8, 8, _mm_add_epi8)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint16, 2, _mm_add_epi16)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint16, 4, _mm_add_epi16)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint16, 8, _mm_add_epi16)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint32, 4, _mm_add_epi32)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint32, 8, _mm_add_epi32)
+TIFF_PREDICT_DEFINE_HORACC_SSE2(uint64, 8, _mm_add_epi64)
+
+/*
+ * Accumulates the cc bytes at cp, made of samples of sampsize bytes, with a
+ * stride of bytestride bytes, if possible. Returns the number of bytes
+ * processed, starting at cp + bytestride, which is 0 when SSE2 cannot be
+ * used. The caller must then accumulate the samples starting at
+ * cp + bytestride + returned value.
+ */
+static tmsize_t horAccSSE2(uint8_t *cp, tmsize_t cc, int sampsize,
+                           tmsize_t bytestride)
+{
+    if (cc < bytestride + 16)
+        return 0;
+    switch (sampsize * 16 + bytestride)
+    {
+        case 1 * 16 + 1:
+            return horAccSSE2_uint8_1(cp, cc);
+        case 1 * 16 + 2:
+            return horAccSSE2_uint8_2(cp, cc);
+        case 1 * 16 + 4:
+            return horAccSSE2_uint8_4(cp, cc);
+        case 1 * 16 + 8:
+            return horAccSSE2_uint8_8(cp, cc);
+        case 2 * 16 + 2:
+            return horAccSSE2_uint16_2(cp, cc);
+        case 2 * 16 + 4:
+            return horAccSSE2_uint16_4(cp, cc);
+        case 2 * 16 + 8:
+            return horAccSSE2_uint16_8(cp, cc);
+        case 4 * 16 + 4:
+            return horAccSSE2_uint32_4(cp, cc);
+        case 4 * 16 + 8:
+            return horAccSSE2_uint32_8(cp, cc);
+        case 8 * 16 + 8:
+            return horAccSSE2_uint64_8(cp, cc);
+        default:
+            break;
+    }
+    return 0;
+}
+
+/*
+ * Differentiates, from the end, the samples of sampsize bytes at cp with a
+ * stride of bytestride bytes. cc must be a multiple of bytestride. Returns
+ * the offset from cp of the end of the bytes that remain to be
+ * differentiated by the caller, which is also a multiple of bytestride.
+ */
+TIFF_NOSANITIZE_UNSIGNED_INT_OVERFLOW
+static tmsize_t horDiffSSE2(uint8_t *cp, tmsize_t cc, int sampsize,
+                            tmsize_t bytestride)
+{
+    tmsize_t gcd = bytestride;
+    tmsize_t b = 16;
+    tmsize_t nvectors;
+    tmsize_t i;
+    if (cc < bytestride + 16)
+        return cc;
+    while (b != 0)
+    {
+        const tmsize_t r = gcd % b;
+        gcd = b;
+        b = r;
+    }
+    /* The vectors processed must cover a whole number of pixels, so that */
+    /* the caller resumes at a pixel boundary: their count is rounded down */
+    /* to a multiple of bytestride / gcd(bytestride, 16). */
+    nvectors = (cc - bytestride) / 16;
+    nvectors -= nvectors % (bytestride / gcd);
+    i = cc - 16;
+    switch (sampsize)
+    {
+#define TIFF_PREDICT_HORDIFF_SSE2_LOOP(sub)                                    \
+    for (; i >= cc - 16 * nvectors; i -= 16)                                   \
+    {                                                                          \
+        const __m128i cur = _mm_loadu_si128((const __m128i *)(cp + i));        \
+        const __m128i prev =                                                   \
+            _mm_loadu_si128((const __m128i *)(cp + i - bytestride));          \
+        _mm_storeu_si128((__m128i *)(cp + i), sub(cur, prev));                 \
+    }
+        case 1:
+            TIFF_PREDICT_HORDIFF_SSE2_LOOP(_mm_sub_epi8)
+            break;
+        case 2:
+            TIFF_PREDICT_HORDIFF_SSE2_LOOP(_mm_sub_epi16)
+            break;
+        case 4:
+            TIFF_PREDICT_HORDIFF_SSE2_LOOP(_mm_sub_epi32)
+            break;
+        case 8:
+            TIFF_PREDICT_HORDIFF_SSE2_LOOP(_mm_sub_epi64)
+            break;
+        default:
+            return cc;
+#undef TIFF_PREDICT_HORDIFF_SSE2_LOOP
+    }
+    return i + 16;
+}
+
+#if !WORDS_BIGENDIAN
+/*
+ * Floating point predictor: reassembles, in little-endian order, the wc
+ * samples of bps bytes of cp from the byte planes of tmp, most significant
+ * byte plane first. Returns the number of samples processed.
+ */
+static tmsize_t fpAccInterleaveSSE2(uint8_t *cp, const uint8_t *tmp,
+                                    tmsize_t wc, uint32_t bps)
+{
+    tmsize_t count = 0;
+#define LOAD_PLANE(k)                                                          \
+    _mm_loadu_si128((const __m128i *)(tmp + (bps - 1 - (k)) * wc + count))
+#define STORE(off, v) _mm_storeu_si128((__m128i *)(cp + bps * count + (off)), v)
+    if (bps == 2)
+    {
+        for (; count + 16 <= wc; count += 16)
+        {
+            const __m128i b0 = LOAD_PLANE(0);
+            const __m128i b1 = LOAD_PLANE(1);
+            STORE(0, _mm_unpacklo_epi8(b0, b1));
+            STORE(16, _mm_unpackhi_epi8(b0, b1));
+        }
+    }
+    else if (bps == 4)
+    {
+        for (; count + 16 <= wc; count += 16)
+        {
+            const __m128i b0 = LOAD_PLANE(0);
+            const __m128i b1 = LOAD_PLANE(1);
+            const __m128i b2 = LOAD_PLANE(2);
+            const __m128i b3 = LOAD_PLANE(3);
+            const __m128i b01lo = _mm_unpacklo_epi8(b0, b1);
+            const __m128i b01hi = _mm_unpackhi_epi8(b0, b1);
+            const __m128i b23lo = _mm_unpacklo_epi8(b2, b3);
+            const __m128i b23hi = _mm_unpackhi_epi8(b2, b3);
+            STORE(0, _mm_unpacklo_epi16(b01lo, b23lo));
+            STORE(16, _mm_unpackhi_epi16(b01lo, b23lo));
+            STORE(32, _mm_unpacklo_epi16(b01hi, b23hi));
+            STORE(48, _mm_unpackhi_epi16(b01hi, b23hi));
+        }
+    }
+    else if (bps == 8)
+    {
+        for (; count + 16 <= wc; count += 16)
+        {
+            const __m128i b0 = LOAD_PLANE(0);
+            const __m128i b1 = LOAD_PLANE(1);
+            const __m128i b2 = LOAD_PLANE(2);
+            const __m128i b3 = LOAD_PLANE(3);
+            const __m128i b4 = LOAD_PLANE(4);
+            const __m128i b5 = LOAD_PLANE(5);
+            const __m128i b6 = LOAD_PLANE(6);
+            const __m128i b7 = LOAD_PLANE(7);
+            const __m128i b01lo = _mm_unpacklo_epi8(b0, b1);
+            const __m128i b01hi = _mm_unpackhi_epi8(b0, b1);
+            const __m128i b23lo = _mm_unpacklo_epi8(b2, b3);
+            const __m128i b23hi = _mm_unpackhi_epi8(b2, b3);
+            const __m128i b45lo = _mm_unpacklo_epi8(b4, b5);
+            const __m128i b45hi = _mm_unpackhi_epi8(b4, b5);
+            const __m128i b67lo = _mm_unpacklo_epi8(b6, b7);
+            const __m128i b67hi = _mm_unpackhi_epi8(b6, b7);
+            /* Bytes 0 to 3 (resp. 4 to 7) of samples 0-3, 4-7, 8-11, 12-15 */
+            const __m128i lo0 = _mm_unpacklo_epi16(b01lo, b23lo);
+            const __m128i lo1 = _mm_unpackhi_epi16(b01lo, b23lo);
+            const __m128i lo2 = _mm_unpacklo_epi16(b01hi, b23hi);
+            const __m128i lo3 = _mm_unpackhi_epi16(b01hi, b23hi);
+            const __m128i hi0 = _mm_unpacklo_epi16(b45lo, b67lo);
+            const __m128i hi1 = _mm_unpackhi_epi16(b45lo, b67lo);
+            const __m128i hi2 = _mm_unpacklo_epi16(b45hi, b67hi);
+            const __m128i hi3 = _mm_unpackhi_epi16(b45hi, b67hi);
+            STORE(0, _mm_unpacklo_epi32(lo0, hi0));
+            STORE(16, _mm_unpackhi_epi32(lo0, hi0));
+            STORE(32, _mm_unpacklo_epi32(lo1, hi1));
+            STORE(48, _mm_unpackhi_epi32(lo1, hi1));
+            STORE(64, _mm_unpacklo_epi32(lo2, hi2));
+            STORE(80, _mm_unpackhi_epi32(lo2, hi2));
+            STORE(96, _mm_unpacklo_epi32(lo3, hi3));
+            STORE(112, _mm_unpackhi_epi32(lo3, hi3));
+        }
+    }
+#undef LOAD_PLANE
+#undef STORE
+    return count;
+}
+
+/*
+ * Floating point predictor: splits the wc little-endian samples of bps bytes
+ * of tmp into the byte planes of cp, most significant byte plane first.
+ * Returns the number of samples processed.
+ */
+static tmsize_t fpDiffDeinterleaveSSE2(uint8_t *cp, const uint8_t *tmp,
+                                       tmsize_t wc, uint32_t bps)
+{
+    tmsize_t count = 0;
+#define LOAD(off)                                                              \
+    _mm_loadu_si128((const __m128i *)(tmp + bps * count + (off)))
+#define STORE_PLANE(k, v)                                                      \
+    _mm_storeu_si128((__m128i *)(cp + (bps - 1 - (k)) * wc + count), v)
+    if (bps == 2)
+    {
+        const __m128i mask = _mm_set1_epi16(0xFF);
+        for (; count + 16 <= wc; count += 16)
+        {
+            const __m128i v0 = LOAD(0);
+            const __m128i v1 = LOAD(16);
+            STORE_PLANE(0, _mm_packus_epi16(_mm_and_si128(v0, mask),
+                                            _mm_and_si128(v1, mask)));
+            STORE_PLANE(1, _mm_packus_epi16(_mm_srli_epi16(v0, 8),
+                                            _mm_srli_epi16(v1, 8)));
+        }
+    }
+    else if (bps == 4)
+    {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        for (; count + 16 <= wc; count += 16)
+        {
+            const __m128i v0 = LOAD(0);
+            const __m128i v1 = LOAD(16);
+            const __m128i v2 = LOAD(32);
+            const __m128i v3 = LOAD(48);
+#define EXTRACT_PLANE(k)                                                       \
+    _mm_packus_epi16(                                                          \
+        _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v0, 8 * (k)), mask),      \
+                        _mm_and_si128(_mm_srli_epi32(v1, 8 * (k)), mask)),     \
+        _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v2, 8 * (k)), mask),      \
+                        _mm_and_si128(_mm_srli_epi32(v3, 8 * (k)), mask)))
+            STORE_PLANE(0, EXTRACT_PLANE(0));
+            STORE_PLANE(1, EXTRACT_PLANE(1));
+            STORE_PLANE(2, EXTRACT_PLANE(2));
+            STORE_PLANE(3, EXTRACT_PLANE(3));
+#undef EXTRACT_PLANE
+        }
+    }
+#undef LOAD
+#undef STORE_PLANE
+    return count;
+}
+#endif /* !WORDS_BIGENDIAN */
+
+#endif /* TIFF_PREDICT_SSE2 */
+
 /* Remarks related to C standard compliance in all below functions : */
 /* - to avoid any undefined behavior, we only operate on unsigned types */
 /*   since the behavior of "overflows" is defined (wrap over) */
@@ -355,6 +681,14 @@ static int horAcc8(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    {
+        const tmsize_t done = horAccSSE2(cp, cc, 1, stride);
+        cp += done;
+        cc -= done;
+    }
+#endif
+
     if (cc > stride)
     {
         /*
@@ -425,6 +759,14 @@ static int horAcc16(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    {
+        const tmsize_t done = horAccSSE2(cp0, cc, 2, 2 * stride);
+        wp += done / 2;
+        wc -= done / 2;
+    }
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -462,6 +804,14 @@ static int horAcc32(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    {
+        const tmsize_t done = horAccSSE2(cp0, cc, 4, 4 * stride);
+        wp += done / 4;
+        wc -= done / 4;
+    }
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -496,6 +846,14 @@ static int horAcc64(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    {
+        const tmsize_t done = horAccSSE2(cp0, cc, 8, 8 * stride);
+        wp += done / 8;
+        wc -= done / 8;
+    }
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -530,6 +888,14 @@ static int fpAcc(TIFF *tif, uint8_t *cp0, tmsize_t cc)
     if (!tmp)
         return 0;
 
+#ifdef TIFF_PREDICT_SSE2
+    {
+        const tmsize_t done = horAccSSE2(cp, count, 1, stride);
+        cp += done;
+        count -= done;
+    }
+#endif
+
     while (count > stride)
     {
         REPEAT4(stride,
@@ -540,7 +906,11 @@ static int fpAcc(TIFF *tif, uint8_t *cp0, tmsize_t cc)
 
     _TIFFmemcpy(tmp, cp0, cc);
     cp = (uint8_t *)cp0;
-    for (count = 0; count < wc; count++)
+    count = 0;
+#if defined(TIFF_PREDICT_SSE2) && !WORDS_BIGENDIAN
+    count = fpAccInterleaveSSE2(cp, tmp, wc, bps);
+#endif
+    for (; count < wc; count++)
     {
         uint32_t byte;
         for (byte = 0; byte < bps; byte++)
@@ -628,6 +998,10 @@ static int horDiff8(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    cc = horDiffSSE2(cp0, cc, 1, stride);
+#endif
+
     if (cc > stride)
     {
         cc -= stride;
@@ -707,6 +1081,10 @@ static int horDiff16(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    wc = horDiffSSE2(cp0, cc, 2, 2 * stride) / 2;
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -749,6 +1127,10 @@ static int horDiff32(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    wc = horDiffSSE2(cp0, cc, 4, 4 * stride) / 4;
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -788,6 +1170,10 @@ static int horDiff64(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
     }
 
+#ifdef TIFF_PREDICT_SSE2
+    wc = horDiffSSE2(cp0, cc, 8, 8 * stride) / 8;
+#endif
+
     if (wc > stride)
     {
         wc -= stride;
@@ -837,7 +1223,11 @@ static int fpDiff(TIFF *tif, uint8_t *cp0, tmsize_t cc)
         return 0;
 
     _TIFFmemcpy(tmp, cp0, cc);
-    for (count = 0; count < wc; count++)
+    count = 0;
+#if defined(TIFF_PREDICT_SSE2) && !WORDS_BIGENDIAN
+    count = fpDiffDeinterleaveSSE2(cp, tmp, wc, bps);
+#endif
+    for (; count < wc; count++)
     {
         uint32_t byte;
         for (byte = 0; byte < bps; byte++)
@@ -851,6 +1241,10 @@ static int fpDiff(TIFF *tif, uint8_t *cp0, tmsize_t cc)
     }
     _TIFFfreeExt(tif, tmp);
 
+#ifdef TIFF_PREDICT_SSE2
+    cc = horDiffSSE2(cp0, cc, 1, stride);
+#endif
+
     cp = (uint8_t *)cp0;
     cp += cc - stride - 1;
     for (count = cc; count > stride; count -= stride)
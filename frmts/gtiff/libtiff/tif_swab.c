@@ -29,6 +29,17 @@
  */
 #include "tiffiop.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TIFF_SWAB_SSE2
+
+/* Swaps the two bytes of each 16-bit word of v */
+static inline __m128i TIFFSwabShortSSE2(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
 #if defined(DISABLE_CHECK_TIFFSWABMACROS) || !defined(TIFFSwabShort)
 void TIFFSwabShort(uint16_t *wp)
 {
@@ -83,6 +94,13 @@ void TIFFSwabArrayOfShort(register uint16_t *wp, tmsize_t n)
     register unsigned char *cp;
     register unsigned char t;
     assert(sizeof(uint16_t) == 2);
+#ifdef TIFF_SWAB_SSE2
+    for (; n >= 8; n -= 8, wp += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)wp);
+        _mm_storeu_si128((__m128i *)wp, TIFFSwabShortSSE2(v));
+    }
+#endif
     /* XXX unroll loop some */
     while (n-- > 0)
     {
@@ -119,6 +137,16 @@ void TIFFSwabArrayOfLong(register uint32_t *lp, tmsize_t n)
     register unsigned char *cp;
     register unsigned char t;
     assert(sizeof(uint32_t) == 4);
+#ifdef TIFF_SWAB_SSE2
+    for (; n >= 4; n -= 4, lp += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)lp);
+        /* Swap the bytes of each 16-bit word, and then the 16-bit words */
+        v = TIFFSwabShortSSE2(v);
+        v = _mm_shufflelo_epi16(_mm_shufflehi_epi16(v, 0xB1), 0xB1);
+        _mm_storeu_si128((__m128i *)lp, v);
+    }
+#endif
     /* XXX unroll loop some */
     while (n-- > 0)
     {
@@ -140,6 +168,16 @@ void TIFFSwabArrayOfLong8(register uint64_t *lp, tmsize_t n)
     register unsigned char *cp;
     register unsigned char t;
     assert(sizeof(uint64_t) == 8);
+#ifdef TIFF_SWAB_SSE2
+    for (; n >= 2; n -= 2, lp += 2)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)lp);
+        /* Swap the bytes of each 16-bit word, and reverse the 16-bit words */
+        v = TIFFSwabShortSSE2(v);
+        v = _mm_shufflelo_epi16(_mm_shufflehi_epi16(v, 0x1B), 0x1B);
+        _mm_storeu_si128((__m128i *)lp, v);
+    }
+#endif
     /* XXX unroll loop some */
     while (n-- > 0)
     {
@@ -0,0 +1,347 @@
+/******************************************************************************
+ *
+ * Project:  Hierarchical Data Format Release 5 (HDF5)
+ * Purpose:  Direct read of chunks of HDF5 datasets, bypassing libhdf5
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "hdf5directchunk.h"
+#include "hdf5dataset.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "gdal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+/************************************************************************/
+/*                       ~HDF5DirectChunkReader()                       */
+/************************************************************************/
+
+HDF5DirectChunkReader::~HDF5DirectChunkReader()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                              Create()                                */
+/************************************************************************/
+
+/** Return a reader for hDataset, or nullptr if its layout, filters or data
+ * type are not supported, in which case libhdf5 must be used.
+ *
+ * hNativeDT is the in-memory data type into which values are returned.
+ */
+std::unique_ptr<HDF5DirectChunkReader>
+HDF5DirectChunkReader::Create(hid_t hDataset, hid_t hNativeDT,
+                              const std::string &osFilename)
+{
+#if defined(H5_VERSION_GE) && H5_VERSION_GE(1, 10, 5)
+    if (!CPLTestBool(
+            CPLGetConfigOption("GDAL_HDF5_DIRECT_CHUNK_READ", "YES")))
+        return nullptr;
+
+    HDF5_GLOBAL_LOCK();
+
+    std::unique_ptr<HDF5DirectChunkReader> poReader(
+        new HDF5DirectChunkReader());
+    poReader->m_hDataset = hDataset;
+
+    // The file must not be modified behind our back.
+    {
+        const hid_t hFile = H5Iget_file_id(hDataset);
+        if (hFile < 0)
+            return nullptr;
+        unsigned nIntent = 0;
+        bool bOK = H5Fget_intent(hFile, &nIntent) >= 0 &&
+                   nIntent == H5F_ACC_RDONLY;
+        // Addresses can only be used as file offsets with single-file
+        // drivers, and not for example with the family one.
+        const hid_t hFAPL = H5Fget_access_plist(hFile);
+        if (hFAPL >= 0)
+        {
+            const hid_t hDriver = H5Pget_driver(hFAPL);
+            if (hDriver != H5FD_SEC2 && hDriver != HDF5GetFileDriver())
+                bOK = false;
+            H5Pclose(hFAPL);
+        }
+        else
+        {
+            bOK = false;
+        }
+        const hid_t hFCPL = H5Fget_create_plist(hFile);
+        hsize_t nUserBlockSize = 0;
+        if (hFCPL < 0 || H5Pget_userblock(hFCPL, &nUserBlockSize) < 0)
+            bOK = false;
+        if (hFCPL >= 0)
+            H5Pclose(hFCPL);
+        H5Fclose(hFile);
+        if (!bOK)
+            return nullptr;
+        // Addresses of objects are relative to the end of the user block.
+        poReader->m_nBaseAddress = static_cast<vsi_l_offset>(nUserBlockSize);
+    }
+
+    // Data type
+    {
+        const hid_t hFileDT = H5Dget_type(hDataset);
+        if (hFileDT < 0)
+            return nullptr;
+        const auto eClass = H5Tget_class(hFileDT);
+        const size_t nSize = H5Tget_size(hFileDT);
+        const auto eFileOrder = H5Tget_order(hFileDT);
+        const auto eNativeOrder = H5Tget_order(hNativeDT);
+        bool bOK = (eClass == H5T_INTEGER || eClass == H5T_FLOAT) &&
+                   nSize > 0 && nSize <= 8 && nSize == H5Tget_size(hNativeDT) &&
+                   H5Tget_precision(hFileDT) == 8 * nSize &&
+                   H5Tget_offset(hFileDT) == 0 &&
+                   (eFileOrder == H5T_ORDER_LE || eFileOrder == H5T_ORDER_BE) &&
+                   (eNativeOrder == H5T_ORDER_LE ||
+                    eNativeOrder == H5T_ORDER_BE);
+        if (bOK)
+        {
+            // Check that the file type only differs from the native type
+            // by its byte order.
+            const hid_t hCopyDT = H5Tcopy(hFileDT);
+            bOK = hCopyDT >= 0 && H5Tset_order(hCopyDT, eNativeOrder) >= 0 &&
+                  H5Tequal(hCopyDT, hNativeDT) > 0;
+            if (hCopyDT >= 0)
+                H5Tclose(hCopyDT);
+        }
+        H5Tclose(hFileDT);
+        if (!bOK)
+            return nullptr;
+        poReader->m_nDTSize = nSize;
+        poReader->m_bNeedByteSwap = eFileOrder != eNativeOrder;
+    }
+
+    // Layout, filters and fill value
+    const hid_t hDCPL = H5Dget_create_plist(hDataset);
+    if (hDCPL < 0)
+        return nullptr;
+    bool bOK = H5Pget_layout(hDCPL) == H5D_CHUNKED;
+    if (bOK)
+    {
+        const int nDims = H5Pget_chunk(hDCPL, 0, nullptr);
+        bOK = nDims > 0 && nDims <= H5S_MAX_RANK;
+        if (bOK)
+        {
+            poReader->m_anChunkDims.resize(nDims);
+            bOK = H5Pget_chunk(hDCPL, nDims,
+                               poReader->m_anChunkDims.data()) == nDims;
+        }
+        size_t nChunkByteSize = poReader->m_nDTSize;
+        for (const hsize_t nDim : poReader->m_anChunkDims)
+        {
+            if (!bOK || nDim == 0 ||
+                nChunkByteSize > std::numeric_limits<int>::max() / nDim)
+            {
+                bOK = false;
+                break;
+            }
+            nChunkByteSize *= static_cast<size_t>(nDim);
+        }
+        poReader->m_nChunkByteSize = nChunkByteSize;
+    }
+    if (bOK)
+    {
+        const int nFilters = H5Pget_nfilters(hDCPL);
+        for (int i = 0; bOK && i < nFilters; ++i)
+        {
+            unsigned int nFlags = 0;
+            size_t nCDElts = 0;
+            char szName[64 + 1] = {0};
+            const auto nFilter = H5Pget_filter(hDCPL, i, &nFlags, &nCDElts,
+                                               nullptr, 64, szName);
+            bOK = nFilter == H5Z_FILTER_DEFLATE ||
+                  nFilter == H5Z_FILTER_SHUFFLE ||
+                  nFilter == H5Z_FILTER_FLETCHER32;
+            poReader->m_anFilters.push_back(nFilter);
+        }
+    }
+    if (bOK)
+    {
+        poReader->m_abyFillValue.resize(poReader->m_nDTSize);
+        H5D_fill_value_t eFillStatus = H5D_FILL_VALUE_UNDEFINED;
+        if (H5Pfill_value_defined(hDCPL, &eFillStatus) >= 0 &&
+            eFillStatus != H5D_FILL_VALUE_UNDEFINED)
+        {
+            bOK = H5Pget_fill_value(hDCPL, hNativeDT,
+                                    poReader->m_abyFillValue.data()) >= 0;
+        }
+    }
+    H5Pclose(hDCPL);
+    if (!bOK)
+        return nullptr;
+
+    poReader->m_fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!poReader->m_fp)
+        return nullptr;
+
+    return poReader;
+#else
+    CPL_IGNORE_RET_VAL(hDataset);
+    CPL_IGNORE_RET_VAL(hNativeDT);
+    CPL_IGNORE_RET_VAL(osFilename);
+    return nullptr;
+#endif
+}
+
+/************************************************************************/
+/*                              Decode()                                */
+/************************************************************************/
+
+bool HDF5DirectChunkReader::Decode(std::vector<GByte> &abyRaw,
+                                   unsigned nFilterMask, void *pDst) const
+{
+    std::vector<GByte> abyTmp;
+
+    // Filters are applied in reverse order of the pipeline
+    for (int i = static_cast<int>(m_anFilters.size()) - 1; i >= 0; --i)
+    {
+        if ((nFilterMask & (1U << i)) != 0)
+            continue;
+        switch (m_anFilters[i])
+        {
+            case H5Z_FILTER_FLETCHER32:
+            {
+                // Strip the checksum
+                if (abyRaw.size() < sizeof(uint32_t))
+                    return false;
+                abyRaw.resize(abyRaw.size() - sizeof(uint32_t));
+                break;
+            }
+
+            case H5Z_FILTER_DEFLATE:
+            {
+                abyTmp.resize(m_nChunkByteSize);
+                size_t nOutBytes = 0;
+                if (!CPLZLibInflate(abyRaw.data(), abyRaw.size(),
+                                    abyTmp.data(), abyTmp.size(), &nOutBytes))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "HDF5: cannot inflate chunk");
+                    return false;
+                }
+                abyTmp.resize(nOutBytes);
+                std::swap(abyRaw, abyTmp);
+                break;
+            }
+
+            case H5Z_FILTER_SHUFFLE:
+            {
+                if (m_nDTSize > 1)
+                {
+                    abyTmp.resize(abyRaw.size());
+                    const size_t nElts = abyRaw.size() / m_nDTSize;
+                    for (size_t iByte = 0; iByte < m_nDTSize; ++iByte)
+                    {
+                        const GByte *pabySrc = abyRaw.data() + iByte * nElts;
+                        GByte *pabyOut = abyTmp.data() + iByte;
+                        for (size_t j = 0; j < nElts; ++j)
+                            pabyOut[j * m_nDTSize] = pabySrc[j];
+                    }
+                    // Trailing bytes that do not form a whole element are
+                    // not shuffled.
+                    const size_t nShuffled = nElts * m_nDTSize;
+                    std::copy(abyRaw.begin() + nShuffled, abyRaw.end(),
+                              abyTmp.begin() + nShuffled);
+                    std::swap(abyRaw, abyTmp);
+                }
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    if (abyRaw.size() != m_nChunkByteSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "HDF5: unexpected size of decoded chunk");
+        return false;
+    }
+    memcpy(pDst, abyRaw.data(), m_nChunkByteSize);
+    if (m_bNeedByteSwap)
+    {
+        GDALSwapWordsEx(pDst, static_cast<int>(m_nDTSize),
+                        m_nChunkByteSize / m_nDTSize,
+                        static_cast<int>(m_nDTSize));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             ReadChunk()                              */
+/************************************************************************/
+
+/** Read the chunk whose first element is at panChunkOrigin into pDst, that
+ * must be GetChunkByteSize() large.
+ *
+ * May be called concurrently from several threads.
+ */
+bool HDF5DirectChunkReader::ReadChunk(const hsize_t *panChunkOrigin,
+                                      void *pDst)
+{
+#if defined(H5_VERSION_GE) && H5_VERSION_GE(1, 10, 5)
+    unsigned nFilterMask = 0;
+    haddr_t nAddr = HADDR_UNDEF;
+    hsize_t nSize = 0;
+    {
+        HDF5_GLOBAL_LOCK();
+        if (H5Dget_chunk_info_by_coord(m_hDataset, panChunkOrigin,
+                                       &nFilterMask, &nAddr, &nSize) < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "H5Dget_chunk_info_by_coord() failed");
+            return false;
+        }
+    }
+
+    if (nAddr == HADDR_UNDEF)
+    {
+        // Chunk not allocated
+        GByte *pabyDst = static_cast<GByte *>(pDst);
+        for (size_t i = 0; i < m_nChunkByteSize; i += m_nDTSize)
+            memcpy(pabyDst + i, m_abyFillValue.data(), m_nDTSize);
+        return true;
+    }
+
+    // Compressed chunks are not expected to be much larger than the
+    // uncompressed ones.
+    if (nSize > 2 * static_cast<hsize_t>(m_nChunkByteSize) + 4096)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "HDF5: invalid chunk size: " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nSize));
+        return false;
+    }
+
+    std::vector<GByte> abyRaw(static_cast<size_t>(nSize));
+    {
+        std::lock_guard<std::mutex> oLock(m_oFileMutex);
+        if (VSIFSeekL(m_fp, m_nBaseAddress + nAddr, SEEK_SET) != 0 ||
+            VSIFReadL(abyRaw.data(), 1, abyRaw.size(), m_fp) != abyRaw.size())
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "HDF5: cannot read chunk at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(m_nBaseAddress + nAddr));
+            return false;
+        }
+    }
+
+    return Decode(abyRaw, nFilterMask, pDst);
+#else
+    CPL_IGNORE_RET_VAL(panChunkOrigin);
+    CPL_IGNORE_RET_VAL(pDst);
+    return false;
+#endif
+}
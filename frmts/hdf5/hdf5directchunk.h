@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Project:  Hierarchical Data Format Release 5 (HDF5)
+ * Purpose:  Direct read of chunks of HDF5 datasets, bypassing libhdf5
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef HDF5DIRECTCHUNK_H_INCLUDED
+#define HDF5DIRECTCHUNK_H_INCLUDED
+
+#include "hdf5_api.h"
+
+#include "cpl_vsi.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                        HDF5DirectChunkReader                         */
+/************************************************************************/
+
+/** Reads and decodes chunks of a chunked HDF5 dataset.
+ *
+ * libhdf5 is only used, under the HDF5 global lock, to locate a chunk in the
+ * file. Its raw bytes are then read through the VSI API, under a lock
+ * specific to this reader, and decompressed without holding any lock, so
+ * that several chunks can be decoded concurrently.
+ *
+ * Only the deflate, shuffle and fletcher32 filters, and fixed-size integer
+ * or floating-point data types, are supported.
+ */
+class HDF5DirectChunkReader
+{
+    hid_t m_hDataset = H5I_INVALID_HID;
+    std::vector<hsize_t> m_anChunkDims{};
+    size_t m_nDTSize = 0;
+    size_t m_nChunkByteSize = 0;
+    bool m_bNeedByteSwap = false;
+    std::vector<H5Z_filter_t> m_anFilters{};
+    std::vector<GByte> m_abyFillValue{};
+    vsi_l_offset m_nBaseAddress = 0;
+
+    std::mutex m_oFileMutex{};
+    VSILFILE *m_fp = nullptr;
+
+    HDF5DirectChunkReader() = default;
+    HDF5DirectChunkReader(const HDF5DirectChunkReader &) = delete;
+    HDF5DirectChunkReader &operator=(const HDF5DirectChunkReader &) = delete;
+
+    bool Decode(std::vector<GByte> &abyRaw, unsigned nFilterMask,
+                void *pDst) const;
+
+  public:
+    ~HDF5DirectChunkReader();
+
+    static std::unique_ptr<HDF5DirectChunkReader>
+    Create(hid_t hDataset, hid_t hNativeDT, const std::string &osFilename);
+
+    const std::vector<hsize_t> &GetChunkDims() const
+    {
+        return m_anChunkDims;
+    }
+
+    /** Size in bytes of a decoded chunk */
+    size_t GetChunkByteSize() const
+    {
+        return m_nChunkByteSize;
+    }
+
+    size_t GetDataTypeSize() const
+    {
+        return m_nDTSize;
+    }
+
+    bool ReadChunk(const hsize_t *panChunkOrigin, void *pDst);
+};
+
+#endif  // HDF5DIRECTCHUNK_H_INCLUDED
@@ -20,6 +20,7 @@
 #include "gdal_priv.h"
 #include "gh5_convenience.h"
 #include "hdf5dataset.h"
+#include "hdf5directchunk.h"
 #include "hdf5drivercore.h"
 #include "ogr_spatialref.h"
 #include "../mem/memdataset.h"
@@ -100,6 +101,9 @@ class HDF5ImageDataset final : public HDF5Dataset
     // [m_iCurrentBandChunk * m_nBandChunkSize, (m_iCurrentBandChunk+1) * m_nBandChunkSize[
     std::vector<GByte> m_abyBandChunk{};
 
+    //! Reader of chunks that bypasses libhdf5, when blocks match chunks
+    std::unique_ptr<HDF5DirectChunkReader> m_poDirectChunkReader{};
+
     CPLErr CreateODIMH5Projection();
 
   public:
@@ -372,6 +376,21 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 
     const int nXOff = nBlockXOff * nBlockXSize;
     const int nYOff = nBlockYOff * nBlockYSize;
+
+    if (poGDS->m_poDirectChunkReader)
+    {
+        // The block is exactly a chunk, which can be read and decompressed
+        // without holding the HDF5 global lock.
+        hsize_t anChunkOrigin[3] = {0, 0, 0};
+        if (poGDS->ndims == 3)
+            anChunkOrigin[0] = nBand - 1;
+        anChunkOrigin[poGDS->ndims - 2] = nYOff;
+        anChunkOrigin[poGDS->ndims - 1] = nXOff;
+        return poGDS->m_poDirectChunkReader->ReadChunk(anChunkOrigin, pImage)
+                   ? CE_None
+                   : CE_Failure;
+    }
+
     const int nXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
     const int nYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
     if (poGDS->m_eWholeBandChunkOptim == HDF5ImageDataset::WBC_ENABLED)
@@ -1309,6 +1328,34 @@ GDALDataset *HDF5ImageDataset::Open(GDALOpenInfo *poOpenInfo)
         H5Pclose(listid);
     }
 
+    // Use direct chunk reads when a block is a chunk laid out as (y, x)
+    if ((poDS->ndims == 2 ||
+         (poDS->ndims == 3 && poDS->m_nOtherDimIndex == 0 &&
+          poDS->m_nBandChunkSize == 1)) &&
+        poDS->GetYIndex() == poDS->ndims - 2 &&
+        poDS->GetXIndex() == poDS->ndims - 1 &&
+        poOpenInfo->eAccess == GA_ReadOnly
+#ifdef HDF5_HAVE_FLOAT16
+        && !poDS->m_bConvertFromFloat16
+#endif
+    )
+    {
+        poDS->m_poDirectChunkReader = HDF5DirectChunkReader::Create(
+            poDS->dataset_id, poDS->native, osFilename);
+        if (poDS->m_poDirectChunkReader)
+        {
+            const auto &anChunkDims =
+                poDS->m_poDirectChunkReader->GetChunkDims();
+            if (anChunkDims[poDS->ndims - 2] !=
+                    static_cast<hsize_t>(poDS->m_nBlockYSize) ||
+                anChunkDims[poDS->ndims - 1] !=
+                    static_cast<hsize_t>(poDS->m_nBlockXSize))
+            {
+                poDS->m_poDirectChunkReader.reset();
+            }
+        }
+    }
+
     for (int i = 0; i < nBands; i++)
     {
         HDF5ImageRasterBand *const poBand =
@@ -10,12 +10,17 @@
  ****************************************************************************/
 
 #include "hdf5dataset.h"
+#include "hdf5directchunk.h"
 #include "hdf5eosparser.h"
 #include "s100.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <utility>
 
@@ -289,6 +294,8 @@ class HDF5Array final : public GDALMDArray
     std::shared_ptr<OGRSpatialReference> m_poSRS{};
     haddr_t m_nOffset;
     mutable CPLStringList m_aosStructuralInfo{};
+    mutable std::once_flag m_oDirectChunkReaderOnce{};
+    mutable std::unique_ptr<HDF5DirectChunkReader> m_poDirectChunkReader{};
 
     HDF5Array(const std::string &osParentName, const std::string &osName,
               const std::shared_ptr<HDF5SharedResources> &poShared,
@@ -306,12 +313,24 @@ class HDF5Array final : public GDALMDArray
     static herr_t GetAttributesCallback(hid_t hArray, const char *pszObjName,
                                         void *);
 
+    bool CanReadDirectChunks(const size_t *count, const GInt64 *arrayStep,
+                             const GDALExtendedDataType &bufferDataType) const;
+
+    bool ReadDirectChunks(const GUInt64 *arrayStartIdx, const size_t *count,
+                          const GPtrDiff_t *bufferStride,
+                          void *pDstBuffer) const;
+
   protected:
     bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
                const GDALExtendedDataType &bufferDataType,
                void *pDstBuffer) const override;
 
+    bool IsChunkCacheable() const override
+    {
+        return true;
+    }
+
   public:
     ~HDF5Array();
 
@@ -2518,6 +2537,198 @@ lbl_next_depth:
         goto lbl_return_to_caller_in_loop;
 }
 
+/************************************************************************/
+/*                       CanReadDirectChunks()                          */
+/************************************************************************/
+
+/** Return whether a request can be served by decoding chunks without
+ * libhdf5: values read without subsampling into the array data type. */
+bool HDF5Array::CanReadDirectChunks(
+    const size_t *count, const GInt64 *arrayStep,
+    const GDALExtendedDataType &bufferDataType) const
+{
+    std::call_once(
+        m_oDirectChunkReaderOnce,
+        [this]()
+        {
+            if (m_poShared->IsReadOnly() &&
+                m_dt.GetClass() == GEDTC_NUMERIC && !m_bHasNonNativeDataType)
+            {
+                m_poDirectChunkReader = HDF5DirectChunkReader::Create(
+                    m_hArray, m_hNativeDT, m_poShared->GetFilename());
+                if (m_poDirectChunkReader &&
+                    (m_poDirectChunkReader->GetDataTypeSize() !=
+                         m_dt.GetSize() ||
+                     m_poDirectChunkReader->GetChunkDims().size() !=
+                         m_dims.size()))
+                {
+                    m_poDirectChunkReader.reset();
+                }
+            }
+        });
+    if (!m_poDirectChunkReader || bufferDataType != m_dt)
+        return false;
+    for (size_t i = 0; i < m_dims.size(); ++i)
+    {
+        if (count[i] != 1 && arrayStep[i] != 1)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         ReadDirectChunks()                           */
+/************************************************************************/
+
+/** Decode the chunks intersecting the request, in parallel with
+ * GDAL_NUM_THREADS worker threads, and without holding the HDF5 global
+ * lock while decompressing them. */
+bool HDF5Array::ReadDirectChunks(const GUInt64 *arrayStartIdx,
+                                 const size_t *count,
+                                 const GPtrDiff_t *bufferStride,
+                                 void *pDstBuffer) const
+{
+    HDF5DirectChunkReader *poReader = m_poDirectChunkReader.get();
+    const auto &anChunkDims = poReader->GetChunkDims();
+    const size_t nDims = m_dims.size();
+    const size_t nDTSize = m_dt.GetSize();
+
+    // Range of chunks intersecting the request, and strides (in elements)
+    // within a chunk.
+    std::vector<GUInt64> anFirstChunk(nDims);
+    std::vector<GUInt64> anChunkCount(nDims);
+    std::vector<size_t> anChunkStrides(nDims);
+    size_t nChunks = 1;
+    size_t nStride = 1;
+    for (size_t i = nDims; i-- > 0;)
+    {
+        anFirstChunk[i] = arrayStartIdx[i] / anChunkDims[i];
+        anChunkCount[i] =
+            (arrayStartIdx[i] + count[i] - 1) / anChunkDims[i] -
+            anFirstChunk[i] + 1;
+        nChunks *= static_cast<size_t>(anChunkCount[i]);
+        anChunkStrides[i] = nStride;
+        nStride *= static_cast<size_t>(anChunkDims[i]);
+    }
+
+    GByte *const pabyDst = static_cast<GByte *>(pDstBuffer);
+    const auto ProcessChunk = [&](size_t iChunk, std::vector<GByte> &abyChunk)
+    {
+        std::vector<hsize_t> anOrigin(nDims);
+        for (size_t i = nDims; i-- > 0;)
+        {
+            anOrigin[i] = (anFirstChunk[i] + iChunk % anChunkCount[i]) *
+                          anChunkDims[i];
+            iChunk /= static_cast<size_t>(anChunkCount[i]);
+        }
+        abyChunk.resize(poReader->GetChunkByteSize());
+        if (!poReader->ReadChunk(anOrigin.data(), abyChunk.data()))
+            return false;
+
+        // Copy the intersection of the chunk and of the request
+        std::vector<size_t> anLow(nDims);
+        std::vector<size_t> anCount(nDims);
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            const GUInt64 nLow = std::max<GUInt64>(arrayStartIdx[i],
+                                                   anOrigin[i]);
+            const GUInt64 nHigh = std::min<GUInt64>(
+                arrayStartIdx[i] + count[i], anOrigin[i] + anChunkDims[i]);
+            anLow[i] = static_cast<size_t>(nLow);
+            anCount[i] = static_cast<size_t>(nHigh - nLow);
+        }
+        const size_t iLast = nDims - 1;
+        std::vector<size_t> anIdx(nDims);
+        while (true)
+        {
+            size_t nSrcOffset = 0;
+            GPtrDiff_t nDstOffset = 0;
+            for (size_t i = 0; i < nDims; ++i)
+            {
+                const size_t nPos = anLow[i] + anIdx[i];
+                nSrcOffset += (nPos - static_cast<size_t>(anOrigin[i])) *
+                              anChunkStrides[i];
+                nDstOffset +=
+                    static_cast<GPtrDiff_t>(nPos - arrayStartIdx[i]) *
+                    bufferStride[i];
+            }
+            const GByte *pabySrc = abyChunk.data() + nSrcOffset * nDTSize;
+            GByte *pabyOut =
+                pabyDst + nDstOffset * static_cast<GPtrDiff_t>(nDTSize);
+            if (bufferStride[iLast] == 1)
+            {
+                memcpy(pabyOut, pabySrc, anCount[iLast] * nDTSize);
+            }
+            else
+            {
+                for (size_t j = 0; j < anCount[iLast]; ++j)
+                {
+                    memcpy(pabyOut + static_cast<GPtrDiff_t>(j * nDTSize) *
+                                         bufferStride[iLast],
+                           pabySrc + j * nDTSize, nDTSize);
+                }
+            }
+
+            if (iLast == 0)
+                return true;
+            size_t i = iLast;
+            while (true)
+            {
+                --i;
+                if (++anIdx[i] < anCount[i])
+                    break;
+                anIdx[i] = 0;
+                if (i == 0)
+                    return true;
+            }
+        }
+    };
+
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        nChunks,
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"),
+                           1024)));
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poPool)
+    {
+        std::vector<GByte> abyChunk;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            if (!ProcessChunk(iChunk, abyChunk))
+                return false;
+        }
+        return true;
+    }
+
+    std::atomic<size_t> nNextChunk{0};
+    std::atomic<bool> bGlobalStatus{true};
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poPool->CreateJobQueue();
+    for (int iThread = 0; iThread < nThreads; ++iThread)
+    {
+        poJobQueue->SubmitJob(
+            [&]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                std::vector<GByte> abyChunk;
+                while (bGlobalStatus)
+                {
+                    const size_t iChunk = nNextChunk++;
+                    if (iChunk >= nChunks)
+                        break;
+                    if (!ProcessChunk(iChunk, abyChunk))
+                        bGlobalStatus = false;
+                }
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return bGlobalStatus;
+}
+
 /************************************************************************/
 /*                               IRead()                                */
 /************************************************************************/
@@ -2527,6 +2738,12 @@ bool HDF5Array::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                       const GDALExtendedDataType &bufferDataType,
                       void *pDstBuffer) const
 {
+    if (CanReadDirectChunks(count, arrayStep, bufferDataType))
+    {
+        return ReadDirectChunks(arrayStartIdx, count, bufferStride,
+                                pDstBuffer);
+    }
+
     HDF5_GLOBAL_LOCK();
 
     const size_t nDims(m_dims.size());
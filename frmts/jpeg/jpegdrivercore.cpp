@@ -131,6 +131,7 @@ void JPEGDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
 #endif
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_CONCURRENT_READ_BLOCK, "YES");
 
     const char *pszOpenOptions =
         "<OpenOptionList>\n"
@@ -149,6 +150,7 @@ void JPEGDriverSetCommonMetadata(GDALDriver *poDriver)
 #endif
 
     poDriver->pfnIdentify = JPEGDriverIdentify;
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES, "FFD8FF");
     poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
 }
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "gdalorienteddataset.h"
 
@@ -1453,6 +1454,9 @@ CPLErr JPGRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
 {
     CPLAssert(nBlockXOff == 0);
 
+    // Scanlines are decoded sequentially
+    std::lock_guard<std::recursive_mutex> oLock(poGDS->m_oReadBlockMutex);
+
     const int nXSize = GetXSize();
     const int nWordSize = GDALGetDataTypeSizeBytes(eDataType);
     if (poGDS->m_fpImage == nullptr)
@@ -2220,6 +2224,19 @@ CPLErr JPGDataset::LoadScanline(int iLine, GByte *outBuffer)
             return CE_Failure;
     }
 
+#ifdef HAVE_JPEG_SKIP_AND_CROP_SCANLINES
+    // Lines before the requested one are only entropy decoded
+    if (iLine > nLoadedScanline + 1)
+    {
+        const JDIMENSION nToSkip =
+            static_cast<JDIMENSION>(iLine - nLoadedScanline - 1);
+        if (jpeg_skip_scanlines(&sDInfo, nToSkip) != nToSkip ||
+            ErrorOutOnNonFatalError())
+            return CE_Failure;
+        nLoadedScanline = iLine - 1;
+    }
+#endif
+
     while (nLoadedScanline < iLine)
     {
         GDAL_JSAMPLE *ppSamples = reinterpret_cast<GDAL_JSAMPLE *>(
@@ -2237,6 +2254,99 @@ CPLErr JPGDataset::LoadScanline(int iLine, GByte *outBuffer)
     return CE_None;
 }
 
+#ifdef HAVE_JPEG_SKIP_AND_CROP_SCANLINES
+
+/************************************************************************/
+/*                         ReadWindowCropped()                          */
+/************************************************************************/
+
+bool JPGDataset::ReadWindowCropped(int nXOff, int nYOff, int nXSize,
+                                   int nYSize, int nBandCount,
+                                   const int *panBandMap, GByte *pabyData,
+                                   GSpacing nPixelSpace, GSpacing nLineSpace,
+                                   GSpacing nBandSpace, CPLErr &eErr)
+{
+    if (m_bDisableCroppedReads || m_fpImage == nullptr ||
+        sDInfo.data_precision != 8 ||
+        (sDInfo.out_color_space != JCS_GRAYSCALE &&
+         sDInfo.out_color_space != JCS_RGB) ||
+        nXSize > nRasterXSize / 2)
+    {
+        return false;
+    }
+
+    // Horizontally adjacent windows are typical of a tiled scan of the
+    // image. Decoding full scanlines once, and serving them from the block
+    // cache, is then cheaper than a cropped decompression for each window.
+    if (nYOff < m_nLastCroppedYOff + m_nLastCroppedYSize &&
+        nYOff + nYSize > m_nLastCroppedYOff)
+    {
+        CPLDebug("JPEG", "Disabling cropped decompression");
+        m_bDisableCroppedReads = true;
+        return false;
+    }
+
+    // Scanlines already decoded
+    GDALRasterBlock *poBlock =
+        GetRasterBand(panBandMap[0])->TryGetLockedBlockRef(0, nYOff);
+    if (poBlock != nullptr)
+    {
+        poBlock->DropLock();
+        return false;
+    }
+
+    m_nLastCroppedYOff = nYOff;
+    m_nLastCroppedYSize = nYSize;
+
+    eErr = CE_Failure;
+    if (Restart() != CE_None || !bHasDoneJpegStartDecompress)
+        return true;
+
+    const int nComponents = sDInfo.output_components;
+    std::vector<GDAL_JSAMPLE> abyLine;
+
+    // setup to trap a fatal error.
+    if (setjmp(sUserData.setjmp_buffer))
+    {
+        StopDecompress();
+        return true;
+    }
+
+    // The horizontal offset is aligned down to an iMCU boundary
+    JDIMENSION nCropXOff = static_cast<JDIMENSION>(nXOff);
+    JDIMENSION nCropWidth = static_cast<JDIMENSION>(nXSize);
+    jpeg_crop_scanline(&sDInfo, &nCropXOff, &nCropWidth);
+    const int nLeftPixels = nXOff - static_cast<int>(nCropXOff);
+
+    const JDIMENSION nSkipLines = static_cast<JDIMENSION>(nYOff);
+    bool bOK = nSkipLines == 0 ||
+               jpeg_skip_scanlines(&sDInfo, nSkipLines) == nSkipLines;
+    if (bOK)
+        abyLine.resize(static_cast<size_t>(sDInfo.output_width) * nComponents);
+    for (int iLine = 0; bOK && iLine < nYSize; ++iLine)
+    {
+        GDAL_JSAMPLE *ppSamples = abyLine.data();
+        bOK = jpeg_read_scanlines(&sDInfo, &ppSamples, 1) == 1 &&
+              !ErrorOutOnNonFatalError();
+        for (int iBand = 0; bOK && iBand < nBandCount; ++iBand)
+        {
+            GDALCopyWords(abyLine.data() + nLeftPixels * nComponents +
+                              panBandMap[iBand] - 1,
+                          GDT_Byte, nComponents,
+                          pabyData + iLine * nLineSpace + iBand * nBandSpace,
+                          GDT_Byte, static_cast<int>(nPixelSpace), nXSize);
+        }
+    }
+
+    // The decompression session is cropped: force a restart on next use
+    StopDecompress();
+    if (bOK)
+        eErr = CE_None;
+    return true;
+}
+
+#endif  // HAVE_JPEG_SKIP_AND_CROP_SCANLINES
+
 /************************************************************************/
 /*                         LoadDefaultTables()                          */
 /************************************************************************/
@@ -2741,6 +2851,18 @@ CPLErr JPGDatasetCommon::IRasterIO(
     }
 #endif
 
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        eBufType == GDT_Byte && pData != nullptr)
+    {
+        CPLErr eErr = CE_None;
+        if (ReadWindowCropped(nXOff, nYOff, nXSize, nYSize, nBandCount,
+                              panBandMap, static_cast<GByte *>(pData),
+                              nPixelSpace, nLineSpace, nBandSpace, eErr))
+        {
+            return eErr;
+        }
+    }
+
     return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
                                      pData, nBufXSize, nBufYSize, eBufType,
                                      nBandCount, panBandMap, nPixelSpace,
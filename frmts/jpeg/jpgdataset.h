@@ -30,6 +30,7 @@
 #include <setjmp.h>
 
 #include <algorithm>
+#include <mutex>
 #include <string>
 
 #include "cpl_conv.h"
@@ -53,6 +54,14 @@ CPL_C_START
 #include "jpeglib.h"
 #endif
 CPL_C_END
+
+// jpeg_skip_scanlines() and jpeg_crop_scanline() are libjpeg-turbo extensions.
+// Versions before 2.1 had issues with some chroma subsampling modes.
+#if !defined(JPGDataset) && defined(LIBJPEG_TURBO_VERSION_NUMBER) &&          \
+    LIBJPEG_TURBO_VERSION_NUMBER >= 2001000
+#define HAVE_JPEG_SKIP_AND_CROP_SCANLINES
+#endif
+
 #include "memdataset.h"
 #include "vsidataio.h"
 
@@ -165,6 +174,11 @@ class JPGDatasetCommon CPL_NON_FINAL : public GDALPamDataset
     int nLoadedScanline;
     GByte *m_pabyScanline;
 
+    // Serializes JPGRasterBand::IReadBlock(), as the driver declares
+    // GDAL_DCAP_CONCURRENT_READ_BLOCK. Recursive since reading a block of
+    // the first band loads the blocks of the other bands.
+    std::recursive_mutex m_oReadBlockMutex{};
+
     bool bHasReadEXIFMetadata;
     bool bHasReadXMPMetadata;
     bool bHasReadICCMetadata;
@@ -196,6 +210,21 @@ class JPGDatasetCommon CPL_NON_FINAL : public GDALPamDataset
     virtual int GetOutColorSpace() = 0;
     virtual int GetJPEGColorSpace() = 0;
 
+    // Decodes only the requested window, instead of full scanlines. Returns
+    // false if that is not possible or not worth it.
+    virtual bool ReadWindowCropped(int /* nXOff */, int /* nYOff */,
+                                   int /* nXSize */, int /* nYSize */,
+                                   int /* nBandCount */,
+                                   const int * /* panBandMap */,
+                                   GByte * /* pabyData */,
+                                   GSpacing /* nPixelSpace */,
+                                   GSpacing /* nLineSpace */,
+                                   GSpacing /* nBandSpace */,
+                                   CPLErr & /* eErr */)
+    {
+        return false;
+    }
+
     bool EXIFInit(VSILFILE *);
     void ReadICCProfile();
 
@@ -311,6 +340,19 @@ class JPGDataset final : public JPGDatasetCommon
         return sDInfo.jpeg_color_space;
     }
 
+#ifdef HAVE_JPEG_SKIP_AND_CROP_SCANLINES
+    // Vertical extent of the last window read by ReadWindowCropped()
+    int m_nLastCroppedYOff = 0;
+    int m_nLastCroppedYSize = 0;
+    bool m_bDisableCroppedReads = false;
+
+    bool ReadWindowCropped(int nXOff, int nYOff, int nXSize, int nYSize,
+                           int nBandCount, const int *panBandMap,
+                           GByte *pabyData, GSpacing nPixelSpace,
+                           GSpacing nLineSpace, GSpacing nBandSpace,
+                           CPLErr &eErr) override;
+#endif
+
     int nQLevel;
 #if !defined(JPGDataset)
     void LoadDefaultTables(int);
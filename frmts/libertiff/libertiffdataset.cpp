@@ -20,11 +20,20 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <mutex>
 #include <type_traits>
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#define HAVE_SSE2
+#elif defined(USE_NEON_OPTIMIZATIONS)
+#include "include_sse2neon.h"
+#define HAVE_SSE2
+#endif
+
 #include "gdal_pam.h"
 #include "gdal_mdreader.h"
 #include "gdal_interpolateatpoint.h"
@@ -101,6 +110,11 @@ class LIBERTIFFDataset final : public GDALPamDataset
 
     static int Identify(GDALOpenInfo *poOpenInfo);
     static GDALDataset *OpenStatic(GDALOpenInfo *poOpenInfo);
+    static GDALDataset *CreateCopy(const char *pszFilename,
+                                   GDALDataset *poSrcDS, int bStrict,
+                                   char **papszOptions,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressData);
 
     const OGRSpatialReference *GetSpatialRef() const override
     {
@@ -955,6 +969,75 @@ CPLErr LIBERTIFFDataset::IRasterIO(
 /*                       HorizPredictorDecode()                         */
 /************************************************************************/
 
+#ifdef HAVE_SSE2
+
+template <class T> static inline __m128i AddEpi(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(T) == 1)
+        return _mm_add_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm_add_epi16(a, b);
+    else if constexpr (sizeof(T) == 4)
+        return _mm_add_epi32(a, b);
+    else
+        return _mm_add_epi64(a, b);
+}
+
+/** Returns a vector made of the last BYTE_STRIDE bytes of v repeated */
+template <int BYTE_STRIDE> static inline __m128i BroadcastLastPixel(__m128i v)
+{
+    if constexpr (BYTE_STRIDE == 1)
+    {
+        v = _mm_unpackhi_epi8(v, v);
+        v = _mm_unpackhi_epi16(v, v);
+        return _mm_shuffle_epi32(v, 0xFF);
+    }
+    else if constexpr (BYTE_STRIDE == 2)
+        return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, 0xFF), 0xFF);
+    else if constexpr (BYTE_STRIDE == 4)
+        return _mm_shuffle_epi32(v, 0xFF);
+    else
+        return _mm_unpackhi_epi64(v, v);
+}
+
+/** Horizontal predictor decoding, 16 bytes at a time, of the nBytes bytes
+ * of buffer, made of samples of type T, with pixels of BYTE_STRIDE bytes.
+ * Each vector is prefix-summed in log2(16 / BYTE_STRIDE) shift-and-add steps,
+ * and the last pixel of the previous vector is added to it.
+ * Returns the number of bytes processed after the first pixel: the caller
+ * must decode the remaining ones starting with that last processed pixel.
+ */
+template <class T, int BYTE_STRIDE>
+static size_t HorizPredictorDecodeSSE2(uint8_t *buffer, size_t nBytes)
+{
+    static_assert(BYTE_STRIDE >= static_cast<int>(sizeof(T)) &&
+                  BYTE_STRIDE <= 8 && (BYTE_STRIDE % sizeof(T)) == 0);
+    uint8_t abyFirstPixel[16];
+    for (int j = 0; j < 16; ++j)
+        abyFirstPixel[j] = buffer[j % BYTE_STRIDE];
+    __m128i carry =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(abyFirstPixel));
+    size_t i = BYTE_STRIDE;
+    for (; i + 16 <= nBytes; i += 16)
+    {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        v = AddEpi<T>(v, _mm_slli_si128(v, BYTE_STRIDE));
+        if constexpr (BYTE_STRIDE < 8)
+            v = AddEpi<T>(v, _mm_slli_si128(v, 2 * BYTE_STRIDE));
+        if constexpr (BYTE_STRIDE < 4)
+            v = AddEpi<T>(v, _mm_slli_si128(v, 4 * BYTE_STRIDE));
+        if constexpr (BYTE_STRIDE < 2)
+            v = AddEpi<T>(v, _mm_slli_si128(v, 8 * BYTE_STRIDE));
+        v = AddEpi<T>(v, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), v);
+        carry = BroadcastLastPixel<BYTE_STRIDE>(v);
+    }
+    return i - BYTE_STRIDE;
+}
+
+#endif
+
 template <class T, class U>
 CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW static void
 HorizPredictorDecode1Component(void *bufferIn, size_t nPixelCount)
@@ -1049,6 +1132,35 @@ HorizPredictorDecode(void *bufferIn, size_t nPixelCount,
     static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
                   std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>);
 
+#ifdef HAVE_SSE2
+    {
+        uint8_t *buffer = static_cast<uint8_t *>(bufferIn);
+        const size_t nBytes = nPixelCount * nComponentsPerPixel * sizeof(T);
+        const int nByteStride =
+            nComponentsPerPixel * static_cast<int>(sizeof(T));
+        size_t nBytesDone = 0;
+        if (nBytes >= 16 + static_cast<size_t>(nByteStride))
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                if (nByteStride == 1)
+                    nBytesDone = HorizPredictorDecodeSSE2<T, 1>(buffer, nBytes);
+                else if (nByteStride == 2)
+                    nBytesDone = HorizPredictorDecodeSSE2<T, 2>(buffer, nBytes);
+            }
+            if constexpr (sizeof(T) <= 2)
+            {
+                if (nByteStride == 4)
+                    nBytesDone = HorizPredictorDecodeSSE2<T, 4>(buffer, nBytes);
+            }
+            if (nByteStride == 8)
+                nBytesDone = HorizPredictorDecodeSSE2<T, 8>(buffer, nBytes);
+        }
+        bufferIn = buffer + nBytesDone;
+        nPixelCount -= nBytesDone / nByteStride;
+    }
+#endif
+
     if (nComponentsPerPixel == 1)
     {
         // cppcheck-suppress duplicateBranch
@@ -1145,7 +1257,72 @@ FloatingPointHorizPredictorDecode(std::vector<uint8_t> &tmpBuffer,
     memcpy(tmpBuffer.data(), buffer, tmpBufferSize);
     constexpr uint32_t bytesPerWords = static_cast<uint32_t>(sizeof(T));
     const size_t wordCount = nPixelCount * nComponentsPerPixel;
-    for (size_t iWord = 0; iWord < wordCount; iWord++)
+    size_t iWord = 0;
+#if defined(HAVE_SSE2) && !defined(CPL_MSB)
+    // Reassemble 16 words at a time from the byte planes, most significant
+    // byte plane first.
+    const uint8_t *planes = tmpBuffer.data();
+    const auto LoadPlane = [planes, wordCount, &iWord](uint32_t iByte)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+            planes + (bytesPerWords - 1 - iByte) * wordCount + iWord));
+    };
+    const auto Store = [buffer, &iWord](int iVector, __m128i v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(
+                             buffer + bytesPerWords * iWord + 16 * iVector),
+                         v);
+    };
+    for (; iWord + 16 <= wordCount; iWord += 16)
+    {
+        const __m128i b0 = LoadPlane(0);
+        const __m128i b1 = LoadPlane(1);
+        const __m128i b2 = LoadPlane(2);
+        const __m128i b3 = LoadPlane(3);
+        const __m128i b01lo = _mm_unpacklo_epi8(b0, b1);
+        const __m128i b01hi = _mm_unpackhi_epi8(b0, b1);
+        const __m128i b23lo = _mm_unpacklo_epi8(b2, b3);
+        const __m128i b23hi = _mm_unpackhi_epi8(b2, b3);
+        // Bytes 0 to 3 of words 0-3, 4-7, 8-11 and 12-15
+        const __m128i lo0 = _mm_unpacklo_epi16(b01lo, b23lo);
+        const __m128i lo1 = _mm_unpackhi_epi16(b01lo, b23lo);
+        const __m128i lo2 = _mm_unpacklo_epi16(b01hi, b23hi);
+        const __m128i lo3 = _mm_unpackhi_epi16(b01hi, b23hi);
+        if constexpr (bytesPerWords == 4)
+        {
+            Store(0, lo0);
+            Store(1, lo1);
+            Store(2, lo2);
+            Store(3, lo3);
+        }
+        else
+        {
+            static_assert(bytesPerWords == 8);
+            const __m128i b4 = LoadPlane(4);
+            const __m128i b5 = LoadPlane(5);
+            const __m128i b6 = LoadPlane(6);
+            const __m128i b7 = LoadPlane(7);
+            const __m128i b45lo = _mm_unpacklo_epi8(b4, b5);
+            const __m128i b45hi = _mm_unpackhi_epi8(b4, b5);
+            const __m128i b67lo = _mm_unpacklo_epi8(b6, b7);
+            const __m128i b67hi = _mm_unpackhi_epi8(b6, b7);
+            // Bytes 4 to 7 of words 0-3, 4-7, 8-11 and 12-15
+            const __m128i hi0 = _mm_unpacklo_epi16(b45lo, b67lo);
+            const __m128i hi1 = _mm_unpackhi_epi16(b45lo, b67lo);
+            const __m128i hi2 = _mm_unpacklo_epi16(b45hi, b67hi);
+            const __m128i hi3 = _mm_unpackhi_epi16(b45hi, b67hi);
+            Store(0, _mm_unpacklo_epi32(lo0, hi0));
+            Store(1, _mm_unpackhi_epi32(lo0, hi0));
+            Store(2, _mm_unpacklo_epi32(lo1, hi1));
+            Store(3, _mm_unpackhi_epi32(lo1, hi1));
+            Store(4, _mm_unpacklo_epi32(lo2, hi2));
+            Store(5, _mm_unpackhi_epi32(lo2, hi2));
+            Store(6, _mm_unpacklo_epi32(lo3, hi3));
+            Store(7, _mm_unpackhi_epi32(lo3, hi3));
+        }
+    }
+#endif
+    for (; iWord < wordCount; iWord++)
     {
         for (uint32_t iByte = 0; iByte < bytesPerWords; iByte++)
         {
@@ -2868,10 +3045,7 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
         pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
     if (pszValue)
     {
-        int nThreads =
-            EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
-        if (nThreads > 1024)
-            nThreads = 1024;  // to please Coverity
+        const int nThreads = CPLParseNumThreads(pszValue, 1024);
         if (nThreads > 1)
         {
             m_poThreadPool = GDALGetGlobalThreadPool(nThreads);
@@ -3197,6 +3371,1004 @@ void LIBERTIFFDataset::ReadRPCTag()
     }
 }
 
+/************************************************************************/
+/*                         LIBERTIFFWriterTag                           */
+/************************************************************************/
+
+namespace
+{
+
+// A TIFF tag, whose value is stored in the native byte order.
+struct LIBERTIFFWriterTag
+{
+    LIBERTIFF_NS::TagTypeType type = 0;
+    uint64_t count = 0;
+    std::vector<GByte> data{};
+
+    // Offset in the file of the value (or of its inline storage in the IFD
+    // entry), set by LIBERTIFFWriteHeaderAndIFD()
+    vsi_l_offset valueOffset = 0;
+};
+
+using LIBERTIFFWriterTagMap =
+    std::map<LIBERTIFF_NS::TagCodeType, LIBERTIFFWriterTag>;
+
+template <class T>
+void LIBERTIFFAddTag(LIBERTIFFWriterTagMap &tags,
+                     LIBERTIFF_NS::TagCodeType code,
+                     LIBERTIFF_NS::TagTypeType type,
+                     const std::vector<T> &values)
+{
+    auto &tag = tags[code];
+    tag.type = type;
+    tag.count = values.size();
+    tag.data.resize(values.size() * sizeof(T));
+    if (!values.empty())
+        memcpy(tag.data.data(), values.data(), tag.data.size());
+}
+
+void LIBERTIFFAddASCIITag(LIBERTIFFWriterTagMap &tags,
+                          LIBERTIFF_NS::TagCodeType code,
+                          const std::string &osValue)
+{
+    auto &tag = tags[code];
+    tag.type = LIBERTIFF_NS::TagType::ASCII;
+    tag.count = osValue.size() + 1;
+    tag.data.assign(osValue.begin(), osValue.end());
+    tag.data.push_back(0);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                      LIBERTIFFWriteHeaderAndIFD()                    */
+/************************************************************************/
+
+// Writes the TIFF header, followed by a single IFD and the out-of-line
+// tag values, in the native byte order. Returns the offset of the end of
+// that area, or 0 in case of error.
+static vsi_l_offset LIBERTIFFWriteHeaderAndIFD(VSILFILE *fp, bool bBigTIFF,
+                                               LIBERTIFFWriterTagMap &tags)
+{
+    const size_t nHeaderSize = bBigTIFF ? 16 : 8;
+    const size_t nCountSize = bBigTIFF ? 8 : 2;
+    const size_t nEntrySize = bBigTIFF ? 20 : 12;
+    const size_t nInlineSize = bBigTIFF ? 8 : 4;
+    const size_t nIFDSize =
+        nCountSize + tags.size() * nEntrySize + (bBigTIFF ? 8 : 4);
+
+    // Assign the location of tag values
+    uint64_t nOffset = nHeaderSize + nIFDSize;
+    size_t iTag = 0;
+    for (auto &[code, tag] : tags)
+    {
+        CPL_IGNORE_RET_VAL(code);
+        if (tag.data.size() <= nInlineSize)
+        {
+            tag.valueOffset = nHeaderSize + nCountSize + iTag * nEntrySize +
+                              (bBigTIFF ? 12 : 8);
+        }
+        else
+        {
+            // Values must begin on a word boundary
+            nOffset += (nOffset % 2);
+            tag.valueOffset = nOffset;
+            nOffset += tag.data.size();
+        }
+        ++iTag;
+    }
+    if (!bBigTIFF && nOffset > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Too large TIFF header. Use BIGTIFF=YES");
+        return 0;
+    }
+
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nOffset));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return 0;
+    }
+    GByte *pabyIter = abyBuffer.data();
+    const auto Write = [&pabyIter](const void *pData, size_t nSize)
+    {
+        memcpy(pabyIter, pData, nSize);
+        pabyIter += nSize;
+    };
+    const auto WriteUInt16 = [&Write](uint16_t nVal)
+    { Write(&nVal, sizeof(nVal)); };
+    const auto WriteUInt32OrUInt64 = [&Write, bBigTIFF](uint64_t nVal)
+    {
+        if (bBigTIFF)
+        {
+            Write(&nVal, sizeof(nVal));
+        }
+        else
+        {
+            const uint32_t nVal32 = static_cast<uint32_t>(nVal);
+            Write(&nVal32, sizeof(nVal32));
+        }
+    };
+
+    // Header
+    Write(CPL_IS_LSB ? "II" : "MM", 2);
+    if (bBigTIFF)
+    {
+        WriteUInt16(43);
+        WriteUInt16(8);  // Byte size of offsets
+        WriteUInt16(0);
+    }
+    else
+    {
+        WriteUInt16(42);
+    }
+    WriteUInt32OrUInt64(nHeaderSize);
+
+    // IFD
+    if (bBigTIFF)
+    {
+        const uint64_t nTagCount = tags.size();
+        Write(&nTagCount, sizeof(nTagCount));
+    }
+    else
+    {
+        WriteUInt16(static_cast<uint16_t>(tags.size()));
+    }
+    for (const auto &[code, tag] : tags)
+    {
+        WriteUInt16(code);
+        WriteUInt16(tag.type);
+        WriteUInt32OrUInt64(tag.count);
+        if (tag.data.size() <= nInlineSize)
+        {
+            // Already zero-padded by resize()
+            if (!tag.data.empty())
+                memcpy(pabyIter, tag.data.data(), tag.data.size());
+            pabyIter += nInlineSize;
+        }
+        else
+        {
+            WriteUInt32OrUInt64(tag.valueOffset);
+        }
+    }
+    WriteUInt32OrUInt64(0);  // No next IFD
+
+    // Out-of-line values
+    for (const auto &[code, tag] : tags)
+    {
+        CPL_IGNORE_RET_VAL(code);
+        if (tag.data.size() > nInlineSize)
+        {
+            memcpy(abyBuffer.data() + tag.valueOffset, tag.data.data(),
+                   tag.data.size());
+        }
+    }
+
+    if (VSIFWriteL(abyBuffer.data(), 1, abyBuffer.size(), fp) !=
+        abyBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write TIFF header");
+        return 0;
+    }
+    return nOffset;
+}
+
+/************************************************************************/
+/*                      LIBERTIFFGetGDALMetadata()                      */
+/************************************************************************/
+
+// Returns the content of the GDAL_METADATA tag for poSrcDS, or an empty
+// string if there is nothing to write.
+static std::string LIBERTIFFGetGDALMetadata(GDALDataset *poSrcDS)
+{
+    CPLXMLTreeCloser oRoot(
+        CPLCreateXMLNode(nullptr, CXT_Element, "GDALMetadata"));
+    const auto AppendItem = [&oRoot](const char *pszKey, const char *pszValue,
+                                     int nBand, const char *pszRole)
+    {
+        CPLXMLNode *psItem =
+            CPLCreateXMLNode(oRoot.get(), CXT_Element, "Item");
+        CPLAddXMLAttributeAndValue(psItem, "name", pszKey);
+        if (nBand > 0)
+            CPLAddXMLAttributeAndValue(psItem, "sample",
+                                       CPLSPrintf("%d", nBand - 1));
+        if (pszRole)
+            CPLAddXMLAttributeAndValue(psItem, "role", pszRole);
+        // Same double escaping as the GTiff driver, which the reader side
+        // undoes.
+        char *pszEscapedValue = CPLEscapeString(pszValue, -1, CPLES_XML);
+        CPLCreateXMLNode(psItem, CXT_Text, pszEscapedValue);
+        CPLFree(pszEscapedValue);
+    };
+
+    for (const char *pszItem : cpl::Iterate(
+             static_cast<CSLConstList>(poSrcDS->GetMetadata())))
+    {
+        char *pszKey = nullptr;
+        const char *pszValue = CPLParseNameValue(pszItem, &pszKey);
+        // AREA_OR_POINT is encoded in the GTRasterTypeGeoKey
+        if (pszKey && pszValue && !EQUAL(pszKey, GDALMD_AREA_OR_POINT))
+            AppendItem(pszKey, pszValue, 0, nullptr);
+        CPLFree(pszKey);
+    }
+
+    for (int i = 1; i <= poSrcDS->GetRasterCount(); ++i)
+    {
+        auto poBand = poSrcDS->GetRasterBand(i);
+        for (const char *pszItem :
+             cpl::Iterate(static_cast<CSLConstList>(poBand->GetMetadata())))
+        {
+            char *pszKey = nullptr;
+            const char *pszValue = CPLParseNameValue(pszItem, &pszKey);
+            if (pszKey && pszValue)
+                AppendItem(pszKey, pszValue, i, nullptr);
+            CPLFree(pszKey);
+        }
+
+        int bHasOffset = FALSE;
+        const double dfOffset = poBand->GetOffset(&bHasOffset);
+        int bHasScale = FALSE;
+        const double dfScale = poBand->GetScale(&bHasScale);
+        if ((bHasOffset && dfOffset != 0) || (bHasScale && dfScale != 1))
+        {
+            AppendItem("OFFSET", CPLSPrintf("%.17g", dfOffset), i, "offset");
+            AppendItem("SCALE", CPLSPrintf("%.17g", dfScale), i, "scale");
+        }
+
+        const char *pszUnitType = poBand->GetUnitType();
+        if (pszUnitType && pszUnitType[0])
+            AppendItem("UNITTYPE", pszUnitType, i, "unittype");
+
+        const char *pszDescription = poBand->GetDescription();
+        if (pszDescription && pszDescription[0])
+            AppendItem("DESCRIPTION", pszDescription, i, "description");
+    }
+
+    if (oRoot->psChild == nullptr)
+        return std::string();
+
+    char *pszXML = CPLSerializeXMLTree(oRoot.get());
+    std::string osXML(pszXML);
+    CPLFree(pszXML);
+    return osXML;
+}
+
+/************************************************************************/
+/*                     LIBERTIFFAddGeoreferencing()                     */
+/************************************************************************/
+
+// Returns false if bStrict and georeferencing cannot be fully written.
+static bool LIBERTIFFAddGeoreferencing(LIBERTIFFWriterTagMap &tags,
+                                       GDALDataset *poSrcDS, bool bStrict)
+{
+    constexpr uint16_t GTModelTypeGeoKey = 1024;
+    constexpr uint16_t ModelTypeProjected = 1;
+    constexpr uint16_t ModelTypeGeographic = 2;
+
+    constexpr uint16_t GTRasterTypeGeoKey = 1025;
+    constexpr uint16_t RasterPixelIsArea = 1;
+    constexpr uint16_t RasterPixelIsPoint = 2;
+
+    constexpr uint16_t GeodeticCRSGeoKey = 2048;
+    constexpr uint16_t ProjectedCRSGeoKey = 3072;
+
+    const char *pszAreaOrPoint = poSrcDS->GetMetadataItem(GDALMD_AREA_OR_POINT);
+    const bool bPixelIsPoint =
+        pszAreaOrPoint && EQUAL(pszAreaOrPoint, GDALMD_AOP_POINT);
+
+    double adfGT[6] = {0, 1, 0, 0, 0, 1};
+    const bool bHasGT = poSrcDS->GetGeoTransform(adfGT) == CE_None;
+    if (bHasGT)
+    {
+        if (bPixelIsPoint)
+        {
+            adfGT[0] += adfGT[1] * 0.5 + adfGT[2] * 0.5;
+            adfGT[3] += adfGT[4] * 0.5 + adfGT[5] * 0.5;
+        }
+        if (adfGT[2] == 0 && adfGT[4] == 0 && adfGT[5] < 0)
+        {
+            LIBERTIFFAddTag(
+                tags, LIBERTIFF_NS::TagCode::GeoTIFFPixelScale,
+                LIBERTIFF_NS::TagType::Double,
+                std::vector<double>{adfGT[1], -adfGT[5], 0.0});
+            LIBERTIFFAddTag(
+                tags, LIBERTIFF_NS::TagCode::GeoTIFFTiePoints,
+                LIBERTIFF_NS::TagType::Double,
+                std::vector<double>{0.0, 0.0, 0.0, adfGT[0], adfGT[3], 0.0});
+        }
+        else
+        {
+            LIBERTIFFAddTag(
+                tags, LIBERTIFF_NS::TagCode::GeoTIFFGeoTransMatrix,
+                LIBERTIFF_NS::TagType::Double,
+                std::vector<double>{adfGT[1], adfGT[2], 0.0, adfGT[0],
+                                    adfGT[4], adfGT[5], 0.0, adfGT[3], 0.0,
+                                    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0});
+        }
+    }
+
+    if (poSrcDS->GetGCPCount() > 0)
+    {
+        CPLError(bStrict ? CE_Failure : CE_Warning, CPLE_NotSupported,
+                 "LIBERTIFF driver does not support writing GCPs. "
+                 "They will be lost");
+        if (bStrict)
+            return false;
+    }
+
+    // Only CRS with an EPSG code are supported, since encoding other CRS
+    // as GeoKeys requires libgeotiff.
+    uint16_t nModelType = 0;
+    uint16_t nEPSGCode = 0;
+    if (const OGRSpatialReference *poSRS = poSrcDS->GetSpatialRef())
+    {
+        OGRSpatialReference oSRS(*poSRS);
+        const char *pszAuthName = oSRS.GetAuthorityName(nullptr);
+        if (!(pszAuthName && EQUAL(pszAuthName, "EPSG")))
+        {
+            oSRS.AutoIdentifyEPSG();
+            pszAuthName = oSRS.GetAuthorityName(nullptr);
+        }
+        const char *pszAuthCode = oSRS.GetAuthorityCode(nullptr);
+        const int nCode = pszAuthCode ? atoi(pszAuthCode) : 0;
+        if (pszAuthName && EQUAL(pszAuthName, "EPSG") && nCode > 0 &&
+            nCode < 32767 && (oSRS.IsProjected() || oSRS.IsGeographic()) &&
+            !oSRS.IsCompound() && oSRS.GetAxesCount() == 2)
+        {
+            nModelType =
+                oSRS.IsProjected() ? ModelTypeProjected : ModelTypeGeographic;
+            nEPSGCode = static_cast<uint16_t>(nCode);
+        }
+        else
+        {
+            CPLError(bStrict ? CE_Failure : CE_Warning, CPLE_NotSupported,
+                     "LIBERTIFF driver only supports writing CRS that have a "
+                     "(2D) EPSG code. The CRS will be lost");
+            if (bStrict)
+                return false;
+        }
+    }
+
+    if (nModelType == 0 && !bHasGT)
+        return true;
+
+    std::vector<uint16_t> anGeoKeys{/* KeyDirectoryVersion = */ 1,
+                                    /* KeyRevision = */ 1,
+                                    /* MinorRevision = */ 1,
+                                    /* NumberOfKeys = */ 0};
+    const auto AddKey = [&anGeoKeys](uint16_t nKey, uint16_t nValue)
+    {
+        anGeoKeys.insert(anGeoKeys.end(), {nKey, 0, 1, nValue});
+        ++anGeoKeys[3];
+    };
+    if (nModelType)
+        AddKey(GTModelTypeGeoKey, nModelType);
+    AddKey(GTRasterTypeGeoKey,
+           bPixelIsPoint ? RasterPixelIsPoint : RasterPixelIsArea);
+    if (nModelType == ModelTypeGeographic)
+        AddKey(GeodeticCRSGeoKey, nEPSGCode);
+    else if (nModelType == ModelTypeProjected)
+        AddKey(ProjectedCRSGeoKey, nEPSGCode);
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::GeoTIFFGeoKeyDirectory,
+                    LIBERTIFF_NS::TagType::Short, anGeoKeys);
+    return true;
+}
+
+/************************************************************************/
+/*                        LIBERTIFFCompressTile()                       */
+/************************************************************************/
+
+static bool LIBERTIFFCompressTile(const CPLCompressor *poCompressor,
+                                  CSLConstList papszOptions,
+                                  std::vector<GByte> &abyTile,
+                                  std::vector<GByte> &abyCompressed)
+{
+    if (!poCompressor)
+    {
+        std::swap(abyTile, abyCompressed);
+        return true;
+    }
+
+    // Upper bound of the compressed size for Deflate and ZSTD
+    const size_t nMaxSize = abyTile.size() + abyTile.size() / 64 + 1024;
+    abyCompressed.resize(nMaxSize);
+    void *pOutput = abyCompressed.data();
+    size_t nOutSize = nMaxSize;
+    if (poCompressor->pfnFunc(abyTile.data(), abyTile.size(), &pOutput,
+                              &nOutSize, papszOptions,
+                              poCompressor->user_data))
+    {
+        abyCompressed.resize(nOutSize);
+        return true;
+    }
+
+    // Let the compressor allocate the output buffer
+    pOutput = nullptr;
+    nOutSize = 0;
+    if (!poCompressor->pfnFunc(abyTile.data(), abyTile.size(), &pOutput,
+                               &nOutSize, papszOptions,
+                               poCompressor->user_data))
+    {
+        return false;
+    }
+    abyCompressed.assign(static_cast<GByte *>(pOutput),
+                         static_cast<GByte *>(pOutput) + nOutSize);
+    VSIFree(pOutput);
+    return true;
+}
+
+/************************************************************************/
+/*                            CreateCopy()                              */
+/************************************************************************/
+
+/* static */ GDALDataset *LIBERTIFFDataset::CreateCopy(
+    const char *pszFilename, GDALDataset *poSrcDS, int bStrict,
+    char **papszOptions, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = poSrcDS->GetRasterXSize();
+    const int nYSize = poSrcDS->GetRasterYSize();
+    const int nBands = poSrcDS->GetRasterCount();
+    if (nBands == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "LIBERTIFF driver does not support source datasets with "
+                 "zero bands");
+        return nullptr;
+    }
+    if (nBands > 65535)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too many bands");
+        return nullptr;
+    }
+
+    const GDALDataType eDT = poSrcDS->GetRasterBand(1)->GetRasterDataType();
+    for (int i = 2; i <= nBands; ++i)
+    {
+        if (poSrcDS->GetRasterBand(i)->GetRasterDataType() != eDT)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "LIBERTIFF driver does not support source datasets "
+                     "whose bands have different data types");
+            return nullptr;
+        }
+    }
+    LIBERTIFF_NS::SampleFormatType nSampleFormat;
+    switch (eDT)
+    {
+        case GDT_Byte:
+        case GDT_UInt16:
+        case GDT_UInt32:
+        case GDT_UInt64:
+            nSampleFormat = LIBERTIFF_NS::SampleFormat::UnsignedInt;
+            break;
+        case GDT_Int8:
+        case GDT_Int16:
+        case GDT_Int32:
+        case GDT_Int64:
+            nSampleFormat = LIBERTIFF_NS::SampleFormat::SignedInt;
+            break;
+        case GDT_Float32:
+        case GDT_Float64:
+            nSampleFormat = LIBERTIFF_NS::SampleFormat::IEEEFP;
+            break;
+        default:
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "LIBERTIFF driver does not support data type %s",
+                     GDALGetDataTypeName(eDT));
+            return nullptr;
+    }
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+
+    /* -------------------------------------------------------------------- */
+    /*      Process creation options.                                       */
+    /* -------------------------------------------------------------------- */
+    const char *pszCompress =
+        CSLFetchNameValueDef(papszOptions, "COMPRESS", "NONE");
+    LIBERTIFF_NS::CompressionType nCompression;
+    const CPLCompressor *poCompressor = nullptr;
+    if (EQUAL(pszCompress, "NONE"))
+    {
+        nCompression = LIBERTIFF_NS::Compression::None;
+    }
+    else if (EQUAL(pszCompress, "DEFLATE"))
+    {
+        nCompression = LIBERTIFF_NS::Compression::Deflate;
+        poCompressor = CPLGetCompressor("zlib");
+    }
+    else if (EQUAL(pszCompress, "ZSTD"))
+    {
+        nCompression = LIBERTIFF_NS::Compression::ZSTD;
+        poCompressor = CPLGetCompressor("zstd");
+        if (!poCompressor)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "COMPRESS=ZSTD unsupported because GDAL "
+                     "has not been built against libzstd");
+            return nullptr;
+        }
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "COMPRESS=%s not supported by LIBERTIFF driver", pszCompress);
+        return nullptr;
+    }
+    CPLStringList aosCompressorOptions;
+    if (const char *pszLevel = CSLFetchNameValue(papszOptions, "LEVEL"))
+        aosCompressorOptions.SetNameValue("LEVEL", pszLevel);
+
+    const int nBlockSize =
+        atoi(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", "256"));
+    if (nBlockSize < 16 || nBlockSize > 4096 || (nBlockSize % 16) != 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "BLOCKSIZE must be a multiple of 16 in [16, 4096]");
+        return nullptr;
+    }
+
+    const char *pszInterleave =
+        CSLFetchNameValueDef(papszOptions, "INTERLEAVE", "PIXEL");
+    bool bSeparate = false;
+    if (EQUAL(pszInterleave, "BAND"))
+    {
+        bSeparate = nBands > 1;
+    }
+    else if (!EQUAL(pszInterleave, "PIXEL"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "INTERLEAVE=%s not supported",
+                 pszInterleave);
+        return nullptr;
+    }
+
+    const int nTilesX = DIV_ROUND_UP(nXSize, nBlockSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nBlockSize);
+    const int nPlanes = bSeparate ? nBands : 1;
+    const int nSamplesPerTile = bSeparate ? 1 : nBands;
+    const uint64_t nTilesPerPlane = static_cast<uint64_t>(nTilesX) * nTilesY;
+    const uint64_t nTiles64 = nTilesPerPlane * nPlanes;
+    if (nTiles64 > std::numeric_limits<uint32_t>::max() / 8)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too many tiles");
+        return nullptr;
+    }
+    const size_t nTiles = static_cast<size_t>(nTiles64);
+    const size_t nTileSize = static_cast<size_t>(nBlockSize) * nBlockSize *
+                             nSamplesPerTile * nDTSize;
+
+    const char *pszBIGTIFF =
+        CSLFetchNameValueDef(papszOptions, "BIGTIFF", "IF_NEEDED");
+    bool bBigTIFF;
+    if (EQUAL(pszBIGTIFF, "IF_NEEDED"))
+    {
+        // Conservatively based on the uncompressed size, including padding
+        // of edge tiles.
+        bBigTIFF = static_cast<double>(nTileSize) * nTiles >= 4.2e9;
+    }
+    else
+    {
+        bBigTIFF = CPLTestBool(pszBIGTIFF);
+    }
+
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    const int nThreads = CPLParseNumThreads(pszNumThreads, 1024);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Collect tags.                                                   */
+    /* -------------------------------------------------------------------- */
+    LIBERTIFFWriterTagMap tags;
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::ImageWidth,
+                    LIBERTIFF_NS::TagType::Long,
+                    std::vector<uint32_t>{static_cast<uint32_t>(nXSize)});
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::ImageLength,
+                    LIBERTIFF_NS::TagType::Long,
+                    std::vector<uint32_t>{static_cast<uint32_t>(nYSize)});
+    LIBERTIFFAddTag(
+        tags, LIBERTIFF_NS::TagCode::BitsPerSample,
+        LIBERTIFF_NS::TagType::Short,
+        std::vector<uint16_t>(nBands, static_cast<uint16_t>(nDTSize * 8)));
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::Compression,
+                    LIBERTIFF_NS::TagType::Short,
+                    std::vector<uint16_t>{static_cast<uint16_t>(nCompression)});
+
+    GDALRasterBand *poSrcBand1 = poSrcDS->GetRasterBand(1);
+    const GDALColorTable *poCT = poSrcBand1->GetColorTable();
+    LIBERTIFF_NS::PhotometricInterpretationType nPhotometric =
+        LIBERTIFF_NS::PhotometricInterpretation::MinIsBlack;
+    int nColorChannels = 1;
+    if (nBands == 1 && poCT && (eDT == GDT_Byte || eDT == GDT_UInt16))
+    {
+        nPhotometric = LIBERTIFF_NS::PhotometricInterpretation::Palette;
+        const int nColors = 1 << (nDTSize * 8);
+        std::vector<uint16_t> anColorMap(3 * nColors);
+        for (int i = 0; i < nColors && i < poCT->GetColorEntryCount(); ++i)
+        {
+            const GDALColorEntry *psEntry = poCT->GetColorEntry(i);
+            anColorMap[i] = static_cast<uint16_t>(psEntry->c1 * 257);
+            anColorMap[nColors + i] = static_cast<uint16_t>(psEntry->c2 * 257);
+            anColorMap[2 * nColors + i] =
+                static_cast<uint16_t>(psEntry->c3 * 257);
+        }
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::ColorMap,
+                        LIBERTIFF_NS::TagType::Short, anColorMap);
+    }
+    else if (nBands >= 3 &&
+             poSrcBand1->GetColorInterpretation() == GCI_RedBand &&
+             poSrcDS->GetRasterBand(2)->GetColorInterpretation() ==
+                 GCI_GreenBand &&
+             poSrcDS->GetRasterBand(3)->GetColorInterpretation() ==
+                 GCI_BlueBand)
+    {
+        nPhotometric = LIBERTIFF_NS::PhotometricInterpretation::RGB;
+        nColorChannels = 3;
+    }
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::PhotometricInterpretation,
+                    LIBERTIFF_NS::TagType::Short,
+                    std::vector<uint16_t>{static_cast<uint16_t>(nPhotometric)});
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::SamplesPerPixel,
+                    LIBERTIFF_NS::TagType::Short,
+                    std::vector<uint16_t>{static_cast<uint16_t>(nBands)});
+    const auto nPlanarConfig =
+        bSeparate ? LIBERTIFF_NS::PlanarConfiguration::Separate
+                  : LIBERTIFF_NS::PlanarConfiguration::Contiguous;
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::PlanarConfiguration,
+                    LIBERTIFF_NS::TagType::Short,
+                    std::vector<uint16_t>{
+                        static_cast<uint16_t>(nPlanarConfig)});
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileWidth,
+                    LIBERTIFF_NS::TagType::Long,
+                    std::vector<uint32_t>{static_cast<uint32_t>(nBlockSize)});
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileLength,
+                    LIBERTIFF_NS::TagType::Long,
+                    std::vector<uint32_t>{static_cast<uint32_t>(nBlockSize)});
+    // Placeholders, rewritten once all tiles have been written
+    if (bBigTIFF)
+    {
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileOffsets,
+                        LIBERTIFF_NS::TagType::Long8,
+                        std::vector<uint64_t>(nTiles));
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileByteCounts,
+                        LIBERTIFF_NS::TagType::Long8,
+                        std::vector<uint64_t>(nTiles));
+    }
+    else
+    {
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileOffsets,
+                        LIBERTIFF_NS::TagType::Long,
+                        std::vector<uint32_t>(nTiles));
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::TileByteCounts,
+                        LIBERTIFF_NS::TagType::Long,
+                        std::vector<uint32_t>(nTiles));
+    }
+    if (nBands > nColorChannels)
+    {
+        std::vector<uint16_t> anExtraSamples;
+        for (int i = nColorChannels + 1; i <= nBands; ++i)
+        {
+            anExtraSamples.push_back(
+                poSrcDS->GetRasterBand(i)->GetColorInterpretation() ==
+                        GCI_AlphaBand
+                    ? LIBERTIFF_NS::ExtraSamples::UnAssociatedAlpha
+                    : LIBERTIFF_NS::ExtraSamples::Unspecified);
+        }
+        LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::ExtraSamples,
+                        LIBERTIFF_NS::TagType::Short, anExtraSamples);
+    }
+    LIBERTIFFAddTag(tags, LIBERTIFF_NS::TagCode::SampleFormat,
+                    LIBERTIFF_NS::TagType::Short,
+                    std::vector<uint16_t>(nBands, nSampleFormat));
+
+    if (!LIBERTIFFAddGeoreferencing(tags, poSrcDS, CPL_TO_BOOL(bStrict)))
+        return nullptr;
+
+    const std::string osGDALMetadata = LIBERTIFFGetGDALMetadata(poSrcDS);
+    if (!osGDALMetadata.empty())
+    {
+        LIBERTIFFAddASCIITag(tags, LIBERTIFF_NS::TagCode::GDAL_METADATA,
+                             osGDALMetadata);
+    }
+
+    int bHasNoData = FALSE;
+    std::string osNoData;
+    if (eDT == GDT_Int64)
+    {
+        const auto nNoData = poSrcBand1->GetNoDataValueAsInt64(&bHasNoData);
+        osNoData = CPLSPrintf(CPL_FRMT_GIB, static_cast<GIntBig>(nNoData));
+    }
+    else if (eDT == GDT_UInt64)
+    {
+        const auto nNoData = poSrcBand1->GetNoDataValueAsUInt64(&bHasNoData);
+        osNoData = CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(nNoData));
+    }
+    else
+    {
+        const double dfNoData = poSrcBand1->GetNoDataValue(&bHasNoData);
+        osNoData = std::isnan(dfNoData)   ? std::string("nan")
+                   : std::isinf(dfNoData) ? std::string(dfNoData > 0 ? "inf"
+                                                                     : "-inf")
+                                          : std::string(CPLSPrintf(
+                                                "%.17g", dfNoData));
+    }
+    if (bHasNoData)
+        LIBERTIFFAddASCIITag(tags, LIBERTIFF_NS::TagCode::GDAL_NODATA,
+                             osNoData);
+
+    /* -------------------------------------------------------------------- */
+    /*      Write header and IFD.                                           */
+    /* -------------------------------------------------------------------- */
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "wb"));
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Cannot create %s", pszFilename);
+        return nullptr;
+    }
+    vsi_l_offset nCurOffset =
+        LIBERTIFFWriteHeaderAndIFD(fp.get(), bBigTIFF, tags);
+    if (nCurOffset == 0)
+        return nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Write tiles.                                                    */
+    /*                                                                      */
+    /*      Tiles are handled by chunks of consecutive tiles of a same row. */
+    /*      While the tiles of a chunk are extracted and compressed by      */
+    /*      worker threads, the next chunk is read from the source.         */
+    /* -------------------------------------------------------------------- */
+    constexpr size_t MAX_CHUNK_BUFFER_SIZE = 64 * 1024 * 1024;
+    const size_t nTileRowStripSize =
+        static_cast<size_t>(nBlockSize) * nBlockSize * nBands * nDTSize;
+    const int nTilesPerChunk = static_cast<int>(
+        std::clamp(MAX_CHUNK_BUFFER_SIZE / nTileRowStripSize, size_t(1),
+                   static_cast<size_t>(nTilesX)));
+    const int nChunksPerRow = DIV_ROUND_UP(nTilesX, nTilesPerChunk);
+    const int nChunks = nChunksPerRow * nTilesY;
+
+    struct TileJob
+    {
+        size_t nTileIdx = 0;
+        int iTileInChunk = 0;
+        int iPlane = 0;
+        std::vector<GByte> abyTile{};
+        std::vector<GByte> abyCompressed{};
+        bool bOK = true;
+    };
+
+    struct Chunk
+    {
+        int nXOff = 0;
+        int nYOff = 0;
+        int nWidth = 0;
+        int nHeight = 0;
+        std::vector<GByte> abyBuffer{};
+        std::vector<TileJob> aJobs{};
+    };
+
+    std::array<Chunk, 2> aChunks;
+
+    const auto ReadChunk = [poSrcDS, nXSize, nYSize, nBands, nBlockSize,
+                            nTilesX, nTilesPerChunk, nChunksPerRow, nPlanes,
+                            nTilesPerPlane, bSeparate, nDTSize,
+                            eDT](int iChunk, Chunk &chunk)
+    {
+        const int nTileY = iChunk / nChunksPerRow;
+        const int nFirstTileX = (iChunk % nChunksPerRow) * nTilesPerChunk;
+        const int nTilesInChunk =
+            std::min(nTilesPerChunk, nTilesX - nFirstTileX);
+        chunk.nXOff = nFirstTileX * nBlockSize;
+        chunk.nYOff = nTileY * nBlockSize;
+        chunk.nWidth = std::min(nTilesInChunk * nBlockSize,
+                                nXSize - chunk.nXOff);
+        chunk.nHeight = std::min(nBlockSize, nYSize - chunk.nYOff);
+        const size_t nPixels =
+            static_cast<size_t>(chunk.nWidth) * chunk.nHeight;
+        try
+        {
+            chunk.abyBuffer.resize(nPixels * nBands * nDTSize);
+            chunk.aJobs.resize(static_cast<size_t>(nTilesInChunk) * nPlanes);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            return false;
+        }
+
+        for (int iPlane = 0; iPlane < nPlanes; ++iPlane)
+        {
+            for (int i = 0; i < nTilesInChunk; ++i)
+            {
+                auto &job = chunk.aJobs[static_cast<size_t>(iPlane) *
+                                            nTilesInChunk +
+                                        i];
+                job.nTileIdx =
+                    static_cast<size_t>(iPlane * nTilesPerPlane +
+                                        static_cast<uint64_t>(nTileY) *
+                                            nTilesX +
+                                        nFirstTileX + i);
+                job.iTileInChunk = i;
+                job.iPlane = iPlane;
+                job.bOK = true;
+            }
+        }
+
+        const GSpacing nPixelSpace =
+            static_cast<GSpacing>(nDTSize) * (bSeparate ? 1 : nBands);
+        const GSpacing nLineSpace = nPixelSpace * chunk.nWidth;
+        const GSpacing nBandSpace = bSeparate
+                                        ? static_cast<GSpacing>(nPixels) *
+                                              nDTSize
+                                        : static_cast<GSpacing>(nDTSize);
+        return poSrcDS->RasterIO(GF_Read, chunk.nXOff, chunk.nYOff,
+                                 chunk.nWidth, chunk.nHeight,
+                                 chunk.abyBuffer.data(), chunk.nWidth,
+                                 chunk.nHeight, eDT, nBands, nullptr,
+                                 nPixelSpace, nLineSpace, nBandSpace,
+                                 nullptr) == CE_None;
+    };
+
+    const auto ProcessTile = [nBlockSize, nSamplesPerTile, nDTSize, nTileSize,
+                              poCompressor, &aosCompressorOptions](
+                                 const Chunk &chunk, TileJob &job)
+    {
+        try
+        {
+            job.abyTile.resize(nTileSize);
+        }
+        catch (const std::exception &)
+        {
+            job.bOK = false;
+            return;
+        }
+        const size_t nTileLineSize =
+            static_cast<size_t>(nBlockSize) * nSamplesPerTile * nDTSize;
+        const int nValidCols = std::min(
+            nBlockSize, chunk.nWidth - job.iTileInChunk * nBlockSize);
+        const size_t nValidLineSize =
+            static_cast<size_t>(nValidCols) * nSamplesPerTile * nDTSize;
+        const size_t nChunkLineSize =
+            static_cast<size_t>(chunk.nWidth) * nSamplesPerTile * nDTSize;
+        const GByte *pabySrc =
+            chunk.abyBuffer.data() +
+            static_cast<size_t>(job.iPlane) * chunk.nHeight * nChunkLineSize +
+            static_cast<size_t>(job.iTileInChunk) * nTileLineSize;
+        GByte *pabyDst = job.abyTile.data();
+        for (int iY = 0; iY < chunk.nHeight; ++iY)
+        {
+            memcpy(pabyDst, pabySrc, nValidLineSize);
+            memset(pabyDst + nValidLineSize, 0, nTileLineSize - nValidLineSize);
+            pabySrc += nChunkLineSize;
+            pabyDst += nTileLineSize;
+        }
+        memset(pabyDst, 0,
+               static_cast<size_t>(nBlockSize - chunk.nHeight) *
+                   nTileLineSize);
+        job.bOK = LIBERTIFFCompressTile(poCompressor,
+                                        aosCompressorOptions.List(),
+                                        job.abyTile, job.abyCompressed);
+    };
+
+    std::vector<uint64_t> anTileOffsets(nTiles);
+    std::vector<uint64_t> anTileByteCounts(nTiles);
+    const auto WriteChunk = [&fp, &nCurOffset, &anTileOffsets,
+                             &anTileByteCounts, bBigTIFF](const Chunk &chunk)
+    {
+        for (const auto &job : chunk.aJobs)
+        {
+            if (!job.bOK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot compress tile %d",
+                         static_cast<int>(job.nTileIdx));
+                return false;
+            }
+            const size_t nSize = job.abyCompressed.size();
+            if (!bBigTIFF &&
+                nCurOffset + nSize > std::numeric_limits<uint32_t>::max())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Maximum TIFF file size exceeded. Use BIGTIFF=YES");
+                return false;
+            }
+            if (fp->Write(job.abyCompressed.data(), 1, nSize) != nSize)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot write tile %d",
+                         static_cast<int>(job.nTileIdx));
+                return false;
+            }
+            anTileOffsets[job.nTileIdx] = nCurOffset;
+            anTileByteCounts[job.nTileIdx] = nSize;
+            nCurOffset += nSize;
+        }
+        return true;
+    };
+
+    const auto SubmitChunk = [&poQueue, &ProcessTile](Chunk &chunk)
+    {
+        for (auto &job : chunk.aJobs)
+        {
+            if (poQueue)
+            {
+                Chunk *pChunk = &chunk;
+                TileJob *pJob = &job;
+                poQueue->SubmitJob([&ProcessTile, pChunk, pJob]()
+                                   { ProcessTile(*pChunk, *pJob); });
+            }
+            else
+            {
+                ProcessTile(chunk, job);
+            }
+        }
+    };
+
+    bool bOK = ReadChunk(0, aChunks[0]);
+    if (bOK)
+        SubmitChunk(aChunks[0]);
+    for (int iChunk = 0; bOK && iChunk < nChunks; ++iChunk)
+    {
+        Chunk &curChunk = aChunks[iChunk % 2];
+        Chunk &nextChunk = aChunks[(iChunk + 1) % 2];
+        if (iChunk + 1 < nChunks)
+            bOK = ReadChunk(iChunk + 1, nextChunk);
+        if (poQueue)
+            poQueue->WaitCompletion();
+        bOK = bOK && WriteChunk(curChunk);
+        if (bOK && iChunk + 1 < nChunks)
+            SubmitChunk(nextChunk);
+        if (bOK && !pfnProgress(static_cast<double>(iChunk + 1) / nChunks,
+                                "", pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            bOK = false;
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    /* -------------------------------------------------------------------- */
+    /*      Rewrite the TileOffsets and TileByteCounts arrays.              */
+    /* -------------------------------------------------------------------- */
+    const auto WriteArray = [&fp, bBigTIFF](const LIBERTIFFWriterTag &tag,
+                                            const std::vector<uint64_t> &an)
+    {
+        if (fp->Seek(tag.valueOffset, SEEK_SET) != 0)
+            return false;
+        if (bBigTIFF)
+            return fp->Write(an.data(), sizeof(uint64_t), an.size()) ==
+                   an.size();
+        const std::vector<uint32_t> an32(an.begin(), an.end());
+        return fp->Write(an32.data(), sizeof(uint32_t), an32.size()) ==
+               an32.size();
+    };
+    bOK = bOK &&
+          WriteArray(tags[LIBERTIFF_NS::TagCode::TileOffsets],
+                     anTileOffsets) &&
+          WriteArray(tags[LIBERTIFF_NS::TagCode::TileByteCounts],
+                     anTileByteCounts);
+    if (fp->Close() != 0 && bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while closing %s",
+                 pszFilename);
+        bOK = false;
+    }
+    fp.reset();
+    if (!bOK)
+    {
+        VSIUnlink(pszFilename);
+        return nullptr;
+    }
+
+    GDALOpenInfo oOpenInfo(pszFilename, GA_ReadOnly);
+    return OpenStatic(&oOpenInfo);
+}
+
 /************************************************************************/
 /*                           OpenStatic()                               */
 /************************************************************************/
@@ -3236,6 +4408,7 @@ void GDALRegister_LIBERTIFF()
 
     poDriver->pfnIdentify = LIBERTIFFDataset::Identify;
     poDriver->pfnOpen = LIBERTIFFDataset::OpenStatic;
+    poDriver->pfnCreateCopy = LIBERTIFFDataset::CreateCopy;
 
     poDriver->SetMetadataItem(
         GDAL_DMD_OPENOPTIONLIST,
@@ -3244,6 +4417,41 @@ void GDALRegister_LIBERTIFF()
         "worker threads for compression. Can be set to ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
 
+    poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES,
+                              "Byte Int8 UInt16 Int16 UInt32 Int32 UInt64 "
+                              "Int64 Float32 Float64");
+    poDriver->SetMetadataItem(
+        GDAL_DMD_CREATIONOPTIONLIST,
+        CPLSPrintf(
+            "<CreationOptionList>"
+            "   <Option name='COMPRESS' type='string-select' default='NONE'>"
+            "       <Value>NONE</Value>"
+            "       <Value>DEFLATE</Value>"
+            "%s"
+            "   </Option>"
+            "   <Option name='LEVEL' type='int' description='Deflate or ZSTD "
+            "compression level'/>"
+            "   <Option name='BLOCKSIZE' type='int' description='Tile width "
+            "and height in pixels. Must be a multiple of 16' default='256'/>"
+            "   <Option name='INTERLEAVE' type='string-select' "
+            "default='PIXEL'>"
+            "       <Value>PIXEL</Value>"
+            "       <Value>BAND</Value>"
+            "   </Option>"
+            "   <Option name='BIGTIFF' type='string-select' "
+            "description='Force creation of BigTIFF file' "
+            "default='IF_NEEDED'>"
+            "     <Value>YES</Value>"
+            "     <Value>NO</Value>"
+            "     <Value>IF_NEEDED</Value>"
+            "   </Option>"
+            "   <Option name='NUM_THREADS' type='string' "
+            "description='Number of worker threads for compression. "
+            "Can be set to ALL_CPUS' default='1'/>"
+            "</CreationOptionList>",
+            CPLGetCompressor("zstd") ? "       <Value>ZSTD</Value>" : ""));
+
     if (CPLGetDecompressor("lzma"))
     {
         poDriver->SetMetadataItem("LZMA_SUPPORT", "YES", "LIBERTIFF");
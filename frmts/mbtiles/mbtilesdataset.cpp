@@ -119,6 +119,11 @@ class MBTilesDataset final : public GDALPamDataset,
                                    void *pProgressData,
                                    CSLConstList papszOptions) override;
 
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, int, BANDMAP_TYPE, GSpacing,
+                             GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual int GetLayerCount() override
     {
         return static_cast<int>(m_apoLayers.size());
@@ -1016,6 +1021,31 @@ int MBTilesDataset::GetRowFromIntoTopConvention(int nRow)
     return m_nTileMatrixHeight - 1 - nRow;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBands > 0 &&
+        (nBufXSize >= nXSize || nBufYSize >= nYSize ||
+         GetRasterBand(1)->GetOverviewCount() == 0))
+    {
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+
+    return GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
 /************************************************************************/
 /*                          GetGeoTransform()                           */
 /************************************************************************/
@@ -3814,6 +3844,7 @@ void GDALRegister_MBTiles()
 #endif
         "</CreationOptionList>");
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_CONCURRENT_READ_BLOCK, "YES");
 
 #ifdef HAVE_MVT_WRITE_SUPPORT
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_FIELD, "YES");
@@ -28,6 +28,7 @@
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
@@ -35,6 +36,19 @@
 struct MEMDataset::Private
 {
     std::shared_ptr<GDALGroup> m_poRootGroup{};
+
+    //! Memory mapping of the file backing the bands, with MMAP_FILENAME
+    CPLVirtualMem *m_psVirtualMem = nullptr;
+
+    Private() = default;
+
+    ~Private()
+    {
+        if (m_psVirtualMem)
+            CPLVirtualMemFree(m_psVirtualMem);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(Private)
 };
 
 /************************************************************************/
@@ -198,6 +212,16 @@ CPLErr MEMRasterBand::IWriteBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                       IsWriteBlockThreadSafe()                       */
+/************************************************************************/
+
+bool MEMRasterBand::IsWriteBlockThreadSafe() const
+{
+    // Distinct blocks are written to distinct memory areas
+    return true;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -377,32 +401,44 @@ CPLErr MEMDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             }
             return CE_None;
         }
-        else if (eRWFlag == GF_Write && nBandCount <= 4 &&
-                 IsBandSeparatedDataset())
+        else if (IsBandSeparatedDataset())
         {
-            // TODO: once we have a GDALInterleave() function, implement the
-            // GF_Read case
             FlushCache(false);
             const auto poFirstBand =
                 cpl::down_cast<MEMRasterBand *>(papoBands[0]);
             const GDALDataType eDT = poFirstBand->GetRasterDataType();
-            void *ppDestBuffer[4] = {nullptr, nullptr, nullptr, nullptr};
+            std::vector<void *> apBandBuffers(nBandCount);
+            const auto InterleaveOrDeinterleave =
+                [eRWFlag, eBufType, eDT, nBandCount,
+                 &apBandBuffers](void *pBuffer, size_t nIters)
+            {
+                if (eRWFlag == GF_Read)
+                {
+                    GDALInterleave(apBandBuffers.data(), eDT, nBandCount,
+                                   pBuffer, eBufType, nIters);
+                }
+                else
+                {
+                    GDALDeinterleave(pBuffer, eBufType, nBandCount,
+                                     apBandBuffers.data(), eDT, nIters);
+                }
+            };
             if (nXOff == 0 && nXSize == nRasterXSize &&
                 poFirstBand->nLineOffset ==
                     poFirstBand->nPixelOffset * nXSize &&
                 nLineSpaceBuf == nPixelSpaceBuf * nXSize)
             {
                 // Optimization of the general case in the below else() clause:
-                // writing whole strips from a fully packed buffer
+                // reading or writing whole strips from a fully packed buffer
                 for (int i = 0; i < nBandCount; ++i)
                 {
                     const auto poBand =
                         cpl::down_cast<MEMRasterBand *>(papoBands[i]);
-                    ppDestBuffer[i] =
+                    apBandBuffers[i] =
                         poBand->pabyData + poBand->nLineOffset * nYOff;
                 }
-                GDALDeinterleave(pData, eBufType, nBandCount, ppDestBuffer, eDT,
-                                 static_cast<size_t>(nXSize) * nYSize);
+                InterleaveOrDeinterleave(pData,
+                                         static_cast<size_t>(nXSize) * nYSize);
             }
             else
             {
@@ -412,14 +448,14 @@ CPLErr MEMDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     {
                         const auto poBand =
                             cpl::down_cast<MEMRasterBand *>(papoBands[i]);
-                        ppDestBuffer[i] = poBand->pabyData +
-                                          poBand->nPixelOffset * nXOff +
-                                          poBand->nLineOffset * (iLine + nYOff);
+                        apBandBuffers[i] =
+                            poBand->pabyData + poBand->nPixelOffset * nXOff +
+                            poBand->nLineOffset * (iLine + nYOff);
                     }
-                    GDALDeinterleave(
+                    InterleaveOrDeinterleave(
                         static_cast<GByte *>(pData) +
                             nLineSpaceBuf * static_cast<size_t>(iLine),
-                        eBufType, nBandCount, ppDestBuffer, eDT, nXSize);
+                        nXSize);
                 }
             }
             return CE_None;
@@ -1362,13 +1398,44 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
 #endif
 
     std::vector<GByte *> apbyBandData;
+    CPLVirtualMem *psVirtualMem = nullptr;
     if (nBandsIn > 0)
     {
-        GByte *pabyData =
-            static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nGlobalSize));
-        if (!pabyData)
+        GByte *pabyData = nullptr;
+        const char *pszMMapFilename =
+            CSLFetchNameValue(papszOptions, "MMAP_FILENAME");
+        if (pszMMapFilename)
+        {
+            // Scratch rasters larger than RAM: back the bands with a file
+            // mapped in memory, and let the OS page it in and out.
+            if (!CPLIsVirtualMemFileMapAvailable())
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "MMAP_FILENAME is not supported on this platform");
+                return nullptr;
+            }
+            VSILFILE *fp = VSIFOpenL(pszMMapFilename, "wb+");
+            if (!fp)
+            {
+                CPLError(CE_Failure, CPLE_OpenFailed, "Cannot create %s",
+                         pszMMapFilename);
+                return nullptr;
+            }
+            psVirtualMem = CPLVirtualMemFileMapNew(
+                fp, 0, nGlobalBigSize, VIRTUALMEM_READWRITE, nullptr, nullptr);
+            // The mapping remains valid once the file is closed
+            VSIFCloseL(fp);
+            if (!psVirtualMem)
+                return nullptr;
+            pabyData = static_cast<GByte *>(CPLVirtualMemGetAddr(psVirtualMem));
+        }
+        else
         {
-            return nullptr;
+            pabyData = static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nGlobalSize));
+            if (!pabyData)
+            {
+                return nullptr;
+            }
         }
 
         if (bPixelInterleaved)
@@ -1397,6 +1464,7 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
     poDS->nRasterXSize = nXSize;
     poDS->nRasterYSize = nYSize;
     poDS->eAccess = GA_Update;
+    poDS->m_poPrivate->m_psVirtualMem = psVirtualMem;
 
     const char *pszPixelType = CSLFetchNameValue(papszOptions, "PIXELTYPE");
     if (pszPixelType && EQUAL(pszPixelType, "SIGNEDBYTE"))
@@ -1414,13 +1482,15 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
     {
         MEMRasterBand *poNewBand = nullptr;
 
+        // The first band owns the whole buffer, unless it is a mapping
+        const bool bOwnData = iBand == 0 && psVirtualMem == nullptr;
         if (bPixelInterleaved)
             poNewBand = new MEMRasterBand(
                 poDS, iBand + 1, apbyBandData[iBand], eType,
-                cpl::fits_on<int>(nWordSize * nBandsIn), 0, iBand == 0);
+                cpl::fits_on<int>(nWordSize * nBandsIn), 0, bOwnData);
         else
             poNewBand = new MEMRasterBand(poDS, iBand + 1, apbyBandData[iBand],
-                                          eType, 0, 0, iBand == 0);
+                                          eType, 0, 0, bOwnData);
 
         poDS->SetBand(iBand + 1, poNewBand);
     }
@@ -3245,6 +3315,9 @@ void GDALRegister_MEM()
         "       <Value>BAND</Value>"
         "       <Value>PIXEL</Value>"
         "   </Option>"
+        "   <Option name='MMAP_FILENAME' type='string' "
+        "description='Filename of a file, created by the driver, in which "
+        "the pixel values are stored through memory mapping'/>"
         "</CreationOptionList>");
 
     // Define GDAL_NO_OPEN_FOR_MEM_DRIVER macro to undefine Open() method for
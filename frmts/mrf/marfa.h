@@ -58,11 +58,17 @@
 #ifndef GDAL_FRMTS_MRF_MARFA_H_INCLUDED
 #define GDAL_FRMTS_MRF_MARFA_H_INCLUDED
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
 
+#include <condition_variable>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
 // For printing values
 #include <ostream>
 #include <iostream>
@@ -412,6 +418,9 @@ class MRFDataset final : public GDALPamDataset
 
     virtual char **GetFileList() override;
 
+    // Also waits for the tiles being compressed and written
+    virtual CPLErr FlushCache(bool bAtClosing = false) override;
+
     void SetColorTable(GDALColorTable *pct)
     {
         poColorTable = pct;
@@ -469,6 +478,9 @@ class MRFDataset final : public GDALPamDataset
     // options in dataset variables
     void ProcessOpenOptions(char **papszOptions);
 
+    // Set the number of threads used to compress tiles
+    void SetWriteThreads(const char *val);
+
     // Writes the XML tree as MRF.  It does not check the content
     int WriteConfig(CPLXMLNode *);
 
@@ -507,6 +519,18 @@ class MRFDataset final : public GDALPamDataset
     virtual CPLErr WriteTile(void *buff, GUIntBig infooffset,
                              GUIntBig size = 0);
 
+    // Job queue for write-behind of tiles, nullptr if tiles are written
+    // synchronously
+    CPLJobQueue *GetTileWriteQueue();
+
+    // Hand over a page buffer to a worker thread, which compresses and
+    // writes it. A null page writes an empty tile
+    CPLErr SubmitTileWrite(MRFRasterBand *poBand, void *page,
+                           GUIntBig infooffset);
+
+    // Wait for all the pending tile writes, reporting their errors
+    CPLErr WaitTileWrites();
+
     // Custom CopyWholeRaster for Zen JPEG
     CPLErr ZenCopy(GDALDataset *poSrc, GDALProgressFunc pfnProgress,
                    void *pProgressData);
@@ -631,6 +655,19 @@ class MRFDataset final : public GDALPamDataset
 #endif
     // Time duration spend for decompression and compression
     std::chrono::nanoseconds read_timer, write_timer;
+
+    // Write-behind of tiles, compressed by worker threads
+    int nWriteThreads = 1;
+    bool bTileWriteQueueInitDone = false;
+    std::unique_ptr<CPLJobQueue> poTileWriteQueue{};
+    size_t nMaxTileWritesInFlight = 0;
+    std::unique_ptr<CPLErrorAccumulator> poTileWriteErrors{};
+    std::condition_variable oTileWriteCV{};
+    // Protects the members below, the data and index files and write_timer
+    // while tile writes are pending
+    std::mutex oTileWriteMutex{};
+    std::set<GUIntBig> oTilesBeingWritten{};  // By index offset
+    bool bTileWriteError = false;
 };
 
 class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
@@ -701,6 +738,10 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
         dozstd = (v != 0);
     }
 
+    // Compress a page held at the start of a buffer of pageSizeBytes + pbsize
+    // and write it, from a worker thread
+    CPLErr CompressAndWritePage(void *page, GUIntBig infooffset);
+
   protected:
     // Pointer to the GDALMRFDataset
     MRFDataset *poMRFDS;
@@ -752,6 +793,19 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) = 0;
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) = 0;
 
+    // Whether Compress() can be called concurrently from several threads
+    virtual bool CanCompressInParallel() const
+    {
+        return false;
+    }
+
+    // Whether pages are compressed and written by worker threads
+    bool IsWriteBehind()
+    {
+        return CanCompressInParallel() && !dozstd &&
+               poMRFDS->GetTileWriteQueue() != nullptr;
+    }
+
     // Read the index record itself, can be overwritten
     //    virtual CPLErr ReadTileIdx(const ILSize &, ILIdx &, GIntBig bias = 0);
 
@@ -935,6 +989,11 @@ class Raw_Band final : public MRFRasterBand
     {
         return Decompress(dst, src);
     }
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
 };
 
 class TIF_Band final : public MRFRasterBand
@@ -965,6 +1024,12 @@ class LERC_Band final : public MRFRasterBand
   protected:
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
+
     double precision = 0;
     // L1 or L2
     int version = 0;
@@ -1003,6 +1068,11 @@ class QB3_Band final : public MRFRasterBand
   protected:
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
 };
 #endif
 
@@ -62,6 +62,7 @@
 #include "mrfdrivercore.h"
 #include "cpl_multiproc.h" /* for CPLSleep() */
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include <assert.h>
 
 #include <algorithm>
@@ -2107,6 +2108,17 @@ CPLErr MRFDataset::ZenCopy(GDALDataset *poSrc, GDALProgressFunc pfnProgress,
 
 // Apply open options to the current dataset
 // Called before the configuration is read
+// Number of tile compression threads, from the NUM_THREADS option value or
+// the GDAL_NUM_THREADS configuration option
+void MRFDataset::SetWriteThreads(const char *val)
+{
+    if (!val)
+        val = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (val)
+        nWriteThreads = std::min(
+            1024, EQUAL(val, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(val));
+}
+
 void MRFDataset::ProcessOpenOptions(char **papszOptions)
 {
     CPLStringList opt(papszOptions, FALSE);
@@ -2114,6 +2126,7 @@ void MRFDataset::ProcessOpenOptions(char **papszOptions)
     const char *val = opt.FetchNameValue("ZSLICE");
     if (val)
         zslice = atoi(val);
+    SetWriteThreads(opt.FetchNameValue("NUM_THREADS"));
 }
 
 // Apply create options to the current dataset, only valid during creation
@@ -2168,6 +2181,8 @@ void MRFDataset::ProcessCreateOptions(char **papszOptions)
     if (val)
         photometric = val;
 
+    SetWriteThreads(opt.FetchNameValue("NUM_THREADS"));
+
     val = opt.FetchNameValue("DATANAME");
     if (val)
         img.datfname = val;
@@ -2515,6 +2530,118 @@ CPLErr MRFDataset::WriteTile(void *buff, GUIntBig infooffset, GUIntBig size)
     return ret;
 }
 
+//
+// Tiles can be compressed and written by worker threads, while the caller
+// goes on filling the next blocks. The number of threads is set by the
+// NUM_THREADS creation or open option, or the GDAL_NUM_THREADS configuration
+// option. Versioned, multi-process safe and caching MRFs are always written
+// synchronously.
+//
+CPLJobQueue *MRFDataset::GetTileWriteQueue()
+{
+    if (bTileWriteQueueInitDone)
+        return poTileWriteQueue.get();
+    bTileWriteQueueInitDone = true;
+
+    if (nWriteThreads <= 1 || hasVersions || mp_safe || !source.empty())
+        return nullptr;
+
+    CPLWorkerThreadPool *wtp = GDALGetGlobalThreadPool(nWriteThreads);
+    if (!wtp)
+        return nullptr;
+    poTileWriteQueue = wtp->CreateJobQueue();
+    poTileWriteErrors = std::make_unique<CPLErrorAccumulator>();
+    // Bounds the memory used by pages waiting to be compressed
+    nMaxTileWritesInFlight = 2 * static_cast<size_t>(nWriteThreads);
+    CPLDebug("MRF", "Writing tiles with up to %d threads", nWriteThreads);
+    return poTileWriteQueue.get();
+}
+
+//
+// Takes ownership of the page, which has to be allocated with VSIMalloc()
+// A tile that is written again waits for the previous write to finish, so
+// the index ends up pointing to the last version
+//
+CPLErr MRFDataset::SubmitTileWrite(MRFRasterBand *poBand, void *page,
+                                   GUIntBig infooffset)
+{
+    CPLJobQueue *poQueue = GetTileWriteQueue();
+    if (!poQueue)
+    {
+        CPLErr ret = poBand->CompressAndWritePage(page, infooffset);
+        CPLFree(page);
+        return ret;
+    }
+
+    // Open the files before the workers need them
+    if (!DataFP() || !IdxFP())
+    {
+        CPLFree(page);
+        return CE_Failure;
+    }
+
+    {
+        std::unique_lock<std::mutex> oLock(oTileWriteMutex);
+        oTileWriteCV.wait(oLock,
+                          [this, infooffset]()
+                          {
+                              return oTilesBeingWritten.size() <
+                                         nMaxTileWritesInFlight &&
+                                     !cpl::contains(oTilesBeingWritten,
+                                                    infooffset);
+                          });
+        if (bTileWriteError)
+        {
+            oLock.unlock();
+            CPLFree(page);
+            WaitTileWrites();
+            return CE_Failure;
+        }
+        oTilesBeingWritten.insert(infooffset);
+    }
+
+    poQueue->SubmitJob(
+        [this, poBand, page, infooffset]()
+        {
+            CPLErr ret;
+            {
+                auto oAccumulator = poTileWriteErrors->InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                ret = poBand->CompressAndWritePage(page, infooffset);
+            }
+            CPLFree(page);
+
+            std::lock_guard<std::mutex> oLock(oTileWriteMutex);
+            if (CE_None != ret)
+                bTileWriteError = true;
+            oTilesBeingWritten.erase(infooffset);
+            oTileWriteCV.notify_all();
+        });
+    return CE_None;
+}
+
+CPLErr MRFDataset::WaitTileWrites()
+{
+    if (!poTileWriteQueue)
+        return CE_None;
+    poTileWriteQueue->WaitCompletion();
+    poTileWriteErrors->ReplayErrors();
+    poTileWriteErrors = std::make_unique<CPLErrorAccumulator>();
+
+    std::lock_guard<std::mutex> oLock(oTileWriteMutex);
+    CPLErr ret = bTileWriteError ? CE_Failure : CE_None;
+    bTileWriteError = false;
+    return ret;
+}
+
+CPLErr MRFDataset::FlushCache(bool bAtClosing)
+{
+    CPLErr ret = GDALPamDataset::FlushCache(bAtClosing);
+    if (CE_None != WaitTileWrites())
+        ret = CE_Failure;
+    return ret;
+}
+
 CPLErr MRFDataset::SetGeoTransform(double *gt)
 {
     if (GetAccess() != GA_Update || bCrystalized)
@@ -2559,6 +2686,10 @@ CPLErr MRFDataset::GetGeoTransform(double *gt)
 CPLErr MRFDataset::ReadTileIdx(ILIdx &tinfo, const ILSize &pos,
                                const ILImage &img, const GIntBig bias)
 {
+    // Tiles being written have to be on file before reading
+    if (CE_None != WaitTileWrites())
+        return CE_Failure;
+
     VSILFILE *l_ifp = IdxFP();
 
     // Initialize the tinfo structure, in case the files are missing
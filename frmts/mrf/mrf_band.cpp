@@ -1260,7 +1260,27 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
         if (!success)
             val = 0.0;
         if (isAllVal(eDataType, buffer, img.pageSizeBytes, val))
+        {
+            if (IsWriteBehind())
+                return poMRFDS->SubmitTileWrite(this, nullptr, infooffset);
             return poMRFDS->WriteTile(nullptr, infooffset, 0);
+        }
+
+        if (IsWriteBehind())
+        {
+            // Copy the page, the worker thread compresses it in place
+            void *page = VSI_MALLOC_VERBOSE(
+                static_cast<size_t>(img.pageSizeBytes) + poMRFDS->pbsize);
+            if (!page)
+                return CE_Failure;
+            memcpy(page, buffer, static_cast<size_t>(img.pageSizeBytes));
+            buf_mgr src = {static_cast<char *>(page),
+                           static_cast<size_t>(img.pageSizeBytes)};
+            if (is_Endianness_Dependent(img.dt, img.comp) &&
+                (img.nbo != NET_ORDER))
+                swab_buff(src, img);
+            return poMRFDS->SubmitTileWrite(this, page, infooffset);
+        }
 
         // Use the pbuffer to hold the compressed page before writing it
         poMRFDS->tile = ILSize();  // Mark it corrupt
@@ -1419,6 +1439,8 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
     if (GIntBig(empties) == AllBandMask())
     {
         CPLFree(tbuffer);
+        if (IsWriteBehind())
+            return poMRFDS->SubmitTileWrite(this, nullptr, infooffset);
         return poMRFDS->WriteTile(nullptr, infooffset, 0);
     }
 
@@ -1428,6 +1450,12 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
                  " instead of " CPL_FRMT_GIB,
                  poMRFDS->bdirty, AllBandMask());
 
+    if (IsWriteBehind())
+    {
+        poMRFDS->bdirty = 0;
+        return poMRFDS->SubmitTileWrite(this, tbuffer, infooffset);
+    }
+
     buf_mgr src;
     src.buffer = (char *)tbuffer;
     src.size = static_cast<size_t>(img.pageSizeBytes);
@@ -1503,6 +1531,60 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
     return ret;
 }
 
+/**
+ *\brief Compress a page and write it as a tile
+ *
+ * The page is at the start of a buffer of pageSizeBytes + pbsize, the rest
+ * holds the compressed output. A null page writes an empty tile.
+ * This runs in worker threads, the dataset is only modified while holding the
+ * tile write lock
+ */
+CPLErr MRFRasterBand::CompressAndWritePage(void *page, GUIntBig infooffset)
+{
+    if (nullptr == page)
+    {
+        std::lock_guard<std::mutex> oLock(poMRFDS->oTileWriteMutex);
+        return poMRFDS->WriteTile(nullptr, infooffset, 0);
+    }
+
+    auto start_time = steady_clock::now();
+
+    buf_mgr src = {static_cast<char *>(page),
+                   static_cast<size_t>(img.pageSizeBytes)};
+    char *outbuff = static_cast<char *>(page) + img.pageSizeBytes;
+    buf_mgr dst = {outbuff, poMRFDS->pbsize};
+    CPLErr ret = Compress(dst, src);
+
+    void *usebuff = outbuff;
+    if (CE_None == ret && dodeflate)
+    {
+        // Move the packed part at the start of the page, to make more space
+        memcpy(page, outbuff, dst.size);
+        dst.buffer = static_cast<char *>(page);
+        usebuff = DeflateBlock(dst,
+                               static_cast<size_t>(img.pageSizeBytes) +
+                                   poMRFDS->pbsize - dst.size,
+                               deflate_flags);
+        if (!usebuff)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "MRF: Deflate error");
+            ret = CE_Failure;
+        }
+    }
+
+    const auto elapsed =
+        duration_cast<nanoseconds>(steady_clock::now() - start_time);
+
+    std::lock_guard<std::mutex> oLock(poMRFDS->oTileWriteMutex);
+    poMRFDS->write_timer += elapsed;
+    if (CE_None != ret)
+    {
+        poMRFDS->WriteTile(nullptr, infooffset, 0);
+        return ret;
+    }
+    return poMRFDS->WriteTile(usebuff, infooffset, dst.size);
+}
+
 //
 // Tests if a given block exists without reading it
 // returns false only when it is definitely not existing
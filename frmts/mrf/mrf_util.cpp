@@ -651,6 +651,9 @@ void GDALRegister_mrf()
         "   <Option name='SPACING' type='int' "
         "description='Leave this many unused bytes before each tile, "
         "default=0'/>\n"
+        "   <Option name='NUM_THREADS' type='string' "
+        "description='Number of worker threads for tile compression. Can be "
+        "set to ALL_CPUS' default='1'/>\n"
         "   <Option name='PHOTOMETRIC' type='string-select' default='DEFAULT' "
         "description='Band interpretation, may affect block encoding'>\n"
         "       <Value>MULTISPECTRAL</Value>"
@@ -129,6 +129,9 @@ void MRFDriverSetCommonMetadata(GDALDriver *poDriver)
         "decompression errors' default='FALSE'/>"
         "    <Option name='ZSLICE' type='int' description='For a third "
         "dimension MRF, pick a slice' default='0'/>"
+        "    <Option name='NUM_THREADS' type='string' description='Number "
+        "of worker threads for tile compression, in update mode. Can be set "
+        "to ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
 
     // These will need to be revisited, do we support complex data types too?
@@ -0,0 +1,369 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reader of netCDF classic (CDF-1/CDF-2) variables
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "netcdfclassicreader.h"
+
+#include "cpl_error.h"
+
+#include <cstring>
+#include <limits>
+
+// Tags of the header lists, as in the netCDF classic format specification
+constexpr uint32_t NC_DIMENSION_TAG = 0x0A;
+constexpr uint32_t NC_VARIABLE_TAG = 0x0B;
+constexpr uint32_t NC_ATTRIBUTE_TAG = 0x0C;
+constexpr uint32_t STREAMING_NUMRECS = 0xFFFFFFFFU;
+
+/************************************************************************/
+/*                          GetClassicTypeSize()                        */
+/************************************************************************/
+
+static int GetClassicTypeSize(uint32_t nType)
+{
+    switch (nType)
+    {
+        case NC_BYTE:
+        case NC_CHAR:
+            return 1;
+        case NC_SHORT:
+            return 2;
+        case NC_INT:
+        case NC_FLOAT:
+            return 4;
+        case NC_DOUBLE:
+            return 8;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                        ~netCDFClassicReader()                        */
+/************************************************************************/
+
+netCDFClassicReader::~netCDFClassicReader()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+std::unique_ptr<netCDFClassicReader>
+netCDFClassicReader::Open(const std::string &osFilename)
+{
+    std::unique_ptr<netCDFClassicReader> poReader(new netCDFClassicReader());
+    poReader->m_fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!poReader->m_fp || !poReader->ParseHeader())
+        return nullptr;
+    return poReader;
+}
+
+/************************************************************************/
+/*                             ParseHeader()                            */
+/************************************************************************/
+
+bool netCDFClassicReader::ParseHeader()
+{
+    bool bOK = true;
+    const auto ReadUInt32 = [this, &bOK]()
+    {
+        uint32_t nVal = 0;
+        if (VSIFReadL(&nVal, sizeof(nVal), 1, m_fp) != 1)
+            bOK = false;
+        return CPL_MSBWORD32(nVal);
+    };
+    const auto Skip = [this, &bOK](uint64_t nBytes)
+    {
+        // Values are padded to a multiple of 4 bytes
+        nBytes = (nBytes + 3) & ~static_cast<uint64_t>(3);
+        if (VSIFSeekL(m_fp, VSIFTellL(m_fp) + nBytes, SEEK_SET) != 0)
+            bOK = false;
+    };
+    const auto SkipName = [&ReadUInt32, &Skip]() { Skip(ReadUInt32()); };
+    const auto SkipAttributes = [&ReadUInt32, &Skip, &SkipName, &bOK]()
+    {
+        const uint32_t nTag = ReadUInt32();
+        const uint32_t nCount = ReadUInt32();
+        if (nTag != NC_ATTRIBUTE_TAG)
+        {
+            // ABSENT list
+            if (nTag != 0 || nCount != 0)
+                bOK = false;
+            return;
+        }
+        for (uint32_t i = 0; bOK && i < nCount; ++i)
+        {
+            SkipName();
+            const int nTypeSize = GetClassicTypeSize(ReadUInt32());
+            if (nTypeSize == 0)
+            {
+                bOK = false;
+                break;
+            }
+            Skip(static_cast<uint64_t>(ReadUInt32()) * nTypeSize);
+        }
+    };
+
+    char achMagic[4] = {};
+    if (VSIFReadL(achMagic, 1, sizeof(achMagic), m_fp) != sizeof(achMagic) ||
+        memcmp(achMagic, "CDF", 3) != 0 ||
+        (achMagic[3] != 1 && achMagic[3] != 2))
+    {
+        return false;
+    }
+    const bool b64BitOffset = achMagic[3] == 2;
+
+    const uint32_t nNumRecs = ReadUInt32();
+    if (nNumRecs == STREAMING_NUMRECS)
+        return false;
+    m_nNumRecs = nNumRecs;
+
+    // Dimensions
+    std::vector<uint32_t> anDimSizes;
+    {
+        const uint32_t nTag = ReadUInt32();
+        const uint32_t nCount = ReadUInt32();
+        if (nTag == NC_DIMENSION_TAG)
+        {
+            for (uint32_t i = 0; bOK && i < nCount; ++i)
+            {
+                SkipName();
+                anDimSizes.push_back(ReadUInt32());
+            }
+        }
+        else if (nTag != 0 || nCount != 0)
+        {
+            return false;
+        }
+    }
+
+    // Global attributes
+    SkipAttributes();
+
+    // Variables
+    const uint32_t nTag = ReadUInt32();
+    const uint32_t nCount = ReadUInt32();
+    if (nTag != NC_VARIABLE_TAG)
+        return bOK && nTag == 0 && nCount == 0;
+
+    int nRecordVars = 0;
+    uint64_t nLastRecordVarSize = 0;
+    for (uint32_t i = 0; bOK && i < nCount; ++i)
+    {
+        Variable oVar;
+        SkipName();
+        const uint32_t nDims = ReadUInt32();
+        if (!bOK || nDims > NC_MAX_VAR_DIMS)
+            return false;
+        uint64_t nSize = 1;
+        for (uint32_t j = 0; j < nDims; ++j)
+        {
+            const uint32_t nDimId = ReadUInt32();
+            if (!bOK || nDimId >= anDimSizes.size())
+                return false;
+            const uint32_t nDimSize = anDimSizes[nDimId];
+            if (nDimSize == 0)
+            {
+                // Only the first dimension may be the record dimension
+                if (j != 0)
+                    return false;
+                oVar.bIsRecord = true;
+            }
+            else
+            {
+                if (nSize > std::numeric_limits<uint64_t>::max() / nDimSize)
+                    return false;
+                nSize *= nDimSize;
+            }
+            oVar.anDimSizes.push_back(nDimSize);
+        }
+        SkipAttributes();
+        const uint32_t nType = ReadUInt32();
+        oVar.eType = static_cast<nc_type>(nType);
+        oVar.nTypeSize = GetClassicTypeSize(nType);
+        if (oVar.nTypeSize == 0 ||
+            nSize > std::numeric_limits<uint64_t>::max() / 8)
+            return false;
+        nSize *= oVar.nTypeSize;
+        // vsize is not reliable for variables larger than 4 GB, so the size
+        // of record variables is computed from their dimensions.
+        CPL_IGNORE_RET_VAL(ReadUInt32());
+        if (b64BitOffset)
+        {
+            const uint64_t nHigh = ReadUInt32();
+            oVar.nBegin = (nHigh << 32) | ReadUInt32();
+        }
+        else
+        {
+            oVar.nBegin = ReadUInt32();
+        }
+        if (oVar.bIsRecord)
+        {
+            ++nRecordVars;
+            nLastRecordVarSize = nSize;
+            m_nRecSize += (nSize + 3) & ~static_cast<uint64_t>(3);
+        }
+        m_aoVars.push_back(std::move(oVar));
+    }
+
+    // When there is a single record variable, records are not padded.
+    if (nRecordVars == 1)
+        m_nRecSize = nLastRecordVarSize;
+
+    return bOK;
+}
+
+/************************************************************************/
+/*                            IsCompatible()                            */
+/************************************************************************/
+
+bool netCDFClassicReader::IsCompatible(int nVarId, GDALDataType eDT) const
+{
+    if (nVarId < 0 || static_cast<size_t>(nVarId) >= m_aoVars.size())
+        return false;
+    switch (m_aoVars[nVarId].eType)
+    {
+        case NC_BYTE:
+            return eDT == GDT_Byte || eDT == GDT_Int8;
+        case NC_CHAR:
+            return eDT == GDT_Byte;
+        case NC_SHORT:
+            return eDT == GDT_Int16 || eDT == GDT_UInt16;
+        case NC_INT:
+            return eDT == GDT_Int32 || eDT == GDT_UInt32;
+        case NC_FLOAT:
+            return eDT == GDT_Float32;
+        case NC_DOUBLE:
+            return eDT == GDT_Float64;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            GetVarNDims()                             */
+/************************************************************************/
+
+int netCDFClassicReader::GetVarNDims(int nVarId) const
+{
+    if (nVarId < 0 || static_cast<size_t>(nVarId) >= m_aoVars.size())
+        return 0;
+    return static_cast<int>(m_aoVars[nVarId].anDimSizes.size());
+}
+
+/************************************************************************/
+/*                              ReadVara()                              */
+/************************************************************************/
+
+bool netCDFClassicReader::ReadVara(int nVarId, const size_t *panStart,
+                                   const size_t *panEdge, void *pBuffer)
+{
+    if (nVarId < 0 || static_cast<size_t>(nVarId) >= m_aoVars.size())
+        return false;
+    const Variable &oVar = m_aoVars[nVarId];
+    const int nDims = static_cast<int>(oVar.anDimSizes.size());
+    if (nDims == 0)
+        return false;
+
+    // Validate the request and compute the byte stride of each dimension
+    std::vector<uint64_t> anStrides(nDims);
+    uint64_t nStride = oVar.nTypeSize;
+    size_t nElts = 1;
+    for (int i = nDims - 1; i >= 0; --i)
+    {
+        const bool bRecordDim = (i == 0 && oVar.bIsRecord);
+        const uint64_t nDimSize = bRecordDim ? m_nNumRecs : oVar.anDimSizes[i];
+        if (panStart[i] > nDimSize || panEdge[i] > nDimSize - panStart[i])
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "netCDF direct read: request out of variable extent");
+            return false;
+        }
+        if (bRecordDim)
+        {
+            anStrides[i] = m_nRecSize;
+        }
+        else
+        {
+            anStrides[i] = nStride;
+            nStride *= nDimSize;
+        }
+        nElts *= panEdge[i];
+    }
+    if (nElts == 0)
+        return true;
+
+    // Find the outermost dimension of the largest run of contiguous values.
+    // Values of a record variable are never contiguous across records.
+    int iRunDim = nDims - 1;
+    size_t nRunElts = panEdge[iRunDim];
+    if (oVar.bIsRecord && nDims == 1)
+    {
+        iRunDim = 1;
+        nRunElts = 1;
+    }
+    else
+    {
+        while (iRunDim > (oVar.bIsRecord ? 1 : 0) &&
+               panEdge[iRunDim] == oVar.anDimSizes[iRunDim])
+        {
+            --iRunDim;
+            nRunElts *= panEdge[iRunDim];
+        }
+    }
+    const size_t nRunBytes = nRunElts * oVar.nTypeSize;
+
+    GByte *pabyDst = static_cast<GByte *>(pBuffer);
+    std::vector<size_t> anIdx(iRunDim);
+    while (true)
+    {
+        uint64_t nOffset = oVar.nBegin;
+        for (int i = 0; i < iRunDim; ++i)
+            nOffset += (panStart[i] + anIdx[i]) * anStrides[i];
+        if (iRunDim < nDims)
+            nOffset += panStart[iRunDim] * anStrides[iRunDim];
+        if (VSIFSeekL(m_fp, nOffset, SEEK_SET) != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "netCDF direct read: cannot seek to offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(nOffset));
+            return false;
+        }
+        // Like the netCDF library, consider that data beyond the end of a
+        // truncated file is zero.
+        const size_t nRead = VSIFReadL(pabyDst, 1, nRunBytes, m_fp);
+        if (nRead < nRunBytes)
+            memset(pabyDst + nRead, 0, nRunBytes - nRead);
+        pabyDst += nRunBytes;
+
+        int i = iRunDim - 1;
+        for (; i >= 0; --i)
+        {
+            if (++anIdx[i] < panEdge[i])
+                break;
+            anIdx[i] = 0;
+        }
+        if (i < 0)
+            break;
+    }
+
+#ifdef CPL_LSB
+    if (oVar.nTypeSize > 1)
+        GDALSwapWordsEx(pBuffer, oVar.nTypeSize, nElts, oVar.nTypeSize);
+#endif
+
+    return true;
+}
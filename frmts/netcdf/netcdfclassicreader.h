@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reader of netCDF classic (CDF-1/CDF-2) variables
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef NETCDFCLASSICREADER_H_INCLUDED_
+#define NETCDFCLASSICREADER_H_INCLUDED_
+
+#include "cpl_vsi.h"
+#include "gdal.h"
+#include "netcdf.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                         netCDFClassicReader                          */
+/************************************************************************/
+
+/** Reads hyperslabs of variables of netCDF classic (CDF-1) and 64-bit offset
+ * (CDF-2) files, by decoding the file header and issuing range reads through
+ * the VSI API. This does not go through the netCDF library, and thus does not
+ * need the global netCDF mutex.
+ *
+ * An instance is not thread-safe: callers must serialize accesses to it.
+ */
+class netCDFClassicReader
+{
+    struct Variable
+    {
+        nc_type eType = NC_NAT;
+        int nTypeSize = 0;
+        bool bIsRecord = false;
+        std::vector<uint64_t> anDimSizes{};
+        uint64_t nBegin = 0;
+    };
+
+    VSILFILE *m_fp = nullptr;
+    std::vector<Variable> m_aoVars{};
+    uint64_t m_nRecSize = 0;
+    uint64_t m_nNumRecs = 0;
+
+    netCDFClassicReader() = default;
+    netCDFClassicReader(const netCDFClassicReader &) = delete;
+    netCDFClassicReader &operator=(const netCDFClassicReader &) = delete;
+
+    bool ParseHeader();
+
+  public:
+    ~netCDFClassicReader();
+
+    static std::unique_ptr<netCDFClassicReader>
+    Open(const std::string &osFilename);
+
+    /** Return whether variable nVarId can be read into a buffer of
+     * type eDT without any value conversion. */
+    bool IsCompatible(int nVarId, GDALDataType eDT) const;
+
+    int GetVarNDims(int nVarId) const;
+
+    /** Read the hyperslab defined by panStart and panEdge, in C order,
+     * into pBuffer, with values in native byte order. */
+    bool ReadVara(int nVarId, const size_t *panStart, const size_t *panEdge,
+                  void *pBuffer);
+};
+
+#endif  // NETCDFCLASSICREADER_H_INCLUDED_
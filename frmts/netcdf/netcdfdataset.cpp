@@ -224,7 +224,11 @@ class netCDFRasterBand final : public GDALPamRasterBand
                       size_t nTmpBlockYSize, bool bCheckIsNan = false);
     void SetBlockSize();
 
-    bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
+    bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage,
+                          netCDFClassicReader *poClassicReader);
+    void CheckDataFromClassicReader(void *pImage, void *pImageNC,
+                                    size_t nTmpBlockXSize,
+                                    size_t nTmpBlockYSize);
 
     void SetNoDataValueNoUpdate(double dfNoData);
     void SetNoDataValueNoUpdate(int64_t nNoData);
@@ -2272,7 +2276,8 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
 /************************************************************************/
 
 bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
-                                        void *pImage)
+                                        void *pImage,
+                                        netCDFClassicReader *poClassicReader)
 {
     size_t start[MAX_NC_DIMS] = {};
     size_t edge[MAX_NC_DIMS] = {};
@@ -2297,7 +2302,10 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
 #endif
 
     int nd = 0;
-    nc_inq_varndims(cdfid, nZId, &nd);
+    if (poClassicReader)
+        nd = poClassicReader->GetVarNDims(nZId);
+    else
+        nc_inq_varndims(cdfid, nZId, &nd);
     if (nd == 3)
     {
         start[panBandZPos[0]] = nLevel;  // z
@@ -2338,7 +2346,8 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
 
     // Make sure we are in data mode.
-    static_cast<netCDFDataset *>(poDS)->SetDefineMode(false);
+    if (!poClassicReader)
+        static_cast<netCDFDataset *>(poDS)->SetDefineMode(false);
 
     // If this block is not a full block in the x axis, we need to
     // re-arrange the data because partial blocks are not arranged the
@@ -2353,6 +2362,15 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
                     (GDALGetDataTypeSize(eDataType) / 8));
     }
 
+    if (poClassicReader)
+    {
+        if (!poClassicReader->ReadVara(nZId, start, edge, pImageNC))
+            return false;
+        CheckDataFromClassicReader(pImage, pImageNC, edge[nBandXPos],
+                                   nYChunkSize);
+        return true;
+    }
+
     // Read data according to type.
     int status;
     if (eDataType == GDT_Byte)
@@ -2507,6 +2525,89 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     return true;
 }
 
+/************************************************************************/
+/*                     CheckDataFromClassicReader()                     */
+/************************************************************************/
+
+void netCDFRasterBand::CheckDataFromClassicReader(void *pImage, void *pImageNC,
+                                                  size_t nTmpBlockXSize,
+                                                  size_t nTmpBlockYSize)
+{
+    // netCDFClassicReader::IsCompatible() guarantees that eDataType has the
+    // same size as the type of the variable.
+    switch (eDataType)
+    {
+        case GDT_Byte:
+            if (bSignedData)
+                CheckData<signed char>(pImage, pImageNC, nTmpBlockXSize,
+                                       nTmpBlockYSize, false);
+            else
+                CheckData<unsigned char>(pImage, pImageNC, nTmpBlockXSize,
+                                         nTmpBlockYSize, false);
+            break;
+        case GDT_Int8:
+            CheckData<signed char>(pImage, pImageNC, nTmpBlockXSize,
+                                   nTmpBlockYSize, false);
+            break;
+        case GDT_Int16:
+            CheckData<GInt16>(pImage, pImageNC, nTmpBlockXSize,
+                              nTmpBlockYSize, false);
+            break;
+        case GDT_UInt16:
+            CheckData<GUInt16>(pImage, pImageNC, nTmpBlockXSize,
+                               nTmpBlockYSize, false);
+            break;
+        case GDT_Int32:
+            CheckData<GInt32>(pImage, pImageNC, nTmpBlockXSize,
+                              nTmpBlockYSize, false);
+            break;
+        case GDT_UInt32:
+            CheckData<GUInt32>(pImage, pImageNC, nTmpBlockXSize,
+                               nTmpBlockYSize, false);
+            break;
+        case GDT_Float32:
+            CheckData<float>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                             true);
+            break;
+        case GDT_Float64:
+            CheckData<double>(pImage, pImageNC, nTmpBlockXSize,
+                              nTmpBlockYSize, true);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                         GetClassicReader()                           */
+/************************************************************************/
+
+netCDFClassicReader *netCDFDataset::GetClassicReader()
+{
+    if (!m_bClassicReaderInitDone)
+    {
+        m_bClassicReaderInitDone = true;
+        // Files opened in update mode are accessed through the buffers of
+        // the netCDF library, which the direct reader would not see.
+        if (eAccess == GA_ReadOnly &&
+            (eFormat == NCDF_FORMAT_NC || eFormat == NCDF_FORMAT_NC2) &&
+            !STARTS_WITH(osFilename, "http://") &&
+            !STARTS_WITH(osFilename, "https://") &&
+            CPLTestBool(CPLGetConfigOption("GDAL_NETCDF_DIRECT_READ", "YES")))
+        {
+            m_poClassicReader = netCDFClassicReader::Open(osFilename);
+            if (!m_poClassicReader)
+            {
+                CPLDebug("GDAL_netCDF",
+                         "Cannot use direct reader of classic format on %s",
+                         osFilename.c_str());
+            }
+        }
+    }
+    return m_poClassicReader.get();
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -2515,7 +2616,19 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+
+    // Variables of classic files can be read without the netCDF library.
+    // Only a lock on the dataset is then needed, so that reads of different
+    // files can proceed concurrently.
+    std::lock_guard<std::mutex> oClassicReaderLock(
+        poGDS->m_oClassicReaderMutex);
+    netCDFClassicReader *poClassicReader = poGDS->GetClassicReader();
+    if (poClassicReader && !poClassicReader->IsCompatible(nZId, eDataType))
+        poClassicReader = nullptr;
+    std::unique_ptr<CPLMutexHolder> poNCMutexHolder;
+    if (!poClassicReader)
+        poNCMutexHolder = std::make_unique<CPLMutexHolder>(&hNCMutex);
 
     // Locate X, Y and Z position in the array.
 
@@ -2525,7 +2638,6 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     // Check y order.
     if (nBandYPos >= 0)
     {
-        auto poGDS = static_cast<netCDFDataset *>(poDS);
         if (poGDS->bBottomUp)
         {
             if (nBlockYSize == 1)
@@ -2566,9 +2678,9 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 if (!firstChunk)
                 {
                     firstChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart,
-                                          nFirstChunkBlock * nBlockYSize,
-                                          firstChunk.get()->data()))
+                    if (!FetchNetcdfChunk(
+                            xstart, nFirstChunkBlock * nBlockYSize,
+                            firstChunk.get()->data(), poClassicReader))
                         return CE_Failure;
                     if (poGDS->poChunkCache)
                         poGDS->poChunkCache->insert(firstKey, firstChunk);
@@ -2576,8 +2688,9 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 if (!secondChunk && firstKey != secondKey)
                 {
                     secondChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart, nLastChunkBlock * nBlockYSize,
-                                          secondChunk.get()->data()))
+                    if (!FetchNetcdfChunk(
+                            xstart, nLastChunkBlock * nBlockYSize,
+                            secondChunk.get()->data(), poClassicReader))
                         return CE_Failure;
                     if (poGDS->poChunkCache)
                         poGDS->poChunkCache->insert(secondKey, secondChunk);
@@ -2621,7 +2734,9 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
-    return FetchNetcdfChunk(xstart, ystart, pImage) ? CE_None : CE_Failure;
+    return FetchNetcdfChunk(xstart, ystart, pImage, poClassicReader)
+               ? CE_None
+               : CE_Failure;
 }
 
 /************************************************************************/
@@ -2931,6 +3046,8 @@ CPLErr netCDFDataset::Close()
         if (fpVSIMEM)
             VSIFCloseL(fpVSIMEM);
 
+        m_poClassicReader.reset();
+
 #ifdef ENABLE_NCDUMP
         if (bFileToDestroyAtClosing)
             VSIUnlink(osFilename);
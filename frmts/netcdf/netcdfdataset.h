@@ -20,6 +20,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "netcdf.h"
+#include "netcdfclassicreader.h"
 #include "netcdfformatenum.h"
 #include "netcdfsg.h"
 #include "netcdfsgwriterutil.h"
@@ -469,6 +471,15 @@ class netCDFDataset final : public GDALPamDataset
 
     std::unique_ptr<ChunkCacheType> poChunkCache;
 
+    // Reader of classic files that bypasses the netCDF library, and thus
+    // hNCMutex. m_oClassicReaderMutex must be held while using it, as well
+    // as poChunkCache when it is used.
+    std::mutex m_oClassicReaderMutex{};
+    bool m_bClassicReaderInitDone = false;
+    std::unique_ptr<netCDFClassicReader> m_poClassicReader{};
+
+    netCDFClassicReader *GetClassicReader();
+
     static double rint(double);
 
     double FetchCopyParam(const char *pszGridMappingValue, const char *pszParam,
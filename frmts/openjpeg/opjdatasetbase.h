@@ -13,6 +13,9 @@
 
 #include <limits>
 #include <algorithm>
+#include <list>
+#include <memory>
+#include <utility>
 
 /* This file is to be used with openjpeg 2.1 or later */
 #ifdef __clang__
@@ -219,6 +222,8 @@ struct OPJCodecWrapper
     {
         pCodec = rhs->pCodec;
         rhs->pCodec = nullptr;
+        pStream = rhs->pStream;
+        rhs->pStream = nullptr;
         psImage = rhs->psImage;
         rhs->psImage = nullptr;
         psJP2File = rhs->psJP2File;
@@ -749,11 +754,21 @@ struct OPJCodecWrapper
 /* ==================================================================== */
 /************************************************************************/
 
+/* Codecs of a single-tiled image, one per resolution level, kept between
+ * requests so that libopenjp2 reuses the tile codestream it has ingested and
+ * the code-blocks it has already decoded. Shared by the full resolution
+ * dataset and its overviews, most recently used first.
+ */
+struct JP2OPJCachedCodecs
+{
+    static constexpr size_t MAX_LEVELS = 2;
+    std::list<std::pair<int, std::unique_ptr<OPJCodecWrapper>>> oList{};
+};
+
 struct JP2OPJDatasetBase : public JP2DatasetBase
 {
     int eColorSpace = OPJCodecWrapper::cvtenum(JP2_CLRSPC_UNKNOWN);
-    OPJCodecWrapper *m_codec = nullptr;
-    int *m_pnLastLevel = nullptr;
+    std::shared_ptr<JP2OPJCachedCodecs> m_poCachedCodecs{};
     bool m_bStrict = true;
 
     void init(void)
@@ -781,23 +796,21 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
             return CE_Failure;
         }
 
-        if (m_codec && CPLTestBool(CPLGetConfigOption(
-                           "USE_OPENJPEG_SINGLE_TILE_OPTIM", "YES")))
+        if (m_poCachedCodecs && CPLTestBool(CPLGetConfigOption(
+                                    "USE_OPENJPEG_SINGLE_TILE_OPTIM", "YES")))
         {
-            if ((*m_pnLastLevel == -1 || *m_pnLastLevel == iLevel) &&
-                codec->pCodec != nullptr && *codec->pStream != nullptr &&
-                m_codec->psImage != nullptr)
+            // Resume from the codec used by previous requests at this level
+            auto &oList = m_poCachedCodecs->oList;
+            for (auto oIter = oList.begin(); oIter != oList.end(); ++oIter)
             {
-                codec->transfer(m_codec);
-            }
-            else
-            {
-                // For some reason, we need to "reboot" all the machinery if
-                // changing of overview level. Should be fixed in openjpeg
-                m_codec->free();
+                if (oIter->first == iLevel)
+                {
+                    codec->transfer(oIter->second.get());
+                    oList.erase(oIter);
+                    break;
+                }
             }
         }
-        *m_pnLastLevel = iLevel;
 
         if (codec->pCodec == nullptr)
         {
@@ -831,17 +844,9 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
                 opj_decoder_set_strict_mode(codec->pCodec, false);
             }
 #endif
-            if (m_codec && m_codec->psJP2File)
-            {
-                codec->pStream = OPJCodecWrapper::CreateReadStream(
-                    m_codec->psJP2File, nCodeStreamLength);
-            }
-            else
-            {
-                codec->open(fpIn, nCodeStreamStart);
-                codec->pStream = OPJCodecWrapper::CreateReadStream(
-                    codec->psJP2File, nCodeStreamLength);
-            }
+            codec->open(fpIn, nCodeStreamStart);
+            codec->pStream = OPJCodecWrapper::CreateReadStream(
+                codec->psJP2File, nCodeStreamLength);
             if (!codec->pStream)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -935,35 +940,35 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
         return CE_None;
     }
 
-    void cache(CPL_UNUSED JP2OPJDatasetBase *rhs)
+    // Share the cached codecs of the full resolution dataset
+    void cache(JP2OPJDatasetBase *rhs)
     {
-        // prevent linter from treating this as potential static method
-        (void)this;
-        if (m_codec && rhs)
-            m_codec->transfer(rhs->m_codec);
+        if (rhs)
+            m_poCachedCodecs = rhs->m_poCachedCodecs;
     }
 
-    void cacheNew(CPL_UNUSED OPJCodecWrapper *codec)
+    void cacheNew(void)
     {
-        // prevent linter from treating this as potential static method
-        (void)this;
-        if (!codec)
-            return;
-        if (m_codec)
-            m_codec = new OPJCodecWrapper(codec);
+        m_poCachedCodecs = std::make_shared<JP2OPJCachedCodecs>();
     }
 
-    void cache(CPL_UNUSED OPJCodecWrapper *codec)
+    void cache(OPJCodecWrapper *codec, bool bSuccess)
     {
-        // prevent linter from treating this as potential static method
-        (void)this;
         if (!codec)
             return;
 
-        if (m_codec && CPLTestBool(CPLGetConfigOption(
-                           "USE_OPENJPEG_SINGLE_TILE_OPTIM", "YES")))
+        if (bSuccess && codec->pCodec != nullptr && m_poCachedCodecs &&
+            CPLTestBool(CPLGetConfigOption("USE_OPENJPEG_SINGLE_TILE_OPTIM",
+                                           "YES")))
         {
-            codec->transfer(m_codec);
+            auto poCached = std::make_unique<OPJCodecWrapper>();
+            poCached->transfer(codec);
+            auto &oList = m_poCachedCodecs->oList;
+            oList.emplace_front(iLevel, std::move(poCached));
+            // Each codec holds the tile codestream and its decoded
+            // code-blocks, so only keep a few of them
+            while (oList.size() > JP2OPJCachedCodecs::MAX_LEVELS)
+                oList.pop_back();
         }
         else
         {
@@ -975,27 +980,16 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
     {
         // prevent linter from treating this as potential static method
         (void)this;
-        if (bSingleTiled && bUseSetDecodeArea)
-        {
-            // nothing
-        }
-        else
-        {
-            if (codec)
-                codec->free();
-        }
+        if (codec)
+            codec->free();
     }
 
     void closeJP2(void)
     {
-        // prevent linter from treating this as potential static method
-        (void)this;
-        if (iLevel == 0)
-        {
-            if (m_codec)
-                m_codec->free();
-            delete m_pnLastLevel;
-            m_pnLastLevel = nullptr;
-        }
+        // The cached codecs reference the file handle, closed with the full
+        // resolution dataset
+        if (iLevel == 0 && m_poCachedCodecs)
+            m_poCachedCodecs->oList.clear();
+        m_poCachedCodecs.reset();
     }
 };
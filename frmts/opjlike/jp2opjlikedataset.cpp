@@ -690,7 +690,7 @@ CPLErr JP2OPJLikeDataset<CODEC, BASE>::ReadBlock(int nBand, VSILFILE *fpIn,
     }
 
 end:
-    this->cache(&localctx);
+    this->cache(&localctx, eErr == CE_None);
 
     return eErr;
 }
@@ -1725,9 +1725,8 @@ GDALDataset *JP2OPJLikeDataset<CODEC, BASE>::Open(GDALOpenInfo *poOpenInfo)
 
     if (poDS->bSingleTiled && poDS->bUseSetDecodeArea)
     {
-        poDS->cacheNew(&localctx);
+        poDS->cacheNew();
     }
-    poDS->m_pnLastLevel = new int(-1);
 
     while (
         poDS->nOverviewCount + 1 < numResolutions && (nW > 128 || nH > 128) &&
@@ -1778,7 +1777,6 @@ GDALDataset *JP2OPJLikeDataset<CODEC, BASE>::Open(GDALOpenInfo *poOpenInfo)
         {
             poODS->cache(poDS);
         }
-        poODS->m_pnLastLevel = poDS->m_pnLastLevel;
         poODS->m_bStrict = poDS->m_bStrict;
 
         poODS->m_nX0 = poDS->m_nX0;
@@ -60,16 +60,8 @@ struct JP2DatasetBase
         if (nThreads >= 1)
             return nThreads;
 
-        const char *pszThreads =
-            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
-        if (EQUAL(pszThreads, "ALL_CPUS"))
-            nThreads = CPLGetNumCPUs();
-        else
-            nThreads = atoi(pszThreads);
-        if (nThreads > 128)
-            nThreads = 128;
-        if (nThreads <= 0)
-            nThreads = 1;
+        nThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
         return nThreads;
     }
 
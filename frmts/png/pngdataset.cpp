@@ -115,6 +115,11 @@ PNGRasterBand::PNGRasterBand(PNGDataset *poDSIn, int nBandIn)
 CPLErr PNGRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
 
 {
+    PNGDataset *poGDS = cpl::down_cast<PNGDataset *>(poDS);
+
+    // Scanlines are decoded sequentially
+    std::lock_guard<std::recursive_mutex> oLock(poGDS->m_oReadBlockMutex);
+
 #ifdef ENABLE_WHOLE_IMAGE_OPTIMIZATION
     if (nBlockYSize > 1)
     {
@@ -128,7 +133,6 @@ CPLErr PNGRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
     }
 #endif
 
-    PNGDataset *poGDS = cpl::down_cast<PNGDataset *>(poDS);
     int nPixelSize;
     CPLAssert(nBlockXOff == 0);
 
@@ -2096,6 +2100,17 @@ static bool safe_png_set_compression_level(jmp_buf sSetJmpContext,
     return true;
 }
 
+static bool safe_png_set_filter(jmp_buf sSetJmpContext, png_structp png_ptr,
+                                int filters)
+{
+    if (setjmp(sSetJmpContext) != 0)
+    {
+        return false;
+    }
+    png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, filters);
+    return true;
+}
+
 static bool safe_png_set_tRNS(jmp_buf sSetJmpContext, png_structp png_ptr,
                               png_infop info_ptr, png_const_bytep trans,
                               int num_trans, png_color_16p trans_values)
@@ -2310,6 +2325,48 @@ GDALDataset *PNGDataset::CreateCopy(const char *pszFilename,
         }
     }
 
+    // Row filters to consider. By default, libpng does no filtering for
+    // paletted and sub-byte images, and otherwise tries the 5 filters on each
+    // row, which is a significant part of the encoding time.
+    const char *pszFilter = CSLFetchNameValue(papszOptions, "FILTER");
+    if (pszFilter && !EQUAL(pszFilter, "DEFAULT"))
+    {
+        int nFilters = 0;
+        if (EQUAL(pszFilter, "NONE"))
+            nFilters = PNG_FILTER_NONE;
+        else if (EQUAL(pszFilter, "SUB"))
+            nFilters = PNG_FILTER_SUB;
+        else if (EQUAL(pszFilter, "UP"))
+            nFilters = PNG_FILTER_UP;
+        else if (EQUAL(pszFilter, "AVERAGE"))
+            nFilters = PNG_FILTER_AVG;
+        else if (EQUAL(pszFilter, "PAETH"))
+            nFilters = PNG_FILTER_PAETH;
+        else if (EQUAL(pszFilter, "FAST"))
+        {
+            // The cheapest filters to evaluate. AVERAGE and PAETH rarely
+            // bring much on top of them on aerial imagery or map tiles.
+            nFilters = PNG_FILTER_NONE | PNG_FILTER_SUB | PNG_FILTER_UP;
+        }
+        else if (EQUAL(pszFilter, "ALL"))
+            nFilters = PNG_ALL_FILTERS;
+        else
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Illegal FILTER value '%s'.", pszFilter);
+            VSIFCloseL(fpImage);
+            png_destroy_write_struct(&hPNG, &psPNGInfo);
+            return nullptr;
+        }
+
+        if (!safe_png_set_filter(sSetJmpContext, hPNG, nFilters))
+        {
+            VSIFCloseL(fpImage);
+            png_destroy_write_struct(&hPNG, &psPNGInfo);
+            return nullptr;
+        }
+    }
+
     // Try to handle nodata values as a tRNS block (note that for paletted
     // images, we save the effect to apply as part of palette).
     png_color_16 sTRNSColor;
@@ -43,6 +43,7 @@
 #include <csetjmp>
 
 #include <algorithm>
+#include <mutex>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4611)
@@ -92,6 +93,11 @@ class PNGDataset final : public GDALPamDataset
     int nLastLineRead;
     GByte *pabyBuffer;
 
+    // Serializes PNGRasterBand::IReadBlock(), as the driver declares
+    // GDAL_DCAP_CONCURRENT_READ_BLOCK. Recursive since reading a block of
+    // a band loads the blocks of the other bands.
+    std::recursive_mutex m_oReadBlockMutex{};
+
     GDALColorTable *poColorTable;
 
     int bGeoTransformValid;
@@ -53,6 +53,17 @@ void PNGDriverSetCommonMetadata(GDALDriver *poDriver)
         "file' default='FALSE'/>\n"
         "   <Option name='ZLEVEL' type='int' description='DEFLATE compression "
         "level 1-9' default='6'/>\n"
+        "   <Option name='FILTER' type='string-select' description='Row "
+        "filters to consider' default='DEFAULT'>\n"
+        "       <Value>DEFAULT</Value>\n"
+        "       <Value>NONE</Value>\n"
+        "       <Value>SUB</Value>\n"
+        "       <Value>UP</Value>\n"
+        "       <Value>AVERAGE</Value>\n"
+        "       <Value>PAETH</Value>\n"
+        "       <Value>FAST</Value>\n"
+        "       <Value>ALL</Value>\n"
+        "   </Option>\n"
         "   <Option name='SOURCE_ICC_PROFILE' type='string' description='ICC "
         "Profile'/>\n"
         "   <Option name='SOURCE_ICC_PROFILE_NAME' type='string' "
@@ -79,8 +90,10 @@ void PNGDriverSetCommonMetadata(GDALDriver *poDriver)
         "</CreationOptionList>\n");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_CONCURRENT_READ_BLOCK, "YES");
 
     poDriver->pfnIdentify = PNGDriverIdentify;
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES, "89504E470D0A1A0A");
     poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
 }
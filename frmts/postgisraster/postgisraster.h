@@ -25,6 +25,7 @@
 #include "cpl_quad_tree.h"
 #include <float.h>
 #include <map>
+#include <mutex>
 
 // #define DEBUG_VERBOSE
 // #define DEBUG_QUERY
@@ -251,6 +252,9 @@ class PostGISRasterDataset final : public VRTDataset
     lru11::Cache<std::string, std::shared_ptr<GDALDataset>> oOutDBDatasetCache{
         8, 0};
     lru11::Cache<std::string, bool> oOutDBFilenameUsable{100, 0};
+    // Protects oOutDBDatasetCache and the datasets it holds, when tiles are
+    // cached by several threads
+    std::mutex m_oOutDBMutex{};
 
     GBool ConstructOneDatasetFromTiles(PGresult *);
     GBool YieldSubdatasets(PGresult *, const char *);
@@ -271,7 +275,8 @@ class PostGISRasterDataset final : public VRTDataset
 
     PostGISRasterTileDataset *GetMatchingSourceRef(const char *pszPKID)
     {
-        return oMapPKIDToRTDS[pszPKID];
+        const auto oIter = oMapPKIDToRTDS.find(pszPKID);
+        return oIter != oMapPKIDToRTDS.end() ? oIter->second : nullptr;
     }
 
     PostGISRasterTileDataset *GetMatchingSourceRef(double dfUpperLeftX,
@@ -319,8 +324,11 @@ class PostGISRasterDataset final : public VRTDataset
     GBool LoadSources(int nXOff, int nYOff, int nXSize, int nYSize, int nBand);
     GBool PolygonFromCoords(int nXOff, int nYOff, int nXEndOff, int nYEndOff,
                             double adfProjWin[8]);
-    void CacheTile(const char *pszMetadata, const char *pszRaster,
-                   const char *pszPKID, int nBand, bool bAllBandCaching);
+    void CacheTile(const char *pszMetadata, const GByte *pabyWKB,
+                   int nWKBLength, const char *pszPKID, int nBand,
+                   bool bAllBandCaching);
+    void CacheTiles(PGresult *poResult, bool bBinaryRaster, int nBand,
+                    bool bAllBandCaching);
 };
 
 /***********************************************************************
@@ -20,6 +20,10 @@
 #include "postgisrasterdrivercore.h"
 #include <math.h>
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
 #include <algorithm>
 #include <memory>
 
@@ -858,8 +862,9 @@ PostGISRasterDataset::GetMatchingSourceRef(double dfUpperLeftX,
 /*                           CacheTile()                                */
 /************************************************************************/
 void PostGISRasterDataset::CacheTile(const char *pszMetadata,
-                                     const char *pszRaster, const char *pszPKID,
-                                     int nBand, bool bAllBandCaching)
+                                     const GByte *pabyWKB, int nWKBLength,
+                                     const char *pszPKID, int nBand,
+                                     bool bAllBandCaching)
 {
     /**
      * Get metadata record and unpack it
@@ -898,19 +903,7 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
         nTileXSize * nTileYSize * nBandDataTypeSize;
     const int nExpectedBands = bAllBandCaching ? GetRasterCount() : 1;
 
-    int nWKBLength = 0;
-
-    struct CPLFreer
-    {
-        void operator()(GByte *x) const
-        {
-            CPLFree(x);
-        }
-    };
-
-    std::unique_ptr<GByte, CPLFreer> pbyDataAutoFreed(
-        CPLHexToBinary(pszRaster, &nWKBLength));
-    GByte *pbyData = pbyDataAutoFreed.get();
+    const GByte *pbyData = pabyWKB;
     const int nMinimumWKBLength =
         RASTER_HEADER_SIZE + BAND_SIZE(1, nBandDataTypeSize) * nExpectedBands;
     if (nWKBLength < nMinimumWKBLength)
@@ -975,15 +968,9 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
                 return;
             }
 
-            GByte *pbyDataToRead = pbyData + nCurOffset;
+            const GByte *pbyDataToRead = pbyData + nCurOffset;
             nCurOffset += nExpectedBandDataSize;
 
-            if (bSwap && nBandDataTypeSize > 1)
-            {
-                GDALSwapWords(pbyDataToRead, nBandDataTypeSize,
-                              nTileXSize * nTileYSize, nBandDataTypeSize);
-            }
-
             /**
              * Manually add each tile data to the cache of the
              * matching PostGISRasterTileRasterBand.
@@ -995,6 +982,12 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
                 memcpy(poBlock->GetDataRef(), pbyDataToRead,
                        nExpectedBandDataSize);
 
+                if (bSwap && nBandDataTypeSize > 1)
+                {
+                    GDALSwapWords(poBlock->GetDataRef(), nBandDataTypeSize,
+                                  nTileXSize * nTileYSize, nBandDataTypeSize);
+                }
+
                 poBlock->DropLock();
             }
         }
@@ -1027,6 +1020,74 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
     }
 }
 
+/************************************************************************/
+/*                           CacheTiles()                               */
+/************************************************************************/
+
+// Cache the tiles of the rows of poResult, whose columns are the PKID, the
+// metadata and the raster. The raster is a bytea if bBinaryRaster is true,
+// which requires poResult to be in binary format, and hex-encoded WKB
+// otherwise. With GDAL_NUM_THREADS, rows are decoded by jobs of the global
+// thread pool, whose errors are replayed in the calling thread.
+void PostGISRasterDataset::CacheTiles(PGresult *poResult, bool bBinaryRaster,
+                                      int nBand, bool bAllBandCaching)
+{
+    const int nTuples = PQntuples(poResult);
+    const auto CacheRow =
+        [this, poResult, bBinaryRaster, nBand, bAllBandCaching](int i)
+    {
+        const char *pszPKID = PQgetvalue(poResult, i, 0);
+        const char *pszMetadata = PQgetvalue(poResult, i, 1);
+        const char *pszRaster = PQgetvalue(poResult, i, 2);
+        if (bBinaryRaster)
+        {
+            CacheTile(pszMetadata, reinterpret_cast<const GByte *>(pszRaster),
+                      PQgetlength(poResult, i, 2), pszPKID, nBand,
+                      bAllBandCaching);
+        }
+        else
+        {
+            int nWKBLength = 0;
+            GByte *pabyWKB = CPLHexToBinary(pszRaster, &nWKBLength);
+            CacheTile(pszMetadata, pabyWKB, nWKBLength, pszPKID, nBand,
+                      bAllBandCaching);
+            CPLFree(pabyWKB);
+        }
+    };
+
+    const int nThreads = std::min(
+        nTuples,
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128));
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    CPLErrorAccumulator oErrorAccumulator;
+    for (int i = 0; i < nTuples; i++)
+    {
+        if (poJobQueue)
+        {
+            poJobQueue->SubmitJob(
+                [&CacheRow, &oErrorAccumulator, i]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    CacheRow(i);
+                });
+        }
+        else
+        {
+            CacheRow(i);
+        }
+    }
+    if (poJobQueue)
+    {
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+}
+
 bool PostGISRasterDataset::LoadOutdbRaster(int &nCurOffset, GDALDataType eDT,
                                            int nBand, const GByte *pbyData,
                                            int nWKBLength, void *pImage,
@@ -1069,6 +1130,7 @@ bool PostGISRasterDataset::LoadOutdbRaster(int &nCurOffset, GDALDataType eDT,
     CPLDebug("PostGIS_Raster", "Band %d: GDAL outdb band=%d %s", nBand,
              nOutdbBandNumber, osPath.c_str());
 #endif
+    std::lock_guard<std::mutex> oLock(m_oOutDBMutex);
     std::shared_ptr<GDALDataset> poDS;
     if (!oOutDBDatasetCache.tryGet(osPath, poDS))
     {
@@ -1314,6 +1376,7 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
         CPLString osCommand;
         osCommand.Printf("SELECT %s, ST_Metadata(%s)",
                          osPrimaryKeyNameI.c_str(), osColumnI.c_str());
+        bool bBinaryRaster = false;
         if (bLoadRasters)
         {
             CPLString orRasterToFetch;
@@ -1329,8 +1392,12 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
             if (eOutDBResolution == OutDBResolution::SERVER_SIDE ||
                 !bCanUseClientSide)
             {
-                orRasterToFetch =
-                    "encode(ST_AsBinary(" + orRasterToFetch + ",TRUE),'hex')";
+                // Fetched as a bytea in a binary format result, so that
+                // the data is neither hex-encoded nor decoded.
+                orRasterToFetch = "ST_AsBinary(" + orRasterToFetch + ",TRUE)";
+                osCommand.Printf("SELECT %s::text, ST_Metadata(%s)::text",
+                                 osPrimaryKeyNameI.c_str(), osColumnI.c_str());
+                bBinaryRaster = true;
             }
             osCommand += ", " + orRasterToFetch;
         }
@@ -1342,7 +1409,10 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
             osCommand += osWHERE;
         }
 
-        poResult = PQexec(poConn, osCommand.c_str());
+        poResult = bBinaryRaster
+                       ? PQexecParams(poConn, osCommand.c_str(), 0, nullptr,
+                                      nullptr, nullptr, nullptr, 1)
+                       : PQexec(poConn, osCommand.c_str());
 
 #ifdef DEBUG_QUERY
         CPLDebug("PostGIS_Raster",
@@ -1390,15 +1460,11 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
                     CPLQuadTreeInsert(hQuadTree, poRTDS);
                 }
             }
-
-            if (bLoadRasters && poRTDS != nullptr)
-            {
-                const char *pszRaster = PQgetvalue(poResult, i, 2);
-                CacheTile(pszMetadata, pszRaster, pszPKID, nBand,
-                          bAllBandCaching);
-            }
         }
 
+        if (bLoadRasters)
+            CacheTiles(poResult, bBinaryRaster, nBand, bAllBandCaching);
+
         PQclear(poResult);
     }
 
@@ -507,25 +507,46 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
             osRasterToFetch = osColumnI;
         else
             osRasterToFetch.Printf("ST_Band(%s, %d)", osColumnI.c_str(), nBand);
-        if (poRDS->eOutDBResolution == OutDBResolution::SERVER_SIDE ||
-            !bCanUseClientSide)
+        // In server-side mode, the raster is fetched as a bytea in a binary
+        // format result, so that the data is neither hex-encoded nor decoded.
+        const bool bBinaryRaster =
+            poRDS->eOutDBResolution == OutDBResolution::SERVER_SIDE ||
+            !bCanUseClientSide;
+        if (bBinaryRaster)
         {
-            osRasterToFetch =
-                "encode(ST_AsBinary(" + osRasterToFetch + ",TRUE),'hex')";
+            osRasterToFetch = "ST_AsBinary(" + osRasterToFetch + ",TRUE)";
         }
 
         CPLString osCommand;
-        osCommand.Printf("SELECT %s, ST_Metadata(%s), %s FROM %s.%s",
-                         (poRDS->GetPrimaryKeyRef()) ? poRDS->GetPrimaryKeyRef()
-                                                     : "NULL",
-                         osColumnI.c_str(), osRasterToFetch.c_str(),
-                         osSchemaI.c_str(), osTableI.c_str());
+        if (bBinaryRaster)
+        {
+            osCommand.Printf("SELECT %s::text, ST_Metadata(%s)::text, %s "
+                             "FROM %s.%s",
+                             (poRDS->GetPrimaryKeyRef())
+                                 ? poRDS->GetPrimaryKeyRef()
+                                 : "NULL",
+                             osColumnI.c_str(), osRasterToFetch.c_str(),
+                             osSchemaI.c_str(), osTableI.c_str());
+        }
+        else
+        {
+            osCommand.Printf("SELECT %s, ST_Metadata(%s), %s FROM %s.%s",
+                             (poRDS->GetPrimaryKeyRef())
+                                 ? poRDS->GetPrimaryKeyRef()
+                                 : "NULL",
+                             osColumnI.c_str(), osRasterToFetch.c_str(),
+                             osSchemaI.c_str(), osTableI.c_str());
+        }
         if (!osWHERE.empty())
         {
             osCommand += " WHERE " + osWHERE;
         }
 
-        PGresult *poResult = PQexec(poRDS->poConn, osCommand.c_str());
+        PGresult *poResult =
+            bBinaryRaster
+                ? PQexecParams(poRDS->poConn, osCommand.c_str(), 0, nullptr,
+                               nullptr, nullptr, nullptr, 1)
+                : PQexec(poRDS->poConn, osCommand.c_str());
 
 #ifdef DEBUG_QUERY
         CPLDebug("PostGIS_Raster",
@@ -566,15 +587,7 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
         /**
          * Ok, we loop over the results
          **/
-        int nTuples = PQntuples(poResult);
-        for (i = 0; i < nTuples; i++)
-        {
-            const char *pszPKID = PQgetvalue(poResult, i, 0);
-            const char *pszMetadata = PQgetvalue(poResult, i, 1);
-            const char *pszRaster = PQgetvalue(poResult, i, 2);
-            poRDS->CacheTile(pszMetadata, pszRaster, pszPKID, nBand,
-                             bAllBandCaching);
-        }  // All tiles have been added to cache
+        poRDS->CacheTiles(poResult, bBinaryRaster, nBand, bAllBandCaching);
 
         PQclear(poResult);
     }  // End missing tiles
@@ -96,10 +96,13 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
     osRasterToFetch.Printf("ST_Band(%s, %d)", osColumnI.c_str(), nBand);
     // We don't honour CLIENT_SIDE_IF_POSSIBLE since it would be likely too
     // costly in that context.
-    if (poRTDS->poRDS->eOutDBResolution != OutDBResolution::CLIENT_SIDE)
+    // In server-side mode, the raster is fetched as a bytea in a binary
+    // format result, so that the data is neither hex-encoded nor decoded.
+    const bool bBinaryRaster =
+        poRTDS->poRDS->eOutDBResolution != OutDBResolution::CLIENT_SIDE;
+    if (bBinaryRaster)
     {
-        osRasterToFetch =
-            "encode(ST_AsBinary(" + osRasterToFetch + ",TRUE),'hex')";
+        osRasterToFetch = "ST_AsBinary(" + osRasterToFetch + ",TRUE)";
     }
 
     osCommand.Printf("SELECT %s FROM %s.%s WHERE ", osRasterToFetch.c_str(),
@@ -123,7 +126,10 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
                                 osColumnI.c_str(), dfTileUpperLeftY);
     }
 
-    poResult = PQexec(poRTDS->poRDS->poConn, osCommand.c_str());
+    poResult = bBinaryRaster
+                   ? PQexecParams(poRTDS->poRDS->poConn, osCommand.c_str(), 0,
+                                  nullptr, nullptr, nullptr, nullptr, 1)
+                   : PQexec(poRTDS->poRDS->poConn, osCommand.c_str());
 
 #ifdef DEBUG_QUERY
     CPLDebug("PostGIS_Raster",
@@ -164,10 +170,31 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
         }
     };
 
-    std::unique_ptr<GByte, CPLFreer> pbyDataAutoFreed(
-        CPLHexToBinary(PQgetvalue(poResult, 0, 0), &nWKBLength));
-    GByte *pbyData = pbyDataAutoFreed.get();
-    PQclear(poResult);
+    struct PGresultFreer
+    {
+        void operator()(PGresult *x) const
+        {
+            PQclear(x);
+        }
+    };
+
+    // In binary mode, pbyData points to the content of poResult, which must
+    // thus be kept alive until we are done with it.
+    std::unique_ptr<PGresult, PGresultFreer> poResultAutoFreed(poResult);
+    std::unique_ptr<GByte, CPLFreer> pbyDataAutoFreed;
+    const GByte *pbyData = nullptr;
+    if (bBinaryRaster)
+    {
+        pbyData = reinterpret_cast<const GByte *>(PQgetvalue(poResult, 0, 0));
+        nWKBLength = PQgetlength(poResult, 0, 0);
+    }
+    else
+    {
+        pbyDataAutoFreed.reset(
+            CPLHexToBinary(PQgetvalue(poResult, 0, 0), &nWKBLength));
+        pbyData = pbyDataAutoFreed.get();
+        poResultAutoFreed.reset();
+    }
 
     const int nMinimumWKBLength = RASTER_HEADER_SIZE + BAND_SIZE(1, nPixelSize);
     if (nWKBLength < nMinimumWKBLength)
@@ -190,7 +217,7 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
             return CE_Failure;
         }
 
-        GByte *pbyDataToRead =
+        const GByte *pbyDataToRead =
             GET_BAND_DATA(pbyData, 1, nPixelSize, nExpectedDataSize);
 
         // Do byte-swapping if necessary */
@@ -201,13 +228,13 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
         const bool bSwap = bIsLittleEndian;
 #endif
 
+        memcpy(pImage, pbyDataToRead, nExpectedDataSize);
+
         if (bSwap && nPixelSize > 1)
         {
-            GDALSwapWords(pbyDataToRead, nPixelSize, nBlockXSize * nBlockYSize,
+            GDALSwapWords(pImage, nPixelSize, nBlockXSize * nBlockYSize,
                           nPixelSize);
         }
-
-        memcpy(pImage, pbyDataToRead, nExpectedDataSize);
     }
     else
     {
@@ -12,13 +12,17 @@
 
 #include "cpl_json.h"
 #include "cpl_http.h"
+#include "cpl_sha256.h"
+#include "cpl_vsi.h"
 #include "vrtdataset.h"
 #include "ogr_spatialref.h"
 
 #include <algorithm>
+#include <ctime>
 #include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace
 {
@@ -61,6 +65,14 @@ struct Collection
 
 class STACITDataset final : public VRTDataset
 {
+    // Persistent cache of the items returned by a STAC API search, and of
+    // the band characteristics of their assets (CACHE_DIRECTORY open option)
+    std::string m_osCacheFilename{};
+    CPLJSONObject m_oCache{};
+
+    bool LoadCache(GDALOpenInfo *poOpenInfo);
+    void SaveCache();
+
     bool Open(GDALOpenInfo *poOpenInfo);
     bool SetupDataset(GDALOpenInfo *poOpenInfo,
                       const std::string &osSTACITFilename,
@@ -420,6 +432,61 @@ static void ParseAsset(const CPLJSONObject &jAsset,
     assets.assets.emplace_back(item);
 }
 
+/************************************************************************/
+/*                             LoadCache()                              */
+/************************************************************************/
+
+// Load m_osCacheFilename into m_oCache, if it exists and is not older than
+// the CACHE_MAX_AGE open option.
+bool STACITDataset::LoadCache(GDALOpenInfo *poOpenInfo)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(m_osCacheFilename.c_str(), &sStat) != 0)
+        return false;
+    const double dfMaxAge = CPLAtof(CSLFetchNameValueDef(
+        poOpenInfo->papszOpenOptions, "CACHE_MAX_AGE", "86400"));
+    if (static_cast<double>(time(nullptr) - sStat.st_mtime) >= dfMaxAge)
+    {
+        CPLDebug("STACIT", "Ignoring expired cache %s",
+                 m_osCacheFilename.c_str());
+        return false;
+    }
+
+    CPLJSONDocument oDoc;
+    if (!oDoc.Load(m_osCacheFilename))
+        return false;
+    const auto oRoot = oDoc.GetRoot();
+    if (!oRoot.GetArray("features").IsValid())
+        return false;
+    CPLDebug("STACIT", "Using search results from cache %s",
+             m_osCacheFilename.c_str());
+    m_oCache = oRoot;
+    return true;
+}
+
+/************************************************************************/
+/*                             SaveCache()                              */
+/************************************************************************/
+
+void STACITDataset::SaveCache()
+{
+    const std::string osDir = CPLGetPathSafe(m_osCacheFilename.c_str());
+    VSIMkdirRecursive(osDir.c_str(), 0755);
+
+    // Write to a temporary file first, so that concurrent readers never see
+    // a partial cache.
+    const std::string osTmpFilename = m_osCacheFilename + ".tmp";
+    CPLJSONDocument oDoc;
+    oDoc.SetRoot(m_oCache);
+    if (!oDoc.Save(osTmpFilename) ||
+        VSIRename(osTmpFilename.c_str(), m_osCacheFilename.c_str()) != 0)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot write cache file %s",
+                 m_osCacheFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                           SetupDataset()                             */
 /************************************************************************/
@@ -564,15 +631,86 @@ bool STACITDataset::SetupDataset(
         return osRet;
     };
 
+    struct BandInfo
+    {
+        GDALDataType eDT = GDT_Unknown;
+        int bHasNoData = FALSE;
+        double dfNoData = 0;
+        GDALColorInterp eInterp = GCI_Undefined;
+    };
+
+    std::vector<BandInfo> asBandInfo;
     const auto osFirstItemName(BuildVSICurlFilename(items.front().osFilename));
-    auto poItemDS = std::unique_ptr<GDALDataset>(
-        GDALDataset::Open(osFirstItemName.c_str()));
-    if (!poItemDS)
+
+    // Look for the band characteristics of the first item in the cache
+    CPLJSONArray oCachedHeaders;
+    if (!m_osCacheFilename.empty())
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot open %s to retrieve band characteristics",
-                 osFirstItemName.c_str());
-        return false;
+        oCachedHeaders = m_oCache.GetArray("asset_headers");
+        if (!oCachedHeaders.IsValid())
+        {
+            oCachedHeaders = CPLJSONArray();
+            m_oCache.Add("asset_headers", oCachedHeaders);
+        }
+        for (const auto &oHeader : oCachedHeaders)
+        {
+            if (oHeader.GetString("filename") != osFirstItemName)
+                continue;
+            for (const auto &oBand : oHeader.GetArray("bands"))
+            {
+                BandInfo sInfo;
+                sInfo.eDT = GDALGetDataTypeByName(
+                    oBand.GetString("data_type").c_str());
+                const auto osNoData = oBand.GetString("nodata");
+                sInfo.bHasNoData = !osNoData.empty();
+                sInfo.dfNoData = CPLAtof(osNoData.c_str());
+                sInfo.eInterp = GDALGetColorInterpretationByName(
+                    oBand.GetString("color_interpretation").c_str());
+                asBandInfo.push_back(sInfo);
+            }
+            break;
+        }
+    }
+
+    if (asBandInfo.empty())
+    {
+        auto poItemDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osFirstItemName.c_str()));
+        if (!poItemDS)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot open %s to retrieve band characteristics",
+                     osFirstItemName.c_str());
+            return false;
+        }
+
+        CPLJSONArray oCachedBands;
+        for (int i = 0; i < poItemDS->GetRasterCount(); i++)
+        {
+            auto poItemBand = poItemDS->GetRasterBand(i + 1);
+            BandInfo sInfo;
+            sInfo.eDT = poItemBand->GetRasterDataType();
+            sInfo.dfNoData = poItemBand->GetNoDataValue(&sInfo.bHasNoData);
+            sInfo.eInterp = poItemBand->GetColorInterpretation();
+            asBandInfo.push_back(sInfo);
+
+            CPLJSONObject oBand;
+            oBand.Add("data_type", GDALGetDataTypeName(sInfo.eDT));
+            if (sInfo.bHasNoData)
+                oBand.Add("nodata", CPLSPrintf("%.17g", sInfo.dfNoData));
+            oBand.Add("color_interpretation",
+                      GDALGetColorInterpretationName(sInfo.eInterp));
+            oCachedBands.Add(oBand);
+        }
+
+        if (!m_osCacheFilename.empty() && !asBandInfo.empty())
+        {
+            CPLJSONObject oHeader;
+            oHeader.Add("filename", osFirstItemName);
+            oHeader.Add("bands", oCachedBands);
+            oCachedHeaders.Add(oHeader);
+            SaveCache();
+        }
     }
 
     // Sort by ascending datetime
@@ -586,27 +724,27 @@ bool STACITDataset::SetupDataset(
 
     // Create VRT bands and add sources
     bool bAtLeastOneBandHasNoData = false;
-    for (int i = 0; i < poItemDS->GetRasterCount(); i++)
+    const int nBands = static_cast<int>(asBandInfo.size());
+    for (int i = 0; i < nBands; i++)
     {
-        auto poItemBand = poItemDS->GetRasterBand(i + 1);
-        AddBand(poItemBand->GetRasterDataType(), nullptr);
+        const auto &sBandInfo = asBandInfo[i];
+        AddBand(sBandInfo.eDT, nullptr);
         auto poVRTBand =
             cpl::down_cast<VRTSourcedRasterBand *>(GetRasterBand(i + 1));
-        int bHasNoData = FALSE;
-        const double dfNoData = poItemBand->GetNoDataValue(&bHasNoData);
+        const int bHasNoData = sBandInfo.bHasNoData;
+        const double dfNoData = sBandInfo.dfNoData;
         if (bHasNoData)
         {
             bAtLeastOneBandHasNoData = true;
             poVRTBand->SetNoDataValue(dfNoData);
         }
 
-        const auto eInterp = poItemBand->GetColorInterpretation();
+        const auto eInterp = sBandInfo.eInterp;
         if (eInterp != GCI_Undefined)
             poVRTBand->SetColorInterpretation(eInterp);
 
         // Set band properties
-        if (asset.bands.IsValid() &&
-            asset.bands.Size() == poItemDS->GetRasterCount())
+        if (asset.bands.IsValid() && asset.bands.Size() == nBands)
         {
             const auto &band = asset.bands[i];
             const auto osBandName = band["name"].ToString();
@@ -789,13 +927,112 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
+    const auto ProcessFeature =
+        [&osFilteredCollection, &osFilteredAsset, &osFilteredCRS,
+         &oMapCollection](const CPLJSONObject &oFeature)
+    {
+        auto oStacExtensions = oFeature.GetArray("stac_extensions");
+        if (!oStacExtensions.IsValid())
+        {
+            CPLDebug("STACIT",
+                     "Skipping Feature that lacks stac_extensions");
+            return;
+        }
+        bool bProjExtensionFound = false;
+        for (const auto &oStacExtension : oStacExtensions)
+        {
+            if (oStacExtension.ToString() == "proj" ||
+                oStacExtension.ToString().find(
+                    "https://stac-extensions.github.io/projection/") == 0)
+            {
+                bProjExtensionFound = true;
+                break;
+            }
+        }
+        if (!bProjExtensionFound)
+        {
+            CPLDebug(
+                "STACIT",
+                "Skipping Feature that lacks the 'proj' STAC extension");
+            return;
+        }
+
+        auto jAssets = oFeature["assets"];
+        if (!jAssets.IsValid() ||
+            jAssets.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Missing assets on a Feature");
+            return;
+        }
+
+        auto oProperties = oFeature["properties"];
+        if (!oProperties.IsValid() ||
+            oProperties.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Missing properties on a Feature");
+            return;
+        }
+
+        const auto osCollection = oFeature["collection"].ToString();
+        if (!osFilteredCollection.empty() &&
+            osFilteredCollection != osCollection)
+            return;
+
+        for (const auto &jAsset : jAssets.GetChildren())
+        {
+            const auto osAssetName = jAsset.GetName();
+            if (!osFilteredAsset.empty() && osFilteredAsset != osAssetName)
+                continue;
+
+            ParseAsset(jAsset, oProperties, osCollection, osFilteredCRS,
+                       oMapCollection);
+        }
+    };
+
+    // Search results of STAC API queries may be cached in CACHE_DIRECTORY
+    const bool bIsHTTP = STARTS_WITH(osFilename, "http://") ||
+                         STARTS_WITH(osFilename, "https://");
+    const char *pszCacheDir =
+        CSLFetchNameValue(poOpenInfo->papszOpenOptions, "CACHE_DIRECTORY");
+    bool bFromCache = false;
+    CPLJSONArray oCachedFeatures;
+    oCachedFeatures.Deinit();
+    if (pszCacheDir && pszCacheDir[0] && bIsHTTP)
+    {
+        const std::string osKey =
+            osFilename + CPLSPrintf("&gdal_max_items=" CPL_FRMT_GIB, nMaxItems);
+        GByte abyHash[CPL_SHA256_HASH_SIZE];
+        CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+        char *pszHash = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+        m_osCacheFilename = CPLFormFilenameSafe(
+            pszCacheDir, (std::string("stacit_") + pszHash).c_str(), "json");
+        CPLFree(pszHash);
+
+        bFromCache = LoadCache(poOpenInfo);
+        if (!bFromCache)
+        {
+            m_oCache = CPLJSONObject();
+            m_oCache.Add("url", osFilename);
+            oCachedFeatures = CPLJSONArray();
+            m_oCache.Add("features", oCachedFeatures);
+        }
+    }
+
     auto osCurFilename = osFilename;
     std::string osMethod = "GET";
     CPLJSONObject oHeaders;
     CPLJSONObject oBody;
     bool bMerge = false;
     int nLoops = 0;
-    do
+    if (bFromCache)
+    {
+        for (const auto &oFeature : m_oCache.GetArray("features"))
+            ProcessFeature(oFeature);
+        osCurFilename.clear();
+    }
+    while (!osCurFilename.empty())
     {
         ++nLoops;
         if (nMaxItems > 0 && nLoops > nMaxItems)
@@ -884,64 +1121,9 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
                 break;
             }
 
-            auto oStacExtensions = oFeature.GetArray("stac_extensions");
-            if (!oStacExtensions.IsValid())
-            {
-                CPLDebug("STACIT",
-                         "Skipping Feature that lacks stac_extensions");
-                continue;
-            }
-            bool bProjExtensionFound = false;
-            for (const auto &oStacExtension : oStacExtensions)
-            {
-                if (oStacExtension.ToString() == "proj" ||
-                    oStacExtension.ToString().find(
-                        "https://stac-extensions.github.io/projection/") == 0)
-                {
-                    bProjExtensionFound = true;
-                    break;
-                }
-            }
-            if (!bProjExtensionFound)
-            {
-                CPLDebug(
-                    "STACIT",
-                    "Skipping Feature that lacks the 'proj' STAC extension");
-                continue;
-            }
-
-            auto jAssets = oFeature["assets"];
-            if (!jAssets.IsValid() ||
-                jAssets.GetType() != CPLJSONObject::Type::Object)
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Missing assets on a Feature");
-                continue;
-            }
-
-            auto oProperties = oFeature["properties"];
-            if (!oProperties.IsValid() ||
-                oProperties.GetType() != CPLJSONObject::Type::Object)
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Missing properties on a Feature");
-                continue;
-            }
-
-            const auto osCollection = oFeature["collection"].ToString();
-            if (!osFilteredCollection.empty() &&
-                osFilteredCollection != osCollection)
-                continue;
-
-            for (const auto &jAsset : jAssets.GetChildren())
-            {
-                const auto osAssetName = jAsset.GetName();
-                if (!osFilteredAsset.empty() && osFilteredAsset != osAssetName)
-                    continue;
-
-                ParseAsset(jAsset, oProperties, osCollection, osFilteredCRS,
-                           oMapCollection);
-            }
+            if (oCachedFeatures.IsValid())
+                oCachedFeatures.Add(oFeature);
+            ProcessFeature(oFeature);
         }
         if (nMaxItems > 0 && nItemIter >= nMaxItems)
         {
@@ -994,7 +1176,10 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
         }
         else
             osCurFilename.clear();
-    } while (!osCurFilename.empty());
+    }
+
+    if (oCachedFeatures.IsValid())
+        SaveCache();
 
     if (oMapCollection.empty())
     {
@@ -1075,6 +1260,12 @@ void GDALRegister_STACIT()
         "       <Value>USE_ALL</Value>"
         "       <Value>USE_MOST_RECENT</Value>"
         "   </Option>"
+        "   <Option name='CACHE_DIRECTORY' type='string' "
+        "description='Directory where to cache the results of STAC API "
+        "searches'/>"
+        "   <Option name='CACHE_MAX_AGE' type='int' default='86400' "
+        "description='Maximum age, in seconds, of a cached search result. "
+        "0=refresh the cache'/>"
         "</OpenOptionList>");
 
     poDriver->pfnOpen = STACITDataset::OpenStatic;
@@ -17,6 +17,8 @@
 #include "vrtexpression.h"
 
 #include <limits>
+#include <new>
+#include <vector>
 
 template <typename T>
 inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
@@ -98,6 +100,86 @@ static CPLErr FetchDoubleArg(CSLConstList papszArgs, const char *pszName,
     return CE_None;
 }
 
+/************************************************************************/
+/*                          ProcessRealLines()                          */
+/************************************************************************/
+
+/** Applies oLineFunc() on each line of non-complex sources.
+ *
+ * Each source line is converted to double with a single GDALCopyWords64()
+ * call (which has vectorized specializations per source type), oLineFunc()
+ * computes a whole output line as plain loops over double arrays that the
+ * compiler can vectorize, and the output line is written with a single
+ * GDALCopyWords64() call. This avoids the GetSrcVal() type switch and the
+ * GDALCopyWords() call done for every pixel by the generic code paths.
+ *
+ * oLineFunc is called as oLineFunc(papadfSrcLines, padfDstLine, nXSize).
+ */
+template <class LineFunc>
+static CPLErr ProcessRealLines(void **papoSources, int nSources, void *pData,
+                               int nXSize, int nYSize, GDALDataType eSrcType,
+                               GDALDataType eBufType, int nPixelSpace,
+                               int nLineSpace, LineFunc &&oLineFunc)
+{
+    CPLAssert(!GDALDataTypeIsComplex(eSrcType));
+
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    const size_t nSrcLineSize = static_cast<size_t>(nSrcTypeSize) * nXSize;
+    // Source buffers are allocated by VRTDerivedRasterBand::IRasterIO()
+    // with VSIMalloc(), so lines of doubles can be used in place.
+    const bool bSrcIsDouble = eSrcType == GDT_Float64;
+
+    std::vector<double> adfSrcLines;
+    std::vector<double> adfDstLine;
+    std::vector<const double *> apadfSrcLines;
+    try
+    {
+        if (!bSrcIsDouble)
+            adfSrcLines.resize(static_cast<size_t>(nSources) * nXSize);
+        adfDstLine.resize(nXSize);
+        apadfSrcLines.resize(nSources);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers");
+        return CE_Failure;
+    }
+
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        for (int iSrc = 0; iSrc < nSources; ++iSrc)
+        {
+            const GByte *pabySrcLine =
+                static_cast<const GByte *>(papoSources[iSrc]) +
+                nSrcLineSize * iLine;
+            if (bSrcIsDouble)
+            {
+                apadfSrcLines[iSrc] =
+                    reinterpret_cast<const double *>(pabySrcLine);
+            }
+            else
+            {
+                double *padfSrcLine =
+                    adfSrcLines.data() + static_cast<size_t>(iSrc) * nXSize;
+                GDALCopyWords64(pabySrcLine, eSrcType, nSrcTypeSize,
+                                padfSrcLine, GDT_Float64, sizeof(double),
+                                nXSize);
+                apadfSrcLines[iSrc] = padfSrcLine;
+            }
+        }
+
+        oLineFunc(apadfSrcLines.data(), adfDstLine.data(), nXSize);
+
+        GDALCopyWords64(adfDstLine.data(), GDT_Float64, sizeof(double),
+                        static_cast<GByte *>(pData) +
+                            static_cast<GSpacing>(nLineSpace) * iLine,
+                        eBufType, nPixelSpace, nXSize);
+    }
+
+    return CE_None;
+}
+
 static CPLErr RealPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -532,27 +614,21 @@ static CPLErr SumPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        return ProcessRealLines(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [nSources, dfK](const double *const *papadfSrc, double *padfDst,
+                            int nCount)
             {
-                double dfSum = dfK;  // Not complex.
-
+                for (int i = 0; i < nCount; ++i)
+                    padfDst[i] = dfK;
                 for (int iSrc = 0; iSrc < nSources; ++iSrc)
                 {
-                    // Source raster pixels may be obtained with GetSrcVal
-                    // macro.
-                    dfSum += GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                    const double *padfSrc = papadfSrc[iSrc];
+                    for (int i = 0; i < nCount; ++i)
+                        padfDst[i] += padfSrc[i];
                 }
-
-                GDALCopyWords(&dfSum, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+            });
     }
 
     /* ---- Return success ---- */
@@ -601,24 +677,16 @@ static CPLErr DiffPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        return ProcessRealLines(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [](const double *const *papadfSrc, double *padfDst, int nCount)
             {
-                // Source raster pixels may be obtained with GetSrcVal macro.
-                // Not complex.
-                const double dfPixVal =
-                    GetSrcVal(papoSources[0], eSrcType, ii) -
-                    GetSrcVal(papoSources[1], eSrcType, ii);
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                const double *padfSrc0 = papadfSrc[0];
+                const double *padfSrc1 = papadfSrc[1];
+                for (int i = 0; i < nCount; ++i)
+                    padfDst[i] = padfSrc0[i] - padfSrc1[i];
+            });
     }
 
     /* ---- Return success ---- */
@@ -686,27 +754,21 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        return ProcessRealLines(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [nSources, dfK](const double *const *papadfSrc, double *padfDst,
+                            int nCount)
             {
-                double dfPixVal = dfK;  // Not complex.
-
+                for (int i = 0; i < nCount; ++i)
+                    padfDst[i] = dfK;
                 for (int iSrc = 0; iSrc < nSources; ++iSrc)
                 {
-                    // Source raster pixels may be obtained with GetSrcVal
-                    // macro.
-                    dfPixVal *= GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                    const double *padfSrc = papadfSrc[iSrc];
+                    for (int i = 0; i < nCount; ++i)
+                        padfDst[i] *= padfSrc[i];
                 }
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+            });
     }
 
     /* ---- Return success ---- */
@@ -765,25 +827,21 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        return ProcessRealLines(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [](const double *const *papadfSrc, double *padfDst, int nCount)
             {
-                const double dfVal = GetSrcVal(papoSources[1], eSrcType, ii);
-                // coverity[divide_by_zero]
-                double dfPixVal =
-                    dfVal == 0
-                        ? std::numeric_limits<double>::infinity()
-                        : GetSrcVal(papoSources[0], eSrcType, ii) / dfVal;
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                const double *padfSrc0 = papadfSrc[0];
+                const double *padfSrc1 = papadfSrc[1];
+                for (int i = 0; i < nCount; ++i)
+                {
+                    // coverity[divide_by_zero]
+                    padfDst[i] = padfSrc1[i] == 0
+                                     ? std::numeric_limits<double>::infinity()
+                                     : padfSrc0[i] / padfSrc1[i];
+                }
+            });
     }
 
     /* ---- Return success ---- */
@@ -1333,27 +1391,19 @@ CPLErr InterpolatePixelFunc(void **papoSources, int nSources, void *pData,
     double dfX1 = dfT0 + dfDt;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    void *apoInterpolatedSources[] = {papoSources[i0], papoSources[i1]};
+    return ProcessRealLines(
+        apoInterpolatedSources, 2, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [dfT0, dfX1, dfT](const double *const *papadfSrc, double *padfDst,
+                          int nCount)
         {
-            const double dfY0 = GetSrcVal(papoSources[i0], eSrcType, ii);
-            const double dfY1 = GetSrcVal(papoSources[i1], eSrcType, ii);
-
-            const double dfPixVal =
-                InterpolationFunction(dfT0, dfX1, dfY0, dfY1, dfT);
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
-
-    /* ---- Return success ---- */
-    return CE_None;
+            const double *padfY0 = papadfSrc[0];
+            const double *padfY1 = papadfSrc[1];
+            for (int i = 0; i < nCount; ++i)
+                padfDst[i] =
+                    InterpolationFunction(dfT0, dfX1, padfY0[i], padfY1[i], dfT);
+        });
 }
 
 static const char pszReplaceNoDataPixelFuncMetadata[] =
@@ -1393,25 +1443,21 @@ static CPLErr ReplaceNoDataPixelFunc(void **papoSources, int nSources,
     }
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    return ProcessRealLines(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [dfOldNoData, dfNewNoData](const double *const *papadfSrc,
+                                   double *padfDst, int nCount)
         {
-            double dfPixVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            if (dfPixVal == dfOldNoData || std::isnan(dfPixVal))
-                dfPixVal = dfNewNoData;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
-
-    /* ---- Return success ---- */
-    return CE_None;
+            const double *padfSrc = papadfSrc[0];
+            for (int i = 0; i < nCount; ++i)
+            {
+                const double dfPixVal = padfSrc[i];
+                padfDst[i] = (dfPixVal == dfOldNoData || std::isnan(dfPixVal))
+                                 ? dfNewNoData
+                                 : dfPixVal;
+            }
+        });
 }
 
 static const char pszScalePixelFuncMetadata[] =
@@ -1442,24 +1488,16 @@ static CPLErr ScalePixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    return ProcessRealLines(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [dfScale, dfOffset](const double *const *papadfSrc, double *padfDst,
+                            int nCount)
         {
-            const double dfPixVal =
-                GetSrcVal(papoSources[0], eSrcType, ii) * dfScale + dfOffset;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
-
-    /* ---- Return success ---- */
-    return CE_None;
+            const double *padfSrc = papadfSrc[0];
+            for (int i = 0; i < nCount; ++i)
+                padfDst[i] = padfSrc[i] * dfScale + dfOffset;
+        });
 }
 
 static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
@@ -1479,31 +1517,26 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
     }
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    return ProcessRealLines(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [](const double *const *papadfSrc, double *padfDst, int nCount)
         {
-            const double dfLeftVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfRightVal = GetSrcVal(papoSources[1], eSrcType, ii);
-
-            const double dfDenom = (dfLeftVal + dfRightVal);
-
-            // coverity[divide_by_zero]
-            const double dfPixVal =
-                dfDenom == 0 ? std::numeric_limits<double>::infinity()
-                             : (dfLeftVal - dfRightVal) / dfDenom;
+            const double *padfLeft = papadfSrc[0];
+            const double *padfRight = papadfSrc[1];
+            for (int i = 0; i < nCount; ++i)
+            {
+                const double dfLeftVal = padfLeft[i];
+                const double dfRightVal = padfRight[i];
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+                const double dfDenom = (dfLeftVal + dfRightVal);
 
-    /* ---- Return success ---- */
-    return CE_None;
+                // coverity[divide_by_zero]
+                padfDst[i] = dfDenom == 0
+                                 ? std::numeric_limits<double>::infinity()
+                                 : (dfLeftVal - dfRightVal) / dfDenom;
+            }
+        });
 }  // NormDiffPixelFunc
 
 /************************************************************************/
@@ -1542,46 +1575,42 @@ static CPLErr MinOrMaxPixelFunc(void **papoSources, int nSources, void *pData,
         CSLFetchNameValueDef(papszArgs, "propagateNoData", "false"));
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    return ProcessRealLines(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [nSources, dfNoData, bPropagateNoData](const double *const *papadfSrc,
+                                               double *padfDst, int nCount)
         {
-            double dfRes = std::numeric_limits<double>::quiet_NaN();
-
-            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            for (int i = 0; i < nCount; ++i)
             {
-                const double dfVal = GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                double dfRes = std::numeric_limits<double>::quiet_NaN();
 
-                if (std::isnan(dfVal) || dfVal == dfNoData)
+                for (int iSrc = 0; iSrc < nSources; ++iSrc)
                 {
-                    if (bPropagateNoData)
+                    const double dfVal = papadfSrc[iSrc][i];
+
+                    if (std::isnan(dfVal) || dfVal == dfNoData)
+                    {
+                        if (bPropagateNoData)
+                        {
+                            dfRes = dfNoData;
+                            break;
+                        }
+                    }
+                    else if (Comparator::compare(dfVal, dfRes))
                     {
-                        dfRes = dfNoData;
-                        break;
+                        dfRes = dfVal;
                     }
                 }
-                else if (Comparator::compare(dfVal, dfRes))
+
+                if (!bPropagateNoData && std::isnan(dfRes))
                 {
-                    dfRes = dfVal;
+                    dfRes = dfNoData;
                 }
-            }
 
-            if (!bPropagateNoData && std::isnan(dfRes))
-            {
-                dfRes = dfNoData;
+                padfDst[i] = dfRes;
             }
-
-            GDALCopyWords(&dfRes, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
-
-    /* ---- Return success ---- */
-    return CE_None;
+        });
 } /* MinOrMaxPixelFunc */
 
 static CPLErr MinPixelFunc(void **papoSources, int nSources, void *pData,
@@ -1666,6 +1695,36 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         pszDialect = "muparser";
     }
 
+#if GDAL_VRT_ENABLE_MUPARSER
+    // Fast path: compile the expression once into operations on whole lines,
+    // falling back to muparser for constructs not handled by
+    // VectorizedExpression.
+    if (pszExpression && EQUAL(pszDialect, "muparser") &&
+        aosSourceNames.size() == nSources &&
+        CPLTestBool(CPLGetConfigOption("VRT_VECTORIZED_EXPRESSION", "YES")))
+    {
+        const std::vector<std::string> aosVariables(aosSourceNames.begin(),
+                                                    aosSourceNames.end());
+        auto poVectorizedExpression = gdal::VectorizedExpression::Compile(
+            pszExpression, aosVariables,
+            strstr(pszExpression, "BANDS") != nullptr);
+        if (poVectorizedExpression)
+        {
+            return ProcessRealLines(
+                papoSources, nSources, pData, nXSize, nYSize, eSrcType,
+                eBufType, nPixelSpace, nLineSpace,
+                [&poVectorizedExpression](const double *const *papadfSrc,
+                                          double *padfDst, int nCount)
+                {
+                    poVectorizedExpression->Evaluate(papadfSrc, padfDst,
+                                                     nCount);
+                });
+        }
+        CPLDebugOnly("VRT", "Expression '%s' evaluated with muparser",
+                     pszExpression);
+    }
+#endif
+
     poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
 
     // cppcheck-suppress knownConditionTrueFalse
@@ -1849,5 +1908,19 @@ CPLErr GDALRegisterDefaultPixelFunc()
                                         pszMinMaxFuncMetadataNodata);
     GDALAddDerivedBandPixelFuncWithArgs("expression", ExprPixelFunc,
                                         pszExprPixelFuncMetadata);
+
+    // All above functions, except "expression" which compiles its
+    // expression at each call, only read their sources and arguments and
+    // can be run concurrently on chunks of lines of large requests.
+    for (const char *pszName :
+         {"real", "imag", "complex", "polar", "mod", "phase", "conj", "sum",
+          "diff", "mul", "div", "cmul", "inv", "intensity", "sqrt", "log10",
+          "dB", "exp", "dB2amp", "dB2pow", "pow", "interpolate_linear",
+          "interpolate_exp", "replace_nodata", "scale", "norm_diff", "min",
+          "max"})
+    {
+        VRTDerivedRasterBand::SetPixelFunctionReentrant(pszName);
+    }
+
     return CE_None;
 }
@@ -0,0 +1,574 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Compact binary encoding of VRT files (.vrtb)
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtdataset.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_minixml.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Layout of a .vrtb file. All numbers are little-endian.
+ *
+ * - 8 bytes: "GDALVRTB"
+ * - uint32: version of the encoding (BINARY_VERSION)
+ * - uint32: size of the XML part
+ * - XML part: the VRTDataset document, from which the sources of the bands
+ *   that have a source table are left out
+ * - uint32: number of strings of the string table
+ * - for each string: uint32 size, followed by the bytes of the string
+ * - uint32: number of source tables
+ * - for each source table:
+ *   - uint32: band number
+ *   - uint32: number of sources
+ *   - for each source, in declaration order, a record of RECORD_SIZE bytes:
+ *     - uint8: source type (SOURCE_SIMPLE or SOURCE_COMPLEX)
+ *     - uint8: FLAG_xxx flags
+ *     - uint16: reserved (0)
+ *     - uint32: index in the string table of the source filename, as
+ *       written in the SourceFilename element of the XML encoding
+ *     - int32: index in the string table of the resampling method, or -1
+ *     - int32: source band number
+ *     - 4 doubles: source window (xOff, yOff, xSize, ySize)
+ *     - 4 doubles: destination window (xOff, yOff, xSize, ySize)
+ *     - 3 doubles: nodata value, scale offset and scale ratio, only
+ *       meaningful for SOURCE_COMPLEX
+ *
+ * Sources are only written in binary form for bands whose sources are all
+ * SimpleSource or ComplexSource using at most nodata, UseMaskBand and linear
+ * scaling, and that do not have open options or a name. Other bands keep
+ * their sources in the XML part.
+ */
+
+namespace
+{
+
+constexpr uint32_t BINARY_VERSION = 1;
+
+constexpr GByte SOURCE_SIMPLE = 0;
+constexpr GByte SOURCE_COMPLEX = 1;
+
+constexpr GByte FLAG_RELATIVE_TO_VRT = 1 << 0;
+constexpr GByte FLAG_MASK_BAND = 1 << 1;
+constexpr GByte FLAG_UNSHARED = 1 << 2;
+constexpr GByte FLAG_NODATA = 1 << 3;
+constexpr GByte FLAG_USE_MASK_BAND = 1 << 4;
+constexpr GByte FLAG_SCALING_LINEAR = 1 << 5;
+
+constexpr size_t RECORD_SIZE = 4 * sizeof(uint32_t) + 11 * sizeof(double);
+
+/************************************************************************/
+/*                           BinaryWriter                               */
+/************************************************************************/
+
+struct BinaryWriter
+{
+    std::vector<GByte> abyData{};
+
+    void AddUInt32(uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        Add(&nVal, sizeof(nVal));
+    }
+
+    void AddInt32(int32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        Add(&nVal, sizeof(nVal));
+    }
+
+    void AddDouble(double dfVal)
+    {
+        CPL_LSBPTR64(&dfVal);
+        Add(&dfVal, sizeof(dfVal));
+    }
+
+    void Add(const void *pData, size_t nSize)
+    {
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+        abyData.insert(abyData.end(), pabyData, pabyData + nSize);
+    }
+};
+
+/************************************************************************/
+/*                           BinaryReader                               */
+/************************************************************************/
+
+struct BinaryReader
+{
+    const GByte *pabyData = nullptr;
+    size_t nRemaining = 0;
+
+    BinaryReader(const GByte *pabyDataIn, size_t nSizeIn)
+        : pabyData(pabyDataIn), nRemaining(nSizeIn)
+    {
+    }
+
+    bool Read(void *pOut, size_t nSize)
+    {
+        if (nSize > nRemaining)
+            return false;
+        memcpy(pOut, pabyData, nSize);
+        pabyData += nSize;
+        nRemaining -= nSize;
+        return true;
+    }
+
+    bool ReadUInt32(uint32_t &nVal)
+    {
+        if (!Read(&nVal, sizeof(nVal)))
+            return false;
+        CPL_LSBPTR32(&nVal);
+        return true;
+    }
+
+    bool ReadInt32(int32_t &nVal)
+    {
+        if (!Read(&nVal, sizeof(nVal)))
+            return false;
+        CPL_LSBPTR32(&nVal);
+        return true;
+    }
+
+    bool ReadDouble(double &dfVal)
+    {
+        if (!Read(&dfVal, sizeof(dfVal)))
+            return false;
+        CPL_LSBPTR64(&dfVal);
+        return true;
+    }
+
+    bool ReadString(std::string &osVal, size_t nSize)
+    {
+        if (nSize > nRemaining)
+            return false;
+        osVal.assign(reinterpret_cast<const char *>(pabyData), nSize);
+        pabyData += nSize;
+        nRemaining -= nSize;
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                          IsValidWindow()                             */
+/************************************************************************/
+
+// Same checks as VRTSimpleSource::ParseSrcRectAndDstRect()
+bool IsValidWindow(double dfXOff, double dfYOff, double dfXSize,
+                   double dfYSize)
+{
+    constexpr double UNINIT_WINDOW = -1.0;
+    // Test written that way to catch NaN values
+    return (dfXOff >= INT_MIN && dfXOff <= INT_MAX) &&
+           (dfYOff >= INT_MIN && dfYOff <= INT_MAX) &&
+           (dfXSize > 0 || dfXSize == UNINIT_WINDOW) && dfXSize <= INT_MAX &&
+           (dfYSize > 0 || dfYSize == UNINIT_WINDOW) && dfYSize <= INT_MAX;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                              IsBinary()                              */
+/************************************************************************/
+
+/** Returns whether the passed data is the start of a .vrtb file */
+bool VRTDataset::IsBinary(const GByte *pabyData, size_t nSize)
+{
+    const size_t nSignatureSize = strlen(BINARY_SIGNATURE);
+    return pabyData != nullptr && nSize >= nSignatureSize &&
+           memcmp(pabyData, BINARY_SIGNATURE, nSignatureSize) == 0;
+}
+
+/************************************************************************/
+/*                            WriteBinary()                             */
+/************************************************************************/
+
+/** Write the dataset as a .vrtb file.
+ *
+ * Only valid for instances of VRTDataset itself, not of its subclasses.
+ */
+bool VRTDataset::WriteBinary(const char *pszFilename)
+{
+    const std::string osVRTPath(CPLGetPathSafe(pszFilename));
+
+    const auto IsBinarySource = [](const VRTSource *poSource)
+    {
+        if (!poSource->IsSimpleSource())
+            return false;
+        const auto poSimpleSource =
+            cpl::down_cast<const VRTSimpleSource *>(poSource);
+        if (poSimpleSource->m_bSrcDSNameFromVRT ||
+            poSimpleSource->m_osSrcDSName.empty() ||
+            !poSimpleSource->m_aosOpenOptionsOri.empty() ||
+            !poSimpleSource->GetName().empty())
+        {
+            return false;
+        }
+        const char *pszType = poSimpleSource->GetType();
+        if (strcmp(pszType, VRTSimpleSource::GetTypeStatic()) == 0)
+            return true;
+        if (strcmp(pszType, VRTComplexSource::GetTypeStatic()) != 0)
+            return false;
+        const auto poComplexSource =
+            cpl::down_cast<const VRTComplexSource *>(poSource);
+        return (poComplexSource->m_nProcessingFlags &
+                ~(VRTComplexSource::PROCESSING_FLAG_NODATA |
+                  VRTComplexSource::PROCESSING_FLAG_USE_MASK_BAND |
+                  VRTComplexSource::PROCESSING_FLAG_SCALING_LINEAR)) == 0 &&
+               poComplexSource->m_adfLUTInputs.empty() &&
+               poComplexSource->m_nColorTableComponent == 0;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Find the bands whose sources can be written in binary form.     */
+    /* -------------------------------------------------------------------- */
+    std::vector<VRTSourcedRasterBand *> apoBinaryBands;
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        auto poBand = dynamic_cast<VRTSourcedRasterBand *>(papoBands[iBand]);
+        if (poBand == nullptr || poBand->nSources == 0 ||
+            dynamic_cast<VRTDerivedRasterBand *>(poBand) != nullptr)
+        {
+            continue;
+        }
+        bool bAllBinary = true;
+        for (int i = 0; bAllBinary && i < poBand->nSources; ++i)
+            bAllBinary = IsBinarySource(poBand->papoSources[i]);
+        if (bAllBinary)
+            apoBinaryBands.push_back(poBand);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Serialize the rest of the dataset as XML.                       */
+    /* -------------------------------------------------------------------- */
+    m_oSetBandsWithBinarySources.insert(apoBinaryBands.begin(),
+                                        apoBinaryBands.end());
+    CPLXMLNode *psDSTree = SerializeToXML(osVRTPath.c_str());
+    m_oSetBandsWithBinarySources.clear();
+    if (psDSTree == nullptr)
+        return false;
+    char *pszXML = CPLSerializeXMLTree(psDSTree);
+    CPLDestroyXMLNode(psDSTree);
+    if (pszXML == nullptr)
+        return false;
+    const std::string osXML(pszXML);
+    CPLFree(pszXML);
+
+    /* -------------------------------------------------------------------- */
+    /*      Encode the source tables, collecting strings.                   */
+    /* -------------------------------------------------------------------- */
+    std::map<std::string, uint32_t> oMapStringToIndex;
+    std::vector<std::string> aosStrings;
+    const auto GetStringIndex =
+        [&oMapStringToIndex, &aosStrings](const std::string &osStr)
+    {
+        const auto oIter = oMapStringToIndex.find(osStr);
+        if (oIter != oMapStringToIndex.end())
+            return oIter->second;
+        const uint32_t nIdx = static_cast<uint32_t>(aosStrings.size());
+        oMapStringToIndex[osStr] = nIdx;
+        aosStrings.push_back(osStr);
+        return nIdx;
+    };
+
+    BinaryWriter oTables;
+    oTables.AddUInt32(static_cast<uint32_t>(apoBinaryBands.size()));
+    for (const auto poBand : apoBinaryBands)
+    {
+        oTables.AddUInt32(static_cast<uint32_t>(poBand->GetBand()));
+        oTables.AddUInt32(static_cast<uint32_t>(poBand->nSources));
+        for (int i = 0; i < poBand->nSources; ++i)
+        {
+            const auto poSource =
+                cpl::down_cast<VRTSimpleSource *>(poBand->papoSources[i]);
+            const bool bComplex = strcmp(poSource->GetType(),
+                                         VRTComplexSource::GetTypeStatic()) ==
+                                  0;
+
+            int bRelativeToVRT = FALSE;
+            const std::string osSourceFilename =
+                poSource->GetSourceFilenameToSerialize(osVRTPath.c_str(),
+                                                       bRelativeToVRT);
+
+            GByte nFlags = 0;
+            if (bRelativeToVRT)
+                nFlags |= FLAG_RELATIVE_TO_VRT;
+            if (poSource->m_bGetMaskBand)
+                nFlags |= FLAG_MASK_BAND;
+            if (poSource->IsSerializedAsUnshared())
+                nFlags |= FLAG_UNSHARED;
+
+            double dfNoData = 0;
+            double dfScaleOff = 0;
+            double dfScaleRatio = 1;
+            if (bComplex)
+            {
+                const auto poComplexSource =
+                    cpl::down_cast<VRTComplexSource *>(poSource);
+                const int nProcessingFlags =
+                    poComplexSource->m_nProcessingFlags;
+                if (nProcessingFlags & VRTComplexSource::PROCESSING_FLAG_NODATA)
+                {
+                    nFlags |= FLAG_NODATA;
+                    dfNoData = poComplexSource->m_dfNoDataValue;
+                }
+                if (nProcessingFlags &
+                    VRTComplexSource::PROCESSING_FLAG_USE_MASK_BAND)
+                {
+                    nFlags |= FLAG_USE_MASK_BAND;
+                }
+                if (nProcessingFlags &
+                    VRTComplexSource::PROCESSING_FLAG_SCALING_LINEAR)
+                {
+                    nFlags |= FLAG_SCALING_LINEAR;
+                    dfScaleOff = poComplexSource->m_dfScaleOff;
+                    dfScaleRatio = poComplexSource->m_dfScaleRatio;
+                }
+            }
+
+            const GByte abyHeader[4] = {
+                bComplex ? SOURCE_COMPLEX : SOURCE_SIMPLE, nFlags, 0, 0};
+            oTables.Add(abyHeader, sizeof(abyHeader));
+            oTables.AddUInt32(GetStringIndex(osSourceFilename));
+            oTables.AddInt32(
+                poSource->m_osResampling.empty()
+                    ? -1
+                    : static_cast<int32_t>(
+                          GetStringIndex(poSource->m_osResampling)));
+            oTables.AddInt32(poSource->m_nBand);
+            oTables.AddDouble(poSource->m_dfSrcXOff);
+            oTables.AddDouble(poSource->m_dfSrcYOff);
+            oTables.AddDouble(poSource->m_dfSrcXSize);
+            oTables.AddDouble(poSource->m_dfSrcYSize);
+            oTables.AddDouble(poSource->m_dfDstXOff);
+            oTables.AddDouble(poSource->m_dfDstYOff);
+            oTables.AddDouble(poSource->m_dfDstXSize);
+            oTables.AddDouble(poSource->m_dfDstYSize);
+            oTables.AddDouble(dfNoData);
+            oTables.AddDouble(dfScaleOff);
+            oTables.AddDouble(dfScaleRatio);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Write the file.                                                 */
+    /* -------------------------------------------------------------------- */
+    BinaryWriter oHeader;
+    oHeader.Add(BINARY_SIGNATURE, strlen(BINARY_SIGNATURE));
+    oHeader.AddUInt32(BINARY_VERSION);
+    oHeader.AddUInt32(static_cast<uint32_t>(osXML.size()));
+    oHeader.Add(osXML.data(), osXML.size());
+    oHeader.AddUInt32(static_cast<uint32_t>(aosStrings.size()));
+    for (const auto &osStr : aosStrings)
+    {
+        oHeader.AddUInt32(static_cast<uint32_t>(osStr.size()));
+        oHeader.Add(osStr.data(), osStr.size());
+    }
+
+    VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s", pszFilename);
+        return false;
+    }
+    bool bRet = VSIFWriteL(oHeader.abyData.data(), oHeader.abyData.size(), 1,
+                           fp) == 1 &&
+                VSIFWriteL(oTables.abyData.data(), oTables.abyData.size(), 1,
+                           fp) == 1;
+    if (VSIFCloseL(fp) != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 pszFilename);
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                             OpenBinary()                             */
+/************************************************************************/
+
+/** Instantiate a VRTDataset from the content of a .vrtb file */
+VRTDataset *VRTDataset::OpenBinary(const GByte *pabyData, size_t nSize,
+                                   const char *pszVRTPath, GDALAccess eAccess)
+{
+    const auto ReportCorrupted = []()
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Corrupted or truncated binary VRT file");
+    };
+
+    if (!IsBinary(pabyData, nSize))
+        return nullptr;
+    const size_t nSignatureSize = strlen(BINARY_SIGNATURE);
+    BinaryReader oReader(pabyData + nSignatureSize, nSize - nSignatureSize);
+
+    uint32_t nVersion = 0;
+    uint32_t nXMLSize = 0;
+    std::string osXML;
+    if (!oReader.ReadUInt32(nVersion) || !oReader.ReadUInt32(nXMLSize) ||
+        !oReader.ReadString(osXML, nXMLSize))
+    {
+        ReportCorrupted();
+        return nullptr;
+    }
+    if (nVersion > BINARY_VERSION)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Binary VRT file of version %u not supported", nVersion);
+        return nullptr;
+    }
+
+    uint32_t nStrings = 0;
+    if (!oReader.ReadUInt32(nStrings) ||
+        nStrings > oReader.nRemaining / sizeof(uint32_t))
+    {
+        ReportCorrupted();
+        return nullptr;
+    }
+    std::vector<std::string> aosStrings(nStrings);
+    for (auto &osStr : aosStrings)
+    {
+        uint32_t nStrSize = 0;
+        if (!oReader.ReadUInt32(nStrSize) ||
+            !oReader.ReadString(osStr, nStrSize))
+        {
+            ReportCorrupted();
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<VRTDataset> poDS(
+        OpenXML(osXML.c_str(), pszVRTPath, eAccess));
+    if (!poDS)
+        return nullptr;
+
+    // Value of VRT_SHARED_SOURCE when sources are not explicitly unshared,
+    // as in VRTSimpleSource::XMLInit()
+    const char *pszShared = CPLGetConfigOption("VRT_SHARED_SOURCE", nullptr);
+
+    uint32_t nTables = 0;
+    if (!oReader.ReadUInt32(nTables))
+    {
+        ReportCorrupted();
+        return nullptr;
+    }
+    for (uint32_t iTable = 0; iTable < nTables; ++iTable)
+    {
+        uint32_t nBand = 0;
+        uint32_t nSources = 0;
+        if (!oReader.ReadUInt32(nBand) || !oReader.ReadUInt32(nSources) ||
+            nSources > oReader.nRemaining / RECORD_SIZE ||
+            nSources > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+        {
+            ReportCorrupted();
+            return nullptr;
+        }
+        auto poBand =
+            nBand >= 1 && nBand <= static_cast<uint32_t>(poDS->GetRasterCount())
+                ? dynamic_cast<VRTSourcedRasterBand *>(
+                      poDS->GetRasterBand(static_cast<int>(nBand)))
+                : nullptr;
+        if (poBand == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Binary VRT: invalid band %u for source table", nBand);
+            return nullptr;
+        }
+
+        for (uint32_t iSource = 0; iSource < nSources; ++iSource)
+        {
+            GByte abyHeader[4] = {0, 0, 0, 0};
+            uint32_t nFilenameIdx = 0;
+            int32_t nResamplingIdx = 0;
+            int32_t nSrcBand = 0;
+            double adfValues[11] = {0};
+            CPL_IGNORE_RET_VAL(oReader.Read(abyHeader, sizeof(abyHeader)));
+            CPL_IGNORE_RET_VAL(oReader.ReadUInt32(nFilenameIdx));
+            CPL_IGNORE_RET_VAL(oReader.ReadInt32(nResamplingIdx));
+            CPL_IGNORE_RET_VAL(oReader.ReadInt32(nSrcBand));
+            for (double &dfVal : adfValues)
+                CPL_IGNORE_RET_VAL(oReader.ReadDouble(dfVal));
+
+            const GByte nType = abyHeader[0];
+            const GByte nFlags = abyHeader[1];
+            if ((nType != SOURCE_SIMPLE && nType != SOURCE_COMPLEX) ||
+                nFilenameIdx >= nStrings ||
+                (nResamplingIdx >= 0 &&
+                 static_cast<uint32_t>(nResamplingIdx) >= nStrings) ||
+                !GDALCheckBandCount(nSrcBand, 0) ||
+                !IsValidWindow(adfValues[0], adfValues[1], adfValues[2],
+                               adfValues[3]) ||
+                !IsValidWindow(adfValues[4], adfValues[5], adfValues[6],
+                               adfValues[7]))
+            {
+                ReportCorrupted();
+                return nullptr;
+            }
+
+            std::unique_ptr<VRTSimpleSource> poSource;
+            if (nType == SOURCE_COMPLEX)
+            {
+                auto poComplexSource = std::make_unique<VRTComplexSource>();
+                if (nFlags & FLAG_NODATA)
+                    poComplexSource->SetNoDataValue(adfValues[8]);
+                if (nFlags & FLAG_USE_MASK_BAND)
+                    poComplexSource->SetUseMaskBand(true);
+                if (nFlags & FLAG_SCALING_LINEAR)
+                    poComplexSource->SetLinearScaling(adfValues[9],
+                                                      adfValues[10]);
+                poSource = std::move(poComplexSource);
+            }
+            else
+            {
+                poSource = std::make_unique<VRTSimpleSource>();
+            }
+
+            const std::string &osFilename = aosStrings[nFilenameIdx];
+            const bool bRelativeToVRT = (nFlags & FLAG_RELATIVE_TO_VRT) != 0;
+            poSource->m_poMapSharedSources = &poDS->m_oMapSharedSources;
+            poSource->m_osSourceFileNameOri = osFilename;
+            poSource->m_bRelativeToVRTOri = bRelativeToVRT;
+            poSource->m_osSrcDSName = GDALDataset::BuildFilename(
+                osFilename.c_str(), pszVRTPath, bRelativeToVRT);
+            if (nFlags & FLAG_UNSHARED)
+                poSource->m_nExplicitSharedStatus = 0;
+            else if (pszShared)
+                poSource->m_nExplicitSharedStatus = CPLTestBool(pszShared);
+            poSource->m_nBand = nSrcBand;
+            poSource->m_bGetMaskBand = (nFlags & FLAG_MASK_BAND) != 0;
+            if (nResamplingIdx >= 0)
+                poSource->m_osResampling = aosStrings[nResamplingIdx];
+            poSource->m_dfSrcXOff = adfValues[0];
+            poSource->m_dfSrcYOff = adfValues[1];
+            poSource->m_dfSrcXSize = adfValues[2];
+            poSource->m_dfSrcYSize = adfValues[3];
+            poSource->m_dfDstXOff = adfValues[4];
+            poSource->m_dfDstYOff = adfValues[5];
+            poSource->m_dfDstXSize = adfValues[6];
+            poSource->m_dfDstYSize = adfValues[7];
+
+            poBand->AddSource(poSource.release());
+        }
+    }
+
+    return poDS.release();
+}
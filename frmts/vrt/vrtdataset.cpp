@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cmath>
 #include <set>
+#include <type_traits>
 #include <typeinfo>
 #include "gdal_proxy.h"
 
@@ -160,6 +161,17 @@ CPLErr VRTFlushCacheStruct<T>::FlushCache(T &obj, bool bAtClosing)
 
     obj.m_bNeedsFlush = false;
 
+    if constexpr (std::is_same_v<T, VRTDataset>)
+    {
+        if (EQUAL(CPLGetExtensionSafe(obj.GetDescription()).c_str(),
+                  VRTDataset::BINARY_EXTENSION))
+        {
+            if (!obj.WriteBinary(obj.GetDescription()))
+                eErr = CE_Failure;
+            return eErr;
+        }
+    }
+
     // Serialize XML representation to disk
     const std::string osVRTPath(CPLGetPathSafe(obj.GetDescription()));
     CPLXMLNode *psDSTree = obj.T::SerializeToXML(osVRTPath.c_str());
@@ -751,6 +763,10 @@ int VRTDataset::Identify(GDALOpenInfo *poOpenInfo)
                "<VRTDataset") != nullptr)
         return TRUE;
 
+    if (IsBinary(poOpenInfo->pabyHeader,
+                 static_cast<size_t>(poOpenInfo->nHeaderBytes)))
+        return TRUE;
+
     if (strstr(poOpenInfo->pszFilename, "<VRTDataset") != nullptr)
         return TRUE;
 
@@ -784,12 +800,13 @@ GDALDataset *VRTDataset::Open(GDALOpenInfo *poOpenInfo)
     VSILFILE *fp = poOpenInfo->fpL;
 
     char *pszVRTPath = nullptr;
+    vsi_l_offset nFileSize = 0;
     if (fp != nullptr)
     {
         poOpenInfo->fpL = nullptr;
 
         GByte *pabyOut = nullptr;
-        if (!VSIIngestFile(fp, poOpenInfo->pszFilename, &pabyOut, nullptr,
+        if (!VSIIngestFile(fp, poOpenInfo->pszFilename, &pabyOut, &nFileSize,
                            INT_MAX - 1))
         {
             CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
@@ -885,7 +902,13 @@ GDALDataset *VRTDataset::Open(GDALOpenInfo *poOpenInfo)
     /* -------------------------------------------------------------------- */
     /*      Turn the XML representation into a VRTDataset.                  */
     /* -------------------------------------------------------------------- */
-    VRTDataset *poDS = OpenXML(pszXML, pszVRTPath, poOpenInfo->eAccess);
+    VRTDataset *poDS =
+        IsBinary(reinterpret_cast<const GByte *>(pszXML),
+                 static_cast<size_t>(nFileSize))
+            ? OpenBinary(reinterpret_cast<const GByte *>(pszXML),
+                         static_cast<size_t>(nFileSize), pszVRTPath,
+                         poOpenInfo->eAccess)
+            : OpenXML(pszXML, pszVRTPath, poOpenInfo->eAccess);
 
     if (poDS != nullptr)
         poDS->m_bNeedsFlush = false;
@@ -1517,6 +1540,196 @@ GDALDataset *VRTDataset::OpenVRTProtocol(const char *pszSpec)
     return poDS;
 }
 
+/************************************************************************/
+/*                        SplitSourcesFromXML()                         */
+/************************************************************************/
+
+/* Copies pszXML into osSkeleton, except the core source elements that are
+ * direct children of a VRTRasterBand element. Each run of consecutive
+ * sources is replaced by a single placeholder element, whose "id" attribute
+ * is the index in oDeferredSources.aoGroups of the location of those sources
+ * in pszXML.
+ *
+ * This avoids building the XML tree of all sources of huge mosaics at once,
+ * which takes several times the size of the file in RAM.
+ *
+ * Returns false if the document does not look well-formed enough, in which
+ * case the caller should parse it as a whole.
+ */
+bool VRTDataset::SplitSourcesFromXML(const char *pszXML,
+                                     std::string &osSkeleton,
+                                     DeferredSources &oDeferredSources)
+{
+    auto &aoGroups = oDeferredSources.aoGroups;
+    const auto IsDeferredSource = [](const char *pszName, size_t nLen)
+    {
+        for (const char *pszSourceName :
+             {"SimpleSource", "ComplexSource", "AveragedSource",
+              "NoDataFromMaskSource"})
+        {
+            if (strlen(pszSourceName) == nLen &&
+                memcmp(pszName, pszSourceName, nLen) == 0)
+                return true;
+        }
+        return false;
+    };
+
+    // Whether we are in a (possibly mask) band of the top level dataset.
+    // Nested datasets, like the input of a VRTProcessedDataset, are left
+    // alone.
+    const auto IsInTopLevelBand = [](const std::vector<std::string> &aosStack)
+    {
+        if (aosStack.size() < 2 || aosStack.front() != "VRTDataset" ||
+            aosStack.back() != "VRTRasterBand")
+            return false;
+        for (size_t k = 1; k + 1 < aosStack.size(); ++k)
+        {
+            if (aosStack[k] != "VRTRasterBand" && aosStack[k] != "MaskBand")
+                return false;
+        }
+        return true;
+    };
+
+    // Names of the currently opened elements, outside of deferred sources
+    std::vector<std::string> aosStack;
+    // Depth of element nesting within the current deferred source, or 0
+    int nDepthInSource = 0;
+    size_t nSourceStart = 0;
+    // Start of the text not yet copied into osSkeleton
+    size_t nCopyStart = 0;
+    bool bInGroup = false;
+
+    size_t i = 0;
+    while (pszXML[i])
+    {
+        if (pszXML[i] != '<')
+        {
+            if (bInGroup && nDepthInSource == 0 &&
+                !isspace(static_cast<unsigned char>(pszXML[i])))
+            {
+                bInGroup = false;
+            }
+            ++i;
+            continue;
+        }
+
+        const char *pszEndMarker = nullptr;
+        if (STARTS_WITH(pszXML + i, "<!--"))
+            pszEndMarker = "-->";
+        else if (STARTS_WITH(pszXML + i, "<![CDATA["))
+            pszEndMarker = "]]>";
+        else if (pszXML[i + 1] == '?')
+            pszEndMarker = "?>";
+        else if (pszXML[i + 1] == '!')
+            pszEndMarker = ">";
+        if (pszEndMarker)
+        {
+            const char *pszEnd = strstr(pszXML + i + 2, pszEndMarker);
+            if (!pszEnd)
+                return false;
+            i = static_cast<size_t>(pszEnd - pszXML) + strlen(pszEndMarker);
+            if (nDepthInSource == 0)
+                bInGroup = false;
+            continue;
+        }
+
+        const size_t nTagStart = i;
+        const bool bClosing = pszXML[i + 1] == '/';
+        const size_t nNameStart = i + (bClosing ? 2 : 1);
+        size_t nNameEnd = nNameStart;
+        while (pszXML[nNameEnd] &&
+               !isspace(static_cast<unsigned char>(pszXML[nNameEnd])) &&
+               pszXML[nNameEnd] != '/' && pszXML[nNameEnd] != '>')
+        {
+            ++nNameEnd;
+        }
+
+        // Find the end of the tag, skipping quoted attribute values
+        size_t j = nNameEnd;
+        char chQuote = 0;
+        while (pszXML[j] && (chQuote || pszXML[j] != '>'))
+        {
+            if (chQuote)
+            {
+                if (pszXML[j] == chQuote)
+                    chQuote = 0;
+            }
+            else if (pszXML[j] == '"' || pszXML[j] == '\'')
+            {
+                chQuote = pszXML[j];
+            }
+            ++j;
+        }
+        if (!pszXML[j] || nNameEnd == nNameStart)
+            return false;
+        const bool bSelfClosing = !bClosing && pszXML[j - 1] == '/';
+        i = j + 1;
+
+        if (nDepthInSource > 0)
+        {
+            if (bClosing)
+                --nDepthInSource;
+            else if (!bSelfClosing)
+                ++nDepthInSource;
+            if (nDepthInSource == 0)
+            {
+                aoGroups.back().emplace_back(nSourceStart, i - nSourceStart);
+                nCopyStart = i;
+            }
+            continue;
+        }
+
+        if (bClosing)
+        {
+            if (aosStack.empty() ||
+                aosStack.back().compare(0, std::string::npos,
+                                        pszXML + nNameStart,
+                                        nNameEnd - nNameStart) != 0)
+            {
+                return false;
+            }
+            aosStack.pop_back();
+            bInGroup = false;
+        }
+        else if (IsInTopLevelBand(aosStack) &&
+                 IsDeferredSource(pszXML + nNameStart, nNameEnd - nNameStart))
+        {
+            osSkeleton.append(pszXML + nCopyStart, nTagStart - nCopyStart);
+            nCopyStart = nTagStart;
+            if (!bInGroup)
+            {
+                osSkeleton += CPLSPrintf(
+                    "<%s id=\"%d\"/>", DeferredSources::ELEMENT_NAME,
+                    static_cast<int>(aoGroups.size()));
+                aoGroups.emplace_back();
+                bInGroup = true;
+            }
+            if (bSelfClosing)
+            {
+                aoGroups.back().emplace_back(nTagStart, i - nTagStart);
+                nCopyStart = i;
+            }
+            else
+            {
+                nSourceStart = nTagStart;
+                nDepthInSource = 1;
+            }
+        }
+        else
+        {
+            if (!bSelfClosing)
+                aosStack.emplace_back(pszXML + nNameStart,
+                                      nNameEnd - nNameStart);
+            bInGroup = false;
+        }
+    }
+
+    if (nDepthInSource != 0 || !aosStack.empty())
+        return false;
+    osSkeleton.append(pszXML + nCopyStart, i - nCopyStart);
+    return true;
+}
+
 /************************************************************************/
 /*                              OpenXML()                               */
 /*                                                                      */
@@ -1529,9 +1742,37 @@ VRTDataset *VRTDataset::OpenXML(const char *pszXML, const char *pszVRTPath,
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Parse the XML.                                                  */
+    /*      Parse the XML. For large documents, the sources are not part    */
+    /*      of the tree, but parsed one at a time by the bands.             */
     /* -------------------------------------------------------------------- */
-    CPLXMLTreeCloser psTree(CPLParseXMLString(pszXML));
+    DeferredSources oDeferredSources;
+    std::string osSkeleton;
+    GIntBig nStreamingThreshold = 10 * 1024 * 1024;
+    if (const char *pszThreshold =
+            CPLGetConfigOption("VRT_SOURCE_STREAMING_THRESHOLD", nullptr))
+    {
+        if (CPLParseMemorySize(pszThreshold, &nStreamingThreshold, nullptr) !=
+            CE_None)
+        {
+            nStreamingThreshold = 10 * 1024 * 1024;
+        }
+    }
+    if (static_cast<GIntBig>(CPLStrnlen(
+            pszXML, static_cast<size_t>(nStreamingThreshold))) >=
+            nStreamingThreshold &&
+        SplitSourcesFromXML(pszXML, osSkeleton, oDeferredSources) &&
+        !oDeferredSources.aoGroups.empty())
+    {
+        CPLDebug("VRT", "Deferred parsing of sources of large VRT");
+        oDeferredSources.pszXML = pszXML;
+    }
+    else
+    {
+        oDeferredSources.aoGroups.clear();
+    }
+
+    CPLXMLTreeCloser psTree(CPLParseXMLString(
+        oDeferredSources.pszXML ? osSkeleton.c_str() : pszXML));
     if (psTree == nullptr)
         return nullptr;
 
@@ -1586,7 +1827,11 @@ VRTDataset *VRTDataset::OpenXML(const char *pszXML, const char *pszVRTPath,
         poDS->eAccess = eAccessIn;
     }
 
-    if (poDS->XMLInit(psRoot, pszVRTPath) != CE_None)
+    if (oDeferredSources.pszXML)
+        poDS->m_poDeferredSources = &oDeferredSources;
+    const CPLErr eErr = poDS->XMLInit(psRoot, pszVRTPath);
+    poDS->m_poDeferredSources = nullptr;
+    if (eErr != CE_None)
     {
         delete poDS;
         poDS = nullptr;
@@ -2664,6 +2909,167 @@ static bool CheckBandForOverview(GDALRasterBand *poBand,
     return true;
 }
 
+/************************************************************************/
+/*                        BuildMosaicOverviews()                        */
+/************************************************************************/
+
+/** Synthesize overview levels for mosaics, according to the
+ * VRT_MOSAIC_OVERVIEWS configuration option:
+ * - VIRTUAL: virtual overviews whose sources are the ones of the full
+ *   resolution bands, with their destination window scaled.
+ * - PERSISTENT: materialized .vrt.ovr sidecar, built at the first call if it
+ *   does not exist yet, so that the cost of reading zoomed-out views no
+ *   longer depends on the number of sources.
+ *
+ * Returns true if the dataset is a mosaic and the option is enabled.
+ */
+bool VRTDataset::BuildMosaicOverviews()
+{
+    if (m_bMosaicOverviewsTried)
+        return false;
+    m_bMosaicOverviewsTried = true;
+
+    const char *pszMode = CPLGetConfigOption("VRT_MOSAIC_OVERVIEWS", "NO");
+    const bool bPersistent = EQUAL(pszMode, "PERSISTENT");
+    if (!bPersistent && !EQUAL(pszMode, "VIRTUAL"))
+        return false;
+
+    // Check that all bands are only made of simple or complex sources with
+    // a destination window, and that at least one has several sources.
+    bool bIsMosaic = false;
+    const auto IsCompatibleBand = [&bIsMosaic](GDALRasterBand *poBand)
+    {
+        if (!cpl::down_cast<VRTRasterBand *>(poBand)->IsSourcedRasterBand())
+            return false;
+        auto poVRTBand = cpl::down_cast<VRTSourcedRasterBand *>(poBand);
+        if (poVRTBand->nSources > 1)
+            bIsMosaic = true;
+        for (int i = 0; i < poVRTBand->nSources; ++i)
+        {
+            VRTSource *poSource = poVRTBand->papoSources[i];
+            if (!poSource->IsSimpleSource())
+                return false;
+            auto poSimpleSource = cpl::down_cast<VRTSimpleSource *>(poSource);
+            const char *pszType = poSimpleSource->GetType();
+            if ((pszType != VRTSimpleSource::GetTypeStatic() &&
+                 pszType != VRTComplexSource::GetTypeStatic()) ||
+                !poSimpleSource->IsDstWinSet())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (int iBand = 0; iBand < nBands; iBand++)
+    {
+        if (!IsCompatibleBand(papoBands[iBand]))
+            return false;
+    }
+    if (m_poMaskBand && !IsCompatibleBand(m_poMaskBand))
+        return false;
+    if (!bIsMosaic)
+        return false;
+
+    // Same minimum overview size as for implicit overviews of single
+    // source VRTs.
+    constexpr int MIN_OVR_SIZE = 128;
+    std::vector<int> anFactors;
+    for (int nFactor = 2; nRasterXSize / nFactor >= MIN_OVR_SIZE &&
+                          nRasterYSize / nFactor >= MIN_OVR_SIZE;
+         nFactor *= 2)
+    {
+        anFactors.push_back(nFactor);
+    }
+    if (anFactors.empty())
+        return true;
+
+    if (bPersistent)
+    {
+        // Only possible for VRT files, whose sidecar can be written.
+        // Callers have already checked that there are no external overviews.
+        VSIStatBufL sStat;
+        if (STARTS_WITH_CI(GetDescription(), "<VRTDataset") ||
+            VSIStatL(GetDescription(), &sStat) != 0)
+        {
+            return true;
+        }
+
+        CPLDebug("VRT", "Building %s.ovr with %d levels", GetDescription(),
+                 static_cast<int>(anFactors.size()));
+        CPLConfigOptionSetter oSetter("VRT_VIRTUAL_OVERVIEWS", "NO", false);
+        if (BuildOverviews("NEAREST", static_cast<int>(anFactors.size()),
+                           anFactors.data(), 0, nullptr, nullptr, nullptr,
+                           nullptr) != CE_None)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Cannot build %s.ovr. Zoomed-out reads will use the "
+                     "sources",
+                     GetDescription());
+        }
+        return true;
+    }
+
+    for (const int nFactor : anFactors)
+    {
+        const int nOvrXSize = nRasterXSize / nFactor;
+        const int nOvrYSize = nRasterYSize / nFactor;
+        const double dfXRatio = static_cast<double>(nOvrXSize) / nRasterXSize;
+        const double dfYRatio = static_cast<double>(nOvrYSize) / nRasterYSize;
+
+        VRTDataset *poOvrVDS = new VRTDataset(nOvrXSize, nOvrYSize);
+        poOvrVDS->m_bMosaicOverviewsTried = true;
+        m_apoOverviews.push_back(poOvrVDS);
+
+        const auto CreateOverviewBand =
+            [poOvrVDS, nOvrXSize, nOvrYSize, dfXRatio,
+             dfYRatio](VRTSourcedRasterBand *poVRTBand)
+        {
+            VRTSourcedRasterBand *poOvrVRTBand = new VRTSourcedRasterBand(
+                poOvrVDS, poVRTBand->GetBand(), poVRTBand->GetRasterDataType(),
+                nOvrXSize, nOvrYSize);
+            poOvrVRTBand->CopyCommonInfoFrom(poVRTBand);
+            poOvrVRTBand->m_bNoDataValueSet = poVRTBand->m_bNoDataValueSet;
+            poOvrVRTBand->m_dfNoDataValue = poVRTBand->m_dfNoDataValue;
+            poOvrVRTBand->m_bHideNoDataValue = poVRTBand->m_bHideNoDataValue;
+
+            for (int i = 0; i < poVRTBand->nSources; ++i)
+            {
+                VRTSimpleSource *poSrcSource =
+                    cpl::down_cast<VRTSimpleSource *>(
+                        poVRTBand->papoSources[i]);
+                if (poSrcSource->GetType() == VRTSimpleSource::GetTypeStatic())
+                {
+                    poOvrVRTBand->AddSource(
+                        new VRTSimpleSource(poSrcSource, dfXRatio, dfYRatio));
+                }
+                else
+                {
+                    poOvrVRTBand->AddSource(new VRTComplexSource(
+                        cpl::down_cast<VRTComplexSource *>(poSrcSource),
+                        dfXRatio, dfYRatio));
+                }
+            }
+
+            return poOvrVRTBand;
+        };
+
+        for (int i = 0; i < nBands; i++)
+        {
+            auto poOvrVRTBand = CreateOverviewBand(
+                cpl::down_cast<VRTSourcedRasterBand *>(papoBands[i]));
+            poOvrVDS->SetBand(poOvrVDS->GetRasterCount() + 1, poOvrVRTBand);
+        }
+
+        if (m_poMaskBand)
+        {
+            poOvrVDS->SetMaskBand(CreateOverviewBand(
+                cpl::down_cast<VRTSourcedRasterBand *>(m_poMaskBand)));
+        }
+    }
+
+    return true;
+}
+
 void VRTDataset::BuildVirtualOverviews()
 {
     // Currently we expose virtual overviews only if the dataset is made of
@@ -2672,6 +3078,10 @@ void VRTDataset::BuildVirtualOverviews()
     if (!m_apoOverviews.empty() || !m_apoOverviewsBak.empty())
         return;
 
+    // Except for mosaics, on request
+    if (BuildMosaicOverviews())
+        return;
+
     int nOverviews = 0;
     GDALRasterBand *poFirstBand = nullptr;
     std::set<std::pair<int, int>> oSetOvrSizes;
@@ -30,6 +30,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <vector>
 
 CPLErr GDALRegisterDefaultPixelFunc();
@@ -290,6 +291,34 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
 
     bool m_bMultiThreadedRasterIOLastUsed = false;
 
+    //! Whether BuildMosaicOverviews() has already been called
+    bool m_bMosaicOverviewsTried = false;
+
+    bool BuildMosaicOverviews();
+
+    // Location, in the XML text of a large VRT, of the source elements that
+    // have been left out of its XML tree, so that bands parse them one at a
+    // time. Only set during OpenXML().
+    struct DeferredSources
+    {
+        static constexpr const char *ELEMENT_NAME = "VRTDeferredSources";
+
+        const char *pszXML = nullptr;
+        // Each group is a run of consecutive sources, as (offset, size) in
+        // pszXML, that replaces the placeholder element whose "id" attribute
+        // is the index of the group.
+        std::vector<std::vector<std::pair<size_t, size_t>>> aoGroups{};
+    };
+
+    const DeferredSources *m_poDeferredSources = nullptr;
+
+    // Bands whose sources are written in the binary part of a .vrtb file,
+    // and are thus left out of its XML part. Only set during WriteBinary().
+    std::set<const VRTRasterBand *> m_oSetBandsWithBinarySources{};
+
+    static bool SplitSourcesFromXML(const char *pszXML, std::string &osSkeleton,
+                                    DeferredSources &oDeferredSources);
+
     VRTRasterBand *InitBand(const char *pszSubclass, int nBand,
                             bool bAllowPansharpenedOrProcessed);
     static GDALDataset *OpenVRTProtocol(const char *pszSpec);
@@ -433,6 +462,15 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     static GDALDataset *Open(GDALOpenInfo *);
     static VRTDataset *OpenXML(const char *, const char * = nullptr,
                                GDALAccess eAccess = GA_ReadOnly);
+
+    // Binary VRT (.vrtb) encoding, implemented in vrtbinary.cpp
+    static constexpr const char *BINARY_SIGNATURE = "GDALVRTB";
+    static constexpr const char *BINARY_EXTENSION = "vrtb";
+    static bool IsBinary(const GByte *pabyData, size_t nSize);
+    static VRTDataset *OpenBinary(const GByte *pabyData, size_t nSize,
+                                  const char *pszVRTPath,
+                                  GDALAccess eAccess = GA_ReadOnly);
+    bool WriteBinary(const char *pszFilename);
     static GDALDataset *Create(const char *pszName, int nXSize, int nYSize,
                                int nBands, GDALDataType eType,
                                char **papszOptions);
@@ -468,6 +506,15 @@ class CPL_DLL VRTWarpedDataset final : public VRTDataset
     VRTWarpedDataset *CreateImplicitOverview(int iOvr) const;
     void CreateImplicitOverviews();
 
+    CPLErr
+    WarpMultiThreaded(int nXOff, int nYOff, int nXSize, int nYSize,
+                      GByte *pabyDst, GDALDataType eBufType, int nBandCount,
+                      const int *panBandMap, GSpacing nPixelSpace,
+                      GSpacing nLineSpace, GSpacing nBandSpace,
+                      const std::map<int, int> &oMapBandToWarpingBandIndex,
+                      int nSrcXOff, int nSrcYOff, int nSrcXSize,
+                      int nSrcYSize, bool &bTried);
+
     friend class VRTWarpedRasterBand;
 
     CPL_DISALLOW_COPY_ASSIGN(VRTWarpedDataset)
@@ -745,6 +792,19 @@ class VRTProcessedDataset final : public VRTDataset
     //! Value of CPLGetUsablePhysicalRAM() / 10 * 4
     GIntBig m_nAllowedRAMUsage = 0;
 
+    //! Identity of the source dataset for the result cache (empty if unknown)
+    std::string m_osSourceCacheKey{};
+
+    //! Number of leading steps whose function is pure (cacheable)
+    int m_nPureStepCount = 0;
+
+    //! Signature of the leading pure steps
+    std::string m_osPureStepsCacheKey{};
+
+    //! Number of pixels by which the processed region must be enlarged on
+    //! each side, so that steps reading neighbouring pixels get them.
+    int m_nHalo = 0;
+
     CPLErr Init(const CPLXMLNode *, const char *,
                 const VRTProcessedDataset *poParentDS,
                 GDALDataset *poParentSrcDS, int iOvrLevel);
@@ -753,6 +813,8 @@ class VRTProcessedDataset final : public VRTDataset
                    GDALDataType &eCurrentDT, int &nCurrentBandCount,
                    std::vector<double> &adfInNoData,
                    std::vector<double> &adfOutNoData);
+    bool ReadSourceRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize,
+                          GDALProgressFunc pfnProgress, void *pProgressData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize,
                        GDALProgressFunc pfnProgress, void *pProgressData);
 };
@@ -922,6 +984,16 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const;
 
+    // Spatial index of the destination windows of the sources, lazily (and
+    // incrementally) built for mosaics with many sources.
+    struct SourceIndex;
+    mutable std::unique_ptr<SourceIndex> m_poSourceIndex{};
+
+    void InvalidateSourceIndex();
+    void GetSourcesIntersecting(double dfXOff, double dfYOff, double dfXSize,
+                                double dfYSize,
+                                std::vector<int> &anSources) const;
+
     CPL_DISALLOW_COPY_ASSIGN(VRTSourcedRasterBand)
 
   protected:
@@ -1203,6 +1275,7 @@ class CPL_DLL VRTDerivedRasterBand CPL_NON_FINAL : public VRTSourcedRasterBand
 
     static const std::pair<PixelFunc, std::string> *
     GetPixelFunction(const char *pszFuncNameIn);
+    static void SetPixelFunctionReentrant(const char *pszFuncNameIn);
 
     void SetPixelFunctionName(const char *pszFuncNameIn);
     void SetSourceTransferType(GDALDataType eDataType);
@@ -1400,6 +1473,9 @@ class CPL_DLL VRTSimpleSource CPL_NON_FINAL : public VRTSource
                m_dfDstXSize != UNINIT_WINDOW || m_dfDstYSize != UNINIT_WINDOW;
     }
 
+    std::string GetSourceFilenameToSerialize(const char *pszVRTPath,
+                                             int &bRelativeToVRT) const;
+    bool IsSerializedAsUnshared() const;
     void AddSourceFilenameNode(const char *pszVRTPath, CPLXMLNode *psSrc);
 
   public:
@@ -1589,6 +1665,8 @@ class CPL_DLL VRTComplexSource CPL_NON_FINAL : public VRTSimpleSource
 {
     CPL_DISALLOW_COPY_ASSIGN(VRTComplexSource)
 
+    friend class VRTDataset;
+
   protected:
     static constexpr int PROCESSING_FLAG_NODATA = 1 << 0;
     static constexpr int PROCESSING_FLAG_USE_MASK_BAND =
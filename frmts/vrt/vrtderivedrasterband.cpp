@@ -15,11 +15,15 @@
 #include "cpl_minixml.h"
 #include "cpl_string.h"
 #include "vrtdataset.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
+#include "gdal_thread_pool.h"
 #include "gdalpython.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <set>
 #include <vector>
 #include <utility>
 
@@ -231,6 +235,16 @@ GetGlobalMapPixelFunction()
     return gosMapPixelFunction;
 }
 
+/************************************************************************/
+/*                  GetGlobalSetReentrantPixelFunction()                */
+/************************************************************************/
+
+static std::set<std::string> &GetGlobalSetReentrantPixelFunction()
+{
+    static std::set<std::string> gosSetReentrantPixelFunction;
+    return gosSetReentrantPixelFunction;
+}
+
 /************************************************************************/
 /*                           AddPixelFunction()                         */
 /************************************************************************/
@@ -261,6 +275,7 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFunc(
         return CE_None;
     }
 
+    GetGlobalSetReentrantPixelFunction().erase(pszName);
     GetGlobalMapPixelFunction()[pszName] = {
         [pfnNewFunction](void **papoSources, int nSources, void *pData,
                          int nBufXSize, int nBufYSize, GDALDataType eSrcType,
@@ -304,6 +319,7 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFuncWithArgs(
         return CE_None;
     }
 
+    GetGlobalSetReentrantPixelFunction().erase(pszName);
     GetGlobalMapPixelFunction()[pszName] = {pfnNewFunction,
                                             pszMetadata ? pszMetadata : ""};
 
@@ -370,6 +386,26 @@ VRTDerivedRasterBand::GetPixelFunction(const char *pszFuncNameIn)
     return &(oIter->second);
 }
 
+/************************************************************************/
+/*                      SetPixelFunctionReentrant()                     */
+/************************************************************************/
+
+/**
+ * Declare that a registered pixel function can be called concurrently
+ * from several threads, on different lines of the same request.
+ *
+ * This allows IRasterIO() to split large requests into chunks of lines
+ * processed by the global thread pool. The flag is cleared if the pixel
+ * function is registered again.
+ *
+ * @param pszFuncNameIn The name associated with the pixel function.
+ */
+void VRTDerivedRasterBand::SetPixelFunctionReentrant(const char *pszFuncNameIn)
+{
+    if (GetPixelFunction(pszFuncNameIn))
+        GetGlobalSetReentrantPixelFunction().insert(pszFuncNameIn);
+}
+
 /************************************************************************/
 /*                         SetPixelFunctionName()                       */
 /************************************************************************/
@@ -1398,10 +1434,83 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
         papszArgs =
             CSLSetNameValue(papszArgs, "SOURCE_NAMES", osSourceNames.c_str());
 
-        eErr = (poPixelFunc->first)(
-            static_cast<void **>(pBuffers), nBufferCount, pData, nBufXSize,
-            nBufYSize, eSrcType, eBufType, static_cast<int>(nPixelSpace),
-            static_cast<int>(nLineSpace), papszArgs);
+        // Built-in pixel functions are CPU bound and only depend on the
+        // values of the pixels at the same location in the sources, so
+        // large requests can be split into chunks of lines processed in
+        // parallel.
+        constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_PIXEL_FUNC =
+            1000 * 1000;
+        int nMaxThreads = 0;
+        CPLWorkerThreadPool *psThreadPool = nullptr;
+        if (nBufferRadius == 0 && nBufYSize > 1 &&
+            static_cast<int64_t>(nBufXSize) * nBufYSize >=
+                MINIMUM_PIXEL_COUNT_FOR_THREADED_PIXEL_FUNC &&
+            cpl::contains(GetGlobalSetReentrantPixelFunction(), pszFuncName) &&
+            (nMaxThreads = VRTDataset::GetNumThreads(poDS)) > 1 &&
+            (psThreadPool = GDALGetGlobalThreadPool(
+                 std::min(nMaxThreads, nBufYSize))) != nullptr)
+        {
+            const int nChunks =
+                std::min(nBufYSize, psThreadPool->GetThreadCount());
+            const int nLinesPerChunk = DIV_ROUND_UP(nBufYSize, nChunks);
+            CPLDebugOnly("VRT",
+                         "IRasterIO(): running pixel function %s "
+                         "by chunks of %d lines on %d threads",
+                         pszFuncName, nLinesPerChunk, nChunks);
+
+            CPLErrorAccumulator errorAccumulator;
+            std::atomic<bool> bSuccess = true;
+            auto poQueue = psThreadPool->CreateJobQueue();
+            for (int iYStart = 0; iYStart < nBufYSize;
+                 iYStart += nLinesPerChunk)
+            {
+                const int nChunkYSize =
+                    std::min(nLinesPerChunk, nBufYSize - iYStart);
+                const auto Job = [&, iYStart, nChunkYSize]()
+                {
+                    if (!bSuccess)
+                        return;
+                    auto oAccumulator =
+                        errorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+
+                    std::vector<void *> apChunkBuffers(nBufferCount);
+                    for (int iBuffer = 0; iBuffer < nBufferCount; iBuffer++)
+                    {
+                        apChunkBuffers[iBuffer] =
+                            static_cast<GByte *>(pBuffers[iBuffer]) +
+                            static_cast<size_t>(iYStart) * nBufXSize *
+                                nSrcTypeSize;
+                    }
+                    if ((poPixelFunc->first)(
+                            apChunkBuffers.data(), nBufferCount,
+                            static_cast<GByte *>(pData) + iYStart * nLineSpace,
+                            nBufXSize, nChunkYSize, eSrcType, eBufType,
+                            static_cast<int>(nPixelSpace),
+                            static_cast<int>(nLineSpace),
+                            papszArgs) != CE_None)
+                    {
+                        bSuccess = false;
+                    }
+                };
+                if (!poQueue->SubmitJob(Job))
+                {
+                    bSuccess = false;
+                    break;
+                }
+            }
+            poQueue->WaitCompletion();
+
+            errorAccumulator.ReplayErrors();
+            eErr = bSuccess ? CE_None : CE_Failure;
+        }
+        else
+        {
+            eErr = (poPixelFunc->first)(
+                static_cast<void **>(pBuffers), nBufferCount, pData, nBufXSize,
+                nBufYSize, eSrcType, eBufType, static_cast<int>(nPixelSpace),
+                static_cast<int>(nLineSpace), papszArgs);
+        }
 
         CSLDestroy(papszArgs);
     }
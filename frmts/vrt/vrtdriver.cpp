@@ -19,6 +19,7 @@
 #include "gdal_frmts.h"
 
 #include <mutex>
+#include <typeinfo>
 
 /*! @cond Doxygen_Suppress */
 
@@ -181,6 +182,17 @@ static GDALDataset *VRTCreateCopy(const char *pszFilename, GDALDataset *poSrcDS,
     /* -------------------------------------------------------------------- */
     if (auto poSrcVRTDS = dynamic_cast<VRTDataset *>(poSrcDS))
     {
+        // Binary encoding, only available for plain VRTDataset
+        if (typeid(*poSrcVRTDS) == typeid(VRTDataset) &&
+            EQUAL(CPLGetExtensionSafe(pszFilename).c_str(),
+                  VRTDataset::BINARY_EXTENSION))
+        {
+            poSrcVRTDS->UnsetPreservedRelativeFilenames();
+            if (!poSrcVRTDS->WriteBinary(pszFilename))
+                return nullptr;
+            return GDALDataset::Open(pszFilename,
+                                     GDAL_OF_RASTER | GDAL_OF_UPDATE);
+        }
 
         /* --------------------------------------------------------------------
          */
@@ -508,6 +520,7 @@ void GDALRegister_VRT()
     poDriver->SetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER, "YES");
     poDriver->SetMetadataItem(GDAL_DMD_LONGNAME, "Virtual Raster");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "vrt");
+    poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "vrt vrtb");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/vrt.html");
     poDriver->SetMetadataItem(
         GDAL_DMD_CREATIONDATATYPES,
@@ -14,6 +14,8 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -165,6 +167,55 @@ class MuParserExpression : public MathExpression
 
 #endif
 
+/**
+ * Expression compiled into a sequence of operations, each one applied on
+ * whole blocks of values, instead of being interpreted value after value.
+ *
+ * This is used as a fast path for the muparser dialect: only the subset of
+ * its syntax whose result does not depend on the muparser version is
+ * supported (arithmetic, comparison and logical operators, ternary operator,
+ * usual unary mathematical functions, min, max, sum and avg).
+ */
+class VectorizedExpression
+{
+  public:
+    /** Compiled operations, private to the implementation. */
+    struct Program;
+
+    ~VectorizedExpression();
+
+    /**
+     * Compile an expression.
+     *
+     * @param osExpression The body of the expression, e.g. "(B1 - B2) / B3"
+     * @param aosVariables Names of the variables, in the order of the value
+     *                     arrays passed to Evaluate().
+     * @param bBandsVector Whether the BANDS vector, made of all variables, can
+     *                     be used as an argument of variadic functions.
+     * @return the compiled expression, or nullptr, without emitting any error,
+     *         if the expression uses unsupported constructs or is invalid.
+     */
+    static std::unique_ptr<VectorizedExpression>
+    Compile(std::string_view osExpression,
+            const std::vector<std::string> &aosVariables, bool bBandsVector);
+
+    /**
+     * Evaluate the expression on nCount values.
+     *
+     * @param papadfVariables Array of pointers to the nCount values of each
+     *                        variable.
+     * @param padfResults Array of nCount values receiving the results.
+     * @param nCount Number of values.
+     */
+    void Evaluate(const double *const *papadfVariables, double *padfResults,
+                  size_t nCount);
+
+  private:
+    std::unique_ptr<Program> m_poProgram;
+
+    explicit VectorizedExpression(std::unique_ptr<Program> poProgram);
+};
+
 inline std::unique_ptr<MathExpression>
 MathExpression::Create([[maybe_unused]] const char *pszExpression,
                        const char *pszDialect)
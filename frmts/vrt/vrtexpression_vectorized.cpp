@@ -0,0 +1,959 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "vrtexpression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+/************************************************************************/
+/*                                 Op                                   */
+/************************************************************************/
+
+enum class Op
+{
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    NEG,
+    LT,
+    GT,
+    LE,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+    SELECT,
+    MIN,
+    MAX,
+    SIN,
+    COS,
+    TAN,
+    ASIN,
+    ACOS,
+    ATAN,
+    SINH,
+    COSH,
+    TANH,
+    ASINH,
+    ACOSH,
+    ATANH,
+    LOG2,
+    LOG10,
+    LN,
+    EXP,
+    SQRT,
+    ABS,
+    SIGN,
+};
+
+/************************************************************************/
+/*                              ApplyOp()                               */
+/************************************************************************/
+
+// Semantics follow the ones of the muparser built-in operators and
+// functions, in particular regarding NaN handling by comparisons, logical
+// operators, min() and max().
+template <Op eOp> inline double ApplyOp(double a, double b, double c)
+{
+    if constexpr (eOp == Op::ADD)
+        return a + b;
+    else if constexpr (eOp == Op::SUB)
+        return a - b;
+    else if constexpr (eOp == Op::MUL)
+        return a * b;
+    else if constexpr (eOp == Op::DIV)
+        return a / b;
+    else if constexpr (eOp == Op::POW)
+        return std::pow(a, b);
+    else if constexpr (eOp == Op::NEG)
+        return -a;
+    else if constexpr (eOp == Op::LT)
+        return a < b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::GT)
+        return a > b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::LE)
+        return a <= b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::GE)
+        return a >= b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::EQ)
+        return a == b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::NE)
+        return a != b ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::AND)
+        return (a != 0 && b != 0) ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::OR)
+        return (a != 0 || b != 0) ? 1.0 : 0.0;
+    else if constexpr (eOp == Op::SELECT)
+        return a != 0 ? b : c;
+    else if constexpr (eOp == Op::MIN)
+        return b < a ? b : a;  // std::min(a, b)
+    else if constexpr (eOp == Op::MAX)
+        return a < b ? b : a;  // std::max(a, b)
+    else if constexpr (eOp == Op::SIN)
+        return std::sin(a);
+    else if constexpr (eOp == Op::COS)
+        return std::cos(a);
+    else if constexpr (eOp == Op::TAN)
+        return std::tan(a);
+    else if constexpr (eOp == Op::ASIN)
+        return std::asin(a);
+    else if constexpr (eOp == Op::ACOS)
+        return std::acos(a);
+    else if constexpr (eOp == Op::ATAN)
+        return std::atan(a);
+    else if constexpr (eOp == Op::SINH)
+        return std::sinh(a);
+    else if constexpr (eOp == Op::COSH)
+        return std::cosh(a);
+    else if constexpr (eOp == Op::TANH)
+        return std::tanh(a);
+    else if constexpr (eOp == Op::ASINH)
+        return std::asinh(a);
+    else if constexpr (eOp == Op::ACOSH)
+        return std::acosh(a);
+    else if constexpr (eOp == Op::ATANH)
+        return std::atanh(a);
+    else if constexpr (eOp == Op::LOG2)
+        return std::log2(a);
+    else if constexpr (eOp == Op::LOG10)
+        return std::log10(a);
+    else if constexpr (eOp == Op::LN)
+        return std::log(a);
+    else if constexpr (eOp == Op::EXP)
+        return std::exp(a);
+    else if constexpr (eOp == Op::SQRT)
+        return std::sqrt(a);
+    else if constexpr (eOp == Op::ABS)
+        return std::fabs(a);
+    else
+    {
+        static_assert(eOp == Op::SIGN);
+        return a < 0 ? -1.0 : a > 0 ? 1.0 : 0.0;
+    }
+}
+
+/************************************************************************/
+/*                            ApplyOnBlock()                            */
+/************************************************************************/
+
+template <Op eOp>
+static void ApplyOnBlock(const double *a, const double *b, const double *c,
+                         double *d, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        d[i] = ApplyOp<eOp>(a[i], b[i], c[i]);
+}
+
+static void ApplyOnBlock(Op eOp, const double *a, const double *b,
+                         const double *c, double *d, size_t n)
+{
+#define APPLY_OP(x)                                                            \
+    case Op::x:                                                                \
+        ApplyOnBlock<Op::x>(a, b, c, d, n);                                    \
+        break
+
+    switch (eOp)
+    {
+        APPLY_OP(ADD);
+        APPLY_OP(SUB);
+        APPLY_OP(MUL);
+        APPLY_OP(DIV);
+        APPLY_OP(POW);
+        APPLY_OP(NEG);
+        APPLY_OP(LT);
+        APPLY_OP(GT);
+        APPLY_OP(LE);
+        APPLY_OP(GE);
+        APPLY_OP(EQ);
+        APPLY_OP(NE);
+        APPLY_OP(AND);
+        APPLY_OP(OR);
+        APPLY_OP(SELECT);
+        APPLY_OP(MIN);
+        APPLY_OP(MAX);
+        APPLY_OP(SIN);
+        APPLY_OP(COS);
+        APPLY_OP(TAN);
+        APPLY_OP(ASIN);
+        APPLY_OP(ACOS);
+        APPLY_OP(ATAN);
+        APPLY_OP(SINH);
+        APPLY_OP(COSH);
+        APPLY_OP(TANH);
+        APPLY_OP(ASINH);
+        APPLY_OP(ACOSH);
+        APPLY_OP(ATANH);
+        APPLY_OP(LOG2);
+        APPLY_OP(LOG10);
+        APPLY_OP(LN);
+        APPLY_OP(EXP);
+        APPLY_OP(SQRT);
+        APPLY_OP(ABS);
+        APPLY_OP(SIGN);
+    }
+
+#undef APPLY_OP
+}
+
+/************************************************************************/
+/*                               Operand                                */
+/************************************************************************/
+
+struct Operand
+{
+    enum class Kind
+    {
+        CONSTANT,
+        VARIABLE,
+        TEMPORARY,
+    };
+
+    Kind eKind = Kind::CONSTANT;
+    double dfValue = 0;  // for CONSTANT
+    int nIndex = 0;      // index of the variable, temporary or constant block
+};
+
+/************************************************************************/
+/*                             Instruction                              */
+/************************************************************************/
+
+struct Instruction
+{
+    Op eOp = Op::ADD;
+    Operand oA{};
+    Operand oB{};
+    Operand oC{};
+    int nDst = 0;  // index of the temporary receiving the result
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                   VectorizedExpression::Program                      */
+/************************************************************************/
+
+struct VectorizedExpression::Program
+{
+    // Number of values processed by each instruction at once. Small enough
+    // for the temporaries to stay in L1/L2 cache.
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    std::vector<Instruction> aoInstructions{};
+    Operand oResult{};
+    int nTemporaries = 0;
+    std::vector<double> adfConstantBlocks{};
+    std::vector<double> adfTemporaryBlocks{};
+};
+
+namespace
+{
+
+/************************************************************************/
+/*                               Compiler                               */
+/************************************************************************/
+
+// Recursive descent parser following the operator precedence of muparser,
+// from lowest to highest: ?:, ||, &&, comparisons, + -, * / and unary
+// minus, ^. It emits instructions as it goes, folding constant operations.
+class Compiler
+{
+  public:
+    Compiler(std::string_view osExpression,
+             const std::vector<std::string> &aosVariables, bool bBandsVector,
+             VectorizedExpression::Program &oProgram)
+        : m_osExpression(osExpression), m_aosVariables(aosVariables),
+          m_bBandsVector(bBandsVector), m_oProgram(oProgram)
+    {
+    }
+
+    bool Compile();
+
+  private:
+    static constexpr int MAX_DEPTH = 256;
+
+    const std::string_view m_osExpression;
+    const std::vector<std::string> &m_aosVariables;
+    const bool m_bBandsVector;
+    VectorizedExpression::Program &m_oProgram;
+    size_t m_nPos = 0;
+    int m_nDepth = 0;
+    std::vector<double> m_adfConstants{};
+
+    void SkipSpaces();
+    bool Consume(const char *pszToken);
+    bool PeekIs(const char *pszToken);
+    bool ParseIdentifier(std::string &osName);
+
+    Operand Emit(Op eOp, const Operand &oA, const Operand &oB,
+                 const Operand &oC);
+    Operand Emit(Op eOp, const Operand &oA, const Operand &oB);
+    Operand Emit(Op eOp, const Operand &oA);
+    Operand AllocateConstantBlock(const Operand &oOperand);
+
+    bool ParseTernary(Operand &oRes);
+    bool ParseOr(Operand &oRes);
+    bool ParseAnd(Operand &oRes);
+    bool ParseComparison(Operand &oRes);
+    bool ParseAdditive(Operand &oRes);
+    bool ParseMultiplicative(Operand &oRes);
+    bool ParseUnary(Operand &oRes);
+    bool ParsePower(Operand &oRes);
+    bool ParsePrimary(Operand &oRes);
+    bool ParseFunctionArguments(std::vector<Operand> &aoArgs);
+};
+
+/************************************************************************/
+/*                            SkipSpaces()                              */
+/************************************************************************/
+
+void Compiler::SkipSpaces()
+{
+    while (m_nPos < m_osExpression.size() &&
+           isspace(static_cast<unsigned char>(m_osExpression[m_nPos])))
+        ++m_nPos;
+}
+
+/************************************************************************/
+/*                          PeekIs() / Consume()                        */
+/************************************************************************/
+
+bool Compiler::PeekIs(const char *pszToken)
+{
+    SkipSpaces();
+    return m_osExpression.substr(m_nPos).substr(0, strlen(pszToken)) ==
+           pszToken;
+}
+
+bool Compiler::Consume(const char *pszToken)
+{
+    if (!PeekIs(pszToken))
+        return false;
+    m_nPos += strlen(pszToken);
+    return true;
+}
+
+/************************************************************************/
+/*                          ParseIdentifier()                           */
+/************************************************************************/
+
+static bool IsNameChar(char ch)
+{
+    return isalnum(static_cast<unsigned char>(ch)) || ch == '_';
+}
+
+bool Compiler::ParseIdentifier(std::string &osName)
+{
+    SkipSpaces();
+    const size_t nStart = m_nPos;
+    if (nStart == m_osExpression.size() ||
+        !(isalpha(static_cast<unsigned char>(m_osExpression[nStart])) ||
+          m_osExpression[nStart] == '_'))
+    {
+        return false;
+    }
+    while (m_nPos < m_osExpression.size() &&
+           IsNameChar(m_osExpression[m_nPos]))
+        ++m_nPos;
+    osName = std::string(m_osExpression.substr(nStart, m_nPos - nStart));
+
+    // Variables such as "X[1]" emulating vector elements (cf Sanitize() in
+    // vrtexpression_muparser.cpp)
+    if (m_nPos < m_osExpression.size() && m_osExpression[m_nPos] == '[')
+    {
+        const size_t nEnd = m_osExpression.find(']', m_nPos);
+        if (nEnd != std::string_view::npos)
+        {
+            const std::string osCandidate(
+                m_osExpression.substr(nStart, nEnd + 1 - nStart));
+            if (std::find(m_aosVariables.begin(), m_aosVariables.end(),
+                          osCandidate) != m_aosVariables.end())
+            {
+                osName = osCandidate;
+                m_nPos = nEnd + 1;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Emit()                                */
+/************************************************************************/
+
+Operand Compiler::AllocateConstantBlock(const Operand &oOperand)
+{
+    if (oOperand.eKind != Operand::Kind::CONSTANT)
+        return oOperand;
+    Operand oRet(oOperand);
+    oRet.nIndex = static_cast<int>(m_adfConstants.size());
+    m_adfConstants.push_back(oOperand.dfValue);
+    return oRet;
+}
+
+Operand Compiler::Emit(Op eOp, const Operand &oA, const Operand &oB,
+                       const Operand &oC)
+{
+    if (oA.eKind == Operand::Kind::CONSTANT &&
+        oB.eKind == Operand::Kind::CONSTANT &&
+        oC.eKind == Operand::Kind::CONSTANT)
+    {
+        Operand oRes;
+        ApplyOnBlock(eOp, &oA.dfValue, &oB.dfValue, &oC.dfValue,
+                     &oRes.dfValue, 1);
+        return oRes;
+    }
+
+    Instruction oInstr;
+    oInstr.eOp = eOp;
+    oInstr.oA = AllocateConstantBlock(oA);
+    oInstr.oB = AllocateConstantBlock(oB);
+    oInstr.oC = AllocateConstantBlock(oC);
+    oInstr.nDst = m_oProgram.nTemporaries++;
+    m_oProgram.aoInstructions.push_back(oInstr);
+
+    Operand oRes;
+    oRes.eKind = Operand::Kind::TEMPORARY;
+    oRes.nIndex = oInstr.nDst;
+    return oRes;
+}
+
+Operand Compiler::Emit(Op eOp, const Operand &oA, const Operand &oB)
+{
+    return Emit(eOp, oA, oB, oA);
+}
+
+Operand Compiler::Emit(Op eOp, const Operand &oA)
+{
+    return Emit(eOp, oA, oA, oA);
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+bool Compiler::Compile()
+{
+    // Variable names must be valid muparser names, otherwise muparser
+    // would emit an error.
+    for (const auto &osVar : m_aosVariables)
+    {
+        const auto nBracketPos = osVar.find('[');
+        const std::string osBaseName = osVar.substr(0, nBracketPos);
+        if (osBaseName.empty() ||
+            isdigit(static_cast<unsigned char>(osBaseName[0])) ||
+            !std::all_of(osBaseName.begin(), osBaseName.end(), IsNameChar))
+        {
+            return false;
+        }
+        if (nBracketPos != std::string::npos &&
+            (osVar.back() != ']' ||
+             osVar.find('[', nBracketPos + 1) != std::string::npos))
+        {
+            return false;
+        }
+    }
+
+    Operand oRes;
+    if (!ParseTernary(oRes))
+        return false;
+    SkipSpaces();
+    if (m_nPos != m_osExpression.size())
+        return false;
+
+    m_oProgram.oResult = oRes;
+
+    constexpr size_t BLOCK_SIZE = VectorizedExpression::Program::BLOCK_SIZE;
+    try
+    {
+        m_oProgram.adfConstantBlocks.resize(m_adfConstants.size() *
+                                            BLOCK_SIZE);
+        m_oProgram.adfTemporaryBlocks.resize(
+            static_cast<size_t>(m_oProgram.nTemporaries) * BLOCK_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < m_adfConstants.size(); ++i)
+    {
+        std::fill_n(m_oProgram.adfConstantBlocks.begin() + i * BLOCK_SIZE,
+                    BLOCK_SIZE, m_adfConstants[i]);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                            ParseTernary()                            */
+/************************************************************************/
+
+bool Compiler::ParseTernary(Operand &oRes)
+{
+    if (++m_nDepth > MAX_DEPTH)
+        return false;
+
+    Operand oCond;
+    if (!ParseOr(oCond))
+        return false;
+    if (Consume("?"))
+    {
+        Operand oIfTrue, oIfFalse;
+        if (!ParseTernary(oIfTrue) || !Consume(":") ||
+            !ParseTernary(oIfFalse))
+        {
+            return false;
+        }
+        oRes = Emit(Op::SELECT, oCond, oIfTrue, oIfFalse);
+    }
+    else
+    {
+        oRes = oCond;
+    }
+
+    --m_nDepth;
+    return true;
+}
+
+/************************************************************************/
+/*                         ParseOr() / ParseAnd()                       */
+/************************************************************************/
+
+bool Compiler::ParseOr(Operand &oRes)
+{
+    if (!ParseAnd(oRes))
+        return false;
+    while (Consume("||"))
+    {
+        Operand oRight;
+        if (!ParseAnd(oRight))
+            return false;
+        oRes = Emit(Op::OR, oRes, oRight);
+    }
+    return true;
+}
+
+bool Compiler::ParseAnd(Operand &oRes)
+{
+    if (!ParseComparison(oRes))
+        return false;
+    while (Consume("&&"))
+    {
+        Operand oRight;
+        if (!ParseComparison(oRight))
+            return false;
+        oRes = Emit(Op::AND, oRes, oRight);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ParseComparison()                           */
+/************************************************************************/
+
+bool Compiler::ParseComparison(Operand &oRes)
+{
+    if (!ParseAdditive(oRes))
+        return false;
+    while (true)
+    {
+        Op eOp;
+        // Two-character operators must be tested first
+        if (Consume("<="))
+            eOp = Op::LE;
+        else if (Consume(">="))
+            eOp = Op::GE;
+        else if (Consume("=="))
+            eOp = Op::EQ;
+        else if (Consume("!="))
+            eOp = Op::NE;
+        else if (Consume("<"))
+            eOp = Op::LT;
+        else if (Consume(">"))
+            eOp = Op::GT;
+        else
+            break;
+        Operand oRight;
+        if (!ParseAdditive(oRight))
+            return false;
+        oRes = Emit(eOp, oRes, oRight);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  ParseAdditive() / ParseMultiplicative()             */
+/************************************************************************/
+
+bool Compiler::ParseAdditive(Operand &oRes)
+{
+    if (!ParseMultiplicative(oRes))
+        return false;
+    while (true)
+    {
+        Op eOp;
+        if (Consume("+"))
+            eOp = Op::ADD;
+        else if (Consume("-"))
+            eOp = Op::SUB;
+        else
+            break;
+        Operand oRight;
+        if (!ParseMultiplicative(oRight))
+            return false;
+        oRes = Emit(eOp, oRes, oRight);
+    }
+    return true;
+}
+
+bool Compiler::ParseMultiplicative(Operand &oRes)
+{
+    if (!ParseUnary(oRes))
+        return false;
+    while (true)
+    {
+        Op eOp;
+        if (Consume("*"))
+            eOp = Op::MUL;
+        else if (Consume("/"))
+            eOp = Op::DIV;
+        else
+            break;
+        Operand oRight;
+        if (!ParseUnary(oRight))
+            return false;
+        oRes = Emit(eOp, oRes, oRight);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      ParseUnary() / ParsePower()                     */
+/************************************************************************/
+
+bool Compiler::ParseUnary(Operand &oRes)
+{
+    if (++m_nDepth > MAX_DEPTH)
+        return false;
+
+    bool bRet;
+    if (Consume("-"))
+    {
+        bRet = ParseUnary(oRes);
+        if (bRet)
+            oRes = Emit(Op::NEG, oRes);
+    }
+    else if (Consume("+"))
+    {
+        bRet = ParseUnary(oRes);
+    }
+    else
+    {
+        bRet = ParsePower(oRes);
+    }
+
+    --m_nDepth;
+    return bRet;
+}
+
+bool Compiler::ParsePower(Operand &oRes)
+{
+    if (!ParsePrimary(oRes))
+        return false;
+    if (Consume("^"))
+    {
+        // The exponent may have a sign, as in "x^-2"
+        bool bNeg = false;
+        while (true)
+        {
+            if (Consume("-"))
+                bNeg = !bNeg;
+            else if (!Consume("+"))
+                break;
+        }
+        Operand oExponent;
+        if (!ParsePrimary(oExponent))
+            return false;
+        if (bNeg)
+            oExponent = Emit(Op::NEG, oExponent);
+        // The associativity of chained powers changed across muparser
+        // versions: let muparser deal with them.
+        if (PeekIs("^"))
+            return false;
+        oRes = Emit(Op::POW, oRes, oExponent);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       ParseFunctionArguments()                       */
+/************************************************************************/
+
+bool Compiler::ParseFunctionArguments(std::vector<Operand> &aoArgs)
+{
+    if (!Consume("("))
+        return false;
+    do
+    {
+        // BANDS expands to the list of all variables
+        const size_t nPosBefore = m_nPos;
+        std::string osName;
+        if (m_bBandsVector && ParseIdentifier(osName) && osName == "BANDS" &&
+            (PeekIs(",") || PeekIs(")")) &&
+            std::find(m_aosVariables.begin(), m_aosVariables.end(),
+                      "BANDS") == m_aosVariables.end())
+        {
+            for (int i = 0; i < static_cast<int>(m_aosVariables.size()); ++i)
+            {
+                Operand oVar;
+                oVar.eKind = Operand::Kind::VARIABLE;
+                oVar.nIndex = i;
+                aoArgs.push_back(oVar);
+            }
+            continue;
+        }
+        m_nPos = nPosBefore;
+
+        Operand oArg;
+        if (!ParseTernary(oArg))
+            return false;
+        aoArgs.push_back(oArg);
+    } while (Consume(","));
+    return Consume(")") && !aoArgs.empty();
+}
+
+/************************************************************************/
+/*                            ParsePrimary()                            */
+/************************************************************************/
+
+bool Compiler::ParsePrimary(Operand &oRes)
+{
+    SkipSpaces();
+    if (m_nPos == m_osExpression.size())
+        return false;
+
+    const char chFirst = m_osExpression[m_nPos];
+
+    if (chFirst == '(')
+    {
+        ++m_nPos;
+        return ParseTernary(oRes) && Consume(")");
+    }
+
+    if (isdigit(static_cast<unsigned char>(chFirst)) || chFirst == '.')
+    {
+        const size_t nStart = m_nPos;
+        while (m_nPos < m_osExpression.size() &&
+               isdigit(static_cast<unsigned char>(m_osExpression[m_nPos])))
+            ++m_nPos;
+        if (m_nPos < m_osExpression.size() && m_osExpression[m_nPos] == '.')
+        {
+            ++m_nPos;
+            while (m_nPos < m_osExpression.size() &&
+                   isdigit(static_cast<unsigned char>(m_osExpression[m_nPos])))
+                ++m_nPos;
+        }
+        if (m_nPos < m_osExpression.size() &&
+            (m_osExpression[m_nPos] == 'e' || m_osExpression[m_nPos] == 'E'))
+        {
+            size_t nExpPos = m_nPos + 1;
+            if (nExpPos < m_osExpression.size() &&
+                (m_osExpression[nExpPos] == '+' ||
+                 m_osExpression[nExpPos] == '-'))
+                ++nExpPos;
+            if (nExpPos < m_osExpression.size() &&
+                isdigit(static_cast<unsigned char>(m_osExpression[nExpPos])))
+            {
+                m_nPos = nExpPos;
+                while (m_nPos < m_osExpression.size() &&
+                       isdigit(static_cast<unsigned char>(
+                           m_osExpression[m_nPos])))
+                    ++m_nPos;
+            }
+        }
+        const std::string osNumber(
+            m_osExpression.substr(nStart, m_nPos - nStart));
+        if (osNumber == "." ||
+            (m_nPos < m_osExpression.size() &&
+             (IsNameChar(m_osExpression[m_nPos]) ||
+              m_osExpression[m_nPos] == '.')))
+        {
+            return false;
+        }
+        oRes = Operand();
+        oRes.dfValue = CPLAtof(osNumber.c_str());
+        return true;
+    }
+
+    std::string osName;
+    if (!ParseIdentifier(osName))
+        return false;
+
+    const auto oIterVar =
+        std::find(m_aosVariables.begin(), m_aosVariables.end(), osName);
+    if (oIterVar != m_aosVariables.end())
+    {
+        oRes = Operand();
+        oRes.eKind = Operand::Kind::VARIABLE;
+        oRes.nIndex = static_cast<int>(oIterVar - m_aosVariables.begin());
+        return true;
+    }
+
+    if (osName == "_pi" || osName == "_e" || osName == "nan" ||
+        osName == "NaN")
+    {
+        oRes = Operand();
+        oRes.dfValue = osName == "_pi"  ? M_PI
+                       : osName == "_e" ? std::exp(1.0)
+                                        : std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+
+    // Functions whose definition is the same in all muparser versions.
+    // "log" and "rint" are not handled on purpose.
+    static const std::map<std::string, Op> oMapUnaryFunctions = {
+        {"sin", Op::SIN},     {"cos", Op::COS},     {"tan", Op::TAN},
+        {"asin", Op::ASIN},   {"acos", Op::ACOS},   {"atan", Op::ATAN},
+        {"sinh", Op::SINH},   {"cosh", Op::COSH},   {"tanh", Op::TANH},
+        {"asinh", Op::ASINH}, {"acosh", Op::ACOSH}, {"atanh", Op::ATANH},
+        {"log2", Op::LOG2},   {"log10", Op::LOG10}, {"ln", Op::LN},
+        {"exp", Op::EXP},     {"sqrt", Op::SQRT},   {"abs", Op::ABS},
+        {"sign", Op::SIGN},
+    };
+
+    std::vector<Operand> aoArgs;
+    const auto oIterFunc = oMapUnaryFunctions.find(osName);
+    if (oIterFunc != oMapUnaryFunctions.end())
+    {
+        if (!ParseFunctionArguments(aoArgs) || aoArgs.size() != 1)
+            return false;
+        oRes = Emit(oIterFunc->second, aoArgs[0]);
+        return true;
+    }
+
+    if (osName == "min" || osName == "max" || osName == "sum" ||
+        osName == "avg")
+    {
+        if (!ParseFunctionArguments(aoArgs))
+            return false;
+        const Op eOp = osName == "min"   ? Op::MIN
+                       : osName == "max" ? Op::MAX
+                                         : Op::ADD;
+        oRes = aoArgs[0];
+        for (size_t i = 1; i < aoArgs.size(); ++i)
+            oRes = Emit(eOp, oRes, aoArgs[i]);
+        if (osName == "avg")
+        {
+            Operand oCount;
+            oCount.dfValue = static_cast<double>(aoArgs.size());
+            oRes = Emit(Op::DIV, oRes, oCount);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                  VectorizedExpression::Compile()                     */
+/************************************************************************/
+
+VectorizedExpression::VectorizedExpression(std::unique_ptr<Program> poProgram)
+    : m_poProgram(std::move(poProgram))
+{
+}
+
+VectorizedExpression::~VectorizedExpression() = default;
+
+std::unique_ptr<VectorizedExpression>
+VectorizedExpression::Compile(std::string_view osExpression,
+                              const std::vector<std::string> &aosVariables,
+                              bool bBandsVector)
+{
+    auto poProgram = std::make_unique<Program>();
+    Compiler oCompiler(osExpression, aosVariables, bBandsVector, *poProgram);
+    if (!oCompiler.Compile())
+        return nullptr;
+    return std::unique_ptr<VectorizedExpression>(
+        new VectorizedExpression(std::move(poProgram)));
+}
+
+/************************************************************************/
+/*                  VectorizedExpression::Evaluate()                    */
+/************************************************************************/
+
+void VectorizedExpression::Evaluate(const double *const *papadfVariables,
+                                    double *padfResults, size_t nCount)
+{
+    constexpr size_t BLOCK_SIZE = Program::BLOCK_SIZE;
+    const Program &oProgram = *m_poProgram;
+
+    for (size_t iStart = 0; iStart < nCount; iStart += BLOCK_SIZE)
+    {
+        const size_t n = std::min(BLOCK_SIZE, nCount - iStart);
+
+        const auto GetValues = [this, papadfVariables,
+                                iStart](const Operand &oOperand)
+        {
+            switch (oOperand.eKind)
+            {
+                case Operand::Kind::CONSTANT:
+                    break;
+                case Operand::Kind::VARIABLE:
+                    return papadfVariables[oOperand.nIndex] + iStart;
+                case Operand::Kind::TEMPORARY:
+                    return static_cast<const double *>(
+                        m_poProgram->adfTemporaryBlocks.data() +
+                        oOperand.nIndex * BLOCK_SIZE);
+            }
+            return static_cast<const double *>(
+                m_poProgram->adfConstantBlocks.data() +
+                oOperand.nIndex * BLOCK_SIZE);
+        };
+
+        for (const auto &oInstr : oProgram.aoInstructions)
+        {
+            ApplyOnBlock(oInstr.eOp, GetValues(oInstr.oA),
+                         GetValues(oInstr.oB), GetValues(oInstr.oC),
+                         m_poProgram->adfTemporaryBlocks.data() +
+                             oInstr.nDst * BLOCK_SIZE,
+                         n);
+        }
+
+        if (oProgram.oResult.eKind == Operand::Kind::CONSTANT)
+            std::fill_n(padfResults + iStart, n, oProgram.oResult.dfValue);
+        else
+            memcpy(padfResults + iStart, GetValues(oProgram.oResult),
+                   n * sizeof(double));
+    }
+}
+
+/*! @endcond Doxygen_Suppress */
+
+}  // namespace gdal
@@ -17,7 +17,10 @@
 
 #include <algorithm>
 #include <limits>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 /************************************************************************/
@@ -68,6 +71,14 @@ struct VRTProcessedDatasetFunc
 
     //! Required processing function
     GDALVRTProcessedDatasetFuncProcess pfnProcess = nullptr;
+
+    //! Whether the output only depends on the input buffer, the arguments
+    //! and the processed region, so that it can be cached.
+    bool bPure = false;
+
+    //! Number of pixels around the processed region that pfnProcess needs
+    //! to compute the values of the region.
+    int nHalo = 0;
 };
 
 /************************************************************************/
@@ -82,6 +93,93 @@ GetGlobalMapProcessedDatasetFunc()
     return goMap;
 }
 
+/************************************************************************/
+/*                    VRTProcessedDatasetResultCache                    */
+/************************************************************************/
+
+/** Process-wide LRU cache of the output of the leading pure steps of
+ * VRTProcessedDataset for a region of a source, bounded in memory by the
+ * VRT_PROCESSED_DATASET_CACHE_SIZE configuration option.
+ *
+ * Keys are built from the identity of the source dataset, the region and
+ * the signature of the steps, so that datasets sharing the same source and
+ * steps share entries.
+ */
+class VRTProcessedDatasetResultCache
+{
+  public:
+    using Buffer = std::vector<GByte>;
+
+    static VRTProcessedDatasetResultCache &Get()
+    {
+        static VRTProcessedDatasetResultCache goCache;
+        return goCache;
+    }
+
+    static size_t GetMaxSize()
+    {
+        GIntBig nMaxSize = 0;
+        const char *pszVal =
+            CPLGetConfigOption("VRT_PROCESSED_DATASET_CACHE_SIZE", "0");
+        if (CPLParseMemorySize(pszVal, &nMaxSize, nullptr) != CE_None)
+            return 0;
+        return static_cast<size_t>(std::min<GIntBig>(
+            nMaxSize, std::numeric_limits<size_t>::max() / 2));
+    }
+
+    std::shared_ptr<const Buffer> Lookup(const std::string &osKey)
+    {
+        std::lock_guard oLock(m_oMutex);
+        const auto oIter = m_oMap.find(osKey);
+        if (oIter == m_oMap.end())
+            return nullptr;
+        // Move to the front of the LRU list
+        m_oList.splice(m_oList.begin(), m_oList, oIter->second);
+        return oIter->second->second;
+    }
+
+    void Insert(const std::string &osKey,
+                std::shared_ptr<const Buffer> poBuffer, size_t nMaxSize)
+    {
+        const size_t nEntrySize = EntrySize(osKey, *poBuffer);
+        if (nEntrySize > nMaxSize)
+            return;
+
+        std::lock_guard oLock(m_oMutex);
+        const auto oIter = m_oMap.find(osKey);
+        if (oIter != m_oMap.end())
+        {
+            m_nSize -= EntrySize(osKey, *(oIter->second->second));
+            m_oList.erase(oIter->second);
+            m_oMap.erase(oIter);
+        }
+        m_oList.emplace_front(osKey, std::move(poBuffer));
+        m_oMap[osKey] = m_oList.begin();
+        m_nSize += nEntrySize;
+
+        while (m_nSize > nMaxSize)
+        {
+            const auto &oLast = m_oList.back();
+            m_nSize -= EntrySize(oLast.first, *(oLast.second));
+            m_oMap.erase(oLast.first);
+            m_oList.pop_back();
+        }
+    }
+
+  private:
+    using Entry = std::pair<std::string, std::shared_ptr<const Buffer>>;
+
+    std::mutex m_oMutex{};
+    std::list<Entry> m_oList{};
+    std::map<std::string, std::list<Entry>::iterator> m_oMap{};
+    size_t m_nSize = 0;
+
+    static size_t EntrySize(const std::string &osKey, const Buffer &oBuffer)
+    {
+        return osKey.size() + oBuffer.size();
+    }
+};
+
 /************************************************************************/
 /*                            Step::~Step()                             */
 /************************************************************************/
@@ -249,6 +347,12 @@ CPLErr VRTProcessedDataset::Init(const CPLXMLNode *psTree,
     {
         m_poSrcDS.reset(
             GDALCreateOverviewDataset(poParentSrcDS, iOvrLevel, true));
+        if (poParentDS && !poParentDS->m_osSourceCacheKey.empty())
+        {
+            m_osSourceCacheKey = poParentDS->m_osSourceCacheKey;
+            m_osSourceCacheKey += "|ovr=";
+            m_osSourceCacheKey += std::to_string(iOvrLevel);
+        }
     }
     else if (const CPLXMLNode *psSourceFileNameNode =
                  CPLGetXMLNode(psInput, "SourceFilename"))
@@ -261,6 +365,18 @@ CPLErr VRTProcessedDataset::Init(const CPLXMLNode *psTree,
         m_poSrcDS.reset(GDALDataset::Open(
             osFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr,
             nullptr, nullptr));
+        // Identify the source by its name, modification time and size, so
+        // that a modified file does not get stale cached results.
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            m_osSourceCacheKey = "file=";
+            m_osSourceCacheKey += osFilename;
+            m_osSourceCacheKey += "|mtime=";
+            m_osSourceCacheKey += std::to_string(sStat.st_mtime);
+            m_osSourceCacheKey += "|size=";
+            m_osSourceCacheKey += std::to_string(sStat.st_size);
+        }
     }
     else if (const CPLXMLNode *psVRTDataset =
                  CPLGetXMLNode(psInput, "VRTDataset"))
@@ -269,6 +385,13 @@ CPLErr VRTProcessedDataset::Init(const CPLXMLNode *psTree,
         sVRTDatasetTmp.psNext = nullptr;
         char *pszXML = CPLSerializeXMLTree(&sVRTDatasetTmp);
         m_poSrcDS.reset(VRTDataset::OpenXML(pszXML, pszVRTPathIn, GA_ReadOnly));
+        if (pszXML)
+        {
+            m_osSourceCacheKey = "vrt=";
+            m_osSourceCacheKey += pszXML;
+            m_osSourceCacheKey += "|path=";
+            m_osSourceCacheKey += m_osVRTPath;
+        }
         CPLFree(pszXML);
     }
     else
@@ -302,6 +425,8 @@ CPLErr VRTProcessedDataset::Init(const CPLXMLNode *psTree,
         CPLError(CE_Failure, CPLE_AppDefined, "Invalid value of 'unscale'");
         return CE_Failure;
     }
+    if (bUnscale && !m_osSourceCacheKey.empty())
+        m_osSourceCacheKey += "|unscale";
 
     if (bUnscale)
     {
@@ -607,6 +732,52 @@ CPLErr VRTProcessedDataset::Init(const CPLXMLNode *psTree,
         return CE_Failure;
     }
 
+    // Each step reading neighbouring pixels shrinks the area where the
+    // output of the following steps is valid, hence halos add up.
+    {
+        const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+        for (const auto &oStep : m_aoSteps)
+        {
+            const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
+            if (oIterFunc != oMapFunctions.end())
+                m_nHalo += oIterFunc->second.nHalo;
+        }
+    }
+
+    // Compute the signature of the leading steps whose output can be cached
+    if (!m_osSourceCacheKey.empty())
+    {
+        const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+        for (const auto &oStep : m_aoSteps)
+        {
+            const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
+            if (oIterFunc == oMapFunctions.end() || !oIterFunc->second.bPure)
+                break;
+            ++m_nPureStepCount;
+            m_osPureStepsCacheKey += "|step=";
+            m_osPureStepsCacheKey += oStep.osAlgorithm;
+            for (const char *pszArg : oStep.aosArguments)
+            {
+                m_osPureStepsCacheKey += ',';
+                m_osPureStepsCacheKey += pszArg;
+            }
+            m_osPureStepsCacheKey += CPLSPrintf(
+                "|in=%s,%d|out=%s,%d", GDALGetDataTypeName(oStep.eInDT),
+                oStep.nInBands, GDALGetDataTypeName(oStep.eOutDT),
+                oStep.nOutBands);
+            for (double dfVal : oStep.adfInNoData)
+                m_osPureStepsCacheKey += CPLSPrintf(",%.17g", dfVal);
+            m_osPureStepsCacheKey += '|';
+            for (double dfVal : oStep.adfOutNoData)
+                m_osPureStepsCacheKey += CPLSPrintf(",%.17g", dfVal);
+        }
+        if (m_nPureStepCount > 0)
+        {
+            m_osPureStepsCacheKey += "|path=";
+            m_osPureStepsCacheKey += m_osVRTPath;
+        }
+    }
+
     int nLargestInDTSizeTimesBand = 1;
     int nLargestOutDTSizeTimesBand = 1;
     for (const auto &oStep : m_aoSteps)
@@ -1185,18 +1356,16 @@ void VRTProcessedDataset::GetBlockSize(int *pnBlockXSize,
 /*                            ProcessRegion()                           */
 /************************************************************************/
 
-/** Compute pixel values for the specified region.
+/** Read the specified region of the source dataset.
  *
- * The output is stored in m_abyInput in a pixel-interleaved way.
+ * The output is stored in m_abyInput in a pixel-interleaved way, with the
+ * input data type of the first step.
  */
-bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
-                                        int nBufYSize,
-                                        GDALProgressFunc pfnProgress,
-                                        void *pProgressData)
+bool VRTProcessedDataset::ReadSourceRegion(int nXOff, int nYOff, int nBufXSize,
+                                           int nBufYSize,
+                                           GDALProgressFunc pfnProgress,
+                                           void *pProgressData)
 {
-
-    CPLAssert(!m_aoSteps.empty());
-
     const size_t nPixelCount = static_cast<size_t>(nBufXSize) * nBufYSize;
 
     const int nFirstBandCount = m_aoSteps.front().nInBands;
@@ -1303,10 +1472,86 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
             return false;
     }
 
-    const double dfSrcXOff = nXOff;
-    const double dfSrcYOff = nYOff;
-    const double dfSrcXSize = nBufXSize;
-    const double dfSrcYSize = nBufYSize;
+    return true;
+}
+
+/************************************************************************/
+/*                            ProcessRegion()                           */
+/************************************************************************/
+
+/** Compute pixel values for the specified region.
+ *
+ * The output is stored in m_abyInput in a pixel-interleaved way.
+ */
+bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
+                                        int nBufYSize,
+                                        GDALProgressFunc pfnProgress,
+                                        void *pProgressData)
+{
+
+    CPLAssert(!m_aoSteps.empty());
+
+    // If some steps need neighbouring pixels, process an enlarged region,
+    // and crop the result at the end.
+    const int nExtXOff = std::max(0, nXOff - m_nHalo);
+    const int nExtYOff = std::max(0, nYOff - m_nHalo);
+    const int nExtBufXSize =
+        static_cast<int>(std::min<GIntBig>(
+            nRasterXSize, static_cast<GIntBig>(nXOff) + nBufXSize + m_nHalo)) -
+        nExtXOff;
+    const int nExtBufYSize =
+        static_cast<int>(std::min<GIntBig>(
+            nRasterYSize, static_cast<GIntBig>(nYOff) + nBufYSize + m_nHalo)) -
+        nExtYOff;
+
+    const size_t nPixelCount = static_cast<size_t>(nExtBufXSize) * nExtBufYSize;
+    auto &abyInput = m_abyInput;
+    auto &abyOutput = m_abyOutput;
+
+    // Look for the output of the leading pure steps in the result cache
+    const size_t nCacheMaxSize =
+        m_nPureStepCount > 0 ? VRTProcessedDatasetResultCache::GetMaxSize()
+                             : 0;
+    std::string osCacheKey;
+    int iFirstStep = 0;
+    if (nCacheMaxSize > 0)
+    {
+        osCacheKey = CPLSPrintf("%d,%d,%d,%d|", nXOff, nYOff, nBufXSize,
+                                nBufYSize);
+        osCacheKey += m_osSourceCacheKey;
+        osCacheKey += m_osPureStepsCacheKey;
+        const auto poCached =
+            VRTProcessedDatasetResultCache::Get().Lookup(osCacheKey);
+        if (poCached)
+        {
+            try
+            {
+                abyInput.resize(poCached->size());
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating working buffer");
+                return false;
+            }
+            if (!poCached->empty())
+                memcpy(abyInput.data(), poCached->data(), poCached->size());
+            iFirstStep = m_nPureStepCount;
+            CPLDebugOnly("VRT", "ProcessRegion(): result cache hit");
+        }
+    }
+
+    if (iFirstStep == 0 &&
+        !ReadSourceRegion(nExtXOff, nExtYOff, nExtBufXSize, nExtBufYSize,
+                          pfnProgress, pProgressData))
+    {
+        return false;
+    }
+
+    const double dfSrcXOff = nExtXOff;
+    const double dfSrcYOff = nExtYOff;
+    const double dfSrcXSize = nExtBufXSize;
+    const double dfSrcYSize = nExtBufYSize;
 
     double adfSrcGT[6];
     if (m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None)
@@ -1319,12 +1564,15 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         adfSrcGT[5] = 1;
     }
 
-    GDALDataType eLastDT = eFirstDT;
+    GDALDataType eLastDT = iFirstStep == 0
+                               ? m_aoSteps.front().eInDT
+                               : m_aoSteps[iFirstStep - 1].eOutDT;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
 
-    int iStep = 0;
-    for (const auto &oStep : m_aoSteps)
+    const int nSteps = static_cast<int>(m_aoSteps.size());
+    for (int iStep = iFirstStep; iStep < nSteps; ++iStep)
     {
+        const auto &oStep = m_aoSteps[iStep];
         const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
         CPLAssert(oIterFunc != oMapFunctions.end());
 
@@ -1366,7 +1614,7 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         const auto &oFunc = oIterFunc->second;
         if (oFunc.pfnProcess(
                 oStep.osAlgorithm.c_str(), oFunc.pUserData, oStep.pWorkingData,
-                oStep.aosArguments.List(), nBufXSize, nBufYSize,
+                oStep.aosArguments.List(), nExtBufXSize, nExtBufYSize,
                 abyInput.data(), abyInput.size(), oStep.eInDT, oStep.nInBands,
                 oStep.adfInNoData.data(), abyOutput.data(), abyOutput.size(),
                 oStep.eOutDT, oStep.nOutBands, oStep.adfOutNoData.data(),
@@ -1380,13 +1628,59 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         std::swap(abyInput, abyOutput);
         eLastDT = oStep.eOutDT;
 
-        ++iStep;
+        if (nCacheMaxSize > 0 && iStep + 1 == m_nPureStepCount)
+        {
+            try
+            {
+                auto poBuffer = std::make_shared<std::vector<GByte>>(
+                    abyInput.size());
+                if (!abyInput.empty())
+                    memcpy(poBuffer->data(), abyInput.data(), abyInput.size());
+                VRTProcessedDatasetResultCache::Get().Insert(
+                    osCacheKey, std::move(poBuffer), nCacheMaxSize);
+            }
+            catch (const std::bad_alloc &)
+            {
+                // Not caching is not an error
+            }
+        }
+
         if (pfnProgress &&
-            !pfnProgress(0.5 + 0.5 * iStep / static_cast<int>(m_aoSteps.size()),
-                         "", pProgressData))
+            !pfnProgress(0.5 + 0.5 * (iStep + 1) / nSteps, "", pProgressData))
             return false;
     }
 
+    if (nExtBufXSize != nBufXSize || nExtBufYSize != nBufYSize)
+    {
+        const size_t nPixelSize = static_cast<size_t>(
+                                      GDALGetDataTypeSizeBytes(eLastDT)) *
+                                  m_aoSteps.back().nOutBands;
+        try
+        {
+            abyOutput.resize(static_cast<size_t>(nBufXSize) * nBufYSize *
+                             nPixelSize);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory allocating working buffer");
+            return false;
+        }
+
+        const size_t nLineSize = static_cast<size_t>(nBufXSize) * nPixelSize;
+        for (int iY = 0; iY < nBufYSize; ++iY)
+        {
+            const size_t nSrcOffset =
+                (static_cast<size_t>(nYOff - nExtYOff + iY) * nExtBufXSize +
+                 (nXOff - nExtXOff)) *
+                nPixelSize;
+            memcpy(abyOutput.data() + iY * nLineSize,
+                   abyInput.data() + nSrcOffset, nLineSize);
+        }
+
+        std::swap(abyInput, abyOutput);
+    }
+
     return true;
 }
 
@@ -1731,7 +2025,23 @@ CPLErr VRTProcessedDataset::IRasterIO(
                 by pfnInit. May be nullptr.
  @param pfnProcess Processing function called to compute pixel values. Must
                    not be nullptr.
- @param papszOptions Unused currently. Must be nullptr.
+ @param papszOptions Options, or nullptr. Supported options are:
+                     <ul>
+                     <li>PURE=YES/NO: (GDAL >= 3.11) whether the output of
+                     pfnProcess only depends on its input buffer, its
+                     arguments and the processed region. If YES, the result
+                     of the step may be cached, when the
+                     VRT_PROCESSED_DATASET_CACHE_SIZE configuration option is
+                     set. Defaults to NO.</li>
+                     <li>HALO=integer: (GDAL >= 3.11) number of pixels
+                     around the processed region that pfnProcess needs to
+                     compute the values of that region, typically 1 for
+                     algorithms working on a 3x3 neighbourhood. pfnProcess is
+                     then given the region enlarged by that number of pixels
+                     on each side (clipped to the raster extent), and only
+                     the values of the inner region are used. Defaults to
+                     0.</li>
+                     </ul>
  @return CE_None in case of success, error otherwise.
  @since 3.9
  */
@@ -1743,7 +2053,7 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     GDALVRTProcessedDatasetFuncInit pfnInit,
     GDALVRTProcessedDatasetFuncFree pfnFree,
     GDALVRTProcessedDatasetFuncProcess pfnProcess,
-    CPL_UNUSED CSLConstList papszOptions)
+    CSLConstList papszOptions)
 {
     if (pszFuncName == nullptr || pszFuncName[0] == '\0')
     {
@@ -1889,6 +2199,14 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     oFunc.pfnInit = pfnInit;
     oFunc.pfnFree = pfnFree;
     oFunc.pfnProcess = pfnProcess;
+    oFunc.bPure = CPLTestBool(CSLFetchNameValueDef(papszOptions, "PURE", "NO"));
+    oFunc.nHalo = atoi(CSLFetchNameValueDef(papszOptions, "HALO", "0"));
+    if (oFunc.nHalo < 0 || oFunc.nHalo > 1024)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid value for HALO: %s",
+                 CSLFetchNameValue(papszOptions, "HALO"));
+        return CE_Failure;
+    }
 
     oMap[pszFuncName] = std::move(oFunc);
 
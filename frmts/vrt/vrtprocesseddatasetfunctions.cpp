@@ -16,6 +16,7 @@
 #include "vrtexpression.h"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <map>
@@ -1745,6 +1746,420 @@ static CPLErr ExpressionProcess(
     return CE_None;
 }
 
+/************************************************************************/
+/*                         DEMProcessingData                            */
+/************************************************************************/
+
+namespace
+{
+/** Working structure for 'Hillshade' and 'Slope' builtin functions. */
+struct DEMProcessingData
+{
+    static constexpr const char *const EXPECTED_SIGNATURE = "DEMProcessing";
+    //! Signature (to make sure callback functions are called with the right argument)
+    const std::string m_osSignature = EXPECTED_SIGNATURE;
+
+    enum class HillshadeVariant
+    {
+        DEFAULT,
+        COMBINED,
+        MULTIDIRECTIONAL,
+    };
+
+    //! Whether this is the 'Hillshade' function (otherwise 'Slope')
+    bool m_bHillshade = true;
+
+    //! Whether to use the Zevenbergen & Thorne gradient (otherwise Horn)
+    bool m_bZevenbergenThorne = false;
+
+    //! Whether to compute values at the edges of the raster and near nodata
+    bool m_bComputeEdges = false;
+
+    //! Vertical exaggeration (hillshade only)
+    double m_dfZFactor = 1.0;
+
+    //! Ratio of vertical units to horizontal units
+    double m_dfScale = 1.0;
+
+    //! Azimuth of the light, in degrees (hillshade only)
+    double m_dfAzimuth = 315.0;
+
+    //! Altitude of the light, in degrees (hillshade only)
+    double m_dfAltitude = 45.0;
+
+    //! Hillshade variant
+    HillshadeVariant m_eVariant = HillshadeVariant::DEFAULT;
+
+    //! Whether slope is expressed in percent (otherwise in degrees)
+    bool m_bSlopeInPercent = false;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        DEMProcessingInit()                           */
+/************************************************************************/
+
+/** Init function for 'Hillshade' and 'Slope' builtin functions. */
+static CPLErr DEMProcessingInit(const char *pszFuncName, void * /*pUserData*/,
+                                CSLConstList papszFunctionArgs, int nInBands,
+                                GDALDataType eInDT, double *padfInNoData,
+                                int *pnOutBands, GDALDataType *peOutDT,
+                                double **ppadfOutNoData,
+                                const char * /* pszVRTPath */,
+                                VRTPDWorkingDataPtr *ppWorkingData)
+{
+    CPLAssert(eInDT == GDT_Float64);
+    CPLAssert(nInBands == 1);
+    CPL_IGNORE_RET_VAL(nInBands);
+
+    const bool bIsFinalStep = *pnOutBands != 0;
+    *peOutDT = eInDT;
+    *ppWorkingData = nullptr;
+
+    if (bIsFinalStep && *pnOutBands != 1)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s algorithm only generates one output band", pszFuncName);
+        return CE_Failure;
+    }
+    *pnOutBands = 1;
+
+    auto data = std::make_unique<DEMProcessingData>();
+    data->m_bHillshade = EQUAL(pszFuncName, "Hillshade");
+
+    // Default output nodata values are the ones of gdaldem
+    double dfDstNoData = data->m_bHillshade ? 0.0 : -9999.0;
+    if (bIsFinalStep && *ppadfOutNoData && !std::isnan((*ppadfOutNoData)[0]))
+        dfDstNoData = (*ppadfOutNoData)[0];
+
+    for (const auto &[pszKey, pszValue] :
+         cpl::IterateNameValue(papszFunctionArgs))
+    {
+        if (EQUAL(pszKey, "src_nodata"))
+        {
+            padfInNoData[0] = CPLAtof(pszValue);
+        }
+        else if (EQUAL(pszKey, "dst_nodata"))
+        {
+            dfDstNoData = CPLAtof(pszValue);
+        }
+        else if (EQUAL(pszKey, "alg"))
+        {
+            if (EQUAL(pszValue, "ZevenbergenThorne"))
+                data->m_bZevenbergenThorne = true;
+            else if (!EQUAL(pszValue, "Horn"))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for argument '%s': %s", pszKey,
+                         pszValue);
+                return CE_Failure;
+            }
+        }
+        else if (EQUAL(pszKey, "compute_edges"))
+        {
+            data->m_bComputeEdges = CPLTestBool(pszValue);
+        }
+        else if (EQUAL(pszKey, "scale"))
+        {
+            data->m_dfScale = CPLAtof(pszValue);
+            if (!(data->m_dfScale > 0))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for argument '%s': %s", pszKey,
+                         pszValue);
+                return CE_Failure;
+            }
+        }
+        else if (data->m_bHillshade && EQUAL(pszKey, "z_factor"))
+        {
+            data->m_dfZFactor = CPLAtof(pszValue);
+        }
+        else if (data->m_bHillshade && EQUAL(pszKey, "azimuth"))
+        {
+            data->m_dfAzimuth = CPLAtof(pszValue);
+        }
+        else if (data->m_bHillshade && EQUAL(pszKey, "altitude"))
+        {
+            data->m_dfAltitude = CPLAtof(pszValue);
+        }
+        else if (data->m_bHillshade && EQUAL(pszKey, "variant"))
+        {
+            if (EQUAL(pszValue, "combined"))
+                data->m_eVariant =
+                    DEMProcessingData::HillshadeVariant::COMBINED;
+            else if (EQUAL(pszValue, "multidirectional"))
+                data->m_eVariant =
+                    DEMProcessingData::HillshadeVariant::MULTIDIRECTIONAL;
+            else if (!EQUAL(pszValue, "default"))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for argument '%s': %s", pszKey,
+                         pszValue);
+                return CE_Failure;
+            }
+        }
+        else if (!data->m_bHillshade && EQUAL(pszKey, "slope_format"))
+        {
+            if (EQUAL(pszValue, "percent"))
+                data->m_bSlopeInPercent = true;
+            else if (!EQUAL(pszValue, "degree"))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for argument '%s': %s", pszKey,
+                         pszValue);
+                return CE_Failure;
+            }
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Unrecognized argument name %s. Ignored", pszKey);
+        }
+    }
+
+    if (*ppadfOutNoData == nullptr)
+    {
+        *ppadfOutNoData = static_cast<double *>(CPLMalloc(sizeof(double)));
+    }
+    (*ppadfOutNoData)[0] = dfDstNoData;
+
+    *ppWorkingData = data.release();
+    return CE_None;
+}
+
+/************************************************************************/
+/*                        DEMProcessingFree()                           */
+/************************************************************************/
+
+/** Free function for 'Hillshade' and 'Slope' builtin functions. */
+static void DEMProcessingFree(const char * /*pszFuncName*/,
+                              void * /*pUserData*/,
+                              VRTPDWorkingDataPtr pWorkingData)
+{
+    DEMProcessingData *data = static_cast<DEMProcessingData *>(pWorkingData);
+    CPLAssert(data->m_osSignature == DEMProcessingData::EXPECTED_SIGNATURE);
+    CPL_IGNORE_RET_VAL(data->m_osSignature);
+    delete data;
+}
+
+/************************************************************************/
+/*                       DEMProcessingProcess()                         */
+/************************************************************************/
+
+/** Processing function for 'Hillshade' and 'Slope' builtin functions.
+ *
+ * The formulas and the handling of edges are the ones of gdaldem. The
+ * buffer edges are considered as raster edges: the VRTProcessedDataset
+ * enlarges the processed region by one pixel (HALO=1) and discards the
+ * values computed at the buffer edges, except at the actual raster edges.
+ */
+static CPLErr DEMProcessingProcess(
+    const char * /*pszFuncName*/, void * /*pUserData*/,
+    VRTPDWorkingDataPtr pWorkingData, CSLConstList /* papszFunctionArgs*/,
+    int nBufXSize, int nBufYSize, const void *pInBuffer, size_t nInBufferSize,
+    GDALDataType eInDT, int nInBands, const double *CPL_RESTRICT padfInNoData,
+    void *pOutBuffer, size_t nOutBufferSize, GDALDataType eOutDT,
+    int nOutBands, const double *CPL_RESTRICT padfOutNoData,
+    double /*dfSrcXOff*/, double /*dfSrcYOff*/, double /*dfSrcXSize*/,
+    double /*dfSrcYSize*/, const double adfSrcGT[],
+    const char * /* pszVRTPath */, CSLConstList /*papszExtra*/)
+{
+    const size_t nElts = static_cast<size_t>(nBufXSize) * nBufYSize;
+
+    CPL_IGNORE_RET_VAL(eInDT);
+    CPLAssert(eInDT == GDT_Float64);
+    CPL_IGNORE_RET_VAL(eOutDT);
+    CPLAssert(eOutDT == GDT_Float64);
+    CPL_IGNORE_RET_VAL(nInBufferSize);
+    CPLAssert(nInBufferSize == nElts * nInBands * sizeof(double));
+    CPL_IGNORE_RET_VAL(nOutBufferSize);
+    CPLAssert(nOutBufferSize == nElts * nOutBands * sizeof(double));
+    CPLAssert(nInBands == 1 && nOutBands == 1);
+    CPL_IGNORE_RET_VAL(nInBands);
+    CPL_IGNORE_RET_VAL(nOutBands);
+    CPL_IGNORE_RET_VAL(nElts);
+
+    const DEMProcessingData *data =
+        static_cast<DEMProcessingData *>(pWorkingData);
+    CPLAssert(data->m_osSignature == DEMProcessingData::EXPECTED_SIGNATURE);
+    const double *CPL_RESTRICT padfSrc = static_cast<const double *>(pInBuffer);
+    double *CPL_RESTRICT padfDst = static_cast<double *>(pOutBuffer);
+
+    const double dfSrcNoData = padfInNoData[0];
+    const double dfDstNoData = padfOutNoData[0];
+    // written this way to work with a NaN value
+    const auto IsNoData = [dfSrcNoData](double dfVal)
+    { return !(dfVal != dfSrcNoData) || std::isnan(dfVal); };
+
+    constexpr double DEG_TO_RAD = M_PI / 180.0;
+    constexpr double RAD_TO_DEG = 180.0 / M_PI;
+    const double dfInvEWRes = 1.0 / adfSrcGT[1];
+    const double dfInvNSRes = 1.0 / adfSrcGT[5];
+    const double dfZScaled =
+        data->m_dfZFactor /
+        ((data->m_bZevenbergenThorne ? 2 : 8) * data->m_dfScale);
+    const double dfSinAlt = sin(data->m_dfAltitude * DEG_TO_RAD);
+    const double dfCosAltMulZ =
+        cos(data->m_dfAltitude * DEG_TO_RAD) * dfZScaled;
+    const double dfCosAzMulCosAltMulZ =
+        cos(data->m_dfAzimuth * DEG_TO_RAD) * dfCosAltMulZ;
+    const double dfSinAzMulCosAltMulZ =
+        sin(data->m_dfAzimuth * DEG_TO_RAD) * dfCosAltMulZ;
+    const double dfSquareZ = dfZScaled * dfZScaled;
+    const double dfCos225AzMulCosAltMulZ =
+        cos(225 * DEG_TO_RAD) * dfCosAltMulZ;
+
+    const auto GetVal = [padfSrc, nBufXSize](int iY, int iX)
+    { return padfSrc[static_cast<size_t>(iY) * nBufXSize + iX]; };
+
+    // Same as INTERPOL() of gdaldem
+    const auto Extrapolate = [&IsNoData, dfSrcNoData](double a, double b)
+    { return (IsNoData(a) || IsNoData(b)) ? dfSrcNoData : 2 * a - b; };
+
+    const bool bCanComputeEdges =
+        data->m_bComputeEdges && nBufXSize >= 2 && nBufYSize >= 2;
+
+    double adfWin[9];
+    for (int iY = 0; iY < nBufYSize; ++iY)
+    {
+        const bool bEdgeLine = iY == 0 || iY == nBufYSize - 1;
+        for (int iX = 0; iX < nBufXSize; ++iX, ++padfDst)
+        {
+            const bool bEdge = bEdgeLine || iX == 0 || iX == nBufXSize - 1;
+            const double dfCenter = GetVal(iY, iX);
+            if (IsNoData(dfCenter) || (bEdge && !bCanComputeEdges))
+            {
+                *padfDst = dfDstNoData;
+                continue;
+            }
+
+            bool bSkip = false;
+            for (int k = 0; k < 9; ++k)
+            {
+                const int iDY = k / 3 - 1;
+                const int iDX = k % 3 - 1;
+                double dfVal;
+                if (!bEdge)
+                {
+                    dfVal = GetVal(iY + iDY, iX + iDX);
+                }
+                else if (bEdgeLine)
+                {
+                    // Clamp columns, and extrapolate the missing line
+                    const int iCol = std::clamp(iX + iDX, 0, nBufXSize - 1);
+                    if (iY + iDY < 0 || iY + iDY >= nBufYSize)
+                        dfVal = Extrapolate(GetVal(iY, iCol),
+                                            GetVal(iY - iDY, iCol));
+                    else
+                        dfVal = GetVal(iY + iDY, iCol);
+                }
+                else if (iX + iDX < 0 || iX + iDX >= nBufXSize)
+                {
+                    // Extrapolate the missing column
+                    dfVal = Extrapolate(GetVal(iY + iDY, iX),
+                                        GetVal(iY + iDY, iX - iDX));
+                }
+                else
+                {
+                    dfVal = GetVal(iY + iDY, iX + iDX);
+                }
+
+                if (IsNoData(dfVal))
+                {
+                    if (!data->m_bComputeEdges)
+                    {
+                        bSkip = true;
+                        break;
+                    }
+                    dfVal = dfCenter;
+                }
+                adfWin[k] = dfVal;
+            }
+            if (bSkip)
+            {
+                *padfDst = dfDstNoData;
+                continue;
+            }
+
+            double x, y;
+            if (data->m_bZevenbergenThorne)
+            {
+                x = adfWin[3] - adfWin[5];
+                y = adfWin[7] - adfWin[1];
+            }
+            else
+            {
+                x = (adfWin[0] + adfWin[3] + adfWin[3] + adfWin[6]) -
+                    (adfWin[2] + adfWin[5] + adfWin[5] + adfWin[8]);
+                y = (adfWin[6] + adfWin[7] + adfWin[7] + adfWin[8]) -
+                    (adfWin[0] + adfWin[1] + adfWin[1] + adfWin[2]);
+            }
+            x *= dfInvEWRes;
+            y *= dfInvNSRes;
+            const double xx_plus_yy = x * x + y * y;
+
+            if (!data->m_bHillshade)
+            {
+                const double dfSlope =
+                    sqrt(xx_plus_yy) /
+                    ((data->m_bZevenbergenThorne ? 2 : 8) * data->m_dfScale);
+                *padfDst = data->m_bSlopeInPercent
+                               ? 100 * dfSlope
+                               : atan(dfSlope) * RAD_TO_DEG;
+            }
+            else if (data->m_eVariant ==
+                     DEMProcessingData::HillshadeVariant::COMBINED)
+            {
+                const double dfSlope = xx_plus_yy * dfSquareZ;
+                const double dfCosAng =
+                    (dfSinAlt -
+                     (y * dfCosAzMulCosAltMulZ - x * dfSinAzMulCosAltMulZ)) /
+                    sqrt(1 + dfSlope);
+                double cang = acos(std::clamp(dfCosAng, -1.0, 1.0));
+                cang = 1 - cang * atan(sqrt(dfSlope)) * 4 / (M_PI * M_PI);
+                *padfDst = cang <= 0.0 ? 1.0 : 1.0 + 254.0 * cang;
+            }
+            else if (data->m_eVariant ==
+                     DEMProcessingData::HillshadeVariant::MULTIDIRECTIONAL)
+            {
+                if (xx_plus_yy == 0.0)
+                {
+                    *padfDst = 1.0 + 254.0 * dfSinAlt;
+                    continue;
+                }
+                // See http://pubs.usgs.gov/of/1992/of92-422/of92-422.pdf
+                const double val225 = std::max(
+                    0.0, dfSinAlt + (x - y) * dfCos225AzMulCosAltMulZ);
+                const double val270 =
+                    std::max(0.0, dfSinAlt - x * dfCosAltMulZ);
+                const double val315 = std::max(
+                    0.0, dfSinAlt + (x + y) * dfCos225AzMulCosAltMulZ);
+                const double val360 =
+                    std::max(0.0, dfSinAlt - y * dfCosAltMulZ);
+                const double weight_225 = 0.5 * xx_plus_yy - x * y;
+                const double weight_270 = x * x;
+                const double weight_315 = xx_plus_yy - weight_225;
+                const double weight_360 = y * y;
+                const double cang =
+                    (weight_225 * val225 + weight_270 * val270 +
+                     weight_315 * val315 + weight_360 * val360) /
+                    xx_plus_yy / sqrt(1 + dfSquareZ * xx_plus_yy);
+                *padfDst = 1.0 + 127.0 * cang;
+            }
+            else
+            {
+                const double cang =
+                    (dfSinAlt -
+                     (y * dfCosAzMulCosAltMulZ - x * dfSinAzMulCosAltMulZ)) /
+                    sqrt(1 + dfSquareZ * xx_plus_yy);
+                *padfDst = cang <= 0.0 ? 1.0 : 1.0 + 254.0 * cang;
+            }
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*              GDALVRTRegisterDefaultProcessedDatasetFuncs()           */
 /************************************************************************/
@@ -1753,6 +2168,10 @@ static CPLErr ExpressionProcess(
  */
 void GDALVRTRegisterDefaultProcessedDatasetFuncs()
 {
+    // All builtin functions only depend on their input buffer and arguments,
+    // hence their result can be cached.
+    const char *const apszPureOptions[] = {"PURE=YES", nullptr};
+
     GDALVRTRegisterProcessedDatasetFunc(
         "BandAffineCombination", nullptr,
         "<ProcessedDatasetFunctionArgumentsList>"
@@ -1774,7 +2193,8 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "   <Argument name='max' description='clamp max value' type='double'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, BandAffineCombinationInit,
-        BandAffineCombinationFree, BandAffineCombinationProcess, nullptr);
+        BandAffineCombinationFree, BandAffineCombinationProcess,
+        apszPureOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LUT", nullptr,
@@ -1789,7 +2209,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='string' required='true'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LUTInit, LUTFree, LUTProcess,
-        nullptr);
+        apszPureOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LocalScaleOffset", nullptr,
@@ -1819,7 +2239,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "description='Override offset dataset nodata value'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LocalScaleOffsetInit,
-        LocalScaleOffsetFree, LocalScaleOffsetProcess, nullptr);
+        LocalScaleOffsetFree, LocalScaleOffsetProcess, apszPureOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "Trimming", nullptr,
@@ -1849,7 +2269,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "description='Override trimming dataset nodata value'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, TrimmingInit, TrimmingFree,
-        TrimmingProcess, nullptr);
+        TrimmingProcess, apszPureOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "Expression", nullptr,
@@ -1862,5 +2282,58 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='integer' />"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, ExpressionInit, ExpressionFree,
-        ExpressionProcess, nullptr);
+        ExpressionProcess, apszPureOptions);
+
+    // Terrain algorithms of gdaldem read the 3x3 neighbourhood of each pixel
+    const char *const apszDEMOptions[] = {"PURE=YES", "HALO=1", nullptr};
+    const int anDEMBandCount[] = {1};
+
+    GDALVRTRegisterProcessedDatasetFunc(
+        "Hillshade", nullptr,
+        "<ProcessedDatasetFunctionArgumentsList>"
+        "   <Argument name='src_nodata' type='double' "
+        "description='Override input nodata value'/>"
+        "   <Argument name='dst_nodata' type='double' "
+        "description='Override output nodata value'/>"
+        "   <Argument name='z_factor' type='double' "
+        "description='Vertical exaggeration' default='1'/>"
+        "   <Argument name='scale' type='double' "
+        "description='Ratio of vertical units to horizontal units' "
+        "default='1'/>"
+        "   <Argument name='azimuth' type='double' "
+        "description='Azimuth of the light, in degrees' default='315'/>"
+        "   <Argument name='altitude' type='double' "
+        "description='Altitude of the light, in degrees' default='45'/>"
+        "   <Argument name='alg' type='string' "
+        "description='Horn or ZevenbergenThorne' default='Horn'/>"
+        "   <Argument name='variant' type='string' "
+        "description='default, combined or multidirectional' "
+        "default='default'/>"
+        "   <Argument name='compute_edges' type='boolean' "
+        "description='Whether to compute values at raster edges and near "
+        "nodata values' default='false'/>"
+        "</ProcessedDatasetFunctionArgumentsList>",
+        GDT_Float64, nullptr, 0, anDEMBandCount, 1, DEMProcessingInit,
+        DEMProcessingFree, DEMProcessingProcess, apszDEMOptions);
+
+    GDALVRTRegisterProcessedDatasetFunc(
+        "Slope", nullptr,
+        "<ProcessedDatasetFunctionArgumentsList>"
+        "   <Argument name='src_nodata' type='double' "
+        "description='Override input nodata value'/>"
+        "   <Argument name='dst_nodata' type='double' "
+        "description='Override output nodata value'/>"
+        "   <Argument name='scale' type='double' "
+        "description='Ratio of vertical units to horizontal units' "
+        "default='1'/>"
+        "   <Argument name='slope_format' type='string' "
+        "description='degree or percent' default='degree'/>"
+        "   <Argument name='alg' type='string' "
+        "description='Horn or ZevenbergenThorne' default='Horn'/>"
+        "   <Argument name='compute_edges' type='boolean' "
+        "description='Whether to compute values at raster edges and near "
+        "nodata values' default='false'/>"
+        "</ProcessedDatasetFunctionArgumentsList>",
+        GDT_Float64, nullptr, 0, anDEMBandCount, 1, DEMProcessingInit,
+        DEMProcessingFree, DEMProcessingProcess, apszDEMOptions);
 }
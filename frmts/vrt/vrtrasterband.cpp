@@ -1367,6 +1367,10 @@ int VRTRasterBand::GetOverviewCount()
     if (!poVRTDS->m_apoOverviews.empty() && poVRTDS->m_apoOverviews[0])
         return static_cast<int>(poVRTDS->m_apoOverviews.size());
 
+    // BuildVirtualOverviews() may have materialized a .vrt.ovr
+    if (poVRTDS->m_apoOverviews.empty())
+        return GDALRasterBand::GetOverviewCount();
+
     return 0;
 }
 
@@ -1435,6 +1439,10 @@ GDALRasterBand *VRTRasterBand::GetOverview(int iOverview)
         return poOvrBand;
     }
 
+    // BuildVirtualOverviews() may have materialized a .vrt.ovr
+    if (poVRTDS->m_apoOverviews.empty())
+        return GDALRasterBand::GetOverview(iOverview);
+
     return nullptr;
 }
 
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -117,6 +118,136 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
     CSLDestroy(m_papszSourceList);
 }
 
+/************************************************************************/
+/*                 VRTSourcedRasterBand::SourceIndex                    */
+/************************************************************************/
+
+struct VRTSourcedRasterBand::SourceIndex
+{
+    CPLQuadTree *hQuadTree = nullptr;
+
+    // Number of sources of papoSources[] that have been processed.
+    int nIndexedSources = 0;
+
+    // Sources that are not simple sources, or whose destination window is
+    // not set, and that are thus always considered as intersecting.
+    std::vector<int> anAlwaysIntersecting{};
+
+    SourceIndex() = default;
+
+    ~SourceIndex()
+    {
+        if (hQuadTree)
+            CPLQuadTreeDestroy(hQuadTree);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(SourceIndex)
+};
+
+/************************************************************************/
+/*                       InvalidateSourceIndex()                        */
+/************************************************************************/
+
+/** Must be called when existing sources are removed or replaced. Sources
+ * appended with AddSource() are taken into account incrementally.
+ */
+void VRTSourcedRasterBand::InvalidateSourceIndex()
+{
+    m_poSourceIndex.reset();
+}
+
+/************************************************************************/
+/*                       GetSourcesIntersecting()                       */
+/************************************************************************/
+
+/** Returns, in increasing order, the indices of the sources whose
+ * destination window may intersect the passed window.
+ *
+ * For mosaics with many sources, this uses a quad tree of the destination
+ * windows, so that the cost of a request does not depend on the total
+ * number of sources.
+ */
+void VRTSourcedRasterBand::GetSourcesIntersecting(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anSources) const
+{
+    anSources.clear();
+
+    // Below that number of sources, a linear scan is fast enough.
+    constexpr int MIN_SOURCES_FOR_INDEX = 64;
+    if (nSources < MIN_SOURCES_FOR_INDEX)
+    {
+        m_poSourceIndex.reset();
+        anSources.reserve(nSources);
+        for (int i = 0; i < nSources; ++i)
+            anSources.push_back(i);
+        return;
+    }
+
+    if (m_poSourceIndex && m_poSourceIndex->nIndexedSources > nSources)
+        m_poSourceIndex.reset();
+    if (!m_poSourceIndex)
+    {
+        m_poSourceIndex = std::make_unique<SourceIndex>();
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = 0;
+        sGlobalBounds.miny = 0;
+        sGlobalBounds.maxx = nRasterXSize;
+        sGlobalBounds.maxy = nRasterYSize;
+        m_poSourceIndex->hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    }
+
+    // Index sources added since the last call.
+    for (int i = m_poSourceIndex->nIndexedSources; i < nSources; ++i)
+    {
+        const auto poSource = papoSources[i];
+        if (poSource->IsSimpleSource() &&
+            cpl::down_cast<VRTSimpleSource *>(poSource)->IsDstWinSet())
+        {
+            double dfSourceXOff;
+            double dfSourceYOff;
+            double dfSourceXSize;
+            double dfSourceYSize;
+            cpl::down_cast<VRTSimpleSource *>(poSource)->GetDstWindow(
+                dfSourceXOff, dfSourceYOff, dfSourceXSize, dfSourceYSize);
+            CPLRectObj sSourceBounds;
+            sSourceBounds.minx = dfSourceXOff;
+            sSourceBounds.miny = dfSourceYOff;
+            sSourceBounds.maxx = dfSourceXOff + dfSourceXSize;
+            sSourceBounds.maxy = dfSourceYOff + dfSourceYSize;
+            CPLQuadTreeInsertWithBounds(
+                m_poSourceIndex->hQuadTree,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i)),
+                &sSourceBounds);
+        }
+        else
+        {
+            m_poSourceIndex->anAlwaysIntersecting.push_back(i);
+        }
+    }
+    m_poSourceIndex->nIndexedSources = nSources;
+
+    CPLRectObj sAoI;
+    sAoI.minx = dfXOff;
+    sAoI.miny = dfYOff;
+    sAoI.maxx = dfXOff + dfXSize;
+    sAoI.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void **pahFeatures =
+        CPLQuadTreeSearch(m_poSourceIndex->hQuadTree, &sAoI, &nFeatureCount);
+    anSources = m_poSourceIndex->anAlwaysIntersecting;
+    anSources.reserve(anSources.size() + nFeatureCount);
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anSources.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+
+    // Sources must be composited in their declaration order.
+    std::sort(anSources.begin(), anSources.end());
+}
+
 /************************************************************************/
 /*                  CanIRasterIOBeForwardedToEachSource()               */
 /************************************************************************/
@@ -279,7 +410,9 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     std::set<std::string> oSetDSName;
 
     nContributingSources = 0;
-    for (int iSource = 0; iSource < nSources; iSource++)
+    std::vector<int> anSources;
+    GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+    for (const int iSource : anSources)
     {
         const auto poSource = papoSources[iSource];
         if (!poSource->IsSimpleSource())
@@ -669,9 +802,12 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
             }
         }
 
+        std::vector<int> anSources;
+        GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+
         auto oQueue = psThreadPool->CreateJobQueue();
         std::atomic<int> nCompletedJobs = 0;
-        for (int iSource = 0; iSource < nSources; iSource++)
+        for (const int iSource : anSources)
         {
             auto poSource = papoSources[iSource];
             if (!poSource->IsSimpleSource())
@@ -729,17 +865,22 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
         void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
+        std::vector<int> anSources;
+        GetSourcesIntersecting(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+        const int nIntersectingSources = static_cast<int>(anSources.size());
+
         VRTSource::WorkingState oWorkingState;
-        for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+        for (int i = 0; eErr == CE_None && i < nIntersectingSources; i++)
         {
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
-                pfnProgressGlobal, pProgressDataGlobal);
+                1.0 * i / nIntersectingSources,
+                1.0 * (i + 1) / nIntersectingSources, pfnProgressGlobal,
+                pProgressDataGlobal);
             if (psExtraArg->pProgressData == nullptr)
                 psExtraArg->pfnProgress = nullptr;
 
-            eErr = papoSources[iSource]->RasterIO(
+            eErr = papoSources[anSources[i]]->RasterIO(
                 eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                 nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg,
                 l_poDS ? l_poDS->m_oWorkingState : oWorkingState);
@@ -2234,12 +2375,50 @@ CPLErr VRTSourcedRasterBand::XMLInit(const CPLXMLNode *psTree,
     VRTDriver *const poDriver =
         static_cast<VRTDriver *>(GDALGetDriverByName("VRT"));
 
+    // Sources of large VRT files may have been left out of psTree by
+    // VRTDataset::OpenXML(), in which case they are parsed one at a time.
+    auto poVRTDS = dynamic_cast<VRTDataset *>(poDS);
+    const VRTDataset::DeferredSources *poDeferredSources =
+        poVRTDS ? poVRTDS->m_poDeferredSources : nullptr;
+    std::string osSourceXML;
+
     for (const CPLXMLNode *psChild = psTree->psChild;
          psChild != nullptr && poDriver != nullptr; psChild = psChild->psNext)
     {
         if (psChild->eType != CXT_Element)
             continue;
 
+        if (poDeferredSources &&
+            strcmp(psChild->pszValue,
+                   VRTDataset::DeferredSources::ELEMENT_NAME) == 0)
+        {
+            const int nGroup = atoi(CPLGetXMLValue(psChild, "id", "-1"));
+            if (nGroup < 0 ||
+                static_cast<size_t>(nGroup) >=
+                    poDeferredSources->aoGroups.size())
+            {
+                continue;
+            }
+            for (const auto &[nOffset, nSize] :
+                 poDeferredSources->aoGroups[nGroup])
+            {
+                osSourceXML.assign(poDeferredSources->pszXML + nOffset, nSize);
+                CPLXMLTreeCloser psSourceTree(
+                    CPLParseXMLString(osSourceXML.c_str()));
+                if (!psSourceTree)
+                    return CE_Failure;
+
+                CPLErrorReset();
+                VRTSource *const poSource = poDriver->ParseSource(
+                    psSourceTree.get(), pszVRTPath, oMapSharedSources);
+                if (poSource != nullptr)
+                    AddSource(poSource);
+                else if (CPLGetLastErrorType() != CE_None)
+                    return CE_Failure;
+            }
+            continue;
+        }
+
         CPLErrorReset();
         VRTSource *const poSource =
             poDriver->ParseSource(psChild, pszVRTPath, oMapSharedSources);
@@ -2282,7 +2461,15 @@ CPLXMLNode *VRTSourcedRasterBand::SerializeToXML(const char *pszVRTPath,
 
     GIntBig nUsableRAM = -1;
 
-    for (int iSource = 0; iSource < nSources; iSource++)
+    // Sources written in the binary part of a .vrtb file
+    auto poVRTDS = dynamic_cast<VRTDataset *>(poDS);
+    const int nSourcesToSerialize =
+        poVRTDS && poVRTDS->m_oSetBandsWithBinarySources.find(this) !=
+                       poVRTDS->m_oSetBandsWithBinarySources.end()
+            ? 0
+            : nSources;
+
+    for (int iSource = 0; iSource < nSourcesToSerialize; iSource++)
     {
         CPLXMLNode *const psXMLSrc =
             papoSources[iSource]->SerializeToXML(pszVRTPath);
@@ -2986,6 +3173,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem(const char *pszName,
         {
             delete papoSources[iSource];
             papoSources[iSource] = poSource;
+            InvalidateSourceIndex();
             static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
             return CE_None;
         }
@@ -3017,6 +3205,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(char **papszNewMD,
             CPLFree(papoSources);
             papoSources = nullptr;
             nSources = 0;
+            InvalidateSourceIndex();
         }
 
         for (const char *const pszMDItem :
@@ -3082,6 +3271,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
     CPLFree(papoSources);
     papoSources = nullptr;
     nSources = 0;
+    InvalidateSourceIndex();
 
     return TRUE;
 }
@@ -3276,6 +3466,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
             papoSources[iDst++] = papoSources[iSrc];
     }
     nSources = iDst;
+    InvalidateSourceIndex();
 
     CPLQuadTreeDestroy(hTree);
 #endif
@@ -332,15 +332,18 @@ static bool IsSlowSource(const char *pszSrcName)
 }
 
 /************************************************************************/
-/*                         AddSourceFilenameNode()                      */
+/*                    GetSourceFilenameToSerialize()                    */
 /************************************************************************/
 
-void VRTSimpleSource::AddSourceFilenameNode(const char *pszVRTPath,
-                                            CPLXMLNode *psSrc)
+/** Returns the source filename as it must be written in a VRT file located
+ * in pszVRTPath, and whether it is relative to that path.
+ */
+std::string
+VRTSimpleSource::GetSourceFilenameToSerialize(const char *pszVRTPath,
+                                              int &bRelativeToVRT) const
 {
-
     VSIStatBufL sStat;
-    int bRelativeToVRT = FALSE;  // TODO(schwehr): Make this a bool?
+    bRelativeToVRT = FALSE;
     std::string osSourceFilename;
 
     if (m_bRelativeToVRTOri >= 0)
@@ -455,17 +458,41 @@ void VRTSimpleSource::AddSourceFilenameNode(const char *pszVRTPath,
             osVRTFilename.c_str(), osSourceDataset.c_str(), &bRelativeToVRT);
     }
 
+    return osSourceFilename;
+}
+
+/************************************************************************/
+/*                        IsSerializedAsUnshared()                      */
+/************************************************************************/
+
+/** Returns whether the source must be serialized with shared="0" */
+bool VRTSimpleSource::IsSerializedAsUnshared() const
+{
+    // The config option will override the m_nExplicitSharedStatus value
+    const char *pszShared = CPLGetConfigOption("VRT_SHARED_SOURCE", nullptr);
+    return (pszShared == nullptr && m_nExplicitSharedStatus == 0) ||
+           (pszShared != nullptr && !CPLTestBool(pszShared));
+}
+
+/************************************************************************/
+/*                         AddSourceFilenameNode()                      */
+/************************************************************************/
+
+void VRTSimpleSource::AddSourceFilenameNode(const char *pszVRTPath,
+                                            CPLXMLNode *psSrc)
+{
+    int bRelativeToVRT = FALSE;  // TODO(schwehr): Make this a bool?
+    const std::string osSourceFilename =
+        GetSourceFilenameToSerialize(pszVRTPath, bRelativeToVRT);
+
     CPLSetXMLValue(psSrc, "SourceFilename", osSourceFilename.c_str());
 
     CPLCreateXMLNode(CPLCreateXMLNode(CPLGetXMLNode(psSrc, "SourceFilename"),
                                       CXT_Attribute, "relativeToVRT"),
                      CXT_Text, bRelativeToVRT ? "1" : "0");
 
-    // Determine if we must write the shared attribute. The config option
-    // will override the m_nExplicitSharedStatus value
-    const char *pszShared = CPLGetConfigOption("VRT_SHARED_SOURCE", nullptr);
-    if ((pszShared == nullptr && m_nExplicitSharedStatus == 0) ||
-        (pszShared != nullptr && !CPLTestBool(pszShared)))
+    // Determine if we must write the shared attribute.
+    if (IsSerializedAsUnshared())
     {
         CPLCreateXMLNode(
             CPLCreateXMLNode(CPLGetXMLNode(psSrc, "SourceFilename"),
@@ -19,7 +19,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 
 // Suppress deprecation warning for GDALOpenVerticalShiftGrid and
 // GDALApplyVerticalShiftGrid
@@ -30,6 +33,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -38,6 +42,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdalwarper.h"
 #include "ogr_geometry.h"
 
@@ -1872,6 +1877,411 @@ CPLErr VRTWarpedDataset::ProcessBlock(int iBlockX, int iBlockY)
     return CE_None;
 }
 
+/************************************************************************/
+/*                     VRTWarpedSourceWindowCache                       */
+/************************************************************************/
+
+namespace
+{
+
+/** Source window of a VRTWarpedDataset::IRasterIO() request, read once by
+ * the calling thread, and shared by the jobs warping the blocks of the
+ * request.
+ */
+struct VRTWarpedSourceWindowCache
+{
+    GDALDataset *poSrcDS = nullptr;
+
+    //! Serializes the accesses to poSrcDS done by the jobs
+    std::mutex oMutex{};
+
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+
+    //! Map from a source band number to the data type and pixels of the window
+    std::map<int, std::pair<GDALDataType, const GByte *>> oMapBands{};
+};
+
+/************************************************************************/
+/*                     VRTWarpedSourceWindowBand                        */
+/************************************************************************/
+
+/** Band of VRTWarpedSourceWindowDataset */
+class VRTWarpedSourceWindowBand final : public GDALRasterBand
+{
+    VRTWarpedSourceWindowCache &m_oCache;
+
+    CPL_DISALLOW_COPY_ASSIGN(VRTWarpedSourceWindowBand)
+
+  public:
+    VRTWarpedSourceWindowBand(GDALDataset *poDSIn, int nBandIn,
+                              VRTWarpedSourceWindowCache &oCache)
+        : m_oCache(oCache)
+    {
+        poDS = poDSIn;
+        nBand = nBandIn;
+        nRasterXSize = poDSIn->GetRasterXSize();
+        nRasterYSize = poDSIn->GetRasterYSize();
+        GDALRasterBand *poSrcBand = oCache.poSrcDS->GetRasterBand(nBandIn);
+        eDataType = poSrcBand->GetRasterDataType();
+        poSrcBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    }
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override
+    {
+        const int nXOff = nBlockXOff * nBlockXSize;
+        const int nYOff = nBlockYOff * nBlockYSize;
+        const int nXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+        const int nYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        return IRasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, pImage, nXSize,
+                         nYSize, eDataType, nDTSize,
+                         static_cast<GSpacing>(nDTSize) * nBlockXSize,
+                         &sExtraArg);
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override
+    {
+        const auto oIter = m_oCache.oMapBands.find(nBand);
+        if (eRWFlag == GF_Read && oIter != m_oCache.oMapBands.end() &&
+            nBufXSize == nXSize && nBufYSize == nYSize &&
+            nXOff >= m_oCache.nXOff && nYOff >= m_oCache.nYOff &&
+            nXOff + nXSize <= m_oCache.nXOff + m_oCache.nXSize &&
+            nYOff + nYSize <= m_oCache.nYOff + m_oCache.nYSize)
+        {
+            const GDALDataType eCacheDT = oIter->second.first;
+            const int nCacheDTSize = GDALGetDataTypeSizeBytes(eCacheDT);
+            for (int iY = 0; iY < nYSize; ++iY)
+            {
+                const size_t nSrcOffset =
+                    (static_cast<size_t>(nYOff - m_oCache.nYOff + iY) *
+                         m_oCache.nXSize +
+                     (nXOff - m_oCache.nXOff)) *
+                    nCacheDTSize;
+                GDALCopyWords(oIter->second.second + nSrcOffset, eCacheDT,
+                              nCacheDTSize,
+                              static_cast<GByte *>(pData) + iY * nLineSpace,
+                              eBufType, static_cast<int>(nPixelSpace), nXSize);
+            }
+            return CE_None;
+        }
+
+        // Not in the window read upfront: forward to the real source.
+        std::lock_guard oLock(m_oCache.oMutex);
+        return m_oCache.poSrcDS->GetRasterBand(nBand)->RasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+};
+
+/************************************************************************/
+/*                    VRTWarpedSourceWindowDataset                      */
+/************************************************************************/
+
+/** Read-only view of the source dataset of a VRTWarpedDataset, used as the
+ * source of the GDALWarpOperation of a job of
+ * VRTWarpedDataset::WarpMultiThreaded(). Requests within the window read
+ * upfront are served from memory, and other ones are forwarded to the real
+ * source dataset, one job at a time.
+ */
+class VRTWarpedSourceWindowDataset final : public GDALDataset
+{
+  public:
+    explicit VRTWarpedSourceWindowDataset(VRTWarpedSourceWindowCache &oCache)
+    {
+        nRasterXSize = oCache.poSrcDS->GetRasterXSize();
+        nRasterYSize = oCache.poSrcDS->GetRasterYSize();
+        for (int i = 1; i <= oCache.poSrcDS->GetRasterCount(); ++i)
+            SetBand(i, new VRTWarpedSourceWindowBand(this, i, oCache));
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                         GetWarpNumThreads()                          */
+/************************************************************************/
+
+static int GetWarpNumThreads()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_VRT_WARP_NUM_THREADS", "1");
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::max(1, atoi(pszNumThreads));
+}
+
+/************************************************************************/
+/*                         WarpMultiThreaded()                          */
+/************************************************************************/
+
+/** Warp a request covering several blocks by warping each block in a job of
+ * the global thread pool, when GDAL_VRT_WARP_NUM_THREADS is set.
+ *
+ * Each job owns its GDALWarpOperation, with a clone of the transformer. The
+ * source window of the whole request is read once by the calling thread, and
+ * shared by the jobs, so that source pixels needed by adjacent blocks are not
+ * read several times.
+ *
+ * bTried is set to false, and nothing is done, when the request is not
+ * eligible.
+ */
+CPLErr VRTWarpedDataset::WarpMultiThreaded(
+    int nXOff, int nYOff, int nXSize, int nYSize, GByte *pabyDst,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
+    const std::map<int, int> &oMapBandToWarpingBandIndex, int nSrcXOff,
+    int nSrcYOff, int nSrcXSize, int nSrcYSize, bool &bTried)
+{
+    bTried = false;
+
+    const int nMaxThreads = GetWarpNumThreads();
+    const int nChunksX = (nXOff + nXSize - 1) / m_nBlockXSize -
+                         nXOff / m_nBlockXSize + 1;
+    const int nChunksY = (nYOff + nYSize - 1) / m_nBlockYSize -
+                         nYOff / m_nBlockYSize + 1;
+    const int64_t nChunks = static_cast<int64_t>(nChunksX) * nChunksY;
+    if (nMaxThreads <= 1 || nChunks <= 1 || nSrcXSize <= 0 || nSrcYSize <= 0)
+        return CE_None;
+
+    const GDALWarpOptions *psWO = m_poWarper->GetOptions();
+    if (psWO->pfnSrcDensityMaskFunc != nullptr ||
+        psWO->papfnSrcPerBandValidityMaskFunc != nullptr ||
+        psWO->nBandCount <= 0)
+        return CE_None;
+
+    GDALDataset *poSrcDS = GDALDataset::FromHandle(psWO->hSrcDS);
+    if (psWO->nSrcAlphaBand <= 0)
+    {
+        // The per-dataset mask band would have to be read by the warper,
+        // which VRTWarpedSourceWindowDataset does not expose.
+        const int nMaskFlags =
+            poSrcDS->GetRasterBand(psWO->panSrcBands[0])->GetMaskFlags();
+        if ((nMaskFlags & GMF_PER_DATASET) && !(nMaskFlags & GMF_ALPHA))
+            return CE_None;
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(
+        static_cast<int>(std::min<int64_t>(nMaxThreads, nChunks)));
+    if (!poThreadPool)
+        return CE_None;
+    const int nThreads = static_cast<int>(
+        std::min<int64_t>(poThreadPool->GetThreadCount(), nChunks));
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the source window of the whole request.                    */
+    /* -------------------------------------------------------------------- */
+    VRTWarpedSourceWindowCache oCache;
+    oCache.poSrcDS = poSrcDS;
+    oCache.nXOff = nSrcXOff;
+    oCache.nYOff = nSrcYOff;
+    oCache.nXSize = nSrcXSize;
+    oCache.nYSize = nSrcYSize;
+
+    const int nWarpDTSize = GDALGetDataTypeSizeBytes(psWO->eWorkingDataType);
+    const size_t nBandPixels = static_cast<size_t>(nSrcXSize) * nSrcYSize;
+    std::vector<GByte> abySrcData;
+    std::vector<float> afSrcAlpha;
+    try
+    {
+        abySrcData.resize(nBandPixels * nWarpDTSize * psWO->nBandCount);
+        if (psWO->nSrcAlphaBand > 0)
+            afSrcAlpha.resize(nBandPixels);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return CE_None;
+    }
+
+    bTried = true;
+
+    if (poSrcDS->RasterIO(GF_Read, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+                          abySrcData.data(), nSrcXSize, nSrcYSize,
+                          psWO->eWorkingDataType, psWO->nBandCount,
+                          psWO->panSrcBands, 0, 0,
+                          static_cast<GSpacing>(nBandPixels) * nWarpDTSize,
+                          nullptr) != CE_None)
+    {
+        return CE_Failure;
+    }
+    for (int i = 0; i < psWO->nBandCount; ++i)
+    {
+        oCache.oMapBands[psWO->panSrcBands[i]] = std::make_pair(
+            psWO->eWorkingDataType,
+            abySrcData.data() + i * nBandPixels * nWarpDTSize);
+    }
+
+    // The alpha band is read as Float32 by GDALWarpSrcAlphaMasker()
+    if (psWO->nSrcAlphaBand > 0)
+    {
+        if (poSrcDS->GetRasterBand(psWO->nSrcAlphaBand)
+                ->RasterIO(GF_Read, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+                           afSrcAlpha.data(), nSrcXSize, nSrcYSize,
+                           GDT_Float32, 0, 0, nullptr) != CE_None)
+        {
+            return CE_Failure;
+        }
+        oCache.oMapBands[psWO->nSrcAlphaBand] = std::make_pair(
+            GDT_Float32, reinterpret_cast<const GByte *>(afSrcAlpha.data()));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create one warper per job.                                      */
+    /* -------------------------------------------------------------------- */
+    std::vector<std::unique_ptr<VRTWarpedSourceWindowDataset>> apoSrcWindowDS;
+    std::vector<std::unique_ptr<GDALWarpOperation>> apoWarpers;
+    const auto DestroyWarpers = [&apoWarpers]()
+    {
+        for (auto &poWarper : apoWarpers)
+        {
+            GDALDestroyTransformer(poWarper->GetOptions()->pTransformerArg);
+        }
+        apoWarpers.clear();
+    };
+
+    for (int i = 0; i < nThreads; ++i)
+    {
+        void *pTransformerArg = GDALCloneTransformer(psWO->pTransformerArg);
+        if (pTransformerArg == nullptr)
+            break;
+
+        apoSrcWindowDS.push_back(
+            std::make_unique<VRTWarpedSourceWindowDataset>(oCache));
+
+        GDALWarpOptions *psJobWO = GDALCloneWarpOptions(psWO);
+        psJobWO->hSrcDS = GDALDataset::ToHandle(apoSrcWindowDS.back().get());
+        psJobWO->pTransformerArg = pTransformerArg;
+        psJobWO->pfnProgress = GDALDummyProgress;
+        psJobWO->pProgressArg = nullptr;
+        // Parallelism is at the block level: do not multi-thread the kernel
+        psJobWO->papszWarpOptions =
+            CSLSetNameValue(psJobWO->papszWarpOptions, "NUM_THREADS", "1");
+
+        auto poWarper = std::make_unique<GDALWarpOperation>();
+        const CPLErr eErr = poWarper->Initialize(psJobWO);
+        GDALDestroyWarpOptions(psJobWO);
+        if (eErr != CE_None)
+        {
+            GDALDestroyTransformer(pTransformerArg);
+            break;
+        }
+        apoWarpers.push_back(std::move(poWarper));
+    }
+
+    if (apoWarpers.empty())
+    {
+        // Typically because the transformer cannot be cloned.
+        bTried = false;
+        return CE_None;
+    }
+
+    CPLDebugOnly("VRT",
+                 "VRTWarpedDataset::IRasterIO(): warping %d blocks with "
+                 "%d threads",
+                 static_cast<int>(nChunks),
+                 static_cast<int>(apoWarpers.size()));
+
+    /* -------------------------------------------------------------------- */
+    /*      Warp blocks.                                                    */
+    /* -------------------------------------------------------------------- */
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bSuccess = true;
+    std::atomic<int64_t> nNextChunk = 0;
+    const int nFirstChunkX = nXOff / m_nBlockXSize;
+    const int nFirstChunkY = nYOff / m_nBlockYSize;
+
+    const auto WarpChunks = [&](GDALWarpOperation *poWarper)
+    {
+        auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+
+        int64_t iChunk;
+        while (bSuccess && (iChunk = nNextChunk++) < nChunks)
+        {
+            const int iChunkX =
+                nFirstChunkX + static_cast<int>(iChunk % nChunksX);
+            const int iChunkY =
+                nFirstChunkY + static_cast<int>(iChunk / nChunksX);
+            const int nChunkXOff = std::max(nXOff, iChunkX * m_nBlockXSize);
+            const int nChunkYOff = std::max(nYOff, iChunkY * m_nBlockYSize);
+            const int nChunkXSize =
+                std::min(nXOff + nXSize, (iChunkX + 1) * m_nBlockXSize) -
+                nChunkXOff;
+            const int nChunkYSize =
+                std::min(nYOff + nYSize, (iChunkY + 1) * m_nBlockYSize) -
+                nChunkYOff;
+
+            GByte *pabyWarpBuffer = static_cast<GByte *>(
+                poWarper->CreateDestinationBuffer(nChunkXSize, nChunkYSize));
+            if (pabyWarpBuffer == nullptr ||
+                poWarper->WarpRegionToBuffer(nChunkXOff, nChunkYOff,
+                                             nChunkXSize, nChunkYSize,
+                                             pabyWarpBuffer,
+                                             psWO->eWorkingDataType) !=
+                    CE_None)
+            {
+                GDALWarpOperation::DestroyDestinationBuffer(pabyWarpBuffer);
+                bSuccess = false;
+                break;
+            }
+
+            // Copy the warping buffer into the user buffer
+            GByte *const pabyChunkDst =
+                pabyDst + (nChunkXOff - nXOff) * nPixelSpace +
+                (nChunkYOff - nYOff) * nLineSpace;
+            for (int i = 0; i < nBandCount; ++i)
+            {
+                const int iWarpingBand =
+                    oMapBandToWarpingBandIndex.find(panBandMap[i])->second;
+                const GByte *const pabyWarpBandBuffer =
+                    pabyWarpBuffer + static_cast<GPtrDiff_t>(iWarpingBand) *
+                                         nChunkXSize * nChunkYSize *
+                                         nWarpDTSize;
+                for (int iY = 0; iY < nChunkYSize; ++iY)
+                {
+                    GDALCopyWords(pabyWarpBandBuffer +
+                                      static_cast<GPtrDiff_t>(iY) *
+                                          nChunkXSize * nWarpDTSize,
+                                  psWO->eWorkingDataType, nWarpDTSize,
+                                  pabyChunkDst + i * nBandSpace +
+                                      iY * nLineSpace,
+                                  eBufType, static_cast<int>(nPixelSpace),
+                                  nChunkXSize);
+                }
+            }
+
+            GDALWarpOperation::DestroyDestinationBuffer(pabyWarpBuffer);
+        }
+    };
+
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (auto &poWarper : apoWarpers)
+    {
+        GDALWarpOperation *poJobWarper = poWarper.get();
+        if (!poQueue->SubmitJob([&WarpChunks, poJobWarper]()
+                                { WarpChunks(poJobWarper); }))
+        {
+            bSuccess = false;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    DestroyWarpers();
+
+    return bSuccess ? CE_None : CE_Failure;
+}
+
 /************************************************************************/
 /*                              IRasterIO()                             */
 /************************************************************************/
@@ -2086,6 +2496,17 @@ CPLErr VRTWarpedDataset::IRasterIO(
         return bOK ? CE_None : CE_Failure;
     }
 
+    {
+        bool bTried = false;
+        const CPLErr eErr = WarpMultiThreaded(
+            nXOff, nYOff, nXSize, nYSize, pabyDst, eBufType, nBandCount,
+            panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+            oMapBandToWarpingBandIndex, nSrcXOff, nSrcYOff, nSrcXSize,
+            nSrcYSize, bTried);
+        if (bTried)
+            return eErr;
+    }
+
     CPLDebugOnly("VRT",
                  "Using optimized VRTWarpedDataset::IRasterIO() code path");
 
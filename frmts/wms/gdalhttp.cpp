@@ -107,6 +107,11 @@ void WMSHTTPInitializeRequest(WMSHTTPRequest *psRequest)
     CPL_IGNORE_RET_VAL(curl_easy_setopt(psRequest->m_curl_handle,
                                         CURLOPT_WRITEFUNCTION, WriteFunc));
 
+    // With HTTP/2, prefer multiplexing the request over an existing
+    // connection to the server rather than opening a new one.
+    CPL_IGNORE_RET_VAL(
+        curl_easy_setopt(psRequest->m_curl_handle, CURLOPT_PIPEWAIT, 1L));
+
     psRequest->m_curl_error.resize(CURL_ERROR_SIZE + 1);
     CPL_IGNORE_RET_VAL(curl_easy_setopt(psRequest->m_curl_handle,
                                         CURLOPT_ERRORBUFFER,
@@ -142,10 +147,10 @@ WMSHTTPRequest::~WMSHTTPRequest()
 // Like CPLHTTPFetch, but multiple requests in parallel
 // By default it uses 5 connections
 //
-CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
+CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount,
+                         CURLM *curl_multi)
 {
     CPLErr ret = CE_None;
-    CURLM *curl_multi = nullptr;
     int max_conn;
     int i, conn_i;
 
@@ -189,12 +194,23 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
         return CE_None;
     }
 
-    curl_multi = curl_multi_init();
-    if (curl_multi == nullptr)
+    const bool bOwnMulti = curl_multi == nullptr;
+    if (bOwnMulti)
     {
-        CPLError(CE_Fatal, CPLE_AppDefined,
-                 "CPLHTTPFetchMulti(): Unable to create CURL multi-handle.");
+        curl_multi = curl_multi_init();
+        if (curl_multi == nullptr)
+        {
+            CPLError(
+                CE_Fatal, CPLE_AppDefined,
+                "CPLHTTPFetchMulti(): Unable to create CURL multi-handle.");
+        }
     }
+    // Multiplex requests to the same server over a single HTTP/2 connection
+    // when possible, and never open more than max_conn connections to it.
+    curl_multi_setopt(curl_multi, CURLMOPT_PIPELINING,
+                      static_cast<long>(CURLPIPE_MULTIPLEX));
+    curl_multi_setopt(curl_multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                      static_cast<long>(max_conn));
 
     // add at most max_conn requests
     int torun = std::min(nRequestCount, max_conn);
@@ -316,10 +332,11 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
                                             : "(null)",
             !psRequest->Error.empty() ? psRequest->Error.c_str() : "(null)");
 
-        curl_multi_remove_handle(curl_multi, pasRequest->m_curl_handle);
+        curl_multi_remove_handle(curl_multi, psRequest->m_curl_handle);
     }
 
-    curl_multi_cleanup(curl_multi);
+    if (bOwnMulti)
+        curl_multi_cleanup(curl_multi);
 
     return ret;
 }
@@ -55,6 +55,9 @@ struct WMSHTTPRequest
 
 // Not public, only for use within WMS
 void WMSHTTPInitializeRequest(WMSHTTPRequest *psRequest);
-CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *psRequest, int nRequestCount = 1);
+// If curl_multi is not null, it is used instead of a temporary multi handle,
+// so that its pool of connections is reused across calls.
+CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *psRequest, int nRequestCount = 1,
+                         CURLM *curl_multi = nullptr);
 
 #endif /*  GDALHTTP_H */
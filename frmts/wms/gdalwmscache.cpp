@@ -16,6 +16,14 @@
 #include "cpl_md5.h"
 #include "wmsdriver.h"
 
+#include <climits>
+#include <cstdlib>
+#include <memory>
+
+#ifdef HAVE_SQLITE
+#include <sqlite3.h>
+#endif
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
@@ -201,6 +209,216 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     int m_nCleanThreadRunTimeout;
 };
 
+#ifdef HAVE_SQLITE
+//------------------------------------------------------------------------------
+// GDALWMSSQLiteCache
+//------------------------------------------------------------------------------
+
+// Stores all tiles in a single SQLite database, named cache.sqlite in the
+// cache path, instead of one file per tile.
+class GDALWMSSQLiteCache : public GDALWMSCacheImpl
+{
+  public:
+    GDALWMSSQLiteCache(const CPLString &soPath, CPLXMLNode *pConfig)
+        : GDALWMSCacheImpl(soPath, pConfig),
+          m_nExpires(604800),            // 7 days
+          m_nMaxSize(67108864),          // 64 Mb
+          m_nCleanThreadRunTimeout(120)  // 3 min
+    {
+        const char *pszCacheExpires =
+            CPLGetXMLValue(pConfig, "Expires", nullptr);
+        if (pszCacheExpires != nullptr)
+        {
+            m_nExpires = atoi(pszCacheExpires);
+            CPLDebug("WMS", "Cache expires in %d sec", m_nExpires);
+        }
+
+        const char *pszCacheMaxSize =
+            CPLGetXMLValue(pConfig, "MaxSize", nullptr);
+        if (pszCacheMaxSize != nullptr)
+            m_nMaxSize = std::strtoll(pszCacheMaxSize, nullptr, 10);
+
+        const char *pszCleanThreadRunTimeout =
+            CPLGetXMLValue(pConfig, "CleanTimeout", nullptr);
+        if (pszCleanThreadRunTimeout != nullptr)
+        {
+            m_nCleanThreadRunTimeout = atoi(pszCleanThreadRunTimeout);
+            CPLDebug("WMS", "Clean Thread Run Timeout is %d sec",
+                     m_nCleanThreadRunTimeout);
+        }
+
+        VSIMkdirRecursive(m_soPath, 0755);
+        const std::string osDBFilename =
+            CPLFormFilenameSafe(m_soPath, "cache.sqlite", nullptr);
+        // The connection is used by the thread of the dataset and by the
+        // clean thread, hence SQLITE_OPEN_FULLMUTEX.
+        if (sqlite3_open_v2(osDBFilename.c_str(), &m_hDB,
+                            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE |
+                                SQLITE_OPEN_FULLMUTEX,
+                            nullptr) != SQLITE_OK ||
+            sqlite3_exec(m_hDB,
+                         "CREATE TABLE IF NOT EXISTS tiles("
+                         "key TEXT PRIMARY KEY, "
+                         "mtime INTEGER NOT NULL, "
+                         "data BLOB NOT NULL)",
+                         nullptr, nullptr, nullptr) != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_OpenFailed,
+                     "Cannot open WMS cache database %s: %s",
+                     osDBFilename.c_str(),
+                     m_hDB ? sqlite3_errmsg(m_hDB) : "out of memory");
+            sqlite3_close(m_hDB);
+            m_hDB = nullptr;
+            return;
+        }
+        // Wait for other processes sharing the same cache
+        sqlite3_busy_timeout(m_hDB, 5000);
+    }
+
+    ~GDALWMSSQLiteCache() override
+    {
+        if (m_hDB)
+            sqlite3_close(m_hDB);
+    }
+
+    bool IsValid() const
+    {
+        return m_hDB != nullptr;
+    }
+
+    virtual int GetCleanThreadRunTimeout() override
+    {
+        return m_nCleanThreadRunTimeout;
+    }
+
+    virtual CPLErr Insert(const char *pszKey,
+                          const CPLString &osFileName) override
+    {
+        // Warns if it fails to write, but returns success
+        GByte *pabyData = nullptr;
+        vsi_l_offset nSize = 0;
+        if (!VSIIngestFile(nullptr, osFileName, &pabyData, &nSize,
+                           INT_MAX - 1))
+        {
+            CPLError(CE_Warning, CPLE_FileIO, "Error writing to WMS cache %s",
+                     m_soPath.c_str());
+            return CE_None;
+        }
+
+        sqlite3_stmt *hStmt = nullptr;
+        if (sqlite3_prepare_v2(m_hDB,
+                               "INSERT OR REPLACE INTO tiles(key, mtime, data) "
+                               "VALUES (?, ?, ?)",
+                               -1, &hStmt, nullptr) != SQLITE_OK ||
+            sqlite3_bind_text(hStmt, 1, pszKey, -1, nullptr) != SQLITE_OK ||
+            sqlite3_bind_int64(hStmt, 2, static_cast<sqlite3_int64>(
+                                             time(nullptr))) != SQLITE_OK ||
+            sqlite3_bind_blob(hStmt, 3, pabyData, static_cast<int>(nSize),
+                              nullptr) != SQLITE_OK ||
+            sqlite3_step(hStmt) != SQLITE_DONE)
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Error writing to WMS cache %s: %s", m_soPath.c_str(),
+                     sqlite3_errmsg(m_hDB));
+        }
+        sqlite3_finalize(hStmt);
+        VSIFree(pabyData);
+        return CE_None;
+    }
+
+    virtual enum GDALWMSCacheItemStatus
+    GetItemStatus(const char *pszKey) const override
+    {
+        sqlite3_stmt *hStmt = nullptr;
+        GDALWMSCacheItemStatus eStatus = CACHE_ITEM_NOT_FOUND;
+        if (sqlite3_prepare_v2(m_hDB, "SELECT mtime FROM tiles WHERE key = ?",
+                               -1, &hStmt, nullptr) == SQLITE_OK &&
+            sqlite3_bind_text(hStmt, 1, pszKey, -1, nullptr) == SQLITE_OK &&
+            sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            const auto seconds = static_cast<GIntBig>(time(nullptr)) -
+                                 sqlite3_column_int64(hStmt, 0);
+            eStatus =
+                seconds < m_nExpires ? CACHE_ITEM_OK : CACHE_ITEM_EXPIRED;
+        }
+        sqlite3_finalize(hStmt);
+        return eStatus;
+    }
+
+    virtual GDALDataset *GetDataset(const char *pszKey,
+                                    char **papszOpenOptions) const override
+    {
+        sqlite3_stmt *hStmt = nullptr;
+        GByte *pabyData = nullptr;
+        int nSize = 0;
+        if (sqlite3_prepare_v2(m_hDB, "SELECT data FROM tiles WHERE key = ?",
+                               -1, &hStmt, nullptr) == SQLITE_OK &&
+            sqlite3_bind_text(hStmt, 1, pszKey, -1, nullptr) == SQLITE_OK &&
+            sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            nSize = sqlite3_column_bytes(hStmt, 0);
+            pabyData = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize));
+            if (pabyData)
+                memcpy(pabyData, sqlite3_column_blob(hStmt, 0), nSize);
+        }
+        sqlite3_finalize(hStmt);
+        if (pabyData == nullptr)
+            return nullptr;
+
+        const CPLString osTmpFilename(
+            VSIMemGenerateHiddenFilename("wmscachetile.dat"));
+        VSILFILE *fp =
+            VSIFileFromMemBuffer(osTmpFilename, pabyData, nSize, true);
+        if (fp == nullptr)
+            return nullptr;
+        VSIFCloseL(fp);
+        auto poDS = GDALDataset::FromHandle(GDALOpenEx(
+            osTmpFilename,
+            GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR, nullptr,
+            papszOpenOptions, nullptr));
+        // The dataset keeps its own handle on the file content
+        VSIUnlink(osTmpFilename);
+        return poDS;
+    }
+
+    virtual void Clean() override
+    {
+        sqlite3_stmt *hStmt = nullptr;
+        GIntBig nSize = 0;
+        if (sqlite3_prepare_v2(m_hDB, "SELECT SUM(LENGTH(data)) FROM tiles",
+                               -1, &hStmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            nSize = sqlite3_column_int64(hStmt, 0);
+        }
+        sqlite3_finalize(hStmt);
+
+        if (nSize > m_nMaxSize)
+        {
+            hStmt = nullptr;
+            if (sqlite3_prepare_v2(m_hDB, "DELETE FROM tiles WHERE mtime < ?",
+                                   -1, &hStmt, nullptr) == SQLITE_OK &&
+                sqlite3_bind_int64(
+                    hStmt, 1,
+                    static_cast<sqlite3_int64>(time(nullptr)) - m_nExpires) ==
+                    SQLITE_OK &&
+                sqlite3_step(hStmt) == SQLITE_DONE)
+            {
+                CPLDebug("WMS", "Delete %d items from cache",
+                         sqlite3_changes(m_hDB));
+            }
+            sqlite3_finalize(hStmt);
+        }
+    }
+
+  private:
+    sqlite3 *m_hDB = nullptr;
+    int m_nExpires;
+    GIntBig m_nMaxSize;
+    int m_nCleanThreadRunTimeout;
+};
+#endif  // HAVE_SQLITE
+
 //------------------------------------------------------------------------------
 // GDALWMSCache
 //------------------------------------------------------------------------------
@@ -295,12 +513,26 @@ CPLErr GDALWMSCache::Initialize(const char *pszUrl, CPLXMLNode *pConfig)
     }
     CPLDebug("WMS", "Using %s for cache", m_osCachePath.c_str());
 
-    // TODO: Add sqlite db cache type
     const char *pszType = CPLGetXMLValue(pConfig, "Type", "file");
     if (EQUAL(pszType, "file"))
     {
         m_poCache = new GDALWMSFileCache(m_osCachePath, pConfig);
     }
+    else if (EQUAL(pszType, "sqlite"))
+    {
+#ifdef HAVE_SQLITE
+        auto poCache =
+            std::make_unique<GDALWMSSQLiteCache>(m_osCachePath, pConfig);
+        if (!poCache->IsValid())
+            return CE_Failure;
+        m_poCache = poCache.release();
+#else
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "sqlite cache type not available: "
+                 "GDAL built without SQLite support");
+        return CE_Failure;
+#endif
+    }
 
     return CE_None;
 }
@@ -63,6 +63,8 @@ GDALWMSDataset::~GDALWMSDataset()
         delete m_poColorTable;
     CSLDestroy(m_http_options);
     CSLDestroy(m_tileOO);
+    if (m_curl_multi)
+        curl_multi_cleanup(m_curl_multi);
 }
 
 /************************************************************************/
@@ -161,6 +163,12 @@ CPLErr GDALWMSDataset::Initialize(CPLXMLNode *config, char **l_papszOpenOptions)
         }
     }
 
+    if (ret == CE_None)
+    {
+        m_prefetch_tiles =
+            std::max(0, atoi(CPLGetXMLValue(config, "PrefetchTiles", "0")));
+    }
+
     if (ret == CE_None)
     {
         const char *timeout = CPLGetXMLValue(config, "Timeout", "");
@@ -882,6 +890,15 @@ const char *const *GDALWMSDataset::GetHTTPRequestOpts()
     return m_http_options;
 }
 
+// Returns the multi handle, created on first use, that holds the pool of
+// connections to the server(s)
+CURLM *GDALWMSDataset::GetCurlMultiHandle()
+{
+    if (m_curl_multi == nullptr)
+        m_curl_multi = curl_multi_init();
+    return m_curl_multi;
+}
+
 void GDALWMSDataset::SetTileOO(const char *pszName, const char *pszValue)
 {
     if (pszName == nullptr || strlen(pszName) == 0)
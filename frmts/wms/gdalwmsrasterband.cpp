@@ -15,7 +15,11 @@
 
 #include "wmsdriver.h"
 
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
+
 #include <algorithm>
+#include <memory>
 
 GDALWMSRasterBand::GDALWMSRasterBand(GDALWMSDataset *parent_dataset, int band,
                                      double scale)
@@ -62,6 +66,73 @@ GDALWMSRasterBand::~GDALWMSRasterBand()
     }
 }
 
+// Whether the downloaded data is an XML document, typically a service
+// exception, rather than an image
+static bool IsXMLResponse(const WMSHTTPRequest &request)
+{
+    if (request.nDataLen < 20)
+        return false;
+    const char *download_data = reinterpret_cast<char *>(request.pabyData);
+    return STARTS_WITH_CI(download_data, "<?xml ") ||
+           STARTS_WITH_CI(download_data, "<!DOCTYPE ") ||
+           STARTS_WITH_CI(download_data, "<ServiceException");
+}
+
+// Opens the downloaded tiles in worker threads of the global thread pool, and
+// decodes them into MEM datasets. Tiles that cannot be decoded are left to
+// the sequential code path, which reports the errors.
+static void DecodeTiles(const std::vector<CPLString> &file_names,
+                        CSLConstList papszOpenOptions,
+                        std::vector<std::unique_ptr<GDALDataset>> &decoded)
+{
+    const int nTiles = static_cast<int>(
+        std::count_if(file_names.begin(), file_names.end(),
+                      [](const CPLString &s) { return !s.empty(); }));
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                     : atoi(pszNumThreads);
+    nThreads = std::min(std::min(1024, nThreads), nTiles);
+    if (nThreads <= 1)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    GDALDriver *poMEMDriver =
+        GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poThreadPool || !poMEMDriver)
+        return;
+
+    auto poQueue = poThreadPool->CreateJobQueue();
+    std::vector<CPLErrorAccumulator> errors(file_names.size());
+    for (size_t i = 0; i < file_names.size(); ++i)
+    {
+        if (file_names[i].empty())
+            continue;
+        poQueue->SubmitJob(
+            [&file_names, &decoded, &errors, papszOpenOptions, poMEMDriver, i]()
+            {
+                auto oAccumulator = errors[i].InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                std::unique_ptr<GDALDataset> poTileDS(GDALDataset::Open(
+                    file_names[i].c_str(),
+                    GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR,
+                    nullptr, papszOpenOptions, nullptr));
+                if (poTileDS)
+                {
+                    decoded[i].reset(poMEMDriver->CreateCopy(
+                        "", poTileDS.get(), false, nullptr, nullptr, nullptr));
+                }
+            });
+    }
+    poQueue->WaitCompletion();
+
+    for (size_t i = 0; i < file_names.size(); ++i)
+    {
+        if (decoded[i])
+            errors[i].ReplayErrors();
+    }
+}
+
 // Request for x, y but all blocks between bx0-bx1 and by0-by1 should be read
 CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                                      int by0, int bx1, int by1, int advise_read)
@@ -181,45 +252,63 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
 
     // Fetch all the requests, OK to call with count of 0
     if (WMSHTTPFetchMulti(count ? &requests[0] : nullptr,
-                          static_cast<int>(count)) != CE_None)
+                          static_cast<int>(count),
+                          count ? m_parent_dataset->GetCurlMultiHandle()
+                                : nullptr) != CE_None)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "GDALWMS: CPLHTTPFetchMulti failed.");
         ret = CE_Failure;
     }
 
+    const auto IsSuccess = [](const WMSHTTPRequest &request)
+    {
+        return ((request.nStatus == 200) ||
+                (!request.Range.empty() && request.nStatus == 206)) &&
+               request.pabyData != nullptr && request.nDataLen > 0;
+    };
+
+    // Decode the downloaded tiles in parallel, before they are dispatched to
+    // the block cache of the bands
+    std::vector<CPLString> file_names(count);
+    std::vector<std::unique_ptr<GDALDataset>> decoded(count);
+    if (ret == CE_None && count > 1 &&
+        (!advise_read || m_parent_dataset->m_verify_advise_read))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (IsSuccess(requests[i]) && !IsXMLResponse(requests[i]))
+                file_names[i] = BufferToVSIFile(requests[i].pabyData,
+                                                requests[i].nDataLen);
+        }
+        DecodeTiles(file_names, m_parent_dataset->m_tileOO, decoded);
+    }
+
     for (size_t i = 0; i < count; ++i)
     {
         WMSHTTPRequest &request = requests[i];
         void *p = ((request.x == x) && (request.y == y)) ? buffer : nullptr;
         if (ret == CE_None)
         {
-            int success = (request.nStatus == 200) ||
-                          (!request.Range.empty() && request.nStatus == 206);
-            if (success && (request.pabyData != nullptr) &&
-                (request.nDataLen > 0))
+            if (IsSuccess(request))
             {
                 CPLString file_name(
-                    BufferToVSIFile(request.pabyData, request.nDataLen));
+                    !file_names[i].empty()
+                        ? file_names[i]
+                        : BufferToVSIFile(request.pabyData, request.nDataLen));
+                file_names[i].clear();
                 if (!file_name.empty())
                 {
                     /* check for error xml */
-                    if (request.nDataLen >= 20)
+                    if (IsXMLResponse(request))
                     {
-                        const char *download_data =
-                            reinterpret_cast<char *>(request.pabyData);
-                        if (STARTS_WITH_CI(download_data, "<?xml ") ||
-                            STARTS_WITH_CI(download_data, "<!DOCTYPE ") ||
-                            STARTS_WITH_CI(download_data, "<ServiceException"))
+                        if (ReportWMSException(file_name) != CE_None)
                         {
-                            if (ReportWMSException(file_name) != CE_None)
-                            {
-                                CPLError(CE_Failure, CPLE_AppDefined,
-                                         "GDALWMS: The server returned unknown "
-                                         "exception.");
-                            }
-                            ret = CE_Failure;
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "GDALWMS: The server returned unknown "
+                                     "exception.");
                         }
+                        ret = CE_Failure;
                     }
                     if (ret == CE_None)
                     {
@@ -231,9 +320,13 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         }
                         else
                         {
-                            ret = ReadBlockFromFile(file_name, request.x,
-                                                    request.y, nBand, p,
-                                                    advise_read);
+                            ret = decoded[i]
+                                      ? ReadBlockFromDataset(
+                                            decoded[i].release(), request.x,
+                                            request.y, nBand, p, advise_read)
+                                      : ReadBlockFromFile(file_name, request.x,
+                                                          request.y, nBand, p,
+                                                          advise_read);
                             if (ret == CE_None)
                             {
                                 if (cache != nullptr)
@@ -306,6 +399,13 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
         }
     }
 
+    // Files of tiles not processed because of an earlier error
+    for (const auto &file_name : file_names)
+    {
+        if (!file_name.empty())
+            VSIUnlink(file_name);
+    }
+
     return ret;
 }
 
@@ -341,6 +441,17 @@ CPLErr GDALWMSRasterBand::IReadBlock(int x, int y, void *buffer)
         }
     }
 
+    const int prefetch_tiles = std::min(m_parent_dataset->m_prefetch_tiles, 15);
+    if (bx0 == bx1 && by0 == by1 && prefetch_tiles > 0)
+    {
+        // Fetch the neighbouring tiles along with this one, anticipating
+        // panning around it.
+        bx0 = std::max(x - prefetch_tiles, 0);
+        by0 = std::max(y - prefetch_tiles, 0);
+        bx1 = std::min(x + prefetch_tiles, nBlocksPerRow - 1);
+        by1 = std::min(y + prefetch_tiles, nBlocksPerColumn - 1);
+    }
+
     CPLErr eErr = ReadBlocks(x, y, buffer, bx0, by0, bx1, by1, 0);
 
     if (bCancelHint)
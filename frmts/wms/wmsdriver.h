@@ -459,6 +459,7 @@ class GDALWMSDataset final : public GDALPamDataset
                                    void *pProgressData);
 
     const char *const *GetHTTPRequestOpts();
+    CURLM *GetCurlMultiHandle();
 
     static const char *GetServerConfig(const char *URI,
                                        char **papszHTTPOptions);
@@ -493,6 +494,10 @@ class GDALWMSDataset final : public GDALPamDataset
     int m_http_max_conn;
     int m_http_timeout;
     char **m_http_options;
+    // Kept across requests, so that connections to the server are reused
+    CURLM *m_curl_multi = nullptr;
+    // Number of rings of neighbouring tiles fetched with a requested tile
+    int m_prefetch_tiles = 0;
     // Open Option list for tiles
     char **m_tileOO;
     int m_clamp_requests;
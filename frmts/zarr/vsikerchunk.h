@@ -0,0 +1,23 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Zarr driver. Virtual file system for Kerchunk reference files
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef VSIKERCHUNK_H
+#define VSIKERCHUNK_H
+
+#include <string>
+
+constexpr const char *JSON_REF_FS_PREFIX = "/vsikerchunk_json_ref/";
+
+void VSIInstallKerchunkJSONRefFileSystem();
+
+std::string VSIKerchunkGetJSONRefPath(const std::string &osJSONFilename);
+
+#endif  // VSIKERCHUNK_H
@@ -0,0 +1,512 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Zarr driver. Virtual file system for Kerchunk JSON reference
+ *           files.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+// Kerchunk reference files map the keys of a Zarr V2 store (".zgroup",
+// "var/.zarray", "var/0.0", ...) to either inline content, or to a byte range
+// of another file. See https://fsspec.github.io/kerchunk/spec.html
+//
+// This file system exposes such a mapping as a directory hierarchy, so that
+// the Zarr driver can read it as any other Zarr store:
+// /vsikerchunk_json_ref/{/path/to/refs.json}/var/0.0
+
+#include "vsikerchunk.h"
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_mem_cache.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+/************************************************************************/
+/*                       VSIKerchunkKeyInfo                             */
+/************************************************************************/
+
+struct VSIKerchunkKeyInfo
+{
+    //! Inline content, if osURI is empty
+    std::string osValue{};
+    //! Filename (VSI path) of the referenced file
+    std::string osURI{};
+    //! Whether nOffset and nSize are set. Otherwise the whole file is used.
+    bool bHasRange = false;
+    uint64_t nOffset = 0;
+    uint64_t nSize = 0;
+};
+
+/************************************************************************/
+/*                       VSIKerchunkRefFile                             */
+/************************************************************************/
+
+class VSIKerchunkRefFile
+{
+    std::map<std::string, VSIKerchunkKeyInfo> m_oMapKeys{};
+    //! Map from a directory to the names of its children
+    std::map<std::string, std::set<std::string>> m_oMapDirs{};
+
+    void AddKey(const std::string &osKey, VSIKerchunkKeyInfo &&info);
+
+  public:
+    bool Load(const std::string &osJSONFilename);
+
+    const VSIKerchunkKeyInfo *GetKey(const std::string &osKey) const
+    {
+        const auto oIter = m_oMapKeys.find(osKey);
+        return oIter == m_oMapKeys.end() ? nullptr : &(oIter->second);
+    }
+
+    const std::set<std::string> *GetDirChildren(const std::string &osDir) const
+    {
+        const auto oIter = m_oMapDirs.find(osDir);
+        return oIter == m_oMapDirs.end() ? nullptr : &(oIter->second);
+    }
+};
+
+/************************************************************************/
+/*                    VSIKerchunkMorphURIToVSIPath()                    */
+/************************************************************************/
+
+static std::string VSIKerchunkMorphURIToVSIPath(const std::string &osURI,
+                                                const std::string &osRootDir)
+{
+    static const struct
+    {
+        const char *pszFSSpecPrefix;
+        const char *pszVSIPrefix;
+    } substitutions[] = {
+        {"s3://", "/vsis3/"},
+        {"gs://", "/vsigs/"},
+        {"gcs://", "/vsigs/"},
+        {"az://", "/vsiaz/"},
+        {"azure://", "/vsiaz/"},
+        {"abfs://", "/vsiaz/"},
+        {"http://", "/vsicurl/http://"},
+        {"https://", "/vsicurl/https://"},
+        {"file://", ""},
+    };
+
+    for (const auto &substitution : substitutions)
+    {
+        if (STARTS_WITH(osURI.c_str(), substitution.pszFSSpecPrefix))
+        {
+            return std::string(substitution.pszVSIPrefix)
+                .append(osURI.c_str() + strlen(substitution.pszFSSpecPrefix));
+        }
+    }
+
+    if (CPLIsFilenameRelative(osURI.c_str()))
+        return CPLFormFilenameSafe(osRootDir.c_str(), osURI.c_str(), nullptr);
+
+    return osURI;
+}
+
+/************************************************************************/
+/*                   VSIKerchunkRefFile::AddKey()                       */
+/************************************************************************/
+
+void VSIKerchunkRefFile::AddKey(const std::string &osKey,
+                                VSIKerchunkKeyInfo &&info)
+{
+    // Register all parent directories of the key
+    std::string osChild = osKey;
+    while (true)
+    {
+        const auto nPos = osChild.rfind('/');
+        const std::string osDir =
+            nPos == std::string::npos ? std::string() : osChild.substr(0, nPos);
+        const std::string osName =
+            nPos == std::string::npos ? osChild : osChild.substr(nPos + 1);
+        auto &oChildren = m_oMapDirs[osDir];
+        const bool bAlreadyKnown = cpl::contains(oChildren, osName);
+        oChildren.insert(osName);
+        if (bAlreadyKnown || osDir.empty())
+            break;
+        osChild = osDir;
+    }
+    m_oMapKeys[osKey] = std::move(info);
+}
+
+/************************************************************************/
+/*                    VSIKerchunkRefFile::Load()                        */
+/************************************************************************/
+
+bool VSIKerchunkRefFile::Load(const std::string &osJSONFilename)
+{
+    CPLJSONDocument oDoc;
+    if (!oDoc.Load(osJSONFilename))
+        return false;
+    const auto oRoot = oDoc.GetRoot();
+
+    // Version 1 has a "refs" member, version 0 directly the references.
+    const int nVersion = oRoot.GetInteger("version", 0);
+    const auto oRefs = nVersion == 1 ? oRoot.GetObj("refs") : oRoot;
+    if (nVersion > 1 || oRefs.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "%s: unsupported Kerchunk reference file",
+                 osJSONFilename.c_str());
+        return false;
+    }
+    if (oRoot.GetObj("gen").IsValid())
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "%s: 'gen' member of Kerchunk reference file is ignored",
+                 osJSONFilename.c_str());
+    }
+
+    std::map<std::string, std::string> oMapTemplates;
+    if (nVersion == 1)
+    {
+        for (const auto &oTemplate : oRoot.GetObj("templates").GetChildren())
+            oMapTemplates[oTemplate.GetName()] = oTemplate.ToString();
+    }
+
+    // References from a remote file to local files are not followed.
+    const std::string osRootDir = CPLGetPathSafe(osJSONFilename.c_str());
+    const bool bJSONIsLocal = VSIIsLocal(osJSONFilename.c_str());
+
+    for (const auto &oRef : oRefs.GetChildren())
+    {
+        const std::string osKey = oRef.GetName();
+        VSIKerchunkKeyInfo info;
+        switch (oRef.GetType())
+        {
+            case CPLJSONObject::Type::String:
+            {
+                info.osValue = oRef.ToString();
+                if (STARTS_WITH(info.osValue.c_str(), "base64:"))
+                {
+                    info.osValue = info.osValue.substr(strlen("base64:"));
+                    const int nSize = CPLBase64DecodeInPlace(
+                        reinterpret_cast<GByte *>(info.osValue.data()));
+                    info.osValue.resize(nSize);
+                }
+                break;
+            }
+
+            case CPLJSONObject::Type::Object:
+            {
+                // Some writers store .zarray/.zattrs content as JSON objects
+                info.osValue = oRef.Format(CPLJSONObject::PrettyFormat::Plain);
+                break;
+            }
+
+            case CPLJSONObject::Type::Array:
+            {
+                const auto oArray = oRef.ToArray();
+                if ((oArray.Size() != 1 && oArray.Size() != 3) ||
+                    oArray[0].GetType() != CPLJSONObject::Type::String)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "%s: invalid value for key '%s'",
+                             osJSONFilename.c_str(), osKey.c_str());
+                    return false;
+                }
+                std::string osURI = oArray[0].ToString();
+                for (const auto &[osName, osValue] : oMapTemplates)
+                {
+                    osURI = CPLString(osURI).replaceAll("{{" + osName + "}}",
+                                                        osValue);
+                }
+                info.osURI = VSIKerchunkMorphURIToVSIPath(osURI, osRootDir);
+                if (!bJSONIsLocal && VSIIsLocal(info.osURI.c_str()))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "%s: reference to local file '%s' is not "
+                             "allowed from a remote reference file",
+                             osJSONFilename.c_str(), info.osURI.c_str());
+                    return false;
+                }
+                if (oArray.Size() == 3)
+                {
+                    info.bHasRange = true;
+                    info.nOffset = static_cast<uint64_t>(oArray[1].ToLong());
+                    info.nSize = static_cast<uint64_t>(oArray[2].ToLong());
+                }
+                break;
+            }
+
+            default:
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "%s: invalid value for key '%s'",
+                         osJSONFilename.c_str(), osKey.c_str());
+                return false;
+            }
+        }
+        AddKey(osKey, std::move(info));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    VSIKerchunkJSONRefFileSystem                      */
+/************************************************************************/
+
+class VSIKerchunkJSONRefFileSystem final : public VSIFilesystemHandler
+{
+    std::mutex m_oMutex{};
+    lru11::Cache<std::string, std::shared_ptr<VSIKerchunkRefFile>> m_oCache{
+        16};
+
+    static std::pair<std::string, std::string>
+    SplitFilename(const char *pszFilename);
+
+    std::shared_ptr<VSIKerchunkRefFile>
+    GetRefFile(const std::string &osJSONFilename);
+
+  public:
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError, CSLConstList papszOptions) override;
+
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+
+    char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
+};
+
+/************************************************************************/
+/*                           SplitFilename()                            */
+/************************************************************************/
+
+/** Split "/vsikerchunk_json_ref/{json_filename}/key" into
+ * (json_filename, key) */
+std::pair<std::string, std::string>
+VSIKerchunkJSONRefFileSystem::SplitFilename(const char *pszFilename)
+{
+    if (!STARTS_WITH(pszFilename, JSON_REF_FS_PREFIX))
+        return {};
+    pszFilename += strlen(JSON_REF_FS_PREFIX);
+
+    std::string osJSONFilename;
+    std::string osKey;
+    if (pszFilename[0] == '{')
+    {
+        // Braces may be nested if the JSON filename itself contains some
+        int nLevel = 1;
+        const char *pszIter = pszFilename + 1;
+        for (; *pszIter; ++pszIter)
+        {
+            if (*pszIter == '{')
+                ++nLevel;
+            else if (*pszIter == '}' && --nLevel == 0)
+                break;
+        }
+        if (*pszIter != '}')
+            return {};
+        osJSONFilename.assign(pszFilename + 1, pszIter - (pszFilename + 1));
+        ++pszIter;
+        if (*pszIter == '/')
+            ++pszIter;
+        else if (*pszIter != '\0')
+            return {};
+        osKey = pszIter;
+    }
+    else
+    {
+        osJSONFilename = pszFilename;
+    }
+    while (!osKey.empty() && osKey.back() == '/')
+        osKey.pop_back();
+    return {osJSONFilename, osKey};
+}
+
+/************************************************************************/
+/*                            GetRefFile()                              */
+/************************************************************************/
+
+std::shared_ptr<VSIKerchunkRefFile>
+VSIKerchunkJSONRefFileSystem::GetRefFile(const std::string &osJSONFilename)
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        std::shared_ptr<VSIKerchunkRefFile> poRefFile;
+        if (m_oCache.tryGet(osJSONFilename, poRefFile))
+            return poRefFile;
+    }
+
+    auto poRefFile = std::make_shared<VSIKerchunkRefFile>();
+    if (!poRefFile->Load(osJSONFilename))
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_oCache.insert(osJSONFilename, poRefFile);
+    return poRefFile;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandle *
+VSIKerchunkJSONRefFileSystem::Open(const char *pszFilename,
+                                   const char *pszAccess, bool bSetError,
+                                   CSLConstList /* papszOptions */)
+{
+    if (strcmp(pszAccess, "r") != 0 && strcmp(pszAccess, "rb") != 0)
+    {
+        if (bSetError)
+        {
+            VSIError(VSIE_FileError,
+                     "Only read-only mode is supported for %s",
+                     JSON_REF_FS_PREFIX);
+        }
+        return nullptr;
+    }
+
+    const auto [osJSONFilename, osKey] = SplitFilename(pszFilename);
+    if (osJSONFilename.empty())
+        return nullptr;
+    const auto poRefFile = GetRefFile(osJSONFilename);
+    if (!poRefFile)
+        return nullptr;
+    const auto *psInfo = poRefFile->GetKey(osKey);
+    if (!psInfo)
+    {
+        if (bSetError)
+            VSIError(VSIE_FileError, "%s: no such key", osKey.c_str());
+        return nullptr;
+    }
+
+    if (psInfo->osURI.empty())
+    {
+        const std::string osTmpFilename =
+            VSIMemGenerateHiddenFilename("kerchunk_inline");
+        const size_t nSize = psInfo->osValue.size();
+        GByte *pabyData = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize + 1));
+        if (!pabyData)
+            return nullptr;
+        memcpy(pabyData, psInfo->osValue.data(), nSize);
+        VSIFCloseL(VSIFileFromMemBuffer(osTmpFilename.c_str(), pabyData, nSize,
+                                        /* bTakeOwnership = */ true));
+        VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "rb");
+        // The handle keeps the content alive
+        VSIUnlink(osTmpFilename.c_str());
+        return fp;
+    }
+
+    if (!psInfo->bHasRange)
+        return VSIFOpenExL(psInfo->osURI.c_str(), "rb", bSetError);
+
+    const std::string osSubFile =
+        CPLSPrintf("/vsisubfile/" CPL_FRMT_GUIB "_" CPL_FRMT_GUIB ",",
+                   static_cast<GUIntBig>(psInfo->nOffset),
+                   static_cast<GUIntBig>(psInfo->nSize)) +
+        psInfo->osURI;
+    return VSIFOpenExL(osSubFile.c_str(), "rb", bSetError);
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSIKerchunkJSONRefFileSystem::Stat(const char *pszFilename,
+                                       VSIStatBufL *pStatBuf, int nFlags)
+{
+    memset(pStatBuf, 0, sizeof(VSIStatBufL));
+
+    const auto [osJSONFilename, osKey] = SplitFilename(pszFilename);
+    if (osJSONFilename.empty())
+        return -1;
+    const auto poRefFile = GetRefFile(osJSONFilename);
+    if (!poRefFile)
+        return -1;
+
+    if (const auto *psInfo = poRefFile->GetKey(osKey))
+    {
+        pStatBuf->st_mode = S_IFREG;
+        if (psInfo->osURI.empty())
+        {
+            pStatBuf->st_size = psInfo->osValue.size();
+        }
+        else if (psInfo->bHasRange)
+        {
+            pStatBuf->st_size = psInfo->nSize;
+        }
+        else
+        {
+            return VSIStatExL(psInfo->osURI.c_str(), pStatBuf, nFlags);
+        }
+        return 0;
+    }
+
+    if (poRefFile->GetDirChildren(osKey))
+    {
+        pStatBuf->st_mode = S_IFDIR;
+        return 0;
+    }
+
+    return -1;
+}
+
+/************************************************************************/
+/*                             ReadDirEx()                              */
+/************************************************************************/
+
+char **VSIKerchunkJSONRefFileSystem::ReadDirEx(const char *pszDirname,
+                                               int nMaxFiles)
+{
+    const auto [osJSONFilename, osKey] = SplitFilename(pszDirname);
+    if (osJSONFilename.empty())
+        return nullptr;
+    const auto poRefFile = GetRefFile(osJSONFilename);
+    if (!poRefFile)
+        return nullptr;
+    const auto *poChildren = poRefFile->GetDirChildren(osKey);
+    if (!poChildren)
+        return nullptr;
+
+    CPLStringList aosList;
+    for (const auto &osChild : *poChildren)
+    {
+        if (nMaxFiles > 0 && aosList.size() >= nMaxFiles)
+            break;
+        aosList.AddString(osChild.c_str());
+    }
+    return aosList.StealList();
+}
+
+/************************************************************************/
+/*                      VSIKerchunkGetJSONRefPath()                     */
+/************************************************************************/
+
+/** Return the path under which the Kerchunk JSON reference file is exposed
+ * as a Zarr store. */
+std::string VSIKerchunkGetJSONRefPath(const std::string &osJSONFilename)
+{
+    return std::string(JSON_REF_FS_PREFIX)
+        .append("{")
+        .append(osJSONFilename)
+        .append("}");
+}
+
+/************************************************************************/
+/*                VSIInstallKerchunkJSONRefFileSystem()                 */
+/************************************************************************/
+
+void VSIInstallKerchunkJSONRefFileSystem()
+{
+    static std::once_flag oFlag;
+    std::call_once(oFlag,
+                   []()
+                   {
+                       VSIFileManager::InstallHandler(
+                           JSON_REF_FS_PREFIX,
+                           new VSIKerchunkJSONRefFileSystem());
+                   });
+}
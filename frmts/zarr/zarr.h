@@ -14,12 +14,16 @@
 #define ZARR_H
 
 #include "cpl_compressor.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
+#include "cpl_mem_cache.h"
 
 #include <array>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -794,6 +798,19 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    // Write-behind of dirty tiles: their encoding and writing is done by
+    // worker threads, while the caller goes on filling the next tiles.
+    mutable bool m_bTileWriteQueueInitDone = false;
+    mutable std::unique_ptr<CPLJobQueue> m_poTileWriteQueue{};
+    mutable size_t m_nMaxTileWritesInFlight = 0;
+    mutable std::unique_ptr<CPLErrorAccumulator>
+        m_poTileWriteErrorAccumulator{};
+    mutable std::condition_variable m_oTileWriteCV{};
+    // Below members are protected by m_oMutex
+    mutable std::set<std::vector<uint64_t>> m_oSetTilesBeingWritten{};
+    mutable std::vector<ZarrByteVectorQuickResize> m_aoFreeTileBuffers{};
+    mutable bool m_bTileWriteError = false;
+
     static uint64_t
     ComputeTileCount(const std::string &osName,
                      const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -825,6 +842,19 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     virtual bool FlushDirtyTile() const = 0;
 
+    // Must not modify any ZarrArray member when bFromWorkerThread is true
+    virtual bool EncodeAndWriteTile(const uint64_t *tileIndices,
+                                    ZarrByteVectorQuickResize &abyRawTileData,
+                                    bool bFromWorkerThread) const = 0;
+
+    CPLJobQueue *GetTileWriteQueue() const;
+
+    bool EncodeAndWriteDirtyTile() const;
+
+    void WaitTileWrite(const uint64_t *tileIndices) const;
+
+    bool WaitTileWrites() const;
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     void NotifyChildrenOfRenaming() override;
@@ -1133,6 +1163,10 @@ class ZarrV2Array final : public ZarrArray
 
     bool FlushDirtyTile() const override;
 
+    bool EncodeAndWriteTile(const uint64_t *tileIndices,
+                            ZarrByteVectorQuickResize &abyRawTileData,
+                            bool bFromWorkerThread) const override;
+
     std::string BuildTileFilename(const uint64_t *tileIndices) const override;
 
     bool AllocateWorkingBuffers() const override;
@@ -1455,6 +1489,37 @@ class ZarrV3CodecSequence
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
 };
 
+/************************************************************************/
+/*                          ZarrV3ShardingInfo                          */
+/************************************************************************/
+
+// Parameters of the "sharding_indexed" codec
+// https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html
+// Shards are the chunks of the chunk_grid, and are made of inner chunks
+// that are encoded independently, followed (or preceded) by an index of
+// (offset, size) pairs of uint64 values, one per inner chunk.
+struct ZarrV3ShardingInfo
+{
+    static constexpr const char *NAME = "sharding_indexed";
+
+    std::vector<GUInt64> anShardSize{};
+    bool bIndexAtStart = false;
+    bool bIndexBigEndian = false;
+    bool bIndexHasCRC32C = false;
+    // Full "codecs" array of the array, for serialization
+    CPLJSONArray oCodecs{};
+
+    static CPLJSONObject
+    GetConfiguration(const std::vector<GUInt64> &anInnerChunkSize,
+                     const CPLJSONArray &oInnerCodecs);
+
+    bool InitFromJson(const CPLJSONArray &oCodecs,
+                      const GDALExtendedDataType &oType,
+                      const std::vector<GUInt64> &anShardSizeIn,
+                      std::vector<GUInt64> &anInnerChunkSize,
+                      CPLJSONArray &oInnerCodecs);
+};
+
 /************************************************************************/
 /*                           ZarrV3Array                                */
 /************************************************************************/
@@ -1464,6 +1529,28 @@ class ZarrV3Array final : public ZarrArray
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
 
+    // Set when the array uses the sharding_indexed codec. The tiles of
+    // ZarrArray are then the inner chunks, and m_poCodecs the codecs
+    // applied to them.
+    ZarrV3ShardingInfo m_oSharding{};
+
+    // Index of shards, by shard filename. Empty for missing shards.
+    mutable lru11::Cache<std::string, std::shared_ptr<std::vector<uint64_t>>>
+        m_oShardIndexCache{256};
+
+    // Content of a shard being written
+    struct ShardWriteBuffer
+    {
+        // Encoded inner chunks. Empty for missing chunks.
+        std::vector<std::vector<GByte>> aabyChunks{};
+        std::vector<bool> abWritten{};
+        size_t nWrittenCount = 0;
+    };
+
+    // Shards being written, by shard indices
+    mutable std::map<std::vector<uint64_t>, ShardWriteBuffer>
+        m_oMapShardWriteBuffers{};
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1485,6 +1572,44 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    void DecodeSourceElts(const ZarrByteVectorQuickResize &abyRawTileData,
+                          ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    std::string BuildChunkFilename(const uint64_t *chunkIndices) const;
+
+    bool IsSharded() const
+    {
+        return !m_oSharding.anShardSize.empty();
+    }
+
+    size_t GetInnerChunkCountPerShard() const;
+
+    size_t GetValidInnerChunkCount(
+        const std::vector<uint64_t> &anShardIndices) const;
+
+    void GetShardLocation(const uint64_t *tileIndices,
+                          std::vector<uint64_t> &anShardIndices,
+                          size_t &nInnerChunkIdx) const;
+
+    bool GetShardIndex(const std::string &osFilename, bool bUseMutex,
+                       std::shared_ptr<std::vector<uint64_t>> &poIndex) const;
+
+    bool ReadInnerChunk(const uint64_t *tileIndices, bool bUseMutex,
+                        ZarrByteVectorQuickResize &abyRawTileData,
+                        bool &bMissingTileOut) const;
+
+    bool IAdviseReadSharded(const std::vector<uint64_t> &anReqTilesIndices,
+                            size_t nReqTiles, int nThreadsMax) const;
+
+    bool StoreInnerChunk(const uint64_t *tileIndices, const GByte *pabyData,
+                         size_t nSize) const;
+
+    bool LoadShardForUpdate(const std::vector<uint64_t> &anShardIndices,
+                            ShardWriteBuffer &oBuffer) const;
+
+    bool WriteShard(const std::vector<uint64_t> &anShardIndices,
+                    const ShardWriteBuffer &oBuffer) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1506,6 +1631,11 @@ class ZarrV3Array final : public ZarrArray
         m_poCodecs = std::move(poCodecs);
     }
 
+    void SetSharding(const ZarrV3ShardingInfo &oSharding)
+    {
+        m_oSharding = oSharding;
+    }
+
     void Flush() override;
 
   protected:
@@ -1518,6 +1648,10 @@ class ZarrV3Array final : public ZarrArray
 
     bool FlushDirtyTile() const override;
 
+    bool EncodeAndWriteTile(const uint64_t *tileIndices,
+                            ZarrByteVectorQuickResize &abyRawTileData,
+                            bool bFromWorkerThread) const override;
+
     std::string BuildTileFilename(const uint64_t *tileIndices) const override;
 
     bool LoadTileData(const uint64_t *tileIndices,
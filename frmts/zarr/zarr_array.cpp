@@ -14,6 +14,7 @@
 #include "ucs4_utf8.hpp"
 
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include "netcdf_cf_constants.h"  // for CF_UNITS, etc
 
@@ -374,6 +375,168 @@ void ZarrArray::DeallocateDecodedTileData()
     }
 }
 
+/************************************************************************/
+/*                    ZarrArray::GetTileWriteQueue()                    */
+/************************************************************************/
+
+/** Return the job queue used for write-behind of dirty tiles, or nullptr if
+ * tiles must be written synchronously.
+ *
+ * The number of worker threads is controlled by the GDAL_NUM_THREADS
+ * configuration option.
+ */
+CPLJobQueue *ZarrArray::GetTileWriteQueue() const
+{
+    if (m_bTileWriteQueueInitDone)
+        return m_poTileWriteQueue.get();
+    m_bTileWriteQueueInitDone = true;
+
+    const int nThreads = CPLParseNumThreads(
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 1024);
+    if (nThreads <= 1)
+        return nullptr;
+
+    CPLWorkerThreadPool *wtp = GDALGetGlobalThreadPool(nThreads);
+    if (!wtp)
+        return nullptr;
+    m_poTileWriteQueue = wtp->CreateJobQueue();
+    m_poTileWriteErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    // Bounds the memory used by tiles waiting to be encoded and written
+    m_nMaxTileWritesInFlight = 2 * static_cast<size_t>(nThreads);
+    CPLDebug(ZARR_DEBUG_KEY,
+             "Writing tiles of %s with up to %d threads and up to %u tiles "
+             "in flight",
+             GetName().c_str(), nThreads,
+             static_cast<unsigned>(m_nMaxTileWritesInFlight));
+    return m_poTileWriteQueue.get();
+}
+
+/************************************************************************/
+/*                 ZarrArray::EncodeAndWriteDirtyTile()                 */
+/************************************************************************/
+
+/** Encode and write the dirty tile m_anCachedTiledIndices, whose native
+ * content is in m_abyRawTileData.
+ *
+ * If write-behind is enabled, this is done by a worker thread: the tile
+ * buffer is handed over to it, and replaced by a free one. The cached tile
+ * is then invalidated.
+ */
+bool ZarrArray::EncodeAndWriteDirtyTile() const
+{
+    CPLJobQueue *poQueue = GetTileWriteQueue();
+    if (!poQueue)
+    {
+        return EncodeAndWriteTile(m_anCachedTiledIndices.data(),
+                                  m_abyRawTileData,
+                                  /* bFromWorkerThread = */ false);
+    }
+
+    ZarrByteVectorQuickResize abyNewRawTileData;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oTileWriteCV.wait(oLock,
+                            [this]()
+                            {
+                                return m_oSetTilesBeingWritten.size() <
+                                       m_nMaxTileWritesInFlight;
+                            });
+        if (m_bTileWriteError)
+        {
+            oLock.unlock();
+            WaitTileWrites();
+            return false;
+        }
+        m_oSetTilesBeingWritten.insert(m_anCachedTiledIndices);
+        if (!m_aoFreeTileBuffers.empty())
+        {
+            abyNewRawTileData = std::move(m_aoFreeTileBuffers.back());
+            m_aoFreeTileBuffers.pop_back();
+        }
+    }
+
+    const std::vector<uint64_t> anTileIndices(m_anCachedTiledIndices);
+    try
+    {
+        abyNewRawTileData.resize(m_nTileSize);
+    }
+    catch (const std::bad_alloc &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_oSetTilesBeingWritten.erase(anTileIndices);
+        return false;
+    }
+
+    // std::function<> requires a copyable object
+    auto poTileData = std::make_shared<ZarrByteVectorQuickResize>(
+        std::move(m_abyRawTileData));
+    m_abyRawTileData = std::move(abyNewRawTileData);
+    m_anCachedTiledIndices.clear();
+    m_bCachedTiledValid = false;
+
+    poQueue->SubmitJob(
+        [this, anTileIndices, poTileData]()
+        {
+            bool bOK;
+            {
+                auto oAccumulator =
+                    m_poTileWriteErrorAccumulator->InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                bOK = EncodeAndWriteTile(anTileIndices.data(), *poTileData,
+                                         /* bFromWorkerThread = */ true);
+            }
+
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            if (!bOK)
+                m_bTileWriteError = true;
+            m_oSetTilesBeingWritten.erase(anTileIndices);
+            m_aoFreeTileBuffers.push_back(std::move(*poTileData));
+            m_oTileWriteCV.notify_all();
+        });
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrArray::WaitTileWrite()                      */
+/************************************************************************/
+
+/** Wait for the completion of the write of a tile, if it is in progress. */
+void ZarrArray::WaitTileWrite(const uint64_t *tileIndices) const
+{
+    if (!m_poTileWriteQueue)
+        return;
+    const std::vector<uint64_t> anTileIndices(tileIndices,
+                                              tileIndices + m_aoDims.size());
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oTileWriteCV.wait(
+        oLock, [this, &anTileIndices]()
+        { return !cpl::contains(m_oSetTilesBeingWritten, anTileIndices); });
+}
+
+/************************************************************************/
+/*                     ZarrArray::WaitTileWrites()                      */
+/************************************************************************/
+
+/** Wait for the completion of all tile writes in progress, and emit the
+ * errors they raised.
+ *
+ * @return false if one of them failed.
+ */
+bool ZarrArray::WaitTileWrites() const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    m_poTileWriteQueue->WaitCompletion();
+    m_poTileWriteErrorAccumulator->ReplayErrors();
+    m_poTileWriteErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const bool bRet = !m_bTileWriteError;
+    m_bTileWriteError = false;
+    return bRet;
+}
+
 /************************************************************************/
 /*                             EncodeElt()                              */
 /************************************************************************/
@@ -862,6 +1025,10 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
     if (!CheckValidAndErrorOutIfNot())
         return false;
 
+    // Tiles being written must be on storage before being fetched
+    if (!WaitTileWrites())
+        return false;
+
     const size_t nDims = m_aoDims.size();
     anIndicesCur.resize(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -924,15 +1091,11 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
         return false;
     }
 
-    const char *pszNumThreads = CSLFetchNameValueDef(
-        papszOptions, "NUM_THREADS",
-        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"));
-    if (EQUAL(pszNumThreads, "ALL_CPUS"))
-        nThreadsMax = CPLGetNumCPUs();
-    else
-        nThreadsMax = std::max(1, atoi(pszNumThreads));
-    if (nThreadsMax > 1024)
-        nThreadsMax = 1024;
+    nThreadsMax = CPLParseNumThreads(
+        CSLFetchNameValueDef(
+            papszOptions, "NUM_THREADS",
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS")),
+        1024);
     if (nThreadsMax <= 1)
         return true;
     CPLDebug(ZARR_DEBUG_KEY, "IAdviseRead(): Using up to %d threads",
@@ -1164,6 +1327,7 @@ lbl_next_depth:
                     return false;
 
                 m_anCachedTiledIndices = tileIndices;
+                WaitTileWrite(tileIndices.data());
                 m_bCachedTiledValid =
                     LoadTileData(tileIndices.data(), bEmptyTile);
                 if (!m_bCachedTiledValid)
@@ -1679,6 +1843,7 @@ lbl_next_depth:
                 // If we don't write the whole tile, we need to fetch a
                 // potentially existing one.
                 bool bEmptyTile = false;
+                WaitTileWrite(tileIndices.data());
                 m_bCachedTiledValid =
                     LoadTileData(tileIndices.data(), bEmptyTile);
                 if (!m_bCachedTiledValid)
@@ -2146,6 +2311,9 @@ bool ZarrArray::CacheTilePresence()
     if (m_nTotalTileCount == 1)
         return true;
 
+    if (!WaitTileWrites())
+        return false;
+
     const std::string osDirectoryName = GetDataDirectory();
 
     struct DirCloser
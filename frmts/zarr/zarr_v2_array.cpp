@@ -70,6 +70,8 @@ ZarrV2Array::Create(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
 ZarrV2Array::~ZarrV2Array()
 {
     ZarrV2Array::Flush();
+    // In case Flush() did nothing because the array is no longer valid
+    WaitTileWrites();
 }
 
 /************************************************************************/
@@ -82,6 +84,7 @@ void ZarrV2Array::Flush()
         return;
 
     ZarrV2Array::FlushDirtyTile();
+    WaitTileWrites();
 
     if (m_bDefinitionModified)
     {
@@ -804,6 +807,9 @@ bool ZarrV2Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
+    // A previous version of the tile might still be being written
+    WaitTileWrite(m_anCachedTiledIndices.data());
+
     std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
 
     const size_t nSourceSize =
@@ -839,13 +845,58 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
     }
 
+    if (m_osDimSeparator == "/")
+    {
+        std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        {
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    return EncodeAndWriteDirtyTile();
+}
+
+/************************************************************************/
+/*                  ZarrV2Array::EncodeAndWriteTile()                   */
+/************************************************************************/
+
+bool ZarrV2Array::EncodeAndWriteTile(const uint64_t *tileIndices,
+                                     ZarrByteVectorQuickResize &abyRawTileData,
+                                     bool bFromWorkerThread) const
+{
+    const std::string osFilename = BuildTileFilename(tileIndices);
+
+    // Worker threads need their own temporary buffer
+    ZarrByteVectorQuickResize abyLocalTmpRawTileData;
+    auto &abyTmpRawTileData =
+        bFromWorkerThread ? abyLocalTmpRawTileData : m_abyTmpRawTileData;
+    if (bFromWorkerThread && (m_bFortranOrder || m_oFiltersArray.Size() != 0))
+    {
+        try
+        {
+            abyTmpRawTileData.resize(m_nTileSize);
+        }
+        catch (const std::bad_alloc &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+    }
+
     if (m_bFortranOrder && !m_aoDims.empty())
     {
-        BlockTranspose(m_abyRawTileData, m_abyTmpRawTileData, false);
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        BlockTranspose(abyRawTileData, abyTmpRawTileData, false);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
+    size_t nRawDataSize = abyRawTileData.size();
     for (const auto &oFilter : m_oFiltersArray)
     {
         const auto osFilterId = oFilter["id"].ToString();
@@ -867,10 +918,10 @@ bool ZarrV2Array::FlushDirtyTile() const
             aosOptions.SetNameValue(obj.GetName().c_str(),
                                     obj.ToString().c_str());
         }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
         if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
                 aosOptions.List(), psFilterCompressor->user_data))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -880,22 +931,7 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
 
         nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
-    }
-
-    if (m_osDimSeparator == "/")
-    {
-        std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
-        VSIStatBufL sStat;
-        if (VSIStatL(osDir.c_str(), &sStat) != 0)
-        {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot create directory %s", osDir.c_str());
-                return false;
-            }
-        }
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
     VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
@@ -909,7 +945,7 @@ bool ZarrV2Array::FlushDirtyTile() const
     bool bRet = true;
     if (m_psCompressor == nullptr)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+        if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
             nRawDataSize)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -955,7 +991,7 @@ bool ZarrV2Array::FlushDirtyTile() const
             }
 
             if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
+                    abyRawTileData.data(), nRawDataSize, &out_buffer,
                     &out_size, aosOptions.List(), m_psCompressor->user_data))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -10,11 +10,13 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_vsi_virtual.h"
 #include "gdal_thread_pool.h"
 #include "zarr.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
@@ -67,6 +69,8 @@ ZarrV3Array::Create(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
 ZarrV3Array::~ZarrV3Array()
 {
     ZarrV3Array::Flush();
+    // In case Flush() did nothing because the array is no longer valid
+    WaitTileWrites();
 }
 
 /************************************************************************/
@@ -79,6 +83,11 @@ void ZarrV3Array::Flush()
         return;
 
     ZarrV3Array::FlushDirtyTile();
+    WaitTileWrites();
+
+    for (const auto &[anShardIndices, oBuffer] : m_oMapShardWriteBuffers)
+        WriteShard(anShardIndices, oBuffer);
+    m_oMapShardWriteBuffers.clear();
 
     if (!m_aoDims.empty())
     {
@@ -144,7 +153,8 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         CPLJSONObject oConfiguration;
         oChunkGrid.Add("configuration", oConfiguration);
         CPLJSONArray oChunks;
-        for (const auto nBlockSize : m_anBlockSize)
+        for (const auto nBlockSize :
+             IsSharded() ? m_oSharding.anShardSize : m_anBlockSize)
         {
             oChunks.Add(static_cast<GInt64>(nBlockSize));
         }
@@ -204,7 +214,11 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         }
     }
 
-    if (m_poCodecs)
+    if (IsSharded())
+    {
+        oRoot.Add("codecs", m_oSharding.oCodecs);
+    }
+    else if (m_poCodecs)
     {
         oRoot.Add("codecs", m_poCodecs->GetJSon());
     }
@@ -381,6 +395,36 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
+    if (IsSharded())
+    {
+        if (!ReadInnerChunk(tileIndices, bUseMutex, abyRawTileData,
+                            bMissingTileOut))
+        {
+            return false;
+        }
+        if (bMissingTileOut)
+            return true;
+        if (poCodecs && !poCodecs->Decode(abyRawTileData))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decompression of inner chunk of shard %s failed",
+                     BuildTileFilename(tileIndices).c_str());
+            return false;
+        }
+        if (abyRawTileData.size() != m_nTileSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decompressed inner chunk of shard %s has not expected "
+                     "size. Got %u instead of %u",
+                     BuildTileFilename(tileIndices).c_str(),
+                     static_cast<unsigned>(abyRawTileData.size()),
+                     static_cast<unsigned>(m_nTileSize));
+            return false;
+        }
+        DecodeSourceElts(abyRawTileData, abyDecodedTileData);
+        return true;
+    }
+
     std::string osFilename = BuildTileFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
@@ -521,6 +565,23 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
         return false;
     }
 
+    DecodeSourceElts(abyRawTileData, abyDecodedTileData);
+
+    return true;
+
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::DecodeSourceElts()                    */
+/************************************************************************/
+
+void ZarrV3Array::DecodeSourceElts(
+    const ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
     if (!abyDecodedTileData.empty())
     {
         const size_t nSourceSize =
@@ -536,12 +597,6 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
             DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
         }
     }
-
-    return true;
-
-#undef m_abyRawTileData
-#undef m_abyDecodedTileData
-#undef m_poCodecs
 }
 
 /************************************************************************/
@@ -565,6 +620,9 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
         return true;
     }
 
+    if (IsSharded())
+        return IAdviseReadSharded(anReqTilesIndices, nReqTiles, nThreadsMax);
+
     const int nThreads =
         static_cast<int>(std::min(static_cast<size_t>(nThreadsMax), nReqTiles));
 
@@ -723,6 +781,9 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
+    // A previous version of the tile might still be being written
+    WaitTileWrite(m_anCachedTiledIndices.data());
+
     std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
 
     const size_t nSourceSize =
@@ -734,6 +795,11 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if (IsSharded())
+        {
+            return StoreInnerChunk(m_anCachedTiledIndices.data(), nullptr, 0);
+        }
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -758,14 +824,21 @@ bool ZarrV3Array::FlushDirtyTile() const
         }
     }
 
-    const size_t nSizeBefore = m_abyRawTileData.size();
-    if (m_poCodecs)
+    if (IsSharded())
     {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
+        // Inner chunks are already buffered per shard, so they are encoded
+        // synchronously.
+        const size_t nSizeBefore = m_abyRawTileData.size();
+        if (m_poCodecs && !m_poCodecs->Encode(m_abyRawTileData))
         {
             m_abyRawTileData.resize(nSizeBefore);
             return false;
         }
+        const bool bRet =
+            StoreInnerChunk(m_anCachedTiledIndices.data(),
+                            m_abyRawTileData.data(), m_abyRawTileData.size());
+        m_abyRawTileData.resize(nSizeBefore);
+        return bRet;
     }
 
     if (m_osDimSeparator == "/")
@@ -778,25 +851,58 @@ bool ZarrV3Array::FlushDirtyTile() const
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
     }
 
+    return EncodeAndWriteDirtyTile();
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::EncodeAndWriteTile()                   */
+/************************************************************************/
+
+bool ZarrV3Array::EncodeAndWriteTile(const uint64_t *tileIndices,
+                                     ZarrByteVectorQuickResize &abyRawTileData,
+                                     bool bFromWorkerThread) const
+{
+    const std::string osFilename = BuildTileFilename(tileIndices);
+
+    // Codecs may have state, so worker threads need their own instance
+    std::unique_ptr<ZarrV3CodecSequence> poCodecsClone;
+    ZarrV3CodecSequence *poCodecs = m_poCodecs.get();
+    if (bFromWorkerThread && m_poCodecs)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            poCodecsClone = m_poCodecs->Clone();
+        }
+        poCodecs = poCodecsClone.get();
+    }
+
+    const size_t nSizeBefore = abyRawTileData.size();
+    if (poCodecs)
+    {
+        if (!poCodecs->Encode(abyRawTileData))
+        {
+            abyRawTileData.resize(nSizeBefore);
+            return false;
+        }
+    }
+
     VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
     if (fp == nullptr)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
+        abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
-        nRawDataSize)
+    const size_t nRawDataSize = abyRawTileData.size();
+    if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) != nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Could not write tile %s correctly", osFilename.c_str());
@@ -804,7 +910,7 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
+    abyRawTileData.resize(nSizeBefore);
 
     return bRet;
 }
@@ -814,6 +920,25 @@ bool ZarrV3Array::FlushDirtyTile() const
 /************************************************************************/
 
 std::string ZarrV3Array::BuildTileFilename(const uint64_t *tileIndices) const
+{
+    if (IsSharded())
+    {
+        // Return the filename of the shard containing the inner chunk
+        std::vector<uint64_t> anShardIndices;
+        size_t nInnerChunkIdx = 0;
+        GetShardLocation(tileIndices, anShardIndices, nInnerChunkIdx);
+        return BuildChunkFilename(anShardIndices.data());
+    }
+    return BuildChunkFilename(tileIndices);
+}
+
+/************************************************************************/
+/*                          BuildChunkFilename()                        */
+/************************************************************************/
+
+/** Return the filename of a chunk of the chunk_grid, that is a shard for
+ * sharded arrays. */
+std::string ZarrV3Array::BuildChunkFilename(const uint64_t *chunkIndices) const
 {
     if (m_aoDims.empty())
     {
@@ -833,7 +958,7 @@ std::string ZarrV3Array::BuildTileFilename(const uint64_t *tileIndices) const
         {
             if (i > 0 || !m_bV2ChunkKeyEncoding)
                 osFilename += m_osDimSeparator;
-            osFilename += std::to_string(tileIndices[i]);
+            osFilename += std::to_string(chunkIndices[i]);
         }
         return osFilename;
     }
@@ -874,6 +999,699 @@ ZarrV3Array::GetTileIndicesFromFilename(const char *pszFilename) const
                            m_osDimSeparator.c_str(), 0));
 }
 
+/************************************************************************/
+/*               ZarrV3Array::GetInnerChunkCountPerShard()              */
+/************************************************************************/
+
+size_t ZarrV3Array::GetInnerChunkCountPerShard() const
+{
+    size_t nCount = 1;
+    for (size_t i = 0; i < m_anBlockSize.size(); ++i)
+    {
+        nCount *=
+            static_cast<size_t>(m_oSharding.anShardSize[i] / m_anBlockSize[i]);
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*                ZarrV3Array::GetValidInnerChunkCount()                */
+/************************************************************************/
+
+/** Return the number of inner chunks of a shard that intersect the array.
+ * Shards at the right/bottom edges of the array may be partially used.
+ */
+size_t ZarrV3Array::GetValidInnerChunkCount(
+    const std::vector<uint64_t> &anShardIndices) const
+{
+    size_t nCount = 1;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        const uint64_t nChunksPerShard =
+            m_oSharding.anShardSize[i] / m_anBlockSize[i];
+        const uint64_t nChunksInDim =
+            DIV_ROUND_UP(m_aoDims[i]->GetSize(), m_anBlockSize[i]);
+        nCount *= static_cast<size_t>(
+            std::min(nChunksPerShard,
+                     nChunksInDim - anShardIndices[i] * nChunksPerShard));
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::GetShardLocation()                    */
+/************************************************************************/
+
+/** Return the indices of the shard containing an inner chunk, and the
+ * index of the inner chunk in the shard index (C order).
+ */
+void ZarrV3Array::GetShardLocation(const uint64_t *tileIndices,
+                                   std::vector<uint64_t> &anShardIndices,
+                                   size_t &nInnerChunkIdx) const
+{
+    const size_t nDims = m_anBlockSize.size();
+    anShardIndices.resize(nDims);
+    nInnerChunkIdx = 0;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const uint64_t nChunksPerShard =
+            m_oSharding.anShardSize[i] / m_anBlockSize[i];
+        anShardIndices[i] = tileIndices[i] / nChunksPerShard;
+        nInnerChunkIdx = nInnerChunkIdx * static_cast<size_t>(nChunksPerShard) +
+                         static_cast<size_t>(tileIndices[i] % nChunksPerShard);
+    }
+}
+
+/************************************************************************/
+/*                     ZarrV3Array::GetShardIndex()                     */
+/************************************************************************/
+
+/** Return the index of a shard, as (offset, size) pairs of each inner chunk.
+ * The index is empty if the shard does not exist.
+ * Indices are cached, so that each shard index is only fetched once.
+ */
+bool ZarrV3Array::GetShardIndex(
+    const std::string &osFilename, bool bUseMutex,
+    std::shared_ptr<std::vector<uint64_t>> &poIndex) const
+{
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        if (m_oShardIndexCache.tryGet(osFilename, poIndex))
+            return true;
+    }
+
+    poIndex = std::make_shared<std::vector<uint64_t>>();
+    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
+                                           nullptr};
+    VSILFILE *fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+    if (fp)
+    {
+        const size_t nChunks = GetInnerChunkCountPerShard();
+        const vsi_l_offset nIndexSize =
+            static_cast<vsi_l_offset>(nChunks) * 2 * sizeof(uint64_t) +
+            (m_oSharding.bIndexHasCRC32C ? 4 : 0);
+        VSIFSeekL(fp, 0, SEEK_END);
+        const vsi_l_offset nFileSize = VSIFTellL(fp);
+        bool bOK = nFileSize >= nIndexSize;
+        if (bOK)
+        {
+            try
+            {
+                poIndex->resize(2 * nChunks);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for index of shard %s",
+                         osFilename.c_str());
+                VSIFCloseL(fp);
+                return false;
+            }
+            bOK = VSIFSeekL(fp,
+                            m_oSharding.bIndexAtStart ? 0
+                                                      : nFileSize - nIndexSize,
+                            SEEK_SET) == 0 &&
+                  VSIFReadL(poIndex->data(), sizeof(uint64_t), 2 * nChunks,
+                            fp) == 2 * nChunks;
+        }
+        VSIFCloseL(fp);
+
+        for (size_t i = 0; bOK && i < 2 * nChunks; i += 2)
+        {
+            uint64_t &nOffset = (*poIndex)[i];
+            uint64_t &nSize = (*poIndex)[i + 1];
+            if (m_oSharding.bIndexBigEndian)
+            {
+                CPL_MSBPTR64(&nOffset);
+                CPL_MSBPTR64(&nSize);
+            }
+            else
+            {
+                CPL_LSBPTR64(&nOffset);
+                CPL_LSBPTR64(&nSize);
+            }
+            constexpr uint64_t MISSING = std::numeric_limits<uint64_t>::max();
+            if (!(nOffset == MISSING && nSize == MISSING) &&
+                (nOffset > nFileSize || nSize > nFileSize - nOffset))
+            {
+                bOK = false;
+            }
+        }
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Invalid index in shard %s",
+                     osFilename.c_str());
+            return false;
+        }
+    }
+
+    std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+    if (bUseMutex)
+        oLock.lock();
+    m_oShardIndexCache.insert(osFilename, poIndex);
+    return true;
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::ReadInnerChunk()                     */
+/************************************************************************/
+
+/** Read the encoded content of an inner chunk of a sharded array, with a
+ * ranged read in the shard. */
+bool ZarrV3Array::ReadInnerChunk(const uint64_t *tileIndices, bool bUseMutex,
+                                 ZarrByteVectorQuickResize &abyRawTileData,
+                                 bool &bMissingTileOut) const
+{
+    std::vector<uint64_t> anShardIndices;
+    size_t nInnerChunkIdx = 0;
+    GetShardLocation(tileIndices, anShardIndices, nInnerChunkIdx);
+
+    {
+        // Inner chunk of a shard being written ?
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        const auto oIter = m_oMapShardWriteBuffers.find(anShardIndices);
+        if (oIter != m_oMapShardWriteBuffers.end())
+        {
+            const auto &abyChunk = oIter->second.aabyChunks[nInnerChunkIdx];
+            bMissingTileOut = abyChunk.empty();
+            if (!bMissingTileOut)
+            {
+                abyRawTileData.resize(abyChunk.size());
+                memcpy(&abyRawTileData[0], abyChunk.data(), abyChunk.size());
+            }
+            return true;
+        }
+    }
+
+    const std::string osFilename = BuildChunkFilename(anShardIndices.data());
+    std::shared_ptr<std::vector<uint64_t>> poIndex;
+    if (!GetShardIndex(osFilename, bUseMutex, poIndex))
+        return false;
+    if (poIndex->empty() ||
+        (*poIndex)[2 * nInnerChunkIdx] == std::numeric_limits<uint64_t>::max())
+    {
+        CPLDebugOnly(ZARR_DEBUG_KEY, "Inner chunk %u of shard %s missing",
+                     static_cast<unsigned>(nInnerChunkIdx),
+                     osFilename.c_str());
+        bMissingTileOut = true;
+        return true;
+    }
+
+    const uint64_t nOffset = (*poIndex)[2 * nInnerChunkIdx];
+    const uint64_t nSize = (*poIndex)[2 * nInnerChunkIdx + 1];
+    if (nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large chunk in shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+    try
+    {
+        abyRawTileData.resize(static_cast<size_t>(nSize));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for chunk of shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
+                                           nullptr};
+    VSILFILE *fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+    bool bRet = fp != nullptr && VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+                (nSize == 0 || VSIFReadL(&abyRawTileData[0], 1,
+                                         abyRawTileData.size(),
+                                         fp) == abyRawTileData.size());
+    if (fp)
+        VSIFCloseL(fp);
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not read chunk of shard %s correctly",
+                 osFilename.c_str());
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::IAdviseReadSharded()                   */
+/************************************************************************/
+
+/** Fill the tile cache with the requested inner chunks. Requests are grouped
+ * by shard: the index of each shard is fetched once, and its inner chunks are
+ * read with a single multi-range read, before being decoded. Shards are
+ * processed concurrently.
+ */
+bool ZarrV3Array::IAdviseReadSharded(
+    const std::vector<uint64_t> &anReqTilesIndices, size_t nReqTiles,
+    int nThreadsMax) const
+{
+    const size_t nDims = m_aoDims.size();
+
+    std::map<std::vector<uint64_t>, std::vector<size_t>> oMapShardToRequests;
+    {
+        std::vector<uint64_t> anShardIndices;
+        size_t nInnerChunkIdx = 0;
+        for (size_t iReq = 0; iReq < nReqTiles; ++iReq)
+        {
+            GetShardLocation(anReqTilesIndices.data() + iReq * nDims,
+                             anShardIndices, nInnerChunkIdx);
+            oMapShardToRequests[anShardIndices].push_back(iReq);
+        }
+    }
+
+    CPLWorkerThreadPool *wtp = GDALGetGlobalThreadPool(nThreadsMax);
+    auto poJobQueue = wtp ? wtp->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        return false;
+
+    std::atomic<bool> bGlobalStatus{true};
+    CPLErrorAccumulator oErrorAccumulator;
+
+    const auto ProcessShard =
+        [this, nDims, &anReqTilesIndices,
+         &bGlobalStatus](const std::vector<uint64_t> &anShardIndices,
+                         const std::vector<size_t> &anRequests)
+    {
+        std::unique_ptr<ZarrV3CodecSequence> poCodecs;
+        if (m_poCodecs)
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            poCodecs = m_poCodecs->Clone();
+        }
+
+        const auto StoreInCache =
+            [this, nDims](const uint64_t *tileIndices, CachedTile &&cachedTile)
+        {
+            uint64_t nTileIdx = 0;
+            for (size_t j = 0; j < nDims; ++j)
+            {
+                if (j > 0)
+                    nTileIdx *= m_aoDims[j - 1]->GetSize();
+                nTileIdx += tileIndices[j];
+            }
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_oMapTileIndexToCachedTile[nTileIdx] = std::move(cachedTile);
+        };
+
+        bool bInWriteBuffers;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            bInWriteBuffers = cpl::contains(m_oMapShardWriteBuffers,
+                                            anShardIndices);
+        }
+
+        const std::string osFilename =
+            BuildChunkFilename(anShardIndices.data());
+        std::shared_ptr<std::vector<uint64_t>> poIndex;
+        if (!bInWriteBuffers && !GetShardIndex(osFilename, true, poIndex))
+        {
+            bGlobalStatus = false;
+            return;
+        }
+
+        // Requests whose inner chunk is present in the shard, with their
+        // encoded content
+        std::vector<const uint64_t *> apanTileIndices;
+        std::vector<ZarrByteVectorQuickResize> aabyRawTileData;
+        std::vector<vsi_l_offset> anOffsets;
+        std::vector<size_t> anSizes;
+        for (const size_t iReq : anRequests)
+        {
+            const uint64_t *tileIndices =
+                anReqTilesIndices.data() + iReq * nDims;
+            if (bInWriteBuffers)
+            {
+                // Rare case: go through the generic code path
+                ZarrByteVectorQuickResize abyRawTileData;
+                bool bMissing = false;
+                if (!ReadInnerChunk(tileIndices, true, abyRawTileData,
+                                    bMissing))
+                {
+                    bGlobalStatus = false;
+                    return;
+                }
+                if (bMissing)
+                {
+                    StoreInCache(tileIndices, CachedTile());
+                }
+                else
+                {
+                    apanTileIndices.push_back(tileIndices);
+                    aabyRawTileData.push_back(std::move(abyRawTileData));
+                }
+                continue;
+            }
+
+            std::vector<uint64_t> anShardIndicesUnused;
+            size_t nInnerChunkIdx = 0;
+            GetShardLocation(tileIndices, anShardIndicesUnused,
+                             nInnerChunkIdx);
+            if (poIndex->empty() ||
+                (*poIndex)[2 * nInnerChunkIdx] ==
+                    std::numeric_limits<uint64_t>::max())
+            {
+                StoreInCache(tileIndices, CachedTile());
+                continue;
+            }
+            const uint64_t nSize = (*poIndex)[2 * nInnerChunkIdx + 1];
+            if (nSize == 0 ||
+                nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid chunk size in shard %s", osFilename.c_str());
+                bGlobalStatus = false;
+                return;
+            }
+            apanTileIndices.push_back(tileIndices);
+            anOffsets.push_back((*poIndex)[2 * nInnerChunkIdx]);
+            anSizes.push_back(static_cast<size_t>(nSize));
+            aabyRawTileData.emplace_back();
+            try
+            {
+                aabyRawTileData.back().resize(anSizes.back());
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for chunk of shard %s",
+                         osFilename.c_str());
+                bGlobalStatus = false;
+                return;
+            }
+        }
+
+        if (!anOffsets.empty())
+        {
+            std::vector<void *> apData;
+            for (auto &abyRawTileData : aabyRawTileData)
+                apData.push_back(&abyRawTileData[0]);
+            const char *const apszOpenOptions[] = {
+                "IGNORE_FILENAME_RESTRICTIONS=YES", nullptr};
+            VSILFILE *fp =
+                VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+            const bool bOK =
+                fp != nullptr &&
+                VSIFReadMultiRangeL(static_cast<int>(apData.size()),
+                                    apData.data(), anOffsets.data(),
+                                    anSizes.data(), fp) == 0;
+            if (fp)
+                VSIFCloseL(fp);
+            if (!bOK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Could not read chunks of shard %s correctly",
+                         osFilename.c_str());
+                bGlobalStatus = false;
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < apanTileIndices.size(); ++i)
+        {
+            if (!bGlobalStatus)
+                return;
+            auto &abyRawTileData = aabyRawTileData[i];
+            if (poCodecs && !poCodecs->Decode(abyRawTileData))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompression of inner chunk of shard %s failed",
+                         osFilename.c_str());
+                bGlobalStatus = false;
+                return;
+            }
+            if (abyRawTileData.size() != m_nTileSize)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompressed inner chunk of shard %s has not "
+                         "expected size",
+                         osFilename.c_str());
+                bGlobalStatus = false;
+                return;
+            }
+            CachedTile cachedTile;
+            if (NeedDecodedBuffer())
+            {
+                ZarrByteVectorQuickResize abyRawUnused;
+                if (!AllocateWorkingBuffers(abyRawUnused,
+                                            cachedTile.abyDecoded))
+                {
+                    bGlobalStatus = false;
+                    return;
+                }
+                DecodeSourceElts(abyRawTileData, cachedTile.abyDecoded);
+            }
+            else
+            {
+                std::swap(cachedTile.abyDecoded, abyRawTileData);
+            }
+            StoreInCache(apanTileIndices[i], std::move(cachedTile));
+        }
+    };
+
+    for (const auto &[anShardIndices, anRequests] : oMapShardToRequests)
+    {
+        const auto *panShardIndices = &anShardIndices;
+        const auto *panRequests = &anRequests;
+        poJobQueue->SubmitJob(
+            [&ProcessShard, &oErrorAccumulator, &bGlobalStatus,
+             panShardIndices, panRequests]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                if (bGlobalStatus)
+                    ProcessShard(*panShardIndices, *panRequests);
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return bGlobalStatus;
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::StoreInnerChunk()                    */
+/************************************************************************/
+
+/** Store the encoded content of an inner chunk (nullptr for an empty chunk)
+ * in the in-memory buffer of its shard. The shard is written in one go once
+ * all its inner chunks have been written, or at Flush() time.
+ */
+bool ZarrV3Array::StoreInnerChunk(const uint64_t *tileIndices,
+                                  const GByte *pabyData, size_t nSize) const
+{
+    if (m_oSharding.bIndexHasCRC32C)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Updating shards whose index has a crc32c checksum is not "
+                 "supported");
+        return false;
+    }
+
+    std::vector<uint64_t> anShardIndices;
+    size_t nInnerChunkIdx = 0;
+    GetShardLocation(tileIndices, anShardIndices, nInnerChunkIdx);
+
+    auto oIter = m_oMapShardWriteBuffers.find(anShardIndices);
+    if (oIter == m_oMapShardWriteBuffers.end())
+    {
+        ShardWriteBuffer oBuffer;
+        if (!LoadShardForUpdate(anShardIndices, oBuffer))
+            return false;
+        oIter =
+            m_oMapShardWriteBuffers.emplace(anShardIndices, std::move(oBuffer))
+                .first;
+    }
+
+    auto &oBuffer = oIter->second;
+    auto &abyChunk = oBuffer.aabyChunks[nInnerChunkIdx];
+    if (pabyData)
+        abyChunk.assign(pabyData, pabyData + nSize);
+    else
+        abyChunk.clear();
+    if (!oBuffer.abWritten[nInnerChunkIdx])
+    {
+        oBuffer.abWritten[nInnerChunkIdx] = true;
+        ++oBuffer.nWrittenCount;
+    }
+
+    if (oBuffer.nWrittenCount == GetValidInnerChunkCount(anShardIndices))
+    {
+        const bool bRet = WriteShard(anShardIndices, oBuffer);
+        m_oMapShardWriteBuffers.erase(oIter);
+        return bRet;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::LoadShardForUpdate()                   */
+/************************************************************************/
+
+/** Initialize the in-memory buffer of a shard with its existing inner
+ * chunks, if it already exists. */
+bool ZarrV3Array::LoadShardForUpdate(
+    const std::vector<uint64_t> &anShardIndices,
+    ShardWriteBuffer &oBuffer) const
+{
+    const size_t nChunks = GetInnerChunkCountPerShard();
+    oBuffer.aabyChunks.resize(nChunks);
+    oBuffer.abWritten.resize(nChunks);
+
+    const std::string osFilename = BuildChunkFilename(anShardIndices.data());
+    std::shared_ptr<std::vector<uint64_t>> poIndex;
+    if (!GetShardIndex(osFilename, false, poIndex))
+        return false;
+    if (poIndex->empty())
+        return true;
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return false;
+    bool bOK = true;
+    for (size_t i = 0; bOK && i < nChunks; ++i)
+    {
+        const uint64_t nOffset = (*poIndex)[2 * i];
+        const uint64_t nSize = (*poIndex)[2 * i + 1];
+        if (nOffset == std::numeric_limits<uint64_t>::max())
+            continue;
+        try
+        {
+            oBuffer.aabyChunks[i].resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for chunk of shard %s",
+                     osFilename.c_str());
+            bOK = false;
+            break;
+        }
+        bOK = nSize == 0 ||
+              (VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+               VSIFReadL(oBuffer.aabyChunks[i].data(), 1,
+                         static_cast<size_t>(nSize), fp) == nSize);
+    }
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not read chunks of shard %s correctly",
+                 osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                       ZarrV3Array::WriteShard()                      */
+/************************************************************************/
+
+/** Write a shard from its in-memory buffer, with a single write of its
+ * whole content. */
+bool ZarrV3Array::WriteShard(const std::vector<uint64_t> &anShardIndices,
+                             const ShardWriteBuffer &oBuffer) const
+{
+    const std::string osFilename = BuildChunkFilename(anShardIndices.data());
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_oShardIndexCache.remove(osFilename);
+    }
+
+    const size_t nChunks = oBuffer.aabyChunks.size();
+    size_t nDataSize = 0;
+    for (const auto &abyChunk : oBuffer.aabyChunks)
+        nDataSize += abyChunk.size();
+
+    if (nDataSize == 0)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            CPLDebugOnly(ZARR_DEBUG_KEY,
+                         "Deleting shard %s that has now empty content",
+                         osFilename.c_str());
+            return VSIUnlink(osFilename.c_str()) == 0;
+        }
+        return true;
+    }
+
+    if (m_osDimSeparator == "/")
+    {
+        std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        {
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    const size_t nIndexSize = nChunks * 2 * sizeof(uint64_t);
+    std::vector<GByte> abyShard;
+    try
+    {
+        abyShard.resize(nIndexSize + nDataSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for shard %s", osFilename.c_str());
+        return false;
+    }
+
+    const size_t nIndexOffset = m_oSharding.bIndexAtStart ? 0 : nDataSize;
+    size_t nOffset = m_oSharding.bIndexAtStart ? nIndexSize : 0;
+    for (size_t i = 0; i < nChunks; ++i)
+    {
+        const auto &abyChunk = oBuffer.aabyChunks[i];
+        uint64_t anEntry[2] = {std::numeric_limits<uint64_t>::max(),
+                               std::numeric_limits<uint64_t>::max()};
+        if (!abyChunk.empty())
+        {
+            anEntry[0] = nOffset;
+            anEntry[1] = abyChunk.size();
+            memcpy(&abyShard[nOffset], abyChunk.data(), abyChunk.size());
+            nOffset += abyChunk.size();
+        }
+        for (auto &nVal : anEntry)
+        {
+            if (m_oSharding.bIndexBigEndian)
+                CPL_MSBPTR64(&nVal);
+            else
+                CPL_LSBPTR64(&nVal);
+        }
+        memcpy(&abyShard[nIndexOffset + i * sizeof(anEntry)], anEntry,
+               sizeof(anEntry));
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+    bool bRet =
+        VSIFWriteL(abyShard.data(), 1, abyShard.size(), fp) == abyShard.size();
+    bRet = VSIFCloseL(fp) == 0 && bRet;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write shard %s correctly", osFilename.c_str());
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                           ParseDtypeV3()                             */
 /************************************************************************/
@@ -1552,7 +2370,22 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
         return nullptr;
     }
 
-    const auto oCodecs = oRoot["codecs"].ToArray();
+    auto oCodecs = oRoot["codecs"].ToArray();
+    ZarrV3ShardingInfo oSharding;
+    if (oCodecs.Size() > 0 &&
+        oCodecs[0].GetString("name") == ZarrV3ShardingInfo::NAME)
+    {
+        // The chunk grid defines the shards. Tiles of the array are the
+        // inner chunks.
+        const std::vector<GUInt64> anShardSize(anBlockSize);
+        CPLJSONArray oInnerCodecs;
+        if (!oSharding.InitFromJson(oCodecs, oType, anShardSize, anBlockSize,
+                                    oInnerCodecs))
+        {
+            return nullptr;
+        }
+        oCodecs = std::move(oInnerCodecs);
+    }
     std::unique_ptr<ZarrV3CodecSequence> poCodecs;
     if (oCodecs.Size() > 0)
     {
@@ -1593,6 +2426,18 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     }
     if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
+    if (!oSharding.anShardSize.empty())
+    {
+        std::string osShardSize;
+        for (const auto nSize : oSharding.anShardSize)
+        {
+            if (!osShardSize.empty())
+                osShardSize += ',';
+            osShardSize += std::to_string(nSize);
+        }
+        poArray->SetStructuralInfo("SHARD_SIZE", osShardSize.c_str());
+        poArray->SetSharding(oSharding);
+    }
     RegisterArray(poArray);
 
     // If this is an indexing variable, attach it to the dimension.
@@ -1605,7 +2450,10 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
         }
     }
 
-    if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
+    // Tile presence caching relies on one file per tile, which does not
+    // apply to sharded arrays.
+    if (oSharding.anShardSize.empty() &&
+        CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
             "CACHE_TILE_PRESENCE", "NO")))
     {
         poArray->CacheTilePresence();
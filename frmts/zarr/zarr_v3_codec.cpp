@@ -1155,3 +1155,129 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     }
     return true;
 }
+
+/************************************************************************/
+/*                ZarrV3ShardingInfo::GetConfiguration()                */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3ShardingInfo::GetConfiguration(
+    const std::vector<GUInt64> &anInnerChunkSize,
+    const CPLJSONArray &oInnerCodecs)
+{
+    CPLJSONObject oConfig;
+    CPLJSONArray oChunkShape;
+    for (const auto nSize : anInnerChunkSize)
+        oChunkShape.Add(static_cast<GInt64>(nSize));
+    oConfig.Add("chunk_shape", oChunkShape);
+    oConfig.Add("codecs", oInnerCodecs);
+    CPLJSONArray oIndexCodecs;
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecBytes::NAME);
+        oCodec.Add("configuration", ZarrV3CodecBytes::GetConfiguration(true));
+        oIndexCodecs.Add(oCodec);
+    }
+    oConfig.Add("index_codecs", oIndexCodecs);
+    oConfig.Add("index_location", "end");
+    return oConfig;
+}
+
+/************************************************************************/
+/*                  ZarrV3ShardingInfo::InitFromJson()                  */
+/************************************************************************/
+
+bool ZarrV3ShardingInfo::InitFromJson(const CPLJSONArray &oCodecsIn,
+                                      const GDALExtendedDataType &oType,
+                                      const std::vector<GUInt64> &anShardSizeIn,
+                                      std::vector<GUInt64> &anInnerChunkSize,
+                                      CPLJSONArray &oInnerCodecs)
+{
+    if (oCodecsIn.Size() != 1)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Codecs after %s are not supported", NAME);
+        return false;
+    }
+    const auto oConfig = oCodecsIn[0]["configuration"];
+
+    const auto oChunkShape = oConfig["chunk_shape"].ToArray();
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) != anShardSizeIn.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s: chunk_shape missing or of wrong dimension", NAME);
+        return false;
+    }
+    anInnerChunkSize.clear();
+    if (!ZarrArray::ParseChunkSize(oChunkShape, oType, anInnerChunkSize))
+        return false;
+    for (size_t i = 0; i < anShardSizeIn.size(); ++i)
+    {
+        if ((anShardSizeIn[i] % anInnerChunkSize[i]) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "%s: chunk_shape must divide the shape of the chunk grid",
+                     NAME);
+            return false;
+        }
+    }
+
+    oInnerCodecs = oConfig["codecs"].ToArray();
+    if (!oInnerCodecs.IsValid())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s: codecs missing", NAME);
+        return false;
+    }
+    for (const auto &oCodec : oInnerCodecs)
+    {
+        if (oCodec.GetString("name") == NAME)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Nested %s codecs are not supported", NAME);
+            return false;
+        }
+    }
+
+    const auto oIndexCodecs = oConfig["index_codecs"].ToArray();
+    if (!oIndexCodecs.IsValid() || oIndexCodecs.Size() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s: index_codecs missing",
+                 NAME);
+        return false;
+    }
+    bIndexBigEndian = false;
+    bIndexHasCRC32C = false;
+    for (int i = 0; i < oIndexCodecs.Size(); ++i)
+    {
+        const auto osName = oIndexCodecs[i].GetString("name");
+        if (i == 0 && osName == ZarrV3CodecBytes::NAME)
+        {
+            bIndexBigEndian =
+                oIndexCodecs[i]["configuration"].GetString("endian",
+                                                           "little") == "big";
+        }
+        else if (i == 1 && osName == "crc32c")
+        {
+            bIndexHasCRC32C = true;
+        }
+        else
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "%s: unsupported index_codecs", NAME);
+            return false;
+        }
+    }
+
+    const auto osIndexLocation = oConfig.GetString("index_location", "end");
+    if (osIndexLocation != "end" && osIndexLocation != "start")
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s: invalid index_location",
+                 NAME);
+        return false;
+    }
+    bIndexAtStart = osIndexLocation == "start";
+
+    anShardSize = anShardSizeIn;
+    oCodecs = oCodecsIn;
+    return true;
+}
@@ -550,6 +550,32 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
                                   papszOptions))
         return nullptr;
 
+    ZarrV3ShardingInfo oSharding;
+    const char *pszShardSize = CSLFetchNameValue(papszOptions, "SHARD_SIZE");
+    if (pszShardSize)
+    {
+        const CPLStringList aosTokens(
+            CSLTokenizeString2(pszShardSize, ",", 0));
+        if (static_cast<size_t>(aosTokens.size()) != aoDimensions.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid number of values in SHARD_SIZE");
+            return nullptr;
+        }
+        for (int i = 0; i < aosTokens.size(); ++i)
+        {
+            const GUInt64 nSize = std::strtoull(aosTokens[i], nullptr, 10);
+            if (nSize == 0 || (nSize % anBlockSize[i]) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "SHARD_SIZE values must be multiple of the "
+                         "corresponding BLOCKSIZE values");
+                return nullptr;
+            }
+            oSharding.anShardSize.push_back(nSize);
+        }
+    }
+
     const char *pszDimSeparator =
         CSLFetchNameValueDef(papszOptions, "DIM_SEPARATOR", "/");
 
@@ -694,6 +720,17 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
             return nullptr;
     }
 
+    if (!oSharding.anShardSize.empty())
+    {
+        // Inner chunks are encoded with the above codecs, and are grouped
+        // into shards by the outer sharding_indexed codec.
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3ShardingInfo::NAME);
+        oCodec.Add("configuration", ZarrV3ShardingInfo::GetConfiguration(
+                                        anBlockSize, oCodecs));
+        oSharding.oCodecs.Add(oCodec);
+    }
+
     auto poArray =
         ZarrV3Array::Create(m_poSharedResource, GetFullName(), osName,
                             aoDimensions, oDataType, aoDtypeElts, anBlockSize);
@@ -714,6 +751,11 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
     }
     if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
+    if (!oSharding.anShardSize.empty())
+    {
+        poArray->SetStructuralInfo("SHARD_SIZE", pszShardSize);
+        poArray->SetSharding(oSharding);
+    }
     poArray->SetUpdatable(true);
     poArray->SetDefinitionModified(true);
     poArray->Flush();
@@ -12,6 +12,7 @@
 
 #include "zarr.h"
 #include "zarrdrivercore.h"
+#include "vsikerchunk.h"
 
 #include "cpl_minixml.h"
 
@@ -45,6 +46,23 @@ GDALDataset *ZarrDataset::OpenMultidim(const char *pszFilename,
     if (osFilename.back() == '/')
         osFilename.pop_back();
 
+    // Expose a Kerchunk JSON reference file as a (read-only) Zarr store
+    if (!STARTS_WITH(osFilename.c_str(), JSON_REF_FS_PREFIX))
+    {
+        GDALOpenInfo oOpenInfo(osFilename.c_str(), GA_ReadOnly);
+        if (ZARRIsLikelyKerchunkJSONRef(&oOpenInfo))
+        {
+            if (bUpdateMode)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Update of Kerchunk reference files is not "
+                         "supported");
+                return nullptr;
+            }
+            osFilename = VSIKerchunkGetJSONRefPath(osFilename);
+        }
+    }
+
     auto poSharedResource = ZarrSharedResource::Create(osFilename, bUpdateMode);
     poSharedResource->SetOpenOptions(papszOpenOptionsIn);
 
@@ -767,6 +785,15 @@ void ZarrDriver::InitMetadata()
             psBlockSizeNode, "description",
             "Comma separated list of chunk size along each dimension");
 
+        auto psShardSizeNode =
+            CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psShardSizeNode, "name", "SHARD_SIZE");
+        CPLAddXMLAttributeAndValue(psShardSizeNode, "type", "string");
+        CPLAddXMLAttributeAndValue(
+            psShardSizeNode, "description",
+            "Comma separated list of shard size along each dimension. "
+            "Only for FORMAT=ZARR_V3");
+
         auto psChunkMemoryLayout =
             CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psChunkMemoryLayout, "name",
@@ -1788,6 +1815,8 @@ void GDALRegister_Zarr()
     if (GDALGetDriverByName(DRIVER_NAME) != nullptr)
         return;
 
+    VSIInstallKerchunkJSONRefFileSystem();
+
     GDALDriver *poDriver = new ZarrDriver();
     ZARRDriverSetCommonMetadata(poDriver);
 
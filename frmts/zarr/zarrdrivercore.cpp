@@ -38,6 +38,27 @@ static bool CheckExistenceOfOneZarrFile(const char *pszFilename)
     return false;
 }
 
+/************************************************************************/
+/*                    ZARRIsLikelyKerchunkJSONRef()                     */
+/************************************************************************/
+
+/** Return whether the file is likely a Kerchunk JSON reference file */
+bool ZARRIsLikelyKerchunkJSONRef(const GDALOpenInfo *poOpenInfo)
+{
+    if (poOpenInfo->bIsDirectory || poOpenInfo->nHeaderBytes == 0 ||
+        !poOpenInfo->IsExtensionEqualToCI("json"))
+    {
+        return false;
+    }
+    const char *pszHeader =
+        reinterpret_cast<const char *>(poOpenInfo->pabyHeader);
+    // Version 1 files have a "refs" member, version 0 ones directly the
+    // keys of the Zarr store.
+    return pszHeader[0] == '{' &&
+           (strstr(pszHeader, "\"refs\"") != nullptr ||
+            strstr(pszHeader, "\".zgroup\"") != nullptr);
+}
+
 /************************************************************************/
 /*                     ZARRDriverIdentify()                             */
 /************************************************************************/
@@ -50,6 +71,11 @@ int ZARRDriverIdentify(GDALOpenInfo *poOpenInfo)
         return TRUE;
     }
 
+    if (ZARRIsLikelyKerchunkJSONRef(poOpenInfo))
+    {
+        return TRUE;
+    }
+
     if (!poOpenInfo->bIsDirectory)
     {
         return FALSE;
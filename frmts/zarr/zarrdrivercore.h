@@ -20,9 +20,13 @@ constexpr const char *DRIVER_NAME = "Zarr";
 #define ZARRDriverIdentify PLUGIN_SYMBOL_NAME(ZARRDriverIdentify)
 #define ZARRDriverSetCommonMetadata                                            \
     PLUGIN_SYMBOL_NAME(ZARRDriverSetCommonMetadata)
+#define ZARRIsLikelyKerchunkJSONRef                                            \
+    PLUGIN_SYMBOL_NAME(ZARRIsLikelyKerchunkJSONRef)
 
 int ZARRDriverIdentify(GDALOpenInfo *poOpenInfo);
 
 void ZARRDriverSetCommonMetadata(GDALDriver *poDriver);
 
+bool ZARRIsLikelyKerchunkJSONRef(const GDALOpenInfo *poOpenInfo);
+
 #endif
@@ -190,10 +190,19 @@ typedef struct
     /*! Height in pixels of the area of interest. Only valid if
      * bFloatingPointWindowValidity = TRUE */
     double dfYSize;
+
+    /*! Hint that the request is part of a streaming (read-once) access, such
+     * as a full scan of the raster. Blocks fetched during that request are not
+     * promoted in the global block cache, so that they are evicted before
+     * the blocks of other requests.
+     * Only valid if nVersion >= 2.
+     * @since GDAL 3.11
+     */
+    int bNoCachePromotion;
 } GDALRasterIOExtraArg;
 
 #ifndef DOXYGEN_SKIP
-#define RASTERIO_EXTRA_ARG_CURRENT_VERSION 1
+#define RASTERIO_EXTRA_ARG_CURRENT_VERSION 2
 #endif
 
 /** Macro to initialize an instance of GDALRasterIOExtraArg structure.
@@ -207,6 +216,7 @@ typedef struct
         (s).pfnProgress = CPL_NULLPTR;                                         \
         (s).pProgressData = CPL_NULLPTR;                                       \
         (s).bFloatingPointWindowValidity = FALSE;                              \
+        (s).bNoCachePromotion = FALSE;                                         \
     } while (0)
 
 /** Value indicating the start of the range for color interpretations belonging
@@ -425,6 +435,19 @@ typedef enum
  */
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
 
+/** List of (space separated) signatures, that is hexadecimal encoded byte
+ * sequences, such that the driver only identifies files starting with one of
+ * them.
+ *
+ * When it is set, GDALOpenEx() and GDALIdentifyDriverEx() skip the driver,
+ * without calling its Identify() method (or loading it, if it is a deferred
+ * plugin), for files whose header could be read and does not start with any
+ * of the signatures. It must thus only be declared by drivers whose
+ * Identify() method returns FALSE for such files.
+ * @since GDAL 3.11
+ */
+#define GDAL_DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
+
 /** XML snippet with creation options. */
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 
@@ -799,6 +822,15 @@ typedef enum
  */
 #define GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE "DCAP_FLUSHCACHE_CONSISTENT_STATE"
 
+/** Capability set by raster drivers whose GDALRasterBand::IReadBlock()
+ * implementation can be called concurrently from several threads, on distinct
+ * blocks of a dataset opened in read-only mode. When GDAL_NUM_THREADS is set,
+ * GDALDataset::BlockBasedRasterIO() then reads the blocks of large requests
+ * with several threads.
+ * @since GDAL 3.11
+ */
+#define GDAL_DCAP_CONCURRENT_READ_BLOCK "DCAP_CONCURRENT_READ_BLOCK"
+
 /** Capability set by drivers which honor the OGRCoordinatePrecision settings
  * of geometry fields at layer creation and/or for OGRLayer::CreateGeomField().
  * Note that while those drivers honor the settings at feature writing time,
@@ -1270,6 +1302,35 @@ CPLErr CPL_DLL CPL_STDCALL GDALDatasetAdviseRead(
     int nBXSize, int nBYSize, GDALDataType eBDataType, int nBandCount,
     int *panBandCount, CSLConstList papszOptions);
 
+/** Window of a GDALDatasetPrefetchAsync() request.
+ * @since GDAL 3.11
+ */
+typedef struct
+{
+    /** Pixel offset to the top left corner of the window. */
+    int nXOff;
+    /** Line offset to the top left corner of the window. */
+    int nYOff;
+    /** Width of the window in pixels. */
+    int nXSize;
+    /** Height of the window in lines. */
+    int nYSize;
+} GDALPrefetchWindow;
+
+/** Callback invoked when a GDALDatasetPrefetchAsync() request has completed.
+ * @param eErr CE_None if all blocks have been read successfully.
+ * @param pUserData User data passed to GDALDatasetPrefetchAsync().
+ * @since GDAL 3.11
+ */
+typedef void (*GDALPrefetchCompletionFunc)(CPLErr eErr, void *pUserData);
+
+int CPL_DLL GDALDatasetPrefetchAsync(GDALDatasetH hDS, int nWindowCount,
+                                     const GDALPrefetchWindow *pasWindows,
+                                     int nBandCount, const int *panBandList,
+                                     GDALPrefetchCompletionFunc pfnCompletion,
+                                     void *pUserData);
+void CPL_DLL GDALDatasetWaitForPendingPrefetch(GDALDatasetH hDS);
+
 char CPL_DLL **
 GDALDatasetGetCompressionFormats(GDALDatasetH hDS, int nXOff, int nYOff,
                                  int nXSize, int nYSize, int nBandCount,
@@ -1278,6 +1339,10 @@ CPLErr CPL_DLL GDALDatasetReadCompressedData(
     GDALDatasetH hDS, const char *pszFormat, int nXOff, int nYOff, int nXSize,
     int nYSize, int nBandCount, const int *panBandList, void **ppBuffer,
     size_t *pnBufferSize, char **ppszDetailedFormat);
+CPLErr CPL_DLL GDALDatasetWriteCompressedData(
+    GDALDatasetH hDS, const char *pszFormat, int nXOff, int nYOff, int nXSize,
+    int nYSize, int nBandCount, const int *panBandList, const void *pBuffer,
+    size_t nBufferSize);
 
 const char CPL_DLL *CPL_STDCALL GDALGetProjectionRef(GDALDatasetH);
 OGRSpatialReferenceH CPL_DLL GDALGetSpatialRef(GDALDatasetH);
@@ -1609,6 +1674,11 @@ CPLErr CPL_DLL CPL_STDCALL GDALReadBlock(GDALRasterBandH, int, int,
                                          void *) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALWriteBlock(GDALRasterBandH, int, int,
                                           void *) CPL_WARN_UNUSED_RESULT;
+GDALPinnedBlockH CPL_DLL GDALRasterBandPinBlock(GDALRasterBandH hBand,
+                                                int nXBlockOff,
+                                                int nYBlockOff);
+const void CPL_DLL *GDALPinnedBlockGetData(GDALPinnedBlockH hPinnedBlock);
+void CPL_DLL GDALPinnedBlockUnpin(GDALPinnedBlockH hPinnedBlock);
 int CPL_DLL CPL_STDCALL GDALGetRasterBandXSize(GDALRasterBandH);
 int CPL_DLL CPL_STDCALL GDALGetRasterBandYSize(GDALRasterBandH);
 GDALAccess CPL_DLL CPL_STDCALL GDALGetRasterAccess(GDALRasterBandH);
@@ -1746,6 +1816,11 @@ CPLErr CPL_DLL GDALRasterInterpolateAtPoint(GDALRasterBandH hBand,
                                             double *pdfRealValue,
                                             double *pdfImagValue);
 
+CPLErr CPL_DLL GDALRasterInterpolateAtPoints(
+    GDALRasterBandH hBand, size_t nPointCount, const double *padfPixel,
+    const double *padfLine, GDALRIOResampleAlg eInterpolation,
+    double *padfRealValue, double *padfImagValue, int *panSuccess);
+
 CPLErr CPL_DLL GDALRasterInterpolateAtGeolocation(
     GDALRasterBandH hBand, double dfGeolocX, double dfGeolocY,
     OGRSpatialReferenceH hSRS, GDALRIOResampleAlg eInterpolation,
@@ -1945,6 +2020,11 @@ void CPL_DLL GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                               int nComponents, void **ppDestBuffer,
                               GDALDataType eDestDT, size_t nIters);
 
+void CPL_DLL GDALInterleave(const void *const *ppSourceBuffer,
+                            GDALDataType eSourceDT, int nComponents,
+                            void *pDestBuffer, GDALDataType eDestDT,
+                            size_t nIters);
+
 void CPL_DLL GDALTranspose2D(const void *pSrc, GDALDataType eSrcType,
                              void *pDst, GDALDataType eDstType,
                              size_t nSrcWidth, size_t nSrcHeight);
@@ -2303,6 +2383,23 @@ GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
+void CPL_DLL GDALGetCacheArenaStatistics(GIntBig *pnReservedBytes,
+                                         GIntBig *pnUsedBytes);
+
+void CPL_DLL GDALDatasetGetBlockCacheStatistics(GDALDatasetH hDS,
+                                                GIntBig *pnCachedBytes,
+                                                GIntBig *pnHits,
+                                                GIntBig *pnMisses,
+                                                GIntBig *pnEvictions);
+void CPL_DLL GDALGetRasterBandBlockCacheStatistics(GDALRasterBandH hBand,
+                                                   GIntBig *pnCachedBytes,
+                                                   GIntBig *pnHits,
+                                                   GIntBig *pnMisses,
+                                                   GIntBig *pnEvictions);
+void CPL_DLL GDALDatasetSetBlockCacheQuota(GDALDatasetH hDS,
+                                           GIntBig nMaxBytes);
+GIntBig CPL_DLL GDALDatasetGetBlockCacheQuota(GDALDatasetH hDS);
+
 /* ==================================================================== */
 /*      GDAL virtual memory                                             */
 /* ==================================================================== */
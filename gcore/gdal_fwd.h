@@ -81,6 +81,12 @@ typedef struct GDALDimensionHS *GDALDimensionH;
 */
 typedef struct GDALSubdatasetInfo *GDALSubdatasetInfoH;
 
+/**
+ *  Opaque type used for the C bindings of the C++ GDALPinnedBlock class
+ *  @since GDAL 3.11
+*/
+typedef struct GDALPinnedBlockHS *GDALPinnedBlockH;
+
 /*!
 \section gdal_fwd_geometry Geometry related types.
 */
@@ -34,6 +34,7 @@ class GDALProxyDataset;
 class GDALProxyRasterBand;
 class GDALAsyncReader;
 class GDALRelationship;
+struct GDALBlockCacheAccounting;
 
 /* -------------------------------------------------------------------- */
 /*      Pull in the public declarations.  This gets the C apis, and     */
@@ -54,13 +55,16 @@ class GDALRelationship;
 
 #include <stdarg.h>
 
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <cstdint>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #if __cplusplus >= 202002L
 #include <span>
@@ -582,6 +586,12 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                        GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
     CPLErr BlockBasedFlushCache(bool bAtClosing);
 
+    int GetConcurrentReadBlockThreadCount();
+    void ReadBlocksMultiThreaded(int nThreads, int nBlockXStart,
+                                 int nBlockXEnd, int nBlockYStart,
+                                 int nBlockYEnd, int nBandCount,
+                                 const int *panBandMap);
+
     CPLErr
     BandBasedRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
                       int nYSize, void *pData, int nBufXSize, int nBufYSize,
@@ -716,6 +726,12 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
 
+    void GetBlockCacheStatistics(GIntBig *pnCachedBytes, GIntBig *pnHits,
+                                 GIntBig *pnMisses,
+                                 GIntBig *pnEvictions) const;
+    void SetBlockCacheQuota(GIntBig nMaxBytes);
+    GIntBig GetBlockCacheQuota() const;
+
     virtual GIntBig GetEstimatedRAMUsage();
 
     virtual const OGRSpatialReference *GetSpatialRef() const;
@@ -757,6 +773,13 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                               int nBandCount, int *panBandList,
                               char **papszOptions);
 
+    std::future<CPLErr>
+    PrefetchAsync(int nWindowCount, const GDALPrefetchWindow *pasWindows,
+                  int nBandCount, const int *panBandList,
+                  GDALPrefetchCompletionFunc pfnCompletion = nullptr,
+                  void *pUserData = nullptr);
+    void WaitForPendingPrefetch();
+
     virtual CPLErr CreateMaskBand(int nFlagsIn);
 
     virtual GDALAsyncReader *
@@ -816,6 +839,10 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                                       int nBands, const int *panBandList,
                                       void **ppBuffer, size_t *pnBufferSize,
                                       char **ppszDetailedFormat);
+    virtual CPLErr WriteCompressedData(const char *pszFormat, int nXOff,
+                                       int nYOff, int nXSize, int nYSize,
+                                       int nBands, const int *panBandList,
+                                       const void *pBuffer, size_t nBufferSize);
 
     int Reference();
     int Dereference();
@@ -945,6 +972,10 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     // SetEnableOverviews() only to be used by GDALOverviewDataset
     void SetEnableOverviews(bool bEnable);
 
+    // Only to be used by GDALAbstractBandBlockCache
+    CPL_INTERNAL std::shared_ptr<GDALBlockCacheAccounting>
+    GetBlockCacheAccounting();
+
     // Only to be used by driver's GetOverviewCount() method.
     bool AreOverviewsEnabled() const;
 
@@ -1253,8 +1284,16 @@ class CPL_DLL GDALRasterBlock
 
     bool bMustDetach;
 
+    // Whether the block is in the probation (old) segment of the LRU list
+    bool bOld = false;
+    // Time (in milliseconds) at which the block entered the old segment
+    GUInt32 nOldEntryTime = 0;
+    // Index of the arena pData was allocated from, or -1 for VSIMalloc()
+    int nDataArena = -1;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
+    CPL_INTERNAL void Unlink_unlocked(void);
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
@@ -1366,6 +1405,9 @@ class CPL_DLL GDALRasterBlock
     static void EnterDisableDirtyBlockFlush();
     static void LeaveDisableDirtyBlockFlush();
 
+    static void EnterNoCachePromotion();
+    static void LeaveNoCachePromotion();
+
 #ifdef notdef
     static void CheckNonOrphanedBlocks(GDALRasterBand *poBand);
     void DumpBlock();
@@ -1375,12 +1417,118 @@ class CPL_DLL GDALRasterBlock
     /* Should only be called by GDALDestroyDriverManager() */
     //! @cond Doxygen_Suppress
     CPL_INTERNAL static void DestroyRBMutex();
+
+    CPL_INTERNAL static bool SubmitWriteBehind(GDALRasterBlock *poBlock);
     //! @endcond
 
   private:
     CPL_DISALLOW_COPY_ASSIGN(GDALRasterBlock)
 };
 
+/* ******************************************************************** */
+/*                            GDALPinnedBlock                           */
+/* ******************************************************************** */
+
+/** RAII holder of a raster block pinned in the block cache.
+ *
+ * While it is pinned, the block cannot be evicted from the block cache, so
+ * its data can be accessed directly with GetData() without being copied.
+ * The data must not be modified.
+ *
+ * Instances are returned by GDALRasterBand::PinBlock(). They must be
+ * destroyed, or Unpin() be called, before the block cache of the band is
+ * flushed or the dataset is closed.
+ *
+ * @since GDAL 3.11
+ */
+class CPL_DLL GDALPinnedBlock
+{
+  public:
+    /** Construct an empty instance */
+    GDALPinnedBlock() = default;
+
+    /** Construct from a block locked with GDALRasterBand::GetLockedBlockRef().
+     * The lock is released by the destructor or Unpin().
+     */
+    explicit GDALPinnedBlock(GDALRasterBlock *poBlock) : m_poBlock(poBlock)
+    {
+    }
+
+    /** Move constructor */
+    GDALPinnedBlock(GDALPinnedBlock &&other) noexcept
+        : m_poBlock(other.m_poBlock)
+    {
+        other.m_poBlock = nullptr;
+    }
+
+    /** Move assignment */
+    GDALPinnedBlock &operator=(GDALPinnedBlock &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Unpin();
+            m_poBlock = other.m_poBlock;
+            other.m_poBlock = nullptr;
+        }
+        return *this;
+    }
+
+    /** Destructor. Unpins the block */
+    ~GDALPinnedBlock()
+    {
+        Unpin();
+    }
+
+    /** Unpin the block. The data pointer may no longer be used after that. */
+    void Unpin()
+    {
+        if (m_poBlock)
+        {
+            m_poBlock->DropLock();
+            m_poBlock = nullptr;
+        }
+    }
+
+    /** Return whether a block is pinned */
+    explicit operator bool() const
+    {
+        return m_poBlock != nullptr;
+    }
+
+    /** Return the block data, of GetXSize() * GetYSize() values of
+     * GetDataType(), or nullptr if no block is pinned. For blocks at the
+     * right or bottom edge of the raster, only the part inside the raster is
+     * valid.
+     */
+    const void *GetData() const
+    {
+        return m_poBlock ? m_poBlock->GetDataRef() : nullptr;
+    }
+
+    /** Return the data type of the block, or GDT_Unknown */
+    GDALDataType GetDataType() const
+    {
+        return m_poBlock ? m_poBlock->GetDataType() : GDT_Unknown;
+    }
+
+    /** Return the width of the block in pixels, or 0 */
+    int GetXSize() const
+    {
+        return m_poBlock ? m_poBlock->GetXSize() : 0;
+    }
+
+    /** Return the height of the block in pixels, or 0 */
+    int GetYSize() const
+    {
+        return m_poBlock ? m_poBlock->GetYSize() : 0;
+    }
+
+  private:
+    GDALRasterBlock *m_poBlock = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALPinnedBlock)
+};
+
 /* ******************************************************************** */
 /*                             GDALColorTable                           */
 /* ******************************************************************** */
@@ -1433,6 +1581,18 @@ class CPL_DLL GDALColorTable
 
 //! @cond Doxygen_Suppress
 
+//! Block cache statistics of a raster band or of a dataset
+struct GDALBlockCacheAccounting
+{
+    std::atomic<GIntBig> nCachedBytes{0};
+    std::atomic<GIntBig> nHits{0};
+    std::atomic<GIntBig> nMisses{0};
+    std::atomic<GIntBig> nEvictions{0};
+    // Maximum number of cached bytes, or 0 for no limit. Only used for
+    // datasets.
+    std::atomic<GIntBig> nQuota{0};
+};
+
 //! This manages how a raster band store its cached block.
 // only used by GDALRasterBand implementation.
 
@@ -1447,8 +1607,15 @@ class GDALAbstractBandBlockCache
     CPLMutex *hCondMutex = nullptr;
     volatile int nKeepAliveCounter = 0;
 
+    // Number of dirty blocks being written by worker threads
+    std::atomic<int> m_nPendingWriteBehind{0};
+
     volatile int m_nDirtyBlocks = 0;
 
+    // Statistics of the band, and of its dataset (may be null)
+    GDALBlockCacheAccounting m_oAccounting{};
+    std::shared_ptr<GDALBlockCacheAccounting> m_poDatasetAccounting{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -1460,6 +1627,7 @@ class GDALAbstractBandBlockCache
 
     void FreeDanglingBlocks();
     void UnreferenceBlockBase();
+    bool SubmitWriteBehind(GDALRasterBlock *poBlock);
 
     void StartDirtyBlockFlushingLog();
     void UpdateDirtyBlockFlushingLog();
@@ -1474,6 +1642,10 @@ class GDALAbstractBandBlockCache
     void IncDirtyBlocks(int nInc);
     void WaitCompletionPendingTasks();
 
+    void IncPendingWriteBehind();
+    void DecPendingWriteBehind();
+    void WaitPendingWriteBehind();
+
     void EnableDirtyBlockWriting()
     {
         --m_nWriteDirtyBlocksDisabled;
@@ -1489,6 +1661,20 @@ class GDALAbstractBandBlockCache
         return m_nDirtyBlocks > 0;
     }
 
+    const GDALBlockCacheAccounting &GetAccounting() const
+    {
+        return m_oAccounting;
+    }
+
+    GDALBlockCacheAccounting *GetDatasetAccounting() const
+    {
+        return m_poDatasetAccounting.get();
+    }
+
+    void AddCachedBytes(GIntBig nBytes);
+    void IncHits();
+    void IncMisses();
+
     virtual bool Init() = 0;
     virtual bool IsInitOK() = 0;
     virtual CPLErr FlushCache() = 0;
@@ -1552,7 +1738,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     friend class GDALRasterBlock;
     friend class GDALDataset;
 
-    CPLErr eFlushBlockErr = CE_None;
+    // Error of the writing of a dirty block, to be reported later. May be
+    // set by worker threads writing blocks (see
+    // GDALRasterBlock::SubmitWriteBehind()).
+    std::atomic<CPLErr> eFlushBlockErr{CE_None};
     GDALAbstractBandBlockCache *poBandBlockCache = nullptr;
 
     CPL_INTERNAL void SetFlushBlockErr(CPLErr eErr);
@@ -1670,6 +1859,7 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
   protected:
     virtual CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) = 0;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff, void *pData);
+    virtual bool IsWriteBlockThreadSafe() const;
 
     virtual CPLErr
     IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
@@ -1806,6 +1996,8 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     virtual CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                               int bWriteDirtyBlock = TRUE);
 
+    GDALPinnedBlock PinBlock(int nXBlockOff, int nYBlockOff);
+
     unsigned char *
     GetIndexColorTranslationTo(/* const */ GDALRasterBand *poReferenceBand,
                                unsigned char *pTranslationTable = nullptr,
@@ -1815,6 +2007,9 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
+    void GetBlockCacheStatistics(GIntBig *pnCachedBytes, GIntBig *pnHits,
+                                 GIntBig *pnMisses,
+                                 GIntBig *pnEvictions) const;
     virtual char **GetCategoryNames();
     virtual double GetNoDataValue(int *pbSuccess = nullptr);
     virtual int64_t GetNoDataValueAsInt64(int *pbSuccess = nullptr);
@@ -1888,6 +2083,11 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     virtual CPLErr SetDefaultHistogram(double dfMin, double dfMax, int nBuckets,
                                        GUIntBig *panHistogram);
 
+    //! @cond Doxygen_Suppress
+    CPLErr ComputeStatisticsAndDefaultHistogram(GDALProgressFunc pfnProgress,
+                                                void *pProgressData);
+    //! @endcond
+
     virtual GDALRasterAttributeTable *GetDefaultRAT();
     virtual CPLErr SetDefaultRAT(const GDALRasterAttributeTable *poRAT);
 
@@ -1919,6 +2119,13 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                                       double *pdfRealValue,
                                       double *pdfImagValue = nullptr) const;
 
+    CPLErr InterpolateAtPoints(size_t nPointCount, const double *padfPixel,
+                               const double *padfLine,
+                               GDALRIOResampleAlg eInterpolation,
+                               double *padfRealValue,
+                               double *padfImagValue = nullptr,
+                               int *panSuccess = nullptr) const;
+
 #ifndef DOXYGEN_XML
     void ReportError(CPLErr eErrClass, CPLErrorNum err_no, const char *fmt,
                      ...) const CPL_PRINT_FUNC_FORMAT(4, 5);
@@ -2059,13 +2266,24 @@ class CPL_DLL GDALNoDataMaskBand : public GDALRasterBand
     uint64_t m_nNoDataValueUInt64 = 0;
     GDALRasterBand *m_poParent = nullptr;
 
+    // Number of valid pixels of each block read so far, or -1 if unknown.
+    // Only maintained when the parent dataset is opened in read-only mode.
+    std::vector<int> m_anBlockValidCount{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALNoDataMaskBand)
 
+    CPL_INTERNAL int *GetBlockValidCountPtr(int nXBlockOff, int nYBlockOff);
+    CPL_INTERNAL void UpdateBlockValidCounts(int nXOff, int nYOff, int nXSize,
+                                             int nYSize, const GByte *pabyData,
+                                             GSpacing nLineSpace);
+
   protected:
     CPLErr IReadBlock(int, int, void *) override;
     CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
                      GDALDataType, GSpacing, GSpacing,
                      GDALRasterIOExtraArg *psExtraArg) override;
+    int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nMaskFlagStop, double *pdfDataPct) override;
 
     bool
     EmitErrorMessageIfWriteNotSupported(const char *pszCaller) const override;
@@ -2447,6 +2665,7 @@ class CPL_DLL GDALDriver : public GDALMajorObject
  * <li>GDAL_DMD_OPENOPTIONLIST</li>
  * <li>GDAL_DMD_SUBDATASETS</li>
  * <li>GDAL_DMD_CONNECTION_PREFIX</li>
+ * <li>GDAL_DMD_OPEN_SIGNATURES</li>
  * <li>GDAL_DCAP_RASTER</li>
  * <li>GDAL_DCAP_MULTIDIM_RASTER</li>
  * <li>GDAL_DCAP_VECTOR</li>
@@ -2539,6 +2758,21 @@ class GDALPluginDriverProxy : public GDALDriver
  * this class.
  */
 
+//! @cond Doxygen_Suppress
+/** Registered driver, with information precomputed from its metadata that is
+ * used to probe files in GDALOpenEx() and GDALIdentifyDriverEx(). */
+struct GDALOpenDispatchEntry
+{
+    GDALDriver *poDriver = nullptr;
+    bool bHidden = false;
+    /** Decoded GDAL_DMD_OPEN_SIGNATURES. Empty if not declared. */
+    std::vector<std::string> aosSignatures{};
+
+    bool IsExcludedBySignature(const GDALOpenInfo *poOpenInfo) const;
+};
+
+//! @endcond
+
 class CPL_DLL GDALDriverManager : public GDALMajorObject
 {
     int nDrivers = 0;
@@ -2551,6 +2785,19 @@ class CPL_DLL GDALDriverManager : public GDALMajorObject
     bool m_bInDeferredDriverLoading = false;
     std::map<std::string, std::unique_ptr<GDALDriver>> m_oMapRealDrivers{};
     std::vector<std::unique_ptr<GDALDriver>> m_aoHiddenDrivers{};
+    std::shared_ptr<const std::vector<GDALOpenDispatchEntry>>
+        m_poOpenDispatchTable{};
+    int m_nOpenDispatchTableGeneration = -1;
+
+    struct IdentifyStats
+    {
+        GIntBig nCalls = 0;
+        GIntBig nSkippedBySignature = 0;
+        double dfSeconds = 0;
+    };
+
+    std::mutex m_oIdentifyStatsMutex{};
+    std::map<std::string, IdentifyStats> m_oMapIdentifyStats{};
 
     GDALDriver *GetDriver_unlocked(int iDriver)
     {
@@ -2609,6 +2856,14 @@ class CPL_DLL GDALDriverManager : public GDALMajorObject
     int GetDriverCount(bool bIncludeHidden) const;
     GDALDriver *GetDriver(int iDriver, bool bIncludeHidden);
     bool IsKnownDriver(const char *pszDriverName) const;
+
+    std::shared_ptr<const std::vector<GDALOpenDispatchEntry>>
+    GetOpenDispatchTable();
+    static void InvalidateOpenDispatchTable();
+
+    static bool IsIdentifyStatsEnabled();
+    void AddIdentifyStats(const GDALDriver *poDriver, bool bSkippedBySignature,
+                          double dfSeconds);
     //! @endcond
 };
 
@@ -3237,6 +3492,10 @@ class CPL_DLL GDALAbstractMDArray
            const GPtrDiff_t *bufferStride,  // stride in elements
            const GDALExtendedDataType &bufferDataType, const void *pSrcBuffer);
 
+    std::vector<size_t>
+    GetProcessingChunkSizeForBlockSize(const std::vector<GUInt64> &blockSize,
+                                       size_t nMaxChunkMemory) const;
+
     void BaseRename(const std::string &osNewName);
 
     virtual void NotifyChildrenOfRenaming()
@@ -3568,11 +3827,22 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     mutable bool m_bHasTriedCachedArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCachedArray{};
 
+    // Identifier of the array in the chunk cache. 0 if not used yet.
+    friend class GDALMDArrayChunkCache;
+    mutable uint64_t m_nChunkCacheArrayId = 0;
+
   protected:
     //! @cond Doxygen_Suppress
     GDALMDArray(const std::string &osParentName, const std::string &osName,
                 const std::string &osContext = std::string());
 
+    // Whether chunks read from this array can be kept in the process-wide
+    // chunk cache, when it is read-only. Drivers opt in by returning true.
+    virtual bool IsChunkCacheable() const
+    {
+        return false;
+    }
+
     virtual bool IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                              CSLConstList papszOptions) const;
 
@@ -3624,6 +3894,8 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     //! @endcond
 
   public:
+    ~GDALMDArray() override;
+
     GUInt64 GetTotalCopyCost() const;
 
     virtual bool CopyFrom(GDALDataset *poSrcDS, const GDALMDArray *poSrcArray,
@@ -92,6 +92,11 @@ class CPL_DLL GDALProxyDataset : public GDALDataset
                                       int nBandCount, const int *panBandList,
                                       void **ppBuffer, size_t *pnBufferSize,
                                       char **ppszDetailedFormat) override;
+    virtual CPLErr WriteCompressedData(const char *pszFormat, int nXOff,
+                                       int nYOff, int nXSize, int nYSize,
+                                       int nBandCount, const int *panBandList,
+                                       const void *pBuffer,
+                                       size_t nBufferSize) override;
 
   private:
     CPL_DISALLOW_COPY_ASSIGN(GDALProxyDataset)
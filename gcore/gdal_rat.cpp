@@ -109,7 +109,7 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
                                           int iStartRow, int iLength,
                                           double *pdfData)
 {
-    if ((iStartRow + iLength) > GetRowCount())
+    if (iStartRow < 0 || iLength < 0 || iStartRow > GetRowCount() - iLength)
     {
         return CE_Failure;
     }
@@ -118,14 +118,14 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            pdfData[iIndex] = GetValueAsDouble(iIndex, iField);
+            pdfData[iIndex - iStartRow] = GetValueAsDouble(iIndex, iField);
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, pdfData[iIndex]);
+            SetValue(iIndex, iField, pdfData[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -173,7 +173,7 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
                                           int iStartRow, int iLength,
                                           int *pnData)
 {
-    if ((iStartRow + iLength) > GetRowCount())
+    if (iStartRow < 0 || iLength < 0 || iStartRow > GetRowCount() - iLength)
     {
         return CE_Failure;
     }
@@ -182,14 +182,14 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            pnData[iIndex] = GetValueAsInt(iIndex, iField);
+            pnData[iIndex - iStartRow] = GetValueAsInt(iIndex, iField);
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, pnData[iIndex]);
+            SetValue(iIndex, iField, pnData[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -239,7 +239,7 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
                                           int iStartRow, int iLength,
                                           char **papszStrList)
 {
-    if ((iStartRow + iLength) > GetRowCount())
+    if (iStartRow < 0 || iLength < 0 || iStartRow > GetRowCount() - iLength)
     {
         return CE_Failure;
     }
@@ -248,14 +248,15 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            papszStrList[iIndex] = VSIStrdup(GetValueAsString(iIndex, iField));
+            papszStrList[iIndex - iStartRow] =
+                VSIStrdup(GetValueAsString(iIndex, iField));
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, papszStrList[iIndex]);
+            SetValue(iIndex, iField, papszStrList[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -708,6 +709,10 @@ CPLXMLNode *GDALRasterAttributeTable::Serialize() const
     CPLXMLNode *psTail = nullptr;
     CPLXMLNode *psRow = nullptr;
 
+    std::vector<GDALRATFieldType> aeTypes;
+    for (int iCol = 0; iCol < iColCount; iCol++)
+        aeTypes.push_back(GetTypeOfCol(iCol));
+
     for (int iRow = 0; iRow < iRowCount; iRow++)
     {
         psRow = CPLCreateXMLNode(nullptr, CXT_Element, "Row");
@@ -718,23 +723,29 @@ CPLXMLNode *GDALRasterAttributeTable::Serialize() const
         psTail = psRow;
 
         snprintf(szValue, sizeof(szValue), "%d", iRow);
-        CPLCreateXMLNode(CPLCreateXMLNode(psRow, CXT_Attribute, "index"),
-                         CXT_Text, szValue);
+        CPLXMLNode *psLastChild =
+            CPLCreateXMLNode(psRow, CXT_Attribute, "index");
+        CPLCreateXMLNode(psLastChild, CXT_Text, szValue);
 
         for (int iCol = 0; iCol < iColCount; iCol++)
         {
             const char *pszValue = szValue;
 
-            if (GetTypeOfCol(iCol) == GFT_Integer)
+            if (aeTypes[iCol] == GFT_Integer)
                 snprintf(szValue, sizeof(szValue), "%d",
                          GetValueAsInt(iRow, iCol));
-            else if (GetTypeOfCol(iCol) == GFT_Real)
+            else if (aeTypes[iCol] == GFT_Real)
                 CPLsnprintf(szValue, sizeof(szValue), "%.16g",
                             GetValueAsDouble(iRow, iCol));
             else
                 pszValue = GetValueAsString(iRow, iCol);
 
-            CPLCreateXMLElementAndValue(psRow, "F", pszValue);
+            // Append after the last child, rather than walking the list of
+            // children of the row for each field.
+            CPLXMLNode *psF =
+                CPLCreateXMLElementAndValue(nullptr, "F", pszValue);
+            psLastChild->psNext = psF;
+            psLastChild = psF;
         }
     }
 
@@ -1896,6 +1907,75 @@ void CPL_STDCALL GDALRATSetValueAsDouble(GDALRasterAttributeTableH hRAT,
     GDALRasterAttributeTable::FromHandle(hRAT)->SetValue(iRow, iField, dfValue);
 }
 
+/************************************************************************/
+/*                              ValuesIO()                              */
+/************************************************************************/
+
+// When the type of the column matches the one of the buffer, values are
+// directly copied from/to the column storage, instead of going through
+// a virtual GetValueAsXXX() / SetValue() call for each row.
+
+CPLErr GDALDefaultRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag,
+                                                 int iField, int iStartRow,
+                                                 int iLength, double *pdfData)
+{
+    if (iField >= 0 && iField < static_cast<int>(aoFields.size()) &&
+        aoFields[iField].eType == GFT_Real && iStartRow >= 0 && iLength >= 0 &&
+        iStartRow <= nRowCount - iLength)
+    {
+        auto oIter = aoFields[iField].adfValues.begin() + iStartRow;
+        if (eRWFlag == GF_Read)
+            std::copy_n(oIter, iLength, pdfData);
+        else
+            std::copy_n(pdfData, iLength, oIter);
+        return CE_None;
+    }
+    return GDALRasterAttributeTable::ValuesIO(eRWFlag, iField, iStartRow,
+                                              iLength, pdfData);
+}
+
+CPLErr GDALDefaultRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag,
+                                                 int iField, int iStartRow,
+                                                 int iLength, int *pnData)
+{
+    if (iField >= 0 && iField < static_cast<int>(aoFields.size()) &&
+        aoFields[iField].eType == GFT_Integer && iStartRow >= 0 &&
+        iLength >= 0 && iStartRow <= nRowCount - iLength)
+    {
+        auto oIter = aoFields[iField].anValues.begin() + iStartRow;
+        if (eRWFlag == GF_Read)
+            std::copy_n(oIter, iLength, pnData);
+        else
+            std::copy_n(pnData, iLength, oIter);
+        return CE_None;
+    }
+    return GDALRasterAttributeTable::ValuesIO(eRWFlag, iField, iStartRow,
+                                              iLength, pnData);
+}
+
+CPLErr GDALDefaultRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag,
+                                                 int iField, int iStartRow,
+                                                 int iLength,
+                                                 char **papszStrList)
+{
+    if (iField >= 0 && iField < static_cast<int>(aoFields.size()) &&
+        aoFields[iField].eType == GFT_String && iStartRow >= 0 &&
+        iLength >= 0 && iStartRow <= nRowCount - iLength)
+    {
+        auto &aosValues = aoFields[iField].aosValues;
+        for (int i = 0; i < iLength; ++i)
+        {
+            if (eRWFlag == GF_Read)
+                papszStrList[i] = VSIStrdup(aosValues[iStartRow + i].c_str());
+            else
+                aosValues[iStartRow + i] = papszStrList[i];
+        }
+        return CE_None;
+    }
+    return GDALRasterAttributeTable::ValuesIO(eRWFlag, iField, iStartRow,
+                                              iLength, papszStrList);
+}
+
 /************************************************************************/
 /*                       ChangesAreWrittenToFile()                      */
 /************************************************************************/
@@ -369,6 +369,13 @@ class CPL_DLL GDALDefaultRasterAttributeTable : public GDALRasterAttributeTable
     void SetValue(int iRow, int iField, double dfValue) override;
     void SetValue(int iRow, int iField, int nValue) override;
 
+    CPLErr ValuesIO(GDALRWFlag eRWFlag, int iField, int iStartRow,
+                    int iLength, double *pdfData) override;
+    CPLErr ValuesIO(GDALRWFlag eRWFlag, int iField, int iStartRow,
+                    int iLength, int *pnData) override;
+    CPLErr ValuesIO(GDALRWFlag eRWFlag, int iField, int iStartRow,
+                    int iLength, char **papszStrList) override;
+
     int ChangesAreWrittenToFile() override;
     void SetRowCount(int iCount) override;
 
@@ -12,6 +12,9 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+
+#include <algorithm>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -20,30 +23,67 @@
 // to hang forever once the tests have terminated.
 static CPLWorkerThreadPool *gpoCompressThreadPool = nullptr;
 
+// Dedicated to the writing of dirty blocks of the block cache, so that
+// jobs of the global thread pool waiting for those writes to complete cannot
+// starve them.
+static CPLWorkerThreadPool *gpoWriteBehindThreadPool = nullptr;
+
 static std::mutex &GetMutexThreadPool()
 {
     static std::mutex gMutexThreadPool;
     return gMutexThreadPool;
 }
 
-CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
+static int GetMaxThreads(int nThreads)
 {
-    std::lock_guard oGuard(GetMutexThreadPool());
-    if (gpoCompressThreadPool == nullptr)
+    // Process-wide upper bound, so that many datasets each requesting
+    // their own number of threads do not oversubscribe the CPUs.
+    const char *pszMaxThreads =
+        CPLGetConfigOption("GDAL_THREAD_POOL_MAX_THREADS", nullptr);
+    if (pszMaxThreads)
+    {
+        const int nMaxThreads = EQUAL(pszMaxThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : atoi(pszMaxThreads);
+        if (nMaxThreads > 0)
+            nThreads = std::min(nThreads, nMaxThreads);
+    }
+    return nThreads;
+}
+
+// Must be called with GetMutexThreadPool() held
+static CPLWorkerThreadPool *GetOrCreateThreadPool(CPLWorkerThreadPool *&poPool,
+                                                  int nThreads)
+{
+    if (poPool == nullptr)
     {
-        gpoCompressThreadPool = new CPLWorkerThreadPool();
-        if (!gpoCompressThreadPool->Setup(nThreads, nullptr, nullptr, false))
+        poPool = new CPLWorkerThreadPool();
+        if (!poPool->Setup(nThreads, nullptr, nullptr, false))
         {
-            delete gpoCompressThreadPool;
-            gpoCompressThreadPool = nullptr;
+            delete poPool;
+            poPool = nullptr;
         }
     }
-    else if (nThreads > gpoCompressThreadPool->GetThreadCount())
+    else if (nThreads > poPool->GetThreadCount())
     {
         // Increase size of thread pool
-        gpoCompressThreadPool->Setup(nThreads, nullptr, nullptr, false);
+        poPool->Setup(nThreads, nullptr, nullptr, false);
     }
-    return gpoCompressThreadPool;
+    return poPool;
+}
+
+CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
+{
+    nThreads = GetMaxThreads(nThreads);
+    std::lock_guard oGuard(GetMutexThreadPool());
+    return GetOrCreateThreadPool(gpoCompressThreadPool, nThreads);
+}
+
+CPLWorkerThreadPool *GDALGetWriteBehindThreadPool(int nThreads)
+{
+    nThreads = GetMaxThreads(nThreads);
+    std::lock_guard oGuard(GetMutexThreadPool());
+    return GetOrCreateThreadPool(gpoWriteBehindThreadPool, nThreads);
 }
 
 void GDALDestroyGlobalThreadPool()
@@ -51,4 +91,6 @@ void GDALDestroyGlobalThreadPool()
     std::lock_guard oGuard(GetMutexThreadPool());
     delete gpoCompressThreadPool;
     gpoCompressThreadPool = nullptr;
+    delete gpoWriteBehindThreadPool;
+    gpoWriteBehindThreadPool = nullptr;
 }
@@ -17,6 +17,8 @@
 
 CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
+CPLWorkerThreadPool *GDALGetWriteBehindThreadPool(int nThreads);
+
 void GDALDestroyGlobalThreadPool();
 
 #endif  // GDAL_THREAD_POOL_H
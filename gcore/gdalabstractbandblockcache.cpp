@@ -37,6 +37,8 @@ GDALAbstractBandBlockCache::GDALAbstractBandBlockCache(GDALRasterBand *poBandIn)
 {
     if (hCondMutex)
         CPLReleaseMutex(hCondMutex);
+    if (GDALDataset *poDS = poBand->GetDataset())
+        m_poDatasetAccounting = poDS->GetBlockCacheAccounting();
 }
 
 /************************************************************************/
@@ -70,6 +72,49 @@ GDALAbstractBandBlockCache::~GDALAbstractBandBlockCache()
 void GDALAbstractBandBlockCache::UnreferenceBlockBase()
 {
     CPLAtomicInc(&nKeepAliveCounter);
+
+    m_oAccounting.nEvictions.fetch_add(1, std::memory_order_relaxed);
+    if (m_poDatasetAccounting)
+        m_poDatasetAccounting->nEvictions.fetch_add(1,
+                                                    std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                           AddCachedBytes()                           */
+/*                                                                      */
+/*      This is called by GDALRasterBlock::Internalize() and            */
+/*      Detach() to account for the size of blocks entering or leaving  */
+/*      the global block cache.                                         */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::AddCachedBytes(GIntBig nBytes)
+{
+    m_oAccounting.nCachedBytes.fetch_add(nBytes, std::memory_order_relaxed);
+    if (m_poDatasetAccounting)
+        m_poDatasetAccounting->nCachedBytes.fetch_add(
+            nBytes, std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                              IncHits()                               */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::IncHits()
+{
+    m_oAccounting.nHits.fetch_add(1, std::memory_order_relaxed);
+    if (m_poDatasetAccounting)
+        m_poDatasetAccounting->nHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                             IncMisses()                              */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::IncMisses()
+{
+    m_oAccounting.nMisses.fetch_add(1, std::memory_order_relaxed);
+    if (m_poDatasetAccounting)
+        m_poDatasetAccounting->nMisses.fetch_add(1, std::memory_order_relaxed);
 }
 
 /************************************************************************/
@@ -100,7 +145,8 @@ void GDALAbstractBandBlockCache::AddBlockToFreeList(GDALRasterBlock *poBlock)
     CPLAcquireMutex(hCondMutex, 1000);
     if (CPLAtomicDec(&nKeepAliveCounter) == 0)
     {
-        CPLCondSignal(hCond);
+        // Broadcast, since WaitPendingWriteBehind() may also be waiting
+        CPLCondBroadcast(hCond);
     }
     CPLReleaseMutex(hCondMutex);
 }
@@ -125,6 +171,67 @@ void GDALAbstractBandBlockCache::WaitCompletionPendingTasks()
     CPLReleaseMutex(hCondMutex);
 }
 
+/************************************************************************/
+/*                        IncPendingWriteBehind()                       */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::IncPendingWriteBehind()
+{
+    ++m_nPendingWriteBehind;
+}
+
+/************************************************************************/
+/*                        DecPendingWriteBehind()                       */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::DecPendingWriteBehind()
+{
+    CPLAcquireMutex(hCondMutex, 1000);
+    if (--m_nPendingWriteBehind == 0)
+        CPLCondBroadcast(hCond);
+    CPLReleaseMutex(hCondMutex);
+}
+
+/************************************************************************/
+/*                       WaitPendingWriteBehind()                       */
+/*                                                                      */
+/*      Called before reading a block from the driver, so that blocks   */
+/*      being written by worker threads are not read back before they   */
+/*      have reached the driver.                                        */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::WaitPendingWriteBehind()
+{
+    if (m_nPendingWriteBehind == 0)
+        return;
+
+    CPLAcquireMutex(hCondMutex, 1000);
+    while (m_nPendingWriteBehind != 0)
+    {
+        CPLCondWait(hCond, hCondMutex);
+    }
+    CPLReleaseMutex(hCondMutex);
+}
+
+/************************************************************************/
+/*                          SubmitWriteBehind()                         */
+/*                                                                      */
+/*      Called by FlushBlock() implementations with a dirty block that  */
+/*      has been removed from the band and detached from the LRU list.  */
+/*      Returns false if the caller must write and delete the block     */
+/*      itself.                                                         */
+/************************************************************************/
+
+bool GDALAbstractBandBlockCache::SubmitWriteBehind(GDALRasterBlock *poBlock)
+{
+    // Keep the band alive until the worker thread calls AddBlockToFreeList()
+    CPLAtomicInc(&nKeepAliveCounter);
+    if (GDALRasterBlock::SubmitWriteBehind(poBlock))
+        return true;
+    CPLAtomicDec(&nKeepAliveCounter);
+    return false;
+}
+
 /************************************************************************/
 /*                           FreeDanglingBlocks()                       */
 /************************************************************************/
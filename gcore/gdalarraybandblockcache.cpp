@@ -317,6 +317,11 @@ CPLErr GDALArrayBandBlockCache::FlushCache()
 
     WaitCompletionPendingTasks();
 
+    // Errors of blocks written by worker threads
+    const CPLErr eWriteBehindErr = poBand->eFlushBlockErr.exchange(CE_None);
+    if (eWriteBehindErr != CE_None && eGlobalErr == CE_None)
+        eGlobalErr = eWriteBehindErr;
+
     return (eGlobalErr);
 }
 
@@ -432,6 +437,9 @@ CPLErr GDALArrayBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
     {
         UpdateDirtyBlockFlushingLog();
 
+        if (SubmitWriteBehind(poBlock))
+            return CE_None;
+
         eErr = poBlock->Write();
     }
 
@@ -21,6 +21,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <new>
@@ -37,6 +41,7 @@
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -114,6 +119,20 @@ class GDALDataset::Private
     std::vector<int>
         m_anBandMap{};  // used by RasterIO(). Values are 1, 2, etc.
 
+    std::once_flag m_oBlockCacheAccountingOnceFlag{};
+    std::shared_ptr<GDALBlockCacheAccounting> m_poBlockCacheAccounting{};
+
+    // PrefetchAsync() requests waiting to be processed. They are processed
+    // one at a time, as the dataset is not assumed to be thread-safe.
+    // Protected by m_oPendingPrefetchMutex, as the following members.
+    std::deque<std::function<void()>> m_aoPrefetchQueue{};
+    // Whether a job is processing m_aoPrefetchQueue
+    bool m_bPrefetchRunning = false;
+    // Number of submitted prefetch jobs that have not completed yet
+    int m_nPendingPrefetch = 0;
+    std::mutex m_oPendingPrefetchMutex{};
+    std::condition_variable m_oPendingPrefetchCV{};
+
     Private() = default;
 };
 
@@ -279,6 +298,8 @@ GDALDataset::GDALDataset(int bForceCachedIOIn)
 GDALDataset::~GDALDataset()
 
 {
+    WaitForPendingPrefetch();
+
     // we don't want to report destruction of datasets that
     // were never really open or meant as internal
     if (!bIsInternal && (nBands != 0 || !EQUAL(GetDescription(), "")))
@@ -551,6 +572,8 @@ void GDALDataset::AddToDatasetOpenList()
 CPLErr GDALDataset::FlushCache(bool bAtClosing)
 
 {
+    WaitForPendingPrefetch();
+
     CPLErr eErr = CE_None;
     // This sometimes happens if a dataset is destroyed before completely
     // built.
@@ -622,6 +645,8 @@ CPLErr CPL_STDCALL GDALFlushCache(GDALDatasetH hDS)
 CPLErr GDALDataset::DropCache()
 
 {
+    WaitForPendingPrefetch();
+
     CPLErr eErr = CE_None;
 
     if (papoBands)
@@ -659,6 +684,178 @@ CPLErr CPL_STDCALL GDALDropCache(GDALDatasetH hDS)
     return GDALDataset::FromHandle(hDS)->DropCache();
 }
 
+/************************************************************************/
+/*                      GetBlockCacheAccounting()                       */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+std::shared_ptr<GDALBlockCacheAccounting>
+GDALDataset::GetBlockCacheAccounting()
+{
+    if (!m_poPrivate)
+        return nullptr;
+    std::call_once(m_poPrivate->m_oBlockCacheAccountingOnceFlag,
+                   [this]()
+                   {
+                       m_poPrivate->m_poBlockCacheAccounting =
+                           std::make_shared<GDALBlockCacheAccounting>();
+                   });
+    return m_poPrivate->m_poBlockCacheAccounting;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                      GetBlockCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Return statistics about the blocks of this dataset in the global
+ * raster block cache.
+ *
+ * Statistics cover all the raster bands whose GetDataset() method returns
+ * this dataset, including their mask bands if any. Counters are cumulative
+ * since the first block of the dataset was cached.
+ *
+ * This method is the same as the C function
+ * GDALDatasetGetBlockCacheStatistics().
+ *
+ * @param[out] pnCachedBytes Pointer to the number of bytes of the blocks of
+ * the dataset currently in the cache, or NULL.
+ * @param[out] pnHits Pointer to the number of block requests served from the
+ * cache, or NULL.
+ * @param[out] pnMisses Pointer to the number of block requests that required
+ * the block to be read (or initialized), or NULL.
+ * @param[out] pnEvictions Pointer to the number of blocks evicted from the
+ * cache to make room for other blocks, or NULL.
+ * @since 3.11
+ */
+
+void GDALDataset::GetBlockCacheStatistics(GIntBig *pnCachedBytes,
+                                          GIntBig *pnHits, GIntBig *pnMisses,
+                                          GIntBig *pnEvictions) const
+{
+    const GDALBlockCacheAccounting *poAccounting =
+        m_poPrivate ? m_poPrivate->m_poBlockCacheAccounting.get() : nullptr;
+    if (pnCachedBytes)
+        *pnCachedBytes = poAccounting ? poAccounting->nCachedBytes.load() : 0;
+    if (pnHits)
+        *pnHits = poAccounting ? poAccounting->nHits.load() : 0;
+    if (pnMisses)
+        *pnMisses = poAccounting ? poAccounting->nMisses.load() : 0;
+    if (pnEvictions)
+        *pnEvictions = poAccounting ? poAccounting->nEvictions.load() : 0;
+}
+
+/************************************************************************/
+/*                 GDALDatasetGetBlockCacheStatistics()                 */
+/************************************************************************/
+
+/**
+ * \brief Return statistics about the blocks of a dataset in the global
+ * raster block cache.
+ *
+ * @see GDALDataset::GetBlockCacheStatistics()
+ * @since 3.11
+ */
+
+void GDALDatasetGetBlockCacheStatistics(GDALDatasetH hDS,
+                                        GIntBig *pnCachedBytes, GIntBig *pnHits,
+                                        GIntBig *pnMisses, GIntBig *pnEvictions)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetGetBlockCacheStatistics");
+
+    GDALDataset::FromHandle(hDS)->GetBlockCacheStatistics(
+        pnCachedBytes, pnHits, pnMisses, pnEvictions);
+}
+
+/************************************************************************/
+/*                        SetBlockCacheQuota()                          */
+/************************************************************************/
+
+/**
+ * \brief Set the maximum amount of memory that the blocks of this dataset
+ * may use in the global raster block cache.
+ *
+ * When a new block of the dataset must be cached and the quota is exceeded,
+ * blocks of this dataset are evicted first, even if the global cache
+ * limit (see GDALSetCacheMax64()) is not reached. As for the global limit,
+ * the quota is not enforced if all blocks of the dataset are locked.
+ * The quota is checked when new blocks are cached, hence lowering it does
+ * not immediately evict blocks.
+ *
+ * This method is the same as the C function GDALDatasetSetBlockCacheQuota().
+ *
+ * @param nMaxBytes Maximum number of bytes, or 0 to remove the quota.
+ * @since 3.11
+ */
+
+void GDALDataset::SetBlockCacheQuota(GIntBig nMaxBytes)
+{
+    auto poAccounting = GetBlockCacheAccounting();
+    if (poAccounting)
+        poAccounting->nQuota = std::max<GIntBig>(0, nMaxBytes);
+}
+
+/************************************************************************/
+/*                   GDALDatasetSetBlockCacheQuota()                    */
+/************************************************************************/
+
+/**
+ * \brief Set the maximum amount of memory that the blocks of a dataset
+ * may use in the global raster block cache.
+ *
+ * @see GDALDataset::SetBlockCacheQuota()
+ * @since 3.11
+ */
+
+void GDALDatasetSetBlockCacheQuota(GDALDatasetH hDS, GIntBig nMaxBytes)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetSetBlockCacheQuota");
+
+    GDALDataset::FromHandle(hDS)->SetBlockCacheQuota(nMaxBytes);
+}
+
+/************************************************************************/
+/*                        GetBlockCacheQuota()                          */
+/************************************************************************/
+
+/**
+ * \brief Return the maximum amount of memory that the blocks of this dataset
+ * may use in the global raster block cache.
+ *
+ * This method is the same as the C function GDALDatasetGetBlockCacheQuota().
+ *
+ * @return the quota in bytes, or 0 if there is none.
+ * @since 3.11
+ */
+
+GIntBig GDALDataset::GetBlockCacheQuota() const
+{
+    const GDALBlockCacheAccounting *poAccounting =
+        m_poPrivate ? m_poPrivate->m_poBlockCacheAccounting.get() : nullptr;
+    return poAccounting ? poAccounting->nQuota.load() : 0;
+}
+
+/************************************************************************/
+/*                   GDALDatasetGetBlockCacheQuota()                    */
+/************************************************************************/
+
+/**
+ * \brief Return the maximum amount of memory that the blocks of a dataset
+ * may use in the global raster block cache.
+ *
+ * @see GDALDataset::GetBlockCacheQuota()
+ * @since 3.11
+ */
+
+GIntBig GDALDatasetGetBlockCacheQuota(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetBlockCacheQuota", 0);
+
+    return GDALDataset::FromHandle(hDS)->GetBlockCacheQuota();
+}
+
 /************************************************************************/
 /*                      GetEstimatedRAMUsage()                          */
 /************************************************************************/
@@ -745,7 +942,16 @@ CPLErr GDALDataset::BlockBasedFlushCache(bool bAtClosing)
             }
         }
     }
-    return CE_None;
+
+    // Wait for the blocks being written by worker threads, and collect
+    // their errors
+    CPLErr eErr = CE_None;
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        if (papoBands[iBand]->FlushCache(bAtClosing) != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
 }
 
 /************************************************************************/
@@ -2742,9 +2948,16 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     else if (CPL_UNLIKELY(psExtraArg->nVersion !=
                           RASTERIO_EXTRA_ARG_CURRENT_VERSION))
     {
-        ReportError(CE_Failure, CPLE_AppDefined,
-                    "Unhandled version of GDALRasterIOExtraArg");
-        return CE_Failure;
+        if (psExtraArg->nVersion != 1)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "Unhandled version of GDALRasterIOExtraArg");
+            return CE_Failure;
+        }
+        // Structure initialized by code built against an older GDAL:
+        // upgrade it to the current version.
+        GDALCopyRasterIOExtraArg(&sExtraArg, psExtraArg);
+        psExtraArg = &sExtraArg;
     }
 
     GDALRasterIOExtraArgSetResampleAlg(psExtraArg, nXSize, nYSize, nBufXSize,
@@ -2820,6 +3033,10 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
 
     int bCallLeaveReadWrite = EnterReadWrite(eRWFlag);
+    const bool bNoCachePromotion =
+        eRWFlag == GF_Read && psExtraArg->bNoCachePromotion;
+    if (bNoCachePromotion)
+        GDALRasterBlock::EnterNoCachePromotion();
 
     /* -------------------------------------------------------------------- */
     /*      We are being forced to use cached IO instead of a driver        */
@@ -2846,6 +3063,8 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                          nBandSpace, psExtraArg);
     }
 
+    if (bNoCachePromotion)
+        GDALRasterBlock::LeaveNoCachePromotion();
     if (bCallLeaveReadWrite)
         LeaveReadWrite();
 
@@ -3118,6 +3337,261 @@ CPLErr CPL_STDCALL GDALDatasetAdviseRead(GDALDatasetH hDS, int nXOff, int nYOff,
         panBandMap, const_cast<char **>(papszOptions));
 }
 
+// Dataset whose prefetch request is being processed by the current thread.
+static thread_local GDALDataset *poCurrentPrefetchDS = nullptr;
+
+/************************************************************************/
+/*                           PrefetchAsync()                            */
+/************************************************************************/
+
+/**
+ * \brief Asynchronously read blocks into the raster block cache.
+ *
+ * The blocks of the specified bands intersecting the specified windows are
+ * read (and decoded) by a thread of the global GDAL thread pool, and
+ * inserted in the raster block cache, so that later RasterIO() requests on
+ * those windows are served from memory. This can for example be used by
+ * interactive applications to read ahead neighbouring tiles.
+ *
+ * Requests on a given dataset are processed sequentially, in a single thread
+ * at a time, but requests on different datasets are processed concurrently.
+ * Unless the dataset is thread-safe (see IsThreadSafe()), the caller must not
+ * access it, or its bands, from another thread before the request has
+ * completed, as signaled by the returned future, the completion callback,
+ * or WaitForPendingPrefetch().
+ *
+ * Pending requests are waited for by FlushCache(), DropCache() and when
+ * the dataset is closed.
+ *
+ * The size of the thread pool is controlled by the GDAL_NUM_THREADS
+ * configuration option, which defaults to ALL_CPUS here. The prefetched
+ * blocks are subject to the limits of the block cache (see
+ * GDALSetCacheMax64()): prefetching more blocks than the cache can hold is
+ * useless.
+ *
+ * This method is the same as the C function GDALDatasetPrefetchAsync().
+ *
+ * @param nWindowCount Number of windows in pasWindows.
+ * @param pasWindows Array of nWindowCount windows, in pixel coordinates
+ * of the full resolution dataset.
+ * @param nBandCount Number of bands to prefetch.
+ * @param panBandList Array of nBandCount band numbers (1-based), or NULL to
+ * select the first nBandCount bands.
+ * @param pfnCompletion Function called, from the worker thread, when the
+ * request has completed, or NULL. It is called before the returned future
+ * becomes ready.
+ * @param pUserData User data passed to pfnCompletion.
+ * @return a future whose value is CE_None if all blocks have been read
+ * successfully. If the request is invalid, an error is emitted, an invalid
+ * future (whose valid() method returns false) is returned and pfnCompletion
+ * is not called.
+ * @since GDAL 3.11
+ */
+
+std::future<CPLErr> GDALDataset::PrefetchAsync(
+    int nWindowCount, const GDALPrefetchWindow *pasWindows, int nBandCount,
+    const int *panBandList, GDALPrefetchCompletionFunc pfnCompletion,
+    void *pUserData)
+{
+    struct PrefetchRequest
+    {
+        std::vector<GDALPrefetchWindow> asWindows{};
+        std::vector<int> anBands{};
+        GDALPrefetchCompletionFunc pfnCompletion = nullptr;
+        void *pUserData = nullptr;
+        std::promise<CPLErr> oPromise{};
+    };
+
+    if (m_poPrivate == nullptr)
+        return std::future<CPLErr>();
+
+    if (nWindowCount <= 0 || pasWindows == nullptr)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "PrefetchAsync(): at least one window must be specified");
+        return std::future<CPLErr>();
+    }
+
+    auto poRequest = std::make_shared<PrefetchRequest>();
+
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALPrefetchWindow &sWindow = pasWindows[i];
+        int bStopProcessing = FALSE;
+        if (ValidateRasterIOOrAdviseReadParameters(
+                "PrefetchAsync()", &bStopProcessing, sWindow.nXOff,
+                sWindow.nYOff, sWindow.nXSize, sWindow.nYSize, sWindow.nXSize,
+                sWindow.nYSize, nBandCount, panBandList) != CE_None)
+        {
+            return std::future<CPLErr>();
+        }
+        if (!bStopProcessing)
+            poRequest->asWindows.push_back(sWindow);
+    }
+
+    for (int i = 0; i < nBandCount; ++i)
+        poRequest->anBands.push_back(panBandList ? panBandList[i] : i + 1);
+    poRequest->pfnCompletion = pfnCompletion;
+    poRequest->pUserData = pUserData;
+    auto oFuture = poRequest->oPromise.get_future();
+
+    const auto ProcessRequest = [this, poRequest]()
+    {
+        CPLErr eErr = CE_None;
+        for (const auto &sWindow : poRequest->asWindows)
+        {
+            // All bands of a dataset generally have the same block size,
+            // but this is not guaranteed.
+            for (int nBand : poRequest->anBands)
+            {
+                GDALRasterBand *poBand = GetRasterBand(nBand);
+                int nBlockXSize = 0;
+                int nBlockYSize = 0;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                const int nXBlockStart = sWindow.nXOff / nBlockXSize;
+                const int nXBlockEnd =
+                    (sWindow.nXOff + sWindow.nXSize - 1) / nBlockXSize;
+                const int nYBlockStart = sWindow.nYOff / nBlockYSize;
+                const int nYBlockEnd =
+                    (sWindow.nYOff + sWindow.nYSize - 1) / nBlockYSize;
+                for (int iY = nYBlockStart; eErr == CE_None && iY <= nYBlockEnd;
+                     ++iY)
+                {
+                    for (int iX = nXBlockStart;
+                         eErr == CE_None && iX <= nXBlockEnd; ++iX)
+                    {
+                        GDALRasterBlock *poBlock =
+                            poBand->GetLockedBlockRef(iX, iY);
+                        if (poBlock)
+                            poBlock->DropLock();
+                        else
+                            eErr = CE_Failure;
+                    }
+                }
+            }
+        }
+
+        if (poRequest->pfnCompletion)
+            poRequest->pfnCompletion(eErr, poRequest->pUserData);
+        poRequest->oPromise.set_value(eErr);
+    };
+
+    {
+        std::lock_guard oLock(m_poPrivate->m_oPendingPrefetchMutex);
+        m_poPrivate->m_aoPrefetchQueue.push_back(ProcessRequest);
+        ++m_poPrivate->m_nPendingPrefetch;
+    }
+
+    // Processes the queued requests of the dataset. If another job is
+    // already doing so, it will process ours too, so return at once rather
+    // than holding a worker of the pool until it has finished.
+    const auto Job = [this]()
+    {
+        std::unique_lock oLock(m_poPrivate->m_oPendingPrefetchMutex);
+        if (!m_poPrivate->m_bPrefetchRunning)
+        {
+            m_poPrivate->m_bPrefetchRunning = true;
+            GDALDataset *const poOldCurrentPrefetchDS = poCurrentPrefetchDS;
+            poCurrentPrefetchDS = this;
+            while (!m_poPrivate->m_aoPrefetchQueue.empty())
+            {
+                auto oProcessRequest =
+                    std::move(m_poPrivate->m_aoPrefetchQueue.front());
+                m_poPrivate->m_aoPrefetchQueue.pop_front();
+                oLock.unlock();
+                oProcessRequest();
+                oLock.lock();
+            }
+            poCurrentPrefetchDS = poOldCurrentPrefetchDS;
+            m_poPrivate->m_bPrefetchRunning = false;
+        }
+
+        // Must be done last, as the dataset may be destroyed as soon as
+        // the mutex is released.
+        --m_poPrivate->m_nPendingPrefetch;
+        m_poPrivate->m_oPendingPrefetchCV.notify_all();
+    };
+
+    const int nThreads = CPLParseNumThreads(
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool || !poThreadPool->SubmitJob(Job))
+    {
+        // Fallback to a synchronous execution
+        Job();
+    }
+
+    return oFuture;
+}
+
+/************************************************************************/
+/*                      GDALDatasetPrefetchAsync()                      */
+/************************************************************************/
+
+/**
+ * \brief Asynchronously read blocks into the raster block cache.
+ *
+ * @see GDALDataset::PrefetchAsync()
+ * @return TRUE if the request has been submitted, FALSE if it is invalid.
+ * @since GDAL 3.11
+ */
+
+int GDALDatasetPrefetchAsync(GDALDatasetH hDS, int nWindowCount,
+                             const GDALPrefetchWindow *pasWindows,
+                             int nBandCount, const int *panBandList,
+                             GDALPrefetchCompletionFunc pfnCompletion,
+                             void *pUserData)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetPrefetchAsync", FALSE);
+
+    return GDALDataset::FromHandle(hDS)
+        ->PrefetchAsync(nWindowCount, pasWindows, nBandCount, panBandList,
+                        pfnCompletion, pUserData)
+        .valid();
+}
+
+/************************************************************************/
+/*                       WaitForPendingPrefetch()                       */
+/************************************************************************/
+
+/**
+ * \brief Wait for the completion of all pending PrefetchAsync() requests.
+ *
+ * This method is the same as the C function
+ * GDALDatasetWaitForPendingPrefetch().
+ *
+ * @since GDAL 3.11
+ */
+
+void GDALDataset::WaitForPendingPrefetch()
+{
+    // Do not dead-lock if called from a prefetch job of this dataset.
+    if (m_poPrivate == nullptr || poCurrentPrefetchDS == this)
+        return;
+
+    std::unique_lock oLock(m_poPrivate->m_oPendingPrefetchMutex);
+    m_poPrivate->m_oPendingPrefetchCV.wait(
+        oLock, [this]() { return m_poPrivate->m_nPendingPrefetch == 0; });
+}
+
+/************************************************************************/
+/*                  GDALDatasetWaitForPendingPrefetch()                 */
+/************************************************************************/
+
+/**
+ * \brief Wait for the completion of all pending prefetch requests.
+ *
+ * @see GDALDataset::WaitForPendingPrefetch()
+ * @since GDAL 3.11
+ */
+
+void GDALDatasetWaitForPendingPrefetch(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetWaitForPendingPrefetch");
+
+    GDALDataset::FromHandle(hDS)->WaitForPendingPrefetch();
+}
+
 /************************************************************************/
 /*                         GDALAntiRecursionStruct                      */
 /************************************************************************/
@@ -3721,7 +4195,11 @@ GDALDatasetH CPL_STDCALL GDALOpenEx(const char *pszFilename,
             : INT_MIN;
 #endif
 
-    const int nDriverCount = poDM->GetDriverCount(/*bIncludeHidden=*/true);
+    // Drivers (including hidden ones) with their GDAL_DMD_OPEN_SIGNATURES,
+    // which allow skipping them without calling Identify().
+    const auto poDispatchTable = poDM->GetOpenDispatchTable();
+    const int nDriverCount = static_cast<int>(poDispatchTable->size());
+    const bool bIdentifyStats = GDALDriverManager::IsIdentifyStatsEnabled();
     GDALDriver *poMissingPluginDriver = nullptr;
     std::vector<GDALDriver *> apoSecondPassDrivers;
 
@@ -3748,9 +4226,8 @@ retry:
                                : static_cast<int>(apoSecondPassDrivers.size()));
          ++iDriver)
     {
-        GDALDriver *poDriver =
-            iPass == 1 ? poDM->GetDriver(iDriver, /*bIncludeHidden=*/true)
-                       : apoSecondPassDrivers[iDriver];
+        GDALDriver *poDriver = iPass == 1 ? (*poDispatchTable)[iDriver].poDriver
+                                          : apoSecondPassDrivers[iDriver];
         if (papszAllowedDrivers != nullptr &&
             CSLFindString(papszAllowedDrivers,
                           GDALGetDriverShortName(poDriver)) == -1)
@@ -3774,6 +4251,15 @@ retry:
             poDriver->GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER) == nullptr)
             continue;
 
+        // Drivers added to apoSecondPassDrivers have already been checked.
+        if (iPass == 1 &&
+            (*poDispatchTable)[iDriver].IsExcludedBySignature(&oOpenInfo))
+        {
+            if (bIdentifyStats)
+                poDM->AddIdentifyStats(poDriver, true, 0);
+            continue;
+        }
+
         // Remove general OVERVIEW_LEVEL open options from list before passing
         // it to the driver, if it isn't a driver specific option already.
         char **papszTmpOpenOptions = nullptr;
@@ -3794,11 +4280,23 @@ retry:
             papszTmpOpenOptionsToValidate = papszOptionsToValidate;
         }
 
+        std::chrono::steady_clock::time_point tIdentifyStart;
+        if (bIdentifyStats)
+            tIdentifyStart = std::chrono::steady_clock::now();
         const int nIdentifyRes =
             poDriver->pfnIdentifyEx
                 ? poDriver->pfnIdentifyEx(poDriver, &oOpenInfo)
             : poDriver->pfnIdentify ? poDriver->pfnIdentify(&oOpenInfo)
                                     : GDAL_IDENTIFY_UNKNOWN;
+        if (bIdentifyStats &&
+            (poDriver->pfnIdentifyEx || poDriver->pfnIdentify))
+        {
+            poDM->AddIdentifyStats(
+                poDriver, false,
+                std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - tIdentifyStart)
+                    .count());
+        }
         if (nIdentifyRes == FALSE)
         {
             CSLDestroy(papszTmpOpenOptions);
@@ -4233,6 +4731,7 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
         if (poDS->Dereference() > 0)
             return CE_None;
 
+        poDS->WaitForPendingPrefetch();
         CPLErr eErr = poDS->Close();
         delete poDS;
 
@@ -4247,6 +4746,7 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
     /* -------------------------------------------------------------------- */
     /*      This is not shared dataset, so directly delete it.              */
     /* -------------------------------------------------------------------- */
+    poDS->WaitForPendingPrefetch();
     CPLErr eErr = poDS->Close();
     delete poDS;
 
@@ -10226,6 +10726,153 @@ CPLErr GDALDatasetReadCompressedData(GDALDatasetH hDS, const char *pszFormat,
         ppBuffer, pnBufferSize, ppszDetailedFormat);
 }
 
+/************************************************************************/
+/*                         WriteCompressedData()                        */
+/************************************************************************/
+
+/** Write already compressed content to the
+ * window of interest and bands, bypassing decompression and recompression.
+ *
+ * This is the write counterpart of ReadCompressedData(): the content passed
+ * must form a valid standalone file (for example a JPEG file, with its
+ * Huffman and quantization tables), such as the one returned by
+ * ReadCompressedData(). Implementations will typically only accept windows
+ * matching exactly a tile of the destination, and data whose characteristics
+ * (bit depth, number of components, etc.) match the ones of the dataset, and
+ * data compressed with the compression method the dataset has been created
+ * with.
+ *
+ * GDALDatasetCopyWholeRaster() uses this method to copy tiles from a source
+ * dataset to a destination one without re-encoding them, when the source
+ * reports compatible formats through GetCompressionFormats().
+ *
+ * If pBuffer is nullptr, the method checks whether it would accept data in
+ * pszFormat for the window of interest, without writing anything, and without
+ * emitting any error.
+ *
+ * The caller must make sure that no pending write, through RasterIO() or
+ * the block cache, targets the same window.
+ *
+ * In the general case this method will return CE_Failure.
+ *
+ * This is the same as C function GDALDatasetWriteCompressedData().
+ *
+ * @param pszFormat Compression format of pBuffer (e.g. "JPEG", "WEBP"),
+ * potentially followed by key=value parameters separated by a semi-colon
+ * character, like the ones returned by ReadCompressedData() in
+ * ppszDetailedFormat. Implementations should return CE_Failure if the
+ * parameters are incompatible with the dataset.
+ *
+ * @param nXOff The pixel offset to the top left corner of the region
+ * of the dataset to be written.
+ *
+ * @param nYOff The line offset to the top left corner of the region
+ * of the dataset to be written.
+ *
+ * @param nXSize The width of the region to be written in pixels.
+ *
+ * @param nYSize The height of the region to be written in lines.
+ *
+ * @param nBandCount the number of bands being written.
+ *
+ * @param panBandList the list of nBandCount band numbers.
+ * Note band numbers are 1 based. This may be NULL to select the first
+ * nBandCount bands.
+ *
+ * @param pBuffer Compressed data, forming a valid standalone file, or nullptr
+ * to only check whether data in pszFormat would be accepted for that window.
+ *
+ * @param nBufferSize Size in bytes of pBuffer.
+ *
+ * @return CE_None in case of success, CE_Failure otherwise.
+ *
+ * @since GDAL 3.11
+ */
+CPLErr GDALDataset::WriteCompressedData(
+    CPL_UNUSED const char *pszFormat, CPL_UNUSED int nXOff,
+    CPL_UNUSED int nYOff, CPL_UNUSED int nXSize, CPL_UNUSED int nYSize,
+    CPL_UNUSED int nBandCount, CPL_UNUSED const int *panBandList,
+    CPL_UNUSED const void *pBuffer, CPL_UNUSED size_t nBufferSize)
+{
+    return CE_Failure;
+}
+
+/************************************************************************/
+/*                  GDALDatasetWriteCompressedData()                    */
+/************************************************************************/
+
+/** Write already compressed content to the
+ * window of interest and bands, bypassing decompression and recompression.
+ *
+ * This is the write counterpart of ReadCompressedData(): the content passed
+ * must form a valid standalone file (for example a JPEG file, with its
+ * Huffman and quantization tables), such as the one returned by
+ * ReadCompressedData(). Implementations will typically only accept windows
+ * matching exactly a tile of the destination, and data whose characteristics
+ * (bit depth, number of components, etc.) match the ones of the dataset, and
+ * data compressed with the compression method the dataset has been created
+ * with.
+ *
+ * GDALDatasetCopyWholeRaster() uses this method to copy tiles from a source
+ * dataset to a destination one without re-encoding them, when the source
+ * reports compatible formats through GetCompressionFormats().
+ *
+ * If pBuffer is nullptr, the method checks whether it would accept data in
+ * pszFormat for the window of interest, without writing anything, and without
+ * emitting any error.
+ *
+ * The caller must make sure that no pending write, through RasterIO() or
+ * the block cache, targets the same window.
+ *
+ * In the general case this method will return CE_Failure.
+ *
+ * This is the same as C++ method GDALDataset::WriteCompressedData().
+ *
+ * @param hDS Dataset handle.
+ *
+ * @param pszFormat Compression format of pBuffer (e.g. "JPEG", "WEBP"),
+ * potentially followed by key=value parameters separated by a semi-colon
+ * character, like the ones returned by ReadCompressedData() in
+ * ppszDetailedFormat. Implementations should return CE_Failure if the
+ * parameters are incompatible with the dataset.
+ *
+ * @param nXOff The pixel offset to the top left corner of the region
+ * of the dataset to be written.
+ *
+ * @param nYOff The line offset to the top left corner of the region
+ * of the dataset to be written.
+ *
+ * @param nXSize The width of the region to be written in pixels.
+ *
+ * @param nYSize The height of the region to be written in lines.
+ *
+ * @param nBandCount the number of bands being written.
+ *
+ * @param panBandList the list of nBandCount band numbers.
+ * Note band numbers are 1 based. This may be NULL to select the first
+ * nBandCount bands.
+ *
+ * @param pBuffer Compressed data, forming a valid standalone file, or nullptr
+ * to only check whether data in pszFormat would be accepted for that window.
+ *
+ * @param nBufferSize Size in bytes of pBuffer.
+ *
+ * @return CE_None in case of success, CE_Failure otherwise.
+ *
+ * @since GDAL 3.11
+ */
+CPLErr GDALDatasetWriteCompressedData(GDALDatasetH hDS, const char *pszFormat,
+                                      int nXOff, int nYOff, int nXSize,
+                                      int nYSize, int nBandCount,
+                                      const int *panBandList,
+                                      const void *pBuffer, size_t nBufferSize)
+{
+    VALIDATE_POINTER1(hDS, __func__, CE_Failure);
+    return GDALDataset::FromHandle(hDS)->WriteCompressedData(
+        pszFormat, nXOff, nYOff, nXSize, nYSize, nBandCount, panBandList,
+        pBuffer, nBufferSize);
+}
+
 /************************************************************************/
 /*                           CanBeCloned()                              */
 /************************************************************************/
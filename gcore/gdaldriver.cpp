@@ -2714,11 +2714,15 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
 
     const int nDriverCount = poDM->GetDriverCount();
 
-    // First pass: only use drivers that have a pfnIdentify implementation.
+    // First pass: only use drivers that have a pfnIdentify implementation,
+    // and whose GDAL_DMD_OPEN_SIGNATURES, if any, match the file.
     std::vector<GDALDriver *> apoSecondPassDrivers;
-    for (int iDriver = 0; iDriver < nDriverCount; ++iDriver)
+    const auto poDispatchTable = poDM->GetOpenDispatchTable();
+    for (const auto &oEntry : *poDispatchTable)
     {
-        GDALDriver *poDriver = poDM->GetDriver(iDriver);
+        if (oEntry.bHidden || oEntry.IsExcludedBySignature(&oOpenInfo))
+            continue;
+        GDALDriver *poDriver = oEntry.poDriver;
         if (papszAllowedDrivers != nullptr &&
             CSLFindString(papszAllowedDrivers,
                           GDALGetDriverShortName(poDriver)) == -1)
@@ -2862,6 +2866,13 @@ CPLErr GDALDriver::SetMetadataItem(const char *pszName, const char *pszValue,
         {
             GDALMajorObject::SetMetadataItem(GDAL_DMD_EXTENSION, pszValue);
         }
+        else if (EQUAL(pszName, GDAL_DMD_OPEN_SIGNATURES))
+        {
+            const CPLErr eErr =
+                GDALMajorObject::SetMetadataItem(pszName, pszValue);
+            GDALDriverManager::InvalidateOpenDispatchTable();
+            return eErr;
+        }
     }
     return GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
 }
@@ -15,6 +15,7 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <map>
 #include <set>
@@ -147,6 +148,24 @@ void GDALDatasetPoolForceDestroy();
 GDALDriverManager::~GDALDriverManager()
 
 {
+    if (!m_oMapIdentifyStats.empty())
+    {
+        std::vector<std::pair<std::string, IdentifyStats>> aoStats(
+            m_oMapIdentifyStats.begin(), m_oMapIdentifyStats.end());
+        std::sort(aoStats.begin(), aoStats.end(),
+                  [](const auto &a, const auto &b)
+                  { return a.second.dfSeconds > b.second.dfSeconds; });
+        CPLDebug("GDAL", "Identify statistics:");
+        for (const auto &[osDriverName, oStats] : aoStats)
+        {
+            CPLDebug("GDAL",
+                     "  %s: " CPL_FRMT_GIB " calls, %.3f ms, " CPL_FRMT_GIB
+                     " skipped by signature",
+                     osDriverName.c_str(), oStats.nCalls,
+                     oStats.dfSeconds * 1e3, oStats.nSkippedBySignature);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Cleanup any open datasets.                                      */
     /* -------------------------------------------------------------------- */
@@ -439,6 +458,149 @@ GDALDriverH CPL_STDCALL GDALGetDriver(int iDriver)
     return /* (GDALDriverH) */ GetGDALDriverManager()->GetDriver(iDriver);
 }
 
+/************************************************************************/
+/*                    IsExcludedBySignature()                           */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Return whether the driver can be skipped without calling its Identify()
+ * method, because it declares GDAL_DMD_OPEN_SIGNATURES and the header of
+ * the file starts with none of them.
+ */
+bool GDALOpenDispatchEntry::IsExcludedBySignature(
+    const GDALOpenInfo *poOpenInfo) const
+{
+    if (aosSignatures.empty() || poOpenInfo->fpL == nullptr ||
+        poOpenInfo->nHeaderBytes <= 0)
+        return false;
+    const size_t nHeaderBytes = static_cast<size_t>(poOpenInfo->nHeaderBytes);
+    for (const auto &osSignature : aosSignatures)
+    {
+        if (osSignature.size() <= nHeaderBytes &&
+            memcmp(poOpenInfo->pabyHeader, osSignature.data(),
+                   osSignature.size()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GetOpenDispatchTable()                          */
+/************************************************************************/
+
+// Incremented each time the dispatch table must be rebuilt
+static std::atomic<int> gnOpenDispatchTableGeneration{0};
+
+/** Return the list of registered drivers, including hidden ones, in their
+ * probing order, with the information used to skip them in GDALOpenEx()
+ * and GDALIdentifyDriverEx().
+ *
+ * The list is rebuilt only when drivers have been (de)registered, reordered,
+ * or when GDAL_DMD_OPEN_SIGNATURES has been set on one of them. Iterating
+ * over it does not require taking the driver manager mutex.
+ */
+std::shared_ptr<const std::vector<GDALOpenDispatchEntry>>
+GDALDriverManager::GetOpenDispatchTable()
+{
+    CPLMutexHolderD(&hDMMutex);
+
+    const int nGeneration = gnOpenDispatchTableGeneration.load();
+    if (m_poOpenDispatchTable && m_nOpenDispatchTableGeneration == nGeneration)
+        return m_poOpenDispatchTable;
+
+    auto poTable = std::make_shared<std::vector<GDALOpenDispatchEntry>>();
+    const int nDriverCount = GetDriverCount(/* bIncludeHidden = */ true);
+    poTable->reserve(nDriverCount);
+    for (int i = 0; i < nDriverCount; ++i)
+    {
+        GDALOpenDispatchEntry oEntry;
+        oEntry.poDriver = GetDriver(i, /* bIncludeHidden = */ true);
+        oEntry.bHidden = i >= nDrivers;
+        const char *pszSignatures =
+            oEntry.poDriver->GetMetadataItem(GDAL_DMD_OPEN_SIGNATURES);
+        if (pszSignatures)
+        {
+            for (const char *pszSignature :
+                 CPLStringList(CSLTokenizeString(pszSignatures)))
+            {
+                int nBytes = 0;
+                GByte *pabyBytes = CPLHexToBinary(pszSignature, &nBytes);
+                if (nBytes > 0)
+                {
+                    oEntry.aosSignatures.emplace_back(
+                        reinterpret_cast<const char *>(pabyBytes), nBytes);
+                }
+                CPLFree(pabyBytes);
+            }
+            // An invalid declaration must not prevent the driver from
+            // being probed.
+            if (oEntry.aosSignatures.empty())
+            {
+                CPLDebug("GDAL", "Ignoring invalid %s=%s for driver %s",
+                         GDAL_DMD_OPEN_SIGNATURES, pszSignatures,
+                         oEntry.poDriver->GetDescription());
+            }
+        }
+        poTable->push_back(std::move(oEntry));
+    }
+
+    m_poOpenDispatchTable = std::move(poTable);
+    m_nOpenDispatchTableGeneration = nGeneration;
+    return m_poOpenDispatchTable;
+}
+
+/************************************************************************/
+/*                   InvalidateOpenDispatchTable()                      */
+/************************************************************************/
+
+/** Force GetOpenDispatchTable() to rebuild its list on its next call. */
+void GDALDriverManager::InvalidateOpenDispatchTable()
+{
+    ++gnOpenDispatchTableGeneration;
+}
+
+/************************************************************************/
+/*                      IsIdentifyStatsEnabled()                        */
+/************************************************************************/
+
+/** Whether GDAL_OPEN_IDENTIFY_STATS=YES is set, in which case GDALOpenEx()
+ * records the time spent in the Identify() method of each driver, which is
+ * printed when the driver manager is destroyed. */
+bool GDALDriverManager::IsIdentifyStatsEnabled()
+{
+    static thread_local CPLConfigOptionCache<bool> oEnabled(
+        "GDAL_OPEN_IDENTIFY_STATS", "NO", CPLTestBool);
+    return oEnabled.Get();
+}
+
+/************************************************************************/
+/*                         AddIdentifyStats()                           */
+/************************************************************************/
+
+/** Record a call to the Identify() method of a driver, or the fact it has
+ * been skipped because of GDAL_DMD_OPEN_SIGNATURES. */
+void GDALDriverManager::AddIdentifyStats(const GDALDriver *poDriver,
+                                         bool bSkippedBySignature,
+                                         double dfSeconds)
+{
+    std::lock_guard oLock(m_oIdentifyStatsMutex);
+    auto &oStats = m_oMapIdentifyStats[poDriver->GetDescription()];
+    if (bSkippedBySignature)
+    {
+        ++oStats.nSkippedBySignature;
+    }
+    else
+    {
+        ++oStats.nCalls;
+        oStats.dfSeconds += dfSeconds;
+    }
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                           RegisterDriver()                           */
 /************************************************************************/
@@ -554,6 +716,7 @@ int GDALDriverManager::RegisterDriver(GDALDriver *poDriver, bool bHidden)
     if (bHidden)
     {
         m_aoHiddenDrivers.push_back(std::unique_ptr<GDALDriver>(poDriver));
+        InvalidateOpenDispatchTable();
         return -1;
     }
 
@@ -566,6 +729,7 @@ int GDALDriverManager::RegisterDriver(GDALDriver *poDriver, bool bHidden)
 
     papoDrivers[nDrivers] = poDriver;
     ++nDrivers;
+    InvalidateOpenDispatchTable();
 
     oMapNameToDrivers[CPLString(poDriver->GetDescription()).toupper()] =
         poDriver;
@@ -631,6 +795,7 @@ void GDALDriverManager::DeregisterDriver(GDALDriver *poDriver)
         papoDrivers[i] = papoDrivers[i + 1];
         ++i;
     }
+    InvalidateOpenDispatchTable();
 }
 
 /************************************************************************/
@@ -1222,6 +1387,7 @@ void GDALDriverManager::ReorderDrivers()
         CPLAssert(oIter != oMapNameToDrivers.end());
         papoDrivers[i] = oIter->second;
     }
+    InvalidateOpenDispatchTable();
 #endif
 }
 
@@ -1286,6 +1452,7 @@ static const char *const apszProxyMetadataItems[] = {
     GDAL_DMD_LONGNAME,
     GDAL_DMD_EXTENSIONS,
     GDAL_DMD_EXTENSION,
+    GDAL_DMD_OPEN_SIGNATURES,
     GDAL_DCAP_RASTER,
     GDAL_DCAP_MULTIDIM_RASTER,
     GDAL_DCAP_VECTOR,
@@ -158,6 +158,9 @@ CPLErr GDALHashSetBandBlockCache::FlushCache()
                 poBlock->GetDirty())
             {
                 UpdateDirtyBlockFlushingLog();
+                poBlock->Detach();
+                if (SubmitWriteBehind(poBlock))
+                    continue;
                 eErr = poBlock->Write();
             }
 
@@ -171,6 +174,11 @@ CPLErr GDALHashSetBandBlockCache::FlushCache()
 
     WaitCompletionPendingTasks();
 
+    // Errors of blocks written by worker threads
+    const CPLErr eWriteBehindErr = poBand->eFlushBlockErr.exchange(CE_None);
+    if (eWriteBehindErr != CE_None && eGlobalErr == CE_None)
+        eGlobalErr = eWriteBehindErr;
+
     return (eGlobalErr);
 }
 
@@ -212,7 +220,12 @@ CPLErr GDALHashSetBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
     CPLErr eErr = CE_None;
 
     if (!m_nWriteDirtyBlocksDisabled && bWriteDirtyBlock && poBlock->GetDirty())
+    {
+        poBlock->Detach();
+        if (SubmitWriteBehind(poBlock))
+            return CE_None;
         eErr = poBlock->Write();
+    }
 
     delete poBlock;
 
@@ -14,6 +14,8 @@
 #include <assert.h>
 #include <algorithm>
 #include <limits>
+#include <mutex>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <utility>
@@ -24,8 +26,10 @@
 
 #include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "cpl_safemaths.hpp"
 #include "memmultidim.h"
@@ -2350,11 +2354,18 @@ std::vector<GUInt64> GDALAbstractMDArray::GetBlockSize() const
  */
 std::vector<size_t>
 GDALAbstractMDArray::GetProcessingChunkSize(size_t nMaxChunkMemory) const
+{
+    return GetProcessingChunkSizeForBlockSize(GetBlockSize(), nMaxChunkMemory);
+}
+
+//! @cond Doxygen_Suppress
+// Same as above, but with the provided block size instead of GetBlockSize()
+std::vector<size_t> GDALAbstractMDArray::GetProcessingChunkSizeForBlockSize(
+    const std::vector<GUInt64> &blockSize, size_t nMaxChunkMemory) const
 {
     const auto &dims = GetDimensions();
     const auto &nDTSize = GetDataType().GetSize();
     std::vector<size_t> anChunkSize;
-    auto blockSize = GetBlockSize();
     CPLAssert(blockSize.size() == dims.size());
     size_t nChunkSize = nDTSize;
     bool bOverflow = false;
@@ -2435,6 +2446,8 @@ GDALAbstractMDArray::GetProcessingChunkSize(size_t nMaxChunkMemory) const
     return anChunkSize;
 }
 
+//! @endcond
+
 /************************************************************************/
 /*                         BaseRename()                                 */
 /************************************************************************/
@@ -3808,6 +3821,16 @@ GDALMDArray::GDALMDArray(CPL_UNUSED const std::string &osParentName,
 {
 }
 
+/************************************************************************/
+/*                          ~GDALMDArray()                              */
+/************************************************************************/
+
+GDALMDArray::~GDALMDArray()
+{
+    if (m_nChunkCacheArrayId)
+        GDALMDArrayChunkCache::ForgetArray(m_nChunkCacheArrayId);
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -3918,6 +3941,11 @@ bool GDALMDArray::CopyFromAllExceptValues(const GDALMDArray *poSrcArray,
 /************************************************************************/
 
 /** Copy the content of an array into a new (generally empty) array.
+ *
+ * Values are copied by chunks aligned on the blocks of both arrays, when
+ * possible. Starting with GDAL 3.11, when the GDAL_NUM_THREADS configuration
+ * option is set to a value greater than 1 or ALL_CPUS, each chunk is written
+ * by a worker thread while the next one is read.
  *
  * @param poSrcDS    Source dataset. Might be nullptr (but for correct behavior
  *                   of some output drivers this is not recommended)
@@ -3977,7 +4005,11 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
         struct CopyFunc
         {
             GDALMDArray *poDstArray = nullptr;
-            std::vector<GByte> abyTmp{};
+            // Two buffers, so that a chunk can be read while the previous
+            // one is written by poJobQueue.
+            std::vector<GByte> abyTmp[2]{};
+            CPLJobQueue *poJobQueue = nullptr;
+            bool bWriteOK = true;
             GDALProgressFunc pfnProgress = nullptr;
             void *pProgressData = nullptr;
             GUInt64 nCurCost = 0;
@@ -3985,27 +4017,17 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             GUInt64 nTotalBytesThisArray = 0;
             bool bStop = false;
 
-            static bool f(GDALAbstractMDArray *l_poSrcArray,
-                          const GUInt64 *chunkArrayStartIdx,
-                          const size_t *chunkCount, GUInt64 iCurChunk,
-                          GUInt64 nChunkCount, void *pUserData)
+            bool WriteChunk(const GDALExtendedDataType &dt,
+                            const GUInt64 *chunkArrayStartIdx,
+                            const size_t *chunkCount, size_t l_nDims,
+                            GByte *pabyBuffer)
             {
-                const auto &dt(l_poSrcArray->GetDataType());
-                auto data = static_cast<CopyFunc *>(pUserData);
-                auto poDstArray = data->poDstArray;
-                if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
-                                        nullptr, dt, &data->abyTmp[0]))
-                {
-                    return false;
-                }
-                bool bRet =
-                    poDstArray->Write(chunkArrayStartIdx, chunkCount, nullptr,
-                                      nullptr, dt, &data->abyTmp[0]);
+                bool bRet = poDstArray->Write(chunkArrayStartIdx, chunkCount,
+                                              nullptr, nullptr, dt, pabyBuffer);
                 if (dt.NeedsFreeDynamicMemory())
                 {
                     const auto l_nDTSize = dt.GetSize();
-                    GByte *ptr = &data->abyTmp[0];
-                    const size_t l_nDims(l_poSrcArray->GetDimensionCount());
+                    GByte *ptr = pabyBuffer;
                     size_t nEltCount = 1;
                     for (size_t i = 0; i < l_nDims; ++i)
                     {
@@ -4017,21 +4039,66 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                         ptr += l_nDTSize;
                     }
                 }
-                if (!bRet)
+                return bRet;
+            }
+
+            bool Progress(GUInt64 iCurChunk, GUInt64 nChunkCount)
+            {
+                double dfCurCost =
+                    double(nCurCost) +
+                    double(iCurChunk) / nChunkCount * nTotalBytesThisArray;
+                if (!pfnProgress(dfCurCost / nTotalCost, "", pProgressData))
                 {
+                    bStop = true;
                     return false;
                 }
+                return true;
+            }
 
-                double dfCurCost =
-                    double(data->nCurCost) + double(iCurChunk) / nChunkCount *
-                                                 data->nTotalBytesThisArray;
-                if (!data->pfnProgress(dfCurCost / data->nTotalCost, "",
-                                       data->pProgressData))
+            static bool f(GDALAbstractMDArray *l_poSrcArray,
+                          const GUInt64 *chunkArrayStartIdx,
+                          const size_t *chunkCount, GUInt64 iCurChunk,
+                          GUInt64 nChunkCount, void *pUserData)
+            {
+                const auto &dt(l_poSrcArray->GetDataType());
+                auto data = static_cast<CopyFunc *>(pUserData);
+                const size_t l_nDims(l_poSrcArray->GetDimensionCount());
+                GByte *pabyBuffer = data->abyTmp[iCurChunk % 2].data();
+                if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
+                                        nullptr, dt, pabyBuffer))
                 {
-                    data->bStop = true;
                     return false;
                 }
 
+                if (!data->poJobQueue)
+                {
+                    return data->WriteChunk(dt, chunkArrayStartIdx, chunkCount,
+                                            l_nDims, pabyBuffer) &&
+                           data->Progress(iCurChunk, nChunkCount);
+                }
+
+                // Wait for the write of the previous chunk, which uses the
+                // other buffer, before submitting the one of this chunk.
+                data->poJobQueue->WaitCompletion();
+                if (!data->bWriteOK ||
+                    (iCurChunk > 1 &&
+                     !data->Progress(iCurChunk - 1, nChunkCount)))
+                {
+                    return false;
+                }
+                std::vector<GUInt64> anStartIdx(chunkArrayStartIdx,
+                                                chunkArrayStartIdx + l_nDims);
+                std::vector<size_t> anCount(chunkCount, chunkCount + l_nDims);
+                data->poJobQueue->SubmitJob(
+                    [data, dt, anStartIdx, anCount, pabyBuffer]()
+                    {
+                        if (!data->WriteChunk(dt, anStartIdx.data(),
+                                              anCount.data(), anCount.size(),
+                                              pabyBuffer))
+                        {
+                            data->bWriteOK = false;
+                        }
+                    });
                 return true;
             }
         };
@@ -4053,15 +4120,68 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                 : static_cast<size_t>(
                       std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
                                GDALGetCacheMax64() / 4));
-        const auto anChunkSizes(GetProcessingChunkSize(nMaxChunkSize));
-        size_t nRealChunkSize = nDTSize;
-        for (const auto &nChunkSize : anChunkSizes)
-        {
-            nRealChunkSize *= nChunkSize;
+
+        // Iterate over chunks aligned on the blocks of both the source and
+        // destination arrays, so that no block is read or written several
+        // times, provided that the least common multiple of their block
+        // sizes fits in memory. Otherwise favor the destination, as partial
+        // writes of compressed blocks are the most expensive.
+        const auto anSrcBlockSize = poSrcArray->GetBlockSize();
+        auto anBlockSize = GetBlockSize();
+        if (anSrcBlockSize.size() == dims.size() &&
+            anBlockSize.size() == dims.size())
+        {
+            std::vector<GUInt64> anCommonBlockSize(dims.size());
+            GUInt64 nCommonBlockBytes = nDTSize;
+            bool bFits = true;
+            for (size_t i = 0; i < dims.size(); ++i)
+            {
+                const GUInt64 nSrc = anSrcBlockSize[i];
+                const GUInt64 nDst = anBlockSize[i];
+                GUInt64 nCommon = nSrc == 0 ? nDst : nDst == 0 ? nSrc : 0;
+                if (nSrc != 0 && nDst != 0)
+                {
+                    constexpr auto kUINT64_MAX =
+                        std::numeric_limits<GUInt64>::max();
+                    const GUInt64 nSrcMul = nSrc / std::gcd(nSrc, nDst);
+                    nCommon = nSrcMul > kUINT64_MAX / nDst ? dims[i]->GetSize()
+                                                           : nSrcMul * nDst;
+                }
+                nCommon = std::min(nCommon, dims[i]->GetSize());
+                anCommonBlockSize[i] = nCommon;
+                if (nCommon > 1 && nCommonBlockBytes > nMaxChunkSize / nCommon)
+                    bFits = false;
+                else
+                    nCommonBlockBytes *= std::max<GUInt64>(1, nCommon);
+            }
+            if (bFits)
+                anBlockSize = std::move(anCommonBlockSize);
         }
+        const auto anChunkSizes(
+            GetProcessingChunkSizeForBlockSize(anBlockSize, nMaxChunkSize));
+        size_t nRealChunkSize = nDTSize;
+        GUInt64 nChunkCount = 1;
+        for (size_t i = 0; i < anChunkSizes.size(); ++i)
+        {
+            nRealChunkSize *= anChunkSizes[i];
+            nChunkCount *= DIV_ROUND_UP(dims[i]->GetSize(), anChunkSizes[i]);
+        }
+
+        // With GDAL_NUM_THREADS, chunks are written by a job of the global
+        // thread pool, while the next one is read by the calling thread.
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreads =
+            EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+        auto poThreadPool = nThreads > 1 && nChunkCount > 1
+                                ? GDALGetGlobalThreadPool(nThreads)
+                                : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+        copyFunc.poJobQueue = poJobQueue.get();
         try
         {
-            copyFunc.abyTmp.resize(nRealChunkSize);
+            copyFunc.abyTmp[0].resize(nRealChunkSize);
+            copyFunc.abyTmp[1].resize(poJobQueue ? nRealChunkSize : 0);
         }
         catch (const std::exception &)
         {
@@ -4070,15 +4190,24 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
         }
-        if (copyFunc.nTotalBytesThisArray != 0 &&
-            !const_cast<GDALMDArray *>(poSrcArray)
-                 ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                                   anChunkSizes.data(), CopyFunc::f,
-                                   &copyFunc) &&
-            (bStrict || copyFunc.bStop))
+        if (copyFunc.nTotalBytesThisArray != 0)
         {
-            nCurCost += copyFunc.nTotalBytesThisArray;
-            return false;
+            bool bRet = const_cast<GDALMDArray *>(poSrcArray)
+                            ->ProcessPerChunk(arrayStartIdx.data(),
+                                              count.data(), anChunkSizes.data(),
+                                              CopyFunc::f, &copyFunc);
+            if (poJobQueue)
+            {
+                poJobQueue->WaitCompletion();
+                if (bRet)
+                    bRet = copyFunc.bWriteOK &&
+                           copyFunc.Progress(nChunkCount, nChunkCount);
+            }
+            if (!bRet && (bStrict || copyFunc.bStop))
+            {
+                nCurCost += copyFunc.nTotalBytesThisArray;
+                return false;
+            }
         }
         nCurCost += copyFunc.nTotalBytesThisArray;
     }
@@ -4495,6 +4624,14 @@ bool GDALMDArray::Read(const GUInt64 *arrayStartIdx, const size_t *count,
         return false;
     }
 
+    if (array == this &&
+        GDALMDArrayChunkCache::IsEligible(this, count, arrayStep))
+    {
+        return GDALMDArrayChunkCache::Read(this, arrayStartIdx, count,
+                                           arrayStep, bufferStride,
+                                           bufferDataType, pDstBuffer);
+    }
+
     return array->IRead(arrayStartIdx, count, arrayStep, bufferStride,
                         bufferDataType, pDstBuffer);
 }
@@ -6672,6 +6809,15 @@ class GDALMDArrayMask final : public GDALPamMDArray
     {
         return m_poParent->GetBlockSize();
     }
+
+    // Whether the mask is only set to 0 for NaN values of the parent
+    bool IsOnlyNaNMasked() const
+    {
+        return !m_bHasMissingValue && !m_bHasFillValue && !m_bHasValidMin &&
+               !m_bHasValidMax && m_anValidFlagValues.empty() &&
+               m_anValidFlagMasks.empty() &&
+               m_poParent->GetRawNoDataValue() == nullptr;
+    }
 };
 
 /************************************************************************/
@@ -9889,6 +10035,10 @@ CPLErr GDALMDArray::GetStatistics(bool bApproxOK, bool bForce, double *pdfMin,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.11, the statistics of the chunks of the array are
+ * computed by several threads when the GDAL_NUM_THREADS configuration option
+ * is set to a value greater than 1 or ALL_CPUS.
+ *
  * This method is the same as the C functions GDALMDArrayComputeStatistics().
  * and GDALMDArrayComputeStatisticsEx().
  *
@@ -9925,6 +10075,137 @@ CPLErr GDALMDArray::GetStatistics(bool bApproxOK, bool bForce, double *pdfMin,
  * @since GDAL 3.2
  */
 
+namespace
+{
+/************************************************************************/
+/*                         GDALMDArrayStats                             */
+/************************************************************************/
+
+// Statistics of a subset of the values of an array
+struct GDALMDArrayStats
+{
+    double dfMin = cpl::NumericLimits<double>::max();
+    double dfMax = -cpl::NumericLimits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUInt64 nValidCount = 0;
+
+    // Merge the statistics of another subset (Chan et al. parallel algorithm)
+    void Merge(const GDALMDArrayStats &other)
+    {
+        if (other.nValidCount == 0)
+            return;
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        const double dfCount = static_cast<double>(nValidCount);
+        const double dfOtherCount = static_cast<double>(other.nValidCount);
+        const double dfNewCount = dfCount + dfOtherCount;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * dfOtherCount / dfNewCount;
+        dfM2 += other.dfM2 + dfDelta * dfDelta * dfCount * dfOtherCount /
+                                 dfNewCount;
+        nValidCount += other.nValidCount;
+    }
+};
+
+/************************************************************************/
+/*                      ComputeStatisticsOnBuffer()                     */
+/************************************************************************/
+
+// Compute the statistics of the values of a buffer in their native type,
+// in two passes (sum, min and max, then sum of squared differences to the
+// mean), which are easily vectorized by compilers. If pabyMask is null,
+// all values but NaN ones are valid.
+template <class T>
+GDALMDArrayStats ComputeStatisticsOnBuffer(const T *paValues,
+                                           const GByte *pabyMask, size_t nVals)
+{
+    GDALMDArrayStats sStats;
+    double dfSum = 0;
+    T tMin = cpl::NumericLimits<T>::max();
+    T tMax = cpl::NumericLimits<T>::lowest();
+    size_t nValidCount = 0;
+    const auto IsValid = [paValues, pabyMask](size_t i)
+    {
+        if (pabyMask)
+            return pabyMask[i] != 0;
+        if constexpr (std::is_floating_point_v<T>)
+            return !std::isnan(paValues[i]);
+        else
+            return true;
+    };
+    for (size_t i = 0; i < nVals; ++i)
+    {
+        if (IsValid(i))
+        {
+            const T tValue = paValues[i];
+            tMin = std::min(tMin, tValue);
+            tMax = std::max(tMax, tValue);
+            dfSum += static_cast<double>(tValue);
+            ++nValidCount;
+        }
+    }
+    if (nValidCount == 0)
+        return sStats;
+
+    const double dfMean = dfSum / static_cast<double>(nValidCount);
+    double dfM2 = 0;
+    for (size_t i = 0; i < nVals; ++i)
+    {
+        if (IsValid(i))
+        {
+            const double dfDelta = static_cast<double>(paValues[i]) - dfMean;
+            dfM2 += dfDelta * dfDelta;
+        }
+    }
+
+    sStats.dfMin = static_cast<double>(tMin);
+    sStats.dfMax = static_cast<double>(tMax);
+    sStats.dfMean = dfMean;
+    sStats.dfM2 = dfM2;
+    sStats.nValidCount = nValidCount;
+    return sStats;
+}
+
+// Dispatch ComputeStatisticsOnBuffer() on the data type of the buffer.
+// adfTmp is used to convert to double the values of data types that have no
+// kernel.
+GDALMDArrayStats ComputeStatisticsOnBuffer(GDALDataType eDT,
+                                           const GByte *pabyValues,
+                                           const GByte *pabyMask, size_t nVals,
+                                           std::vector<double> &adfTmp)
+{
+    switch (eDT)
+    {
+#define CASE(eDT, T)                                                           \
+    case eDT:                                                                  \
+        return ComputeStatisticsOnBuffer(                                      \
+            reinterpret_cast<const T *>(pabyValues), pabyMask, nVals)
+
+        CASE(GDT_Byte, uint8_t);
+        CASE(GDT_Int8, int8_t);
+        CASE(GDT_UInt16, uint16_t);
+        CASE(GDT_Int16, int16_t);
+        CASE(GDT_UInt32, uint32_t);
+        CASE(GDT_Int32, int32_t);
+        CASE(GDT_UInt64, uint64_t);
+        CASE(GDT_Int64, int64_t);
+        CASE(GDT_Float32, float);
+        CASE(GDT_Float64, double);
+#undef CASE
+        default:
+            break;
+    }
+    adfTmp.resize(nVals);
+    GDALCopyWords64(pabyValues, eDT, GDALGetDataTypeSizeBytes(eDT),
+                    adfTmp.data(), GDT_Float64,
+                    static_cast<int>(sizeof(double)),
+                    static_cast<GPtrDiff_t>(nVals));
+    return ComputeStatisticsOnBuffer(adfTmp.data(), pabyMask, nVals);
+}
+
+}  // namespace
+
 bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                                     double *pdfMax, double *pdfMean,
                                     double *pdfStdDev, GUInt64 *pnValidCount,
@@ -9932,22 +10213,34 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                                     void *pProgressData,
                                     CSLConstList papszOptions)
 {
+    // Buffers of a chunk
+    struct ChunkBuffers
+    {
+        std::vector<GByte> abyData{};
+        std::vector<GByte> abyMaskData{};
+        std::vector<double> adfTmp{};
+    };
+
     struct StatsPerChunkType
     {
         const GDALMDArray *array = nullptr;
         std::shared_ptr<GDALMDArray> poMask{};
-        double dfMin = cpl::NumericLimits<double>::max();
-        double dfMax = -cpl::NumericLimits<double>::max();
-        double dfMean = 0.0;
-        double dfM2 = 0.0;
-        GUInt64 nValidCount = 0;
-        std::vector<GByte> abyData{};
-        std::vector<double> adfData{};
-        std::vector<GByte> abyMaskData{};
+        // Whether the mask can be deduced from NaN values, without being read
+        bool bMaskIsNaN = false;
+        // Statistics of each chunk, merged in order at the end, so that the
+        // result does not depend on the scheduling of jobs.
+        std::vector<GDALMDArrayStats> asChunkStats{};
+        CPLJobQueue *poJobQueue = nullptr;
+        int nThreads = 1;
+        std::mutex oMutex{};
+        std::vector<ChunkBuffers> aoFreeBuffers{};
         GDALProgressFunc pfnProgress = nullptr;
         void *pProgressData = nullptr;
     };
 
+    // Chunks are read by the calling thread. With GDAL_NUM_THREADS, their
+    // statistics are computed by jobs of the global thread pool, each job
+    // owning the buffers of its chunk, which are recycled once it is done.
     const auto PerChunkFunc = [](GDALAbstractMDArray *,
                                  const GUInt64 *chunkArrayStartIdx,
                                  const size_t *chunkCount, GUInt64 iCurChunk,
@@ -9961,55 +10254,71 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         for (size_t i = 0; i < nDims; i++)
             nVals *= chunkCount[i];
 
-        // Get mask
-        data->abyMaskData.resize(nVals);
-        if (!(poMask->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
-                           poMask->GetDataType(), &data->abyMaskData[0])))
+        ChunkBuffers oBuffers;
+        if (data->poJobQueue)
         {
-            return false;
+            // Bound the number of chunk buffers.
+            data->poJobQueue->WaitCompletion(data->nThreads);
+            std::lock_guard<std::mutex> oLock(data->oMutex);
+            if (!data->aoFreeBuffers.empty())
+            {
+                oBuffers = std::move(data->aoFreeBuffers.back());
+                data->aoFreeBuffers.pop_back();
+            }
         }
 
-        // Get data
-        const auto &oType = array->GetDataType();
-        if (oType.GetNumericDataType() == GDT_Float64)
+        // Get mask
+        if (!data->bMaskIsNaN)
         {
-            data->adfData.resize(nVals);
-            if (!array->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
-                             oType, &data->adfData[0]))
+            oBuffers.abyMaskData.resize(nVals);
+            if (!(poMask->Read(chunkArrayStartIdx, chunkCount, nullptr,
+                               nullptr, poMask->GetDataType(),
+                               oBuffers.abyMaskData.data())))
             {
                 return false;
             }
         }
-        else
+
+        // Get data
+        const auto &oType = array->GetDataType();
+        oBuffers.abyData.resize(nVals * oType.GetSize());
+        if (!array->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
+                         oType, oBuffers.abyData.data()))
         {
-            data->abyData.resize(nVals * oType.GetSize());
-            if (!array->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
-                             oType, &data->abyData[0]))
-            {
-                return false;
-            }
-            data->adfData.resize(nVals);
-            GDALCopyWords64(&data->abyData[0], oType.GetNumericDataType(),
-                            static_cast<int>(oType.GetSize()),
-                            &data->adfData[0], GDT_Float64,
-                            static_cast<int>(sizeof(double)),
-                            static_cast<GPtrDiff_t>(nVals));
+            return false;
         }
-        for (size_t i = 0; i < nVals; i++)
+
+        const auto eDT = oType.GetNumericDataType();
+        // iCurChunk is in [1, nChunkCount] range
+        if (iCurChunk == 0 || iCurChunk > data->asChunkStats.size())
+            return false;
+        auto &sChunkStats = data->asChunkStats[iCurChunk - 1];
+        if (data->poJobQueue)
         {
-            if (data->abyMaskData[i])
-            {
-                const double dfValue = data->adfData[i];
-                data->dfMin = std::min(data->dfMin, dfValue);
-                data->dfMax = std::max(data->dfMax, dfValue);
-                data->nValidCount++;
-                const double dfDelta = dfValue - data->dfMean;
-                data->dfMean += dfDelta / data->nValidCount;
-                data->dfM2 += dfDelta * (dfValue - data->dfMean);
-            }
+            auto poBuffers =
+                std::make_shared<ChunkBuffers>(std::move(oBuffers));
+            data->poJobQueue->SubmitJob(
+                [data, eDT, nVals, poBuffers, &sChunkStats]()
+                {
+                    sChunkStats = ComputeStatisticsOnBuffer(
+                        eDT, poBuffers->abyData.data(),
+                        data->bMaskIsNaN ? nullptr
+                                         : poBuffers->abyMaskData.data(),
+                        nVals, poBuffers->adfTmp);
+                    std::lock_guard<std::mutex> oLock(data->oMutex);
+                    data->aoFreeBuffers.push_back(std::move(*poBuffers));
+                });
         }
+        else
+        {
+            sChunkStats = ComputeStatisticsOnBuffer(
+                eDT, oBuffers.abyData.data(),
+                data->bMaskIsNaN ? nullptr : oBuffers.abyMaskData.data(), nVals,
+                oBuffers.adfTmp);
+        }
+
         if (data->pfnProgress &&
-            !data->pfnProgress(static_cast<double>(iCurChunk + 1) / nChunkCount,
+            !data->pfnProgress(static_cast<double>(iCurChunk) / nChunkCount,
                                "", data->pProgressData))
         {
             return false;
@@ -10051,34 +10360,71 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
     {
         return false;
     }
+    const auto poMask =
+        std::dynamic_pointer_cast<GDALMDArrayMask>(sData.poMask);
+    sData.bMaskIsNaN = poMask && poMask->IsOnlyNaNMasked();
     sData.pfnProgress = pfnProgress;
     sData.pProgressData = pProgressData;
-    if (!ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                         GetProcessingChunkSize(nMaxChunkSize).data(),
-                         PerChunkFunc, &sData))
+
+    const auto anChunkSizes = GetProcessingChunkSize(nMaxChunkSize);
+    GUInt64 nChunkCount = 1;
+    for (size_t i = 0; i < nDims; i++)
+    {
+        nChunkCount *= DIV_ROUND_UP(count[i], anChunkSizes[i]);
+    }
+    try
     {
+        sData.asChunkStats.resize(static_cast<size_t>(nChunkCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in ComputeStatistics()");
         return false;
     }
 
+    sData.nThreads = static_cast<int>(std::min<GUInt64>(
+        nChunkCount,
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128)));
+    auto poThreadPool =
+        sData.nThreads > 1 ? GDALGetGlobalThreadPool(sData.nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    sData.poJobQueue = poJobQueue.get();
+
+    const bool bRet =
+        ProcessPerChunk(arrayStartIdx.data(), count.data(),
+                        anChunkSizes.data(), PerChunkFunc, &sData);
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+    if (!bRet)
+    {
+        return false;
+    }
+
+    GDALMDArrayStats sStats;
+    for (const auto &sChunkStats : sData.asChunkStats)
+        sStats.Merge(sChunkStats);
+
     if (pdfMin)
-        *pdfMin = sData.dfMin;
+        *pdfMin = sStats.dfMin;
 
     if (pdfMax)
-        *pdfMax = sData.dfMax;
+        *pdfMax = sStats.dfMax;
 
     if (pdfMean)
-        *pdfMean = sData.dfMean;
+        *pdfMean = sStats.dfMean;
 
     const double dfStdDev =
-        sData.nValidCount > 0 ? sqrt(sData.dfM2 / sData.nValidCount) : 0.0;
+        sStats.nValidCount > 0 ? sqrt(sStats.dfM2 / sStats.nValidCount) : 0.0;
     if (pdfStdDev)
         *pdfStdDev = dfStdDev;
 
     if (pnValidCount)
-        *pnValidCount = sData.nValidCount;
+        *pnValidCount = sStats.nValidCount;
 
-    SetStatistics(bApproxOK, sData.dfMin, sData.dfMax, sData.dfMean, dfStdDev,
-                  sData.nValidCount, papszOptions);
+    SetStatistics(bApproxOK, sStats.dfMin, sStats.dfMax, sStats.dfMean,
+                  dfStdDev, sStats.nValidCount, papszOptions);
 
     return true;
 }
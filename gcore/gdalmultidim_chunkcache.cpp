@@ -0,0 +1,631 @@
+/******************************************************************************
+ * Name:     gdalmultidim_chunkcache.cpp
+ * Project:  GDAL Core
+ * Purpose:  Process-wide cache of chunks of multidimensional arrays
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "gdalmultidim_priv.h"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+/************************************************************************/
+/*                               Chunk                                  */
+/************************************************************************/
+
+// Content of a chunk, in the data type of the array, in row-major order.
+// Chunks at the right edges of an array may be smaller than the block size.
+struct Chunk
+{
+    std::vector<size_t> anCount{};
+    std::vector<GByte> abyData{};
+};
+
+/************************************************************************/
+/*                              ArrayState                              */
+/************************************************************************/
+
+struct ArrayState
+{
+    bool bEligible = false;
+    std::vector<GUInt64> anBlockSize{};
+    size_t nChunkBytes = 0;
+
+    // Access pattern tracking, for prefetching
+    std::vector<uint64_t> anLastMissedChunk{};
+    int nPrefetchChunks = 0;
+};
+
+/************************************************************************/
+/*                              ChunkCache                              */
+/************************************************************************/
+
+class ChunkCache
+{
+  public:
+    using Key = std::pair<uint64_t, std::vector<uint64_t>>;
+
+    std::mutex m_oMutex{};
+    uint64_t m_nLastArrayId = 0;
+    std::map<uint64_t, ArrayState> m_oMapArrayState{};
+
+    std::shared_ptr<const Chunk> Get(const Key &oKey);
+    bool Contains(const Key &oKey) const;
+    void Insert(const Key &oKey, std::shared_ptr<const Chunk> &&poChunk);
+    void ForgetArray(uint64_t nArrayId);
+    size_t GetMaxBytes();
+
+  private:
+    using Entry = std::pair<Key, std::shared_ptr<const Chunk>>;
+    std::list<Entry> m_oLRU{};  // most recently used first
+    std::map<Key, std::list<Entry>::iterator> m_oMap{};
+    size_t m_nBytes = 0;
+    size_t m_nMaxBytes = 0;
+
+    void Evict(size_t nMaxBytes);
+};
+
+ChunkCache &GetChunkCache()
+{
+    static ChunkCache oCache;
+    return oCache;
+}
+
+/************************************************************************/
+/*                       ChunkCache::GetMaxBytes()                      */
+/************************************************************************/
+
+// Must be called with m_oMutex held
+size_t ChunkCache::GetMaxBytes()
+{
+    if (m_nMaxBytes == 0)
+    {
+        // By default, half of the GDAL block cache size
+        const char *pszSize =
+            CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE_SIZE", nullptr);
+        const GIntBig nMaxBytes =
+            pszSize ? CPLAtoGIntBig(pszSize) : GDALGetCacheMax64() / 2;
+        m_nMaxBytes = static_cast<size_t>(std::min<GIntBig>(
+            std::max<GIntBig>(nMaxBytes, 1),
+            static_cast<GIntBig>(std::numeric_limits<size_t>::max() / 2)));
+    }
+    return m_nMaxBytes;
+}
+
+/************************************************************************/
+/*                          ChunkCache::Get()                           */
+/************************************************************************/
+
+// Must be called with m_oMutex held
+std::shared_ptr<const Chunk> ChunkCache::Get(const Key &oKey)
+{
+    const auto oIter = m_oMap.find(oKey);
+    if (oIter == m_oMap.end())
+        return nullptr;
+    m_oLRU.splice(m_oLRU.begin(), m_oLRU, oIter->second);
+    return oIter->second->second;
+}
+
+/************************************************************************/
+/*                        ChunkCache::Contains()                        */
+/************************************************************************/
+
+// Must be called with m_oMutex held
+bool ChunkCache::Contains(const Key &oKey) const
+{
+    return m_oMap.find(oKey) != m_oMap.end();
+}
+
+/************************************************************************/
+/*                         ChunkCache::Insert()                         */
+/************************************************************************/
+
+// Must be called with m_oMutex held
+void ChunkCache::Insert(const Key &oKey,
+                        std::shared_ptr<const Chunk> &&poChunk)
+{
+    const auto oIter = m_oMap.find(oKey);
+    if (oIter != m_oMap.end())
+    {
+        m_nBytes -= oIter->second->second->abyData.size();
+        m_oLRU.erase(oIter->second);
+        m_oMap.erase(oIter);
+    }
+    const size_t nChunkBytes = poChunk->abyData.size();
+    Evict(GetMaxBytes() - std::min(GetMaxBytes(), nChunkBytes));
+    m_oLRU.emplace_front(oKey, std::move(poChunk));
+    m_oMap[oKey] = m_oLRU.begin();
+    m_nBytes += nChunkBytes;
+}
+
+/************************************************************************/
+/*                          ChunkCache::Evict()                         */
+/************************************************************************/
+
+void ChunkCache::Evict(size_t nMaxBytes)
+{
+    while (m_nBytes > nMaxBytes && !m_oLRU.empty())
+    {
+        const auto &oEntry = m_oLRU.back();
+        m_nBytes -= oEntry.second->abyData.size();
+        m_oMap.erase(oEntry.first);
+        m_oLRU.pop_back();
+    }
+}
+
+/************************************************************************/
+/*                       ChunkCache::ForgetArray()                      */
+/************************************************************************/
+
+// Must be called with m_oMutex held
+void ChunkCache::ForgetArray(uint64_t nArrayId)
+{
+    m_oMapArrayState.erase(nArrayId);
+    auto oIter = m_oMap.lower_bound(Key(nArrayId, {}));
+    while (oIter != m_oMap.end() && oIter->first.first == nArrayId)
+    {
+        m_nBytes -= oIter->second->second->abyData.size();
+        m_oLRU.erase(oIter->second);
+        oIter = m_oMap.erase(oIter);
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                 GDALMDArrayChunkCache::IsEligible()                  */
+/************************************************************************/
+
+/** Return whether a read request on poArray should go through the chunk
+ * cache.
+ *
+ * This is the case for read-only arrays whose driver opted in with
+ * IsChunkCacheable(), that have a numeric data type and a chunked layout with
+ * chunks small enough compared to the cache size, for requests with
+ * non-negative steps. The cache can be disabled by setting the
+ * GDAL_MDARRAY_CHUNK_CACHE configuration option to NO.
+ */
+bool GDALMDArrayChunkCache::IsEligible(const GDALMDArray *poArray,
+                                       const size_t *count,
+                                       const GInt64 *arrayStep)
+{
+    if (!poArray->IsChunkCacheable() || poArray->IsWritable() ||
+        poArray->GetDataType().GetClass() != GEDTC_NUMERIC ||
+        !CPLTestBool(CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE", "YES")))
+    {
+        return false;
+    }
+
+    const size_t nDims = poArray->GetDimensionCount();
+    if (nDims == 0)
+        return false;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        if (count[i] > 1 && arrayStep[i] <= 0)
+            return false;
+    }
+
+    auto &oCache = GetChunkCache();
+    std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+    if (poArray->m_nChunkCacheArrayId == 0)
+    {
+        poArray->m_nChunkCacheArrayId = ++oCache.m_nLastArrayId;
+
+        ArrayState oState;
+        oState.anBlockSize = poArray->GetBlockSize();
+        oState.bEligible = oState.anBlockSize.size() == nDims;
+        uint64_t nChunkBytes = poArray->GetDataType().GetSize();
+        for (size_t i = 0; oState.bEligible && i < nDims; ++i)
+        {
+            const auto nBlockSize = oState.anBlockSize[i];
+            oState.bEligible =
+                nBlockSize > 0 &&
+                nChunkBytes <= std::numeric_limits<uint64_t>::max() /
+                                   std::max<uint64_t>(1, nBlockSize);
+            if (oState.bEligible)
+                nChunkBytes *= nBlockSize;
+        }
+        // Chunks that are too large compared to the cache size would
+        // evict everything else, and be read for no benefit.
+        oState.bEligible =
+            oState.bEligible && nChunkBytes <= oCache.GetMaxBytes() / 8;
+        if (oState.bEligible)
+        {
+            oState.nChunkBytes = static_cast<size_t>(nChunkBytes);
+            CPLDebugOnly("GDAL", "Chunk cache enabled for %s",
+                         poArray->GetFullName().c_str());
+        }
+        oCache.m_oMapArrayState[poArray->m_nChunkCacheArrayId] =
+            std::move(oState);
+    }
+    return oCache.m_oMapArrayState[poArray->m_nChunkCacheArrayId].bEligible;
+}
+
+/************************************************************************/
+/*                     GDALMDArrayChunkCache::Read()                    */
+/************************************************************************/
+
+/** Serve a read request from the chunk cache, reading the missing chunks
+ * with poArray->IRead().
+ *
+ * When consecutive cache misses follow one axis (for example when extracting
+ * a time series), the following chunks along that axis are prefetched with
+ * the same IRead() call, with a number of chunks that doubles at each
+ * sequential miss, up to GDAL_MDARRAY_CHUNK_CACHE_PREFETCH (default 8).
+ *
+ * Must only be called if IsEligible() returned true. arrayStep and
+ * bufferStride must be fully specified.
+ */
+bool GDALMDArrayChunkCache::Read(const GDALMDArray *poArray,
+                                 const GUInt64 *arrayStartIdx,
+                                 const size_t *count, const GInt64 *arrayStep,
+                                 const GPtrDiff_t *bufferStride,
+                                 const GDALExtendedDataType &bufferDataType,
+                                 void *pDstBuffer)
+{
+    auto &oCache = GetChunkCache();
+    const uint64_t nArrayId = poArray->m_nChunkCacheArrayId;
+    std::vector<GUInt64> anBlockSize;
+    {
+        std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+        anBlockSize = oCache.m_oMapArrayState[nArrayId].anBlockSize;
+    }
+
+    const auto &apoDims = poArray->GetDimensions();
+    const size_t nDims = apoDims.size();
+    const auto &oType = poArray->GetDataType();
+    const size_t nDTSize = oType.GetSize();
+    const size_t nBufferDTSize = bufferDataType.GetSize();
+
+    // Step of 1 for dimensions where only one element is requested, to
+    // simplify below computations
+    std::vector<GInt64> anStep(nDims);
+    std::vector<uint64_t> anFirstChunk(nDims);
+    std::vector<uint64_t> anLastChunk(nDims);
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        anStep[i] = count[i] > 1 ? arrayStep[i] : 1;
+        anFirstChunk[i] = arrayStartIdx[i] / anBlockSize[i];
+        anLastChunk[i] =
+            (arrayStartIdx[i] + (count[i] - 1) * anStep[i]) / anBlockSize[i];
+    }
+
+    const int nMaxPrefetch = std::max(
+        0, atoi(CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE_PREFETCH", "8")));
+
+    // Read the chunk at anChunkIdx, and possibly next ones along one axis,
+    // and insert them in the cache.
+    const auto LoadChunks =
+        [poArray, &oCache, nArrayId, nDims, nDTSize, &oType, &apoDims,
+         &anBlockSize, &anLastChunk,
+         nMaxPrefetch](const std::vector<uint64_t> &anChunkIdx)
+        -> std::shared_ptr<const Chunk>
+    {
+        // Detect sequential misses along one axis
+        int iPrefetchAxis = -1;
+        int nPrefetch = 0;
+        {
+            std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+            auto &oState = oCache.m_oMapArrayState[nArrayId];
+            if (oState.anLastMissedChunk.size() == nDims)
+            {
+                int nDiffAxis = -1;
+                for (size_t i = 0; i < nDims; ++i)
+                {
+                    if (anChunkIdx[i] == oState.anLastMissedChunk[i])
+                        continue;
+                    if (nDiffAxis < 0 &&
+                        anChunkIdx[i] == oState.anLastMissedChunk[i] + 1)
+                    {
+                        nDiffAxis = static_cast<int>(i);
+                    }
+                    else
+                    {
+                        nDiffAxis = -1;
+                        break;
+                    }
+                }
+                iPrefetchAxis = nDiffAxis;
+            }
+            if (iPrefetchAxis >= 0)
+            {
+                oState.nPrefetchChunks = std::min(
+                    nMaxPrefetch, std::max(1, 2 * oState.nPrefetchChunks));
+                nPrefetch = oState.nPrefetchChunks;
+            }
+            else
+            {
+                oState.nPrefetchChunks = 0;
+            }
+
+            // Do not prefetch past the array, nor already cached chunks.
+            if (nPrefetch > 0)
+            {
+                const size_t iAxis = static_cast<size_t>(iPrefetchAxis);
+                const uint64_t nChunksInDim =
+                    (apoDims[iAxis]->GetSize() + anBlockSize[iAxis] - 1) /
+                    anBlockSize[iAxis];
+                nPrefetch = static_cast<int>(std::min<uint64_t>(
+                    nPrefetch, nChunksInDim - 1 - anChunkIdx[iAxis]));
+                ChunkCache::Key oKey(nArrayId, anChunkIdx);
+                for (int j = 1; j <= nPrefetch; ++j)
+                {
+                    ++oKey.second[iAxis];
+                    if (oCache.Contains(oKey))
+                    {
+                        nPrefetch = j - 1;
+                        break;
+                    }
+                }
+            }
+            // Prefetching beyond the request is not useful if the access
+            // pattern does not continue further.
+            if (nPrefetch > 0 &&
+                anChunkIdx[iPrefetchAxis] + nPrefetch >
+                    anLastChunk[iPrefetchAxis] &&
+                anChunkIdx[iPrefetchAxis] < anLastChunk[iPrefetchAxis])
+            {
+                nPrefetch = static_cast<int>(anLastChunk[iPrefetchAxis] -
+                                             anChunkIdx[iPrefetchAxis]);
+            }
+
+            oState.anLastMissedChunk = anChunkIdx;
+            if (nPrefetch > 0)
+                oState.anLastMissedChunk[iPrefetchAxis] += nPrefetch;
+        }
+
+        // Region to read
+        std::vector<GUInt64> anStartIdx(nDims);
+        std::vector<size_t> anCount(nDims);
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            anStartIdx[i] = anChunkIdx[i] * anBlockSize[i];
+            const GUInt64 nEnd = std::min<GUInt64>(
+                apoDims[i]->GetSize(),
+                (anChunkIdx[i] + 1 +
+                 (static_cast<int>(i) == iPrefetchAxis ? nPrefetch : 0)) *
+                    anBlockSize[i]);
+            anCount[i] = static_cast<size_t>(nEnd - anStartIdx[i]);
+        }
+
+        size_t nElts = 1;
+        for (size_t i = 0; i < nDims; ++i)
+            nElts *= anCount[i];
+        std::vector<GByte> abyRegion;
+        try
+        {
+            abyRegion.resize(nElts * nDTSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for chunk cache");
+            return nullptr;
+        }
+        std::vector<GInt64> anArrayStep(nDims, 1);
+        std::vector<GPtrDiff_t> anBufferStride(nDims);
+        {
+            GPtrDiff_t nStride = 1;
+            for (size_t i = nDims; i > 0;)
+            {
+                --i;
+                anBufferStride[i] = nStride;
+                nStride *= static_cast<GPtrDiff_t>(anCount[i]);
+            }
+        }
+        if (!poArray->IRead(anStartIdx.data(), anCount.data(),
+                            anArrayStep.data(), anBufferStride.data(), oType,
+                            abyRegion.data()))
+        {
+            return nullptr;
+        }
+
+        // Split the region into chunks
+        std::shared_ptr<const Chunk> poRet;
+        const int nChunks = 1 + nPrefetch;
+        for (int j = 0; j < nChunks; ++j)
+        {
+            auto poChunk = std::make_shared<Chunk>();
+            poChunk->anCount = anCount;
+            std::vector<uint64_t> anThisChunkIdx(anChunkIdx);
+            size_t nOffsetInAxis = 0;
+            if (nPrefetch > 0)
+            {
+                const size_t iAxis = static_cast<size_t>(iPrefetchAxis);
+                anThisChunkIdx[iAxis] += j;
+                nOffsetInAxis = static_cast<size_t>(j * anBlockSize[iAxis]);
+                poChunk->anCount[iAxis] = std::min(
+                    static_cast<size_t>(anBlockSize[iAxis]),
+                    anCount[iAxis] - nOffsetInAxis);
+            }
+
+            if (nChunks == 1)
+            {
+                poChunk->abyData = std::move(abyRegion);
+            }
+            else
+            {
+                // Copy the rows of the chunk, that is the contiguous runs
+                // along the last dimension.
+                size_t nChunkElts = 1;
+                for (size_t i = 0; i < nDims; ++i)
+                    nChunkElts *= poChunk->anCount[i];
+                poChunk->abyData.resize(nChunkElts * nDTSize);
+                const size_t nRowElts = poChunk->anCount[nDims - 1];
+                const size_t nRows = nChunkElts / nRowElts;
+                std::vector<size_t> anRowIdx(nDims, 0);
+                for (size_t iRow = 0; iRow < nRows; ++iRow)
+                {
+                    size_t nSrcOffset = 0;
+                    for (size_t i = 0; i < nDims; ++i)
+                    {
+                        size_t nIdx = anRowIdx[i];
+                        if (static_cast<int>(i) == iPrefetchAxis)
+                            nIdx += nOffsetInAxis;
+                        nSrcOffset += nIdx * anBufferStride[i];
+                    }
+                    memcpy(poChunk->abyData.data() + iRow * nRowElts * nDTSize,
+                           abyRegion.data() + nSrcOffset * nDTSize,
+                           nRowElts * nDTSize);
+                    // Increment row index, last dimension excluded
+                    for (size_t i = nDims - 1; i > 0;)
+                    {
+                        --i;
+                        if (++anRowIdx[i] < poChunk->anCount[i])
+                            break;
+                        anRowIdx[i] = 0;
+                    }
+                }
+            }
+
+            std::shared_ptr<const Chunk> poConstChunk(std::move(poChunk));
+            if (j == 0)
+                poRet = poConstChunk;
+            std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+            oCache.Insert(ChunkCache::Key(nArrayId, anThisChunkIdx),
+                          std::move(poConstChunk));
+        }
+        return poRet;
+    };
+
+    // Iterate over the chunks intersecting the request
+    std::vector<uint64_t> anChunkIdx(anFirstChunk);
+    std::vector<size_t> anFirstInChunk(nDims);  // in request coordinates
+    std::vector<size_t> anCountInChunk(nDims);
+    std::vector<size_t> anIdx(nDims);
+    while (true)
+    {
+        // Compute the part of the request that lies in this chunk
+        bool bIntersects = true;
+        for (size_t i = 0; bIntersects && i < nDims; ++i)
+        {
+            const GUInt64 nChunkStart = anChunkIdx[i] * anBlockSize[i];
+            const GUInt64 nChunkEnd = nChunkStart + anBlockSize[i];
+            const GUInt64 nStep = static_cast<GUInt64>(anStep[i]);
+            const GUInt64 nFirst =
+                nChunkStart <= arrayStartIdx[i]
+                    ? 0
+                    : (nChunkStart - arrayStartIdx[i] + nStep - 1) / nStep;
+            const GUInt64 nLast = std::min<GUInt64>(
+                count[i] - 1, (nChunkEnd - 1 - arrayStartIdx[i]) / nStep);
+            bIntersects = nFirst <= nLast;
+            anFirstInChunk[i] = static_cast<size_t>(nFirst);
+            anCountInChunk[i] = static_cast<size_t>(nLast - nFirst + 1);
+        }
+
+        if (bIntersects)
+        {
+            std::shared_ptr<const Chunk> poChunk;
+            {
+                std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+                poChunk = oCache.Get(ChunkCache::Key(nArrayId, anChunkIdx));
+            }
+            if (!poChunk)
+            {
+                poChunk = LoadChunks(anChunkIdx);
+                if (!poChunk)
+                    return false;
+            }
+
+            // Strides of the chunk, in elements
+            std::vector<size_t> anChunkStride(nDims);
+            {
+                size_t nStride = 1;
+                for (size_t i = nDims; i > 0;)
+                {
+                    --i;
+                    anChunkStride[i] = nStride;
+                    nStride *= poChunk->anCount[i];
+                }
+            }
+
+            // Copy the selected elements, with one CopyValues() call per
+            // run along the last dimension.
+            const size_t iLast = nDims - 1;
+            std::fill(anIdx.begin(), anIdx.end(), 0);
+            bool bDone = false;
+            while (!bDone)
+            {
+                size_t nSrcOffset = 0;
+                GPtrDiff_t nDstOffset = 0;
+                for (size_t i = 0; i < nDims; ++i)
+                {
+                    const GUInt64 nReqIdx = anFirstInChunk[i] + anIdx[i];
+                    const GUInt64 nArrayIdx =
+                        arrayStartIdx[i] + nReqIdx * anStep[i];
+                    nSrcOffset += static_cast<size_t>(
+                                      nArrayIdx -
+                                      anChunkIdx[i] * anBlockSize[i]) *
+                                  anChunkStride[i];
+                    nDstOffset +=
+                        static_cast<GPtrDiff_t>(nReqIdx) * bufferStride[i];
+                }
+                if (!GDALExtendedDataType::CopyValues(
+                        poChunk->abyData.data() + nSrcOffset * nDTSize, oType,
+                        static_cast<GPtrDiff_t>(anStep[iLast] *
+                                                anChunkStride[iLast]),
+                        static_cast<GByte *>(pDstBuffer) +
+                            nDstOffset *
+                                static_cast<GPtrDiff_t>(nBufferDTSize),
+                        bufferDataType, bufferStride[iLast],
+                        anCountInChunk[iLast]))
+                {
+                    return false;
+                }
+
+                bDone = true;
+                for (size_t i = iLast; i > 0;)
+                {
+                    --i;
+                    if (++anIdx[i] < anCountInChunk[i])
+                    {
+                        bDone = false;
+                        break;
+                    }
+                    anIdx[i] = 0;
+                }
+            }
+        }
+
+        // Next chunk, last dimension varying fastest
+        size_t i = nDims;
+        while (i > 0)
+        {
+            --i;
+            if (++anChunkIdx[i] <= anLastChunk[i])
+                break;
+            anChunkIdx[i] = anFirstChunk[i];
+            if (i == 0)
+                return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                 GDALMDArrayChunkCache::ForgetArray()                 */
+/************************************************************************/
+
+/** Evict the chunks of an array that is being destroyed. */
+void GDALMDArrayChunkCache::ForgetArray(uint64_t nArrayId)
+{
+    auto &oCache = GetChunkCache();
+    std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+    oCache.ForgetArray(nArrayId);
+}
+
+//! @endcond
@@ -78,6 +78,27 @@ struct GDALDimensionHS
     }
 };
 
+/************************************************************************/
+/*                        GDALMDArrayChunkCache                         */
+/************************************************************************/
+
+// Process-wide cache of chunks of arrays, bounded in memory, used by
+// GDALMDArray::Read() for arrays whose IsChunkCacheable() returns true.
+class GDALMDArrayChunkCache
+{
+  public:
+    static bool IsEligible(const GDALMDArray *poArray, const size_t *count,
+                           const GInt64 *arrayStep);
+
+    static bool Read(const GDALMDArray *poArray, const GUInt64 *arrayStartIdx,
+                     const size_t *count, const GInt64 *arrayStep,
+                     const GPtrDiff_t *bufferStride,
+                     const GDALExtendedDataType &bufferDataType,
+                     void *pDstBuffer);
+
+    static void ForgetArray(uint64_t nArrayId);
+};
+
 //! @endcond
 
 #endif  // GDALMULTIDIM_PRIV_INCLUDED
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -209,6 +210,24 @@ bool GDALNoDataMaskBand::IsNoDataInRange(double dfNoDataValue,
     }
 }
 
+/************************************************************************/
+/*                            CountNonZero()                            */
+/************************************************************************/
+
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static int
+CountNonZero(const GByte *pabyData, int nCount)
+{
+    int nNonZero = 0;
+    for (int i = 0; i < nCount; ++i)
+    {
+        nNonZero += (pabyData[i] != 0);
+    }
+    return nNonZero;
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -234,6 +253,171 @@ CPLErr GDALNoDataMaskBand::IReadBlock(int nXBlockOff, int nYBlockOff,
                      nBlockXSize, &sExtraArg);
 }
 
+/************************************************************************/
+/*                       UpdateBlockValidCounts()                       */
+/*                                                                      */
+/*      Remember the number of valid pixels of the blocks fully         */
+/*      contained in a window that has just been read at full           */
+/*      resolution, for IGetDataCoverageStatus().                       */
+/************************************************************************/
+
+void GDALNoDataMaskBand::UpdateBlockValidCounts(int nXOff, int nYOff,
+                                                int nXSize, int nYSize,
+                                                const GByte *pabyData,
+                                                GSpacing nLineSpace)
+{
+    if (!GetBlockValidCountPtr(0, 0))
+        return;
+
+    const int nXBlockStart = DIV_ROUND_UP(nXOff, nBlockXSize);
+    const int nYBlockStart = DIV_ROUND_UP(nYOff, nBlockYSize);
+    for (int iYBlock = nYBlockStart;; ++iYBlock)
+    {
+        const int nBlockYOff = iYBlock * nBlockYSize;
+        const int nBlockActualYSize =
+            std::min(nBlockYSize, nRasterYSize - nBlockYOff);
+        if (nBlockActualYSize <= 0 ||
+            nBlockYOff + nBlockActualYSize > nYOff + nYSize)
+            break;
+        for (int iXBlock = nXBlockStart;; ++iXBlock)
+        {
+            const int nBlockXOff = iXBlock * nBlockXSize;
+            const int nBlockActualXSize =
+                std::min(nBlockXSize, nRasterXSize - nBlockXOff);
+            if (nBlockActualXSize <= 0 ||
+                nBlockXOff + nBlockActualXSize > nXOff + nXSize)
+                break;
+            int nValidCount = 0;
+            for (int iY = 0; iY < nBlockActualYSize; ++iY)
+            {
+                nValidCount += CountNonZero(
+                    pabyData + (nBlockYOff - nYOff + iY) * nLineSpace +
+                        (nBlockXOff - nXOff),
+                    nBlockActualXSize);
+            }
+            *GetBlockValidCountPtr(iXBlock, iYBlock) = nValidCount;
+        }
+    }
+}
+
+/************************************************************************/
+/*                        GetBlockValidCountPtr()                       */
+/************************************************************************/
+
+int *GDALNoDataMaskBand::GetBlockValidCountPtr(int nXBlockOff, int nYBlockOff)
+{
+    // The validity of pixels of a dataset opened in update mode may change
+    GDALDataset *poParentDS = m_poParent->GetDataset();
+    if (!poParentDS || poParentDS->GetAccess() != GA_ReadOnly)
+        return nullptr;
+
+    const int nXBlocks = DIV_ROUND_UP(nRasterXSize, nBlockXSize);
+    const int nYBlocks = DIV_ROUND_UP(nRasterYSize, nBlockYSize);
+    if (m_anBlockValidCount.empty())
+    {
+        // Limit the memory used to 40 MB
+        constexpr int MAX_BLOCKS = 10 * 1000 * 1000;
+        if (static_cast<int64_t>(nBlockXSize) * nBlockYSize >
+                std::numeric_limits<int>::max() ||
+            static_cast<int64_t>(nXBlocks) * nYBlocks > MAX_BLOCKS)
+        {
+            return nullptr;
+        }
+        m_anBlockValidCount.resize(static_cast<size_t>(nXBlocks) * nYBlocks,
+                                   -1);
+    }
+    return &m_anBlockValidCount[static_cast<size_t>(nYBlockOff) * nXBlocks +
+                                nXBlockOff];
+}
+
+/************************************************************************/
+/*                       IGetDataCoverageStatus()                       */
+/*                                                                      */
+/*      Valid pixels are reported as "data", and nodata pixels, which   */
+/*      are read as 0, as "empty". This relies on the summary of blocks */
+/*      already read, or on the coverage status of the parent band,     */
+/*      since empty blocks of the parent band are nodata.               */
+/************************************************************************/
+
+int GDALNoDataMaskBand::IGetDataCoverageStatus(int nXOff, int nYOff,
+                                               int nXSize, int nYSize,
+                                               int nMaskFlagStop,
+                                               double *pdfDataPct)
+{
+    if (!GetBlockValidCountPtr(0, 0))
+    {
+        return GDALRasterBand::IGetDataCoverageStatus(
+            nXOff, nYOff, nXSize, nYSize, nMaskFlagStop, pdfDataPct);
+    }
+
+    // Empty blocks of the parent band are read as its nodata value, or 0
+    const auto eParentDT = m_poParent->GetRasterDataType();
+    int bParentHasNoData = FALSE;
+    const double dfParentNoData = m_poParent->GetNoDataValue(&bParentHasNoData);
+    const double dfEmptyValue = bParentHasNoData ? dfParentNoData : 0.0;
+    const bool bParentEmptyIsNoData =
+        eParentDT != GDT_Int64 && eParentDT != GDT_UInt64 &&
+        (dfEmptyValue == m_dfNoDataValue ||
+         (std::isnan(dfEmptyValue) && std::isnan(m_dfNoDataValue)));
+
+    int nStatus = 0;
+    double dfValidPixels = 0;
+    const int nXBlockStart = nXOff / nBlockXSize;
+    const int nXBlockEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nYBlockStart = nYOff / nBlockYSize;
+    const int nYBlockEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    for (int iYBlock = nYBlockStart; iYBlock <= nYBlockEnd; ++iYBlock)
+    {
+        const int nBlockYOff = iYBlock * nBlockYSize;
+        const int nBlockActualYSize =
+            std::min(nBlockYSize, nRasterYSize - nBlockYOff);
+        const int nIntersectYSize =
+            std::min(nYOff + nYSize, nBlockYOff + nBlockActualYSize) -
+            std::max(nYOff, nBlockYOff);
+        for (int iXBlock = nXBlockStart; iXBlock <= nXBlockEnd; ++iXBlock)
+        {
+            const int nBlockXOff = iXBlock * nBlockXSize;
+            const int nBlockActualXSize =
+                std::min(nBlockXSize, nRasterXSize - nBlockXOff);
+            const int nIntersectXSize =
+                std::min(nXOff + nXSize, nBlockXOff + nBlockActualXSize) -
+                std::max(nXOff, nBlockXOff);
+
+            int *pnValidCount = GetBlockValidCountPtr(iXBlock, iYBlock);
+            if (*pnValidCount < 0 && bParentEmptyIsNoData &&
+                m_poParent->GetDataCoverageStatus(
+                    nBlockXOff, nBlockYOff, nBlockActualXSize,
+                    nBlockActualYSize, 0,
+                    nullptr) == GDAL_DATA_COVERAGE_STATUS_EMPTY)
+            {
+                *pnValidCount = 0;
+            }
+            if (*pnValidCount < 0)
+            {
+                if (pdfDataPct)
+                    *pdfDataPct = -1.0;
+                return GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED |
+                       GDAL_DATA_COVERAGE_STATUS_DATA;
+            }
+
+            const int nBlockPixels = nBlockActualXSize * nBlockActualYSize;
+            if (*pnValidCount > 0)
+                nStatus |= GDAL_DATA_COVERAGE_STATUS_DATA;
+            if (*pnValidCount < nBlockPixels)
+                nStatus |= GDAL_DATA_COVERAGE_STATUS_EMPTY;
+            // Approximate for partially intersecting mixed blocks
+            dfValidPixels += static_cast<double>(*pnValidCount) *
+                             nIntersectXSize * nIntersectYSize / nBlockPixels;
+            if (nMaskFlagStop != 0 && (nStatus & nMaskFlagStop) != 0)
+                return nStatus;
+        }
+    }
+    if (pdfDataPct)
+        *pdfDataPct =
+            100.0 * dfValidPixels / (static_cast<double>(nXSize) * nYSize);
+    return nStatus;
+}
+
 /************************************************************************/
 /*                            SetZeroOr255()                            */
 /************************************************************************/
@@ -298,6 +482,97 @@ static void SetZeroOr255(GByte *pabyDest, const T *panSrc, int nBufXSize,
     }
 }
 
+/************************************************************************/
+/*                          SetZeroOr255Real()                          */
+/************************************************************************/
+
+// Same tolerance as ARE_REAL_EQUAL(), written without branches so that
+// the loops can be vectorized.
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetZeroOr255Real(GByte *pabyDest, const T *pSrc, size_t nBufSize, T noData)
+{
+    constexpr T EPSILON_X_ULP =
+        static_cast<T>(std::numeric_limits<float>::epsilon() * 2);
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        const T val = pSrc[i];
+        const bool bIsNoData =
+            (val == noData) |
+            (std::abs(val - noData) < EPSILON_X_ULP * std::abs(val + noData));
+        pabyDest[i] = bIsNoData ? 0 : 255;
+    }
+}
+
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetZeroOr255NaN(GByte *pabyDest, const T *pSrc, size_t nBufSize)
+{
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        const T val = pSrc[i];
+        // val != val is true only for NaN
+        pabyDest[i] = (val != val) ? 0 : 255;
+    }
+}
+
+template <class T>
+static void SetZeroOr255Real(GByte *pabyDest, const T *pSrc, size_t nBufSize,
+                             T noData, bool bIsNoDataNan)
+{
+    if (bIsNoDataNan)
+        SetZeroOr255NaN(pabyDest, pSrc, nBufSize);
+    else
+        SetZeroOr255Real(pabyDest, pSrc, nBufSize, noData);
+}
+
+template <class T>
+static void SetZeroOr255Real(GByte *pabyDest, const T *pSrc, int nBufXSize,
+                             int nBufYSize, GSpacing nPixelSpace,
+                             GSpacing nLineSpace, T noData, bool bIsNoDataNan)
+{
+    if (nPixelSpace == 1 && nLineSpace == nBufXSize)
+    {
+        const size_t nBufSize = static_cast<size_t>(nBufXSize) * nBufYSize;
+        SetZeroOr255Real(pabyDest, pSrc, nBufSize, noData, bIsNoDataNan);
+    }
+    else if (nPixelSpace == 1)
+    {
+        for (int iY = 0; iY < nBufYSize; iY++)
+        {
+            SetZeroOr255Real(pabyDest, pSrc, nBufXSize, noData, bIsNoDataNan);
+            pabyDest += nLineSpace;
+            pSrc += nBufXSize;
+        }
+    }
+    else
+    {
+        size_t i = 0;
+        for (int iY = 0; iY < nBufYSize; iY++)
+        {
+            GByte *pabyLineDest = pabyDest + iY * nLineSpace;
+            for (int iX = 0; iX < nBufXSize; iX++)
+            {
+                const T val = pSrc[i];
+                if (bIsNoDataNan && std::isnan(val))
+                    *pabyLineDest = 0;
+                else if (ARE_REAL_EQUAL(val, noData))
+                    *pabyLineDest = 0;
+                else
+                    *pabyLineDest = 255;
+                ++i;
+                pabyLineDest += nPixelSpace;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -340,6 +615,11 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             SetZeroOr255(pabyData, pabyData, nBufXSize, nBufYSize, nPixelSpace,
                          nLineSpace, byNoData);
         }
+        if (nPixelSpace == 1 && nXSize == nBufXSize && nYSize == nBufYSize)
+        {
+            UpdateBlockValidCounts(nXOff, nYOff, nXSize, nYSize, pabyData,
+                                   nLineSpace);
+        }
         return CE_None;
     }
 
@@ -461,48 +741,18 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             {
                 const float fNoData = static_cast<float>(m_dfNoDataValue);
                 const float *pafSrc = static_cast<const float *>(pTemp);
-
-                size_t i = 0;
-                for (int iY = 0; iY < nBufYSize; iY++)
-                {
-                    GByte *pabyLineDest = pabyDest + iY * nLineSpace;
-                    for (int iX = 0; iX < nBufXSize; iX++)
-                    {
-                        const float fVal = pafSrc[i];
-                        if (bIsNoDataNan && std::isnan(fVal))
-                            *pabyLineDest = 0;
-                        else if (ARE_REAL_EQUAL(fVal, fNoData))
-                            *pabyLineDest = 0;
-                        else
-                            *pabyLineDest = 255;
-                        ++i;
-                        pabyLineDest += nPixelSpace;
-                    }
-                }
+                SetZeroOr255Real(pabyDest, pafSrc, nBufXSize, nBufYSize,
+                                 nPixelSpace, nLineSpace, fNoData,
+                                 bIsNoDataNan);
             }
             break;
 
             case GDT_Float64:
             {
                 const double *padfSrc = static_cast<const double *>(pTemp);
-
-                size_t i = 0;
-                for (int iY = 0; iY < nBufYSize; iY++)
-                {
-                    GByte *pabyLineDest = pabyDest + iY * nLineSpace;
-                    for (int iX = 0; iX < nBufXSize; iX++)
-                    {
-                        const double dfVal = padfSrc[i];
-                        if (bIsNoDataNan && std::isnan(dfVal))
-                            *pabyLineDest = 0;
-                        else if (ARE_REAL_EQUAL(dfVal, m_dfNoDataValue))
-                            *pabyLineDest = 0;
-                        else
-                            *pabyLineDest = 255;
-                        ++i;
-                        pabyLineDest += nPixelSpace;
-                    }
-                }
+                SetZeroOr255Real(pabyDest, padfSrc, nBufXSize, nBufYSize,
+                                 nPixelSpace, nLineSpace, m_dfNoDataValue,
+                                 bIsNoDataNan);
             }
             break;
 
@@ -528,6 +778,11 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
 
         VSIFree(pTemp);
+        if (nPixelSpace == 1 && nXSize == nBufXSize && nYSize == nBufYSize)
+        {
+            UpdateBlockValidCounts(nXOff, nYOff, nXSize, nYSize, pabyDest,
+                                   nLineSpace);
+        }
         return CE_None;
     }
 
@@ -16,7 +16,9 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
+#include <cmath>
 #include <cstring>
+#include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -69,30 +71,60 @@ GDALNoDataValuesMaskBand::~GDALNoDataValuesMaskBand()
 /*                            FillOutBuffer()                           */
 /************************************************************************/
 
+// Sets to 255 the pixels of pabyDest whose value in paSrc is not nNoData
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetValidTo255(GByte *pabyDest, const T *paSrc, GPtrDiff_t nCount, T nNoData)
+{
+    for (GPtrDiff_t i = 0; i < nCount; i++)
+    {
+        pabyDest[i] |= (paSrc[i] != nNoData) ? 255 : 0;
+    }
+}
+
+// Same as above, for a NaN nodata value
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetNonNaNTo255(GByte *pabyDest, const T *paSrc, GPtrDiff_t nCount)
+{
+    for (GPtrDiff_t i = 0; i < nCount; i++)
+    {
+        const T val = paSrc[i];
+        // val == val is false only for NaN
+        pabyDest[i] |= (val == val) ? 255 : 0;
+    }
+}
+
 template <class T>
 static void FillOutBuffer(GPtrDiff_t nBlockOffsetPixels, int nBands,
                           const void *pabySrc, const double *padfNodataValues,
                           void *pImage)
 {
-    T *paNoData = static_cast<T *>(CPLMalloc(nBands * sizeof(T)));
+    // A pixel is nodata (0) only if it is nodata in all bands: process
+    // bands one after the other, so that the loops are vectorizable.
+    GByte *pabyDest = static_cast<GByte *>(pImage);
+    memset(pabyDest, 0, static_cast<size_t>(nBlockOffsetPixels));
     for (int iBand = 0; iBand < nBands; ++iBand)
     {
-        paNoData[iBand] = static_cast<T>(padfNodataValues[iBand]);
-    }
-
-    for (GPtrDiff_t i = 0; i < nBlockOffsetPixels; i++)
-    {
-        int nCountNoData = 0;
-        for (int iBand = 0; iBand < nBands; ++iBand)
+        const T *paSrc =
+            static_cast<const T *>(pabySrc) + iBand * nBlockOffsetPixels;
+        if constexpr (std::is_floating_point_v<T>)
         {
-            if (static_cast<const T *>(
-                    pabySrc)[i + iBand * nBlockOffsetPixels] == paNoData[iBand])
-                ++nCountNoData;
+            if (std::isnan(padfNodataValues[iBand]))
+            {
+                SetNonNaNTo255(pabyDest, paSrc, nBlockOffsetPixels);
+                continue;
+            }
         }
-        static_cast<GByte *>(pImage)[i] = nCountNoData == nBands ? 0 : 255;
+        SetValidTo255(pabyDest, paSrc, nBlockOffsetPixels,
+                      static_cast<T>(padfNodataValues[iBand]));
     }
-
-    CPLFree(paNoData);
 }
 
 /************************************************************************/
@@ -154,6 +154,14 @@ D_PROXY_METHOD_WITH_RET(CPLErr, CE_Failure, ReadCompressedData,
                          panBandList, ppBuffer, pnBufferSize,
                          ppszDetailedFormat))
 
+D_PROXY_METHOD_WITH_RET(CPLErr, CE_Failure, WriteCompressedData,
+                        (const char *pszFormat, int nXOff, int nYOff,
+                         int nXSize, int nYSize, int nBandCount,
+                         const int *panBandList, const void *pBuffer,
+                         size_t nBufferSize),
+                        (pszFormat, nXOff, nYOff, nXSize, nYSize, nBandCount,
+                         panBandList, pBuffer, nBufferSize))
+
 D_PROXY_METHOD_WITH_RET(CPLErr, CE_None, FlushCache, (bool bAtClosing),
                         (bAtClosing))
 
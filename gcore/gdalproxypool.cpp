@@ -18,6 +18,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <unordered_map>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -60,6 +62,9 @@ struct _GDALProxyPoolCacheEntry
     /* Ref count of the cached dataset */
     int refCount;
 
+    /* Thread opening the dataset, while refCount == -1 */
+    GIntBig nLoadingThreadId;
+
     GDALProxyPoolCacheEntry *prev;
     GDALProxyPoolCacheEntry *next;
 };
@@ -95,6 +100,17 @@ class GDALDatasetPool
     GDALProxyPoolCacheEntry *firstEntry = nullptr;
     GDALProxyPoolCacheEntry *lastEntry = nullptr;
 
+    /* Index of entries by their pszFileNameAndOpenOptions, to avoid */
+    /* scanning the whole list on each lookup */
+    std::unordered_multimap<std::string, GDALProxyPoolCacheEntry *>
+        oMapEntries{};
+
+    /* Signaled when the opening of a dataset completes */
+    CPLCond *hCondOpenCompleted = nullptr;
+
+    void AddToIndex(GDALProxyPoolCacheEntry *entry);
+    void RemoveFromIndex(GDALProxyPoolCacheEntry *entry);
+
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
     explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
@@ -139,7 +155,8 @@ class GDALDatasetPool
 /************************************************************************/
 
 GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn)
-    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn)
+    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn),
+      hCondOpenCompleted(CPLCreateCond())
 {
 }
 
@@ -167,6 +184,8 @@ GDALDatasetPool::~GDALDatasetPool()
         cur = next;
     }
     GDALSetResponsiblePIDForCurrentThread(responsiblePID);
+    if (hCondOpenCompleted)
+        CPLDestroyCond(hCondOpenCompleted);
 }
 
 #ifdef DEBUG_PROXY_POOL
@@ -229,6 +248,35 @@ static std::string GetFilenameAndOpenOptions(const char *pszFileName,
     return osFilenameAndOO;
 }
 
+/************************************************************************/
+/*                             AddToIndex()                             */
+/************************************************************************/
+
+void GDALDatasetPool::AddToIndex(GDALProxyPoolCacheEntry *entry)
+{
+    CPLAssert(entry->pszFileNameAndOpenOptions);
+    oMapEntries.emplace(entry->pszFileNameAndOpenOptions, entry);
+}
+
+/************************************************************************/
+/*                          RemoveFromIndex()                           */
+/************************************************************************/
+
+void GDALDatasetPool::RemoveFromIndex(GDALProxyPoolCacheEntry *entry)
+{
+    if (!entry->pszFileNameAndOpenOptions)
+        return;
+    auto range = oMapEntries.equal_range(entry->pszFileNameAndOpenOptions);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second == entry)
+        {
+            oMapEntries.erase(iter);
+            break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                            _RefDataset()                             */
 /************************************************************************/
@@ -269,6 +317,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         nRAMUsage -= candidate->nRAMUsage;
         candidate->nRAMUsage = 0;
 
+        RemoveFromIndex(candidate);
         CPLFree(candidate->pszFileNameAndOpenOptions);
         candidate->pszFileNameAndOpenOptions = nullptr;
 
@@ -316,22 +365,36 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         return true;
     };
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
+    GDALProxyPoolCacheEntry *cur = nullptr;
 
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
-    while (cur)
+    const GIntBig nThreadId = CPLGetPID();
+    while (true)
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
+        bool bOpeningByOtherThread = false;
+        auto range = oMapEntries.equal_range(osFilenameAndOO);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            GDALProxyPoolCacheEntry *entry = iter->second;
+            if (entry->refCount < 0)
+            {
+                if (entry->nLoadingThreadId != nThreadId)
+                    bOpeningByOtherThread = true;
+            }
+            else if ((bShared && entry->responsiblePID == responsiblePID &&
+                      ((entry->pszOwner == nullptr && pszOwner == nullptr) ||
+                       (entry->pszOwner != nullptr && pszOwner != nullptr &&
+                        strcmp(entry->pszOwner, pszOwner) == 0))) ||
+                     (!bShared && entry->refCount == 0))
+            {
+                cur = entry;
+                break;
+            }
+        }
 
-        if (cur->refCount >= 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
-            ((bShared && cur->responsiblePID == responsiblePID &&
-              ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
-               (cur->pszOwner != nullptr && pszOwner != nullptr &&
-                strcmp(cur->pszOwner, pszOwner) == 0))) ||
-             (!bShared && cur->refCount == 0)))
+        if (cur)
         {
             if (cur != firstEntry)
             {
@@ -355,11 +418,22 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             return cur;
         }
 
-        cur = next;
-    }
+        if (!bForceOpen)
+            return nullptr;
 
-    if (!bForceOpen)
-        return nullptr;
+        /* If another thread is opening the same dataset, wait for it to */
+        /* complete, so that we benefit from what it has cached (typically */
+        /* the header of network files), instead of fetching it */
+        /* concurrently. We only do that for top-level requests, that is */
+        /* when the current thread is not itself opening a dataset, to */
+        /* avoid dead-locks between threads. */
+        if (!bOpeningByOtherThread || refCountOfDisabledRefCount != 0 ||
+            bInDestruction)
+        {
+            break;
+        }
+        CPLCondWait(hCondOpenCompleted, *pMutex);
+    }
 
     if (currentSize == maxSize)
     {
@@ -397,9 +471,11 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     }
 
     cur->pszFileNameAndOpenOptions = CPLStrdup(osFilenameAndOO.c_str());
+    AddToIndex(cur);
     cur->pszOwner = (pszOwner) ? CPLStrdup(pszOwner) : nullptr;
     cur->responsiblePID = responsiblePID;
     cur->refCount = -1;  // to mark loading of dataset in progress
+    cur->nLoadingThreadId = nThreadId;
     cur->nRAMUsage = 0;
 
     refCountOfDisabledRefCount++;
@@ -416,6 +492,8 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
 
     cur->poDS = poDS;
     cur->refCount = 1;
+    cur->nLoadingThreadId = 0;
+    CPLCondBroadcast(hCondOpenCompleted);
 
     refCountOfDisabledRefCount--;
 
@@ -451,18 +529,17 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
     if (bInDestruction)
         return;
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
     GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
 
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
-    while (cur)
+    auto range = oMapEntries.equal_range(osFilenameAndOO);
+    for (auto iter = range.first; iter != range.second; ++iter)
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
+        GDALProxyPoolCacheEntry *cur = iter->second;
 
-        if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
+        if (cur->refCount == 0 &&
             ((pszOwner == nullptr && cur->pszOwner == nullptr) ||
              (pszOwner != nullptr && cur->pszOwner != nullptr &&
               strcmp(cur->pszOwner, pszOwner) == 0)) &&
@@ -478,6 +555,7 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             cur->nRAMUsage = 0;
 
             cur->poDS = nullptr;
+            oMapEntries.erase(iter);
             CPLFree(cur->pszFileNameAndOpenOptions);
             cur->pszFileNameAndOpenOptions = nullptr;
             CPLFree(cur->pszOwner);
@@ -490,8 +568,6 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
             break;
         }
-
-        cur = next;
     }
 }
 
@@ -529,11 +605,9 @@ void GDALDatasetPool::Ref()
             CPLGetConfigOption("GDAL_MAX_DATASET_POOL_RAM_USAGE", nullptr);
         if (pszMaxRAMUsage)
         {
-            l_nMaxRAMUsage = std::strtoll(pszMaxRAMUsage, nullptr, 10);
-            if (strstr(pszMaxRAMUsage, "MB"))
-                l_nMaxRAMUsage *= 1024 * 1024;
-            else if (strstr(pszMaxRAMUsage, "GB"))
-                l_nMaxRAMUsage *= 1024 * 1024 * 1024;
+            GIntBig nVal = 0;
+            if (CPLParseMemorySize(pszMaxRAMUsage, &nVal, nullptr) == CE_None)
+                l_nMaxRAMUsage = nVal;
         }
 
         singleton =
@@ -25,8 +25,11 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -40,6 +43,7 @@
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -335,9 +339,16 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     else if (CPL_UNLIKELY(psExtraArg->nVersion !=
                           RASTERIO_EXTRA_ARG_CURRENT_VERSION))
     {
-        ReportError(CE_Failure, CPLE_AppDefined,
-                    "Unhandled version of GDALRasterIOExtraArg");
-        return CE_Failure;
+        if (psExtraArg->nVersion != 1)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "Unhandled version of GDALRasterIOExtraArg");
+            return CE_Failure;
+        }
+        // Structure initialized by code built against an older GDAL:
+        // upgrade it to the current version.
+        GDALCopyRasterIOExtraArg(&sExtraArg, psExtraArg);
+        psExtraArg = &sExtraArg;
     }
 
     GDALRasterIOExtraArgSetResampleAlg(psExtraArg, nXSize, nYSize, nBufXSize,
@@ -370,11 +381,10 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     {
         if (CPL_UNLIKELY(eFlushBlockErr != CE_None))
         {
-            ReportError(eFlushBlockErr, CPLE_AppDefined,
+            const CPLErr eErr = eFlushBlockErr.exchange(CE_None);
+            ReportError(eErr, CPLE_AppDefined,
                         "An error occurred while writing a dirty block "
                         "from GDALRasterBand::RasterIO");
-            CPLErr eErr = eFlushBlockErr;
-            eFlushBlockErr = CE_None;
             return eErr;
         }
         if (EmitErrorMessageIfWriteNotSupported("GDALRasterBand::RasterIO()"))
@@ -431,6 +441,10 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     /* -------------------------------------------------------------------- */
 
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(eRWFlag));
+    const bool bNoCachePromotion =
+        eRWFlag == GF_Read && psExtraArg->bNoCachePromotion;
+    if (bNoCachePromotion)
+        GDALRasterBlock::EnterNoCachePromotion();
 
     CPLErr eErr;
     if (bForceCachedIO)
@@ -442,6 +456,8 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                       nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
 
+    if (bNoCachePromotion)
+        GDALRasterBlock::LeaveNoCachePromotion();
     if (bCallLeaveReadWrite)
         LeaveReadWrite();
 
@@ -669,7 +685,7 @@ CPLErr GDALRasterBand::ReadRaster(T *pData, size_t nArrayEltCount,
     }
 
     GDALRasterIOExtraArg sExtraArg;
-    sExtraArg.nVersion = 1;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
     sExtraArg.eResampleAlg = eResampleAlg;
     sExtraArg.pfnProgress = pfnProgress;
     sExtraArg.pProgressData = pProgressData;
@@ -883,7 +899,7 @@ CPLErr GDALRasterBand::ReadRaster(std::vector<T> &vData, double dfXOff,
     }
 
     GDALRasterIOExtraArg sExtraArg;
-    sExtraArg.nVersion = 1;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
     sExtraArg.eResampleAlg = eResampleAlg;
     sExtraArg.pfnProgress = pfnProgress;
     sExtraArg.pProgressData = pProgressData;
@@ -1111,6 +1127,9 @@ CPLErr GDALRasterBand::ReadBlock(int nXBlockOff, int nYBlockOff, void *pImage)
     /*      Invoke underlying implementation method.                        */
     /* -------------------------------------------------------------------- */
 
+    if (poBandBlockCache)
+        poBandBlockCache->WaitPendingWriteBehind();
+
     int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
     CPLErr eErr = IReadBlock(nXBlockOff, nYBlockOff, pImage);
     if (bCallLeaveReadWrite)
@@ -1183,6 +1202,33 @@ CPLErr GDALRasterBand::IWriteBlock(int /*nBlockXOff*/, int /*nBlockYOff*/,
     return (CE_Failure);
 }
 
+/************************************************************************/
+/*                       IsWriteBlockThreadSafe()                       */
+/************************************************************************/
+
+/**
+ * \brief Return whether IWriteBlock() may be called concurrently.
+ *
+ * Drivers returning true accept that IWriteBlock() is called from several
+ * threads at the same time on distinct blocks of this band (and of the other
+ * bands of the dataset), while the thread owning the dataset keeps using it.
+ * This allows dirty blocks evicted from the block cache, or written by
+ * FlushCache(), to be written by worker threads when the
+ * GDAL_WRITE_BEHIND_NUM_THREADS configuration option is set. Blocks being
+ * written are waited for before a block of the band is read through
+ * IReadBlock(): drivers whose IRasterIO() reads data without going through
+ * the block cache must call FlushCache() first.
+ *
+ * The default implementation returns false.
+ *
+ * @since GDAL 3.11
+ */
+
+bool GDALRasterBand::IsWriteBlockThreadSafe() const
+{
+    return false;
+}
+
 /************************************************************************/
 /*                             WriteBlock()                             */
 /************************************************************************/
@@ -1252,11 +1298,10 @@ CPLErr GDALRasterBand::WriteBlock(int nXBlockOff, int nYBlockOff, void *pImage)
 
     if (eFlushBlockErr != CE_None)
     {
-        ReportError(eFlushBlockErr, CPLE_AppDefined,
+        const CPLErr eErr = eFlushBlockErr.exchange(CE_None);
+        ReportError(eErr, CPLE_AppDefined,
                     "An error occurred while writing a dirty block "
                     "from GDALRasterBand::WriteBlock");
-        CPLErr eErr = eFlushBlockErr;
-        eFlushBlockErr = CE_None;
         return eErr;
     }
 
@@ -1660,20 +1705,22 @@ CPLErr GDALRasterBand::FlushCache(bool bAtClosing)
         poBandBlockCache)
         poBandBlockCache->DisableDirtyBlockWriting();
 
-    CPLErr eGlobalErr = eFlushBlockErr;
+    const CPLErr eGlobalErr = eFlushBlockErr.exchange(CE_None);
 
-    if (eFlushBlockErr != CE_None)
+    if (eGlobalErr != CE_None)
     {
         ReportError(
-            eFlushBlockErr, CPLE_AppDefined,
+            eGlobalErr, CPLE_AppDefined,
             "An error occurred while writing a dirty block from FlushCache");
-        eFlushBlockErr = CE_None;
     }
 
     if (poBandBlockCache == nullptr || !poBandBlockCache->IsInitOK())
         return eGlobalErr;
 
-    return poBandBlockCache->FlushCache();
+    // Also waits for the blocks being written by worker threads, and
+    // returns their errors
+    const CPLErr eErr = poBandBlockCache->FlushCache();
+    return eGlobalErr != CE_None ? eGlobalErr : eErr;
 }
 
 /************************************************************************/
@@ -1718,14 +1765,13 @@ CPLErr GDALRasterBand::DropCache()
     if (poBandBlockCache)
         poBandBlockCache->DisableDirtyBlockWriting();
 
-    CPLErr eGlobalErr = eFlushBlockErr;
+    const CPLErr eGlobalErr = eFlushBlockErr.exchange(CE_None);
 
-    if (eFlushBlockErr != CE_None)
+    if (eGlobalErr != CE_None)
     {
         ReportError(
-            eFlushBlockErr, CPLE_AppDefined,
+            eGlobalErr, CPLE_AppDefined,
             "An error occurred while writing a dirty block from DropCache");
-        eFlushBlockErr = CE_None;
     }
 
     if (poBandBlockCache == nullptr || !poBandBlockCache->IsInitOK())
@@ -1758,6 +1804,70 @@ CPLErr CPL_STDCALL GDALDropRasterCache(GDALRasterBandH hBand)
     return GDALRasterBand::FromHandle(hBand)->DropCache();
 }
 
+/************************************************************************/
+/*                      GetBlockCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Return statistics about the blocks of this band in the global
+ * raster block cache.
+ *
+ * Counters are cumulative since the first block of the band was cached.
+ *
+ * This method is the same as the C function
+ * GDALGetRasterBandBlockCacheStatistics().
+ *
+ * @param[out] pnCachedBytes Pointer to the number of bytes of the blocks of
+ * the band currently in the cache, or NULL.
+ * @param[out] pnHits Pointer to the number of block requests served from the
+ * cache, or NULL.
+ * @param[out] pnMisses Pointer to the number of block requests that required
+ * the block to be read (or initialized), or NULL.
+ * @param[out] pnEvictions Pointer to the number of blocks evicted from the
+ * cache to make room for other blocks, or NULL.
+ * @since 3.11
+ */
+
+void GDALRasterBand::GetBlockCacheStatistics(GIntBig *pnCachedBytes,
+                                             GIntBig *pnHits,
+                                             GIntBig *pnMisses,
+                                             GIntBig *pnEvictions) const
+{
+    const GDALBlockCacheAccounting *poAccounting =
+        poBandBlockCache ? &(poBandBlockCache->GetAccounting()) : nullptr;
+    if (pnCachedBytes)
+        *pnCachedBytes = poAccounting ? poAccounting->nCachedBytes.load() : 0;
+    if (pnHits)
+        *pnHits = poAccounting ? poAccounting->nHits.load() : 0;
+    if (pnMisses)
+        *pnMisses = poAccounting ? poAccounting->nMisses.load() : 0;
+    if (pnEvictions)
+        *pnEvictions = poAccounting ? poAccounting->nEvictions.load() : 0;
+}
+
+/************************************************************************/
+/*                 GDALGetRasterBandBlockCacheStatistics()              */
+/************************************************************************/
+
+/**
+ * \brief Return statistics about the blocks of a band in the global
+ * raster block cache.
+ *
+ * @see GDALRasterBand::GetBlockCacheStatistics()
+ * @since 3.11
+ */
+
+void GDALGetRasterBandBlockCacheStatistics(GDALRasterBandH hBand,
+                                           GIntBig *pnCachedBytes,
+                                           GIntBig *pnHits, GIntBig *pnMisses,
+                                           GIntBig *pnEvictions)
+{
+    VALIDATE_POINTER0(hBand, "GDALGetRasterBandBlockCacheStatistics");
+
+    GDALRasterBand::FromHandle(hBand)->GetBlockCacheStatistics(
+        pnCachedBytes, pnHits, pnMisses, pnEvictions);
+}
+
 /************************************************************************/
 /*                        UnreferenceBlock()                            */
 /*                                                                      */
@@ -1816,6 +1926,12 @@ void GDALRasterBand::AddBlockToFreeList(GDALRasterBlock *poBlock)
 /************************************************************************/
 
 /** Flush a block out of the block cache.
+ *
+ * When the block is written by a worker thread (see the
+ * GDAL_WRITE_BEHIND_NUM_THREADS configuration option), this returns before
+ * the write has completed, and a write error is returned by the next
+ * FlushCache().
+ *
  * @param nXBlockOff block x offset
  * @param nYBlockOff blocky offset
  * @param bWriteDirtyBlock whether the block should be written to disk if dirty.
@@ -1909,7 +2025,11 @@ GDALRasterBlock *GDALRasterBand::TryGetLockedBlockRef(int nXBlockOff,
         return (nullptr);
     }
 
-    return poBandBlockCache->TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    GDALRasterBlock *poBlock =
+        poBandBlockCache->TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    if (poBlock)
+        poBandBlockCache->IncHits();
+    return poBlock;
 }
 
 /************************************************************************/
@@ -1995,6 +2115,7 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
         if (poBlock == nullptr)
             return nullptr;
 
+        poBandBlockCache->IncMisses();
         poBlock->AddLock();
 
         /* We need to temporarily drop the read-write lock in the following */
@@ -2031,6 +2152,9 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
 
         if (!bJustInitialize)
         {
+            // Do not read a block that is being written by a worker thread
+            poBandBlockCache->WaitPendingWriteBehind();
+
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
             eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
@@ -2064,6 +2188,108 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                              PinBlock()                              */
+/************************************************************************/
+
+/**
+ * \brief Pin a block in the block cache to access its data without copy.
+ *
+ * The block is read if it is not already cached. As long as the returned
+ * object holds it, the block cannot be evicted from the block cache, and
+ * GDALPinnedBlock::GetData() returns a pointer to its data. That data
+ * must not be modified.
+ *
+ * The block must be unpinned before the block cache of the band is flushed
+ * or the dataset is closed.
+ *
+ * This method is the same as the C function GDALRasterBandPinBlock().
+ *
+ * @param nXBlockOff the horizontal block offset, with zero indicating
+ * the left most block, 1 the next block and so forth.
+ *
+ * @param nYBlockOff the vertical block offset, with zero indicating
+ * the top most block, 1 the next block and so forth.
+ *
+ * @return a pinned block, which evaluates to false on failure.
+ *
+ * @since GDAL 3.11
+ */
+
+GDALPinnedBlock GDALRasterBand::PinBlock(int nXBlockOff, int nYBlockOff)
+{
+    return GDALPinnedBlock(GetLockedBlockRef(nXBlockOff, nYBlockOff));
+}
+
+/************************************************************************/
+/*                       GDALRasterBandPinBlock()                       */
+/************************************************************************/
+
+/**
+ * \brief Pin a block in the block cache to access its data without copy.
+ *
+ * The returned handle must be released with GDALPinnedBlockUnpin().
+ *
+ * @see GDALRasterBand::PinBlock()
+ *
+ * @return a handle, or NULL on failure.
+ *
+ * @since GDAL 3.11
+ */
+
+GDALPinnedBlockH GDALRasterBandPinBlock(GDALRasterBandH hBand, int nXBlockOff,
+                                        int nYBlockOff)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterBandPinBlock", nullptr);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    auto oPinnedBlock = poBand->PinBlock(nXBlockOff, nYBlockOff);
+    if (!oPinnedBlock)
+        return nullptr;
+    return reinterpret_cast<GDALPinnedBlockH>(
+        new GDALPinnedBlock(std::move(oPinnedBlock)));
+}
+
+/************************************************************************/
+/*                       GDALPinnedBlockGetData()                       */
+/************************************************************************/
+
+/**
+ * \brief Return the data of a pinned block.
+ *
+ * The data is made of nBlockXSize * nBlockYSize values of the band data
+ * type, as returned by GDALGetBlockSize() and GDALGetRasterDataType(). For
+ * blocks at the right or bottom edge of the raster, only the part inside the
+ * raster is valid. The data must not be modified.
+ *
+ * @since GDAL 3.11
+ */
+
+const void *GDALPinnedBlockGetData(GDALPinnedBlockH hPinnedBlock)
+{
+    VALIDATE_POINTER1(hPinnedBlock, "GDALPinnedBlockGetData", nullptr);
+
+    return reinterpret_cast<GDALPinnedBlock *>(hPinnedBlock)->GetData();
+}
+
+/************************************************************************/
+/*                        GDALPinnedBlockUnpin()                        */
+/************************************************************************/
+
+/**
+ * \brief Unpin a block pinned with GDALRasterBandPinBlock().
+ *
+ * The handle, and the data pointer returned by GDALPinnedBlockGetData(),
+ * may no longer be used after that.
+ *
+ * @since GDAL 3.11
+ */
+
+void GDALPinnedBlockUnpin(GDALPinnedBlockH hPinnedBlock)
+{
+    delete reinterpret_cast<GDALPinnedBlock *>(hPinnedBlock);
+}
+
 /************************************************************************/
 /*                               Fill()                                 */
 /************************************************************************/
@@ -4799,6 +5025,78 @@ CPLErr GDALRasterBand::GetDefaultHistogram(double *pdfMin, double *pdfMax,
     return eErr;
 }
 
+/************************************************************************/
+/*               ComputeStatisticsAndDefaultHistogram()                 */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/**
+ * \brief Compute exact statistics and the default histogram in a single pass.
+ *
+ * This has the same effect as ComputeStatistics() with bApproxOK = FALSE,
+ * followed by GetDefaultHistogram() with bForce = TRUE, but reads pixels
+ * only once.
+ *
+ * This is only possible for unsigned Byte bands, whose default histogram has
+ * one bucket per value, so that statistics can be derived exactly from it.
+ *
+ * @return CE_None in case of success, CE_Warning (without emitting an error)
+ * if not possible for this band or if there is no valid pixel, in which case
+ * the above methods should be used, or CE_Failure in case of error.
+ */
+CPLErr GDALRasterBand::ComputeStatisticsAndDefaultHistogram(
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    if (eDataType != GDT_Byte)
+        return CE_Warning;
+    EnablePixelTypeSignedByteWarning(false);
+    const char *pszPixelType = GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE");
+    EnablePixelTypeSignedByteWarning(true);
+    if (pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE"))
+        return CE_Warning;
+
+    // Same parameters as in GetDefaultHistogram(), so that the histogram
+    // is saved as the default one by PAM.
+    constexpr int nBuckets = 256;
+    std::vector<GUIntBig> anHistogram(nBuckets);
+    const CPLErr eErr =
+        GetHistogram(-0.5, 255.5, nBuckets, anHistogram.data(), TRUE, FALSE,
+                     pfnProgress, pProgressData);
+    if (eErr != CE_None)
+        return eErr;
+
+    int nMin = -1;
+    int nMax = -1;
+    GUIntBig nValidCount = 0;
+    GUIntBig nSum = 0;
+    GUIntBig nSumSquare = 0;
+    for (int i = 0; i < nBuckets; ++i)
+    {
+        const GUIntBig nCount = anHistogram[i];
+        if (nCount == 0)
+            continue;
+        if (nMin < 0)
+            nMin = i;
+        nMax = i;
+        nValidCount += nCount;
+        nSum += nCount * i;
+        nSumSquare += nCount * i * i;
+    }
+    if (nValidCount == 0)
+        return CE_Warning;
+
+    const double dfValidCount = static_cast<double>(nValidCount);
+    const double dfMean = static_cast<double>(nSum) / dfValidCount;
+    const double dfVariance =
+        static_cast<double>(nSumSquare) / dfValidCount - dfMean * dfMean;
+    SetStatistics(nMin, nMax, dfMean, sqrt(std::max(0.0, dfVariance)));
+    SetValidPercent(static_cast<GUIntBig>(nRasterXSize) * nRasterYSize,
+                    nValidCount);
+    return CE_None;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                      GDALGetDefaultHistogram()                       */
 /************************************************************************/
@@ -6325,6 +6623,320 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
 
 //! @endcond
 
+/************************************************************************/
+/*                       GDALPartialStatistics                          */
+/************************************************************************/
+
+namespace
+{
+// Statistics of a subset of the pixels of a band, that are merged with the
+// ones of other subsets with the parallel algorithm of Chan et al.
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+struct GDALPartialStatistics
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;  // Sum of square of differences to the mean.
+    GUIntBig nValidCount = 0;
+    GUIntBig nSampleCount = 0;
+
+    void Merge(const GDALPartialStatistics &sOther)
+    {
+        nSampleCount += sOther.nSampleCount;
+        if (sOther.nValidCount == 0)
+            return;
+        dfMin = std::min(dfMin, sOther.dfMin);
+        dfMax = std::max(dfMax, sOther.dfMax);
+        const GUIntBig nNewValidCount = nValidCount + sOther.nValidCount;
+        const double dfOtherRatio =
+            static_cast<double>(sOther.nValidCount) / nNewValidCount;
+        const double dfDelta = sOther.dfMean - dfMean;
+        dfMean += dfDelta * dfOtherRatio;
+        dfM2 += sOther.dfM2 + dfDelta * dfDelta *
+                                  static_cast<double>(nValidCount) *
+                                  dfOtherRatio;
+        nValidCount = nNewValidCount;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                      ComputeBlockStatistics()                        */
+/************************************************************************/
+
+// Uses the corrected two-pass algorithm: the mean of the block is computed
+// first, and the sum of the differences to it, which would be zero with
+// exact arithmetic, compensates for its rounding error. Contrary to a
+// per-sample Welford update, this does not need any division in the loops.
+template <GDALDataType eDataType, bool bSignedByte>
+static void ComputeBlockStatistics(const void *pData, int nXCheck, int nYCheck,
+                                   int nBlockXSize,
+                                   const GDALNoDataValues &sNoDataValues,
+                                   const GByte *pabyMaskData,
+                                   GDALPartialStatistics &sStats)
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfSum = 0.0;
+    GUIntBig nValidCount = 0;
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+            bool bValid = true;
+            const double dfValue = GetPixelValue(
+                eDataType, bSignedByte, pData, iOffset, sNoDataValues, bValid);
+            if (!bValid)
+                continue;
+            dfMin = std::min(dfMin, dfValue);
+            dfMax = std::max(dfMax, dfValue);
+            dfSum += dfValue;
+            ++nValidCount;
+        }
+    }
+
+    sStats = GDALPartialStatistics();
+    sStats.nSampleCount = static_cast<GUIntBig>(nXCheck) * nYCheck;
+    if (nValidCount == 0)
+        return;
+
+    const double dfMean = dfSum / static_cast<double>(nValidCount);
+    double dfSumDelta = 0.0;
+    double dfSumDelta2 = 0.0;
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+            bool bValid = true;
+            const double dfValue = GetPixelValue(
+                eDataType, bSignedByte, pData, iOffset, sNoDataValues, bValid);
+            if (!bValid)
+                continue;
+            const double dfDelta = dfValue - dfMean;
+            dfSumDelta += dfDelta;
+            dfSumDelta2 += dfDelta * dfDelta;
+        }
+    }
+
+    sStats.dfMin = dfMin;
+    sStats.dfMax = dfMax;
+    sStats.dfMean = dfMean + dfSumDelta / static_cast<double>(nValidCount);
+    sStats.dfM2 = std::max(0.0, dfSumDelta2 - dfSumDelta * dfSumDelta /
+                                                  static_cast<double>(
+                                                      nValidCount));
+    sStats.nValidCount = nValidCount;
+}
+
+static void ComputeBlockStatistics(const void *pData, GDALDataType eDataType,
+                                   bool bSignedByte, int nXCheck, int nYCheck,
+                                   int nBlockXSize,
+                                   const GDALNoDataValues &sNoDataValues,
+                                   const GByte *pabyMaskData,
+                                   GDALPartialStatistics &sStats)
+{
+#define CASE_COMPUTE_BLOCK_STATISTICS(eDT)                                     \
+    case eDT:                                                                  \
+        ComputeBlockStatistics<eDT, false>(pData, nXCheck, nYCheck,            \
+                                           nBlockXSize, sNoDataValues,         \
+                                           pabyMaskData, sStats);              \
+        break
+
+    switch (eDataType)
+    {
+        case GDT_Byte:
+            if (bSignedByte)
+            {
+                ComputeBlockStatistics<GDT_Byte, true>(
+                    pData, nXCheck, nYCheck, nBlockXSize, sNoDataValues,
+                    pabyMaskData, sStats);
+            }
+            else
+            {
+                ComputeBlockStatistics<GDT_Byte, false>(
+                    pData, nXCheck, nYCheck, nBlockXSize, sNoDataValues,
+                    pabyMaskData, sStats);
+            }
+            break;
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Int8);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_UInt16);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Int16);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_UInt32);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Int32);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_UInt64);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Int64);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Float16);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Float32);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_Float64);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_CInt16);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_CInt32);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_CFloat16);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_CFloat32);
+            CASE_COMPUTE_BLOCK_STATISTICS(GDT_CFloat64);
+        case GDT_Unknown:
+        case GDT_TypeCount:
+            CPLAssert(false);
+            break;
+    }
+
+#undef CASE_COMPUTE_BLOCK_STATISTICS
+}
+
+/************************************************************************/
+/*                        ProcessSampledBlocks()                        */
+/************************************************************************/
+
+// Calls pfnProcess(iSample, pData, pabyMaskData, nXCheck, nYCheck) on one
+// block out of nSampleRate of poBand, iSample being the index of the block
+// among the sampled ones, and pabyMaskData the values of poMaskBand for it
+// (or nullptr if poMaskBand is nullptr).
+// Blocks and mask values are read by the calling thread. With
+// GDAL_NUM_THREADS, pfnProcess() is run by jobs of the global thread pool,
+// each job owning the lock of its block and a mask buffer, which is
+// recycled once it is done.
+template <class ProcessFunc>
+static bool
+ProcessSampledBlocks(GDALRasterBand *poBand, GDALRasterBand *poMaskBand,
+                     int nSampleRate, const ProcessFunc &pfnProcess,
+                     GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+    const int nBlocksPerColumn =
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+    const GIntBig nSampledBlocks = DIV_ROUND_UP(nTotalBlocks, nSampleRate);
+    const size_t nMaskSize =
+        poMaskBand ? static_cast<size_t>(nBlockXSize) * nBlockYSize : 0;
+
+    const int nThreads = static_cast<int>(std::min<GIntBig>(
+        nSampledBlocks,
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128)));
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    std::mutex oMutex;
+    std::vector<std::vector<GByte>> aabyFreeMasks;
+
+    bool bRet = true;
+    std::vector<GByte> abyMask;
+    for (GIntBig iSample = 0; iSample < nSampledBlocks; ++iSample)
+    {
+        const GIntBig iSampleBlock = iSample * nSampleRate;
+        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
+        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+        if (poJobQueue)
+        {
+            // Bound the number of locked blocks and mask buffers.
+            poJobQueue->WaitCompletion(nThreads);
+            std::lock_guard<std::mutex> oLock(oMutex);
+            if (!aabyFreeMasks.empty())
+            {
+                abyMask = std::move(aabyFreeMasks.back());
+                aabyFreeMasks.pop_back();
+            }
+        }
+        if (abyMask.size() < nMaskSize)
+        {
+            try
+            {
+                abyMask.resize(nMaskSize);
+            }
+            catch (const std::exception &)
+            {
+                poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
+                                    "Out of memory in ProcessSampledBlocks()");
+                bRet = false;
+                break;
+            }
+        }
+
+        GDALRasterBlock *const poBlock =
+            poBand->GetLockedBlockRef(iXBlock, iYBlock);
+        if (poBlock == nullptr)
+        {
+            bRet = false;
+            break;
+        }
+
+        int nXCheck = 0, nYCheck = 0;
+        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+        if (poMaskBand &&
+            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
+                                 abyMask.data(), nXCheck, nYCheck, GDT_Byte, 0,
+                                 nBlockXSize, nullptr) != CE_None)
+        {
+            poBlock->DropLock();
+            bRet = false;
+            break;
+        }
+
+        if (poJobQueue)
+        {
+            auto pabyJobMask = new std::vector<GByte>(std::move(abyMask));
+            abyMask.clear();
+            const auto ProcessJob = [&oMutex, &aabyFreeMasks, &pfnProcess,
+                                     poBlock, pabyJobMask, iSample, nXCheck,
+                                     nYCheck, nMaskSize]()
+            {
+                std::unique_ptr<std::vector<GByte>> pabyJobMaskHolder(
+                    pabyJobMask);
+                pfnProcess(static_cast<size_t>(iSample), poBlock->GetDataRef(),
+                           nMaskSize ? pabyJobMask->data() : nullptr, nXCheck,
+                           nYCheck);
+                poBlock->DropLock();
+                std::lock_guard<std::mutex> oLock(oMutex);
+                aabyFreeMasks.push_back(std::move(*pabyJobMask));
+            };
+            if (!poJobQueue->SubmitJob(ProcessJob))
+            {
+                delete pabyJobMask;
+                poBlock->DropLock();
+                bRet = false;
+                break;
+            }
+        }
+        else
+        {
+            pfnProcess(static_cast<size_t>(iSample), poBlock->GetDataRef(),
+                       poMaskBand ? abyMask.data() : nullptr, nXCheck,
+                       nYCheck);
+            poBlock->DropLock();
+        }
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(iSampleBlock) /
+                             static_cast<double>(nTotalBlocks),
+                         "Compute Statistics", pProgressData))
+        {
+            poBand->ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+            bRet = false;
+            break;
+        }
+    }
+
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -6342,6 +6954,11 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Since GDAL 3.11, for data types other than Byte and UInt16, blocks are
+ * processed by several threads when the GDAL_NUM_THREADS configuration
+ * option is set. Blocks are still read by the calling thread, and the result
+ * does not depend on the number of threads.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -6418,12 +7035,11 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Read actual data and compute statistics.                        */
     /* -------------------------------------------------------------------- */
-    // Using Welford algorithm:
-    // http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-    // to compute standard deviation in a more numerically robust way than
-    // the difference of the sum of square values with the square of the sum.
-    // dfMean and dfM2 are updated at each sample.
-    // dfM2 is the sum of square of differences to the current mean.
+    // Statistics are computed per block and merged with the parallel
+    // algorithm of Chan et al. (see GDALPartialStatistics), to compute
+    // standard deviation in a more numerically robust way than the
+    // difference of the sum of square values with the square of the sum.
+    // dfM2 is the sum of square of differences to the mean.
     double dfMin = std::numeric_limits<double>::max();
     double dfMax = -std::numeric_limits<double>::max();
     double dfMean = 0.0;
@@ -6516,32 +7132,16 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             }
         }
 
-        /* this isn't the fastest way to do this, but is easier for now */
-        for (int iY = 0; iY < nYReduced; iY++)
-        {
-            for (int iX = 0; iX < nXReduced; iX++)
-            {
-                const int iOffset = iX + iY * nXReduced;
-                if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                    continue;
-
-                bool bValid = true;
-                double dfValue = GetPixelValue(eDataType, bSignedByte, pData,
-                                               iOffset, sNoDataValues, bValid);
-                if (!bValid)
-                    continue;
-
-                dfMin = std::min(dfMin, dfValue);
-                dfMax = std::max(dfMax, dfValue);
-
-                nValidCount++;
-                const double dfDelta = dfValue - dfMean;
-                dfMean += dfDelta / nValidCount;
-                dfM2 += dfDelta * (dfValue - dfMean);
-            }
-        }
-
-        nSampleCount = static_cast<GUIntBig>(nXReduced) * nYReduced;
+        GDALPartialStatistics sStats;
+        ComputeBlockStatistics(pData, eDataType, bSignedByte, nXReduced,
+                               nYReduced, nXReduced, sNoDataValues,
+                               pabyMaskData, sStats);
+        dfMin = sStats.dfMin;
+        dfMax = sStats.dfMax;
+        dfMean = sStats.dfMean;
+        dfM2 = sStats.dfM2;
+        nValidCount = sStats.nValidCount;
+        nSampleCount = sStats.nSampleCount;
 
         CPLFree(pData);
         CPLFree(pabyMaskData);
@@ -6724,93 +7324,48 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        // Statistics are computed per block, possibly in parallel, and
+        // merged in block order, so that the result does not depend on the
+        // number of threads.
+        const GIntBig nSampledBlocks = DIV_ROUND_UP(
+            static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+            nSampleRate);
+        std::vector<GDALPartialStatistics> asBlockStats;
+        try
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
+            asBlockStats.resize(static_cast<size_t>(nSampledBlocks));
         }
-
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        catch (const std::exception &)
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
-            }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    bool bValid = true;
-                    double dfValue =
-                        GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                      sNoDataValues, bValid);
-
-                    if (!bValid)
-                        continue;
-
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
-                }
-            }
-
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in ComputeStatistics()");
+            return CE_Failure;
+        }
 
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+        const auto ComputeForBlock =
+            [this, bSignedByte, &sNoDataValues,
+             &asBlockStats](size_t iSample, const void *pData,
+                            const GByte *pabyMaskData, int nXCheck, int nYCheck)
+        {
+            ComputeBlockStatistics(pData, eDataType, bSignedByte, nXCheck,
+                                   nYCheck, nBlockXSize, sNoDataValues,
+                                   pabyMaskData, asBlockStats[iSample]);
+        };
+        if (!ProcessSampledBlocks(this, poMaskBand, nSampleRate,
+                                  ComputeForBlock, pfnProgress, pProgressData))
+        {
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        GDALPartialStatistics sStats;
+        for (const auto &sBlockStats : asBlockStats)
+            sStats.Merge(sBlockStats);
+        dfMin = sStats.dfMin;
+        dfMax = sStats.dfMax;
+        dfMean = sStats.dfMean;
+        dfM2 = sStats.dfM2;
+        nValidCount = sStats.nValidCount;
+        nSampleCount = sStats.nSampleCount;
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -7144,62 +7699,52 @@ static void ComputeMinMaxGeneric(const void *pData, GDALDataType eDataType,
 
 static bool ComputeMinMaxGenericIterBlocks(
     GDALRasterBand *poBand, GDALDataType eDataType, bool bSignedByte,
-    GIntBig nTotalBlocks, int nSampleRate, int nBlocksPerRow,
-    const GDALNoDataValues &sNoDataValues, GDALRasterBand *poMaskBand,
-    double &dfMin, double &dfMax)
+    int nSampleRate, const GDALNoDataValues &sNoDataValues,
+    GDALRasterBand *poMaskBand, double &dfMin, double &dfMax)
 
 {
-    GByte *pabyMaskData = nullptr;
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize)) *
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
 
-    if (poMaskBand)
+    // Per-block min/max, possibly computed in parallel.
+    std::vector<std::pair<double, double>> aoBlockMinMax;
+    try
     {
-        pabyMaskData =
-            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-        if (!pabyMaskData)
-        {
-            return false;
-        }
+        aoBlockMinMax.resize(
+            static_cast<size_t>(DIV_ROUND_UP(nTotalBlocks, nSampleRate)),
+            std::make_pair(dfMin, dfMax));
     }
-
-    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks;
-         iSampleBlock += nSampleRate)
+    catch (const std::exception &)
     {
-        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
-        if (poBlock == nullptr)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        void *const pData = poBlock->GetDataRef();
-
-        int nXCheck = 0, nYCheck = 0;
-        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-        if (poMaskBand &&
-            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                 pabyMaskData, nXCheck, nYCheck, GDT_Byte, 0,
-                                 nBlockXSize, nullptr) != CE_None)
-        {
-            poBlock->DropLock();
-            CPLFree(pabyMaskData);
-            return false;
-        }
+        poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory in ComputeRasterMinMax()");
+        return false;
+    }
 
+    const auto ComputeForBlock =
+        [eDataType, bSignedByte, nBlockXSize, &sNoDataValues,
+         &aoBlockMinMax](size_t iSample, const void *pData,
+                         const GByte *pabyMaskData, int nXCheck, int nYCheck)
+    {
         ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
-                             nBlockXSize, sNoDataValues, pabyMaskData, dfMin,
-                             dfMax);
-
-        poBlock->DropLock();
+                             nBlockXSize, sNoDataValues, pabyMaskData,
+                             aoBlockMinMax[iSample].first,
+                             aoBlockMinMax[iSample].second);
+    };
+    if (!ProcessSampledBlocks(poBand, poMaskBand, nSampleRate, ComputeForBlock,
+                              nullptr, nullptr))
+    {
+        return false;
     }
 
-    CPLFree(pabyMaskData);
+    for (const auto &oBlockMinMax : aoBlockMinMax)
+    {
+        dfMin = std::min(dfMin, oBlockMinMax.first);
+        dfMax = std::max(dfMax, oBlockMinMax.second);
+    }
     return true;
 }
 
@@ -7504,11 +8049,9 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
         }
         else
         {
-            const GIntBig nTotalBlocks =
-                static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-            if (!ComputeMinMaxGenericIterBlocks(
-                    this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, sNoDataValues, poMaskBand, dfMin, dfMax))
+            if (!ComputeMinMaxGenericIterBlocks(this, eDataType, bSignedByte,
+                                                nSampleRate, sNoDataValues,
+                                                poMaskBand, dfMin, dfMax))
             {
                 return CE_Failure;
             }
@@ -9872,6 +10415,92 @@ CPLErr GDALRasterInterpolateAtPoint(GDALRasterBandH hBand, double dfPixel,
                                       pdfRealValue, pdfImagValue);
 }
 
+/************************************************************************/
+/*                            InterpolateAtPoints()                     */
+/************************************************************************/
+
+/**
+ * \brief Interpolates the values between pixels at several points using a
+ * resampling algorithm, taking pixel/line coordinates as input.
+ *
+ * This is equivalent to calling InterpolateAtPoint() on each point, but
+ * points are processed in the order of the raster blocks that contain them,
+ * so that each block is generally read only once, whatever the order of the
+ * input points. This is much faster when sampling a large number of
+ * scattered points.
+ *
+ * @param nPointCount number of points.
+ * @param padfPixel array of nPointCount pixel coordinates.
+ * @param padfLine array of nPointCount line coordinates.
+ * @param eInterpolation interpolation type. Only near, bilinear, cubic and cubicspline are allowed.
+ * @param padfRealValue array of nPointCount values, receiving the real part of interpolated values
+ * @param padfImagValue array of nPointCount values, receiving the imaginary part of interpolated values (may be null if not needed)
+ * @param panSuccess array of nPointCount values, set to TRUE for points that
+ * could be interpolated and FALSE otherwise (may be null if not needed)
+ *
+ * @return CE_None if all points could be interpolated, or an error code
+ * otherwise.
+ * @since GDAL 3.11
+ */
+
+CPLErr GDALRasterBand::InterpolateAtPoints(size_t nPointCount,
+                                           const double *padfPixel,
+                                           const double *padfLine,
+                                           GDALRIOResampleAlg eInterpolation,
+                                           double *padfRealValue,
+                                           double *padfImagValue,
+                                           int *panSuccess) const
+{
+    if (eInterpolation != GRIORA_NearestNeighbour &&
+        eInterpolation != GRIORA_Bilinear && eInterpolation != GRIORA_Cubic &&
+        eInterpolation != GRIORA_CubicSpline)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only nearest, bilinear, cubic and cubicspline interpolation "
+                 "methods "
+                 "allowed");
+
+        return CE_Failure;
+    }
+
+    GDALRasterBand *pBand = const_cast<GDALRasterBand *>(this);
+    if (!m_poPointsCache)
+        m_poPointsCache = new GDALDoublePointsCache();
+
+    const bool res = GDALInterpolateAtPoints(
+        pBand, eInterpolation, m_poPointsCache->cache, nPointCount, padfPixel,
+        padfLine, padfRealValue, padfImagValue, panSuccess);
+
+    return res ? CE_None : CE_Failure;
+}
+
+/************************************************************************/
+/*                       GDALRasterInterpolateAtPoints()                */
+/************************************************************************/
+
+/**
+ * \brief Interpolates the values between pixels at several points using
+ * a resampling algorithm
+ *
+ * @see GDALRasterBand::InterpolateAtPoints()
+ * @since GDAL 3.11
+ */
+
+CPLErr GDALRasterInterpolateAtPoints(GDALRasterBandH hBand, size_t nPointCount,
+                                     const double *padfPixel,
+                                     const double *padfLine,
+                                     GDALRIOResampleAlg eInterpolation,
+                                     double *padfRealValue,
+                                     double *padfImagValue, int *panSuccess)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterInterpolateAtPoints", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->InterpolateAtPoints(nPointCount, padfPixel, padfLine,
+                                       eInterpolation, padfRealValue,
+                                       padfImagValue, panSuccess);
+}
+
 /************************************************************************/
 /*                    InterpolateAtGeolocation()                        */
 /************************************************************************/
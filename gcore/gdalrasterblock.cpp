@@ -17,9 +17,21 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <cstdint>
 #include <cstring>
+#include <map>
 #include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -27,27 +39,69 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "gdal_thread_pool.h"
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+static CPLLockType GetLockType();
+
+/************************************************************************/
+/*                          GDALRBCacheShard                            */
+/************************************************************************/
+
+// The global block cache is made of one or several shards. Each shard has
+// its own lock and its own LRU list, so that threads that work on blocks
+// falling in different shards do not contend on the same lock.
+// A block is assigned to a shard by hashing its band and block offsets, so
+// its shard does not change during its lifetime. The nCacheUsed member of
+// each shard accounts for the blocks of its list, and the sum over all
+// shards is the global nCacheUsed value (modulo blocks being inserted).
+//
+// The LRU list of a shard is made of a "young" segment, from poNewest to
+// the block preceding poOldHead, followed by an "old" segment, from poOldHead
+// to poOldest. Eviction always starts from poOldest, hence blocks of the old
+// segment are evicted first. With the default LRU policy, the old segment
+// only contains blocks fetched with the no-promotion hint. With the 2Q
+// policy, new blocks enter the old segment (probation queue) and are only
+// promoted to the young segment when accessed again after a delay, so that
+// a single sequential scan does not evict the frequently used blocks.
+
+namespace
+{
+struct GDALRBCacheShard
+{
+    CPLLock *hRBLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    GDALRasterBlock *poOldHead = nullptr;  // Head of the old segment.
+    GIntBig nCacheUsed = 0;
+    GIntBig nOldUsed = 0;  // Size of the blocks of the old segment.
+};
+
+enum class GDALRBCachePolicy
+{
+    LRU,
+    TWO_Q,
+};
+}  // namespace
+
+constexpr int MAX_RB_CACHE_SHARDS = 64;
+static GDALRBCacheShard asShards[MAX_RB_CACHE_SHARDS];
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
+static thread_local int nNoCachePromotionCounter = 0;
+
+// With the 2Q policy, accesses to a block of the old segment within that
+// delay after its insertion are considered as correlated to its first access
+// (e.g. reading the lines of a block one at a time), and do not promote it.
+constexpr GUInt32 TWO_Q_CORRELATED_REFERENCE_PERIOD_MS = 1000;
+
 static CPLLockType GetLockType()
 {
     static int nLockType = -1;
@@ -75,13 +129,369 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(oShard)                                                \
+    CPLLockHolderD(&((oShard).hRBLock), GetLockType());                        \
+    CPLLockSetDebugPerf((oShard).hRBLock, bDebugContention)
+#define TAKE_LOCK(oShard) CPLLockHolderOptionalLockD((oShard).hRBLock)
+#define DESTROY_LOCK(oShard) CPLDestroyLock((oShard).hRBLock)
+
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
+
+static int GetShardCount()
+{
+    static const int nShardCount = []()
+    {
+        const char *pszShards =
+            CPLGetConfigOption("GDAL_RB_CACHE_SHARDS", "1");
+        int nVal = EQUAL(pszShards, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszShards);
+        if (nVal < 1 || nVal > MAX_RB_CACHE_SHARDS)
+        {
+            const int nClamped =
+                std::max(1, std::min(nVal, MAX_RB_CACHE_SHARDS));
+            if (!EQUAL(pszShards, "ALL_CPUS"))
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "GDAL_RB_CACHE_SHARDS=%s out of [1,%d] range. "
+                         "Using %d",
+                         pszShards, MAX_RB_CACHE_SHARDS, nClamped);
+            }
+            nVal = nClamped;
+        }
+        return nVal;
+    }();
+    return nShardCount;
+}
+
+/************************************************************************/
+/*                          GetCachePolicy()                            */
+/************************************************************************/
+
+static GDALRBCachePolicy GetCachePolicy()
+{
+    static const GDALRBCachePolicy ePolicy = []()
+    {
+        const char *pszPolicy =
+            CPLGetConfigOption("GDAL_RB_CACHE_POLICY", "LRU");
+        if (EQUAL(pszPolicy, "2Q"))
+            return GDALRBCachePolicy::TWO_Q;
+        if (!EQUAL(pszPolicy, "LRU"))
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "GDAL_RB_CACHE_POLICY=%s not supported. "
+                     "Falling back to LRU",
+                     pszPolicy);
+        }
+        return GDALRBCachePolicy::LRU;
+    }();
+    return ePolicy;
+}
+
+/************************************************************************/
+/*                            GetTimeMS()                               */
+/************************************************************************/
+
+static GUInt32 GetTimeMS()
+{
+    return static_cast<GUInt32>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/************************************************************************/
+/*                           GetShardIndex()                            */
+/************************************************************************/
+
+static int GetShardIndex(const GDALRasterBand *poBand, int nXOff, int nYOff)
+{
+    const int nShardCount = GetShardCount();
+    if (nShardCount == 1)
+        return 0;
+    uint64_t nHash = static_cast<uint64_t>(
+                         reinterpret_cast<std::uintptr_t>(poBand) >> 4) *
+                     UINT64_C(0x9E3779B97F4A7C15);
+    nHash ^= static_cast<uint64_t>(static_cast<unsigned>(nXOff)) *
+             UINT64_C(0xC2B2AE3D27D4EB4F);
+    nHash ^= static_cast<uint64_t>(static_cast<unsigned>(nYOff)) *
+             UINT64_C(0x165667B19E3779F9);
+    nHash ^= nHash >> 29;
+    return static_cast<int>(nHash % static_cast<unsigned>(nShardCount));
+}
+
+static GDALRBCacheShard &GetShard(GDALRasterBlock *poBlock)
+{
+    return asShards[GetShardIndex(poBlock->GetBand(), poBlock->GetXOff(),
+                                  poBlock->GetYOff())];
+}
+
+/************************************************************************/
+/*                        InitializeShardLocks()                        */
+/************************************************************************/
+
+static void InitializeShardLocks()
+{
+    const int nShardCount = GetShardCount();
+    for (int i = 0; i < nShardCount; ++i)
+    {
+        INITIALIZE_LOCK(asShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                          GDALRBDataArena                             */
+/************************************************************************/
+
+// When GDAL_RB_CACHE_ALLOCATOR=ARENA, the data of blocks is not allocated
+// individually with VSIMalloc(), but carved out of large chunks owned by
+// an arena. On Linux, chunks are mmap()'ed at a huge page boundary and,
+// unless GDAL_RB_CACHE_HUGE_PAGES=NO, transparent huge pages are requested
+// for them with madvise(MADV_HUGEPAGE), which reduces TLB misses with large
+// caches. The data of a released block is kept in a free list of its arena,
+// indexed by size, to be reused by the next block of the same size.
+//
+// Unless GDAL_RB_CACHE_NUMA=NO, there is one arena per NUMA node, and a
+// thread allocates from the arena of the node it is running on. As the
+// kernel places a page on the node of the thread that first touches it,
+// and block data is generally filled by the thread that allocated it, the
+// memory of an arena ends up local to its node. Data of an evicted block is
+// only directly recycled for a new block if it belongs to the arena of the
+// current thread.
+//
+// The arena never returns memory to the system while blocks are alive. To
+// bound the memory retained by free lists of sizes that are no longer used,
+// a new chunk is only reserved if the total reserved size is below
+// GDAL_CACHEMAX plus one chunk. Otherwise, or for blocks larger than a
+// quarter of a chunk, block data is allocated with VSIMalloc() as usual.
+
+namespace
+{
+struct GDALRBDataArena
+{
+    std::mutex oMutex{};
+    std::vector<std::pair<void *, size_t>> aoChunks{};
+    GByte *pabyCur = nullptr;  // Unused part of the last chunk.
+    size_t nRemaining = 0;
+    std::map<size_t, std::vector<void *>> oMapFreeLists{};
+};
+
+struct GDALRBDataArenaConfig
+{
+    bool bEnabled = false;
+    bool bHugePages = true;
+    bool bNUMA = true;
+};
+}  // namespace
+
+constexpr int MAX_RB_DATA_ARENAS = 64;
+constexpr size_t RB_DATA_ARENA_CHUNK_SIZE = 32 * 1024 * 1024;
+constexpr size_t RB_DATA_ARENA_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+static GDALRBDataArena asDataArenas[MAX_RB_DATA_ARENAS];
+static std::atomic<GIntBig> nDataArenaReserved{0};
+static std::atomic<GIntBig> nDataArenaUsed{0};
+
+/************************************************************************/
+/*                        GetDataArenaConfig()                          */
+/************************************************************************/
+
+static const GDALRBDataArenaConfig &GetDataArenaConfig()
+{
+    static const GDALRBDataArenaConfig sConfig = []()
+    {
+        GDALRBDataArenaConfig sRet;
+        const char *pszAllocator =
+            CPLGetConfigOption("GDAL_RB_CACHE_ALLOCATOR", "DEFAULT");
+        if (EQUAL(pszAllocator, "ARENA"))
+            sRet.bEnabled = true;
+        else if (!EQUAL(pszAllocator, "DEFAULT"))
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "GDAL_RB_CACHE_ALLOCATOR=%s not supported. "
+                     "Falling back to DEFAULT",
+                     pszAllocator);
+        }
+        sRet.bHugePages =
+            CPLTestBool(CPLGetConfigOption("GDAL_RB_CACHE_HUGE_PAGES", "YES"));
+        sRet.bNUMA =
+            CPLTestBool(CPLGetConfigOption("GDAL_RB_CACHE_NUMA", "YES"));
+        return sRet;
+    }();
+    return sConfig;
+}
+
+/************************************************************************/
+/*                       GetCurrentDataArena()                          */
+/************************************************************************/
 
+static int GetCurrentDataArena()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    if (GetDataArenaConfig().bNUMA)
+    {
+        unsigned nCPU = 0;
+        unsigned nNode = 0;
+        if (syscall(SYS_getcpu, &nCPU, &nNode, nullptr) == 0)
+            return static_cast<int>(nNode % MAX_RB_DATA_ARENAS);
+    }
+#endif
+    return 0;
+}
+
+/************************************************************************/
+/*                        AllocDataArenaChunk()                         */
+/************************************************************************/
+
+static void *AllocDataArenaChunk()
+{
+#if defined(__linux__) && defined(HAVE_MMAP)
+    // Over-allocate to be able to align the chunk on a huge page boundary,
+    // and unmap the unused head and tail.
+    constexpr size_t nMapSize =
+        RB_DATA_ARENA_CHUNK_SIZE + RB_DATA_ARENA_HUGE_PAGE_SIZE;
+    void *pMap = mmap(nullptr, nMapSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pMap == MAP_FAILED)
+        return nullptr;
+    const std::uintptr_t nMap = reinterpret_cast<std::uintptr_t>(pMap);
+    const std::uintptr_t nChunk =
+        DIV_ROUND_UP(nMap, RB_DATA_ARENA_HUGE_PAGE_SIZE) *
+        RB_DATA_ARENA_HUGE_PAGE_SIZE;
+    if (nChunk > nMap)
+        munmap(pMap, nChunk - nMap);
+    if (nChunk + RB_DATA_ARENA_CHUNK_SIZE < nMap + nMapSize)
+        munmap(reinterpret_cast<void *>(nChunk + RB_DATA_ARENA_CHUNK_SIZE),
+               nMap + nMapSize - nChunk - RB_DATA_ARENA_CHUNK_SIZE);
+    void *pChunk = reinterpret_cast<void *>(nChunk);
+#ifdef MADV_HUGEPAGE
+    if (GetDataArenaConfig().bHugePages)
+        madvise(pChunk, RB_DATA_ARENA_CHUNK_SIZE, MADV_HUGEPAGE);
+#endif
+    return pChunk;
+#else
+    return VSIMallocAligned(RB_DATA_ARENA_HUGE_PAGE_SIZE,
+                            RB_DATA_ARENA_CHUNK_SIZE);
+#endif
+}
+
+/************************************************************************/
+/*                           AllocBlockData()                           */
+/************************************************************************/
+
+// Returns the data of a new block, and sets nArena to the index of the arena
+// it comes from, or -1 if it was allocated with VSIMalloc().
+static void *AllocBlockData(size_t nSize, int &nArena)
+{
+    nArena = -1;
+    if (GetDataArenaConfig().bEnabled && nSize <= RB_DATA_ARENA_CHUNK_SIZE / 4)
+    {
+        // Keep the 64-byte alignment of VSI_MALLOC_ALIGNED_AUTO().
+        const size_t nRoundedSize = DIV_ROUND_UP(nSize, 64) * 64;
+        const int nCurArena = GetCurrentDataArena();
+        GDALRBDataArena &oArena = asDataArenas[nCurArena];
+        void *pRet = nullptr;
+        {
+            std::lock_guard oLock(oArena.oMutex);
+            auto oIter = oArena.oMapFreeLists.find(nRoundedSize);
+            if (oIter != oArena.oMapFreeLists.end() && !oIter->second.empty())
+            {
+                pRet = oIter->second.back();
+                oIter->second.pop_back();
+            }
+            else
+            {
+                const GIntBig nMaxReserved =
+                    nCacheMax + static_cast<GIntBig>(RB_DATA_ARENA_CHUNK_SIZE);
+                if (oArena.nRemaining < nRoundedSize &&
+                    nDataArenaReserved < nMaxReserved)
+                {
+                    void *pChunk = AllocDataArenaChunk();
+                    if (pChunk)
+                    {
+                        oArena.aoChunks.emplace_back(pChunk,
+                                                     RB_DATA_ARENA_CHUNK_SIZE);
+                        oArena.pabyCur = static_cast<GByte *>(pChunk);
+                        oArena.nRemaining = RB_DATA_ARENA_CHUNK_SIZE;
+                        nDataArenaReserved += RB_DATA_ARENA_CHUNK_SIZE;
+                    }
+                }
+                if (oArena.nRemaining >= nRoundedSize)
+                {
+                    pRet = oArena.pabyCur;
+                    oArena.pabyCur += nRoundedSize;
+                    oArena.nRemaining -= nRoundedSize;
+                }
+            }
+        }
+        if (pRet)
+        {
+            nDataArenaUsed += nRoundedSize;
+            nArena = nCurArena;
+            return pRet;
+        }
+    }
+    return VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSize);
+}
+
+/************************************************************************/
+/*                           FreeBlockData()                            */
+/************************************************************************/
+
+static void FreeBlockData(void *pData, size_t nSize, int nArena)
+{
+    if (nArena < 0)
+    {
+        VSIFreeAligned(pData);
+        return;
+    }
+    const size_t nRoundedSize = DIV_ROUND_UP(nSize, 64) * 64;
+    GDALRBDataArena &oArena = asDataArenas[nArena];
+    {
+        std::lock_guard oLock(oArena.oMutex);
+        oArena.oMapFreeLists[nRoundedSize].push_back(pData);
+    }
+    nDataArenaUsed -= nRoundedSize;
+}
+
+/************************************************************************/
+/*                       IsBlockDataRecyclable()                        */
+/************************************************************************/
+
+// Whether the data of an evicted block can be directly reused by a new
+// block allocated by the current thread.
+static bool IsBlockDataRecyclable(int nArena)
+{
+    return nArena < 0 || !GetDataArenaConfig().bNUMA ||
+           nArena == GetCurrentDataArena();
+}
+
+/************************************************************************/
+/*                         ReleaseDataArenas()                          */
+/************************************************************************/
+
+static void ReleaseDataArenas()
+{
+    if (nDataArenaUsed != 0)
+        return;
+    for (auto &oArena : asDataArenas)
+    {
+        std::lock_guard oLock(oArena.oMutex);
+        for (const auto &oChunk : oArena.aoChunks)
+        {
+#if defined(__linux__) && defined(HAVE_MMAP)
+            munmap(oChunk.first, oChunk.second);
+#else
+            VSIFreeAligned(oChunk.first);
 #endif
+        }
+        oArena.aoChunks.clear();
+        oArena.pabyCur = nullptr;
+        oArena.nRemaining = 0;
+        oArena.oMapFreeLists.clear();
+    }
+    nDataArenaReserved = 0;
+}
 
 // #define ENABLE_DEBUG
 
@@ -221,9 +631,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            InitializeShardLocks();
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -273,14 +681,15 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nCurCacheUsed = nCacheUsed;
+    if (nCurCacheUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
                      "Cache used value doesn't fit on a 32 bit integer. "
                      "Call GDALGetCacheUsed64() instead");
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nCurCacheUsed);
 }
 
 /************************************************************************/
@@ -301,6 +710,33 @@ GIntBig CPL_STDCALL GDALGetCacheUsed64()
     return nCacheUsed;
 }
 
+/************************************************************************/
+/*                    GDALGetCacheArenaStatistics()                     */
+/************************************************************************/
+
+/**
+ * \brief Get occupancy statistics of the block data arenas.
+ *
+ * Block data is allocated from arenas when the GDAL_RB_CACHE_ALLOCATOR
+ * configuration option is set to ARENA. Otherwise both values are 0.
+ *
+ * @param pnReservedBytes Pointer to the number of bytes reserved from the
+ *                        system by the arenas, or NULL.
+ * @param pnUsedBytes Pointer to the number of bytes of the arenas currently
+ *                    used by block data, or NULL.
+ *
+ * @since GDAL 3.11
+ */
+
+void GDALGetCacheArenaStatistics(GIntBig *pnReservedBytes,
+                                 GIntBig *pnUsedBytes)
+{
+    if (pnReservedBytes)
+        *pnReservedBytes = nDataArenaReserved;
+    if (pnUsedBytes)
+        *pnUsedBytes = nDataArenaUsed;
+}
+
 /************************************************************************/
 /*                        GDALFlushCacheBlock()                         */
 /*                                                                      */
@@ -378,11 +814,22 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    GDALRasterBlock *poTarget = nullptr;
 
+    // Start from a different shard at each call, so that repeated calls
+    // do not always drain the same shard first.
+    static std::atomic<unsigned> nNextShard{0};
+    const int nShardCount = GetShardCount();
+    const int nFirstShard =
+        static_cast<int>(nNextShard++ % static_cast<unsigned>(nShardCount));
+
+    for (int iShard = 0; iShard < nShardCount && poTarget == nullptr;
+         ++iShard)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRBCacheShard &oShard =
+            asShards[(nFirstShard + iShard) % nShardCount];
+        TAKE_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
@@ -396,7 +843,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
         if (bSleepsForBockCacheDebug)
         {
             // coverity[tainted_data]
@@ -410,6 +857,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
     if (bSleepsForBockCacheDebug)
     {
         // coverity[tainted_data]
@@ -419,6 +869,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
             CPLSleep(dfDelay);
     }
 
+    if (SubmitWriteBehind(poTarget))
+        return TRUE;
+
     if (poTarget->GetDirty())
     {
         const CPLErr eErr = poTarget->Write();
@@ -429,8 +882,10 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
     }
 
-    VSIFreeAligned(poTarget->pData);
+    FreeBlockData(poTarget->pData, poTarget->GetBlockSize(),
+                  poTarget->nDataArena);
     poTarget->pData = nullptr;
+    poTarget->nDataArena = -1;
     poTarget->GetBand()->AddBlockToFreeList(poTarget);
 
     return TRUE;
@@ -465,6 +920,89 @@ void GDALRasterBlock::FlushDirtyBlocks()
     }
 }
 
+/************************************************************************/
+/*                          SubmitWriteBehind()                         */
+/************************************************************************/
+
+// Number of blocks, of all bands, being written by worker threads
+static std::atomic<int> gnPendingWriteBehind{0};
+
+/**
+ * \brief Write a dirty block in a worker thread ("write-behind").
+ *
+ * The block must have been removed from its band and detached from the
+ * LRU list, and the keep-alive counter of the band block cache must have
+ * been incremented by the caller. The worker thread writes the block,
+ * releases its data and adds it to the free list of the band.
+ *
+ * This is only done when the GDAL_WRITE_BEHIND_NUM_THREADS configuration
+ * option is set to a positive value or ALL_CPUS, and the band declares
+ * that IWriteBlock() may be called concurrently on distinct blocks (see
+ * GDALRasterBand::IsWriteBlockThreadSafe()). The number of blocks waiting to
+ * be written, which are no longer accounted in the cache size, is bounded to
+ * twice the number of threads.
+ *
+ * @return true if the block has been submitted, false if the caller must
+ * write it itself.
+ */
+
+bool GDALRasterBlock::SubmitWriteBehind(GDALRasterBlock *poBlock)
+{
+    GDALRasterBand *poBand = poBlock->GetBand();
+    if (!poBlock->GetDirty() || nDisableDirtyBlockFlushCounter > 0 ||
+        !poBand || !poBand->poBandBlockCache ||
+        !poBand->IsWriteBlockThreadSafe())
+    {
+        return false;
+    }
+
+    const char *pszThreads =
+        CPLGetConfigOption("GDAL_WRITE_BEHIND_NUM_THREADS", "0");
+    const int nThreads =
+        std::min(128, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszThreads));
+    if (nThreads <= 0)
+        return false;
+
+    if (gnPendingWriteBehind.fetch_add(1) >= 2 * nThreads)
+    {
+        --gnPendingWriteBehind;
+        return false;
+    }
+
+    GDALAbstractBandBlockCache *poBandBlockCache = poBand->poBandBlockCache;
+    poBandBlockCache->IncPendingWriteBehind();
+
+    const auto Job = [poBlock, poBand, poBandBlockCache]()
+    {
+        const CPLErr eErr = poBlock->Write();
+        if (eErr != CE_None)
+        {
+            // Save the error for later reporting.
+            poBand->SetFlushBlockErr(eErr);
+        }
+
+        FreeBlockData(poBlock->pData, poBlock->GetBlockSize(),
+                      poBlock->nDataArena);
+        poBlock->pData = nullptr;
+        poBlock->nDataArena = -1;
+
+        --gnPendingWriteBehind;
+        poBandBlockCache->DecPendingWriteBehind();
+        // Must be last, as the band may be destroyed right after
+        poBand->AddBlockToFreeList(poBlock);
+    };
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetWriteBehindThreadPool(nThreads);
+    if (!poThreadPool || !poThreadPool->SubmitJob(Job))
+    {
+        poBandBlockCache->DecPendingWriteBehind();
+        --gnPendingWriteBehind;
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                      EnterDisableDirtyBlockFlush()                   */
 /************************************************************************/
@@ -506,6 +1044,49 @@ void GDALRasterBlock::LeaveDisableDirtyBlockFlush()
     CPLAtomicDec(&nDisableDirtyBlockFlushCounter);
 }
 
+/************************************************************************/
+/*                        EnterNoCachePromotion()                       */
+/************************************************************************/
+
+/**
+ * \brief Starts preventing blocks accessed by the current thread from being
+ * promoted in the block cache.
+ *
+ * Until the matching LeaveNoCachePromotion() call, blocks inserted in the
+ * block cache by the current thread are put in its old segment, where they
+ * are evicted first, and blocks already cached are not promoted when
+ * accessed. This is used to implement the bNoCachePromotion hint of
+ * GDALRasterIOExtraArg.
+ *
+ * This method implements a per-thread reference counter.
+ *
+ * This call must be paired with a corresponding LeaveNoCachePromotion().
+ *
+ * @since GDAL 3.11
+ */
+
+void GDALRasterBlock::EnterNoCachePromotion()
+{
+    ++nNoCachePromotionCounter;
+}
+
+/************************************************************************/
+/*                        LeaveNoCachePromotion()                       */
+/************************************************************************/
+
+/**
+ * \brief Ends preventing blocks from being promoted in the block cache.
+ *
+ * Undoes the effect of EnterNoCachePromotion().
+ *
+ * @since GDAL 3.11
+ */
+
+void GDALRasterBlock::LeaveNoCachePromotion()
+{
+    --nNoCachePromotionCounter;
+}
+
 /************************************************************************/
 /*                          GDALRasterBlock()                           */
 /************************************************************************/
@@ -531,11 +1112,11 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
       poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!asShards[0].hRBLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeShardLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -586,6 +1167,7 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
 
     poNext = nullptr;
     poPrevious = nullptr;
+    bOld = false;
 
     nXOff = nXOffIn;
     nYOff = nYOffIn;
@@ -609,7 +1191,7 @@ GDALRasterBlock::~GDALRasterBlock()
 
     if (pData != nullptr)
     {
-        VSIFreeAligned(pData);
+        FreeBlockData(pData, GetBlockSize(), nDataArena);
     }
 
     CPLAssert(nLockCount <= 0);
@@ -652,33 +1234,25 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(this));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
-
-    if (poNewest == this)
-    {
-        poNewest = poNext;
-    }
-
-    if (poPrevious != nullptr)
-        poPrevious->poNext = poNext;
-
-    if (poNext != nullptr)
-        poNext->poPrevious = poPrevious;
-
-    poPrevious = nullptr;
-    poNext = nullptr;
+    Unlink_unlocked();
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        GDALRBCacheShard &oShard = GetShard(this);
+        const GIntBig nEffectiveSize = GetEffectiveBlockSize(GetBlockSize());
+        oShard.nCacheUsed -= nEffectiveSize;
+        nCacheUsed -= nEffectiveSize;
+        if (poBand && poBand->poBandBlockCache)
+            poBand->poBandBlockCache->AddCachedBytes(-nEffectiveSize);
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -698,26 +1272,36 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    const int nShardCount = GetShardCount();
+    for (int iShard = 0; iShard < nShardCount; ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRBCacheShard &oShard = asShards[iShard];
+        TAKE_LOCK(oShard);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        CPLAssert((oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+                  (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
+
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            bool bInOldSegment = false;
+            for (GDALRasterBlock *poBlock = oShard.poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(&GetShard(poBlock) == &oShard);
+                if (poBlock == oShard.poOldHead)
+                    bInOldSegment = true;
+                CPLAssert(poBlock->bOld == bInOldSegment);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(oShard.poOldest == poLast);
+        }
     }
 }
 
@@ -730,24 +1314,27 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int iShard = 0; iShard < GetShardCount(); ++iShard)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(asShards[iShard]);
+        for (GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -778,7 +1365,8 @@ CPLErr GDALRasterBlock::Write()
 
     MarkClean();
 
-    if (poBand->eFlushBlockErr == CE_None)
+    const CPLErr eFlushBlockErr = poBand->eFlushBlockErr;
+    if (eFlushBlockErr == CE_None)
     {
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
         CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
@@ -787,7 +1375,7 @@ CPLErr GDALRasterBlock::Write()
         return eErr;
     }
     else
-        return poBand->eFlushBlockErr;
+        return eFlushBlockErr;
 }
 
 /************************************************************************/
@@ -804,32 +1392,136 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRBCacheShard &oShard = GetShard(this);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
-    // Could happen even if tested in Touch() before taking the lock
-    // Scenario would be :
-    // 0. this is the second block (the one pointed by poNewest->poNext)
-    // 1. Thread 1 calls Touch() and poNewest != this at that point
-    // 2. Thread 2 detaches poNewest
-    // 3. Thread 1 arrives here
-    if (poNewest == this)
-        return;
+    GDALRBCacheShard &oShard = GetShard(this);
+    const GDALRBCachePolicy ePolicy = GetCachePolicy();
+    const bool bNoPromotion = nNoCachePromotionCounter > 0;
+
+    const bool bInList = poPrevious != nullptr || poNext != nullptr ||
+                         oShard.poNewest == this;
+    if (bInList)
+    {
+        // Could happen even if tested in Touch() before taking the lock
+        // Scenario would be :
+        // 0. this is the second block (the one pointed by poNewest->poNext)
+        // 1. Thread 1 calls Touch() and poNewest != this at that point
+        // 2. Thread 2 detaches poNewest
+        // 3. Thread 1 arrives here
+        if (oShard.poNewest == this || bNoPromotion)
+            return;
+
+        // We should not try to touch a block that has been detached.
+        // If that happen, corruption has already occurred.
+        CPLAssert(bMustDetach);
+
+        if (bOld && ePolicy == GDALRBCachePolicy::TWO_Q &&
+            GetTimeMS() - nOldEntryTime < TWO_Q_CORRELATED_REFERENCE_PERIOD_MS)
+        {
+            return;
+        }
+
+        Unlink_unlocked();
+    }
+
+    if (!bInList && (bNoPromotion || ePolicy == GDALRBCachePolicy::TWO_Q))
+    {
+        // Insert at the head of the old segment.
+        bOld = true;
+        nOldEntryTime = GetTimeMS();
+        oShard.nOldUsed += GetEffectiveBlockSize(GetBlockSize());
+        if (oShard.poOldHead != nullptr)
+        {
+            poPrevious = oShard.poOldHead->poPrevious;
+            poNext = oShard.poOldHead;
+            oShard.poOldHead->poPrevious = this;
+        }
+        else
+        {
+            poPrevious = oShard.poOldest;
+            poNext = nullptr;
+            oShard.poOldest = this;
+        }
+        if (poPrevious != nullptr)
+            poPrevious->poNext = this;
+        else
+            oShard.poNewest = this;
+        oShard.poOldHead = this;
+    }
+    else
+    {
+        // Insert at the head of the young segment.
+        poPrevious = nullptr;
+        poNext = oShard.poNewest;
+
+        if (oShard.poNewest != nullptr)
+        {
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            oShard.poNewest->poPrevious = this;
+        }
+        oShard.poNewest = this;
+
+        if (oShard.poOldest == nullptr)
+        {
+            CPLAssert(poPrevious == nullptr && poNext == nullptr);
+            oShard.poOldest = this;
+        }
+    }
 
-    // We should not try to touch a block that has been detached.
-    // If that happen, corruption has already occurred.
-    CPLAssert(bMustDetach);
+    // With the 2Q policy, keep the old segment at least a quarter of the
+    // shard, by demoting the least recently used blocks of the young segment.
+    if (ePolicy == GDALRBCachePolicy::TWO_Q)
+    {
+        while (oShard.nOldUsed < oShard.nCacheUsed / 4)
+        {
+            GDALRasterBlock *poYoungTail = oShard.poOldHead
+                                               ? oShard.poOldHead->poPrevious
+                                               : oShard.poOldest;
+            if (poYoungTail == nullptr)
+                break;
+            poYoungTail->bOld = true;
+            // Demoted blocks have already been used: they can be promoted
+            // again on their next access.
+            poYoungTail->nOldEntryTime =
+                GetTimeMS() - TWO_Q_CORRELATED_REFERENCE_PERIOD_MS;
+            oShard.nOldUsed +=
+                GetEffectiveBlockSize(poYoungTail->GetBlockSize());
+            oShard.poOldHead = poYoungTail;
+        }
+    }
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+#ifdef ENABLE_DEBUG
+    Verify();
+#endif
+}
+
+/************************************************************************/
+/*                          Unlink_unlocked()                           */
+/************************************************************************/
+
+// Remove the block from the LRU list of its shard.
+void GDALRasterBlock::Unlink_unlocked()
+{
+    GDALRBCacheShard &oShard = GetShard(this);
+    if (oShard.poOldHead == this)
+        oShard.poOldHead = poNext;
+
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
+
+    if (oShard.poNewest == this)
+        oShard.poNewest = poNext;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -838,23 +1530,13 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
-
-    if (poNewest != nullptr)
-    {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
-    }
-    poNewest = this;
+    poNext = nullptr;
 
-    if (poOldest == nullptr)
+    if (bOld)
     {
-        CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        bOld = false;
+        oShard.nOldUsed -= GetEffectiveBlockSize(GetBlockSize());
     }
-#ifdef ENABLE_DEBUG
-    Verify();
-#endif
 }
 
 /************************************************************************/
@@ -878,18 +1560,43 @@ CPLErr GDALRasterBlock::Internalize()
     CPLAssert(pData == nullptr);
 
     void *pNewData = nullptr;
+    int nNewDataArena = -1;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
+    const GIntBig nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
+
+    const int nShardCount = GetShardCount();
+    GDALRBCacheShard &oThisShard = GetShard(this);
+    const int nThisShard = static_cast<int>(&oThisShard - asShards);
+
+    nCacheUsed += nEffectiveSize;
+    poBand->poBandBlockCache->AddCachedBytes(nEffectiveSize);
+
+    // If the dataset of this block has a quota in the block cache and it is
+    // exceeded, evict blocks of that dataset even if the global limit is not
+    // reached.
+    const GDALBlockCacheAccounting *poDSAccounting =
+        poBand->poBandBlockCache->GetDatasetAccounting();
+    const auto IsOverQuota = [poDSAccounting]()
+    {
+        if (!poDSAccounting)
+            return false;
+        const GIntBig nQuota = poDSAccounting->nQuota.load();
+        return nQuota > 0 && poDSAccounting->nCachedBytes.load() > nQuota;
+    };
+    const auto NeedsEviction = [nCurCacheMax, &IsOverQuota]()
+    { return nCacheUsed > nCurCacheMax || IsOverQuota(); };
 
     /* -------------------------------------------------------------------- */
     /*      Flush old blocks if we are nearing our memory limit.            */
+    /*      We evict in priority from the shard of this block, and then     */
+    /*      from the other shards.                                          */
     /* -------------------------------------------------------------------- */
-    bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
     do
@@ -897,14 +1604,20 @@ CPLErr GDALRasterBlock::Internalize()
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+        for (int iShard = 0;
+             iShard < nShardCount && !bLoopAgain && NeedsEviction();
+             ++iShard)
         {
-            TAKE_LOCK;
+            GDALRBCacheShard &oShard =
+                asShards[(nThisShard + iShard) % nShardCount];
+            TAKE_LOCK(oShard);
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+            GDALRasterBlock *poTarget = oShard.poOldest;
+            while (NeedsEviction())
             {
+                // If only the quota of the dataset is exceeded, only blocks
+                // of that dataset can be evicted.
+                const bool bOnlyThisDataset = nCacheUsed <= nCurCacheMax;
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
                 // dataset. We do this to decrease significantly the likelihood
@@ -917,7 +1630,13 @@ CPLErr GDALRasterBlock::Internalize()
                 //    so gets the old value.
                 while (poTarget != nullptr)
                 {
-                    if (!poTarget->GetDirty())
+                    if (bOnlyThisDataset &&
+                        poTarget->poBand->poBandBlockCache
+                                ->GetDatasetAccounting() != poDSAccounting)
+                    {
+                        // Skip blocks of other datasets.
+                    }
+                    else if (!poTarget->GetDirty())
                     {
                         if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
                                                         0, -1))
@@ -949,7 +1668,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -987,12 +1706,12 @@ CPLErr GDALRasterBlock::Internalize()
                         // Only free one dirty block at a time so that
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bLoopAgain = NeedsEviction();
                         break;
                     }
                     if (nBlocksToFree == 64)
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
+                        bLoopAgain = NeedsEviction();
                         break;
                     }
 
@@ -1003,23 +1722,24 @@ CPLErr GDALRasterBlock::Internalize()
                     break;
                 }
             }
-
-            /* ------------------------------------------------------------------
-             */
-            /*      Add this block to the list. */
-            /* ------------------------------------------------------------------
-             */
-            if (!bLoopAgain)
-                Touch_unlocked();
         }
 
-        bFirstIter = false;
+        // Add this block to the list of its shard.
+        if (!bLoopAgain)
+        {
+            TAKE_LOCK(oThisShard);
+            oThisShard.nCacheUsed += nEffectiveSize;
+            Touch_unlocked();
+        }
 
         // Now free blocks we have detached and removed from their band.
         for (int i = 0; i < nBlocksToFree; ++i)
         {
             GDALRasterBlock *const poBlock = apoBlocksToFree[i];
 
+            if (SubmitWriteBehind(poBlock))
+                continue;
+
             if (poBlock->GetDirty())
             {
                 if (bSleepsForBockCacheDebug)
@@ -1043,15 +1763,19 @@ CPLErr GDALRasterBlock::Internalize()
             // Try to recycle the data of an existing block.
             void *pDataBlock = poBlock->pData;
             if (pNewData == nullptr && pDataBlock != nullptr &&
-                poBlock->GetBlockSize() == nSizeInBytes)
+                poBlock->GetBlockSize() == nSizeInBytes &&
+                IsBlockDataRecyclable(poBlock->nDataArena))
             {
                 pNewData = pDataBlock;
+                nNewDataArena = poBlock->nDataArena;
             }
-            else
+            else if (pDataBlock != nullptr)
             {
-                VSIFreeAligned(poBlock->pData);
+                FreeBlockData(pDataBlock, poBlock->GetBlockSize(),
+                              poBlock->nDataArena);
             }
             poBlock->pData = nullptr;
+            poBlock->nDataArena = -1;
 
             poBlock->GetBand()->AddBlockToFreeList(poBlock);
         }
@@ -1059,14 +1783,23 @@ CPLErr GDALRasterBlock::Internalize()
 
     if (pNewData == nullptr)
     {
-        pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
+        pNewData = AllocBlockData(nSizeInBytes, nNewDataArena);
         if (pNewData == nullptr)
         {
+            // The block remains in the LRU list without data, so Detach()
+            // will not release its accounted size.
+            {
+                TAKE_LOCK(oThisShard);
+                oThisShard.nCacheUsed -= nEffectiveSize;
+            }
+            nCacheUsed -= nEffectiveSize;
+            poBand->poBandBlockCache->AddCachedBytes(-nEffectiveSize);
             return (CE_Failure);
         }
     }
 
     pData = pNewData;
+    nDataArena = nNewDataArena;
 
     return CE_None;
 }
@@ -1118,9 +1851,13 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hRBLock != nullptr)
+            DESTROY_LOCK(oShard);
+        oShard.hRBLock = nullptr;
+    }
+    ReleaseDataArenas();
 }
 
 /*! @endcond */
@@ -1199,7 +1936,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(this));
 
     return FALSE;
 }
@@ -1208,7 +1945,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
+    for( GDALRasterBlock *poBlock = asShards[0].poNewest;
          poBlock != nullptr;
          poBlock = poBlock->poNext )
     {
@@ -17,9 +17,13 @@
 #include "gdal_rat.h"
 #include "gdal_priv.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <vector>
 
@@ -36,6 +40,14 @@
  *   them in a thread-safe way.
  * - GDALThreadLocalDatasetCache which is an internal class, which holds the
  *   thread-local datasets.
+ *
+ * When the GDAL_THREAD_SAFE_SHARED_BLOCK_CACHE configuration option is set,
+ * full resolution reads on GDALThreadSafeRasterBand are served from a cache
+ * of decoded blocks owned by the GDALThreadSafeDataset and shared by all
+ * threads, instead of from the block cache of each thread-local dataset.
+ * Blocks missing from it are still decoded by the thread-local datasets, so
+ * decoding stays parallel, but each block is decoded only once while it
+ * remains in the cache.
  */
 
 /************************************************************************/
@@ -227,6 +239,10 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
     }
 
   protected:
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, int, BANDMAP_TYPE, GSpacing, GSpacing,
+                     GSpacing, GDALRasterIOExtraArg *psExtraArg) override;
+
     GDALDataset *RefUnderlyingDataset() const override;
 
     void
@@ -263,6 +279,40 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
     /** Cached value returned by GetGCPSpatialRef() */
     mutable OGRSpatialReference m_oGCPSRS{};
 
+    /** Cache of decoded blocks shared by all threads. Keys are built by
+     * GDALThreadSafeRasterBand::GetSharedBlock()
+     */
+    struct SharedBlockCache
+    {
+        /** Mutex that protects oCache and oSetInFlight */
+        std::mutex oMutex{};
+
+        /** Signaled when a block is removed from oSetInFlight */
+        std::condition_variable oCV{};
+
+        lru11::Cache<GUIntBig, std::shared_ptr<const std::vector<GByte>>>
+            oCache;
+
+        /** Keys of blocks being decoded by a thread, so that other threads
+         * needing them wait for them, instead of decoding them again.
+         */
+        std::set<GUIntBig> oSetInFlight{};
+
+        explicit SharedBlockCache(size_t nMaxBlocks) : oCache(nMaxBlocks, 0)
+        {
+        }
+    };
+
+    /** Shared block cache, or null if GDAL_THREAD_SAFE_SHARED_BLOCK_CACHE is
+     * not set.
+     */
+    std::unique_ptr<SharedBlockCache> m_poSharedBlockCache{};
+
+    /** Number of GDALThreadSafeRasterBand instances that use
+     * m_poSharedBlockCache.
+     */
+    int m_nSharedBlockCacheBandCount = 0;
+
     /** Structure that references all GDALThreadLocalDatasetCache* instances.
      */
     struct GlobalCache
@@ -373,6 +423,11 @@ class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
     }
 
   protected:
+    CPLErr IReadBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, GSpacing, GSpacing,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     GDALRasterBand *RefUnderlyingRasterBand(bool bForceOpen) const override;
     void UnrefUnderlyingRasterBand(
         GDALRasterBand *poUnderlyingRasterBand) const override;
@@ -382,6 +437,14 @@ class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
      *created */
     GDALThreadSafeDataset *m_poTSDS = nullptr;
 
+    /** Index of this band in the keys of the shared block cache of m_poTSDS,
+     * or -1 if this band does not use it.
+     */
+    int m_nSharedBlockCacheBandIdx = -1;
+
+    std::shared_ptr<const std::vector<GByte>> GetSharedBlock(int nXBlock,
+                                                             int nYBlock);
+
     /** Pointer to the "prototype" raster band that corresponds to us.
      * All calls to m_poPrototypeBand should be protected by
      * GDALThreadSafeDataset:m_oPrototypeDSMutex.
@@ -516,6 +579,37 @@ GDALThreadSafeDataset::GDALThreadSafeDataset(
     // Replicate the characteristics of the prototype dataset onto ourselves
     nRasterXSize = poPrototypeDS->GetRasterXSize();
     nRasterYSize = poPrototypeDS->GetRasterYSize();
+
+    const char *pszSharedBlockCache =
+        CPLGetConfigOption("GDAL_THREAD_SAFE_SHARED_BLOCK_CACHE", nullptr);
+    GIntBig nSharedBlockCacheSize = 0;
+    if (pszSharedBlockCache &&
+        CPLParseMemorySize(pszSharedBlockCache, &nSharedBlockCacheSize,
+                           nullptr) == CE_None &&
+        nSharedBlockCacheSize > 0 && poPrototypeDS->GetRasterCount() > 0)
+    {
+        // Size the cache, in number of blocks, from the largest block of
+        // the bands.
+        GIntBig nMaxBlockSize = 1;
+        for (int i = 1; i <= poPrototypeDS->GetRasterCount(); ++i)
+        {
+            auto poBand = poPrototypeDS->GetRasterBand(i);
+            int nBlockXSize = 0;
+            int nBlockYSize = 0;
+            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+            nMaxBlockSize = std::max(
+                nMaxBlockSize,
+                static_cast<GIntBig>(nBlockXSize) * nBlockYSize *
+                    GDALGetDataTypeSizeBytes(poBand->GetRasterDataType()));
+        }
+        const size_t nMaxBlocks = static_cast<size_t>(std::max<GIntBig>(
+            1, nSharedBlockCacheSize / nMaxBlockSize));
+        CPLDebug("GDAL", "Shared block cache of %d blocks for %s",
+                 static_cast<int>(std::min<size_t>(nMaxBlocks, INT_MAX)),
+                 poPrototypeDS->GetDescription());
+        m_poSharedBlockCache = std::make_unique<SharedBlockCache>(nMaxBlocks);
+    }
+
     for (int i = 1; i <= poPrototypeDS->GetRasterCount(); ++i)
     {
         SetBand(i, std::make_unique<GDALThreadSafeRasterBand>(
@@ -821,6 +915,36 @@ void GDALThreadSafeDataset::UnrefUnderlyingDataset(
     poCache->m_oMapReferencedDS.erase(oIter);
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Implements GDALDataset::IRasterIO.
+ *
+ * When the shared block cache is used, full resolution reads are done band
+ * per band, through GDALThreadSafeRasterBand::IRasterIO(). Otherwise they
+ * are forwarded to the thread-local dataset.
+ */
+CPLErr GDALThreadSafeDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_poSharedBlockCache && eRWFlag == GF_Read && nXSize == nBufXSize &&
+        nYSize == nBufYSize)
+    {
+        return BandBasedRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                                 nBufXSize, nBufYSize, eBufType, nBandCount,
+                                 panBandMap, nPixelSpace, nLineSpace,
+                                 nBandSpace, psExtraArg);
+    }
+    return GDALProxyDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
 /************************************************************************/
 /*                      GDALThreadSafeRasterBand()                      */
 /************************************************************************/
@@ -839,6 +963,16 @@ GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
     nRasterYSize = poPrototypeBand->GetYSize();
     poPrototypeBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
+    // Keys of the shared block cache have 16 bits for the band index and 24
+    // bits for each block coordinate.
+    if (poTSDS->m_poSharedBlockCache &&
+        poTSDS->m_nSharedBlockCacheBandCount < (1 << 16) &&
+        DIV_ROUND_UP(nRasterXSize, nBlockXSize) <= (1 << 24) &&
+        DIV_ROUND_UP(nRasterYSize, nBlockYSize) <= (1 << 24))
+    {
+        m_nSharedBlockCacheBandIdx = poTSDS->m_nSharedBlockCacheBandCount++;
+    }
+
     if (nBandIn > 0)
     {
         // For regular bands instantiates a (thread-safe) mask band and
@@ -1003,6 +1137,148 @@ void GDALThreadSafeRasterBand::UnrefUnderlyingRasterBand(
     }
 }
 
+/************************************************************************/
+/*                          GetSharedBlock()                            */
+/************************************************************************/
+
+/** Return a block from the shared block cache, decoding it with the
+ * thread-local band if it is not there yet, or null in case of error.
+ */
+std::shared_ptr<const std::vector<GByte>>
+GDALThreadSafeRasterBand::GetSharedBlock(int nXBlock, int nYBlock)
+{
+    auto &oSharedCache = *(m_poTSDS->m_poSharedBlockCache);
+    const GUIntBig nKey =
+        (static_cast<GUIntBig>(m_nSharedBlockCacheBandIdx) << 48) |
+        (static_cast<GUIntBig>(nYBlock) << 24) | static_cast<GUIntBig>(nXBlock);
+    {
+        std::unique_lock oLock(oSharedCache.oMutex);
+        while (true)
+        {
+            std::shared_ptr<const std::vector<GByte>> poBlock;
+            if (oSharedCache.oCache.tryGet(nKey, poBlock))
+                return poBlock;
+            if (oSharedCache.oSetInFlight.insert(nKey).second)
+                break;
+            // Another thread is decoding that block: wait for it
+            oSharedCache.oCV.wait(oLock);
+        }
+    }
+
+    // Decode the block outside of the lock, so that several blocks can be
+    // decoded at the same time.
+    std::shared_ptr<std::vector<GByte>> poBlock;
+    auto poTLBand = RefUnderlyingRasterBand(true);
+    if (poTLBand)
+    {
+        try
+        {
+            poBlock = std::make_shared<std::vector<GByte>>(
+                static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                GDALGetDataTypeSizeBytes(eDataType));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate block of shared block cache");
+        }
+        if (poBlock &&
+            poTLBand->ReadBlock(nXBlock, nYBlock, poBlock->data()) != CE_None)
+        {
+            poBlock.reset();
+        }
+        UnrefUnderlyingRasterBand(poTLBand);
+    }
+
+    {
+        std::lock_guard oLock(oSharedCache.oMutex);
+        oSharedCache.oSetInFlight.erase(nKey);
+        if (poBlock)
+            oSharedCache.oCache.insert(nKey, poBlock);
+        oSharedCache.oCV.notify_all();
+    }
+    return poBlock;
+}
+
+/************************************************************************/
+/*                            IReadBlock()                              */
+/************************************************************************/
+
+/** Implements GDALRasterBand::IReadBlock
+ */
+CPLErr GDALThreadSafeRasterBand::IReadBlock(int nXBlock, int nYBlock,
+                                            void *pImage)
+{
+    if (m_nSharedBlockCacheBandIdx < 0)
+        return GDALProxyRasterBand::IReadBlock(nXBlock, nYBlock, pImage);
+
+    auto poBlock = GetSharedBlock(nXBlock, nYBlock);
+    if (!poBlock)
+        return CE_Failure;
+    memcpy(pImage, poBlock->data(), poBlock->size());
+    return CE_None;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Implements GDALRasterBand::IRasterIO
+ *
+ * Full resolution reads are served from the shared block cache, if it is
+ * used. Other requests are forwarded to the thread-local band.
+ */
+CPLErr GDALThreadSafeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_nSharedBlockCacheBandIdx < 0 || eRWFlag != GF_Read ||
+        nXSize != nBufXSize || nYSize != nBufYSize)
+    {
+        return GDALProxyRasterBand::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+            nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nXBlockStart = nXOff / nBlockXSize;
+    const int nXBlockEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nYBlockStart = nYOff / nBlockYSize;
+    const int nYBlockEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    for (int nYBlock = nYBlockStart; nYBlock <= nYBlockEnd; ++nYBlock)
+    {
+        const int nYStart = std::max(nYOff, nYBlock * nBlockYSize);
+        const int nYEnd =
+            std::min(nYOff + nYSize, (nYBlock + 1) * nBlockYSize);
+        for (int nXBlock = nXBlockStart; nXBlock <= nXBlockEnd; ++nXBlock)
+        {
+            const auto poBlock = GetSharedBlock(nXBlock, nYBlock);
+            if (!poBlock)
+                return CE_Failure;
+            const int nXStart = std::max(nXOff, nXBlock * nBlockXSize);
+            const int nXEnd =
+                std::min(nXOff + nXSize, (nXBlock + 1) * nBlockXSize);
+            for (int iY = nYStart; iY < nYEnd; ++iY)
+            {
+                const size_t nSrcOffset =
+                    (static_cast<size_t>(iY - nYBlock * nBlockYSize) *
+                         nBlockXSize +
+                     (nXStart - nXBlock * nBlockXSize)) *
+                    nDTSize;
+                GDALCopyWords64(poBlock->data() + nSrcOffset, eDataType,
+                                nDTSize,
+                                static_cast<GByte *>(pData) +
+                                    (iY - nYOff) * nLineSpace +
+                                    (nXStart - nXOff) * nPixelSpace,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nXEnd - nXStart);
+            }
+        }
+    }
+    return CE_None;
+}
+
 /************************************************************************/
 /*                           GetMaskBand()                              */
 /************************************************************************/
@@ -19,10 +19,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <limits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_virtualmem.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 // To be changed if we go to 64-bit RasterIO coordinates and spacing.
 using coord_type = int;
@@ -595,6 +598,33 @@ void GDALVirtualMem::Destroy(void *pUserData)
     delete psParams;
 }
 
+/************************************************************************/
+/*                     GDALVirtualMemSetReadAhead()                     */
+/************************************************************************/
+
+// Enable read-ahead on a mapping whose pfnCachePage callback accepts ranges
+// of several pages, according to the GDAL_VIRTUAL_MEM_READAHEAD
+// configuration option.
+static void GDALVirtualMemSetReadAhead(CPLVirtualMem *view, size_t nCacheSize)
+{
+    const char *pszReadAhead =
+        CPLGetConfigOption("GDAL_VIRTUAL_MEM_READAHEAD", "YES");
+    size_t nMaxReadAheadSize = 0;
+    if (CPLGetValueType(pszReadAhead) == CPL_VALUE_INTEGER)
+    {
+        const GIntBig nVal = CPLAtoGIntBig(pszReadAhead);
+        if (nVal > 0)
+            nMaxReadAheadSize = static_cast<size_t>(
+                std::min<GUIntBig>(nVal, std::numeric_limits<size_t>::max()));
+    }
+    else if (CPLTestBool(pszReadAhead))
+    {
+        // Capped to a quarter of the cache size by CPLVirtualMemSetReadAhead()
+        nMaxReadAheadSize = nCacheSize;
+    }
+    CPLVirtualMemSetReadAhead(view, nMaxReadAheadSize, TRUE);
+}
+
 /************************************************************************/
 /*                      GDALCheckBandParameters()                       */
 /************************************************************************/
@@ -756,6 +786,10 @@ GDALGetVirtualMem(GDALDatasetH hDS, GDALRasterBandH hBand, GDALRWFlag eRWFlag,
     {
         delete psParams;
     }
+    else
+    {
+        GDALVirtualMemSetReadAhead(view, nCacheSize);
+    }
 
     return view;
 }
@@ -790,6 +824,11 @@ GDALGetVirtualMem(GDALDatasetH hDS, GDALRasterBandH hBand, GDALRWFlag eRWFlag,
  * used to avoid that by ensuring memory pages are allocated before being
  * accessed.
  *
+ * Starting with GDAL 3.11, when pages are accessed sequentially, or with a
+ * constant stride, the pages expected to be accessed next are read ahead, with
+ * a single RasterIO() request per range of consecutive pages. This can be
+ * controlled with the GDAL_VIRTUAL_MEM_READAHEAD configuration option.
+ *
  * The size of the region that can be mapped as a virtual memory object depends
  * on hardware and operating system limitations.
  * On Linux AMD64 platforms, the maximum value is 128 TB.
@@ -924,6 +963,11 @@ CPLVirtualMem *GDALDatasetGetVirtualMem(
  * used to avoid that by ensuring memory pages are allocated before being
  * accessed.
  *
+ * Starting with GDAL 3.11, when pages are accessed sequentially, or with a
+ * constant stride, the pages expected to be accessed next are read ahead, with
+ * a single RasterIO() request per range of consecutive pages. This can be
+ * controlled with the GDAL_VIRTUAL_MEM_READAHEAD configuration option.
+ *
  * The size of the region that can be mapped as a virtual memory object depends
  * on hardware and operating system limitations.
  * On Linux AMD64 platforms, the maximum value is 128 TB.
@@ -1028,6 +1072,14 @@ class GDALTiledVirtualMem
     int *panBandMap = nullptr;
     GDALTileOrganization eTileOrganization = GTO_TIP;
 
+    // Thread-safe version of hDS (or of the dataset of hBand), used to read
+    // several tiles in parallel.
+    GDALDataset *poThreadSafeDS = nullptr;
+    int nThreads = 1;
+
+    size_t GetTileSize() const;
+    void DoIOTile(GDALRWFlag eRWFlag, size_t nOffset, void *pPage,
+                  bool bUseThreadSafeDS) const;
     void DoIO(GDALRWFlag eRWFlag, size_t nOffset, void *pPage,
               size_t nBytes) const;
 
@@ -1041,6 +1093,8 @@ class GDALTiledVirtualMem
                         GDALTileOrganization eTileOrganization);
     ~GDALTiledVirtualMem();
 
+    void EnableParallelRead();
+
     static void FillCache(CPLVirtualMem *ctxt, size_t nOffset,
                           void *pPageToFill, size_t nPageSize, void *pUserData);
     static void SaveFromCache(CPLVirtualMem *ctxt, size_t nOffset,
@@ -1091,24 +1145,109 @@ GDALTiledVirtualMem::GDALTiledVirtualMem(
 GDALTiledVirtualMem::~GDALTiledVirtualMem()
 {
     CPLFree(panBandMap);
+    if (poThreadSafeDS)
+        poThreadSafeDS->ReleaseRef();
+}
+
+/************************************************************************/
+/*                         EnableParallelRead()                         */
+/************************************************************************/
+
+// Allow ranges of several tiles, filled by read-ahead, to be read by
+// GDAL_NUM_THREADS threads, if the dataset is, or can be turned into, a
+// thread-safe dataset. Only done for datasets opened in read-only mode, since
+// a thread-safe dataset would not see pending changes of the source dataset.
+void GDALTiledVirtualMem::EnableParallelRead()
+{
+    const int nNumThreads =
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    if (nNumThreads <= 1)
+        return;
+
+    GDALDataset *poDS = hDS ? GDALDataset::FromHandle(hDS)
+                            : GDALRasterBand::FromHandle(hBand)->GetDataset();
+    if (poDS == nullptr || poDS->GetAccess() != GA_ReadOnly)
+        return;
+    if (hBand != nullptr)
+    {
+        const int nBand = GDALRasterBand::FromHandle(hBand)->GetBand();
+        if (nBand <= 0 || poDS->GetRasterBand(nBand) !=
+                              GDALRasterBand::FromHandle(hBand))
+            return;
+    }
+
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poThreadSafeDS = GDALGetThreadSafeDataset(poDS, GDAL_OF_RASTER);
+    }
+    if (poThreadSafeDS)
+        nThreads = nNumThreads;
+    else
+        CPLDebug("GDAL", "GDALTiledVirtualMem: dataset cannot be made "
+                         "thread-safe. Tiles will be read sequentially");
+}
+
+/************************************************************************/
+/*                            GetTileSize()                             */
+/************************************************************************/
+
+size_t GDALTiledVirtualMem::GetTileSize() const
+{
+    size_t nTileSize = static_cast<size_t>(nTileXSize) * nTileYSize *
+                       GDALGetDataTypeSizeBytes(eBufType);
+    if (eTileOrganization != GTO_BSQ)
+        nTileSize *= nBandCount;
+    return nTileSize;
 }
 
 /************************************************************************/
 /*                                DoIO()                                */
 /************************************************************************/
 
+// nBytes may be a multiple of the tile size when pages are read ahead.
 void GDALTiledVirtualMem::DoIO(GDALRWFlag eRWFlag, size_t nOffset, void *pPage,
                                size_t nBytes) const
+{
+    const size_t nPageSize = GetTileSize();
+    CPLAssert((nBytes % nPageSize) == 0);
+    const size_t nTiles = nBytes / nPageSize;
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 && nTiles > 1 && eRWFlag == GF_Read
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    for (size_t i = 0; i < nTiles; ++i)
+    {
+        const size_t nTileOffset = nOffset + i * nPageSize;
+        void *pTile = static_cast<GByte *>(pPage) + i * nPageSize;
+        if (poQueue)
+        {
+            poQueue->SubmitJob(
+                [this, eRWFlag, nTileOffset, pTile]()
+                { DoIOTile(eRWFlag, nTileOffset, pTile, true); });
+        }
+        else
+        {
+            DoIOTile(eRWFlag, nTileOffset, pTile, false);
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                              DoIOTile()                              */
+/************************************************************************/
+
+void GDALTiledVirtualMem::DoIOTile(GDALRWFlag eRWFlag, size_t nOffset,
+                                   void *pPage, bool bUseThreadSafeDS) const
 {
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eBufType);
     const int nTilesPerRow = (nXSize + nTileXSize - 1) / nTileXSize;
     const int nTilesPerCol = (nYSize + nTileYSize - 1) / nTileYSize;
-    size_t nPageSize =
-        static_cast<size_t>(nTileXSize) * nTileYSize * nDataTypeSize;
-    if (eTileOrganization != GTO_BSQ)
-        nPageSize *= nBandCount;
+    const size_t nPageSize = GetTileSize();
     CPLAssert((nOffset % nPageSize) == 0);
-    CPLAssert(nBytes == nPageSize);
     size_t nTile = 0;
     int band = 0;
     int nPixelSpace = 0;
@@ -1151,11 +1290,21 @@ void GDALTiledVirtualMem::DoIO(GDALRWFlag eRWFlag, size_t nOffset, void *pPage,
         std::min(nTileYSize, nYSize - static_cast<int>(nYTile * nTileYSize));
     if (eRWFlag == GF_Read &&
         (nReqXSize < nTileXSize || nReqYSize < nTileYSize))
-        memset(pPage, 0, nBytes);
-    if (hDS != nullptr)
+        memset(pPage, 0, nPageSize);
+    GDALDatasetH hDSIO = hDS;
+    GDALRasterBandH hBandIO = hBand;
+    if (bUseThreadSafeDS)
+    {
+        if (hDS)
+            hDSIO = GDALDataset::ToHandle(poThreadSafeDS);
+        else
+            hBandIO = GDALRasterBand::ToHandle(poThreadSafeDS->GetRasterBand(
+                GDALRasterBand::FromHandle(hBand)->GetBand()));
+    }
+    if (hDSIO != nullptr)
     {
         CPL_IGNORE_RET_VAL(GDALDatasetRasterIO(
-            hDS, eRWFlag, static_cast<int>(nXOff + nXTile * nTileXSize),
+            hDSIO, eRWFlag, static_cast<int>(nXOff + nXTile * nTileXSize),
             static_cast<int>(nYOff + nYTile * nTileYSize), nReqXSize, nReqYSize,
             pPage, nReqXSize, nReqYSize, eBufType,
             eTileOrganization != GTO_BSQ ? nBandCount : 1,
@@ -1165,7 +1314,7 @@ void GDALTiledVirtualMem::DoIO(GDALRWFlag eRWFlag, size_t nOffset, void *pPage,
     else
     {
         CPL_IGNORE_RET_VAL(GDALRasterIO(
-            hBand, eRWFlag, static_cast<int>(nXOff + nXTile * nTileXSize),
+            hBandIO, eRWFlag, static_cast<int>(nXOff + nXTile * nTileXSize),
             static_cast<int>(nYOff + nYTile * nTileYSize), nReqXSize, nReqYSize,
             pPage, nReqXSize, nReqYSize, eBufType, nPixelSpace, nLineSpace));
     }
@@ -1275,6 +1424,8 @@ static CPLVirtualMem *GDALGetTiledVirtualMem(
     psParams = new GDALTiledVirtualMem(
         hDS, hBand, nXOff, nYOff, nXSize, nYSize, nTileXSize, nTileYSize,
         eBufType, nBandCount, panBandMap, eTileOrganization);
+    if (eRWFlag == GF_Read)
+        psParams->EnableParallelRead();
 
     view = CPLVirtualMemNew(static_cast<size_t>(nReqMem), nCacheSize,
                             nPageSizeHint, bSingleThreadUsage,
@@ -1297,6 +1448,10 @@ static CPLVirtualMem *GDALGetTiledVirtualMem(
         CPLVirtualMemFree(view);
         return nullptr;
     }
+    else
+    {
+        GDALVirtualMemSetReadAhead(view, nCacheSize);
+    }
 
     return view;
 }
@@ -1358,6 +1513,14 @@ static CPLVirtualMem *GDALGetTiledVirtualMem(
  * used to avoid that by ensuring memory pages are allocated before being
  * accessed.
  *
+ * Starting with GDAL 3.11, when tiles are accessed sequentially, or with a
+ * constant stride (e.g. tile column by tile column), the tiles expected to be
+ * accessed next are read ahead. This can be controlled with the
+ * GDAL_VIRTUAL_MEM_READAHEAD configuration option. In GF_Read mode, if the
+ * GDAL_NUM_THREADS configuration option is set and the dataset is opened in
+ * read-only mode and is, or can be turned into, a thread-safe dataset (see
+ * GDALGetThreadSafeDataset()), tiles read ahead are read in parallel.
+ *
  * The size of the region that can be mapped as a virtual memory object depends
  * on hardware and operating system limitations.
  * On Linux AMD64 platforms, the maximum value is 128 TB.
@@ -1472,6 +1635,14 @@ CPLVirtualMem *GDALDatasetGetTiledVirtualMem(
  * used to avoid that by ensuring memory pages are allocated before being
  * accessed.
  *
+ * Starting with GDAL 3.11, when tiles are accessed sequentially, or with a
+ * constant stride (e.g. tile column by tile column), the tiles expected to be
+ * accessed next are read ahead. This can be controlled with the
+ * GDAL_VIRTUAL_MEM_READAHEAD configuration option. In GF_Read mode, if the
+ * GDAL_NUM_THREADS configuration option is set and the dataset is opened in
+ * read-only mode and is, or can be turned into, a thread-safe dataset (see
+ * GDALGetThreadSafeDataset()), tiles read ahead are read in parallel.
+ *
  * The size of the region that can be mapped as a virtual memory object depends
  * on hardware and operating system limitations.
  * On Linux AMD64 platforms, the maximum value is 128 TB.
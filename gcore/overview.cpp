@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
@@ -36,6 +37,7 @@
 #include "gdal.h"
 #include "gdal_thread_pool.h"
 #include "gdalwarper.h"
+#include "overview_avx2.h"
 
 #ifdef USE_NEON_OPTIMIZATIONS
 #include "include_sse2neon.h"
@@ -2165,6 +2167,8 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
     const int nChunkRightXOff = nChunkXOff + nChunkXSize;
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     std::vector<int> anVals(256, 0);
+    // Histogram for 16-bit values
+    std::vector<int> anVals16;
 
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
@@ -2274,6 +2278,62 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 size_t iMaxVal = 0;
                 bool biMaxValdValid = false;
 
+                if constexpr (std::is_same<T, uint16_t>::value)
+                {
+                    // Use a histogram when the number of source pixels is
+                    // large enough for the linear search below to be slow.
+                    constexpr size_t MIN_NUM_PX_FOR_HISTOGRAM = 32;
+                    if (nNumPx >= MIN_NUM_PX_FOR_HISTOGRAM)
+                    {
+                        if (anVals16.empty())
+                            anVals16.resize(65536);
+
+                        // Same semantics as below: the value that first
+                        // reaches the highest count wins.
+                        int nMaxCount = 0;
+                        int nMaxCountVal = -1;
+                        for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                        {
+                            const GPtrDiff_t iTotYOff =
+                                static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                    nChunkXSize -
+                                nChunkXOff;
+                            for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                            {
+                                if (pabySrcScanlineNodataMask == nullptr ||
+                                    pabySrcScanlineNodataMask[iX + iTotYOff])
+                                {
+                                    const int nVal =
+                                        paSrcScanline[iX + iTotYOff];
+                                    if (++anVals16[nVal] > nMaxCount)
+                                    {
+                                        nMaxCountVal = nVal;
+                                        nMaxCount = anVals16[nVal];
+                                    }
+                                }
+                            }
+                        }
+
+                        // Reset only the entries that have been used.
+                        for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                        {
+                            const GPtrDiff_t iTotYOff =
+                                static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                    nChunkXSize -
+                                nChunkXOff;
+                            for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                                anVals16[paSrcScanline[iX + iTotYOff]] = 0;
+                        }
+
+                        if (nMaxCountVal == -1)
+                            paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
+                        else
+                            paDstScanline[iDstPixel - nDstXOff] =
+                                static_cast<T>(nMaxCountVal);
+                        continue;
+                    }
+                }
+
                 if (paVals == nullptr || nNumPx > nMaxNumPx)
                 {
                     T *paValsNew = static_cast<T *>(
@@ -2347,10 +2407,13 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 int nMaxVal = 0;
                 int iMaxInd = -1;
 
-                // The cost of this zeroing might be high. Perhaps we should
-                // just use the above generic case, and go to this one if the
-                // number of source pixels is large enough
-                std::fill(anVals.begin(), anVals.end(), 0);
+                // The histogram is all zeroes between destination pixels.
+                // When there are fewer source pixels than histogram entries,
+                // only the entries used by this pixel are reset afterwards,
+                // instead of zeroing the whole histogram.
+                const int nNumPx =
+                    (nSrcYOff2 - nSrcYOff) * (nSrcXOff2 - nSrcXOff);
+                const bool bResetUsedEntries = nNumPx < 256;
 
                 for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
                 {
@@ -2374,6 +2437,23 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                     }
                 }
 
+                if (bResetUsedEntries)
+                {
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                            anVals[paSrcScanline[iX + iTotYOff]] = 0;
+                    }
+                }
+                else
+                {
+                    std::fill(anVals.begin(), anVals.end(), 0);
+                }
+
                 if (iMaxInd == -1)
                     paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
                 else
@@ -3567,6 +3647,27 @@ static CPLErr GDALResampleChunk_ConvolutionT(
 #ifdef USE_SSE2
             if constexpr (eWrkDataType == GDT_Float32)
             {
+#ifdef HAVE_OVERVIEW_AVX2_DISPATCH
+                if (nDstXSize >= 32 && CPLHaveRuntimeAVX2())
+                {
+                    for (; iFilteredPixelOff + 31 < nDstXSize;
+                         iFilteredPixelOff += 32, j += 32)
+                    {
+                        GDALResampleConvolutionVertical_32cols_AVX2(
+                            padfHorizontalFiltered + j, nDstXSize, padfWeights,
+                            nSrcLineCount, pafDstScanline + iFilteredPixelOff);
+                        if (bHasNoData)
+                        {
+                            for (int k = 0; k < 32; k++)
+                            {
+                                pafDstScanline[iFilteredPixelOff + k] =
+                                    replaceValIfNodata(
+                                        pafDstScanline[iFilteredPixelOff + k]);
+                            }
+                        }
+                    }
+                }
+#endif
 #ifdef __AVX__
                 for (; iFilteredPixelOff + 15 < nDstXSize;
                      iFilteredPixelOff += 16, j += 16)
@@ -4700,14 +4801,17 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     GByte *pabyChunkNodataMask = nullptr;
     void *pChunk = nullptr;
 
-    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const int nThreads =
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
-    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
-                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    // Overview computation is bulk processing: let jobs of other queues of
+    // the global pool go first, and do not use more threads than requested
+    // if the pool is larger.
+    auto poJobQueue =
+        poThreadPool
+            ? poThreadPool->CreateJobQueue(CPLJobPriority::LOW, nThreads)
+            : std::unique_ptr<CPLJobQueue>(nullptr);
 
     /* -------------------------------------------------------------------- */
     /*      Loop over image operating on chunks.                            */
@@ -5088,6 +5192,13 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
  *
+ * Starting with GDAL 3.11, when an overview level is computed from the
+ * previous one, the lines of that level are computed as soon as the lines of
+ * the previous level they depend on have been written, so that all levels are
+ * generated during a single scan of the source bands, re-reading recently
+ * written data from the block cache. This can be disabled by setting the
+ * GDAL_OVR_STREAMING configuration option to NO.
+ *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
  * @param papoSrcBands the list of source bands to downsample
@@ -5247,86 +5358,131 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     const bool bPropagateNoData =
         CPLTestBool(CPLGetConfigOption("GDAL_OVR_PROPAGATE_NODATA", "NO"));
 
-    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const int nThreads =
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
-    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
-                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    // Overview computation is bulk processing: let jobs of other queues of
+    // the global pool go first, and do not use more threads than requested
+    // if the pool is larger.
+    auto poJobQueue =
+        poThreadPool
+            ? poThreadPool->CreateJobQueue(CPLJobPriority::LOW, nThreads)
+            : std::unique_ptr<CPLJobQueue>(nullptr);
 
     // Only configurable for debug / testing
     const int nChunkMaxSize = std::max(
         100, atoi(CPLGetConfigOption("GDAL_OVR_CHUNK_MAX_SIZE", "10485760")));
 
-    // Second pass to do the real job.
-    double dfCurPixelCount = 0;
-    CPLErr eErr = CE_None;
-    for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
-         ++iOverview)
+    // Parameters of the computation of an overview level
+    struct OvrLevel
     {
         int iSrcOverview = -1;  // -1 means the source bands.
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        int nDstTotalWidth = 0;
+        int nDstTotalHeight = 0;
+        int nDstXOffStart = 0;
+        int nDstXOffEnd = 0;
+        int nDstYOffStart = 0;
+        int nDstYOffEnd = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        int nFullResXChunk = 0;
+        int nFullResYChunk = 0;
+        int nFullResXChunkQueried = 0;
+        int nFullResYChunkQueried = 0;
+
+        // Set when the RAM requirements to acquire the source data would
+        // exceed nChunkMaxSize
+        bool bUseTmpDS = false;
+        int nReducedDstChunkXSize = 0;
+        int nReducedDstChunkYSize = 0;
+
+        // First destination line not yet processed
+        int nNextDstYOff = 0;
+
+        // Source buffers
+        std::vector<void *> apaChunk{};
+        std::vector<GByte *> apabyChunkNoDataMask{};
+    };
+
+    const char *pszDST_CHUNK_X_SIZE =
+        CSLFetchNameValue(papszOptions, "DST_CHUNK_X_SIZE");
+    const char *pszDST_CHUNK_Y_SIZE =
+        CSLFetchNameValue(papszOptions, "DST_CHUNK_Y_SIZE");
+
+    std::vector<OvrLevel> aoLevels(nOverviews);
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        OvrLevel &oLevel = aoLevels[iOverview];
 
         const int nDstTotalWidth =
             papapoOverviewBands[0][iOverview]->GetXSize();
         const int nDstTotalHeight =
             papapoOverviewBands[0][iOverview]->GetYSize();
+        oLevel.nDstTotalWidth = nDstTotalWidth;
+        oLevel.nDstTotalHeight = nDstTotalHeight;
 
         // Compute the coordinates of the target region to refresh
         constexpr double EPS = 1e-8;
-        const int nDstXOffStart = static_cast<int>(
+        oLevel.nDstXOffStart = static_cast<int>(
             static_cast<double>(nSrcXOff) / nToplevelSrcWidth * nDstTotalWidth +
             EPS);
-        const int nDstXOffEnd =
+        oLevel.nDstXOffEnd =
             std::min(static_cast<int>(
                          std::ceil(static_cast<double>(nSrcXOff + nSrcXSize) /
                                        nToplevelSrcWidth * nDstTotalWidth -
                                    EPS)),
                      nDstTotalWidth);
-        const int nDstWidth = nDstXOffEnd - nDstXOffStart;
-        const int nDstYOffStart =
+        const int nDstWidth = oLevel.nDstXOffEnd - oLevel.nDstXOffStart;
+        oLevel.nDstYOffStart =
             static_cast<int>(static_cast<double>(nSrcYOff) /
                                  nToplevelSrcHeight * nDstTotalHeight +
                              EPS);
-        const int nDstYOffEnd =
+        oLevel.nDstYOffEnd =
             std::min(static_cast<int>(
                          std::ceil(static_cast<double>(nSrcYOff + nSrcYSize) /
                                        nToplevelSrcHeight * nDstTotalHeight -
                                    EPS)),
                      nDstTotalHeight);
+        oLevel.nNextDstYOff = oLevel.nDstYOffStart;
 
         // Try to use previous level of overview as the source to compute
         // the next level.
-        int nSrcWidth = nToplevelSrcWidth;
-        int nSrcHeight = nToplevelSrcHeight;
+        oLevel.nSrcWidth = nToplevelSrcWidth;
+        oLevel.nSrcHeight = nToplevelSrcHeight;
         if (iOverview > 0 &&
             papapoOverviewBands[0][iOverview - 1]->GetXSize() > nDstTotalWidth)
         {
-            nSrcWidth = papapoOverviewBands[0][iOverview - 1]->GetXSize();
-            nSrcHeight = papapoOverviewBands[0][iOverview - 1]->GetYSize();
-            iSrcOverview = iOverview - 1;
+            oLevel.nSrcWidth =
+                papapoOverviewBands[0][iOverview - 1]->GetXSize();
+            oLevel.nSrcHeight =
+                papapoOverviewBands[0][iOverview - 1]->GetYSize();
+            oLevel.iSrcOverview = iOverview - 1;
         }
 
         const double dfXRatioDstToSrc =
-            static_cast<double>(nSrcWidth) / nDstTotalWidth;
+            static_cast<double>(oLevel.nSrcWidth) / nDstTotalWidth;
         const double dfYRatioDstToSrc =
-            static_cast<double>(nSrcHeight) / nDstTotalHeight;
+            static_cast<double>(oLevel.nSrcHeight) / nDstTotalHeight;
+        oLevel.dfXRatioDstToSrc = dfXRatioDstToSrc;
+        oLevel.dfYRatioDstToSrc = dfYRatioDstToSrc;
 
         int nOvrFactor = std::max(static_cast<int>(0.5 + dfXRatioDstToSrc),
                                   static_cast<int>(0.5 + dfYRatioDstToSrc));
         if (nOvrFactor == 0)
             nOvrFactor = 1;
+        oLevel.nOvrFactor = nOvrFactor;
 
         int nDstChunkXSize = 0;
         int nDstChunkYSize = 0;
         papapoOverviewBands[0][iOverview]->GetBlockSize(&nDstChunkXSize,
                                                         &nDstChunkYSize);
 
-        const char *pszDST_CHUNK_X_SIZE =
-            CSLFetchNameValue(papszOptions, "DST_CHUNK_X_SIZE");
-        const char *pszDST_CHUNK_Y_SIZE =
-            CSLFetchNameValue(papszOptions, "DST_CHUNK_Y_SIZE");
         if (pszDST_CHUNK_X_SIZE && pszDST_CHUNK_Y_SIZE)
         {
             nDstChunkXSize = std::max(1, atoi(pszDST_CHUNK_X_SIZE));
@@ -5366,6 +5522,13 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         const int nFullResXChunkQueried =
             nFullResXChunk + 2 * nKernelRadius * nOvrFactor;
 
+        oLevel.nDstChunkXSize = nDstChunkXSize;
+        oLevel.nDstChunkYSize = nDstChunkYSize;
+        oLevel.nFullResXChunk = nFullResXChunk;
+        oLevel.nFullResYChunk = nFullResYChunk;
+        oLevel.nFullResXChunkQueried = nFullResXChunkQueried;
+        oLevel.nFullResYChunkQueried = nFullResYChunkQueried;
+
         // Make sure that the RAM requirements to acquire the source data does
         // not exceed nChunkMaxSize
         // If so, reduce the destination chunk size, generate overviews in a
@@ -5382,504 +5545,640 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             const auto nSqrtOverShootFactor = std::max<GIntBig>(
                 4, static_cast<GIntBig>(std::ceil(
                        std::sqrt(static_cast<double>(nOverShootFactor)))));
-            const int nReducedDstChunkXSize = std::max(
+            oLevel.nReducedDstChunkXSize = std::max(
                 1, static_cast<int>(nDstChunkXSize / nSqrtOverShootFactor));
-            const int nReducedDstChunkYSize = std::max(
+            oLevel.nReducedDstChunkYSize = std::max(
                 1, static_cast<int>(nDstChunkYSize / nSqrtOverShootFactor));
-            if (nReducedDstChunkXSize < nDstChunkXSize ||
-                nReducedDstChunkYSize < nDstChunkYSize)
+            oLevel.bUseTmpDS =
+                oLevel.nReducedDstChunkXSize < nDstChunkXSize ||
+                oLevel.nReducedDstChunkYSize < nDstChunkYSize;
+        }
+
+        oLevel.apaChunk.resize(nBands);
+        oLevel.apabyChunkNoDataMask.resize(nBands);
+    }
+
+    // Second pass to do the real job.
+    double dfCurPixelCount = 0;
+    CPLErr eErr = CE_None;
+
+    // Generate an overview level in a temporary dataset with a reduced
+    // chunk size, and copy it over the target overview bands.
+    const auto GenerateLevelThroughTmpDS =
+        [nBands, papoSrcBands, papapoOverviewBands, pszResampling, pfnProgress,
+         pProgressData, papszOptions, eDataType, nChunkMaxSize, nSrcXSize,
+         nSrcYSize, nToplevelSrcWidth, nToplevelSrcHeight, dfTotalPixelCount,
+         &dfCurPixelCount](int iOverview, const OvrLevel &oLevel)
+    {
+        CPLErr l_eErr = CE_None;
+        const int nDstTotalWidth = oLevel.nDstTotalWidth;
+        const int nDstTotalHeight = oLevel.nDstTotalHeight;
+
+        CPLStringList aosOptions(papszOptions);
+        aosOptions.SetNameValue("DST_CHUNK_X_SIZE",
+                                CPLSPrintf("%d", oLevel.nReducedDstChunkXSize));
+        aosOptions.SetNameValue("DST_CHUNK_Y_SIZE",
+                                CPLSPrintf("%d", oLevel.nReducedDstChunkYSize));
+
+        const auto nTmpDSMemRequirement =
+            static_cast<GIntBig>(nDstTotalWidth) * nDstTotalHeight * nBands *
+            GDALGetDataTypeSizeBytes(eDataType);
+        std::unique_ptr<GDALDataset> poTmpDS;
+        // Config option mostly/only for autotest purposes
+        const char *pszGDAL_OVR_TEMP_DRIVER =
+            CPLGetConfigOption("GDAL_OVR_TEMP_DRIVER", "");
+        if ((nTmpDSMemRequirement <= nChunkMaxSize &&
+             !EQUAL(pszGDAL_OVR_TEMP_DRIVER, "GTIFF")) ||
+            EQUAL(pszGDAL_OVR_TEMP_DRIVER, "MEM"))
+        {
+            auto poTmpDrv = GetGDALDriverManager()->GetDriverByName("MEM");
+            if (!poTmpDrv)
             {
-                CPLStringList aosOptions(papszOptions);
-                aosOptions.SetNameValue(
-                    "DST_CHUNK_X_SIZE",
-                    CPLSPrintf("%d", nReducedDstChunkXSize));
-                aosOptions.SetNameValue(
-                    "DST_CHUNK_Y_SIZE",
-                    CPLSPrintf("%d", nReducedDstChunkYSize));
-
-                const auto nTmpDSMemRequirement =
-                    static_cast<GIntBig>(nDstTotalWidth) * nDstTotalHeight *
-                    nBands * GDALGetDataTypeSizeBytes(eDataType);
-                std::unique_ptr<GDALDataset> poTmpDS;
-                // Config option mostly/only for autotest purposes
-                const char *pszGDAL_OVR_TEMP_DRIVER =
-                    CPLGetConfigOption("GDAL_OVR_TEMP_DRIVER", "");
-                if ((nTmpDSMemRequirement <= nChunkMaxSize &&
-                     !EQUAL(pszGDAL_OVR_TEMP_DRIVER, "GTIFF")) ||
-                    EQUAL(pszGDAL_OVR_TEMP_DRIVER, "MEM"))
-                {
-                    auto poTmpDrv =
-                        GetGDALDriverManager()->GetDriverByName("MEM");
-                    if (!poTmpDrv)
-                    {
-                        eErr = CE_Failure;
-                        break;
-                    }
-                    poTmpDS.reset(poTmpDrv->Create("", nDstTotalWidth,
-                                                   nDstTotalHeight, nBands,
-                                                   eDataType, nullptr));
-                }
-                else
-                {
-                    auto poTmpDrv =
-                        GetGDALDriverManager()->GetDriverByName("GTiff");
-                    if (!poTmpDrv)
-                    {
-                        eErr = CE_Failure;
-                        break;
-                    }
-                    std::string osTmpFilename;
-                    auto poDstDS = papapoOverviewBands[0][0]->GetDataset();
-                    if (poDstDS)
-                    {
-                        osTmpFilename = poDstDS->GetDescription();
-                        VSIStatBufL sStatBuf;
-                        if (!osTmpFilename.empty() &&
-                            VSIStatL(osTmpFilename.c_str(), &sStatBuf) == 0)
-                            osTmpFilename += "_tmp_ovr.tif";
-                    }
-                    if (osTmpFilename.empty())
-                    {
-                        osTmpFilename = CPLGenerateTempFilenameSafe(nullptr);
-                        osTmpFilename += ".tif";
-                    }
-                    CPLDebug("GDAL",
-                             "Creating temporary file %s of %d x %d x %d",
-                             osTmpFilename.c_str(), nDstTotalWidth,
-                             nDstTotalHeight, nBands);
-                    CPLStringList aosCO;
-                    poTmpDS.reset(poTmpDrv->Create(
-                        osTmpFilename.c_str(), nDstTotalWidth, nDstTotalHeight,
-                        nBands, eDataType, aosCO.List()));
-                    if (poTmpDS)
-                    {
-                        poTmpDS->MarkSuppressOnClose();
-                        VSIUnlink(osTmpFilename.c_str());
-                    }
-                }
-                if (!poTmpDS)
-                {
-                    eErr = CE_Failure;
-                    break;
-                }
+                return CE_Failure;
+            }
+            poTmpDS.reset(poTmpDrv->Create("", nDstTotalWidth, nDstTotalHeight,
+                                           nBands, eDataType, nullptr));
+        }
+        else
+        {
+            auto poTmpDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+            if (!poTmpDrv)
+            {
+                return CE_Failure;
+            }
+            std::string osTmpFilename;
+            auto poDstDS = papapoOverviewBands[0][0]->GetDataset();
+            if (poDstDS)
+            {
+                osTmpFilename = poDstDS->GetDescription();
+                VSIStatBufL sStatBuf;
+                if (!osTmpFilename.empty() &&
+                    VSIStatL(osTmpFilename.c_str(), &sStatBuf) == 0)
+                    osTmpFilename += "_tmp_ovr.tif";
+            }
+            if (osTmpFilename.empty())
+            {
+                osTmpFilename = CPLGenerateTempFilenameSafe(nullptr);
+                osTmpFilename += ".tif";
+            }
+            CPLDebug("GDAL", "Creating temporary file %s of %d x %d x %d",
+                     osTmpFilename.c_str(), nDstTotalWidth, nDstTotalHeight,
+                     nBands);
+            CPLStringList aosCO;
+            poTmpDS.reset(poTmpDrv->Create(osTmpFilename.c_str(),
+                                           nDstTotalWidth, nDstTotalHeight,
+                                           nBands, eDataType, aosCO.List()));
+            if (poTmpDS)
+            {
+                poTmpDS->MarkSuppressOnClose();
+                VSIUnlink(osTmpFilename.c_str());
+            }
+        }
+        if (!poTmpDS)
+        {
+            return CE_Failure;
+        }
 
-                std::vector<GDALRasterBand **> apapoOverviewBands(nBands);
-                for (int i = 0; i < nBands; ++i)
-                {
-                    apapoOverviewBands[i] = static_cast<GDALRasterBand **>(
-                        CPLMalloc(sizeof(GDALRasterBand *)));
-                    apapoOverviewBands[i][0] = poTmpDS->GetRasterBand(i + 1);
-                }
+        std::vector<GDALRasterBand **> apapoOverviewBands(nBands);
+        for (int i = 0; i < nBands; ++i)
+        {
+            apapoOverviewBands[i] = static_cast<GDALRasterBand **>(
+                CPLMalloc(sizeof(GDALRasterBand *)));
+            apapoOverviewBands[i][0] = poTmpDS->GetRasterBand(i + 1);
+        }
+
+        const double dfExtraPixels =
+            static_cast<double>(nSrcXSize) / nToplevelSrcWidth *
+            papapoOverviewBands[0][iOverview]->GetXSize() *
+            static_cast<double>(nSrcYSize) / nToplevelSrcHeight *
+            papapoOverviewBands[0][iOverview]->GetYSize();
 
-                const double dfExtraPixels =
-                    static_cast<double>(nSrcXSize) / nToplevelSrcWidth *
-                    papapoOverviewBands[0][iOverview]->GetXSize() *
-                    static_cast<double>(nSrcYSize) / nToplevelSrcHeight *
-                    papapoOverviewBands[0][iOverview]->GetYSize();
+        void *pScaledProgressData = GDALCreateScaledProgress(
+            dfCurPixelCount / dfTotalPixelCount,
+            (dfCurPixelCount + dfExtraPixels) / dfTotalPixelCount, pfnProgress,
+            pProgressData);
 
-                void *pScaledProgressData = GDALCreateScaledProgress(
-                    dfCurPixelCount / dfTotalPixelCount,
-                    (dfCurPixelCount + dfExtraPixels) / dfTotalPixelCount,
-                    pfnProgress, pProgressData);
+        // Generate overviews in temporary dataset
+        l_eErr = GDALRegenerateOverviewsMultiBand(
+            nBands, papoSrcBands, 1, apapoOverviewBands.data(), pszResampling,
+            GDALScaledProgress, pScaledProgressData, aosOptions.List());
 
-                // Generate overviews in temporary dataset
-                eErr = GDALRegenerateOverviewsMultiBand(
-                    nBands, papoSrcBands, 1, apapoOverviewBands.data(),
-                    pszResampling, GDALScaledProgress, pScaledProgressData,
-                    aosOptions.List());
+        GDALDestroyScaledProgress(pScaledProgressData);
 
-                GDALDestroyScaledProgress(pScaledProgressData);
+        dfCurPixelCount += dfExtraPixels;
 
-                dfCurPixelCount += dfExtraPixels;
+        for (int i = 0; i < nBands; ++i)
+        {
+            CPLFree(apapoOverviewBands[i]);
+        }
+
+        // Copy temporary dataset to destination overview bands
 
-                for (int i = 0; i < nBands; ++i)
+        if (l_eErr == CE_None)
+        {
+            // Check if all papapoOverviewBands[][iOverview] bands point
+            // to the same dataset. If so, we can use
+            // GDALDatasetCopyWholeRaster()
+            GDALDataset *poDstOvrBandDS =
+                papapoOverviewBands[0][iOverview]->GetDataset();
+            if (poDstOvrBandDS)
+            {
+                if (poDstOvrBandDS->GetRasterCount() != nBands ||
+                    poDstOvrBandDS->GetRasterBand(1) !=
+                        papapoOverviewBands[0][iOverview])
                 {
-                    CPLFree(apapoOverviewBands[i]);
+                    poDstOvrBandDS = nullptr;
                 }
-
-                // Copy temporary dataset to destination overview bands
-
-                if (eErr == CE_None)
+                else
                 {
-                    // Check if all papapoOverviewBands[][iOverview] bands point
-                    // to the same dataset. If so, we can use
-                    // GDALDatasetCopyWholeRaster()
-                    GDALDataset *poDstOvrBandDS =
-                        papapoOverviewBands[0][iOverview]->GetDataset();
-                    if (poDstOvrBandDS)
+                    for (int i = 1; poDstOvrBandDS && i < nBands; ++i)
                     {
-                        if (poDstOvrBandDS->GetRasterCount() != nBands ||
-                            poDstOvrBandDS->GetRasterBand(1) !=
-                                papapoOverviewBands[0][iOverview])
+                        GDALDataset *poThisDstOvrBandDS =
+                            papapoOverviewBands[i][iOverview]->GetDataset();
+                        if (poThisDstOvrBandDS == nullptr ||
+                            poThisDstOvrBandDS != poDstOvrBandDS ||
+                            poThisDstOvrBandDS->GetRasterBand(i + 1) !=
+                                papapoOverviewBands[i][iOverview])
                         {
                             poDstOvrBandDS = nullptr;
                         }
-                        else
-                        {
-                            for (int i = 1; poDstOvrBandDS && i < nBands; ++i)
-                            {
-                                GDALDataset *poThisDstOvrBandDS =
-                                    papapoOverviewBands[i][iOverview]
-                                        ->GetDataset();
-                                if (poThisDstOvrBandDS == nullptr ||
-                                    poThisDstOvrBandDS != poDstOvrBandDS ||
-                                    poThisDstOvrBandDS->GetRasterBand(i + 1) !=
-                                        papapoOverviewBands[i][iOverview])
-                                {
-                                    poDstOvrBandDS = nullptr;
-                                }
-                            }
-                        }
-                    }
-                    if (poDstOvrBandDS)
-                    {
-                        eErr = GDALDatasetCopyWholeRaster(
-                            GDALDataset::ToHandle(poTmpDS.get()),
-                            GDALDataset::ToHandle(poDstOvrBandDS), nullptr,
-                            nullptr, nullptr);
-                    }
-                    else
-                    {
-                        for (int i = 0; eErr == CE_None && i < nBands; ++i)
-                        {
-                            eErr = GDALRasterBandCopyWholeRaster(
-                                GDALRasterBand::ToHandle(
-                                    poTmpDS->GetRasterBand(i + 1)),
-                                GDALRasterBand::ToHandle(
-                                    papapoOverviewBands[i][iOverview]),
-                                nullptr, nullptr, nullptr);
-                        }
                     }
                 }
-
-                if (eErr != CE_None)
-                    break;
-
-                continue;
+            }
+            if (poDstOvrBandDS)
+            {
+                l_eErr = GDALDatasetCopyWholeRaster(
+                    GDALDataset::ToHandle(poTmpDS.get()),
+                    GDALDataset::ToHandle(poDstOvrBandDS), nullptr, nullptr,
+                    nullptr);
+            }
+            else
+            {
+                for (int i = 0; l_eErr == CE_None && i < nBands; ++i)
+                {
+                    l_eErr = GDALRasterBandCopyWholeRaster(
+                        GDALRasterBand::ToHandle(poTmpDS->GetRasterBand(i + 1)),
+                        GDALRasterBand::ToHandle(
+                            papapoOverviewBands[i][iOverview]),
+                        nullptr, nullptr, nullptr);
+                }
             }
         }
 
-        // Structure describing a resampling job
-        struct OvrJob
-        {
-            // Buffers to free when job is finished
-            std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
-            std::unique_ptr<PointerHolder> oSrcBufferHolder{};
-            std::unique_ptr<PointerHolder> oDstBufferHolder{};
-
-            GDALRasterBand *poDstBand = nullptr;
-
-            // Input parameters of pfnResampleFn
-            GDALResampleFunction pfnResampleFn = nullptr;
-            GDALOverviewResampleArgs args{};
-            const void *pChunk = nullptr;
-
-            // Output values of resampling function
-            CPLErr eErr = CE_Failure;
-            void *pDstBuffer = nullptr;
-            GDALDataType eDstBufferDataType = GDT_Unknown;
-
-            // Synchronization
-            bool bFinished = false;
-            std::mutex mutex{};
-            std::condition_variable cv{};
-        };
-
-        // Thread function to resample
-        const auto JobResampleFunc = [](void *pData)
-        {
-            OvrJob *poJob = static_cast<OvrJob *>(pData);
+        return l_eErr;
+    };
 
-            poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
-                                               &(poJob->pDstBuffer),
-                                               &(poJob->eDstBufferDataType));
+    // Structure describing a resampling job
+    struct OvrJob
+    {
+        // Buffers to free when job is finished
+        std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
+        std::unique_ptr<PointerHolder> oSrcBufferHolder{};
+        std::unique_ptr<PointerHolder> oDstBufferHolder{};
 
-            poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
+        GDALRasterBand *poDstBand = nullptr;
 
-            {
-                std::lock_guard<std::mutex> guard(poJob->mutex);
-                poJob->bFinished = true;
-                poJob->cv.notify_one();
-            }
-        };
+        // Input parameters of pfnResampleFn
+        GDALResampleFunction pfnResampleFn = nullptr;
+        GDALOverviewResampleArgs args{};
+        const void *pChunk = nullptr;
+
+        // Output values of resampling function
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+
+        // Synchronization
+        bool bFinished = false;
+        std::mutex mutex{};
+        std::condition_variable cv{};
+    };
+
+    // Thread function to resample
+    const auto JobResampleFunc = [](void *pData)
+    {
+        OvrJob *poJob = static_cast<OvrJob *>(pData);
+
+        poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
+                                           &(poJob->pDstBuffer),
+                                           &(poJob->eDstBufferDataType));
+
+        poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
 
-        // Function to write resample data to target band
-        const auto WriteJobData = [](const OvrJob *poJob)
         {
-            return poJob->poDstBand->RasterIO(
-                GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff,
-                poJob->eDstBufferDataType, 0, 0, nullptr);
-        };
-
-        // Wait for completion of oldest job and serialize it
-        const auto WaitAndFinalizeOldestJob =
-            [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
+            std::lock_guard<std::mutex> guard(poJob->mutex);
+            poJob->bFinished = true;
+            poJob->cv.notify_one();
+        }
+    };
+
+    // Function to write resample data to target band
+    const auto WriteJobData = [](const OvrJob *poJob)
+    {
+        return poJob->poDstBand->RasterIO(
+            GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff,
+            poJob->eDstBufferDataType, 0, 0, nullptr);
+    };
+
+    // Wait for completion of oldest job and serialize it
+    const auto WaitAndFinalizeOldestJob =
+        [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
+    {
+        auto poOldestJob = jobList.front().get();
         {
-            auto poOldestJob = jobList.front().get();
-            {
-                std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
-                // coverity[missing_lock:FALSE]
-                while (!poOldestJob->bFinished)
-                {
-                    poOldestJob->cv.wait(oGuard);
-                }
-            }
-            CPLErr l_eErr = poOldestJob->eErr;
-            if (l_eErr == CE_None)
+            std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
+            // coverity[missing_lock:FALSE]
+            while (!poOldestJob->bFinished)
             {
-                l_eErr = WriteJobData(poOldestJob);
+                poOldestJob->cv.wait(oGuard);
             }
+        }
+        CPLErr l_eErr = poOldestJob->eErr;
+        if (l_eErr == CE_None)
+        {
+            l_eErr = WriteJobData(poOldestJob);
+        }
 
-            jobList.pop_front();
-            return l_eErr;
-        };
+        jobList.pop_front();
+        return l_eErr;
+    };
+
+    // Wait for all pending jobs to complete
+    const auto WaitAllJobs =
+        [WaitAndFinalizeOldestJob](std::list<std::unique_ptr<OvrJob>> &jobList)
+    {
+        CPLErr l_eErr = CE_None;
+        while (!jobList.empty())
+        {
+            const auto l_eErr2 = WaitAndFinalizeOldestJob(jobList);
+            if (l_eErr2 != CE_None && l_eErr == CE_None)
+                l_eErr = l_eErr2;
+        }
+        return l_eErr;
+    };
 
-        // Queue of jobs
-        std::list<std::unique_ptr<OvrJob>> jobList;
+    // Queue of jobs
+    std::list<std::unique_ptr<OvrJob>> jobList;
 
-        std::vector<void *> apaChunk(nBands);
-        std::vector<GByte *> apabyChunkNoDataMask(nBands);
+    // Number of source lines (of the previous level, or of the source bands)
+    // needed to compute the strip of oLevel starting at nDstYOff
+    const auto GetStripSrcYEnd = [nKernelRadius](const OvrLevel &oLevel,
+                                                 int nDstYOff)
+    {
+        const int nDstYCount =
+            std::min(oLevel.nDstChunkYSize, oLevel.nDstYOffEnd - nDstYOff);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * oLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > oLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstTotalHeight)
+            nChunkYOff2 = oLevel.nSrcHeight;
+        return std::min(oLevel.nSrcHeight,
+                        nChunkYOff2 + nKernelRadius * oLevel.nOvrFactor);
+    };
+
+    // Compute the strip of destination lines of an overview level starting
+    // at oLevel.nNextDstYOff, and advance oLevel.nNextDstYOff.
+    const auto ProcessStrip = [&](int iOverview, OvrLevel &oLevel)
+    {
+        CPLErr l_eErr = CE_None;
+        const int iSrcOverview = oLevel.iSrcOverview;
+        const int nSrcWidth = oLevel.nSrcWidth;
+        const int nSrcHeight = oLevel.nSrcHeight;
+        const double dfXRatioDstToSrc = oLevel.dfXRatioDstToSrc;
+        const double dfYRatioDstToSrc = oLevel.dfYRatioDstToSrc;
+        const int nOvrFactor = oLevel.nOvrFactor;
+        const int nDstChunkXSize = oLevel.nDstChunkXSize;
+        const int nDstChunkYSize = oLevel.nDstChunkYSize;
+        const int nFullResXChunkQueried = oLevel.nFullResXChunkQueried;
+        const int nFullResYChunkQueried = oLevel.nFullResYChunkQueried;
+        auto &apaChunk = oLevel.apaChunk;
+        auto &apabyChunkNoDataMask = oLevel.apabyChunkNoDataMask;
+
+        const int nDstYOff = oLevel.nNextDstYOff;
+        int nDstYCount;
+        if (nDstYOff + nDstChunkYSize <= oLevel.nDstYOffEnd)
+            nDstYCount = nDstChunkYSize;
+        else
+            nDstYCount = oLevel.nDstYOffEnd - nDstYOff;
+        oLevel.nNextDstYOff += nDstYCount;
+
+        int nChunkYOff = static_cast<int>(nDstYOff * dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
+        if (nChunkYOff2 > nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstTotalHeight)
+            nChunkYOff2 = nSrcHeight;
+        int nYCount = nChunkYOff2 - nChunkYOff;
+        CPLAssert(nYCount <= oLevel.nFullResYChunk);
+
+        int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
+        int nChunkYSizeQueried = nYCount + 2 * nKernelRadius * nOvrFactor;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > nSrcHeight)
+            nChunkYSizeQueried = nSrcHeight - nChunkYOffQueried;
+        CPLAssert(nChunkYSizeQueried <= nFullResYChunkQueried);
+
+        if (!pfnProgress(dfCurPixelCount / dfTotalPixelCount, nullptr,
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            l_eErr = CE_Failure;
+        }
 
         // Iterate on destination overview, block by block.
-        for (int nDstYOff = nDstYOffStart;
-             nDstYOff < nDstYOffEnd && eErr == CE_None;
-             nDstYOff += nDstChunkYSize)
+        for (int nDstXOff = oLevel.nDstXOffStart;
+             nDstXOff < oLevel.nDstXOffEnd && l_eErr == CE_None;
+             nDstXOff += nDstChunkXSize)
         {
-            int nDstYCount;
-            if (nDstYOff + nDstChunkYSize <= nDstYOffEnd)
-                nDstYCount = nDstChunkYSize;
+            int nDstXCount = 0;
+            if (nDstXOff + nDstChunkXSize <= oLevel.nDstXOffEnd)
+                nDstXCount = nDstChunkXSize;
             else
-                nDstYCount = nDstYOffEnd - nDstYOff;
-
-            int nChunkYOff = static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = static_cast<int>(
-                ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
-            if (nChunkYOff2 > nSrcHeight ||
-                nDstYOff + nDstYCount == nDstTotalHeight)
-                nChunkYOff2 = nSrcHeight;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
-            int nChunkYSizeQueried = nYCount + 2 * nKernelRadius * nOvrFactor;
-            if (nChunkYOffQueried < 0)
+                nDstXCount = oLevel.nDstXOffEnd - nDstXOff;
+
+            dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
+
+            int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
+            if (nChunkXOff2 > nSrcWidth ||
+                nDstXOff + nDstXCount == oLevel.nDstTotalWidth)
+                nChunkXOff2 = nSrcWidth;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+            CPLAssert(nXCount <= oLevel.nFullResXChunk);
+
+            int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
+            int nChunkXSizeQueried = nXCount + 2 * nKernelRadius * nOvrFactor;
+            if (nChunkXOffQueried < 0)
             {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
             }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nSrcHeight)
-                nChunkYSizeQueried = nSrcHeight - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYChunkQueried);
-
-            if (!pfnProgress(dfCurPixelCount / dfTotalPixelCount, nullptr,
-                             pProgressData))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
-            }
-
-            // Iterate on destination overview, block by block.
-            for (int nDstXOff = nDstXOffStart;
-                 nDstXOff < nDstXOffEnd && eErr == CE_None;
-                 nDstXOff += nDstChunkXSize)
-            {
-                int nDstXCount = 0;
-                if (nDstXOff + nDstChunkXSize <= nDstXOffEnd)
-                    nDstXCount = nDstChunkXSize;
-                else
-                    nDstXCount = nDstXOffEnd - nDstXOff;
-
-                dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
-
-                int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 = static_cast<int>(
-                    ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nSrcWidth ||
-                    nDstXOff + nDstXCount == nDstTotalWidth)
-                    nChunkXOff2 = nSrcWidth;
-                const int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
-                int nChunkXSizeQueried =
-                    nXCount + 2 * nKernelRadius * nOvrFactor;
-                if (nChunkXOffQueried < 0)
-                {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
-                }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nSrcWidth)
-                    nChunkXSizeQueried = nSrcWidth - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXChunkQueried);
+            if (nChunkXSizeQueried + nChunkXOffQueried > nSrcWidth)
+                nChunkXSizeQueried = nSrcWidth - nChunkXOffQueried;
+            CPLAssert(nChunkXSizeQueried <= nFullResXChunkQueried);
 #if DEBUG_VERBOSE
-                CPLDebug("GDAL",
-                         "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
-                         nChunkXOffQueried, nChunkYOffQueried,
-                         nChunkXSizeQueried, nChunkYSizeQueried, nDstXOff,
-                         nDstYOff, nDstXCount, nDstYCount);
+            CPLDebug("GDAL",
+                     "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
+                     nChunkXOffQueried, nChunkYOffQueried, nChunkXSizeQueried,
+                     nChunkYSizeQueried, nDstXOff, nDstYOff, nDstXCount,
+                     nDstYCount);
 #endif
 
-                // Avoid accumulating too many tasks and exhaust RAM
+            // Avoid accumulating too many tasks and exhaust RAM
 
-                // Try to complete already finished jobs
-                while (eErr == CE_None && !jobList.empty())
+            // Try to complete already finished jobs
+            while (l_eErr == CE_None && !jobList.empty())
+            {
+                auto poOldestJob = jobList.front().get();
                 {
-                    auto poOldestJob = jobList.front().get();
-                    {
-                        std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
-                        if (!poOldestJob->bFinished)
-                        {
-                            break;
-                        }
-                    }
-                    eErr = poOldestJob->eErr;
-                    if (eErr == CE_None)
+                    std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
+                    if (!poOldestJob->bFinished)
                     {
-                        eErr = WriteJobData(poOldestJob);
+                        break;
                     }
-
-                    jobList.pop_front();
                 }
-
-                // And in case we have saturated the number of threads,
-                // wait for completion of tasks to go below the threshold.
-                while (eErr == CE_None &&
-                       jobList.size() >= static_cast<size_t>(nThreads))
+                l_eErr = poOldestJob->eErr;
+                if (l_eErr == CE_None)
                 {
-                    eErr = WaitAndFinalizeOldestJob(jobList);
+                    l_eErr = WriteJobData(poOldestJob);
                 }
 
-                // (Re)allocate buffers if needed
-                for (int iBand = 0; iBand < nBands; ++iBand)
+                jobList.pop_front();
+            }
+
+            // And in case we have saturated the number of threads,
+            // wait for completion of tasks to go below the threshold.
+            while (l_eErr == CE_None &&
+                   jobList.size() >= static_cast<size_t>(nThreads))
+            {
+                l_eErr = WaitAndFinalizeOldestJob(jobList);
+            }
+
+            // (Re)allocate buffers if needed
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                if (apaChunk[iBand] == nullptr)
                 {
+                    apaChunk[iBand] = VSI_MALLOC3_VERBOSE(
+                        nFullResXChunkQueried, nFullResYChunkQueried,
+                        nWrkDataTypeSize);
                     if (apaChunk[iBand] == nullptr)
                     {
-                        apaChunk[iBand] = VSI_MALLOC3_VERBOSE(
-                            nFullResXChunkQueried, nFullResYChunkQueried,
-                            nWrkDataTypeSize);
-                        if (apaChunk[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
+                        l_eErr = CE_Failure;
                     }
-                    if (bUseNoDataMask &&
-                        apabyChunkNoDataMask[iBand] == nullptr)
+                }
+                if (bUseNoDataMask && apabyChunkNoDataMask[iBand] == nullptr)
+                {
+                    apabyChunkNoDataMask[iBand] =
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            nFullResXChunkQueried, nFullResYChunkQueried));
+                    if (apabyChunkNoDataMask[iBand] == nullptr)
                     {
-                        apabyChunkNoDataMask[iBand] =
-                            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                                nFullResXChunkQueried, nFullResYChunkQueried));
-                        if (apabyChunkNoDataMask[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
+                        l_eErr = CE_Failure;
                     }
                 }
+            }
 
-                // Read the source buffers for all the bands.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            // Read the source buffers for all the bands.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                GDALRasterBand *poSrcBand = nullptr;
+                if (iSrcOverview == -1)
+                    poSrcBand = papoSrcBands[iBand];
+                else
+                    poSrcBand = papapoOverviewBands[iBand][iSrcOverview];
+                l_eErr = poSrcBand->RasterIO(
+                    GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                    nChunkXSizeQueried, nChunkYSizeQueried, apaChunk[iBand],
+                    nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType, 0, 0,
+                    nullptr);
+
+                if (bUseNoDataMask && l_eErr == CE_None)
                 {
-                    GDALRasterBand *poSrcBand = nullptr;
-                    if (iSrcOverview == -1)
-                        poSrcBand = papoSrcBands[iBand];
-                    else
-                        poSrcBand = papapoOverviewBands[iBand][iSrcOverview];
-                    eErr = poSrcBand->RasterIO(
+                    auto poMaskBand = poSrcBand->IsMaskBand()
+                                          ? poSrcBand
+                                          : poSrcBand->GetMaskBand();
+                    l_eErr = poMaskBand->RasterIO(
                         GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                        nChunkXSizeQueried, nChunkYSizeQueried, apaChunk[iBand],
-                        nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType, 0,
-                        0, nullptr);
+                        nChunkXSizeQueried, nChunkYSizeQueried,
+                        apabyChunkNoDataMask[iBand], nChunkXSizeQueried,
+                        nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+                }
+            }
 
-                    if (bUseNoDataMask && eErr == CE_None)
+            // Compute the resulting overview block.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                auto poJob = std::make_unique<OvrJob>();
+                poJob->pfnResampleFn = pfnResampleFn;
+                poJob->poDstBand = papapoOverviewBands[iBand][iOverview];
+                poJob->args.eOvrDataType =
+                    poJob->poDstBand->GetRasterDataType();
+                poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
+                poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
+                const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
+                    "NBITS", "IMAGE_STRUCTURE");
+                poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
+                poJob->args.dfXRatioDstToSrc = dfXRatioDstToSrc;
+                poJob->args.dfYRatioDstToSrc = dfYRatioDstToSrc;
+                poJob->args.eWrkDataType = eWrkDataType;
+                poJob->pChunk = apaChunk[iBand];
+                poJob->args.pabyChunkNodataMask = apabyChunkNoDataMask[iBand];
+                poJob->args.nChunkXOff = nChunkXOffQueried;
+                poJob->args.nChunkXSize = nChunkXSizeQueried;
+                poJob->args.nChunkYOff = nChunkYOffQueried;
+                poJob->args.nChunkYSize = nChunkYSizeQueried;
+                poJob->args.nDstXOff = nDstXOff;
+                poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
+                poJob->args.nDstYOff = nDstYOff;
+                poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
+                poJob->args.pszResampling = pszResampling;
+                poJob->args.bHasNoData = pabHasNoData[iBand];
+                poJob->args.dfNoDataValue = padfNoDataValue[iBand];
+                poJob->args.eSrcDataType = eDataType;
+                poJob->args.bPropagateNoData = bPropagateNoData;
+
+                if (poJobQueue)
+                {
+                    poJob->oSrcMaskBufferHolder.reset(
+                        new PointerHolder(apabyChunkNoDataMask[iBand]));
+                    apabyChunkNoDataMask[iBand] = nullptr;
+
+                    poJob->oSrcBufferHolder.reset(
+                        new PointerHolder(apaChunk[iBand]));
+                    apaChunk[iBand] = nullptr;
+
+                    poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                    jobList.emplace_back(std::move(poJob));
+                }
+                else
+                {
+                    JobResampleFunc(poJob.get());
+                    l_eErr = poJob->eErr;
+                    if (l_eErr == CE_None)
                     {
-                        auto poMaskBand = poSrcBand->IsMaskBand()
-                                              ? poSrcBand
-                                              : poSrcBand->GetMaskBand();
-                        eErr = poMaskBand->RasterIO(
-                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                            nChunkXSizeQueried, nChunkYSizeQueried,
-                            apabyChunkNoDataMask[iBand], nChunkXSizeQueried,
-                            nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+                        l_eErr = WriteJobData(poJob.get());
                     }
                 }
+            }
+        }
 
-                // Compute the resulting overview block.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
-                {
-                    auto poJob = std::make_unique<OvrJob>();
-                    poJob->pfnResampleFn = pfnResampleFn;
-                    poJob->poDstBand = papapoOverviewBands[iBand][iOverview];
-                    poJob->args.eOvrDataType =
-                        poJob->poDstBand->GetRasterDataType();
-                    poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
-                    poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
-                    const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
-                        "NBITS", "IMAGE_STRUCTURE");
-                    poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-                    poJob->args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    poJob->args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    poJob->args.eWrkDataType = eWrkDataType;
-                    poJob->pChunk = apaChunk[iBand];
-                    poJob->args.pabyChunkNodataMask =
-                        apabyChunkNoDataMask[iBand];
-                    poJob->args.nChunkXOff = nChunkXOffQueried;
-                    poJob->args.nChunkXSize = nChunkXSizeQueried;
-                    poJob->args.nChunkYOff = nChunkYOffQueried;
-                    poJob->args.nChunkYSize = nChunkYSizeQueried;
-                    poJob->args.nDstXOff = nDstXOff;
-                    poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
-                    poJob->args.nDstYOff = nDstYOff;
-                    poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
-                    poJob->args.pszResampling = pszResampling;
-                    poJob->args.bHasNoData = pabHasNoData[iBand];
-                    poJob->args.dfNoDataValue = padfNoDataValue[iBand];
-                    poJob->args.eSrcDataType = eDataType;
-                    poJob->args.bPropagateNoData = bPropagateNoData;
-
-                    if (poJobQueue)
-                    {
-                        poJob->oSrcMaskBufferHolder.reset(
-                            new PointerHolder(apabyChunkNoDataMask[iBand]));
-                        apabyChunkNoDataMask[iBand] = nullptr;
+        return l_eErr;
+    };
+
+    // Free the source buffers of a level, and flush its data to overviews.
+    const auto FinalizeLevel = [nBands, papapoOverviewBands](int iOverview,
+                                                             OvrLevel &oLevel)
+    {
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            CPLFree(oLevel.apaChunk[iBand]);
+            oLevel.apaChunk[iBand] = nullptr;
+            papapoOverviewBands[iBand][iOverview]->FlushCache(false);
 
-                        poJob->oSrcBufferHolder.reset(
-                            new PointerHolder(apaChunk[iBand]));
-                        apaChunk[iBand] = nullptr;
+            CPLFree(oLevel.apabyChunkNoDataMask[iBand]);
+            oLevel.apabyChunkNoDataMask[iBand] = nullptr;
+        }
+    };
 
-                        poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
-                        jobList.emplace_back(std::move(poJob));
-                    }
-                    else
+    // When several levels are computed and none needs a temporary dataset,
+    // they are computed in a single scan of the source bands: each strip of
+    // a level computed from the previous one is emitted as soon as the
+    // lines of the previous level it depends on have been written, so that
+    // they are re-read while still in the block cache, instead of after the
+    // whole previous level has been written (and possibly evicted).
+    bool bStreaming =
+        nOverviews > 1 &&
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_STREAMING", "YES"));
+    for (int iOverview = 0; bStreaming && iOverview < nOverviews; ++iOverview)
+    {
+        if (aoLevels[iOverview].bUseTmpDS)
+            bStreaming = false;
+    }
+
+    if (bStreaming)
+    {
+        const auto IsLevelFinished = [](const OvrLevel &oLevel)
+        { return oLevel.nNextDstYOff >= oLevel.nDstYOffEnd; };
+
+        bool bFinished = false;
+        while (eErr == CE_None && !bFinished)
+        {
+            bFinished = true;
+            for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
+                 ++iOverview)
+            {
+                OvrLevel &oLevel = aoLevels[iOverview];
+                if (oLevel.iSrcOverview < 0)
+                {
+                    // Levels computed from the source bands advance by one
+                    // strip at each iteration of the scan.
+                    if (!IsLevelFinished(oLevel))
+                        eErr = ProcessStrip(iOverview, oLevel);
+                }
+                else
+                {
+                    // Levels computed from the previous level advance as
+                    // much as the lines written in it allow.
+                    const OvrLevel &oSrcLevel = aoLevels[oLevel.iSrcOverview];
+                    while (eErr == CE_None && !IsLevelFinished(oLevel) &&
+                           (IsLevelFinished(oSrcLevel) ||
+                            GetStripSrcYEnd(oLevel, oLevel.nNextDstYOff) <=
+                                oSrcLevel.nNextDstYOff))
                     {
-                        JobResampleFunc(poJob.get());
-                        eErr = poJob->eErr;
+                        // Make sure the source lines have been written.
+                        eErr = WaitAllJobs(jobList);
                         if (eErr == CE_None)
-                        {
-                            eErr = WriteJobData(poJob.get());
-                        }
+                            eErr = ProcessStrip(iOverview, oLevel);
                     }
                 }
+                if (!IsLevelFinished(oLevel))
+                    bFinished = false;
             }
         }
 
-        // Wait for all pending jobs to complete
-        while (!jobList.empty())
+        const auto l_eErr = WaitAllJobs(jobList);
+        if (l_eErr != CE_None && eErr == CE_None)
+            eErr = l_eErr;
+
+        for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
         {
-            const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-            if (l_eErr != CE_None && eErr == CE_None)
-                eErr = l_eErr;
+            FinalizeLevel(iOverview, aoLevels[iOverview]);
         }
-
-        // Flush the data to overviews.
-        for (int iBand = 0; iBand < nBands; ++iBand)
+    }
+    else
+    {
+        for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
+             ++iOverview)
         {
-            CPLFree(apaChunk[iBand]);
-            papapoOverviewBands[iBand][iOverview]->FlushCache(false);
+            OvrLevel &oLevel = aoLevels[iOverview];
+            if (oLevel.bUseTmpDS)
+            {
+                eErr = GenerateLevelThroughTmpDS(iOverview, oLevel);
+                continue;
+            }
+
+            // Iterate on destination overview, block by block.
+            while (oLevel.nNextDstYOff < oLevel.nDstYOffEnd && eErr == CE_None)
+            {
+                eErr = ProcessStrip(iOverview, oLevel);
+            }
+
+            // Wait for all pending jobs to complete
+            const auto l_eErr = WaitAllJobs(jobList);
+            if (l_eErr != CE_None && eErr == CE_None)
+                eErr = l_eErr;
 
-            CPLFree(apabyChunkNoDataMask[iBand]);
+            FinalizeLevel(iOverview, oLevel);
         }
     }
 
@@ -0,0 +1,56 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview resampling kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#include "overview_avx2.h"
+
+#ifdef HAVE_OVERVIEW_AVX2_DISPATCH
+
+#include <immintrin.h>
+
+// Note: this file must not include gdal_priv_templates.hpp or any other
+// header with inline functions that could be instantiated with AVX2
+// instructions and then selected by the linker for non-AVX2 code paths.
+
+/************************************************************************/
+/*            GDALResampleConvolutionVertical_32cols_AVX2()             */
+/************************************************************************/
+
+void GDALResampleConvolutionVertical_32cols_AVX2(
+    const double *CPL_RESTRICT padfChunk, int nStride,
+    const double *CPL_RESTRICT padfWeights, int nSrcLineCount,
+    float *CPL_RESTRICT pafDest)
+{
+    constexpr int NACC = 8;
+    __m256d aAcc[NACC];
+    for (int k = 0; k < NACC; ++k)
+        aAcc[k] = _mm256_setzero_pd();
+
+    // Multiplications and additions are kept separate (no FMA), so that
+    // rounding is the same as in the non-AVX2 code paths.
+    size_t j = 0;
+    for (int i = 0; i < nSrcLineCount; ++i, j += nStride)
+    {
+        const __m256d w = _mm256_broadcast_sd(padfWeights + i);
+        const double *padfLine = padfChunk + j;
+        for (int k = 0; k < NACC; ++k)
+        {
+            const __m256d v = _mm256_loadu_pd(padfLine + 4 * k);
+            aAcc[k] = _mm256_add_pd(aAcc[k], _mm256_mul_pd(v, w));
+        }
+    }
+    for (int k = 0; k < NACC; ++k)
+        _mm_storeu_ps(pafDest + 4 * k, _mm256_cvtpd_ps(aAcc[k]));
+    _mm256_zeroupper();
+}
+
+#endif  // HAVE_OVERVIEW_AVX2_DISPATCH
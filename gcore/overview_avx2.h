@@ -0,0 +1,32 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview resampling kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OVERVIEW_AVX2_H_INCLUDED
+#define OVERVIEW_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_OVERVIEW_AVX2_DISPATCH
+
+// Vertical pass of the convolution resampling, on 32 consecutive columns of
+// the horizontally filtered buffer padfChunk, whose lines are nStride values
+// apart. Values are accumulated in the same order as in the SSE2 and AVX
+// code paths of overview.cpp, so results are identical.
+void GDALResampleConvolutionVertical_32cols_AVX2(
+    const double *CPL_RESTRICT padfChunk, int nStride,
+    const double *CPL_RESTRICT padfWeights, int nSrcLineCount,
+    float *CPL_RESTRICT pafDest);
+
+#endif
+
+#endif /* OVERVIEW_AVX2_H_INCLUDED */
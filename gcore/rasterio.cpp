@@ -25,18 +25,25 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -50,6 +57,8 @@
 #define HAVE_SSE2
 #endif
 
+#include "rasterio_avx2.h"
+
 #ifdef HAVE_SSSE3_AT_COMPILE_TIME
 #include "rasterio_ssse3.h"
 #ifdef __SSSE3__
@@ -214,11 +223,10 @@ CPLErr GDALRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 {
     if (eRWFlag == GF_Write && eFlushBlockErr != CE_None)
     {
-        CPLError(eFlushBlockErr, CPLE_AppDefined,
+        const CPLErr eErr = eFlushBlockErr.exchange(CE_None);
+        CPLError(eErr, CPLE_AppDefined,
                  "An error occurred while writing a dirty block "
                  "from GDALRasterBand::IRasterIO");
-        CPLErr eErr = eFlushBlockErr;
-        eFlushBlockErr = CE_None;
         return eErr;
     }
     if (nBlockXSize <= 0 || nBlockYSize <= 0)
@@ -1049,8 +1057,8 @@ CPLErr GDALRasterBand::RasterIOResampled(
         nDestYOffVirtual = static_cast<int>(dfDestYOff + 0.5);
     }
 
-    // Create a MEM dataset that wraps the output buffer.
-    GDALDataset *poMEMDS;
+    // Resampled values are written in a temporary buffer of the band data
+    // type if the buffer data type is different.
     void *pTempBuffer = nullptr;
     GSpacing nPSMem = nPixelSpace;
     GSpacing nLSMem = nLineSpace;
@@ -1068,26 +1076,27 @@ CPLErr GDALRasterBand::RasterIOResampled(
         eDTMem = eDataType;
     }
 
-    poMEMDS =
-        MEMDataset::Create("", nDestXOffVirtual + nBufXSize,
-                           nDestYOffVirtual + nBufYSize, 0, eDTMem, nullptr);
-    GByte *pabyData = static_cast<GByte *>(pDataMem) -
-                      nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
-    GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
-        poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
-    poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
-
     const char *pszNBITS = GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
     const int nNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-    if (pszNBITS)
-        GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
-            "NBITS", pszNBITS, "IMAGE_STRUCTURE");
 
     CPLErr eErr = CE_None;
 
     // Do the resampling.
     if (bUseWarp)
     {
+        // Create a MEM dataset that wraps the output buffer.
+        GDALDataset *poMEMDS = MEMDataset::Create(
+            "", nDestXOffVirtual + nBufXSize, nDestYOffVirtual + nBufYSize, 0,
+            eDTMem, nullptr);
+        GByte *pabyData = static_cast<GByte *>(pDataMem) -
+                          nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
+        GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+            poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
+        poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
+        if (pszNBITS)
+            GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
+                "NBITS", pszNBITS, "IMAGE_STRUCTURE");
+
         int bHasNoData = FALSE;
         double dfNoDataValue = GetNoDataValue(&bHasNoData);
 
@@ -1199,6 +1208,7 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
         if (hVRTDS)
             GDALClose(hVRTDS);
+        GDALClose(poMEMDS);
     }
     else
     {
@@ -1272,33 +1282,113 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk =
-            VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
-                                nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = GetMaskBand();
         int l_nMaskFlags = GetMaskFlags();
 
         bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
+
+        // Buffers holding a source chunk and its mask.
+        struct ChunkBuffers
         {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
+            void *pChunk = nullptr;
+            GByte *pabyChunkNoDataMask = nullptr;
+
+            ChunkBuffers() = default;
+            ChunkBuffers(const ChunkBuffers &) = delete;
+            ChunkBuffers &operator=(const ChunkBuffers &) = delete;
+
+            ~ChunkBuffers()
+            {
+                VSIFree(pChunk);
+                VSIFree(pabyChunkNoDataMask);
+            }
+        };
+
+        const auto AllocChunkBuffers =
+            [eWrkDataType, nFullResXSizeQueried, nFullResYSizeQueried,
+             bUseNoDataMask]()
         {
-            GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
-            VSIFree(pTempBuffer);
-            return CE_Failure;
-        }
+            auto poBuffers = std::make_unique<ChunkBuffers>();
+            poBuffers->pChunk =
+                VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
+                                    nFullResXSizeQueried, nFullResYSizeQueried);
+            if (bUseNoDataMask)
+            {
+                poBuffers->pabyChunkNoDataMask =
+                    static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                        nFullResXSizeQueried, nFullResYSizeQueried));
+            }
+            if (poBuffers->pChunk == nullptr ||
+                (bUseNoDataMask && poBuffers->pabyChunkNoDataMask == nullptr))
+            {
+                poBuffers.reset();
+            }
+            return poBuffers;
+        };
 
         int nTotalBlocks = ((nBufXSize + nDstBlockXSize - 1) / nDstBlockXSize) *
                            ((nBufYSize + nDstBlockYSize - 1) / nDstBlockYSize);
-        int nBlocksDone = 0;
+
+        // With GDAL_NUM_THREADS, the source chunks are read by this thread,
+        // and resampled by jobs of the global thread pool. Each pending job
+        // owns a set of chunk buffers, which are recycled when it is done.
+        const int nThreads = std::min(
+            nTotalBlocks,
+            CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"),
+                               128));
+        auto poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+        std::mutex oMutex;
+        std::vector<std::unique_ptr<ChunkBuffers>> apoFreeBuffers;
+        CPLErr eJobErr = CE_None;
+        std::atomic<int> nBlocksDone{0};
+
+        std::unique_ptr<ChunkBuffers> poBuffers;
+        if (!poJobQueue)
+        {
+            poBuffers = AllocChunkBuffers();
+            if (!poBuffers)
+            {
+                VSIFree(pTempBuffer);
+                return CE_Failure;
+            }
+        }
+
+        // Resample a chunk and write the result into the output buffer.
+        const GDALColorTable *poColorTable = GetColorTable();
+        const auto ResampleChunk =
+            [pfnResampleFunc, pDataMem, nPSMem, nLSMem, eDTMem,
+             nDestXOffVirtual,
+             nDestYOffVirtual](const GDALOverviewResampleArgs &args,
+                               const void *pChunk)
+        {
+            void *pDstBuffer = nullptr;
+            GDALDataType eDstBufferDataType = GDT_Unknown;
+            const CPLErr eLocalErr =
+                pfnResampleFunc(args, pChunk, &pDstBuffer, &eDstBufferDataType);
+            if (eLocalErr == CE_None)
+            {
+                const int nDstXCount = args.nDstXOff2 - args.nDstXOff;
+                const int nDTSize =
+                    GDALGetDataTypeSizeBytes(eDstBufferDataType);
+                for (int iY = args.nDstYOff; iY < args.nDstYOff2; ++iY)
+                {
+                    GDALCopyWords64(
+                        static_cast<GByte *>(pDstBuffer) +
+                            static_cast<size_t>(iY - args.nDstYOff) *
+                                nDstXCount * nDTSize,
+                        eDstBufferDataType, nDTSize,
+                        static_cast<GByte *>(pDataMem) +
+                            nLSMem * (iY - nDestYOffVirtual) +
+                            nPSMem * (args.nDstXOff - nDestXOffVirtual),
+                        eDTMem, static_cast<int>(nPSMem), nDstXCount);
+                }
+            }
+            CPLFree(pDstBuffer);
+            return eLocalErr;
+        };
 
         int nDstYOff;
         for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
@@ -1365,6 +1455,33 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
                 CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
 
+                if (poJobQueue)
+                {
+                    // Bound the number of pending jobs, and thus the number
+                    // of chunk buffers in use.
+                    poJobQueue->WaitCompletion(nThreads);
+                    std::lock_guard<std::mutex> oLock(oMutex);
+                    eErr = eJobErr;
+                    if (!apoFreeBuffers.empty())
+                    {
+                        poBuffers = std::move(apoFreeBuffers.back());
+                        apoFreeBuffers.pop_back();
+                    }
+                }
+                if (eErr != CE_None)
+                    break;
+                if (!poBuffers)
+                {
+                    poBuffers = AllocChunkBuffers();
+                    if (!poBuffers)
+                    {
+                        eErr = CE_Failure;
+                        break;
+                    }
+                }
+                void *pChunk = poBuffers->pChunk;
+                GByte *pabyChunkNoDataMask = poBuffers->pabyChunkNoDataMask;
+
                 // Read the source buffers.
                 eErr = RasterIO(GF_Read, nChunkXOffQueried, nChunkYOffQueried,
                                 nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
@@ -1416,15 +1533,11 @@ CPLErr GDALRasterBand::RasterIOResampled(
                 if (!bSkipResample && eErr == CE_None)
                 {
                     const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
                     GDALOverviewResampleArgs args;
                     args.eSrcDataType = eDataType;
-                    args.eOvrDataType = poMEMBand->GetRasterDataType();
-                    args.nOvrXSize = poMEMBand->GetXSize();
-                    args.nOvrYSize = poMEMBand->GetYSize();
+                    args.eOvrDataType = eDTMem;
+                    args.nOvrXSize = nDestXOffVirtual + nBufXSize;
+                    args.nOvrYSize = nDestYOffVirtual + nBufYSize;
                     args.nOvrNBITS = nNBITS;
                     args.dfXRatioDstToSrc = dfXRatioDstToSrc;
                     args.dfYRatioDstToSrc = dfYRatioDstToSrc;
@@ -1448,22 +1561,49 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     args.pszResampling = pszResampling;
                     args.bHasNoData = bHasNoData;
                     args.dfNoDataValue = dfNoDataValue;
-                    args.poColorTable = GetColorTable();
+                    args.poColorTable = poColorTable;
                     args.bPropagateNoData = bPropagateNoData;
-                    eErr = pfnResampleFunc(args, pChunk, &pDstBuffer,
-                                           &eDstBufferDataType);
-                    if (eErr == CE_None)
+                    if (poJobQueue)
+                    {
+                        ChunkBuffers *poJobBuffers = poBuffers.release();
+                        const auto ResampleJob =
+                            [&oMutex, &apoFreeBuffers, &eJobErr, &nBlocksDone,
+                             &ResampleChunk, args, poJobBuffers]()
+                        {
+                            std::unique_ptr<ChunkBuffers> poJobBuffersHolder(
+                                poJobBuffers);
+                            const CPLErr eLocalErr =
+                                ResampleChunk(args, poJobBuffers->pChunk);
+                            ++nBlocksDone;
+                            std::lock_guard<std::mutex> oLock(oMutex);
+                            if (eLocalErr != CE_None)
+                                eJobErr = eLocalErr;
+                            apoFreeBuffers.push_back(
+                                std::move(poJobBuffersHolder));
+                        };
+                        if (!poJobQueue->SubmitJob(ResampleJob))
+                        {
+                            delete poJobBuffers;
+                            eErr = CE_Failure;
+                        }
+                    }
+                    else
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        eErr = ResampleChunk(args, pChunk);
+                        ++nBlocksDone;
                     }
-                    CPLFree(pDstBuffer);
+                }
+                else
+                {
+                    ++nBlocksDone;
+                }
+
+                if (poJobQueue && poBuffers)
+                {
+                    std::lock_guard<std::mutex> oLock(oMutex);
+                    apoFreeBuffers.push_back(std::move(poBuffers));
                 }
 
-                nBlocksDone++;
                 if (eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
                     !psExtraArg->pfnProgress(1.0 * nBlocksDone / nTotalBlocks,
                                              "", psExtraArg->pProgressData))
@@ -1473,18 +1613,31 @@ CPLErr GDALRasterBand::RasterIOResampled(
             }
         }
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        if (poJobQueue)
+        {
+            poJobQueue->WaitCompletion();
+            if (eErr == CE_None)
+                eErr = eJobErr;
+            if (eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
+                !psExtraArg->pfnProgress(1.0, "", psExtraArg->pProgressData))
+            {
+                eErr = CE_Failure;
+            }
+        }
     }
 
     if (eBufType != eDataType)
     {
-        CPL_IGNORE_RET_VAL(poMEMDS->GetRasterBand(1)->RasterIO(
-            GF_Read, nDestXOffVirtual, nDestYOffVirtual, nBufXSize, nBufYSize,
-            pData, nBufXSize, nBufYSize, eBufType, nPixelSpace, nLineSpace,
-            nullptr));
+        for (int iY = 0; iY < nBufYSize; ++iY)
+        {
+            GDALCopyWords64(static_cast<const GByte *>(pTempBuffer) +
+                                iY * nLSMem,
+                            eDataType, static_cast<int>(nPSMem),
+                            static_cast<GByte *>(pData) + iY * nLineSpace,
+                            eBufType, static_cast<int>(nPixelSpace),
+                            nBufXSize);
+        }
     }
-    GDALClose(poMEMDS);
     VSIFree(pTempBuffer);
 
     return eErr;
@@ -2036,6 +2189,18 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 2:
             CPLAssert(nWordSkip >= 2 || nWordCount == 1);
+            if (nWordSkip == 2)
+            {
+                // Packed words: use a loop that compilers can vectorize
+                for (int i = 0; i < nWordCount; i++)
+                {
+                    GUInt16 nVal;
+                    memcpy(&nVal, pabyData + 2 * static_cast<size_t>(i), 2);
+                    nVal = CPL_SWAP16(nVal);
+                    memcpy(pabyData + 2 * static_cast<size_t>(i), &nVal, 2);
+                }
+                break;
+            }
             for (int i = 0; i < nWordCount; i++)
             {
                 CPL_SWAP16PTR(pabyData);
@@ -2045,7 +2210,18 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 4:
             CPLAssert(nWordSkip >= 4 || nWordCount == 1);
-            if (CPL_IS_ALIGNED(pabyData, 4) && (nWordSkip % 4) == 0)
+            if (nWordSkip == 4)
+            {
+                // Packed words: use a loop that compilers can vectorize
+                for (int i = 0; i < nWordCount; i++)
+                {
+                    GUInt32 nVal;
+                    memcpy(&nVal, pabyData + 4 * static_cast<size_t>(i), 4);
+                    nVal = CPL_SWAP32(nVal);
+                    memcpy(pabyData + 4 * static_cast<size_t>(i), &nVal, 4);
+                }
+            }
+            else if (CPL_IS_ALIGNED(pabyData, 4) && (nWordSkip % 4) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
                 {
@@ -2066,7 +2242,18 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 8:
             CPLAssert(nWordSkip >= 8 || nWordCount == 1);
-            if (CPL_IS_ALIGNED(pabyData, 8) && (nWordSkip % 8) == 0)
+            if (nWordSkip == 8)
+            {
+                // Packed words: use a loop that compilers can vectorize
+                for (int i = 0; i < nWordCount; i++)
+                {
+                    GUInt64 nVal;
+                    memcpy(&nVal, pabyData + 8 * static_cast<size_t>(i), 8);
+                    nVal = CPL_SWAP64(nVal);
+                    memcpy(pabyData + 8 * static_cast<size_t>(i), &nVal, 8);
+                }
+            }
+            else if (CPL_IS_ALIGNED(pabyData, 8) && (nWordSkip % 8) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
                 {
@@ -2231,6 +2418,81 @@ static void inline GDALCopyWordsT_8atatime(
     }
 }
 
+#ifdef HAVE_AVX2_DISPATCH
+
+/************************************************************************/
+/*                         GDALCopyWordsAVX2()                          */
+/************************************************************************/
+
+// Run pfnKernel, an AVX2 conversion function from rasterio_avx2.cpp, if the
+// CPU supports AVX2. Non-packed input or output values are gathered or
+// scattered through small buffers, so that the conversion itself is always
+// done on packed arrays.
+// Returns false if the conversion has not been done.
+
+template <class Tin, class Tout>
+static bool
+GDALCopyWordsAVX2(size_t (*pfnKernel)(const Tin *CPL_RESTRICT,
+                                      Tout *CPL_RESTRICT, size_t),
+                  const Tin *const CPL_RESTRICT pSrcData, int nSrcPixelStride,
+                  Tout *const CPL_RESTRICT pDstData, int nDstPixelStride,
+                  GPtrDiff_t nWordCount)
+{
+    if (nWordCount < 32 || !CPLHaveRuntimeAVX2())
+        return false;
+
+    const bool bSrcPacked = nSrcPixelStride == static_cast<int>(sizeof(Tin));
+    const bool bDstPacked = nDstPixelStride == static_cast<int>(sizeof(Tout));
+    if (bSrcPacked && bDstPacked)
+    {
+        const size_t nDone =
+            pfnKernel(pSrcData, pDstData, static_cast<size_t>(nWordCount));
+        for (size_t n = nDone; n < static_cast<size_t>(nWordCount); ++n)
+            GDALCopyWord(pSrcData[n], pDstData[n]);
+        return true;
+    }
+
+    constexpr int CHUNK_SIZE = 256;
+    Tin aSrc[CHUNK_SIZE];
+    Tout aDst[CHUNK_SIZE];
+    const GByte *const pabySrc = reinterpret_cast<const GByte *>(pSrcData);
+    GByte *const pabyDst = reinterpret_cast<GByte *>(pDstData);
+    for (GPtrDiff_t i = 0; i < nWordCount; i += CHUNK_SIZE)
+    {
+        const int nChunk =
+            static_cast<int>(std::min<GPtrDiff_t>(CHUNK_SIZE, nWordCount - i));
+        const Tin *pSrcChunk = aSrc;
+        if (bSrcPacked)
+        {
+            pSrcChunk = pSrcData + i;
+        }
+        else
+        {
+            for (int j = 0; j < nChunk; ++j)
+            {
+                memcpy(&aSrc[j], pabySrc + (i + j) * nSrcPixelStride,
+                       sizeof(Tin));
+            }
+        }
+        Tout *const pDstChunk = bDstPacked ? pDstData + i : aDst;
+        const int nDone = static_cast<int>(
+            pfnKernel(pSrcChunk, pDstChunk, static_cast<size_t>(nChunk)));
+        for (int j = nDone; j < nChunk; ++j)
+            GDALCopyWord(pSrcChunk[j], pDstChunk[j]);
+        if (!bDstPacked)
+        {
+            for (int j = 0; j < nChunk; ++j)
+            {
+                memcpy(pabyDst + (i + j) * nDstPixelStride, &aDst[j],
+                       sizeof(Tout));
+            }
+        }
+    }
+    return true;
+}
+
+#endif  // HAVE_AVX2_DISPATCH
+
 #ifdef HAVE_SSE2
 
 template <class Tout>
@@ -2360,6 +2622,12 @@ void GDALCopyWordsT(const GByte *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsByteToFloat32_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2407,6 +2675,12 @@ void GDALCopyWordsT(const GByte *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsByteToFloat64_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2479,6 +2753,12 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsUInt16ToByte_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2516,6 +2796,12 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GInt16 *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsUInt16ToInt16_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2551,6 +2837,12 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsUInt16ToFloat32_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2588,6 +2880,12 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsUInt16ToFloat64_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
@@ -2638,6 +2936,12 @@ void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GUInt16 *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsFloat64ToUInt16_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -2649,6 +2953,12 @@ void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsFloat32ToByte_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -2658,6 +2968,12 @@ void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GInt16 *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsFloat32ToInt16_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -2667,94 +2983,286 @@ void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GUInt16 *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (GDALCopyWordsAVX2(GDALCopyWordsFloat32ToUInt16_AVX2, pSrcData,
+                          nSrcPixelStride, pDstData, nDstPixelStride,
+                          nWordCount))
+        return;
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
 
-/************************************************************************/
-/*                   GDALCopyWordsComplexT()                            */
-/************************************************************************/
-/**
- * Template function, used to copy data from pSrcData into buffer
- * pDstData, with stride nSrcPixelStride in the source data and
- * stride nDstPixelStride in the destination data. Deals with the
- * complex case, where input is complex and output is complex.
- *
- * @param pSrcData the source data buffer
- * @param nSrcPixelStride the stride, in the buffer pSrcData for pixels
- *                      of interest.
- * @param pDstData the destination buffer.
- * @param nDstPixelStride the stride in the buffer pDstData for pixels of
- *                      interest.
- * @param nWordCount the total number of pixel words to copy
- *
- */
-template <class Tin, class Tout>
-inline void GDALCopyWordsComplexT(const Tin *const CPL_RESTRICT pSrcData,
-                                  int nSrcPixelStride,
-                                  Tout *const CPL_RESTRICT pDstData,
-                                  int nDstPixelStride, GPtrDiff_t nWordCount)
-{
-    decltype(nWordCount) nDstOffset = 0;
-    const char *const pSrcDataPtr = reinterpret_cast<const char *>(pSrcData);
-    char *const pDstDataPtr = reinterpret_cast<char *>(pDstData);
+#ifdef HAVE_AVX2_DISPATCH
 
-    for (decltype(nWordCount) n = 0; n < nWordCount; n++)
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt16ToByte_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
     {
-        const Tin *const pPixelIn =
-            reinterpret_cast<const Tin *>(pSrcDataPtr + n * nSrcPixelStride);
-        Tout *const pPixelOut =
-            reinterpret_cast<Tout *>(pDstDataPtr + nDstOffset);
-
-        GDALCopyWord(pPixelIn[0], pPixelOut[0]);
-        GDALCopyWord(pPixelIn[1], pPixelOut[1]);
-
-        nDstOffset += nDstPixelStride;
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
     }
 }
 
-/************************************************************************/
-/*                   GDALCopyWordsComplexOutT()                         */
-/************************************************************************/
-/**
- * Template function, used to copy data from pSrcData into buffer
- * pDstData, with stride nSrcPixelStride in the source data and
- * stride nDstPixelStride in the destination data. Deals with the
- * case where the value is real coming in, but complex going out.
- *
- * @param pSrcData the source data buffer
- * @param nSrcPixelStride the stride, in the buffer pSrcData for pixels
- *                      of interest, in bytes.
- * @param pDstData the destination buffer.
- * @param nDstPixelStride the stride in the buffer pDstData for pixels of
- *                      interest, in bytes.
- * @param nWordCount the total number of pixel words to copy
- *
- */
-template <class Tin, class Tout>
-inline void GDALCopyWordsComplexOutT(const Tin *const CPL_RESTRICT pSrcData,
-                                     int nSrcPixelStride,
-                                     Tout *const CPL_RESTRICT pDstData,
-                                     int nDstPixelStride, GPtrDiff_t nWordCount)
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GUInt16 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
 {
-    decltype(nWordCount) nDstOffset = 0;
-
-    const Tout tOutZero = static_cast<Tout>(0);
-
-    const char *const pSrcDataPtr = reinterpret_cast<const char *>(pSrcData);
-    char *const pDstDataPtr = reinterpret_cast<char *>(pDstData);
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt16ToUInt16_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
 
-    for (decltype(nWordCount) n = 0; n < nWordCount; n++)
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt16ToFloat32_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
     {
-        const Tin tValue =
-            *reinterpret_cast<const Tin *>(pSrcDataPtr + n * nSrcPixelStride);
-        Tout *const pPixelOut =
-            reinterpret_cast<Tout *>(pDstDataPtr + nDstOffset);
-        GDALCopyWord(tValue, *pPixelOut);
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
 
-        pPixelOut[1] = tOutZero;
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt16ToFloat64_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
 
-        nDstOffset += nDstPixelStride;
+template <>
+void GDALCopyWordsT(const GInt32 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt32ToByte_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const GInt32 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GInt16 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt32ToInt16_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const GInt32 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GUInt16 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt32ToUInt16_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const GInt32 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsInt32ToFloat64_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsFloat32ToFloat64_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsFloat64ToByte_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GInt16 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsFloat64ToInt16_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GInt32 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsFloat64ToInt32_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (!GDALCopyWordsAVX2(GDALCopyWordsFloat64ToFloat32_AVX2, pSrcData,
+                           nSrcPixelStride, pDstData, nDstPixelStride,
+                           nWordCount))
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+#endif  // HAVE_AVX2_DISPATCH
+
+/************************************************************************/
+/*                   GDALCopyWordsComplexT()                            */
+/************************************************************************/
+/**
+ * Template function, used to copy data from pSrcData into buffer
+ * pDstData, with stride nSrcPixelStride in the source data and
+ * stride nDstPixelStride in the destination data. Deals with the
+ * complex case, where input is complex and output is complex.
+ *
+ * @param pSrcData the source data buffer
+ * @param nSrcPixelStride the stride, in the buffer pSrcData for pixels
+ *                      of interest.
+ * @param pDstData the destination buffer.
+ * @param nDstPixelStride the stride in the buffer pDstData for pixels of
+ *                      interest.
+ * @param nWordCount the total number of pixel words to copy
+ *
+ */
+template <class Tin, class Tout>
+inline void GDALCopyWordsComplexT(const Tin *const CPL_RESTRICT pSrcData,
+                                  int nSrcPixelStride,
+                                  Tout *const CPL_RESTRICT pDstData,
+                                  int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) nDstOffset = 0;
+    const char *const pSrcDataPtr = reinterpret_cast<const char *>(pSrcData);
+    char *const pDstDataPtr = reinterpret_cast<char *>(pDstData);
+
+    for (decltype(nWordCount) n = 0; n < nWordCount; n++)
+    {
+        const Tin *const pPixelIn =
+            reinterpret_cast<const Tin *>(pSrcDataPtr + n * nSrcPixelStride);
+        Tout *const pPixelOut =
+            reinterpret_cast<Tout *>(pDstDataPtr + nDstOffset);
+
+        GDALCopyWord(pPixelIn[0], pPixelOut[0]);
+        GDALCopyWord(pPixelIn[1], pPixelOut[1]);
+
+        nDstOffset += nDstPixelStride;
+    }
+}
+
+/************************************************************************/
+/*                   GDALCopyWordsComplexOutT()                         */
+/************************************************************************/
+/**
+ * Template function, used to copy data from pSrcData into buffer
+ * pDstData, with stride nSrcPixelStride in the source data and
+ * stride nDstPixelStride in the destination data. Deals with the
+ * case where the value is real coming in, but complex going out.
+ *
+ * @param pSrcData the source data buffer
+ * @param nSrcPixelStride the stride, in the buffer pSrcData for pixels
+ *                      of interest, in bytes.
+ * @param pDstData the destination buffer.
+ * @param nDstPixelStride the stride in the buffer pDstData for pixels of
+ *                      interest, in bytes.
+ * @param nWordCount the total number of pixel words to copy
+ *
+ */
+template <class Tin, class Tout>
+inline void GDALCopyWordsComplexOutT(const Tin *const CPL_RESTRICT pSrcData,
+                                     int nSrcPixelStride,
+                                     Tout *const CPL_RESTRICT pDstData,
+                                     int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) nDstOffset = 0;
+
+    const Tout tOutZero = static_cast<Tout>(0);
+
+    const char *const pSrcDataPtr = reinterpret_cast<const char *>(pSrcData);
+    char *const pDstDataPtr = reinterpret_cast<char *>(pDstData);
+
+    for (decltype(nWordCount) n = 0; n < nWordCount; n++)
+    {
+        const Tin tValue =
+            *reinterpret_cast<const Tin *>(pSrcDataPtr + n * nSrcPixelStride);
+        Tout *const pPixelOut =
+            reinterpret_cast<Tout *>(pDstDataPtr + nDstOffset);
+        GDALCopyWord(tValue, *pPixelOut);
+
+        pPixelOut[1] = tOutZero;
+
+        nDstOffset += nDstPixelStride;
     }
 }
 
@@ -3998,6 +4506,98 @@ static int GDALDatasetGetBestOverviewLevel(GDALDataset *poDS, int &nXOff,
                                          psExtraArg);
 }
 
+/************************************************************************/
+/*                 GetConcurrentReadBlockThreadCount()                  */
+/*                                                                      */
+/*      Return the number of threads that BlockBasedRasterIO() may use  */
+/*      to read blocks, or 1 if the driver does not declare             */
+/*      GDAL_DCAP_CONCURRENT_READ_BLOCK.                                */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+int GDALDataset::GetConcurrentReadBlockThreadCount()
+{
+    if (eAccess != GA_ReadOnly || poDriver == nullptr ||
+        !CPLFetchBool(poDriver->GetMetadata(), GDAL_DCAP_CONCURRENT_READ_BLOCK,
+                      false))
+    {
+        return 1;
+    }
+
+    return CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+}
+
+/************************************************************************/
+/*                      ReadBlocksMultiThreaded()                       */
+/*                                                                      */
+/*      Read into the block cache the blocks of the specified range     */
+/*      (bounds included) with several threads of the global thread     */
+/*      pool. Errors are silenced: failed blocks will be read again,    */
+/*      and the error reported, by the caller.                          */
+/************************************************************************/
+
+void GDALDataset::ReadBlocksMultiThreaded(int nThreads, int nBlockXStart,
+                                          int nBlockXEnd, int nBlockYStart,
+                                          int nBlockYEnd, int nBandCount,
+                                          const int *panBandMap)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    // Initializing the block cache is not thread-safe.
+    for (int iBand = 0; iBand < nBandCount; ++iBand)
+    {
+        if (!GetRasterBand(panBandMap[iBand])->InitBlockInfo())
+            return;
+    }
+
+    // All the bands of a block are read by the same thread, as reading a
+    // block of a band of pixel-interleaved formats (JPEG, PNG, GPKG, ...)
+    // also loads the blocks of its sibling bands into the block cache, which
+    // must not be done concurrently for the same block.
+    const int nBlocksPerRow = nBlockXEnd - nBlockXStart + 1;
+    const size_t nBlocks = static_cast<size_t>(nBlocksPerRow) *
+                           (nBlockYEnd - nBlockYStart + 1);
+    std::atomic<size_t> nNextBlock{0};
+    const auto ReadBlocks = [this, &nNextBlock, nBlocks, nBlocksPerRow,
+                             nBlockXStart, nBlockYStart, nBandCount,
+                             panBandMap]()
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        while (true)
+        {
+            const size_t iBlock = nNextBlock++;
+            if (iBlock >= nBlocks)
+                break;
+            const int nBlockXOff =
+                nBlockXStart + static_cast<int>(iBlock % nBlocksPerRow);
+            const int nBlockYOff =
+                nBlockYStart + static_cast<int>(iBlock / nBlocksPerRow);
+            for (int iBand = 0; iBand < nBandCount; ++iBand)
+            {
+                GDALRasterBlock *poBlock =
+                    GetRasterBand(panBandMap[iBand])
+                        ->GetLockedBlockRef(nBlockXOff, nBlockYOff);
+                if (poBlock)
+                    poBlock->DropLock();
+            }
+        }
+    };
+
+    const int nJobs =
+        static_cast<int>(std::min(static_cast<size_t>(nThreads), nBlocks));
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poJobQueue->SubmitJob(ReadBlocks))
+            break;
+    }
+    poJobQueue->WaitCompletion();
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                         BlockBasedRasterIO()                         */
 /*                                                                      */
@@ -4107,9 +4707,46 @@ CPLErr GDALDataset::BlockBasedRasterIO(
         int nChunkYSize = 0;
         int nChunkXSize = 0;
 
+        // If the driver supports it, read blocks into the block cache with
+        // several threads, by batches of block rows that fit in half of the
+        // cache, before copying them to the user buffer.
+        const int nBlockXStart = nXOff / nBlockXSize;
+        const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+        const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+        int nThreads =
+            eRWFlag == GF_Read ? GetConcurrentReadBlockThreadCount() : 1;
+        int nBlockRowsPerBatch = 0;
+        if (nThreads > 1)
+        {
+            const GIntBig nBlockRowSize =
+                static_cast<GIntBig>(nBlockXSize) * nBlockYSize *
+                GDALGetDataTypeSizeBytes(eDataType) * nBandCount *
+                (nBlockXEnd - nBlockXStart + 1);
+            nBlockRowsPerBatch = static_cast<int>(std::min<GIntBig>(
+                INT_MAX, GDALGetCacheMax64() / 2 / nBlockRowSize));
+            if (nBlockRowsPerBatch == 0 ||
+                (nBlockXStart == nBlockXEnd &&
+                 nYOff / nBlockYSize == nBlockYEnd))
+            {
+                nThreads = 1;
+            }
+        }
+        int nBlockYNextBatch = 0;
+
         for (iBufYOff = 0; iBufYOff < nBufYSize; iBufYOff += nChunkYSize)
         {
             const int nChunkYOff = iBufYOff + nYOff;
+            if (nThreads > 1 && nChunkYOff / nBlockYSize >= nBlockYNextBatch)
+            {
+                const int nBlockYStart = nChunkYOff / nBlockYSize;
+                nBlockYNextBatch = static_cast<int>(
+                    std::min<GIntBig>(static_cast<GIntBig>(nBlockYStart) +
+                                          nBlockRowsPerBatch,
+                                      nBlockYEnd + 1));
+                ReadBlocksMultiThreaded(nThreads, nBlockXStart, nBlockXEnd,
+                                        nBlockYStart, nBlockYNextBatch - 1,
+                                        nBandCount, panBandMap);
+            }
             nChunkYSize = nBlockYSize - (nChunkYOff % nBlockYSize);
             if (nChunkYOff + nChunkYSize > nYOff + nYSize)
                 nChunkYSize = (nYOff + nYSize) - nChunkYOff;
@@ -4629,6 +5266,212 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                 GDALCopyWholeRasterCompressedTiles()                 */
+/************************************************************************/
+
+// Copy the raster by transferring the compressed tiles of the source to the
+// destination as they are, when the source exposes them through
+// ReadCompressedData() and the destination accepts them through
+// WriteCompressedData(). Tiles for which that is not possible are decoded and
+// re-encoded as usual.
+// Returns false if this method is not applicable, in which case nothing has
+// been done.
+static bool GDALCopyWholeRasterCompressedTiles(GDALDataset *poSrcDS,
+                                               GDALDataset *poDstDS,
+                                               bool bCheckHoles,
+                                               GDALProgressFunc pfnProgress,
+                                               void *pProgressData,
+                                               CPLErr &eErr)
+{
+    const int nXSize = poDstDS->GetRasterXSize();
+    const int nYSize = poDstDS->GetRasterYSize();
+    const int nBandCount = poDstDS->GetRasterCount();
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poDstDS->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const GDALDataType eDT = poDstDS->GetRasterBand(1)->GetRasterDataType();
+    for (int i = 1; i <= nBandCount; ++i)
+    {
+        int nSrcBlockXSize = 0;
+        int nSrcBlockYSize = 0;
+        poSrcDS->GetRasterBand(i)->GetBlockSize(&nSrcBlockXSize,
+                                                &nSrcBlockYSize);
+        int nDstBlockXSize = 0;
+        int nDstBlockYSize = 0;
+        poDstDS->GetRasterBand(i)->GetBlockSize(&nDstBlockXSize,
+                                                &nDstBlockYSize);
+        if (nSrcBlockXSize != nBlockXSize || nSrcBlockYSize != nBlockYSize ||
+            nDstBlockXSize != nBlockXSize || nDstBlockYSize != nBlockYSize ||
+            poSrcDS->GetRasterBand(i)->GetRasterDataType() != eDT ||
+            poDstDS->GetRasterBand(i)->GetRasterDataType() != eDT)
+        {
+            return false;
+        }
+    }
+
+    // Find a format offered by the source that the destination accepts,
+    // judging from the first tile.
+    std::string osFormat;
+    const CPLStringList aosFormats(poSrcDS->GetCompressionFormats(
+        0, 0, nBlockXSize, nBlockYSize, nBandCount, nullptr));
+    for (const char *pszFormat : aosFormats)
+    {
+        if (poDstDS->WriteCompressedData(pszFormat, 0, 0, nBlockXSize,
+                                         nBlockYSize, nBandCount, nullptr,
+                                         nullptr, 0) == CE_None)
+        {
+            const CPLStringList aosTokens(
+                CSLTokenizeString2(pszFormat, ";", 0));
+            osFormat = aosTokens[0];
+            break;
+        }
+    }
+    if (osFormat.empty())
+        return false;
+
+    CPLDebug("GDAL",
+             "GDALDatasetCopyWholeRaster(): copying %s compressed tiles "
+             "without re-encoding them",
+             osFormat.c_str());
+
+    const int nPixelSize = GDALGetDataTypeSizeBytes(eDT) * nBandCount;
+    std::vector<GByte> abyTile;
+    const int nXBlocks = DIV_ROUND_UP(nXSize, nBlockXSize);
+    const int nYBlocks = DIV_ROUND_UP(nYSize, nBlockYSize);
+    const GIntBig nTotalBlocks = static_cast<GIntBig>(nXBlocks) * nYBlocks;
+    GIntBig nBlocksDone = 0;
+    GIntBig nBlocksCopied = 0;
+
+    eErr = CE_None;
+    for (int iYBlock = 0; iYBlock < nYBlocks && eErr == CE_None; ++iYBlock)
+    {
+        const int iY = iYBlock * nBlockYSize;
+        const int nThisLines = std::min(nBlockYSize, nYSize - iY);
+        for (int iXBlock = 0; iXBlock < nXBlocks && eErr == CE_None;
+             ++iXBlock)
+        {
+            const int iX = iXBlock * nBlockXSize;
+            const int nThisCols = std::min(nBlockXSize, nXSize - iX);
+
+            int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
+            if (bCheckHoles)
+            {
+                nStatus = 0;
+                for (int iBand = 0; iBand < nBandCount; iBand++)
+                {
+                    nStatus |= poSrcDS->GetRasterBand(iBand + 1)
+                                   ->GetDataCoverageStatus(
+                                       iX, iY, nThisCols, nThisLines,
+                                       GDAL_DATA_COVERAGE_STATUS_DATA);
+                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+                        break;
+                }
+            }
+
+            if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+            {
+                bool bCopied = false;
+                const CPLStringList aosTileFormats(
+                    poSrcDS->GetCompressionFormats(iX, iY, nBlockXSize,
+                                                   nBlockYSize, nBandCount,
+                                                   nullptr));
+                bool bFormatAvailable = false;
+                for (const char *pszFormat : aosTileFormats)
+                {
+                    const CPLStringList aosTokens(
+                        CSLTokenizeString2(pszFormat, ";", 0));
+                    if (aosTokens.size() > 0 &&
+                        EQUAL(aosTokens[0], osFormat.c_str()))
+                    {
+                        bFormatAvailable = true;
+                        break;
+                    }
+                }
+
+                void *pBuffer = nullptr;
+                size_t nBufferSize = 0;
+                char *pszDetailedFormat = nullptr;
+                if (bFormatAvailable &&
+                    poSrcDS->ReadCompressedData(
+                        osFormat.c_str(), iX, iY, nBlockXSize, nBlockYSize,
+                        nBandCount, nullptr, &pBuffer, &nBufferSize,
+                        &pszDetailedFormat) == CE_None)
+                {
+                    const char *pszTileFormat = pszDetailedFormat
+                                                    ? pszDetailedFormat
+                                                    : osFormat.c_str();
+                    if (poDstDS->WriteCompressedData(
+                            pszTileFormat, iX, iY, nBlockXSize, nBlockYSize,
+                            nBandCount, nullptr, nullptr, 0) == CE_None)
+                    {
+                        eErr = poDstDS->WriteCompressedData(
+                            pszTileFormat, iX, iY, nBlockXSize, nBlockYSize,
+                            nBandCount, nullptr, pBuffer, nBufferSize);
+                        bCopied = true;
+                        ++nBlocksCopied;
+                    }
+                }
+                VSIFree(pBuffer);
+                VSIFree(pszDetailedFormat);
+
+                if (!bCopied)
+                {
+                    if (abyTile.empty())
+                    {
+                        try
+                        {
+                            abyTile.resize(static_cast<size_t>(nBlockXSize) *
+                                           nBlockYSize * nPixelSize);
+                        }
+                        catch (const std::exception &)
+                        {
+                            CPLError(CE_Failure, CPLE_OutOfMemory,
+                                     "Out of memory allocating tile buffer");
+                            eErr = CE_Failure;
+                            break;
+                        }
+                    }
+                    eErr = poSrcDS->RasterIO(
+                        GF_Read, iX, iY, nThisCols, nThisLines, abyTile.data(),
+                        nThisCols, nThisLines, eDT, nBandCount, nullptr, 0, 0,
+                        0, nullptr);
+                    if (eErr == CE_None)
+                        eErr = poDstDS->RasterIO(
+                            GF_Write, iX, iY, nThisCols, nThisLines,
+                            abyTile.data(), nThisCols, nThisLines, eDT,
+                            nBandCount, nullptr, 0, 0, 0, nullptr);
+                }
+            }
+
+            nBlocksDone++;
+            if (eErr == CE_None &&
+                !pfnProgress(nBlocksDone / static_cast<double>(nTotalBlocks),
+                             nullptr, pProgressData))
+            {
+                eErr = CE_Failure;
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "User terminated CreateCopy()");
+            }
+        }
+    }
+
+    CPLDebug("GDAL",
+             "GDALDatasetCopyWholeRaster(): " CPL_FRMT_GIB
+             " out of " CPL_FRMT_GIB " tiles copied without re-encoding",
+             nBlocksCopied, nTotalBlocks);
+
+    if (eErr == CE_None)
+    {
+        // Flush tiles written through RasterIO(), so that drivers do not
+        // delay them past the compressed tiles written directly.
+        eErr = poDstDS->FlushCache(false);
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4654,6 +5497,20 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"COPY_SRC_COMPRESSED_DATA=YES/NO" to determine whether, when the source
+ * and destination datasets have the same block size, tiles that the source
+ * exposes with GDALDataset::ReadCompressedData() and that the destination
+ * accepts with GDALDataset::WriteCompressedData() may be transferred without
+ * being decompressed and recompressed. Defaults to YES (GDAL &gt;= 3.11)</li>
+ * <li>"READ_AHEAD=YES/NO/N/ALL_CPUS" to read the next swath of the source in
+ * a worker thread while the current one is written, which is worth it when
+ * computing or decoding the source (warping, resampling, JPEG2000, ...) is
+ * costly. With an integer value N, up to N swaths are read at the same time
+ * by N worker threads, provided that the source dataset is, or can be turned
+ * into, a thread-safe dataset (see GDALGetThreadSafeDataset()). Otherwise only
+ * one swath is read ahead. N+1 swath buffers are used. Defaults to the value
+ * of the GDAL_COPY_WHOLE_RASTER_READ_AHEAD configuration option, or NO
+ * (GDAL &gt;= 3.11)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -4720,6 +5577,24 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     GDALRasterBand *poDstPrototypeBand = poDstDS->GetRasterBand(1);
     GDALDataType eDT = poDstPrototypeBand->GetRasterDataType();
 
+    /* -------------------------------------------------------------------- */
+    /*      Can we transfer the compressed tiles of the source as they     */
+    /*      are?                                                            */
+    /* -------------------------------------------------------------------- */
+    const bool bCheckHoles =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
+    if (CPLTestBool(CSLFetchNameValueDef(papszOptions,
+                                         "COPY_SRC_COMPRESSED_DATA", "YES")))
+    {
+        CPLErr eErr = CE_None;
+        if (GDALCopyWholeRasterCompressedTiles(poSrcDS, poDstDS, bCheckHoles,
+                                               pfnProgress, pProgressData,
+                                               eErr))
+        {
+            return eErr;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Do we want to try and do the operation in a pixel               */
     /*      interleaved fashion?                                            */
@@ -4789,175 +5664,265 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     poSrcDS->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nBandCount,
                         nullptr, nullptr);
 
-    /* ==================================================================== */
-    /*      Band oriented (uninterleaved) case.                             */
-    /* ==================================================================== */
-    CPLErr eErr = CE_None;
-    const bool bCheckHoles =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
-
-    if (!bInterleave)
+    /* -------------------------------------------------------------------- */
+    /*      List the swaths to copy: band per band in the band oriented     */
+    /*      case, or all bands at once in the pixel interleaved case.       */
+    /* -------------------------------------------------------------------- */
+    struct Swath
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
-
-        const GIntBig nTotalBlocks = static_cast<GIntBig>(nBandCount) *
-                                     DIV_ROUND_UP(nYSize, nSwathLines) *
-                                     DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
+        int nBand;  // 0 for all bands
+        int iX;
+        int iY;
+        int nCols;
+        int nLines;
+    };
 
-        for (int iBand = 0; iBand < nBandCount && eErr == CE_None; iBand++)
+    std::vector<Swath> aoSwaths;
+    try
+    {
+        for (int iBand = 0; iBand < (bInterleave ? 1 : nBandCount); iBand++)
         {
-            int nBand = iBand + 1;
-
-            for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+            for (int iY = 0; iY < nYSize; iY += nSwathLines)
             {
-                int nThisLines = nSwathLines;
-
-                if (iY + nThisLines > nYSize)
-                    nThisLines = nYSize - iY;
-
-                for (int iX = 0; iX < nXSize && eErr == CE_None;
-                     iX += nSwathCols)
+                for (int iX = 0; iX < nXSize; iX += nSwathCols)
                 {
-                    int nThisCols = nSwathCols;
-
-                    if (iX + nThisCols > nXSize)
-                        nThisCols = nXSize - iX;
-
-                    int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                    if (bCheckHoles)
-                    {
-                        nStatus = poSrcDS->GetRasterBand(nBand)
-                                      ->GetDataCoverageStatus(
-                                          iX, iY, nThisCols, nThisLines,
-                                          GDAL_DATA_COVERAGE_STATUS_DATA);
-                    }
-                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                    {
-                        sExtraArg.pfnProgress = GDALScaledProgress;
-                        sExtraArg.pProgressData = GDALCreateScaledProgress(
-                            nBlocksDone / static_cast<double>(nTotalBlocks),
-                            (nBlocksDone + 0.5) /
-                                static_cast<double>(nTotalBlocks),
-                            pfnProgress, pProgressData);
-                        if (sExtraArg.pProgressData == nullptr)
-                            sExtraArg.pfnProgress = nullptr;
-
-                        eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                                 nThisLines, pSwathBuf,
-                                                 nThisCols, nThisLines, eDT, 1,
-                                                 &nBand, 0, 0, 0, &sExtraArg);
-
-                        GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                        if (eErr == CE_None)
-                            eErr = poDstDS->RasterIO(
-                                GF_Write, iX, iY, nThisCols, nThisLines,
-                                pSwathBuf, nThisCols, nThisLines, eDT, 1,
-                                &nBand, 0, 0, 0, nullptr);
-                    }
-
-                    nBlocksDone++;
-                    if (eErr == CE_None &&
-                        !pfnProgress(nBlocksDone /
-                                         static_cast<double>(nTotalBlocks),
-                                     nullptr, pProgressData))
-                    {
-                        eErr = CE_Failure;
-                        CPLError(CE_Failure, CPLE_UserInterrupt,
-                                 "User terminated CreateCopy()");
-                    }
+                    aoSwaths.push_back({bInterleave ? 0 : iBand + 1, iX, iY,
+                                        std::min(nSwathCols, nXSize - iX),
+                                        std::min(nSwathLines, nYSize - iY)});
                 }
             }
         }
     }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALDatasetCopyWholeRaster()");
+        CPLFree(pSwathBuf);
+        return CE_Failure;
+    }
 
-    /* ==================================================================== */
-    /*      Pixel interleaved case.                                         */
-    /* ==================================================================== */
-    else /* if( bInterleave ) */
+    // Reads a swath from poDS (poSrcDS, or a thread-safe version of it),
+    // unless it is a hole of the source and bCheckHoles is set, in which case
+    // bHasData is set to false.
+    const auto ReadSwath =
+        [nBandCount, eDT, bCheckHoles](GDALDataset *poDS, const Swath &oSwath,
+                                       void *pBuf,
+                                       GDALRasterIOExtraArg *psExtraArg,
+                                       bool &bHasData)
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
+        int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
+        if (bCheckHoles)
+        {
+            nStatus = 0;
+            for (int iBand = 0; iBand < nBandCount; iBand++)
+            {
+                const int nBand = oSwath.nBand ? oSwath.nBand : iBand + 1;
+                nStatus |= poDS->GetRasterBand(nBand)->GetDataCoverageStatus(
+                    oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines,
+                    GDAL_DATA_COVERAGE_STATUS_DATA);
+                if (oSwath.nBand || (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA))
+                    break;
+            }
+        }
+        bHasData = (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+        if (!bHasData)
+            return CE_None;
+
+        int nBand = oSwath.nBand;
+        return poDS->RasterIO(GF_Read, oSwath.iX, oSwath.iY, oSwath.nCols,
+                              oSwath.nLines, pBuf, oSwath.nCols, oSwath.nLines,
+                              eDT, nBand ? 1 : nBandCount,
+                              nBand ? &nBand : nullptr, 0, 0, 0, psExtraArg);
+    };
 
-        const GIntBig nTotalBlocks =
-            static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nSwathLines)) *
-            DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
+    /* -------------------------------------------------------------------- */
+    /*      With READ_AHEAD, the next swath(s) are read by worker threads   */
+    /*      while the current one is written. Swath iSwath uses buffer      */
+    /*      iSwath % (nReadAhead + 1).                                      */
+    /* -------------------------------------------------------------------- */
+    struct ReadAheadResult
+    {
+        CPLErr eErr = CE_None;
+        bool bHasData = true;
+        bool bDone = false;
+        std::unique_ptr<CPLErrorAccumulator> poErrors{};
+    };
+
+    int nReadAhead = 0;
+    const char *pszReadAhead = CSLFetchNameValueDef(
+        papszOptions, "READ_AHEAD",
+        CPLGetConfigOption("GDAL_COPY_WHOLE_RASTER_READ_AHEAD", "NO"));
+    if (EQUAL(pszReadAhead, "ALL_CPUS"))
+        nReadAhead = CPLGetNumCPUs();
+    else if (CPLGetValueType(pszReadAhead) == CPL_VALUE_INTEGER)
+        nReadAhead = std::clamp(atoi(pszReadAhead), 0, 128);
+    else
+        nReadAhead = CPLTestBool(pszReadAhead) ? 1 : 0;
+    nReadAhead = static_cast<int>(
+        std::min(static_cast<size_t>(nReadAhead), aoSwaths.size() - 1));
 
-        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+    // Reading several swaths at the same time requires a thread-safe source
+    GDALDataset *poReadAheadDS = poSrcDS;
+    GDALDataset *poThreadSafeDS = nullptr;
+    if (nReadAhead > 1 && !poSrcDS->IsThreadSafe(GDAL_OF_RASTER))
+    {
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            poThreadSafeDS = GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER);
+        }
+        if (poThreadSafeDS)
         {
-            int nThisLines = nSwathLines;
+            poReadAheadDS = poThreadSafeDS;
+        }
+        else
+        {
+            CPLDebug("GDAL",
+                     "GDALDatasetCopyWholeRaster(): source dataset cannot be "
+                     "made thread-safe. Reading only one swath ahead");
+            nReadAhead = 1;
+        }
+    }
 
-            if (iY + nThisLines > nYSize)
-                nThisLines = nYSize - iY;
+    std::vector<void *> apSwathBufs{pSwathBuf};
+    std::vector<ReadAheadResult> aoReadAheadResults;
+    std::unique_ptr<CPLJobQueue> poReadAheadQueue;
+    std::mutex oReadAheadMutex;
+    std::condition_variable oReadAheadCV;
+    if (nReadAhead > 0)
+    {
+        for (int i = 0; i < nReadAhead; ++i)
+        {
+            void *pBuf =
+                VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
+            if (!pBuf)
+                break;
+            apSwathBufs.push_back(pBuf);
+        }
+        nReadAhead = static_cast<int>(apSwathBufs.size()) - 1;
+        CPLWorkerThreadPool *poThreadPool =
+            nReadAhead > 0 ? GDALGetGlobalThreadPool(nReadAhead) : nullptr;
+        if (poThreadPool)
+        {
+            aoReadAheadResults.resize(apSwathBufs.size());
+            poReadAheadQueue = poThreadPool->CreateJobQueue();
+        }
+    }
 
-            for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
+    const auto SubmitReadAhead =
+        [&aoSwaths, &apSwathBufs, &aoReadAheadResults, &poReadAheadQueue,
+         &oReadAheadMutex, &oReadAheadCV, poReadAheadDS,
+         &ReadSwath](size_t iSwath)
+    {
+        ReadAheadResult *poResult =
+            &aoReadAheadResults[iSwath % aoReadAheadResults.size()];
+        poResult->poErrors = std::make_unique<CPLErrorAccumulator>();
+        poResult->bDone = false;
+        const Swath *poSwath = &aoSwaths[iSwath];
+        void *pBuf = apSwathBufs[iSwath % apSwathBufs.size()];
+        poReadAheadQueue->SubmitJob(
+            [poResult, poSwath, pBuf, poReadAheadDS, &ReadSwath,
+             &oReadAheadMutex, &oReadAheadCV]()
             {
-                int nThisCols = nSwathCols;
-
-                if (iX + nThisCols > nXSize)
-                    nThisCols = nXSize - iX;
-
-                int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                if (bCheckHoles)
                 {
-                    nStatus = 0;
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                    {
-                        nStatus |= poSrcDS->GetRasterBand(iBand + 1)
-                                       ->GetDataCoverageStatus(
-                                           iX, iY, nThisCols, nThisLines,
-                                           GDAL_DATA_COVERAGE_STATUS_DATA);
-                        if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                            break;
-                    }
+                    auto oAccumulator =
+                        poResult->poErrors->InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    poResult->eErr = ReadSwath(poReadAheadDS, *poSwath, pBuf,
+                                               nullptr, poResult->bHasData);
                 }
-                if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                {
-                    sExtraArg.pfnProgress = GDALScaledProgress;
-                    sExtraArg.pProgressData = GDALCreateScaledProgress(
-                        nBlocksDone / static_cast<double>(nTotalBlocks),
-                        (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
-                        pfnProgress, pProgressData);
-                    if (sExtraArg.pProgressData == nullptr)
-                        sExtraArg.pfnProgress = nullptr;
+                std::lock_guard oLock(oReadAheadMutex);
+                poResult->bDone = true;
+                oReadAheadCV.notify_all();
+            });
+    };
 
-                    eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                             nThisLines, pSwathBuf, nThisCols,
-                                             nThisLines, eDT, nBandCount,
-                                             nullptr, 0, 0, 0, &sExtraArg);
+    if (poReadAheadQueue)
+    {
+        CPLDebug("GDAL",
+                 "GDALDatasetCopyWholeRaster(): reading %d swath(s) ahead",
+                 nReadAhead);
+        for (int i = 0; i < nReadAhead; ++i)
+            SubmitReadAhead(i);
+    }
 
-                    GDALDestroyScaledProgress(sExtraArg.pProgressData);
+    /* ==================================================================== */
+    /*      Copy the swaths.                                                */
+    /* ==================================================================== */
+    CPLErr eErr = CE_None;
+    const GIntBig nTotalBlocks = static_cast<GIntBig>(aoSwaths.size());
+    GIntBig nBlocksDone = 0;
 
-                    if (eErr == CE_None)
-                        eErr = poDstDS->RasterIO(
-                            GF_Write, iX, iY, nThisCols, nThisLines, pSwathBuf,
-                            nThisCols, nThisLines, eDT, nBandCount, nullptr, 0,
-                            0, 0, nullptr);
-                }
+    for (size_t iSwath = 0; iSwath < aoSwaths.size() && eErr == CE_None;
+         ++iSwath)
+    {
+        const Swath &oSwath = aoSwaths[iSwath];
+        void *pBuf = apSwathBufs[iSwath % apSwathBufs.size()];
+        bool bHasData = true;
 
-                nBlocksDone++;
-                if (eErr == CE_None &&
-                    !pfnProgress(nBlocksDone /
-                                     static_cast<double>(nTotalBlocks),
-                                 nullptr, pProgressData))
-                {
-                    eErr = CE_Failure;
-                    CPLError(CE_Failure, CPLE_UserInterrupt,
-                             "User terminated CreateCopy()");
-                }
+        if (poReadAheadQueue)
+        {
+            ReadAheadResult &oResult =
+                aoReadAheadResults[iSwath % aoReadAheadResults.size()];
+            {
+                std::unique_lock oLock(oReadAheadMutex);
+                oReadAheadCV.wait(oLock, [&oResult] { return oResult.bDone; });
             }
+            oResult.poErrors->ReplayErrors();
+            eErr = oResult.eErr;
+            bHasData = oResult.bHasData;
+            // The buffer of the previous swath, already written, is reused
+            if (eErr == CE_None && iSwath + nReadAhead < aoSwaths.size())
+                SubmitReadAhead(iSwath + nReadAhead);
+        }
+        else
+        {
+            GDALRasterIOExtraArg sExtraArg;
+            INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+            sExtraArg.pfnProgress = GDALScaledProgress;
+            sExtraArg.pProgressData = GDALCreateScaledProgress(
+                nBlocksDone / static_cast<double>(nTotalBlocks),
+                (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
+                pfnProgress, pProgressData);
+            if (sExtraArg.pProgressData == nullptr)
+                sExtraArg.pfnProgress = nullptr;
+
+            eErr = ReadSwath(poSrcDS, oSwath, pBuf, &sExtraArg, bHasData);
+
+            GDALDestroyScaledProgress(sExtraArg.pProgressData);
+        }
+
+        if (eErr == CE_None && bHasData)
+        {
+            int nBand = oSwath.nBand;
+            eErr = poDstDS->RasterIO(
+                GF_Write, oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines,
+                pBuf, oSwath.nCols, oSwath.nLines, eDT,
+                nBand ? 1 : nBandCount, nBand ? &nBand : nullptr, 0, 0, 0,
+                nullptr);
+        }
+
+        nBlocksDone++;
+        if (eErr == CE_None &&
+            !pfnProgress(nBlocksDone / static_cast<double>(nTotalBlocks),
+                         nullptr, pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
         }
     }
 
+    // Reads ahead may still be pending after an error
+    if (poReadAheadQueue)
+        poReadAheadQueue->WaitCompletion();
+
     /* -------------------------------------------------------------------- */
     /*      Cleanup                                                         */
     /* -------------------------------------------------------------------- */
-    CPLFree(pSwathBuf);
+    for (void *pBuf : apSwathBufs)
+        CPLFree(pBuf);
+    if (poThreadSafeDS)
+        poThreadSafeDS->ReleaseRef();
 
     return eErr;
 }
@@ -5149,6 +6114,8 @@ void GDALCopyRasterIOExtraArg(GDALRasterIOExtraArg *psDestArg,
             psDestArg->dfXSize = psSrcArg->dfXSize;
             psDestArg->dfYSize = psSrcArg->dfYSize;
         }
+        if (psSrcArg->nVersion >= 2)
+            psDestArg->bNoCachePromotion = psSrcArg->bNoCachePromotion;
     }
 }
 
@@ -5595,6 +6562,118 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
 
 #endif
 
+/************************************************************************/
+/*                      GDALDeinterleaveN()                             */
+/************************************************************************/
+
+// Copy of values whose size is sizeof(T), for 2 to 4 components, written so
+// that compilers generate vectorized (de)interleaving code.
+template <class T, int N>
+#if defined(__GNUC__) && !defined(__clang__)
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void GDALDeinterleaveN(const void *pSourceBuffer, void **ppDestBuffer,
+                              size_t nIters)
+{
+    static_assert(N >= 2 && N <= 4);
+    const T *CPL_RESTRICT pSrc = static_cast<const T *>(pSourceBuffer);
+    T *CPL_RESTRICT pDest0 = static_cast<T *>(ppDestBuffer[0]);
+    T *CPL_RESTRICT pDest1 = static_cast<T *>(ppDestBuffer[1]);
+    T *CPL_RESTRICT pDest2 = static_cast<T *>(ppDestBuffer[N >= 3 ? 2 : 1]);
+    T *CPL_RESTRICT pDest3 = static_cast<T *>(ppDestBuffer[N >= 4 ? 3 : 1]);
+    for (size_t i = 0; i < nIters; ++i)
+    {
+        pDest0[i] = pSrc[N * i + 0];
+        pDest1[i] = pSrc[N * i + 1];
+        if constexpr (N >= 3)
+            pDest2[i] = pSrc[N * i + 2];
+        if constexpr (N >= 4)
+            pDest3[i] = pSrc[N * i + 3];
+    }
+}
+
+/************************************************************************/
+/*                       GDALInterleaveN()                              */
+/************************************************************************/
+
+template <class T, int N>
+#if defined(__GNUC__) && !defined(__clang__)
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void GDALInterleaveN(const void *const *ppSourceBuffer,
+                            void *pDestBuffer, size_t nIters)
+{
+    static_assert(N >= 2 && N <= 4);
+    const T *CPL_RESTRICT pSrc0 = static_cast<const T *>(ppSourceBuffer[0]);
+    const T *CPL_RESTRICT pSrc1 = static_cast<const T *>(ppSourceBuffer[1]);
+    const T *CPL_RESTRICT pSrc2 =
+        static_cast<const T *>(ppSourceBuffer[N >= 3 ? 2 : 1]);
+    const T *CPL_RESTRICT pSrc3 =
+        static_cast<const T *>(ppSourceBuffer[N >= 4 ? 3 : 1]);
+    T *CPL_RESTRICT pDest = static_cast<T *>(pDestBuffer);
+    for (size_t i = 0; i < nIters; ++i)
+    {
+        pDest[N * i + 0] = pSrc0[i];
+        pDest[N * i + 1] = pSrc1[i];
+        if constexpr (N >= 3)
+            pDest[N * i + 2] = pSrc2[i];
+        if constexpr (N >= 4)
+            pDest[N * i + 3] = pSrc3[i];
+    }
+}
+
+/************************************************************************/
+/*                    GDALDeinterleaveSameType()                        */
+/************************************************************************/
+
+template <class T>
+static bool GDALDeinterleaveSameType(const void *pSourceBuffer,
+                                     int nComponents, void **ppDestBuffer,
+                                     size_t nIters)
+{
+    switch (nComponents)
+    {
+        case 2:
+            GDALDeinterleaveN<T, 2>(pSourceBuffer, ppDestBuffer, nIters);
+            return true;
+        case 3:
+            GDALDeinterleaveN<T, 3>(pSourceBuffer, ppDestBuffer, nIters);
+            return true;
+        case 4:
+            GDALDeinterleaveN<T, 4>(pSourceBuffer, ppDestBuffer, nIters);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GDALInterleaveSameType()                         */
+/************************************************************************/
+
+template <class T>
+static bool GDALInterleaveSameType(const void *const *ppSourceBuffer,
+                                   int nComponents, void *pDestBuffer,
+                                   size_t nIters)
+{
+    switch (nComponents)
+    {
+        case 2:
+            GDALInterleaveN<T, 2>(ppSourceBuffer, pDestBuffer, nIters);
+            return true;
+        case 3:
+            GDALInterleaveN<T, 3>(ppSourceBuffer, pDestBuffer, nIters);
+            return true;
+        case 4:
+            GDALInterleaveN<T, 4>(ppSourceBuffer, pDestBuffer, nIters);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                      GDALDeinterleave()                              */
 /************************************************************************/
@@ -5610,7 +6689,8 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
     \endverbatim
 
     The implementation is optimized for a few cases, like de-interleaving
-    of 3 or 4-components Byte buffers.
+    of 3 or 4-components Byte buffers, and more generally of 2 to 4 components
+    when eSourceDT == eDestDT.
 
     \since GDAL 3.6
  */
@@ -5695,6 +6775,24 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
 #endif
         }
 #endif
+
+        // Values are copied as unsigned integers of the same size
+        const int nDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+        if ((nDTSize == 1 &&
+             GDALDeinterleaveSameType<uint8_t>(pSourceBuffer, nComponents,
+                                               ppDestBuffer, nIters)) ||
+            (nDTSize == 2 &&
+             GDALDeinterleaveSameType<uint16_t>(pSourceBuffer, nComponents,
+                                                ppDestBuffer, nIters)) ||
+            (nDTSize == 4 &&
+             GDALDeinterleaveSameType<uint32_t>(pSourceBuffer, nComponents,
+                                                ppDestBuffer, nIters)) ||
+            (nDTSize == 8 &&
+             GDALDeinterleaveSameType<uint64_t>(pSourceBuffer, nComponents,
+                                                ppDestBuffer, nIters)))
+        {
+            return;
+        }
     }
 
     const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
@@ -5708,6 +6806,63 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
     }
 }
 
+/************************************************************************/
+/*                        GDALInterleave()                              */
+/************************************************************************/
+
+/*! Copy values from multiple per-component buffers to a pixel-interleave
+    buffer.
+
+    This is the reverse operation of GDALDeinterleave().
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nIters; ++i)
+        for(int iComp = 0; iComp < nComponents; iComp++ )
+            pDestBuffer[nComponents * i + iComp] = ppSourceBuffer[iComp][i]
+    \endverbatim
+
+    The implementation is optimized for 2 to 4 components when
+    eSourceDT == eDestDT.
+
+    \since GDAL 3.11
+ */
+void GDALInterleave(const void *const *ppSourceBuffer, GDALDataType eSourceDT,
+                    int nComponents, void *pDestBuffer, GDALDataType eDestDT,
+                    size_t nIters)
+{
+    if (eSourceDT == eDestDT)
+    {
+        // Values are copied as unsigned integers of the same size
+        const int nDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+        if ((nDTSize == 1 &&
+             GDALInterleaveSameType<uint8_t>(ppSourceBuffer, nComponents,
+                                             pDestBuffer, nIters)) ||
+            (nDTSize == 2 &&
+             GDALInterleaveSameType<uint16_t>(ppSourceBuffer, nComponents,
+                                              pDestBuffer, nIters)) ||
+            (nDTSize == 4 &&
+             GDALInterleaveSameType<uint32_t>(ppSourceBuffer, nComponents,
+                                              pDestBuffer, nIters)) ||
+            (nDTSize == 8 &&
+             GDALInterleaveSameType<uint64_t>(ppSourceBuffer, nComponents,
+                                              pDestBuffer, nIters)))
+        {
+            return;
+        }
+    }
+
+    const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+    const int nDestDTSize = GDALGetDataTypeSizeBytes(eDestDT);
+    for (int iComp = 0; iComp < nComponents; iComp++)
+    {
+        GDALCopyWords64(ppSourceBuffer[iComp], eSourceDT, nSourceDTSize,
+                        static_cast<GByte *>(pDestBuffer) +
+                            iComp * nDestDTSize,
+                        eDestDT, nComponents * nDestDTSize, nIters);
+    }
+}
+
 /************************************************************************/
 /*                    GDALTranspose2DSingleToSingle()                   */
 /************************************************************************/
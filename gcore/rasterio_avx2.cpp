@@ -0,0 +1,517 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of GDALCopyWords()
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#include "rasterio_avx2.h"
+
+#ifdef HAVE_AVX2_DISPATCH
+
+#include <immintrin.h>
+
+#include <limits>
+
+// Note: this file must not include gdal_priv_templates.hpp or any other
+// header with inline functions that could be instantiated with AVX2
+// instructions and then selected by the linker for non-AVX2 code paths.
+
+/************************************************************************/
+/*                          Helper functions                            */
+/************************************************************************/
+
+namespace
+{
+
+inline __m256i LoadU256(const void *p)
+{
+    return _mm256_loadu_si256(static_cast<const __m256i *>(p));
+}
+
+inline __m128i LoadU128(const void *p)
+{
+    return _mm_loadu_si128(static_cast<const __m128i *>(p));
+}
+
+inline void StoreU256(void *p, __m256i v)
+{
+    _mm256_storeu_si256(static_cast<__m256i *>(p), v);
+}
+
+inline void StoreU128(void *p, __m128i v)
+{
+    _mm_storeu_si128(static_cast<__m128i *>(p), v);
+}
+
+// Pack 2 x 8 int32 to 16 int16 with signed saturation, in order.
+inline __m256i PackS32To16(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// Pack 2 x 8 int32 to 16 uint16 with unsigned saturation, in order.
+inline __m256i PackUS32To16(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// Pack 16 int16 to 16 uint8 with unsigned saturation, in order.
+inline __m128i PackUS16To8(__m256i a)
+{
+    return _mm_packus_epi16(_mm256_castsi256_si128(a),
+                            _mm256_extracti128_si256(a, 1));
+}
+
+// Round float values to the nearest unsigned integer as done by
+// GDALCopyWord(), i.e. clamp(x + 0.5, 0, fMax), NaN becoming 0.
+inline __m256i RoundFloatToUnsigned(__m256 x, __m256 ymm_max)
+{
+    const __m256 p0d5 = _mm256_set1_ps(0.5f);
+    x = _mm256_add_ps(x, p0d5);
+    // max(NaN, 0.5) returns 0.5
+    x = _mm256_min_ps(_mm256_max_ps(x, p0d5), ymm_max);
+    return _mm256_cvttps_epi32(x);
+}
+
+// Same for double values.
+inline __m128i RoundDoubleToUnsigned(__m256d x, __m256d ymm_max)
+{
+    const __m256d p0d5 = _mm256_set1_pd(0.5);
+    x = _mm256_add_pd(x, p0d5);
+    // max(NaN, 0.5) returns 0.5
+    x = _mm256_min_pd(_mm256_max_pd(x, p0d5), ymm_max);
+    return _mm256_cvttpd_epi32(x);
+}
+
+// Round float values to the nearest signed integer as done by
+// GDALCopyWord(), i.e. clamp(x >= 0 ? x + 0.5 : x - 0.5, fMin, fMax),
+// NaN becoming 0.
+inline __m256i RoundFloatToSigned(__m256 x, __m256 ymm_min, __m256 ymm_max)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    x = _mm256_and_ps(x, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+    const __m256 mask = _mm256_cmp_ps(x, zero, _CMP_GE_OQ);
+    x = _mm256_add_ps(x, _mm256_blendv_ps(_mm256_set1_ps(-0.5f),
+                                          _mm256_set1_ps(0.5f), mask));
+    x = _mm256_min_ps(_mm256_max_ps(x, ymm_min), ymm_max);
+    return _mm256_cvttps_epi32(x);
+}
+
+// Same for double values, with x > 0 instead of x >= 0.
+inline __m128i RoundDoubleToSigned(__m256d x, __m256d ymm_min,
+                                   __m256d ymm_max)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    x = _mm256_and_pd(x, _mm256_cmp_pd(x, x, _CMP_ORD_Q));
+    const __m256d mask = _mm256_cmp_pd(x, zero, _CMP_GT_OQ);
+    x = _mm256_add_pd(x, _mm256_blendv_pd(_mm256_set1_pd(-0.5),
+                                          _mm256_set1_pd(0.5), mask));
+    x = _mm256_min_pd(_mm256_max_pd(x, ymm_min), ymm_max);
+    return _mm256_cvttpd_epi32(x);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                          From Byte                                   */
+/************************************************************************/
+
+size_t GDALCopyWordsByteToFloat32_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                       float *CPL_RESTRICT pDst, size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m128i xmm = LoadU128(pSrc + i);
+        const __m256i ymm0 = _mm256_cvtepu8_epi32(xmm);
+        const __m256i ymm1 = _mm256_cvtepu8_epi32(_mm_srli_si128(xmm, 8));
+        _mm256_storeu_ps(pDst + i, _mm256_cvtepi32_ps(ymm0));
+        _mm256_storeu_ps(pDst + i + 8, _mm256_cvtepi32_ps(ymm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsByteToFloat64_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                       double *CPL_RESTRICT pDst,
+                                       size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m256i ymm = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pSrc + i)));
+        _mm256_storeu_pd(pDst + i,
+                         _mm256_cvtepi32_pd(_mm256_castsi256_si128(ymm)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtepi32_pd(_mm256_extracti128_si256(ymm, 1)));
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          From Int16                                  */
+/************************************************************************/
+
+size_t GDALCopyWordsInt16ToByte_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst, size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        StoreU128(pDst + i, PackUS16To8(LoadU256(pSrc + i)));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt16ToUInt16_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                       GUInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        StoreU256(pDst + i, _mm256_max_epi16(LoadU256(pSrc + i), zero));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt16ToFloat32_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                        float *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm0 = _mm256_cvtepi16_epi32(LoadU128(pSrc + i));
+        const __m256i ymm1 = _mm256_cvtepi16_epi32(LoadU128(pSrc + i + 8));
+        _mm256_storeu_ps(pDst + i, _mm256_cvtepi32_ps(ymm0));
+        _mm256_storeu_ps(pDst + i + 8, _mm256_cvtepi32_ps(ymm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt16ToFloat64_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                        double *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m256i ymm = _mm256_cvtepi16_epi32(LoadU128(pSrc + i));
+        _mm256_storeu_pd(pDst + i,
+                         _mm256_cvtepi32_pd(_mm256_castsi256_si128(ymm)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtepi32_pd(_mm256_extracti128_si256(ymm, 1)));
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          From UInt16                                 */
+/************************************************************************/
+
+size_t GDALCopyWordsUInt16ToByte_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                      GByte *CPL_RESTRICT pDst, size_t nIters)
+{
+    const __m256i ymm_255 = _mm256_set1_epi16(255);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm = _mm256_min_epu16(LoadU256(pSrc + i), ymm_255);
+        StoreU128(pDst + i, PackUS16To8(ymm));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsUInt16ToInt16_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                       GInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters)
+{
+    const __m256i ymm_32767 = _mm256_set1_epi16(32767);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        StoreU256(pDst + i, _mm256_min_epu16(LoadU256(pSrc + i), ymm_32767));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsUInt16ToFloat32_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm0 = _mm256_cvtepu16_epi32(LoadU128(pSrc + i));
+        const __m256i ymm1 = _mm256_cvtepu16_epi32(LoadU128(pSrc + i + 8));
+        _mm256_storeu_ps(pDst + i, _mm256_cvtepi32_ps(ymm0));
+        _mm256_storeu_ps(pDst + i + 8, _mm256_cvtepi32_ps(ymm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsUInt16ToFloat64_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                         double *CPL_RESTRICT pDst,
+                                         size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m256i ymm = _mm256_cvtepu16_epi32(LoadU128(pSrc + i));
+        _mm256_storeu_pd(pDst + i,
+                         _mm256_cvtepi32_pd(_mm256_castsi256_si128(ymm)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtepi32_pd(_mm256_extracti128_si256(ymm, 1)));
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          From Int32                                  */
+/************************************************************************/
+
+size_t GDALCopyWordsInt32ToByte_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst, size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm =
+            PackS32To16(LoadU256(pSrc + i), LoadU256(pSrc + i + 8));
+        StoreU128(pDst + i, PackUS16To8(ymm));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt32ToInt16_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                      GInt16 *CPL_RESTRICT pDst, size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        StoreU256(pDst + i,
+                  PackS32To16(LoadU256(pSrc + i), LoadU256(pSrc + i + 8)));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt32ToUInt16_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                       GUInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        StoreU256(pDst + i,
+                  PackUS32To16(LoadU256(pSrc + i), LoadU256(pSrc + i + 8)));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsInt32ToFloat64_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                        double *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        _mm256_storeu_pd(pDst + i, _mm256_cvtepi32_pd(LoadU128(pSrc + i)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtepi32_pd(LoadU128(pSrc + i + 4)));
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          From Float32                                */
+/************************************************************************/
+
+size_t GDALCopyWordsFloat32ToByte_AVX2(const float *CPL_RESTRICT pSrc,
+                                       GByte *CPL_RESTRICT pDst, size_t nIters)
+{
+    const __m256 ymm_max = _mm256_set1_ps(255);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm0 =
+            RoundFloatToUnsigned(_mm256_loadu_ps(pSrc + i), ymm_max);
+        const __m256i ymm1 =
+            RoundFloatToUnsigned(_mm256_loadu_ps(pSrc + i + 8), ymm_max);
+        StoreU128(pDst + i, PackUS16To8(PackS32To16(ymm0, ymm1)));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat32ToInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                        GInt16 *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    const __m256 ymm_min = _mm256_set1_ps(-32768);
+    const __m256 ymm_max = _mm256_set1_ps(32767);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm0 =
+            RoundFloatToSigned(_mm256_loadu_ps(pSrc + i), ymm_min, ymm_max);
+        const __m256i ymm1 = RoundFloatToSigned(_mm256_loadu_ps(pSrc + i + 8),
+                                                ymm_min, ymm_max);
+        StoreU256(pDst + i, PackS32To16(ymm0, ymm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat32ToUInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                         GUInt16 *CPL_RESTRICT pDst,
+                                         size_t nIters)
+{
+    const __m256 ymm_max = _mm256_set1_ps(65535);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m256i ymm0 =
+            RoundFloatToUnsigned(_mm256_loadu_ps(pSrc + i), ymm_max);
+        const __m256i ymm1 =
+            RoundFloatToUnsigned(_mm256_loadu_ps(pSrc + i + 8), ymm_max);
+        StoreU256(pDst + i, PackUS32To16(ymm0, ymm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat32ToFloat64_AVX2(const float *CPL_RESTRICT pSrc,
+                                          double *CPL_RESTRICT pDst,
+                                          size_t nIters)
+{
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        _mm256_storeu_pd(pDst + i, _mm256_cvtps_pd(_mm_loadu_ps(pSrc + i)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtps_pd(_mm_loadu_ps(pSrc + i + 4)));
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          From Float64                                */
+/************************************************************************/
+
+size_t GDALCopyWordsFloat64ToByte_AVX2(const double *CPL_RESTRICT pSrc,
+                                       GByte *CPL_RESTRICT pDst, size_t nIters)
+{
+    const __m256d ymm_max = _mm256_set1_pd(255);
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m128i xmm0 =
+            RoundDoubleToUnsigned(_mm256_loadu_pd(pSrc + i), ymm_max);
+        const __m128i xmm1 =
+            RoundDoubleToUnsigned(_mm256_loadu_pd(pSrc + i + 4), ymm_max);
+        __m128i xmm = _mm_packs_epi32(xmm0, xmm1);
+        xmm = _mm_packus_epi16(xmm, xmm);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(pDst + i), xmm);
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat64ToInt16_AVX2(const double *CPL_RESTRICT pSrc,
+                                        GInt16 *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    const __m256d ymm_min = _mm256_set1_pd(-32768);
+    const __m256d ymm_max = _mm256_set1_pd(32767);
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m128i xmm0 =
+            RoundDoubleToSigned(_mm256_loadu_pd(pSrc + i), ymm_min, ymm_max);
+        const __m128i xmm1 = RoundDoubleToSigned(_mm256_loadu_pd(pSrc + i + 4),
+                                                 ymm_min, ymm_max);
+        StoreU128(pDst + i, _mm_packs_epi32(xmm0, xmm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat64ToUInt16_AVX2(const double *CPL_RESTRICT pSrc,
+                                         GUInt16 *CPL_RESTRICT pDst,
+                                         size_t nIters)
+{
+    const __m256d ymm_max = _mm256_set1_pd(65535);
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        const __m128i xmm0 =
+            RoundDoubleToUnsigned(_mm256_loadu_pd(pSrc + i), ymm_max);
+        const __m128i xmm1 =
+            RoundDoubleToUnsigned(_mm256_loadu_pd(pSrc + i + 4), ymm_max);
+        StoreU128(pDst + i, _mm_packus_epi32(xmm0, xmm1));
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat64ToInt32_AVX2(const double *CPL_RESTRICT pSrc,
+                                        GInt32 *CPL_RESTRICT pDst,
+                                        size_t nIters)
+{
+    const __m256d ymm_min =
+        _mm256_set1_pd(std::numeric_limits<GInt32>::lowest());
+    const __m256d ymm_max = _mm256_set1_pd(std::numeric_limits<GInt32>::max());
+    const __m256d zero = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            __m256d x = _mm256_loadu_pd(pSrc + i + 4 * j);
+            x = _mm256_and_pd(x, _mm256_cmp_pd(x, x, _CMP_ORD_Q));
+            const __m256d mask = _mm256_cmp_pd(x, zero, _CMP_GE_OQ);
+            x = _mm256_add_pd(x, _mm256_blendv_pd(_mm256_set1_pd(-0.5),
+                                                  _mm256_set1_pd(0.5), mask));
+            x = _mm256_min_pd(_mm256_max_pd(x, ymm_min), ymm_max);
+            StoreU128(pDst + i + 4 * j, _mm256_cvttpd_epi32(x));
+        }
+    }
+    return i;
+}
+
+size_t GDALCopyWordsFloat64ToFloat32_AVX2(const double *CPL_RESTRICT pSrc,
+                                          float *CPL_RESTRICT pDst,
+                                          size_t nIters)
+{
+    // Values out of the float range become infinity, rather than being
+    // rounded to the largest float value.
+    const __m256d ymm_posmax =
+        _mm256_set1_pd(std::numeric_limits<float>::max());
+    const __m256d ymm_negmax =
+        _mm256_set1_pd(-std::numeric_limits<float>::max());
+    const __m256d ymm_posinf =
+        _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    const __m256d ymm_neginf =
+        _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+    size_t i = 0;
+    for (; i + 8 <= nIters; i += 8)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            __m256d x = _mm256_loadu_pd(pSrc + i + 4 * j);
+            x = _mm256_blendv_pd(x, ymm_posinf,
+                                 _mm256_cmp_pd(x, ymm_posmax, _CMP_GT_OQ));
+            x = _mm256_blendv_pd(x, ymm_neginf,
+                                 _mm256_cmp_pd(x, ymm_negmax, _CMP_LT_OQ));
+            _mm_storeu_ps(pDst + i + 4 * j, _mm256_cvtpd_ps(x));
+        }
+    }
+    return i;
+}
+
+#endif  // HAVE_AVX2_DISPATCH
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of GDALCopyWords()
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX2_H_INCLUDED
+#define RASTERIO_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_AVX2_DISPATCH
+
+// Those functions convert packed arrays of nIters values with the same
+// semantics as GDALCopyWord(). They return the number of values converted,
+// which is nIters rounded down to a multiple of the vector width. The caller
+// is responsible for converting the remaining values.
+
+size_t GDALCopyWordsByteToFloat32_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                       float *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsByteToFloat64_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                       double *CPL_RESTRICT pDst,
+                                       size_t nIters);
+
+size_t GDALCopyWordsInt16ToByte_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsInt16ToUInt16_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                       GUInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters);
+size_t GDALCopyWordsInt16ToFloat32_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                        float *CPL_RESTRICT pDst,
+                                        size_t nIters);
+size_t GDALCopyWordsInt16ToFloat64_AVX2(const GInt16 *CPL_RESTRICT pSrc,
+                                        double *CPL_RESTRICT pDst,
+                                        size_t nIters);
+
+size_t GDALCopyWordsUInt16ToByte_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                      GByte *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsUInt16ToInt16_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                       GInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters);
+size_t GDALCopyWordsUInt16ToFloat32_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         size_t nIters);
+size_t GDALCopyWordsUInt16ToFloat64_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                         double *CPL_RESTRICT pDst,
+                                         size_t nIters);
+
+size_t GDALCopyWordsInt32ToByte_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsInt32ToInt16_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                      GInt16 *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsInt32ToUInt16_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                       GUInt16 *CPL_RESTRICT pDst,
+                                       size_t nIters);
+size_t GDALCopyWordsInt32ToFloat64_AVX2(const GInt32 *CPL_RESTRICT pSrc,
+                                        double *CPL_RESTRICT pDst,
+                                        size_t nIters);
+
+size_t GDALCopyWordsFloat32ToByte_AVX2(const float *CPL_RESTRICT pSrc,
+                                       GByte *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsFloat32ToInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                        GInt16 *CPL_RESTRICT pDst,
+                                        size_t nIters);
+size_t GDALCopyWordsFloat32ToUInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                         GUInt16 *CPL_RESTRICT pDst,
+                                         size_t nIters);
+size_t GDALCopyWordsFloat32ToFloat64_AVX2(const float *CPL_RESTRICT pSrc,
+                                          double *CPL_RESTRICT pDst,
+                                          size_t nIters);
+
+size_t GDALCopyWordsFloat64ToByte_AVX2(const double *CPL_RESTRICT pSrc,
+                                       GByte *CPL_RESTRICT pDst, size_t nIters);
+size_t GDALCopyWordsFloat64ToInt16_AVX2(const double *CPL_RESTRICT pSrc,
+                                        GInt16 *CPL_RESTRICT pDst,
+                                        size_t nIters);
+size_t GDALCopyWordsFloat64ToUInt16_AVX2(const double *CPL_RESTRICT pSrc,
+                                         GUInt16 *CPL_RESTRICT pDst,
+                                         size_t nIters);
+size_t GDALCopyWordsFloat64ToInt32_AVX2(const double *CPL_RESTRICT pSrc,
+                                        GInt32 *CPL_RESTRICT pDst,
+                                        size_t nIters);
+size_t GDALCopyWordsFloat64ToFloat32_AVX2(const double *CPL_RESTRICT pSrc,
+                                          float *CPL_RESTRICT pDst,
+                                          size_t nIters);
+
+#endif
+
+#endif /* RASTERIO_AVX2_H_INCLUDED */
@@ -25,6 +25,7 @@
 #include <fcntl.h>
 #endif
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <vector>
 
@@ -35,8 +36,10 @@
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
 #include "cpl_safemaths.hpp"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           RawRasterBand()                            */
@@ -322,6 +325,9 @@ RawRasterBand::~RawRasterBand()
 
     RawRasterBand::FlushCache(true);
 
+    if (m_psMMap)
+        CPLVirtualMemFree(m_psMMap);
+
     if (bOwnsFP)
     {
         if (VSIFCloseL(fpRawL) != 0)
@@ -1048,6 +1054,177 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                            GetMMapData()                             */
+/************************************************************************/
+
+// Return a pointer to the start of the band data in a read-only memory
+// mapping of the file, or nullptr if it cannot be mapped.
+const GByte *RawRasterBand::GetMMapData()
+{
+    if (!m_bMMapTried)
+    {
+        m_bMMapTried = true;
+
+        const vsi_l_offset nSize =
+            static_cast<vsi_l_offset>(nRasterYSize - 1) * nLineOffset +
+            static_cast<vsi_l_offset>(nRasterXSize - 1) * nPixelOffset +
+            GDALGetDataTypeSizeBytes(eDataType);
+        // Mapping beyond the end of the file would cause SIGBUS errors, and
+        // some formats such as ENVI allow for sparse files.
+        if (static_cast<size_t>(nSize) == nSize &&
+            VSIFSeekL(fpRawL, 0, SEEK_END) == 0 &&
+            VSIFTellL(fpRawL) >= nImgOffset + nSize)
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            m_psMMap = CPLVirtualMemFileMapNew(fpRawL, nImgOffset, nSize,
+                                               VIRTUALMEM_READONLY, nullptr,
+                                               nullptr);
+        }
+        if (m_psMMap)
+            CPLDebug("RAW", "Using memory mapping for band %d", nBand);
+    }
+    return m_psMMap
+               ? static_cast<const GByte *>(CPLVirtualMemGetAddr(m_psMMap))
+               : nullptr;
+}
+
+/************************************************************************/
+/*                           CanUseMMapRead()                           */
+/************************************************************************/
+
+// Return whether a non-resampled read can be served from a memory mapping
+// of the file.
+bool RawRasterBand::CanUseMMapRead(int nXSize, int nYSize, int nBufXSize,
+                                   int nBufYSize)
+{
+    return nXSize == nBufXSize && nYSize == nBufYSize && nPixelOffset >= 0 &&
+           nLineOffset >= 0 && poDS != nullptr &&
+           poDS->GetAccess() == GA_ReadOnly &&
+           CPLTestBool(CPLGetConfigOption("RAW_USE_MMAP", "NO")) &&
+           CPLIsVirtualMemFileMapAvailable() &&
+           VSIFGetNativeFileDescriptorL(fpRawL) != nullptr &&
+           GetMMapData() != nullptr;
+}
+
+/************************************************************************/
+/*                            MMapRasterIO()                            */
+/************************************************************************/
+
+// Read a window from the memory mapping of the file. Lines are processed by
+// several threads when GDAL_NUM_THREADS is set and the request is large
+// enough.
+CPLErr RawRasterBand::MMapRasterIO(int nXOff, int nYOff, int nXSize,
+                                   int nYSize, void *pData,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg)
+{
+    const GByte *pabyMMapData = GetMMapData();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const bool bNeedsByteOrderChange = NeedsByteOrderChange();
+    // If the buffer has the data type of the band, swap bytes in it directly
+    // rather than through a temporary line.
+    const bool bSwapInBuffer = eBufType == eDataType && nPixelSpace > 0 &&
+                               nPixelSpace <= INT_MAX;
+
+    const auto ReadLines = [this, pabyMMapData, nDTSize, bNeedsByteOrderChange,
+                            bSwapInBuffer, nXOff, nYOff, nXSize, pData,
+                            eBufType, nPixelSpace,
+                            nLineSpace](int iStartLine, int iEndLine)
+    {
+        std::vector<GByte> abyLine;
+        if (bNeedsByteOrderChange && !bSwapInBuffer)
+        {
+            try
+            {
+                abyLine.resize(static_cast<size_t>(nXSize) * nDTSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in MMapRasterIO()");
+                return false;
+            }
+        }
+
+        for (int iLine = iStartLine; iLine < iEndLine; ++iLine)
+        {
+            const GByte *pabySrc =
+                pabyMMapData +
+                static_cast<size_t>(nYOff + iLine) * nLineOffset +
+                static_cast<size_t>(nXOff) * nPixelOffset;
+            GByte *pabyDst = static_cast<GByte *>(pData) + iLine * nLineSpace;
+            if (!bNeedsByteOrderChange)
+            {
+                GDALCopyWords64(pabySrc, eDataType, nPixelOffset, pabyDst,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nXSize);
+            }
+            else if (bSwapInBuffer)
+            {
+                GDALCopyWords64(pabySrc, eDataType, nPixelOffset, pabyDst,
+                                eDataType, static_cast<int>(nPixelSpace),
+                                nXSize);
+                DoByteSwap(pabyDst, nXSize, static_cast<int>(nPixelSpace),
+                           true);
+            }
+            else
+            {
+                GDALCopyWords64(pabySrc, eDataType, nPixelOffset,
+                                abyLine.data(), eDataType, nDTSize, nXSize);
+                DoByteSwap(abyLine.data(), nXSize, nDTSize, true);
+                GDALCopyWords64(abyLine.data(), eDataType, nDTSize, pabyDst,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nXSize);
+            }
+        }
+        return true;
+    };
+
+    // Do not bother spawning jobs for less than 1 MB of band data each
+    constexpr GIntBig MIN_BYTES_PER_JOB = 1024 * 1024;
+    int nThreads = static_cast<int>(std::min<GIntBig>(
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128),
+        static_cast<GIntBig>(nXSize) * nYSize * nDTSize / MIN_BYTES_PER_JOB));
+    nThreads = std::min(nThreads, nYSize);
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        std::atomic<bool> bSuccess{true};
+        for (int i = 0; i < nThreads; ++i)
+        {
+            const int iStartLine =
+                static_cast<int>(static_cast<GIntBig>(nYSize) * i / nThreads);
+            const int iEndLine = static_cast<int>(
+                static_cast<GIntBig>(nYSize) * (i + 1) / nThreads);
+            poJobQueue->SubmitJob(
+                [&ReadLines, &bSuccess, iStartLine, iEndLine]()
+                {
+                    if (!ReadLines(iStartLine, iEndLine))
+                        bSuccess = false;
+                });
+        }
+        poJobQueue->WaitCompletion();
+        if (!bSuccess)
+            return CE_Failure;
+    }
+    else if (!ReadLines(0, nYSize))
+    {
+        return CE_Failure;
+    }
+
+    if (psExtraArg->pfnProgress != nullptr &&
+        !psExtraArg->pfnProgress(1.0, "", psExtraArg->pProgressData))
+    {
+        return CE_Failure;
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1069,6 +1246,13 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
+    if (eRWFlag == GF_Read &&
+        CanUseMMapRead(nXSize, nYSize, nBufXSize, nBufYSize))
+    {
+        return MMapRasterIO(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                            nPixelSpace, nLineSpace, psExtraArg);
+    }
+
     if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1612,7 +1796,10 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 bCanUseDirectIO = false;
                 break;
             }
-            else if (!poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
+            else if (!(eRWFlag == GF_Read &&
+                       poBand->CanUseMMapRead(nXSize, nYSize, nBufXSize,
+                                              nBufYSize)) &&
+                     !poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
                                              eBufType, psExtraArg))
             {
                 bCanUseDirectIO = false;
@@ -246,6 +246,17 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     vsi_l_offset ComputeFileOffset(int iLine) const;
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
+
+    // Read-only memory mapping of the band data, when RAW_USE_MMAP is set
+    CPLVirtualMem *m_psMMap = nullptr;
+    bool m_bMMapTried = false;
+
+    const GByte *GetMMapData();
+    bool CanUseMMapRead(int nXSize, int nYSize, int nBufXSize, int nBufYSize);
+    CPLErr MMapRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                        void *pData, GDALDataType eBufType,
+                        GSpacing nPixelSpace, GSpacing nLineSpace,
+                        GDALRasterIOExtraArg *psExtraArg);
 };
 
 #ifdef GDAL_COMPILATION
@@ -51,6 +51,9 @@ typedef int GNMDirection;  // We use int values in order to save them to the
 #define GNM_MD_FETCHVERTEX "fetch_vertex"
 #define GNM_MD_NUM_PATHS "num_paths"
 #define GNM_MD_EMITTER "emitter"
+#define GNM_MD_SOURCE "source"
+#define GNM_MD_TARGET "target"
+#define GNM_MD_NUM_THREADS "num_threads"
 
 // TODO: Constants for capabilities.
 // #define GNMCanChangeConnections "CanChangeConnections"
@@ -59,7 +62,11 @@ typedef enum
 {
     /** Dijkstra shortest path */ GATDijkstraShortestPath = 1,
     /** KShortest Paths        */ GATKShortestPath,
-    /** Recursive Breadth-first search */ GATConnectedComponents
+    /** Recursive Breadth-first search */ GATConnectedComponents,
+    /** Contraction hierarchy shortest path (GDAL >= 3.11) */
+    GATContractionHierarchyShortestPath,
+    /** Many-to-many shortest path costs (GDAL >= 3.11) */
+    GATShortestPathMatrix
 } GNMGraphAlgorithmType;
 
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
@@ -197,6 +197,16 @@ CPLString GNMGenericNetwork::GetAlgorithmName(GNMDirection eAlgorithm,
                 return CPLString("Connected");
             else
                 return CPLString("Connected components");
+        case GATContractionHierarchyShortestPath:
+            if (bShortName)
+                return CPLString("CH");
+            else
+                return CPLString("Contraction hierarchy shortest path");
+        case GATShortestPathMatrix:
+            if (bShortName)
+                return CPLString("Matrix");
+            else
+                return CPLString("Shortest path cost matrix");
     }
 
     return CPLString("Invalid");
@@ -866,6 +876,64 @@ OGRLayer *GNMGenericNetwork::GetPath(GNMGFID nStartFID, GNMGFID nEndFID,
             FillResultLayer(poResLayer, path, 1, bReturnVertices, bReturnEdges);
         }
         break;
+        case GATContractionHierarchyShortestPath:
+        {
+            GNMPATH path =
+                m_oGraph.ContractionHierarchyShortestPath(nStartFID, nEndFID);
+
+            // fill features in result layer
+            FillResultLayer(poResLayer, path, 1, bReturnVertices, bReturnEdges);
+        }
+        break;
+        case GATShortestPathMatrix:
+        {
+            GNMVECTOR anSources, anTargets;
+            const CPLStringList aosSources(
+                CSLFetchNameValueMultiple(papszOptions, GNM_MD_SOURCE));
+            for (const char *pszSource : aosSources)
+                anSources.push_back(CPLAtoGIntBig(pszSource));
+            const CPLStringList aosTargets(
+                CSLFetchNameValueMultiple(papszOptions, GNM_MD_TARGET));
+            for (const char *pszTarget : aosTargets)
+                anTargets.push_back(CPLAtoGIntBig(pszTarget));
+
+            if (nStartFID != -1)
+                anSources.push_back(nStartFID);
+            if (nEndFID != -1)
+                anTargets.push_back(nEndFID);
+
+            const char *pszNumThreads = CSLFetchNameValueDef(
+                papszOptions, GNM_MD_NUM_THREADS,
+                CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+            const int nThreads =
+                std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                  ? CPLGetNumCPUs()
+                                  : atoi(pszNumThreads));
+
+            std::vector<double> adfCosts =
+                m_oGraph.ShortestPathCostMatrix(anSources, anTargets, nThreads);
+
+            // one feature per pair of source and target linked by a path
+            OGRFieldDefn oSourceField(GNM_SYSFIELD_SOURCE, GNMGFIDInt);
+            OGRFieldDefn oTargetField(GNM_SYSFIELD_TARGET, GNMGFIDInt);
+            OGRFieldDefn oCostField(GNM_SYSFIELD_COST, OFTReal);
+            poResLayer->CreateField(&oSourceField);
+            poResLayer->CreateField(&oTargetField);
+            poResLayer->CreateField(&oCostField);
+            for (size_t i = 0; i < adfCosts.size(); ++i)
+            {
+                if (std::isinf(adfCosts[i]))
+                    continue;
+                OGRFeature oFeature(poResLayer->GetLayerDefn());
+                oFeature.SetField(GNM_SYSFIELD_SOURCE,
+                                  anSources[i / anTargets.size()]);
+                oFeature.SetField(GNM_SYSFIELD_TARGET,
+                                  anTargets[i % anTargets.size()]);
+                oFeature.SetField(GNM_SYSFIELD_COST, adfCosts[i]);
+                poResLayer->CreateFeature(&oFeature);
+            }
+        }
+        break;
     }
 
     return poResLayer;
@@ -30,11 +30,77 @@
 
 #include "gnmgraph.h"
 #include "gnm_priv.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <set>
 
 //! @cond Doxygen_Suppress
+/************************************************************************/
+/*                       GNMContractionHierarchy                        */
+/************************************************************************/
+
+// Contraction hierarchy built from a GNMGraph. Vertices are contracted one
+// after the other, by increasing importance, and shortcut arcs are added
+// between their neighbours when they lie on the only shortest path between
+// them. A shortest path query is then a bidirectional Dijkstra search which
+// only follows arcs leading to more important vertices.
+// Vertices are addressed by their index in the sorted array of identificators,
+// and the upward graphs are stored in compressed sparse row (CSR) form.
+class GNMContractionHierarchy
+{
+  public:
+    struct Arc
+    {
+        int nFrom;
+        int nTo;
+        double dfCost;
+        GNMGFID nEdgeFID;  // -1 for a shortcut
+        int nChild1;       // arcs bypassed by a shortcut, -1 otherwise
+        int nChild2;
+    };
+
+    // State of a search in one of the upward graphs
+    struct Search
+    {
+        std::vector<double> adfDist{};
+        std::vector<int> anParentArc{};
+        std::vector<int> anTouched{};
+        std::vector<int> anSettled{};
+        std::priority_queue<std::pair<double, int>,
+                            std::vector<std::pair<double, int>>,
+                            std::greater<std::pair<double, int>>>
+            oQueue{};
+
+        void Init(int nSource, size_t nVertexCount);
+    };
+
+    bool Build(const std::map<GNMGFID, GNMStdVertex> &mstVertices,
+               const std::map<GNMGFID, GNMStdEdge> &mstEdges);
+
+    size_t GetVertexCount() const
+    {
+        return m_anVertexFIDs.size();
+    }
+
+    int GetVertexIndex(GNMGFID nFID) const;
+    GNMPATH ShortestPath(int nStart, int nEnd) const;
+    void FullUpwardSearch(bool bForward, int nSource, Search &oSearch) const;
+
+  private:
+    std::vector<GNMGFID> m_anVertexFIDs{};
+    std::vector<Arc> m_aoArcs{};
+    std::vector<int> m_anFwdFirst{};
+    std::vector<int> m_anFwdArcs{};
+    std::vector<int> m_anBwdFirst{};
+    std::vector<int> m_anBwdArcs{};
+
+    int SettleNext(bool bForward, Search &oSearch) const;
+    void UnpackArc(int nArc, GNMPATH &aoPath) const;
+};
+
 GNMGraph::GNMGraph()
 {
 }
@@ -48,6 +114,8 @@ void GNMGraph::AddVertex(GNMGFID nFID)
     if (m_mstVertices.find(nFID) != m_mstVertices.end())
         return;
 
+    InvalidateContractionHierarchy();
+
     GNMStdVertex stVertex;
     stVertex.bIsBlocked = false;
     m_mstVertices[nFID] = std::move(stVertex);
@@ -55,6 +123,7 @@ void GNMGraph::AddVertex(GNMGFID nFID)
 
 void GNMGraph::DeleteVertex(GNMGFID nFID)
 {
+    InvalidateContractionHierarchy();
     m_mstVertices.erase(nFID);
 
     // remove all edges with this vertex
@@ -103,6 +172,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
     stEdge.bIsBlocked = false;
 
     m_mstEdges[nConFID] = stEdge;
+    InvalidateContractionHierarchy();
 
     if (bIsBidir)
     {
@@ -117,6 +187,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
 
 void GNMGraph::DeleteEdge(GNMGFID nConFID)
 {
+    InvalidateContractionHierarchy();
     m_mstEdges.erase(nConFID);
 
     // remove edge from all vertices anOutEdgeFIDs
@@ -136,11 +207,14 @@ void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
     {
         it->second.dfDirCost = dfCost;
         it->second.dfInvCost = dfInvCost;
+        InvalidateContractionHierarchy();
     }
 }
 
 void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
 {
+    InvalidateContractionHierarchy();
+
     // check vertices
     std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.find(nFID);
     if (itv != m_mstVertices.end())
@@ -168,6 +242,8 @@ bool GNMGraph::CheckVertexBlocked(GNMGFID nFID) const
 
 void GNMGraph::ChangeAllBlockState(bool bBlock)
 {
+    InvalidateContractionHierarchy();
+
     for (std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.begin();
          itv != m_mstVertices.end(); ++itv)
     {
@@ -450,6 +526,7 @@ GNMPATH GNMGraph::ConnectedComponents(const GNMVECTOR &anEmittersIDs)
 
 void GNMGraph::Clear()
 {
+    InvalidateContractionHierarchy();
     m_mstVertices.clear();
     m_mstEdges.clear();
 }
@@ -632,4 +709,656 @@ void GNMGraph::TraceTargets(std::queue<GNMGFID> &vertexQueue,
         TraceTargets(neighbours_queue, markedVertIds, connectedIds);
 }
 
+const GNMContractionHierarchy *GNMGraph::GetContractionHierarchy()
+{
+    if (!m_bCHBuilt)
+    {
+        m_bCHBuilt = true;
+        auto poCH = std::make_unique<GNMContractionHierarchy>();
+        if (poCH->Build(m_mstVertices, m_mstEdges))
+            m_poCH = std::move(poCH);
+    }
+    return m_poCH.get();
+}
+
+void GNMGraph::InvalidateContractionHierarchy()
+{
+    m_poCH.reset();
+    m_bCHBuilt = false;
+}
+
+GNMPATH GNMGraph::ContractionHierarchyShortestPath(GNMGFID nStartFID,
+                                                   GNMGFID nEndFID)
+{
+    const GNMContractionHierarchy *poCH = GetContractionHierarchy();
+    if (nullptr == poCH)
+        return DijkstraShortestPath(nStartFID, nEndFID);
+
+    if (nStartFID == nEndFID)
+    {
+        GNMPATH aoPath;
+        aoPath.push_back(std::make_pair(nStartFID, GNMGFID(-1)));
+        return aoPath;
+    }
+
+    const int nStart = poCH->GetVertexIndex(nStartFID);
+    const int nEnd = poCH->GetVertexIndex(nEndFID);
+    if (nStart < 0 || nEnd < 0)
+        return GNMPATH();
+
+    return poCH->ShortestPath(nStart, nEnd);
+}
+
+// Run pfnFunc() on [0, nCount) split in contiguous chunks, one per thread.
+static void RunInChunks(int nThreads, size_t nCount,
+                        const std::function<void(size_t, size_t)> &pfnFunc)
+{
+    const int nJobs = static_cast<int>(
+        std::min(static_cast<size_t>(std::max(nThreads, 1)), nCount));
+    auto poThreadPool = nJobs > 1 ? GDALGetGlobalThreadPool(nJobs) : nullptr;
+    if (poThreadPool == nullptr)
+    {
+        pfnFunc(0, nCount);
+        return;
+    }
+
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nJobs; ++i)
+    {
+        const size_t nStart = nCount * i / nJobs;
+        const size_t nEnd = nCount * (i + 1) / nJobs;
+        poQueue->SubmitJob([&pfnFunc, nStart, nEnd]()
+                           { pfnFunc(nStart, nEnd); });
+    }
+    poQueue->WaitCompletion();
+}
+
+std::vector<double>
+GNMGraph::ShortestPathCostMatrix(const GNMVECTOR &anSourceIDs,
+                                 const GNMVECTOR &anTargetIDs, int nThreads)
+{
+    const GNMContractionHierarchy *poCH = GetContractionHierarchy();
+    if (nullptr == poCH)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Cannot compute a shortest path cost matrix on a graph with "
+                 "negative costs.");
+        return std::vector<double>();
+    }
+
+    const size_t nSources = anSourceIDs.size();
+    const size_t nTargets = anTargetIDs.size();
+    const size_t nVertexCount = poCH->GetVertexCount();
+    std::vector<double> adfCosts(nSources * nTargets,
+                                 std::numeric_limits<double>::infinity());
+    if (adfCosts.empty())
+        return adfCosts;
+
+    // Search the upward backward graph from each target. Each vertex reached
+    // gets a bucket with the cost from it to the target.
+    std::vector<std::vector<std::pair<int, double>>> aaoTargetSpaces(nTargets);
+    RunInChunks(
+        nThreads, nTargets,
+        [poCH, &anTargetIDs, &aaoTargetSpaces](size_t nStart, size_t nEnd)
+        {
+            GNMContractionHierarchy::Search oSearch;
+            for (size_t j = nStart; j < nEnd; ++j)
+            {
+                const int nTarget = poCH->GetVertexIndex(anTargetIDs[j]);
+                if (nTarget < 0)
+                    continue;
+                poCH->FullUpwardSearch(false, nTarget, oSearch);
+                aaoTargetSpaces[j].reserve(oSearch.anSettled.size());
+                for (const int nVertex : oSearch.anSettled)
+                {
+                    aaoTargetSpaces[j].emplace_back(nVertex,
+                                                    oSearch.adfDist[nVertex]);
+                }
+            }
+        });
+
+    // Store the buckets in CSR form, indexed by vertex.
+    std::vector<size_t> anBucketFirst(nVertexCount + 1, 0);
+    for (const auto &aoSpace : aaoTargetSpaces)
+    {
+        for (const auto &oEntry : aoSpace)
+            ++anBucketFirst[oEntry.first + 1];
+    }
+    for (size_t i = 0; i < nVertexCount; ++i)
+        anBucketFirst[i + 1] += anBucketFirst[i];
+    std::vector<std::pair<int, double>> aoBuckets(anBucketFirst.back());
+    {
+        std::vector<size_t> anPos(anBucketFirst.begin(),
+                                  anBucketFirst.end() - 1);
+        for (size_t j = 0; j < nTargets; ++j)
+        {
+            for (const auto &oEntry : aaoTargetSpaces[j])
+            {
+                aoBuckets[anPos[oEntry.first]++] =
+                    std::make_pair(static_cast<int>(j), oEntry.second);
+            }
+            aaoTargetSpaces[j].clear();
+            aaoTargetSpaces[j].shrink_to_fit();
+        }
+    }
+
+    // Search the upward forward graph from each source, and combine the cost
+    // to each vertex reached with the costs in its bucket. Each source fills
+    // its own row of the matrix.
+    RunInChunks(nThreads, nSources,
+                [poCH, nTargets, &anSourceIDs, &anBucketFirst, &aoBuckets,
+                 &adfCosts](size_t nStart, size_t nEnd)
+                {
+                    GNMContractionHierarchy::Search oSearch;
+                    for (size_t i = nStart; i < nEnd; ++i)
+                    {
+                        const int nSource =
+                            poCH->GetVertexIndex(anSourceIDs[i]);
+                        if (nSource < 0)
+                            continue;
+                        poCH->FullUpwardSearch(true, nSource, oSearch);
+                        double *padfRow = adfCosts.data() + i * nTargets;
+                        for (const int nVertex : oSearch.anSettled)
+                        {
+                            const double dfDist = oSearch.adfDist[nVertex];
+                            for (size_t k = anBucketFirst[nVertex];
+                                 k < anBucketFirst[nVertex + 1]; ++k)
+                            {
+                                const double dfCost =
+                                    dfDist + aoBuckets[k].second;
+                                double &dfMin = padfRow[aoBuckets[k].first];
+                                if (dfCost < dfMin)
+                                    dfMin = dfCost;
+                            }
+                        }
+                    }
+                });
+
+    return adfCosts;
+}
+
+/************************************************************************/
+/*                  GNMContractionHierarchy::Build()                    */
+/************************************************************************/
+
+bool GNMContractionHierarchy::Build(
+    const std::map<GNMGFID, GNMStdVertex> &mstVertices,
+    const std::map<GNMGFID, GNMStdEdge> &mstEdges)
+{
+    constexpr double dfInfinity = std::numeric_limits<double>::infinity();
+
+    m_anVertexFIDs.reserve(mstVertices.size());
+    for (const auto &oIter : mstVertices)
+        m_anVertexFIDs.push_back(oIter.first);
+    const int nVertexCount = static_cast<int>(m_anVertexFIDs.size());
+
+    // Build the arcs from the outcome edges of each vertex, the same way as
+    // DijkstraShortestPathTree() goes through them.
+    int nVertex = 0;
+    for (const auto &oIter : mstVertices)
+    {
+        for (const GNMGFID nEdgeFID : oIter.second.anOutEdgeFIDs)
+        {
+            const auto ite = mstEdges.find(nEdgeFID);
+            if (ite == mstEdges.end() || ite->second.bIsBlocked)
+                continue;
+            const GNMStdEdge &stEdge = ite->second;
+
+            GNMGFID nTargetFID;
+            if (oIter.first == stEdge.nSrcVertexFID)
+                nTargetFID = stEdge.nTgtVertexFID;
+            else if (oIter.first == stEdge.nTgtVertexFID)
+                nTargetFID = stEdge.nSrcVertexFID;
+            else
+                continue;
+
+            const auto itv = mstVertices.find(nTargetFID);
+            if (itv == mstVertices.end() || itv->second.bIsBlocked)
+                continue;
+
+            const double dfCost = stEdge.dfDirCost;
+            if (dfCost < 0)
+            {
+                CPLDebug("GNM",
+                         "Edge " CPL_FRMT_GIB " has a negative cost. "
+                         "Cannot build a contraction hierarchy",
+                         nEdgeFID);
+                return false;
+            }
+            // Also skips NaN costs
+            if (!(dfCost < dfInfinity))
+                continue;
+
+            const int nTarget = GetVertexIndex(nTargetFID);
+            if (nTarget != nVertex)
+            {
+                m_aoArcs.push_back(
+                    Arc{nVertex, nTarget, dfCost, nEdgeFID, -1, -1});
+            }
+        }
+        ++nVertex;
+    }
+
+    // Only keep the cheapest of parallel arcs.
+    std::sort(m_aoArcs.begin(), m_aoArcs.end(),
+              [](const Arc &a, const Arc &b)
+              {
+                  if (a.nFrom != b.nFrom)
+                      return a.nFrom < b.nFrom;
+                  if (a.nTo != b.nTo)
+                      return a.nTo < b.nTo;
+                  return a.dfCost < b.dfCost;
+              });
+    m_aoArcs.erase(
+        std::unique(m_aoArcs.begin(), m_aoArcs.end(),
+                    [](const Arc &a, const Arc &b)
+                    { return a.nFrom == b.nFrom && a.nTo == b.nTo; }),
+        m_aoArcs.end());
+
+    // Arcs of the remaining graph, i.e. between vertices not contracted yet.
+    std::vector<std::vector<int>> aanOutArcs(nVertexCount);
+    std::vector<std::vector<int>> aanInArcs(nVertexCount);
+    for (int i = 0; i < static_cast<int>(m_aoArcs.size()); ++i)
+    {
+        aanOutArcs[m_aoArcs[i].nFrom].push_back(i);
+        aanInArcs[m_aoArcs[i].nTo].push_back(i);
+    }
+    std::vector<int> anContractedNeighbours(nVertexCount, 0);
+
+    // Keep the cheapest arc to each neighbour of a vertex in the remaining
+    // graph, as (neighbour, arc) pairs.
+    const auto CollectNeighbours =
+        [this](const std::vector<int> &anArcs, bool bOut,
+               std::vector<std::pair<int, int>> &aoNeighbours)
+    {
+        aoNeighbours.clear();
+        for (const int nArc : anArcs)
+        {
+            const Arc &oArc = m_aoArcs[nArc];
+            aoNeighbours.emplace_back(bOut ? oArc.nTo : oArc.nFrom, nArc);
+        }
+        std::sort(aoNeighbours.begin(), aoNeighbours.end(),
+                  [this](const std::pair<int, int> &a,
+                         const std::pair<int, int> &b)
+                  {
+                      if (a.first != b.first)
+                          return a.first < b.first;
+                      return m_aoArcs[a.second].dfCost <
+                             m_aoArcs[b.second].dfCost;
+                  });
+        aoNeighbours.erase(
+            std::unique(aoNeighbours.begin(), aoNeighbours.end(),
+                        [](const std::pair<int, int> &a,
+                           const std::pair<int, int> &b)
+                        { return a.first == b.first; }),
+            aoNeighbours.end());
+    };
+
+    // Bounded Dijkstra search in the remaining graph, avoiding the vertex
+    // being contracted, to find paths that make a shortcut unnecessary. It
+    // stops once all the targets are settled. Stopping it earlier only causes
+    // superfluous shortcuts.
+    constexpr int MAX_WITNESS_SETTLED = 500;
+    std::vector<double> adfWitnessDist(nVertexCount, dfInfinity);
+    std::vector<int> anWitnessTouched;
+    std::vector<bool> abWitnessTarget(nVertexCount, false);
+    std::priority_queue<std::pair<double, int>,
+                        std::vector<std::pair<double, int>>,
+                        std::greater<std::pair<double, int>>>
+        oWitnessQueue;
+    const auto WitnessSearch = [&](int nSource, int nExcluded, double dfMax,
+                                   int nTargets)
+    {
+        for (const int i : anWitnessTouched)
+            adfWitnessDist[i] = dfInfinity;
+        anWitnessTouched.clear();
+        oWitnessQueue = decltype(oWitnessQueue)();
+
+        adfWitnessDist[nSource] = 0;
+        anWitnessTouched.push_back(nSource);
+        oWitnessQueue.push(std::make_pair(0.0, nSource));
+        int nSettled = 0;
+        while (!oWitnessQueue.empty())
+        {
+            const auto oTop = oWitnessQueue.top();
+            oWitnessQueue.pop();
+            if (oTop.first > adfWitnessDist[oTop.second])
+                continue;
+            if (oTop.first > dfMax || ++nSettled > MAX_WITNESS_SETTLED)
+                break;
+            if (abWitnessTarget[oTop.second] && --nTargets == 0)
+                break;
+            for (const int nArc : aanOutArcs[oTop.second])
+            {
+                const Arc &oArc = m_aoArcs[nArc];
+                if (oArc.nTo == nExcluded)
+                    continue;
+                const double dfDist = oTop.first + oArc.dfCost;
+                if (dfDist < adfWitnessDist[oArc.nTo])
+                {
+                    if (adfWitnessDist[oArc.nTo] == dfInfinity)
+                        anWitnessTouched.push_back(oArc.nTo);
+                    adfWitnessDist[oArc.nTo] = dfDist;
+                    oWitnessQueue.push(std::make_pair(dfDist, oArc.nTo));
+                }
+            }
+        }
+    };
+
+    // Contract a vertex, or only count the shortcuts this would add when
+    // bSimulate is set. Returns the priority of the vertex: the edge
+    // difference, plus the number of contracted neighbours to spread the
+    // contraction uniformly across the graph.
+    std::vector<std::pair<int, int>> aoIn, aoOut;
+    const auto ContractVertex = [&](int nVertexIdx, bool bSimulate)
+    {
+        CollectNeighbours(aanInArcs[nVertexIdx], false, aoIn);
+        CollectNeighbours(aanOutArcs[nVertexIdx], true, aoOut);
+
+        for (const auto &oOut : aoOut)
+            abWitnessTarget[oOut.first] = true;
+
+        int nShortcuts = 0;
+        for (const auto &oIn : aoIn)
+        {
+            const int nPred = oIn.first;
+            const double dfInCost = m_aoArcs[oIn.second].dfCost;
+            double dfMaxOutCost = -1;
+            int nTargets = 0;
+            for (const auto &oOut : aoOut)
+            {
+                if (oOut.first != nPred)
+                {
+                    dfMaxOutCost =
+                        std::max(dfMaxOutCost, m_aoArcs[oOut.second].dfCost);
+                    ++nTargets;
+                }
+            }
+            if (nTargets == 0)
+                continue;
+
+            // The predecessor itself may be a target, which is settled first
+            if (abWitnessTarget[nPred])
+                ++nTargets;
+            WitnessSearch(nPred, nVertexIdx, dfInCost + dfMaxOutCost,
+                          nTargets);
+            for (const auto &oOut : aoOut)
+            {
+                const int nSucc = oOut.first;
+                if (nSucc == nPred)
+                    continue;
+                const double dfCost = dfInCost + m_aoArcs[oOut.second].dfCost;
+                if (adfWitnessDist[nSucc] <= dfCost)
+                    continue;
+                ++nShortcuts;
+                if (!bSimulate)
+                {
+                    const int nArc = static_cast<int>(m_aoArcs.size());
+                    m_aoArcs.push_back(
+                        Arc{nPred, nSucc, dfCost, -1, oIn.second, oOut.second});
+                    aanOutArcs[nPred].push_back(nArc);
+                    aanInArcs[nSucc].push_back(nArc);
+                }
+            }
+        }
+
+        for (const auto &oOut : aoOut)
+            abWitnessTarget[oOut.first] = false;
+
+        return nShortcuts - static_cast<int>(aoIn.size() + aoOut.size()) +
+               anContractedNeighbours[nVertexIdx];
+    };
+
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>>
+        oQueue;
+    for (int i = 0; i < nVertexCount; ++i)
+        oQueue.push(std::make_pair(ContractVertex(i, true), i));
+
+    std::vector<int> anRank(nVertexCount);
+    int nRank = 0;
+    while (!oQueue.empty())
+    {
+        const int nCurVertex = oQueue.top().second;
+        oQueue.pop();
+
+        // Priorities are updated lazily: if it increased since it was
+        // computed, the vertex is put back in the queue.
+        const int nPriority = ContractVertex(nCurVertex, true);
+        if (!oQueue.empty() && nPriority > oQueue.top().first)
+        {
+            oQueue.push(std::make_pair(nPriority, nCurVertex));
+            continue;
+        }
+
+        ContractVertex(nCurVertex, false);
+        anRank[nCurVertex] = nRank++;
+        // Remove the arcs of the contracted vertex from the remaining graph
+        for (const auto &oIn : aoIn)
+        {
+            ++anContractedNeighbours[oIn.first];
+            auto &anArcs = aanOutArcs[oIn.first];
+            anArcs.erase(
+                std::remove_if(anArcs.begin(), anArcs.end(),
+                               [this, nCurVertex](int nArc)
+                               { return m_aoArcs[nArc].nTo == nCurVertex; }),
+                anArcs.end());
+        }
+        for (const auto &oOut : aoOut)
+        {
+            ++anContractedNeighbours[oOut.first];
+            auto &anArcs = aanInArcs[oOut.first];
+            anArcs.erase(
+                std::remove_if(anArcs.begin(), anArcs.end(),
+                               [this, nCurVertex](int nArc)
+                               { return m_aoArcs[nArc].nFrom == nCurVertex; }),
+                anArcs.end());
+        }
+        aanInArcs[nCurVertex].clear();
+        aanInArcs[nCurVertex].shrink_to_fit();
+        aanOutArcs[nCurVertex].clear();
+        aanOutArcs[nCurVertex].shrink_to_fit();
+    }
+
+    // Arcs leading to a more important vertex form the upward forward graph,
+    // the other ones the upward backward graph, searched from their target.
+    m_anFwdFirst.assign(nVertexCount + 1, 0);
+    m_anBwdFirst.assign(nVertexCount + 1, 0);
+    for (const Arc &oArc : m_aoArcs)
+    {
+        if (anRank[oArc.nFrom] < anRank[oArc.nTo])
+            ++m_anFwdFirst[oArc.nFrom + 1];
+        else
+            ++m_anBwdFirst[oArc.nTo + 1];
+    }
+    for (int i = 0; i < nVertexCount; ++i)
+    {
+        m_anFwdFirst[i + 1] += m_anFwdFirst[i];
+        m_anBwdFirst[i + 1] += m_anBwdFirst[i];
+    }
+    m_anFwdArcs.resize(m_anFwdFirst.back());
+    m_anBwdArcs.resize(m_anBwdFirst.back());
+    std::vector<int> anFwdPos(m_anFwdFirst.begin(), m_anFwdFirst.end() - 1);
+    std::vector<int> anBwdPos(m_anBwdFirst.begin(), m_anBwdFirst.end() - 1);
+    for (int i = 0; i < static_cast<int>(m_aoArcs.size()); ++i)
+    {
+        const Arc &oArc = m_aoArcs[i];
+        if (anRank[oArc.nFrom] < anRank[oArc.nTo])
+            m_anFwdArcs[anFwdPos[oArc.nFrom]++] = i;
+        else
+            m_anBwdArcs[anBwdPos[oArc.nTo]++] = i;
+    }
+
+    CPLDebug("GNM",
+             "Contraction hierarchy built with %d vertices and %d arcs, "
+             "including shortcuts",
+             nVertexCount, static_cast<int>(m_aoArcs.size()));
+
+    return true;
+}
+
+int GNMContractionHierarchy::GetVertexIndex(GNMGFID nFID) const
+{
+    const auto it =
+        std::lower_bound(m_anVertexFIDs.begin(), m_anVertexFIDs.end(), nFID);
+    if (it == m_anVertexFIDs.end() || *it != nFID)
+        return -1;
+    return static_cast<int>(it - m_anVertexFIDs.begin());
+}
+
+void GNMContractionHierarchy::Search::Init(int nSource, size_t nVertexCount)
+{
+    constexpr double dfInfinity = std::numeric_limits<double>::infinity();
+    if (adfDist.size() != nVertexCount)
+    {
+        adfDist.assign(nVertexCount, dfInfinity);
+        anParentArc.assign(nVertexCount, -1);
+    }
+    else
+    {
+        for (const int i : anTouched)
+        {
+            adfDist[i] = dfInfinity;
+            anParentArc[i] = -1;
+        }
+    }
+    anTouched.clear();
+    anSettled.clear();
+    oQueue = decltype(oQueue)();
+
+    adfDist[nSource] = 0;
+    anTouched.push_back(nSource);
+    oQueue.push(std::make_pair(0.0, nSource));
+}
+
+// Settle the next vertex of a search and relax its upward arcs. Returns -1
+// once the search space is exhausted.
+int GNMContractionHierarchy::SettleNext(bool bForward, Search &oSearch) const
+{
+    const std::vector<int> &anFirst = bForward ? m_anFwdFirst : m_anBwdFirst;
+    const std::vector<int> &anArcs = bForward ? m_anFwdArcs : m_anBwdArcs;
+    while (!oSearch.oQueue.empty())
+    {
+        const auto oTop = oSearch.oQueue.top();
+        oSearch.oQueue.pop();
+        const int nVertex = oTop.second;
+        if (oTop.first > oSearch.adfDist[nVertex])
+            continue;
+
+        for (int i = anFirst[nVertex]; i < anFirst[nVertex + 1]; ++i)
+        {
+            const Arc &oArc = m_aoArcs[anArcs[i]];
+            const int nNext = bForward ? oArc.nTo : oArc.nFrom;
+            const double dfDist = oTop.first + oArc.dfCost;
+            if (dfDist < oSearch.adfDist[nNext])
+            {
+                if (oSearch.anParentArc[nNext] < 0)
+                    oSearch.anTouched.push_back(nNext);
+                oSearch.adfDist[nNext] = dfDist;
+                oSearch.anParentArc[nNext] = anArcs[i];
+                oSearch.oQueue.push(std::make_pair(dfDist, nNext));
+            }
+        }
+        oSearch.anSettled.push_back(nVertex);
+        return nVertex;
+    }
+    return -1;
+}
+
+void GNMContractionHierarchy::FullUpwardSearch(bool bForward, int nSource,
+                                               Search &oSearch) const
+{
+    oSearch.Init(nSource, m_anVertexFIDs.size());
+    while (SettleNext(bForward, oSearch) >= 0)
+    {
+    }
+}
+
+GNMPATH GNMContractionHierarchy::ShortestPath(int nStart, int nEnd) const
+{
+    Search oFwd, oBwd;
+    oFwd.Init(nStart, m_anVertexFIDs.size());
+    oBwd.Init(nEnd, m_anVertexFIDs.size());
+
+    // Alternate the forward and backward searches. Each one stops once the
+    // costs it still has to settle cannot improve the best path found.
+    double dfBest = std::numeric_limits<double>::infinity();
+    int nMeeting = -1;
+    bool abDone[2] = {false, false};
+    while (!abDone[0] || !abDone[1])
+    {
+        for (int iDir = 0; iDir < 2; ++iDir)
+        {
+            if (abDone[iDir])
+                continue;
+            Search &oSearch = iDir == 0 ? oFwd : oBwd;
+            const Search &oOther = iDir == 0 ? oBwd : oFwd;
+            if (oSearch.oQueue.empty() || oSearch.oQueue.top().first >= dfBest)
+            {
+                abDone[iDir] = true;
+                continue;
+            }
+            const int nVertex = SettleNext(iDir == 0, oSearch);
+            if (nVertex < 0)
+            {
+                abDone[iDir] = true;
+                continue;
+            }
+            const double dfCost =
+                oSearch.adfDist[nVertex] + oOther.adfDist[nVertex];
+            if (dfCost < dfBest)
+            {
+                dfBest = dfCost;
+                nMeeting = nVertex;
+            }
+        }
+    }
+
+    if (nMeeting < 0)
+        return GNMPATH();
+
+    // Arcs from the start to the meeting vertex, then to the end.
+    std::vector<int> anArcs;
+    for (int nVertex = nMeeting; nVertex != nStart;)
+    {
+        const int nArc = oFwd.anParentArc[nVertex];
+        anArcs.push_back(nArc);
+        nVertex = m_aoArcs[nArc].nFrom;
+    }
+    std::reverse(anArcs.begin(), anArcs.end());
+    for (int nVertex = nMeeting; nVertex != nEnd;)
+    {
+        const int nArc = oBwd.anParentArc[nVertex];
+        anArcs.push_back(nArc);
+        nVertex = m_aoArcs[nArc].nTo;
+    }
+
+    GNMPATH aoPath;
+    aoPath.push_back(std::make_pair(m_anVertexFIDs[nStart], GNMGFID(-1)));
+    for (const int nArc : anArcs)
+        UnpackArc(nArc, aoPath);
+    return aoPath;
+}
+
+// Append the original arcs bypassed by an arc to a path.
+void GNMContractionHierarchy::UnpackArc(int nArc, GNMPATH &aoPath) const
+{
+    std::vector<int> anStack{nArc};
+    while (!anStack.empty())
+    {
+        const Arc &oArc = m_aoArcs[anStack.back()];
+        anStack.pop_back();
+        if (oArc.nChild1 < 0)
+        {
+            aoPath.push_back(
+                std::make_pair(m_anVertexFIDs[oArc.nTo], oArc.nEdgeFID));
+        }
+        else
+        {
+            anStack.push_back(oArc.nChild2);
+            anStack.push_back(oArc.nChild1);
+        }
+    }
+}
+
 //! @endcond
@@ -34,6 +34,7 @@
 #include "cpl_port.h"
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <vector>
@@ -54,6 +55,8 @@ typedef const std::vector<GNMGFID> *LPGNMCONSTVECTOR;
 typedef std::pair<GNMGFID, GNMGFID> EDGEVERTEXPAIR;
 typedef std::vector<EDGEVERTEXPAIR> GNMPATH;
 
+class GNMContractionHierarchy;
+
 /** Edge */
 struct GNMStdEdge
 {
@@ -210,6 +213,48 @@ class CPL_DLL GNMGraph
      */
     virtual GNMPATH ConnectedComponents(const GNMVECTOR &anEmittersIDs);
 
+    /**
+     * @brief Shortest path using a contraction hierarchy.
+     *
+     * Returns the best path between nStartFID and nEndFID features, in the
+     * same form as @see DijkstraShortestPath. The first call preprocesses the
+     * graph into a contraction hierarchy (a compact representation where
+     * vertices are ordered by importance and shortcut edges bypass the less
+     * important ones), which is kept until the graph is modified. Subsequent
+     * queries only explore a small part of the graph.
+     * Method takes in account the blocking state of features at the time the
+     * hierarchy is built. Costs must not be negative, otherwise
+     * @see DijkstraShortestPath is used.
+     *
+     * @param nStartFID Start identificator
+     * @param nEndFID End identificator
+     * @return an array of best path included identificator of vertices and
+     * edges
+     * @since GDAL 3.11
+     */
+    virtual GNMPATH ContractionHierarchyShortestPath(GNMGFID nStartFID,
+                                                     GNMGFID nEndFID);
+
+    /**
+     * @brief Compute the costs of the shortest paths between several sources
+     * and several targets.
+     *
+     * Uses the contraction hierarchy (@see ContractionHierarchyShortestPath)
+     * to compute a many-to-many cost matrix.
+     *
+     * @param anSourceIDs Source vertex identificators
+     * @param anTargetIDs Target vertex identificators
+     * @param nThreads Number of threads to use
+     * @return an array of anSourceIDs.size() * anTargetIDs.size() costs,
+     * where the cost from anSourceIDs[i] to anTargetIDs[j] is at index
+     * i * anTargetIDs.size() + j, and is infinity if there is no path between
+     * them. An empty array is returned in case of error.
+     * @since GDAL 3.11
+     */
+    virtual std::vector<double>
+    ShortestPathCostMatrix(const GNMVECTOR &anSourceIDs,
+                           const GNMVECTOR &anTargetIDs, int nThreads = 1);
+
     /** Clear */
     virtual void Clear();
 
@@ -245,10 +290,14 @@ class CPL_DLL GNMGraph
     virtual void TraceTargets(std::queue<GNMGFID> &vertexQueue,
                               std::set<GNMGFID> &markedVertIds,
                               GNMPATH &connectedIds);
+    const GNMContractionHierarchy *GetContractionHierarchy();
+    void InvalidateContractionHierarchy();
 
   protected:
     std::map<GNMGFID, GNMStdVertex> m_mstVertices;
     std::map<GNMGFID, GNMStdEdge> m_mstEdges;
+    std::unique_ptr<GNMContractionHierarchy> m_poCH{};
+    bool m_bCHBuilt = false;
     //! @endcond
 };
 
@@ -870,6 +870,12 @@ void CPL_DLL OGRRegisterAll(void);
  * See GDALDestroyDriverManager() */
 void CPL_DLL OGRCleanupAll(void);
 
+/* Statistics on the stages of feature pipelines */
+
+void CPL_DLL OGRProfilingStatsReset(void);
+char CPL_DLL *OGRProfilingStatsGetAsSerializedJSON(char **papszOptions);
+char CPL_DLL *OGRProfilingStatsGetAsText(char **papszOptions);
+
 /* -------------------------------------------------------------------- */
 /*      ogrsf_featurestyle.h                                            */
 /* -------------------------------------------------------------------- */
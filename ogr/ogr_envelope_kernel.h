@@ -0,0 +1,100 @@
+/******************************************************************************
+ *
+ * Project:  OGR
+ * Purpose:  Computation of the 2D envelope of a sequence of points
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_ENVELOPE_KERNEL_H_INCLUDED
+#define OGR_ENVELOPE_KERNEL_H_INCLUDED
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_port.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Only enabled on x86_64, where MINPD/MAXPD return their second operand
+// when one of them is NaN, which matches the scalar code below. The NEON
+// emulation does not guarantee that.
+#if defined(__x86_64) || defined(_M_X64)
+#define OGR_ENVELOPE_KERNEL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+/************************************************************************/
+/*                       OGRUpdateEnvelopeXY()                          */
+/************************************************************************/
+
+/** Update the dfMinX, dfMinY, dfMaxX and dfMaxY bounds with the nPoints
+ * points starting at pabyXY, whose X and Y values are stored as consecutive
+ * native-endian doubles, with a distance of nStride bytes between 2 points.
+ * pabyXY does not need to be aligned.
+ *
+ * NaN coordinates are ignored, unless a bound was already NaN, in which
+ * case it stays NaN.
+ */
+inline void OGRUpdateEnvelopeXY(const GByte *pabyXY, size_t nPoints,
+                                size_t nStride, double &dfMinX,
+                                double &dfMinY, double &dfMaxX,
+                                double &dfMaxY)
+{
+#ifdef OGR_ENVELOPE_KERNEL_USE_SSE2
+    // Two sets of accumulators to break dependency chains.
+    __m128d minXY0 = _mm_set_pd(dfMinY, dfMinX);
+    __m128d maxXY0 = _mm_set_pd(dfMaxY, dfMaxX);
+    __m128d minXY1 = minXY0;
+    __m128d maxXY1 = maxXY0;
+    size_t i = 0;
+    for (; i + 1 < nPoints; i += 2)
+    {
+        const __m128d xy0 = _mm_loadu_pd(
+            reinterpret_cast<const double *>(pabyXY + i * nStride));
+        const __m128d xy1 = _mm_loadu_pd(
+            reinterpret_cast<const double *>(pabyXY + (i + 1) * nStride));
+        // The accumulator must be the second operand, so that a NaN value
+        // from the point is ignored.
+        minXY0 = _mm_min_pd(xy0, minXY0);
+        maxXY0 = _mm_max_pd(xy0, maxXY0);
+        minXY1 = _mm_min_pd(xy1, minXY1);
+        maxXY1 = _mm_max_pd(xy1, maxXY1);
+    }
+    if (i < nPoints)
+    {
+        const __m128d xy0 = _mm_loadu_pd(
+            reinterpret_cast<const double *>(pabyXY + i * nStride));
+        minXY0 = _mm_min_pd(xy0, minXY0);
+        maxXY0 = _mm_max_pd(xy0, maxXY0);
+    }
+    minXY0 = _mm_min_pd(minXY1, minXY0);
+    maxXY0 = _mm_max_pd(maxXY1, maxXY0);
+
+    double adfMin[2];
+    double adfMax[2];
+    _mm_storeu_pd(adfMin, minXY0);
+    _mm_storeu_pd(adfMax, maxXY0);
+    dfMinX = adfMin[0];
+    dfMinY = adfMin[1];
+    dfMaxX = adfMax[0];
+    dfMaxY = adfMax[1];
+#else
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        double adfXY[2];
+        memcpy(adfXY, pabyXY + i * nStride, sizeof(adfXY));
+        dfMinX = std::min(dfMinX, adfXY[0]);
+        dfMinY = std::min(dfMinY, adfXY[1]);
+        dfMaxX = std::max(dfMaxX, adfXY[0]);
+        dfMaxY = std::max(dfMaxY, adfXY[1]);
+    }
+#endif
+}
+
+//! @endcond
+
+#endif /* OGR_ENVELOPE_KERNEL_H_INCLUDED */
@@ -896,6 +896,83 @@ inline OGRFeatureDefn::TemporaryUnsealer whileUnsealing(OGRFeatureDefn *object,
 }
 #endif
 
+/************************************************************************/
+/*                           OGRFieldCopyPlan                           */
+/************************************************************************/
+
+/**
+ * Precompiled plan to copy the fields and geometries of features of a
+ * feature definition into features of another one.
+ *
+ * The conversion to apply to each field is resolved once when the plan is
+ * built, rather than for each feature as OGRFeature::SetFrom() with a field
+ * map does. This is intended to be used when translating many features
+ * between the same pair of layers.
+ *
+ * The plan must be rebuilt if one of the feature definitions is modified.
+ *
+ * @since GDAL 3.11
+ */
+class CPL_DLL OGRFieldCopyPlan
+{
+  public:
+    OGRFieldCopyPlan(const OGRFeatureDefn *poSrcDefn,
+                     const OGRFeatureDefn *poDstDefn, const int *panMap,
+                     bool bUseISO8601ForDateTimeAsString = false);
+
+  private:
+    friend class OGRFeature;
+
+    /** Copy operation of a field */
+    enum class Op
+    {
+        COPY_INTEGER,
+        COPY_INTEGER64,
+        COPY_REAL,
+        COPY_STRING,
+        COPY_DATE,
+        FROM_INTEGER,
+        FROM_INTEGER64,
+        FROM_REAL,
+        FROM_STRING,
+        FROM_INTEGER_LIST,
+        FROM_INTEGER64_LIST,
+        FROM_REAL_LIST,
+        FROM_RAW,
+        LIST_AS_JSON,
+        AS_STRING,
+        DATETIME_AS_ISO8601,
+        UNSUPPORTED,
+        FAILURE
+    };
+
+    struct FieldOp
+    {
+        int iSrcField;
+        int iDstField;
+        Op eOp;
+    };
+
+    const OGRFeatureDefn *m_poSrcDefn = nullptr;
+    const OGRFeatureDefn *m_poDstDefn = nullptr;
+    int m_nSrcFieldCount = 0;
+    int m_nDstFieldCount = 0;
+    int m_nSrcGeomFieldCount = 0;
+    int m_nDstGeomFieldCount = 0;
+    bool m_bUseISO8601ForDateTimeAsString = false;
+    std::vector<int> m_anMap{};
+    std::vector<FieldOp> m_aoOps{};
+    // Index of the source geometry field of each target geometry field, or -1
+    std::vector<int> m_anGeomMap{};
+
+    static Op GetOp(const OGRFieldDefn *poSrcFieldDefn,
+                    const OGRFieldDefn *poDstFieldDefn,
+                    bool bUseISO8601ForDateTimeAsString);
+
+    bool IsValidFor(const OGRFeatureDefn *poSrcDefn,
+                    const OGRFeatureDefn *poDstDefn) const;
+};
+
 /************************************************************************/
 /*                              OGRFeature                              */
 /************************************************************************/
@@ -915,6 +992,9 @@ class CPL_DLL OGRFeature
     char *m_pszNativeMediaType;
 
     bool SetFieldInternal(int i, const OGRField *puValue);
+    OGRErr CopyFieldFrom(const OGRFeature *poSrcFeature, int iSrcField,
+                         int iDstField, OGRFieldCopyPlan::Op eOp,
+                         int bForgiving);
 
   protected:
     //! @cond Doxygen_Suppress
@@ -1507,6 +1587,10 @@ class CPL_DLL OGRFeature
     OGRErr SetFieldsFrom(const OGRFeature *, const int *panMap,
                          int bForgiving = TRUE,
                          bool bUseISO8601ForDateTimeAsString = false);
+    OGRErr SetFrom(const OGRFeature *, const OGRFieldCopyPlan &oPlan,
+                   int bForgiving = TRUE);
+    OGRErr SetFieldsFrom(const OGRFeature *, const OGRFieldCopyPlan &oPlan,
+                         int bForgiving = TRUE);
 
     //! @cond Doxygen_Suppress
     OGRErr RemapFields(OGRFeatureDefn *poNewDefn, const int *panRemapSource);
@@ -1974,6 +2058,8 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    // Layer passed to Compile(), if any. Only used for profiling statistics.
+    const OGRLayer *m_poLayer = nullptr;
 
     char **FieldCollector(void *, char **);
 
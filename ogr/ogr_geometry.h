@@ -24,8 +24,10 @@
 
 #include <climits>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 /**
  * \file ogr_geometry.h
@@ -1712,6 +1714,39 @@ class CPL_DLL OGRSimpleCurve : public OGRCurve
                    void *pabyZ = nullptr, int nZStride = 0,
                    void *pabyM = nullptr, int nMStride = 0) const;
 
+    /** Return a read-only pointer to the internal array of getNumPoints()
+     * interleaved XY coordinates, without copying them.
+     *
+     * The pointer may be null for an empty curve, and is invalidated by any
+     * modification of the curve.
+     *
+     * @since GDAL 3.11
+     */
+    const OGRRawPoint *getRawPoints() const
+    {
+        return paoPoints;
+    }
+
+    /** Return a read-only pointer to the internal array of Z values, or
+     * nullptr if the curve has no Z dimension.
+     *
+     * @since GDAL 3.11
+     */
+    const double *getRawZ() const
+    {
+        return (flags & OGR_G_3D) ? padfZ : nullptr;
+    }
+
+    /** Return a read-only pointer to the internal array of M values, or
+     * nullptr if the curve has no M dimension.
+     *
+     * @since GDAL 3.11
+     */
+    const double *getRawM() const
+    {
+        return (flags & OGR_G_MEASURED) ? padfM : nullptr;
+    }
+
     void addSubLineString(const OGRLineString *, int nStartVertex = 0,
                           int nEndVertex = -1);
     void reversePoints() override;
@@ -4395,6 +4430,12 @@ class CPL_DLL OGRGeometryFactory
     static OGRCurve *
     curveFromLineString(const OGRLineString *poLS,
                         const char *const *papszOptions = nullptr);
+
+    static std::vector<std::unique_ptr<OGRGeometry>> applyToGeometries(
+        const std::vector<const OGRGeometry *> &apoGeoms,
+        const std::function<std::unique_ptr<OGRGeometry>(const OGRGeometry *)>
+            &fnOperation,
+        int nThreads);
 };
 
 OGRwkbGeometryType CPL_DLL OGRFromOGCGeomType(const char *pszGeomType);
@@ -0,0 +1,388 @@
+/******************************************************************************
+ *
+ * Project:  OGR
+ * Purpose:  Timing counters of the stages of vector feature pipelines
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_profiling.h"
+
+#include <array>
+#include <cinttypes>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "ogr_api.h"
+#include "ogrsf_frmts.h"
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+constexpr const char *apszStageNames[OGR_PROFILING_STAGE_COUNT] = {
+    "read",
+    "read_arrow",
+    "attribute_filter",
+    "spatial_filter",
+    "coordinate_transformation",
+    "geometry_operations",
+    "write",
+    "write_arrow"};
+
+/************************************************************************/
+/*                            StageCounters                             */
+/************************************************************************/
+
+struct StageCounters
+{
+    uint64_t nCalls = 0;
+    uint64_t nFeatures = 0;
+    uint64_t nBytes = 0;
+    uint64_t nTimeNS = 0;
+};
+
+/************************************************************************/
+/*                            LayerCounters                             */
+/************************************************************************/
+
+struct LayerCounters
+{
+    std::string osLayerName{};
+    std::array<StageCounters, OGR_PROFILING_STAGE_COUNT> aoStages{};
+
+    bool IsEmpty() const
+    {
+        for (const auto &oStage : aoStages)
+        {
+            if (oStage.nCalls)
+                return false;
+        }
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                               State                                  */
+/************************************************************************/
+
+struct State
+{
+    std::mutex oMutex{};
+
+    // Layers that are still alive
+    std::map<const OGRLayer *, LayerCounters> oMapLayers{};
+
+    // Layers that have been destroyed, in destruction order
+    std::vector<LayerCounters> aoForgottenLayers{};
+};
+
+State &GetState()
+{
+    static State oState;
+    return oState;
+}
+
+/************************************************************************/
+/*                          GetAllCounters()                            */
+/************************************************************************/
+
+// Must be called with the mutex of the state held
+std::vector<const LayerCounters *> GetAllCounters(const State &oState)
+{
+    std::vector<const LayerCounters *> apoCounters;
+    for (const auto &oCounters : oState.aoForgottenLayers)
+        apoCounters.push_back(&oCounters);
+    for (const auto &[poLayer, oCounters] : oState.oMapLayers)
+    {
+        CPL_IGNORE_RET_VAL(poLayer);
+        if (!oCounters.IsEmpty())
+            apoCounters.push_back(&oCounters);
+    }
+    return apoCounters;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                   OGRProfilingStats::ReadEnabled()                   */
+/************************************************************************/
+
+std::atomic<int> OGRProfilingStats::gnEnabled{-1};  // unknown state
+std::atomic<bool> OGRProfilingStats::gbHasStats{false};
+
+void OGRProfilingStats::ReadEnabled()
+{
+    gnEnabled =
+        CPLTestBool(CPLGetConfigOption("OGR_PROFILING_STATS_ENABLED", "NO"))
+            ? TRUE
+            : FALSE;
+}
+
+/************************************************************************/
+/*                      OGRProfilingStats::Add()                        */
+/************************************************************************/
+
+void OGRProfilingStats::Add(const OGRLayer *poLayer, OGRProfilingStage eStage,
+                            uint64_t nTimeNS, uint64_t nFeatures,
+                            uint64_t nBytes)
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    auto oIter = oState.oMapLayers.find(poLayer);
+    if (oIter == oState.oMapLayers.end())
+    {
+        oIter = oState.oMapLayers.emplace(poLayer, LayerCounters()).first;
+        oIter->second.osLayerName =
+            poLayer ? const_cast<OGRLayer *>(poLayer)->GetName() : "";
+    }
+    gbHasStats = true;
+    auto &oStage = oIter->second.aoStages[static_cast<int>(eStage)];
+    ++oStage.nCalls;
+    oStage.nFeatures += nFeatures;
+    oStage.nBytes += nBytes;
+    oStage.nTimeNS += nTimeNS;
+}
+
+/************************************************************************/
+/*               OGRProfilingStats::ForgetLayerInternal()               */
+/************************************************************************/
+
+void OGRProfilingStats::ForgetLayerInternal(const OGRLayer *poLayer)
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    auto oIter = oState.oMapLayers.find(poLayer);
+    if (oIter != oState.oMapLayers.end())
+    {
+        if (!oIter->second.IsEmpty())
+            oState.aoForgottenLayers.push_back(std::move(oIter->second));
+        oState.oMapLayers.erase(oIter);
+    }
+}
+
+/************************************************************************/
+/*               OGRProfilingStats::GetGeometriesWkbSize()              */
+/************************************************************************/
+
+uint64_t OGRProfilingStats::GetGeometriesWkbSize(const OGRFeature *poFeature)
+{
+    uint64_t nSize = 0;
+    if (poFeature)
+    {
+        const int nGeomFieldCount = poFeature->GetGeomFieldCount();
+        for (int i = 0; i < nGeomFieldCount; ++i)
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+            if (poGeom)
+                nSize += poGeom->WkbSize();
+        }
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                      OGRProfilingStats::Reset()                      */
+/************************************************************************/
+
+void OGRProfilingStats::Reset()
+{
+    {
+        auto &oState = GetState();
+        std::lock_guard<std::mutex> oLock(oState.oMutex);
+        oState.oMapLayers.clear();
+        oState.aoForgottenLayers.clear();
+    }
+    gbHasStats = false;
+    gnEnabled = -1;
+}
+
+/************************************************************************/
+/*             OGRProfilingStats::GetReportAsSerializedJSON()           */
+/************************************************************************/
+
+std::string OGRProfilingStats::GetReportAsSerializedJSON()
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+
+    CPLJSONObject oJSON;
+    CPLJSONArray oLayers;
+    oJSON.Add("layers", oLayers);
+    for (const auto *poCounters : GetAllCounters(oState))
+    {
+        CPLJSONObject oLayerJSON;
+        oLayerJSON.Add("name", poCounters->osLayerName);
+        CPLJSONObject oStages;
+        for (int iStage = 0; iStage < OGR_PROFILING_STAGE_COUNT; ++iStage)
+        {
+            const auto &oStage = poCounters->aoStages[iStage];
+            if (oStage.nCalls == 0)
+                continue;
+            CPLJSONObject oStageJSON;
+            oStageJSON.Add("calls", oStage.nCalls);
+            oStageJSON.Add("features", oStage.nFeatures);
+            oStageJSON.Add("bytes", oStage.nBytes);
+            oStageJSON.Add("time_ns", oStage.nTimeNS);
+            oStages.Add(apszStageNames[iStage], oStageJSON);
+        }
+        oLayerJSON.Add("stages", oStages);
+        oLayers.Add(oLayerJSON);
+    }
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+/************************************************************************/
+/*                 OGRProfilingStats::GetReportAsText()                 */
+/************************************************************************/
+
+std::string OGRProfilingStats::GetReportAsText()
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+
+    std::string osRet;
+    for (const auto *poCounters : GetAllCounters(oState))
+    {
+        osRet += "Layer ";
+        osRet += poCounters->osLayerName.empty()
+                     ? std::string("(none)")
+                     : "'" + poCounters->osLayerName + "'";
+        osRet += ":\n";
+        osRet += CPLSPrintf("  %-26s %12s %12s %14s %12s\n", "Stage", "Calls",
+                            "Features", "Bytes", "Time (ms)");
+        for (int iStage = 0; iStage < OGR_PROFILING_STAGE_COUNT; ++iStage)
+        {
+            const auto &oStage = poCounters->aoStages[iStage];
+            if (oStage.nCalls == 0)
+                continue;
+            osRet += CPLSPrintf(
+                "  %-26s %12" PRIu64 " %12" PRIu64 " %14" PRIu64 " %12.3f\n",
+                apszStageNames[iStage], oStage.nCalls, oStage.nFeatures,
+                oStage.nBytes, static_cast<double>(oStage.nTimeNS) / 1e6);
+        }
+    }
+    return osRet;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                       OGRProfilingStatsReset()                       */
+/************************************************************************/
+
+/**
+ * \brief Clear the statistics collected on the stages of feature pipelines.
+ *
+ * The effect of the OGR_PROFILING_STATS_ENABLED configuration option
+ * will also be reset. That is, that its value will be checked again on the
+ * next instrumented operation.
+ *
+ * @since GDAL 3.11
+ */
+
+void OGRProfilingStatsReset(void)
+{
+    OGRProfilingStats::Reset();
+}
+
+/************************************************************************/
+/*                OGRProfilingStatsGetAsSerializedJSON()                */
+/************************************************************************/
+
+/**
+ * \brief Return the statistics collected on the stages of feature pipelines,
+ * as a JSON serialized object.
+ *
+ * Statistics collecting should be enabled with the OGR_PROFILING_STATS_ENABLED
+ * configuration option set to YES (for efficiency, reading it is cached on
+ * first access, until OGRProfilingStatsReset() is called).
+ *
+ * Statistics are collected per layer. For each stage, the number of calls,
+ * processed features and bytes, and the cumulated time in nanoseconds are
+ * reported. The following stages are instrumented:
+ * <ul>
+ * <li>read: OGR_L_GetNextFeature(), and reading of source features by
+ * ogr2ogr. This includes the time spent in the attribute and spatial
+ * filters evaluated by the driver. Bytes are the WKB size of the
+ * geometries.</li>
+ * <li>read_arrow: get_next() callback of ArrowArrayStream returned by the
+ * generic implementation of OGR_L_GetArrowStream(). Features are rows of the
+ * batches.</li>
+ * <li>attribute_filter: evaluation of attribute filters by OGR.</li>
+ * <li>spatial_filter: evaluation of spatial filters by OGR.</li>
+ * <li>coordinate_transformation: reprojection of geometries by ogr2ogr.</li>
+ * <li>geometry_operations: other geometry operations done by ogr2ogr
+ * (-segmentize, -simplify, -clipsrc, -clipdst, -makevalid, -xyRes and
+ * geometry type conversions).</li>
+ * <li>write: OGR_L_CreateFeature(), OGR_L_SetFeature(), OGR_L_UpsertFeature()
+ * and OGR_L_UpdateFeature(). Bytes are the WKB size of the geometries.</li>
+ * <li>write_arrow: OGR_L_WriteArrowBatch(), and its use by ogr2ogr.</li>
+ * </ul>
+ *
+ * Operations run in several threads (for example reprojection in ogr2ogr)
+ * have their time cumulated over all threads.
+ * Stages may be nested: for example, the time of "attribute_filter" is also
+ * accounted in "read" when the filter is evaluated while reading.
+ *
+ * Example of output:
+ * \code{.js}
+ * {
+ *   "layers":[
+ *     {
+ *       "name":"poly",
+ *       "stages":{
+ *         "read":{
+ *           "calls":11,
+ *           "features":10,
+ *           "bytes":3200,
+ *           "time_ns":412400
+ *         }
+ *       }
+ *     }
+ *   ]
+ * }
+ * \endcode
+ *
+ * @param papszOptions NULL or NULL-terminated list of options. Unused for now.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.11
+ */
+
+char *OGRProfilingStatsGetAsSerializedJSON(char **papszOptions)
+{
+    CPL_IGNORE_RET_VAL(papszOptions);
+    return CPLStrdup(OGRProfilingStats::GetReportAsSerializedJSON().c_str());
+}
+
+/************************************************************************/
+/*                     OGRProfilingStatsGetAsText()                     */
+/************************************************************************/
+
+/**
+ * \brief Return the statistics collected on the stages of feature pipelines,
+ * as a human readable summary.
+ *
+ * See OGRProfilingStatsGetAsSerializedJSON() for how to enable statistics
+ * collection and the meaning of the stages.
+ *
+ * @param papszOptions NULL or NULL-terminated list of options. Unused for now.
+ * @return a string to free with VSIFree(), or nullptr
+ * @since GDAL 3.11
+ */
+
+char *OGRProfilingStatsGetAsText(char **papszOptions)
+{
+    CPL_IGNORE_RET_VAL(papszOptions);
+    return CPLStrdup(OGRProfilingStats::GetReportAsText().c_str());
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Project:  OGR
+ * Purpose:  Timing counters of the stages of vector feature pipelines
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_PROFILING_H_INCLUDED
+#define OGR_PROFILING_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+class OGRFeature;
+class OGRLayer;
+
+/************************************************************************/
+/*                          OGRProfilingStage                           */
+/************************************************************************/
+
+/** Stages of a feature pipeline for which timings are collected. */
+enum class OGRProfilingStage
+{
+    /** OGRLayer::GetNextFeature(), including the filters evaluated by it */
+    READ,
+    /** ArrowArrayStream::get_next() of the generic GetArrowStream() */
+    READ_ARROW,
+    /** OGRFeatureQuery::Evaluate() */
+    ATTRIBUTE_FILTER,
+    /** OGRLayer::FilterGeometry() */
+    SPATIAL_FILTER,
+    /** Reprojection of geometries (ogr2ogr) */
+    COORDINATE_TRANSFORMATION,
+    /** Other geometry operations (ogr2ogr -segmentize, -makevalid, etc.) */
+    GEOMETRY_OPERATIONS,
+    /** OGRLayer::CreateFeature(), SetFeature(), UpsertFeature() and
+     * UpdateFeature() */
+    WRITE,
+    /** OGRLayer::WriteArrowBatch() */
+    WRITE_ARROW,
+};
+
+constexpr int OGR_PROFILING_STAGE_COUNT = 8;
+
+/************************************************************************/
+/*                          OGRProfilingStats                           */
+/************************************************************************/
+
+/** Collects, per layer and per stage, the number of calls, processed
+ * features and bytes, and the cumulated time spent.
+ *
+ * Enabled with the OGR_PROFILING_STATS_ENABLED configuration option.
+ */
+class CPL_DLL OGRProfilingStats
+{
+    static std::atomic<int> gnEnabled;
+    static std::atomic<bool> gbHasStats;
+
+    static void ReadEnabled();
+    static void ForgetLayerInternal(const OGRLayer *poLayer);
+
+  public:
+    static inline bool IsEnabled()
+    {
+        if (gnEnabled.load() < 0)
+            ReadEnabled();
+        return gnEnabled.load() == TRUE;
+    }
+
+    /** Account for one call of stage eStage on poLayer (may be null). */
+    static void Add(const OGRLayer *poLayer, OGRProfilingStage eStage,
+                    uint64_t nTimeNS, uint64_t nFeatures, uint64_t nBytes);
+
+    /** Must be called when poLayer is destroyed, so that its statistics are
+     * kept, but no longer associated with its address. */
+    static inline void ForgetLayer(const OGRLayer *poLayer)
+    {
+        if (gbHasStats.load())
+            ForgetLayerInternal(poLayer);
+    }
+
+    /** Return the sum of the WKB sizes of the geometries of poFeature. */
+    static uint64_t GetGeometriesWkbSize(const OGRFeature *poFeature);
+
+    static void Reset();
+
+    static std::string GetReportAsSerializedJSON();
+
+    static std::string GetReportAsText();
+};
+
+/************************************************************************/
+/*                          OGRProfilingTimer                           */
+/************************************************************************/
+
+/** Times the enclosing scope and accounts for it in OGRProfilingStats.
+ * Does nothing if profiling is not enabled.
+ */
+class OGRProfilingTimer
+{
+    const OGRLayer *const m_poLayer;
+    const OGRProfilingStage m_eStage;
+    const bool m_bEnabled;
+    std::chrono::steady_clock::time_point m_oStart{};
+    uint64_t m_nFeatures = 1;
+    uint64_t m_nBytes = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRProfilingTimer)
+
+  public:
+    OGRProfilingTimer(const OGRLayer *poLayer, OGRProfilingStage eStage)
+        : m_poLayer(poLayer), m_eStage(eStage),
+          m_bEnabled(OGRProfilingStats::IsEnabled())
+    {
+        if (m_bEnabled)
+            m_oStart = std::chrono::steady_clock::now();
+    }
+
+    ~OGRProfilingTimer()
+    {
+        if (m_bEnabled)
+        {
+            const auto nTimeNS =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - m_oStart)
+                    .count();
+            OGRProfilingStats::Add(m_poLayer, m_eStage,
+                                   static_cast<uint64_t>(nTimeNS), m_nFeatures,
+                                   m_nBytes);
+        }
+    }
+
+    bool IsEnabled() const
+    {
+        return m_bEnabled;
+    }
+
+    /** Set the number of features processed (defaults to 1) */
+    void SetFeatureCount(uint64_t nFeatures)
+    {
+        m_nFeatures = nFeatures;
+    }
+
+    void AddBytes(uint64_t nBytes)
+    {
+        m_nBytes += nBytes;
+    }
+};
+
+#endif  // #ifndef DOXYGEN_SKIP
+
+#endif  // OGR_PROFILING_H_INCLUDED
@@ -324,6 +324,7 @@ void OSRProjTLSCache::clear()
 {
     m_oCacheEPSG.clear();
     m_oCacheWKT.clear();
+    m_oCacheBestMatch.clear();
     m_tlsContext = nullptr;
 }
 
@@ -334,6 +335,78 @@ PJ_CONTEXT *OSRProjTLSCache::GetPJContext()
     return m_tlsContext;
 }
 
+/************************************************************************/
+/*                          OSRProjGlobalCache                          */
+/************************************************************************/
+
+// Objects of this cache belong to a PROJ context of their own, and are only
+// accessed with m_oMutex held. Cloning them into the context of another
+// thread is cheap, as the underlying PROJ objects are immutable and shared
+// between the clones.
+struct OSRProjGlobalCache
+{
+    std::mutex m_oMutex{};
+    PJ_CONTEXT *m_ctxt = nullptr;
+    OSRProjTLSCache::EPSGCache m_oCacheEPSG{256};
+    lru11::Cache<std::string, OSRProjTLSCache::UniquePtrPJ> m_oCacheWKT{256};
+    lru11::Cache<std::string, OSRProjTLSCache::BestMatch> m_oCacheBestMatch{
+        256};
+
+    PJ *Clone(const PJ *pj)
+    {
+        if (m_ctxt == nullptr)
+        {
+            m_ctxt = proj_context_create();
+            proj_log_func(m_ctxt, nullptr, osr_proj_logger);
+        }
+        return proj_clone(m_ctxt, pj);
+    }
+
+    template <class Cache, class Key>
+    PJ *Get(Cache &oCache, const Key &key, PJ_CONTEXT *ctxt)
+    {
+        std::lock_guard oLock(m_oMutex);
+        auto cached = oCache.getPtr(key);
+        return cached ? proj_clone(ctxt, cached->get()) : nullptr;
+    }
+
+    template <class Cache, class Key>
+    void Insert(Cache &oCache, const Key &key, const PJ *pj)
+    {
+        std::lock_guard oLock(m_oMutex);
+        oCache.insert(key, OSRProjTLSCache::UniquePtrPJ(Clone(pj)));
+    }
+
+    void clear()
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_oCacheEPSG.clear();
+        m_oCacheWKT.clear();
+        m_oCacheBestMatch.clear();
+        // Destroy context in last
+        if (m_ctxt)
+            proj_context_destroy(m_ctxt);
+        m_ctxt = nullptr;
+    }
+};
+
+static OSRProjGlobalCache &GetProjGlobalCache()
+{
+    // Intentionally leaked, as PJ objects should not be destroyed after
+    // PROJ has been unloaded. OSRCleanup() empties it.
+    static OSRProjGlobalCache *poCache = new OSRProjGlobalCache();
+    return *poCache;
+}
+
+/************************************************************************/
+/*                        OSRCleanupGlobalCache()                       */
+/************************************************************************/
+
+void OSRCleanupGlobalCache()
+{
+    GetProjGlobalCache().clear();
+}
+
 PJ *OSRProjTLSCache::GetPJForEPSGCode(int nCode, bool bUseNonDeprecated,
                                       bool bAddTOWGS84)
 {
@@ -343,7 +416,11 @@ PJ *OSRProjTLSCache::GetPJForEPSGCode(int nCode, bool bUseNonDeprecated,
     {
         return proj_clone(GetPJContext(), cached->get());
     }
-    return nullptr;
+    auto &oGlobalCache = GetProjGlobalCache();
+    PJ *pj = oGlobalCache.Get(oGlobalCache.m_oCacheEPSG, key, GetPJContext());
+    if (pj)
+        m_oCacheEPSG.insert(key, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    return pj;
 }
 
 void OSRProjTLSCache::CachePJForEPSGCode(int nCode, bool bUseNonDeprecated,
@@ -351,6 +428,8 @@ void OSRProjTLSCache::CachePJForEPSGCode(int nCode, bool bUseNonDeprecated,
 {
     const EPSGCacheKey key(nCode, bUseNonDeprecated, bAddTOWGS84);
     m_oCacheEPSG.insert(key, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    auto &oGlobalCache = GetProjGlobalCache();
+    oGlobalCache.Insert(oGlobalCache.m_oCacheEPSG, key, pj);
 }
 
 PJ *OSRProjTLSCache::GetPJForWKT(const std::string &wkt)
@@ -360,12 +439,65 @@ PJ *OSRProjTLSCache::GetPJForWKT(const std::string &wkt)
     {
         return proj_clone(GetPJContext(), cached->get());
     }
-    return nullptr;
+    auto &oGlobalCache = GetProjGlobalCache();
+    PJ *pj = oGlobalCache.Get(oGlobalCache.m_oCacheWKT, wkt, GetPJContext());
+    if (pj)
+        m_oCacheWKT.insert(wkt, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    return pj;
 }
 
 void OSRProjTLSCache::CachePJForWKT(const std::string &wkt, PJ *pj)
 {
     m_oCacheWKT.insert(wkt, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    auto &oGlobalCache = GetProjGlobalCache();
+    oGlobalCache.Insert(oGlobalCache.m_oCacheWKT, wkt, pj);
+}
+
+// Returns false if key is not in cache. Otherwise, pjOut is set to the best
+// match (or nullptr if there was none) and anMapping to its data axis to SRS
+// axis mapping (empty if default).
+bool OSRProjTLSCache::GetBestMatch(const std::string &key, PJ *&pjOut,
+                                   std::vector<int> &anMapping)
+{
+    auto cached = m_oCacheBestMatch.getPtr(key);
+    if (!cached)
+    {
+        BestMatch oMatch;
+        {
+            auto &oGlobalCache = GetProjGlobalCache();
+            std::lock_guard oLock(oGlobalCache.m_oMutex);
+            auto globalCached = oGlobalCache.m_oCacheBestMatch.getPtr(key);
+            if (!globalCached)
+                return false;
+            if (globalCached->pj)
+                oMatch.pj.reset(
+                    proj_clone(GetPJContext(), globalCached->pj.get()));
+            oMatch.anMapping = globalCached->anMapping;
+        }
+        m_oCacheBestMatch.insert(key, std::move(oMatch));
+        cached = m_oCacheBestMatch.getPtr(key);
+    }
+    pjOut = cached->pj ? proj_clone(GetPJContext(), cached->pj.get()) : nullptr;
+    anMapping = cached->anMapping;
+    return true;
+}
+
+void OSRProjTLSCache::CacheBestMatch(const std::string &key, PJ *pj,
+                                     const std::vector<int> &anMapping)
+{
+    BestMatch oMatch;
+    if (pj)
+        oMatch.pj.reset(proj_clone(GetPJContext(), pj));
+    oMatch.anMapping = anMapping;
+    m_oCacheBestMatch.insert(key, std::move(oMatch));
+
+    auto &oGlobalCache = GetProjGlobalCache();
+    std::lock_guard oLock(oGlobalCache.m_oMutex);
+    BestMatch oGlobalMatch;
+    if (pj)
+        oGlobalMatch.pj.reset(oGlobalCache.Clone(pj));
+    oGlobalMatch.anMapping = anMapping;
+    oGlobalCache.m_oCacheBestMatch.insert(key, std::move(oGlobalMatch));
 }
 
 /************************************************************************/
@@ -393,10 +525,14 @@ void OSRCleanupTLSContext()
  */
 void OSRSetPROJSearchPaths(const char *const *papszPaths)
 {
-    std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
-    g_searchPathGenerationCounter++;
-    g_aosSearchpaths.Assign(CSLDuplicate(papszPaths), true);
-    OSRInstallSetConfigOptionCallback();
+    {
+        std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
+        g_searchPathGenerationCounter++;
+        g_aosSearchpaths.Assign(CSLDuplicate(papszPaths), true);
+        OSRInstallSetConfigOptionCallback();
+    }
+    // Cached objects may come from another database
+    OSRCleanupGlobalCache();
 }
 
 /************************************************************************/
@@ -440,9 +576,13 @@ char **OSRGetPROJSearchPaths()
  */
 void OSRSetPROJAuxDbPaths(const char *const *papszAux)
 {
-    std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
-    g_auxDbPathsGenerationCounter++;
-    g_aosAuxDbPaths.Assign(CSLDuplicate(papszAux), true);
+    {
+        std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
+        g_auxDbPathsGenerationCounter++;
+        g_aosAuxDbPaths.Assign(CSLDuplicate(papszAux), true);
+    }
+    // Cached objects may come from another database
+    OSRCleanupGlobalCache();
 }
 
 /************************************************************************/
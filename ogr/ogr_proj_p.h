@@ -19,15 +19,24 @@
 
 #include <unordered_map>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 /*! @cond Doxygen_Suppress */
 
 PJ_CONTEXT CPL_DLL *OSRGetProjTLSContext();
 void OSRCleanupTLSContext();
 
+struct OSRProjGlobalCache;
+
+// Cache of PROJ objects for the current thread. When it misses, a
+// process-wide cache is consulted, so that each thread of a pool does not
+// have to query the PROJ database again.
 class OSRProjTLSCache
 {
+    friend struct OSRProjGlobalCache;
+
     struct OSRPJDeleter
     {
         void operator()(PJ *pj) const
@@ -69,14 +78,27 @@ class OSRProjTLSCache
 
     PJ_CONTEXT *m_tlsContext =
         nullptr;  // never use it directly. use GetPJContext()
-    lru11::Cache<EPSGCacheKey, UniquePtrPJ, lru11::NullLock,
-                 std::unordered_map<EPSGCacheKey,
-                                    typename std::list<lru11::KeyValuePair<
-                                        EPSGCacheKey, UniquePtrPJ>>::iterator,
-                                    EPSGCacheKeyHasher>>
-        m_oCacheEPSG{};
+    typedef lru11::Cache<
+        EPSGCacheKey, UniquePtrPJ, lru11::NullLock,
+        std::unordered_map<EPSGCacheKey,
+                           typename std::list<lru11::KeyValuePair<
+                               EPSGCacheKey, UniquePtrPJ>>::iterator,
+                           EPSGCacheKeyHasher>>
+        EPSGCache;
+
+    EPSGCache m_oCacheEPSG{};
     lru11::Cache<std::string, UniquePtrPJ> m_oCacheWKT{};
 
+    // Result of OGRSpatialReference::FindBestMatch(). pj is null when there
+    // was no match.
+    struct BestMatch
+    {
+        UniquePtrPJ pj{};
+        std::vector<int> anMapping{};
+    };
+
+    lru11::Cache<std::string, BestMatch> m_oCacheBestMatch{};
+
     PJ_CONTEXT *GetPJContext();
 
     OSRProjTLSCache(const OSRProjTLSCache &) = delete;
@@ -95,9 +117,15 @@ class OSRProjTLSCache
 
     PJ *GetPJForWKT(const std::string &wkt);
     void CachePJForWKT(const std::string &wkt, PJ *pj);
+
+    bool GetBestMatch(const std::string &key, PJ *&pjOut,
+                      std::vector<int> &anMapping);
+    void CacheBestMatch(const std::string &key, PJ *pj,
+                        const std::vector<int> &anMapping);
 };
 
 OSRProjTLSCache *OSRGetProjTLSCache();
+void OSRCleanupGlobalCache();
 
 void OGRCTDumpStatistics();
 
@@ -12,6 +12,7 @@
 
 #include "cpl_error.h"
 #include "ogr_wkb.h"
+#include "ogr_envelope_kernel.h"
 #include "ogr_core.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
@@ -298,6 +299,14 @@ static bool ReadWKBPointSequence(const uint8_t *data, size_t size,
         OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
     if (nPoints > (size - iOffset) / (nDim * sizeof(double)))
         return false;
+    if (!OGR_SWAP(eByteOrder) && !(INCLUDE_Z && bHasZ))
+    {
+        OGRUpdateEnvelopeXY(data + iOffset, nPoints, nDim * sizeof(double),
+                            sEnvelope.MinX, sEnvelope.MinY, sEnvelope.MaxX,
+                            sEnvelope.MaxY);
+        iOffset += static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        return true;
+    }
     double dfX = 0;
     double dfY = 0;
     [[maybe_unused]] double dfZ = 0;
@@ -1653,3 +1662,493 @@ size_t OGRWKTToWKBTranslator::TranslateWKT(void *pabyWKTStart, size_t nLength,
     poGeometry->exportToWkb(wkbNDR, pabyWKB, wkbVariantIso);
     return nWKBSize;
 }
+
+/************************************************************************/
+/*              OGRWKBGeometryView::PointSequence::Read()               */
+/************************************************************************/
+
+double OGRWKBGeometryView::PointSequence::Read(uint32_t i, int iDim) const
+{
+    return OGRWKBReadFloat64(
+        m_pabyData + (static_cast<size_t>(i) * m_nDim + iDim) * sizeof(double),
+        m_bNeedSwap);
+}
+
+/************************************************************************/
+/*                        OGRWKBGeometryView()                          */
+/************************************************************************/
+
+/** Construct a view over the WKB geometry starting at pabyWkb.
+ *
+ * The WKB is fully validated at construction time. IsValid() must be
+ * checked before using the other methods.
+ *
+ * @param pabyWkb WKB or ISO WKB buffer.
+ * @param nWKBSize Size in bytes of pabyWkb.
+ */
+OGRWKBGeometryView::OGRWKBGeometryView(const GByte *pabyWkb, size_t nWKBSize)
+{
+    if (!Parse(pabyWkb, nWKBSize, 0))
+        *this = OGRWKBGeometryView();
+}
+
+/************************************************************************/
+/*                                Parse()                               */
+/************************************************************************/
+
+bool OGRWKBGeometryView::Parse(const GByte *pabyWkb, size_t nWKBSize, int nRec)
+{
+    if (pabyWkb == nullptr || nWKBSize < WKB_PREFIX_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(pabyWkb[0]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    m_bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(nByteOrder));
+
+    OGRwkbGeometryType eType = wkbUnknown;
+    if (OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &eType) != OGRERR_NONE)
+        return false;
+    m_bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eType));
+    m_bHasM = CPL_TO_BOOL(OGR_GT_HasM(eType));
+    m_nDim = 2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0);
+    const size_t nPointSize = m_nDim * sizeof(double);
+    const auto eFlatType = wkbFlatten(eType);
+
+    size_t nOffset = WKB_PREFIX_SIZE;
+    if (eFlatType == wkbPoint)
+    {
+        if (nWKBSize - nOffset < nPointSize)
+            return false;
+        nOffset += nPointSize;
+        m_nCount = 1;
+    }
+    else
+    {
+        if (nWKBSize - nOffset < sizeof(uint32_t))
+            return false;
+        m_nCount = OGRWKBReadUInt32(pabyWkb + nOffset, m_bNeedSwap);
+        nOffset += sizeof(uint32_t);
+
+        if (eFlatType == wkbLineString)
+        {
+            if (m_nCount > (nWKBSize - nOffset) / nPointSize)
+                return false;
+            nOffset += m_nCount * nPointSize;
+        }
+        else if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+        {
+            if (m_nCount > (nWKBSize - nOffset) / sizeof(uint32_t))
+                return false;
+            for (uint32_t i = 0; i < m_nCount; ++i)
+            {
+                if (nWKBSize - nOffset < sizeof(uint32_t))
+                    return false;
+                const uint32_t nPoints =
+                    OGRWKBReadUInt32(pabyWkb + nOffset, m_bNeedSwap);
+                nOffset += sizeof(uint32_t);
+                if (nPoints > (nWKBSize - nOffset) / nPointSize)
+                    return false;
+                nOffset += nPoints * nPointSize;
+            }
+        }
+        else if (eFlatType == wkbMultiPoint ||
+                 eFlatType == wkbMultiLineString ||
+                 eFlatType == wkbMultiPolygon ||
+                 eFlatType == wkbGeometryCollection)
+        {
+            if (nRec == 128)
+                return false;
+            if (m_nCount > (nWKBSize - nOffset) / MIN_WKB_SIZE)
+                return false;
+            const OGRwkbGeometryType eExpectedPartType =
+                eFlatType == wkbMultiPoint        ? wkbPoint
+                : eFlatType == wkbMultiLineString ? wkbLineString
+                : eFlatType == wkbMultiPolygon    ? wkbPolygon
+                                                  : wkbUnknown;
+            for (uint32_t i = 0; i < m_nCount; ++i)
+            {
+                OGRWKBGeometryView oPart;
+                if (!oPart.Parse(pabyWkb + nOffset, nWKBSize - nOffset,
+                                 nRec + 1))
+                    return false;
+                if (eExpectedPartType != wkbUnknown &&
+                    wkbFlatten(oPart.m_eType) != eExpectedPartType)
+                    return false;
+                nOffset += oPart.m_nSize;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    m_pabyData = pabyWkb;
+    m_nSize = nOffset;
+    m_eType = eType;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetPointSequence()                          */
+/************************************************************************/
+
+// pabyData must point to the number of points of the sequence.
+OGRWKBGeometryView::PointSequence
+OGRWKBGeometryView::GetPointSequence(const GByte *pabyData) const
+{
+    PointSequence oSeq;
+    oSeq.m_nPoints = OGRWKBReadUInt32(pabyData, m_bNeedSwap);
+    oSeq.m_pabyData = pabyData + sizeof(uint32_t);
+    oSeq.m_nDim = m_nDim;
+    oSeq.m_bNeedSwap = m_bNeedSwap;
+    oSeq.m_bHasZ = m_bHasZ;
+    oSeq.m_bHasM = m_bHasM;
+    return oSeq;
+}
+
+/************************************************************************/
+/*                              IsEmpty()                               */
+/************************************************************************/
+
+/** Return whether the geometry is empty (or the view invalid). */
+bool OGRWKBGeometryView::IsEmpty() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (!IsValid())
+    {
+        return true;
+    }
+    else if (eFlatType == wkbPoint)
+    {
+        const auto oPoints = GetPoints();
+        return oPoints.size() == 0;
+    }
+    else if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+        {
+            if (GetRing(i).size() != 0)
+                return false;
+        }
+        return true;
+    }
+    else if (OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection))
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+        {
+            if (!GetGeometry(i).IsEmpty())
+                return false;
+        }
+        return true;
+    }
+    return m_nCount == 0;
+}
+
+/************************************************************************/
+/*                          GetNumGeometries()                          */
+/************************************************************************/
+
+/** Return the number of parts of a multi geometry or geometry collection,
+ * or 0 for other geometry types. */
+uint32_t OGRWKBGeometryView::GetNumGeometries() const
+{
+    return OGR_GT_IsSubClassOf(wkbFlatten(m_eType), wkbGeometryCollection)
+               ? m_nCount
+               : 0;
+}
+
+/************************************************************************/
+/*                            GetGeometry()                             */
+/************************************************************************/
+
+/** Return a view over the i-th part of a multi geometry or geometry
+ * collection, or an invalid view if i is out of range.
+ *
+ * This requires skipping the i-1 previous parts, so iterating over
+ * parts is quadratic in the number of parts, but not in the number of points.
+ */
+OGRWKBGeometryView OGRWKBGeometryView::GetGeometry(uint32_t i) const
+{
+    if (i >= GetNumGeometries())
+        return OGRWKBGeometryView();
+    size_t nOffset = MIN_WKB_SIZE;
+    for (uint32_t k = 0;; ++k)
+    {
+        OGRWKBGeometryView oPart(m_pabyData + nOffset, m_nSize - nOffset);
+        if (k == i || !oPart.IsValid())
+            return oPart;
+        nOffset += oPart.m_nSize;
+    }
+}
+
+/************************************************************************/
+/*                            GetNumRings()                             */
+/************************************************************************/
+
+/** Return the number of rings of a polygon or triangle, or 0 for other
+ * geometry types. */
+uint32_t OGRWKBGeometryView::GetNumRings() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    return eFlatType == wkbPolygon || eFlatType == wkbTriangle ? m_nCount : 0;
+}
+
+/************************************************************************/
+/*                              GetRing()                               */
+/************************************************************************/
+
+/** Return the points of the i-th ring of a polygon or triangle (the
+ * exterior ring being at index 0), or an empty sequence if i is out of
+ * range. */
+OGRWKBGeometryView::PointSequence OGRWKBGeometryView::GetRing(uint32_t i) const
+{
+    if (i >= GetNumRings())
+        return PointSequence();
+    const size_t nPointSize = m_nDim * sizeof(double);
+    const GByte *pabyData = m_pabyData + MIN_WKB_SIZE;
+    for (uint32_t k = 0; k < i; ++k)
+    {
+        const uint32_t nPoints = OGRWKBReadUInt32(pabyData, m_bNeedSwap);
+        pabyData += sizeof(uint32_t) + nPoints * nPointSize;
+    }
+    return GetPointSequence(pabyData);
+}
+
+/************************************************************************/
+/*                             GetPoints()                              */
+/************************************************************************/
+
+/** Return the points of a point or line string, or an empty sequence for
+ * other geometry types. An empty point has no point. */
+OGRWKBGeometryView::PointSequence OGRWKBGeometryView::GetPoints() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbLineString)
+        return GetPointSequence(m_pabyData + WKB_PREFIX_SIZE);
+    PointSequence oSeq;
+    if (eFlatType == wkbPoint)
+    {
+        oSeq.m_pabyData = m_pabyData + WKB_PREFIX_SIZE;
+        oSeq.m_nDim = m_nDim;
+        oSeq.m_bNeedSwap = m_bNeedSwap;
+        oSeq.m_bHasZ = m_bHasZ;
+        oSeq.m_bHasM = m_bHasM;
+        oSeq.m_nPoints = 1;
+        if (std::isnan(oSeq.getX(0)) && std::isnan(oSeq.getY(0)))
+            oSeq.m_nPoints = 0;
+    }
+    return oSeq;
+}
+
+/************************************************************************/
+/*                            GetEnvelope()                             */
+/************************************************************************/
+
+/** Return the 2D envelope of the geometry. */
+OGREnvelope OGRWKBGeometryView::GetEnvelope() const
+{
+    OGREnvelope sEnvelope;
+    if (IsValid() && !OGRWKBGetBoundingBox(m_pabyData, m_nSize, sEnvelope))
+        sEnvelope = OGREnvelope();
+    return sEnvelope;
+}
+
+/************************************************************************/
+/*                      OGRWKBPointSequenceLength()                     */
+/************************************************************************/
+
+static double
+OGRWKBPointSequenceLength(const OGRWKBGeometryView::PointSequence &oSeq)
+{
+    double dfLength = 0;
+    const uint32_t nPoints = oSeq.size();
+    for (uint32_t i = 1; i < nPoints; ++i)
+    {
+        const double dfDX = oSeq.getX(i) - oSeq.getX(i - 1);
+        const double dfDY = oSeq.getY(i) - oSeq.getY(i - 1);
+        dfLength += sqrt(dfDX * dfDX + dfDY * dfDY);
+    }
+    return dfLength;
+}
+
+/************************************************************************/
+/*                             GetLength()                              */
+/************************************************************************/
+
+/** Return the 2D length of a line string, the perimeter of a polygon
+ * (including its interior rings), or the sum of those of the parts of a
+ * collection. */
+double OGRWKBGeometryView::GetLength() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    double dfLength = 0;
+    if (eFlatType == wkbLineString)
+    {
+        dfLength = OGRWKBPointSequenceLength(GetPoints());
+    }
+    else if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+            dfLength += OGRWKBPointSequenceLength(GetRing(i));
+    }
+    else if (OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection))
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+            dfLength += GetGeometry(i).GetLength();
+    }
+    return dfLength;
+}
+
+/************************************************************************/
+/*                       OGRWKBPointSequenceArea()                      */
+/************************************************************************/
+
+// Cf OGRSimpleCurve::get_LinearArea()
+static double
+OGRWKBPointSequenceArea(const OGRWKBGeometryView::PointSequence &oSeq)
+{
+    const uint32_t nPoints = oSeq.size();
+    if (nPoints < 2)
+        return 0;
+
+    double dfAreaSum = oSeq.getX(0) * (oSeq.getY(1) - oSeq.getY(nPoints - 1));
+    for (uint32_t i = 1; i < nPoints - 1; i++)
+    {
+        dfAreaSum += oSeq.getX(i) * (oSeq.getY(i + 1) - oSeq.getY(i - 1));
+    }
+    dfAreaSum +=
+        oSeq.getX(nPoints - 1) * (oSeq.getY(0) - oSeq.getY(nPoints - 2));
+
+    return 0.5 * fabs(dfAreaSum);
+}
+
+/************************************************************************/
+/*                              GetArea()                               */
+/************************************************************************/
+
+/** Return the area of a polygon (exterior ring area minus interior ring
+ * areas), or the sum of the areas of the parts of a collection. */
+double OGRWKBGeometryView::GetArea() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    double dfArea = 0;
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+        {
+            const double dfRingArea = OGRWKBPointSequenceArea(GetRing(i));
+            dfArea += i == 0 ? dfRingArea : -dfRingArea;
+        }
+    }
+    else if (OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection))
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+            dfArea += GetGeometry(i).GetArea();
+    }
+    return dfArea;
+}
+
+/************************************************************************/
+/*                    OGRWKBPointSequenceContains()                     */
+/************************************************************************/
+
+// Cf OGRLinearRing::isPointInRing()
+static bool
+OGRWKBPointSequenceContains(const OGRWKBGeometryView::PointSequence &oSeq,
+                            double dfTestX, double dfTestY)
+{
+    const uint32_t nPoints = oSeq.size();
+    if (nPoints < 4)
+        return false;
+
+    // For every point p in ring,
+    // test if ray starting from given point crosses segment (p - 1, p)
+    int iNumCrossings = 0;
+
+    double prev_diff_x = oSeq.getX(0) - dfTestX;
+    double prev_diff_y = oSeq.getY(0) - dfTestY;
+
+    for (uint32_t iPoint = 1; iPoint < nPoints; iPoint++)
+    {
+        const double x1 = oSeq.getX(iPoint) - dfTestX;
+        const double y1 = oSeq.getY(iPoint) - dfTestY;
+
+        const double x2 = prev_diff_x;
+        const double y2 = prev_diff_y;
+
+        if (((y1 > 0) && (y2 <= 0)) || ((y2 > 0) && (y1 <= 0)))
+        {
+            // Check if ray intersects with segment of the ring
+            const double dfIntersection = (x1 * y2 - x2 * y1) / (y2 - y1);
+            if (0.0 < dfIntersection)
+            {
+                // Count intersections
+                iNumCrossings++;
+            }
+        }
+
+        prev_diff_x = x1;
+        prev_diff_y = y1;
+    }
+
+    return (iNumCrossings % 2) != 0;
+}
+
+/************************************************************************/
+/*                           ContainsPoint()                            */
+/************************************************************************/
+
+/** Return whether the 2D point (dfX, dfY) is inside a polygon, or inside
+ * one of the polygons of a collection.
+ *
+ * The result is unspecified for points located on a ring boundary.
+ */
+bool OGRWKBGeometryView::ContainsPoint(double dfX, double dfY) const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        if (m_nCount == 0 || !OGRWKBPointSequenceContains(GetRing(0), dfX, dfY))
+            return false;
+        for (uint32_t i = 1; i < m_nCount; ++i)
+        {
+            if (OGRWKBPointSequenceContains(GetRing(i), dfX, dfY))
+                return false;
+        }
+        return true;
+    }
+    else if (OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection))
+    {
+        for (uint32_t i = 0; i < m_nCount; ++i)
+        {
+            if (GetGeometry(i).ContainsPoint(dfX, dfY))
+                return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                             ToGeometry()                             */
+/************************************************************************/
+
+/** Instantiate an OGRGeometry from the viewed WKB.
+ *
+ * @return a new geometry, or nullptr for an invalid view.
+ */
+std::unique_ptr<OGRGeometry> OGRWKBGeometryView::ToGeometry() const
+{
+    if (!IsValid())
+        return nullptr;
+    OGRGeometry *poGeom = nullptr;
+    size_t nBytesConsumed = 0;
+    if (OGRGeometryFactory::createFromWkb(m_pabyData, nullptr, &poGeom, m_nSize,
+                                          wkbVariantIso,
+                                          nBytesConsumed) != OGRERR_NONE)
+    {
+        delete poGeom;
+        return nullptr;
+    }
+    return std::unique_ptr<OGRGeometry>(poGeom);
+}
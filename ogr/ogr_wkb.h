@@ -18,6 +18,7 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+#include <memory>
 #include <vector>
 
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
@@ -90,6 +91,151 @@ bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
                              OGRWKBTransformCache &oCache,
                              OGREnvelope3D &sEnvelope);
 
+/************************************************************************/
+/*                        OGRWKBGeometryView                            */
+/************************************************************************/
+
+class OGRGeometry;
+
+/** Non-owning, read-only view over a WKB or ISO WKB geometry.
+ *
+ * It gives access to the structure and coordinates of a geometry, and
+ * computes its envelope, length and area, without instantiating an
+ * OGRGeometry.
+ *
+ * Only linear geometry types are handled: points, line strings, polygons,
+ * triangles, their multi variants and geometry collections of them, with
+ * optional Z and/or M. For other geometry types, or truncated or corrupted
+ * WKB, IsValid() returns false.
+ *
+ * The viewed buffer must outlive the view.
+ *
+ * @since GDAL 3.11
+ */
+class CPL_DLL OGRWKBGeometryView
+{
+  public:
+    /** Read-only view over the points of a point, line string or ring. */
+    class CPL_DLL PointSequence
+    {
+      public:
+        /** Return the number of points. */
+        inline uint32_t size() const
+        {
+            return m_nPoints;
+        }
+
+        /** Return the X coordinate of the i-th point. */
+        inline double getX(uint32_t i) const
+        {
+            return Read(i, 0);
+        }
+
+        /** Return the Y coordinate of the i-th point. */
+        inline double getY(uint32_t i) const
+        {
+            return Read(i, 1);
+        }
+
+        /** Return the Z coordinate of the i-th point, or 0 if there is none. */
+        inline double getZ(uint32_t i) const
+        {
+            return m_bHasZ ? Read(i, 2) : 0.0;
+        }
+
+        /** Return the M coordinate of the i-th point, or 0 if there is none. */
+        inline double getM(uint32_t i) const
+        {
+            return m_bHasM ? Read(i, m_bHasZ ? 3 : 2) : 0.0;
+        }
+
+      private:
+        friend class OGRWKBGeometryView;
+
+        const GByte *m_pabyData = nullptr;
+        uint32_t m_nPoints = 0;
+        int m_nDim = 2;
+        bool m_bNeedSwap = false;
+        bool m_bHasZ = false;
+        bool m_bHasM = false;
+
+        double Read(uint32_t i, int iDim) const;
+    };
+
+    /** Construct an invalid view. */
+    OGRWKBGeometryView() = default;
+
+    OGRWKBGeometryView(const GByte *pabyWkb, size_t nWKBSize);
+
+    /** Return whether the WKB could be parsed. */
+    inline bool IsValid() const
+    {
+        return m_pabyData != nullptr;
+    }
+
+    /** Return the pointer to the start of the viewed WKB. */
+    inline const GByte *GetWkb() const
+    {
+        return m_pabyData;
+    }
+
+    /** Return the number of bytes used by the viewed geometry, which may be
+     * smaller than the size of the buffer passed to the constructor. */
+    inline size_t GetWkbSize() const
+    {
+        return m_nSize;
+    }
+
+    /** Return the geometry type, or wkbUnknown for an invalid view. */
+    inline OGRwkbGeometryType GetGeometryType() const
+    {
+        return m_eType;
+    }
+
+    /** Return whether the geometry has a Z dimension. */
+    inline bool Is3D() const
+    {
+        return m_bHasZ;
+    }
+
+    /** Return whether the geometry has a M dimension. */
+    inline bool IsMeasured() const
+    {
+        return m_bHasM;
+    }
+
+    bool IsEmpty() const;
+
+    uint32_t GetNumGeometries() const;
+    OGRWKBGeometryView GetGeometry(uint32_t i) const;
+
+    uint32_t GetNumRings() const;
+    PointSequence GetRing(uint32_t i) const;
+
+    PointSequence GetPoints() const;
+
+    OGREnvelope GetEnvelope() const;
+    double GetLength() const;
+    double GetArea() const;
+    bool ContainsPoint(double dfX, double dfY) const;
+
+    std::unique_ptr<OGRGeometry> ToGeometry() const;
+
+  private:
+    const GByte *m_pabyData = nullptr;
+    size_t m_nSize = 0;
+    OGRwkbGeometryType m_eType = wkbUnknown;
+    bool m_bNeedSwap = false;
+    bool m_bHasZ = false;
+    bool m_bHasM = false;
+    int m_nDim = 2;
+    //! Number of points, rings or parts, depending on the geometry type
+    uint32_t m_nCount = 0;
+
+    bool Parse(const GByte *pabyWkb, size_t nWKBSize, int nRec);
+    PointSequence GetPointSequence(const GByte *pabyData) const;
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
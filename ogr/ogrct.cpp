@@ -744,6 +744,7 @@ class OGRProjCT : public OGRCoordinateTransformation
     std::string m_osTargetSRS{};  // WKT, PROJ4 or AUTH:CODE
 
     bool bWebMercatorToWGS84LongLat = false;
+    bool bWGS84LongLatToWebMercator = false;
 
     size_t nErrorCount = 0;
 
@@ -1260,6 +1261,7 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       dfTargetCoordinateEpoch(other.dfTargetCoordinateEpoch),
       m_osTargetSRS(other.m_osTargetSRS),
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
+      bWGS84LongLatToWebMercator(other.bWGS84LongLatToWebMercator),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
       m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
@@ -1309,15 +1311,118 @@ void OGRProjCT::ComputeThreshold()
     }
 }
 
+/************************************************************************/
+/*                    IsWebMercatorAndWGS84LongLat()                    */
+/************************************************************************/
+
+// Returns whether poMercSRS is WebMercator and poGeogSRS is WGS84 long/lat.
+static bool IsWebMercatorAndWGS84LongLat(const OGRSpatialReference *poMercSRS,
+                                         const OGRSpatialReference *poGeogSRS)
+{
+    bool bRet = false;
+
+    // Examine SRS ID before going to Proj4 string for faster execution
+    // This assumes that the SRS definition is "not lying", that is, it
+    // is equivalent to the resolution of the official EPSG code.
+    const char *pszMercAuth = poMercSRS->GetAuthorityName(nullptr);
+    const char *pszMercCode = poMercSRS->GetAuthorityCode(nullptr);
+    const char *pszGeogAuth = poGeogSRS->GetAuthorityName(nullptr);
+    const char *pszGeogCode = poGeogSRS->GetAuthorityCode(nullptr);
+    if (pszMercAuth && pszMercCode && pszGeogAuth && pszGeogCode &&
+        EQUAL(pszMercAuth, "EPSG") && EQUAL(pszGeogAuth, "EPSG"))
+    {
+        bRet = (EQUAL(pszMercCode, "3857") ||
+                EQUAL(pszMercCode, "3785") ||     // deprecated
+                EQUAL(pszMercCode, "900913")) &&  // deprecated
+               EQUAL(pszGeogCode, "4326");
+    }
+    else
+    {
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        char *pszMercProj4Defn = nullptr;
+        poMercSRS->exportToProj4(&pszMercProj4Defn);
+
+        char *pszGeogProj4Defn = nullptr;
+        poGeogSRS->exportToProj4(&pszGeogProj4Defn);
+        CPLPopErrorHandler();
+
+        if (pszMercProj4Defn && pszGeogProj4Defn)
+        {
+            if (pszMercProj4Defn[0] != '\0' &&
+                pszMercProj4Defn[strlen(pszMercProj4Defn) - 1] == ' ')
+                pszMercProj4Defn[strlen(pszMercProj4Defn) - 1] = 0;
+            if (pszGeogProj4Defn[0] != '\0' &&
+                pszGeogProj4Defn[strlen(pszGeogProj4Defn) - 1] == ' ')
+                pszGeogProj4Defn[strlen(pszGeogProj4Defn) - 1] = 0;
+            char *pszNeedle = strstr(pszMercProj4Defn, "  ");
+            if (pszNeedle)
+                memmove(pszNeedle, pszNeedle + 1, strlen(pszNeedle + 1) + 1);
+            pszNeedle = strstr(pszGeogProj4Defn, "  ");
+            if (pszNeedle)
+                memmove(pszNeedle, pszNeedle + 1, strlen(pszNeedle + 1) + 1);
+
+            if ((strstr(pszGeogProj4Defn, "+datum=WGS84") != nullptr ||
+                 strstr(pszGeogProj4Defn,
+                        "+ellps=WGS84 +towgs84=0,0,0,0,0,0,0 ") != nullptr) &&
+                strstr(pszMercProj4Defn, "+nadgrids=@null ") != nullptr &&
+                strstr(pszMercProj4Defn, "+towgs84") == nullptr)
+            {
+                char *pszDst =
+                    strstr(pszGeogProj4Defn, "+towgs84=0,0,0,0,0,0,0 ");
+                if (pszDst != nullptr)
+                {
+                    char *pszSrc = pszDst + strlen("+towgs84=0,0,0,0,0,0,0 ");
+                    memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
+                }
+                else
+                {
+                    memcpy(strstr(pszGeogProj4Defn, "+datum=WGS84"), "+ellps",
+                           6);
+                }
+
+                pszDst = strstr(pszMercProj4Defn, "+nadgrids=@null ");
+                char *pszSrc = pszDst + strlen("+nadgrids=@null ");
+                memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
+
+                pszDst = strstr(pszMercProj4Defn, "+wktext ");
+                if (pszDst)
+                {
+                    pszSrc = pszDst + strlen("+wktext ");
+                    memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
+                }
+                bRet = strcmp(pszGeogProj4Defn,
+                              "+proj=longlat +ellps=WGS84 +no_defs") == 0 &&
+                       (strcmp(pszMercProj4Defn,
+                               "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 "
+                               "+lon_0=0.0 "
+                               "+x_0=0.0 +y_0=0 +k=1.0 +units=m +no_defs") ==
+                            0 ||
+                        strcmp(pszMercProj4Defn,
+                               "+proj=merc +a=6378137 +b=6378137 +lat_ts=0 "
+                               "+lon_0=0 "
+                               "+x_0=0 +y_0=0 +k=1 +units=m +no_defs") == 0);
+            }
+        }
+
+        CPLFree(pszMercProj4Defn);
+        CPLFree(pszGeogProj4Defn);
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                        DetectWebMercatorToWGS84()                    */
 /************************************************************************/
 
 void OGRProjCT::DetectWebMercatorToWGS84()
 {
+    if (!m_options.d->osCoordOperation.empty() || !poSRSSource ||
+        !poSRSTarget)
+        return;
+
     // Detect webmercator to WGS84
-    if (m_options.d->osCoordOperation.empty() && poSRSSource && poSRSTarget &&
-        poSRSSource->IsProjected() && poSRSTarget->IsGeographic() &&
+    if (poSRSSource->IsProjected() && poSRSTarget->IsGeographic() &&
         ((m_eTargetFirstAxisOrient == OAO_North &&
           poSRSTarget->GetDataAxisToSRSAxisMapping() ==
               std::vector<int>{2, 1}) ||
@@ -1325,104 +1430,29 @@ void OGRProjCT::DetectWebMercatorToWGS84()
           poSRSTarget->GetDataAxisToSRSAxisMapping() ==
               std::vector<int>{1, 2})))
     {
-        // Examine SRS ID before going to Proj4 string for faster execution
-        // This assumes that the SRS definition is "not lying", that is, it
-        // is equivalent to the resolution of the official EPSG code.
-        const char *pszSourceAuth = poSRSSource->GetAuthorityName(nullptr);
-        const char *pszSourceCode = poSRSSource->GetAuthorityCode(nullptr);
-        const char *pszTargetAuth = poSRSTarget->GetAuthorityName(nullptr);
-        const char *pszTargetCode = poSRSTarget->GetAuthorityCode(nullptr);
-        if (pszSourceAuth && pszSourceCode && pszTargetAuth && pszTargetCode &&
-            EQUAL(pszSourceAuth, "EPSG") && EQUAL(pszTargetAuth, "EPSG"))
-        {
-            bWebMercatorToWGS84LongLat =
-                (EQUAL(pszSourceCode, "3857") ||
-                 EQUAL(pszSourceCode, "3785") ||     // deprecated
-                 EQUAL(pszSourceCode, "900913")) &&  // deprecated
-                EQUAL(pszTargetCode, "4326");
-        }
-        else
-        {
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            char *pszSrcProj4Defn = nullptr;
-            poSRSSource->exportToProj4(&pszSrcProj4Defn);
-
-            char *pszDstProj4Defn = nullptr;
-            poSRSTarget->exportToProj4(&pszDstProj4Defn);
-            CPLPopErrorHandler();
-
-            if (pszSrcProj4Defn && pszDstProj4Defn)
-            {
-                if (pszSrcProj4Defn[0] != '\0' &&
-                    pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] == ' ')
-                    pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] = 0;
-                if (pszDstProj4Defn[0] != '\0' &&
-                    pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] == ' ')
-                    pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] = 0;
-                char *pszNeedle = strstr(pszSrcProj4Defn, "  ");
-                if (pszNeedle)
-                    memmove(pszNeedle, pszNeedle + 1,
-                            strlen(pszNeedle + 1) + 1);
-                pszNeedle = strstr(pszDstProj4Defn, "  ");
-                if (pszNeedle)
-                    memmove(pszNeedle, pszNeedle + 1,
-                            strlen(pszNeedle + 1) + 1);
-
-                if ((strstr(pszDstProj4Defn, "+datum=WGS84") != nullptr ||
-                     strstr(pszDstProj4Defn,
-                            "+ellps=WGS84 +towgs84=0,0,0,0,0,0,0 ") !=
-                         nullptr) &&
-                    strstr(pszSrcProj4Defn, "+nadgrids=@null ") != nullptr &&
-                    strstr(pszSrcProj4Defn, "+towgs84") == nullptr)
-                {
-                    char *pszDst =
-                        strstr(pszDstProj4Defn, "+towgs84=0,0,0,0,0,0,0 ");
-                    if (pszDst != nullptr)
-                    {
-                        char *pszSrc =
-                            pszDst + strlen("+towgs84=0,0,0,0,0,0,0 ");
-                        memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
-                    }
-                    else
-                    {
-                        memcpy(strstr(pszDstProj4Defn, "+datum=WGS84"),
-                               "+ellps", 6);
-                    }
-
-                    pszDst = strstr(pszSrcProj4Defn, "+nadgrids=@null ");
-                    char *pszSrc = pszDst + strlen("+nadgrids=@null ");
-                    memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
-
-                    pszDst = strstr(pszSrcProj4Defn, "+wktext ");
-                    if (pszDst)
-                    {
-                        pszSrc = pszDst + strlen("+wktext ");
-                        memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
-                    }
-                    bWebMercatorToWGS84LongLat =
-                        strcmp(pszDstProj4Defn,
-                               "+proj=longlat +ellps=WGS84 +no_defs") == 0 &&
-                        (strcmp(pszSrcProj4Defn,
-                                "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 "
-                                "+lon_0=0.0 "
-                                "+x_0=0.0 +y_0=0 +k=1.0 +units=m +no_defs") ==
-                             0 ||
-                         strcmp(pszSrcProj4Defn,
-                                "+proj=merc +a=6378137 +b=6378137 +lat_ts=0 "
-                                "+lon_0=0 "
-                                "+x_0=0 +y_0=0 +k=1 +units=m +no_defs") == 0);
-                }
-            }
-
-            CPLFree(pszSrcProj4Defn);
-            CPLFree(pszDstProj4Defn);
-        }
-
+        bWebMercatorToWGS84LongLat =
+            IsWebMercatorAndWGS84LongLat(poSRSSource, poSRSTarget);
         if (bWebMercatorToWGS84LongLat)
         {
             CPLDebug("OGRCT", "Using WebMercator to WGS84 optimization");
         }
     }
+    // Detect WGS84 to webmercator
+    else if (poSRSSource->IsGeographic() && poSRSTarget->IsProjected() &&
+             ((m_eSourceFirstAxisOrient == OAO_North &&
+               poSRSSource->GetDataAxisToSRSAxisMapping() ==
+                   std::vector<int>{2, 1}) ||
+              (m_eSourceFirstAxisOrient == OAO_East &&
+               poSRSSource->GetDataAxisToSRSAxisMapping() ==
+                   std::vector<int>{1, 2})))
+    {
+        bWGS84LongLatToWebMercator =
+            IsWebMercatorAndWGS84LongLat(poSRSTarget, poSRSSource);
+        if (bWGS84LongLatToWebMercator)
+        {
+            CPLDebug("OGRCT", "Using WGS84 to WebMercator optimization");
+        }
+    }
 }
 
 /************************************************************************/
@@ -1624,7 +1654,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                  m_bReversePj ? "(reversed) " : "");
 #endif
     }
-    else if (!bWebMercatorToWGS84LongLat && poSRSSource && poSRSTarget)
+    else if (!bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+             poSRSSource && poSRSTarget)
     {
 #ifdef DEBUG_PERF
         struct CPLTimeVal tvStart;
@@ -2485,6 +2516,88 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
         bTransformDone = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optimized transform from WGS84 to WebMercator                   */
+    /* -------------------------------------------------------------------- */
+    if (bWGS84LongLatToWebMercator)
+    {
+        // Same formulas and domain checks as PROJ "webmerc"
+        constexpr double SPHERE_RADIUS = 6378137.0;
+        constexpr double DEG_TO_RAD = M_PI / 180.;
+        constexpr double EPS_LAT = 1e-12;
+        constexpr double EPS10 = 1e-10;
+
+        if (m_eSourceFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        const double y0 = y[0];
+        for (size_t i = 0; i < nCount; i++)
+        {
+            int err = 0;
+            double dfLong = x[i] * DEG_TO_RAD;
+            const double dfLat = y[i] * DEG_TO_RAD;
+            if (!std::isfinite(dfLong) || !std::isfinite(dfLat) ||
+                std::fabs(dfLat) - M_PI / 2 > EPS_LAT || dfLong > 10 ||
+                dfLong < -10)
+            {
+                err = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+            }
+            else if (std::fabs(std::fabs(dfLat) - M_PI / 2) <= EPS10)
+            {
+                err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+            }
+            if (err != 0)
+            {
+                bRet = FALSE;
+                x[i] = HUGE_VAL;
+                y[i] = HUGE_VAL;
+                if (panErrorCodes)
+                    panErrorCodes[i] = err;
+                if (++nErrorCount < 20)
+                {
+                    // Same messages as PROJ
+                    const char *pszError =
+                        err == PROJ_ERR_COORD_TRANSFM_INVALID_COORD
+                            ? "Invalid coordinate"
+                            : "Point outside of projection domain";
+                    if (m_bEmitErrors)
+                        CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+                    else
+                        CPLDebug("OGRCT", "%s", pszError);
+                }
+                continue;
+            }
+
+            // Cf PROJ adjlon()
+            if (std::fabs(dfLong) >= M_PI + 1e-12)
+            {
+                dfLong += M_PI;
+                dfLong -= 2 * M_PI * std::floor(dfLong / (2 * M_PI));
+                dfLong -= M_PI;
+            }
+            x[i] = SPHERE_RADIUS * dfLong;
+
+            // Optimization for the case where we are provided a whole line
+            // of same latitude.
+            if (i > 0 && y[i] == y0 && y[0] != HUGE_VAL)
+                y[i] = y[0];
+            else
+                y[i] = SPHERE_RADIUS * std::asinh(std::tan(dfLat));
+
+            if (panErrorCodes)
+                panErrorCodes[i] = 0;
+        }
+
+        if (m_eTargetFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        bTransformDone = true;
+    }
+
     // Determine the default coordinate epoch, if not provided in the point to
     // transform.
     // For time-dependent transformations, PROJ can currently only do
@@ -3549,7 +3662,8 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 {
     PJ *new_pj = nullptr;
     // m_pj can be nullptr if using m_eStrategy != PROJ
-    if (m_pj && !bWebMercatorToWGS84LongLat && !bNoTransform)
+    if (m_pj && !bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+        !bNoTransform)
     {
         // See https://github.com/OSGeo/PROJ/pull/2582
         // This may fail before PROJ 8.0.1 if the m_pj object is a "meta"
@@ -297,7 +297,13 @@ void OGRFeature::Reset()
         for (int i = 0; i < nFieldcount; i++)
         {
             if (!IsFieldSetAndNotNullUnsafe(i))
+            {
+                // Also clear null fields
+                pauFields[i].Set.nMarker1 = OGRUnsetMarker;
+                pauFields[i].Set.nMarker2 = OGRUnsetMarker;
+                pauFields[i].Set.nMarker3 = OGRUnsetMarker;
                 continue;
+            }
 
             const OGRFieldDefn *poFDefn = poDefn->GetFieldDefnUnsafe(i);
             switch (poFDefn->GetType())
@@ -6524,172 +6530,462 @@ OGRErr OGRFeature::SetFieldsFrom(const OGRFeature *poSrcFeature,
             continue;
         }
 
-        const auto eSrcType =
-            poSrcFeature->poDefn->GetFieldDefnUnsafe(iField)->GetType();
-        const auto eDstType = poDefn->GetFieldDefnUnsafe(iDstField)->GetType();
-        if (eSrcType == eDstType)
+        const auto eOp = OGRFieldCopyPlan::GetOp(
+            poSrcFeature->poDefn->GetFieldDefnUnsafe(iField),
+            poDefn->GetFieldDefnUnsafe(iDstField),
+            bUseISO8601ForDateTimeAsString);
+        if (CopyFieldFrom(poSrcFeature, iField, iDstField, eOp, bForgiving) !=
+            OGRERR_NONE)
+            return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           CopyFieldFrom()                            */
+/************************************************************************/
+
+/** Set the value of field iDstField of this feature from the one, set and
+ * not null, of field iSrcField of poSrcFeature, with the operation resolved
+ * by OGRFieldCopyPlan::GetOp().
+ */
+OGRErr OGRFeature::CopyFieldFrom(const OGRFeature *poSrcFeature,
+                                 int iSrcField, int iDstField,
+                                 OGRFieldCopyPlan::Op eOp, int bForgiving)
+{
+    using Op = OGRFieldCopyPlan::Op;
+    switch (eOp)
+    {
+        case Op::COPY_INTEGER:
+            SetFieldSameTypeUnsafe(
+                iDstField, poSrcFeature->GetFieldAsIntegerUnsafe(iSrcField));
+            break;
+
+        case Op::COPY_INTEGER64:
+            SetFieldSameTypeUnsafe(
+                iDstField, poSrcFeature->GetFieldAsInteger64Unsafe(iSrcField));
+            break;
+
+        case Op::COPY_REAL:
+            SetFieldSameTypeUnsafe(
+                iDstField, poSrcFeature->GetFieldAsDoubleUnsafe(iSrcField));
+            break;
+
+        case Op::COPY_STRING:
+            if (IsFieldSetAndNotNullUnsafe(iDstField))
+                CPLFree(pauFields[iDstField].String);
+
+            SetFieldSameTypeUnsafe(
+                iDstField,
+                VSI_STRDUP_VERBOSE(
+                    poSrcFeature->GetFieldAsStringUnsafe(iSrcField)));
+            break;
+
+        case Op::COPY_DATE:
+            pauFields[iDstField] = poSrcFeature->pauFields[iSrcField];
+            break;
+
+        case Op::FROM_INTEGER:
+            SetField(iDstField,
+                     poSrcFeature->GetFieldAsIntegerUnsafe(iSrcField));
+            break;
+
+        case Op::FROM_INTEGER64:
+            SetField(iDstField,
+                     poSrcFeature->GetFieldAsInteger64Unsafe(iSrcField));
+            break;
+
+        case Op::FROM_REAL:
+            SetField(iDstField,
+                     poSrcFeature->GetFieldAsDoubleUnsafe(iSrcField));
+            break;
+
+        case Op::FROM_STRING:
+            SetField(iDstField,
+                     poSrcFeature->GetFieldAsStringUnsafe(iSrcField));
+            break;
+
+        case Op::FROM_INTEGER_LIST:
+        {
+            int nCount = 0;
+            const int *panValues =
+                poSrcFeature->GetFieldAsIntegerList(iSrcField, &nCount);
+            SetField(iDstField, nCount, panValues);
+            break;
+        }
+
+        case Op::FROM_INTEGER64_LIST:
         {
-            if (eSrcType == OFTInteger)
+            int nCount = 0;
+            const GIntBig *panValues =
+                poSrcFeature->GetFieldAsInteger64List(iSrcField, &nCount);
+            SetField(iDstField, nCount, panValues);
+            break;
+        }
+
+        case Op::FROM_REAL_LIST:
+        {
+            int nCount = 0;
+            const double *padfValues =
+                poSrcFeature->GetFieldAsDoubleList(iSrcField, &nCount);
+            SetField(iDstField, nCount, padfValues);
+            break;
+        }
+
+        case Op::FROM_RAW:
+            SetField(iDstField, poSrcFeature->GetRawFieldRef(iSrcField));
+            break;
+
+        case Op::LIST_AS_JSON:
+        {
+            char *pszVal = poSrcFeature->GetFieldAsSerializedJSon(iSrcField);
+            if (pszVal)
             {
-                SetFieldSameTypeUnsafe(
-                    iDstField, poSrcFeature->GetFieldAsIntegerUnsafe(iField));
-                continue;
+                SetField(iDstField, pszVal);
+                CPLFree(pszVal);
             }
-            if (eSrcType == OFTInteger64)
-            {
-                SetFieldSameTypeUnsafe(
-                    iDstField, poSrcFeature->GetFieldAsInteger64Unsafe(iField));
-                continue;
-            }
-            if (eSrcType == OFTReal)
+            else
             {
-                SetFieldSameTypeUnsafe(
-                    iDstField, poSrcFeature->GetFieldAsDoubleUnsafe(iField));
-                continue;
+                SetField(iDstField, poSrcFeature->GetFieldAsString(iSrcField));
             }
-            if (eSrcType == OFTString)
-            {
-                if (IsFieldSetAndNotNullUnsafe(iDstField))
-                    CPLFree(pauFields[iDstField].String);
+            break;
+        }
 
-                SetFieldSameTypeUnsafe(
-                    iDstField,
-                    VSI_STRDUP_VERBOSE(
-                        poSrcFeature->GetFieldAsStringUnsafe(iField)));
-                continue;
-            }
+        case Op::AS_STRING:
+            SetField(iDstField, poSrcFeature->GetFieldAsString(iSrcField));
+            break;
+
+        case Op::DATETIME_AS_ISO8601:
+            SetField(iDstField, poSrcFeature->GetFieldAsISO8601DateTime(
+                                    iSrcField, nullptr));
+            break;
+
+        case Op::UNSUPPORTED:
+            if (!bForgiving)
+                return OGRERR_FAILURE;
+            break;
+
+        case Op::FAILURE:
+            return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           SetFieldsFrom()                            */
+/************************************************************************/
+
+/**
+ * \brief Set fields from another feature, using a precompiled copy plan.
+ *
+ * This is the same as SetFieldsFrom(const OGRFeature*, const int*, int, bool)
+ * with the field map and the datetime formatting the plan was built with,
+ * except that the conversion of each field has already been resolved.
+ *
+ * If the feature definitions of poSrcFeature and this feature are not the
+ * ones the plan was built for, this falls back to the field map of the plan.
+ *
+ * @param poSrcFeature the feature from which field values will be copied.
+ *
+ * @param oPlan copy plan, built from the feature definitions of poSrcFeature
+ * and of this feature.
+ *
+ * @param bForgiving TRUE if the operation should continue despite lacking
+ * output fields matching some of the source fields.
+ *
+ * @return OGRERR_NONE if the operation succeeds, even if some values are
+ * not transferred, otherwise an error code.
+ *
+ * @since GDAL 3.11
+ */
+
+OGRErr OGRFeature::SetFieldsFrom(const OGRFeature *poSrcFeature,
+                                 const OGRFieldCopyPlan &oPlan, int bForgiving)
+
+{
+    if (!oPlan.IsValidFor(poSrcFeature->poDefn, poDefn))
+    {
+        if (poSrcFeature->poDefn->GetFieldCountUnsafe() !=
+            static_cast<int>(oPlan.m_anMap.size()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "SetFieldsFrom(): copy plan does not match the feature "
+                     "definitions");
+            return OGRERR_FAILURE;
         }
+        return SetFieldsFrom(poSrcFeature, oPlan.m_anMap.data(), bForgiving,
+                             oPlan.m_bUseISO8601ForDateTimeAsString);
+    }
+
+    for (const auto &sOp : oPlan.m_aoOps)
+    {
+        if (sOp.eOp == OGRFieldCopyPlan::Op::FAILURE)
+            return OGRERR_FAILURE;
 
-        // Check if we must convert list types to JSON
-        if (eDstType == OFTString)
+        if (!poSrcFeature->IsFieldSetUnsafe(sOp.iSrcField))
         {
-            const auto eDstSubType =
-                poDefn->GetFieldDefnUnsafe(iDstField)->GetSubType();
-            if (eDstSubType == OFSTJSON &&
-                (eSrcType == OFTIntegerList || eSrcType == OFTInteger64List ||
-                 eSrcType == OFTRealList || eSrcType == OFTStringList))
-            {
-                char *pszVal = poSrcFeature->GetFieldAsSerializedJSon(iField);
-                if (pszVal)
-                {
-                    SetField(iDstField, pszVal);
-                    CPLFree(pszVal);
-                    continue;
-                }
-            }
+            UnsetField(sOp.iDstField);
+            continue;
         }
 
-        switch (eSrcType)
+        if (poSrcFeature->IsFieldNullUnsafe(sOp.iSrcField))
         {
-            case OFTInteger:
-                SetField(iDstField,
-                         poSrcFeature->GetFieldAsIntegerUnsafe(iField));
-                break;
+            SetFieldNull(sOp.iDstField);
+            continue;
+        }
 
-            case OFTInteger64:
-                SetField(iDstField,
-                         poSrcFeature->GetFieldAsInteger64Unsafe(iField));
-                break;
+        if (CopyFieldFrom(poSrcFeature, sOp.iSrcField, sOp.iDstField,
+                          sOp.eOp, bForgiving) != OGRERR_NONE)
+            return OGRERR_FAILURE;
+    }
 
-            case OFTReal:
-                SetField(iDstField,
-                         poSrcFeature->GetFieldAsDoubleUnsafe(iField));
-                break;
+    return OGRERR_NONE;
+}
 
-            case OFTString:
-                SetField(iDstField,
-                         poSrcFeature->GetFieldAsStringUnsafe(iField));
-                break;
+/************************************************************************/
+/*                              SetFrom()                               */
+/************************************************************************/
 
-            case OFTIntegerList:
-            {
-                if (eDstType == OFTString)
-                {
-                    SetField(iDstField, poSrcFeature->GetFieldAsString(iField));
-                }
-                else
-                {
-                    int nCount = 0;
-                    const int *panValues =
-                        poSrcFeature->GetFieldAsIntegerList(iField, &nCount);
-                    SetField(iDstField, nCount, panValues);
-                }
-            }
-            break;
+/**
+ * \brief Set one feature from another, using a precompiled copy plan.
+ *
+ * This is the same as SetFrom(const OGRFeature*, const int*, int, bool)
+ * with the field map and the datetime formatting the plan was built with,
+ * except that the conversion of each field, and the source geometry field
+ * of each geometry field, have already been resolved.
+ *
+ * @param poSrcFeature the feature from which geometry and field values will
+ * be copied.
+ *
+ * @param oPlan copy plan, built from the feature definitions of poSrcFeature
+ * and of this feature.
+ *
+ * @param bForgiving TRUE if the operation should continue despite lacking
+ * output fields matching some of the source fields.
+ *
+ * @return OGRERR_NONE if the operation succeeds, even if some values are
+ * not transferred, otherwise an error code.
+ *
+ * @since GDAL 3.11
+ */
 
-            case OFTInteger64List:
-            {
-                if (eDstType == OFTString)
-                {
-                    SetField(iDstField, poSrcFeature->GetFieldAsString(iField));
-                }
-                else
-                {
-                    int nCount = 0;
-                    const GIntBig *panValues =
-                        poSrcFeature->GetFieldAsInteger64List(iField, &nCount);
-                    SetField(iDstField, nCount, panValues);
-                }
-            }
-            break;
+OGRErr OGRFeature::SetFrom(const OGRFeature *poSrcFeature,
+                           const OGRFieldCopyPlan &oPlan, int bForgiving)
 
-            case OFTRealList:
-            {
-                if (eDstType == OFTString)
-                {
-                    SetField(iDstField, poSrcFeature->GetFieldAsString(iField));
-                }
-                else
-                {
-                    int nCount = 0;
-                    const double *padfValues =
-                        poSrcFeature->GetFieldAsDoubleList(iField, &nCount);
-                    SetField(iDstField, nCount, padfValues);
-                }
-            }
+{
+    if (poSrcFeature == this)
+        return OGRERR_FAILURE;
+
+    if (!oPlan.IsValidFor(poSrcFeature->poDefn, poDefn))
+    {
+        if (poSrcFeature->poDefn->GetFieldCountUnsafe() !=
+            static_cast<int>(oPlan.m_anMap.size()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "SetFrom(): copy plan does not match the feature "
+                     "definitions");
+            return OGRERR_FAILURE;
+        }
+        return SetFrom(poSrcFeature, oPlan.m_anMap.data(), bForgiving,
+                       oPlan.m_bUseISO8601ForDateTimeAsString);
+    }
+
+    SetFID(OGRNullFID);
+
+    for (int i = 0; i < oPlan.m_nDstGeomFieldCount; i++)
+    {
+        const int iSrc = oPlan.m_anGeomMap[i];
+        SetGeomField(i, iSrc >= 0 ? poSrcFeature->GetGeomFieldRef(iSrc)
+                                  : nullptr);
+    }
+
+    SetStyleString(poSrcFeature->GetStyleString());
+
+    SetNativeData(poSrcFeature->GetNativeData());
+    SetNativeMediaType(poSrcFeature->GetNativeMediaType());
+
+    return SetFieldsFrom(poSrcFeature, oPlan, bForgiving);
+}
+
+/************************************************************************/
+/*                          OGRFieldCopyPlan()                          */
+/************************************************************************/
+
+/**
+ * \brief Build a plan to copy features of poSrcDefn into features of
+ * poDstDefn.
+ *
+ * @param poSrcDefn feature definition of the source features.
+ *
+ * @param poDstDefn feature definition of the target features.
+ *
+ * @param panMap Array of the indices of the target fields stored at the
+ * corresponding index of the source fields, as for
+ * OGRFeature::SetFieldsFrom(). A value of -1 should be used to ignore a
+ * source field. The array should not be NULL and be as long as the number
+ * of fields of poSrcDefn.
+ *
+ * @param bUseISO8601ForDateTimeAsString true if datetime fields
+ * converted to string should use ISO8601 formatting rather than OGR own format.
+ *
+ * @since GDAL 3.11
+ */
+
+OGRFieldCopyPlan::OGRFieldCopyPlan(const OGRFeatureDefn *poSrcDefn,
+                                   const OGRFeatureDefn *poDstDefn,
+                                   const int *panMap,
+                                   bool bUseISO8601ForDateTimeAsString)
+    : m_poSrcDefn(poSrcDefn), m_poDstDefn(poDstDefn),
+      m_nSrcFieldCount(poSrcDefn->GetFieldCount()),
+      m_nDstFieldCount(poDstDefn->GetFieldCount()),
+      m_nSrcGeomFieldCount(poSrcDefn->GetGeomFieldCount()),
+      m_nDstGeomFieldCount(poDstDefn->GetGeomFieldCount()),
+      m_bUseISO8601ForDateTimeAsString(bUseISO8601ForDateTimeAsString),
+      m_anMap(panMap, panMap + m_nSrcFieldCount)
+{
+    for (int iField = 0; iField < m_nSrcFieldCount; iField++)
+    {
+        const int iDstField = panMap[iField];
+        if (iDstField < 0)
+            continue;
+        if (iDstField >= m_nDstFieldCount)
+        {
+            m_aoOps.push_back({iField, iDstField, Op::FAILURE});
             break;
+        }
+        m_aoOps.push_back({iField, iDstField,
+                           GetOp(poSrcDefn->GetFieldDefn(iField),
+                                 poDstDefn->GetFieldDefn(iDstField),
+                                 bUseISO8601ForDateTimeAsString)});
+    }
 
+    // Same rules as OGRFeature::SetFrom(const OGRFeature*, const int*, ...)
+    for (int i = 0; i < m_nDstGeomFieldCount; i++)
+    {
+        int iSrc = poSrcDefn->GetGeomFieldIndex(
+            poDstDefn->GetGeomFieldDefn(i)->GetNameRef());
+        // Whatever the geometry field names are.  For backward
+        // compatibility.
+        if (iSrc < 0 && m_nDstGeomFieldCount == 1 && m_nSrcGeomFieldCount > 0)
+            iSrc = 0;
+        m_anGeomMap.push_back(iSrc);
+    }
+}
+
+/************************************************************************/
+/*                       OGRFieldCopyPlan::GetOp()                      */
+/************************************************************************/
+
+/** Return the operation to copy a set and not null value of a field of
+ * definition poSrcFieldDefn into a field of definition poDstFieldDefn.
+ */
+OGRFieldCopyPlan::Op
+OGRFieldCopyPlan::GetOp(const OGRFieldDefn *poSrcFieldDefn,
+                        const OGRFieldDefn *poDstFieldDefn,
+                        bool bUseISO8601ForDateTimeAsString)
+{
+    const auto eSrcType = poSrcFieldDefn->GetType();
+    const auto eDstType = poDstFieldDefn->GetType();
+    if (eSrcType == eDstType)
+    {
+        switch (eSrcType)
+        {
+            case OFTInteger:
+                return Op::COPY_INTEGER;
+            case OFTInteger64:
+                return Op::COPY_INTEGER64;
+            case OFTReal:
+                return Op::COPY_REAL;
+            case OFTString:
+                return Op::COPY_STRING;
             case OFTDate:
-            case OFTDateTime:
             case OFTTime:
-            {
-                if (eDstType == OFTDate || eDstType == OFTTime ||
-                    eDstType == OFTDateTime)
-                {
-                    SetField(iDstField, poSrcFeature->GetRawFieldRef(iField));
-                }
-                else if (eDstType == OFTString || eDstType == OFTStringList)
-                {
-                    SetField(iDstField,
-                             eSrcType == OFTDateTime &&
-                                     bUseISO8601ForDateTimeAsString
-                                 ? poSrcFeature->GetFieldAsISO8601DateTime(
-                                       iField, nullptr)
-                                 : poSrcFeature->GetFieldAsString(iField));
-                }
-                else if (!bForgiving)
-                    return OGRERR_FAILURE;
+            case OFTDateTime:
+                return Op::COPY_DATE;
+            default:
                 break;
-            }
+        }
+    }
 
-            default:
+    // Check if we must convert list types to JSON
+    if (eDstType == OFTString && poDstFieldDefn->GetSubType() == OFSTJSON &&
+        (eSrcType == OFTIntegerList || eSrcType == OFTInteger64List ||
+         eSrcType == OFTRealList || eSrcType == OFTStringList))
+    {
+        return Op::LIST_AS_JSON;
+    }
+
+    switch (eSrcType)
+    {
+        case OFTInteger:
+            return Op::FROM_INTEGER;
+
+        case OFTInteger64:
+            return Op::FROM_INTEGER64;
+
+        case OFTReal:
+            return Op::FROM_REAL;
+
+        case OFTString:
+            return Op::FROM_STRING;
+
+        case OFTIntegerList:
+            return eDstType == OFTString ? Op::AS_STRING
+                                         : Op::FROM_INTEGER_LIST;
+
+        case OFTInteger64List:
+            return eDstType == OFTString ? Op::AS_STRING
+                                         : Op::FROM_INTEGER64_LIST;
+
+        case OFTRealList:
+            return eDstType == OFTString ? Op::AS_STRING : Op::FROM_REAL_LIST;
+
+        case OFTDate:
+        case OFTDateTime:
+        case OFTTime:
+        {
+            if (eDstType == OFTDate || eDstType == OFTTime ||
+                eDstType == OFTDateTime)
             {
-                if (eSrcType == eDstType)
-                {
-                    SetField(iDstField, poSrcFeature->GetRawFieldRef(iField));
-                }
-                else if (eDstType == OFTString || eDstType == OFTStringList)
-                {
-                    SetField(iDstField, poSrcFeature->GetFieldAsString(iField));
-                }
-                else if (!bForgiving)
-                    return OGRERR_FAILURE;
-                break;
+                return Op::FROM_RAW;
             }
+            else if (eDstType == OFTString || eDstType == OFTStringList)
+            {
+                return eSrcType == OFTDateTime && bUseISO8601ForDateTimeAsString
+                           ? Op::DATETIME_AS_ISO8601
+                           : Op::AS_STRING;
+            }
+            return Op::UNSUPPORTED;
+        }
+
+        default:
+        {
+            if (eSrcType == eDstType)
+                return Op::FROM_RAW;
+            else if (eDstType == OFTString || eDstType == OFTStringList)
+                return Op::AS_STRING;
+            return Op::UNSUPPORTED;
         }
     }
+}
 
-    return OGRERR_NONE;
+/************************************************************************/
+/*                    OGRFieldCopyPlan::IsValidFor()                    */
+/************************************************************************/
+
+/** Return whether the plan can be used to copy features of poSrcDefn into
+ * features of poDstDefn.
+ */
+bool OGRFieldCopyPlan::IsValidFor(const OGRFeatureDefn *poSrcDefn,
+                                  const OGRFeatureDefn *poDstDefn) const
+{
+    return poSrcDefn == m_poSrcDefn && poDstDefn == m_poDstDefn &&
+           poSrcDefn->GetFieldCount() == m_nSrcFieldCount &&
+           poDstDefn->GetFieldCount() == m_nDstFieldCount &&
+           poSrcDefn->GetGeomFieldCount() == m_nSrcGeomFieldCount &&
+           poDstDefn->GetGeomFieldCount() == m_nDstGeomFieldCount;
 }
 
 /************************************************************************/
@@ -18,6 +18,9 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -25,6 +28,7 @@
 #include "ogr_attrind.h"
 #include "ogr_core.h"
 #include "ogr_p.h"
+#include "ogr_profiling.h"
 #include "ogrsf_frmts.h"
 
 //! @cond Doxygen_Suppress
@@ -105,6 +109,7 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         delete static_cast<swq_expr_node *>(pSWQExpr);
         pSWQExpr = nullptr;
     }
+    m_poLayer = poLayer;
 
     const char *pszFIDColumn = nullptr;
     bool bMustAddFID = false;
@@ -311,6 +316,8 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    OGRProfilingTimer oTimer(m_poLayer, OGRProfilingStage::ATTRIBUTE_FILTER);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -382,12 +389,18 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
 /*      Attempt to return a list of FIDs matching the given             */
 /*      attribute query conditions utilizing attribute indices.         */
 /*      Returns NULL if the result cannot be computed from the          */
-/*      available indices, or an "OGRNullFID" terminated list of        */
-/*      FIDs if it can.                                                 */
+/*      available indices, or a sorted "OGRNullFID" terminated list     */
+/*      of FIDs if it can.                                              */
+/*                                                                      */
+/*      The list is a superset of the matching features, which must     */
+/*      be evaluated against the query afterwards: for example, an      */
+/*      AND whose only one operand is indexed returns the candidates    */
+/*      of that operand.                                                */
 /*                                                                      */
-/*      For now we only support equality tests on a single indexed      */
-/*      attribute field.  Eventually we should make this support        */
-/*      multi-part queries with ranges.                                 */
+/*      We support equality, IN, comparison and BETWEEN tests, and      */
+/*      LIKE tests with a fixed prefix, on indexed attribute fields,    */
+/*      combined with AND and OR, depending on what the index of each   */
+/*      field supports.                                                 */
 /************************************************************************/
 
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(OGRLayer *poLayer,
@@ -530,6 +543,84 @@ static GIntBig *OGRANDGIntBigArray(GIntBig panFIDList1[], GIntBig nFIDCount1,
     return panFIDList;
 }
 
+/************************************************************************/
+/*                     OGRFeatureQueryGetIndexKey()                     */
+/*                                                                      */
+/*      Convert a constant of the query into a key suitable for the     */
+/*      index of a field of type eType. For integer fields,             */
+/*      non-integral values are rounded down if nRounding < 0 (lower    */
+/*      bound of a range), up if nRounding > 0 (upper bound), and      */
+/*      truncated otherwise.                                            */
+/************************************************************************/
+
+static bool OGRFeatureQueryGetIndexKey(const swq_expr_node *poValue,
+                                       OGRFieldType eType, int nRounding,
+                                       OGRField &sValue)
+{
+    if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null)
+        return false;
+
+    const bool bIsInteger = poValue->field_type == SWQ_INTEGER ||
+                            poValue->field_type == SWQ_INTEGER64;
+    switch (eType)
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        {
+            GIntBig nVal = 0;
+            if (poValue->field_type == SWQ_FLOAT)
+            {
+                double dfVal = poValue->float_value;
+                if (std::isnan(dfVal))
+                    return false;
+                if (nRounding < 0)
+                    dfVal = std::floor(dfVal);
+                else if (nRounding > 0)
+                    dfVal = std::ceil(dfVal);
+                // Clamp to the range exactly representable on both types
+                nVal = static_cast<GIntBig>(
+                    std::clamp(dfVal, -9.2233720368547748e18,
+                               9.2233720368547748e18 - 1024));
+            }
+            else if (bIsInteger)
+            {
+                nVal = poValue->int_value;
+            }
+            else
+            {
+                return false;
+            }
+            if (eType == OFTInteger)
+                sValue.Integer = static_cast<int>(std::clamp<GIntBig>(
+                    nVal, std::numeric_limits<int>::min(),
+                    std::numeric_limits<int>::max()));
+            else
+                sValue.Integer64 = nVal;
+            return true;
+        }
+
+        case OFTReal:
+            if (poValue->field_type == SWQ_FLOAT)
+                sValue.Real = poValue->float_value;
+            else if (bIsInteger)
+                sValue.Real = static_cast<double>(poValue->int_value);
+            else
+                return false;
+            return true;
+
+        case OFTString:
+            if (poValue->field_type != SWQ_STRING ||
+                poValue->string_value == nullptr)
+                return false;
+            sValue.String = poValue->string_value;
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
                                                  OGRLayer *poLayer,
                                                  GIntBig &nFIDCount)
@@ -545,11 +636,25 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         GIntBig nFIDCount2 = 0;
         GIntBig *panFIDList1 =
             EvaluateAgainstIndices(psExpr->papoSubExpr[0], poLayer, nFIDCount1);
+        if (panFIDList1 == nullptr && psExpr->nOperation == SWQ_OR)
+            return nullptr;
         GIntBig *panFIDList2 =
-            panFIDList1 == nullptr
-                ? nullptr
-                : EvaluateAgainstIndices(psExpr->papoSubExpr[1], poLayer,
-                                         nFIDCount2);
+            EvaluateAgainstIndices(psExpr->papoSubExpr[1], poLayer, nFIDCount2);
+
+        // For AND, the candidates of a single indexed operand are enough,
+        // since they are evaluated against the whole query afterwards.
+        if (psExpr->nOperation == SWQ_AND &&
+            (panFIDList1 == nullptr || panFIDList2 == nullptr))
+        {
+            if (panFIDList1 != nullptr)
+            {
+                nFIDCount = nFIDCount1;
+                return panFIDList1;
+            }
+            nFIDCount = nFIDCount2;
+            return panFIDList2;
+        }
+
         GIntBig *panFIDList = nullptr;
         if (panFIDList1 != nullptr && panFIDList2 != nullptr)
         {
@@ -567,117 +672,143 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         return panFIDList;
     }
 
-    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
-        psExpr->nSubExprCount < 2)
+    if (psExpr->nSubExprCount < 2)
         return nullptr;
 
+    // Normalize "value op column" into "column op value"
+    int nOperation = psExpr->nOperation;
     const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
     const swq_expr_node *poValue = psExpr->papoSubExpr[1];
+    if (psExpr->nSubExprCount == 2 && poColumn->eNodeType == SNT_CONSTANT &&
+        poValue->eNodeType == SNT_COLUMN)
+    {
+        std::swap(poColumn, poValue);
+        if (nOperation == SWQ_LT)
+            nOperation = SWQ_GT;
+        else if (nOperation == SWQ_LE)
+            nOperation = SWQ_GE;
+        else if (nOperation == SWQ_GT)
+            nOperation = SWQ_LT;
+        else if (nOperation == SWQ_GE)
+            nOperation = SWQ_LE;
+        else if (nOperation != SWQ_EQ)
+            return nullptr;
+    }
 
-    if (poColumn->eNodeType != SNT_COLUMN || poValue->eNodeType != SNT_CONSTANT)
+    if (poColumn->eNodeType != SNT_COLUMN)
         return nullptr;
 
-    const int nIdx = OGRFeatureFetcherFixFieldIndex(poLayer->GetLayerDefn(),
-                                                    poColumn->field_index);
+    OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    const int nIdx =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poColumn->field_index);
+    if (nIdx < 0 || nIdx >= poDefn->GetFieldCount())
+        return nullptr;
 
     OGRAttrIndex *poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
     if (poIndex == nullptr)
         return nullptr;
 
     // Have an index, now we need to query it.
+    const OGRFieldType eType = poDefn->GetFieldDefn(nIdx)->GetType();
     OGRField sValue;
-    const OGRFieldDefn *poFieldDefn =
-        poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
+    OGRField sMaxValue;
+    int nFIDCount32 = 0;
+    GIntBig *panFIDs = nullptr;
 
-    // Handle the case of an IN operation.
-    if (psExpr->nOperation == SWQ_IN)
+    switch (nOperation)
     {
-        int nLength = 0;
-        GIntBig *panFIDs = nullptr;
-        nFIDCount = 0;
-
-        for (int iIN = 1; iIN < psExpr->nSubExprCount; iIN++)
+        case SWQ_EQ:
         {
-            switch (poFieldDefn->GetType())
-            {
-                case OFTInteger:
-                    if (psExpr->papoSubExpr[iIN]->field_type == SWQ_FLOAT)
-                        sValue.Integer = static_cast<int>(
-                            psExpr->papoSubExpr[iIN]->float_value);
-                    else
-                        sValue.Integer = static_cast<int>(
-                            psExpr->papoSubExpr[iIN]->int_value);
-                    break;
-
-                case OFTInteger64:
-                    if (psExpr->papoSubExpr[iIN]->field_type == SWQ_FLOAT)
-                        sValue.Integer64 = static_cast<GIntBig>(
-                            psExpr->papoSubExpr[iIN]->float_value);
-                    else
-                        sValue.Integer64 = psExpr->papoSubExpr[iIN]->int_value;
-                    break;
-
-                case OFTReal:
-                    sValue.Real = psExpr->papoSubExpr[iIN]->float_value;
-                    break;
-
-                case OFTString:
-                    sValue.String = psExpr->papoSubExpr[iIN]->string_value;
-                    break;
-
-                default:
-                    CPLAssert(false);
-                    return nullptr;
-            }
-
-            int nFIDCount32 = static_cast<int>(nFIDCount);
-            panFIDs = poIndex->GetAllMatches(&sValue, panFIDs, &nFIDCount32,
+            if (!OGRFeatureQueryGetIndexKey(poValue, eType, 0, sValue))
+                return nullptr;
+            int nLength = 0;
+            panFIDs = poIndex->GetAllMatches(&sValue, nullptr, &nFIDCount32,
                                              &nLength);
-            nFIDCount = nFIDCount32;
+            break;
         }
 
-        if (nFIDCount > 1)
+        case SWQ_IN:
         {
-            // The returned FIDs are expected to be in sorted order.
-            std::sort(panFIDs, panFIDs + nFIDCount);
+            int nLength = 0;
+            for (int iIN = 1; iIN < psExpr->nSubExprCount; iIN++)
+            {
+                if (!OGRFeatureQueryGetIndexKey(psExpr->papoSubExpr[iIN], eType,
+                                                0, sValue))
+                {
+                    CPLFree(panFIDs);
+                    return nullptr;
+                }
+                panFIDs = poIndex->GetAllMatches(&sValue, panFIDs, &nFIDCount32,
+                                                 &nLength);
+            }
+            break;
         }
-        return panFIDs;
-    }
 
-    // Handle equality test.
-    switch (poFieldDefn->GetType())
-    {
-        case OFTInteger:
-            if (poValue->field_type == SWQ_FLOAT)
-                sValue.Integer = static_cast<int>(poValue->float_value);
-            else
-                sValue.Integer = static_cast<int>(poValue->int_value);
+        case SWQ_GT:
+        case SWQ_GE:
+            if (!OGRFeatureQueryGetIndexKey(poValue, eType, -1, sValue))
+                return nullptr;
+            panFIDs = poIndex->GetRangeMatches(&sValue, nOperation == SWQ_GE,
+                                               nullptr, false, &nFIDCount32);
             break;
 
-        case OFTInteger64:
-            if (poValue->field_type == SWQ_FLOAT)
-                sValue.Integer64 = static_cast<GIntBig>(poValue->float_value);
-            else
-                sValue.Integer64 = poValue->int_value;
+        case SWQ_LT:
+        case SWQ_LE:
+            if (!OGRFeatureQueryGetIndexKey(poValue, eType, 1, sValue))
+                return nullptr;
+            panFIDs = poIndex->GetRangeMatches(nullptr, false, &sValue,
+                                               nOperation == SWQ_LE,
+                                               &nFIDCount32);
             break;
 
-        case OFTReal:
-            sValue.Real = poValue->float_value;
+        case SWQ_BETWEEN:
+            if (psExpr->nSubExprCount != 3 ||
+                !OGRFeatureQueryGetIndexKey(poValue, eType, -1, sValue) ||
+                !OGRFeatureQueryGetIndexKey(psExpr->papoSubExpr[2], eType, 1,
+                                            sMaxValue))
+                return nullptr;
+            panFIDs = poIndex->GetRangeMatches(&sValue, true, &sMaxValue, true,
+                                               &nFIDCount32);
             break;
 
-        case OFTString:
-            sValue.String = poValue->string_value;
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+        {
+            // Only patterns starting with a fixed prefix, without ESCAPE
+            // clause, can use the index.
+            if (psExpr->nSubExprCount != 2 || eType != OFTString ||
+                !OGRFeatureQueryGetIndexKey(poValue, eType, 0, sValue))
+                return nullptr;
+            const bool bCaseInsensitive =
+                nOperation == SWQ_ILIKE ||
+                CPLTestBool(
+                    CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+            std::string osPrefix;
+            for (const char *pszIter = sValue.String; *pszIter; ++pszIter)
+            {
+                if (*pszIter == '%' || *pszIter == '_')
+                    break;
+                // Case-insensitive matching of non-ASCII characters is not
+                // a byte-wise operation.
+                if (bCaseInsensitive &&
+                    static_cast<unsigned char>(*pszIter) >= 128)
+                    break;
+                osPrefix += *pszIter;
+            }
+            if (osPrefix.empty())
+                return nullptr;
+            panFIDs = poIndex->GetPrefixMatches(osPrefix.c_str(),
+                                                bCaseInsensitive, &nFIDCount32);
             break;
+        }
 
         default:
-            CPLAssert(false);
             return nullptr;
     }
 
-    int nLength = 0;
-    int nFIDCount32 = 0;
-    GIntBig *panFIDs =
-        poIndex->GetAllMatches(&sValue, nullptr, &nFIDCount32, &nLength);
+    if (panFIDs == nullptr)
+        return nullptr;
+
     nFIDCount = nFIDCount32;
     if (nFIDCount > 1)
     {
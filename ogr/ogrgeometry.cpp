@@ -24,6 +24,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -3270,6 +3271,187 @@ void OGRGeometry::freeGEOSContext(
 
 #ifdef HAVE_GEOS
 
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+
+/************************************************************************/
+/*                       CanConvertToGEOSDirectly()                     */
+/*                                                                      */
+/*      Whether a linear geometry can be converted to GEOS by           */
+/*      directly building GEOS coordinate sequences.  Empty parts       */
+/*      and other geometry types go through WKB.                        */
+/************************************************************************/
+
+static bool CanConvertToGEOSDirectly(const OGRGeometry *poGeom)
+{
+    if (poGeom->IsEmpty())
+        return false;
+    switch (wkbFlatten(poGeom->getGeometryType()))
+    {
+        case wkbPoint:
+        case wkbLineString:
+            return true;
+
+        case wkbPolygon:
+        {
+            for (const auto *poRing : *(poGeom->toPolygon()))
+            {
+                if (poRing->IsEmpty())
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        {
+            for (const auto *poSubGeom : *(poGeom->toGeometryCollection()))
+            {
+                if (!CanConvertToGEOSDirectly(poSubGeom))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         convertToGEOSCoordSeq()                      */
+/************************************************************************/
+
+static GEOSCoordSequence *convertToGEOSCoordSeq(GEOSContextHandle_t hGEOSCtxt,
+                                                const OGRSimpleCurve *poSC,
+                                                std::vector<double> &adfBuffer)
+{
+    const bool bHasZ = CPL_TO_BOOL(poSC->Is3D());
+    const bool bHasM = CPL_TO_BOOL(poSC->IsMeasured());
+    const int nDims = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    const int nStride = static_cast<int>(nDims * sizeof(double));
+    const int nPoints = poSC->getNumPoints();
+    if (nDims == 2 && nPoints > 0)
+    {
+        // The OGRRawPoint array already has the interleaved XY layout
+        // expected by GEOS.
+        static_assert(sizeof(OGRRawPoint) == 2 * sizeof(double),
+                      "sizeof(OGRRawPoint) == 2 * sizeof(double)");
+        return GEOSCoordSeq_copyFromBuffer_r(
+            hGEOSCtxt, reinterpret_cast<const double *>(poSC->getRawPoints()),
+            nPoints, false, false);
+    }
+    try
+    {
+        adfBuffer.resize(static_cast<size_t>(nPoints) * nDims);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return nullptr;
+    }
+    double *padfBuffer = adfBuffer.data();
+    poSC->getPoints(padfBuffer, nStride, padfBuffer + 1, nStride,
+                    bHasZ ? padfBuffer + 2 : nullptr, nStride,
+                    bHasM ? padfBuffer + nDims - 1 : nullptr, nStride);
+    return GEOSCoordSeq_copyFromBuffer_r(hGEOSCtxt, padfBuffer, nPoints,
+                                         bHasZ, bHasM);
+}
+
+/************************************************************************/
+/*                       convertToGEOSGeomDirect()                      */
+/*                                                                      */
+/*      Build a GEOS geometry from the coordinates of the OGR           */
+/*      geometry, without an intermediate WKB serialization.  The       */
+/*      geometry must satisfy CanConvertToGEOSDirectly().               */
+/************************************************************************/
+
+static GEOSGeom convertToGEOSGeomDirect(GEOSContextHandle_t hGEOSCtxt,
+                                        const OGRGeometry *poGeom,
+                                        std::vector<double> &adfBuffer)
+{
+    const OGRwkbGeometryType eType = wkbFlatten(poGeom->getGeometryType());
+    switch (eType)
+    {
+        case wkbPoint:
+        {
+            const OGRPoint *poPoint = poGeom->toPoint();
+            double adfXYZM[4] = {poPoint->getX(), poPoint->getY(), 0, 0};
+            int nDims = 2;
+            if (poPoint->Is3D())
+                adfXYZM[nDims++] = poPoint->getZ();
+            if (poPoint->IsMeasured())
+                adfXYZM[nDims++] = poPoint->getM();
+            GEOSCoordSequence *hSeq = GEOSCoordSeq_copyFromBuffer_r(
+                hGEOSCtxt, adfXYZM, 1, poPoint->Is3D(),
+                poPoint->IsMeasured());
+            return hSeq ? GEOSGeom_createPoint_r(hGEOSCtxt, hSeq) : nullptr;
+        }
+
+        case wkbLineString:
+        {
+            GEOSCoordSequence *hSeq = convertToGEOSCoordSeq(
+                hGEOSCtxt, poGeom->toLineString(), adfBuffer);
+            return hSeq ? GEOSGeom_createLineString_r(hGEOSCtxt, hSeq)
+                        : nullptr;
+        }
+
+        case wkbPolygon:
+        {
+            std::vector<GEOSGeom> ahRings;
+            for (const auto *poRing : *(poGeom->toPolygon()))
+            {
+                GEOSCoordSequence *hSeq =
+                    convertToGEOSCoordSeq(hGEOSCtxt, poRing, adfBuffer);
+                GEOSGeom hRing =
+                    hSeq ? GEOSGeom_createLinearRing_r(hGEOSCtxt, hSeq)
+                         : nullptr;
+                if (hRing == nullptr)
+                {
+                    for (GEOSGeom hOtherRing : ahRings)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherRing);
+                    return nullptr;
+                }
+                ahRings.push_back(hRing);
+            }
+            return GEOSGeom_createPolygon_r(
+                hGEOSCtxt, ahRings[0], ahRings.data() + 1,
+                static_cast<unsigned>(ahRings.size() - 1));
+        }
+
+        default:
+        {
+            std::vector<GEOSGeom> ahGeoms;
+            for (const auto *poSubGeom : *(poGeom->toGeometryCollection()))
+            {
+                GEOSGeom hSubGeom =
+                    convertToGEOSGeomDirect(hGEOSCtxt, poSubGeom, adfBuffer);
+                if (hSubGeom == nullptr)
+                {
+                    for (GEOSGeom hOtherGeom : ahGeoms)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherGeom);
+                    return nullptr;
+                }
+                ahGeoms.push_back(hSubGeom);
+            }
+            const int nGEOSType = eType == wkbMultiPoint ? GEOS_MULTIPOINT
+                                  : eType == wkbMultiLineString
+                                      ? GEOS_MULTILINESTRING
+                                  : eType == wkbMultiPolygon
+                                      ? GEOS_MULTIPOLYGON
+                                      : GEOS_GEOMETRYCOLLECTION;
+            return GEOSGeom_createCollection_r(
+                hGEOSCtxt, nGEOSType, ahGeoms.data(),
+                static_cast<unsigned>(ahGeoms.size()));
+        }
+    }
+}
+
+#endif
+
 /************************************************************************/
 /*                          convertToGEOSGeom()                         */
 /************************************************************************/
@@ -3277,6 +3459,15 @@ void OGRGeometry::freeGEOSContext(
 static GEOSGeom convertToGEOSGeom(GEOSContextHandle_t hGEOSCtxt,
                                   OGRGeometry *poGeom)
 {
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+    if (CanConvertToGEOSDirectly(poGeom))
+    {
+        std::vector<double> adfBuffer;
+        return convertToGEOSGeomDirect(hGEOSCtxt, poGeom, adfBuffer);
+    }
+#endif
+
     GEOSGeom hGeom = nullptr;
     const size_t nDataSize = poGeom->WkbSize();
     unsigned char *pabyData =
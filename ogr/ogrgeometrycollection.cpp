@@ -17,7 +17,9 @@
 #include <cstddef>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <new>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -611,6 +613,14 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         return OGRERR_CORRUPT_DATA;
     }
 
+    // Keep the existing sub-geometries aside, so that they can be reused for
+    // new sub-geometries of the same type, to save dynamic memory allocations.
+    std::vector<std::unique_ptr<OGRGeometry>> apoRecycledGeoms;
+    apoRecycledGeoms.reserve(nGeomCount);
+    for (int iGeom = 0; iGeom < nGeomCount; iGeom++)
+        apoRecycledGeoms.emplace_back(papoGeoms[iGeom]);
+    nGeomCount = 0;
+
     OGRwkbByteOrder eByteOrder = wkbXDR;
     size_t nDataOffset = 0;
     int nGeomCountNew = 0;
@@ -659,10 +669,16 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         }
 
         OGRGeometry *poSubGeom = nullptr;
+        if (iGeom < static_cast<int>(apoRecycledGeoms.size()) &&
+            apoRecycledGeoms[iGeom]->getGeometryType() == eSubGeomType)
+        {
+            poSubGeom = apoRecycledGeoms[iGeom].release();
+        }
         size_t nSubGeomBytesConsumed = 0;
         if (OGR_GT_IsSubClassOf(eSubGeomType, wkbGeometryCollection))
         {
-            poSubGeom = OGRGeometryFactory::createGeometry(eSubGeomType);
+            if (poSubGeom == nullptr)
+                poSubGeom = OGRGeometryFactory::createGeometry(eSubGeomType);
             if (poSubGeom == nullptr)
                 eErr = OGRERR_FAILURE;
             else
@@ -672,9 +688,13 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         }
         else
         {
-            eErr = OGRGeometryFactory::createFromWkb(
-                pabySubData, nullptr, &poSubGeom, nSize, eWkbVariant,
-                nSubGeomBytesConsumed);
+            if (poSubGeom)
+                eErr = poSubGeom->importFromWkb(pabySubData, nSize, eWkbVariant,
+                                                nSubGeomBytesConsumed);
+            else
+                eErr = OGRGeometryFactory::createFromWkb(
+                    pabySubData, nullptr, &poSubGeom, nSize, eWkbVariant,
+                    nSubGeomBytesConsumed);
 
             if (eErr == OGRERR_NONE)
             {
@@ -25,6 +25,8 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 #ifdef HAVE_GEOS
 #include "geos_c.h"
 #endif
@@ -40,6 +42,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <new>
 #include <utility>
 #include <vector>
@@ -2235,6 +2238,170 @@ OGRGeometry *OGRGeometryFactory::createFromGML(const char *pszData)
     return OGRGeometry::FromHandle(hGeom);
 }
 
+#if defined(HAVE_GEOS) &&                                                      \
+    (GEOS_VERSION_MAJOR > 3 ||                                                 \
+     (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10))
+
+/************************************************************************/
+/*                       SetPointsFromGEOSCoordSeq()                    */
+/************************************************************************/
+
+static bool SetPointsFromGEOSCoordSeq(GEOSContextHandle_t hGEOSCtxt,
+                                      const GEOSGeometry *hGeom, bool bHasZ,
+                                      OGRSimpleCurve *poSC,
+                                      std::vector<double> &adfBuffer)
+{
+    const GEOSCoordSequence *hSeq = GEOSGeom_getCoordSeq_r(hGEOSCtxt, hGeom);
+    unsigned int nSize = 0;
+    if (hSeq == nullptr || !GEOSCoordSeq_getSize_r(hGEOSCtxt, hSeq, &nSize) ||
+        nSize > static_cast<unsigned>(INT_MAX))
+        return false;
+    try
+    {
+        adfBuffer.resize(static_cast<size_t>(nSize) * (bHasZ ? 3 : 2));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+    double *padfX = adfBuffer.data();
+    double *padfY = padfX + nSize;
+    double *padfZ = bHasZ ? padfY + nSize : nullptr;
+    if (nSize > 0 && !GEOSCoordSeq_copyToArrays_r(hGEOSCtxt, hSeq, padfX,
+                                                   padfY, padfZ, nullptr))
+        return false;
+    if (!poSC->setPoints(static_cast<int>(nSize), padfX, padfY, padfZ))
+        return false;
+    if (bHasZ && nSize == 0)
+        poSC->set3D(TRUE);
+    return true;
+}
+
+/************************************************************************/
+/*                        createFromGEOSDirect()                        */
+/*                                                                      */
+/*      Build an OGR geometry from the coordinate sequences of a        */
+/*      GEOS geometry, without an intermediate WKB serialization.       */
+/*      Returns nullptr in case of error.                               */
+/************************************************************************/
+
+static std::unique_ptr<OGRGeometry>
+createFromGEOSDirect(GEOSContextHandle_t hGEOSCtxt, const GEOSGeometry *hGeom,
+                     bool bHasZ, bool bInPolygon,
+                     std::vector<double> &adfBuffer)
+{
+    const int nGEOSType = GEOSGeomTypeId_r(hGEOSCtxt, hGeom);
+    switch (nGEOSType)
+    {
+        case GEOS_POINT:
+        {
+            auto poPoint = std::make_unique<OGRPoint>();
+            if (GEOSisEmpty_r(hGEOSCtxt, hGeom))
+            {
+                if (bHasZ)
+                    poPoint->set3D(TRUE);
+                return poPoint;
+            }
+            const GEOSCoordSequence *hSeq =
+                GEOSGeom_getCoordSeq_r(hGEOSCtxt, hGeom);
+            double adfXYZ[3] = {0, 0, 0};
+            if (hSeq == nullptr ||
+                !GEOSCoordSeq_copyToBuffer_r(hGEOSCtxt, hSeq, adfXYZ, bHasZ,
+                                             false))
+                return nullptr;
+            poPoint->setX(adfXYZ[0]);
+            poPoint->setY(adfXYZ[1]);
+            if (bHasZ)
+                poPoint->setZ(adfXYZ[2]);
+            return poPoint;
+        }
+
+        case GEOS_LINESTRING:
+        case GEOS_LINEARRING:
+        {
+            std::unique_ptr<OGRSimpleCurve> poSC;
+            if (bInPolygon)
+                poSC = std::make_unique<OGRLinearRing>();
+            else
+                poSC = std::make_unique<OGRLineString>();
+            if (!SetPointsFromGEOSCoordSeq(hGEOSCtxt, hGeom, bHasZ, poSC.get(),
+                                           adfBuffer))
+                return nullptr;
+            return poSC;
+        }
+
+        case GEOS_POLYGON:
+        {
+            auto poPoly = std::make_unique<OGRPolygon>();
+            if (bHasZ)
+                poPoly->set3D(TRUE);
+            if (GEOSisEmpty_r(hGEOSCtxt, hGeom))
+                return poPoly;
+            const int nInteriorRings =
+                GEOSGetNumInteriorRings_r(hGEOSCtxt, hGeom);
+            if (nInteriorRings < 0)
+                return nullptr;
+            for (int iRing = -1; iRing < nInteriorRings; iRing++)
+            {
+                const GEOSGeometry *hRing =
+                    iRing < 0
+                        ? GEOSGetExteriorRing_r(hGEOSCtxt, hGeom)
+                        : GEOSGetInteriorRingN_r(hGEOSCtxt, hGeom, iRing);
+                if (hRing == nullptr)
+                    return nullptr;
+                auto poRing = createFromGEOSDirect(hGEOSCtxt, hRing, bHasZ,
+                                                   true, adfBuffer);
+                if (poRing == nullptr)
+                    return nullptr;
+                poPoly->addRingDirectly(poRing.release()->toLinearRing());
+            }
+            return poPoly;
+        }
+
+        case GEOS_MULTIPOINT:
+        case GEOS_MULTILINESTRING:
+        case GEOS_MULTIPOLYGON:
+        case GEOS_GEOMETRYCOLLECTION:
+        {
+            std::unique_ptr<OGRGeometryCollection> poGC;
+            if (nGEOSType == GEOS_MULTIPOINT)
+                poGC = std::make_unique<OGRMultiPoint>();
+            else if (nGEOSType == GEOS_MULTILINESTRING)
+                poGC = std::make_unique<OGRMultiLineString>();
+            else if (nGEOSType == GEOS_MULTIPOLYGON)
+                poGC = std::make_unique<OGRMultiPolygon>();
+            else
+                poGC = std::make_unique<OGRGeometryCollection>();
+            if (bHasZ)
+                poGC->set3D(TRUE);
+            const int nGeoms = GEOSGetNumGeometries_r(hGEOSCtxt, hGeom);
+            if (nGeoms < 0)
+                return nullptr;
+            for (int i = 0; i < nGeoms; i++)
+            {
+                const GEOSGeometry *hSubGeom =
+                    GEOSGetGeometryN_r(hGEOSCtxt, hGeom, i);
+                if (hSubGeom == nullptr)
+                    return nullptr;
+                auto poSubGeom = createFromGEOSDirect(hGEOSCtxt, hSubGeom,
+                                                      bHasZ, false, adfBuffer);
+                if (poSubGeom == nullptr ||
+                    poGC->addGeometryDirectly(poSubGeom.release()) !=
+                        OGRERR_NONE)
+                    return nullptr;
+            }
+            return poGC;
+        }
+
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+#endif
+
 /************************************************************************/
 /*                           createFromGEOS()                           */
 /************************************************************************/
@@ -2267,6 +2434,22 @@ OGRGeometry *OGRGeometryFactory::createFromGEOS(
 
     const int nCoordDim =
         GEOSGeom_getCoordinateDimension_r(hGEOSCtxt, geosGeom);
+
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+    // Geometries with M values go through WKB.
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+    if (GEOSHasM_r(hGEOSCtxt, geosGeom) == 0)
+#endif
+    {
+        std::vector<double> adfBuffer;
+        return createFromGEOSDirect(hGEOSCtxt, geosGeom, nCoordDim >= 3,
+                                    false, adfBuffer)
+            .release();
+    }
+#endif
+
     GEOSWKBWriter *wkbwriter = GEOSWKBWriter_create_r(hGEOSCtxt);
     GEOSWKBWriter_setOutputDimension_r(hGEOSCtxt, wkbwriter, nCoordDim);
     pabyBuf = GEOSWKBWriter_write_r(hGEOSCtxt, wkbwriter, geosGeom, &nSize);
@@ -6355,3 +6538,90 @@ OGRGeometryFactory::createFromGeoJson(const CPLJSONObject &oJsonObject)
     return OGRGeoJSONReadGeometry(
         static_cast<json_object *>(oJsonObject.GetInternalHandle()));
 }
+
+/************************************************************************/
+/*                          applyToGeometries()                         */
+/************************************************************************/
+
+/**
+ * @brief Apply an operation to a batch of geometries, possibly in parallel.
+ *
+ * fnOperation is called on each non-null geometry of apoGeoms, and the
+ * geometries it returns are returned in the same order as the input ones.
+ * A null input geometry results in a null output geometry, without
+ * fnOperation being called.
+ *
+ * When nThreads is greater than 1, the geometries are processed by chunks
+ * on the GDAL global thread pool, so fnOperation must be thread-safe. This
+ * is the case of OGRGeometry methods that rely on GEOS, such as
+ * MakeValid(), Buffer() or SimplifyPreserveTopology(), as they use their own
+ * GEOS context. Errors emitted by fnOperation in worker threads are
+ * re-emitted in the calling thread once all geometries have been processed.
+ *
+ * For example, to make geometries valid using 4 threads:
+ * \code{.cpp}
+ * auto apoValidGeoms = OGRGeometryFactory::applyToGeometries(
+ *     apoGeoms,
+ *     [](const OGRGeometry *poGeom)
+ *     { return std::unique_ptr<OGRGeometry>(poGeom->MakeValid()); },
+ *     4);
+ * \endcode
+ *
+ * @param apoGeoms input geometries (some of them may be null).
+ * @param fnOperation operation to apply to each geometry.
+ * @param nThreads maximum number of threads to use.
+ * @return a vector of the same size as apoGeoms, with the results of
+ * fnOperation.
+ * @since GDAL 3.11
+ */
+std::vector<std::unique_ptr<OGRGeometry>> OGRGeometryFactory::applyToGeometries(
+    const std::vector<const OGRGeometry *> &apoGeoms,
+    const std::function<std::unique_ptr<OGRGeometry>(const OGRGeometry *)>
+        &fnOperation,
+    int nThreads)
+{
+    const size_t nGeoms = apoGeoms.size();
+    std::vector<std::unique_ptr<OGRGeometry>> apoRet(nGeoms);
+
+    const auto ProcessRange = [&apoGeoms, &apoRet, &fnOperation](size_t iStart,
+                                                                 size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            if (apoGeoms[i])
+                apoRet[i] = fnOperation(apoGeoms[i]);
+        }
+    };
+
+    nThreads = static_cast<int>(
+        std::min<size_t>(std::max(nThreads, 1), std::max<size_t>(nGeoms, 1)));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        ProcessRange(0, nGeoms);
+        return apoRet;
+    }
+
+    // Use several chunks per thread, as the cost of operations can vary a
+    // lot from one geometry to another.
+    const size_t nChunks = std::min(nGeoms, static_cast<size_t>(nThreads) * 4);
+    CPLErrorAccumulator oErrorAccumulator;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const size_t iStart = iChunk * nGeoms / nChunks;
+        const size_t iEnd = (iChunk + 1) * nGeoms / nChunks;
+        poJobQueue->SubmitJob(
+            [&ProcessRange, &oErrorAccumulator, iStart, iEnd]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                ProcessRange(iStart, iEnd);
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return apoRet;
+}
@@ -12,6 +12,7 @@
  ****************************************************************************/
 
 #include "ogr_geometry.h"
+#include "ogr_envelope_kernel.h"
 #include "ogr_geos.h"
 #include "ogr_p.h"
 
@@ -2418,17 +2419,9 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
     double dfMinY = paoPoints[0].y;
     double dfMaxY = paoPoints[0].y;
 
-    for (int iPoint = 1; iPoint < nPointCount; iPoint++)
-    {
-        if (dfMaxX < paoPoints[iPoint].x)
-            dfMaxX = paoPoints[iPoint].x;
-        if (dfMaxY < paoPoints[iPoint].y)
-            dfMaxY = paoPoints[iPoint].y;
-        if (dfMinX > paoPoints[iPoint].x)
-            dfMinX = paoPoints[iPoint].x;
-        if (dfMinY > paoPoints[iPoint].y)
-            dfMinY = paoPoints[iPoint].y;
-    }
+    OGRUpdateEnvelopeXY(reinterpret_cast<const GByte *>(paoPoints + 1),
+                        static_cast<size_t>(nPointCount - 1),
+                        sizeof(OGRRawPoint), dfMinX, dfMinY, dfMaxX, dfMaxY);
 
     psEnvelope->MinX = dfMinX;
     psEnvelope->MaxX = dfMaxX;
@@ -16,7 +16,9 @@
 
 #include <cstring>
 #include <cstddef>
+#include <memory>
 #include <new>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -391,6 +393,14 @@ OGRErr OGRPolygon::importFromWkb(const unsigned char *pabyData, size_t nSize,
 
     nBytesConsumedOut = 0;
 
+    // Keep the existing rings aside, so that they and their point arrays can
+    // be reused for the new rings, to save dynamic memory allocations.
+    std::vector<std::unique_ptr<OGRCurve>> apoRecycledRings;
+    apoRecycledRings.reserve(oCC.nCurveCount);
+    for (int iRing = 0; iRing < oCC.nCurveCount; iRing++)
+        apoRecycledRings.emplace_back(oCC.papoCurves[iRing]);
+    oCC.nCurveCount = 0;
+
     // coverity[tainted_data]
     OGRErr eErr = oCC.importPreambleFromWkb(this, pabyData, nSize, nDataOffset,
                                             eByteOrder, 4, eWkbVariant);
@@ -402,7 +412,11 @@ OGRErr OGRPolygon::importFromWkb(const unsigned char *pabyData, size_t nSize,
     /* -------------------------------------------------------------------- */
     for (int iRing = 0; iRing < oCC.nCurveCount; iRing++)
     {
-        OGRLinearRing *poLR = new OGRLinearRing();
+        OGRLinearRing *poLR =
+            iRing < static_cast<int>(apoRecycledRings.size())
+                ? cpl::down_cast<OGRLinearRing *>(
+                      apoRecycledRings[iRing].release())
+                : new OGRLinearRing();
         oCC.papoCurves[iRing] = poLR;
         size_t nBytesConsumedRing = 0;
         eErr = poLR->_importFromWkb(eByteOrder, flags, pabyData + nDataOffset,
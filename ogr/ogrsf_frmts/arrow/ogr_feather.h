@@ -35,6 +35,9 @@
 #endif
 
 constexpr const char *GDAL_GEO_FOOTER_KEY = "gdal:geo";
+// Custom metadata of record batches with the bounding box of each geometry
+// column, as a JSON object {"column_name": [minx, miny, maxx, maxy], ...}
+constexpr const char *GDAL_BATCH_BBOX_KEY = "gdal:bbox";
 constexpr const char *ARROW_DRIVER_NAME_UC = "ARROW";
 
 /************************************************************************/
@@ -91,6 +94,8 @@ class OGRFeatherLayer final : public OGRArrowLayer
     CanPostFilterArrowArray(const struct ArrowSchema *schema) const override;
 
     bool ReadNextBatchFile();
+    bool IsBatchDisjointFromSpatialFilter(
+        const std::shared_ptr<const arrow::KeyValueMetadata> &poMetadata) const;
     bool ReadNextBatchStream();
     void TryToCacheFirstTwoBatches();
 
@@ -158,6 +163,8 @@ class OGRFeatherWriterLayer final : public OGRArrowWriterLayer
 
     virtual bool FlushGroup() override;
 
+    arrow::Status WriteRecordBatch(const arrow::RecordBatch &oBatch);
+
     virtual std::string GetDriverUCName() const override
     {
         return ARROW_DRIVER_NAME_UC;
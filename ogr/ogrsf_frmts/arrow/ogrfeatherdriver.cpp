@@ -184,15 +184,36 @@ static GDALDataset *OGRFeatherDriverOpen(GDALOpenInfo *poOpenInfo)
                      poFS.status().message().c_str());
             return nullptr;
         }
-        auto result = (*poFS)->OpenInputFile(osFSPath);
-        if (!result.ok())
+        // Memory-map local files: record batches read from uncompressed
+        // files then directly point into the mapping, and so do the arrays
+        // exported by GetArrowStream().
+        if ((*poFS)->type_name() == "local" &&
+            CPLTestBool(CPLGetConfigOption("OGR_ARROW_MEMORY_MAP", "YES")))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "OpenInputFile() failed with %s",
-                     result.status().message().c_str());
-            return nullptr;
+            auto result = arrow::io::MemoryMappedFile::Open(
+                osFSPath, arrow::io::FileMode::READ);
+            if (result.ok())
+            {
+                infile = *result;
+            }
+            else
+            {
+                CPLDebug("ARROW", "MemoryMappedFile::Open() failed with %s",
+                         result.status().message().c_str());
+            }
+        }
+        if (!infile)
+        {
+            auto result = (*poFS)->OpenInputFile(osFSPath);
+            if (!result.ok())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "OpenInputFile() failed with %s",
+                         result.status().message().c_str());
+                return nullptr;
+            }
+            infile = *result;
         }
-        infile = *result;
     }
 
     auto poMemoryPool = std::shared_ptr<arrow::MemoryPool>(
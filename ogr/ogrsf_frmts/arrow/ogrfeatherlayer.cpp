@@ -440,6 +440,32 @@ bool OGRFeatherLayer::ReadNextBatchFile()
 
         m_nIdxInBatch = 0;
 
+#if ARROW_VERSION_MAJOR >= 10
+        // Single batch files are dealt with specially by the caller.
+        if (m_poFilterGeom &&
+            m_poRecordBatchFileReader->num_record_batches() > 1)
+        {
+            auto result =
+                m_poRecordBatchFileReader->ReadRecordBatchWithCustomMetadata(
+                    m_iRecordBatch);
+            if (!result.ok())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "ReadRecordBatchWithCustomMetadata() failed: %s",
+                         result.status().message().c_str());
+                m_poBatch.reset();
+                return false;
+            }
+            if (result->batch->num_rows() != 0 &&
+                !IsBatchDisjointFromSpatialFilter(result->custom_metadata))
+            {
+                SetBatch(result->batch);
+                break;
+            }
+            continue;
+        }
+#endif
+
         auto result =
             m_poRecordBatchFileReader->ReadRecordBatch(m_iRecordBatch);
         if (!result.ok())
@@ -460,6 +486,40 @@ bool OGRFeatherLayer::ReadNextBatchFile()
     return true;
 }
 
+/************************************************************************/
+/*                  IsBatchDisjointFromSpatialFilter()                  */
+/************************************************************************/
+
+// Uses the bounding box written by OGRFeatherWriterLayer as custom metadata
+// of record batches.
+bool OGRFeatherLayer::IsBatchDisjointFromSpatialFilter(
+    const std::shared_ptr<const arrow::KeyValueMetadata> &poMetadata) const
+{
+    if (!poMetadata || m_iGeomFieldFilter < 0 ||
+        m_iGeomFieldFilter >= m_poFeatureDefn->GetGeomFieldCount())
+        return false;
+    const auto osBBOXes = poMetadata->Get(GDAL_BATCH_BBOX_KEY);
+    if (!osBBOXes.ok())
+        return false;
+    CPLJSONDocument oDoc;
+    if (!oDoc.LoadMemory(*osBBOXes))
+        return false;
+    const auto oBBOX = oDoc.GetRoot().GetArray(
+        m_poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter)->GetNameRef());
+    if (!oBBOX.IsValid() || oBBOX.Size() != 4)
+        return false;
+    OGREnvelope sBatchEnvelope;
+    sBatchEnvelope.MinX = oBBOX[0].ToDouble();
+    sBatchEnvelope.MinY = oBBOX[1].ToDouble();
+    sBatchEnvelope.MaxX = oBBOX[2].ToDouble();
+    sBatchEnvelope.MaxY = oBBOX[3].ToDouble();
+    if (sBatchEnvelope.Intersects(m_sFilterEnvelope))
+        return false;
+    CPLDebugOnly("ARROW", "Skipping record batch %d, outside spatial filter",
+                 m_iRecordBatch);
+    return true;
+}
+
 /************************************************************************/
 /*                         ReadNextBatchStream()                        */
 /************************************************************************/
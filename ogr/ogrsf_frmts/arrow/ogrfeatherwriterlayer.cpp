@@ -419,6 +419,55 @@ void OGRFeatherWriterLayer::PerformStepsBeforeFinalFlushGroup()
     }
 }
 
+/************************************************************************/
+/*                          WriteRecordBatch()                          */
+/************************************************************************/
+
+// Writes a record batch, with the bounding box of its geometry columns as
+// custom metadata, so that readers can skip it when it does not intersect
+// their spatial filter.
+arrow::Status
+OGRFeatherWriterLayer::WriteRecordBatch(const arrow::RecordBatch &oBatch)
+{
+    std::shared_ptr<arrow::KeyValueMetadata> poMetadata;
+#if ARROW_VERSION_MAJOR >= 10
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_WRITE_BBOX", "YES")))
+    {
+        CPLJSONObject oBBOXes;
+        bool bHasBBOX = false;
+        for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+        {
+            const auto &sEnvelope = m_aoBatchEnvelopes[i];
+            if (sEnvelope.IsInit())
+            {
+                CPLJSONArray oBBOX;
+                oBBOX.Add(sEnvelope.MinX);
+                oBBOX.Add(sEnvelope.MinY);
+                oBBOX.Add(sEnvelope.MaxX);
+                oBBOX.Add(sEnvelope.MaxY);
+                oBBOXes.Add(
+                    m_poFeatureDefn->GetGeomFieldDefn(i)->GetNameRef(),
+                    oBBOX);
+                bHasBBOX = true;
+            }
+        }
+        if (bHasBBOX)
+        {
+            poMetadata = std::make_shared<arrow::KeyValueMetadata>();
+            poMetadata->Append(
+                GDAL_BATCH_BBOX_KEY,
+                oBBOXes.Format(CPLJSONObject::PrettyFormat::Plain));
+        }
+    }
+#endif
+    for (auto &sEnvelope : m_aoBatchEnvelopes)
+        sEnvelope = OGREnvelope3D();
+
+    if (poMetadata)
+        return m_poFileWriter->WriteRecordBatch(oBatch, poMetadata);
+    return m_poFileWriter->WriteRecordBatch(oBatch);
+}
+
 /************************************************************************/
 /*                            FlushGroup()                              */
 /************************************************************************/
@@ -438,7 +487,7 @@ bool OGRFeatherWriterLayer::FlushGroup()
     {
         auto poRecordBatch = arrow::RecordBatch::Make(
             m_poSchema, !columns.empty() ? columns[0]->length() : 0, columns);
-        auto status = m_poFileWriter->WriteRecordBatch(*poRecordBatch);
+        auto status = WriteRecordBatch(*poRecordBatch);
         if (!status.ok())
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -465,7 +514,7 @@ OGRFeatherWriterLayer::WriteArrowBatch(const struct ArrowSchema *schema,
         schema, array, papszOptions,
         [this](const std::shared_ptr<arrow::RecordBatch> &poBatch)
         {
-            auto status = m_poFileWriter->WriteRecordBatch(*poBatch);
+            auto status = WriteRecordBatch(*poBatch);
             if (!status.ok())
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -426,6 +426,9 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
 
     std::vector<int> m_anTZFlag{};               // size: GetFieldCount()
     std::vector<OGREnvelope3D> m_aoEnvelopes{};  // size: GetGeomFieldCount()
+    // Envelopes of the features of the record batch being built.
+    std::vector<OGREnvelope3D>
+        m_aoBatchEnvelopes{};  // size: GetGeomFieldCount()
     std::vector<std::set<OGRwkbGeometryType>>
         m_oSetWrittenGeometryTypes{};  // size: GetGeomFieldCount()
 
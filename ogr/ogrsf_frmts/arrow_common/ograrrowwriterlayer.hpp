@@ -453,6 +453,7 @@ inline void OGRArrowWriterLayer::CreateSchemaCommon()
     }
 
     m_aoEnvelopes.resize(m_poFeatureDefn->GetGeomFieldCount());
+    m_aoBatchEnvelopes.resize(m_poFeatureDefn->GetGeomFieldCount());
     m_oSetWrittenGeometryTypes.resize(m_poFeatureDefn->GetGeomFieldCount());
 
     m_poSchema = arrow::schema(std::move(fields));
@@ -1205,15 +1206,49 @@ static OGRErr GeoArrowLineBuilder(const OGRLineString *poLS,
                                   arrow::DoubleBuilder *poZBuilder,
                                   arrow::DoubleBuilder *poMBuilder)
 {
-    for (int j = 0; j < poLS->getNumPoints(); ++j)
+    const int nPoints = poLS->getNumPoints();
+    if (nPoints == 0)
+        return OGRERR_NONE;
+    OGR_ARROW_RETURN_OGRERR_NOT_OK(
+        poPointBuilder->AppendValues(nPoints, nullptr));
+
+    // For the FixedSizeList encoding, all coordinates go to the same
+    // builder.
+    const bool bInterleaved = poXBuilder == poYBuilder;
+    if (bInterleaved && !poZBuilder && !poMBuilder)
+    {
+        // Bulk copy of the OGRRawPoint array, which has the same layout
+        static_assert(sizeof(OGRRawPoint) == 2 * sizeof(double),
+                      "sizeof(OGRRawPoint) == 2 * sizeof(double)");
+        OGR_ARROW_RETURN_OGRERR_NOT_OK(poXBuilder->AppendValues(
+            reinterpret_cast<const double *>(poLS->getRawPoints()),
+            2 * static_cast<int64_t>(nPoints)));
+        return OGRERR_NONE;
+    }
+
+    if (bInterleaved)
+    {
+        const int nDims = 2 + (poZBuilder ? 1 : 0) + (poMBuilder ? 1 : 0);
+        OGR_ARROW_RETURN_OGRERR_NOT_OK(
+            poXBuilder->Reserve(static_cast<int64_t>(nPoints) * nDims));
+    }
+    else
+    {
+        OGR_ARROW_RETURN_OGRERR_NOT_OK(poXBuilder->Reserve(nPoints));
+        OGR_ARROW_RETURN_OGRERR_NOT_OK(poYBuilder->Reserve(nPoints));
+        if (poZBuilder)
+            OGR_ARROW_RETURN_OGRERR_NOT_OK(poZBuilder->Reserve(nPoints));
+        if (poMBuilder)
+            OGR_ARROW_RETURN_OGRERR_NOT_OK(poMBuilder->Reserve(nPoints));
+    }
+    for (int j = 0; j < nPoints; ++j)
     {
-        OGR_ARROW_RETURN_OGRERR_NOT_OK(poPointBuilder->Append());
-        OGR_ARROW_RETURN_OGRERR_NOT_OK(poXBuilder->Append(poLS->getX(j)));
-        OGR_ARROW_RETURN_OGRERR_NOT_OK(poYBuilder->Append(poLS->getY(j)));
+        poXBuilder->UnsafeAppend(poLS->getX(j));
+        poYBuilder->UnsafeAppend(poLS->getY(j));
         if (poZBuilder)
-            OGR_ARROW_RETURN_OGRERR_NOT_OK(poZBuilder->Append(poLS->getZ(j)));
+            poZBuilder->UnsafeAppend(poLS->getZ(j));
         if (poMBuilder)
-            OGR_ARROW_RETURN_OGRERR_NOT_OK(poMBuilder->Append(poLS->getM(j)));
+            poMBuilder->UnsafeAppend(poLS->getM(j));
     }
     return OGRERR_NONE;
 }
@@ -1239,11 +1274,13 @@ inline OGRErr OGRArrowWriterLayer::BuildGeometry(OGRGeometry *poGeom,
         {
             poGeom->getEnvelope(&oEnvelope);
             m_aoEnvelopes[iGeomField].Merge(oEnvelope);
+            m_aoBatchEnvelopes[iGeomField].Merge(oEnvelope);
         }
         else
         {
             poGeom->getEnvelope(static_cast<OGREnvelope *>(&oEnvelope));
             m_aoEnvelopes[iGeomField].Merge(oEnvelope);
+            m_aoBatchEnvelopes[iGeomField].Merge(oEnvelope);
         }
         m_oSetWrittenGeometryTypes[iGeomField].insert(eGType);
     }
@@ -2760,6 +2797,7 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
                         {
                             bValidGeom = true;
                             m_aoEnvelopes[i].Merge(sEnvelope);
+                            m_aoBatchEnvelopes[i].Merge(sEnvelope);
 
                             if (m_bWriteBBoxStruct)
                             {
@@ -15,7 +15,11 @@
 #define OGR_CSV_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogrspatialindexsidecar.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <set>
 
 typedef enum
@@ -80,7 +84,27 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     bool bHasFieldNames;
 
-    OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *
+    GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
+    void TranslateTokens(char **papszTokens, OGRFeature *poFeature, int nFID);
+
+    // Multi-threaded decoding of features
+    int m_nNumThreads = -1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoQueuedFeatures{};
+    int GetNumThreads();
+    void FillFeatureQueue();
+
+    // Sidecar spatial index, and candidate records of the current
+    // spatially filtered scan
+    bool m_bSidecarIndexChecked = false;
+    std::unique_ptr<OGRSpatialIndexSidecar> m_poSidecarIndex{};
+    bool m_bSidecarScanPrepared = false;
+    bool m_bUseSidecarCandidates = false;
+    std::vector<OGRSpatialIndexSidecar::Item> m_aoSidecarCandidates{};
+    size_t m_iNextSidecarCandidate = 0;
+    OGRSpatialIndexSidecar *GetSidecarIndex();
+    void PrepareSidecarScan();
 
     bool bNew;
     bool bInWriteMode;
@@ -121,7 +145,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(CSLConstList papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth;
+    // Atomic, since it may be set by several threads in FillFeatureQueue()
+    std::atomic<bool> bWarningBadTypeOrWidth;
     bool bKeepSourceColumns;
     bool bKeepGeomColumns;
 
@@ -209,6 +234,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
 
     OGRFeatureDefn *GetLayerDefn() override
@@ -256,6 +282,9 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     }
 
     OGRErr WriteHeader();
+
+    bool BuildSpatialIndex();
+    bool DropSpatialIndex();
 };
 
 /************************************************************************/
@@ -308,6 +337,9 @@ class OGRCSVDataSource final : public GDALDataset
 
     int TestCapability(const char *) override;
 
+    OGRLayer *ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
+                         const char *pszDialect) override;
+
     void CreateForSingleFile(const char *pszDirname, const char *pszFilename);
 
     void EnableGeometryFields()
@@ -274,6 +274,10 @@ OGRErr OGRCSVEditableLayerSynchronizer::EditableSyncToDisk(
             VSIUnlink(osTmpOriCSVTFilename);
     }
 
+    // The records of the rewritten file are no longer at the offsets
+    // recorded by the sidecar spatial index.
+    OGRSpatialIndexSidecar::Drop(osFilename);
+
     VSILFILE *fp = VSIFOpenL(osFilename, "rb+");
     if (fp == nullptr)
     {
@@ -457,6 +461,61 @@ int OGRCSVDataSource::TestCapability(const char *pszCap)
         return FALSE;
 }
 
+/************************************************************************/
+/*                             ExecuteSQL()                             */
+/*                                                                      */
+/*      We override this to provide special handling of the following   */
+/*      commands, which create or remove the sidecar spatial index:     */
+/*                                                                      */
+/*        CREATE SPATIAL INDEX ON layer_name                            */
+/*        DROP SPATIAL INDEX ON layer_name                              */
+/************************************************************************/
+
+OGRLayer *OGRCSVDataSource::ExecuteSQL(const char *pszStatement,
+                                       OGRGeometry *poSpatialFilter,
+                                       const char *pszDialect)
+
+{
+    const bool bCreate =
+        STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX ON ");
+    const bool bDrop = STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX ON ");
+    if (!bCreate && !bDrop)
+        return GDALDataset::ExecuteSQL(pszStatement, poSpatialFilter,
+                                       pszDialect);
+
+    const CPLStringList aosTokens(CSLTokenizeString(pszStatement));
+    if (aosTokens.size() != 5)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Syntax error in %s SPATIAL INDEX command.\n"
+                 "Was '%s'\n"
+                 "Should be of form '%s SPATIAL INDEX ON <table>'",
+                 aosTokens[0], pszStatement, aosTokens[0]);
+        return nullptr;
+    }
+
+    OGRLayer *poLayer = GetLayerByName(aosTokens[4]);
+    if (auto poEditableLayer = dynamic_cast<OGREditableLayer *>(poLayer))
+        poLayer = poEditableLayer->GetBaseLayer();
+    auto poCSVLayer = dynamic_cast<OGRCSVLayer *>(poLayer);
+    if (poCSVLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "No such layer as '%s' in %s SPATIAL INDEX.", aosTokens[4],
+                 aosTokens[0]);
+        return nullptr;
+    }
+
+    if (bCreate)
+        poCSVLayer->BuildSpatialIndex();
+    else if (!poCSVLayer->DropSpatialIndex())
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot remove spatial index of layer '%s'", aosTokens[4]);
+    }
+    return nullptr;
+}
+
 /************************************************************************/
 /*                              GetLayer()                              */
 /************************************************************************/
@@ -31,6 +31,7 @@
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
@@ -41,6 +42,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "gdal_thread_pool.h"
 
 #define DIGIT_ZERO '0'
 
@@ -859,6 +861,11 @@ std::vector<std::string> OGRCSVLayer::GetFileList()
     ret.emplace_back(pszFilename);
     if (!m_osCSVTFilename.empty())
         ret.emplace_back(m_osCSVTFilename);
+    const std::string osSidecarFilename =
+        OGRSpatialIndexSidecar::GetFilename(pszFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osSidecarFilename.c_str(), &sStat) == 0)
+        ret.emplace_back(osSidecarFilename);
     return ret;
 }
 
@@ -1285,6 +1292,8 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     nNextFID = 1;
+    m_apoQueuedFeatures.clear();
+    m_bSidecarScanPrepared = false;
 }
 
 /************************************************************************/
@@ -1320,7 +1329,8 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < 1 || fpCSV == nullptr)
         return nullptr;
-    if (nFID < nNextFID || bNeedRewindBeforeRead)
+    if (nFID < nNextFID || bNeedRewindBeforeRead ||
+        !m_apoQueuedFeatures.empty())
         ResetReading();
     while (nNextFID < nFID)
     {
@@ -1337,7 +1347,7 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
 
-OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
+OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse)
 
 {
     if (fpCSV == nullptr)
@@ -1348,9 +1358,38 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    // Create the OGR feature, or reuse the passed one.
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == poFeatureDefn);
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(poFeatureDefn);
+    }
+
+    TranslateTokens(papszTokens, poFeature, nNextFID++);
+    CSLDestroy(papszTokens);
+
+    m_nFeaturesRead++;
 
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          TranslateTokens()                           */
+/************************************************************************/
+
+/** Set the attributes, geometries and FID of poFeature from the tokens of
+ * the CSV record of feature nFID.
+ *
+ * This may be called concurrently from several threads by FillFeatureQueue().
+ */
+void OGRCSVLayer::TranslateTokens(char **papszTokens, OGRFeature *poFeature,
+                                  int nFID)
+{
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
     const int nAttrCount = std::min(
@@ -1466,16 +1505,15 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                 {
                     poFeature->SetField(iOGRField, 0);
                 }
-                else if (!bWarningBadTypeOrWidth)
+                else if (!bWarningBadTypeOrWidth.exchange(true))
                 {
                     // Set to TRUE because it's different than 0 but emit a warning
                     poFeature->SetField(iOGRField, 1);
-                    bWarningBadTypeOrWidth = true;
                     CPLError(
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1496,29 +1534,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                 if (endptr == papszTokens[iAttr] + strlen(papszTokens[iAttr]))
                 {
                     poFeature->SetField(iOGRField, dfVal);
-                    if (!bWarningBadTypeOrWidth &&
-                        (eFieldType == OFTInteger ||
+                    if ((eFieldType == OFTInteger ||
                          eFieldType == OFTInteger64) &&
-                        CPLGetValueType(papszTokens[iAttr]) == CPL_VALUE_REAL)
+                        CPLGetValueType(papszTokens[iAttr]) == CPL_VALUE_REAL &&
+                        !bWarningBadTypeOrWidth.exchange(true))
                     {
-                        bWarningBadTypeOrWidth = true;
                         CPLError(CE_Warning, CPLE_AppDefined,
                                  "Invalid value type found in record %d for "
                                  "field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nFID, poFieldDefn->GetNameRef());
                     }
-                    else if (!bWarningBadTypeOrWidth &&
-                             poFieldDefn->GetWidth() > 0 &&
+                    else if (poFieldDefn->GetWidth() > 0 &&
                              static_cast<int>(strlen(papszTokens[iAttr])) >
-                                 poFieldDefn->GetWidth())
+                                 poFieldDefn->GetWidth() &&
+                             !bWarningBadTypeOrWidth.exchange(true))
                     {
-                        bWarningBadTypeOrWidth = true;
                         CPLError(CE_Warning, CPLE_AppDefined,
                                  "Value with a width greater than field width "
                                  "found in record %d for field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nFID, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              poFieldDefn->GetWidth() > 0 &&
@@ -1530,28 +1566,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             pszDot != nullptr
                                 ? static_cast<int>(strlen(pszDot + 1))
                                 : 0;
-                        if (nPrecision > poFieldDefn->GetPrecision())
+                        if (nPrecision > poFieldDefn->GetPrecision() &&
+                            !bWarningBadTypeOrWidth.exchange(true))
                         {
-                            bWarningBadTypeOrWidth = true;
                             CPLError(CE_Warning, CPLE_AppDefined,
                                      "Value with a precision greater than "
                                      "field precision found in record %d for "
                                      "field %s. "
                                      "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
+                                     nFID, poFieldDefn->GetNameRef());
                         }
                     }
                 }
                 else
                 {
-                    if (!bWarningBadTypeOrWidth)
+                    if (!bWarningBadTypeOrWidth.exchange(true))
                     {
-                        bWarningBadTypeOrWidth = true;
                         CPLError(
                             CE_Warning, CPLE_AppDefined,
                             "Invalid value type found in record %d for field "
                             "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
+                            nFID, poFieldDefn->GetNameRef());
                     }
                 }
             }
@@ -1561,15 +1596,14 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored())
             {
                 poFeature->SetField(iOGRField, papszTokens[iAttr]);
-                if (!bWarningBadTypeOrWidth &&
-                    !poFeature->IsFieldSetAndNotNull(iOGRField))
+                if (!poFeature->IsFieldSetAndNotNull(iOGRField) &&
+                    !bWarningBadTypeOrWidth.exchange(true))
                 {
-                    bWarningBadTypeOrWidth = true;
                     CPLError(
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1582,16 +1616,16 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             else
             {
                 poFeature->SetField(iOGRField, papszTokens[iAttr]);
-                if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
+                if (poFieldDefn->GetWidth() > 0 &&
                     static_cast<int>(strlen(papszTokens[iAttr])) >
-                        poFieldDefn->GetWidth())
+                        poFieldDefn->GetWidth() &&
+                    !bWarningBadTypeOrWidth.exchange(true))
                 {
-                    bWarningBadTypeOrWidth = true;
                     CPLError(CE_Warning, CPLE_AppDefined,
                              "Value with a width greater than field width "
                              "found in record %d for field %s. "
                              "This warning will no longer be emitted",
-                             nNextFID, poFieldDefn->GetNameRef());
+                             nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1716,14 +1750,106 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    CSLDestroy(papszTokens);
 
     // Translate the record id.
-    poFeature->SetFID(nNextFID++);
+    poFeature->SetFID(nFID);
+}
 
-    m_nFeaturesRead++;
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
 
-    return poFeature;
+int OGRCSVLayer::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    }
+    return m_nNumThreads;
+}
+
+/************************************************************************/
+/*                          FillFeatureQueue()                          */
+/************************************************************************/
+
+// Number of records translated into features by each thread in a batch
+constexpr int RECORDS_PER_THREAD_IN_BATCH = 1000;
+
+/** Read a batch of records, and translate them into features with several
+ * threads. Splitting of the file into records is done sequentially, since
+ * record boundaries depend on the quoting state of what precedes them.
+ */
+void OGRCSVLayer::FillFeatureQueue()
+{
+    if (fpCSV == nullptr)
+        return;
+
+    const int nThreads = GetNumThreads();
+    std::vector<CPLStringList> aosRecords;
+    aosRecords.reserve(static_cast<size_t>(nThreads) *
+                       RECORDS_PER_THREAD_IN_BATCH);
+    while (aosRecords.size() <
+           static_cast<size_t>(nThreads) * RECORDS_PER_THREAD_IN_BATCH)
+    {
+        char **papszTokens = GetNextLineTokens();
+        if (papszTokens == nullptr)
+            break;
+        aosRecords.emplace_back(papszTokens);
+    }
+    if (aosRecords.empty())
+        return;
+
+    const int nFirstFID = nNextFID;
+    nNextFID += static_cast<int>(aosRecords.size());
+    m_nFeaturesRead += static_cast<GIntBig>(aosRecords.size());
+
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures(aosRecords.size());
+    const auto TranslateRecords =
+        [this, &aosRecords, &apoFeatures, nFirstFID](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto poFeature = std::make_unique<OGRFeature>(poFeatureDefn);
+            TranslateTokens(aosRecords[i].List(), poFeature.get(),
+                            nFirstFID + static_cast<int>(i));
+            apoFeatures[i] = std::move(poFeature);
+        }
+    };
+
+    const size_t nChunks = std::min(
+        static_cast<size_t>(nThreads),
+        (aosRecords.size() + RECORDS_PER_THREAD_IN_BATCH - 1) /
+            RECORDS_PER_THREAD_IN_BATCH);
+    CPLWorkerThreadPool *poThreadPool =
+        nChunks >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        TranslateRecords(0, aosRecords.size());
+    }
+    else
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t iStart = iChunk * aosRecords.size() / nChunks;
+            const size_t iEnd = (iChunk + 1) * aosRecords.size() / nChunks;
+            poJobQueue->SubmitJob(
+                [&TranslateRecords, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    TranslateRecords(iStart, iEnd);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+
+    for (auto &poFeature : apoFeatures)
+        m_apoQueuedFeatures.push_back(std::move(poFeature));
 }
 
 /************************************************************************/
@@ -1732,25 +1858,198 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
 OGRFeature *OGRCSVLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature)
+
+{
+    if (!poFeature || poFeature->GetDefnRef() != poFeatureDefn ||
+        GetNumThreads() > 1)
+        return OGRLayer::GetNextFeatureInto(poFeature);
+    return GetNextFeatureInternal(poFeature.get()) != nullptr;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (bNeedRewindBeforeRead)
         ResetReading();
+    if (!m_bSidecarScanPrepared)
+        PrepareSidecarScan();
 
     // Read features till we find one that satisfies our current
     // spatial criteria.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
-        if (poFeature == nullptr)
-            return nullptr;
+        OGRFeature *poFeature = nullptr;
+        if (m_bUseSidecarCandidates)
+        {
+            // Jump to the next record whose envelope intersects the
+            // spatial filter.
+            if (m_iNextSidecarCandidate == m_aoSidecarCandidates.size())
+                return nullptr;
+            const auto &oCandidate =
+                m_aoSidecarCandidates[m_iNextSidecarCandidate++];
+            if (VSIFSeekL(fpCSV, oCandidate.nOffset, SEEK_SET) != 0)
+                return nullptr;
+            nNextFID = static_cast<int>(oCandidate.nFID);
+            poFeature = GetNextUnfilteredFeature(poFeatureToReuse);
+            if (poFeature == nullptr)
+                return nullptr;
+        }
+        else if (poFeatureToReuse == nullptr && GetNumThreads() > 1)
+        {
+            if (m_apoQueuedFeatures.empty())
+                FillFeatureQueue();
+            if (m_apoQueuedFeatures.empty())
+                return nullptr;
+            poFeature = m_apoQueuedFeatures.front().release();
+            m_apoQueuedFeatures.pop_front();
+        }
+        else
+        {
+            poFeature = GetNextUnfilteredFeature(poFeatureToReuse);
+            if (poFeature == nullptr)
+                return nullptr;
+        }
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        if (poFeature != poFeatureToReuse)
+            delete poFeature;
+    }
+}
+
+/************************************************************************/
+/*                          GetSidecarIndex()                           */
+/************************************************************************/
+
+/** Return the sidecar spatial index of the layer, if there is a valid one */
+OGRSpatialIndexSidecar *OGRCSVLayer::GetSidecarIndex()
+{
+    if (!m_bSidecarIndexChecked)
+    {
+        m_bSidecarIndexChecked = true;
+        if (fpCSV != nullptr && !bNew && poFeatureDefn->GetGeomFieldCount() > 0)
+            m_poSidecarIndex = OGRSpatialIndexSidecar::Open(pszFilename);
+    }
+    return m_poSidecarIndex.get();
+}
+
+/************************************************************************/
+/*                         PrepareSidecarScan()                         */
+/************************************************************************/
+
+/** Determine, at the start of a scan, whether the sidecar spatial index can
+ * be used to evaluate the spatial filter, and if so collect the records
+ * whose envelope intersects it.
+ */
+void OGRCSVLayer::PrepareSidecarScan()
+{
+    m_bUseSidecarCandidates = false;
+    m_aoSidecarCandidates.clear();
+    m_iNextSidecarCandidate = 0;
+
+    if (m_poFilterGeom != nullptr && m_iGeomFieldFilter == 0 &&
+        fpCSV != nullptr && !bNew && OGRSpatialIndexSidecar::IsEnabled())
+    {
+        if (GetSidecarIndex() == nullptr &&
+            OGRSpatialIndexSidecar::IsAutoBuildEnabled() &&
+            poFeatureDefn->GetGeomFieldCount() > 0)
+        {
+            CPLDebug("CSV", "Building sidecar spatial index of %s",
+                     pszFilename);
+            BuildSpatialIndex();
+        }
+        auto poIndex = GetSidecarIndex();
+        if (poIndex && poIndex->Search(m_sFilterEnvelope,
+                                       m_aoSidecarCandidates))
+        {
+            m_bUseSidecarCandidates = true;
+        }
+    }
+
+    m_bSidecarScanPrepared = true;
+}
+
+/************************************************************************/
+/*                         BuildSpatialIndex()                          */
+/************************************************************************/
+
+/** Build the sidecar spatial index of the first geometry field of the
+ * layer, from a full scan of the file. */
+bool OGRCSVLayer::BuildSpatialIndex()
+{
+    if (fpCSV == nullptr || bNew || poFeatureDefn->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Cannot create a spatial index on layer '%s'",
+                 poFeatureDefn->GetName());
+        return false;
     }
+
+    m_poSidecarIndex.reset();
+    m_bSidecarIndexChecked = false;
+
+    // The geometry is needed, even if the user asked to ignore it
+    OGRGeomFieldDefn *poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(0);
+    const bool bGeomIgnored = CPL_TO_BOOL(poGeomFieldDefn->IsIgnored());
+    poGeomFieldDefn->SetIgnored(false);
+
+    std::vector<OGRSpatialIndexSidecar::Item> aoItems;
+    ResetReading();
+    OGRFeature oFeature(poFeatureDefn);
+    while (true)
+    {
+        const vsi_l_offset nOffset = VSIFTellL(fpCSV);
+        char **papszTokens = GetNextLineTokens();
+        if (papszTokens == nullptr)
+            break;
+        oFeature.Reset();
+        TranslateTokens(papszTokens, &oFeature, nNextFID);
+        CSLDestroy(papszTokens);
+
+        const OGRGeometry *poGeom = oFeature.GetGeomFieldRef(0);
+        if (poGeom != nullptr && !poGeom->IsEmpty())
+        {
+            OGRSpatialIndexSidecar::Item oItem;
+            poGeom->getEnvelope(&oItem.sEnvelope);
+            oItem.nOffset = nOffset;
+            oItem.nFID = nNextFID;
+            aoItems.push_back(oItem);
+        }
+        nNextFID++;
+    }
+
+    poGeomFieldDefn->SetIgnored(bGeomIgnored);
+    ResetReading();
+
+    return OGRSpatialIndexSidecar::Build(pszFilename, std::move(aoItems));
+}
+
+/************************************************************************/
+/*                          DropSpatialIndex()                          */
+/************************************************************************/
+
+bool OGRCSVLayer::DropSpatialIndex()
+{
+    m_poSidecarIndex.reset();
+    m_bSidecarIndexChecked = false;
+    ResetReading();
+    return OGRSpatialIndexSidecar::Drop(pszFilename);
 }
 
 /************************************************************************/
@@ -1775,6 +2074,9 @@ int OGRCSVLayer::TestCapability(const char *pszCap)
         return TRUE;
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return OGRSpatialIndexSidecar::IsEnabled() &&
+               GetSidecarIndex() != nullptr;
     else
         return FALSE;
 }
@@ -2205,6 +2507,10 @@ OGRErr OGRCSVLayer::ICreateFeature(OGRFeature *poNewFeature)
         return OGRERR_FAILURE;
     }
 
+    // The sidecar spatial index, if any, becomes outdated
+    m_poSidecarIndex.reset();
+    m_bSidecarIndexChecked = false;
+
     // If we need rewind, it means that we have just written a feature before
     // so there's no point seeking to the end of the file, as we're already
     // at the end.
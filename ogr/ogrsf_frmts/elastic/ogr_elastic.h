@@ -21,6 +21,7 @@
 #include "cpl_http.h"
 #include "cpl_json.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -34,6 +35,8 @@ typedef enum
 } ESGeometryTypeMapping;
 
 class OGRElasticDataSource;
+class CPLErrorAccumulator;
+class CPLJobQueue;
 
 class OGRESSortDesc
 {
@@ -76,6 +79,11 @@ class OGRElasticLayer final : public OGRLayer
 
     CPLString m_osBulkContent{};
     int m_nBulkUpload{};
+    //! Maximum number of bulk requests in flight. 0 = synchronous upload
+    int m_nBulkMaxConcurrentRequests = 1;
+    std::unique_ptr<CPLJobQueue> m_poBulkJobQueue{};
+    std::unique_ptr<CPLErrorAccumulator> m_poBulkErrorAccumulator{};
+    std::atomic<bool> m_bBulkUploadFailed{false};
 
     CPLString m_osFID{};
 
@@ -90,6 +98,9 @@ class OGRElasticLayer final : public OGRLayer
     CPLString m_osPrecision{};
 
     CPLString m_osScrollID{};
+    //! Scroll identifiers of the slices not yet exhausted, in sliced mode
+    std::vector<CPLString> m_aosSliceScrollIDs{};
+    bool m_bSlicedScroll = false;
     GIntBig m_iCurID = 0;
     GIntBig m_nNextFID = -1;  // for creation
     int m_iCurFeatureInPage = 0;
@@ -122,11 +133,17 @@ class OGRElasticLayer final : public OGRLayer
 
     void CopyMembersTo(OGRElasticLayer *poNew);
 
-    bool PushIndex();
+    bool PushIndex(bool bWaitCompletion = true);
+    bool WaitBulkUploads();
     CPLString BuildMap();
 
     OGRErr WriteMapIfNecessary();
     OGRFeature *GetNextRawFeature();
+    bool CanUseSlicedScroll() const;
+    void FetchSlicedScrollPages(const CPLString &osRequest,
+                                const CPLString &osPostData);
+    void AddFeaturesFromHits(json_object *poHits);
+    void ClearScrolls();
     void BuildFeature(OGRFeature *poFeature, json_object *poSource,
                       CPLString osPath);
     void CreateFieldFromSchema(const char *pszName, const char *pszPrefix,
@@ -340,6 +357,7 @@ class OGRElasticDataSource final : public GDALDataset
     char *m_pszWriteMap;
     char *m_pszMapping;
     int m_nBatchSize;
+    int m_nScrollSlices = 1;
     int m_nFeatureCountToEstablishFeatureDefn;
     bool m_bJSonField;
     bool m_bFlattenNestedAttributes;
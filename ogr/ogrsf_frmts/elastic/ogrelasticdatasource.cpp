@@ -19,6 +19,8 @@
 #include "ogrlibjsonutils.h"
 #include "ogr_swq.h"
 
+#include <algorithm>
+
 /************************************************************************/
 /*                        OGRElasticDataSource()                        */
 /************************************************************************/
@@ -828,6 +830,9 @@ bool OGRElasticDataSource::Open(GDALOpenInfo *poOpenInfo)
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "USERPWD", "");
     m_nBatchSize = atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                              "BATCH_SIZE", "100"));
+    m_nScrollSlices = std::max(
+        1, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                     "SCROLL_SLICES", "1")));
     m_nFeatureCountToEstablishFeatureDefn = atoi(
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                              "FEATURE_COUNT_TO_ESTABLISH_FEATURE_DEFN", "100"));
@@ -22,8 +22,12 @@
 #include "ogrlibjsonutils.h"
 #include "ogrgeojsongeometry.h"
 #include "ogr_geo_utils.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <cstdlib>
+#include <memory>
 #include <set>
 
 /************************************************************************/
@@ -105,6 +109,9 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
     {
         m_nBulkUpload =
             atoi(CSLFetchNameValueDef(papszOptions, "BULK_SIZE", "1000000"));
+        m_nBulkMaxConcurrentRequests = std::max(
+            0, atoi(CSLFetchNameValueDef(
+                   papszOptions, "BULK_MAX_CONCURRENT_REQUESTS", "1")));
     }
 
     const char *pszStoredFields =
@@ -244,6 +251,7 @@ void OGRElasticLayer::CopyMembersTo(OGRElasticLayer *poNew)
     poNew->m_bFeatureDefnFinalized = true;
     poNew->m_osBulkContent = m_osBulkContent;
     poNew->m_nBulkUpload = m_nBulkUpload;
+    poNew->m_nBulkMaxConcurrentRequests = m_nBulkMaxConcurrentRequests;
     poNew->m_osFID = m_osFID;
     poNew->m_aaosFieldPaths = m_aaosFieldPaths;
     poNew->m_aosMapToFieldIndex = m_aosMapToFieldIndex;
@@ -285,6 +293,7 @@ OGRElasticLayer *OGRElasticLayer::Clone()
 OGRElasticLayer::~OGRElasticLayer()
 {
     OGRElasticLayer::SyncToDisk();
+    m_poBulkJobQueue.reset();
 
     OGRElasticLayer::ResetReading();
 
@@ -1066,20 +1075,7 @@ const char *OGRElasticLayer::GetFIDColumn()
 
 void OGRElasticLayer::ResetReading()
 {
-    if (!m_osScrollID.empty())
-    {
-        char **papszOptions =
-            CSLAddNameValue(nullptr, "CUSTOMREQUEST", "DELETE");
-        CPLHTTPResult *psResult = m_poDS->HTTPFetch(
-            (m_poDS->GetURL() + CPLString("/_search/scroll?scroll_id=") +
-             m_osScrollID)
-                .c_str(),
-            papszOptions);
-        CSLDestroy(papszOptions);
-        CPLHTTPDestroyResult(psResult);
-
-        m_osScrollID = "";
-    }
+    ClearScrolls();
     for (int i = 0; i < (int)m_apoCachedFeatures.size(); i++)
         delete m_apoCachedFeatures[i];
     m_apoCachedFeatures.resize(0);
@@ -1096,6 +1092,34 @@ void OGRElasticLayer::ResetReading()
         m_dfEndTimeStamp = GetTimestamp() + dfTimeout;
 }
 
+/************************************************************************/
+/*                            ClearScrolls()                            */
+/************************************************************************/
+
+/* Release the server-side scroll contexts of the current iteration */
+void OGRElasticLayer::ClearScrolls()
+{
+    std::vector<CPLString> aosScrollIDs;
+    std::swap(aosScrollIDs, m_aosSliceScrollIDs);
+    if (!m_osScrollID.empty())
+        aosScrollIDs.push_back(m_osScrollID);
+    m_osScrollID = "";
+    m_bSlicedScroll = false;
+
+    for (const auto &osScrollID : aosScrollIDs)
+    {
+        char **papszOptions =
+            CSLAddNameValue(nullptr, "CUSTOMREQUEST", "DELETE");
+        CPLHTTPResult *psResult = m_poDS->HTTPFetch(
+            (m_poDS->GetURL() + CPLString("/_search/scroll?scroll_id=") +
+             osScrollID)
+                .c_str(),
+            papszOptions);
+        CSLDestroy(papszOptions);
+        CPLHTTPDestroyResult(psResult);
+    }
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -1260,6 +1284,16 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
                 CPLSPrintf("/_search?scroll=1m&size=%d", m_poDS->m_nBatchSize);
             osPostData = m_osJSONFilter;
         }
+
+        m_bSlicedScroll = CanUseSlicedScroll();
+    }
+    else if (m_bSlicedScroll)
+    {
+        if (m_aosSliceScrollIDs.empty())
+        {
+            m_bEOF = true;
+            return nullptr;
+        }
     }
     else
     {
@@ -1272,46 +1306,80 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
                                m_poDS->GetURL(), m_osScrollID.c_str());
     }
 
-    if (m_bAddPretty)
-        osRequest += "&pretty";
-    poResponse = m_poDS->RunRequest(osRequest, osPostData);
-    if (poResponse == nullptr)
+    if (m_bSlicedScroll)
     {
-        m_bEOF = true;
-        return nullptr;
+        FetchSlicedScrollPages(osRequest, osPostData);
+        if (m_apoCachedFeatures.empty())
+        {
+            m_bEOF = true;
+            return nullptr;
+        }
     }
-    m_osScrollID.clear();
-    json_object *poScrollID =
-        CPL_json_object_object_get(poResponse, "_scroll_id");
-    if (poScrollID)
+    else
     {
-        const char *pszScrollID = json_object_get_string(poScrollID);
-        if (pszScrollID)
-            m_osScrollID = pszScrollID;
-    }
+        if (m_bAddPretty)
+            osRequest += "&pretty";
+        poResponse = m_poDS->RunRequest(osRequest, osPostData);
+        if (poResponse == nullptr)
+        {
+            m_bEOF = true;
+            return nullptr;
+        }
+        m_osScrollID.clear();
+        json_object *poScrollID =
+            CPL_json_object_object_get(poResponse, "_scroll_id");
+        if (poScrollID)
+        {
+            const char *pszScrollID = json_object_get_string(poScrollID);
+            if (pszScrollID)
+                m_osScrollID = pszScrollID;
+        }
 
-    json_object *poHits = CPL_json_object_object_get(poResponse, "hits");
-    if (poHits == nullptr || json_object_get_type(poHits) != json_type_object)
-    {
-        m_bEOF = true;
+        json_object *poHits = CPL_json_object_object_get(poResponse, "hits");
+        if (poHits == nullptr ||
+            json_object_get_type(poHits) != json_type_object)
+        {
+            m_bEOF = true;
+            json_object_put(poResponse);
+            return nullptr;
+        }
+        poHits = CPL_json_object_object_get(poHits, "hits");
+        if (poHits == nullptr ||
+            json_object_get_type(poHits) != json_type_array)
+        {
+            m_bEOF = true;
+            json_object_put(poResponse);
+            return nullptr;
+        }
+        const auto nHits = json_object_array_length(poHits);
+        if (nHits == 0)
+        {
+            m_osScrollID = "";
+            m_bEOF = true;
+            json_object_put(poResponse);
+            return nullptr;
+        }
+        AddFeaturesFromHits(poHits);
         json_object_put(poResponse);
-        return nullptr;
     }
-    poHits = CPL_json_object_object_get(poHits, "hits");
-    if (poHits == nullptr || json_object_get_type(poHits) != json_type_array)
+    if (!m_apoCachedFeatures.empty())
     {
-        m_bEOF = true;
-        json_object_put(poResponse);
-        return nullptr;
+        OGRFeature *poRet = m_apoCachedFeatures[0];
+        m_apoCachedFeatures[0] = nullptr;
+        m_iCurFeatureInPage++;
+        m_nReadFeaturesSinceResetReading++;
+        return poRet;
     }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        AddFeaturesFromHits()                         */
+/************************************************************************/
+
+void OGRElasticLayer::AddFeaturesFromHits(json_object *poHits)
+{
     const auto nHits = json_object_array_length(poHits);
-    if (nHits == 0)
-    {
-        m_osScrollID = "";
-        m_bEOF = true;
-        json_object_put(poResponse);
-        return nullptr;
-    }
     for (auto i = decltype(nHits){0}; i < nHits; i++)
     {
         json_object *poHit = json_object_array_get_idx(poHits, i);
@@ -1365,16 +1433,129 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
         m_apoCachedFeatures.push_back(poFeature);
     }
 
-    json_object_put(poResponse);
-    if (!m_apoCachedFeatures.empty())
+}
+
+/************************************************************************/
+/*                        CanUseSlicedScroll()                          */
+/************************************************************************/
+
+/* Whether the iteration can be split in several slices fetched in parallel,
+ * which is only possible when the order of the results does not matter. */
+bool OGRElasticLayer::CanUseSlicedScroll() const
+{
+    // The slice parameter of scroll requests is available since
+    // Elasticsearch 5
+    return m_poDS->m_nScrollSlices > 1 && m_poDS->m_nMajorVersion >= 5 &&
+           m_osESSearch.empty() && m_aoSortColumns.empty();
+}
+
+/************************************************************************/
+/*                       FetchSlicedScrollPages()                       */
+/************************************************************************/
+
+/* Issue in parallel the request of the next page of each slice not yet
+ * exhausted (or the initial request of each slice), and append the features
+ * of all pages to m_apoCachedFeatures. */
+void OGRElasticLayer::FetchSlicedScrollPages(const CPLString &osRequest,
+                                             const CPLString &osPostData)
+{
+    const bool bFirstRequest = m_aosSliceScrollIDs.empty();
+    const int nSlices = bFirstRequest
+                            ? m_poDS->m_nScrollSlices
+                            : static_cast<int>(m_aosSliceScrollIDs.size());
+
+    std::vector<CPLString> aosRequests(nSlices);
+    std::vector<CPLString> aosPostData(nSlices);
+    if (bFirstRequest)
     {
-        OGRFeature *poRet = m_apoCachedFeatures[0];
-        m_apoCachedFeatures[0] = nullptr;
-        m_iCurFeatureInPage++;
-        m_nReadFeaturesSinceResetReading++;
-        return poRet;
+        json_object *poQuery = nullptr;
+        if (osPostData.empty())
+            poQuery = json_object_new_object();
+        else if (!OGRJSonParse(osPostData.c_str(), &poQuery, true) ||
+                 json_object_get_type(poQuery) != json_type_object)
+        {
+            json_object_put(poQuery);
+            m_bEOF = true;
+            return;
+        }
+        for (int i = 0; i < nSlices; ++i)
+        {
+            json_object *poSlice = json_object_new_object();
+            json_object_object_add(poSlice, "id", json_object_new_int(i));
+            json_object_object_add(poSlice, "max",
+                                   json_object_new_int(nSlices));
+            json_object_object_add(poQuery, "slice", poSlice);
+            aosRequests[i] = osRequest;
+            aosPostData[i] = json_object_to_json_string(poQuery);
+        }
+        json_object_put(poQuery);
+    }
+    else
+    {
+        for (int i = 0; i < nSlices; ++i)
+        {
+            aosRequests[i] =
+                CPLSPrintf("%s/_search/scroll?scroll=1m&scroll_id=%s",
+                           m_poDS->GetURL(), m_aosSliceScrollIDs[i].c_str());
+        }
+    }
+    if (m_bAddPretty)
+    {
+        for (auto &osURL : aosRequests)
+            osURL += "&pretty";
+    }
+
+    std::vector<json_object *> apoResponses(nSlices);
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nSlices);
+    if (poPool == nullptr)
+    {
+        for (int i = 0; i < nSlices; ++i)
+            apoResponses[i] = m_poDS->RunRequest(aosRequests[i].c_str(),
+                                                 aosPostData[i].c_str());
+    }
+    else
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        auto poQueue = poPool->CreateJobQueue();
+        for (int i = 0; i < nSlices; ++i)
+        {
+            poQueue->SubmitJob(
+                [this, i, &aosRequests, &aosPostData, &apoResponses,
+                 &oErrorAccumulator]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    apoResponses[i] = m_poDS->RunRequest(
+                        aosRequests[i].c_str(), aosPostData[i].c_str());
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+
+    // A slice is exhausted once it returns no hit, or on error
+    m_aosSliceScrollIDs.clear();
+    for (json_object *poResponse : apoResponses)
+    {
+        if (poResponse == nullptr)
+            continue;
+        json_object *poHits = CPL_json_object_object_get(poResponse, "hits");
+        if (poHits && json_object_get_type(poHits) == json_type_object)
+            poHits = CPL_json_object_object_get(poHits, "hits");
+        json_object *poScrollID =
+            CPL_json_object_object_get(poResponse, "_scroll_id");
+        if (poHits && json_object_get_type(poHits) == json_type_array &&
+            json_object_array_length(poHits) > 0)
+        {
+            const char *pszScrollID =
+                poScrollID ? json_object_get_string(poScrollID) : nullptr;
+            if (pszScrollID)
+                m_aosSliceScrollIDs.push_back(pszScrollID);
+            AddFeaturesFromHits(poHits);
+        }
+        json_object_put(poResponse);
     }
-    return nullptr;
 }
 
 /************************************************************************/
@@ -2697,7 +2878,7 @@ OGRErr OGRElasticLayer::ICreateFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if ((int)m_osBulkContent.length() > m_nBulkUpload)
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bWaitCompletion = */ false))
             {
                 return OGRERR_FAILURE;
             }
@@ -2836,7 +3017,7 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if (m_osBulkContent.length() > static_cast<size_t>(m_nBulkUpload))
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bWaitCompletion = */ false))
             {
                 return OGRERR_FAILURE;
             }
@@ -2871,18 +3052,76 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
 /*                             PushIndex()                              */
 /************************************************************************/
 
-bool OGRElasticLayer::PushIndex()
+bool OGRElasticLayer::PushIndex(bool bWaitCompletion)
 {
-    if (m_osBulkContent.empty())
+    if (m_bBulkUploadFailed)
     {
-        return true;
+        // Report the errors of previous background requests
+        m_osBulkContent.clear();
+        WaitBulkUploads();
+        return false;
     }
 
-    const bool bRet = m_poDS->UploadFile(
-        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
-    m_osBulkContent.clear();
+    if (!m_osBulkContent.empty())
+    {
+        CPLWorkerThreadPool *poPool =
+            m_nBulkMaxConcurrentRequests > 0
+                ? GDALGetGlobalThreadPool(m_nBulkMaxConcurrentRequests)
+                : nullptr;
+        if (poPool == nullptr)
+        {
+            const bool bRet = m_poDS->UploadFile(
+                CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
+            m_osBulkContent.clear();
+            return bRet;
+        }
+
+        if (!m_poBulkJobQueue)
+        {
+            m_poBulkJobQueue = poPool->CreateJobQueue();
+            m_poBulkErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+        }
+
+        // Bound the number of requests in flight, and thus the memory used
+        // by their payloads.
+        m_poBulkJobQueue->WaitCompletion(m_nBulkMaxConcurrentRequests - 1);
+
+        auto poContent = std::make_shared<CPLString>();
+        std::swap(*poContent, m_osBulkContent);
+        m_poBulkJobQueue->SubmitJob(
+            [this, poContent]()
+            {
+                auto oAccumulator =
+                    m_poBulkErrorAccumulator->InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                if (!m_poDS->UploadFile(
+                        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), *poContent))
+                {
+                    m_bBulkUploadFailed = true;
+                }
+            });
+    }
+
+    if (bWaitCompletion)
+        return WaitBulkUploads();
+    return !m_bBulkUploadFailed;
+}
+
+/************************************************************************/
+/*                          WaitBulkUploads()                           */
+/************************************************************************/
+
+/* Wait for the completion of the bulk requests running in the background,
+ * and report their errors. */
+bool OGRElasticLayer::WaitBulkUploads()
+{
+    if (!m_poBulkJobQueue)
+        return true;
 
-    return bRet;
+    m_poBulkJobQueue->WaitCompletion();
+    m_poBulkErrorAccumulator->ReplayErrors();
+    m_poBulkErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    return !m_bBulkUploadFailed.exchange(false);
 }
 
 /************************************************************************/
@@ -23,6 +23,7 @@
 
 #include <deque>
 #include <limits>
+#include <memory>
 
 class OGRFlatGeobufDataset;
 
@@ -86,6 +87,13 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // batched reading: features are read with multi-range requests and/or
+    // decoded by several threads, and queued for GetNextFeature()
+    int m_nNumThreads = -1;  // -1 = not yet computed
+    std::deque<std::unique_ptr<OGRFeature>> m_apoQueuedFeatures{};
+    bool m_bQueuedFeaturesEndWithError = false;
+    bool m_bBatchedReadingEOF = false;
+
     // creation
     GDALDataset *m_poDS = nullptr;  // parent dataset to get metadata from it
     bool m_create = false;
@@ -112,7 +120,15 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     // deserialize
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
+    OGRErr checkFeatureSize(uint64_t offset, uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    OGRErr decodeFeature(const GByte *featureBuf, uint32_t featureSize,
+                         OGRFeature *poFeature) const;
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
+    int GetNumThreads();
+    bool UseBatchedReading();
+    void FillFeatureQueue();
+    std::unique_ptr<OGRFeature> GetNextFeatureBatched();
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
@@ -156,6 +172,8 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRFeature *GetNextFeature() override;
+    virtual bool
+    GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature) override;
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = true) override;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -16,6 +16,8 @@
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_time.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogrlayerarrow.h"
@@ -534,6 +536,110 @@ static bool SupportsSeekWhileWriting(const std::string &osFilename)
            STARTS_WITH(osFilename.c_str(), "/vsimem/");
 }
 
+/************************************************************************/
+/*                            HilbertSort()                             */
+/************************************************************************/
+
+// Equivalent of FlatGeobuf::hilbertSort(), except that the Hilbert value of
+// each item is computed only once, and that the computation and the sort are
+// split among nThreads threads. Items with the same Hilbert value are kept
+// in their insertion order, so that the result does not depend on the
+// number of threads.
+static void HilbertSort(std::deque<FeatureItem> &items, const NodeItem &extent,
+                        int nThreads)
+{
+    const size_t nItems = items.size();
+    const double minX = extent.minX;
+    const double minY = extent.minY;
+    const double width = extent.width();
+    const double height = extent.height();
+
+    // (Hilbert value, index in items)
+    std::vector<std::pair<uint32_t, size_t>> keys(nItems);
+    const auto Compare = [](const std::pair<uint32_t, size_t> &a,
+                            const std::pair<uint32_t, size_t> &b)
+    {
+        return a.first > b.first ||
+               (a.first == b.first && a.second < b.second);
+    };
+    const auto ComputeAndSort = [&](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            keys[i].first = hilbert(items[i].nodeItem, HILBERT_MAX, minX, minY,
+                                    width, height);
+            keys[i].second = i;
+        }
+        std::sort(keys.begin() + iStart, keys.begin() + iEnd, Compare);
+    };
+
+    const size_t nChunks =
+        std::min(nItems, static_cast<size_t>(std::max(1, nThreads)));
+    CPLWorkerThreadPool *poThreadPool =
+        nChunks >= 2 ? GDALGetGlobalThreadPool(static_cast<int>(nChunks))
+                     : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        ComputeAndSort(0, nItems);
+    }
+    else
+    {
+        std::vector<size_t> anBounds;
+        for (size_t iChunk = 0; iChunk <= nChunks; ++iChunk)
+            anBounds.push_back(iChunk * nItems / nChunks);
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t iStart = anBounds[iChunk];
+            const size_t iEnd = anBounds[iChunk + 1];
+            poJobQueue->SubmitJob([&ComputeAndSort, iStart, iEnd]()
+                                  { ComputeAndSort(iStart, iEnd); });
+        }
+        poJobQueue->WaitCompletion();
+
+        // Merge sorted chunks pairwise
+        for (size_t nWidth = 1; nWidth < nChunks; nWidth *= 2)
+        {
+            for (size_t iChunk = 0; iChunk + nWidth < nChunks;
+                 iChunk += 2 * nWidth)
+            {
+                const auto iterStart = keys.begin() + anBounds[iChunk];
+                const auto iterMiddle =
+                    keys.begin() + anBounds[iChunk + nWidth];
+                const auto iterEnd =
+                    keys.begin() +
+                    anBounds[std::min(iChunk + 2 * nWidth, nChunks)];
+                poJobQueue->SubmitJob(
+                    [iterStart, iterMiddle, iterEnd, &Compare]()
+                    {
+                        std::inplace_merge(iterStart, iterMiddle, iterEnd,
+                                           Compare);
+                    });
+            }
+            poJobQueue->WaitCompletion();
+        }
+    }
+
+    // Apply the permutation in place, following its cycles
+    constexpr size_t DONE = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        if (keys[i].second == DONE)
+            continue;
+        FeatureItem tmp = items[i];
+        size_t j = i;
+        while (keys[j].second != i)
+        {
+            const size_t k = keys[j].second;
+            items[j] = items[k];
+            keys[j].second = DONE;
+            j = k;
+        }
+        items[j] = tmp;
+        keys[j].second = DONE;
+    }
+}
+
 bool OGRFlatGeobufLayer::CreateFinalFile()
 {
     // no spatial index requested, we are (almost) done
@@ -608,7 +714,7 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
     CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
+    HilbertSort(m_featureItems, extent, GetNumThreads());
     CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
     uint64_t featureOffset = 0;
     for (auto &item : m_featureItems)
@@ -939,16 +1045,22 @@ OGRErr OGRFlatGeobufLayer::readIndex()
                          env.MinX, env.MinY, env.MaxX, env.MaxY);
             const auto treeOffset =
                 sizeof(magicbytes) + sizeof(uoffset_t) + headerSize;
-            const auto readNode =
-                [this, treeOffset](uint8_t *buf, size_t i, size_t s)
+            // Read the nodes of the queue with multi-range requests, which
+            // saves a lot of round-trips on network files.
+            const auto readNodes =
+                [this, treeOffset](size_t count, uint8_t **buffers,
+                                   const uint64_t *offsets, const size_t *sizes)
             {
-                if (VSIFSeekL(m_poFp, treeOffset + i, SEEK_SET) == -1)
-                    throw std::runtime_error("I/O seek failure");
-                if (VSIFReadL(buf, 1, s, m_poFp) != s)
+                std::vector<vsi_l_offset> anOffsets(count);
+                for (size_t i = 0; i < count; ++i)
+                    anOffsets[i] = treeOffset + offsets[i];
+                if (VSIFReadMultiRangeL(static_cast<int>(count),
+                                        reinterpret_cast<void **>(buffers),
+                                        anOffsets.data(), sizes, m_poFp) != 0)
                     throw std::runtime_error("I/O read file");
             };
-            m_foundItems = PackedRTree::streamSearch(
-                featuresCount, indexNodeSize, n, readNode);
+            m_foundItems = PackedRTree::streamSearchBatched(
+                featuresCount, indexNodeSize, n, readNodes);
             m_featuresCount = m_foundItems.size();
             CPLDebugOnly("FlatGeobuf",
                          "%lu features found in spatial index search",
@@ -988,10 +1100,37 @@ static inline bool ParseDateTime(const char *pszInput, size_t nLen,
 }
 
 OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+bool OGRFlatGeobufLayer::GetNextFeatureInto(
+    std::unique_ptr<OGRFeature> &poFeature)
+{
+    if (!poFeature || poFeature->GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(poFeature);
+    if (UseBatchedReading())
+    {
+        poFeature = GetNextFeatureBatched();
+        return poFeature != nullptr;
+    }
+    return GetNextFeatureInternal(poFeature.get()) != nullptr;
+}
+
+// If poFeatureToReuse is not null, it is filled and returned instead of
+// allocating a new feature.
+OGRFeature *
+OGRFlatGeobufLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
 {
     if (m_create)
         return nullptr;
 
+    if (UseBatchedReading())
+    {
+        CPLAssert(poFeatureToReuse == nullptr);
+        return GetNextFeatureBatched().release();
+    }
+
     while (true)
     {
         if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
@@ -1012,8 +1151,18 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
             return nullptr;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
+        std::unique_ptr<OGRFeature> poNewFeature;
+        OGRFeature *poFeature = poFeatureToReuse;
+        if (poFeature)
+        {
+            poFeature->Reset();
+        }
+        else
+        {
+            poNewFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+            poFeature = poNewFeature.get();
+        }
+        if (parseFeature(poFeature) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Fatal error parsing feature");
@@ -1028,11 +1177,312 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
 
         m_featuresPos++;
 
+        if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
+             FilterGeometry(poFeature->GetGeometryRef())) &&
+            (m_poAttrQuery == nullptr || m_ignoreAttributeFilter ||
+             m_poAttrQuery->Evaluate(poFeature)))
+            return poNewFeature ? poNewFeature.release() : poFeature;
+    }
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+int OGRFlatGeobufLayer::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    }
+    return m_nNumThreads;
+}
+
+/************************************************************************/
+/*                         UseBatchedReading()                          */
+/************************************************************************/
+
+// Features are read by batches when they can be decoded by several threads,
+// or when a spatial filter is set on a remote file, so that the byte ranges
+// of the features selected by the spatial index are fetched with a few
+// multi-range requests, instead of one request per feature.
+bool OGRFlatGeobufLayer::UseBatchedReading()
+{
+    // GetFeature() reads a single feature
+    if (m_create || m_ignoreAttributeFilter)
+        return false;
+    return GetNumThreads() > 1 ||
+           (m_poFilterGeom != nullptr && !VSIIsLocal(m_osFilename.c_str()));
+}
+
+/************************************************************************/
+/*                         FillFeatureQueue()                           */
+/************************************************************************/
+
+// Read the next batch of features, decode them, potentially in parallel,
+// and append them to m_apoQueuedFeatures.
+void OGRFlatGeobufLayer::FillFeatureQueue()
+{
+    constexpr size_t MAX_FEATURES_PER_BATCH = 1000;
+    constexpr size_t MAX_BYTES_PER_BATCH = 16 * 1024 * 1024;
+
+    size_t nFeatures = MAX_FEATURES_PER_BATCH;
+    if (m_featuresCount > 0)
+    {
+        if (m_featuresPos >= m_featuresCount)
+        {
+            m_bBatchedReadingEOF = true;
+            return;
+        }
+        nFeatures = static_cast<size_t>(std::min<uint64_t>(
+            nFeatures, m_featuresCount - m_featuresPos));
+    }
+
+    struct RawFeature
+    {
+        GIntBig nFID;
+        size_t nOffsetInBuffer;
+        uint32_t nSize;
+    };
+
+    std::vector<RawFeature> asRawFeatures;
+    std::vector<GByte> abyBuffer;
+    bool bError = false;
+
+    // Each feature buffer is stored at an 8-byte aligned offset of abyBuffer
+    const auto AlignedSize = [](uint32_t nSize)
+    { return (static_cast<size_t>(nSize) + 7) & ~static_cast<size_t>(7); };
+
+    try
+    {
+        if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
+        {
+            // First read the size of the features, then their content
+            std::vector<uint32_t> anFeatureSizes(nFeatures);
+            std::vector<void *> apData(nFeatures);
+            std::vector<vsi_l_offset> anOffsets(nFeatures);
+            std::vector<size_t> anSizes(nFeatures, sizeof(uint32_t));
+            for (size_t i = 0; i < nFeatures; ++i)
+            {
+                apData[i] = &anFeatureSizes[i];
+                anOffsets[i] =
+                    m_offsetFeatures + m_foundItems[m_featuresPos + i].offset;
+            }
+            if (VSIFReadMultiRangeL(static_cast<int>(nFeatures),
+                                    apData.data(), anOffsets.data(),
+                                    anSizes.data(), m_poFp) != 0)
+            {
+                CPLErrorIO("reading feature size");
+                bError = true;
+            }
+            else
+            {
+                size_t nBufferSize = 0;
+                for (size_t i = 0; i < nFeatures; ++i)
+                {
+                    if (i > 0 && nBufferSize >= MAX_BYTES_PER_BATCH)
+                        break;
+                    CPL_LSBPTR32(&anFeatureSizes[i]);
+                    if (checkFeatureSize(anOffsets[i], anFeatureSizes[i]) !=
+                        OGRERR_NONE)
+                    {
+                        bError = true;
+                        break;
+                    }
+                    asRawFeatures.push_back(
+                        {static_cast<GIntBig>(
+                             m_foundItems[m_featuresPos + i].index),
+                         nBufferSize, anFeatureSizes[i]});
+                    nBufferSize += AlignedSize(anFeatureSizes[i]);
+                }
+                abyBuffer.resize(nBufferSize);
+                for (size_t i = 0; i < asRawFeatures.size(); ++i)
+                {
+                    apData[i] =
+                        abyBuffer.data() + asRawFeatures[i].nOffsetInBuffer;
+                    anOffsets[i] += sizeof(uint32_t);
+                    anSizes[i] = asRawFeatures[i].nSize;
+                }
+                if (!asRawFeatures.empty() &&
+                    VSIFReadMultiRangeL(static_cast<int>(asRawFeatures.size()),
+                                        apData.data(), anOffsets.data(),
+                                        anSizes.data(), m_poFp) != 0)
+                {
+                    CPLErrorIO("reading feature");
+                    asRawFeatures.clear();
+                    bError = true;
+                }
+            }
+        }
+        else
+        {
+            if (VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+            {
+                CPLErrorIO("seeking to feature location");
+                bError = true;
+                nFeatures = 0;
+            }
+            for (size_t i = 0; i < nFeatures; ++i)
+            {
+                if (i > 0 && abyBuffer.size() >= MAX_BYTES_PER_BATCH)
+                    break;
+                uint32_t featureSize;
+                if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) !=
+                    1)
+                {
+                    if (VSIFEofL(m_poFp))
+                    {
+                        CPLDebug("FlatGeobuf",
+                                 "GetNextFeature: iteration end due to EOF");
+                        m_bBatchedReadingEOF = true;
+                    }
+                    else
+                    {
+                        CPLErrorIO("reading feature size");
+                        bError = true;
+                    }
+                    break;
+                }
+                CPL_LSBPTR32(&featureSize);
+                if (checkFeatureSize(m_offset, featureSize) != OGRERR_NONE)
+                {
+                    bError = true;
+                    break;
+                }
+                const size_t nOffsetInBuffer = abyBuffer.size();
+                abyBuffer.resize(nOffsetInBuffer + AlignedSize(featureSize));
+                if (VSIFReadL(abyBuffer.data() + nOffsetInBuffer, 1,
+                              featureSize, m_poFp) != featureSize)
+                {
+                    CPLErrorIO("reading feature");
+                    bError = true;
+                    break;
+                }
+                asRawFeatures.push_back(
+                    {static_cast<GIntBig>(m_featuresPos + i), nOffsetInBuffer,
+                     featureSize});
+                m_offset += featureSize + sizeof(featureSize);
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLErrorMemoryAllocation("feature batch");
+        asRawFeatures.clear();
+        bError = true;
+    }
+    m_featuresPos += asRawFeatures.size();
+
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures(asRawFeatures.size());
+    const auto DecodeFeatures =
+        [this, &asRawFeatures, &abyBuffer, &apoFeatures](size_t iStart,
+                                                         size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const auto &sRawFeature = asRawFeatures[i];
+            auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+            poFeature->SetFID(sRawFeature.nFID);
+            if (decodeFeature(abyBuffer.data() + sRawFeature.nOffsetInBuffer,
+                              sRawFeature.nSize,
+                              poFeature.get()) == OGRERR_NONE)
+            {
+                apoFeatures[i] = std::move(poFeature);
+            }
+        }
+    };
+
+    const int nThreads = static_cast<int>(
+        std::min<size_t>(GetNumThreads(), asRawFeatures.size()));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        DecodeFeatures(0, asRawFeatures.size());
+    }
+    else
+    {
+        const size_t nChunks = std::min(asRawFeatures.size(),
+                                        static_cast<size_t>(nThreads) * 4);
+        CPLErrorAccumulator oErrorAccumulator;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t iStart = iChunk * asRawFeatures.size() / nChunks;
+            const size_t iEnd = (iChunk + 1) * asRawFeatures.size() / nChunks;
+            poJobQueue->SubmitJob(
+                [&DecodeFeatures, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    DecodeFeatures(iStart, iEnd);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+
+    for (auto &poFeature : apoFeatures)
+    {
+        if (!poFeature)
+        {
+            bError = true;
+            break;
+        }
+        m_apoQueuedFeatures.push_back(std::move(poFeature));
+    }
+    if (bError)
+        m_bQueuedFeaturesEndWithError = true;
+    else if (asRawFeatures.empty())
+        m_bBatchedReadingEOF = true;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureBatched()                        */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> OGRFlatGeobufLayer::GetNextFeatureBatched()
+{
+    while (true)
+    {
+        if (m_apoQueuedFeatures.empty())
+        {
+            if (m_bQueuedFeaturesEndWithError)
+            {
+                m_bQueuedFeaturesEndWithError = false;
+                m_bBatchedReadingEOF = true;
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Fatal error parsing feature");
+                return nullptr;
+            }
+            if (m_bBatchedReadingEOF)
+                return nullptr;
+
+            if (readIndex() != OGRERR_NONE)
+            {
+                return nullptr;
+            }
+
+            if (m_queriedSpatialIndex && m_featuresCount == 0)
+            {
+                CPLDebugOnly("FlatGeobuf", "GetNextFeature: no features found");
+                return nullptr;
+            }
+
+            FillFeatureQueue();
+            continue;
+        }
+
+        auto poFeature = std::move(m_apoQueuedFeatures.front());
+        m_apoQueuedFeatures.pop_front();
+
         if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
             (m_poAttrQuery == nullptr || m_ignoreAttributeFilter ||
              m_poAttrQuery->Evaluate(poFeature.get())))
-            return poFeature.release();
+            return poFeature;
     }
 }
 
@@ -1065,6 +1515,32 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
     return OGRERR_NONE;
 }
 
+// Sanity check to avoid allocated huge amount of memory on corrupted
+// feature
+OGRErr OGRFlatGeobufLayer::checkFeatureSize(uint64_t offset,
+                                            uint32_t featureSize)
+{
+    if (featureSize > 100 * 1024 * 1024)
+    {
+        if (featureSize > feature_max_buffer_size)
+            return CPLErrorInvalidSize("feature");
+
+        if (m_nFileSize == 0)
+        {
+            VSIStatBufL sStatBuf;
+            if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+            {
+                m_nFileSize = sStatBuf.st_size;
+            }
+        }
+        if (offset + featureSize > m_nFileSize)
+        {
+            return CPLErrorIO("reading feature size");
+        }
+    }
+    return OGRERR_NONE;
+}
+
 OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
 {
     GIntBig fid;
@@ -1103,51 +1579,41 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     }
     CPL_LSBPTR32(&featureSize);
 
-    // Sanity check to avoid allocated huge amount of memory on corrupted
-    // feature
-    if (featureSize > 100 * 1024 * 1024)
-    {
-        if (featureSize > feature_max_buffer_size)
-            return CPLErrorInvalidSize("feature");
-
-        if (m_nFileSize == 0)
-        {
-            VSIStatBufL sStatBuf;
-            if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
-            {
-                m_nFileSize = sStatBuf.st_size;
-            }
-        }
-        if (m_offset + featureSize > m_nFileSize)
-        {
-            return CPLErrorIO("reading feature size");
-        }
-    }
-
-    const auto err = ensureFeatureBuf(featureSize);
+    auto err = checkFeatureSize(m_offset, featureSize);
+    if (err != OGRERR_NONE)
+        return err;
+    err = ensureFeatureBuf(featureSize);
     if (err != OGRERR_NONE)
         return err;
     if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
         return CPLErrorIO("reading feature");
     m_offset += featureSize + sizeof(featureSize);
 
+    return decodeFeature(m_featureBuf, featureSize, poFeature);
+}
+
+// Verify and decode the feature buffer featureBuf into poFeature.
+// This method does not modify the state of the layer, and may be called
+// from several threads at once.
+OGRErr OGRFlatGeobufLayer::decodeFeature(const GByte *featureBuf,
+                                         uint32_t featureSize,
+                                         OGRFeature *poFeature) const
+{
     if (m_bVerifyBuffers)
     {
-        Verifier v(m_featureBuf, featureSize);
+        Verifier v(featureBuf, featureSize);
         const auto ok = VerifyFeatureBuffer(v);
         if (!ok)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Buffer verification failed");
-            CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
-                         static_cast<long unsigned int>(m_offset));
-            CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
-                         static_cast<long unsigned int>(m_featuresPos));
+            CPLDebugOnly("FlatGeobuf", "fid: " CPL_FRMT_GIB,
+                         poFeature->GetFID());
             CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
             return OGRERR_CORRUPT_DATA;
         }
     }
 
-    const auto feature = GetRoot<Feature>(m_featureBuf);
+    const auto feature = GetRoot<Feature>(featureBuf);
     const auto geometry = feature->geometry();
     if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
     {
@@ -1450,7 +1916,8 @@ int OGRFlatGeobufLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
 {
     if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
         CPLTestBool(
-            CPLGetConfigOption("OGR_FLATGEOBUF_STREAM_BASE_IMPL", "NO")))
+            CPLGetConfigOption("OGR_FLATGEOBUF_STREAM_BASE_IMPL", "NO")) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(m_aosArrowArrayStreamOptions))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
@@ -2450,6 +2917,10 @@ void OGRFlatGeobufLayer::ResetReading()
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
     m_ignoreAttributeFilter = false;
+    m_nNumThreads = -1;
+    m_apoQueuedFeatures.clear();
+    m_bQueuedFeaturesEndWithError = false;
+    m_bBatchedReadingEOF = false;
     return;
 }
 
@@ -401,6 +401,90 @@ std::vector<SearchResultItem> PackedRTree::streamSearch(
     return results;
 }
 
+std::vector<SearchResultItem> PackedRTree::streamSearchBatched(
+    const uint64_t numItems, const uint16_t nodeSize, const NodeItem &item,
+    const std::function<void(size_t, uint8_t **, const uint64_t *,
+                             const size_t *)> &readNodes,
+    const size_t maxNodesPerBatch)
+{
+    auto levelBounds = generateLevelBounds(numItems, nodeSize);
+    uint64_t leafNodesOffset = levelBounds.front().first;
+    uint64_t numNodes = levelBounds.front().second;
+    // use ordered search queue to make index traversal in sequential order.
+    // As levels are stored top-down, the nodes of a level are all dequeued
+    // before the ones of the next level, so results are still sorted.
+    std::map<uint64_t, uint64_t> queue;
+    std::vector<SearchResultItem> results;
+    std::vector<std::pair<uint64_t, uint64_t>> batch;
+    std::vector<NodeItem> nodeItems;
+    std::vector<uint8_t *> buffers;
+    std::vector<uint64_t> offsets;
+    std::vector<size_t> sizes;
+    queue.insert(std::pair<uint64_t, uint64_t>(0, levelBounds.size() - 1));
+    while (queue.size() != 0)
+    {
+        batch.clear();
+        while (queue.size() != 0 &&
+               batch.size() < std::max<size_t>(1, maxNodesPerBatch))
+        {
+            batch.push_back(*queue.begin());
+            queue.erase(queue.begin());
+        }
+        nodeItems.resize(batch.size() * nodeSize);
+        buffers.resize(batch.size());
+        offsets.resize(batch.size());
+        sizes.resize(batch.size());
+        for (size_t iNode = 0; iNode < batch.size(); iNode++)
+        {
+            const uint64_t nodeIndex = batch[iNode].first;
+            const uint64_t level = batch[iNode].second;
+            const uint64_t end =
+                std::min(static_cast<uint64_t>(nodeIndex + nodeSize),
+                         levelBounds[static_cast<size_t>(level)].second);
+            buffers[iNode] =
+                reinterpret_cast<uint8_t *>(&nodeItems[iNode * nodeSize]);
+            offsets[iNode] = nodeIndex * sizeof(NodeItem);
+            sizes[iNode] = static_cast<size_t>((end - nodeIndex) *
+                                               sizeof(NodeItem));
+        }
+        readNodes(batch.size(), buffers.data(), offsets.data(), sizes.data());
+        for (size_t iNode = 0; iNode < batch.size(); iNode++)
+        {
+            const uint64_t nodeIndex = batch[iNode].first;
+            const uint64_t level = batch[iNode].second;
+            const bool isLeafNode = nodeIndex >= numNodes - numItems;
+            const uint64_t length = sizes[iNode] / sizeof(NodeItem);
+            const NodeItem *nodeItemsOfNode = &nodeItems[iNode * nodeSize];
+#if !CPL_IS_LSB
+            for (size_t i = 0; i < static_cast<size_t>(length); i++)
+            {
+                NodeItem &nodeItem = nodeItems[iNode * nodeSize + i];
+                CPL_LSBPTR64(&nodeItem.minX);
+                CPL_LSBPTR64(&nodeItem.minY);
+                CPL_LSBPTR64(&nodeItem.maxX);
+                CPL_LSBPTR64(&nodeItem.maxY);
+                CPL_LSBPTR64(&nodeItem.offset);
+            }
+#endif
+            // search through child nodes
+            for (uint64_t nodePos = 0; nodePos < length; nodePos++)
+            {
+                const auto &nodeItem =
+                    nodeItemsOfNode[static_cast<size_t>(nodePos)];
+                if (!item.intersects(nodeItem))
+                    continue;
+                if (isLeafNode)
+                    results.push_back({nodeItem.offset,
+                                       nodeIndex + nodePos - leafNodesOffset});
+                else
+                    queue.insert(std::pair<uint64_t, uint64_t>(nodeItem.offset,
+                                                               level - 1));
+            }
+        }
+    }
+    return results;
+}
+
 uint64_t PackedRTree::size() const
 {
     return _numNodes * sizeof(NodeItem);
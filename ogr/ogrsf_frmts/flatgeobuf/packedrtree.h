@@ -143,6 +143,14 @@ class PackedRTree
     static std::vector<SearchResultItem> streamSearch(
         const uint64_t numItems, const uint16_t nodeSize, const NodeItem &item,
         const std::function<void(uint8_t *, size_t, size_t)> &readNode);
+    /** Same as streamSearch(), except that the nodes of the queue are read
+     * in batches of up to maxNodesPerBatch nodes, with a single call to
+     * readNodes(count, buffers, offsets, sizes) per batch. */
+    static std::vector<SearchResultItem> streamSearchBatched(
+        const uint64_t numItems, const uint16_t nodeSize, const NodeItem &item,
+        const std::function<void(size_t, uint8_t **, const uint64_t *,
+                                 const size_t *)> &readNodes,
+        const size_t maxNodesPerBatch = 1024);
     static std::vector<std::pair<uint64_t, uint64_t>>
     generateLevelBounds(const uint64_t numItems, const uint16_t nodeSize);
     uint64_t size() const;
@@ -62,4 +62,38 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/*                                                                      */
+/*      Return an OGRNullFID terminated list of the FIDs of the         */
+/*      features whose value is between psMin and psMax (nullptr        */
+/*      meaning unbounded), or nullptr if range queries are not         */
+/*      supported by the index. The list may contain FIDs of features   */
+/*      that do not match, as they are evaluated against the full       */
+/*      query afterwards.                                               */
+/************************************************************************/
+
+GIntBig *OGRAttrIndex::GetRangeMatches(const OGRField * /* psMin */,
+                                       bool /* bMinIncluded */,
+                                       const OGRField * /* psMax */,
+                                       bool /* bMaxIncluded */,
+                                       int * /* pnFIDCount */)
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          GetPrefixMatches()                          */
+/*                                                                      */
+/*      Same as GetRangeMatches() for string values starting with       */
+/*      pszPrefix.                                                      */
+/************************************************************************/
+
+GIntBig *OGRAttrIndex::GetPrefixMatches(const char * /* pszPrefix */,
+                                        bool /* bCaseInsensitive */,
+                                        int * /* pnFIDCount */)
+{
+    return nullptr;
+}
+
 //! @endcond
@@ -601,6 +601,10 @@ void OGRGenSQLResultsLayer::ResetReading()
     m_nNextIndexFID = psSelectInfo->offset;
     m_nIteratedFeatures = -1;
     m_bEOF = false;
+
+    // Secondary layers might have been modified since the previous iteration
+    m_aoJoinHashTables.clear();
+    m_aoJoinHashTables.resize(psSelectInfo->join_count);
 }
 
 /************************************************************************/
@@ -1468,6 +1472,147 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                         BuildJoinHashTable()                         */
+/************************************************************************/
+
+/** Load the features of the secondary layer of the join in a hash table
+ * indexed by the join key, when the join condition is of the form
+ * primary_table.field = secondary_table.field, with both fields being
+ * integer or both being string fields. This replaces setting an attribute
+ * filter on the secondary layer for each feature of the primary layer, which
+ * is a full scan of the secondary layer for drivers without attribute index.
+ */
+void OGRGenSQLResultsLayer::BuildJoinHashTable(int iJoin)
+{
+    auto &oHashTable = m_aoJoinHashTables[iJoin];
+    oHashTable.bBuilt = true;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_USE_HASH_JOIN", "YES")))
+        return;
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2)
+    {
+        return;
+    }
+    const swq_expr_node *poPrimaryColumn = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondaryColumn = poExpr->papoSubExpr[1];
+    if (poPrimaryColumn->eNodeType != SNT_COLUMN ||
+        poSecondaryColumn->eNodeType != SNT_COLUMN)
+    {
+        return;
+    }
+    if (poPrimaryColumn->table_index != 0)
+        std::swap(poPrimaryColumn, poSecondaryColumn);
+    if (poPrimaryColumn->table_index != 0 ||
+        poSecondaryColumn->table_index != psJoinInfo->secondary_table)
+    {
+        return;
+    }
+
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+    // Scanning the secondary layer would reset the reading of the primary one
+    if (poJoinLayer == m_poSrcLayer)
+        return;
+
+    const OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+    const OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+    const int iPrimaryField = poPrimaryColumn->field_index;
+    const int iSecondaryField = poSecondaryColumn->field_index;
+    // Exclude special fields
+    if (iPrimaryField < 0 || iPrimaryField >= poSrcDefn->GetFieldCount() ||
+        iSecondaryField < 0 || iSecondaryField >= poJoinDefn->GetFieldCount())
+    {
+        return;
+    }
+
+    const auto IsIntegerType = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const OGRFieldType ePrimaryType =
+        poSrcDefn->GetFieldDefn(iPrimaryField)->GetType();
+    const OGRFieldType eSecondaryType =
+        poJoinDefn->GetFieldDefn(iSecondaryField)->GetType();
+    if (IsIntegerType(ePrimaryType) && IsIntegerType(eSecondaryType))
+        oHashTable.bStringKey = false;
+    else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        oHashTable.bStringKey = true;
+    else
+        return;
+
+    CPLDebug("OGR", "Using hash join on %s.%s", poJoinLayer->GetName(),
+             poJoinDefn->GetFieldDefn(iSecondaryField)->GetNameRef());
+
+    oHashTable.iPrimaryField = iPrimaryField;
+    oHashTable.bUsable = true;
+
+    poJoinLayer->SetAttributeFilter("");
+    poJoinLayer->ResetReading();
+    for (auto &&poFeature : *poJoinLayer)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iSecondaryField))
+            continue;
+
+        // Only the first matching feature of the secondary layer is used
+        // by the join, so only keep that one.
+        const size_t nIdx = oHashTable.apoFeatures.size();
+        bool bInserted;
+        if (oHashTable.bStringKey)
+        {
+            // String comparisons are case insensitive in OGR SQL
+            CPLString osKey(poFeature->GetFieldAsString(iSecondaryField));
+            osKey.toupper();
+            bInserted =
+                oHashTable.oMapStringKeyToIdx.emplace(std::move(osKey), nIdx)
+                    .second;
+        }
+        else
+        {
+            bInserted = oHashTable.oMapIntegerKeyToIdx
+                            .emplace(poFeature->GetFieldAsInteger64(
+                                         iSecondaryField),
+                                     nIdx)
+                            .second;
+        }
+        if (bInserted)
+            oHashTable.apoFeatures.emplace_back(poFeature.release());
+    }
+}
+
+/************************************************************************/
+/*                    GetJoinFeatureFromHashTable()                     */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::GetJoinFeatureFromHashTable(
+    const JoinHashTable &oHashTable, const OGRFeature *poSrcFeat) const
+{
+    // if source key is null, we can't do join.
+    if (!poSrcFeat->IsFieldSetAndNotNull(oHashTable.iPrimaryField))
+        return nullptr;
+
+    size_t nIdx;
+    if (oHashTable.bStringKey)
+    {
+        CPLString osKey(poSrcFeat->GetFieldAsString(oHashTable.iPrimaryField));
+        osKey.toupper();
+        const auto oIter = oHashTable.oMapStringKeyToIdx.find(osKey);
+        if (oIter == oHashTable.oMapStringKeyToIdx.end())
+            return nullptr;
+        nIdx = oIter->second;
+    }
+    else
+    {
+        const auto oIter = oHashTable.oMapIntegerKeyToIdx.find(
+            poSrcFeat->GetFieldAsInteger64(oHashTable.iPrimaryField));
+        if (oIter == oHashTable.oMapIntegerKeyToIdx.end())
+            return nullptr;
+        nIdx = oIter->second;
+    }
+    return std::unique_ptr<OGRFeature>(oHashTable.apoFeatures[nIdx]->Clone());
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1499,6 +1644,16 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        auto &oHashTable = m_aoJoinHashTables[iJoin];
+        if (!oHashTable.bBuilt)
+            BuildJoinHashTable(iJoin);
+        if (oHashTable.bUsable)
+        {
+            apoFeatures.push_back(
+                GetJoinFeatureFromHashTable(oHashTable, poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
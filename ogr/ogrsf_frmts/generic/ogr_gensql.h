@@ -19,6 +19,9 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -73,6 +76,26 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // In-memory hash table of the features of a secondary layer, indexed by
+    // their join key, for joins whose condition is an equality between a
+    // field of the primary layer and a field of the secondary layer.
+    struct JoinHashTable
+    {
+        bool bBuilt = false;
+        bool bUsable = false;
+        bool bStringKey = false;
+        int iPrimaryField = -1;
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        std::unordered_map<GIntBig, size_t> oMapIntegerKeyToIdx{};
+        std::unordered_map<std::string, size_t> oMapStringKeyToIdx{};
+    };
+
+    std::vector<JoinHashTable> m_aoJoinHashTables{};
+
+    void BuildJoinHashTable(int iJoin);
+    std::unique_ptr<OGRFeature> GetJoinFeatureFromHashTable(
+        const JoinHashTable &oHashTable, const OGRFeature *poSrcFeat) const;
+
     bool PrepareSummary();
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
@@ -19,6 +19,10 @@
 #include "mitab/mitab_priv.h"
 #include "cpl_minixml.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 /************************************************************************/
 /*                            OGRMIAttrIndex                            */
 /*                                                                      */
@@ -48,6 +52,13 @@ class OGRMIAttrIndex : public OGRAttrIndex
     GIntBig *GetAllMatches(OGRField *psKey) override;
     GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
                            int *nLength) override;
+    GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                             const OGRField *psMax, bool bMaxIncluded,
+                             int *pnFIDCount) override;
+    GIntBig *GetPrefixMatches(const char *pszPrefix, bool bCaseInsensitive,
+                              int *pnFIDCount) override;
+    GIntBig *FindRange(const std::vector<GByte> &abyMinKey,
+                       const std::vector<GByte> &abyMaxKey, int *pnFIDCount);
 
     OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
     OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
@@ -809,6 +820,116 @@ GIntBig *OGRMIAttrIndex::GetAllMatches(OGRField *psKey)
     return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
 }
 
+/************************************************************************/
+/*                             FindRange()                              */
+/*                                                                      */
+/*      Return the FIDs whose key is between the provided keys (both    */
+/*      included, and an empty key meaning unbounded).                  */
+/************************************************************************/
+
+GIntBig *OGRMIAttrIndex::FindRange(const std::vector<GByte> &abyMinKey,
+                                   const std::vector<GByte> &abyMaxKey,
+                                   int *pnFIDCount)
+{
+    std::vector<GInt32> anRecordNos;
+    if (poINDFile->FindRange(iIndex,
+                             abyMinKey.empty() ? nullptr : abyMinKey.data(),
+                             abyMaxKey.empty() ? nullptr : abyMaxKey.data(),
+                             anRecordNos) != 0)
+    {
+        return nullptr;
+    }
+
+    GIntBig *panFIDList = static_cast<GIntBig *>(
+        VSI_MALLOC2_VERBOSE(anRecordNos.size() + 1, sizeof(GIntBig)));
+    if (panFIDList == nullptr)
+        return nullptr;
+    int nFIDCount = 0;
+    for (const GInt32 nRecordNo : anRecordNos)
+    {
+        if (nRecordNo > 0)
+            panFIDList[nFIDCount++] = nRecordNo - 1;
+    }
+    panFIDList[nFIDCount] = OGRNullFID;
+    if (pnFIDCount)
+        *pnFIDCount = nFIDCount;
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/*                                                                      */
+/*      Only supported for integer fields, as keys of floating point    */
+/*      values are not sorted in the order of values in .ind files.     */
+/*      Bounds are always included, which is fine since candidate       */
+/*      features are evaluated afterwards.                              */
+/************************************************************************/
+
+GIntBig *OGRMIAttrIndex::GetRangeMatches(const OGRField *psMin,
+                                         bool /* bMinIncluded */,
+                                         const OGRField *psMax,
+                                         bool /* bMaxIncluded */,
+                                         int *pnFIDCount)
+{
+    if (poFldDefn->GetType() != OFTInteger)
+        return nullptr;
+
+    const int nKeyLength = poINDFile->GetKeyLength(iIndex);
+    if (nKeyLength <= 0)
+        return nullptr;
+
+    std::vector<GByte> abyMinKey;
+    std::vector<GByte> abyMaxKey;
+    if (psMin)
+    {
+        const GByte *pabyKey = poINDFile->BuildKey(iIndex, psMin->Integer);
+        if (pabyKey == nullptr)
+            return nullptr;
+        abyMinKey.assign(pabyKey, pabyKey + nKeyLength);
+    }
+    if (psMax)
+    {
+        const GByte *pabyKey = poINDFile->BuildKey(iIndex, psMax->Integer);
+        if (pabyKey == nullptr)
+            return nullptr;
+        abyMaxKey.assign(pabyKey, pabyKey + nKeyLength);
+    }
+
+    return FindRange(abyMinKey, abyMaxKey, pnFIDCount);
+}
+
+/************************************************************************/
+/*                          GetPrefixMatches()                          */
+/*                                                                      */
+/*      String keys are upper-cased and padded with nul bytes, so all   */
+/*      the values starting with the prefix, whatever their case, have  */
+/*      keys between the key of the prefix and the same key padded      */
+/*      with 0xFF bytes.                                                */
+/************************************************************************/
+
+GIntBig *OGRMIAttrIndex::GetPrefixMatches(const char *pszPrefix,
+                                          bool /* bCaseInsensitive */,
+                                          int *pnFIDCount)
+{
+    if (poFldDefn->GetType() != OFTString)
+        return nullptr;
+
+    const int nKeyLength = poINDFile->GetKeyLength(iIndex);
+    const GByte *pabyKey = poINDFile->BuildKey(iIndex, pszPrefix);
+    if (nKeyLength <= 0 || pabyKey == nullptr)
+        return nullptr;
+
+    std::vector<GByte> abyMinKey(pabyKey, pabyKey + nKeyLength);
+    std::vector<GByte> abyMaxKey(abyMinKey);
+    for (size_t i = std::min(strlen(pszPrefix), abyMaxKey.size());
+         i < abyMaxKey.size(); ++i)
+    {
+        abyMaxKey[i] = 0xFF;
+    }
+
+    return FindRange(abyMinKey, abyMaxKey, pnFIDCount);
+}
+
 /************************************************************************/
 /*                               Clear()                                */
 /************************************************************************/
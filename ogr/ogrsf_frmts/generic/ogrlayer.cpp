@@ -18,9 +18,12 @@
 #include "ogr_swq.h"
 #include "ograpispy.h"
 #include "ogr_wkb.h"
+#include "ogr_profiling.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -47,6 +50,8 @@ OGRLayer::OGRLayer()
 OGRLayer::~OGRLayer()
 
 {
+    OGRProfilingStats::ForgetLayer(this);
+
     if (m_poStyleTable)
     {
         delete m_poStyleTable;
@@ -862,7 +867,58 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
         OGRAPISpy_L_GetNextFeature(hLayer);
 #endif
 
-    return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
+    OGRLayer *poLayer = OGRLayer::FromHandle(hLayer);
+    OGRProfilingTimer oTimer(poLayer, OGRProfilingStage::READ);
+    OGRFeature *poFeature = poLayer->GetNextFeature();
+    if (oTimer.IsEnabled())
+    {
+        oTimer.SetFeatureCount(poFeature ? 1 : 0);
+        oTimer.AddBytes(OGRProfilingStats::GetGeometriesWkbSize(poFeature));
+    }
+    return OGRFeature::ToHandle(poFeature);
+}
+
+/************************************************************************/
+/*                        GetNextFeatureInto()                          */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly reusing
+ an existing feature object.
+
+ This method is a variant of GetNextFeature() for sequential reading loops,
+ which avoids allocating and destroying a feature object, and its field
+ array, for each feature. If poFeature is not null and has been returned
+ by a previous call on this layer, drivers that support it will fill it with
+ the content of the next feature, after calling OGRFeature::Reset() on it.
+ Otherwise, or for drivers that do not support reuse, poFeature is replaced
+ by the result of GetNextFeature().
+
+ The caller is free to release or std::move() poFeature between calls, in
+ which case a new feature object will be allocated.
+
+ Only features matching the current attribute and spatial filters will be
+ returned.
+
+ \code{.cpp}
+ std::unique_ptr<OGRFeature> poFeature;
+ while (poLayer->GetNextFeatureInto(poFeature))
+ {
+     // Do something with poFeature
+ }
+ \endcode
+
+ @param[in,out] poFeature Feature object, possibly null, that receives the
+ next feature.
+ @return true if a feature has been read, false if no more features are
+ available. In that case, the content of poFeature is unspecified.
+ @since GDAL 3.11
+*/
+
+bool OGRLayer::GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature)
+{
+    poFeature.reset(GetNextFeature());
+    return poFeature != nullptr;
 }
 
 /************************************************************************/
@@ -957,7 +1013,10 @@ void OGRLayer::ConvertGeomsIfNecessary(OGRFeature *poFeature)
 OGRErr OGRLayer::SetFeature(OGRFeature *poFeature)
 
 {
+    OGRProfilingTimer oTimer(this, OGRProfilingStage::WRITE);
     ConvertGeomsIfNecessary(poFeature);
+    if (oTimer.IsEnabled())
+        oTimer.AddBytes(OGRProfilingStats::GetGeometriesWkbSize(poFeature));
     return ISetFeature(poFeature);
 }
 
@@ -997,7 +1056,10 @@ OGRErr OGR_L_SetFeature(OGRLayerH hLayer, OGRFeatureH hFeat)
 OGRErr OGRLayer::CreateFeature(OGRFeature *poFeature)
 
 {
+    OGRProfilingTimer oTimer(this, OGRProfilingStage::WRITE);
     ConvertGeomsIfNecessary(poFeature);
+    if (oTimer.IsEnabled())
+        oTimer.AddBytes(OGRProfilingStats::GetGeometriesWkbSize(poFeature));
     return ICreateFeature(poFeature);
 }
 
@@ -1037,7 +1099,10 @@ OGRErr OGR_L_CreateFeature(OGRLayerH hLayer, OGRFeatureH hFeat)
 OGRErr OGRLayer::UpsertFeature(OGRFeature *poFeature)
 
 {
+    OGRProfilingTimer oTimer(this, OGRProfilingStage::WRITE);
     ConvertGeomsIfNecessary(poFeature);
+    if (oTimer.IsEnabled())
+        oTimer.AddBytes(OGRProfilingStats::GetGeometriesWkbSize(poFeature));
     return IUpsertFeature(poFeature);
 }
 
@@ -1080,7 +1145,10 @@ OGRErr OGRLayer::UpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
                                bool bUpdateStyleString)
 
 {
+    OGRProfilingTimer oTimer(this, OGRProfilingStage::WRITE);
     ConvertGeomsIfNecessary(poFeature);
+    if (oTimer.IsEnabled())
+        oTimer.AddBytes(OGRProfilingStats::GetGeometriesWkbSize(poFeature));
     const int nFieldCount = GetLayerDefn()->GetFieldCount();
     for (int i = 0; i < nUpdatedFieldsCount; ++i)
     {
@@ -2261,6 +2329,8 @@ int OGRLayer::FilterGeometry(const OGRGeometry *poGeometry)
     if (m_poFilterGeom == nullptr)
         return TRUE;
 
+    OGRProfilingTimer oTimer(this, OGRProfilingStage::SPATIAL_FILTER);
+
     if (poGeometry == nullptr || poGeometry->IsEmpty())
         return FALSE;
 
@@ -3246,6 +3316,218 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+/************************************************************************/
+/*                     OGRLayerAlgebraMethodLayer                       */
+/************************************************************************/
+
+namespace
+{
+// In-memory copy of the method layer of the geoprocessing methods, with a
+// spatial index of its features. Those methods set a spatial filter on the
+// method layer for each feature of the input layer, which is very costly
+// for drivers that do not have a fast spatial filter, as this results in
+// a full scan of the method layer for each input feature.
+class OGRLayerAlgebraMethodLayer final : public OGRLayer
+{
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    std::vector<std::unique_ptr<OGRFeature>> m_apoFeatures{};
+    CPLQuadTree *m_hQuadTree = nullptr;
+    // Indices of the features matching the current spatial filter
+    std::vector<size_t> m_anCandidates{};
+    size_t m_nIdx = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerAlgebraMethodLayer)
+
+  public:
+    explicit OGRLayerAlgebraMethodLayer(OGRFeatureDefn *poFeatureDefn)
+        : m_poFeatureDefn(poFeatureDefn)
+    {
+        m_poFeatureDefn->Reference();
+        SetDescription(m_poFeatureDefn->GetName());
+    }
+
+    ~OGRLayerAlgebraMethodLayer() override;
+
+    bool Load(OGRLayer *poSrcLayer);
+
+    void ResetReading() override
+    {
+        m_nIdx = 0;
+    }
+
+    OGRFeature *GetNextFeature() override;
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+
+    GIntBig GetFeatureCount(int bForce) override
+    {
+        if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+            return static_cast<GIntBig>(m_apoFeatures.size());
+        return OGRLayer::GetFeatureCount(bForce);
+    }
+
+    int TestCapability(const char *pszCap) override
+    {
+        return EQUAL(pszCap, OLCFastSpatialFilter) ||
+               EQUAL(pszCap, OLCFastFeatureCount);
+    }
+
+    OGRErr ISetSpatialFilter(int iGeomField,
+                             const OGRGeometry *poGeom) override;
+};
+
+OGRLayerAlgebraMethodLayer::~OGRLayerAlgebraMethodLayer()
+{
+    if (m_hQuadTree)
+        CPLQuadTreeDestroy(m_hQuadTree);
+    m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                                Load()                                */
+/************************************************************************/
+
+// Load the features of poSrcLayer, honouring its current filters.
+bool OGRLayerAlgebraMethodLayer::Load(OGRLayer *poSrcLayer)
+{
+    OGREnvelope sExtent;
+    for (auto &&poFeature : poSrcLayer)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            sExtent.Merge(sEnvelope);
+        }
+        m_apoFeatures.emplace_back(poFeature.release());
+    }
+
+    if (!sExtent.IsInit())
+        sExtent.Merge(0, 0);
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sExtent.MinX;
+    sGlobalBounds.miny = sExtent.MinY;
+    sGlobalBounds.maxx = sExtent.MaxX;
+    sGlobalBounds.maxy = sExtent.MaxY;
+    m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    if (!m_hQuadTree)
+        return false;
+    for (size_t i = 0; i < m_apoFeatures.size(); ++i)
+    {
+        const OGRGeometry *poGeom = m_apoFeatures[i]->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            CPLRectObj sRect;
+            sRect.minx = sEnvelope.MinX;
+            sRect.miny = sEnvelope.MinY;
+            sRect.maxx = sEnvelope.MaxX;
+            sRect.maxy = sEnvelope.MaxY;
+            CPLQuadTreeInsertWithBounds(
+                m_hQuadTree,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sRect);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRLayerAlgebraMethodLayer::ISetSpatialFilter(int iGeomField,
+                                                     const OGRGeometry *poGeom)
+{
+    const OGRErr eErr = OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
+    m_anCandidates.clear();
+    if (eErr == OGRERR_NONE && m_poFilterGeom)
+    {
+        CPLRectObj sAoi;
+        sAoi.minx = m_sFilterEnvelope.MinX;
+        sAoi.miny = m_sFilterEnvelope.MinY;
+        sAoi.maxx = m_sFilterEnvelope.MaxX;
+        sAoi.maxy = m_sFilterEnvelope.MaxY;
+        int nCount = 0;
+        void **pahItems = CPLQuadTreeSearch(m_hQuadTree, &sAoi, &nCount);
+        m_anCandidates.reserve(nCount);
+        for (int i = 0; i < nCount; ++i)
+        {
+            m_anCandidates.push_back(
+                static_cast<size_t>(reinterpret_cast<uintptr_t>(pahItems[i])));
+        }
+        CPLFree(pahItems);
+        // Return features in the same order as the source layer
+        std::sort(m_anCandidates.begin(), m_anCandidates.end());
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRLayerAlgebraMethodLayer::GetNextFeature()
+{
+    while (true)
+    {
+        OGRFeature *poFeature = nullptr;
+        if (m_poFilterGeom)
+        {
+            if (m_nIdx >= m_anCandidates.size())
+                return nullptr;
+            poFeature = m_apoFeatures[m_anCandidates[m_nIdx]].get();
+        }
+        else
+        {
+            if (m_nIdx >= m_apoFeatures.size())
+                return nullptr;
+            poFeature = m_apoFeatures[m_nIdx].get();
+        }
+        ++m_nIdx;
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeometryRef())) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
+        {
+            return poFeature->Clone();
+        }
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         index_method_layer()                         */
+/************************************************************************/
+
+// Return an in-memory spatially indexed copy of pLayerMethod if it has no
+// fast spatial filter, or pLayerMethod itself otherwise.
+static OGRLayer *
+index_method_layer(OGRLayer *pLayerMethod, CSLConstList papszOptions,
+                   std::unique_ptr<OGRLayer> &poIndexedMethodLayer)
+{
+    if (pLayerMethod->TestCapability(OLCFastSpatialFilter) ||
+        !CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "YES")))
+    {
+        return pLayerMethod;
+    }
+    auto poLayer = std::make_unique<OGRLayerAlgebraMethodLayer>(
+        pLayerMethod->GetLayerDefn());
+    if (!poLayer->Load(pLayerMethod))
+        return pLayerMethod;
+    CPLDebug("OGR", "Using in-memory spatial index of method layer %s",
+             pLayerMethod->GetDescription());
+    poIndexedMethodLayer = std::move(poLayer);
+    return poIndexedMethodLayer.get();
+}
+
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -3300,6 +3582,11 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -3334,8 +3621,11 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
+    std::unique_ptr<OGRFieldCopyPlan> poMethodCopyPlan;
     OGREnvelope sEnvelopeMethod;
     GBool bEnvelopeSet;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
@@ -3375,6 +3665,10 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    poMethodCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnMethod, poDefnResult, mapMethod);
     bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
     if (bKeepLowerDimGeom)
     {
@@ -3387,6 +3681,9 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
+
     for (auto &&x : this)
     {
 
@@ -3529,8 +3826,8 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 }
             }
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            z->SetFieldsFrom(y.get(), mapMethod);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
+            z->SetFieldsFrom(y.get(), *poMethodCopyPlan);
             if (bPromoteToMulti)
                 z_geom.reset(promote_to_multi(z_geom.release()));
             z->SetGeometryDirectly(z_geom.release());
@@ -3622,6 +3919,11 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -3718,6 +4020,11 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -3752,9 +4059,12 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
+    std::unique_ptr<OGRFieldCopyPlan> poMethodCopyPlan;
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
@@ -3795,6 +4105,10 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    poMethodCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnMethod, poDefnResult, mapMethod);
     if (bKeepLowerDimGeom)
     {
         // require that the result layer is of geom type unknown
@@ -3806,6 +4120,9 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
+
     // add features based on input layer
     for (auto &&x : this)
     {
@@ -3919,8 +4236,8 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             else
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                z->SetFieldsFrom(x.get(), *poInputCopyPlan);
+                z->SetFieldsFrom(y.get(), *poMethodCopyPlan);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -3974,7 +4291,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         else
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
@@ -4080,7 +4397,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         else
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
+            z->SetFieldsFrom(x.get(), *poMethodCopyPlan);
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
@@ -4172,6 +4489,11 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -4255,6 +4577,11 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -4289,9 +4616,12 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
+    std::unique_ptr<OGRFieldCopyPlan> poMethodCopyPlan;
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
@@ -4328,6 +4658,13 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    poMethodCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnMethod, poDefnResult, mapMethod);
+
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
 
     // add features based on input layer
     for (auto &&x : this)
@@ -4409,7 +4746,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         if (geom && !geom->IsEmpty())
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
@@ -4508,7 +4845,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         if (geom && !geom->IsEmpty())
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
+            z->SetFieldsFrom(x.get(), *poMethodCopyPlan);
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
@@ -4590,6 +4927,11 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -4685,6 +5027,11 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -4719,8 +5066,11 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
+    std::unique_ptr<OGRFieldCopyPlan> poMethodCopyPlan;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
     double progress_ticker = 0;
@@ -4766,6 +5116,13 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    poMethodCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnMethod, poDefnResult, mapMethod);
+
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
 
     // split the features in input layer to the result layer
     for (auto &&x : this)
@@ -4878,8 +5235,8 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             else
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                z->SetFieldsFrom(x.get(), *poInputCopyPlan);
+                z->SetFieldsFrom(y.get(), *poMethodCopyPlan);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -4932,7 +5289,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         else
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
@@ -5019,6 +5376,11 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -5103,6 +5465,11 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -5137,8 +5504,11 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
+    std::unique_ptr<OGRFieldCopyPlan> poMethodCopyPlan;
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
@@ -5172,6 +5542,13 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    poMethodCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnMethod, poDefnResult, mapMethod);
+
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
 
     // add clipped features from the input layer
     for (auto &&x : this)
@@ -5254,7 +5631,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         else
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
@@ -5299,7 +5676,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             continue;
         OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
         if (mapMethod)
-            z->SetFieldsFrom(y.get(), mapMethod);
+            z->SetFieldsFrom(y.get(), *poMethodCopyPlan);
         z->SetGeometryDirectly(y_geom);
         ret = pLayerResult->CreateFeature(z.get());
         if (ret != OGRERR_NONE)
@@ -5375,6 +5752,11 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -5452,6 +5834,11 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -5485,7 +5872,9 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     int *mapInput = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
     double progress_ticker = 0;
@@ -5514,6 +5903,11 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
+
     for (auto &&x : this)
     {
 
@@ -5612,7 +6006,7 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             else if (!poIntersection->IsEmpty())
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
+                z->SetFieldsFrom(x.get(), *poInputCopyPlan);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -5684,6 +6078,11 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -5761,6 +6160,11 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -5794,7 +6198,9 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    std::unique_ptr<OGRLayer> poIndexedMethodLayer;
     int *mapInput = nullptr;
+    std::unique_ptr<OGRFieldCopyPlan> poInputCopyPlan;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
     double progress_ticker = 0;
@@ -5823,6 +6229,11 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    poInputCopyPlan = std::make_unique<OGRFieldCopyPlan>(
+        poDefnInput, poDefnResult, mapInput);
+
+    pLayerMethod =
+        index_method_layer(pLayerMethod, papszOptions, poIndexedMethodLayer);
 
     for (auto &&x : this)
     {
@@ -5902,7 +6313,7 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         if (!geom->IsEmpty())
         {
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
+            z->SetFieldsFrom(x.get(), *poInputCopyPlan);
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
@@ -5972,6 +6383,11 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO (GDAL >= 3.11). Set to NO to not
+ *     build an in-memory spatial index of the method layer when it does
+ *     not support fast spatial filtering. Building this index requires
+ *     loading all features of the method layer in memory.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -19,8 +19,10 @@
 #include "ogr_swq.h"
 #include "ogr_wkb.h"
 #include "ogr_p.h"
+#include "ogr_profiling.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_json.h"
 #include "cpl_time.h"
@@ -28,9 +30,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
 #include <utility>
 #include <set>
+#include <thread>
 
 constexpr const char *MD_GDAL_OGR_TYPE = "GDAL:OGR:type";
 constexpr const char *MD_GDAL_OGR_ALTERNATIVE_NAME =
@@ -363,6 +368,403 @@ static void AddDictToSchema(struct ArrowSchema *psChild,
         psChildDict->flags = ARROW_FLAG_NULLABLE;
 }
 
+/************************************************************************/
+/*                 SetGeometryColumnExtensionMetadata()                 */
+/************************************************************************/
+
+/** Set the ARROW:extension:name (and ARROW:extension:metadata for GeoArrow
+ * extensions) metadata of a geometry column.
+ */
+static void SetGeometryColumnExtensionMetadata(
+    struct ArrowSchema *psSchema, const OGRGeomFieldDefn *poFieldDefn,
+    const char *pszExtensionName)
+{
+    std::string osExtensionMetadata;
+    if (STARTS_WITH(pszExtensionName, "geoarrow."))
+    {
+        const auto poSRS = poFieldDefn->GetSpatialRef();
+        if (poSRS)
+        {
+            char *pszPROJJSON = nullptr;
+            poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
+            if (pszPROJJSON)
+            {
+                osExtensionMetadata = "{\"crs\":";
+                osExtensionMetadata += pszPROJJSON;
+                osExtensionMetadata += '}';
+                CPLFree(pszPROJJSON);
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Cannot export CRS of geometry field %s to PROJJSON",
+                         poFieldDefn->GetNameRef());
+            }
+        }
+    }
+    size_t nLen = sizeof(int32_t) + sizeof(int32_t) +
+                  strlen(ARROW_EXTENSION_NAME_KEY) + sizeof(int32_t) +
+                  strlen(pszExtensionName);
+    if (!osExtensionMetadata.empty())
+    {
+        nLen += sizeof(int32_t) + strlen(ARROW_EXTENSION_METADATA_KEY) +
+                sizeof(int32_t) + osExtensionMetadata.size();
+    }
+    char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
+    psSchema->metadata = pszMetadata;
+    size_t offsetMD = 0;
+    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
+        osExtensionMetadata.empty() ? 1 : 2;
+    offsetMD += sizeof(int32_t);
+    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
+        static_cast<int32_t>(strlen(ARROW_EXTENSION_NAME_KEY));
+    offsetMD += sizeof(int32_t);
+    memcpy(pszMetadata + offsetMD, ARROW_EXTENSION_NAME_KEY,
+           strlen(ARROW_EXTENSION_NAME_KEY));
+    offsetMD += static_cast<int>(strlen(ARROW_EXTENSION_NAME_KEY));
+    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
+        static_cast<int32_t>(strlen(pszExtensionName));
+    offsetMD += sizeof(int32_t);
+    memcpy(pszMetadata + offsetMD, pszExtensionName, strlen(pszExtensionName));
+    offsetMD += strlen(pszExtensionName);
+    if (!osExtensionMetadata.empty())
+    {
+        *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
+            static_cast<int32_t>(strlen(ARROW_EXTENSION_METADATA_KEY));
+        offsetMD += sizeof(int32_t);
+        memcpy(pszMetadata + offsetMD, ARROW_EXTENSION_METADATA_KEY,
+               strlen(ARROW_EXTENSION_METADATA_KEY));
+        offsetMD += static_cast<int>(strlen(ARROW_EXTENSION_METADATA_KEY));
+        *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
+            static_cast<int32_t>(osExtensionMetadata.size());
+        offsetMD += sizeof(int32_t);
+        memcpy(pszMetadata + offsetMD, osExtensionMetadata.c_str(),
+               osExtensionMetadata.size());
+        offsetMD += osExtensionMetadata.size();
+    }
+    CPLAssert(offsetMD == nLen);
+    CPL_IGNORE_RET_VAL(offsetMD);
+}
+
+/************************************************************************/
+/*                       GetGeoArrowEncoding()                          */
+/************************************************************************/
+
+namespace
+{
+enum class GeoArrowEncoding
+{
+    WKB,
+    SEPARATED,
+    INTERLEAVED,
+};
+}  // namespace
+
+static GeoArrowEncoding GetGeoArrowEncoding(const CPLStringList &aosOptions,
+                                            bool bEmitWarning = true)
+{
+    const char *pszEncoding =
+        aosOptions.FetchNameValue(GAS_OPT_GEOMETRY_ENCODING);
+    if (pszEncoding == nullptr || EQUAL(pszEncoding, "WKB"))
+        return GeoArrowEncoding::WKB;
+    if (EQUAL(pszEncoding, "GEOARROW"))
+        return GeoArrowEncoding::SEPARATED;
+    if (EQUAL(pszEncoding, "GEOARROW_INTERLEAVED"))
+        return GeoArrowEncoding::INTERLEAVED;
+    if (bEmitWarning)
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Unsupported GEOMETRY_ENCODING value: %s", pszEncoding);
+    }
+    return GeoArrowEncoding::WKB;
+}
+
+/************************************************************************/
+/*                  GetGeoArrowNativeGeometryType()                     */
+/************************************************************************/
+
+/** Return the (flattened) geometry type of a geometry field, if it can be
+ * encoded with a GeoArrow native encoding, or wkbUnknown otherwise.
+ */
+static OGRwkbGeometryType
+GetGeoArrowNativeGeometryType(const OGRGeomFieldDefn *poFieldDefn,
+                              GeoArrowEncoding eEncoding)
+{
+    if (eEncoding == GeoArrowEncoding::WKB)
+        return wkbUnknown;
+    const auto eFlatType = wkbFlatten(poFieldDefn->GetType());
+    switch (eFlatType)
+    {
+        case wkbPoint:
+        case wkbLineString:
+        case wkbPolygon:
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+            return eFlatType;
+        default:
+            break;
+    }
+    return wkbUnknown;
+}
+
+/************************************************************************/
+/*                    GetGeoArrowExtensionName()                        */
+/************************************************************************/
+
+static const char *GetGeoArrowExtensionName(OGRwkbGeometryType eFlatType)
+{
+    switch (eFlatType)
+    {
+        case wkbPoint:
+            return EXTENSION_NAME_GEOARROW_POINT;
+        case wkbLineString:
+            return EXTENSION_NAME_GEOARROW_LINESTRING;
+        case wkbPolygon:
+            return EXTENSION_NAME_GEOARROW_POLYGON;
+        case wkbMultiPoint:
+            return EXTENSION_NAME_GEOARROW_MULTIPOINT;
+        case wkbMultiLineString:
+            return EXTENSION_NAME_GEOARROW_MULTILINESTRING;
+        case wkbMultiPolygon:
+            return EXTENSION_NAME_GEOARROW_MULTIPOLYGON;
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                 GetGeoArrowGeometryTypeFromSchema()                  */
+/************************************************************************/
+
+/** Return the (flattened) geometry type of a GeoArrow native encoded column
+ * from its ARROW:extension:name metadata, or wkbUnknown if it is not such a
+ * column.
+ */
+static OGRwkbGeometryType
+GetGeoArrowGeometryTypeFromSchema(const struct ArrowSchema *schema)
+{
+    if (!schema->metadata)
+        return wkbUnknown;
+    const auto oMetadata = OGRParseArrowMetadata(schema->metadata);
+    const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+    if (oIter == oMetadata.end())
+        return wkbUnknown;
+    for (const auto eFlatType : {wkbPoint, wkbLineString, wkbPolygon,
+                                 wkbMultiPoint, wkbMultiLineString,
+                                 wkbMultiPolygon})
+    {
+        if (oIter->second == GetGeoArrowExtensionName(eFlatType))
+            return eFlatType;
+    }
+    return wkbUnknown;
+}
+
+/************************************************************************/
+/*                    GetGeoArrowNestingLevels()                        */
+/************************************************************************/
+
+/** Return the number of list levels above the coordinates of a GeoArrow
+ * native encoded geometry of the specified type.
+ */
+static int GetGeoArrowNestingLevels(OGRwkbGeometryType eFlatType)
+{
+    switch (eFlatType)
+    {
+        case wkbLineString:
+        case wkbMultiPoint:
+            return 1;
+        case wkbPolygon:
+        case wkbMultiLineString:
+            return 2;
+        case wkbMultiPolygon:
+            return 3;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                   ParseGeoArrowNativeSchema()                        */
+/************************************************************************/
+
+/** Check that schema is a valid GeoArrow native encoding of a geometry of
+ * type eFlatType, with int32 list offsets, and return the layout of its
+ * coordinates.
+ */
+static bool ParseGeoArrowNativeSchema(const struct ArrowSchema *schema,
+                                      OGRwkbGeometryType eFlatType,
+                                      bool &bInterleaved, bool &bHasZ,
+                                      bool &bHasM)
+{
+    const int nLevels = GetGeoArrowNestingLevels(eFlatType);
+    for (int iLevel = 0; iLevel < nLevels; ++iLevel)
+    {
+        if (!IsList(schema->format) || schema->n_children != 1)
+            return false;
+        schema = schema->children[0];
+    }
+
+    const auto CheckDimNames = [&bHasZ, &bHasM](const char *pszDims)
+    {
+        bHasZ = EQUAL(pszDims, "xyz") || EQUAL(pszDims, "xyzm");
+        bHasM = EQUAL(pszDims, "xym") || EQUAL(pszDims, "xyzm");
+        return bHasZ || bHasM || EQUAL(pszDims, "xy");
+    };
+
+    if (IsStructure(schema->format))
+    {
+        bInterleaved = false;
+        if (schema->n_children < 2 || schema->n_children > 4)
+            return false;
+        std::string osDims;
+        for (int64_t i = 0; i < schema->n_children; ++i)
+        {
+            const auto psChild = schema->children[i];
+            if (!IsFloat64(psChild->format) || !psChild->name ||
+                strlen(psChild->name) != 1)
+                return false;
+            osDims += psChild->name;
+        }
+        return CheckDimNames(osDims.c_str());
+    }
+    else if (IsFixedSizeList(schema->format))
+    {
+        bInterleaved = true;
+        if (schema->n_children != 1)
+            return false;
+        const auto psChild = schema->children[0];
+        if (!IsFloat64(psChild->format) || !psChild->name ||
+            !CheckDimNames(psChild->name))
+            return false;
+        const int nDims = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+        return atoi(schema->format + strlen("+w:")) == nDims;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*               CreateSchemaForGeoArrowGeometryColumn()                */
+/************************************************************************/
+
+static struct ArrowSchema *CreateGeoArrowChildSchema(const char *pszName,
+                                                     const char *pszFormat,
+                                                     int nChildren)
+{
+    auto psSchema = static_cast<struct ArrowSchema *>(
+        CPLCalloc(1, sizeof(struct ArrowSchema)));
+    psSchema->release = OGRLayerPartialReleaseSchema;
+    psSchema->name = CPLStrdup(pszName);
+    psSchema->format = pszFormat;
+    psSchema->n_children = nChildren;
+    if (nChildren)
+    {
+        psSchema->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowSchema *)));
+    }
+    return psSchema;
+}
+
+/** Return a ArrowSchema* corresponding to the GeoArrow native encoding of
+ * a geometry column of type eFlatType, which must be one of the types
+ * accepted by GetGeoArrowNativeGeometryType().
+ */
+static struct ArrowSchema *
+CreateSchemaForGeoArrowGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
+                                      OGRwkbGeometryType eFlatType,
+                                      GeoArrowEncoding eEncoding)
+{
+    const bool bHasZ = CPL_TO_BOOL(wkbHasZ(poFieldDefn->GetType()));
+    const bool bHasM = CPL_TO_BOOL(wkbHasM(poFieldDefn->GetType()));
+    const int nDims = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    const char *pszDims = bHasZ && bHasM ? "xyzm"
+                          : bHasZ        ? "xyz"
+                          : bHasM        ? "xym"
+                                         : "xy";
+
+    const char *pszGeomFieldName = poFieldDefn->GetNameRef();
+    if (pszGeomFieldName[0] == '\0')
+        pszGeomFieldName = OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Names of the successive list levels, from the top one
+    const char *apszLevelNames[3] = {nullptr, nullptr, nullptr};
+    switch (eFlatType)
+    {
+        case wkbLineString:
+            apszLevelNames[0] = "vertices";
+            break;
+        case wkbPolygon:
+            apszLevelNames[0] = "rings";
+            apszLevelNames[1] = "vertices";
+            break;
+        case wkbMultiPoint:
+            apszLevelNames[0] = "points";
+            break;
+        case wkbMultiLineString:
+            apszLevelNames[0] = "linestrings";
+            apszLevelNames[1] = "vertices";
+            break;
+        case wkbMultiPolygon:
+            apszLevelNames[0] = "polygons";
+            apszLevelNames[1] = "rings";
+            apszLevelNames[2] = "vertices";
+            break;
+        default:
+            break;
+    }
+    const int nLevels = GetGeoArrowNestingLevels(eFlatType);
+
+    // Create the top-level schema, and the intermediate list levels.
+    // apszLevelNames[i] is the name of the child of level i.
+    struct ArrowSchema *psTopSchema = nullptr;
+    struct ArrowSchema *psParent = nullptr;
+    for (int i = 0; i < nLevels; ++i)
+    {
+        auto psSchema = CreateGeoArrowChildSchema(
+            i == 0 ? pszGeomFieldName : apszLevelNames[i - 1], "+l", 1);
+        if (psParent)
+            psParent->children[0] = psSchema;
+        else
+            psTopSchema = psSchema;
+        psParent = psSchema;
+    }
+
+    // Create the coordinates schema
+    const char *pszCoordsName =
+        nLevels == 0 ? pszGeomFieldName : apszLevelNames[nLevels - 1];
+    struct ArrowSchema *psCoordsSchema;
+    if (eEncoding == GeoArrowEncoding::INTERLEAVED)
+    {
+        static const char *const apszFormats[] = {"+w:2", "+w:3", "+w:4"};
+        psCoordsSchema = CreateGeoArrowChildSchema(
+            pszCoordsName, apszFormats[nDims - 2], 1);
+        psCoordsSchema->children[0] =
+            CreateGeoArrowChildSchema(pszDims, "g", 0);
+    }
+    else
+    {
+        psCoordsSchema = CreateGeoArrowChildSchema(pszCoordsName, "+s", nDims);
+        for (int i = 0; i < nDims; ++i)
+        {
+            const char szName[] = {pszDims[i], 0};
+            psCoordsSchema->children[i] =
+                CreateGeoArrowChildSchema(szName, "g", 0);
+        }
+    }
+    if (psParent)
+        psParent->children[0] = psCoordsSchema;
+    else
+        psTopSchema = psCoordsSchema;
+
+    if (poFieldDefn->IsNullable())
+        psTopSchema->flags = ARROW_FLAG_NULLABLE;
+    SetGeometryColumnExtensionMetadata(psTopSchema, poFieldDefn,
+                                       GetGeoArrowExtensionName(eFlatType));
+    return psTopSchema;
+}
+
 /************************************************************************/
 /*                     DefaultGetArrowSchema()                          */
 /************************************************************************/
@@ -691,6 +1093,8 @@ int OGRLayer::GetArrowSchema(struct ArrowArrayStream *,
                      "Unsupported GEOMETRY_METADATA_ENCODING value: %s",
                      pszGeometryMetadataEncoding);
     }
+    const auto eGeoArrowEncoding =
+        GetGeoArrowEncoding(m_aosArrowArrayStreamOptions);
     for (int i = 0; i < nGeomFieldCount; ++i)
     {
         const auto poFieldDefn = poLayerDefn->GetGeomFieldDefn(i);
@@ -699,8 +1103,20 @@ int OGRLayer::GetArrowSchema(struct ArrowArrayStream *,
             continue;
         }
 
-        out_schema->children[iSchemaChild] = CreateSchemaForWKBGeometryColumn(
-            poFieldDefn, "z", pszExtensionName);
+        const auto eGeoArrowType =
+            GetGeoArrowNativeGeometryType(poFieldDefn, eGeoArrowEncoding);
+        if (eGeoArrowType != wkbUnknown)
+        {
+            out_schema->children[iSchemaChild] =
+                CreateSchemaForGeoArrowGeometryColumn(
+                    poFieldDefn, eGeoArrowType, eGeoArrowEncoding);
+        }
+        else
+        {
+            out_schema->children[iSchemaChild] =
+                CreateSchemaForWKBGeometryColumn(poFieldDefn, "z",
+                                                 pszExtensionName);
+        }
 
         ++iSchemaChild;
     }
@@ -744,71 +1160,8 @@ OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
     if (poFieldDefn->IsNullable())
         psSchema->flags = ARROW_FLAG_NULLABLE;
     psSchema->format = strcmp(pszArrowFormat, "z") == 0 ? "z" : "Z";
-    std::string osExtensionMetadata;
-    if (EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
-    {
-        const auto poSRS = poFieldDefn->GetSpatialRef();
-        if (poSRS)
-        {
-            char *pszPROJJSON = nullptr;
-            poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
-            if (pszPROJJSON)
-            {
-                osExtensionMetadata = "{\"crs\":";
-                osExtensionMetadata += pszPROJJSON;
-                osExtensionMetadata += '}';
-                CPLFree(pszPROJJSON);
-            }
-            else
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Cannot export CRS of geometry field %s to PROJJSON",
-                         poFieldDefn->GetNameRef());
-            }
-        }
-    }
-    size_t nLen = sizeof(int32_t) + sizeof(int32_t) +
-                  strlen(ARROW_EXTENSION_NAME_KEY) + sizeof(int32_t) +
-                  strlen(pszExtensionName);
-    if (!osExtensionMetadata.empty())
-    {
-        nLen += sizeof(int32_t) + strlen(ARROW_EXTENSION_METADATA_KEY) +
-                sizeof(int32_t) + osExtensionMetadata.size();
-    }
-    char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
-    psSchema->metadata = pszMetadata;
-    size_t offsetMD = 0;
-    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
-        osExtensionMetadata.empty() ? 1 : 2;
-    offsetMD += sizeof(int32_t);
-    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
-        static_cast<int32_t>(strlen(ARROW_EXTENSION_NAME_KEY));
-    offsetMD += sizeof(int32_t);
-    memcpy(pszMetadata + offsetMD, ARROW_EXTENSION_NAME_KEY,
-           strlen(ARROW_EXTENSION_NAME_KEY));
-    offsetMD += static_cast<int>(strlen(ARROW_EXTENSION_NAME_KEY));
-    *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
-        static_cast<int32_t>(strlen(pszExtensionName));
-    offsetMD += sizeof(int32_t);
-    memcpy(pszMetadata + offsetMD, pszExtensionName, strlen(pszExtensionName));
-    offsetMD += strlen(pszExtensionName);
-    if (!osExtensionMetadata.empty())
-    {
-        *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
-            static_cast<int32_t>(strlen(ARROW_EXTENSION_METADATA_KEY));
-        offsetMD += sizeof(int32_t);
-        memcpy(pszMetadata + offsetMD, ARROW_EXTENSION_METADATA_KEY,
-               strlen(ARROW_EXTENSION_METADATA_KEY));
-        offsetMD += static_cast<int>(strlen(ARROW_EXTENSION_METADATA_KEY));
-        *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
-            static_cast<int32_t>(osExtensionMetadata.size());
-        offsetMD += sizeof(int32_t);
-        memcpy(pszMetadata + offsetMD, osExtensionMetadata.c_str(),
-               osExtensionMetadata.size());
-        offsetMD += osExtensionMetadata.size();
-    }
-    CPLAssert(offsetMD == nLen);
-    CPL_IGNORE_RET_VAL(offsetMD);
+    SetGeometryColumnExtensionMetadata(psSchema, poFieldDefn,
+                                       pszExtensionName);
     return psSchema;
 }
 
@@ -1638,26 +1991,281 @@ FillWKBGeometryArray(struct ArrowArray *psChild,
         return 0;
     psChild->buffers[2] = pabyValues;
 
-    nOffset = 0;
-    for (size_t iFeat = 0; iFeat < nFeatCount; ++iFeat)
+    nOffset = 0;
+    for (size_t iFeat = 0; iFeat < nFeatCount; ++iFeat)
+    {
+        const size_t nLen =
+            static_cast<size_t>(panOffsets[iFeat + 1] - panOffsets[iFeat]);
+        if (nLen)
+        {
+            const auto poGeom = apoFeatures[iFeat]->GetGeomFieldRef(i);
+            poGeom->exportToWkb(wkbNDR, pabyValues + nOffset, wkbVariantIso);
+            nOffset += nLen;
+        }
+        else if (!bIsNullable && poEmptyGeom)
+        {
+            poEmptyGeom->exportToWkb(wkbNDR, pabyValues + nOffset,
+                                     wkbVariantIso);
+            nOffset += nLen;
+        }
+    }
+
+    return nFeatCount;
+}
+
+/************************************************************************/
+/*                    FillGeoArrowGeometryArray()                       */
+/************************************************************************/
+
+static struct ArrowArray *CreateGeoArrowChildArray(int nBuffers,
+                                                   int nChildren)
+{
+    auto psArray = static_cast<struct ArrowArray *>(
+        CPLCalloc(1, sizeof(struct ArrowArray)));
+    psArray->release = OGRLayerDefaultReleaseArray;
+    psArray->n_buffers = nBuffers;
+    psArray->buffers =
+        static_cast<const void **>(CPLCalloc(nBuffers, sizeof(void *)));
+    psArray->n_children = nChildren;
+    if (nChildren)
+    {
+        psArray->children = static_cast<struct ArrowArray **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowArray *)));
+    }
+    return psArray;
+}
+
+template <class T> static T *DupToAlignedBuffer(const std::vector<T> &aValues)
+{
+    // + 1 to avoid a zero-size allocation
+    T *pBuffer = static_cast<T *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(T) * (aValues.size() + 1)));
+    if (pBuffer && !aValues.empty())
+        memcpy(pBuffer, aValues.data(), sizeof(T) * aValues.size());
+    return pBuffer;
+}
+
+/** Fill psChild with the GeoArrow native encoding of the geometries of the
+ * first nFeatureCount features, for a geometry field of type eFlatType.
+ */
+static bool
+FillGeoArrowGeometryArray(struct ArrowArray *psChild,
+                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
+                          const size_t nFeatureCount,
+                          const OGRGeomFieldDefn *poFieldDefn, const int i,
+                          OGRwkbGeometryType eFlatType,
+                          GeoArrowEncoding eEncoding)
+{
+    const bool bHasZ = CPL_TO_BOOL(wkbHasZ(poFieldDefn->GetType()));
+    const bool bHasM = CPL_TO_BOOL(wkbHasM(poFieldDefn->GetType()));
+    const int nDims = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    const int nLevels = GetGeoArrowNestingLevels(eFlatType);
+    const bool bInterleaved = eEncoding == GeoArrowEncoding::INTERLEAVED;
+    constexpr double dfNaN = std::numeric_limits<double>::quiet_NaN();
+
+    // Coordinates, either interleaved in a single vector, or one vector
+    // per dimension.
+    std::vector<double> adfCoords[4];
+    size_t nCoords = 0;
+    // Offsets of the list levels, from the top one
+    std::vector<int32_t> anOffsets[3];
+    uint8_t *pabyValidity = nullptr;
+
+    psChild->n_buffers = nLevels == 0 ? 1 : 2;
+    psChild->buffers = static_cast<const void **>(
+        CPLCalloc(static_cast<size_t>(psChild->n_buffers), sizeof(void *)));
+    psChild->n_children = (nLevels == 0 && !bInterleaved) ? nDims : 1;
+    psChild->children = static_cast<struct ArrowArray **>(CPLCalloc(
+        static_cast<size_t>(psChild->n_children), sizeof(struct ArrowArray *)));
+
+    try
+    {
+        for (int iLevel = 0; iLevel < nLevels; ++iLevel)
+            anOffsets[iLevel].push_back(0);
+
+        const auto AddXYZM = [&](double dfX, double dfY, double dfZ, double dfM)
+        {
+            const double adfXYZM[] = {dfX, dfY, dfZ, dfM};
+            const int anIdx[] = {0, 1, bHasZ ? 2 : 3, 3};
+            for (int iDim = 0; iDim < nDims; ++iDim)
+            {
+                adfCoords[bInterleaved ? 0 : iDim].push_back(
+                    adfXYZM[anIdx[iDim]]);
+            }
+            ++nCoords;
+        };
+
+        const auto AddPoint = [&](const OGRPoint *poPoint)
+        {
+            if (poPoint->IsEmpty())
+                AddXYZM(dfNaN, dfNaN, dfNaN, dfNaN);
+            else
+                AddXYZM(poPoint->getX(), poPoint->getY(), poPoint->getZ(),
+                        poPoint->getM());
+        };
+
+        const auto AddCurve = [&](const OGRSimpleCurve *poCurve)
+        {
+            const int nPoints = poCurve->getNumPoints();
+            for (int iPt = 0; iPt < nPoints; ++iPt)
+            {
+                AddXYZM(poCurve->getX(iPt), poCurve->getY(iPt),
+                        poCurve->getZ(iPt), poCurve->getM(iPt));
+            }
+        };
+
+        // Add the rings of a polygon, whose offsets are at level iLevel
+        const auto AddPolygon = [&](const OGRPolygon *poPoly, int iLevel)
+        {
+            for (const auto *poRing : *poPoly)
+            {
+                AddCurve(poRing);
+                anOffsets[iLevel].push_back(static_cast<int32_t>(nCoords));
+            }
+        };
+
+        for (size_t iFeat = 0; iFeat < nFeatureCount; ++iFeat)
+        {
+            const OGRGeometry *poGeom = apoFeatures[iFeat]->GetGeomFieldRef(i);
+            std::unique_ptr<OGRGeometry> poPromotedGeom;
+            if (poGeom && wkbFlatten(poGeom->getGeometryType()) != eFlatType)
+            {
+                if (OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection) &&
+                    OGR_GT_GetCollection(wkbFlatten(
+                        poGeom->getGeometryType())) == eFlatType)
+                {
+                    poPromotedGeom.reset(OGRGeometryFactory::forceTo(
+                        poGeom->clone(), eFlatType));
+                    poGeom = poPromotedGeom.get();
+                }
+                else
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Geometry of type %s found, whereas %s is "
+                             "expected. Returning null geometry",
+                             OGRGeometryTypeToName(poGeom->getGeometryType()),
+                             OGRGeometryTypeToName(eFlatType));
+                    poGeom = nullptr;
+                }
+            }
+
+            if (poGeom == nullptr)
+            {
+                ++psChild->null_count;
+                if (pabyValidity == nullptr)
+                {
+                    pabyValidity = AllocValidityBitmap(nFeatureCount);
+                    psChild->buffers[0] = pabyValidity;
+                    if (pabyValidity == nullptr)
+                        return false;
+                }
+                UnsetBit(pabyValidity, iFeat);
+                if (eFlatType == wkbPoint)
+                    AddXYZM(dfNaN, dfNaN, dfNaN, dfNaN);
+            }
+            else
+            {
+                switch (eFlatType)
+                {
+                    case wkbPoint:
+                        AddPoint(poGeom->toPoint());
+                        break;
+                    case wkbLineString:
+                        AddCurve(poGeom->toLineString());
+                        break;
+                    case wkbPolygon:
+                        AddPolygon(poGeom->toPolygon(), 1);
+                        break;
+                    case wkbMultiPoint:
+                        for (const auto *poPoint : *(poGeom->toMultiPoint()))
+                            AddPoint(poPoint);
+                        break;
+                    case wkbMultiLineString:
+                        for (const auto *poLS : *(poGeom->toMultiLineString()))
+                        {
+                            AddCurve(poLS);
+                            anOffsets[1].push_back(
+                                static_cast<int32_t>(nCoords));
+                        }
+                        break;
+                    case wkbMultiPolygon:
+                        for (const auto *poPoly : *(poGeom->toMultiPolygon()))
+                        {
+                            AddPolygon(poPoly, 2);
+                            anOffsets[1].push_back(
+                                static_cast<int32_t>(anOffsets[2].size() - 1));
+                        }
+                        break;
+                    default:
+                        CPLAssert(false);
+                        break;
+                }
+            }
+
+            // Close the top-level list (and the intermediate one for
+            // polygons)
+            if (nLevels == 1)
+            {
+                anOffsets[0].push_back(static_cast<int32_t>(nCoords));
+            }
+            else if (nLevels >= 2)
+            {
+                anOffsets[0].push_back(
+                    static_cast<int32_t>(anOffsets[1].size() - 1));
+            }
+
+            if (nCoords > static_cast<size_t>(INT32_MAX) / 4)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too many coordinates in batch");
+                return false;
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in FillGeoArrowGeometryArray()");
+        return false;
+    }
+
+    // Build the list levels, from the top one
+    struct ArrowArray *psParent = psChild;
+    for (int iLevel = 0; iLevel < nLevels; ++iLevel)
     {
-        const size_t nLen =
-            static_cast<size_t>(panOffsets[iFeat + 1] - panOffsets[iFeat]);
-        if (nLen)
-        {
-            const auto poGeom = apoFeatures[iFeat]->GetGeomFieldRef(i);
-            poGeom->exportToWkb(wkbNDR, pabyValues + nOffset, wkbVariantIso);
-            nOffset += nLen;
-        }
-        else if (!bIsNullable && poEmptyGeom)
+        if (iLevel > 0)
         {
-            poEmptyGeom->exportToWkb(wkbNDR, pabyValues + nOffset,
-                                     wkbVariantIso);
-            nOffset += nLen;
+            psParent->children[0] = CreateGeoArrowChildArray(2, 1);
+            psParent = psParent->children[0];
         }
+        psParent->length = static_cast<int64_t>(anOffsets[iLevel].size()) - 1;
+        auto panOffsets = DupToAlignedBuffer(anOffsets[iLevel]);
+        psParent->buffers[1] = panOffsets;
+        if (!panOffsets)
+            return false;
     }
 
-    return nFeatCount;
+    // Build the coordinates array
+    struct ArrowArray *psCoords = psChild;
+    if (nLevels > 0)
+    {
+        psParent->children[0] =
+            CreateGeoArrowChildArray(1, bInterleaved ? 1 : nDims);
+        psCoords = psParent->children[0];
+    }
+    psCoords->length = static_cast<int64_t>(nCoords);
+    for (int iDim = 0; iDim < (bInterleaved ? 1 : nDims); ++iDim)
+    {
+        auto psValues = CreateGeoArrowChildArray(2, 0);
+        psCoords->children[iDim] = psValues;
+        psValues->length = static_cast<int64_t>(adfCoords[iDim].size());
+        auto padfValues = DupToAlignedBuffer(adfCoords[iDim]);
+        psValues->buffers[1] = padfValues;
+        if (!padfValues)
+            return false;
+    }
+
+    return true;
 }
 
 /************************************************************************/
@@ -1921,6 +2529,179 @@ FillDateTimeArrayAsString(struct ArrowArray *psChild,
     return nFeatCount;
 }
 
+/************************************************************************/
+/*                   OGRArrowArrayStreamPrefetcher                      */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+// Set in the thread of OGRArrowArrayStreamPrefetcher, so that
+// OGRLayer::GetNextArrowArray() builds the batch itself instead of
+// dispatching to the prefetcher.
+static thread_local bool tlbInArrowArrayStreamPrefetcher = false;
+
+/** Background thread that builds the next batches of the generic
+ * OGRLayer::GetNextArrowArray() implementation, while the consumer processes
+ * the current one. Used when the PREFETCH_BATCHES option is set.
+ *
+ * A single thread is used, given that OGRLayer::GetNextFeature() and
+ * GetFeature() cannot be called concurrently on the same layer.
+ */
+struct OGRArrowArrayStreamPrefetcher
+{
+    struct Batch
+    {
+        struct ArrowArray sArray
+        {
+        };
+
+        int nRet = 0;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    OGRArrowArrayStreamPrefetcher(
+        OGRLayer::ArrowArrayStreamPrivateData *poShared, size_t nMaxQueueSize)
+        : m_poShared(poShared), m_nMaxQueueSize(nMaxQueueSize)
+    {
+    }
+
+    ~OGRArrowArrayStreamPrefetcher()
+    {
+        Stop();
+    }
+
+    bool Start()
+    {
+        try
+        {
+            m_oThread = std::thread([this]() { Run(); });
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot start worker thread: %s", e.what());
+            return false;
+        }
+        return true;
+    }
+
+    int GetNext(struct ArrowArray *out_array)
+    {
+        Batch oBatch;
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock,
+                       [this]() { return !m_aoQueue.empty() || m_bFinished; });
+            if (m_aoQueue.empty())
+            {
+                memset(out_array, 0, sizeof(*out_array));
+                return 0;
+            }
+            oBatch = std::move(m_aoQueue.front());
+            m_aoQueue.pop_front();
+        }
+        // Wake up the worker thread, now that there is room in the queue
+        m_oCV.notify_all();
+
+        for (const auto &sError : oBatch.aoErrors)
+            CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+        *out_array = oBatch.sArray;
+        return oBatch.nRet;
+    }
+
+  private:
+    OGRLayer::ArrowArrayStreamPrivateData *const m_poShared;
+    const size_t m_nMaxQueueSize;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<Batch> m_aoQueue{};
+    bool m_bStop = false;
+    bool m_bFinished = false;
+    std::thread m_oThread{};
+
+    OGRArrowArrayStreamPrefetcher(const OGRArrowArrayStreamPrefetcher &) =
+        delete;
+    OGRArrowArrayStreamPrefetcher &
+    operator=(const OGRArrowArrayStreamPrefetcher &) = delete;
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_bStop = true;
+        }
+        m_oCV.notify_all();
+        if (m_oThread.joinable())
+            m_oThread.join();
+        for (auto &oBatch : m_aoQueue)
+        {
+            if (oBatch.sArray.release)
+                oBatch.sArray.release(&oBatch.sArray);
+        }
+        m_aoQueue.clear();
+    }
+
+    void Run()
+    {
+        tlbInArrowArrayStreamPrefetcher = true;
+
+        // The private data of the stream passed to the layer only needs
+        // to give access to m_poShared, which outlives this thread. Hence
+        // the non-owning shared_ptr.
+        OGRLayer::ArrowArrayStreamPrivateDataSharedDataWrapper oWrapper;
+        oWrapper.poShared =
+            std::shared_ptr<OGRLayer::ArrowArrayStreamPrivateData>(
+                std::shared_ptr<OGRLayer::ArrowArrayStreamPrivateData>(),
+                m_poShared);
+        struct ArrowArrayStream sStream;
+        memset(&sStream, 0, sizeof(sStream));
+        sStream.private_data = &oWrapper;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                m_oCV.wait(oLock,
+                           [this]() {
+                               return m_bStop ||
+                                      m_aoQueue.size() < m_nMaxQueueSize;
+                           });
+                if (m_bStop)
+                    return;
+            }
+
+            auto poLayer = m_poShared->m_poLayer;
+            Batch oBatch;
+            CPLErrorAccumulator oErrorAccumulator;
+            if (poLayer)
+            {
+                auto oContext = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oContext);
+                oBatch.nRet = poLayer->OGRLayer::GetNextArrowArray(
+                    &sStream, &oBatch.sArray);
+            }
+            oBatch.aoErrors = oErrorAccumulator.GetErrors();
+            const bool bLast =
+                oBatch.nRet != 0 || oBatch.sArray.release == nullptr;
+
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_aoQueue.push_back(std::move(oBatch));
+                m_bFinished = bLast;
+            }
+            m_oCV.notify_all();
+            if (bLast)
+                return;
+        }
+    }
+};
+
+OGRLayer::ArrowArrayStreamPrivateData::ArrowArrayStreamPrivateData() = default;
+
+OGRLayer::ArrowArrayStreamPrivateData::~ArrowArrayStreamPrivateData() = default;
+
+//! @endcond
+
 /************************************************************************/
 /*                          GetNextArrowArray()                         */
 /************************************************************************/
@@ -1939,10 +2720,34 @@ int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         static_cast<ArrowArrayStreamPrivateDataSharedDataWrapper *>(
             stream->private_data);
 
+    const int nPrefetchBatches =
+        atoi(m_aosArrowArrayStreamOptions.FetchNameValueDef(
+            GAS_OPT_PREFETCH_BATCHES, "0"));
+    if (nPrefetchBatches > 0 && !tlbInArrowArrayStreamPrefetcher)
+    {
+        auto &poPrefetcher = poPrivate->poShared->m_poPrefetcher;
+        if (!poPrefetcher)
+        {
+            poPrefetcher = std::make_unique<OGRArrowArrayStreamPrefetcher>(
+                poPrivate->poShared.get(),
+                static_cast<size_t>(nPrefetchBatches));
+            if (!poPrefetcher->Start())
+            {
+                poPrefetcher.reset();
+                memset(out_array, 0, sizeof(*out_array));
+                return ENOMEM;
+            }
+        }
+        return poPrefetcher->GetNext(out_array);
+    }
+
     const bool bIncludeFID = CPLTestBool(
         m_aosArrowArrayStreamOptions.FetchNameValueDef("INCLUDE_FID", "YES"));
     const bool bDateTimeAsString = m_aosArrowArrayStreamOptions.FetchBool(
         GAS_OPT_DATETIME_AS_STRING, false);
+    // The warning about an unsupported value is emitted by GetArrowSchema()
+    const auto eGeoArrowEncoding = GetGeoArrowEncoding(
+        m_aosArrowArrayStreamOptions, /* bEmitWarning = */ false);
     int nMaxBatchSize = atoi(m_aosArrowArrayStreamOptions.FetchNameValueDef(
         "MAX_FEATURES_IN_BATCH", "65536"));
     if (nMaxBatchSize <= 0)
@@ -2327,6 +3132,16 @@ int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         ++iSchemaChild;
         psChild->release = OGRLayerDefaultReleaseArray;
         psChild->length = oFeatureQueue.size();
+        const auto eGeoArrowType =
+            GetGeoArrowNativeGeometryType(poFieldDefn, eGeoArrowEncoding);
+        if (eGeoArrowType != wkbUnknown)
+        {
+            if (!FillGeoArrowGeometryArray(psChild, oFeatureQueue,
+                                           nFeatureCount, poFieldDefn, i,
+                                           eGeoArrowType, eGeoArrowEncoding))
+                goto error;
+            continue;
+        }
         const size_t nThisFeatureCount = FillWKBGeometryArray<int32_t>(
             psChild, oFeatureQueue, nFeatureCount, poFieldDefn, i, nMemLimit);
         if (nThisFeatureCount == 0)
@@ -2391,7 +3206,12 @@ int OGRLayer::StaticGetNextArrowArray(struct ArrowArrayStream *stream,
                  "Calling get_next() on a freed OGRLayer is not supported");
         return EINVAL;
     }
-    return poLayer->GetNextArrowArray(stream, out_array);
+    OGRProfilingTimer oTimer(poLayer, OGRProfilingStage::READ_ARROW);
+    const int nRet = poLayer->GetNextArrowArray(stream, out_array);
+    oTimer.SetFeatureCount(nRet == 0 && out_array->release
+                               ? static_cast<uint64_t>(out_array->length)
+                               : 0);
+    return nRet;
 }
 
 /************************************************************************/
@@ -2412,6 +3232,8 @@ void OGRLayer::ReleaseStream(struct ArrowArrayStream *stream)
     ArrowArrayStreamPrivateDataSharedDataWrapper *poPrivate =
         static_cast<ArrowArrayStreamPrivateDataSharedDataWrapper *>(
             stream->private_data);
+    // Must be done before ResetReading(), to stop the worker thread
+    poPrivate->poShared->m_poPrefetcher.reset();
     poPrivate->poShared->m_bArrowArrayStreamInProgress = false;
     poPrivate->poShared->m_bEOF = false;
     if (poPrivate->poShared->m_poLayer)
@@ -2564,6 +3386,31 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=WKB/GEOARROW/GEOARROW_INTERLEAVED (GDAL >= 3.11).
+ *     The default is WKB. When set to GEOARROW or GEOARROW_INTERLEAVED,
+ *     geometry fields whose type is Point, LineString, Polygon, MultiPoint,
+ *     MultiLineString or MultiPolygon (possibly with Z and/or M) are returned
+ *     with the corresponding GeoArrow native encoding, that is nested lists
+ *     of coordinates, with the ARROW:extension:name metadata set to
+ *     geoarrow.point, geoarrow.linestring, etc.
+ *     With GEOARROW, coordinates are a struct of x, y[, z][, m] double fields
+ *     (separated encoding). With GEOARROW_INTERLEAVED, they are a fixed size
+ *     list of doubles. Geometry fields of other types are still returned as
+ *     WKB. Single geometries in a Multi geometry field are promoted to it,
+ *     and other geometries whose type does not match the one of the field are
+ *     returned as null, with a warning.
+ *     Drivers with a specialized implementation that only support WKB fall
+ *     back to the generic implementation when this option is set.
+ * </li>
+ * <li>PREFETCH_BATCHES=integer (GDAL >= 3.11). Defaults to 0.
+ *     Only taken into account by the generic implementation. When set to a
+ *     strictly positive value, a background thread reads features and builds
+ *     up to that number of batches in advance, while the caller processes the
+ *     current batch. As features are read from that thread, the caller must
+ *     not use the dataset of the layer (including its other layers) while the
+ *     stream is active, unless the driver is thread-safe, and it must release
+ *     the stream before closing the dataset.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -2770,6 +3617,31 @@ YES.</li>
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=WKB/GEOARROW/GEOARROW_INTERLEAVED (GDAL >= 3.11).
+ *     The default is WKB. When set to GEOARROW or GEOARROW_INTERLEAVED,
+ *     geometry fields whose type is Point, LineString, Polygon, MultiPoint,
+ *     MultiLineString or MultiPolygon (possibly with Z and/or M) are returned
+ *     with the corresponding GeoArrow native encoding, that is nested lists
+ *     of coordinates, with the ARROW:extension:name metadata set to
+ *     geoarrow.point, geoarrow.linestring, etc.
+ *     With GEOARROW, coordinates are a struct of x, y[, z][, m] double fields
+ *     (separated encoding). With GEOARROW_INTERLEAVED, they are a fixed size
+ *     list of doubles. Geometry fields of other types are still returned as
+ *     WKB. Single geometries in a Multi geometry field are promoted to it,
+ *     and other geometries whose type does not match the one of the field are
+ *     returned as null, with a warning.
+ *     Drivers with a specialized implementation that only support WKB fall
+ *     back to the generic implementation when this option is set.
+ * </li>
+ * <li>PREFETCH_BATCHES=integer (GDAL >= 3.11). Defaults to 0.
+ *     Only taken into account by the generic implementation. When set to a
+ *     strictly positive value, a background thread reads features and builds
+ *     up to that number of batches in advance, while the caller processes the
+ *     current batch. As features are read from that thread, the caller must
+ *     not use the dataset of the layer (including its other layers) while the
+ *     stream is active, unless the driver is thread-safe, and it must release
+ *     the stream before closing the dataset.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -4752,75 +5624,606 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
                     array, iOGRFieldIndex, nOffsettedIndex, childArray,
                     oFeature);
         }
-        else if (IsLargeString(childFormat))
+        else if (IsLargeString(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldListFromString<uint32_t, uint64_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+            else
+                FillFieldListFromString<uint64_t, uint64_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+        }
+        else if (format[1] == ARROW_2ND_LETTER_LIST)
+        {
+            const size_t iFeature =
+                static_cast<size_t>(nOffsettedIndex - array->offset);
+            oFeature.SetField(iOGRFieldIndex,
+                              GetListAsJSON<uint32_t>(schema, array, iFeature)
+                                  .Format(CPLJSONObject::PrettyFormat::Plain)
+                                  .c_str());
+        }
+        else
+        {
+            const size_t iFeature =
+                static_cast<size_t>(nOffsettedIndex - array->offset);
+            oFeature.SetField(iOGRFieldIndex,
+                              GetListAsJSON<uint64_t>(schema, array, iFeature)
+                                  .Format(CPLJSONObject::PrettyFormat::Plain)
+                                  .c_str());
+        }
+    }
+    else if (IsDecimal(format))
+    {
+        int nPrecision = 0;
+        int nScale = 0;
+        int nWidthInBytes = 0;
+        if (!ParseDecimalFormat(format, nPrecision, nScale, nWidthInBytes))
+        {
+            CPLAssert(false);
+        }
+
+        // fits on a int64
+        CPLAssert(nPrecision <= 19);
+        // either 128 or 256 bits
+        CPLAssert((nWidthInBytes % 8) == 0);
+        const int nWidthIn64BitWord = nWidthInBytes / 8;
+        const size_t iFeature =
+            static_cast<size_t>(nOffsettedIndex - array->offset);
+        oFeature.SetField(
+            iOGRFieldIndex,
+            GetValueDecimal(array, nWidthIn64BitWord, nScale, iFeature));
+        return true;
+    }
+    else if (IsMap(format))
+    {
+        const size_t iFeature =
+            static_cast<size_t>(nOffsettedIndex - array->offset);
+        oFeature.SetField(iOGRFieldIndex,
+                          GetMapAsJSON(schema, array, iFeature)
+                              .Format(CPLJSONObject::PrettyFormat::Plain)
+                              .c_str());
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRArrowColumnarFilter                         */
+/************************************************************************/
+
+namespace
+{
+// Evaluates a subset of OGR SQL expressions (comparisons between a column and
+// constants, IS NULL, AND, OR, NOT) directly on the Arrow buffers, one
+// operation at a time over all the rows of the batch, instead of
+// instantiating a OGRFeature and evaluating the expression tree for each row.
+// For each row, each node computes the same int_value and is_null values
+// as the node returned by swq_expr_node::Evaluate() on the equivalent
+// OGRFeature, so that the result is identical to the row-based evaluation.
+class OGRArrowColumnarFilter
+{
+  public:
+    OGRArrowColumnarFilter() = default;
+
+    static std::unique_ptr<OGRArrowColumnarFilter>
+    Compile(const swq_expr_node *poNode, const OGRFeatureDefn *poFeatureDefn,
+            const struct ArrowSchema *schema,
+            const std::map<std::string, std::vector<int>>
+                &oMapFieldNameToArrowPath);
+
+    void Evaluate(const struct ArrowArray *array,
+                  std::vector<uint8_t> &abyValue,
+                  std::vector<uint8_t> &abyNull) const;
+
+  private:
+    enum class Type
+    {
+        AND,
+        OR,
+        NOT,
+        IS_NULL,
+        COMPARE_INTEGER,
+        COMPARE_DOUBLE,
+        COMPARE_STRING,
+    };
+
+    Type m_eType = Type::AND;
+    swq_op m_eOp = SWQ_EQ;
+    std::vector<std::unique_ptr<OGRArrowColumnarFilter>> m_apoChildren{};
+    int m_iArrowField = -1;
+    const char *m_pszFormat = nullptr;
+    std::vector<int64_t> m_anConstants{};
+    std::vector<double> m_adfConstants{};
+    std::vector<std::string> m_aosConstants{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowColumnarFilter)
+};
+
+/************************************************************************/
+/*                   OGRArrowColumnarFilter::Compile()                  */
+/************************************************************************/
+
+/** Return a columnar evaluator of poNode, or nullptr if it contains
+ * constructs that are not handled.
+ */
+std::unique_ptr<OGRArrowColumnarFilter> OGRArrowColumnarFilter::Compile(
+    const swq_expr_node *poNode, const OGRFeatureDefn *poFeatureDefn,
+    const struct ArrowSchema *schema,
+    const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath)
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return nullptr;
+
+    auto poFilter = std::make_unique<OGRArrowColumnarFilter>();
+    poFilter->m_eOp = poNode->nOperation;
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount !=
+                (poNode->nOperation == SWQ_NOT ? 1 : 2))
+                return nullptr;
+            poFilter->m_eType = poNode->nOperation == SWQ_AND  ? Type::AND
+                                : poNode->nOperation == SWQ_OR ? Type::OR
+                                                               : Type::NOT;
+            for (int i = 0; i < poNode->nSubExprCount; ++i)
+            {
+                auto poChild =
+                    Compile(poNode->papoSubExpr[i], poFeatureDefn, schema,
+                            oMapFieldNameToArrowPath);
+                if (!poChild)
+                    return nullptr;
+                poFilter->m_apoChildren.push_back(std::move(poChild));
+            }
+            return poFilter;
+        }
+
+        case SWQ_ISNULL:
+            if (poNode->nSubExprCount != 1)
+                return nullptr;
+            poFilter->m_eType = Type::IS_NULL;
+            break;
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+            if (poNode->nSubExprCount != 2)
+                return nullptr;
+            break;
+
+        case SWQ_BETWEEN:
+            if (poNode->nSubExprCount != 3)
+                return nullptr;
+            break;
+
+        case SWQ_IN:
+            if (poNode->nSubExprCount < 2)
+                return nullptr;
+            break;
+
+        default:
+            return nullptr;
+    }
+
+    // First argument must be a regular attribute field, mapped to a
+    // top-level Arrow column of a compatible data type.
+    const swq_expr_node *poColumn = poNode->papoSubExpr[0];
+    if (poColumn->eNodeType != SNT_COLUMN || poColumn->table_index != 0 ||
+        poColumn->field_index < 0 ||
+        poColumn->field_index >= poFeatureDefn->GetFieldCount())
+    {
+        return nullptr;
+    }
+    const OGRFieldDefn *poFieldDefn =
+        poFeatureDefn->GetFieldDefn(poColumn->field_index);
+    const auto oIter =
+        oMapFieldNameToArrowPath.find(poFieldDefn->GetNameRef());
+    if (oIter == oMapFieldNameToArrowPath.end() || oIter->second.size() != 1)
+        return nullptr;
+    poFilter->m_iArrowField = oIter->second[0];
+    const struct ArrowSchema *psSchemaField =
+        schema->children[poFilter->m_iArrowField];
+    if (psSchemaField->dictionary)
+        return nullptr;
+    const char *format = psSchemaField->format;
+    poFilter->m_pszFormat = format;
+
+    const bool bIntegerColumn =
+        (poColumn->field_type == SWQ_INTEGER &&
+         poFieldDefn->GetType() == OFTInteger &&
+         poFieldDefn->GetSubType() != OFSTBoolean &&
+         (IsInt8(format) || IsUInt8(format) || IsInt16(format) ||
+          IsUInt16(format) || IsInt32(format))) ||
+        (poColumn->field_type == SWQ_INTEGER64 &&
+         poFieldDefn->GetType() == OFTInteger64 &&
+         (IsInt8(format) || IsUInt8(format) || IsInt16(format) ||
+          IsUInt16(format) || IsInt32(format) || IsUInt32(format) ||
+          IsInt64(format)));
+    const bool bDoubleColumn = poColumn->field_type == SWQ_FLOAT &&
+                               poFieldDefn->GetType() == OFTReal &&
+                               (IsFloat32(format) || IsFloat64(format));
+    const bool bStringColumn = poColumn->field_type == SWQ_STRING &&
+                               poFieldDefn->GetType() == OFTString &&
+                               (IsString(format) || IsLargeString(format));
+    if (!bIntegerColumn && !bDoubleColumn && !bStringColumn)
+        return nullptr;
+
+    if (poFilter->m_eType == Type::IS_NULL)
+        return poFilter;
+
+    // Other arguments must be non-NULL constants. Constants have already
+    // been promoted to the type of the comparison by SWQGeneralChecker().
+    bool bHasFloatConstant = false;
+    for (int i = 1; i < poNode->nSubExprCount; ++i)
+    {
+        const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+        if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null)
+            return nullptr;
+        if (poConstant->field_type == SWQ_FLOAT)
+            bHasFloatConstant = true;
+    }
+
+    if (bStringColumn)
+    {
+        poFilter->m_eType = Type::COMPARE_STRING;
+        for (int i = 1; i < poNode->nSubExprCount; ++i)
+        {
+            const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+            if (poConstant->field_type != SWQ_STRING ||
+                !poConstant->string_value)
+                return nullptr;
+            const std::string osConstant(poConstant->string_value);
+            // The equality operator has special rules for values that look
+            // like timestamps with and without timezone.
+            if (poNode->nOperation == SWQ_EQ && osConstant.size() > 3 &&
+                (osConstant[osConstant.size() - 3] == ':' ||
+                 osConstant.compare(osConstant.size() - 3, 3, "+00") == 0))
+            {
+                return nullptr;
+            }
+            poFilter->m_aosConstants.push_back(osConstant);
+        }
+    }
+    else if (bDoubleColumn || bHasFloatConstant)
+    {
+        poFilter->m_eType = Type::COMPARE_DOUBLE;
+        for (int i = 1; i < poNode->nSubExprCount; ++i)
+        {
+            const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+            if (poConstant->field_type != SWQ_FLOAT)
+                return nullptr;
+            poFilter->m_adfConstants.push_back(poConstant->float_value);
+        }
+    }
+    else
+    {
+        poFilter->m_eType = Type::COMPARE_INTEGER;
+        for (int i = 1; i < poNode->nSubExprCount; ++i)
+        {
+            const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+            if (!SWQ_IS_INTEGER(poConstant->field_type))
+                return nullptr;
+            poFilter->m_anConstants.push_back(poConstant->int_value);
+        }
+    }
+
+    return poFilter;
+}
+
+/************************************************************************/
+/*                      CompareColumnWithConstants()                    */
+/************************************************************************/
+
+template <class ArrowType, class CompareType>
+static void
+CompareColumnWithConstants(const ArrowType *paValues, size_t nLength,
+                           swq_op eOp,
+                           const std::vector<CompareType> &aConstants,
+                           uint8_t *pabyValue)
+{
+    const CompareType c0 = aConstants[0];
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) == c0;
+            break;
+        case SWQ_NE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) != c0;
+            break;
+        case SWQ_LT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) < c0;
+            break;
+        case SWQ_LE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) <= c0;
+            break;
+        case SWQ_GT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) > c0;
+            break;
+        case SWQ_GE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<CompareType>(paValues[i]) >= c0;
+            break;
+        case SWQ_BETWEEN:
+        {
+            const CompareType c1 = aConstants[1];
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                const auto v = static_cast<CompareType>(paValues[i]);
+                pabyValue[i] = v >= c0 && v <= c1;
+            }
+            break;
+        }
+        case SWQ_IN:
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldListFromString<uint32_t, uint64_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
-            else
-                FillFieldListFromString<uint64_t, uint64_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
+            std::fill_n(pabyValue, nLength, static_cast<uint8_t>(0));
+            for (const CompareType c : aConstants)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                    pabyValue[i] |= static_cast<CompareType>(paValues[i]) == c;
+            }
+            break;
         }
-        else if (format[1] == ARROW_2ND_LETTER_LIST)
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                   CompareNumericColumnWithConstants()                */
+/************************************************************************/
+
+template <class CompareType>
+static void CompareNumericColumnWithConstants(
+    const struct ArrowArray *psArray, size_t nLength, const char *format,
+    swq_op eOp, const std::vector<CompareType> &aConstants, uint8_t *pabyValue)
+{
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const void *pBuffer = psArray->buffers[1];
+    if (IsInt8(format))
+        CompareColumnWithConstants(static_cast<const int8_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsUInt8(format))
+        CompareColumnWithConstants(static_cast<const uint8_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsInt16(format))
+        CompareColumnWithConstants(static_cast<const int16_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsUInt16(format))
+        CompareColumnWithConstants(static_cast<const uint16_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsInt32(format))
+        CompareColumnWithConstants(static_cast<const int32_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsUInt32(format))
+        CompareColumnWithConstants(static_cast<const uint32_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsInt64(format))
+        CompareColumnWithConstants(static_cast<const int64_t *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsFloat32(format))
+        CompareColumnWithConstants(static_cast<const float *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else if (IsFloat64(format))
+        CompareColumnWithConstants(static_cast<const double *>(pBuffer) +
+                                       nOffset,
+                                   nLength, eOp, aConstants, pabyValue);
+    else
+        CPLAssert(false);
+}
+
+/************************************************************************/
+/*                   CompareStringColumnWithConstants()                 */
+/************************************************************************/
+
+template <class OffsetType>
+static void CompareStringColumnWithConstants(
+    const struct ArrowArray *psArray, size_t nLength, swq_op eOp,
+    const std::vector<std::string> &aosConstants, const uint8_t *pabyNull,
+    uint8_t *pabyValue)
+{
+    const auto panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+    const char *pszC0 = aosConstants[0].c_str();
+    std::string osValue;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        if (pabyNull[i])
         {
-            const size_t iFeature =
-                static_cast<size_t>(nOffsettedIndex - array->offset);
-            oFeature.SetField(iOGRFieldIndex,
-                              GetListAsJSON<uint32_t>(schema, array, iFeature)
-                                  .Format(CPLJSONObject::PrettyFormat::Plain)
-                                  .c_str());
+            pabyValue[i] = false;
+            continue;
         }
-        else
+        const char *pszStart = pachData + static_cast<size_t>(panOffsets[i]);
+        const size_t nSize =
+            static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+        // OGRFeature string fields stop at the first nul character
+        osValue.assign(pszStart, CPLStrnlen(pszStart, nSize));
+        const char *pszValue = osValue.c_str();
+        switch (eOp)
         {
-            const size_t iFeature =
-                static_cast<size_t>(nOffsettedIndex - array->offset);
-            oFeature.SetField(iOGRFieldIndex,
-                              GetListAsJSON<uint64_t>(schema, array, iFeature)
-                                  .Format(CPLJSONObject::PrettyFormat::Plain)
-                                  .c_str());
+            case SWQ_EQ:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) == 0;
+                break;
+            case SWQ_NE:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) != 0;
+                break;
+            case SWQ_LT:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) < 0;
+                break;
+            case SWQ_LE:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) <= 0;
+                break;
+            case SWQ_GT:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) > 0;
+                break;
+            case SWQ_GE:
+                pabyValue[i] = strcasecmp(pszValue, pszC0) >= 0;
+                break;
+            case SWQ_BETWEEN:
+                pabyValue[i] =
+                    strcasecmp(pszValue, pszC0) >= 0 &&
+                    strcasecmp(pszValue, aosConstants[1].c_str()) <= 0;
+                break;
+            case SWQ_IN:
+            {
+                pabyValue[i] = false;
+                for (const auto &osConstant : aosConstants)
+                {
+                    if (strcasecmp(pszValue, osConstant.c_str()) == 0)
+                    {
+                        pabyValue[i] = true;
+                        break;
+                    }
+                }
+                break;
+            }
+            default:
+                CPLAssert(false);
+                break;
         }
     }
-    else if (IsDecimal(format))
+}
+
+/************************************************************************/
+/*                   OGRArrowColumnarFilter::Evaluate()                 */
+/************************************************************************/
+
+/** Evaluate the filter on all rows of array. On return, abyValue[i] is
+ * the logical value of the expression for row i, and abyNull[i] whether
+ * it is NULL.
+ */
+void OGRArrowColumnarFilter::Evaluate(const struct ArrowArray *array,
+                                      std::vector<uint8_t> &abyValue,
+                                      std::vector<uint8_t> &abyNull) const
+{
+    const size_t nLength = static_cast<size_t>(array->length);
+    abyValue.resize(nLength);
+    abyNull.resize(nLength);
+
+    switch (m_eType)
     {
-        int nPrecision = 0;
-        int nScale = 0;
-        int nWidthInBytes = 0;
-        if (!ParseDecimalFormat(format, nPrecision, nScale, nWidthInBytes))
+        case Type::AND:
+        case Type::OR:
         {
-            CPLAssert(false);
+            std::vector<uint8_t> abyValue2, abyNull2;
+            m_apoChildren[0]->Evaluate(array, abyValue, abyNull);
+            m_apoChildren[1]->Evaluate(array, abyValue2, abyNull2);
+            if (m_eType == Type::AND)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    abyValue[i] = abyValue[i] & abyValue2[i];
+                    abyNull[i] = abyNull[i] & abyNull2[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    abyValue[i] = abyValue[i] | abyValue2[i];
+                    abyNull[i] = abyNull[i] | abyNull2[i];
+                }
+            }
+            return;
         }
 
-        // fits on a int64
-        CPLAssert(nPrecision <= 19);
-        // either 128 or 256 bits
-        CPLAssert((nWidthInBytes % 8) == 0);
-        const int nWidthIn64BitWord = nWidthInBytes / 8;
-        const size_t iFeature =
-            static_cast<size_t>(nOffsettedIndex - array->offset);
-        oFeature.SetField(
-            iOGRFieldIndex,
-            GetValueDecimal(array, nWidthIn64BitWord, nScale, iFeature));
-        return true;
+        case Type::NOT:
+        {
+            m_apoChildren[0]->Evaluate(array, abyValue, abyNull);
+            for (size_t i = 0; i < nLength; ++i)
+                abyValue[i] = !abyValue[i] && !abyNull[i];
+            return;
+        }
+
+        default:
+            break;
     }
-    else if (IsMap(format))
+
+    const struct ArrowArray *psArray = array->children[m_iArrowField];
+    const uint8_t *pabyValidity =
+        psArray->null_count == 0
+            ? nullptr
+            : static_cast<const uint8_t *>(psArray->buffers[0]);
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    if (pabyValidity)
     {
-        const size_t iFeature =
-            static_cast<size_t>(nOffsettedIndex - array->offset);
-        oFeature.SetField(iOGRFieldIndex,
-                          GetMapAsJSON(schema, array, iFeature)
-                              .Format(CPLJSONObject::PrettyFormat::Plain)
-                              .c_str());
+        for (size_t i = 0; i < nLength; ++i)
+            abyNull[i] = !TestBit(pabyValidity, nOffset + i);
     }
     else
     {
-        return false;
+        std::fill(abyNull.begin(), abyNull.end(), static_cast<uint8_t>(0));
     }
 
-    return true;
+    switch (m_eType)
+    {
+        case Type::IS_NULL:
+            std::swap(abyValue, abyNull);
+            std::fill(abyNull.begin(), abyNull.end(), static_cast<uint8_t>(0));
+            return;
+
+        case Type::COMPARE_INTEGER:
+            CompareNumericColumnWithConstants(psArray, nLength, m_pszFormat,
+                                              m_eOp, m_anConstants,
+                                              abyValue.data());
+            break;
+
+        case Type::COMPARE_DOUBLE:
+            CompareNumericColumnWithConstants(psArray, nLength, m_pszFormat,
+                                              m_eOp, m_adfConstants,
+                                              abyValue.data());
+            break;
+
+        case Type::COMPARE_STRING:
+            if (IsString(m_pszFormat))
+                CompareStringColumnWithConstants<uint32_t>(
+                    psArray, nLength, m_eOp, m_aosConstants, abyNull.data(),
+                    abyValue.data());
+            else
+                CompareStringColumnWithConstants<uint64_t>(
+                    psArray, nLength, m_eOp, m_aosConstants, abyNull.data(),
+                    abyValue.data());
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+
+    // Comparisons with a NULL value evaluate to false
+    for (size_t i = 0; i < nLength; ++i)
+        abyValue[i] = abyValue[i] & !abyNull[i];
 }
 
+}  // namespace
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4839,6 +6242,24 @@ static size_t FillValidityArrayFromAttrQuery(
     BuildMapFieldNameToArrowPath(schema, oMapFieldNameToArrowPath,
                                  std::string(), anArrowPathTmp);
 
+    // Evaluate the filter directly on the Arrow columns when possible, which
+    // avoids instantiating a OGRFeature for each row.
+    if (const auto poColumnarFilter = OGRArrowColumnarFilter::Compile(
+            static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+            poFeatureDefn, schema, oMapFieldNameToArrowPath))
+    {
+        std::vector<uint8_t> abyValue, abyNull;
+        poColumnarFilter->Evaluate(array, abyValue, abyNull);
+        for (size_t iRow = 0; iRow < abyValidityFromFilters.size(); ++iRow)
+        {
+            if (abyValidityFromFilters[iRow] && abyValue[iRow])
+                nCountIntersecting++;
+            else
+                abyValidityFromFilters[iRow] = false;
+        }
+        return nCountIntersecting;
+    }
+
     struct UsedFieldsInfo
     {
         int iOGRFieldIndex{};
@@ -5837,6 +7258,23 @@ static bool IsArrowSchemaSupportedInternal(const struct ArrowSchema *schema,
 
     const char *fieldName = schema->name;
     const char *format = schema->format;
+
+    const auto eGeoArrowType = GetGeoArrowGeometryTypeFromSchema(schema);
+    if (eGeoArrowType != wkbUnknown)
+    {
+        bool bInterleaved = false;
+        bool bHasZ = false;
+        bool bHasM = false;
+        if (!ParseGeoArrowNativeSchema(schema, eGeoArrowType, bInterleaved,
+                                       bHasZ, bHasM))
+        {
+            AppendError("Unsupported layout for GeoArrow encoded field " +
+                        osFieldPrefix + fieldName);
+            return false;
+        }
+        return true;
+    }
+
     if (IsStructure(format))
     {
         bool bRet = true;
@@ -6467,8 +7905,30 @@ struct FieldInfo
     int nWidthInBytes = 0;  // only used for decimal fields
     int nPrecision = 0;     // only used for decimal fields
     int nScale = 0;         // only used for decimal fields
+    // Only set for GeoArrow native encoded geometry columns
+    const struct ArrowSchema *psGeoArrowSchema = nullptr;
+    OGRwkbGeometryType eGeoArrowType = wkbUnknown;
+    bool bGeoArrowInterleaved = false;
+    bool bGeoArrowHasZ = false;
+    bool bGeoArrowHasM = false;
 };
 
+/************************************************************************/
+/*                       IsGeoArrowNativeColumn()                       */
+/************************************************************************/
+
+/** Return whether the Arrow column of index iArrowIdx is a GeoArrow native
+ * encoded geometry column, whose (structure) schema must not be recursed
+ * into.
+ */
+static inline bool
+IsGeoArrowNativeColumn(const struct ArrowSchema *schema, int iArrowIdx,
+                       const std::vector<FieldInfo> &asFieldInfo)
+{
+    return iArrowIdx < static_cast<int>(asFieldInfo.size()) &&
+           asFieldInfo[iArrowIdx].psGeoArrowSchema == schema;
+}
+
 static bool BuildOGRFieldInfo(
     const struct ArrowSchema *schema, struct ArrowArray *array,
     const OGRFeatureDefn *poFeatureDefn, const std::string &osFieldPrefix,
@@ -6481,6 +7941,47 @@ static bool BuildOGRFieldInfo(
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+
+    const auto eGeoArrowType = GetGeoArrowGeometryTypeFromSchema(schema);
+    if (eGeoArrowType != wkbUnknown)
+    {
+        FieldInfo sInfo;
+        sInfo.osName = osFieldPrefix + fieldName;
+        sInfo.format = format;
+        sInfo.psGeoArrowSchema = schema;
+        sInfo.eGeoArrowType = eGeoArrowType;
+        if (!ParseGeoArrowNativeSchema(schema, eGeoArrowType,
+                                       sInfo.bGeoArrowInterleaved,
+                                       sInfo.bGeoArrowHasZ,
+                                       sInfo.bGeoArrowHasM))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Geometry column '%s' has an unsupported layout for "
+                     "its GeoArrow encoding",
+                     sInfo.osName.c_str());
+            return false;
+        }
+        const auto oIter = oMapArrowFieldNameToOGRFieldName.find(sInfo.osName);
+        sInfo.iOGRFieldIdx = poFeatureDefn->GetGeomFieldIndex(
+            oIter != oMapArrowFieldNameToOGRFieldName.end()
+                ? oIter->second.c_str()
+                : sInfo.osName.c_str());
+        if (sInfo.iOGRFieldIdx < 0)
+        {
+            if (poFeatureDefn->GetGeomFieldCount() == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot find OGR geometry field for Arrow array %s",
+                         sInfo.osName.c_str());
+                return false;
+            }
+            sInfo.iOGRFieldIdx = 0;
+        }
+        sInfo.bIsGeomCol = true;
+        asFieldInfo.emplace_back(std::move(sInfo));
+        return true;
+    }
+
     if (IsStructure(format))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
@@ -7001,7 +8502,8 @@ static size_t GetWorkingBufferSize(const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
-    if (IsStructure(format))
+    if (IsStructure(format) &&
+        !IsGeoArrowNativeColumn(schema, iArrowIdxInOut, asFieldInfo))
     {
         size_t nRet = 0;
         for (int64_t i = 0; i < array->n_children; ++i)
@@ -7163,6 +8665,178 @@ FillFieldBinary(const struct ArrowArray *array, int iOGRFieldIdx,
     return true;
 }
 
+/************************************************************************/
+/*                     BuildGeometryFromGeoArrow()                      */
+/************************************************************************/
+
+/** Build the geometry at index iFeature (not including array->offset) of a
+ * GeoArrow native encoded geometry array.
+ */
+static std::unique_ptr<OGRGeometry>
+BuildGeometryFromGeoArrow(const FieldInfo &sInfo,
+                          const struct ArrowArray *array, size_t iFeature)
+{
+    const bool bHasZ = sInfo.bGeoArrowHasZ;
+    const bool bHasM = sInfo.bGeoArrowHasM;
+    const int nDims = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+
+    // Return the [begin, end[ range of the list element of index idx
+    const auto GetRange = [](const struct ArrowArray *psList, size_t idx)
+    {
+        const auto panOffsets =
+            static_cast<const int32_t *>(psList->buffers[1]) + psList->offset;
+        return std::pair<size_t, size_t>(
+            static_cast<size_t>(panOffsets[idx]),
+            static_cast<size_t>(panOffsets[idx + 1]));
+    };
+
+    // Return the X, Y, Z and M values of the coordinate of index idx
+    const auto GetXYZM =
+        [&sInfo, bHasZ, nDims](const struct ArrowArray *psCoords, size_t idx,
+                               double adfXYZM[4])
+    {
+        const int anIdx[] = {0, 1, bHasZ ? 2 : 3, 3};
+        idx += static_cast<size_t>(psCoords->offset);
+        for (int iDim = 0; iDim < nDims; ++iDim)
+        {
+            const struct ArrowArray *psValues =
+                psCoords->children[sInfo.bGeoArrowInterleaved ? 0 : iDim];
+            const size_t nValueIdx =
+                sInfo.bGeoArrowInterleaved ? idx * nDims + iDim : idx;
+            adfXYZM[anIdx[iDim]] =
+                static_cast<const double *>(
+                    psValues->buffers[1])[psValues->offset + nValueIdx];
+        }
+    };
+
+    const auto BuildPoint =
+        [&GetXYZM, bHasZ, bHasM](const struct ArrowArray *psCoords, size_t idx)
+    {
+        double adfXYZM[4] = {0, 0, 0, 0};
+        GetXYZM(psCoords, idx, adfXYZM);
+        auto poPoint = std::make_unique<OGRPoint>();
+        // NaN X and Y values are for an empty point
+        poPoint->setX(adfXYZM[0]);
+        poPoint->setY(adfXYZM[1]);
+        if (bHasZ)
+            poPoint->setZ(adfXYZM[2]);
+        if (bHasM)
+            poPoint->setM(adfXYZM[3]);
+        return poPoint;
+    };
+
+    const auto FillCurve = [&GetXYZM, &GetRange, bHasZ,
+                            bHasM](OGRSimpleCurve *poCurve,
+                                   const struct ArrowArray *psList, size_t idx)
+    {
+        const auto oRange = GetRange(psList, idx);
+        const auto psCoords = psList->children[0];
+        poCurve->setNumPoints(static_cast<int>(oRange.second - oRange.first),
+                              false);
+        double adfXYZM[4] = {0, 0, 0, 0};
+        for (size_t j = oRange.first; j < oRange.second; ++j)
+        {
+            GetXYZM(psCoords, j, adfXYZM);
+            const int iPt = static_cast<int>(j - oRange.first);
+            if (bHasZ && bHasM)
+                poCurve->setPoint(iPt, adfXYZM[0], adfXYZM[1], adfXYZM[2],
+                                  adfXYZM[3]);
+            else if (bHasZ)
+                poCurve->setPoint(iPt, adfXYZM[0], adfXYZM[1], adfXYZM[2]);
+            else if (bHasM)
+                poCurve->setPointM(iPt, adfXYZM[0], adfXYZM[1], adfXYZM[3]);
+            else
+                poCurve->setPoint(iPt, adfXYZM[0], adfXYZM[1]);
+        }
+    };
+
+    const auto BuildPolygon =
+        [&FillCurve, &GetRange](const struct ArrowArray *psList, size_t idx)
+    {
+        auto poPoly = std::make_unique<OGRPolygon>();
+        const auto oRange = GetRange(psList, idx);
+        for (size_t j = oRange.first; j < oRange.second; ++j)
+        {
+            auto poRing = std::make_unique<OGRLinearRing>();
+            FillCurve(poRing.get(), psList->children[0], j);
+            poPoly->addRingDirectly(poRing.release());
+        }
+        return poPoly;
+    };
+
+    std::unique_ptr<OGRGeometry> poGeom;
+    switch (sInfo.eGeoArrowType)
+    {
+        case wkbPoint:
+        {
+            poGeom = BuildPoint(array, iFeature);
+            break;
+        }
+
+        case wkbLineString:
+        {
+            auto poLS = std::make_unique<OGRLineString>();
+            FillCurve(poLS.get(), array, iFeature);
+            poGeom = std::move(poLS);
+            break;
+        }
+
+        case wkbPolygon:
+        {
+            poGeom = BuildPolygon(array, iFeature);
+            break;
+        }
+
+        case wkbMultiPoint:
+        {
+            auto poMP = std::make_unique<OGRMultiPoint>();
+            const auto oRange = GetRange(array, iFeature);
+            for (size_t j = oRange.first; j < oRange.second; ++j)
+                poMP->addGeometry(BuildPoint(array->children[0], j));
+            poGeom = std::move(poMP);
+            break;
+        }
+
+        case wkbMultiLineString:
+        {
+            auto poMLS = std::make_unique<OGRMultiLineString>();
+            const auto oRange = GetRange(array, iFeature);
+            for (size_t j = oRange.first; j < oRange.second; ++j)
+            {
+                auto poLS = std::make_unique<OGRLineString>();
+                FillCurve(poLS.get(), array->children[0], j);
+                poMLS->addGeometry(std::move(poLS));
+            }
+            poGeom = std::move(poMLS);
+            break;
+        }
+
+        case wkbMultiPolygon:
+        {
+            auto poMPoly = std::make_unique<OGRMultiPolygon>();
+            const auto oRange = GetRange(array, iFeature);
+            for (size_t j = oRange.first; j < oRange.second; ++j)
+                poMPoly->addGeometry(BuildPolygon(array->children[0], j));
+            poGeom = std::move(poMPoly);
+            break;
+        }
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+
+    if (poGeom)
+    {
+        // Needed for empty geometries
+        if (bHasZ)
+            poGeom->set3D(true);
+        if (bHasM)
+            poGeom->setMeasured(true);
+    }
+    return poGeom;
+}
+
 /************************************************************************/
 /*                             FillFeature()                            */
 /************************************************************************/
@@ -7177,7 +8851,8 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
-    if (IsStructure(format))
+    if (IsStructure(format) &&
+        !IsGeoArrowNativeColumn(schema, iArrowIdxInOut, asFieldInfo))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
         for (int64_t i = 0; i < array->n_children; ++i)
@@ -7258,6 +8933,14 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
         }
     }
 
+    if (asFieldInfo[iArrowIdx].psGeoArrowSchema)
+    {
+        oFeature.SetGeomField(iOGRFieldIdx,
+                              BuildGeometryFromGeoArrow(asFieldInfo[iArrowIdx],
+                                                        array, iFeature));
+        return true;
+    }
+
     if (asFieldInfo[iArrowIdx].bUseDictionary)
     {
         const uint64_t nDictIdx = GetUInt64Value(schema, array, iFeature);
@@ -7531,6 +9214,12 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
  *     ARROW:extension:name=ogc.wkb as a field metadata.
  *     The corresponding ArrowArray must be of type binary (w) or large
  *     binary (W).
+ *     Starting with GDAL 3.11, columns with
+ *     ARROW:extension:name=geoarrow.point,
+ *     geoarrow.linestring, geoarrow.polygon, geoarrow.multipoint,
+ *     geoarrow.multilinestring or geoarrow.multipolygon, using the separated
+ *     or interleaved GeoArrow native encoding with 32-bit list offsets, are
+ *     also recognized as geometry columns.
  * </li>
  * </ul>
  *
@@ -8071,6 +9760,12 @@ bool OGRLayer::WriteArrowBatch(const struct ArrowSchema *schema,
  *     ARROW:extension:name=ogc.wkb as a field metadata.
  *     The corresponding ArrowArray must be of type binary (w) or large
  *     binary (W).
+ *     Starting with GDAL 3.11, columns with
+ *     ARROW:extension:name=geoarrow.point,
+ *     geoarrow.linestring, geoarrow.polygon, geoarrow.multipoint,
+ *     geoarrow.multilinestring or geoarrow.multipolygon, using the separated
+ *     or interleaved GeoArrow native encoding with 32-bit list offsets, are
+ *     also recognized as geometry columns.
  * </li>
  * </ul>
  *
@@ -8161,6 +9856,8 @@ bool OGR_L_WriteArrowBatch(OGRLayerH hLayer, const struct ArrowSchema *schema,
     VALIDATE_POINTER1(schema, __func__, false);
     VALIDATE_POINTER1(array, __func__, false);
 
-    return OGRLayer::FromHandle(hLayer)->WriteArrowBatch(schema, array,
-                                                         papszOptions);
+    OGRLayer *poLayer = OGRLayer::FromHandle(hLayer);
+    OGRProfilingTimer oTimer(poLayer, OGRProfilingStage::WRITE_ARROW);
+    oTimer.SetFeatureCount(static_cast<uint64_t>(array->length));
+    return poLayer->WriteArrowBatch(schema, array, papszOptions);
 }
@@ -14,6 +14,7 @@
 #define OGRLAYERARROW_H_DEFINED
 
 #include "cpl_port.h"
+#include "cpl_string.h"
 
 #include <map>
 #include <string>
@@ -24,10 +25,36 @@ constexpr const char *ARROW_EXTENSION_NAME_KEY = "ARROW:extension:name";
 constexpr const char *ARROW_EXTENSION_METADATA_KEY = "ARROW:extension:metadata";
 constexpr const char *EXTENSION_NAME_OGC_WKB = "ogc.wkb";
 constexpr const char *EXTENSION_NAME_GEOARROW_WKB = "geoarrow.wkb";
+constexpr const char *EXTENSION_NAME_GEOARROW_POINT = "geoarrow.point";
+constexpr const char *EXTENSION_NAME_GEOARROW_LINESTRING =
+    "geoarrow.linestring";
+constexpr const char *EXTENSION_NAME_GEOARROW_POLYGON = "geoarrow.polygon";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTIPOINT =
+    "geoarrow.multipoint";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTILINESTRING =
+    "geoarrow.multilinestring";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTIPOLYGON =
+    "geoarrow.multipolygon";
 constexpr const char *EXTENSION_NAME_ARROW_JSON = "arrow.json";
 
 // GetArrowStream(GAS) options
 constexpr const char *GAS_OPT_DATETIME_AS_STRING = "DATETIME_AS_STRING";
+constexpr const char *GAS_OPT_GEOMETRY_ENCODING = "GEOMETRY_ENCODING";
+constexpr const char *GAS_OPT_PREFETCH_BATCHES = "PREFETCH_BATCHES";
+
+/** Return whether the GetArrowStream() options request geometry columns
+ * to be returned with a GeoArrow native (that is non-WKB) encoding.
+ *
+ * Drivers with a specialized GetNextArrowArray() implementation that only
+ * produces WKB geometries should fall back to the generic implementation
+ * in that case.
+ */
+inline bool OGRArrowStreamUsesGeoArrowNativeEncoding(CSLConstList papszOptions)
+{
+    const char *pszEncoding =
+        CSLFetchNameValue(papszOptions, GAS_OPT_GEOMETRY_ENCODING);
+    return pszEncoding && STARTS_WITH_CI(pszEncoding, "GEOARROW");
+}
 
 std::map<std::string, std::string>
     CPL_DLL OGRParseArrowMetadata(const char *pabyMetadata);
@@ -35,6 +35,24 @@ OGRAbstractProxiedLayer::~OGRAbstractProxiedLayer()
     poPool->UnchainLayer(this);
 }
 
+/************************************************************************/
+/*                                Pin()                                 */
+/************************************************************************/
+
+void OGRAbstractProxiedLayer::Pin()
+{
+    poPool->PinLayer(this, true);
+}
+
+/************************************************************************/
+/*                               Unpin()                                */
+/************************************************************************/
+
+void OGRAbstractProxiedLayer::Unpin()
+{
+    poPool->PinLayer(this, false);
+}
+
 /************************************************************************/
 /*                            OGRLayerPool()                            */
 /************************************************************************/
@@ -62,6 +80,8 @@ OGRLayerPool::~OGRLayerPool()
 
 void OGRLayerPool::SetLastUsedLayer(OGRAbstractProxiedLayer *poLayer)
 {
+    std::lock_guard oLock(m_oMutex);
+
     /* If we are already the MRU layer, nothing to do */
     if (poLayer == poMRULayer)
         return;
@@ -71,17 +91,24 @@ void OGRLayerPool::SetLastUsedLayer(OGRAbstractProxiedLayer *poLayer)
     if (poLayer->poPrevLayer != nullptr || poLayer->poNextLayer != nullptr)
     {
         /* Remove current layer from its current place in the list */
-        UnchainLayer(poLayer);
+        UnchainLayerUnlocked(poLayer);
     }
-    else if (nMRUListSize == nMaxSimultaneouslyOpened)
+    else if (nMRUListSize >= nMaxSimultaneouslyOpened)
     {
         /* If we have reached the maximum allowed number of layers */
         /* simultaneously opened, then close the LRU one that */
-        /* was still active until now */
+        /* was still active until now. Layers pinned by another thread */
+        /* are skipped, which may temporarily exceed the maximum. */
         CPLAssert(poLRULayer != nullptr);
 
-        poLRULayer->CloseUnderlyingLayer();
-        UnchainLayer(poLRULayer);
+        OGRAbstractProxiedLayer *poLayerToClose = poLRULayer;
+        while (poLayerToClose != nullptr && poLayerToClose->nPinCount > 0)
+            poLayerToClose = poLayerToClose->poPrevLayer;
+        if (poLayerToClose != nullptr)
+        {
+            poLayerToClose->CloseUnderlyingLayer();
+            UnchainLayerUnlocked(poLayerToClose);
+        }
     }
 
     /* Put current layer on top of MRU list */
@@ -104,6 +131,16 @@ void OGRLayerPool::SetLastUsedLayer(OGRAbstractProxiedLayer *poLayer)
 /************************************************************************/
 
 void OGRLayerPool::UnchainLayer(OGRAbstractProxiedLayer *poLayer)
+{
+    std::lock_guard oLock(m_oMutex);
+    UnchainLayerUnlocked(poLayer);
+}
+
+/************************************************************************/
+/*                       UnchainLayerUnlocked()                         */
+/************************************************************************/
+
+void OGRLayerPool::UnchainLayerUnlocked(OGRAbstractProxiedLayer *poLayer)
 {
     OGRAbstractProxiedLayer *poPrevLayer = poLayer->poPrevLayer;
     OGRAbstractProxiedLayer *poNextLayer = poLayer->poNextLayer;
@@ -127,6 +164,29 @@ void OGRLayerPool::UnchainLayer(OGRAbstractProxiedLayer *poLayer)
     poLayer->poNextLayer = nullptr;
 }
 
+/************************************************************************/
+/*                              PinLayer()                              */
+/************************************************************************/
+
+/** Prevents (bPin = true) or allows again (bPin = false) the underlying
+ * layer of poLayer to be closed when other layers are opened.
+ *
+ * This is used when layers of the pool are used by several threads.
+ */
+void OGRLayerPool::PinLayer(OGRAbstractProxiedLayer *poLayer, bool bPin)
+{
+    std::lock_guard oLock(m_oMutex);
+    if (bPin)
+    {
+        poLayer->nPinCount++;
+    }
+    else
+    {
+        CPLAssert(poLayer->nPinCount > 0);
+        poLayer->nPinCount--;
+    }
+}
+
 /************************************************************************/
 /*                          OGRProxiedLayer()                           */
 /************************************************************************/
@@ -17,6 +17,8 @@
 
 #include "ogrsf_frmts.h"
 
+#include <mutex>
+
 typedef OGRLayer *(*OpenLayerFunc)(void *user_data);
 typedef void (*ReleaseLayerFunc)(OGRLayer *, void *user_data);
 typedef void (*FreeUserDataFunc)(void *user_data);
@@ -37,6 +39,7 @@ class CPL_DLL OGRAbstractProxiedLayer : public OGRLayer
         *poPrevLayer; /* Chain to a layer that was used more recently */
     OGRAbstractProxiedLayer
         *poNextLayer; /* Chain to a layer that was used less recently */
+    int nPinCount = 0; /* Protected by the mutex of the pool */
 
   protected:
     OGRLayerPool *poPool;
@@ -46,6 +49,9 @@ class CPL_DLL OGRAbstractProxiedLayer : public OGRLayer
   public:
     explicit OGRAbstractProxiedLayer(OGRLayerPool *poPool);
     virtual ~OGRAbstractProxiedLayer();
+
+    void Pin();
+    void Unpin();
 };
 
 /************************************************************************/
@@ -62,6 +68,9 @@ class CPL_DLL OGRLayerPool
         *poLRULayer;  /* the least recently used layer (still opened) */
     int nMRUListSize; /* the size of the list */
     int nMaxSimultaneouslyOpened;
+    std::mutex m_oMutex{};
+
+    void UnchainLayerUnlocked(OGRAbstractProxiedLayer *poProxiedLayer);
 
   public:
     explicit OGRLayerPool(int nMaxSimultaneouslyOpened = 100);
@@ -69,6 +78,7 @@ class CPL_DLL OGRLayerPool
 
     void SetLastUsedLayer(OGRAbstractProxiedLayer *poProxiedLayer);
     void UnchainLayer(OGRAbstractProxiedLayer *poProxiedLayer);
+    void PinLayer(OGRAbstractProxiedLayer *poProxiedLayer, bool bPin);
 
     int GetMaxSimultaneouslyOpened() const
     {
@@ -0,0 +1,523 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRSpatialIndexSidecar class
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrspatialindexsidecar.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+/*
+ * File layout (all values little-endian):
+ *
+ * - header of HEADER_SIZE bytes:
+ *     - magic "GDALSIDX" (8 bytes)
+ *     - version (uint32)
+ *     - node size, i.e. maximum number of children of a node (uint32)
+ *     - size of the data file (uint64)
+ *     - modification time of the data file (int64)
+ *     - number of items (uint64)
+ *     - extent of the items: minx, miny, maxx, maxy (4 doubles)
+ * - nodes of NODE_BYTES bytes each, from the root level to the leaf level:
+ *     - minx, miny, maxx, maxy (4 doubles)
+ *     - for a leaf, offset of the record in the data file; for an internal
+ *       node, index of its first child in the node array (uint64)
+ *     - for a leaf, FID of the feature; unused otherwise (int64)
+ */
+
+constexpr const char SIDX_MAGIC[] = "GDALSIDX";
+constexpr GUInt32 SIDX_VERSION = 1;
+constexpr GUInt32 SIDX_NODE_SIZE = 16;
+constexpr int HEADER_SIZE = 8 + 4 + 4 + 8 + 8 + 8 + 4 * 8;
+constexpr int NODE_BYTES = 4 * 8 + 8 + 8;
+
+/************************************************************************/
+/*                          ComputeLevelBounds()                        */
+/************************************************************************/
+
+/** Return, for each level from the leaves to the root, the index of its
+ * first node in the node array and its number of nodes. */
+static std::vector<std::pair<GUInt64, GUInt64>>
+ComputeLevelBounds(GUInt64 nItemCount)
+{
+    std::vector<GUInt64> anLevelNodeCount;
+    GUInt64 nNodes = nItemCount;
+    anLevelNodeCount.push_back(nNodes);
+    while (nNodes > 1)
+    {
+        nNodes = (nNodes + SIDX_NODE_SIZE - 1) / SIDX_NODE_SIZE;
+        anLevelNodeCount.push_back(nNodes);
+    }
+
+    std::vector<std::pair<GUInt64, GUInt64>> anLevelBounds(
+        anLevelNodeCount.size());
+    GUInt64 nOffset = 0;
+    for (size_t i = anLevelNodeCount.size(); i > 0;)
+    {
+        --i;
+        anLevelBounds[i] = {nOffset, anLevelNodeCount[i]};
+        nOffset += anLevelNodeCount[i];
+    }
+    return anLevelBounds;
+}
+
+/************************************************************************/
+/*                              Hilbert()                               */
+/************************************************************************/
+
+/** Return the index of (nX, nY) along a Hilbert curve of order 16. */
+static GUInt32 Hilbert(GUInt32 nX, GUInt32 nY)
+{
+    constexpr GUInt32 N = 1U << 16;
+    GUInt32 nIdx = 0;
+    for (GUInt32 s = N / 2; s > 0; s /= 2)
+    {
+        const GUInt32 rx = (nX & s) ? 1 : 0;
+        const GUInt32 ry = (nY & s) ? 1 : 0;
+        nIdx += s * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                nX = N - 1 - nX;
+                nY = N - 1 - nY;
+            }
+            std::swap(nX, nY);
+        }
+    }
+    return nIdx;
+}
+
+/************************************************************************/
+/*                        Serialization helpers                         */
+/************************************************************************/
+
+template <class T> static void ToLSB(T &nVal)
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+    if constexpr (sizeof(T) == 4)
+        CPL_LSBPTR32(&nVal);
+    else
+        CPL_LSBPTR64(&nVal);
+}
+
+template <class T> static void Write(GByte *&pabyDst, T nVal)
+{
+    ToLSB(nVal);
+    memcpy(pabyDst, &nVal, sizeof(nVal));
+    pabyDst += sizeof(nVal);
+}
+
+template <class T> static T Read(const GByte *&pabySrc)
+{
+    T nVal;
+    memcpy(&nVal, pabySrc, sizeof(nVal));
+    ToLSB(nVal);
+    pabySrc += sizeof(nVal);
+    return nVal;
+}
+
+static void WriteEnvelope(GByte *&pabyDst, const OGREnvelope &sEnvelope)
+{
+    Write(pabyDst, sEnvelope.MinX);
+    Write(pabyDst, sEnvelope.MinY);
+    Write(pabyDst, sEnvelope.MaxX);
+    Write(pabyDst, sEnvelope.MaxY);
+}
+
+static OGREnvelope ReadEnvelope(const GByte *&pabySrc)
+{
+    OGREnvelope sEnvelope;
+    sEnvelope.MinX = Read<double>(pabySrc);
+    sEnvelope.MinY = Read<double>(pabySrc);
+    sEnvelope.MaxX = Read<double>(pabySrc);
+    sEnvelope.MaxY = Read<double>(pabySrc);
+    return sEnvelope;
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+/** Return the name of the sidecar index file of a data file. */
+std::string
+OGRSpatialIndexSidecar::GetFilename(const std::string &osDataFilename)
+{
+    return osDataFilename + ".sidx";
+}
+
+/************************************************************************/
+/*                             IsEnabled()                              */
+/************************************************************************/
+
+/** Return whether existing sidecar indexes should be used, according to
+ * the OGR_SIDECAR_SPATIAL_INDEX configuration option. */
+bool OGRSpatialIndexSidecar::IsEnabled()
+{
+    const char *pszVal =
+        CPLGetConfigOption("OGR_SIDECAR_SPATIAL_INDEX", "YES");
+    return EQUAL(pszVal, "AUTO") || CPLTestBool(pszVal);
+}
+
+/************************************************************************/
+/*                         IsAutoBuildEnabled()                         */
+/************************************************************************/
+
+/** Return whether a missing or outdated sidecar index should be built by
+ * the first spatially filtered scan of a layer, according to the
+ * OGR_SIDECAR_SPATIAL_INDEX configuration option. */
+bool OGRSpatialIndexSidecar::IsAutoBuildEnabled()
+{
+    return EQUAL(CPLGetConfigOption("OGR_SIDECAR_SPATIAL_INDEX", "YES"),
+                 "AUTO");
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Build the sidecar index of a data file from the envelope, record offset
+ * and FID of its features. Features with an empty geometry should not be
+ * passed. */
+bool OGRSpatialIndexSidecar::Build(const std::string &osDataFilename,
+                                   std::vector<Item> &&aoItems)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osDataFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s",
+                 osDataFilename.c_str());
+        return false;
+    }
+
+    const GUInt64 nItemCount = aoItems.size();
+    OGREnvelope sExtent;
+    for (const auto &oItem : aoItems)
+        sExtent.Merge(oItem.sEnvelope);
+
+    // Sort items along the Hilbert curve of the center of their envelope
+    std::vector<GUInt32> anHilbert(aoItems.size());
+    {
+        const double dfWidth = sExtent.MaxX - sExtent.MinX;
+        const double dfHeight = sExtent.MaxY - sExtent.MinY;
+        constexpr double HILBERT_MAX = (1 << 16) - 1;
+        for (size_t i = 0; i < aoItems.size(); ++i)
+        {
+            const auto &sEnv = aoItems[i].sEnvelope;
+            const double dfX =
+                dfWidth > 0 ? ((sEnv.MinX + sEnv.MaxX) / 2 - sExtent.MinX) /
+                                  dfWidth * HILBERT_MAX
+                            : 0;
+            const double dfY =
+                dfHeight > 0 ? ((sEnv.MinY + sEnv.MaxY) / 2 - sExtent.MinY) /
+                                   dfHeight * HILBERT_MAX
+                             : 0;
+            anHilbert[i] = Hilbert(static_cast<GUInt32>(dfX),
+                                   static_cast<GUInt32>(dfY));
+        }
+    }
+    std::vector<size_t> anOrder(aoItems.size());
+    std::iota(anOrder.begin(), anOrder.end(), 0);
+    std::stable_sort(anOrder.begin(), anOrder.end(),
+                     [&anHilbert](size_t a, size_t b)
+                     { return anHilbert[a] < anHilbert[b]; });
+
+    // Compute the nodes, from the leaves up to the root
+    const auto anLevelBounds = ComputeLevelBounds(nItemCount);
+    const GUInt64 nTotalNodeCount =
+        anLevelBounds[0].first + anLevelBounds[0].second;
+    if (nTotalNodeCount > std::numeric_limits<size_t>::max() / NODE_BYTES)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Too many features to build spatial index");
+        return false;
+    }
+
+    std::vector<OGREnvelope> asNodeEnvelopes;
+    std::vector<GUInt64> anNodeValues;
+    std::vector<GIntBig> anNodeFIDs;
+    try
+    {
+        asNodeEnvelopes.resize(static_cast<size_t>(nTotalNodeCount));
+        anNodeValues.resize(static_cast<size_t>(nTotalNodeCount));
+        anNodeFIDs.resize(static_cast<size_t>(nTotalNodeCount),
+                          OGRNullFID);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory to build spatial index");
+        return false;
+    }
+
+    {
+        size_t iNode = static_cast<size_t>(anLevelBounds[0].first);
+        for (const size_t iItem : anOrder)
+        {
+            asNodeEnvelopes[iNode] = aoItems[iItem].sEnvelope;
+            anNodeValues[iNode] = aoItems[iItem].nOffset;
+            anNodeFIDs[iNode] = aoItems[iItem].nFID;
+            ++iNode;
+        }
+    }
+    aoItems.clear();
+    for (size_t iLevel = 0; iLevel + 1 < anLevelBounds.size(); ++iLevel)
+    {
+        const auto &oChildLevel = anLevelBounds[iLevel];
+        const auto &oParentLevel = anLevelBounds[iLevel + 1];
+        const GUInt64 nChildEnd = oChildLevel.first + oChildLevel.second;
+        for (GUInt64 i = 0; i < oParentLevel.second; ++i)
+        {
+            const size_t iParent = static_cast<size_t>(oParentLevel.first + i);
+            const GUInt64 nFirstChild =
+                oChildLevel.first + i * SIDX_NODE_SIZE;
+            const GUInt64 nLastChild =
+                std::min(nFirstChild + SIDX_NODE_SIZE, nChildEnd);
+            anNodeValues[iParent] = nFirstChild;
+            for (GUInt64 iChild = nFirstChild; iChild < nLastChild; ++iChild)
+            {
+                asNodeEnvelopes[iParent].Merge(
+                    asNodeEnvelopes[static_cast<size_t>(iChild)]);
+            }
+        }
+    }
+
+    // Write the file
+    const std::string osFilename = GetFilename(osDataFilename);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    GByte abyHeader[HEADER_SIZE];
+    GByte *pabyDst = abyHeader;
+    memcpy(pabyDst, SIDX_MAGIC, 8);
+    pabyDst += 8;
+    Write(pabyDst, SIDX_VERSION);
+    Write(pabyDst, SIDX_NODE_SIZE);
+    Write(pabyDst, static_cast<GUInt64>(sStat.st_size));
+    Write(pabyDst, static_cast<GInt64>(sStat.st_mtime));
+    Write(pabyDst, nItemCount);
+    WriteEnvelope(pabyDst, sExtent);
+    bool bOK = VSIFWriteL(abyHeader, HEADER_SIZE, 1, fp) == 1;
+
+    constexpr size_t NODES_PER_CHUNK = 4096;
+    std::vector<GByte> abyChunk(NODES_PER_CHUNK * NODE_BYTES);
+    for (size_t iStart = 0; bOK && iStart < asNodeEnvelopes.size();
+         iStart += NODES_PER_CHUNK)
+    {
+        const size_t iEnd =
+            std::min(iStart + NODES_PER_CHUNK, asNodeEnvelopes.size());
+        pabyDst = abyChunk.data();
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            WriteEnvelope(pabyDst, asNodeEnvelopes[i]);
+            Write(pabyDst, anNodeValues[i]);
+            Write(pabyDst, static_cast<GInt64>(anNodeFIDs[i]));
+        }
+        bOK = VSIFWriteL(abyChunk.data(), NODE_BYTES, iEnd - iStart, fp) ==
+              iEnd - iStart;
+    }
+
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 osFilename.c_str());
+        VSIUnlink(osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Open the sidecar index of a data file.
+ *
+ * Return nullptr if there is no sidecar index, or if it is invalid or
+ * outdated.
+ */
+std::unique_ptr<OGRSpatialIndexSidecar>
+OGRSpatialIndexSidecar::Open(const std::string &osDataFilename)
+{
+    const std::string osFilename = GetFilename(osDataFilename);
+    VSIStatBufL sStat;
+    VSIStatBufL sIndexStat;
+    if (VSIStatL(osDataFilename.c_str(), &sStat) != 0 ||
+        VSIStatL(osFilename.c_str(), &sIndexStat) != 0)
+    {
+        return nullptr;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return nullptr;
+
+    std::unique_ptr<OGRSpatialIndexSidecar> poIndex(
+        new OGRSpatialIndexSidecar());
+    poIndex->m_fp = fp;
+
+    GByte abyHeader[HEADER_SIZE];
+    if (VSIFReadL(abyHeader, HEADER_SIZE, 1, fp) != 1 ||
+        memcmp(abyHeader, SIDX_MAGIC, 8) != 0)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index", osFilename.c_str());
+        return nullptr;
+    }
+    const GByte *pabySrc = abyHeader + 8;
+    const GUInt32 nVersion = Read<GUInt32>(pabySrc);
+    const GUInt32 nNodeSize = Read<GUInt32>(pabySrc);
+    const GUInt64 nDataSize = Read<GUInt64>(pabySrc);
+    const GInt64 nDataMTime = Read<GInt64>(pabySrc);
+    poIndex->m_nItemCount = Read<GUInt64>(pabySrc);
+    poIndex->m_sExtent = ReadEnvelope(pabySrc);
+    if (nVersion != SIDX_VERSION || nNodeSize != SIDX_NODE_SIZE)
+    {
+        CPLDebug("OGR", "%s: unsupported spatial index version",
+                 osFilename.c_str());
+        return nullptr;
+    }
+    if (nDataSize != static_cast<GUInt64>(sStat.st_size) ||
+        nDataMTime != static_cast<GInt64>(sStat.st_mtime))
+    {
+        CPLDebug("OGR", "%s is outdated, and thus ignored",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    if (poIndex->m_nItemCount > 0)
+    {
+        if (poIndex->m_nItemCount >
+            std::numeric_limits<GUInt64>::max() / (2 * NODE_BYTES))
+        {
+            return nullptr;
+        }
+        poIndex->m_anLevelBounds = ComputeLevelBounds(poIndex->m_nItemCount);
+        const auto &oLeaves = poIndex->m_anLevelBounds[0];
+        if (static_cast<GUInt64>(sIndexStat.st_size) !=
+            HEADER_SIZE + (oLeaves.first + oLeaves.second) * NODE_BYTES)
+        {
+            CPLDebug("OGR", "%s has not the expected size",
+                     osFilename.c_str());
+            return nullptr;
+        }
+    }
+
+    return poIndex;
+}
+
+/************************************************************************/
+/*                                Drop()                                */
+/************************************************************************/
+
+/** Remove the sidecar index of a data file, if it exists. */
+bool OGRSpatialIndexSidecar::Drop(const std::string &osDataFilename)
+{
+    const std::string osFilename = GetFilename(osDataFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return true;
+    return VSIUnlink(osFilename.c_str()) == 0;
+}
+
+/************************************************************************/
+/*                      ~OGRSpatialIndexSidecar()                       */
+/************************************************************************/
+
+OGRSpatialIndexSidecar::~OGRSpatialIndexSidecar()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Return the items whose envelope intersects sFilter, sorted by
+ * increasing offset in the data file. */
+bool OGRSpatialIndexSidecar::Search(const OGREnvelope &sFilter,
+                                    std::vector<Item> &aoResults)
+{
+    aoResults.clear();
+    if (m_nItemCount == 0 || !sFilter.Intersects(m_sExtent))
+        return true;
+
+    // Pairs of (index of the first node of a group of siblings, level)
+    std::vector<std::pair<GUInt64, size_t>> aoStack;
+    aoStack.emplace_back(0, m_anLevelBounds.size() - 1);
+    std::vector<GByte> abyNodes(SIDX_NODE_SIZE * NODE_BYTES);
+    while (!aoStack.empty())
+    {
+        const auto [nFirstNode, iLevel] = aoStack.back();
+        aoStack.pop_back();
+
+        const auto &oLevel = m_anLevelBounds[iLevel];
+        const GUInt64 nLevelEnd = oLevel.first + oLevel.second;
+        if (nFirstNode < oLevel.first || nFirstNode >= nLevelEnd)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Corrupted spatial index: invalid node index");
+            return false;
+        }
+        const size_t nNodes = static_cast<size_t>(
+            std::min<GUInt64>(SIDX_NODE_SIZE, nLevelEnd - nFirstNode));
+        if (VSIFSeekL(m_fp, HEADER_SIZE + nFirstNode * NODE_BYTES,
+                      SEEK_SET) != 0 ||
+            VSIFReadL(abyNodes.data(), NODE_BYTES, nNodes, m_fp) != nNodes)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read nodes of spatial index");
+            return false;
+        }
+
+        const GByte *pabySrc = abyNodes.data();
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            const OGREnvelope sEnvelope = ReadEnvelope(pabySrc);
+            const GUInt64 nValue = Read<GUInt64>(pabySrc);
+            const GInt64 nFID = Read<GInt64>(pabySrc);
+            if (!sEnvelope.Intersects(sFilter))
+                continue;
+            if (iLevel == 0)
+            {
+                Item oItem;
+                oItem.sEnvelope = sEnvelope;
+                oItem.nOffset = static_cast<vsi_l_offset>(nValue);
+                oItem.nFID = static_cast<GIntBig>(nFID);
+                aoResults.push_back(oItem);
+            }
+            else
+            {
+                aoStack.emplace_back(nValue, iLevel - 1);
+            }
+        }
+    }
+
+    std::sort(aoResults.begin(), aoResults.end(),
+              [](const Item &a, const Item &b)
+              { return a.nOffset < b.nOffset; });
+    return true;
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Defines OGRSpatialIndexSidecar class
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRSPATIALINDEXSIDECAR_H_INCLUDED
+#define OGRSPATIALINDEXSIDECAR_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_vsi.h"
+#include "ogr_core.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                        OGRSpatialIndexSidecar                        */
+/************************************************************************/
+
+/** Persistent spatial index, stored in a "<datafile>.sidx" file next to the
+ * data file, for drivers of formats that have no native spatial index.
+ *
+ * The index is a packed Hilbert R-tree of the envelopes of the features,
+ * whose leaves point to the offset in the data file of the record of each
+ * feature, and to its FID. It records the size and modification time of the
+ * data file at the time it was built, and is ignored once they change.
+ */
+class CPL_DLL OGRSpatialIndexSidecar
+{
+  public:
+    /** Indexed feature */
+    struct Item
+    {
+        OGREnvelope sEnvelope{};
+        vsi_l_offset nOffset = 0;
+        GIntBig nFID = OGRNullFID;
+    };
+
+    static std::string GetFilename(const std::string &osDataFilename);
+
+    static bool IsEnabled();
+    static bool IsAutoBuildEnabled();
+
+    static bool Build(const std::string &osDataFilename,
+                      std::vector<Item> &&aoItems);
+
+    static std::unique_ptr<OGRSpatialIndexSidecar>
+    Open(const std::string &osDataFilename);
+
+    static bool Drop(const std::string &osDataFilename);
+
+    ~OGRSpatialIndexSidecar();
+
+    /** Return the number of indexed features */
+    GUInt64 GetItemCount() const
+    {
+        return m_nItemCount;
+    }
+
+    /** Return the union of the envelopes of indexed features */
+    const OGREnvelope &GetExtent() const
+    {
+        return m_sExtent;
+    }
+
+    bool Search(const OGREnvelope &sFilter, std::vector<Item> &aoResults);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRSpatialIndexSidecar)
+
+    VSILFILE *m_fp = nullptr;
+    GUInt64 m_nItemCount = 0;
+    OGREnvelope m_sExtent{};
+
+    // Index of the first node of each level in the node array, and number
+    // of nodes of the level. Level 0 is the leaves, which are stored last.
+    std::vector<std::pair<GUInt64, GUInt64>> m_anLevelBounds{};
+
+    OGRSpatialIndexSidecar() = default;
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* OGRSPATIALINDEXSIDECAR_H_INCLUDED */
@@ -13,8 +13,16 @@
 #ifndef DOXYGEN_SKIP
 
 #include "ogrunionlayer.h"
+#include "ogrlayerpool.h"
 #include "ogrwarpedlayer.h"
 #include "ogr_p.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 /************************************************************************/
 /*                      OGRUnionLayerGeomFieldDefn()                    */
@@ -74,6 +82,12 @@ OGRUnionLayer::OGRUnionLayer(const char *pszName, int nSrcLayersIn,
     CPLAssert(nSrcLayersIn > 0);
 
     SetDescription(pszName);
+
+    for (int i = 0; i < nSrcLayers; i++)
+    {
+        m_apoProxiedSrcLayers.push_back(
+            dynamic_cast<OGRAbstractProxiedLayer *>(papoSrcLayers[i]));
+    }
 }
 
 /************************************************************************/
@@ -82,6 +96,9 @@ OGRUnionLayer::OGRUnionLayer(const char *pszName, int nSrcLayersIn,
 
 OGRUnionLayer::~OGRUnionLayer()
 {
+    StopParallelScan();
+    m_poThreadPool.reset();
+
     if (bHasLayerOwnership)
     {
         for (int i = 0; i < nSrcLayers; i++)
@@ -97,7 +114,6 @@ OGRUnionLayer::~OGRUnionLayer()
     CPLFree(papoGeomFields);
 
     CPLFree(pszAttributeFilter);
-    CPLFree(panMap);
     CPLFree(pabModifiedLayers);
     CPLFree(pabCheckIfAutoWrap);
 
@@ -174,6 +190,120 @@ void OGRUnionLayer::SetFeatureCount(int nFeatureCountIn)
     nFeatureCount = nFeatureCountIn;
 }
 
+/************************************************************************/
+/*                            SetNumThreads()                           */
+/************************************************************************/
+
+/** Sets the number of threads used to open and read source layers.
+ *
+ * With several threads, source layers are read ahead concurrently by
+ * GetNextFeature(), and GetFeatureCount() and GetExtent() query them
+ * concurrently. Source layers must then not share a dataset.
+ * If bPreserveSourceOrder is false, features from the source layers being
+ * read are returned as soon as they are available, and their order, and
+ * their FID if PreserveSrcFID is not set, is not deterministic.
+ */
+void OGRUnionLayer::SetNumThreads(int nNumThreads, bool bPreserveSourceOrder)
+{
+    CPLAssert(poFeatureDefn == nullptr);
+
+    m_nNumThreads = std::max(1, std::min(nNumThreads, nSrcLayers));
+    m_bPreserveSourceOrder = bPreserveSourceOrder;
+}
+
+/************************************************************************/
+/*                            GetThreadPool()                           */
+/************************************************************************/
+
+CPLWorkerThreadPool *OGRUnionLayer::GetThreadPool()
+{
+    if (m_nNumThreads <= 1)
+        return nullptr;
+    if (!m_poThreadPool)
+    {
+        m_poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!m_poThreadPool->Setup(m_nNumThreads, nullptr, nullptr))
+        {
+            m_poThreadPool.reset();
+            m_nNumThreads = 1;
+        }
+    }
+    return m_poThreadPool.get();
+}
+
+/************************************************************************/
+/*                            PinSourceLayer()                          */
+/************************************************************************/
+
+// Prevents a source layer proxied by a OGRLayerPool from being closed
+// while it is used by a worker thread.
+void OGRUnionLayer::PinSourceLayer(int iSrcLayer, bool bPin)
+{
+    OGRAbstractProxiedLayer *poProxiedLayer =
+        m_apoProxiedSrcLayers[iSrcLayer];
+    if (poProxiedLayer)
+    {
+        if (bPin)
+            poProxiedLayer->Pin();
+        else
+            poProxiedLayer->Unpin();
+    }
+}
+
+/************************************************************************/
+/*                          ForEachSourceLayer()                        */
+/************************************************************************/
+
+// Calls oFunc() for each source layer index, concurrently if several
+// threads are configured. oFunc() must only access its source layer.
+void OGRUnionLayer::ForEachSourceLayer(const std::function<void(int)> &oFunc)
+{
+    CPLAssert(!m_poParallelScan);
+
+    CPLWorkerThreadPool *poThreadPool = GetThreadPool();
+    if (!poThreadPool)
+    {
+        for (int i = 0; i < nSrcLayers; i++)
+            oFunc(i);
+        return;
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nSrcLayers; i++)
+    {
+        poJobQueue->SubmitJob(
+            [this, &oFunc, &oErrorAccumulator, i]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                PinSourceLayer(i, true);
+                oFunc(i);
+                PinSourceLayer(i, false);
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+}
+
+/************************************************************************/
+/*                        FetchSourceLayerDefns()                       */
+/************************************************************************/
+
+// Opens all source layers and fetches their layer definition, concurrently
+// if several threads are configured.
+void OGRUnionLayer::FetchSourceLayerDefns()
+{
+    if (m_bSrcLayerDefnsFetched)
+        return;
+    m_bSrcLayerDefnsFetched = true;
+    if (m_nNumThreads > 1)
+    {
+        ForEachSourceLayer([this](int iSrcLayer)
+                           { papoSrcLayers[iSrcLayer]->GetLayerDefn(); });
+    }
+}
+
 /************************************************************************/
 /*                         MergeFieldDefn()                             */
 /************************************************************************/
@@ -309,6 +439,8 @@ OGRFeatureDefn *OGRUnionLayer::GetLayerDefn()
                     papoGeomFields[0]));
         }
 
+        FetchSourceLayerDefns();
+
         int nDstFieldCount = 0;
         std::map<std::string, int> oMapDstFieldNameToIdx;
 
@@ -391,6 +523,8 @@ OGRFeatureDefn *OGRUnionLayer::GetLayerDefn()
     }
     else if (eFieldStrategy == FIELD_INTERSECTION_ALL_LAYERS)
     {
+        FetchSourceLayerDefns();
+
         OGRFeatureDefn *poSrcFeatureDefn = papoSrcLayers[0]->GetLayerDefn();
         for (int i = 0; i < poSrcFeatureDefn->GetFieldCount(); i++)
             poFeatureDefn->AddFieldDefn(poSrcFeatureDefn->GetFieldDefn(i));
@@ -499,15 +633,28 @@ void OGRUnionLayer::SetSpatialFilterToSourceLayer(OGRLayer *poSrcLayer)
 
 void OGRUnionLayer::ConfigureActiveLayer()
 {
-    AutoWarpLayerIfNecessary(iCurLayer);
-    ApplyAttributeFilterToSrcLayer(iCurLayer);
-    SetSpatialFilterToSourceLayer(papoSrcLayers[iCurLayer]);
-    papoSrcLayers[iCurLayer]->ResetReading();
+    m_anMap = ConfigureSourceLayer(iCurLayer);
+}
+
+/************************************************************************/
+/*                        ConfigureSourceLayer()                        */
+/************************************************************************/
+
+// Applies filters and ignored fields to a source layer, resets its reading,
+// and returns the map from its fields to the fields of the union layer.
+// Only accesses papoSrcLayers[iSrcLayer], so that it can be called from a
+// worker thread once GetLayerDefn() has been called.
+std::vector<int> OGRUnionLayer::ConfigureSourceLayer(int iSrcLayer)
+{
+    AutoWarpLayerIfNecessary(iSrcLayer);
+    ApplyAttributeFilterToSrcLayer(iSrcLayer);
+    SetSpatialFilterToSourceLayer(papoSrcLayers[iSrcLayer]);
+    papoSrcLayers[iSrcLayer]->ResetReading();
 
     /* Establish map */
     GetLayerDefn();
     const OGRFeatureDefn *poSrcFeatureDefn =
-        papoSrcLayers[iCurLayer]->GetLayerDefn();
+        papoSrcLayers[iSrcLayer]->GetLayerDefn();
     const int nSrcFieldCount = poSrcFeatureDefn->GetFieldCount();
     const int nDstFieldCount = poFeatureDefn->GetFieldCount();
 
@@ -518,8 +665,7 @@ void OGRUnionLayer::ConfigureActiveLayer()
         oMapDstFieldNameToIdx[poDstFieldDefn->GetNameRef()] = i;
     }
 
-    CPLFree(panMap);
-    panMap = static_cast<int *>(CPLMalloc(nSrcFieldCount * sizeof(int)));
+    std::vector<int> anMap(nSrcFieldCount);
     for (int i = 0; i < nSrcFieldCount; i++)
     {
         const OGRFieldDefn *poSrcFieldDefn = poSrcFeatureDefn->GetFieldDefn(i);
@@ -527,16 +673,16 @@ void OGRUnionLayer::ConfigureActiveLayer()
         {
             const auto oIter =
                 oMapDstFieldNameToIdx.find(poSrcFieldDefn->GetNameRef());
-            panMap[i] =
+            anMap[i] =
                 oIter == oMapDstFieldNameToIdx.end() ? -1 : oIter->second;
         }
         else
         {
-            panMap[i] = -1;
+            anMap[i] = -1;
         }
     }
 
-    if (papoSrcLayers[iCurLayer]->TestCapability(OLCIgnoreFields))
+    if (papoSrcLayers[iSrcLayer]->TestCapability(OLCIgnoreFields))
     {
         CPLStringList aosFieldSrc;
         for (const char *pszFieldName : cpl::Iterate(m_aosIgnoredFields))
@@ -605,8 +751,10 @@ void OGRUnionLayer::ConfigureActiveLayer()
             }
         }
 
-        papoSrcLayers[iCurLayer]->SetIgnoredFields(aosFieldSrc.List());
+        papoSrcLayers[iSrcLayer]->SetIgnoredFields(aosFieldSrc.List());
     }
+
+    return anMap;
 }
 
 /************************************************************************/
@@ -615,8 +763,12 @@ void OGRUnionLayer::ConfigureActiveLayer()
 
 void OGRUnionLayer::ResetReading()
 {
+    StopParallelScan();
     iCurLayer = 0;
-    ConfigureActiveLayer();
+    // With several threads, source layers are configured by the workers
+    // started by the first call to GetNextFeature().
+    if (!GetThreadPool())
+        ConfigureActiveLayer();
     nNextFID = 0;
 }
 
@@ -687,6 +839,203 @@ void OGRUnionLayer::AutoWarpLayerIfNecessary(int iLayer)
     }
 }
 
+/************************************************************************/
+/*                        OGRUnionLayer::ParallelScan                   */
+/************************************************************************/
+
+// State of the reading of source layers by worker threads
+struct OGRUnionLayer::ParallelScan
+{
+    // Maximum number of features read ahead for each source layer
+    static constexpr size_t MAX_QUEUED_FEATURES = 1000;
+
+    struct Source
+    {
+        std::deque<std::unique_ptr<OGRFeature>> apoFeatures{};
+        bool bFinished = false;
+    };
+
+    std::mutex oMutex{};
+    // Notified by workers when they queue a feature or finish their source
+    std::condition_variable oCVFeatureQueued{};
+    // Notified when a full queue is no longer full, or when stopping
+    std::condition_variable oCVFeatureDequeued{};
+    std::vector<Source> asSources{};
+    // Index of the next source layer to start reading
+    int iNextSrcLayer = 0;
+    // Source layers being read, or not yet fully consumed, in index order
+    std::vector<int> anActiveSrcLayers{};
+    bool bStop = false;
+    CPLErrorAccumulator oErrorAccumulator{};
+    CPLJobQueuePtr poJobQueue{};
+};
+
+/************************************************************************/
+/*                          StartParallelScan()                         */
+/************************************************************************/
+
+void OGRUnionLayer::StartParallelScan()
+{
+    CPLAssert(!m_poParallelScan);
+
+    // Make sure that state lazily computed from source layers is available
+    // before workers access them.
+    GetLayerDefn();
+    GetSpatialRef();
+    GetAttrFilterPassThroughValue();
+
+    CPLWorkerThreadPool *poThreadPool = GetThreadPool();
+    CPLAssert(poThreadPool);
+    m_poParallelScan = std::make_unique<ParallelScan>();
+    m_poParallelScan->asSources =
+        std::vector<ParallelScan::Source>(nSrcLayers);
+    m_poParallelScan->poJobQueue = poThreadPool->CreateJobQueue();
+}
+
+/************************************************************************/
+/*                           ScanSourceLayer()                          */
+/************************************************************************/
+
+// Run by a worker thread: reads the features of a source layer, and queues
+// them translated to the union layer definition.
+void OGRUnionLayer::ScanSourceLayer(int iSrcLayer)
+{
+    ParallelScan &oScan = *m_poParallelScan;
+    ParallelScan::Source &oSource = oScan.asSources[iSrcLayer];
+
+    auto oAccumulator = oScan.oErrorAccumulator.InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    bool bStop;
+    {
+        std::lock_guard oLock(oScan.oMutex);
+        bStop = oScan.bStop;
+    }
+
+    if (!bStop)
+    {
+        PinSourceLayer(iSrcLayer, true);
+
+        const std::vector<int> anMap = ConfigureSourceLayer(iSrcLayer);
+        OGRLayer *poSrcLayer = papoSrcLayers[iSrcLayer];
+        while (true)
+        {
+            std::unique_ptr<OGRFeature> poSrcFeature(
+                poSrcLayer->GetNextFeature());
+            if (!poSrcFeature)
+                break;
+            std::unique_ptr<OGRFeature> poFeature(
+                TranslateFromSrcLayer(poSrcFeature.get(), iSrcLayer, anMap));
+
+            std::unique_lock oLock(oScan.oMutex);
+            oScan.oCVFeatureDequeued.wait(
+                oLock,
+                [&oScan, &oSource]()
+                {
+                    return oScan.bStop ||
+                           oSource.apoFeatures.size() <
+                               ParallelScan::MAX_QUEUED_FEATURES;
+                });
+            if (oScan.bStop)
+                break;
+            oSource.apoFeatures.push_back(std::move(poFeature));
+            oScan.oCVFeatureQueued.notify_one();
+        }
+
+        PinSourceLayer(iSrcLayer, false);
+    }
+
+    std::lock_guard oLock(oScan.oMutex);
+    oSource.bFinished = true;
+    oScan.oCVFeatureQueued.notify_one();
+}
+
+/************************************************************************/
+/*                    GetNextFeatureFromParallelScan()                  */
+/************************************************************************/
+
+// Returns the next feature read by worker threads, translated to the union
+// layer definition, but without FID assigned (unless PreserveSrcFID is set)
+// and not filtered. Returns nullptr once all source layers have been read.
+OGRFeature *OGRUnionLayer::GetNextFeatureFromParallelScan()
+{
+    ParallelScan &oScan = *m_poParallelScan;
+    std::unique_lock oLock(oScan.oMutex);
+    while (true)
+    {
+        // Start reading other source layers, so that there are up to
+        // m_nNumThreads source layers read ahead.
+        while (static_cast<int>(oScan.anActiveSrcLayers.size()) <
+                   m_nNumThreads &&
+               oScan.iNextSrcLayer < nSrcLayers)
+        {
+            const int iSrcLayer = oScan.iNextSrcLayer++;
+            oScan.anActiveSrcLayers.push_back(iSrcLayer);
+            oScan.poJobQueue->SubmitJob([this, iSrcLayer]()
+                                        { ScanSourceLayer(iSrcLayer); });
+        }
+
+        if (oScan.anActiveSrcLayers.empty())
+            return nullptr;
+
+        // When preserving the source order, only the first source layer
+        // being read may be consumed.
+        const size_t nCandidates =
+            m_bPreserveSourceOrder ? 1 : oScan.anActiveSrcLayers.size();
+        bool bSourceFinished = false;
+        for (size_t i = 0; i < nCandidates; ++i)
+        {
+            ParallelScan::Source &oSource =
+                oScan.asSources[oScan.anActiveSrcLayers[i]];
+            if (!oSource.apoFeatures.empty())
+            {
+                auto poFeature = std::move(oSource.apoFeatures.front());
+                oSource.apoFeatures.pop_front();
+                if (oSource.apoFeatures.size() + 1 ==
+                    ParallelScan::MAX_QUEUED_FEATURES)
+                {
+                    oScan.oCVFeatureDequeued.notify_all();
+                }
+                return poFeature.release();
+            }
+            if (oSource.bFinished)
+            {
+                oScan.anActiveSrcLayers.erase(
+                    oScan.anActiveSrcLayers.begin() + i);
+                bSourceFinished = true;
+                break;
+            }
+        }
+
+        if (!bSourceFinished)
+            oScan.oCVFeatureQueued.wait(oLock);
+    }
+}
+
+/************************************************************************/
+/*                          StopParallelScan()                          */
+/************************************************************************/
+
+// Stops worker threads, if a parallel scan is in progress. If it was not
+// complete, the next call to GetNextFeature() restarts from the beginning.
+void OGRUnionLayer::StopParallelScan()
+{
+    if (!m_poParallelScan)
+        return;
+
+    {
+        std::lock_guard oLock(m_poParallelScan->oMutex);
+        m_poParallelScan->bStop = true;
+    }
+    m_poParallelScan->oCVFeatureDequeued.notify_all();
+    m_poParallelScan->poJobQueue->WaitCompletion();
+    m_poParallelScan->oErrorAccumulator.ReplayErrors();
+    m_poParallelScan.reset();
+
+    if (iCurLayer != nSrcLayers)
+        iCurLayer = -1;
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -701,23 +1050,44 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
     if (iCurLayer == nSrcLayers)
         return nullptr;
 
+    if (!m_poParallelScan && GetThreadPool())
+        StartParallelScan();
+
     while (true)
     {
-        OGRFeature *poSrcFeature = papoSrcLayers[iCurLayer]->GetNextFeature();
-        if (poSrcFeature == nullptr)
+        OGRFeature *poFeature;
+        if (m_poParallelScan)
         {
-            iCurLayer++;
-            if (iCurLayer < nSrcLayers)
+            poFeature = GetNextFeatureFromParallelScan();
+            if (poFeature == nullptr)
             {
-                ConfigureActiveLayer();
-                continue;
-            }
-            else
+                iCurLayer = nSrcLayers;
+                StopParallelScan();
                 break;
+            }
+        }
+        else
+        {
+            OGRFeature *poSrcFeature =
+                papoSrcLayers[iCurLayer]->GetNextFeature();
+            if (poSrcFeature == nullptr)
+            {
+                iCurLayer++;
+                if (iCurLayer < nSrcLayers)
+                {
+                    ConfigureActiveLayer();
+                    continue;
+                }
+                else
+                    break;
+            }
+
+            poFeature = TranslateFromSrcLayer(poSrcFeature, iCurLayer, m_anMap);
+            delete poSrcFeature;
         }
 
-        OGRFeature *poFeature = TranslateFromSrcLayer(poSrcFeature);
-        delete poSrcFeature;
+        if (!bPreserveSrcFID)
+            poFeature->SetFID(nNextFID++);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
@@ -737,6 +1107,8 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
 
 OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
 {
+    StopParallelScan();
+
     OGRFeature *poFeature = nullptr;
 
     if (!bPreserveSrcFID)
@@ -758,7 +1130,7 @@ OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
             OGRFeature *poSrcFeature = papoSrcLayers[i]->GetFeature(nFeatureId);
             if (poSrcFeature != nullptr)
             {
-                poFeature = TranslateFromSrcLayer(poSrcFeature);
+                poFeature = TranslateFromSrcLayer(poSrcFeature, i, m_anMap);
                 delete poSrcFeature;
 
                 break;
@@ -780,6 +1152,8 @@ OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
 
 OGRErr OGRUnionLayer::ICreateFeature(OGRFeature *poFeature)
 {
+    StopParallelScan();
+
     if (osSourceLayerFieldName.empty())
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -833,6 +1207,8 @@ OGRErr OGRUnionLayer::ICreateFeature(OGRFeature *poFeature)
 
 OGRErr OGRUnionLayer::ISetFeature(OGRFeature *poFeature)
 {
+    StopParallelScan();
+
     if (!bPreserveSrcFID)
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -913,6 +1289,8 @@ OGRErr OGRUnionLayer::IUpdateFeature(OGRFeature *poFeature,
                                      const int *panUpdatedGeomFieldsIdx,
                                      bool bUpdateStyleString)
 {
+    StopParallelScan();
+
     if (!bPreserveSrcFID)
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -1037,6 +1415,8 @@ int OGRUnionLayer::GetAttrFilterPassThroughValue()
     if (bAttrFilterPassThroughValue >= 0)
         return bAttrFilterPassThroughValue;
 
+    FetchSourceLayerDefns();
+
     char **papszUsedFields = m_poAttrQuery->GetUsedFields();
     int bRet = TRUE;
 
@@ -1098,17 +1478,24 @@ GIntBig OGRUnionLayer::GetFeatureCount(int bForce)
         return nFeatureCount;
     }
 
+    StopParallelScan();
+
     if (!GetAttrFilterPassThroughValue())
         return OGRLayer::GetFeatureCount(bForce);
 
+    GetLayerDefn();
+    std::vector<GIntBig> anCounts(nSrcLayers);
+    ForEachSourceLayer(
+        [this, bForce, &anCounts](int i)
+        {
+            AutoWarpLayerIfNecessary(i);
+            ApplyAttributeFilterToSrcLayer(i);
+            SetSpatialFilterToSourceLayer(papoSrcLayers[i]);
+            anCounts[i] = papoSrcLayers[i]->GetFeatureCount(bForce);
+        });
     GIntBig nRet = 0;
-    for (int i = 0; i < nSrcLayers; i++)
-    {
-        AutoWarpLayerIfNecessary(i);
-        ApplyAttributeFilterToSrcLayer(i);
-        SetSpatialFilterToSourceLayer(papoSrcLayers[i]);
-        nRet += papoSrcLayers[i]->GetFeatureCount(bForce);
-    }
+    for (const GIntBig nCount : anCounts)
+        nRet += nCount;
     ResetReading();
     return nRet;
 }
@@ -1128,6 +1515,8 @@ OGRErr OGRUnionLayer::SetAttributeFilter(const char *pszAttributeFilterIn)
     if (poFeatureDefn == nullptr)
         GetLayerDefn();
 
+    StopParallelScan();
+
     bAttrFilterPassThroughValue = -1;
 
     OGRErr eErr = OGRLayer::SetAttributeFilter(pszAttributeFilterIn);
@@ -1150,6 +1539,8 @@ OGRErr OGRUnionLayer::SetAttributeFilter(const char *pszAttributeFilterIn)
 
 int OGRUnionLayer::TestCapability(const char *pszCap)
 {
+    StopParallelScan();
+
     if (EQUAL(pszCap, OLCFastFeatureCount))
     {
         if (nFeatureCount >= 0 && m_poFilterGeom == nullptr &&
@@ -1278,29 +1669,40 @@ OGRErr OGRUnionLayer::IGetExtent(int iGeomField, OGREnvelope *psExtent,
         return OGRERR_FAILURE;
     }
 
+    StopParallelScan();
+
+    const char *pszGeomFieldName =
+        GetLayerDefn()->GetGeomFieldDefn(iGeomField)->GetNameRef();
+    std::vector<OGREnvelope> asExtents(nSrcLayers);
+    std::vector<bool> abExtentValid(nSrcLayers);
+    ForEachSourceLayer(
+        [this, pszGeomFieldName, bForce, &asExtents, &abExtentValid](int i)
+        {
+            AutoWarpLayerIfNecessary(i);
+            int iSrcGeomField =
+                papoSrcLayers[i]->GetLayerDefn()->GetGeomFieldIndex(
+                    pszGeomFieldName);
+            if (iSrcGeomField >= 0)
+            {
+                abExtentValid[i] =
+                    papoSrcLayers[i]->GetExtent(iSrcGeomField, &asExtents[i],
+                                                bForce) == OGRERR_NONE;
+            }
+        });
+
     int bInit = FALSE;
     for (int i = 0; i < nSrcLayers; i++)
     {
-        AutoWarpLayerIfNecessary(i);
-        int iSrcGeomField = papoSrcLayers[i]->GetLayerDefn()->GetGeomFieldIndex(
-            GetLayerDefn()->GetGeomFieldDefn(iGeomField)->GetNameRef());
-        if (iSrcGeomField >= 0)
+        if (!abExtentValid[i])
+            continue;
+        if (!bInit)
         {
-            if (!bInit)
-            {
-                if (papoSrcLayers[i]->GetExtent(iSrcGeomField, psExtent,
-                                                bForce) == OGRERR_NONE)
-                    bInit = TRUE;
-            }
-            else
-            {
-                OGREnvelope sExtent;
-                if (papoSrcLayers[i]->GetExtent(iSrcGeomField, &sExtent,
-                                                bForce) == OGRERR_NONE)
-                {
-                    psExtent->Merge(sExtent);
-                }
-            }
+            *psExtent = asExtents[i];
+            bInit = TRUE;
+        }
+        else
+        {
+            psExtent->Merge(asExtents[i]);
         }
     }
     return (bInit) ? OGRERR_NONE : OGRERR_FAILURE;
@@ -1313,6 +1715,8 @@ OGRErr OGRUnionLayer::IGetExtent(int iGeomField, OGREnvelope *psExtent,
 OGRErr OGRUnionLayer::ISetSpatialFilter(int iGeomField,
                                         const OGRGeometry *poGeom)
 {
+    StopParallelScan();
+
     m_iGeomFieldFilter = iGeomField;
     if (InstallFilter(poGeom))
         ResetReading();
@@ -1329,18 +1733,22 @@ OGRErr OGRUnionLayer::ISetSpatialFilter(int iGeomField,
 /*                        TranslateFromSrcLayer()                       */
 /************************************************************************/
 
-OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
+// The FID of the returned feature is only set if PreserveSrcFID is set.
+OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature,
+                                                 int iSrcLayer,
+                                                 const std::vector<int> &anMap)
 {
-    CPLAssert(poSrcFeature->GetFieldCount() == 0 || panMap != nullptr);
-    CPLAssert(iCurLayer >= 0 && iCurLayer < nSrcLayers);
+    CPLAssert(poSrcFeature->GetFieldCount() ==
+              static_cast<int>(anMap.size()));
+    CPLAssert(iSrcLayer >= 0 && iSrcLayer < nSrcLayers);
 
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
-    poFeature->SetFrom(poSrcFeature, panMap, TRUE);
+    poFeature->SetFrom(poSrcFeature, anMap.data(), TRUE);
 
     if (!osSourceLayerFieldName.empty() &&
         !poFeatureDefn->GetFieldDefn(0)->IsIgnored())
     {
-        poFeature->SetField(0, papoSrcLayers[iCurLayer]->GetName());
+        poFeature->SetField(0, papoSrcLayers[iSrcLayer]->GetName());
     }
 
     for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
@@ -1360,8 +1768,6 @@ OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
 
     if (bPreserveSrcFID)
         poFeature->SetFID(poSrcFeature->GetFID());
-    else
-        poFeature->SetFID(nNextFID++);
     return poFeature;
 }
 
@@ -1371,6 +1777,8 @@ OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
 
 OGRErr OGRUnionLayer::SetIgnoredFields(CSLConstList papszFields)
 {
+    StopParallelScan();
+
     OGRErr eErr = OGRLayer::SetIgnoredFields(papszFields);
     if (eErr != OGRERR_NONE)
         return eErr;
@@ -1386,6 +1794,8 @@ OGRErr OGRUnionLayer::SetIgnoredFields(CSLConstList papszFields)
 
 OGRErr OGRUnionLayer::SyncToDisk()
 {
+    StopParallelScan();
+
     for (int i = 0; i < nSrcLayers; i++)
     {
         if (pabModifiedLayers[i])
@@ -17,6 +17,13 @@
 
 #include "ogrsf_frmts.h"
 
+#include <functional>
+#include <memory>
+#include <vector>
+
+class CPLWorkerThreadPool;
+class OGRAbstractProxiedLayer;
+
 /************************************************************************/
 /*                      OGRUnionLayerGeomFieldDefn                      */
 /************************************************************************/
@@ -72,20 +79,40 @@ class CPL_DLL OGRUnionLayer final : public OGRLayer
     int iCurLayer = -1;
     char *pszAttributeFilter = nullptr;
     int nNextFID = 0;
-    int *panMap = nullptr;
+    std::vector<int> m_anMap{};
     CPLStringList m_aosIgnoredFields{};
     int bAttrFilterPassThroughValue = -1;
     int *pabModifiedLayers = nullptr;
     int *pabCheckIfAutoWrap = nullptr;
     const OGRSpatialReference *poGlobalSRS = nullptr;
 
+    // Parallel scanning of source layers, see SetNumThreads()
+    int m_nNumThreads = 1;
+    bool m_bPreserveSourceOrder = true;
+    bool m_bSrcLayerDefnsFetched = false;
+    std::vector<OGRAbstractProxiedLayer *> m_apoProxiedSrcLayers{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    struct ParallelScan;
+    std::unique_ptr<ParallelScan> m_poParallelScan{};
+
     void AutoWarpLayerIfNecessary(int iSubLayer);
-    OGRFeature *TranslateFromSrcLayer(OGRFeature *poSrcFeature);
+    OGRFeature *TranslateFromSrcLayer(OGRFeature *poSrcFeature, int iSrcLayer,
+                                      const std::vector<int> &anMap);
     void ApplyAttributeFilterToSrcLayer(int iSubLayer);
     int GetAttrFilterPassThroughValue();
     void ConfigureActiveLayer();
+    std::vector<int> ConfigureSourceLayer(int iSrcLayer);
     void SetSpatialFilterToSourceLayer(OGRLayer *poSrcLayer);
 
+    CPLWorkerThreadPool *GetThreadPool();
+    void PinSourceLayer(int iSrcLayer, bool bPin);
+    void ForEachSourceLayer(const std::function<void(int)> &oFunc);
+    void FetchSourceLayerDefns();
+    void StartParallelScan();
+    void ScanSourceLayer(int iSrcLayer);
+    OGRFeature *GetNextFeatureFromParallelScan();
+    void StopParallelScan();
+
   public:
     OGRUnionLayer(
         const char *pszName, int nSrcLayers, /* must be >= 1 */
@@ -108,6 +135,7 @@ class CPL_DLL OGRUnionLayer final : public OGRLayer
     void SetSourceLayerFieldName(const char *pszSourceLayerFieldName);
     void SetPreserveSrcFID(int bPreserveSrcFID);
     void SetFeatureCount(int nFeatureCount);
+    void SetNumThreads(int nNumThreads, bool bPreserveSourceOrder);
 
     virtual const char *GetName() override
     {
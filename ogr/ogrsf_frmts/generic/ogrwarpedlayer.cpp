@@ -12,10 +12,19 @@
 
 #ifndef DOXYGEN_SKIP
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "ogrwarpedlayer.h"
 
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
+#include "ogr_wkb.h"
+#include "ogrlayerarrow.h"
+
 /************************************************************************/
 /*                          OGRWarpedLayer()                            */
 /************************************************************************/
@@ -512,8 +521,10 @@ int OGRWarpedLayer::TestCapability(const char *pszCapability)
 
     int bVal = m_poDecoratedLayer->TestCapability(pszCapability);
 
+    // GetArrowStream() reprojects the batches of the decorated layer, but
+    // it cannot apply a spatial filter expressed in the target CRS.
     if (EQUAL(pszCapability, OLCFastGetArrowStream))
-        return false;
+        return bVal && m_poFilterGeom == nullptr;
 
     if (EQUAL(pszCapability, OLCFastSpatialFilter) ||
         EQUAL(pszCapability, OLCRandomWrite) ||
@@ -544,6 +555,267 @@ void OGRWarpedLayer::SetExtent(double dfXMin, double dfYMin, double dfXMax,
     sStaticEnvelope.MaxY = dfYMax;
 }
 
+/************************************************************************/
+/*                     OGRWarpedLayerArrowStream                        */
+/************************************************************************/
+
+namespace
+{
+
+/** Private data of the ArrowArrayStream returned by
+ * OGRWarpedLayer::GetArrowStream(), which reprojects in place the WKB
+ * geometry column of the batches of the decorated layer.
+ */
+struct OGRWarpedLayerArrowStream
+{
+    OGRArrowArrayStream m_oSrcStream{};
+    std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
+    int m_iArrowGeomField = -1;
+    int m_nThreads = 1;
+    std::string m_osLastError{};
+
+    static int GetSchema(struct ArrowArrayStream *stream,
+                         struct ArrowSchema *out_schema);
+    static int GetNext(struct ArrowArrayStream *stream,
+                       struct ArrowArray *out_array);
+    static const char *GetLastError(struct ArrowArrayStream *stream);
+    static void Release(struct ArrowArrayStream *stream);
+
+    bool TransformGeometries(struct ArrowArray *psGeomArray);
+};
+
+/** Substitutes writable copies of the WKB (and validity) buffers of a
+ * geometry array, and restores the original ones when it is released.
+ */
+struct OGRWarpedGeomArrayReleaser
+{
+    const void *m_pOriginBuffer0 = nullptr;
+    const void *m_pOriginBuffer2 = nullptr;
+    void (*m_pfnOriginRelease)(struct ArrowArray *) = nullptr;
+    void *m_pOriginPrivateData = nullptr;
+    std::vector<GByte> m_abyValidity{};
+    std::vector<GByte> m_abyWKB{};
+
+    static OGRWarpedGeomArrayReleaser *Install(struct ArrowArray *psArray)
+    {
+        auto poReleaser = new OGRWarpedGeomArrayReleaser();
+        poReleaser->m_pOriginBuffer0 = psArray->buffers[0];
+        poReleaser->m_pOriginBuffer2 = psArray->buffers[2];
+        poReleaser->m_pOriginPrivateData = psArray->private_data;
+        poReleaser->m_pfnOriginRelease = psArray->release;
+        psArray->release = OGRWarpedGeomArrayReleaser::Release;
+        psArray->private_data = poReleaser;
+        return poReleaser;
+    }
+
+    static void Release(struct ArrowArray *psArray)
+    {
+        auto poReleaser =
+            static_cast<OGRWarpedGeomArrayReleaser *>(psArray->private_data);
+        psArray->buffers[0] = poReleaser->m_pOriginBuffer0;
+        psArray->buffers[2] = poReleaser->m_pOriginBuffer2;
+        psArray->private_data = poReleaser->m_pOriginPrivateData;
+        psArray->release = poReleaser->m_pfnOriginRelease;
+        if (psArray->release)
+            psArray->release(psArray);
+        delete poReleaser;
+    }
+};
+
+/************************************************************************/
+/*                            GetSchema()                               */
+/************************************************************************/
+
+int OGRWarpedLayerArrowStream::GetSchema(struct ArrowArrayStream *stream,
+                                         struct ArrowSchema *out_schema)
+{
+    auto poThis =
+        static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+    return poThis->m_oSrcStream.get_schema(out_schema);
+}
+
+/************************************************************************/
+/*                             GetNext()                                */
+/************************************************************************/
+
+int OGRWarpedLayerArrowStream::GetNext(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    auto poThis =
+        static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+    const int nRet = poThis->m_oSrcStream.get_next(out_array);
+    if (nRet != 0 || out_array->release == nullptr || out_array->length == 0)
+        return nRet;
+    if (!poThis->TransformGeometries(
+            out_array->children[poThis->m_iArrowGeomField]))
+    {
+        out_array->release(out_array);
+        return EIO;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                           GetLastError()                             */
+/************************************************************************/
+
+const char *
+OGRWarpedLayerArrowStream::GetLastError(struct ArrowArrayStream *stream)
+{
+    auto poThis =
+        static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+    if (!poThis->m_osLastError.empty())
+        return poThis->m_osLastError.c_str();
+    auto psSrcStream = poThis->m_oSrcStream.get();
+    return psSrcStream->get_last_error(psSrcStream);
+}
+
+/************************************************************************/
+/*                              Release()                               */
+/************************************************************************/
+
+void OGRWarpedLayerArrowStream::Release(struct ArrowArrayStream *stream)
+{
+    delete static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+/************************************************************************/
+/*                        TransformGeometries()                         */
+/************************************************************************/
+
+bool OGRWarpedLayerArrowStream::TransformGeometries(
+    struct ArrowArray *psGeomArray)
+{
+    const size_t nOffset = static_cast<size_t>(psGeomArray->offset);
+    const size_t nLength = static_cast<size_t>(psGeomArray->length);
+    const uint32_t *panOffsets =
+        static_cast<const uint32_t *>(psGeomArray->buffers[1]) + nOffset;
+    const GByte *pabyValidity =
+        static_cast<const GByte *>(psGeomArray->buffers[0]);
+
+    auto poReleaser = OGRWarpedGeomArrayReleaser::Install(psGeomArray);
+    try
+    {
+        poReleaser->m_abyWKB.assign(
+            static_cast<const GByte *>(psGeomArray->buffers[2]),
+            static_cast<const GByte *>(psGeomArray->buffers[2]) +
+                panOffsets[nLength]);
+    }
+    catch (const std::exception &)
+    {
+        m_osLastError = "Out of memory";
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", m_osLastError.c_str());
+        return false;
+    }
+    GByte *pabyWKB = poReleaser->m_abyWKB.data();
+    psGeomArray->buffers[2] = pabyWKB;
+
+    // Geometries that cannot be reprojected are set to null, as done by
+    // GetNextFeature()
+    std::vector<std::vector<size_t>> aanFailed;
+    std::atomic<bool> bCloneError{false};
+    const auto TransformRange = [this, pabyWKB, panOffsets, pabyValidity,
+                                 nOffset, &bCloneError](
+                                    size_t iStart, size_t iEnd,
+                                    std::vector<size_t> &anFailed)
+    {
+        auto poCT =
+            std::unique_ptr<OGRCoordinateTransformation>(m_poCT->Clone());
+        if (!poCT)
+        {
+            bCloneError = true;
+            return;
+        }
+        OGRWKBTransformCache oCache;
+        OGREnvelope3D sEnv3D;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t iShifted = i + nOffset;
+            if (pabyValidity &&
+                (pabyValidity[iShifted / 8] & (1 << (iShifted % 8))) == 0)
+                continue;
+            const size_t nWKBSize = panOffsets[i + 1] - panOffsets[i];
+            if (nWKBSize != 0 &&
+                !OGRWKBTransform(pabyWKB + panOffsets[i], nWKBSize, poCT.get(),
+                                 oCache, sEnv3D))
+            {
+                anFailed.push_back(i);
+            }
+        }
+    };
+
+    // Below that number of features per thread, the cost of cloning the
+    // coordinate transformation is not worth it.
+    constexpr size_t MIN_FEATURES_PER_THREAD = 1000;
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        m_nThreads, std::max<size_t>(1, nLength / MIN_FEATURES_PER_THREAD)));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        aanFailed.resize(nThreads);
+        CPLErrorAccumulator oErrorAccumulator;
+        for (int iThread = 0; iThread < nThreads; ++iThread)
+        {
+            const size_t iStart = iThread * nLength / nThreads;
+            const size_t iEnd = (iThread + 1) * nLength / nThreads;
+            auto &anFailed = aanFailed[iThread];
+            poJobQueue->SubmitJob(
+                [&TransformRange, &oErrorAccumulator, &anFailed, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    TransformRange(iStart, iEnd, anFailed);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+    else
+    {
+        aanFailed.resize(1);
+        TransformRange(0, nLength, aanFailed[0]);
+    }
+
+    if (bCloneError)
+    {
+        m_osLastError = "Cannot clone OGRCoordinateTransformation";
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", m_osLastError.c_str());
+        return false;
+    }
+
+    bool bHasFailures = false;
+    for (const auto &anFailed : aanFailed)
+    {
+        for (const size_t i : anFailed)
+        {
+            if (!bHasFailures)
+            {
+                bHasFailures = true;
+                const size_t nBits = nOffset + nLength;
+                if (pabyValidity)
+                    poReleaser->m_abyValidity.assign(
+                        pabyValidity, pabyValidity + (nBits + 7) / 8);
+                else
+                    poReleaser->m_abyValidity.resize((nBits + 7) / 8, 0xFF);
+                psGeomArray->buffers[0] = poReleaser->m_abyValidity.data();
+                psGeomArray->null_count = -1;
+            }
+            const size_t iShifted = i + nOffset;
+            poReleaser->m_abyValidity[iShifted / 8] &=
+                static_cast<GByte>(~(1 << (iShifted % 8)));
+        }
+    }
+
+    return true;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                            GetArrowStream()                          */
 /************************************************************************/
@@ -551,7 +823,96 @@ void OGRWarpedLayer::SetExtent(double dfXMin, double dfYMin, double dfXMax,
 bool OGRWarpedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
                                     CSLConstList papszOptions)
 {
-    return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    // Reprojecting the batches of the decorated layer is only possible when
+    // they are requested with WKB geometries, and when they do not carry the
+    // CRS of the source layer in the metadata of the geometry column.
+    const CPLStringList aosOptions(papszOptions);
+    const char *pszGeomEncoding =
+        aosOptions.FetchNameValueDef(GAS_OPT_GEOMETRY_ENCODING, "WKB");
+    const char *pszGeomMetadataEncoding =
+        aosOptions.FetchNameValueDef("GEOMETRY_METADATA_ENCODING", "OGC");
+    if (!TestCapability(OLCFastGetArrowStream) ||
+        !EQUAL(pszGeomEncoding, "WKB") ||
+        !EQUAL(pszGeomMetadataEncoding, "OGC") ||
+        // Mostly for testing purposes
+        !CPLTestBool(
+            CPLGetConfigOption("OGR_WARPED_LAYER_NATIVE_ARROW_STREAM", "YES")))
+    {
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+
+    auto poStream = std::make_unique<OGRWarpedLayerArrowStream>();
+    poStream->m_poCT.reset(m_poCT->Clone());
+    if (!poStream->m_poCT)
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+
+    CPLStringList aosSrcOptions(aosOptions);
+    aosSrcOptions.SetNameValue(GAS_OPT_GEOMETRY_ENCODING, "WKB");
+    if (!m_poDecoratedLayer->GetArrowStream(poStream->m_oSrcStream.get(),
+                                            aosSrcOptions.List()))
+    {
+        return false;
+    }
+
+    // Locate the WKB column of the reprojected geometry field
+    struct ArrowSchema sSchema;
+    if (poStream->m_oSrcStream.get_schema(&sSchema) != 0)
+        return false;
+    const char *pszGeomFieldName =
+        m_poDecoratedLayer->GetLayerDefn()
+            ->GetGeomFieldDefn(m_iGeomField)
+            ->GetNameRef();
+    if (pszGeomFieldName[0] == '\0')
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+    bool bCRSInMetadata = false;
+    for (int i = 0; i < sSchema.n_children; ++i)
+    {
+        const auto psChild = sSchema.children[i];
+        if (strcmp(psChild->name, pszGeomFieldName) == 0 &&
+            strcmp(psChild->format, "z") == 0)
+        {
+            poStream->m_iArrowGeomField = i;
+            if (psChild->metadata)
+            {
+                const auto oMetadata = OGRParseArrowMetadata(psChild->metadata);
+                bCRSInMetadata =
+                    cpl::contains(oMetadata, ARROW_EXTENSION_METADATA_KEY);
+            }
+            break;
+        }
+    }
+    sSchema.release(&sSchema);
+    if (poStream->m_iArrowGeomField < 0 || bCRSInMetadata)
+    {
+        CPLDebug("OGR",
+                 "Cannot reproject the Arrow stream of layer %s natively. "
+                 "Falling back to the generic implementation",
+                 GetDescription());
+        poStream.reset();
+        m_poDecoratedLayer->ResetReading();
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+    {
+        poStream->m_nThreads =
+            EQUAL(pszNumThreads, "ALL_CPUS")
+                ? CPLGetNumCPUs()
+                : std::max(1, std::min(atoi(pszNumThreads), 1024));
+    }
+    else
+    {
+        poStream->m_nThreads = CPLGetNumCPUs();
+    }
+
+    memset(out_stream, 0, sizeof(*out_stream));
+    out_stream->get_schema = OGRWarpedLayerArrowStream::GetSchema;
+    out_stream->get_next = OGRWarpedLayerArrowStream::GetNext;
+    out_stream->get_last_error = OGRWarpedLayerArrowStream::GetLastError;
+    out_stream->release = OGRWarpedLayerArrowStream::Release;
+    out_stream->private_data = poStream.release();
+    return true;
 }
 
 #endif /* #ifndef DOXYGEN_SKIP */
@@ -14,6 +14,8 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrlibjsonutils.h"
@@ -22,6 +24,7 @@
 #include "ogrgeojsongeometry.h"
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 
 constexpr char RS = '\x1e';
@@ -90,7 +93,21 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    // Multi-threaded decoding of features
+    int m_nNumThreads = -1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoQueuedFeatures{};
+
+    bool ReadNextRecord();
+    std::vector<std::string> ReadRecords(size_t nMaxRecords);
     json_object *GetNextObject(bool bLooseIdentification);
+    int GetNumThreads();
+    void EstablishLayerDefnMultiThreaded(
+        std::map<std::string, int> &oMapFieldNameToIdx,
+        std::vector<std::unique_ptr<OGRFieldDefn>> &apoFieldDefn,
+        gdal::DirectedAcyclicGraph<int, std::string> &dag);
+    OGRFeature *TranslateObject(json_object *poObject,
+                                const char *pszSerializedObj);
+    void FillFeatureQueue();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -412,24 +429,31 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
     gdal::DirectedAcyclicGraph<int, std::string> dag;
     bool bOK = false;
 
-    while (true)
+    if (bEstablishLayerDefn && GetNumThreads() > 1)
     {
-        auto poObject = GetNextObject(bLooseIdentification);
-        if (!poObject)
-            break;
-        const auto eObjectType = OGRGeoJSONGetType(poObject);
-        if (bEstablishLayerDefn && eObjectType == GeoJSONObject::eFeature)
-        {
-            m_oReader.GenerateFeatureDefn(oMapFieldNameToIdx, apoFieldDefn, dag,
-                                          this, poObject);
-        }
-        json_object_put(poObject);
-        if (!bEstablishLayerDefn)
+        EstablishLayerDefnMultiThreaded(oMapFieldNameToIdx, apoFieldDefn, dag);
+    }
+    else
+    {
+        while (true)
         {
-            bOK = (eObjectType == GeoJSONObject::eFeature);
-            break;
+            auto poObject = GetNextObject(bLooseIdentification);
+            if (!poObject)
+                break;
+            const auto eObjectType = OGRGeoJSONGetType(poObject);
+            if (bEstablishLayerDefn && eObjectType == GeoJSONObject::eFeature)
+            {
+                m_oReader.GenerateFeatureDefn(oMapFieldNameToIdx, apoFieldDefn,
+                                              dag, this, poObject);
+            }
+            json_object_put(poObject);
+            if (!bEstablishLayerDefn)
+            {
+                bOK = (eObjectType == GeoJSONObject::eFeature);
+                break;
+            }
+            m_nTotalFeatures++;
         }
-        m_nTotalFeatures++;
     }
 
     if (bEstablishLayerDefn)
@@ -480,13 +504,17 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
     m_nNextFID = 0;
+    m_apoQueuedFeatures.clear();
 }
 
 /************************************************************************/
-/*                           GetNextObject()                            */
+/*                           ReadNextRecord()                           */
 /************************************************************************/
 
-json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+/** Read the next non-empty record of the file into m_osFeatureBuffer.
+ * Returns false at end of file, or in case of error.
+ */
+bool OGRGeoJSONSeqLayer::ReadNextRecord()
 {
     m_osFeatureBuffer.clear();
     while (true)
@@ -496,7 +524,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         {
             if (m_nBufferValidSize < m_osBuffer.size())
             {
-                return nullptr;
+                return false;
             }
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
@@ -520,7 +548,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
             if (m_nPosInBuffer >= m_nBufferValidSize)
             {
-                return nullptr;
+                return false;
             }
         }
 
@@ -548,7 +576,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
                          "for larger features, or 0 to remove any size limit.",
                          static_cast<unsigned>(m_osFeatureBuffer.size() / 1024 /
                                                1024));
-                return nullptr;
+                return false;
             }
             m_nPosInBuffer = m_nBufferValidSize;
             if (m_nBufferValidSize == m_osBuffer.size())
@@ -565,19 +593,229 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         }
         if (!m_osFeatureBuffer.empty())
         {
-            json_object *poObject = nullptr;
-            CPL_IGNORE_RET_VAL(
-                OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
-            m_osFeatureBuffer.clear();
-            if (json_object_get_type(poObject) == json_type_object)
+            return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                            ReadRecords()                             */
+/************************************************************************/
+
+std::vector<std::string> OGRGeoJSONSeqLayer::ReadRecords(size_t nMaxRecords)
+{
+    std::vector<std::string> aosRecords;
+    while (aosRecords.size() < nMaxRecords && ReadNextRecord())
+    {
+        aosRecords.push_back(std::move(m_osFeatureBuffer));
+        m_osFeatureBuffer.clear();
+    }
+    return aosRecords;
+}
+
+/************************************************************************/
+/*                           GetNextObject()                            */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+{
+    while (ReadNextRecord())
+    {
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
+        m_osFeatureBuffer.clear();
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            return poObject;
+        }
+        json_object_put(poObject);
+        if (bLooseIdentification)
+        {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+int OGRGeoJSONSeqLayer::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    }
+    return m_nNumThreads;
+}
+
+// Number of records processed by each thread in a batch
+constexpr size_t RECORDS_PER_THREAD_IN_BATCH = 500;
+
+/************************************************************************/
+/*                         ProcessInParallel()                          */
+/************************************************************************/
+
+/** Call Process(i) for each i in [0, nCount[, using up to nThreads threads */
+template <class Func>
+static void ProcessInParallel(int nThreads, size_t nCount, const Func &Process)
+{
+    const size_t nChunks = std::min(static_cast<size_t>(nThreads), nCount);
+    CPLWorkerThreadPool *poThreadPool =
+        nChunks >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        for (size_t i = 0; i < nCount; ++i)
+            Process(i);
+        return;
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const size_t iStart = iChunk * nCount / nChunks;
+        const size_t iEnd = (iChunk + 1) * nCount / nChunks;
+        poJobQueue->SubmitJob(
+            [&Process, &oErrorAccumulator, iStart, iEnd]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                for (size_t i = iStart; i < iEnd; ++i)
+                    Process(i);
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+}
+
+/************************************************************************/
+/*                  EstablishLayerDefnMultiThreaded()                   */
+/************************************************************************/
+
+/** Scan the whole file to establish the layer definition. Records are parsed
+ * into JSON objects by several threads, and then processed sequentially to
+ * update the field definitions.
+ */
+void OGRGeoJSONSeqLayer::EstablishLayerDefnMultiThreaded(
+    std::map<std::string, int> &oMapFieldNameToIdx,
+    std::vector<std::unique_ptr<OGRFieldDefn>> &apoFieldDefn,
+    gdal::DirectedAcyclicGraph<int, std::string> &dag)
+{
+    const int nThreads = GetNumThreads();
+    while (true)
+    {
+        const auto aosRecords =
+            ReadRecords(nThreads * RECORDS_PER_THREAD_IN_BATCH);
+        if (aosRecords.empty())
+            break;
+
+        std::vector<json_object *> apoObjects(aosRecords.size());
+        ProcessInParallel(nThreads, aosRecords.size(),
+                          [&aosRecords, &apoObjects](size_t i)
+                          {
+                              json_object *poObject = nullptr;
+                              CPL_IGNORE_RET_VAL(OGRJSonParse(
+                                  aosRecords[i].c_str(), &poObject));
+                              if (json_object_get_type(poObject) ==
+                                  json_type_object)
+                              {
+                                  apoObjects[i] = poObject;
+                              }
+                              else
+                              {
+                                  json_object_put(poObject);
+                              }
+                          });
+
+        for (json_object *poObject : apoObjects)
+        {
+            if (!poObject)
+                continue;
+            if (OGRGeoJSONGetType(poObject) == GeoJSONObject::eFeature)
             {
-                return poObject;
+                m_oReader.GenerateFeatureDefn(oMapFieldNameToIdx, apoFieldDefn,
+                                              dag, this, poObject);
             }
             json_object_put(poObject);
-            if (bLooseIdentification)
-            {
-                return nullptr;
-            }
+            m_nTotalFeatures++;
+        }
+    }
+}
+
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+/** Return the feature corresponding to a JSON object, or nullptr if it must
+ * be skipped. This may be called concurrently from several threads by
+ * FillFeatureQueue().
+ */
+OGRFeature *OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject,
+                                                const char *pszSerializedObj)
+{
+    auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, pszSerializedObj);
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+    else
+    {
+        OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+        if (!poGeom)
+        {
+            return nullptr;
+        }
+        OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+        poFeature->SetGeometryDirectly(poGeom);
+        return poFeature;
+    }
+}
+
+/************************************************************************/
+/*                          FillFeatureQueue()                          */
+/************************************************************************/
+
+/** Read a batch of records, and parse and translate them into features with
+ * several threads.
+ */
+void OGRGeoJSONSeqLayer::FillFeatureQueue()
+{
+    const int nThreads = GetNumThreads();
+    while (m_apoQueuedFeatures.empty())
+    {
+        const auto aosRecords =
+            ReadRecords(nThreads * RECORDS_PER_THREAD_IN_BATCH);
+        if (aosRecords.empty())
+            break;
+
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures(aosRecords.size());
+        ProcessInParallel(nThreads, aosRecords.size(),
+                          [this, &aosRecords, &apoFeatures](size_t i)
+                          {
+                              json_object *poObject = nullptr;
+                              CPL_IGNORE_RET_VAL(OGRJSonParse(
+                                  aosRecords[i].c_str(), &poObject));
+                              if (json_object_get_type(poObject) ==
+                                  json_type_object)
+                              {
+                                  apoFeatures[i].reset(TranslateObject(
+                                      poObject, aosRecords[i].c_str()));
+                              }
+                              json_object_put(poObject);
+                          });
+
+        for (auto &poFeature : apoFeatures)
+        {
+            if (poFeature)
+                m_apoQueuedFeatures.push_back(std::move(poFeature));
         }
     }
 }
@@ -602,34 +840,25 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
-        OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
+        OGRFeature *poFeature = nullptr;
+        if (GetNumThreads() > 1)
         {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
-        {
-            json_object_put(poObject);
-            continue;
+            if (m_apoQueuedFeatures.empty())
+                FillFeatureQueue();
+            if (m_apoQueuedFeatures.empty())
+                return nullptr;
+            poFeature = m_apoQueuedFeatures.front().release();
+            m_apoQueuedFeatures.pop_front();
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = TranslateObject(poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
-            if (!poGeom)
-            {
+            if (!poFeature)
                 continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
 
         if (poFeature->GetFID() == OGRNullFID)
@@ -19,9 +19,12 @@
 #include "gmlreader.h"
 #include "gmlutils.h"
 
+#include <deque>
 #include <memory>
+#include <string>
 #include <vector>
 
+class CPLJobQueue;
 class OGRGMLDataSource;
 
 typedef enum
@@ -55,6 +58,31 @@ class OGRGMLLayer final : public OGRLayer
 
     bool bFaceHoleNegative;
 
+    // GML feature read ahead, whose geometry is built by a worker thread
+    struct QueuedGMLFeature
+    {
+        std::unique_ptr<GMLFeature> poGMLFeature{};
+        bool bGeometryBuilt = false;
+        std::unique_ptr<OGRGeometry> poGeometry{};
+        std::string osErrorMsg{};
+    };
+
+    int m_nNumThreads = -1;
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    // One SRS cache per thread, since they are not thread-safe
+    std::vector<void *> m_ahCacheSRSPerThread{};
+    // Features whose geometry is being built by worker threads
+    std::vector<QueuedGMLFeature> m_aoInFlightGMLFeatures{};
+    // Features whose geometry has been built, in file order
+    std::deque<QueuedGMLFeature> m_aoQueuedGMLFeatures{};
+
+    int GetNumThreads();
+    bool CanBuildGeometriesInThreads();
+    std::vector<QueuedGMLFeature> ReadGMLFeatureBatch();
+    void SubmitGeometryBuilding();
+    void FillGMLFeatureQueue();
+    void DiscardQueuedGMLFeatures();
+
     CPL_DISALLOW_COPY_ASSIGN(OGRGMLLayer)
 
   public:
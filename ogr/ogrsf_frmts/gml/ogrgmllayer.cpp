@@ -18,6 +18,10 @@
 #include "cpl_string.h"
 #include "ogr_p.h"
 #include "ogr_api.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 
 /************************************************************************/
 /*                           OGRGMLLayer()                              */
@@ -53,12 +57,16 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
 OGRGMLLayer::~OGRGMLLayer()
 
 {
+    DiscardQueuedGMLFeatures();
+
     CPLFree(pszFIDPrefix);
 
     if (poFeatureDefn)
         poFeatureDefn->Release();
 
     GML_BuildOGRGeometryFromList_DestroyCache(hCacheSRS);
+    for (void *hCache : m_ahCacheSRSPerThread)
+        GML_BuildOGRGeometryFromList_DestroyCache(hCache);
 }
 
 /************************************************************************/
@@ -84,6 +92,8 @@ void OGRGMLLayer::ResetReading()
         poDS->SetStoredGMLFeature(nullptr);
     }
 
+    DiscardQueuedGMLFeatures();
+
     iNextGMLId = 0;
     poDS->GetReader()->ResetReading();
     CPLDebug("GML", "ResetReading()");
@@ -108,6 +118,193 @@ static GIntBig Increment(GIntBig nVal)
     return nVal;
 }
 
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+int OGRGMLLayer::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    }
+    return m_nNumThreads;
+}
+
+/************************************************************************/
+/*                    CanBuildGeometriesInThreads()                     */
+/************************************************************************/
+
+/** Whether GML features can be read ahead of the current one, so that their
+ * geometry is built by worker threads. This is restricted to the STANDARD
+ * read mode, where the reader only returns features of this layer, and to
+ * layers with a single geometry field.
+ */
+bool OGRGMLLayer::CanBuildGeometriesInThreads()
+{
+    return poDS->GetReadMode() == STANDARD &&
+           poFeatureDefn->GetGeomFieldCount() == 1 && GetNumThreads() > 1;
+}
+
+/************************************************************************/
+/*                        ReadGMLFeatureBatch()                         */
+/************************************************************************/
+
+// Number of GML features whose geometry is built by each thread in a batch
+constexpr int GML_FEATURES_PER_THREAD_IN_BATCH = 100;
+
+std::vector<OGRGMLLayer::QueuedGMLFeature> OGRGMLLayer::ReadGMLFeatureBatch()
+{
+    const size_t nBatchSize =
+        static_cast<size_t>(GetNumThreads()) * GML_FEATURES_PER_THREAD_IN_BATCH;
+    std::vector<QueuedGMLFeature> aoBatch;
+    aoBatch.reserve(nBatchSize);
+    while (aoBatch.size() < nBatchSize)
+    {
+        GMLFeature *poGMLFeature = poDS->GetReader()->NextFeature();
+        if (poGMLFeature == nullptr)
+            break;
+        m_nFeaturesRead++;
+        aoBatch.emplace_back();
+        aoBatch.back().poGMLFeature.reset(poGMLFeature);
+    }
+    return aoBatch;
+}
+
+/************************************************************************/
+/*                      SubmitGeometryBuilding()                        */
+/************************************************************************/
+
+/** Submit the building of the geometries of m_aoInFlightGMLFeatures to
+ * worker threads. The result is the same as the one of the sequential
+ * code path of GetNextFeature().
+ */
+void OGRGMLLayer::SubmitGeometryBuilding()
+{
+    const int nThreads = GetNumThreads();
+    if (!m_poJobQueue)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            m_poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    while (static_cast<int>(m_ahCacheSRSPerThread.size()) < nThreads)
+    {
+        m_ahCacheSRSPerThread.push_back(
+            GML_BuildOGRGeometryFromList_CreateCache());
+    }
+
+    const auto BuildGeometries = [this](size_t iStart, size_t iEnd,
+                                        void *hCache)
+    {
+        const char *pszSRSName = poDS->GetGlobalSRSName();
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto &oQueued = m_aoInFlightGMLFeatures[i];
+            if (oQueued.poGMLFeature->GetClass() != poFClass)
+                continue;
+
+            const CPLXMLNode *const *papsGeometry =
+                oQueued.poGMLFeature->GetGeometryList();
+            const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
+            const CPLXMLNode *psBoundedByGeometry =
+                oQueued.poGMLFeature->GetBoundedByGeometry();
+            if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+            {
+                apsGeometries[0] = psBoundedByGeometry;
+                papsGeometry = apsGeometries;
+            }
+            oQueued.bGeometryBuilt = true;
+            if (papsGeometry[0] == nullptr ||
+                strcmp(papsGeometry[0]->pszValue, "null") == 0)
+            {
+                continue;
+            }
+
+            CPLErrorReset();
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
+                pszSRSName, poDS->GetConsiderEPSGAsURN(),
+                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
+                hCache, bFaceHoleNegative);
+            CPLPopErrorHandler();
+            if (poGeom != nullptr)
+            {
+                oQueued.poGeometry.reset(
+                    OGRGeometryFactory::forceTo(poGeom, GetGeomType()));
+            }
+            else
+            {
+                oQueued.osErrorMsg = CPLGetLastErrorMsg();
+            }
+        }
+    };
+
+    const size_t nCount = m_aoInFlightGMLFeatures.size();
+    const size_t nChunks =
+        std::min(static_cast<size_t>(nThreads),
+                 (nCount + GML_FEATURES_PER_THREAD_IN_BATCH - 1) /
+                     GML_FEATURES_PER_THREAD_IN_BATCH);
+    if (!m_poJobQueue || nChunks < 2)
+    {
+        BuildGeometries(0, nCount, m_ahCacheSRSPerThread[0]);
+        return;
+    }
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const size_t iStart = iChunk * nCount / nChunks;
+        const size_t iEnd = (iChunk + 1) * nCount / nChunks;
+        void *hCache = m_ahCacheSRSPerThread[iChunk];
+        m_poJobQueue->SubmitJob([BuildGeometries, iStart, iEnd, hCache]()
+                                { BuildGeometries(iStart, iEnd, hCache); });
+    }
+}
+
+/************************************************************************/
+/*                        FillGMLFeatureQueue()                         */
+/************************************************************************/
+
+/** Fill m_aoQueuedGMLFeatures with GML features whose geometry has been
+ * built. Parsing of the GML file is sequential, but the next batch of
+ * features is read while worker threads build the geometries of the
+ * previous one.
+ */
+void OGRGMLLayer::FillGMLFeatureQueue()
+{
+    if (m_aoInFlightGMLFeatures.empty())
+    {
+        m_aoInFlightGMLFeatures = ReadGMLFeatureBatch();
+        if (m_aoInFlightGMLFeatures.empty())
+            return;
+        SubmitGeometryBuilding();
+    }
+
+    auto aoNextBatch = ReadGMLFeatureBatch();
+
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    for (auto &oQueued : m_aoInFlightGMLFeatures)
+        m_aoQueuedGMLFeatures.push_back(std::move(oQueued));
+
+    m_aoInFlightGMLFeatures = std::move(aoNextBatch);
+    if (!m_aoInFlightGMLFeatures.empty())
+        SubmitGeometryBuilding();
+}
+
+/************************************************************************/
+/*                      DiscardQueuedGMLFeatures()                      */
+/************************************************************************/
+
+void OGRGMLLayer::DiscardQueuedGMLFeatures()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_aoInFlightGMLFeatures.clear();
+    m_aoQueuedGMLFeatures.clear();
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -135,11 +332,31 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
     /* ==================================================================== */
     while (true)
     {
+        // Set when the geometry has been built by a worker thread
+        bool bGeometryBuilt = false;
+        std::unique_ptr<OGRGeometry> poBuiltGeometry;
+        std::string osBuildErrorMsg;
+
         GMLFeature *poGMLFeature = poDS->PeekStoredGMLFeature();
         if (poGMLFeature != nullptr)
         {
             poDS->SetStoredGMLFeature(nullptr);
         }
+        else if (!m_aoQueuedGMLFeatures.empty() ||
+                 !m_aoInFlightGMLFeatures.empty() ||
+                 CanBuildGeometriesInThreads())
+        {
+            if (m_aoQueuedGMLFeatures.empty())
+                FillGMLFeatureQueue();
+            if (m_aoQueuedGMLFeatures.empty())
+                return nullptr;
+            auto &oQueued = m_aoQueuedGMLFeatures.front();
+            poGMLFeature = oQueued.poGMLFeature.release();
+            bGeometryBuilt = oQueued.bGeometryBuilt;
+            poBuiltGeometry = std::move(oQueued.poGeometry);
+            osBuildErrorMsg = std::move(oQueued.osErrorMsg);
+            m_aoQueuedGMLFeatures.pop_front();
+        }
         else
         {
             poGMLFeature = poDS->GetReader()->NextFeature();
@@ -339,23 +556,34 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else if (papsGeometry[0] != nullptr)
         {
-            const char *pszSRSName = poDS->GetGlobalSRSName();
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            poGeom = GML_BuildOGRGeometryFromList(
-                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
-                pszSRSName, poDS->GetConsiderEPSGAsURN(),
-                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
-                hCacheSRS, bFaceHoleNegative);
-            CPLPopErrorHandler();
-
-            // Do geometry type changes if needed to match layer geometry type.
-            if (poGeom != nullptr)
+            CPLString osLastErrorMsg;
+            if (bGeometryBuilt)
             {
-                poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                poGeom = poBuiltGeometry.release();
+                osLastErrorMsg = osBuildErrorMsg;
             }
             else
             {
-                const CPLString osLastErrorMsg(CPLGetLastErrorMsg());
+                const char *pszSRSName = poDS->GetGlobalSRSName();
+                CPLPushErrorHandler(CPLQuietErrorHandler);
+                poGeom = GML_BuildOGRGeometryFromList(
+                    papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
+                    pszSRSName, poDS->GetConsiderEPSGAsURN(),
+                    poDS->GetSwapCoordinates(),
+                    poDS->GetSecondaryGeometryOption(), hCacheSRS,
+                    bFaceHoleNegative);
+                CPLPopErrorHandler();
+
+                // Do geometry type changes if needed to match layer geometry
+                // type.
+                if (poGeom != nullptr)
+                    poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                else
+                    osLastErrorMsg = CPLGetLastErrorMsg();
+            }
+
+            if (poGeom == nullptr)
+            {
 
                 const bool bGoOn = CPLTestBool(
                     CPLGetConfigOption("GML_SKIP_CORRUPTED_FEATURES", "NO"));
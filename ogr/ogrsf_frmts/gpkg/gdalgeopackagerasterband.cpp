@@ -15,18 +15,37 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #if !defined(DEBUG_VERBOSE) && defined(DEBUG_VERBOSE_GPKG)
 #define DEBUG_VERBOSE
 #endif
 
+/************************************************************************/
+/*                        PendingTileEncoding                           */
+/************************************************************************/
+
+struct GDALGPKGMBTilesLikePseudoDataset::PendingTileEncoding
+{
+    int nRow = 0;
+    int nCol = 0;
+    std::string osMemFileName{};
+    std::unique_ptr<GDALDataset> poSrcDS{};
+    CPLErrorAccumulator oErrors{};
+    bool bSuccess = false;
+    bool bDone = false;
+};
+
 /************************************************************************/
 /*                    GDALGPKGMBTilesLikePseudoDataset()                */
 /************************************************************************/
@@ -53,6 +72,11 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    // Normally already done by FlushTiles()
+    if (m_poTileEncodingQueue)
+        m_poTileEncodingQueue->WaitCompletion();
+    for (const auto &poJob : m_apoPendingTileEncodings)
+        VSIUnlink(poJob->osMemFileName.c_str());
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -155,6 +179,8 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
             eErr = WriteTile();
         }
     }
+    if (FlushPendingTileEncodings() != CE_None)
+        eErr = CE_Failure;
 
     if (poMainDS->m_nTileInsertionCount > 0)
     {
@@ -869,6 +895,8 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
 
+    FlushPendingTileEncodings();
+
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
         "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
@@ -986,6 +1014,252 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     return pabyData;
 }
 
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+/** Fetch, with a single SQL request, the tiles intersecting a window that are
+ * not yet in the block cache, decode them in worker threads (according to
+ * GDAL_NUM_THREADS), and store them in the block cache.
+ *
+ * This is only done in read-only mode, when tiles are aligned with blocks.
+ */
+void GDALGPKGMBTilesLikePseudoDataset::PrefetchTiles(int nXOff, int nYOff,
+                                                     int nXSize, int nYSize)
+{
+    if (IGetUpdate() || m_pabyCachedTiles == nullptr ||
+        m_nShiftXPixelsMod != 0 || m_nShiftYPixelsMod != 0 || nXSize <= 0 ||
+        nYSize <= 0)
+    {
+        return;
+    }
+
+    auto poBand1 =
+        cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(IGetRasterBand(1));
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand1->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlockXMin = nXOff / nBlockXSize;
+    const int nBlockYMin = nYOff / nBlockYSize;
+    const int nBlockXMax = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYMax = (nYOff + nYSize - 1) / nBlockYSize;
+    if (nBlockXMin == nBlockXMax && nBlockYMin == nBlockYMax)
+        return;
+
+    struct PrefetchedTile
+    {
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        GIntBig nTileId = 0;
+        bool bFound = false;
+        std::vector<GByte> abyTileData{};
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+    };
+
+    // Key is (tile_row as stored in the table, tile_column)
+    std::map<std::pair<int, int>, size_t> oMapTileToIdx;
+    std::vector<PrefetchedTile> asTiles;
+    int nRowMin = std::numeric_limits<int>::max();
+    int nRowMax = std::numeric_limits<int>::min();
+    for (int nBlockYOff = nBlockYMin; nBlockYOff <= nBlockYMax; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nBlockXMin; nBlockXOff <= nBlockXMax;
+             ++nBlockXOff)
+        {
+            GDALRasterBlock *poBlock =
+                poBand1->AccessibleTryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            const int nRow =
+                GetRowFromIntoTopConvention(nBlockYOff + m_nShiftYTiles);
+            const int nCol = nBlockXOff + m_nShiftXTiles;
+            nRowMin = std::min(nRowMin, nRow);
+            nRowMax = std::max(nRowMax, nRow);
+            oMapTileToIdx[std::make_pair(nRow, nCol)] = asTiles.size();
+            PrefetchedTile sTile;
+            sTile.nBlockXOff = nBlockXOff;
+            sTile.nBlockYOff = nBlockYOff;
+            asTiles.push_back(std::move(sTile));
+        }
+    }
+    if (asTiles.size() < 2)
+        return;
+
+    // Do not prefetch more than what the block cache can reasonably hold
+    const int nBands = IGetRasterCount();
+    const size_t nBandBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize * m_nDTSize;
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+    if (static_cast<GIntBig>(asTiles.size() * nBands * nBandBlockSize) >
+        GDALGetCacheMax64() / 4)
+    {
+        return;
+    }
+
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_row, tile_column, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row BETWEEN %d AND %d AND "
+        "tile_column BETWEEN %d AND %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, nRowMin, nRowMax,
+        nBlockXMin + m_nShiftXTiles, nBlockXMax + m_nShiftXTiles,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+        return;
+    while ((rc = sqlite3_step(hStmt)) == SQLITE_ROW)
+    {
+        const auto oIter = oMapTileToIdx.find(std::make_pair(
+            sqlite3_column_int(hStmt, 0), sqlite3_column_int(hStmt, 1)));
+        if (oIter == oMapTileToIdx.end() ||
+            sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+        {
+            continue;
+        }
+        auto &sTile = asTiles[oIter->second];
+        const GByte *pabyBlob =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+        sTile.abyTileData.assign(pabyBlob,
+                                 pabyBlob + sqlite3_column_bytes(hStmt, 2));
+        if (m_eDT != GDT_Byte)
+            sTile.nTileId = sqlite3_column_int64(hStmt, 3);
+        sTile.bFound = true;
+    }
+    sqlite3_finalize(hStmt);
+    // On error, let IReadBlock() read tiles one at a time and report it
+    if (rc != SQLITE_DONE)
+        return;
+
+    // Things that must be done before decoding tiles from worker threads
+    poBand1->GetColorTable();
+    for (auto &sTile : asTiles)
+    {
+        if (sTile.bFound)
+            GetTileOffsetAndScale(sTile.nTileId, sTile.dfTileOffset,
+                                  sTile.dfTileScale);
+    }
+
+    const size_t nTileSize = nTileBands * nBandBlockSize;
+    std::vector<GByte> abyDecoded;
+    try
+    {
+        abyDecoded.resize(asTiles.size() * nTileSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+
+    const auto DecodeTiles =
+        [this, &asTiles, &abyDecoded, nTileSize](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto &sTile = asTiles[i];
+            GByte *pabyDest = abyDecoded.data() + i * nTileSize;
+            if (!sTile.bFound)
+            {
+                FillEmptyTile(pabyDest);
+                continue;
+            }
+            const CPLString osMemFileName(
+                VSIMemGenerateHiddenFilename("gpkg_read_tile"));
+            VSILFILE *fp = VSIFileFromMemBuffer(
+                osMemFileName.c_str(), sTile.abyTileData.data(),
+                sTile.abyTileData.size(), FALSE);
+            VSIFCloseL(fp);
+            ReadTile(osMemFileName, pabyDest, sTile.dfTileOffset,
+                     sTile.dfTileScale);
+            VSIUnlink(osMemFileName);
+            sTile.abyTileData.clear();
+            sTile.abyTileData.shrink_to_fit();
+        }
+    };
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    const int nMaxThreads = std::min(
+        128, EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                              : atoi(pszNumThreads));
+    const int nThreads =
+        static_cast<int>(std::min<size_t>(nMaxThreads, asTiles.size()));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        DecodeTiles(0, asTiles.size());
+    }
+    else
+    {
+        const size_t nChunks =
+            std::min(asTiles.size(), static_cast<size_t>(nThreads) * 4);
+        CPLErrorAccumulator oErrorAccumulator;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t iStart = iChunk * asTiles.size() / nChunks;
+            const size_t iEnd = (iChunk + 1) * asTiles.size() / nChunks;
+            poJobQueue->SubmitJob(
+                [&DecodeTiles, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    DecodeTiles(iStart, iEnd);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+
+    // Store the decoded tiles in the block cache
+    for (size_t i = 0; i < asTiles.size(); ++i)
+    {
+        const auto &sTile = asTiles[i];
+        const GByte *pabyTileData = abyDecoded.data() + i * nTileSize;
+        for (int iBand = 1; iBand <= nBands; ++iBand)
+        {
+            GDALRasterBlock *poBlock =
+                IGetRasterBand(iBand)->GetLockedBlockRef(
+                    sTile.nBlockXOff, sTile.nBlockYOff, TRUE);
+            if (poBlock == nullptr)
+                continue;
+            if (!poBlock->GetDirty())
+            {
+                memcpy(poBlock->GetDataRef(),
+                       pabyTileData + (iBand - 1) * nBandBlockSize,
+                       nBandBlockSize);
+            }
+            poBlock->DropLock();
+        }
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && (nBufXSize >= nXSize || nBufYSize >= nYSize ||
+                               GetOverviewCount() == 0))
+    {
+        m_poTPD->PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                         IReadBlock()                                 */
 /************************************************************************/
@@ -999,6 +1273,11 @@ CPLErr GDALGPKGMBTilesLikeRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
              nBand, nBlockXOff, nBlockYOff, m_poTPD->m_nZoomLevel);
 #endif
 
+    // The tile cache and the database handle are shared by all blocks
+    std::lock_guard<std::recursive_mutex> oLock(
+        (m_poTPD->m_poParentDS ? m_poTPD->m_poParentDS : m_poTPD)
+            ->m_oReadBlockMutex);
+
     if (m_poTPD->m_pabyCachedTiles == nullptr)
         return CE_Failure;
 
@@ -1391,6 +1670,8 @@ static bool WEBPSupports4Bands()
 
 GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 {
+    FlushPendingTileEncodings();
+
     char *pszSQL =
         sqlite3_mprintf("SELECT id FROM \"%w\" WHERE zoom_level = %d AND "
                         "tile_row = %d AND tile_column = %d",
@@ -1407,6 +1688,8 @@ GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 
 bool GDALGPKGMBTilesLikePseudoDataset::DeleteTile(int nRow, int nCol)
 {
+    FlushPendingTileEncodings();
+
     char *pszSQL =
         sqlite3_mprintf("DELETE FROM \"%w\" "
                         "WHERE zoom_level = %d AND tile_row = %d AND "
@@ -1582,6 +1865,140 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTile()
     return eErr;
 }
 
+/************************************************************************/
+/*                       InitTileEncodingQueue()                        */
+/************************************************************************/
+
+// Returns whether tiles can be encoded in worker threads (according to
+// GDAL_NUM_THREADS).
+bool GDALGPKGMBTilesLikePseudoDataset::InitTileEncodingQueue()
+{
+    if (!m_bTileEncodingQueueInitialized)
+    {
+        m_bTileEncodingQueueInitialized = true;
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        const int nThreads = std::min(
+            128, EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                  : atoi(pszNumThreads));
+        CPLWorkerThreadPool *poThreadPool =
+            nThreads >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (poThreadPool)
+        {
+            m_poTileEncodingQueue = poThreadPool->CreateJobQueue();
+            // Keep each worker busy, while bounding the memory used by
+            // tiles waiting to be encoded or inserted.
+            m_nMaxPendingTileEncodings = 2 * static_cast<size_t>(nThreads);
+        }
+    }
+    return m_poTileEncodingQueue != nullptr;
+}
+
+/************************************************************************/
+/*                        SubmitTileEncoding()                          */
+/************************************************************************/
+
+// Encodes poMEMDS with poTileDriver in a worker thread. The resulting blob
+// is inserted at (nRow, nCol) by FlushPendingTileEncodings(), in the order
+// tiles were submitted. poMEMDS is copied, and can thus reference
+// m_pabyCachedTiles.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::SubmitTileEncoding(
+    int nRow, int nCol, GDALDriver *poTileDriver, GDALDataset *poMEMDS,
+    CSLConstList papszDriverOptions)
+{
+    GDALDriver *poMEMDriver =
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    auto poJob = std::make_shared<PendingTileEncoding>();
+    poJob->nRow = nRow;
+    poJob->nCol = nCol;
+    poJob->osMemFileName = VSIMemGenerateHiddenFilename("gpkg_write_tile");
+    poJob->poSrcDS.reset(poMEMDriver->CreateCopy(
+        "", poMEMDS, FALSE, nullptr, nullptr, nullptr));
+    if (!poJob->poSrcDS)
+        return CE_Failure;
+
+    const CPLStringList aosDriverOptions(papszDriverOptions);
+    m_apoPendingTileEncodings.push_back(poJob);
+    if (!m_poTileEncodingQueue->SubmitJob(
+            [this, poJob, poTileDriver, aosDriverOptions]()
+            {
+                {
+                    auto oAccumulator =
+                        poJob->oErrors.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    GDALDataset *poOutDS = poTileDriver->CreateCopy(
+                        poJob->osMemFileName.c_str(), poJob->poSrcDS.get(),
+                        FALSE, aosDriverOptions.List(), nullptr, nullptr);
+                    if (poOutDS)
+                    {
+                        poJob->bSuccess = true;
+                        GDALClose(poOutDS);
+                    }
+                    poJob->poSrcDS.reset();
+                }
+                std::lock_guard oLock(m_oTileEncodingMutex);
+                poJob->bDone = true;
+                m_oTileEncodingCV.notify_all();
+            }))
+    {
+        m_apoPendingTileEncodings.pop_back();
+        return CE_Failure;
+    }
+
+    return FlushPendingTileEncodings(m_nMaxPendingTileEncodings);
+}
+
+/************************************************************************/
+/*                     FlushPendingTileEncodings()                      */
+/************************************************************************/
+
+// Inserts tiles submitted by SubmitTileEncoding(), waiting for them to be
+// encoded, until there are no more than nMaxRemaining ones left. Must be
+// called before any SQL request involving the tiles of this zoom level.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushPendingTileEncodings(
+    size_t nMaxRemaining)
+{
+    CPLErr eErr = CE_None;
+    bool bDiscard = false;
+    while (m_apoPendingTileEncodings.size() > nMaxRemaining)
+    {
+        auto poJob = std::move(m_apoPendingTileEncodings.front());
+        m_apoPendingTileEncodings.pop_front();
+        {
+            std::unique_lock oLock(m_oTileEncodingMutex);
+            m_oTileEncodingCV.wait(oLock, [&poJob] { return poJob->bDone; });
+        }
+        poJob->oErrors.ReplayErrors();
+        if (!poJob->bSuccess || bDiscard)
+        {
+            VSIUnlink(poJob->osMemFileName.c_str());
+            eErr = CE_Failure;
+            continue;
+        }
+
+        vsi_l_offset nBlobSize = 0;
+        GByte *pabyBlob =
+            VSIGetMemFileBuffer(poJob->osMemFileName.c_str(), &nBlobSize, TRUE);
+        VSIUnlink(poJob->osMemFileName.c_str());
+        CPLErr eInsertErr = CE_None;
+        if (!InsertTile(poJob->nRow, poJob->nCol, pabyBlob,
+                        static_cast<size_t>(nBlobSize), eInsertErr))
+        {
+            // The transaction could not be committed: give up on the
+            // remaining tiles, as WriteTile() would do.
+            bDiscard = true;
+            nMaxRemaining = 0;
+        }
+        if (eInsertErr != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                         WriteTileInternal()                          */
+/************************************************************************/
+
 /* should only be called by WriteTile() */
 CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 {
@@ -2369,6 +2786,27 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
+        // Encode Byte tiles in worker threads when they are written in
+        // sequence, typically by gdal_translate or when building overviews.
+        if (m_eDT == GDT_Byte && m_nShiftXPixelsMod == 0 &&
+            m_nShiftYPixelsMod == 0 && InitTileEncodingQueue())
+        {
+            eErr = SubmitTileEncoding(nRow, nCol, l_poDriver, poMEMDS,
+                                      papszDriverOptions);
+            CSLDestroy(papszDriverOptions);
+            CPLFree(pTempTileBuffer);
+            delete poMEMDS;
+            return eErr;
+        }
+        // Preserve the order of insertions
+        if (FlushPendingTileEncodings() != CE_None)
+        {
+            CSLDestroy(papszDriverOptions);
+            CPLFree(pTempTileBuffer);
+            delete poMEMDS;
+            return CE_Failure;
+        }
+
 #ifdef DEBUG
         VSIStatBufL sStat;
         CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
@@ -2386,64 +2824,13 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             GByte *pabyBlob =
                 VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
 
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
+            if (!InsertTile(nRow, nCol, pabyBlob,
+                            static_cast<size_t>(nBlobSize), eErr))
             {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
-            {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
-            }
-            poMainDS->m_nTileInsertionCount++;
-
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "failed to prepare SQL %s: %s", pszSQL,
-                         sqlite3_errmsg(IGetDB()));
-                CPLFree(pabyBlob);
-            }
-            else
-            {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
+                VSIUnlink(osMemFileName);
+                delete poMEMDS;
+                return CE_Failure;
             }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
 
             if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
             {
@@ -2454,7 +2841,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2463,9 +2850,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
-                                            nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
+                                                nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -2511,6 +2898,222 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
     return eErr;
 }
 
+/************************************************************************/
+/*                             InsertTile()                             */
+/************************************************************************/
+
+// Inserts (or replaces) the encoded tile pabyBlob, which is freed with
+// CPLFree(), at (nRow, nCol) of the current zoom level. eErr is set to the
+// result of the insertion. Returns false if the current transaction could
+// not be committed, in which case no insertion has been attempted.
+bool GDALGPKGMBTilesLikePseudoDataset::InsertTile(int nRow, int nCol,
+                                                  GByte *pabyBlob,
+                                                  size_t nBlobSize,
+                                                  CPLErr &eErr)
+{
+    eErr = CE_Failure;
+
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return false;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to prepare SQL %s: %s",
+                 pszSQL, sqlite3_errmsg(IGetDB()));
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+    return true;
+}
+
+/************************************************************************/
+/*                        WriteCompressedTile()                         */
+/************************************************************************/
+
+// Writes the already encoded tile pBuffer, in the format described by
+// pszFormat ("JPEG" or "WEBP", potentially followed by the parameters
+// returned by GDALDataset::ReadCompressedData()), at the tile whose top-left
+// corner is (nXOff, nYOff) in raster space. If pBuffer is nullptr, only
+// checks whether that would be possible, without emitting any error.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteCompressedTile(
+    const char *pszFormat, int nXOff, int nYOff, int nXSize, int nYSize,
+    const void *pBuffer, size_t nBufferSize)
+{
+    if (!IGetUpdate() || m_pabyCachedTiles == nullptr || m_eDT != GDT_Byte ||
+        m_nShiftXPixelsMod != 0 || m_nShiftYPixelsMod != 0 ||
+        m_bQualityExplicit || nBufferSize > INT_MAX)
+    {
+        return CE_Failure;
+    }
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALRasterBand *poBand = IGetRasterBand(1);
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nRasterXSize = poBand->GetXSize();
+    const int nRasterYSize = poBand->GetYSize();
+    if (nXOff < 0 || nYOff < 0 || nXOff >= nRasterXSize ||
+        nYOff >= nRasterYSize || (nXOff % nBlockXSize) != 0 ||
+        (nYOff % nBlockYSize) != 0 ||
+        (nXSize != nBlockXSize && nXOff + nXSize != nRasterXSize) ||
+        (nYSize != nBlockYSize && nYOff + nYSize != nRasterYSize))
+    {
+        return CE_Failure;
+    }
+    const bool bFullTile = nXOff + nBlockXSize <= nRasterXSize &&
+                           nYOff + nBlockYSize <= nRasterYSize;
+
+    // Lossy formats can only be used for fully opaque tiles, so alpha bands
+    // are not handled.
+    const int nBands = IGetRasterCount();
+    if (nBands != 1 && nBands != 3)
+        return CE_Failure;
+
+    const CPLStringList aosTokens(CSLTokenizeString2(pszFormat, ";", 0));
+    if (aosTokens.empty())
+        return CE_Failure;
+    if (EQUAL(aosTokens[0], "JPEG"))
+    {
+        if (!(m_eTF == GPKG_TF_JPEG ||
+              (m_eTF == GPKG_TF_PNG_JPEG && bFullTile)))
+            return CE_Failure;
+        for (int i = 1; i < aosTokens.size(); ++i)
+        {
+            const char *pszToken = aosTokens[i];
+            if (STARTS_WITH_CI(pszToken, "frame_type="))
+            {
+                // Only the Huffman coded 8-bit frame types are universally
+                // readable.
+                const char *pszValue = pszToken + strlen("frame_type=");
+                if (!EQUAL(pszValue, "SOF0_baseline") &&
+                    !EQUAL(pszValue, "SOF1_extended_sequential") &&
+                    !EQUAL(pszValue, "SOF2_progressive_huffman"))
+                    return CE_Failure;
+            }
+            else if (STARTS_WITH_CI(pszToken, "bit_depth="))
+            {
+                if (atoi(pszToken + strlen("bit_depth=")) != 8)
+                    return CE_Failure;
+            }
+            else if (STARTS_WITH_CI(pszToken, "num_components="))
+            {
+                if (atoi(pszToken + strlen("num_components=")) != nBands)
+                    return CE_Failure;
+            }
+            else if (STARTS_WITH_CI(pszToken, "colorspace="))
+            {
+                const char *pszValue = pszToken + strlen("colorspace=");
+                const bool bGray = EQUAL(pszValue, "GRAY") ||
+                                   EQUAL(pszValue, "unknown");
+                const bool bColor =
+                    EQUAL(pszValue, "YCbCr") || EQUAL(pszValue, "RGB");
+                if (!(nBands == 1 && bGray) && !(nBands == 3 && bColor))
+                    return CE_Failure;
+            }
+        }
+    }
+    else if (EQUAL(aosTokens[0], "WEBP"))
+    {
+        if (m_eTF != GPKG_TF_WEBP || nBands != 3 || aosTokens.size() != 1)
+            return CE_Failure;
+    }
+    else
+    {
+        return CE_Failure;
+    }
+
+    if (pBuffer == nullptr)
+        return CE_None;
+
+    // If the caller did not provide the characteristics of the codestream,
+    // check them ourselves.
+    if (EQUAL(aosTokens[0], "JPEG") && aosTokens.size() == 1 &&
+        WriteCompressedTile(
+            GDALGetCompressionFormatForJPEG(pBuffer, nBufferSize).c_str(),
+            nXOff, nYOff, nXSize, nYSize, nullptr, 0) != CE_None)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "JPEG codestream not compatible with the dataset");
+        return CE_Failure;
+    }
+
+    if (m_poParentDS)
+        m_poParentDS->m_bHasModifiedTiles = true;
+    else
+        m_bHasModifiedTiles = true;
+
+    const int nRow = nYOff / nBlockYSize + m_nShiftYTiles;
+    const int nCol = nXOff / nBlockXSize + m_nShiftXTiles;
+
+    // Pending content for that tile, if any, is superseded.
+    for (auto &sDesc : m_asCachedTilesDesc)
+    {
+        if (sDesc.nRow == nRow && sDesc.nCol == nCol)
+        {
+            sDesc.nRow = -1;
+            sDesc.nCol = -1;
+            sDesc.nIdxWithinTileData = -1;
+        }
+    }
+
+    GByte *pabyBlob = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBufferSize));
+    if (pabyBlob == nullptr)
+        return CE_Failure;
+    memcpy(pabyBlob, pBuffer, nBufferSize);
+    CPLErr eErr = FlushPendingTileEncodings();
+    if (eErr != CE_None)
+    {
+        CPLFree(pabyBlob);
+        return eErr;
+    }
+    InsertTile(nRow, nCol, pabyBlob, nBufferSize, eErr);
+    return eErr;
+}
+
 /************************************************************************/
 /*                     FlushRemainingShiftedTiles()                     */
 /************************************************************************/
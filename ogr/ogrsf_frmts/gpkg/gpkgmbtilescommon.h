@@ -14,9 +14,15 @@
 #define GPKGMBTILESCOMMON_H_INCLUDED
 
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
 typedef struct
 {
     int nRow;
@@ -76,6 +82,7 @@ class GDALGPKGMBTilesLikePseudoDataset
         true;  // for test/debug purposes only. true is the nominal value
     int m_nZLevel = 6;
     int m_nQuality = 75;
+    bool m_bQualityExplicit = false;  // QUALITY set by the user
     bool m_bDither = false;
 
     GDALColorTable *m_poCT = nullptr;
@@ -95,9 +102,35 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
+    // Serializes GDALGPKGMBTilesLikeRasterBand::IReadBlock(), as the drivers
+    // declare GDAL_DCAP_CONCURRENT_READ_BLOCK. Only the one of the parent
+    // dataset, whose database handle is shared by overviews, is used.
+    // Recursive since reading a block of a band loads the blocks of the
+    // other bands.
+    std::recursive_mutex m_oReadBlockMutex{};
+
   private:
     bool m_bInWriteTile = false;
+
+    // Tiles being encoded in worker threads, in submission order
+    struct PendingTileEncoding;
+    bool m_bTileEncodingQueueInitialized = false;
+    std::unique_ptr<CPLJobQueue> m_poTileEncodingQueue{};
+    size_t m_nMaxPendingTileEncodings = 0;
+    std::mutex m_oTileEncodingMutex{};
+    std::condition_variable m_oTileEncodingCV{};
+    std::deque<std::shared_ptr<PendingTileEncoding>>
+        m_apoPendingTileEncodings{};
+
+    bool InitTileEncodingQueue();
+    CPLErr SubmitTileEncoding(int nRow, int nCol, GDALDriver *poTileDriver,
+                              GDALDataset *poMEMDS,
+                              CSLConstList papszDriverOptions);
+    CPLErr FlushPendingTileEncodings(size_t nMaxRemaining = 0);
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
+    bool InsertTile(int nRow, int nCol, GByte *pabyBlob, size_t nBlobSize,
+                    CPLErr &eErr);
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
     bool DeleteFromGriddedTileAncillary(GIntBig nTileId);
@@ -120,8 +153,12 @@ class GDALGPKGMBTilesLikePseudoDataset
     GByte *ReadTile(int nRow, int nCol);
     GByte *ReadTile(int nRow, int nCol, GByte *pabyData,
                     bool *pbIsLossyFormat = nullptr);
+    void PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize);
 
     CPLErr WriteTile();
+    CPLErr WriteCompressedTile(const char *pszFormat, int nXOff, int nYOff,
+                               int nXSize, int nYSize, const void *pBuffer,
+                               size_t nBufferSize);
 
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
@@ -163,6 +200,9 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
                               void *pData) override;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff,
                                void *pData) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
 
     int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
@@ -317,6 +317,11 @@ class GDALGeoPackageDataset final : public OGRSQLiteBaseDataSource,
     virtual CPLErr IBuildOverviews(const char *, int, const int *, int,
                                    const int *, GDALProgressFunc, void *,
                                    CSLConstList papszOptions) override;
+    virtual CPLErr WriteCompressedData(const char *pszFormat, int nXOff,
+                                       int nYOff, int nXSize, int nYSize,
+                                       int nBandCount, const int *panBandList,
+                                       const void *pBuffer,
+                                       size_t nBufferSize) override;
 
     virtual int GetLayerCount() override
     {
@@ -598,7 +603,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -714,6 +721,11 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
+    // Used when m_nIsCompatOfOptimizedGetNextArrowArray == TRUE.
+    // Batches are read from ranges of m_nMaxBatchSize FIDs starting at
+    // m_nArrowMinFID + m_iNextShapeId, up to m_nArrowMinFID + m_nArrowFIDRange
+    GIntBig m_nArrowMinFID = 1;
+    GIntBig m_nArrowFIDRange = 0;
 
     int m_nCountInsertInTransactionThreshold = -1;
     GIntBig m_nCountInsertInTransaction = 0;
@@ -733,6 +745,27 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     std::vector<GPKGRTreeEntry> m_aoRTreeEntries{};
 
+    // Geometry of a row of a batch given to WriteArrowBatch(), decoded and
+    // encoded as a GeoPackage geometry blob by a worker thread.
+    struct PreparedGeometry
+    {
+        std::unique_ptr<OGRGeometry> poGeom{};
+        std::unique_ptr<GByte, void (*)(void *)> pabyBlob{nullptr, VSIFree};
+        size_t nBlobSize = 0;
+        OGREnvelope sEnvelope{};
+    };
+
+    // Set by WriteArrowBatch() during the OGRLayer::WriteArrowBatch() call
+    std::vector<PreparedGeometry> *m_pasPreparedGeometries = nullptr;
+    size_t m_iNextPreparedGeometry = 0;
+    // Set by CreateOrUpsertFeature() during FeatureBindInsertParameters()
+    PreparedGeometry *m_psCurPreparedGeometry = nullptr;
+
+    int PrepareGeometries(const struct ArrowSchema *schema,
+                          const struct ArrowArray *array,
+                          CSLConstList papszOptions, int nThreads,
+                          std::vector<PreparedGeometry> &asGeometries);
+
     // Variables used for background RTree building
     std::string m_osAsyncDBName{};
     std::string m_osAsyncDBAttachName{};
@@ -825,11 +858,15 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     int GetNextArrowArrayInternal(struct ArrowArray *out_array,
                                   std::string &osErrorMsg,
                                   bool &bMemoryLimitReached);
+    bool IsArrowFIDRangeDense() const;
+    GIntBig GetFeatureCountBeforeFID(GIntBig nFID);
     int GetNextArrowArrayAsynchronous(struct ArrowArrayStream *stream,
                                       struct ArrowArray *out_array);
     void GetNextArrowArrayAsynchronousWorker();
     void CancelAsyncNextArrowArray();
 
+    OGRFeature *GetNextTableFeature(OGRFeature *poFeatureToReuse);
+
   protected:
     friend void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext,
                                                    int /*argc*/,
@@ -884,12 +921,17 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
     OGRErr RollbackTransaction() override;
     GIntBig GetFeatureCount(int) override;
 
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
                       bool bForce) override;
 
@@ -1105,6 +1105,32 @@ bool GDALGeoPackageDataset::ICanIWriteBlock()
     return true;
 }
 
+/************************************************************************/
+/*                        WriteCompressedData()                         */
+/************************************************************************/
+
+CPLErr GDALGeoPackageDataset::WriteCompressedData(
+    const char *pszFormat, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBandCount, const int *panBandList, const void *pBuffer,
+    size_t nBufferSize)
+{
+    if (nBands == 0 || !m_bGeoTransformValid || m_nSRID == UNKNOWN_SRID ||
+        nBandCount != nBands)
+    {
+        return CE_Failure;
+    }
+    if (panBandList)
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (panBandList[i] != i + 1)
+                return CE_Failure;
+        }
+    }
+    return WriteCompressedTile(pszFormat, nXOff, nYOff, nXSize, nYSize,
+                               pBuffer, nBufferSize);
+}
+
 /************************************************************************/
 /*                            IRasterIO()                               */
 /************************************************************************/
@@ -1116,6 +1142,13 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    if (eRWFlag == GF_Read && nBands > 0 &&
+        (nBufXSize >= nXSize || nBufYSize >= nYSize ||
+         GetRasterBand(1)->GetOverviewCount() == 0))
+    {
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
@@ -6501,7 +6534,10 @@ void GDALGeoPackageDataset::ParseCompressionOptions(char **papszOptions)
 
     const char *pszQuality = CSLFetchNameValue(papszOptions, "QUALITY");
     if (pszQuality)
+    {
         m_nQuality = atoi(pszQuality);
+        m_bQualityExplicit = true;
+    }
 
     const char *pszDither = CSLFetchNameValue(papszOptions, "DITHER");
     if (pszDither)
@@ -763,6 +763,7 @@ void RegisterOGRGeoPackage()
     poDriver->pfnGetSubdatasetInfoFunc = OGRGeoPackageDriverGetSubdatasetInfo;
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_CONCURRENT_READ_BLOCK, "YES");
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
 }
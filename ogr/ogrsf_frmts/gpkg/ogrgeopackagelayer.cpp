@@ -77,6 +77,20 @@ void OGRGeoPackageLayer::ClearStatement()
 
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is filled and returned      */
+/*      instead of allocating a new feature.                            */
+/************************************************************************/
+
+OGRFeature *
+OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (m_bEOF)
         return nullptr;
@@ -119,14 +133,16 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poFeatureToReuse);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        if (poFeature != poFeatureToReuse)
+            delete poFeature;
     }
 }
 
@@ -328,13 +344,24 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or reuse the passed   */
+    /*      one.                                                            */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == m_poFeatureDefn);
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(m_poFeatureDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -521,7 +548,8 @@ bool OGRGeoPackageLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
 int OGRGeoPackageLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                           struct ArrowArray *out_array)
 {
-    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")))
+    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(m_aosArrowArrayStreamOptions))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
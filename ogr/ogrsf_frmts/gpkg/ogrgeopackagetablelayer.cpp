@@ -20,6 +20,8 @@
 #include "ogr_p.h"
 #include "sqlite_rtree_bulk_load/wrapper.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "cpl_error_internal.h"
 
 #include <algorithm>
 #include <cassert>
@@ -240,8 +242,18 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
         if (poGeom)
         {
             size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
+            GByte *pabyWkb = nullptr;
+            if (m_psCurPreparedGeometry && m_psCurPreparedGeometry->pabyBlob)
+            {
+                // Already encoded by WriteArrowBatch()
+                szWkb = m_psCurPreparedGeometry->nBlobSize;
+                pabyWkb = m_psCurPreparedGeometry->pabyBlob.release();
+            }
+            else
+            {
+                pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                              &m_sBinaryPrecision, &szWkb);
+            }
             if (!pabyWkb)
                 return OGRERR_FAILURE;
             int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
@@ -2396,6 +2408,19 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
     }
 #endif
 
+    // Geometry prepared by WriteArrowBatch(), whose column has been removed
+    // from the batch given to OGRLayer::WriteArrowBatch()
+    PreparedGeometry sPreparedGeometry;
+    bool bHasPreparedGeometry = false;
+    if (m_pasPreparedGeometries && !bUpsert &&
+        m_iNextPreparedGeometry < m_pasPreparedGeometries->size())
+    {
+        sPreparedGeometry =
+            std::move((*m_pasPreparedGeometries)[m_iNextPreparedGeometry++]);
+        bHasPreparedGeometry = true;
+        poFeature->SetGeomFieldDirectly(0, sPreparedGeometry.poGeom.release());
+    }
+
     CheckGeometryType(poFeature);
 
     /* Substitute default values for null Date/DateTime fields as the standard
@@ -2503,9 +2528,12 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
     }
 
     /* Bind values onto the statement now */
+    m_psCurPreparedGeometry =
+        bHasPreparedGeometry ? &sPreparedGeometry : nullptr;
     OGRErr errOgr = FeatureBindInsertParameters(poFeature, m_poInsertStatement,
                                                 m_bInsertStatementWithFID,
                                                 !bHasDefaultValue);
+    m_psCurPreparedGeometry = nullptr;
     if (errOgr != OGRERR_NONE)
     {
         sqlite3_reset(m_poInsertStatement);
@@ -2571,7 +2599,10 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
         if (!poGeom->IsEmpty())
         {
             OGREnvelope oEnv;
-            poGeom->getEnvelope(&oEnv);
+            if (bHasPreparedGeometry)
+                oEnv = sPreparedGeometry.sEnvelope;
+            else
+                poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
             if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
@@ -2666,6 +2697,215 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                        GetThreadsAvailable()                         */
+/************************************************************************/
+
+static int GetThreadsAvailable()
+{
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+    if (pszMaxThreads == nullptr)
+        return std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    else
+        return atoi(pszMaxThreads);
+}
+
+/************************************************************************/
+/*                         PrepareGeometries()                          */
+/************************************************************************/
+
+// Decode the WKB geometries of the geometry column of the batch, and encode
+// them as GeoPackage geometry blobs, using nThreads threads.
+// Returns the index of the geometry column in the batch, or -1 if there is
+// not exactly one.
+int OGRGeoPackageTableLayer::PrepareGeometries(
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    CSLConstList papszOptions, int nThreads,
+    std::vector<PreparedGeometry> &asGeometries)
+{
+    // Same logic as in OGRLayer::WriteArrowBatch() to identify the
+    // geometry column
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+    int iGeomChild = -1;
+    for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+    {
+        const auto psChild = schema->children[i];
+        if ((strcmp(psChild->format, "z") != 0 &&
+             strcmp(psChild->format, "Z") != 0) ||
+            m_poFeatureDefn->GetFieldIndex(psChild->name) >= 0)
+        {
+            continue;
+        }
+        bool bIsGeomColumn =
+            strcmp(psChild->name, pszGeomFieldName) == 0 ||
+            m_poFeatureDefn->GetGeomFieldIndex(psChild->name) == 0;
+        if (!bIsGeomColumn && psChild->metadata)
+        {
+            const auto oMetadata = OGRParseArrowMetadata(psChild->metadata);
+            const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+            bIsGeomColumn = oIter != oMetadata.end() &&
+                            (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                             oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+        }
+        if (bIsGeomColumn)
+        {
+            if (iGeomChild >= 0)
+                return -1;
+            iGeomChild = i;
+        }
+    }
+    if (iGeomChild < 0)
+        return -1;
+
+    const struct ArrowArray *psGeomArray = array->children[iGeomChild];
+    const bool bLargeBinary = schema->children[iGeomChild]->format[0] == 'Z';
+    const auto pabyValidity =
+        static_cast<const GByte *>(psGeomArray->buffers[0]);
+    const auto panOffsets32 =
+        static_cast<const int32_t *>(psGeomArray->buffers[1]);
+    const auto panOffsets64 =
+        static_cast<const int64_t *>(psGeomArray->buffers[1]);
+    const auto pabyData = static_cast<const GByte *>(psGeomArray->buffers[2]);
+
+    const size_t nRows = static_cast<size_t>(array->length);
+    asGeometries.clear();
+    asGeometries.resize(nRows);
+
+    const auto ProcessRange =
+        [this, &asGeometries, psGeomArray, bLargeBinary, pabyValidity,
+         panOffsets32, panOffsets64, pabyData](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t iIdx = i + static_cast<size_t>(psGeomArray->offset);
+            if (psGeomArray->null_count != 0 && pabyValidity &&
+                (pabyValidity[iIdx / 8] & (1 << (iIdx % 8))) == 0)
+            {
+                continue;
+            }
+            const int64_t nStart =
+                bLargeBinary ? panOffsets64[iIdx] : panOffsets32[iIdx];
+            const int64_t nEnd = bLargeBinary ? panOffsets64[iIdx + 1]
+                                              : panOffsets32[iIdx + 1];
+            OGRGeometry *poGeom = nullptr;
+            size_t nBytesConsumedOut = 0;
+            OGRGeometryFactory::createFromWkb(
+                pabyData + nStart, nullptr, &poGeom,
+                static_cast<size_t>(nEnd - nStart), wkbVariantIso,
+                nBytesConsumedOut);
+            if (!poGeom)
+                continue;
+
+            auto &sPrepared = asGeometries[i];
+            sPrepared.poGeom.reset(poGeom);
+            if (!poGeom->IsEmpty())
+                poGeom->getEnvelope(&sPrepared.sEnvelope);
+            // On failure, CreateFeature() will encode the geometry again
+            // and report the error
+            sPrepared.pabyBlob.reset(GPkgGeometryFromOGR(
+                poGeom, m_iSrs, &m_sBinaryPrecision, &sPrepared.nBlobSize));
+        }
+    };
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        ProcessRange(0, nRows);
+        return iGeomChild;
+    }
+
+    // Use several chunks per thread, as the cost of decoding and encoding
+    // can vary a lot from one geometry to another.
+    const size_t nChunks = std::min(nRows, static_cast<size_t>(nThreads) * 4);
+    CPLErrorAccumulator oErrorAccumulator;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const size_t iStart = iChunk * nRows / nChunks;
+        const size_t iEnd = (iChunk + 1) * nRows / nChunks;
+        poJobQueue->SubmitJob(
+            [&ProcessRange, &oErrorAccumulator, iStart, iEnd]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                ProcessRange(iStart, iEnd);
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return iGeomChild;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+// Minimum number of rows of a batch for WriteArrowBatch() to decode and
+// encode geometries in worker threads.
+constexpr int64_t MIN_ROWS_FOR_THREADED_GEOMETRY_ENCODING = 1000;
+
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+
+    const int nThreads = GetThreadsAvailable();
+    if (nThreads < 2 || m_pasPreparedGeometries != nullptr ||
+        array->length < MIN_ROWS_FOR_THREADED_GEOMETRY_ENCODING ||
+        m_poFeatureDefn->GetGeomFieldCount() != 1 ||
+        strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children)
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    std::vector<PreparedGeometry> asGeometries;
+    const int iGeomChild = PrepareGeometries(schema, array, papszOptions,
+                                             nThreads, asGeometries);
+    if (iGeomChild < 0)
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    // Give the batch without its geometry column to the generic
+    // implementation. It calls CreateFeature() for each row, in order, which
+    // picks the geometry prepared for that row.
+    std::vector<struct ArrowSchema *> apsSchemaChildren;
+    std::vector<struct ArrowArray *> apsArrayChildren;
+    for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+    {
+        if (i != iGeomChild)
+        {
+            apsSchemaChildren.push_back(schema->children[i]);
+            apsArrayChildren.push_back(array->children[i]);
+        }
+    }
+    struct ArrowSchema sSchemaView = *schema;
+    sSchemaView.n_children = static_cast<int64_t>(apsSchemaChildren.size());
+    sSchemaView.children = apsSchemaChildren.data();
+    sSchemaView.release = [](struct ArrowSchema *psSchema)
+    { psSchema->release = nullptr; };
+    struct ArrowArray sArrayView = *array;
+    sArrayView.n_children = static_cast<int64_t>(apsArrayChildren.size());
+    sArrayView.children = apsArrayChildren.data();
+    sArrayView.release = [](struct ArrowArray *psArray)
+    { psArray->release = nullptr; };
+
+    m_pasPreparedGeometries = &asGeometries;
+    m_iNextPreparedGeometry = 0;
+    const bool bRet =
+        OGRLayer::WriteArrowBatch(&sSchemaView, &sArrayView, papszOptions);
+    m_pasPreparedGeometries = nullptr;
+    return bRet;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -3609,6 +3849,28 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 /************************************************************************/
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    return GetNextTableFeature(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::GetNextFeatureInto(
+    std::unique_ptr<OGRFeature> &poFeature)
+{
+    if (!poFeature || poFeature->GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(poFeature);
+    return GetNextTableFeature(poFeature.get()) != nullptr;
+}
+
+/************************************************************************/
+/*                         GetNextTableFeature()                        */
+/************************************************************************/
+
+OGRFeature *
+OGRGeoPackageTableLayer::GetNextTableFeature(OGRFeature *poFeatureToReuse)
 {
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
@@ -3625,7 +3887,7 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
             return nullptr;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
+    OGRFeature *poFeature = GetNextFeatureInternal(poFeatureToReuse);
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
@@ -8629,7 +8891,8 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         }
     }
 
-    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")))
+    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(m_aosArrowArrayStreamOptions))
     {
         return OGRGeoPackageLayer::GetNextArrowArray(stream, out_array);
     }
@@ -8642,32 +8905,38 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
+    // We can use this optimized version only if the FID values are not too
+    // sparse, given that batches are read from ranges of FID values (that may
+    // contain holes), which are partitioned among worker threads.
     if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
     {
         m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
+        char *pszSQL =
+            sqlite3_mprintf("SELECT MIN(\"%w\"), MAX(\"%w\") FROM \"%w\"",
+                            m_pszFidColumn, m_pszFidColumn, m_pszTableName);
+        auto oResult = SQLQuery(m_poDS->GetDB(), pszSQL);
+        sqlite3_free(pszSQL);
+        if (!oResult || oResult->RowCount() != 1 ||
+            oResult->GetValue(0, 0) == nullptr ||
+            oResult->GetValue(1, 0) == nullptr)
         {
-            char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
-                                           m_pszFidColumn, m_pszTableName);
-            OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
-            sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
-                return GetNextArrowArrayAsynchronous(stream, out_array);
+            return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        const GIntBig nMinFID = CPLAtoGIntBig(oResult->GetValue(0, 0));
+        const GIntBig nMaxFID = CPLAtoGIntBig(oResult->GetValue(1, 0));
+        // Do not use FID ranges if more than half of them would be holes,
+        // as that would result in too many small or empty batches.
+        if (nMinFID > nMaxFID ||
+            static_cast<uint64_t>(nMaxFID) - static_cast<uint64_t>(nMinFID) >=
+                2 * static_cast<uint64_t>(nTotalFeatureCount))
         {
-            char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
-                                           m_pszFidColumn, m_pszTableName);
-            OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
-            sqlite3_free(pszSQL);
-            if (nMinFID != 1)
-                return GetNextArrowArrayAsynchronous(stream, out_array);
+            return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        m_nArrowMinFID = nMinFID;
+        m_nArrowFIDRange = nMaxFID - nMinFID + 1;
         m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
     }
 
@@ -8678,6 +8947,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
+begin:
     // Fetch the answer from a potentially queued asynchronous task
     if (!m_oQueueArrowArrayPrefetchTasks.empty())
     {
@@ -8709,6 +8979,13 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                 task->m_oThread.join();
         };
 
+        // When FIDs are not consecutive, a range of FIDs may contain no
+        // feature at all, which must not be confused with the end of stream.
+        const bool bEmptyFIDRange =
+            task->m_psArrowArray->release == nullptr &&
+            task->m_osErrorMsg.empty() &&
+            task->m_poLayer->m_iNextShapeId > task->m_iStartShapeId;
+
         if (task->m_iStartShapeId != m_iNextShapeId)
         {
             // Should not normally happen, unless the user messes with
@@ -8722,15 +8999,17 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
 
             stopThread();
         }
-        else if (task->m_psArrowArray->release)
+        else if (task->m_psArrowArray->release || bEmptyFIDRange)
         {
-            m_iNextShapeId += task->m_psArrowArray->length;
+            m_iNextShapeId = task->m_poLayer->m_iNextShapeId;
 
             // Transfer the task ArrowArray to the client array
             memcpy(out_array, task->m_psArrowArray.get(),
                    sizeof(struct ArrowArray));
             memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
 
+            const bool bReturnArray = !bEmptyFIDRange;
+
             const bool bMemoryLimitReached = [&task]()
             {
                 std::unique_lock oLock(task->m_oMutex);
@@ -8748,7 +9027,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             // queued tasks ? If so, recycle this task to read them
             else if (task->m_iStartShapeId +
                          static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
+                     m_nArrowFIDRange)
             {
                 task->m_iStartShapeId +=
                     static_cast<GIntBig>(nTasks) * nMaxBatchSize;
@@ -8762,7 +9041,9 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                         task->m_oCV.notify_one();
                     }
                     m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
+                    if (bReturnArray)
+                        return 0;
+                    goto begin;
                 }
                 catch (const std::exception &e)
                 {
@@ -8773,35 +9054,25 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             else
             {
                 stopThread();
-                return 0;
+                if (bReturnArray)
+                    return 0;
+                goto begin;
             }
         }
 
         stopThread();
     }
 
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
     // Start asynchronous tasks to prefetch the next ArrowArray
     if (m_poDS->GetAccess() == GA_ReadOnly &&
         m_oQueueArrowArrayPrefetchTasks.empty() &&
         m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
+            m_nArrowFIDRange &&
         sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
         CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
     {
         const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
+            DIV_ROUND_UP(m_nArrowFIDRange - nMaxBatchSize - m_iNextShapeId,
                          nMaxBatchSize),
             GetThreadsAvailable()));
         CPLDebug("GPKG", "Using %d threads", nMaxTasks);
@@ -8840,6 +9111,8 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
 
             poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
+            poOtherLayer->m_nArrowMinFID = m_nArrowMinFID;
+            poOtherLayer->m_nArrowFIDRange = m_nArrowFIDRange;
             poOtherLayer->m_aosArrowArrayStreamOptions =
                 m_aosArrowArrayStreamOptions;
             auto poOtherFDefn = poOtherLayer->GetLayerDefn();
@@ -8909,6 +9182,12 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         CancelAsyncNextArrowArray();
         m_nIsCompatOfOptimizedGetNextArrowArray = false;
     }
+    else if (ret == 0 && out_array->release == nullptr && osErrorMsg.empty() &&
+             m_iNextShapeId < m_nArrowFIDRange)
+    {
+        // Range of FIDs without any feature: go on with the next one
+        goto begin;
+    }
     return ret;
 }
 
@@ -8923,7 +9202,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_iNextShapeId >= m_nArrowFIDRange)
     {
         return 0;
     }
@@ -9000,11 +9279,12 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += SQLEscapeName(m_pszTableName);
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
+    const GIntBig nStartFID = m_nArrowMinFID + m_iNextShapeId;
+    const int nMaxBatchSize = sFillArrowArray.psHelper->m_nMaxBatchSize;
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(nStartFID);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
-                            sFillArrowArray.psHelper->m_nMaxBatchSize);
+    osSQL += std::to_string(nStartFID + nMaxBatchSize - 1);
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
 
@@ -9039,11 +9319,54 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
         sFillArrowArray.psHelper->ClearArray();
     }
 
-    m_iNextShapeId += sFillArrowArray.nCountRows;
+    if (IsArrowFIDRangeDense())
+    {
+        m_iNextShapeId += sFillArrowArray.nCountRows;
+    }
+    else if (bMemoryLimitReached)
+    {
+        // The caller will fall back to GetNextArrowArrayAsynchronous(),
+        // which uses m_iNextShapeId as a number of features to skip.
+        m_iNextShapeId =
+            GetFeatureCountBeforeFID(nStartFID) + sFillArrowArray.nCountRows;
+    }
+    else
+    {
+        m_iNextShapeId += nMaxBatchSize;
+    }
 
     return 0;
 }
 
+/************************************************************************/
+/*                        IsArrowFIDRangeDense()                        */
+/************************************************************************/
+
+// Returns whether FIDs are consecutive, in which case m_iNextShapeId is both
+// an offset in the FID range and a number of already read features.
+bool OGRGeoPackageTableLayer::IsArrowFIDRangeDense() const
+{
+    return m_nArrowFIDRange == m_nTotalFeatureCount;
+}
+
+/************************************************************************/
+/*                      GetFeatureCountBeforeFID()                      */
+/************************************************************************/
+
+GIntBig OGRGeoPackageTableLayer::GetFeatureCountBeforeFID(GIntBig nFID)
+{
+    char *pszSQL =
+        sqlite3_mprintf("SELECT COUNT(*) FROM \"%w\" WHERE \"%w\" < ",
+                        m_pszTableName, m_pszFidColumn);
+    std::string osSQL(pszSQL);
+    sqlite3_free(pszSQL);
+    osSQL += std::to_string(nFID);
+    OGRErr err = OGRERR_NONE;
+    const GIntBig nCount =
+        SQLGetInteger64(m_poDS->GetDB(), osSQL.c_str(), &err);
+    return err == OGRERR_NONE ? nCount : 0;
+}
+
 /************************************************************************/
 /*               OGR_GPKG_GeometryExtent3DAggregate()                   */
 /************************************************************************/
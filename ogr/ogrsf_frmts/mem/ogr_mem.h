@@ -15,8 +15,11 @@
 #define OGRMEM_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_recordbatch.h"
 
 #include <map>
+#include <memory>
+#include <vector>
 
 /************************************************************************/
 /*                             OGRMemLayer                              */
@@ -156,6 +159,109 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
     }
 };
 
+/************************************************************************/
+/*                           OGRMemArrowLayer                           */
+/************************************************************************/
+
+/** Layer whose features are stored as a sequence of Arrow record batches,
+ * created with the STORAGE=ARROW layer creation option.
+ *
+ * Batches are exported by GetNextArrowArray() and appended by
+ * WriteArrowBatch() without copying when their schema matches the one of
+ * the layer. Features created with CreateFeature() are accumulated in a
+ * OGRMemLayer and converted to a batch when enough of them are collected,
+ * or before reading.
+ */
+class OGRMemArrowLayer final : public OGRLayer
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemArrowLayer)
+
+    struct Batch
+    {
+        std::shared_ptr<struct ArrowArray> poArray{};
+        // Extent of each geometry field, lazily computed
+        std::map<int, OGREnvelope> oMapEnvelopes{};
+    };
+
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    GDALDataset *m_poDS = nullptr;
+    std::string m_osFIDColumn{};
+    struct ArrowSchema m_sSchema{};
+
+    std::vector<Batch> m_aoBatches{};
+    GIntBig m_nStoredFeatureCount = 0;
+    GIntBig m_nNextFID = 0;
+
+    std::unique_ptr<OGRMemLayer> m_poPendingLayer{};
+
+    size_t m_iNextBatch = 0;
+    std::unique_ptr<OGRMemLayer> m_poCurBatchLayer{};
+    size_t m_iNextArrowBatch = 0;
+
+    std::unique_ptr<OGRMemLayer> CreateRowLayer() const;
+    bool EnsureSchema();
+    void AppendBatch(struct ArrowArray *array);
+    bool FlushPendingFeatures();
+    bool BatchIntersectsFilterEnvelope(Batch &oBatch);
+    bool CanExportBatchesDirectly() const;
+    bool CanAppendBatchDirectly(const struct ArrowSchema *schema,
+                                const struct ArrowArray *array,
+                                CSLConstList papszOptions) const;
+
+  protected:
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+
+  public:
+    OGRMemArrowLayer(const char *pszName, const OGRSpatialReference *poSRS,
+                     OGRwkbGeometryType eGeomType);
+    ~OGRMemArrowLayer() override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+
+    GIntBig GetFeatureCount(int bForce) override;
+
+    OGRErr CreateField(const OGRFieldDefn *poField,
+                       int bApproxOK = TRUE) override;
+    OGRErr CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                           int bApproxOK = TRUE) override;
+
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
+    int TestCapability(const char *) override;
+
+    const char *GetFIDColumn() override
+    {
+        return m_osFIDColumn.c_str();
+    }
+
+    void SetFIDColumn(const char *pszFIDColumn)
+    {
+        m_osFIDColumn = pszFIDColumn;
+    }
+
+    void SetDataset(GDALDataset *poDS)
+    {
+        m_poDS = poDS;
+    }
+
+    GDALDataset *GetDataset() override
+    {
+        return m_poDS;
+    }
+};
+
 /************************************************************************/
 /*                           OGRMemDataSource                           */
 /************************************************************************/
@@ -164,7 +270,7 @@ class OGRMemDataSource CPL_NON_FINAL : public GDALDataset
 {
     CPL_DISALLOW_COPY_ASSIGN(OGRMemDataSource)
 
-    OGRMemLayer **papoLayers;
+    OGRLayer **papoLayers;
     int nLayers;
 
   public:
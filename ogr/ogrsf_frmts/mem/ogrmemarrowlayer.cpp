@@ -0,0 +1,707 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRMemArrowLayer class.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_mem.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "ogr_wkb.h"
+#include "ogrlayerarrow.h"
+
+// Number of features accumulated by CreateFeature() before they are
+// converted to a batch. Same as the default of MAX_FEATURES_IN_BATCH.
+constexpr GIntBig MEM_ARROW_BATCH_SIZE = 65536;
+
+/************************************************************************/
+/*                        ReleaseSharedArray()                          */
+/************************************************************************/
+
+// Release callback of the arrays returned by ShareArrowArray(). Buffers are
+// owned by the stored batch, and are kept alive by the shared pointer held
+// by each node.
+static void ReleaseSharedArray(struct ArrowArray *array)
+{
+    for (int64_t i = 0; i < array->n_children; ++i)
+    {
+        if (array->children[i]->release)
+            array->children[i]->release(array->children[i]);
+        delete array->children[i];
+    }
+    delete[] array->children;
+    if (array->dictionary)
+    {
+        if (array->dictionary->release)
+            array->dictionary->release(array->dictionary);
+        delete array->dictionary;
+    }
+    delete[] array->buffers;
+    delete static_cast<std::shared_ptr<struct ArrowArray> *>(
+        array->private_data);
+    array->release = nullptr;
+}
+
+/************************************************************************/
+/*                          ShareArrowArray()                           */
+/************************************************************************/
+
+// Export in out_array a view of src (that is poHolder or one of its
+// descendants), sharing its buffers.
+static void ShareArrowArray(const std::shared_ptr<struct ArrowArray> &poHolder,
+                            const struct ArrowArray *src,
+                            struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    out_array->length = src->length;
+    out_array->null_count = src->null_count;
+    out_array->offset = src->offset;
+    out_array->n_buffers = src->n_buffers;
+    out_array->n_children = src->n_children;
+    out_array->buffers = new const void *[static_cast<size_t>(src->n_buffers)];
+    for (int64_t i = 0; i < src->n_buffers; ++i)
+        out_array->buffers[i] = src->buffers[i];
+    if (src->n_children)
+    {
+        out_array->children =
+            new struct ArrowArray *[static_cast<size_t>(src->n_children)];
+        for (int64_t i = 0; i < src->n_children; ++i)
+        {
+            out_array->children[i] = new struct ArrowArray;
+            ShareArrowArray(poHolder, src->children[i],
+                            out_array->children[i]);
+        }
+    }
+    if (src->dictionary)
+    {
+        out_array->dictionary = new struct ArrowArray;
+        ShareArrowArray(poHolder, src->dictionary, out_array->dictionary);
+    }
+    out_array->private_data =
+        new std::shared_ptr<struct ArrowArray>(poHolder);
+    out_array->release = ReleaseSharedArray;
+}
+
+/************************************************************************/
+/*                         SchemaFormatsMatch()                         */
+/************************************************************************/
+
+// Whether the two schemas have the same physical layout.
+static bool SchemaFormatsMatch(const struct ArrowSchema *schemaA,
+                               const struct ArrowSchema *schemaB)
+{
+    if (strcmp(schemaA->format, schemaB->format) != 0 ||
+        schemaA->n_children != schemaB->n_children ||
+        (schemaA->dictionary == nullptr) != (schemaB->dictionary == nullptr))
+    {
+        return false;
+    }
+    for (int64_t i = 0; i < schemaA->n_children; ++i)
+    {
+        if (!SchemaFormatsMatch(schemaA->children[i], schemaB->children[i]))
+            return false;
+    }
+    return schemaA->dictionary == nullptr ||
+           SchemaFormatsMatch(schemaA->dictionary, schemaB->dictionary);
+}
+
+/************************************************************************/
+/*                          OGRMemArrowLayer()                          */
+/************************************************************************/
+
+OGRMemArrowLayer::OGRMemArrowLayer(const char *pszName,
+                                   const OGRSpatialReference *poSRSIn,
+                                   OGRwkbGeometryType eReqType)
+    : m_poFeatureDefn(new OGRFeatureDefn(pszName))
+{
+    m_poFeatureDefn->Reference();
+
+    SetDescription(m_poFeatureDefn->GetName());
+    m_poFeatureDefn->SetGeomType(eReqType);
+
+    if (eReqType != wkbNone && poSRSIn != nullptr)
+    {
+        OGRSpatialReference *poSRS = poSRSIn->Clone();
+        m_poFeatureDefn->GetGeomFieldDefn(0)->SetSpatialRef(poSRS);
+        poSRS->Release();
+    }
+
+    m_poFeatureDefn->Seal(/* bSealFields = */ true);
+}
+
+/************************************************************************/
+/*                         ~OGRMemArrowLayer()                          */
+/************************************************************************/
+
+OGRMemArrowLayer::~OGRMemArrowLayer()
+
+{
+    if (m_nFeaturesRead > 0)
+    {
+        CPLDebug("Mem", CPL_FRMT_GIB " features read on layer '%s'.",
+                 m_nFeaturesRead, m_poFeatureDefn->GetName());
+    }
+
+    m_poCurBatchLayer.reset();
+    m_poPendingLayer.reset();
+    m_aoBatches.clear();
+    if (m_sSchema.release)
+        m_sSchema.release(&m_sSchema);
+
+    m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                           CreateRowLayer()                           */
+/************************************************************************/
+
+// Create a (feature-based) OGRMemLayer with the same fields as this layer.
+std::unique_ptr<OGRMemLayer> OGRMemArrowLayer::CreateRowLayer() const
+{
+    auto poLayer = std::make_unique<OGRMemLayer>(m_poFeatureDefn->GetName(),
+                                                 nullptr, wkbNone);
+    poLayer->SetFIDColumn(m_osFIDColumn.c_str());
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+        poLayer->CreateGeomField(m_poFeatureDefn->GetGeomFieldDefn(i));
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+        poLayer->CreateField(m_poFeatureDefn->GetFieldDefn(i));
+    return poLayer;
+}
+
+/************************************************************************/
+/*                            EnsureSchema()                            */
+/************************************************************************/
+
+// Compute the schema of the stored batches, that is the one of the default
+// options of GetArrowStream().
+bool OGRMemArrowLayer::EnsureSchema()
+{
+    if (m_sSchema.release)
+        return true;
+
+    auto poLayer = CreateRowLayer();
+    OGRArrowArrayStream oStream;
+    if (!poLayer->GetArrowStream(oStream.get()) ||
+        oStream.get_schema(&m_sSchema) != 0)
+    {
+        memset(&m_sSchema, 0, sizeof(m_sSchema));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            AppendBatch()                             */
+/************************************************************************/
+
+// Take ownership of the content of array, which is moved.
+void OGRMemArrowLayer::AppendBatch(struct ArrowArray *array)
+{
+    Batch oBatch;
+    oBatch.poArray = std::shared_ptr<struct ArrowArray>(
+        new struct ArrowArray(*array),
+        [](struct ArrowArray *psArray)
+        {
+            if (psArray->release)
+                psArray->release(psArray);
+            delete psArray;
+        });
+    array->release = nullptr;
+    m_nStoredFeatureCount += oBatch.poArray->length;
+    m_aoBatches.push_back(std::move(oBatch));
+}
+
+/************************************************************************/
+/*                        FlushPendingFeatures()                        */
+/************************************************************************/
+
+// Convert the features created with CreateFeature() to batches.
+bool OGRMemArrowLayer::FlushPendingFeatures()
+{
+    if (!m_poPendingLayer)
+        return true;
+
+    const auto poPendingLayer = std::move(m_poPendingLayer);
+    if (!EnsureSchema())
+        return false;
+
+    OGRArrowArrayStream oStream;
+    if (!poPendingLayer->GetArrowStream(oStream.get()))
+        return false;
+    while (true)
+    {
+        struct ArrowArray array;
+        memset(&array, 0, sizeof(array));
+        if (oStream.get_next(&array) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot convert pending features to an Arrow batch");
+            return false;
+        }
+        if (array.release == nullptr)
+            break;
+        AppendBatch(&array);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRMemArrowLayer::ResetReading()
+
+{
+    m_iNextBatch = 0;
+    m_poCurBatchLayer.reset();
+    m_iNextArrowBatch = 0;
+}
+
+/************************************************************************/
+/*                   BatchIntersectsFilterEnvelope()                    */
+/************************************************************************/
+
+bool OGRMemArrowLayer::BatchIntersectsFilterEnvelope(Batch &oBatch)
+{
+    auto oIter = oBatch.oMapEnvelopes.find(m_iGeomFieldFilter);
+    if (oIter == oBatch.oMapEnvelopes.end())
+    {
+        const auto poGeomFieldDefn =
+            m_poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
+        const char *pszName = poGeomFieldDefn->GetNameRef();
+        if (pszName[0] == '\0')
+            pszName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+        const struct ArrowArray *array = oBatch.poArray.get();
+        const struct ArrowArray *psGeomArray = nullptr;
+        const struct ArrowSchema *psGeomSchema = nullptr;
+        for (int64_t i = 0; i < m_sSchema.n_children; ++i)
+        {
+            if (strcmp(m_sSchema.children[i]->name, pszName) == 0)
+            {
+                psGeomSchema = m_sSchema.children[i];
+                psGeomArray = array->children[i];
+                break;
+            }
+        }
+
+        OGREnvelope sEnvelope;
+        if (psGeomArray == nullptr ||
+            (strcmp(psGeomSchema->format, "z") != 0 &&
+             strcmp(psGeomSchema->format, "Z") != 0))
+        {
+            // Should not happen. Do not prune anything
+            sEnvelope.MinX = -std::numeric_limits<double>::infinity();
+            sEnvelope.MinY = -std::numeric_limits<double>::infinity();
+            sEnvelope.MaxX = std::numeric_limits<double>::infinity();
+            sEnvelope.MaxY = std::numeric_limits<double>::infinity();
+        }
+        else
+        {
+            const bool bLargeBinary = strcmp(psGeomSchema->format, "Z") == 0;
+            const auto pabyValidity =
+                static_cast<const GByte *>(psGeomArray->buffers[0]);
+            const auto panOffsets32 =
+                static_cast<const int32_t *>(psGeomArray->buffers[1]);
+            const auto panOffsets64 =
+                static_cast<const int64_t *>(psGeomArray->buffers[1]);
+            const auto pabyData =
+                static_cast<const GByte *>(psGeomArray->buffers[2]);
+            for (int64_t iRow = 0; iRow < psGeomArray->length; ++iRow)
+            {
+                const int64_t iIdx = iRow + psGeomArray->offset;
+                if (psGeomArray->null_count != 0 && pabyValidity &&
+                    (pabyValidity[iIdx / 8] & (1 << (iIdx % 8))) == 0)
+                {
+                    continue;
+                }
+                const int64_t nStart =
+                    bLargeBinary ? panOffsets64[iIdx] : panOffsets32[iIdx];
+                const int64_t nEnd = bLargeBinary ? panOffsets64[iIdx + 1]
+                                                  : panOffsets32[iIdx + 1];
+                OGREnvelope sGeomEnvelope;
+                if (nEnd > nStart &&
+                    OGRWKBGetBoundingBox(pabyData + nStart,
+                                         static_cast<size_t>(nEnd - nStart),
+                                         sGeomEnvelope))
+                {
+                    sEnvelope.Merge(sGeomEnvelope);
+                }
+            }
+        }
+        oIter = oBatch.oMapEnvelopes.emplace(m_iGeomFieldFilter, sEnvelope)
+                    .first;
+    }
+    return oIter->second.Intersects(m_sFilterEnvelope);
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRMemArrowLayer::GetNextFeature()
+{
+    if (!FlushPendingFeatures())
+        return nullptr;
+
+    while (true)
+    {
+        if (!m_poCurBatchLayer)
+        {
+            if (m_iNextBatch >= m_aoBatches.size())
+                return nullptr;
+            auto &oBatch = m_aoBatches[m_iNextBatch++];
+            if (m_poFilterGeom != nullptr &&
+                !BatchIntersectsFilterEnvelope(oBatch))
+            {
+                continue;
+            }
+
+            // Decode the batch into a temporary feature-based layer
+            auto poLayer = CreateRowLayer();
+            struct ArrowArray array;
+            ShareArrowArray(oBatch.poArray, oBatch.poArray.get(), &array);
+            const bool bOK = poLayer->WriteArrowBatch(&m_sSchema, &array);
+            if (array.release)
+                array.release(&array);
+            if (!bOK)
+                return nullptr;
+            m_poCurBatchLayer = std::move(poLayer);
+        }
+
+        auto poFeature =
+            std::unique_ptr<OGRFeature>(m_poCurBatchLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            m_poCurBatchLayer.reset();
+            continue;
+        }
+        poFeature->SetFDefnUnsafe(m_poFeatureDefn);
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get())))
+        {
+            m_nFeaturesRead++;
+            return poFeature.release();
+        }
+    }
+}
+
+/************************************************************************/
+/*                           ICreateFeature()                           */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::ICreateFeature(OGRFeature *poFeature)
+
+{
+    if (poFeature->GetFID() == OGRNullFID)
+    {
+        poFeature->SetFID(m_nNextFID++);
+    }
+    else if (poFeature->GetFID() < 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Negative FID values are not supported");
+        return OGRERR_FAILURE;
+    }
+    else
+    {
+        m_nNextFID = std::max(m_nNextFID, poFeature->GetFID() + 1);
+    }
+
+    if (!m_poPendingLayer)
+        m_poPendingLayer = CreateRowLayer();
+    if (m_poPendingLayer->CreateFeature(poFeature) != OGRERR_NONE)
+        return OGRERR_FAILURE;
+
+    if (m_poPendingLayer->GetFeatureCount(FALSE) >= MEM_ARROW_BATCH_SIZE &&
+        !FlushPendingFeatures())
+    {
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRMemArrowLayer::GetFeatureCount(int bForce)
+{
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr)
+        return OGRLayer::GetFeatureCount(bForce);
+
+    return m_nStoredFeatureCount +
+           (m_poPendingLayer ? m_poPendingLayer->GetFeatureCount(FALSE) : 0);
+}
+
+/************************************************************************/
+/*                            CreateField()                             */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::CreateField(const OGRFieldDefn *poField,
+                                     int /* bApproxOK */)
+{
+    if (m_nStoredFeatureCount > 0 || m_poPendingLayer)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Cannot add a field to a layer with STORAGE=ARROW that "
+                 "has features");
+        return OGRERR_FAILURE;
+    }
+
+    whileUnsealing(m_poFeatureDefn)->AddFieldDefn(poField);
+    if (m_sSchema.release)
+        m_sSchema.release(&m_sSchema);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          CreateGeomField()                           */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                                         int /* bApproxOK */)
+{
+    if (m_nStoredFeatureCount > 0 || m_poPendingLayer)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Cannot add a geometry field to a layer with STORAGE=ARROW "
+                 "that has features");
+        return OGRERR_FAILURE;
+    }
+
+    whileUnsealing(m_poFeatureDefn)->AddGeomFieldDefn(poGeomField);
+    if (m_sSchema.release)
+        m_sSchema.release(&m_sSchema);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+bool OGRMemArrowLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                      CSLConstList papszOptions)
+{
+    if (!FlushPendingFeatures())
+        return false;
+    m_iNextArrowBatch = 0;
+    return OGRLayer::GetArrowStream(out_stream, papszOptions);
+}
+
+/************************************************************************/
+/*                      CanExportBatchesDirectly()                      */
+/************************************************************************/
+
+// Whether the stored batches match what GetNextArrowArray() must return
+// with the current filters and options of GetArrowStream().
+bool OGRMemArrowLayer::CanExportBatchesDirectly() const
+{
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr ||
+        !m_aosArrowArrayStreamOptions.FetchBool("INCLUDE_FID", true) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(
+            m_aosArrowArrayStreamOptions) ||
+        m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                               false) ||
+        m_aosArrowArrayStreamOptions.FetchNameValue("TIMEZONE") != nullptr)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+    {
+        if (m_poFeatureDefn->GetFieldDefn(i)->IsIgnored())
+            return false;
+    }
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        if (m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored())
+            return false;
+    }
+
+    const char *pszMaxFeaturesInBatch =
+        m_aosArrowArrayStreamOptions.FetchNameValue("MAX_FEATURES_IN_BATCH");
+    if (pszMaxFeaturesInBatch)
+    {
+        const int64_t nMaxFeaturesInBatch =
+            std::max<int64_t>(1, CPLAtoGIntBig(pszMaxFeaturesInBatch));
+        for (const auto &oBatch : m_aoBatches)
+        {
+            if (oBatch.poArray->length > nMaxFeaturesInBatch)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRMemArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                        struct ArrowArray *out_array)
+{
+    if (!CanExportBatchesDirectly())
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    memset(out_array, 0, sizeof(*out_array));
+    if (m_iNextArrowBatch >= m_aoBatches.size())
+        return 0;
+
+    const auto &poArray = m_aoBatches[m_iNextArrowBatch++].poArray;
+    ShareArrowArray(poArray, poArray.get(), out_array);
+    return 0;
+}
+
+/************************************************************************/
+/*                       CanAppendBatchDirectly()                       */
+/************************************************************************/
+
+// Whether the batch has exactly the layout of the stored batches.
+bool OGRMemArrowLayer::CanAppendBatchDirectly(const struct ArrowSchema *schema,
+                                              const struct ArrowArray *array,
+                                              CSLConstList papszOptions) const
+{
+    if (array->release == nullptr || array->offset != 0 ||
+        array->null_count != 0 || strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != m_sSchema.n_children ||
+        array->n_children != schema->n_children)
+    {
+        return false;
+    }
+
+    const char *pszFIDName = m_osFIDColumn.empty()
+                                 ? DEFAULT_ARROW_FID_NAME
+                                 : m_osFIDColumn.c_str();
+    const char *pszInputFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", m_osFIDColumn.c_str());
+    if (pszInputFIDName[0] == '\0')
+        pszInputFIDName = DEFAULT_ARROW_FID_NAME;
+    if (strcmp(pszFIDName, pszInputFIDName) != 0)
+        return false;
+
+    for (int64_t i = 0; i < m_sSchema.n_children; ++i)
+    {
+        const auto psLayerChild = m_sSchema.children[i];
+        const auto psChild = schema->children[i];
+        if (strcmp(psLayerChild->name, psChild->name) != 0 ||
+            !SchemaFormatsMatch(psLayerChild, psChild) ||
+            array->children[i]->length != array->length)
+        {
+            return false;
+        }
+        if (strcmp(psLayerChild->name, pszFIDName) == 0)
+        {
+            // FIDs must all be set
+            if (array->children[i]->null_count != 0)
+                return false;
+        }
+        else if (m_poFeatureDefn->GetGeomFieldIndex(psLayerChild->name) >= 0 ||
+                 (strcmp(psLayerChild->name, DEFAULT_ARROW_GEOMETRY_NAME) ==
+                      0 &&
+                  m_poFeatureDefn->GetGeomFieldCount() > 0))
+        {
+            // Geometry columns must be advertized as such
+            const auto oMetadata =
+                OGRParseArrowMetadata(psChild->metadata);
+            const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+            if (oIter == oMetadata.end() ||
+                (oIter->second != EXTENSION_NAME_OGC_WKB &&
+                 oIter->second != EXTENSION_NAME_GEOARROW_WKB))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRMemArrowLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                       struct ArrowArray *array,
+                                       CSLConstList papszOptions)
+{
+    if (!EnsureSchema())
+        return false;
+
+    if (!CanAppendBatchDirectly(schema, array, papszOptions))
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    if (!FlushPendingFeatures())
+        return false;
+
+    // Find the FID column to update the next FID to assign
+    const char *pszFIDName = m_osFIDColumn.empty()
+                                 ? DEFAULT_ARROW_FID_NAME
+                                 : m_osFIDColumn.c_str();
+    for (int64_t i = 0; i < m_sSchema.n_children; ++i)
+    {
+        if (strcmp(m_sSchema.children[i]->name, pszFIDName) == 0)
+        {
+            const auto psFIDArray = array->children[i];
+            const bool bInt32 = strcmp(m_sSchema.children[i]->format, "i") == 0;
+            for (int64_t iRow = 0; iRow < psFIDArray->length; ++iRow)
+            {
+                const int64_t iIdx = iRow + psFIDArray->offset;
+                const GIntBig nFID =
+                    bInt32
+                        ? static_cast<const int32_t *>(
+                              psFIDArray->buffers[1])[iIdx]
+                        : static_cast<const int64_t *>(
+                              psFIDArray->buffers[1])[iIdx];
+                m_nNextFID = std::max(m_nNextFID, nFID + 1);
+            }
+            break;
+        }
+    }
+
+    AppendBatch(array);
+    return true;
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRMemArrowLayer::TestCapability(const char *pszCap)
+
+{
+    if (EQUAL(pszCap, OLCSequentialWrite) ||
+        EQUAL(pszCap, OLCFastGetArrowStream) ||
+        EQUAL(pszCap, OLCFastWriteArrowBatch))
+        return TRUE;
+
+    else if (EQUAL(pszCap, OLCFastFeatureCount))
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+
+    else if (EQUAL(pszCap, OLCCreateField) ||
+             EQUAL(pszCap, OLCCreateGeomField))
+        return m_nStoredFeatureCount == 0 && !m_poPendingLayer;
+
+    else if (EQUAL(pszCap, OLCStringsAsUTF8) ||
+             EQUAL(pszCap, OLCCurveGeometries) ||
+             EQUAL(pszCap, OLCMeasuredGeometries) ||
+             EQUAL(pszCap, OLCZGeometries))
+        return TRUE;
+
+    return FALSE;
+}
@@ -64,21 +64,35 @@ OGRMemDataSource::ICreateLayer(const char *pszLayerName,
         poSRS = poSRSIn->Clone();
         poSRS->SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     }
-    OGRMemLayer *poLayer = new OGRMemLayer(pszLayerName, poSRS, eType);
+    OGRLayer *poLayer = nullptr;
+    if (EQUAL(CSLFetchNameValueDef(papszOptions, "STORAGE", "FEATURE"),
+              "ARROW"))
+    {
+        auto poArrowLayer = new OGRMemArrowLayer(pszLayerName, poSRS, eType);
+        poArrowLayer->SetDataset(this);
+        poArrowLayer->SetFIDColumn(
+            CSLFetchNameValueDef(papszOptions, "FID", ""));
+        poLayer = poArrowLayer;
+    }
+    else
+    {
+        auto poMemLayer = new OGRMemLayer(pszLayerName, poSRS, eType);
+        if (CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false))
+            poMemLayer->SetAdvertizeUTF8(true);
+
+        poMemLayer->SetDataset(this);
+        poMemLayer->SetFIDColumn(
+            CSLFetchNameValueDef(papszOptions, "FID", ""));
+        poLayer = poMemLayer;
+    }
     if (poSRS)
     {
         poSRS->Release();
     }
 
-    if (CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false))
-        poLayer->SetAdvertizeUTF8(true);
-
-    poLayer->SetDataset(this);
-    poLayer->SetFIDColumn(CSLFetchNameValueDef(papszOptions, "FID", ""));
-
     // Add layer to data source layer list.
-    papoLayers = static_cast<OGRMemLayer **>(
-        CPLRealloc(papoLayers, sizeof(OGRMemLayer *) * (nLayers + 1)));
+    papoLayers = static_cast<OGRLayer **>(
+        CPLRealloc(papoLayers, sizeof(OGRLayer *) * (nLayers + 1)));
 
     papoLayers[nLayers++] = poLayer;
 
@@ -186,7 +200,7 @@ bool OGRMemDataSource::DeleteFieldDomain(const std::string &name,
 
     for (int i = 0; i < nLayers; i++)
     {
-        OGRMemLayer *poLayer = papoLayers[i];
+        OGRLayer *poLayer = papoLayers[i];
         for (int j = 0; j < poLayer->GetLayerDefn()->GetFieldCount(); ++j)
         {
             OGRFieldDefn *poFieldDefn =
@@ -231,7 +245,10 @@ OGRLayer *OGRMemDataSource::ExecuteSQL(const char *pszStatement,
     if (EQUAL(pszStatement, "PRAGMA read_only=1"))  // as used by VDV driver
     {
         for (int i = 0; i < nLayers; ++i)
-            papoLayers[i]->SetUpdatable(false);
+        {
+            if (auto poMemLayer = dynamic_cast<OGRMemLayer *>(papoLayers[i]))
+                poMemLayer->SetUpdatable(false);
+        }
         return nullptr;
     }
     return GDALDataset::ExecuteSQL(pszStatement, poSpatialFilter, pszDialect);
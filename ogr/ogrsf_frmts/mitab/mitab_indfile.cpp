@@ -20,6 +20,7 @@
 #include <cctype>
 #include <cstring>
 #include <algorithm>
+#include <set>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -692,6 +693,47 @@ GInt32 TABINDFile::FindNext(int nIndexNumber, GByte *pKeyValue)
     return m_papoIndexRootNodes[nIndexNumber - 1]->FindNext(pKeyValue);
 }
 
+/**********************************************************************
+ *                   TABINDFile::GetKeyLength()
+ *
+ * Return the length of the keys of the specified index, or -1 if the
+ * index number is invalid.
+ *
+ * Note that index numbers are positive values starting at 1.
+ **********************************************************************/
+int TABINDFile::GetKeyLength(int nIndexNumber)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    return m_papoIndexRootNodes[nIndexNumber - 1]->GetKeyLength();
+}
+
+/**********************************************************************
+ *                   TABINDFile::FindRange()
+ *
+ * Search one of the indexes for all the keys between pMinKeyValue and
+ * pMaxKeyValue (both included), in the order of the index. A NULL
+ * pMinKeyValue or pMaxKeyValue means that the range is unbounded on that
+ * side. The corresponding record numbers are appended to anRecordNos.
+ *
+ * Note that index numbers are positive values starting at 1, and that
+ * BuildKey() returns a buffer that is overwritten by the next call, so
+ * the min key must be copied before building the max key.
+ *
+ * Returns 0 on success, -1 on error.
+ **********************************************************************/
+int TABINDFile::FindRange(int nIndexNumber, const GByte *pMinKeyValue,
+                          const GByte *pMaxKeyValue,
+                          std::vector<GInt32> &anRecordNos)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    return m_papoIndexRootNodes[nIndexNumber - 1]->FindRange(
+        pMinKeyValue, pMaxKeyValue, anRecordNos);
+}
+
 /**********************************************************************
  *                   TABINDFile::CreateIndex()
  *
@@ -1392,6 +1434,124 @@ GInt32 TABINDNode::FindNext(GByte *pKeyValue)
     return 0;
 }
 
+/**********************************************************************
+ *                   TABINDNode::FindRange()
+ *
+ * Append to anRecordNos the record numbers of all the keys of this node
+ * and its children that are between pMinKeyValue and pMaxKeyValue (both
+ * included, and NULL meaning unbounded).
+ *
+ * We descend to the leaf that may contain the first key >= pMinKeyValue,
+ * and then walk the chain of leaves until a key > pMaxKeyValue is found.
+ *
+ * Returns 0 on success, -1 on error.
+ **********************************************************************/
+int TABINDNode::FindRange(const GByte *pMinKeyValue, const GByte *pMaxKeyValue,
+                          std::vector<GInt32> &anRecordNos)
+{
+    if (m_poDataBlock == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AssertionFailed,
+                 "TABINDNode::FindRange(): Node has not been initialized yet!");
+        return -1;
+    }
+
+    if (m_nSubTreeDepth > 1)
+    {
+        /*-------------------------------------------------------------
+         * Index Node: the key of each entry is the first key of the
+         * corresponding child. Keys equal to pMinKeyValue may be found at
+         * the end of the child preceding the first entry equal to it, so
+         * we go to the last child whose first key is < pMinKeyValue.
+         *------------------------------------------------------------*/
+        m_nCurIndexEntry = 0;
+        if (pMinKeyValue)
+        {
+            while (m_nCurIndexEntry + 1 < m_numEntriesInNode &&
+                   IndexKeyCmp(pMinKeyValue, m_nCurIndexEntry + 1) > 0)
+            {
+                m_nCurIndexEntry++;
+            }
+        }
+
+        const int nChildNodePtr = ReadIndexEntry(m_nCurIndexEntry, nullptr);
+        if (nChildNodePtr <= 0)
+        {
+            /* Empty index */
+            return 0;
+        }
+        else if ((nChildNodePtr % 512) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Invalid child node pointer");
+            return -1;
+        }
+        else if (m_poCurChildNode == nullptr)
+        {
+            m_poCurChildNode = new TABINDNode(m_eAccessMode);
+            if (m_poCurChildNode->InitNode(m_fp, nChildNodePtr, m_nKeyLength,
+                                           m_nSubTreeDepth - 1, m_bUnique,
+                                           m_poBlockManagerRef, this) != 0 ||
+                m_poCurChildNode->SetFieldType(m_eFieldType) != 0)
+            {
+                // An error happened... and was already reported
+                return -1;
+            }
+        }
+
+        if (m_poCurChildNode->GotoNodePtr(nChildNodePtr) != 0)
+        {
+            // An error happened and has already been reported
+            return -1;
+        }
+
+        return m_poCurChildNode->FindRange(pMinKeyValue, pMaxKeyValue,
+                                           anRecordNos);
+    }
+
+    /*-----------------------------------------------------------------
+     * Leaf node level... collect entries until the max key is passed,
+     * continuing with the next nodes of the chain.
+     *----------------------------------------------------------------*/
+    std::set<int> oSetVisitedNodePtr;
+    m_nCurIndexEntry = 0;
+    while (true)
+    {
+        if (m_nCurIndexEntry >= m_numEntriesInNode)
+        {
+            if (m_nNextNodePtr <= 0)
+                break;
+            if ((m_nNextNodePtr % 512) != 0 ||
+                !oSetVisitedNodePtr.insert(m_nNextNodePtr).second)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid next node pointer structure");
+                return -1;
+            }
+            if (GotoNodePtr(m_nNextNodePtr) != 0)
+                return -1;
+            m_nCurIndexEntry = 0;
+            continue;
+        }
+
+        if (pMinKeyValue && IndexKeyCmp(pMinKeyValue, m_nCurIndexEntry) > 0)
+        {
+            /* Not there yet... (pMinKey > IndexEntry) */
+            m_nCurIndexEntry++;
+            continue;
+        }
+        if (pMaxKeyValue && IndexKeyCmp(pMaxKeyValue, m_nCurIndexEntry) < 0)
+        {
+            /* Past the end of the range (pMaxKey < IndexEntry) */
+            break;
+        }
+
+        anRecordNos.push_back(ReadIndexEntry(m_nCurIndexEntry, nullptr));
+        m_nCurIndexEntry++;
+    }
+
+    return 0;
+}
+
 /**********************************************************************
  *                   TABINDNode::CommitToFile()
  *
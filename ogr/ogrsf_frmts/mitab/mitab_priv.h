@@ -22,6 +22,7 @@
 #include "ogrmitabspatialref.h"
 
 #include <set>
+#include <vector>
 
 class TABFile;
 class TABFeature;
@@ -1686,6 +1687,8 @@ class TABINDNode
 
     GInt32 FindFirst(const GByte *pKeyValue);
     GInt32 FindNext(GByte *pKeyValue);
+    int FindRange(const GByte *pMinKeyValue, const GByte *pMaxKeyValue,
+                  std::vector<GInt32> &anRecordNos);
 
     int CommitToFile();
 
@@ -1750,6 +1753,7 @@ class TABINDFile
         return m_numIndexes;
     }
 
+    int GetKeyLength(int nIndexNumber);
     int SetIndexFieldType(int nIndexNumber, TABFieldType eType);
     int SetIndexUnique(int nIndexNumber, GBool bUnique = TRUE);
     GByte *BuildKey(int nIndexNumber, GInt32 nValue);
@@ -1758,6 +1762,8 @@ class TABINDFile
     GByte *BuildKey(int nIndexNumber, double dValue);
     GInt32 FindFirst(int nIndexNumber, GByte *pKeyValue);
     GInt32 FindNext(int nIndexNumber, GByte *pKeyValue);
+    int FindRange(int nIndexNumber, const GByte *pMinKeyValue,
+                  const GByte *pMaxKeyValue, std::vector<GInt32> &anRecordNos);
 
     int CreateIndex(TABFieldType eType, int nFieldSize);
     int AddEntry(int nIndexNumber, GByte *pKeyValue, GInt32 nRecordNo);
@@ -257,3 +257,9 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
         poGeom->assignSpatialReference(poSRS);
     return poFeature;
 }
+
+/************************************************************************/
+/*                      ~OGRMVTWriterTileSink()                         */
+/************************************************************************/
+
+OGRMVTWriterTileSink::~OGRMVTWriterTileSink() = default;
@@ -16,6 +16,12 @@
 #include "cpl_json.h"
 #include "ogrsf_frmts.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #define MVT_LCO                                                                \
     "<LayerCreationOptionList>"                                                \
     "  <Option name='MINZOOM' type='int' min='0' max='22' "                    \
@@ -74,10 +80,44 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
                                     bool bJsonField,
                                     OGRSpatialReference *poSRS);
 
+/************************************************************************/
+/*                         OGRMVTWriterTileSink                         */
+/************************************************************************/
+
+/** Receives the tiles encoded by the MVT writer, instead of them being
+ * written into a directory or a MBTiles file.
+ *
+ * Tiles are emitted in ascending order of GetTileOrderKey(). The MVT writer
+ * sorts the features it has clipped per tile in that order, in a bounded
+ * amount of memory, spilling sorted runs to a temporary file if needed.
+ */
+class OGRMVTWriterTileSink
+{
+  public:
+    virtual ~OGRMVTWriterTileSink();
+
+    /** Return the ordering key of a tile (nY=0 is the top-most row). */
+    virtual uint64_t GetTileOrderKey(int nZ, int nX, int nY) const = 0;
+
+    /** Receive the (possibly compressed) data of a tile. */
+    virtual bool WriteTile(int nZ, int nX, int nY,
+                           const std::string &osData) = 0;
+
+    /** Called once all tiles have been written, with the items that
+     * would have been written in the MBTiles metadata table. */
+    virtual bool
+    Finalize(const std::vector<std::pair<std::string, std::string>>
+                 &aoMetadata) = 0;
+};
+
 // #ifdef HAVE_MVT_WRITE_SUPPORT
 GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
                                        int nYSize, int nBandsIn,
                                        GDALDataType eDT, char **papszOptions);
+
+GDALDataset *
+OGRMVTWriterDatasetCreate(const char *pszFilename, CSLConstList papszOptions,
+                          std::unique_ptr<OGRMVTWriterTileSink> poTileSink);
 // #endif
 
 #endif  // MVTUTILS_H
@@ -59,8 +59,13 @@ constexpr int knMAX_FILES_PER_DIR = 10000;
 
 #include "../sqlite/ogrsqlitevfs.h"
 
+#include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <cstring>
+#include <deque>
+#include <future>
+#include <limits>
 #include <mutex>
 
 // Limitations from https://github.com/mapbox/mapbox-geostats
@@ -3320,6 +3325,568 @@ struct OGRMVTFeatureContent
     GIntBig nFID;
 };
 
+/************************************************************************/
+/*                          OGRMVTTempFeature                           */
+/************************************************************************/
+
+// A feature clipped to a tile, encoded as a zlib-compressed MVT layer with
+// a single feature, in the coordinates of the tile.
+struct OGRMVTTempFeature
+{
+    std::string osLayer{};
+    GIntBig nSerial = 0;
+    double dfAreaOrLength = 0;
+    std::string osBlob{};
+};
+
+/************************************************************************/
+/*                       OGRMVTTempFeatureSorter                        */
+/************************************************************************/
+
+// Sorts temporary features by tile key, layer name and serial number, using
+// a bounded amount of memory. When it is exceeded, the features in memory
+// are sorted and written as a run in a temporary file. Runs are merged when
+// reading back, with intermediate merge passes if there are too many of
+// them for the memory budget.
+class OGRMVTTempFeatureSorter
+{
+  public:
+    OGRMVTTempFeatureSorter(const std::string &osTmpFilename,
+                            size_t nMaxMemory)
+        : m_osTmpFilename(osTmpFilename), m_nMaxMemory(nMaxMemory)
+    {
+    }
+
+    ~OGRMVTTempFeatureSorter();
+
+    bool Add(uint64_t nTileKey, int nZ, int nX, int nY,
+             OGRMVTTempFeature &&oFeature);
+
+    bool StartReading();
+
+    bool GetNextTile(int &nZ, int &nX, int &nY,
+                     std::vector<OGRMVTTempFeature> &aoFeatures);
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRMVTTempFeatureSorter)
+
+    struct Record
+    {
+        uint64_t nTileKey = 0;
+        int nZ = 0;
+        int nX = 0;
+        int nY = 0;
+        // Insertion order, to break ties as the temporary database does
+        GIntBig nSeq = 0;
+        OGRMVTTempFeature oFeature{};
+
+        bool operator<(const Record &other) const
+        {
+            if (nTileKey != other.nTileKey)
+                return nTileKey < other.nTileKey;
+            const int nCmp = oFeature.osLayer.compare(other.oFeature.osLayer);
+            if (nCmp != 0)
+                return nCmp < 0;
+            if (oFeature.nSerial != other.oFeature.nSerial)
+                return oFeature.nSerial < other.oFeature.nSerial;
+            return nSeq < other.nSeq;
+        }
+    };
+
+    struct Run
+    {
+        vsi_l_offset nStart = 0;
+        vsi_l_offset nEnd = 0;
+    };
+
+    struct RunReader
+    {
+        vsi_l_offset nNextOffset = 0;
+        vsi_l_offset nEnd = 0;
+        std::string osBuffer{};
+        size_t nBufferPos = 0;
+        Record oRecord{};
+    };
+
+    // Size of the read buffer of each run being merged
+    static constexpr size_t RUN_BUFFER_SIZE = 64 * 1024;
+
+    std::string m_osTmpFilename;
+    VSIVirtualHandleUniquePtr m_fpTmp{};
+    vsi_l_offset m_nTmpFileSize = 0;
+    size_t m_nMaxMemory;
+    size_t m_nMemory = 0;
+    GIntBig m_nSeq = 0;
+    bool m_bError = false;
+    std::vector<Record> m_asRecords{};
+    std::vector<Run> m_asRuns{};
+
+    // State used when reading back
+    size_t m_nNextRecord = 0;
+    std::vector<RunReader> m_asReaders{};
+    std::vector<size_t> m_anHeap{};
+    bool m_bHasPending = false;
+    Record m_oPending{};
+
+    static size_t GetMemoryUsage(const Record &oRecord)
+    {
+        return sizeof(Record) + oRecord.oFeature.osLayer.size() +
+               oRecord.oFeature.osBlob.size();
+    }
+
+    bool OpenTmpFile();
+    bool WriteRecords(const std::vector<Record> &asRecords);
+    bool FlushRun();
+    bool ReaderGreater(size_t a, size_t b) const
+    {
+        return m_asReaders[b].oRecord < m_asReaders[a].oRecord;
+    }
+
+    bool InitReaders(size_t iFirstRun, size_t nRuns);
+    bool ReadBytes(RunReader &oReader, void *pDest, size_t nSize);
+    bool ReadRecord(RunReader &oReader, Record &oRecord, bool &bEOF);
+    bool NextMerged(Record &oRecord, bool &bEOF);
+    bool NextRecord(Record &oRecord, bool &bEOF);
+};
+
+/************************************************************************/
+/*                     ~OGRMVTTempFeatureSorter()                       */
+/************************************************************************/
+
+OGRMVTTempFeatureSorter::~OGRMVTTempFeatureSorter()
+{
+    if (m_fpTmp)
+    {
+        m_fpTmp.reset();
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                            OpenTmpFile()                             */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::OpenTmpFile()
+{
+    m_fpTmp.reset(VSIFOpenL(m_osTmpFilename.c_str(), "wb+"));
+    if (!m_fpTmp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    // For Unix
+    VSIUnlink(m_osTmpFilename.c_str());
+    return true;
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::Add(uint64_t nTileKey, int nZ, int nX, int nY,
+                                  OGRMVTTempFeature &&oFeature)
+{
+    if (m_bError)
+        return false;
+    try
+    {
+        Record oRecord;
+        oRecord.nTileKey = nTileKey;
+        oRecord.nZ = nZ;
+        oRecord.nX = nX;
+        oRecord.nY = nY;
+        oRecord.nSeq = m_nSeq++;
+        oRecord.oFeature = std::move(oFeature);
+        m_nMemory += GetMemoryUsage(oRecord);
+        m_asRecords.push_back(std::move(oRecord));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in OGRMVTTempFeatureSorter::Add(): %s",
+                 e.what());
+        m_bError = true;
+        return false;
+    }
+    if (m_nMemory > m_nMaxMemory)
+        return FlushRun();
+    return true;
+}
+
+/************************************************************************/
+/*                           WriteRecords()                             */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::WriteRecords(const std::vector<Record> &asRecords)
+{
+    std::string osBuffer;
+    const auto Append = [&osBuffer](const void *pData, size_t nSize)
+    { osBuffer.append(static_cast<const char *>(pData), nSize); };
+
+    for (size_t i = 0; i < asRecords.size(); ++i)
+    {
+        const Record &oRecord = asRecords[i];
+        const auto &oFeature = oRecord.oFeature;
+        const uint32_t nLayerSize =
+            static_cast<uint32_t>(oFeature.osLayer.size());
+        const uint32_t nBlobSize =
+            static_cast<uint32_t>(oFeature.osBlob.size());
+        Append(&oRecord.nTileKey, sizeof(oRecord.nTileKey));
+        Append(&oRecord.nZ, sizeof(oRecord.nZ));
+        Append(&oRecord.nX, sizeof(oRecord.nX));
+        Append(&oRecord.nY, sizeof(oRecord.nY));
+        Append(&oRecord.nSeq, sizeof(oRecord.nSeq));
+        Append(&oFeature.nSerial, sizeof(oFeature.nSerial));
+        Append(&oFeature.dfAreaOrLength, sizeof(oFeature.dfAreaOrLength));
+        Append(&nLayerSize, sizeof(nLayerSize));
+        Append(&nBlobSize, sizeof(nBlobSize));
+        Append(oFeature.osLayer.data(), nLayerSize);
+        Append(oFeature.osBlob.data(), nBlobSize);
+        if (osBuffer.size() >= RUN_BUFFER_SIZE || i + 1 == asRecords.size())
+        {
+            if (m_fpTmp->Seek(m_nTmpFileSize, SEEK_SET) != 0 ||
+                m_fpTmp->Write(osBuffer.data(), 1, osBuffer.size()) !=
+                    osBuffer.size())
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                         m_osTmpFilename.c_str());
+                return false;
+            }
+            m_nTmpFileSize += osBuffer.size();
+            osBuffer.clear();
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             FlushRun()                               */
+/************************************************************************/
+
+// Sort the records in memory and write them as a new run
+bool OGRMVTTempFeatureSorter::FlushRun()
+{
+    if (m_asRecords.empty())
+        return true;
+    if (!m_fpTmp && !OpenTmpFile())
+    {
+        m_bError = true;
+        return false;
+    }
+
+    std::sort(m_asRecords.begin(), m_asRecords.end());
+    Run sRun;
+    sRun.nStart = m_nTmpFileSize;
+    if (!WriteRecords(m_asRecords))
+    {
+        m_bError = true;
+        return false;
+    }
+    sRun.nEnd = m_nTmpFileSize;
+    m_asRuns.push_back(sRun);
+
+    m_asRecords.clear();
+    m_nMemory = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                            ReadBytes()                               */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::ReadBytes(RunReader &oReader, void *pDest,
+                                        size_t nSize)
+{
+    GByte *pabyDest = static_cast<GByte *>(pDest);
+    while (nSize > 0)
+    {
+        if (oReader.nBufferPos == oReader.osBuffer.size())
+        {
+            const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                oReader.nEnd - oReader.nNextOffset, RUN_BUFFER_SIZE));
+            if (nToRead == 0)
+                return false;
+            oReader.osBuffer.resize(nToRead);
+            if (m_fpTmp->Seek(oReader.nNextOffset, SEEK_SET) != 0 ||
+                m_fpTmp->Read(&oReader.osBuffer[0], 1, nToRead) != nToRead)
+            {
+                return false;
+            }
+            oReader.nNextOffset += nToRead;
+            oReader.nBufferPos = 0;
+        }
+        const size_t nAvailable =
+            std::min(nSize, oReader.osBuffer.size() - oReader.nBufferPos);
+        memcpy(pabyDest, oReader.osBuffer.data() + oReader.nBufferPos,
+               nAvailable);
+        oReader.nBufferPos += nAvailable;
+        pabyDest += nAvailable;
+        nSize -= nAvailable;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            ReadRecord()                              */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::ReadRecord(RunReader &oReader, Record &oRecord,
+                                         bool &bEOF)
+{
+    bEOF = oReader.nBufferPos == oReader.osBuffer.size() &&
+           oReader.nNextOffset == oReader.nEnd;
+    if (bEOF)
+        return true;
+
+    auto &oFeature = oRecord.oFeature;
+    uint32_t nLayerSize = 0;
+    uint32_t nBlobSize = 0;
+    if (!ReadBytes(oReader, &oRecord.nTileKey, sizeof(oRecord.nTileKey)) ||
+        !ReadBytes(oReader, &oRecord.nZ, sizeof(oRecord.nZ)) ||
+        !ReadBytes(oReader, &oRecord.nX, sizeof(oRecord.nX)) ||
+        !ReadBytes(oReader, &oRecord.nY, sizeof(oRecord.nY)) ||
+        !ReadBytes(oReader, &oRecord.nSeq, sizeof(oRecord.nSeq)) ||
+        !ReadBytes(oReader, &oFeature.nSerial, sizeof(oFeature.nSerial)) ||
+        !ReadBytes(oReader, &oFeature.dfAreaOrLength,
+                   sizeof(oFeature.dfAreaOrLength)) ||
+        !ReadBytes(oReader, &nLayerSize, sizeof(nLayerSize)) ||
+        !ReadBytes(oReader, &nBlobSize, sizeof(nBlobSize)))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read from %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    try
+    {
+        oFeature.osLayer.resize(nLayerSize);
+        oFeature.osBlob.resize(nBlobSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in OGRMVTTempFeatureSorter::ReadRecord()");
+        return false;
+    }
+    if ((nLayerSize && !ReadBytes(oReader, &oFeature.osLayer[0], nLayerSize)) ||
+        (nBlobSize && !ReadBytes(oReader, &oFeature.osBlob[0], nBlobSize)))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read from %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           InitReaders()                              */
+/************************************************************************/
+
+// Prepare the merge of runs [iFirstRun, iFirstRun + nRuns[
+bool OGRMVTTempFeatureSorter::InitReaders(size_t iFirstRun, size_t nRuns)
+{
+    m_asReaders.clear();
+    m_asReaders.resize(nRuns);
+    m_anHeap.clear();
+    for (size_t i = 0; i < nRuns; ++i)
+    {
+        auto &oReader = m_asReaders[i];
+        oReader.nNextOffset = m_asRuns[iFirstRun + i].nStart;
+        oReader.nEnd = m_asRuns[iFirstRun + i].nEnd;
+        bool bEOF = false;
+        if (!ReadRecord(oReader, oReader.oRecord, bEOF))
+            return false;
+        if (!bEOF)
+            m_anHeap.push_back(i);
+    }
+    std::make_heap(m_anHeap.begin(), m_anHeap.end(),
+                   [this](size_t a, size_t b) { return ReaderGreater(a, b); });
+    return true;
+}
+
+/************************************************************************/
+/*                            NextMerged()                              */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::NextMerged(Record &oRecord, bool &bEOF)
+{
+    bEOF = m_anHeap.empty();
+    if (bEOF)
+        return true;
+
+    const auto Greater = [this](size_t a, size_t b)
+    { return ReaderGreater(a, b); };
+    std::pop_heap(m_anHeap.begin(), m_anHeap.end(), Greater);
+    auto &oReader = m_asReaders[m_anHeap.back()];
+    oRecord = std::move(oReader.oRecord);
+    bool bReaderEOF = false;
+    if (!ReadRecord(oReader, oReader.oRecord, bReaderEOF))
+        return false;
+    if (bReaderEOF)
+        m_anHeap.pop_back();
+    else
+        std::push_heap(m_anHeap.begin(), m_anHeap.end(), Greater);
+    return true;
+}
+
+/************************************************************************/
+/*                           StartReading()                             */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::StartReading()
+{
+    if (m_bError)
+        return false;
+
+    if (m_asRuns.empty())
+    {
+        // Everything fits in memory
+        std::sort(m_asRecords.begin(), m_asRecords.end());
+        m_nNextRecord = 0;
+        return true;
+    }
+
+    if (!FlushRun())
+        return false;
+
+    // Maximum number of runs merged at once, so that their read buffers
+    // fit in the memory budget
+    const size_t nMaxMergedRuns =
+        std::max<size_t>(2, m_nMaxMemory / RUN_BUFFER_SIZE);
+    size_t iFirstRun = 0;
+    while (m_asRuns.size() - iFirstRun > nMaxMergedRuns)
+    {
+        // Intermediate pass: merge the oldest runs into a new one, appended
+        // at the end of the temporary file.
+        if (!InitReaders(iFirstRun, nMaxMergedRuns))
+            return false;
+        Run sRun;
+        sRun.nStart = m_nTmpFileSize;
+        std::vector<Record> asRecords;
+        size_t nMemory = 0;
+        while (true)
+        {
+            Record oRecord;
+            bool bEOF = false;
+            if (!NextMerged(oRecord, bEOF))
+                return false;
+            if (bEOF)
+                break;
+            nMemory += GetMemoryUsage(oRecord);
+            asRecords.push_back(std::move(oRecord));
+            if (nMemory >= RUN_BUFFER_SIZE)
+            {
+                if (!WriteRecords(asRecords))
+                    return false;
+                asRecords.clear();
+                nMemory = 0;
+            }
+        }
+        if (!WriteRecords(asRecords))
+            return false;
+        sRun.nEnd = m_nTmpFileSize;
+        m_asRuns.push_back(sRun);
+        iFirstRun += nMaxMergedRuns;
+    }
+
+    CPLDebug("MVT", "Merging %d sorted runs of temporary features",
+             static_cast<int>(m_asRuns.size() - iFirstRun));
+    return InitReaders(iFirstRun, m_asRuns.size() - iFirstRun);
+}
+
+/************************************************************************/
+/*                            NextRecord()                              */
+/************************************************************************/
+
+bool OGRMVTTempFeatureSorter::NextRecord(Record &oRecord, bool &bEOF)
+{
+    if (!m_asRuns.empty())
+        return NextMerged(oRecord, bEOF);
+
+    bEOF = m_nNextRecord == m_asRecords.size();
+    if (!bEOF)
+        oRecord = std::move(m_asRecords[m_nNextRecord++]);
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNextTile()                              */
+/************************************************************************/
+
+// Return the features of the next tile, in layer name and serial number
+// order, or false at the end of the stream or in case of error.
+bool OGRMVTTempFeatureSorter::GetNextTile(
+    int &nZ, int &nX, int &nY, std::vector<OGRMVTTempFeature> &aoFeatures)
+{
+    aoFeatures.clear();
+    if (m_bError)
+        return false;
+
+    bool bEOF = false;
+    if (!m_bHasPending)
+    {
+        if (!NextRecord(m_oPending, bEOF))
+        {
+            m_bError = true;
+            return false;
+        }
+        if (bEOF)
+            return false;
+    }
+    m_bHasPending = false;
+
+    nZ = m_oPending.nZ;
+    nX = m_oPending.nX;
+    nY = m_oPending.nY;
+    const uint64_t nTileKey = m_oPending.nTileKey;
+    aoFeatures.push_back(std::move(m_oPending.oFeature));
+    while (true)
+    {
+        if (!NextRecord(m_oPending, bEOF))
+        {
+            m_bError = true;
+            return false;
+        }
+        if (bEOF)
+            break;
+        if (m_oPending.nTileKey != nTileKey)
+        {
+            m_bHasPending = true;
+            break;
+        }
+        aoFeatures.push_back(std::move(m_oPending.oFeature));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          OGRMVTEncodedTile                           */
+/************************************************************************/
+
+// Input and result of the encoding of a tile, which may run in a worker
+// thread.
+struct OGRMVTEncodedTile
+{
+    int nZ = 0;
+    int nX = 0;
+    int nY = 0;
+    // Features of the tile, sorted by layer name and serial number
+    std::vector<OGRMVTTempFeature> aoFeatures{};
+    size_t nFeaturesSize = 0;
+    // Tile at full resolution, before any size reduction. Layer statistics
+    // are computed from it.
+    MVTTile oFullTile{};
+    // Final tile data
+    std::string osData{};
+    bool bTooManyFeatures = false;
+    bool bTooBigTile = false;
+};
+
 class OGRMVTWriterDataset final : public GDALDataset
 {
     class MVTFieldProperties
@@ -3389,6 +3956,11 @@ class OGRMVTWriterDataset final : public GDALDataset
     int m_nTileMatrixHeight0 =
         1;  // Number of tiles along Y axis at zoom level 0
     bool m_bReuseTempFile = false;  // debug only
+    std::unique_ptr<OGRMVTWriterTileSink> m_poTileSink{};
+    std::unique_ptr<OGRMVTTempFeatureSorter> m_poTempFeatureSorter{};
+    // Approximate memory budget for temporary features being sorted, and
+    // for tiles being encoded
+    size_t m_nMaxMemory = 100 * 1024 * 1024;
 
     OGRErr PreGenerateForTile(
         int nZ, int nX, int nY, const CPLString &osTargetName,
@@ -3432,18 +4004,20 @@ class OGRMVTWriterDataset final : public GDALDataset
                        std::shared_ptr<MVTTileLayer> &poTargetLayer,
                        std::map<CPLString, GUInt32> &oMapKeyToIdx,
                        std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-                       MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-                       unsigned &nFeaturesInTile);
+                       GUInt32 nExtent, unsigned &nFeaturesInTile) const;
 
-    std::string
-    EncodeTile(int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer,
-               sqlite3_stmt *hStmtRows,
-               std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-               std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead);
+    void EncodeTile(OGRMVTEncodedTile &oTile) const;
 
-    std::string RecodeTileLowerResolution(int nZ, int nX, int nY, int nExtent,
-                                          sqlite3_stmt *hStmtLayer,
-                                          sqlite3_stmt *hStmtRows);
+    std::string RecodeTileLowerResolution(const OGRMVTEncodedTile &oTile,
+                                          GUInt32 nExtent) const;
+
+    static void
+    UpdateTileLayersProperties(const OGRMVTEncodedTile &oTile,
+                               std::map<CPLString, MVTLayerProperties> &oMap,
+                               std::set<CPLString> &oSetLayers);
+
+    bool WriteEncodedTile(OGRMVTEncodedTile &oTile, sqlite3_stmt *hInsertStmt,
+                          int &nLastZ, int &nLastX);
 
     bool CreateOutput();
 
@@ -3469,6 +4043,10 @@ class OGRMVTWriterDataset final : public GDALDataset
                                int nBandsIn, GDALDataType eDT,
                                char **papszOptions);
 
+    static GDALDataset *
+    Create(const char *pszFilename, CSLConstList papszOptions,
+           std::unique_ptr<OGRMVTWriterTileSink> poTileSink);
+
     OGRSpatialReference *GetSRS()
     {
         return m_poSRS;
@@ -3655,6 +4233,8 @@ CPLErr OGRMVTWriterDataset::Close()
         {
             sqlite3_close(m_hDBMBTILES);
         }
+        m_poTempFeatureSorter.reset();
+        m_poTileSink.reset();
         if (!m_osTempDB.empty() && !m_bReuseTempFile &&
             CPLTestBool(CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES")))
         {
@@ -4325,6 +4905,26 @@ OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
     oBuffer.assign(static_cast<char *>(pCompressed), nCompressedSize);
     CPLFree(pCompressed);
 
+    if (m_poTempFeatureSorter)
+    {
+        OGRMVTTempFeature oFeature;
+        oFeature.osLayer = osTargetName;
+        oFeature.nSerial = nSerial;
+        oFeature.dfAreaOrLength = dfAreaOrLength;
+        oFeature.osBlob = std::move(oBuffer);
+        const uint64_t nTileKey =
+            m_poTileSink->GetTileOrderKey(nZ, nTileX, nTileY);
+
+        std::unique_lock<std::mutex> oLock(m_oDBMutex, std::defer_lock);
+        if (m_bThreadPoolOK)
+            oLock.lock();
+        m_nTempTiles++;
+        return m_poTempFeatureSorter->Add(nTileKey, nZ, nTileX, nTileY,
+                                          std::move(oFeature))
+                   ? OGRERR_NONE
+                   : OGRERR_FAILURE;
+    }
+
     const auto InsertIntoDb = [&]()
     {
         m_nTempTiles++;
@@ -4824,9 +5424,8 @@ void OGRMVTWriterDataset::EncodeFeature(
     const void *pabyBlob, int nBlobSize,
     std::shared_ptr<MVTTileLayer> &poTargetLayer,
     std::map<CPLString, GUInt32> &oMapKeyToIdx,
-    std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-    MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-    unsigned &nFeaturesInTile)
+    std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx, GUInt32 nExtent,
+    unsigned &nFeaturesInTile) const
 {
     size_t nUncompressedSize = 0;
     void *pCompressed =
@@ -4848,10 +5447,6 @@ void OGRMVTWriterDataset::EncodeFeature(
             if (poSrcFeature->hasId())
                 poFeature->setId(poSrcFeature->getId());
             poFeature->setType(poSrcFeature->getType());
-            if (poLayerProperties)
-            {
-                poLayerProperties->m_oCountGeomType[poSrcFeature->getType()]++;
-            }
             bool bOK = true;
             if (nExtent < m_nExtent)
             {
@@ -4924,12 +5519,6 @@ void OGRMVTWriterDataset::EncodeFeature(
                         const auto &osKey = srcKeys[nSrcIdxKey];
                         const auto &oValue = srcValues[nSrcIdxValue];
 
-                        if (poLayerProperties)
-                        {
-                            UpdateLayerProperties(poLayerProperties, osKey,
-                                                  oValue);
-                        }
-
                         poFeature->addTag(oMapKeyToIdx[osKey]);
                         poFeature->addTag(oMapValueToIdx[oValue]);
                     }
@@ -4953,93 +5542,40 @@ void OGRMVTWriterDataset::EncodeFeature(
 /*                            EncodeTile()                              */
 /************************************************************************/
 
-std::string OGRMVTWriterDataset::EncodeTile(
-    int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer, sqlite3_stmt *hStmtRows,
-    std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-    std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead)
+// Encode the features of a tile. This is thread-safe, and may run in a
+// worker thread.
+void OGRMVTWriterDataset::EncodeTile(OGRMVTEncodedTile &oTile) const
 {
-    MVTTile oTargetTile;
-
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
+    const int nZ = oTile.nZ;
+    const int nX = oTile.nX;
+    const int nY = oTile.nY;
+    MVTTile &oTargetTile = oTile.oFullTile;
 
     unsigned nFeaturesInTile = 0;
-    const GIntBig nProgressStep =
-        std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
-
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    std::shared_ptr<MVTTileLayer> poTargetLayer;
+    std::map<CPLString, GUInt32> oMapKeyToIdx;
+    std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
+    for (const auto &oFeature : oTile.aoFeatures)
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
-
-        auto oIterMapLayerProps = oMapLayerProps.find(pszLayerName);
-        MVTLayerProperties *poLayerProperties = nullptr;
-        if (oIterMapLayerProps == oMapLayerProps.end())
+        if (nFeaturesInTile >= m_nMaxFeatures)
+            break;
+        if (!poTargetLayer || poTargetLayer->getName() != oFeature.osLayer)
         {
-            if (oSetLayers.size() < knMAX_COUNT_LAYERS)
-            {
-                oSetLayers.insert(pszLayerName);
-                if (oMapLayerProps.size() < knMAX_REPORT_LAYERS)
-                {
-                    MVTLayerProperties props;
-                    props.m_nMinZoom = nZ;
-                    props.m_nMaxZoom = nZ;
-                    oMapLayerProps[pszLayerName] = std::move(props);
-                    poLayerProperties = &(oMapLayerProps[pszLayerName]);
-                }
-            }
+            poTargetLayer = std::make_shared<MVTTileLayer>();
+            oTargetTile.addLayer(poTargetLayer);
+            poTargetLayer->setName(oFeature.osLayer);
+            poTargetLayer->setVersion(m_nMVTVersion);
+            poTargetLayer->setExtent(m_nExtent);
+            oMapKeyToIdx.clear();
+            oMapValueToIdx.clear();
         }
-        else
-        {
-            poLayerProperties = &(oIterMapLayerProps->second);
-        }
-        if (poLayerProperties)
-        {
-            poLayerProperties->m_nMinZoom =
-                std::min(nZ, poLayerProperties->m_nMinZoom);
-            poLayerProperties->m_nMaxZoom =
-                std::max(nZ, poLayerProperties->m_nMaxZoom);
-        }
-
-        std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
-        oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
-        poTargetLayer->setVersion(m_nMVTVersion);
-        poTargetLayer->setExtent(m_nExtent);
 
-        std::map<CPLString, GUInt32> oMapKeyToIdx;
-        std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
-
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
-        {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, poLayerProperties, m_nExtent,
-                          nFeaturesInTile);
-
-            nTempTilesRead++;
-            if (nTempTilesRead == m_nTempTiles ||
-                (nTempTilesRead % nProgressStep) == 0)
-            {
-                const int nPct =
-                    static_cast<int>((100 * nTempTilesRead) / m_nTempTiles);
-                CPLDebug("MVT", "%d%%...", nPct);
-            }
-        }
-        sqlite3_reset(hStmtRows);
+        EncodeFeature(oFeature.osBlob.data(),
+                      static_cast<int>(oFeature.osBlob.size()), poTargetLayer,
+                      oMapKeyToIdx, oMapValueToIdx, m_nExtent,
+                      nFeaturesInTile);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     size_t nSizeBefore = oTileBuffer.size();
     if (m_bGZip)
@@ -5049,35 +5585,20 @@ std::string OGRMVTWriterDataset::EncodeTile(
         static_cast<double>(nSizeAfter) / nSizeBefore;
 
     const bool bTooManyFeatures = nFeaturesInTile >= m_nMaxFeatures;
-    if (bTooManyFeatures && !m_bMaxFeaturesOptSpecified)
-    {
-        m_bMaxFeaturesOptSpecified = true;
-        CPLError(CE_Warning, CPLE_AppDefined,
-                 "At least one tile exceeded the default maximum number of "
-                 "features per tile (%u) and was truncated to satisfy it.",
-                 m_nMaxFeatures);
-    }
+    oTile.bTooManyFeatures = bTooManyFeatures;
 
     // If the tile size is above the allowed values or there are too many
     // features, then sort by descending area / length until we get to the
     // limit.
     bool bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
-    if (bTooBigTile && !m_bMaxTileSizeOptSpecified)
-    {
-        m_bMaxTileSizeOptSpecified = true;
-        CPLError(CE_Warning, CPLE_AppDefined,
-                 "At least one tile exceeded the default maximum tile size of "
-                 "%u bytes and was encoded at lower resolution",
-                 m_nMaxTileSize);
-    }
+    oTile.bTooBigTile = bTooBigTile;
 
     GUInt32 nExtent = m_nExtent;
     while (bTooBigTile && !bTooManyFeatures && nExtent >= 256)
     {
         nExtent /= 2;
         nSizeBefore = oTileBuffer.size();
-        oTileBuffer = RecodeTileLowerResolution(nZ, nX, nY, nExtent, hStmtLayer,
-                                                hStmtRows);
+        oTileBuffer = RecodeTileLowerResolution(oTile, nExtent);
         bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
         CPLDebug("MVT",
                  "Recoding tile %d/%d/%d with extent = %u. "
@@ -5101,21 +5622,19 @@ std::string OGRMVTWriterDataset::EncodeTile(
                      nZ, nX, nY, m_nMaxFeatures);
         }
 
-        oTargetTile.clear();
-
         const unsigned nTotalFeaturesInTile =
             std::min(m_nMaxFeatures, nFeaturesInTile);
-        char *pszSQL =
-            sqlite3_mprintf("SELECT layer, feature FROM temp "
-                            "WHERE z = %d AND x = %d AND y = %d ORDER BY "
-                            "area_or_length DESC LIMIT %d",
-                            nZ, nX, nY, nTotalFeaturesInTile);
-        sqlite3_stmt *hTmpStmt = nullptr;
-        CPL_IGNORE_RET_VAL(
-            sqlite3_prepare_v2(m_hDB, pszSQL, -1, &hTmpStmt, nullptr));
-        sqlite3_free(pszSQL);
-        if (!hTmpStmt)
-            return std::string();
+
+        std::vector<const OGRMVTTempFeature *> apoFeatures;
+        apoFeatures.reserve(oTile.aoFeatures.size());
+        for (const auto &oFeature : oTile.aoFeatures)
+            apoFeatures.push_back(&oFeature);
+        std::stable_sort(apoFeatures.begin(), apoFeatures.end(),
+                         [](const OGRMVTTempFeature *a,
+                            const OGRMVTTempFeature *b)
+                         { return a->dfAreaOrLength > b->dfAreaOrLength; });
+        if (apoFeatures.size() > nTotalFeaturesInTile)
+            apoFeatures.resize(nTotalFeaturesInTile);
 
         class TargetTileLayerProps
         {
@@ -5127,56 +5646,45 @@ std::string OGRMVTWriterDataset::EncodeTile(
 
         std::map<std::string, TargetTileLayerProps> oMapLayerNameToTargetLayer;
 
+        MVTTile oReducedTile;
         nFeaturesInTile = 0;
         const unsigned nCheckStep = std::max(1U, nTotalFeaturesInTile / 100);
-        while (sqlite3_step(hTmpStmt) == SQLITE_ROW)
+        for (const auto *poFeature : apoFeatures)
         {
-            const char *pszLayerName = reinterpret_cast<const char *>(
-                sqlite3_column_text(hTmpStmt, 0));
-            int nBlobSize = sqlite3_column_bytes(hTmpStmt, 1);
-            const void *pabyBlob = sqlite3_column_blob(hTmpStmt, 1);
+            const std::string &osLayerName = poFeature->osLayer;
 
-            std::shared_ptr<MVTTileLayer> poTargetLayer;
-            std::map<CPLString, GUInt32> *poMapKeyToIdx;
-            std::map<MVTTileLayerValue, GUInt32> *poMapValueToIdx;
-            auto oIter = oMapLayerNameToTargetLayer.find(pszLayerName);
+            auto oIter = oMapLayerNameToTargetLayer.find(osLayerName);
             if (oIter == oMapLayerNameToTargetLayer.end())
             {
-                poTargetLayer =
-                    std::shared_ptr<MVTTileLayer>(new MVTTileLayer());
                 TargetTileLayerProps props;
-                props.m_poLayer = poTargetLayer;
-                oTargetTile.addLayer(poTargetLayer);
-                poTargetLayer->setName(pszLayerName);
-                poTargetLayer->setVersion(m_nMVTVersion);
-                poTargetLayer->setExtent(nExtent);
-                oMapLayerNameToTargetLayer[pszLayerName] = std::move(props);
-                poMapKeyToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapKeyToIdx;
-                poMapValueToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapValueToIdx;
-            }
-            else
-            {
-                poTargetLayer = oIter->second.m_poLayer;
-                poMapKeyToIdx = &oIter->second.m_oMapKeyToIdx;
-                poMapValueToIdx = &oIter->second.m_oMapValueToIdx;
+                props.m_poLayer = std::make_shared<MVTTileLayer>();
+                oReducedTile.addLayer(props.m_poLayer);
+                props.m_poLayer->setName(osLayerName);
+                props.m_poLayer->setVersion(m_nMVTVersion);
+                props.m_poLayer->setExtent(nExtent);
+                oIter = oMapLayerNameToTargetLayer
+                            .insert({osLayerName, std::move(props)})
+                            .first;
             }
 
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, *poMapKeyToIdx,
-                          *poMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+            EncodeFeature(poFeature->osBlob.data(),
+                          static_cast<int>(poFeature->osBlob.size()),
+                          oIter->second.m_poLayer, oIter->second.m_oMapKeyToIdx,
+                          oIter->second.m_oMapValueToIdx, nExtent,
+                          nFeaturesInTile);
 
             if (nFeaturesInTile == nTotalFeaturesInTile ||
                 (bTooBigTile && (nFeaturesInTile % nCheckStep == 0)))
             {
-                if (oTargetTile.getSize() * dfCompressionRatio > m_nMaxTileSize)
+                if (oReducedTile.getSize() * dfCompressionRatio >
+                    m_nMaxTileSize)
                 {
                     break;
                 }
             }
         }
 
-        oTileBuffer = oTargetTile.write();
+        oTileBuffer = oReducedTile.write();
         if (m_bGZip)
             GZIPCompress(oTileBuffer);
 
@@ -5185,66 +5693,205 @@ std::string OGRMVTWriterDataset::EncodeTile(
             CPLDebug("MVT", "For tile %d/%d/%d, final tile size is %u", nZ, nX,
                      nY, static_cast<unsigned>(oTileBuffer.size()));
         }
-
-        sqlite3_finalize(hTmpStmt);
     }
 
-    return oTileBuffer;
+    oTile.osData = std::move(oTileBuffer);
 }
 
 /************************************************************************/
 /*                    RecodeTileLowerResolution()                       */
 /************************************************************************/
 
-std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
-    int nZ, int nX, int nY, int nExtent, sqlite3_stmt *hStmtLayer,
-    sqlite3_stmt *hStmtRows)
+std::string
+OGRMVTWriterDataset::RecodeTileLowerResolution(const OGRMVTEncodedTile &oTile,
+                                               GUInt32 nExtent) const
 {
     MVTTile oTargetTile;
 
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
     unsigned nFeaturesInTile = 0;
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    std::shared_ptr<MVTTileLayer> poTargetLayer;
+    std::map<CPLString, GUInt32> oMapKeyToIdx;
+    std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
+    for (const auto &oFeature : oTile.aoFeatures)
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
+        if (nFeaturesInTile >= m_nMaxFeatures)
+            break;
+        if (!poTargetLayer || poTargetLayer->getName() != oFeature.osLayer)
+        {
+            poTargetLayer = std::make_shared<MVTTileLayer>();
+            oTargetTile.addLayer(poTargetLayer);
+            poTargetLayer->setName(oFeature.osLayer);
+            poTargetLayer->setVersion(m_nMVTVersion);
+            poTargetLayer->setExtent(nExtent);
+            oMapKeyToIdx.clear();
+            oMapValueToIdx.clear();
+        }
+
+        EncodeFeature(oFeature.osBlob.data(),
+                      static_cast<int>(oFeature.osBlob.size()), poTargetLayer,
+                      oMapKeyToIdx, oMapValueToIdx, nExtent, nFeaturesInTile);
+    }
+
+    std::string oTileBuffer(oTargetTile.write());
+    if (m_bGZip)
+        GZIPCompress(oTileBuffer);
 
-        std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
-        oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
-        poTargetLayer->setVersion(m_nMVTVersion);
-        poTargetLayer->setExtent(nExtent);
+    return oTileBuffer;
+}
 
-        std::map<CPLString, GUInt32> oMapKeyToIdx;
-        std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
+/************************************************************************/
+/*                     UpdateTileLayersProperties()                     */
+/************************************************************************/
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+// Update the layer statistics from the full resolution content of a tile.
+// Tiles must be processed in output order, for the result not to depend on
+// the number of threads used for encoding.
+void OGRMVTWriterDataset::UpdateTileLayersProperties(
+    const OGRMVTEncodedTile &oTile,
+    std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
+    std::set<CPLString> &oSetLayers)
+{
+    const int nZ = oTile.nZ;
+    for (const auto &poLayer : oTile.oFullTile.getLayers())
+    {
+        const CPLString osLayerName(poLayer->getName());
+        auto oIterMapLayerProps = oMapLayerProps.find(osLayerName);
+        MVTLayerProperties *poLayerProperties = nullptr;
+        if (oIterMapLayerProps == oMapLayerProps.end())
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
+            if (oSetLayers.size() < knMAX_COUNT_LAYERS)
+            {
+                oSetLayers.insert(osLayerName);
+                if (oMapLayerProps.size() < knMAX_REPORT_LAYERS)
+                {
+                    MVTLayerProperties props;
+                    props.m_nMinZoom = nZ;
+                    props.m_nMaxZoom = nZ;
+                    oMapLayerProps[osLayerName] = std::move(props);
+                    poLayerProperties = &(oMapLayerProps[osLayerName]);
+                }
+            }
+        }
+        else
+        {
+            poLayerProperties = &(oIterMapLayerProps->second);
+        }
+        if (!poLayerProperties)
+            continue;
+
+        poLayerProperties->m_nMinZoom =
+            std::min(nZ, poLayerProperties->m_nMinZoom);
+        poLayerProperties->m_nMaxZoom =
+            std::max(nZ, poLayerProperties->m_nMaxZoom);
 
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+        const auto &keys = poLayer->getKeys();
+        const auto &values = poLayer->getValues();
+        for (const auto &poFeature : poLayer->getFeatures())
+        {
+            poLayerProperties->m_oCountGeomType[poFeature->getType()]++;
+            const auto &anTags = poFeature->getTags();
+            for (size_t i = 0; i + 1 < anTags.size(); i += 2)
+            {
+                if (anTags[i] < keys.size() && anTags[i + 1] < values.size())
+                {
+                    UpdateLayerProperties(poLayerProperties, keys[anTags[i]],
+                                          values[anTags[i + 1]]);
+                }
+            }
         }
-        sqlite3_reset(hStmtRows);
     }
+}
 
-    sqlite3_reset(hStmtLayer);
+/************************************************************************/
+/*                          WriteEncodedTile()                          */
+/************************************************************************/
 
-    std::string oTileBuffer(oTargetTile.write());
-    if (m_bGZip)
-        GZIPCompress(oTileBuffer);
+bool OGRMVTWriterDataset::WriteEncodedTile(OGRMVTEncodedTile &oTile,
+                                           sqlite3_stmt *hInsertStmt,
+                                           int &nLastZ, int &nLastX)
+{
+    const int nZ = oTile.nZ;
+    const int nX = oTile.nX;
+    const int nY = oTile.nY;
+    const std::string &oTileBuffer = oTile.osData;
 
-    return oTileBuffer;
+    if (oTile.bTooManyFeatures && !m_bMaxFeaturesOptSpecified)
+    {
+        m_bMaxFeaturesOptSpecified = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "At least one tile exceeded the default maximum number of "
+                 "features per tile (%u) and was truncated to satisfy it.",
+                 m_nMaxFeatures);
+    }
+    if (oTile.bTooBigTile && !m_bMaxTileSizeOptSpecified)
+    {
+        m_bMaxTileSizeOptSpecified = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "At least one tile exceeded the default maximum tile size of "
+                 "%u bytes and was encoded at lower resolution",
+                 m_nMaxTileSize);
+    }
+
+    bool bRet = true;
+    if (oTileBuffer.empty())
+    {
+        bRet = false;
+    }
+    else if (m_poTileSink)
+    {
+        bRet = m_poTileSink->WriteTile(nZ, nX, nY, oTileBuffer);
+    }
+    else if (hInsertStmt)
+    {
+        sqlite3_bind_int(hInsertStmt, 1, nZ);
+        sqlite3_bind_int(hInsertStmt, 2, nX);
+        sqlite3_bind_int(hInsertStmt, 3, (1 << nZ) - 1 - nY);
+        sqlite3_bind_blob(hInsertStmt, 4, oTileBuffer.data(),
+                          static_cast<int>(oTileBuffer.size()), SQLITE_STATIC);
+        const int rc = sqlite3_step(hInsertStmt);
+        bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
+        sqlite3_reset(hInsertStmt);
+    }
+    else
+    {
+        const std::string osZDirname(CPLFormFilenameSafe(
+            GetDescription(), CPLSPrintf("%d", nZ), nullptr));
+        const std::string osXDirname(CPLFormFilenameSafe(
+            osZDirname.c_str(), CPLSPrintf("%d", nX), nullptr));
+        if (nZ != nLastZ)
+        {
+            VSIMkdir(osZDirname.c_str(), 0755);
+            nLastZ = nZ;
+            nLastX = -1;
+        }
+        if (nX != nLastX)
+        {
+            VSIMkdir(osXDirname.c_str(), 0755);
+            nLastX = nX;
+        }
+        const std::string osTileFilename(
+            CPLFormFilenameSafe(osXDirname.c_str(), CPLSPrintf("%d", nY),
+                                m_osExtension.c_str()));
+        VSILFILE *fpOut = VSIFOpenL(osTileFilename.c_str(), "wb");
+        if (fpOut)
+        {
+            const size_t nRet =
+                VSIFWriteL(oTileBuffer.data(), 1, oTileBuffer.size(), fpOut);
+            bRet = (nRet == oTileBuffer.size());
+            VSIFCloseL(fpOut);
+        }
+        else
+        {
+            bRet = false;
+        }
+    }
+
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Error while writing tile %d/%d/%d", nZ, nX, nY);
+    }
+    return bRet;
 }
 
 /************************************************************************/
@@ -5264,139 +5911,203 @@ bool OGRMVTWriterDataset::CreateOutput()
         return GenerateMetadata(0, oMapLayerProps);
     }
 
-    CPLDebug("MVT", "Building output file from temporary database...");
-
+    // Tiles are read from the sorted temporary features when writing to a
+    // tile sink, or from the temporary database otherwise.
     sqlite3_stmt *hStmtZXY = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB, "SELECT DISTINCT z, x, y FROM temp ORDER BY z, x, y", -1,
-        &hStmtZXY, nullptr));
-    if (hStmtZXY == nullptr)
+    sqlite3_stmt *hStmtTile = nullptr;
+    sqlite3_stmt *hInsertStmt = nullptr;
+    const auto FinalizeStatements = [&hStmtZXY, &hStmtTile, &hInsertStmt]()
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        return false;
-    }
+        if (hStmtZXY)
+            sqlite3_finalize(hStmtZXY);
+        if (hStmtTile)
+            sqlite3_finalize(hStmtTile);
+        if (hInsertStmt)
+            sqlite3_finalize(hInsertStmt);
+    };
 
-    sqlite3_stmt *hStmtLayer = nullptr;
-    CPL_IGNORE_RET_VAL(
-        sqlite3_prepare_v2(m_hDB,
-                           "SELECT DISTINCT layer FROM temp "
-                           "WHERE z = ? AND x = ? AND y = ? ORDER BY layer",
-                           -1, &hStmtLayer, nullptr));
-    if (hStmtLayer == nullptr)
+    if (m_poTempFeatureSorter)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        return false;
-    }
-    sqlite3_stmt *hStmtRows = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB,
-        "SELECT feature FROM temp "
-        "WHERE z = ? AND x = ? AND y = ? AND layer = ? ORDER BY idx",
-        -1, &hStmtRows, nullptr));
-    if (hStmtRows == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        sqlite3_finalize(hStmtLayer);
-        return false;
+        CPLDebug("MVT", "Building output file from sorted temporary features");
+        if (!m_poTempFeatureSorter->StartReading())
+            return false;
     }
-
-    sqlite3_stmt *hInsertStmt = nullptr;
-    if (m_hDBMBTILES)
+    else
     {
+        CPLDebug("MVT", "Building output file from temporary database...");
+
         CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-            m_hDBMBTILES,
-            "INSERT INTO tiles(zoom_level, tile_column, tile_row, "
-            "tile_data) VALUES (?,?,?,?)",
-            -1, &hInsertStmt, nullptr));
-        if (hInsertStmt == nullptr)
+            m_hDB, "SELECT DISTINCT z, x, y FROM temp ORDER BY z, x, y", -1,
+            &hStmtZXY, nullptr));
+        CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
+            m_hDB,
+            "SELECT layer, idx, feature, area_or_length FROM temp "
+            "WHERE z = ? AND x = ? AND y = ? ORDER BY layer, idx",
+            -1, &hStmtTile, nullptr));
+        if (hStmtZXY == nullptr || hStmtTile == nullptr)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-            sqlite3_finalize(hStmtZXY);
-            sqlite3_finalize(hStmtLayer);
-            sqlite3_finalize(hStmtRows);
+            FinalizeStatements();
             return false;
         }
+
+        if (m_hDBMBTILES)
+        {
+            CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
+                m_hDBMBTILES,
+                "INSERT INTO tiles(zoom_level, tile_column, tile_row, "
+                "tile_data) VALUES (?,?,?,?)",
+                -1, &hInsertStmt, nullptr));
+            if (hInsertStmt == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Prepared statement failed");
+                FinalizeStatements();
+                return false;
+            }
+        }
     }
 
+    const auto ReadNextTile = [this, hStmtZXY,
+                               hStmtTile](OGRMVTEncodedTile &oTile)
+    {
+        if (m_poTempFeatureSorter)
+        {
+            return m_poTempFeatureSorter->GetNextTile(
+                oTile.nZ, oTile.nX, oTile.nY, oTile.aoFeatures);
+        }
+
+        if (sqlite3_step(hStmtZXY) != SQLITE_ROW)
+            return false;
+        oTile.nZ = sqlite3_column_int(hStmtZXY, 0);
+        oTile.nX = sqlite3_column_int(hStmtZXY, 1);
+        oTile.nY = sqlite3_column_int(hStmtZXY, 2);
+        sqlite3_bind_int(hStmtTile, 1, oTile.nZ);
+        sqlite3_bind_int(hStmtTile, 2, oTile.nX);
+        sqlite3_bind_int(hStmtTile, 3, oTile.nY);
+        while (sqlite3_step(hStmtTile) == SQLITE_ROW)
+        {
+            OGRMVTTempFeature oFeature;
+            oFeature.osLayer = reinterpret_cast<const char *>(
+                sqlite3_column_text(hStmtTile, 0));
+            oFeature.nSerial = sqlite3_column_int64(hStmtTile, 1);
+            const int nBlobSize = sqlite3_column_bytes(hStmtTile, 2);
+            const void *pabyBlob = sqlite3_column_blob(hStmtTile, 2);
+            if (pabyBlob)
+            {
+                oFeature.osBlob.assign(static_cast<const char *>(pabyBlob),
+                                       nBlobSize);
+            }
+            oFeature.dfAreaOrLength = sqlite3_column_double(hStmtTile, 3);
+            oTile.aoFeatures.push_back(std::move(oFeature));
+        }
+        sqlite3_reset(hStmtTile);
+        return true;
+    };
+
+    // Tiles are encoded in worker threads, and written in order, keeping a
+    // bounded number of them in flight.
+    auto poJobQueue =
+        m_bThreadPoolOK ? m_oThreadPool.CreateJobQueue() : nullptr;
+    const size_t nMaxPendingTiles =
+        poJobQueue ? 4 * static_cast<size_t>(m_oThreadPool.GetThreadCount())
+                   : 1;
+    std::deque<std::pair<std::unique_ptr<OGRMVTEncodedTile>, std::future<void>>>
+        aoPendingTiles;
+    size_t nPendingSize = 0;
+
     int nLastZ = -1;
     int nLastX = -1;
-    bool bRet = true;
     GIntBig nTempTilesRead = 0;
+    const GIntBig nProgressStep =
+        std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    const auto WriteTile = [&](OGRMVTEncodedTile &oTile)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
+        UpdateTileLayersProperties(oTile, oMapLayerProps, oSetLayers);
 
-        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
-                                           oMapLayerProps, oSetLayers,
-                                           nTempTilesRead));
+        const GIntBig nTempTilesReadBefore = nTempTilesRead;
+        nTempTilesRead += static_cast<GIntBig>(oTile.aoFeatures.size());
+        if (nTempTilesRead / nProgressStep !=
+                nTempTilesReadBefore / nProgressStep ||
+            nTempTilesRead == m_nTempTiles)
+        {
+            const int nPct =
+                static_cast<int>((100 * nTempTilesRead) / m_nTempTiles);
+            CPLDebug("MVT", "%d%%...", nPct);
+        }
+
+        return WriteEncodedTile(oTile, hInsertStmt, nLastZ, nLastX);
+    };
 
-        if (oTileBuffer.empty())
+    const auto WriteOldestPendingTile = [&]()
+    {
+        auto oPending = std::move(aoPendingTiles.front());
+        aoPendingTiles.pop_front();
+        OGRMVTEncodedTile &oTile = *(oPending.first);
+        nPendingSize -= oTile.nFeaturesSize;
+        try
         {
-            bRet = false;
+            oPending.second.get();
         }
-        else if (hInsertStmt)
+        catch (const std::exception &e)
         {
-            sqlite3_bind_int(hInsertStmt, 1, nZ);
-            sqlite3_bind_int(hInsertStmt, 2, nX);
-            sqlite3_bind_int(hInsertStmt, 3, (1 << nZ) - 1 - nY);
-            sqlite3_bind_blob(hInsertStmt, 4, oTileBuffer.data(),
-                              static_cast<int>(oTileBuffer.size()),
-                              SQLITE_STATIC);
-            const int rc = sqlite3_step(hInsertStmt);
-            bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
-            sqlite3_reset(hInsertStmt);
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot encode tile %d/%d/%d: %s", oTile.nZ, oTile.nX,
+                     oTile.nY, e.what());
+            return false;
         }
-        else
+        return WriteTile(oTile);
+    };
+
+    bool bRet = true;
+    while (bRet)
+    {
+        auto poTile = std::make_unique<OGRMVTEncodedTile>();
+        if (!ReadNextTile(*poTile))
+            break;
+
+        if (!poJobQueue)
         {
-            const std::string osZDirname(CPLFormFilenameSafe(
-                GetDescription(), CPLSPrintf("%d", nZ), nullptr));
-            const std::string osXDirname(CPLFormFilenameSafe(
-                osZDirname.c_str(), CPLSPrintf("%d", nX), nullptr));
-            if (nZ != nLastZ)
-            {
-                VSIMkdir(osZDirname.c_str(), 0755);
-                nLastZ = nZ;
-                nLastX = -1;
-            }
-            if (nX != nLastX)
-            {
-                VSIMkdir(osXDirname.c_str(), 0755);
-                nLastX = nX;
-            }
-            const std::string osTileFilename(
-                CPLFormFilenameSafe(osXDirname.c_str(), CPLSPrintf("%d", nY),
-                                    m_osExtension.c_str()));
-            VSILFILE *fpOut = VSIFOpenL(osTileFilename.c_str(), "wb");
-            if (fpOut)
-            {
-                const size_t nRet = VSIFWriteL(oTileBuffer.data(), 1,
-                                               oTileBuffer.size(), fpOut);
-                bRet = (nRet == oTileBuffer.size());
-                VSIFCloseL(fpOut);
-            }
-            else
-            {
-                bRet = false;
-            }
+            EncodeTile(*poTile);
+            bRet = WriteTile(*poTile);
+            continue;
         }
 
-        if (!bRet)
+        for (const auto &oFeature : poTile->aoFeatures)
+            poTile->nFeaturesSize += oFeature.osBlob.size();
+        nPendingSize += poTile->nFeaturesSize;
+        OGRMVTEncodedTile *poTileRaw = poTile.get();
+        auto oFuture = poJobQueue->SubmitJobWithFuture(
+            [this, poTileRaw]() { EncodeTile(*poTileRaw); });
+        aoPendingTiles.emplace_back(std::move(poTile), std::move(oFuture));
+
+        while (bRet && !aoPendingTiles.empty() &&
+               (aoPendingTiles.size() >= nMaxPendingTiles ||
+                nPendingSize > m_nMaxMemory))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Error while writing tile %d/%d/%d", nZ, nX, nY);
-            break;
+            bRet = WriteOldestPendingTile();
+        }
+    }
+    if (!bRet && poJobQueue)
+        poJobQueue->CancelPendingJobs();
+    while (!aoPendingTiles.empty())
+    {
+        if (bRet)
+        {
+            bRet = WriteOldestPendingTile();
+        }
+        else
+        {
+            aoPendingTiles.front().second.wait();
+            aoPendingTiles.pop_front();
         }
     }
-    sqlite3_finalize(hStmtZXY);
-    sqlite3_finalize(hStmtLayer);
-    sqlite3_finalize(hStmtRows);
-    if (hInsertStmt)
-        sqlite3_finalize(hInsertStmt);
+
+    if (m_poTempFeatureSorter && m_poTempFeatureSorter->HasError())
+        bRet = false;
+
+    FinalizeStatements();
 
     bRet &= GenerateMetadata(oSetLayers.size(), oMapLayerProps);
 
@@ -5766,6 +6477,23 @@ bool OGRMVTWriterDataset::GenerateMetadata(
         return true;
     }
 
+    if (m_poTileSink)
+    {
+        std::vector<std::pair<std::string, std::string>> aoMetadata;
+        for (const auto &oChild : oRoot.GetChildren())
+        {
+            std::string osValue;
+            if (oChild.GetType() == CPLJSONObject::Type::Integer)
+                osValue = CPLSPrintf("%d", oChild.ToInteger());
+            else if (oChild.GetType() == CPLJSONObject::Type::Double)
+                osValue = CPLSPrintf("%.17g", oChild.ToDouble());
+            else
+                osValue = oChild.ToString();
+            aoMetadata.emplace_back(oChild.GetName(), std::move(osValue));
+        }
+        return m_poTileSink->Finalize(aoMetadata);
+    }
+
     return oDoc.Save(
         CPLFormFilenameSafe(GetDescription(), "metadata.json", nullptr));
 }
@@ -6040,6 +6768,21 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
         return nullptr;
     }
 
+    return Create(pszFilename, papszOptions, nullptr);
+}
+
+/************************************************************************/
+/*                                Create()                              */
+/************************************************************************/
+
+// When poTileSink is set, tiles are handed over to it in the order of its
+// tile keys, and neither a temporary SQLite database nor a directory or
+// MBTiles output is created: the temporary features are stored in a
+// bounded memory buffer, spilled to sorted runs in a temporary file.
+GDALDataset *
+OGRMVTWriterDataset::Create(const char *pszFilename, CSLConstList papszOptions,
+                            std::unique_ptr<OGRMVTWriterTileSink> poTileSink)
+{
     const char *pszFormat = CSLFetchNameValue(papszOptions, "FORMAT");
     const bool bMBTILESExt =
         EQUAL(CPLGetExtensionSafe(pszFilename).c_str(), "mbtiles");
@@ -6047,10 +6790,12 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     {
         pszFormat = "MBTILES";
     }
-    const bool bMBTILES = pszFormat != nullptr && EQUAL(pszFormat, "MBTILES");
+    const bool bMBTILES = !poTileSink && pszFormat != nullptr &&
+                          EQUAL(pszFormat, "MBTILES");
 
     // For debug only
     bool bReuseTempFile =
+        !poTileSink &&
         CPLTestBool(CPLGetConfigOption("OGR_MVT_REUSE_TEMP_FILE", "NO"));
 
     if (bMBTILES)
@@ -6064,7 +6809,7 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
 
         VSIUnlink(pszFilename);
     }
-    else
+    else if (!poTileSink)
     {
         VSIStatBufL sStat;
         if (VSIStatL(pszFilename, &sStat) == 0)
@@ -6082,75 +6827,121 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     }
 
     OGRMVTWriterDataset *poDS = new OGRMVTWriterDataset();
-    poDS->m_pMyVFS = OGRSQLiteCreateVFS(nullptr, poDS);
-    sqlite3_vfs_register(poDS->m_pMyVFS, 0);
 
-    CPLString osTempDBDefault = CPLString(pszFilename) + ".temp.db";
-    if (STARTS_WITH(osTempDBDefault, "/vsizip/"))
+    if (poTileSink)
     {
-        osTempDBDefault =
-            CPLString(pszFilename + strlen("/vsizip/")) + ".temp.db";
-    }
-    CPLString osTempDB = CSLFetchNameValueDef(papszOptions, "TEMPORARY_DB",
-                                              osTempDBDefault.c_str());
-    if (!bReuseTempFile)
-        VSIUnlink(osTempDB);
-
-    sqlite3 *hDB = nullptr;
-    if (sqlite3_open_v2(osTempDB, &hDB,
-                        SQLITE_OPEN_READWRITE |
-                            (bReuseTempFile ? 0 : SQLITE_OPEN_CREATE) |
-                            SQLITE_OPEN_NOMUTEX,
-                        poDS->m_pMyVFS->zName) != SQLITE_OK ||
-        hDB == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s", osTempDB.c_str());
-        delete poDS;
-        sqlite3_close(hDB);
-        return nullptr;
-    }
-    poDS->m_osTempDB = osTempDB;
-    poDS->m_hDB = hDB;
-    poDS->m_bReuseTempFile = bReuseTempFile;
+        size_t nMaxMemory = 0;
+        {
+            const char *pszSortBufferSize = CSLFetchNameValueDef(
+                papszOptions, "SORT_BUFFER_SIZE", "100MB");
+            GIntBig nValue = 0;
+            bool bUnitSpecified = false;
+            if (CPLParseMemorySize(pszSortBufferSize, &nValue,
+                                   &bUnitSpecified) != CE_None ||
+                nValue <= 0 ||
+                static_cast<uint64_t>(nValue) >
+                    std::numeric_limits<size_t>::max())
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "Invalid value for SORT_BUFFER_SIZE");
+                delete poDS;
+                return nullptr;
+            }
+            nMaxMemory = static_cast<size_t>(nValue);
+        }
 
-    // For Unix
-    if (!poDS->m_bReuseTempFile &&
-        CPLTestBool(CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES")))
-    {
-        VSIUnlink(osTempDB);
-    }
+        std::string osSortTmpFilename;
+        if (VSIIsLocal(pszFilename))
+        {
+            osSortTmpFilename = std::string(pszFilename).append(".tmp.sort");
+        }
+        else
+        {
+            osSortTmpFilename =
+                CPLGenerateTempFilenameSafe(CPLGetFilename(pszFilename)) +
+                ".tmp.sort";
+        }
 
-    if (poDS->m_bReuseTempFile)
-    {
-        poDS->m_nTempTiles =
-            SQLGetInteger64(hDB, "SELECT COUNT(*) FROM temp", nullptr);
+        poDS->m_nMaxMemory = nMaxMemory;
+        poDS->m_poTempFeatureSorter = std::make_unique<OGRMVTTempFeatureSorter>(
+            osSortTmpFilename, nMaxMemory);
+        poDS->m_poTileSink = std::move(poTileSink);
     }
     else
     {
-        CPL_IGNORE_RET_VAL(SQLCommand(
-            hDB,
-            "PRAGMA page_size = 4096;"  // 4096: default since sqlite 3.12
-            "PRAGMA synchronous = OFF;"
-            "PRAGMA journal_mode = OFF;"
-            "PRAGMA temp_store = MEMORY;"
-            "CREATE TABLE temp(z INTEGER, x INTEGER, y INTEGER, layer TEXT, "
-            "idx INTEGER, feature BLOB, geomtype INTEGER, area_or_length "
-            "DOUBLE);"
-            "CREATE INDEX temp_index ON temp (z, x, y, layer, idx);"));
-    }
+        poDS->m_pMyVFS = OGRSQLiteCreateVFS(nullptr, poDS);
+        sqlite3_vfs_register(poDS->m_pMyVFS, 0);
 
-    sqlite3_stmt *hInsertStmt = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        hDB,
-        "INSERT INTO temp (z,x,y,layer,idx,feature,geomtype,area_or_length) "
-        "VALUES (?,?,?,?,?,?,?,?)",
-        -1, &hInsertStmt, nullptr));
-    if (hInsertStmt == nullptr)
-    {
-        delete poDS;
-        return nullptr;
+        CPLString osTempDBDefault = CPLString(pszFilename) + ".temp.db";
+        if (STARTS_WITH(osTempDBDefault, "/vsizip/"))
+        {
+            osTempDBDefault =
+                CPLString(pszFilename + strlen("/vsizip/")) + ".temp.db";
+        }
+        CPLString osTempDB = CSLFetchNameValueDef(papszOptions, "TEMPORARY_DB",
+                                                  osTempDBDefault.c_str());
+        if (!bReuseTempFile)
+            VSIUnlink(osTempDB);
+
+        sqlite3 *hDB = nullptr;
+        if (sqlite3_open_v2(osTempDB, &hDB,
+                            SQLITE_OPEN_READWRITE |
+                                (bReuseTempFile ? 0 : SQLITE_OPEN_CREATE) |
+                                SQLITE_OPEN_NOMUTEX,
+                            poDS->m_pMyVFS->zName) != SQLITE_OK ||
+            hDB == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     osTempDB.c_str());
+            delete poDS;
+            sqlite3_close(hDB);
+            return nullptr;
+        }
+        poDS->m_osTempDB = osTempDB;
+        poDS->m_hDB = hDB;
+        poDS->m_bReuseTempFile = bReuseTempFile;
+
+        // For Unix
+        if (!poDS->m_bReuseTempFile &&
+            CPLTestBool(
+                CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES")))
+        {
+            VSIUnlink(osTempDB);
+        }
+
+        if (poDS->m_bReuseTempFile)
+        {
+            poDS->m_nTempTiles =
+                SQLGetInteger64(hDB, "SELECT COUNT(*) FROM temp", nullptr);
+        }
+        else
+        {
+            CPL_IGNORE_RET_VAL(SQLCommand(
+                hDB,
+                "PRAGMA page_size = 4096;"  // 4096: default since sqlite 3.12
+                "PRAGMA synchronous = OFF;"
+                "PRAGMA journal_mode = OFF;"
+                "PRAGMA temp_store = MEMORY;"
+                "CREATE TABLE temp(z INTEGER, x INTEGER, y INTEGER, "
+                "layer TEXT, idx INTEGER, feature BLOB, geomtype INTEGER, "
+                "area_or_length DOUBLE);"
+                "CREATE INDEX temp_index ON temp (z, x, y, layer, idx);"));
+        }
+
+        sqlite3_stmt *hInsertStmt = nullptr;
+        CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
+            hDB,
+            "INSERT INTO temp "
+            "(z,x,y,layer,idx,feature,geomtype,area_or_length) "
+            "VALUES (?,?,?,?,?,?,?,?)",
+            -1, &hInsertStmt, nullptr));
+        if (hInsertStmt == nullptr)
+        {
+            delete poDS;
+            return nullptr;
+        }
+        poDS->m_hInsertStmt = hInsertStmt;
     }
-    poDS->m_hInsertStmt = hInsertStmt;
 
     poDS->m_nMinZoom = atoi(CSLFetchNameValueDef(
         papszOptions, "MINZOOM", CPLSPrintf("%d", poDS->m_nMinZoom)));
@@ -6242,6 +7033,14 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
             delete poDS;
             return nullptr;
         }
+        if (poDS->m_poTileSink)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Custom TILING_SCHEME not supported with this output "
+                     "format");
+            delete poDS;
+            return nullptr;
+        }
 
         const CPLStringList aoList(CSLTokenizeString2(pszTilingScheme, ",", 0));
         if (aoList.Count() >= 4)
@@ -6329,6 +7128,14 @@ GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
                                        eDT, papszOptions);
 }
 
+GDALDataset *
+OGRMVTWriterDatasetCreate(const char *pszFilename, CSLConstList papszOptions,
+                          std::unique_ptr<OGRMVTWriterTileSink> poTileSink)
+{
+    return OGRMVTWriterDataset::Create(pszFilename, papszOptions,
+                                       std::move(poTileSink));
+}
+
 #endif  // HAVE_MVT_WRITE_SUPPORT
 
 /************************************************************************/
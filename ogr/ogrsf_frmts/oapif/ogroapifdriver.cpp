@@ -14,11 +14,15 @@
 #include "cpl_conv.h"
 #include "cpl_minixml.h"
 #include "cpl_http.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_swq.h"
 #include "parsexsd.h"
 
 #include <algorithm>
 #include <cinttypes>
+#include <deque>
 #include <memory>
 #include <vector>
 #include <set>
@@ -78,6 +82,8 @@ class OGROAPIFDataset final : public GDALDataset
     int m_nPageSize = 1000;
     int m_nInitialRequestPageSize = 20;
     bool m_bPageSizeSetFromOpenOptions = false;
+    // Maximum number of pages downloaded ahead of the one being read
+    int m_nMaxPrefetchedPages = 0;
     std::vector<std::unique_ptr<OGRLayer>> m_apoLayers;
     std::string m_osAskedCRS{};
     OGRSpatialReference m_oAskedCRS{};
@@ -96,7 +102,8 @@ class OGROAPIFDataset final : public GDALDataset
 
     bool Download(const CPLString &osURL, const char *pszAccept,
                   CPLString &osResult, CPLString &osContentType,
-                  CPLStringList *paosHeaders = nullptr);
+                  CPLStringList *paosHeaders = nullptr,
+                  bool bUsePersistentSession = true);
 
     bool DownloadJSon(const CPLString &osURL, CPLJSONDocument &oDoc,
                       const char *pszAccept = MEDIA_TYPE_GEOJSON
@@ -178,8 +185,35 @@ class OGROAPIFLayer final : public OGRLayer
     CPLJSONDocument m_oCurDoc{};
     int m_iFeatureInPage = 0;
 
+    // Page downloaded in the background, ahead of the one being read
+    struct PrefetchedPage
+    {
+        CPLString osURL{};
+        bool bOK = false;
+        CPLString osResult{};
+        CPLStringList aosHeaders{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::unique_ptr<CPLJobQueue> poJobQueue{};
+    };
+
+    // In reading order
+    std::deque<std::unique_ptr<PrefetchedPage>> m_apoPrefetchedPages{};
+
+    // Set when the "next" links only differ by an offset parameter, in
+    // which case several pages can be requested at once.
+    bool m_bOffsetPaging = false;
+    bool m_bOffsetPagingEnded = false;
+    CPLString m_osOffsetPagingURL{};
+    CPLString m_osOffsetPagingKey{};
+    GIntBig m_nOffsetPagingNext = 0;
+    GIntBig m_nOffsetPagingStep = 0;
+    GIntBig m_nNumberMatched = -1;
+
     void EstablishFeatureDefn();
     OGRFeature *GetNextRawFeature();
+    void PrefetchNextPages(const CPLString &osCurURL, int nFeaturesInPage);
+    void SubmitPageDownload(const CPLString &osURL);
+    void DiscardPrefetchedPages();
     CPLString AddFilters(const CPLString &osURL);
     CPLString BuildFilter(const swq_expr_node *poNode);
     CPLString BuildFilterCQLText(const swq_expr_node *poNode);
@@ -354,7 +388,8 @@ CPLString OGROAPIFDataset::ResolveURL(const CPLString &osURL,
 
 bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
                                CPLString &osResult, CPLString &osContentType,
-                               CPLStringList *paosHeaders)
+                               CPLStringList *paosHeaders,
+                               bool bUsePersistentSession)
 {
 #ifndef REMOVE_HACK
     VSIStatBufL sStatBuf;
@@ -384,9 +419,13 @@ bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
         papszOptions =
             CSLSetNameValue(papszOptions, "USERPWD", m_osUserPwd.c_str());
     }
-    m_bMustCleanPersistent = true;
-    papszOptions =
-        CSLAddString(papszOptions, CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    // A persistent session cannot be used concurrently by several threads
+    if (bUsePersistentSession)
+    {
+        m_bMustCleanPersistent = true;
+        papszOptions = CSLAddString(papszOptions,
+                                    CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    }
     CPLString osURLWithQueryParameters(osURL);
     if (!m_osUserQueryParams.empty() &&
         osURL.find('?' + m_osUserQueryParams) == std::string::npos &&
@@ -1150,6 +1189,10 @@ bool OGROAPIFDataset::Open(GDALOpenInfo *poOpenInfo)
         m_nInitialRequestPageSize = initialRequestPageSize;
     }
 
+    m_nMaxPrefetchedPages = std::max(
+        0, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                     "MAX_PREFETCHED_PAGES", "0")));
+
     m_osUserPwd =
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "USERPWD", "");
     std::string osCRS =
@@ -1425,6 +1468,7 @@ OGROAPIFLayer::OGROAPIFLayer(OGROAPIFDataset *poDS, const CPLString &osName,
 
 OGROAPIFLayer::~OGROAPIFLayer()
 {
+    DiscardPrefetchedPages();
     m_poFeatureDefn->Release();
 }
 
@@ -1974,6 +2018,10 @@ void OGROAPIFLayer::ResetReading()
     }
     m_oCurDoc = CPLJSONDocument();
     m_iFeatureInPage = 0;
+    DiscardPrefetchedPages();
+    m_bOffsetPaging = false;
+    m_bOffsetPagingEnded = false;
+    m_nNumberMatched = -1;
 }
 
 /************************************************************************/
@@ -2040,6 +2088,138 @@ CPLString OGROAPIFLayer::AddFilters(const CPLString &osURL)
     return osURLNew;
 }
 
+/************************************************************************/
+/*                         SubmitPageDownload()                         */
+/************************************************************************/
+
+void OGROAPIFLayer::SubmitPageDownload(const CPLString &osURL)
+{
+    auto poPage = std::make_unique<PrefetchedPage>();
+    poPage->osURL = osURL;
+    PrefetchedPage *poPagePtr = poPage.get();
+    OGROAPIFDataset *poDS = m_poDS;
+    const auto Fetch = [poDS, poPagePtr]()
+    {
+        auto oAccumulator =
+            poPagePtr->oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+        CPLString osContentType;
+        poPagePtr->bOK = poDS->Download(
+            poPagePtr->osURL, MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
+            poPagePtr->osResult, osContentType, &poPagePtr->aosHeaders,
+            /* bUsePersistentSession = */ false);
+    };
+    CPLWorkerThreadPool *poPool =
+        GDALGetGlobalThreadPool(m_poDS->m_nMaxPrefetchedPages);
+    if (poPool)
+    {
+        poPage->poJobQueue = poPool->CreateJobQueue();
+        poPage->poJobQueue->SubmitJob(Fetch);
+    }
+    else
+    {
+        Fetch();
+    }
+    m_apoPrefetchedPages.push_back(std::move(poPage));
+}
+
+/************************************************************************/
+/*                       DiscardPrefetchedPages()                       */
+/************************************************************************/
+
+void OGROAPIFLayer::DiscardPrefetchedPages()
+{
+    for (auto &poPage : m_apoPrefetchedPages)
+    {
+        if (poPage->poJobQueue)
+            poPage->poJobQueue->WaitCompletion();
+    }
+    m_apoPrefetchedPages.clear();
+}
+
+/************************************************************************/
+/*                         PrefetchNextPages()                          */
+/************************************************************************/
+
+/* Called once a page has been downloaded, and m_osGetURL set to its "next"
+ * link. Starts downloading the following page(s) in the background, so that
+ * this is overlapped with the parsing of the current page. When the server
+ * uses offset-based paging, several pages are requested concurrently. */
+void OGROAPIFLayer::PrefetchNextPages(const CPLString &osCurURL,
+                                      int nFeaturesInPage)
+{
+    if (m_poDS->m_nMaxPrefetchedPages == 0)
+        return;
+
+    if (m_bOffsetPaging)
+    {
+        // Pages of the offset-based paging after the last one are empty,
+        // or shorter than the page size.
+        if (m_osGetURL.empty() || nFeaturesInPage < m_nOffsetPagingStep)
+        {
+            m_bOffsetPagingEnded = true;
+            DiscardPrefetchedPages();
+        }
+        m_osGetURL.clear();
+    }
+    else if (!m_osGetURL.empty() && m_apoPrefetchedPages.empty())
+    {
+        if (m_nNumberMatched < 0)
+            m_nNumberMatched = m_oCurDoc.GetRoot().GetLong("numberMatched", -1);
+
+        for (const char *pszKey : {"offset", "startindex"})
+        {
+            const CPLString osNextOffset = CPLURLGetValue(m_osGetURL, pszKey);
+            const CPLString osCurOffset = CPLURLGetValue(osCurURL, pszKey);
+            if (osNextOffset.empty() ||
+                CPLGetValueType(osNextOffset) != CPL_VALUE_INTEGER ||
+                (!osCurOffset.empty() &&
+                 CPLGetValueType(osCurOffset) != CPL_VALUE_INTEGER))
+            {
+                continue;
+            }
+            const GIntBig nNextOffset = CPLAtoGIntBig(osNextOffset);
+            const GIntBig nStep =
+                nNextOffset -
+                (osCurOffset.empty() ? 0 : CPLAtoGIntBig(osCurOffset));
+            if (nStep > 0 && nStep == nFeaturesInPage)
+            {
+                CPLDebug("OAPIF",
+                         "Offset-based paging detected. Fetching up to %d "
+                         "pages concurrently",
+                         m_poDS->m_nMaxPrefetchedPages);
+                m_bOffsetPaging = true;
+                m_osOffsetPagingURL = m_osGetURL;
+                m_osOffsetPagingKey = pszKey;
+                m_nOffsetPagingNext = nNextOffset;
+                m_nOffsetPagingStep = nStep;
+                m_osGetURL.clear();
+            }
+            break;
+        }
+    }
+
+    if (m_bOffsetPaging)
+    {
+        while (!m_bOffsetPagingEnded &&
+               static_cast<int>(m_apoPrefetchedPages.size()) <
+                   m_poDS->m_nMaxPrefetchedPages &&
+               (m_nNumberMatched < 0 ||
+                m_nOffsetPagingNext < m_nNumberMatched))
+        {
+            SubmitPageDownload(CPLURLAddKVP(
+                m_osOffsetPagingURL, m_osOffsetPagingKey,
+                CPLSPrintf(CPL_FRMT_GIB, m_nOffsetPagingNext)));
+            m_nOffsetPagingNext += m_nOffsetPagingStep;
+        }
+    }
+    else if (!m_osGetURL.empty())
+    {
+        SubmitPageDownload(m_osGetURL);
+        m_osGetURL.clear();
+    }
+}
+
 /************************************************************************/
 /*                         GetNextRawFeature()                          */
 /************************************************************************/
@@ -2054,19 +2234,37 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
     {
         if (m_poUnderlyingLayer == nullptr)
         {
-            if (m_osGetURL.empty())
-                return nullptr;
-
             m_oCurDoc = CPLJSONDocument();
 
-            const CPLString osURL(m_osGetURL);
-            m_osGetURL.clear();
+            CPLString osURL;
             CPLStringList aosHeaders;
-            if (!m_poDS->DownloadJSon(osURL, m_oCurDoc,
-                                      MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
-                                      &aosHeaders))
+            if (!m_apoPrefetchedPages.empty())
             {
-                return nullptr;
+                auto poPage = std::move(m_apoPrefetchedPages.front());
+                m_apoPrefetchedPages.pop_front();
+                if (poPage->poJobQueue)
+                    poPage->poJobQueue->WaitCompletion();
+                poPage->oErrorAccumulator.ReplayErrors();
+                osURL = poPage->osURL;
+                aosHeaders = std::move(poPage->aosHeaders);
+                if (!poPage->bOK || !m_oCurDoc.LoadMemory(poPage->osResult))
+                {
+                    DiscardPrefetchedPages();
+                    return nullptr;
+                }
+            }
+            else
+            {
+                if (m_osGetURL.empty())
+                    return nullptr;
+                osURL = m_osGetURL;
+                m_osGetURL.clear();
+                if (!m_poDS->DownloadJSon(
+                        osURL, m_oCurDoc,
+                        MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON, &aosHeaders))
+                {
+                    return nullptr;
+                }
             }
 
             const std::string osContentCRS =
@@ -2125,30 +2323,15 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                 }
             }
 
-            const CPLString osTmpFilename(
-                VSIMemGenerateHiddenFilename("oapif.json"));
-            m_oCurDoc.Save(osTmpFilename);
-            m_poUnderlyingDS =
-                std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
-                    GDALOpenEx(osTmpFilename, GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
-                               nullptr, nullptr, nullptr)));
-            VSIUnlink(osTmpFilename);
-            if (!m_poUnderlyingDS.get())
-            {
-                return nullptr;
-            }
-            m_poUnderlyingLayer = m_poUnderlyingDS->GetLayer(0);
-            if (!m_poUnderlyingLayer)
-            {
-                m_poUnderlyingDS.reset();
-                return nullptr;
-            }
-
             // To avoid issues with implementations having a non-relevant
-            // next link, make sure the current page is not empty
+            // next link, make sure the current page is not empty.
+            // This is done before opening the page as GeoJSON, so that the
+            // download of the next page(s) overlaps with its parsing.
             // We could even check that the feature count is the page size
             // actually
-            if (m_poUnderlyingLayer->GetFeatureCount() > 0 && m_osGetID.empty())
+            const int nFeaturesInPage =
+                m_oCurDoc.GetRoot().GetArray("features").Size();
+            if (nFeaturesInPage > 0 && m_osGetID.empty())
             {
                 CPLJSONArray oLinks = m_oCurDoc.GetRoot().GetArray("links");
                 if (oLinks.IsValid())
@@ -2219,6 +2402,26 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                     m_osGetURL = m_poDS->ResolveURL(m_osGetURL, osURL);
                 }
             }
+            PrefetchNextPages(osURL, nFeaturesInPage);
+
+            const CPLString osTmpFilename(
+                VSIMemGenerateHiddenFilename("oapif.json"));
+            m_oCurDoc.Save(osTmpFilename);
+            m_poUnderlyingDS =
+                std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
+                    GDALOpenEx(osTmpFilename, GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
+                               nullptr, nullptr, nullptr)));
+            VSIUnlink(osTmpFilename);
+            if (!m_poUnderlyingDS.get())
+            {
+                return nullptr;
+            }
+            m_poUnderlyingLayer = m_poUnderlyingDS->GetLayer(0);
+            if (!m_poUnderlyingLayer)
+            {
+                m_poUnderlyingDS.reset();
+                return nullptr;
+            }
         }
 
         // cppcheck-suppress nullPointerRedundantCheck
@@ -3244,6 +3447,9 @@ void RegisterOGROAPIF()
         "  <Option name='INITIAL_REQUEST_PAGE_SIZE' type='int' "
         "description='Maximum number of features to retrieve in the initial "
         "request issued to determine the schema from a feature sample'/>"
+        "  <Option name='MAX_PREFETCHED_PAGES' type='int' "
+        "description='Maximum number of pages downloaded in the background "
+        "ahead of the one being read. 0 to disable' default='0'/>"
         "  <Option name='USERPWD' type='string' "
         "description='Basic authentication as username:password'/>"
         "  <Option name='IGNORE_SCHEMA' type='boolean' "
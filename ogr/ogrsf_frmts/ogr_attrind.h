@@ -36,6 +36,12 @@ class CPL_DLL OGRAttrIndex
     virtual GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList,
                                    int *nFIDCount, int *nLength) = 0;
 
+    virtual GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                                     const OGRField *psMax, bool bMaxIncluded,
+                                     int *pnFIDCount);
+    virtual GIntBig *GetPrefixMatches(const char *pszPrefix,
+                                      bool bCaseInsensitive, int *pnFIDCount);
+
     virtual OGRErr AddEntry(OGRField *psKey, GIntBig nFID) = 0;
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
 
@@ -41,6 +41,10 @@ class OGRSFDriver;
 
 struct ArrowArrayStream;
 
+//! @cond Doxygen_Suppress
+struct OGRArrowArrayStreamPrefetcher;
+//! @endcond
+
 /************************************************************************/
 /*                               OGRLayer                               */
 /************************************************************************/
@@ -132,6 +136,15 @@ class CPL_DLL OGRLayer : public GDALMajorObject
         std::vector<GIntBig> m_anQueriedFIDs{};
         size_t m_iQueriedFIDS = 0;
         std::deque<std::unique_ptr<OGRFeature>> m_oFeatureQueue{};
+        // Only set when the PREFETCH_BATCHES option is used
+        std::unique_ptr<OGRArrowArrayStreamPrefetcher> m_poPrefetcher{};
+
+        ArrowArrayStreamPrivateData();
+        ~ArrowArrayStreamPrivateData();
+        ArrowArrayStreamPrivateData(const ArrowArrayStreamPrivateData &) =
+            delete;
+        ArrowArrayStreamPrivateData &
+        operator=(const ArrowArrayStreamPrivateData &) = delete;
     };
 
     std::shared_ptr<ArrowArrayStreamPrivateData>
@@ -145,6 +158,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     friend class OGRArrowArrayHelper;
     friend class OGRGenSQLResultsLayer;
+    friend struct OGRArrowArrayStreamPrefetcher;
     static void ReleaseArray(struct ArrowArray *array);
     static void ReleaseSchema(struct ArrowSchema *schema);
     static void ReleaseStream(struct ArrowArrayStream *stream);
@@ -208,6 +222,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual bool GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature);
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
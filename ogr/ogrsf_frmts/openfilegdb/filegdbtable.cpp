@@ -32,6 +32,7 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "filegdbtable_priv.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
@@ -1590,6 +1591,68 @@ FileGDBTable::GetOffsetInTableForRow(int64_t iRow,
     return nOffset;
 }
 
+/************************************************************************/
+/*                           AdviseReadRows()                           */
+/************************************************************************/
+
+/** Hint that rows in the [iFirstRow, iEndRow[ range are going to be read.
+ *
+ * On network file systems, this allows the part of the .gdbtable file that
+ * contains them to be fetched with a single range request, instead of one
+ * request per (group of) row(s).
+ */
+void FileGDBTable::AdviseReadRows(int64_t iFirstRow, int64_t iEndRow)
+{
+    if (m_fpTable == nullptr || VSIIsLocal(m_osFilename.c_str()))
+        return;
+    const size_t nLimit = m_fpTable->GetAdviseReadTotalBytesLimit();
+    if (nLimit == 0)
+        return;
+
+    iFirstRow = std::max<int64_t>(0, iFirstRow);
+    iEndRow = std::min(iEndRow, m_nTotalRecordCount);
+
+    const bool bIsDeletedBackup = m_bIsDeleted;
+    vsi_l_offset nMinOffset = std::numeric_limits<vsi_l_offset>::max();
+    vsi_l_offset nMaxOffset = 0;
+    bool bMaxOffsetIsDeleted = false;
+    for (int64_t iRow = iFirstRow; iRow < iEndRow; ++iRow)
+    {
+        const vsi_l_offset nOffset = GetOffsetInTableForRow(iRow);
+        if (m_bError)
+            break;
+        if (nOffset == 0)
+            continue;
+        nMinOffset = std::min(nMinOffset, nOffset);
+        if (nOffset > nMaxOffset)
+        {
+            nMaxOffset = nOffset;
+            bMaxOffsetIsDeleted = m_bIsDeleted;
+        }
+    }
+    m_bIsDeleted = bIsDeletedBackup;
+    if (m_bError || nMaxOffset == 0)
+        return;
+
+    // Read the size of the last row to know where the range ends
+    GByte abyBuffer[4];
+    if (VSIFSeekL(m_fpTable, nMaxOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyBuffer, 4, 1, m_fpTable) != 1)
+    {
+        return;
+    }
+    GUInt32 nLastRowSize = GetUInt32(abyBuffer, 0);
+    if (bMaxOffsetIsDeleted)
+        nLastRowSize = static_cast<GUInt32>(-static_cast<int>(nLastRowSize));
+    const vsi_l_offset nEndOffset = nMaxOffset + 4 + nLastRowSize;
+    if (nEndOffset - nMinOffset > nLimit)
+        return;
+
+    const vsi_l_offset nRangeOffset = nMinOffset;
+    const size_t nRangeSize = static_cast<size_t>(nEndOffset - nMinOffset);
+    m_fpTable->AdviseRead(1, &nRangeOffset, &nRangeSize);
+}
+
 /************************************************************************/
 /*                        ReadFeatureOffset()                           */
 /************************************************************************/
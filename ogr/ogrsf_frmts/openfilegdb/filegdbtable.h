@@ -706,6 +706,15 @@ class FileGDBTable
     GetOffsetInTableForRow(int64_t iRow,
                            vsi_l_offset *pnOffsetInTableX = nullptr);
 
+    void AdviseReadRows(int64_t iFirstRow, int64_t iEndRow);
+
+    /** Return whether row offsets are read from a .gdbtablx file, rather than
+     * guessed by scanning the .gdbtable file. */
+    bool HasTableXFile() const
+    {
+        return m_fpTableX != nullptr;
+    }
+
     int HasDeletedFeaturesListed() const
     {
         return m_bHasDeletedFeaturesListed;
@@ -22,6 +22,8 @@
 #include "gdal_rat.h"
 
 #include <array>
+#include <deque>
+#include <memory>
 #include <vector>
 #include <map>
 
@@ -141,9 +143,22 @@ class OGROpenFileGDBLayer final : public OGRLayer
     int BuildLayerDefinition();
     int BuildGeometryColumnGDBv10(const std::string &osParentDefinition);
     OGRFeature *GetCurrentFeature();
+    OGRFeature *GetCurrentFeature(FileGDBTable *poTable,
+                                  FileGDBOGRGeometryConverter *poGeomConverter,
+                                  bool bMainTable);
 
     std::unique_ptr<FileGDBOGRGeometryConverter> m_poGeomConverter{};
 
+    // Multi-threaded sequential scan
+    int m_nNumThreads = -1;
+    std::vector<std::unique_ptr<FileGDBTable>> m_apoWorkerTables{};
+    std::vector<std::unique_ptr<FileGDBOGRGeometryConverter>>
+        m_apoWorkerGeomConverters{};
+    std::deque<std::unique_ptr<OGRFeature>> m_apoQueuedFeatures{};
+    int GetNumThreads();
+    bool UseParallelScan();
+    void FillFeatureQueue();
+
     int m_iFieldToReadAsBinary = -1;
 
     FileGDBIterator *m_poAttributeIterator = nullptr;
@@ -264,6 +279,9 @@ class OGROpenFileGDBLayer final : public OGRLayer
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
 
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
+
     virtual GIntBig GetFeatureCount(int bForce = TRUE) override;
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
                       bool bForce) override;
@@ -25,6 +25,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
@@ -35,9 +36,12 @@
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
 #include "ogrsf_frmts.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                      OGROpenFileGDBLayer()                           */
@@ -120,6 +124,9 @@ OGROpenFileGDBLayer::~OGROpenFileGDBLayer()
 
 void OGROpenFileGDBLayer::Close()
 {
+    m_apoQueuedFeatures.clear();
+    m_apoWorkerGeomConverters.clear();
+    m_apoWorkerTables.clear();
     delete m_poLyrTable;
     m_poLyrTable = nullptr;
     m_bValidLayerDefn = FALSE;
@@ -902,6 +909,7 @@ void OGROpenFileGDBLayer::ResetReading()
     }
     m_bEOF = FALSE;
     m_iCurFeat = 0;
+    m_apoQueuedFeatures.clear();
     if (m_poAttributeIterator)
         m_poAttributeIterator->Reset();
     if (m_poSpatialIndexIterator)
@@ -921,6 +929,7 @@ OGRErr OGROpenFileGDBLayer::ISetSpatialFilter(int iGeomField,
         return OGRERR_FAILURE;
 
     OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
+    m_apoQueuedFeatures.clear();
 
     if (m_bFilterIsEnvelope)
     {
@@ -1672,6 +1681,7 @@ OGRErr OGROpenFileGDBLayer::SetAttributeFilter(const char *pszFilter)
     delete m_poCombinedIterator;
     m_poCombinedIterator = nullptr;
     m_bIteratorSufficientToEvaluateFilter = FALSE;
+    m_apoQueuedFeatures.clear();
 
     OGRErr eErr = OGRLayer::SetAttributeFilter(pszFilter);
     if (eErr != OGRERR_NONE ||
@@ -1715,16 +1725,59 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                      PromoteToMultiGeometry()                       */
+/***********************************************************************/
+
+// Polygon and line geometries are reported as their multi counterpart, to be
+// consistent with the layer geometry type.
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
 
 OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
+{
+    return GetCurrentFeature(m_poLyrTable, m_poGeomConverter.get(), true);
+}
+
+/** Build a feature from the current row of poTable.
+ *
+ * bMainTable must be false when poTable is one of the tables used by the
+ * worker threads of a multi-threaded scan. The legacy in-memory spatial index
+ * is then not updated (FillFeatureQueue() takes care of it), and no spatial
+ * filter is assumed to be set.
+ */
+OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature(
+    FileGDBTable *poTable, FileGDBOGRGeometryConverter *poGeomConverter,
+    bool bMainTable)
 {
     OGRFeature *poFeature = nullptr;
     int iOGRIdx = 0;
-    int64_t iRow = m_poLyrTable->GetCurRow();
-    for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount(); iGDBIdx++)
+    int64_t iRow = poTable->GetCurRow();
+    for (int iGDBIdx = 0; iGDBIdx < poTable->GetFieldCount(); iGDBIdx++)
     {
         if (iOGRIdx == m_iFIDAsRegularColumnIndex)
             iOGRIdx++;
@@ -1733,19 +1786,18 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
         {
             if (m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
             {
-                if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                if (bMainTable && m_eSpatialIndexState == SPI_IN_BUILDING)
                     m_eSpatialIndexState = SPI_INVALID;
                 continue;
             }
 
-            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            const OGRField *psField = poTable->GetFieldValue(iGDBIdx);
             if (psField != nullptr)
             {
-                if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                if (bMainTable && m_eSpatialIndexState == SPI_IN_BUILDING)
                 {
                     OGREnvelope sFeatureEnvelope;
-                    if (m_poLyrTable->GetFeatureExtent(psField,
-                                                       &sFeatureEnvelope))
+                    if (poTable->GetFeatureExtent(psField, &sFeatureEnvelope))
                     {
 #if SIZEOF_VOIDP < 8
                         if (iRow > INT32_MAX)
@@ -1771,38 +1823,18 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                     }
                 }
 
-                if (m_poFilterGeom != nullptr &&
+                if (bMainTable && m_poFilterGeom != nullptr &&
                     m_eSpatialIndexState != SPI_COMPLETED &&
-                    !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(
-                        psField))
+                    !poTable->DoesGeometryIntersectsFilterEnvelope(psField))
                 {
                     delete poFeature;
                     return nullptr;
                 }
 
-                OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
+                OGRGeometry *poGeom = poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -1813,13 +1845,13 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 }
             }
         }
-        else if (iGDBIdx != m_poLyrTable->GetObjectIdFieldIdx())
+        else if (iGDBIdx != poTable->GetObjectIdFieldIdx())
         {
             const OGRFieldDefn *poFieldDefn =
                 m_poFeatureDefn->GetFieldDefn(iOGRIdx);
             if (!poFieldDefn->IsIgnored())
             {
-                const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+                const OGRField *psField = poTable->GetFieldValue(iGDBIdx);
                 if (poFeature == nullptr)
                     poFeature = new OGRFeature(m_poFeatureDefn);
                 if (psField == nullptr)
@@ -1836,7 +1868,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                     else if (poFieldDefn->GetType() == OFTDateTime)
                     {
                         OGRField sField = *psField;
-                        if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        if (poTable->GetField(iGDBIdx)->GetType() ==
                             FGFT_DATETIME)
                         {
                             sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
@@ -1854,10 +1886,10 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
     if (poFeature == nullptr)
         poFeature = new OGRFeature(m_poFeatureDefn);
 
-    if (m_poLyrTable->HasDeletedFeaturesListed())
+    if (poTable->HasDeletedFeaturesListed())
     {
         poFeature->SetField(poFeature->GetFieldCount() - 1,
-                            m_poLyrTable->IsCurRowDeleted());
+                            poTable->IsCurRowDeleted());
     }
 
     poFeature->SetFID(iRow + 1);
@@ -1868,6 +1900,234 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
     return poFeature;
 }
 
+/***********************************************************************/
+/*                           GetNumThreads()                           */
+/***********************************************************************/
+
+int OGROpenFileGDBLayer::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    }
+    return m_nNumThreads;
+}
+
+// Number of consecutive rows decoded by a worker thread in a batch. Matches
+// the granularity of the block map of .gdbtablx files.
+constexpr int PARALLEL_SCAN_ROWS_PER_THREAD = 1024;
+
+/***********************************************************************/
+/*                          UseParallelScan()                          */
+/***********************************************************************/
+
+/** Return whether the sequential scan of the table must be done by
+ * FillFeatureQueue(), that is with several threads.
+ *
+ * Each thread uses its own FileGDBTable object, so that rows are read and
+ * decoded concurrently. This is only done in read-only mode, when no spatial
+ * filter is set, and on tables large enough for this to be worthwhile.
+ */
+bool OGROpenFileGDBLayer::UseParallelScan()
+{
+    if (m_bEditable || m_poFilterGeom != nullptr ||
+        !m_poLyrTable->HasTableXFile() ||
+        m_poLyrTable->GetTotalRecordCount() - m_iCurFeat <
+            2 * PARALLEL_SCAN_ROWS_PER_THREAD ||
+        GetNumThreads() <= 1)
+    {
+        return !m_apoQueuedFeatures.empty();
+    }
+
+    if (m_apoWorkerTables.empty())
+    {
+        const int nThreads = GetNumThreads();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            auto poTable = std::make_unique<FileGDBTable>();
+            if (!poTable->Open(m_osGDBFilename, false, GetDescription()) ||
+                poTable->GetFieldCount() != m_poLyrTable->GetFieldCount() ||
+                poTable->GetTotalRecordCount() !=
+                    m_poLyrTable->GetTotalRecordCount())
+            {
+                m_apoWorkerGeomConverters.clear();
+                m_apoWorkerTables.clear();
+                m_nNumThreads = 1;
+                return false;
+            }
+            std::unique_ptr<FileGDBOGRGeometryConverter> poGeomConverter;
+            if (m_iGeomFieldIdx >= 0)
+            {
+                poGeomConverter.reset(
+                    FileGDBOGRGeometryConverter::BuildConverter(
+                        poTable->GetGeomField()));
+            }
+            m_apoWorkerTables.push_back(std::move(poTable));
+            m_apoWorkerGeomConverters.push_back(std::move(poGeomConverter));
+        }
+        CPLDebug("OpenFileGDB", "%s: using %d threads for sequential reading",
+                 GetDescription(), nThreads);
+    }
+
+    return true;
+}
+
+/***********************************************************************/
+/*                          FillFeatureQueue()                         */
+/***********************************************************************/
+
+/** Decode the next rows of the table with several threads, each one taking
+ * care of a range of consecutive rows, and append the resulting features,
+ * in row order, to m_apoQueuedFeatures.
+ */
+void OGROpenFileGDBLayer::FillFeatureQueue()
+{
+    const int64_t nTotalRecordCount = m_poLyrTable->GetTotalRecordCount();
+    const int nWorkers = static_cast<int>(m_apoWorkerTables.size());
+
+    struct WorkerResult
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        bool bError = false;
+    };
+
+    std::vector<WorkerResult> asResults(nWorkers);
+
+    const auto DecodeRows = [this, &asResults](int iWorker, int64_t iStartRow,
+                                               int64_t iEndRow)
+    {
+        FileGDBTable *poTable = m_apoWorkerTables[iWorker].get();
+        FileGDBOGRGeometryConverter *poGeomConverter =
+            m_apoWorkerGeomConverters[iWorker].get();
+        auto &sResult = asResults[iWorker];
+        poTable->AdviseReadRows(iStartRow, iEndRow);
+        for (int64_t iRow = iStartRow; iRow < iEndRow; ++iRow)
+        {
+            if (poTable->SelectRow(iRow))
+            {
+                sResult.apoFeatures.emplace_back(
+                    GetCurrentFeature(poTable, poGeomConverter, false));
+            }
+            else if (poTable->HasGotError())
+            {
+                sResult.bError = true;
+                break;
+            }
+        }
+    };
+
+    while (m_apoQueuedFeatures.empty() && m_iCurFeat < nTotalRecordCount)
+    {
+        const int64_t iFirstRow = m_iCurFeat;
+        int nJobs = 0;
+        for (int iWorker = 0;
+             iWorker < nWorkers && m_iCurFeat < nTotalRecordCount; ++iWorker)
+        {
+            asResults[iWorker] = WorkerResult();
+            m_iCurFeat = std::min(m_iCurFeat + PARALLEL_SCAN_ROWS_PER_THREAD,
+                                  nTotalRecordCount);
+            ++nJobs;
+        }
+
+        CPLWorkerThreadPool *poThreadPool =
+            nJobs >= 2 ? GDALGetGlobalThreadPool(nJobs) : nullptr;
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        const auto GetStartRow = [iFirstRow](int iWorker)
+        {
+            return iFirstRow + static_cast<int64_t>(iWorker) *
+                                   PARALLEL_SCAN_ROWS_PER_THREAD;
+        };
+        const auto GetEndRow = [this, &GetStartRow](int iWorker)
+        { return std::min(GetStartRow(iWorker + 1), m_iCurFeat); };
+        if (!poJobQueue)
+        {
+            for (int iWorker = 0; iWorker < nJobs; ++iWorker)
+                DecodeRows(iWorker, GetStartRow(iWorker), GetEndRow(iWorker));
+        }
+        else
+        {
+            CPLErrorAccumulator oErrorAccumulator;
+            for (int iWorker = 0; iWorker < nJobs; ++iWorker)
+            {
+                const int64_t iStartRow = GetStartRow(iWorker);
+                const int64_t iEndRow = GetEndRow(iWorker);
+                poJobQueue->SubmitJob(
+                    [&DecodeRows, &oErrorAccumulator, iWorker, iStartRow,
+                     iEndRow]()
+                    {
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        DecodeRows(iWorker, iStartRow, iEndRow);
+                    });
+            }
+            poJobQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+        }
+
+        if (m_eSpatialIndexState == SPI_IN_BUILDING && m_iGeomFieldIdx >= 0 &&
+            m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
+        {
+            m_eSpatialIndexState = SPI_INVALID;
+        }
+
+        for (int iWorker = 0; iWorker < nJobs; ++iWorker)
+        {
+            auto &sResult = asResults[iWorker];
+            for (auto &poFeature : sResult.apoFeatures)
+            {
+                const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+                if (m_eSpatialIndexState == SPI_IN_BUILDING && poGeom &&
+                    !poGeom->IsEmpty())
+                {
+                    const int64_t iRow = poFeature->GetFID() - 1;
+#if SIZEOF_VOIDP < 8
+                    if (iRow > INT32_MAX)
+                    {
+                        // m_pQuadTree stores iRow values as void*
+                        // This would overflow here.
+                        m_eSpatialIndexState = SPI_INVALID;
+                    }
+                    else
+#endif
+                    {
+                        OGREnvelope sFeatureEnvelope;
+                        poGeom->getEnvelope(&sFeatureEnvelope);
+                        CPLRectObj sBounds;
+                        sBounds.minx = sFeatureEnvelope.MinX;
+                        sBounds.miny = sFeatureEnvelope.MinY;
+                        sBounds.maxx = sFeatureEnvelope.MaxX;
+                        sBounds.maxy = sFeatureEnvelope.MaxY;
+                        CPLQuadTreeInsertWithBounds(
+                            m_pQuadTree,
+                            reinterpret_cast<void *>(
+                                static_cast<uintptr_t>(iRow)),
+                            &sBounds);
+                    }
+                }
+                m_apoQueuedFeatures.push_back(std::move(poFeature));
+            }
+            if (sResult.bError)
+            {
+                // Stop reading after the last successfully read row
+                if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                    m_eSpatialIndexState = SPI_INVALID;
+                m_iCurFeat = nTotalRecordCount;
+                return;
+            }
+        }
+    }
+
+    if (m_eSpatialIndexState == SPI_IN_BUILDING &&
+        m_iCurFeat == nTotalRecordCount)
+    {
+        CPLDebug("OpenFileGDB", "SPI_COMPLETED");
+        m_eSpatialIndexState = SPI_COMPLETED;
+    }
+}
+
 /***********************************************************************/
 /*                         GetNextFeature()                            */
 /***********************************************************************/
@@ -1930,6 +2190,17 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
                 }
             }
         }
+        else if (UseParallelScan())
+        {
+            if (m_apoQueuedFeatures.empty())
+            {
+                FillFeatureQueue();
+                if (m_apoQueuedFeatures.empty())
+                    return nullptr;
+            }
+            poFeature = m_apoQueuedFeatures.front().release();
+            m_apoQueuedFeatures.pop_front();
+        }
         else
         {
             while (true)
@@ -1975,6 +2246,338 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                        GetNextArrowArray()                          */
+/***********************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    if (!BuildLayerDefinition())
+        return EINVAL;
+
+    // The specialized implementation below only handles a sequential scan of
+    // the table, with the spatial filter evaluated while reading and the
+    // attribute filter evaluated afterwards on the batch. Index-assisted
+    // reading and the more exotic cases are delegated to the generic
+    // implementation.
+    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(
+            m_aosArrowArrayStreamOptions) ||
+        m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                               false) ||
+        (m_poAttrQuery != nullptr &&
+         !m_aosArrowArrayStreamOptions.FetchBool("INCLUDE_FID", true)) ||
+        m_poCombinedIterator != nullptr ||
+        m_poSpatialIndexIterator != nullptr ||
+        m_poAttributeIterator != nullptr || m_nFilteredFeatureCount >= 0 ||
+        m_iFieldToReadAsBinary >= 0 || m_iFIDAsRegularColumnIndex >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed())
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+begin:
+    int errorErrno = EIO;
+    memset(out_array, 0, sizeof(*out_array));
+
+    if (m_bEOF || m_iCurFeat >= m_poLyrTable->GetTotalRecordCount())
+        return 0;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    // The in-memory spatial index is only built by GetNextFeature()
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    const int iGeomArrowField =
+        m_iGeomFieldIdx >= 0 ? sHelper.m_mapOGRGeomFieldToArrowField[0] : -1;
+    const bool bReadGeometry =
+        m_iGeomFieldIdx >= 0 &&
+        (iGeomArrowField >= 0 || m_poFilterGeom != nullptr);
+    const int nGDBFieldCount = m_poLyrTable->GetFieldCount();
+    const int iObjectIdFieldIdx = m_poLyrTable->GetObjectIdFieldIdx();
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int iFeat = 0;
+    bool bRowDeferred = false;
+
+    // Whether appending nLen bytes to the variable-length array psArray would
+    // exceed the memory limit, in which case the current row is deferred to
+    // the next batch.
+    const auto ExceedsMemLimit =
+        [&iFeat, nMemLimit](const struct ArrowArray *psArray, size_t nLen)
+    {
+        if (iFeat == 0)
+            return false;
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nLen <= nMemLimit && nLen > nMemLimit - nCurLength;
+    };
+
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        if (m_iCurFeat >= m_poLyrTable->GetTotalRecordCount())
+            break;
+        const int64_t iRow =
+            m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+        if (iRow < 0)
+        {
+            m_bEOF = TRUE;
+            break;
+        }
+        m_iCurFeat = iRow + 1;
+
+        if (bReadGeometry)
+        {
+            const OGRField *psField =
+                m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if (m_poFilterGeom != nullptr &&
+                (psField == nullptr ||
+                 !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(psField)))
+            {
+                continue;
+            }
+
+            std::unique_ptr<OGRGeometry> poGeom;
+            if (psField != nullptr)
+            {
+                poGeom.reset(m_poGeomConverter->GetAsGeometry(psField));
+                if (poGeom)
+                    poGeom.reset(PromoteToMultiGeometry(poGeom.release()));
+            }
+            if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom.get()))
+                continue;
+
+            if (iGeomArrowField >= 0)
+            {
+                if (poGeom)
+                {
+                    const size_t nWKBSize = poGeom->WkbSize();
+                    if (ExceedsMemLimit(out_array->children[iGeomArrowField],
+                                        nWKBSize))
+                    {
+                        m_iCurFeat = iRow;
+                        bRowDeferred = true;
+                        goto after_loop;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iGeomArrowField, iFeat, nWKBSize);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                }
+                else if (!sHelper.SetNull(iGeomArrowField, iFeat))
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+            }
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+
+        for (int iGDBIdx = 0, iField = 0; iGDBIdx < nGDBFieldCount; iGDBIdx++)
+        {
+            if (iGDBIdx == m_iGeomFieldIdx || iGDBIdx == iObjectIdFieldIdx)
+                continue;
+            const int iOGRIdx = iField++;
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+            if (iArrowField < 0)
+                continue;
+
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                if (!sHelper.SetNull(iArrowField, iFeat))
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefnUnsafe(iOGRIdx);
+            auto psArray = out_array->children[iArrowField];
+
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (psField->Integer != 0)
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        sHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat, psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    const bool bIsString = poFieldDefn->GetType() == OFTString;
+                    const size_t nBytes =
+                        bIsString ? strlen(psField->String)
+                                  : static_cast<size_t>(psField->Binary.nCount);
+                    if (ExceedsMemLimit(psArray, nBytes))
+                    {
+                        m_iCurFeat = iRow;
+                        bRowDeferred = true;
+                        goto after_loop;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nBytes);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    if (nBytes)
+                    {
+                        memcpy(outPtr,
+                               bIsString ? static_cast<const void *>(
+                                               psField->String)
+                                         : psField->Binary.paData,
+                               nBytes);
+                    }
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    sHelper.SetDate(psArray, iFeat, brokenDown, *psField);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    const int nMS =
+                        psField->Date.Hour * 3600000 +
+                        psField->Date.Minute * 60000 +
+                        static_cast<int>(psField->Date.Second * 1000 + 0.5);
+                    sHelper.SetInt32(psArray, iFeat, nMS);
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                        sHelper.m_anTZFlags[iOGRIdx], sField);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        ++iFeat;
+    }
+
+after_loop:
+    if (bRowDeferred)
+    {
+        // The current row was deferred to the next batch: undo the null
+        // markers that might have been set for it.
+        for (int i = 0; i < sHelper.m_nChildren; ++i)
+        {
+            auto psArray = out_array->children[i];
+            auto pabyNull = static_cast<uint8_t *>(
+                const_cast<void *>(psArray->buffers[0]));
+            if (pabyNull && (pabyNull[iFeat / 8] & (1 << (iFeat % 8))) == 0)
+            {
+                pabyNull[iFeat / 8] |= static_cast<uint8_t>(1 << (iFeat % 8));
+                --psArray->null_count;
+            }
+        }
+    }
+    sHelper.Shrink(iFeat);
+
+    if (out_array->length != 0 && m_poAttrQuery)
+    {
+        struct ArrowSchema schema;
+        stream->get_schema(stream, &schema);
+        CPLAssert(schema.release != nullptr);
+        CPLAssert(schema.n_children == out_array->n_children);
+        // Spatial filter already evaluated
+        auto poFilterGeomBackup = m_poFilterGeom;
+        m_poFilterGeom = nullptr;
+        PostFilterArrowArray(&schema, out_array, nullptr);
+        schema.release(&schema);
+        m_poFilterGeom = poFilterGeomBackup;
+    }
+
+    if (out_array->length == 0)
+    {
+        if (out_array->release)
+            out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+
+        if (m_poAttrQuery || m_poFilterGeom)
+        {
+            goto begin;
+        }
+    }
+
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -2021,6 +2624,8 @@ OGRErr OGROpenFileGDBLayer::SetNextByIndex(GIntBig nIndex)
     if (m_eSpatialIndexState == SPI_IN_BUILDING)
         m_eSpatialIndexState = SPI_INVALID;
 
+    m_apoQueuedFeatures.clear();
+
     if (m_nFilteredFeatureCount >= 0)
     {
         if (nIndex < 0 || nIndex >= m_nFilteredFeatureCount)
@@ -2302,6 +2907,10 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
     {
         return TRUE;
     }
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return TRUE;
+    }
     else if (EQUAL(pszCap, OLCFastGetExtent))
     {
         return TRUE;
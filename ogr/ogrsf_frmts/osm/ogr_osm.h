@@ -18,6 +18,7 @@
 
 #include "ogrsf_frmts.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 
 #include <array>
 #include <set>
@@ -409,6 +410,11 @@ class OGROSMDataSource final : public GDALDataset
 
     std::vector<LonLat> m_asLonLatCache{};
 
+    // Resolved coordinates of each item of m_asWayFeaturePairs
+    std::vector<std::vector<LonLat>> m_aasWaysLonLat{};
+
+    int m_nNumThreads = -1;
+
     std::array<const char *, 7> m_ignoredKeys = {{"area", "created_by",
                                                   "converted_by", "note",
                                                   "todo", "fixme", "FIXME"}};
@@ -486,6 +492,14 @@ class OGROSMDataSource final : public GDALDataset
     GIntBig m_nNodesFileSize = 0;
     VSILFILE *m_fpNodes = nullptr;
 
+    // Read-only memory mapping of the nodes file, when it is on disk
+    bool m_bMapNodesFile = true;
+    CPLVirtualMem *m_psNodesFileMapping = nullptr;
+    GIntBig m_nNodesFileMappingSize = 0;
+    const GByte *GetNodesFileData();
+    void ReleaseNodesFileMapping();
+    bool ReadNodesFile(GIntBig nOffset, size_t nSize, GByte *pabyOut);
+
     GIntBig m_nPrevNodeId = -INT_MAX;
     int m_nBucketOld = -1;
     int m_nOffInBucketReducedOld = -1;
@@ -528,7 +542,11 @@ class OGROSMDataSource final : public GDALDataset
     bool StartTransactionCacheDB();
     bool CommitTransactionCacheDB();
 
-    int FindNode(GIntBig nID);
+    int FindNode(GIntBig nID) const;
+    void ResolveWayNodes(const WayFeaturePair &sWayFeaturePair,
+                         std::vector<LonLat> &asLonLat) const;
+    void ResolveWaysNodes(size_t iStart, size_t iEnd);
+    int GetNumThreads();
     void ProcessWaysBatch();
 
     void ProcessPolygonsStandalone();
@@ -40,6 +40,7 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -293,6 +294,7 @@ OGROSMDataSource::~OGROSMDataSource()
         }
     }
 
+    ReleaseNodesFileMapping();
     if (m_fpNodes)
         VSIFCloseL(m_fpNodes);
     if (!m_osNodesFilename.empty() && m_bMustUnlinkNodesFile)
@@ -977,6 +979,107 @@ static bool DecompressSector(const GByte *pabyIn, int nSectorSize,
     return nRead == nSectorSize;
 }
 
+/************************************************************************/
+/*                          GetNodesFileData()                          */
+/************************************************************************/
+
+/** Return a pointer to the content of the nodes file, when it can be accessed
+ * directly: either because it is an in-memory file, or through a read-only
+ * memory mapping of the temporary file on disk. Returns nullptr otherwise.
+ *
+ * The returned pointer is only valid until the nodes file is written again.
+ */
+const GByte *OGROSMDataSource::GetNodesFileData()
+{
+    if (m_nNodesFileSize == 0)
+        return nullptr;
+
+    if (m_bInMemoryNodesFile)
+    {
+        vsi_l_offset nLength = 0;
+        const GByte *pabyData =
+            VSIGetMemFileBuffer(m_osNodesFilename, &nLength, FALSE);
+        if (pabyData && nLength >= static_cast<vsi_l_offset>(m_nNodesFileSize))
+            return pabyData;
+        return nullptr;
+    }
+
+    if (!m_bMapNodesFile)
+        return nullptr;
+
+    if (m_psNodesFileMapping &&
+        m_nNodesFileMappingSize == m_nNodesFileSize)
+    {
+        return static_cast<const GByte *>(
+            CPLVirtualMemGetAddr(m_psNodesFileMapping));
+    }
+
+    // New nodes have been written since the file was mapped: remap it
+    ReleaseNodesFileMapping();
+    if (static_cast<GUIntBig>(m_nNodesFileSize) >
+            std::numeric_limits<size_t>::max() ||
+        !CPLIsVirtualMemFileMapAvailable())
+    {
+        m_bMapNodesFile = false;
+        return nullptr;
+    }
+
+    VSIFFlushL(m_fpNodes);
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    m_psNodesFileMapping = CPLVirtualMemFileMapNew(
+        m_fpNodes, 0, static_cast<vsi_l_offset>(m_nNodesFileSize),
+        VIRTUALMEM_READONLY, nullptr, nullptr);
+    CPLPopErrorHandler();
+    if (m_psNodesFileMapping == nullptr)
+    {
+        CPLDebug("OSM", "Cannot memory-map the nodes file. "
+                        "Using regular file I/O instead.");
+        m_bMapNodesFile = false;
+        return nullptr;
+    }
+    m_nNodesFileMappingSize = m_nNodesFileSize;
+    return static_cast<const GByte *>(
+        CPLVirtualMemGetAddr(m_psNodesFileMapping));
+}
+
+/************************************************************************/
+/*                      ReleaseNodesFileMapping()                       */
+/************************************************************************/
+
+void OGROSMDataSource::ReleaseNodesFileMapping()
+{
+    if (m_psNodesFileMapping)
+    {
+        CPLVirtualMemFree(m_psNodesFileMapping);
+        m_psNodesFileMapping = nullptr;
+        m_nNodesFileMappingSize = 0;
+    }
+}
+
+/************************************************************************/
+/*                           ReadNodesFile()                            */
+/************************************************************************/
+
+/** Read nSize bytes at nOffset of the nodes file, preferably from the data
+ * returned by GetNodesFileData(). */
+bool OGROSMDataSource::ReadNodesFile(GIntBig nOffset, size_t nSize,
+                                     GByte *pabyOut)
+{
+    const GByte *pabyNodesFileData = GetNodesFileData();
+    if (pabyNodesFileData)
+    {
+        if (nOffset < 0 || nOffset > m_nNodesFileSize ||
+            nSize > static_cast<size_t>(m_nNodesFileSize - nOffset))
+            return false;
+        memcpy(pabyOut, pabyNodesFileData + static_cast<size_t>(nOffset),
+               nSize);
+        return true;
+    }
+
+    return VSIFSeekL(m_fpNodes, nOffset, SEEK_SET) == 0 &&
+           VSIFReadL(pabyOut, 1, nSize, m_fpNodes) == nSize;
+}
+
 /************************************************************************/
 /*                           LookupNodesCustom()                        */
 /************************************************************************/
@@ -1121,12 +1224,12 @@ void OGROSMDataSource::LookupNodesCustomCompressedCase()
                         COMPRESS_SIZE_FROM_BYTE(psBucket->u.panSectorSize[k]);
             }
 
-            VSIFSeekL(m_fpNodes, psBucket->nOff + nOffFromBucketStart,
-                      SEEK_SET);
+            const GIntBig nSectorOffset = psBucket->nOff + nOffFromBucketStart;
             if (nSectorSize == SECTOR_SIZE)
             {
-                if (VSIFReadL(m_pabySector, 1, static_cast<size_t>(SECTOR_SIZE),
-                              m_fpNodes) != static_cast<size_t>(SECTOR_SIZE))
+                if (!ReadNodesFile(nSectorOffset,
+                                   static_cast<size_t>(SECTOR_SIZE),
+                                   m_pabySector))
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
                              "Cannot read node " CPL_FRMT_GIB, id);
@@ -1136,8 +1239,9 @@ void OGROSMDataSource::LookupNodesCustomCompressedCase()
             }
             else
             {
-                if (static_cast<int>(VSIFReadL(abyRawSector, 1, nSectorSize,
-                                               m_fpNodes)) != nSectorSize)
+                if (!ReadNodesFile(nSectorOffset,
+                                   static_cast<size_t>(nSectorSize),
+                                   abyRawSector))
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
                              "Cannot read sector for node " CPL_FRMT_GIB, id);
@@ -1186,6 +1290,10 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
     const int knDISK_SECTOR_SIZE = 4096;
     CPL_STATIC_ASSERT((knDISK_SECTOR_SIZE % SECTOR_SIZE) == 0);
     GByte abyDiskSector[knDISK_SECTOR_SIZE];
+    // When the content of the nodes file is directly accessible, point into
+    // it instead of reading into abyDiskSector.
+    const GByte *pabyNodesFileData = GetNodesFileData();
+    const GByte *pabyDiskSector = abyDiskSector;
     // Offset in the nodes files for which abyDiskSector was read
     GIntBig nOldOffset = -knDISK_SECTOR_SIZE - 1;
     // Number of valid bytes in abyDiskSector
@@ -1251,9 +1359,20 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
             // Align on 4096 boundary to be glibc caching friendly
             const GIntBig nAlignedNewPos =
                 nNewOffset & ~(static_cast<GIntBig>(knDISK_SECTOR_SIZE) - 1);
-            VSIFSeekL(m_fpNodes, nAlignedNewPos, SEEK_SET);
-            nValidBytes =
-                VSIFReadL(abyDiskSector, 1, knDISK_SECTOR_SIZE, m_fpNodes);
+            if (pabyNodesFileData)
+            {
+                pabyDiskSector =
+                    pabyNodesFileData + static_cast<size_t>(nAlignedNewPos);
+                nValidBytes = static_cast<size_t>(std::min<GIntBig>(
+                    knDISK_SECTOR_SIZE,
+                    std::max<GIntBig>(0, m_nNodesFileSize - nAlignedNewPos)));
+            }
+            else
+            {
+                VSIFSeekL(m_fpNodes, nAlignedNewPos, SEEK_SET);
+                nValidBytes =
+                    VSIFReadL(abyDiskSector, 1, knDISK_SECTOR_SIZE, m_fpNodes);
+            }
             nOldOffset = nAlignedNewPos;
         }
 
@@ -1267,7 +1386,7 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
                      "Cannot read node " CPL_FRMT_GIB, id);
             continue;
         }
-        memcpy(&m_pasLonLatArray[j], abyDiskSector + nOffsetInDiskSector,
+        memcpy(&m_pasLonLatArray[j], pabyDiskSector + nOffsetInDiskSector,
                sizeof(LonLat));
 
         m_panReqIds[j] = id;
@@ -1579,7 +1698,7 @@ void OGROSMDataSource::IndexWay(GIntBig nWayID, bool bIsArea,
 /*                              FindNode()                              */
 /************************************************************************/
 
-int OGROSMDataSource::FindNode(GIntBig nID)
+int OGROSMDataSource::FindNode(GIntBig nID) const
 {
     if (m_nReqIds == 0)
         return -1;
@@ -1599,87 +1718,171 @@ int OGROSMDataSource::FindNode(GIntBig nID)
 }
 
 /************************************************************************/
-/*                         ProcessWaysBatch()                           */
+/*                          ResolveWayNodes()                           */
 /************************************************************************/
 
-void OGROSMDataSource::ProcessWaysBatch()
+/** Fill asLonLat with the coordinates of the nodes of sWayFeaturePair that
+ * have been found by LookupNodes(). Only reads state, so it can be called
+ * concurrently for different ways.
+ */
+void OGROSMDataSource::ResolveWayNodes(const WayFeaturePair &sWayFeaturePair,
+                                       std::vector<LonLat> &asLonLat) const
 {
-    if (m_asWayFeaturePairs.empty())
-        return;
-
-    // printf("nodes = %d, features = %d\n", nUnsortedReqIds, int(m_asWayFeaturePairs.size()));
-    LookupNodes();
-
-    for (WayFeaturePair &sWayFeaturePairs : m_asWayFeaturePairs)
-    {
-        const bool bIsArea = sWayFeaturePairs.bIsArea;
-        m_asLonLatCache.clear();
+    asLonLat.clear();
 
 #ifdef ENABLE_NODE_LOOKUP_BY_HASHING
-        if (m_bHashedIndexValid)
+    if (m_bHashedIndexValid)
+    {
+        for (unsigned int i = 0; i < sWayFeaturePair.nRefs; i++)
         {
-            for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
+            int nIndInHashArray = static_cast<int>(
+                HASH_ID_FUNC(sWayFeaturePair.panNodeRefs[i]) %
+                HASHED_INDEXES_ARRAY_SIZE);
+            int nIdx = m_panHashedIndexes[nIndInHashArray];
+            if (nIdx < -1)
             {
-                int nIndInHashArray = static_cast<int>(
-                    HASH_ID_FUNC(sWayFeaturePairs.panNodeRefs[i]) %
-                    HASHED_INDEXES_ARRAY_SIZE);
-                int nIdx = m_panHashedIndexes[nIndInHashArray];
-                if (nIdx < -1)
+                int iBucket = -nIdx - 2;
+                while (true)
                 {
-                    int iBucket = -nIdx - 2;
-                    while (true)
+                    nIdx = m_psCollisionBuckets[iBucket].nInd;
+                    if (m_panReqIds[nIdx] == sWayFeaturePair.panNodeRefs[i])
+                        break;
+                    iBucket = m_psCollisionBuckets[iBucket].nNext;
+                    if (iBucket < 0)
                     {
-                        nIdx = m_psCollisionBuckets[iBucket].nInd;
-                        if (m_panReqIds[nIdx] ==
-                            sWayFeaturePairs.panNodeRefs[i])
-                            break;
-                        iBucket = m_psCollisionBuckets[iBucket].nNext;
-                        if (iBucket < 0)
-                        {
-                            nIdx = -1;
-                            break;
-                        }
+                        nIdx = -1;
+                        break;
                     }
                 }
-                else if (nIdx >= 0 &&
-                         m_panReqIds[nIdx] != sWayFeaturePairs.panNodeRefs[i])
-                    nIdx = -1;
+            }
+            else if (nIdx >= 0 &&
+                     m_panReqIds[nIdx] != sWayFeaturePair.panNodeRefs[i])
+                nIdx = -1;
 
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+            if (nIdx >= 0)
+            {
+                asLonLat.push_back(m_pasLonLatArray[nIdx]);
             }
         }
-        else
+    }
+    else
 #endif  // ENABLE_NODE_LOOKUP_BY_HASHING
+    {
+        int nIdx = -1;
+        for (unsigned int i = 0; i < sWayFeaturePair.nRefs; i++)
         {
-            int nIdx = -1;
-            for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
+            if (nIdx >= 0 && sWayFeaturePair.panNodeRefs[i] ==
+                                 sWayFeaturePair.panNodeRefs[i - 1] + 1)
             {
-                if (nIdx >= 0 && sWayFeaturePairs.panNodeRefs[i] ==
-                                     sWayFeaturePairs.panNodeRefs[i - 1] + 1)
-                {
-                    if (static_cast<unsigned>(nIdx + 1) < m_nReqIds &&
-                        m_panReqIds[nIdx + 1] ==
-                            sWayFeaturePairs.panNodeRefs[i])
-                        nIdx++;
-                    else
-                        nIdx = -1;
-                }
+                if (static_cast<unsigned>(nIdx + 1) < m_nReqIds &&
+                    m_panReqIds[nIdx + 1] == sWayFeaturePair.panNodeRefs[i])
+                    nIdx++;
                 else
-                    nIdx = FindNode(sWayFeaturePairs.panNodeRefs[i]);
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+                    nIdx = -1;
+            }
+            else
+                nIdx = FindNode(sWayFeaturePair.panNodeRefs[i]);
+            if (nIdx >= 0)
+            {
+                asLonLat.push_back(m_pasLonLatArray[nIdx]);
             }
         }
+    }
 
-        if (!m_asLonLatCache.empty() && bIsArea)
+    if (!asLonLat.empty() && sWayFeaturePair.bIsArea)
+    {
+        asLonLat.push_back(asLonLat[0]);
+    }
+}
+
+/************************************************************************/
+/*                          ResolveWaysNodes()                          */
+/************************************************************************/
+
+/** Resolve the node coordinates of the ways of m_asWayFeaturePairs in the
+ * [iStart, iEnd[ range into m_aasWaysLonLat, and attach their line string
+ * geometry to their feature, if any.
+ */
+void OGROSMDataSource::ResolveWaysNodes(size_t iStart, size_t iEnd)
+{
+    for (size_t iWay = iStart; iWay < iEnd; ++iWay)
+    {
+        WayFeaturePair &sWayFeaturePairs = m_asWayFeaturePairs[iWay];
+        std::vector<LonLat> &asLonLat = m_aasWaysLonLat[iWay];
+        ResolveWayNodes(sWayFeaturePairs, asLonLat);
+
+        if (asLonLat.size() < 2 || sWayFeaturePairs.poFeature == nullptr)
+            continue;
+
+        OGRLineString *poLS = new OGRLineString();
+        const int nPoints = static_cast<int>(asLonLat.size());
+        poLS->setNumPoints(nPoints, /*bZeroizeNewContent=*/false);
+        for (int i = 0; i < nPoints; i++)
         {
-            m_asLonLatCache.push_back(m_asLonLatCache[0]);
+            poLS->setPoint(i, INT_TO_DBL(asLonLat[i].nLon),
+                           INT_TO_DBL(asLonLat[i].nLat));
         }
+        sWayFeaturePairs.poFeature->SetGeometryDirectly(poLS);
+    }
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+int OGROSMDataSource::GetNumThreads()
+{
+    if (m_nNumThreads < 0)
+    {
+        m_nNumThreads = CPLParseNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"), 128);
+    }
+    return m_nNumThreads;
+}
+
+/************************************************************************/
+/*                         ProcessWaysBatch()                           */
+/************************************************************************/
+
+void OGROSMDataSource::ProcessWaysBatch()
+{
+    if (m_asWayFeaturePairs.empty())
+        return;
+
+    // printf("nodes = %d, features = %d\n", nUnsortedReqIds, int(m_asWayFeaturePairs.size()));
+    LookupNodes();
+
+    // Resolve node coordinates and build line strings, possibly in parallel,
+    // before the sequential indexing of ways and emission of features.
+    const size_t nWays = m_asWayFeaturePairs.size();
+    m_aasWaysLonLat.resize(nWays);
+    constexpr size_t WAYS_PER_THREAD = 1000;
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        GetNumThreads(), (nWays + WAYS_PER_THREAD - 1) / WAYS_PER_THREAD));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        const size_t nWaysPerJob = (nWays + nThreads - 1) / nThreads;
+        for (size_t iStart = 0; iStart < nWays; iStart += nWaysPerJob)
+        {
+            const size_t iEnd = std::min(nWays, iStart + nWaysPerJob);
+            poJobQueue->SubmitJob([this, iStart, iEnd]()
+                                  { ResolveWaysNodes(iStart, iEnd); });
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        ResolveWaysNodes(0, nWays);
+    }
+
+    for (size_t iWay = 0; iWay < nWays; ++iWay)
+    {
+        WayFeaturePair &sWayFeaturePairs = m_asWayFeaturePairs[iWay];
+        const bool bIsArea = sWayFeaturePairs.bIsArea;
+        std::swap(m_asLonLatCache, m_aasWaysLonLat[iWay]);
 
         if (m_asLonLatCache.size() < 2)
         {
@@ -1711,19 +1914,7 @@ void OGROSMDataSource::ProcessWaysBatch()
             continue;
         }
 
-        OGRLineString *poLS = new OGRLineString();
-        OGRGeometry *poGeom = poLS;
-
         const int nPoints = static_cast<int>(m_asLonLatCache.size());
-        poLS->setNumPoints(nPoints, /*bZeroizeNewContent=*/false);
-        for (int i = 0; i < nPoints; i++)
-        {
-            poLS->setPoint(i, INT_TO_DBL(m_asLonLatCache[i].nLon),
-                           INT_TO_DBL(m_asLonLatCache[i].nLat));
-        }
-
-        sWayFeaturePairs.poFeature->SetGeometryDirectly(poGeom);
-
         if (m_asLonLatCache.size() != sWayFeaturePairs.nRefs)
             CPLDebug("OSM",
                      "For way " CPL_FRMT_GIB
@@ -2741,6 +2932,8 @@ int OGROSMDataSource::Open(const char *pszFilename,
                              CPLGetConfigOption("OSM_COMPRESS_NODES", "NO")));
     if (m_bCompressNodes)
         CPLDebug("OSM", "Using compression for nodes DB");
+    m_bMapNodesFile =
+        CPLTestBool(CPLGetConfigOption("OSM_MMAP_NODES_FILE", "YES"));
 
     // Do not change the below order without updating the IDX_LYR_ constants!
     m_apoLayers.emplace_back(
@@ -3854,6 +4047,7 @@ int OGROSMDataSource::MyResetReading()
         m_nBucketOld = -1;
         m_nOffInBucketReducedOld = -1;
 
+        ReleaseNodesFileMapping();
         VSIFSeekL(m_fpNodes, 0, SEEK_SET);
         VSIFTruncateL(m_fpNodes, 0);
         m_nNodesFileSize = 0;
@@ -4068,6 +4262,7 @@ bool OGROSMDataSource::TransferToDiskIfNecesserary()
         {
             m_bInMemoryNodesFile = false;
 
+            ReleaseNodesFileMapping();
             VSIFCloseL(m_fpNodes);
             m_fpNodes = nullptr;
 
@@ -29,6 +29,7 @@
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/array/array_dict.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/base64.h"
@@ -42,6 +43,10 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/parquet_version.h"
+#if PARQUET_VERSION_MAJOR >= 12
+#include "parquet/page_index.h"
+#endif
 
 #ifdef GDAL_USE_ARROWDATASET
 #include "arrow/filesystem/filesystem.h"
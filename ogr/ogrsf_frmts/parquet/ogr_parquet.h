@@ -43,8 +43,6 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     CPLStringList m_aosGeomPossibleNames{};
     std::string m_osCRS{};
 
-    static int GetNumCPUs();
-
     void LoadGeoMetadata(
         const std::shared_ptr<const arrow::KeyValueMetadata> &kv_metadata);
     bool DealWithGeometryColumn(
@@ -66,6 +64,8 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     void ResetReading() override;
 
     GDALDataset *GetDataset() override;
+
+    static int GetNumCPUs();
 };
 
 /************************************************************************/
@@ -117,6 +117,9 @@ class OGRParquetLayer final : public OGRParquetLayerBase
         const std::map<std::string, int> &oMapParquetColumnNameToIdx);
     bool CreateRecordBatchReader(int iStartingRowGroup);
     bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
+    bool IsRowGroupPossibleFromPageIndex(int iRowGroup, int iXMinField,
+                                         int iYMinField, int iXMaxField,
+                                         int iYMaxField) const;
     bool ReadNextBatch() override;
 
     void InvalidateCachedBatches() override;
@@ -327,6 +330,11 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     OGRLayer *m_poTmpGPKGLayer = nullptr;
     //! Number of features written by ICreateFeature(). Only used in SORT_BY_BBOX mode
     GIntBig m_nTmpFeatureCount = 0;
+    //! Whether features are sorted along a Hilbert curve rather than with
+    //! the RTree. Only used in SORT_BY_BBOX mode
+    bool m_bSortByHilbertCurve = false;
+    //! Whether the columns of a row group are encoded in parallel
+    bool m_bUseThreads = false;
 
     virtual bool IsFileWriterCreated() const override
     {
@@ -362,6 +370,7 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     //! Copy temporary GeoPackage layer to final Parquet file
     bool CopyTmpGpkgLayerToFinalFile();
+    bool CopyTmpGpkgFeaturesInHilbertOrder(OGRFeature &oFeat);
 
   public:
     OGRParquetWriterLayer(
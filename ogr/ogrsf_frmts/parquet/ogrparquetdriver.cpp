@@ -449,20 +449,55 @@ static GDALDataset *OGRParquetDriverOpen(GDALOpenInfo *poOpenInfo)
         std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
         auto poMemoryPool = std::shared_ptr<arrow::MemoryPool>(
             arrow::MemoryPool::CreateDefault().release());
-#if ARROW_VERSION_MAJOR >= 19
-        PARQUET_ASSIGN_OR_THROW(
-            arrow_reader,
-            parquet::arrow::OpenFile(std::move(infile), poMemoryPool.get()));
-#else
-        auto st = parquet::arrow::OpenFile(std::move(infile),
-                                           poMemoryPool.get(), &arrow_reader);
-        if (!st.ok())
+
+        // On network file systems, pre-buffer the column chunks of the
+        // selected row groups, so that the next ones are fetched concurrently
+        // while the current one is decoded.
+        const bool bPreBuffer = CPLTestBool(
+            CPLGetConfigOption("OGR_PARQUET_PRE_BUFFER",
+                               VSIIsLocal(osFilename.c_str()) ? "NO" : "YES"));
+        if (bPreBuffer)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "parquet::arrow::OpenFile() failed");
-            return nullptr;
+            parquet::arrow::FileReaderBuilder oBuilder;
+            PARQUET_THROW_NOT_OK(oBuilder.Open(std::move(infile)));
+
+            parquet::ArrowReaderProperties oArrowReaderProperties =
+                parquet::default_arrow_reader_properties();
+            oArrowReaderProperties.set_pre_buffer(true);
+            auto oCacheOptions = arrow::io::CacheOptions::LazyDefaults();
+#if ARROW_VERSION_MAJOR >= 8
+            // The prefetch limit is expressed as a number of (coalesced)
+            // ranges, that is roughly one per column chunk.
+            const int nPrefetchRowGroups = std::max(
+                0, atoi(CPLGetConfigOption("OGR_PARQUET_PREFETCH_ROW_GROUPS",
+                                           "1")));
+            oCacheOptions.prefetch_limit =
+                static_cast<int64_t>(nPrefetchRowGroups) *
+                oBuilder.raw_reader()->metadata()->num_columns();
+#endif
+            oArrowReaderProperties.set_cache_options(oCacheOptions);
+
+            oBuilder.memory_pool(poMemoryPool.get())
+                ->properties(oArrowReaderProperties);
+            PARQUET_THROW_NOT_OK(oBuilder.Build(&arrow_reader));
         }
+        else
+        {
+#if ARROW_VERSION_MAJOR >= 19
+            PARQUET_ASSIGN_OR_THROW(arrow_reader,
+                                    parquet::arrow::OpenFile(
+                                        std::move(infile), poMemoryPool.get()));
+#else
+            auto st = parquet::arrow::OpenFile(
+                std::move(infile), poMemoryPool.get(), &arrow_reader);
+            if (!st.ok())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "parquet::arrow::OpenFile() failed");
+                return nullptr;
+            }
 #endif
+        }
 
         auto poDS = std::make_unique<OGRParquetDataset>(poMemoryPool);
         auto poLayer = std::make_unique<OGRParquetLayer>(
@@ -706,6 +741,18 @@ void OGRParquetDriver::InitMetadata()
                                    "the bounding box of their geometries");
     }
 
+    {
+        auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psOption, "name", "SORT_BY_BBOX_METHOD");
+        CPLAddXMLAttributeAndValue(psOption, "type", "string-select");
+        CPLAddXMLAttributeAndValue(psOption, "default", "RTREE");
+        CPLAddXMLAttributeAndValue(psOption, "description",
+                                   "Method used to sort features when "
+                                   "SORT_BY_BBOX=YES");
+        CPLCreateXMLElementAndValue(psOption, "Value", "RTREE");
+        CPLCreateXMLElementAndValue(psOption, "Value", "HILBERT");
+    }
+
     char *pszXML = CPLSerializeXMLTree(oTree.get());
     GDALDriver::SetMetadataItem(GDAL_DS_LAYER_CREATIONOPTIONLIST, pszXML);
     CPLFree(pszXML);
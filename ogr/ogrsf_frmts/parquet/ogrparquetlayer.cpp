@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
@@ -1400,6 +1401,325 @@ static IsConstraintPossibleRes IsConstraintPossible(int nOperation, T v, T min,
     return IsConstraintPossibleRes::YES;
 }
 
+#if PARQUET_VERSION_MAJOR >= 12
+
+//! Ranges of [first, last] row indices within a row group
+typedef std::vector<std::pair<int64_t, int64_t>> ParquetRowRanges;
+
+/************************************************************************/
+/*                      IntersectParquetRowRanges()                     */
+/************************************************************************/
+
+static ParquetRowRanges IntersectParquetRowRanges(const ParquetRowRanges &a,
+                                                  const ParquetRowRanges &b)
+{
+    ParquetRowRanges res;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() && j < b.size())
+    {
+        const int64_t nFirst = std::max(a[i].first, b[j].first);
+        const int64_t nLast = std::min(a[i].second, b[j].second);
+        if (nFirst <= nLast)
+            res.emplace_back(nFirst, nLast);
+        if (a[i].second < b[j].second)
+            ++i;
+        else
+            ++j;
+    }
+    return res;
+}
+
+/************************************************************************/
+/*                    GetPageIndexRowRangesTyped()                      */
+/************************************************************************/
+
+/** Collect in aoRanges the row ranges of the non-null pages of a column chunk
+ * for which pfnIsPagePossible(page_min, page_max) returns true.
+ */
+template <class DType, class T>
+static bool GetPageIndexRowRangesTyped(
+    const parquet::ColumnIndex &oColumnIndex,
+    const parquet::OffsetIndex &oOffsetIndex, int64_t nRowGroupRows,
+    const std::function<bool(T, T)> &pfnIsPagePossible,
+    ParquetRowRanges &aoRanges)
+{
+    const auto &oTypedIndex =
+        static_cast<const parquet::TypedColumnIndex<DType> &>(oColumnIndex);
+    const auto &abNullPages = oTypedIndex.null_pages();
+    const auto &aMinValues = oTypedIndex.min_values();
+    const auto &aMaxValues = oTypedIndex.max_values();
+    const auto &anNonNullPageIndices = oTypedIndex.non_null_page_indices();
+    const auto &aoPageLocations = oOffsetIndex.page_locations();
+    if (aoPageLocations.size() != abNullPages.size() ||
+        aMinValues.size() != aMaxValues.size())
+    {
+        return false;
+    }
+    // Depending on the libparquet version, min/max values are indexed either
+    // by page or by non-null page.
+    const bool bIndexedByPage = aMinValues.size() == abNullPages.size();
+
+    aoRanges.clear();
+    for (size_t i = 0; i < anNonNullPageIndices.size(); ++i)
+    {
+        const size_t iPage = anNonNullPageIndices[i];
+        const size_t iVal = bIndexedByPage ? iPage : i;
+        if (iPage >= aoPageLocations.size() || iVal >= aMinValues.size())
+            return false;
+        const T minVal = static_cast<T>(aMinValues[iVal]);
+        const T maxVal = static_cast<T>(aMaxValues[iVal]);
+        if (!std::isnan(static_cast<double>(minVal)) &&
+            !std::isnan(static_cast<double>(maxVal)) &&
+            !pfnIsPagePossible(minVal, maxVal))
+        {
+            continue;
+        }
+        const int64_t nFirst = aoPageLocations[iPage].first_row_index;
+        const int64_t nLast =
+            iPage + 1 < aoPageLocations.size()
+                ? aoPageLocations[iPage + 1].first_row_index - 1
+                : nRowGroupRows - 1;
+        if (!aoRanges.empty() && aoRanges.back().second + 1 >= nFirst)
+            aoRanges.back().second = std::max(aoRanges.back().second, nLast);
+        else
+            aoRanges.emplace_back(nFirst, nLast);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GetPageIndexRowRanges()                        */
+/************************************************************************/
+
+/** Return the row ranges of a column chunk that may satisfy
+ * pfnIsPagePossible, or false if that cannot be determined from the page
+ * index.
+ */
+template <class T>
+static bool
+GetPageIndexRowRanges(parquet::RowGroupPageIndexReader *poPageIndexReader,
+                      const parquet::SchemaDescriptor *poParquetSchema,
+                      int iCol, int64_t nRowGroupRows,
+                      const std::function<bool(T, T)> &pfnIsPagePossible,
+                      ParquetRowRanges &aoRanges)
+{
+    const auto parquetColumn = poParquetSchema->Column(iCol);
+    const auto &logicalType = parquetColumn->logical_type();
+    if (logicalType && !logicalType->is_none() &&
+        !(logicalType->is_int() &&
+          static_cast<const parquet::IntLogicalType *>(logicalType.get())
+              ->is_signed()))
+    {
+        return false;
+    }
+
+    try
+    {
+        const auto poColumnIndex = poPageIndexReader->GetColumnIndex(iCol);
+        const auto poOffsetIndex = poPageIndexReader->GetOffsetIndex(iCol);
+        if (!poColumnIndex || !poOffsetIndex)
+            return false;
+
+        switch (parquetColumn->physical_type())
+        {
+            case parquet::Type::INT32:
+                return GetPageIndexRowRangesTyped<parquet::Int32Type>(
+                    *poColumnIndex, *poOffsetIndex, nRowGroupRows,
+                    pfnIsPagePossible, aoRanges);
+            case parquet::Type::INT64:
+                return GetPageIndexRowRangesTyped<parquet::Int64Type>(
+                    *poColumnIndex, *poOffsetIndex, nRowGroupRows,
+                    pfnIsPagePossible, aoRanges);
+            case parquet::Type::FLOAT:
+                return GetPageIndexRowRangesTyped<parquet::FloatType>(
+                    *poColumnIndex, *poOffsetIndex, nRowGroupRows,
+                    pfnIsPagePossible, aoRanges);
+            case parquet::Type::DOUBLE:
+                return GetPageIndexRowRangesTyped<parquet::DoubleType>(
+                    *poColumnIndex, *poOffsetIndex, nRowGroupRows,
+                    pfnIsPagePossible, aoRanges);
+            default:
+                break;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLDebug("PARQUET", "Cannot read page index of column %d: %s", iCol,
+                 e.what());
+    }
+    return false;
+}
+
+#endif  // PARQUET_VERSION_MAJOR >= 12
+
+/************************************************************************/
+/*                   IsRowGroupPossibleFromPageIndex()                  */
+/************************************************************************/
+
+/** Use the page index (column index and offset index) of a row group, when
+ * present, to determine whether there is at least one range of rows for which
+ * all the spatial and attribute filter constraints may be satisfied.
+ *
+ * This is finer grained than the row group statistics, since each column
+ * chunk is split into pages with their own min/max values, and the candidate
+ * row ranges of the different columns are intersected.
+ *
+ * Returns false only if it is certain that no row of the group may match.
+ */
+bool OGRParquetLayer::IsRowGroupPossibleFromPageIndex(
+    [[maybe_unused]] int iRowGroup, [[maybe_unused]] int iXMinField,
+    [[maybe_unused]] int iYMinField, [[maybe_unused]] int iXMaxField,
+    [[maybe_unused]] int iYMaxField) const
+{
+#if PARQUET_VERSION_MAJOR >= 12
+    auto poParquetReader = m_poArrowReader->parquet_reader();
+    const auto metadata = poParquetReader->metadata();
+    const int64_t nRowGroupRows = metadata->RowGroup(iRowGroup)->num_rows();
+    if (nRowGroupRows <= 0)
+        return true;
+    const auto poParquetSchema = metadata->schema();
+
+    std::shared_ptr<parquet::RowGroupPageIndexReader> poPageIndexReader;
+    try
+    {
+        auto poFilePageIndexReader = poParquetReader->GetPageIndexReader();
+        if (poFilePageIndexReader)
+            poPageIndexReader = poFilePageIndexReader->RowGroup(iRowGroup);
+    }
+    catch (const std::exception &e)
+    {
+        CPLDebug("PARQUET", "Cannot read page index of row group %d: %s",
+                 iRowGroup, e.what());
+    }
+    if (!poPageIndexReader)
+        return true;
+
+    ParquetRowRanges aoCandidateRanges{{0, nRowGroupRows - 1}};
+    ParquetRowRanges aoColumnRanges;
+
+    using DoublePredicate = std::function<bool(double, double)>;
+    using Int64Predicate = std::function<bool(int64_t, int64_t)>;
+
+    if (m_poFilterGeom && iXMinField >= 0 && iYMinField >= 0 &&
+        iXMaxField >= 0 && iYMaxField >= 0)
+    {
+        const OGREnvelope sEnv(m_sFilterEnvelope);
+        std::vector<std::pair<int, DoublePredicate>> aoChecks;
+        if (iXMinField == iXMaxField)
+        {
+            aoChecks.emplace_back(
+                iXMinField, [sEnv](double dfMin, double dfMax)
+                { return dfMin <= sEnv.MaxX && dfMax >= sEnv.MinX; });
+        }
+        else
+        {
+            aoChecks.emplace_back(iXMinField, [sEnv](double dfMin, double)
+                                  { return dfMin <= sEnv.MaxX; });
+            aoChecks.emplace_back(iXMaxField, [sEnv](double, double dfMax)
+                                  { return dfMax >= sEnv.MinX; });
+        }
+        if (iYMinField == iYMaxField)
+        {
+            aoChecks.emplace_back(
+                iYMinField, [sEnv](double dfMin, double dfMax)
+                { return dfMin <= sEnv.MaxY && dfMax >= sEnv.MinY; });
+        }
+        else
+        {
+            aoChecks.emplace_back(iYMinField, [sEnv](double dfMin, double)
+                                  { return dfMin <= sEnv.MaxY; });
+            aoChecks.emplace_back(iYMaxField, [sEnv](double, double dfMax)
+                                  { return dfMax >= sEnv.MinY; });
+        }
+
+        for (const auto &[iCol, pfnIsPagePossible] : aoChecks)
+        {
+            if (GetPageIndexRowRanges<double>(
+                    poPageIndexReader.get(), poParquetSchema, iCol,
+                    nRowGroupRows, pfnIsPagePossible, aoColumnRanges))
+            {
+                aoCandidateRanges = IntersectParquetRowRanges(
+                    aoCandidateRanges, aoColumnRanges);
+                if (aoCandidateRanges.empty())
+                    return false;
+            }
+        }
+    }
+
+    for (const auto &constraint : m_asAttributeFilterConstraints)
+    {
+        int iOGRField = constraint.iField;
+        if (constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID)
+        {
+            iOGRField = OGR_FID_INDEX;
+        }
+        const int iCol = iOGRField == OGR_FID_INDEX
+                             ? m_iFIDParquetColumn
+                             : m_anMapFieldIndexToParquetColumn[iOGRField];
+        if (iCol < 0)
+            continue;
+
+        const int nOperation = constraint.nOperation;
+        bool bOK = false;
+        if (nOperation == SWQ_ISNOTNULL)
+        {
+            bOK = GetPageIndexRowRanges<double>(
+                poPageIndexReader.get(), poParquetSchema, iCol, nRowGroupRows,
+                DoublePredicate([](double, double) { return true; }),
+                aoColumnRanges);
+        }
+        else if (nOperation == SWQ_ISNULL)
+        {
+            continue;
+        }
+        else if (constraint.eType == OGRArrowLayer::Constraint::Type::Integer ||
+                 constraint.eType ==
+                     OGRArrowLayer::Constraint::Type::Integer64)
+        {
+            const int64_t nVal =
+                constraint.eType == OGRArrowLayer::Constraint::Type::Integer
+                    ? static_cast<int64_t>(constraint.sValue.Integer)
+                    : static_cast<int64_t>(constraint.sValue.Integer64);
+            bOK = GetPageIndexRowRanges<int64_t>(
+                poPageIndexReader.get(), poParquetSchema, iCol, nRowGroupRows,
+                Int64Predicate(
+                    [nOperation, nVal](int64_t nMin, int64_t nMax)
+                    {
+                        return IsConstraintPossible(nOperation, nVal, nMin,
+                                                    nMax) !=
+                               IsConstraintPossibleRes::NO;
+                    }),
+                aoColumnRanges);
+        }
+        else if (constraint.eType == OGRArrowLayer::Constraint::Type::Real)
+        {
+            const double dfVal = constraint.sValue.Real;
+            bOK = GetPageIndexRowRanges<double>(
+                poPageIndexReader.get(), poParquetSchema, iCol, nRowGroupRows,
+                DoublePredicate(
+                    [nOperation, dfVal](double dfMin, double dfMax)
+                    {
+                        return IsConstraintPossible(nOperation, dfVal, dfMin,
+                                                    dfMax) !=
+                               IsConstraintPossibleRes::NO;
+                    }),
+                aoColumnRanges);
+        }
+
+        if (bOK)
+        {
+            aoCandidateRanges =
+                IntersectParquetRowRanges(aoCandidateRanges, aoColumnRanges);
+            if (aoCandidateRanges.empty())
+                return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
 /************************************************************************/
 /*                           IncrFeatureIdx()                           */
 /************************************************************************/
@@ -1489,6 +1809,10 @@ bool OGRParquetLayer::ReadNextBatch()
             int iXMaxField = -1;
             int iYMaxField = -1;
 
+            const bool bUsePageIndex = CPLTestBool(
+                CPLGetConfigOption("OGR_PARQUET_USE_PAGE_INDEX", "YES"));
+            int nRowGroupsSkippedByPageIndex = 0;
+
             if (bIsGeoArrowStruct)
             {
                 const auto metadata =
@@ -1758,6 +2082,15 @@ bool OGRParquetLayer::ReadNextBatch()
                     }
                 }
 
+                if (bSelectGroup && !bIterateEverything && bUsePageIndex &&
+                    !IsRowGroupPossibleFromPageIndex(iRowGroup, iXMinField,
+                                                     iYMinField, iXMaxField,
+                                                     iYMaxField))
+                {
+                    bSelectGroup = false;
+                    ++nRowGroupsSkippedByPageIndex;
+                }
+
                 if (bSelectGroup)
                 {
                     // CPLDebug("PARQUET", "Selecting row group %d", iRowGroup);
@@ -1769,6 +2102,12 @@ bool OGRParquetLayer::ReadNextBatch()
 
                 nFeatureIdxTotal += poRowGroup->metadata()->num_rows();
             }
+
+            if (nRowGroupsSkippedByPageIndex > 0 && !bIterateEverything)
+            {
+                CPLDebug("PARQUET", "%d row group(s) skipped using page index",
+                         nRowGroupsSkippedByPageIndex);
+            }
         }
 
         if (bIterateEverything)
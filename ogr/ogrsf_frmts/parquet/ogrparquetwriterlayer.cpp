@@ -23,6 +23,7 @@
 
 #include "ogr_wkb.h"
 
+#include <algorithm>
 #include <utility>
 
 /************************************************************************/
@@ -121,6 +122,9 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
         }
     }
 
+    if (m_bSortByHilbertCurve)
+        return CopyTmpGpkgFeaturesInHilbertOrder(oFeat);
+
     // Now walk through the GPKG RTree for features with geometries
     // Cf https://github.com/sqlite/sqlite/blob/master/ext/rtree/rtree.c
     // for the description of the content of the rtree _node table
@@ -279,6 +283,154 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
     return true;
 }
 
+/************************************************************************/
+/*                          HilbertIndex()                              */
+/************************************************************************/
+
+// Index of (nX, nY) along a Hilbert curve covering [0, 2^31[ x [0, 2^31[,
+// hence in [0, 2^62[
+static int64_t HilbertIndex(uint32_t nX, uint32_t nY)
+{
+    uint64_t nIdx = 0;
+    for (uint32_t s = 1U << 30; s > 0; s >>= 1)
+    {
+        const uint32_t rx = (nX & s) ? 1 : 0;
+        const uint32_t ry = (nY & s) ? 1 : 0;
+        nIdx += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                nX = ~nX;
+                nY = ~nY;
+            }
+            std::swap(nX, nY);
+        }
+    }
+    return static_cast<int64_t>(nIdx);
+}
+
+/************************************************************************/
+/*                 CopyTmpGpkgFeaturesInHilbertOrder()                  */
+/************************************************************************/
+
+/** Write the features with geometries of the temporary GeoPackage layer in
+ * the order of the Hilbert index of the center of their bounding box.
+ *
+ * The Hilbert indices are stored in a table of the temporary GeoPackage, so
+ * that sorting them is done by SQLite, possibly spilling to temporary files,
+ * and is thus not limited by the available RAM.
+ */
+bool OGRParquetWriterLayer::CopyTmpGpkgFeaturesInHilbertOrder(
+    OGRFeature &oFeat)
+{
+    OGREnvelope sExtent;
+    if (m_poTmpGPKGLayer->GetExtent(&sExtent, true) != OGRERR_NONE)
+    {
+        // No feature with a geometry
+        return true;
+    }
+
+    auto poKeysLayer =
+        m_poTmpGPKG->CreateLayer("hilbert_keys", nullptr, wkbNone);
+    if (!poKeysLayer)
+        return false;
+    if (poKeysLayer->CreateField(
+            std::make_unique<OGRFieldDefn>("src_fid", OFTInteger64).get()) !=
+            OGRERR_NONE ||
+        poKeysLayer->CreateField(
+            std::make_unique<OGRFieldDefn>("hilbert_key", OFTInteger64)
+                .get()) != OGRERR_NONE)
+    {
+        return false;
+    }
+
+    constexpr double HILBERT_MAX = static_cast<double>((1U << 31) - 1);
+    const double dfScaleX = sExtent.MaxX > sExtent.MinX
+                                ? HILBERT_MAX / (sExtent.MaxX - sExtent.MinX)
+                                : 0.0;
+    const double dfScaleY = sExtent.MaxY > sExtent.MinY
+                                ? HILBERT_MAX / (sExtent.MaxY - sExtent.MinY)
+                                : 0.0;
+
+    // Compute the Hilbert index of each feature from the bounding box
+    // stored in the RTree.
+    {
+        auto poRTreeLayer = std::unique_ptr<OGRLayer>(
+            m_poTmpGPKG->ExecuteSQL("SELECT id, minx, maxx, miny, maxy FROM "
+                                    "rtree_tmp_geom",
+                                    nullptr, nullptr));
+        if (!poRTreeLayer)
+            return false;
+        OGRFeature oKeyFeat(poKeysLayer->GetLayerDefn());
+        for (const auto &poRTreeFeature : poRTreeLayer.get())
+        {
+            const double dfX = (poRTreeFeature->GetFieldAsDouble(1) +
+                                poRTreeFeature->GetFieldAsDouble(2)) /
+                               2;
+            const double dfY = (poRTreeFeature->GetFieldAsDouble(3) +
+                                poRTreeFeature->GetFieldAsDouble(4)) /
+                               2;
+            const uint32_t nX = static_cast<uint32_t>(std::clamp(
+                (dfX - sExtent.MinX) * dfScaleX, 0.0, HILBERT_MAX));
+            const uint32_t nY = static_cast<uint32_t>(std::clamp(
+                (dfY - sExtent.MinY) * dfScaleY, 0.0, HILBERT_MAX));
+            oKeyFeat.SetFID(OGRNullFID);
+            oKeyFeat.SetField(0, poRTreeFeature->GetFieldAsInteger64(0));
+            oKeyFeat.SetField(1, static_cast<GIntBig>(HilbertIndex(nX, nY)));
+            if (poKeysLayer->CreateFeature(&oKeyFeat) != OGRERR_NONE)
+                return false;
+        }
+    }
+
+    // Interval in terms of features between 2 debug progress report messages
+    constexpr int PROGRESS_FC_INTERVAL = 100 * 1000;
+
+    auto poSortedLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+        "SELECT src_fid FROM hilbert_keys ORDER BY hilbert_key, src_fid",
+        nullptr, nullptr));
+    if (!poSortedLayer)
+        return false;
+    for (const auto &poSortedFeature : poSortedLayer.get())
+    {
+        const GIntBig nFID = poSortedFeature->GetFieldAsInteger64(0);
+        const auto poSrcFeature = std::unique_ptr<const OGRFeature>(
+            m_poTmpGPKGLayer->GetFeature(nFID));
+        if (!poSrcFeature)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot get feature " CPL_FRMT_GIB, nFID);
+            return false;
+        }
+
+        int nBytesFeature = 0;
+        const GByte *pabyFeatureData =
+            poSrcFeature->GetFieldAsBinary(0, &nBytesFeature);
+        if (!oFeat.DeserializeFromBinary(pabyFeatureData, nBytesFeature))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot deserialize feature");
+            return false;
+        }
+        if (OGRArrowWriterLayer::ICreateFeature(&oFeat) != OGRERR_NONE)
+        {
+            return false;
+        }
+
+        if ((m_nFeatureCount % PROGRESS_FC_INTERVAL) == 0)
+        {
+            CPLDebugProgress(
+                "PARQUET",
+                "CopyTmpGpkgLayerToFinalFile(): %.02f%% progress",
+                100.0 * double(m_nFeatureCount) / double(m_nTmpFeatureCount));
+        }
+    }
+
+    CPLDebug("PARQUET",
+             "CopyTmpGpkgLayerToFinalFile(): 100%%, successfully finished");
+    return true;
+}
+
 /************************************************************************/
 /*                       IsSupportedGeometryType()                      */
 /************************************************************************/
@@ -343,7 +495,31 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
             std::make_unique<OGRFieldDefn>("serialized_feature", OFTBinary)
                 .get());
         CPL_IGNORE_RET_VAL(m_poTmpGPKGLayer->StartTransaction());
+
+        const char *pszSortMethod =
+            CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX_METHOD", "RTREE");
+        if (EQUAL(pszSortMethod, "HILBERT"))
+        {
+            m_bSortByHilbertCurve = true;
+        }
+        else if (!EQUAL(pszSortMethod, "RTREE"))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Unsupported value for SORT_BY_BBOX_METHOD: %s",
+                     pszSortMethod);
+            return false;
+        }
+    }
+
+#if PARQUET_VERSION_MAJOR >= 13
+    // Encode and compress the columns of each row group in parallel
+    {
+        const int nNumCPUs = OGRParquetLayerBase::GetNumCPUs();
+        m_bUseThreads =
+            nNumCPUs > 1 && CPLTestBool(CPLGetConfigOption(
+                                "OGR_PARQUET_USE_THREADS", "YES"));
     }
+#endif
 
     const char *pszGeomEncoding =
         CSLFetchNameValue(papszOptions, "GEOMETRY_ENCODING");
@@ -1000,8 +1176,21 @@ void OGRParquetWriterLayer::CreateWriter()
         FinalizeSchema();
     }
 
-    auto arrowWriterProperties =
-        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+    parquet::ArrowWriterProperties::Builder oArrowWriterPropertiesBuilder;
+    oArrowWriterPropertiesBuilder.store_schema();
+#if PARQUET_VERSION_MAJOR >= 13
+    if (m_bUseThreads)
+    {
+        oArrowWriterPropertiesBuilder.set_use_threads(true);
+        // Row groups are then written through WriteRecordBatch(), which
+        // splits them if they exceed max_row_group_length
+        m_oWriterPropertiesBuilder.max_row_group_length(
+            std::max(static_cast<int64_t>(m_nRowGroupSize),
+                     static_cast<int64_t>(
+                         parquet::DEFAULT_MAX_ROW_GROUP_LENGTH)));
+    }
+#endif
+    auto arrowWriterProperties = oArrowWriterPropertiesBuilder.build();
     CPL_IGNORE_RET_VAL(Open(*m_poSchema, m_poMemoryPool, m_poOutputStream,
                             m_oWriterPropertiesBuilder.build(),
                             std::move(arrowWriterProperties), &m_poFileWriter,
@@ -1076,6 +1265,39 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 
 bool OGRParquetWriterLayer::FlushGroup()
 {
+#if PARQUET_VERSION_MAJOR >= 13
+    if (m_bUseThreads)
+    {
+        // Write the row group as a record batch, so that its columns are
+        // encoded and compressed in parallel by the Arrow writer.
+        const int64_t nRows = m_apoBuilders[0]->length();
+        std::vector<std::shared_ptr<arrow::Array>> apoArrays;
+        bool ret = WriteArrays(
+            [&apoArrays](const std::shared_ptr<arrow::Field> &,
+                         const std::shared_ptr<arrow::Array> &array)
+            {
+                apoArrays.push_back(array);
+                return true;
+            });
+        ClearArrayBuilers();
+        if (!ret)
+            return false;
+
+        const auto poBatch =
+            arrow::RecordBatch::Make(m_poSchema, nRows, std::move(apoArrays));
+        auto status = m_poFileWriter->NewBufferedRowGroup();
+        if (status.ok())
+            status = m_poFileWriter->WriteRecordBatch(*poBatch);
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteRecordBatch() failed: %s", status.message().c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
+
     auto status = m_poFileWriter->NewRowGroup(m_apoBuilders[0]->length());
     if (!status.ok())
     {
@@ -193,6 +193,16 @@ class OGRPGLayer CPL_NON_FINAL : public OGRLayer
 
     int nResultOffset = 0;
 
+    // Asynchronous fetching of the next cursor page, while the current one
+    // is being translated into features.
+    bool m_bPrefetchCursorPage = true;
+    bool m_bCursorPageFetchPending = false;
+    PGresult *m_hPrefetchedCursorPage = nullptr;
+
+    PGresult *FetchCursorPage();
+    void CollectPrefetchedCursorPage();
+    void DiscardPrefetchedCursorPage();
+
     int bWkbAsOid = false;
 
     char *pszFIDColumn = nullptr;
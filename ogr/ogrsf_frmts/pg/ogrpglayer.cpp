@@ -62,7 +62,9 @@ PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 /************************************************************************/
 
 OGRPGLayer::OGRPGLayer()
-    : nCursorPage(atoi(CPLGetConfigOption("OGR_PG_CURSOR_PAGE", "500")))
+    : nCursorPage(atoi(CPLGetConfigOption("OGR_PG_CURSOR_PAGE", "500"))),
+      m_bPrefetchCursorPage(
+          CPLTestBool(CPLGetConfigOption("OGR_PG_PREFETCH_CURSOR_PAGE", "YES")))
 {
     pszCursorName = CPLStrdup(CPLSPrintf("OGRPGLayerReader%p", this));
 }
@@ -101,6 +103,8 @@ OGRPGLayer::~OGRPGLayer()
 
 void OGRPGLayer::CloseCursor()
 {
+    DiscardPrefetchedCursorPage();
+
     PGconn *hPGConn = poDS->GetPGConn();
 
     if (hCursorResult != nullptr)
@@ -1491,8 +1495,7 @@ void OGRPGLayer::SetInitialQueryCursor()
     }
     OGRPGClearResult(hCursorResult);
 
-    osCommand.Printf("FETCH %d in %s", nCursorPage, pszCursorName);
-    hCursorResult = OGRPG_PQexec(hPGConn, osCommand);
+    hCursorResult = FetchCursorPage();
 
     CreateMapFromFieldNameToIndex(hCursorResult, poFeatureDefn,
                                   m_panMapFieldNameToIndex,
@@ -1502,15 +1505,82 @@ void OGRPGLayer::SetInitialQueryCursor()
 }
 
 /************************************************************************/
-/*                         GetNextRawFeature()                          */
+/*                          FetchCursorPage()                           */
 /************************************************************************/
 
-OGRFeature *OGRPGLayer::GetNextRawFeature()
-
+/** Return the next page of the cursor, and, if it is a full one, send the
+ * request for the following page without waiting for its result, so that
+ * the server processes it while the current page is being translated into
+ * features.
+ */
+PGresult *OGRPGLayer::FetchCursorPage()
 {
     PGconn *hPGConn = poDS->GetPGConn();
     CPLString osCommand;
+    osCommand.Printf("FETCH %d in %s", nCursorPage, pszCursorName);
+
+    PGresult *hResult = nullptr;
+    CollectPrefetchedCursorPage();
+    if (m_hPrefetchedCursorPage)
+    {
+        hResult = m_hPrefetchedCursorPage;
+        m_hPrefetchedCursorPage = nullptr;
+    }
+    else
+    {
+        hResult = OGRPG_PQexec(hPGConn, osCommand);
+    }
+
+    // Large objects are read from the same connection while translating
+    // records, which is not compatible with a pending query.
+    if (m_bPrefetchCursorPage && !bWkbAsOid && hResult &&
+        PQresultStatus(hResult) == PGRES_TUPLES_OK &&
+        PQntuples(hResult) == nCursorPage)
+    {
+        m_bCursorPageFetchPending = OGRPG_PQsendQuery(
+            hPGConn, osCommand, [this]() { CollectPrefetchedCursorPage(); });
+    }
+
+    return hResult;
+}
+
+/************************************************************************/
+/*                    CollectPrefetchedCursorPage()                     */
+/************************************************************************/
 
+/** Wait for the result of the request sent by FetchCursorPage(), if any,
+ * and store it in m_hPrefetchedCursorPage.
+ */
+void OGRPGLayer::CollectPrefetchedCursorPage()
+{
+    if (m_bCursorPageFetchPending)
+    {
+        m_bCursorPageFetchPending = false;
+        CPLString osCommand;
+        osCommand.Printf("FETCH %d in %s", nCursorPage, pszCursorName);
+        CPLAssert(m_hPrefetchedCursorPage == nullptr);
+        m_hPrefetchedCursorPage =
+            OGRPG_PQgetResult(poDS->GetPGConn(), osCommand);
+    }
+}
+
+/************************************************************************/
+/*                    DiscardPrefetchedCursorPage()                     */
+/************************************************************************/
+
+void OGRPGLayer::DiscardPrefetchedCursorPage()
+{
+    CollectPrefetchedCursorPage();
+    OGRPGClearResult(m_hPrefetchedCursorPage);
+}
+
+/************************************************************************/
+/*                         GetNextRawFeature()                          */
+/************************************************************************/
+
+OGRFeature *OGRPGLayer::GetNextRawFeature()
+
+{
     if (bInvalidated)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -1553,8 +1623,7 @@ OGRFeature *OGRPGLayer::GetNextRawFeature()
     {
         OGRPGClearResult(hCursorResult);
 
-        osCommand.Printf("FETCH %d in %s", nCursorPage, pszCursorName);
-        hCursorResult = OGRPG_PQexec(hPGConn, osCommand);
+        hCursorResult = FetchCursorPage();
 
         nResultOffset = 0;
     }
@@ -1623,6 +1692,7 @@ OGRErr OGRPGLayer::SetNextByIndex(GIntBig nIndex)
     }
 
     OGRPGClearResult(hCursorResult);
+    DiscardPrefetchedCursorPage();
 
     osCommand.Printf("FETCH ABSOLUTE " CPL_FRMT_GIB " in %s", nIndex + 1,
                      pszCursorName);
@@ -13,18 +13,45 @@
 #include "ogr_pg.h"
 #include "cpl_conv.h"
 
+#include <map>
+#include <mutex>
+
 /************************************************************************/
-/*                         OGRPG_PQexec()                               */
+/*                      Pending asynchronous queries                    */
 /************************************************************************/
 
-PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
-                       int bMultipleCommandAllowed, int bErrorAsDebug)
+// Connections on which a query sent with OGRPG_PQsendQuery() may still be
+// in flight, with the function that collects its result. libpq does not
+// allow issuing another query before that result has been consumed.
+static std::mutex goMutexPendingQueries;
+static std::map<PGconn *, std::function<void()>> goMapPendingQueries;
+
+/************************************************************************/
+/*                       OGRPGCollectPendingQuery()                     */
+/************************************************************************/
+
+static void OGRPGCollectPendingQuery(PGconn *conn)
 {
-    PGresult *hResult = bMultipleCommandAllowed
-                            ? PQexec(conn, query)
-                            : PQexecParams(conn, query, 0, nullptr, nullptr,
-                                           nullptr, nullptr, 0);
+    std::function<void()> collectResult;
+    {
+        std::lock_guard<std::mutex> oLock(goMutexPendingQueries);
+        auto oIter = goMapPendingQueries.find(conn);
+        if (oIter == goMapPendingQueries.end())
+            return;
+        collectResult = std::move(oIter->second);
+        goMapPendingQueries.erase(oIter);
+    }
+    collectResult();
+}
 
+/************************************************************************/
+/*                         OGRPGReportResult()                          */
+/************************************************************************/
+
+static void OGRPGReportResult(PGconn *conn, const char *pszFunction,
+                              const char *query, PGresult *hResult,
+                              int bErrorAsDebug)
+{
 #ifdef DEBUG
     const char *pszRetCode = "UNKNOWN";
     char szNTuples[32] = {};
@@ -50,10 +77,11 @@ PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
                 break;
         }
     }
-    if (bMultipleCommandAllowed)
-        CPLDebug("PG", "PQexec(%s) = %s%s", query, pszRetCode, szNTuples);
-    else
-        CPLDebug("PG", "PQexecParams(%s) = %s%s", query, pszRetCode, szNTuples);
+    CPLDebug("PG", "%s(%s) = %s%s", pszFunction, query, pszRetCode,
+             szNTuples);
+#else
+    CPL_IGNORE_RET_VAL(pszFunction);
+    CPL_IGNORE_RET_VAL(query);
 #endif
 
     /* -------------------------------------------------------------------- */
@@ -67,6 +95,80 @@ PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
         else
             CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(conn));
     }
+}
+
+/************************************************************************/
+/*                         OGRPG_PQexec()                               */
+/************************************************************************/
+
+PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
+                       int bMultipleCommandAllowed, int bErrorAsDebug)
+{
+    OGRPGCollectPendingQuery(conn);
+
+    PGresult *hResult = bMultipleCommandAllowed
+                            ? PQexec(conn, query)
+                            : PQexecParams(conn, query, 0, nullptr, nullptr,
+                                           nullptr, nullptr, 0);
+
+    OGRPGReportResult(conn,
+                      bMultipleCommandAllowed ? "PQexec" : "PQexecParams",
+                      query, hResult, bErrorAsDebug);
+
+    return hResult;
+}
+
+/************************************************************************/
+/*                         OGRPG_PQsendQuery()                          */
+/************************************************************************/
+
+/** Send a (single command) query without waiting for its result, which must
+ * be retrieved with OGRPG_PQgetResult().
+ *
+ * collectResult is called if another query is issued with OGRPG_PQexec() on
+ * the same connection before that: it must call OGRPG_PQgetResult() and keep
+ * the result for later use.
+ */
+bool OGRPG_PQsendQuery(PGconn *conn, const char *query,
+                       const std::function<void()> &collectResult)
+{
+    OGRPGCollectPendingQuery(conn);
+
+    if (!PQsendQueryParams(conn, query, 0, nullptr, nullptr, nullptr, nullptr,
+                           0))
+    {
+        CPLDebug("PG", "PQsendQueryParams(%s) failed: %s", query,
+                 PQerrorMessage(conn));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> oLock(goMutexPendingQueries);
+    goMapPendingQueries[conn] = collectResult;
+    return true;
+}
+
+/************************************************************************/
+/*                         OGRPG_PQgetResult()                          */
+/************************************************************************/
+
+/** Wait for the result of a query sent with OGRPG_PQsendQuery() */
+PGresult *OGRPG_PQgetResult(PGconn *conn, const char *query)
+{
+    {
+        std::lock_guard<std::mutex> oLock(goMutexPendingQueries);
+        goMapPendingQueries.erase(conn);
+    }
+
+    PGresult *hResult = nullptr;
+    while (PGresult *hOtherResult = PQgetResult(conn))
+    {
+        if (hResult == nullptr)
+            hResult = hOtherResult;
+        else
+            PQclear(hOtherResult);
+    }
+
+    OGRPGReportResult(conn, "PQgetResult", query, hResult, FALSE);
 
     return hResult;
 }
@@ -15,10 +15,17 @@
 
 #include "libpq-fe.h"
 
+#include <functional>
+
 PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
                        int bMultipleCommandAllowed = FALSE,
                        int bErrorAsDebug = FALSE);
 
+bool OGRPG_PQsendQuery(PGconn *conn, const char *query,
+                       const std::function<void()> &collectResult);
+
+PGresult *OGRPG_PQgetResult(PGconn *conn, const char *query);
+
 /************************************************************************/
 /*                            OGRPGClearResult                          */
 /*                                                                      */
@@ -17,11 +17,13 @@
 #include "ogrsf_frmts.h"
 
 #include "cpl_compressor.h"
+#include "cpl_mem_cache.h"
 #include "cpl_vsi_virtual.h"
 
 #include "include_pmtiles.h"
 
 #include <limits>
+#include <memory>
 #include <set>
 #include <stack>
 
@@ -95,14 +97,58 @@ class OGRPMTilesDataset final : public GDALDataset
     const std::string *ReadInternal(uint64_t nOffset, uint64_t nSize,
                                     const char *pszDataType);
 
+    /** Return the entries of a directory, from a cache of decompressed and
+     * deserialized directories, or nullptr in case of error.
+     * May throw a std::exception if the directory is corrupted.
+     */
+    std::shared_ptr<const std::vector<pmtiles::entryv3>>
+    ReadDirectory(uint64_t nOffset, uint64_t nSize, const char *pszDataType);
+
     /** Return a short-lived decompressed buffer for tile data.
      *  or nullptr in case of error.
      */
     const std::string *ReadTileData(uint64_t nOffset, uint64_t nSize);
 
+    /** Return the MVT dataset of a tile, from a cache of decoded tiles
+     * indexed by (z,x,y), or nullptr in case of error.
+     * The dataset may be shared with other layers, so its layers must be
+     * reset before being read.
+     */
+    std::shared_ptr<GDALDataset>
+    GetDecodedTile(const pmtiles::entry_zxy &sTile, bool bJsonField);
+
+    /** Advise that the data of the specified tiles will be read soon. Only
+     * has an effect on network files.
+     */
+    void AdviseReadTiles(const std::vector<pmtiles::entry_zxy> &asTiles);
+
+    inline bool IsNetworkFile() const
+    {
+        return m_bIsNetworkFile;
+    }
+
   private:
     VSIVirtualHandleUniquePtr m_poFile{};
 
+    //! Whether m_poFile is a network file
+    bool m_bIsNetworkFile = false;
+
+    //! Cache of deserialized directories, indexed by their offset
+    lru11::Cache<uint64_t, std::shared_ptr<const std::vector<pmtiles::entryv3>>>
+        m_oCacheDirectories{128};
+
+    //! Cache of decompressed tile data, indexed by their offset
+    lru11::Cache<uint64_t, std::shared_ptr<const std::string>>
+        m_oCacheTileData{64};
+
+    //! Cache of MVT datasets of decoded tiles, indexed by their tile id
+    //! and whether they expose a json field
+    lru11::Cache<uint64_t, std::shared_ptr<GDALDataset>> m_oCacheDecodedTiles{
+        16};
+
+    //! Last tile data returned by ReadTileData()
+    std::shared_ptr<const std::string> m_poLastTileData{};
+
     //! PMTiles header
     pmtiles::headerv3 m_sHeader{};
 
@@ -278,6 +324,16 @@ class OGRPMTilesVectorLayer final
     //! Iterator over tiles
     std::unique_ptr<OGRPMTilesTileIterator> m_poTileIterator{};
 
+    //! Iterator running ahead of m_poTileIterator to prefetch tiles on
+    //! network files
+    std::unique_ptr<OGRPMTilesTileIterator> m_poPrefetchTileIterator{};
+
+    //! Number of tiles m_poPrefetchTileIterator is ahead of m_poTileIterator
+    int m_nTilesPrefetchedAhead = 0;
+
+    //! Whether m_poPrefetchTileIterator has reached its end
+    bool m_bPrefetchEOF = false;
+
     //! Total feature count (may over-estimate due to not applying clipping)
     GIntBig m_nFeatureCount = -1;
 
@@ -287,14 +343,8 @@ class OGRPMTilesVectorLayer final
     //! Y tile value of currently opened tile
     uint32_t m_nY = 0;
 
-    //! Offset of the currently opened tile
-    uint64_t m_nLastTileOffset = 0;
-
-    //! Uncompressed MVT tile
-    std::string m_osTileData{};
-
     //! In-memory MVT dataset of the currently opened tile
-    std::unique_ptr<GDALDataset> m_poTileDS{};
+    std::shared_ptr<GDALDataset> m_poTileDS{};
 
     //! Layer of m_poTileDS
     OGRLayer *m_poTileLayer = nullptr;
@@ -324,6 +374,7 @@ class OGRPMTilesVectorLayer final
     bool m_bJsonField = false;
 
     std::unique_ptr<OGRFeature> GetNextSrcFeature();
+    void PrefetchTiles();
     std::unique_ptr<OGRFeature> CreateFeatureFrom(OGRFeature *poSrcFeature);
     GIntBig GetTotalFeatureCount() const;
     void ExtentToTileExtent(const OGREnvelope &sEnvelope, int &nTileMinX,
@@ -341,7 +392,7 @@ class OGRPMTilesVectorLayer final
 
 class OGRPMTilesWriterDataset final : public GDALDataset
 {
-    std::unique_ptr<GDALDataset> m_poMBTilesWriterDataset{};
+    std::unique_ptr<GDALDataset> m_poMVTWriterDataset{};
 
   public:
     OGRPMTilesWriterDataset() = default;
@@ -18,6 +18,9 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <utility>
+
 /************************************************************************/
 /*                       ~OGRPMTilesDataset()                           */
 /************************************************************************/
@@ -115,6 +118,7 @@ bool OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
     // Borrow file handle
     m_poFile.reset(poOpenInfo->fpL);
     poOpenInfo->fpL = nullptr;
+    m_bIsNetworkFile = !VSIIsLocal(poOpenInfo->pszFilename);
 
     // Deserizalize header
     std::string osHeader;
@@ -450,5 +454,143 @@ const std::string *OGRPMTilesDataset::ReadInternal(uint64_t nOffset,
 const std::string *OGRPMTilesDataset::ReadTileData(uint64_t nOffset,
                                                    uint64_t nSize)
 {
-    return Read(m_psTileDataDecompressor, nOffset, nSize, "tile data");
+    // Tile data is deduplicated, so the offset identifies its content
+    if (m_oCacheTileData.tryGet(nOffset, m_poLastTileData))
+        return m_poLastTileData.get();
+
+    const auto *posStr =
+        Read(m_psTileDataDecompressor, nOffset, nSize, "tile data");
+    if (!posStr)
+        return nullptr;
+    m_poLastTileData = std::make_shared<const std::string>(*posStr);
+    m_oCacheTileData.insert(nOffset, m_poLastTileData);
+    return m_poLastTileData.get();
+}
+
+/************************************************************************/
+/*                           GetDecodedTile()                           */
+/************************************************************************/
+
+std::shared_ptr<GDALDataset>
+OGRPMTilesDataset::GetDecodedTile(const pmtiles::entry_zxy &sTile,
+                                  bool bJsonField)
+{
+    // Tile ids are lower than 2^63 for zoom levels up to 31, which leaves
+    // one bit for bJsonField.
+    uint64_t nKey;
+    try
+    {
+        nKey = (pmtiles::zxy_to_tileid(sTile.z, sTile.x, sTile.y) << 1) |
+               (bJsonField ? 1 : 0);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+        return nullptr;
+    }
+
+    std::shared_ptr<GDALDataset> poTileDS;
+    if (m_oCacheDecodedTiles.tryGet(nKey, poTileDS))
+    {
+        CPLDebug("PMTiles", "Reusing decoded tile X=%u, Y=%u, Z=%u", sTile.x,
+                 sTile.y, sTile.z);
+        return poTileDS;
+    }
+
+    const auto *posStr = ReadTileData(sTile.offset, sTile.length);
+    if (!posStr)
+        return nullptr;
+
+    CPLDebug("PMTiles", "Decoding tile X=%u, Y=%u, Z=%u", sTile.x, sTile.y,
+             sTile.z);
+
+    // The MVT driver ingests the file content when opening it, so the
+    // cached buffer is only read, and the file can be removed just after.
+    const std::string osTmpFilename = VSIMemGenerateHiddenFilename(
+        CPLSPrintf("pmtiles_%u_%u.pbf", sTile.x, sTile.y));
+    VSIFCloseL(VSIFileFromMemBuffer(
+        osTmpFilename.c_str(),
+        reinterpret_cast<GByte *>(const_cast<char *>(posStr->data())),
+        posStr->size(), false));
+
+    const char *const apszAllowedDrivers[] = {"MVT", nullptr};
+    CPLStringList aosOpenOptions;
+    aosOpenOptions.SetNameValue("X", CPLSPrintf("%u", sTile.x));
+    aosOpenOptions.SetNameValue("Y", CPLSPrintf("%u", sTile.y));
+    aosOpenOptions.SetNameValue("Z", CPLSPrintf("%u", sTile.z));
+    aosOpenOptions.SetNameValue(
+        "METADATA_FILE", bJsonField ? "" : m_osMetadataFilename.c_str());
+    if (!m_osClipOpenOption.empty())
+    {
+        aosOpenOptions.SetNameValue("CLIP", m_osClipOpenOption.c_str());
+    }
+    poTileDS.reset(GDALDataset::Open(("MVT:" + osTmpFilename).c_str(),
+                                     GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
+                                     apszAllowedDrivers,
+                                     aosOpenOptions.List(), nullptr));
+    VSIUnlink(osTmpFilename.c_str());
+    if (poTileDS)
+        m_oCacheDecodedTiles.insert(nKey, poTileDS);
+    return poTileDS;
+}
+
+/************************************************************************/
+/*                            ReadDirectory()                           */
+/************************************************************************/
+
+std::shared_ptr<const std::vector<pmtiles::entryv3>>
+OGRPMTilesDataset::ReadDirectory(uint64_t nOffset, uint64_t nSize,
+                                 const char *pszDataType)
+{
+    std::shared_ptr<const std::vector<pmtiles::entryv3>> poEntries;
+    if (m_oCacheDirectories.tryGet(nOffset, poEntries))
+        return poEntries;
+
+    const auto *posStr = ReadInternal(nOffset, nSize, pszDataType);
+    if (!posStr)
+        return nullptr;
+    poEntries = std::make_shared<const std::vector<pmtiles::entryv3>>(
+        pmtiles::deserialize_directory(*posStr));
+    m_oCacheDirectories.insert(nOffset, poEntries);
+    return poEntries;
+}
+
+/************************************************************************/
+/*                           AdviseReadTiles()                          */
+/************************************************************************/
+
+void OGRPMTilesDataset::AdviseReadTiles(
+    const std::vector<pmtiles::entry_zxy> &asTiles)
+{
+    if (!m_bIsNetworkFile)
+        return;
+
+    // Collect distinct ranges of tiles that are not already cached
+    std::vector<std::pair<uint64_t, uint32_t>> aoRanges;
+    for (const auto &sTile : asTiles)
+    {
+        if (!m_oCacheTileData.contains(sTile.offset))
+            aoRanges.emplace_back(sTile.offset, sTile.length);
+    }
+    std::sort(aoRanges.begin(), aoRanges.end());
+    aoRanges.erase(std::unique(aoRanges.begin(), aoRanges.end()),
+                   aoRanges.end());
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    const size_t nLimit = m_poFile->GetAdviseReadTotalBytesLimit();
+    size_t nTotalSize = 0;
+    for (const auto &oRange : aoRanges)
+    {
+        if (oRange.second > nLimit - nTotalSize)
+            break;
+        nTotalSize += oRange.second;
+        anOffsets.push_back(oRange.first);
+        anSizes.push_back(oRange.second);
+    }
+    if (anOffsets.size() > 1)
+    {
+        m_poFile->AdviseRead(static_cast<int>(anOffsets.size()),
+                             anOffsets.data(), anSizes.data());
+    }
 }
@@ -192,7 +192,12 @@ void RegisterOGRPMTiles()
         "description='Layer type' default='overlay'>"
         "    <Value>overlay</Value>"
         "    <Value>baselayer</Value>"
-        "  </Option>" MVT_MBTILES_PMTILES_COMMON_DSCO "</CreationOptionList>");
+        "  </Option>"
+        "  <Option name='SORT_BUFFER_SIZE' scope='vector' type='string' "
+        "description='Maximum amount of memory used to sort the features "
+        "clipped to tiles, before spilling them to a temporary file' "
+        "default='100MB'/>" MVT_MBTILES_PMTILES_COMMON_DSCO
+        "</CreationOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_LAYER, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_FIELD, "YES");
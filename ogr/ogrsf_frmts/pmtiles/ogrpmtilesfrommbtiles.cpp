@@ -25,39 +25,26 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
 #include <unordered_map>
 #include <utility>
 
+constexpr uint64_t BLOB_NOT_WRITTEN = std::numeric_limits<uint64_t>::max();
+
 /************************************************************************/
 /*                         ProcessMetadata()                            */
 /************************************************************************/
 
-static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
-                            std::string &osMetadata)
+static bool
+ProcessMetadata(const std::vector<std::pair<std::string, std::string>> &aoItems,
+                pmtiles::headerv3 &sHeader, std::string &osMetadata)
 {
-
-    auto poMetadata = poSQLiteDS->GetLayerByName("metadata");
-    if (!poMetadata)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "metadata table not found");
-        return false;
-    }
-
-    const int iName = poMetadata->GetLayerDefn()->GetFieldIndex("name");
-    const int iValue = poMetadata->GetLayerDefn()->GetFieldIndex("value");
-    if (iName < 0 || iValue < 0)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Bad structure for metadata table");
-        return false;
-    }
-
     CPLJSONObject oObj;
     CPLJSONDocument oJsonDoc;
-    for (auto &&poFeature : poMetadata)
+    for (const auto &oItem : aoItems)
     {
-        const char *pszName = poFeature->GetFieldAsString(iName);
-        const char *pszValue = poFeature->GetFieldAsString(iValue);
+        const char *pszName = oItem.first.c_str();
+        const char *pszValue = oItem.second.c_str();
         if (EQUAL(pszName, "json"))
         {
             if (!oJsonDoc.LoadMemory(pszValue))
@@ -175,205 +162,172 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
 }
 
 /************************************************************************/
-/*                               HashArray()                            */
+/*                      OGRPMTilesArchiveWriter()                       */
 /************************************************************************/
 
-// From https://codereview.stackexchange.com/questions/171999/specializing-stdhash-for-stdarray
-// We do not use std::hash<std::array<T, N>> as the name of the struct
-// because with gcc 5.4 we get the following error:
-// https://stackoverflow.com/questions/25594644/warning-specialization-of-template-in-different-namespace
-template <class T, size_t N> struct HashArray
+OGRPMTilesArchiveWriter::OGRPMTilesArchiveWriter(const std::string &osDestName)
+    : m_osDestName(osDestName)
 {
-    CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
-    size_t operator()(const std::array<T, N> &key) const
+}
+
+/************************************************************************/
+/*                     ~OGRPMTilesArchiveWriter()                       */
+/************************************************************************/
+
+OGRPMTilesArchiveWriter::~OGRPMTilesArchiveWriter()
+{
+    if (m_poTmpFile)
     {
-        std::hash<T> hasher;
-        size_t result = 0;
-        for (size_t i = 0; i < N; ++i)
-        {
-            result = result * 31 + hasher(key[i]);
-        }
-        return result;
+        m_poTmpFile.reset();
+        VSIUnlink(m_osTmpFile.c_str());
     }
-};
+}
 
 /************************************************************************/
-/*                    OGRPMTilesConvertFromMBTiles()                    */
+/*                               Open()                                 */
 /************************************************************************/
 
-bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
-                                  const char *pszSrcName)
+bool OGRPMTilesArchiveWriter::Open()
 {
-    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
-    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
-        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
-    if (!poSQLiteDS)
+    // Let's build a temporary file that contains the distinct tile data, in
+    // the order in which they are added. They are copied in the final file
+    // in the order of the "clustered" mode at the end.
+    m_osTmpFile = m_osDestName + ".tmp";
+    if (!VSIIsLocal(m_osDestName.c_str()))
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot open %s with SQLite driver", pszSrcName);
+        m_osTmpFile =
+            CPLGenerateTempFilenameSafe(CPLGetFilename(m_osDestName.c_str()));
+    }
+
+    m_poTmpFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_osTmpFile.c_str(), "wb+"));
+    VSIUnlink(m_osTmpFile.c_str());
+    if (!m_poTmpFile)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
+                 m_osTmpFile.c_str());
         return false;
     }
+    return true;
+}
 
-    pmtiles::headerv3 sHeader;
-    std::string osMetadata;
-    if (!ProcessMetadata(poSQLiteDS.get(), sHeader, osMetadata))
+/************************************************************************/
+/*                              AddTile()                               */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::AddTile(int nZ, int nX, int nY,
+                                      const void *pData, size_t nSize)
+{
+    if (!m_poTmpFile)
         return false;
 
-    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
-    if (!poTilesLayer)
+    uint64_t nTileId;
+    try
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
+        nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
+                 e.what());
         return false;
     }
-
-    const int iZoomLevel =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
-    const int iTileColumn =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
-    const int iTileRow =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
-    const int iTileData =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
-    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
+    if (nSize > std::numeric_limits<uint32_t>::max())
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large tile");
         return false;
     }
 
-    struct TileEntry
-    {
-        uint64_t nTileId;
-        std::array<unsigned char, 16> abyMD5;
-    };
+    // Deduplicate the tile data, using a hash of it, while writing distinct
+    // data in the temporary file.
+    std::array<unsigned char, 16> abyMD5;
+    CPLMD5Context md5context;
+    CPLMD5Init(&md5context);
+    CPLMD5Update(&md5context, pData, nSize);
+    CPLMD5Final(&abyMD5[0], &md5context);
 
-    // In a first step browse through the tiles table to compute the PMTiles
-    // tile_id of each tile, and compute a hash of the tile data for
-    // deduplication
-    std::vector<TileEntry> asTileEntries;
-    for (auto &&poFeature : poTilesLayer)
+    try
     {
-        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
-        if (nZoomLevel < 0 || nZoomLevel > 30)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid zoom_level");
-            continue;
-        }
-        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
-        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_column");
-            continue;
-        }
-        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
-        if (nRow < 0 || nRow >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_row");
-            continue;
-        }
-        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
-        // 0=top-most row
-        const int nY = (1 << nZoomLevel) - 1 - nRow;
-        uint64_t nTileId;
-        try
-        {
-            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZoomLevel),
-                                             nColumn, nY);
-        }
-        catch (const std::exception &e)
-        {
-            // shouldn't happen given previous checks
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
-                     e.what());
-            return false;
-        }
-        int nTileDataLength = 0;
-        const GByte *pabyData =
-            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-        if (!pabyData)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
-            return false;
-        }
-
         TileEntry sEntry;
         sEntry.nTileId = nTileId;
 
-        CPLMD5Context md5context;
-        CPLMD5Init(&md5context);
-        CPLMD5Update(&md5context, pabyData, nTileDataLength);
-        CPLMD5Final(&sEntry.abyMD5[0], &md5context);
-        try
+        const auto oIter = m_oMapMD5ToBlobIdx.find(abyMD5);
+        if (oIter != m_oMapMD5ToBlobIdx.end())
         {
-            asTileEntries.push_back(sEntry);
+            sEntry.nBlobIdx = oIter->second;
         }
-        catch (const std::exception &e)
+        else
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Out of memory browsing through tiles: %s", e.what());
-            return false;
-        }
-    }
+            if (nSize && m_poTmpFile->Write(pData, nSize, 1) != 1)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+                return false;
+            }
 
-    // Sort the tiles by ascending tile_id. This is a requirement to build
-    // the PMTiles directories.
-    std::sort(asTileEntries.begin(), asTileEntries.end(),
-              [](const TileEntry &a, const TileEntry &b)
-              { return a.nTileId < b.nTileId; });
+            sEntry.nBlobIdx = static_cast<uint32_t>(m_asTileBlobs.size());
+            TileBlob sBlob;
+            sBlob.nTmpFileOffset = m_nTmpFileOffset;
+            sBlob.nLength = static_cast<uint32_t>(nSize);
+            sBlob.nFinalOffset = BLOB_NOT_WRITTEN;
+            m_asTileBlobs.push_back(sBlob);
+            m_oMapMD5ToBlobIdx[abyMD5] = sEntry.nBlobIdx;
+            m_nTmpFileOffset += nSize;
+        }
 
-    // Let's build a temporary file that contains the tile data in
-    // a way that corresponds to the "clustered" mode, that is
-    // "offsets are either contiguous with the previous offset+length, or
-    // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(std::string(pszDestName) + ".tmp");
-    if (!VSIIsLocal(pszDestName))
-    {
-        osTmpFile = CPLGenerateTempFilenameSafe(CPLGetFilename(pszDestName));
+        if (!m_asTileEntries.empty() &&
+            m_asTileEntries.back().nTileId >= nTileId)
+        {
+            m_bSorted = false;
+        }
+        m_asTileEntries.push_back(sEntry);
     }
-
-    auto poTmpFile =
-        VSIVirtualHandleUniquePtr(VSIFOpenL(osTmpFile.c_str(), "wb+"));
-    VSIUnlink(osTmpFile.c_str());
-    if (!poTmpFile)
+    catch (const std::exception &e)
     {
-        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 osTmpFile.c_str());
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Out of memory browsing through tiles: %s", e.what());
         return false;
     }
 
-    struct ResetAndUnlinkTmpFile
-    {
-        VSIVirtualHandleUniquePtr &m_poFile;
-        std::string m_osFilename;
+    return true;
+}
 
-        ResetAndUnlinkTmpFile(VSIVirtualHandleUniquePtr &poFile,
-                              const std::string &osFilename)
-            : m_poFile(poFile), m_osFilename(osFilename)
-        {
-        }
+/************************************************************************/
+/*                             Finalize()                               */
+/************************************************************************/
 
-        ~ResetAndUnlinkTmpFile()
-        {
-            m_poFile.reset();
-            VSIUnlink(m_osFilename.c_str());
-        }
-    };
+bool OGRPMTilesArchiveWriter::Finalize(
+    const std::vector<std::pair<std::string, std::string>> &aoMetadata)
+{
+    if (!m_poTmpFile)
+        return false;
 
-    ResetAndUnlinkTmpFile oReseer(poTmpFile, osTmpFile);
+    pmtiles::headerv3 sHeader;
+    std::string osMetadata;
+    if (!ProcessMetadata(aoMetadata, sHeader, osMetadata))
+        return false;
 
+    // Sort the tiles by ascending tile_id. This is a requirement to build
+    // the PMTiles directories.
+    if (!m_bSorted)
+    {
+        std::sort(m_asTileEntries.begin(), m_asTileEntries.end(),
+                  [](const TileEntry &a, const TileEntry &b)
+                  { return a.nTileId < b.nTileId; });
+    }
+
+    // Assign the offsets of the tile data in the final file, in a way that
+    // corresponds to the "clustered" mode, that is "offsets are either
+    // contiguous with the previous offset+length, or refer to a lesser
+    // offset, when writing with deduplication."
     std::vector<pmtiles::entryv3> asPMTilesEntries;
+    std::vector<uint32_t> anBlobIdxInFinalOrder;
     uint64_t nLastTileId = 0;
+    uint32_t nLastBlobIdx = 0;
     uint64_t nFileOffset = 0;
-    std::array<unsigned char, 16> abyLastMD5;
-    std::unordered_map<std::array<unsigned char, 16>,
-                       std::pair<uint64_t, uint32_t>,
-                       HashArray<unsigned char, 16>>
-        oMapMD5ToOffsetLen;
-    for (const auto &sEntry : asTileEntries)
-    {
-        if (sEntry.nTileId == nLastTileId + 1 && sEntry.abyMD5 == abyLastMD5)
+    for (const auto &sEntry : m_asTileEntries)
+    {
+        if (!asPMTilesEntries.empty() && sEntry.nTileId == nLastTileId + 1 &&
+            sEntry.nBlobIdx == nLastBlobIdx)
         {
             // If the tile id immediately follows the previous one and
             // has the same tile data, increase the run_length
@@ -381,72 +335,26 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
         }
         else
         {
-            pmtiles::entryv3 sPMTilesEntry;
-            sPMTilesEntry.tile_id = sEntry.nTileId;
-            sPMTilesEntry.run_length = 1;
-
-            auto oIter = oMapMD5ToOffsetLen.find(sEntry.abyMD5);
-            if (oIter != oMapMD5ToOffsetLen.end())
-            {
-                // Point to previously written tile data if this content
-                // has already been written
-                sPMTilesEntry.offset = oIter->second.first;
-                sPMTilesEntry.length = oIter->second.second;
-            }
-            else
+            TileBlob &sBlob = m_asTileBlobs[sEntry.nBlobIdx];
+            if (sBlob.nFinalOffset == BLOB_NOT_WRITTEN)
             {
-                try
-                {
-                    const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
-                    poTilesLayer->SetAttributeFilter(CPLSPrintf(
-                        "zoom_level = %d AND tile_column = %u AND tile_row = "
-                        "%u",
-                        sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
-                }
-                catch (const std::exception &e)
-                {
-                    // shouldn't happen given previous checks
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot compute xyz: %s", e.what());
-                    return false;
-                }
-                poTilesLayer->ResetReading();
-                auto poFeature =
-                    std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
-                if (!poFeature)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
-                    return false;
-                }
-                int nTileDataLength = 0;
-                const GByte *pabyData =
-                    poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-                if (!pabyData)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
-                    return false;
-                }
-
-                sPMTilesEntry.offset = nFileOffset;
-                sPMTilesEntry.length = nTileDataLength;
-
-                oMapMD5ToOffsetLen[sEntry.abyMD5] =
-                    std::pair<uint64_t, uint32_t>(nFileOffset, nTileDataLength);
-
-                nFileOffset += nTileDataLength;
-
-                if (poTmpFile->Write(pabyData, nTileDataLength, 1) != 1)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
-                    return false;
-                }
+                sBlob.nFinalOffset = nFileOffset;
+                nFileOffset += sBlob.nLength;
+                anBlobIdxInFinalOrder.push_back(sEntry.nBlobIdx);
             }
 
+            pmtiles::entryv3 sPMTilesEntry;
+            sPMTilesEntry.tile_id = sEntry.nTileId;
+            sPMTilesEntry.run_length = 1;
+            // Point to previously written tile data if this content
+            // has already been written
+            sPMTilesEntry.offset = sBlob.nFinalOffset;
+            sPMTilesEntry.length = sBlob.nLength;
             asPMTilesEntries.push_back(sPMTilesEntry);
-
-            nLastTileId = sEntry.nTileId;
-            abyLastMD5 = sEntry.abyMD5;
         }
+
+        nLastTileId = sEntry.nTileId;
+        nLastBlobIdx = sEntry.nBlobIdx;
     }
 
     const CPLCompressor *psCompressor = CPLGetCompressor("gzip");
@@ -515,27 +423,27 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
 
     // Nomber of tiles that are addressable in the PMTiles archive, that is
     // the number of tiles we would have if not deduplicating them
-    sHeader.addressed_tiles_count = asTileEntries.size();
+    sHeader.addressed_tiles_count = m_asTileEntries.size();
 
     // Number of tile entries in root and leave directories
     // ie entries whose run_length >= 1
     sHeader.tile_entries_count = asPMTilesEntries.size();
 
     // Number of distinct tile blobs
-    sHeader.tile_contents_count = oMapMD5ToOffsetLen.size();
+    sHeader.tile_contents_count = m_asTileBlobs.size();
 
     // Now build the final file!
-    auto poFile = VSIVirtualHandleUniquePtr(VSIFOpenL(pszDestName, "wb"));
+    auto poFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_osDestName.c_str(), "wb"));
     if (!poFile)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 pszDestName);
+                 m_osDestName.c_str());
         return false;
     }
     const auto osHeader = sHeader.serialize();
 
-    if (poTmpFile->Seek(0, SEEK_SET) != 0 ||
-        poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
+    if (poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
         poFile->Write(osRootBytes.data(), osRootBytes.size(), 1) != 1 ||
         poFile->Write(osCompressedMetadata.data(), osCompressedMetadata.size(),
                       1) != 1 ||
@@ -546,22 +454,51 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
         return false;
     }
 
-    // Copy content of the temporary file at end of the output file.
+    // Copy the tile data from the temporary file at end of the output file,
+    // in clustered order, coalescing reads of consecutive blobs.
     std::string oCopyBuffer;
     oCopyBuffer.resize(1024 * 1024);
-    const uint64_t nTotalSize = nFileOffset;
-    nFileOffset = 0;
-    while (nFileOffset < nTotalSize)
-    {
-        const size_t nToRead = static_cast<size_t>(
-            std::min<uint64_t>(nTotalSize - nFileOffset, oCopyBuffer.size()));
-        if (poTmpFile->Read(&oCopyBuffer[0], nToRead, 1) != 1 ||
-            poFile->Write(&oCopyBuffer[0], nToRead, 1) != 1)
-        {
-            CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+    const auto CopyRange = [this, &poFile, &oCopyBuffer](uint64_t nStart,
+                                                         uint64_t nEnd)
+    {
+        if (nStart == nEnd)
+            return true;
+        if (m_poTmpFile->Seek(nStart, SEEK_SET) != 0)
             return false;
+        while (nStart < nEnd)
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min<uint64_t>(nEnd - nStart, oCopyBuffer.size()));
+            if (m_poTmpFile->Read(&oCopyBuffer[0], nToRead, 1) != 1 ||
+                poFile->Write(&oCopyBuffer[0], nToRead, 1) != 1)
+            {
+                return false;
+            }
+            nStart += nToRead;
+        }
+        return true;
+    };
+
+    uint64_t nRangeStart = 0;
+    uint64_t nRangeEnd = 0;
+    for (const uint32_t nBlobIdx : anBlobIdxInFinalOrder)
+    {
+        const TileBlob &sBlob = m_asTileBlobs[nBlobIdx];
+        if (sBlob.nTmpFileOffset != nRangeEnd)
+        {
+            if (!CopyRange(nRangeStart, nRangeEnd))
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+                return false;
+            }
+            nRangeStart = sBlob.nTmpFileOffset;
         }
-        nFileOffset += nToRead;
+        nRangeEnd = sBlob.nTmpFileOffset + sBlob.nLength;
+    }
+    if (!CopyRange(nRangeStart, nRangeEnd))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+        return false;
     }
 
     if (poFile->Close() != 0)
@@ -569,3 +506,123 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
 
     return true;
 }
+
+/************************************************************************/
+/*                    OGRPMTilesConvertFromMBTiles()                    */
+/************************************************************************/
+
+bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
+                                  const char *pszSrcName)
+{
+    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
+    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
+    if (!poSQLiteDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot open %s with SQLite driver", pszSrcName);
+        return false;
+    }
+
+    auto poMetadata = poSQLiteDS->GetLayerByName("metadata");
+    if (!poMetadata)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "metadata table not found");
+        return false;
+    }
+
+    const int iName = poMetadata->GetLayerDefn()->GetFieldIndex("name");
+    const int iValue = poMetadata->GetLayerDefn()->GetFieldIndex("value");
+    if (iName < 0 || iValue < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Bad structure for metadata table");
+        return false;
+    }
+
+    std::vector<std::pair<std::string, std::string>> aoMetadata;
+    for (auto &&poFeature : poMetadata)
+    {
+        aoMetadata.emplace_back(poFeature->GetFieldAsString(iName),
+                                poFeature->GetFieldAsString(iValue));
+    }
+
+    // Validate the metadata before going through the tiles
+    {
+        pmtiles::headerv3 sHeader;
+        std::string osMetadata;
+        if (!ProcessMetadata(aoMetadata, sHeader, osMetadata))
+            return false;
+    }
+
+    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
+    if (!poTilesLayer)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
+        return false;
+    }
+
+    const int iZoomLevel =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
+    const int iTileColumn =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
+    const int iTileRow =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
+    const int iTileData =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
+    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
+        return false;
+    }
+
+    OGRPMTilesArchiveWriter oWriter(pszDestName);
+    if (!oWriter.Open())
+        return false;
+
+    // In a single pass, browse through the tiles table and hand over the
+    // tiles to the archive writer, which deduplicates them.
+    for (auto &&poFeature : poTilesLayer)
+    {
+        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
+        if (nZoomLevel < 0 || nZoomLevel > 30)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid zoom_level");
+            continue;
+        }
+        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
+        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_column");
+            continue;
+        }
+        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
+        if (nRow < 0 || nRow >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_row");
+            continue;
+        }
+        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
+        // 0=top-most row
+        const int nY = (1 << nZoomLevel) - 1 - nRow;
+        int nTileDataLength = 0;
+        const GByte *pabyData =
+            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
+        if (!pabyData)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+            return false;
+        }
+
+        if (!oWriter.AddTile(nZoomLevel, nColumn, nY, pabyData,
+                             static_cast<size_t>(nTileDataLength)))
+        {
+            return false;
+        }
+    }
+
+    return oWriter.Finalize(aoMetadata);
+}
@@ -14,6 +14,94 @@
 #define OGRPMTILESFROMMBTILES_H_INCLUDED
 
 #include "gdal_priv.h"
+#include "cpl_vsi_virtual.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/************************************************************************/
+/*                               HashArray()                            */
+/************************************************************************/
+
+// From https://codereview.stackexchange.com/questions/171999/specializing-stdhash-for-stdarray
+// We do not use std::hash<std::array<T, N>> as the name of the struct
+// because with gcc 5.4 we get the following error:
+// https://stackoverflow.com/questions/25594644/warning-specialization-of-template-in-different-namespace
+template <class T, size_t N> struct HashArray
+{
+    CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
+    size_t operator()(const std::array<T, N> &key) const
+    {
+        std::hash<T> hasher;
+        size_t result = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result = result * 31 + hasher(key[i]);
+        }
+        return result;
+    }
+};
+
+/************************************************************************/
+/*                        OGRPMTilesArchiveWriter                       */
+/************************************************************************/
+
+/** Writes a PMTiles v3 archive of MVT tiles, in clustered mode.
+ *
+ * Tile data is deduplicated on the fly, using a MD5 hash of it, and
+ * distinct blobs are written in a temporary file. Finalize() builds the
+ * directories, with run-length encoded entries for consecutive identical
+ * tiles, and copies the blobs in the final file in tile_id order.
+ * Tiles can be added in any order, but adding them in ascending tile_id
+ * order avoids a final sort of the entries.
+ */
+class OGRPMTilesArchiveWriter
+{
+  public:
+    explicit OGRPMTilesArchiveWriter(const std::string &osDestName);
+    ~OGRPMTilesArchiveWriter();
+
+    bool Open();
+
+    /** Add a tile. nY=0 is the top-most row. */
+    bool AddTile(int nZ, int nX, int nY, const void *pData, size_t nSize);
+
+    /** Write the final file, from the items of a MBTiles metadata table. */
+    bool Finalize(
+        const std::vector<std::pair<std::string, std::string>> &aoMetadata);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesArchiveWriter)
+
+    struct TileEntry
+    {
+        uint64_t nTileId;
+        // Index in m_asTileBlobs[]
+        uint32_t nBlobIdx;
+    };
+
+    struct TileBlob
+    {
+        uint64_t nTmpFileOffset;
+        uint32_t nLength;
+        uint64_t nFinalOffset;
+    };
+
+    std::string m_osDestName;
+    std::string m_osTmpFile{};
+    VSIVirtualHandleUniquePtr m_poTmpFile{};
+    uint64_t m_nTmpFileOffset = 0;
+    bool m_bSorted = true;
+    std::vector<TileEntry> m_asTileEntries{};
+    std::vector<TileBlob> m_asTileBlobs{};
+    std::unordered_map<std::array<unsigned char, 16>, uint32_t,
+                       HashArray<unsigned char, 16>>
+        m_oMapMD5ToBlobIdx{};
+};
 
 bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
                                   const char *pszSrcName);
@@ -108,16 +108,16 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
     }
 
     const auto &sHeader = m_poDS->GetHeader();
-    const auto *posStr = m_poDS->ReadInternal(
+    const auto poEntries = m_poDS->ReadDirectory(
         sHeader.root_dir_offset, static_cast<uint32_t>(sHeader.root_dir_bytes),
         "header");
-    if (!posStr)
+    if (!poEntries)
     {
         return false;
     }
 
     DirectoryContext sContext;
-    sContext.sEntries = pmtiles::deserialize_directory(*posStr);
+    sContext.sEntries = *poEntries;
 
     if (m_nZoomLevel >= 0)
     {
@@ -290,10 +290,10 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                              "Invalid directory offset");
                     break;
                 }
-                const auto *posStr = m_poDS->ReadInternal(
+                const auto poEntries = m_poDS->ReadDirectory(
                     sHeader.leaf_dirs_offset + sCurrentEntry.offset,
                     sCurrentEntry.length, "directory");
-                if (!posStr)
+                if (!poEntries)
                 {
                     m_bEOF = true;
                     CPLError(
@@ -308,7 +308,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 }
 
                 DirectoryContext sContext;
-                sContext.sEntries = pmtiles::deserialize_directory(*posStr);
+                sContext.sEntries = *poEntries;
                 if (sContext.sEntries.empty())
                 {
                     m_bEOF = true;
@@ -102,6 +102,9 @@ void OGRPMTilesVectorLayer::ResetReading()
     m_poTileDS.reset();
     m_poTileLayer = nullptr;
     m_poTileIterator.reset();
+    m_poPrefetchTileIterator.reset();
+    m_nTilesPrefetchedAhead = 0;
+    m_bPrefetchEOF = false;
 }
 
 /************************************************************************/
@@ -326,6 +329,46 @@ OGRFeature *OGRPMTilesVectorLayer::GetFeature(GIntBig nFID)
     return poFeature.release();
 }
 
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+/** On network files, when the tiles previously prefetched have been
+ * consumed, look ahead of m_poTileIterator for the next tiles, and advise
+ * the dataset to fetch them, so that they are downloaded in parallel.
+ */
+void OGRPMTilesVectorLayer::PrefetchTiles()
+{
+    if (m_nTilesPrefetchedAhead > 0 || m_bPrefetchEOF)
+        return;
+
+    if (!m_poPrefetchTileIterator)
+    {
+        m_poPrefetchTileIterator = std::make_unique<OGRPMTilesTileIterator>(
+            m_poDS, m_nZoomLevel, m_nFilterMinX, m_nFilterMinY, m_nFilterMaxX,
+            m_nFilterMaxY);
+    }
+
+    constexpr int MAX_TILES_PREFETCHED = 64;
+    std::vector<pmtiles::entry_zxy> asTiles;
+    {
+        // Errors will be reported by m_poTileIterator
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        while (static_cast<int>(asTiles.size()) < MAX_TILES_PREFETCHED)
+        {
+            const auto sTile = m_poPrefetchTileIterator->GetNextTile();
+            if (sTile.offset == 0)
+            {
+                m_bPrefetchEOF = true;
+                break;
+            }
+            asTiles.push_back(sTile);
+        }
+    }
+    m_nTilesPrefetchedAhead = static_cast<int>(asTiles.size());
+    m_poDS->AdviseReadTiles(asTiles);
+}
+
 /************************************************************************/
 /*                        GetNextSrcFeature()                           */
 /************************************************************************/
@@ -358,10 +401,15 @@ std::unique_ptr<OGRFeature> OGRPMTilesVectorLayer::GetNextSrcFeature()
     if (!m_poTileLayer ||
         (poTileFeat = m_poTileLayer->GetNextFeature()) == nullptr)
     {
-        const char *const apszAllowedDrivers[] = {"MVT", nullptr};
-
         while (true)
         {
+            if (m_poDS->IsNetworkFile())
+            {
+                PrefetchTiles();
+                if (m_nTilesPrefetchedAhead > 0)
+                    --m_nTilesPrefetchedAhead;
+            }
+
             const auto sTile = m_poTileIterator->GetNextTile();
             if (sTile.offset == 0)
             {
@@ -371,57 +419,15 @@ std::unique_ptr<OGRFeature> OGRPMTilesVectorLayer::GetNextSrcFeature()
             m_nX = sTile.x;
             m_nY = sTile.y;
 
-            if (sTile.offset == m_nLastTileOffset)
-            {
-                // In case of run-length encoded tiles, we do not need to
-                // re-read it from disk
-            }
-            else
-            {
-                m_nLastTileOffset = sTile.offset;
-                CPLDebugOnly("PMTiles", "Opening tile X=%u, Y=%u, Z=%d",
-                             sTile.x, sTile.y, m_nZoomLevel);
-
-                const auto *posStr =
-                    m_poDS->ReadTileData(sTile.offset, sTile.length);
-                if (!posStr)
-                {
-                    return nullptr;
-                }
-                m_osTileData = *posStr;
-            }
-
-            m_poTileDS.reset();
-            const std::string osTmpFilename = VSIMemGenerateHiddenFilename(
-                CPLSPrintf("pmtiles_%u_%u.pbf", sTile.x, sTile.y));
-            VSIFCloseL(VSIFileFromMemBuffer(
-                osTmpFilename.c_str(),
-                reinterpret_cast<GByte *>(&m_osTileData[0]),
-                m_osTileData.size(), false));
-
-            CPLStringList aosOpenOptions;
-            aosOpenOptions.SetNameValue("X", CPLSPrintf("%u", sTile.x));
-            aosOpenOptions.SetNameValue("Y", CPLSPrintf("%u", sTile.y));
-            aosOpenOptions.SetNameValue("Z", CPLSPrintf("%d", m_nZoomLevel));
-            aosOpenOptions.SetNameValue(
-                "METADATA_FILE",
-                m_bJsonField ? "" : m_poDS->GetMetadataFilename().c_str());
-            if (!m_poDS->GetClipOpenOption().empty())
-            {
-                aosOpenOptions.SetNameValue(
-                    "CLIP", m_poDS->GetClipOpenOption().c_str());
-            }
-            m_poTileDS.reset(GDALDataset::Open(
-                ("MVT:" + osTmpFilename).c_str(),
-                GDAL_OF_VECTOR | GDAL_OF_INTERNAL, apszAllowedDrivers,
-                aosOpenOptions.List(), nullptr));
+            m_poTileLayer = nullptr;
+            m_poTileDS = m_poDS->GetDecodedTile(sTile, m_bJsonField);
             if (m_poTileDS)
             {
-                m_poTileDS->SetDescription(osTmpFilename.c_str());
-                m_poTileDS->MarkSuppressOnClose();
                 m_poTileLayer = m_poTileDS->GetLayerByName(GetDescription());
                 if (m_poTileLayer)
                 {
+                    // The decoded tile may have been read previously
+                    m_poTileLayer->ResetReading();
                     poTileFeat = m_poTileLayer->GetNextFeature();
                     if (poTileFeat)
                     {
@@ -431,10 +437,6 @@ std::unique_ptr<OGRFeature> OGRPMTilesVectorLayer::GetNextSrcFeature()
                 m_poTileDS.reset();
                 m_poTileLayer = nullptr;
             }
-            else
-            {
-                VSIUnlink(osTmpFilename.c_str());
-            }
         }
     }
 
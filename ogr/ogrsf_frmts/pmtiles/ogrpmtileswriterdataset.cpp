@@ -17,6 +17,55 @@
 #include "mvtutils.h"
 #include "ogrpmtilesfrommbtiles.h"
 
+#include "include_pmtiles.h"
+
+#include <limits>
+
+/************************************************************************/
+/*                        OGRPMTilesMVTTileSink                         */
+/************************************************************************/
+
+// Receives the tiles encoded by the MVT writer, in tile_id order, and
+// writes them in the PMTiles archive.
+class OGRPMTilesMVTTileSink final : public OGRMVTWriterTileSink
+{
+    OGRPMTilesArchiveWriter m_oWriter;
+
+  public:
+    explicit OGRPMTilesMVTTileSink(const std::string &osFilename)
+        : m_oWriter(osFilename)
+    {
+    }
+
+    bool Open()
+    {
+        return m_oWriter.Open();
+    }
+
+    uint64_t GetTileOrderKey(int nZ, int nX, int nY) const override
+    {
+        try
+        {
+            return pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+        }
+        catch (const std::exception &)
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+    }
+
+    bool WriteTile(int nZ, int nX, int nY, const std::string &osData) override
+    {
+        return m_oWriter.AddTile(nZ, nX, nY, osData.data(), osData.size());
+    }
+
+    bool Finalize(const std::vector<std::pair<std::string, std::string>>
+                      &aoMetadata) override
+    {
+        return m_oWriter.Finalize(aoMetadata);
+    }
+};
+
 /************************************************************************/
 /*                     ~OGRPMTilesWriterDataset()                       */
 /************************************************************************/
@@ -35,24 +84,12 @@ CPLErr OGRPMTilesWriterDataset::Close()
     CPLErr eErr = CE_None;
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
-        if (m_poMBTilesWriterDataset)
+        // Closing the MVT writer encodes the tiles and writes the archive
+        if (m_poMVTWriterDataset)
         {
-            if (m_poMBTilesWriterDataset->Close() != CE_None)
-            {
+            if (m_poMVTWriterDataset->Close() != CE_None)
                 eErr = CE_Failure;
-            }
-            else
-            {
-                if (!OGRPMTilesConvertFromMBTiles(
-                        GetDescription(),
-                        m_poMBTilesWriterDataset->GetDescription()))
-                {
-                    eErr = CE_Failure;
-                }
-            }
-
-            VSIUnlink(m_poMBTilesWriterDataset->GetDescription());
-            m_poMBTilesWriterDataset.reset();
+            m_poMVTWriterDataset.reset();
         }
 
         if (GDALDataset::Close() != CE_None)
@@ -69,28 +106,24 @@ bool OGRPMTilesWriterDataset::Create(const char *pszFilename,
                                      CSLConstList papszOptions)
 {
     SetDescription(pszFilename);
-    CPLStringList aosOptions(papszOptions);
-    aosOptions.SetNameValue("FORMAT", "MBTILES");
-
-    // Let's build a temporary file that contains the tile data in
-    // a way that corresponds to the "clustered" mode, that is
-    // "offsets are either contiguous with the previous offset+length, or
-    // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(pszFilename);
-    if (!VSIIsLocal(pszFilename))
-    {
-        osTmpFile = CPLGenerateTempFilenameSafe(CPLGetFilename(pszFilename));
-    }
-    osTmpFile += ".tmp.mbtiles";
 
+    // The MVT writer hands over the tiles directly to the PMTiles archive
+    // writer, in tile_id order, without any intermediate MBTiles file.
+    auto poTileSink = std::make_unique<OGRPMTilesMVTTileSink>(pszFilename);
+    if (!poTileSink->Open())
+        return false;
+
+    CPLStringList aosOptions(papszOptions);
+    // PMTiles archives are written with gzip-compressed tiles
+    aosOptions.SetNameValue("COMPRESS", nullptr);
     if (!aosOptions.FetchNameValue("NAME"))
         aosOptions.SetNameValue("NAME",
                                 CPLGetBasenameSafe(pszFilename).c_str());
 
-    m_poMBTilesWriterDataset.reset(OGRMVTWriterDatasetCreate(
-        osTmpFile.c_str(), 0, 0, 0, GDT_Unknown, aosOptions.List()));
+    m_poMVTWriterDataset.reset(OGRMVTWriterDatasetCreate(
+        pszFilename, aosOptions.List(), std::move(poTileSink)));
 
-    return m_poMBTilesWriterDataset != nullptr;
+    return m_poMVTWriterDataset != nullptr;
 }
 
 /************************************************************************/
@@ -102,8 +135,8 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
                                       const OGRGeomFieldDefn *poGeomFieldDefn,
                                       CSLConstList papszOptions)
 {
-    return m_poMBTilesWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
-                                                 papszOptions);
+    return m_poMVTWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
+                                             papszOptions);
 }
 
 /************************************************************************/
@@ -112,7 +145,7 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
 
 int OGRPMTilesWriterDataset::TestCapability(const char *pszCap)
 {
-    return m_poMBTilesWriterDataset->TestCapability(pszCap);
+    return m_poMVTWriterDataset->TestCapability(pszCap);
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
@@ -38,9 +38,14 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
+OGRGeometry *SHPReadOGRObjectForLayer(SHPHandle hSHP, int iShape,
+                                      SHPObject *psShape,
+                                      OGRwkbGeometryType eLayerGeomType,
+                                      bool &bHasWarnedWrongWindingOrder);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
                                       DBFHandle hDBF,
                                       const char *pszSHPEncoding,
@@ -216,7 +221,8 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId, OGRFeature *poFeatureToReuse);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -231,6 +237,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
@@ -39,6 +39,7 @@
 #include "ogr_srs_api.h"
 #include "ogrlayerpool.h"
 #include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
 #include "shp_vsi.h"
@@ -885,7 +886,8 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToReuse)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -906,7 +908,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -920,14 +923,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
     }
     else
     {
-        poFeature =
-            SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, nullptr,
-                              osEncoding, m_bHasWarnedWrongWindingOrder);
+        poFeature = SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId,
+                                      nullptr, osEncoding,
+                                      m_bHasWarnedWrongWindingOrder,
+                                      poFeatureToReuse);
     }
 
     return poFeature;
@@ -939,6 +944,31 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::GetNextFeatureInto(std::unique_ptr<OGRFeature> &poFeature)
+
+{
+    if (!poFeature || poFeature->GetDefnRef() != poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(poFeature);
+    return GetNextFeatureInternal(poFeature.get()) != nullptr;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is filled and returned      */
+/*      instead of allocating a new feature.                            */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (!TouchLayer())
         return nullptr;
@@ -971,7 +1001,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]));
+                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]),
+                           poFeatureToReuse);
 
             iMatchingFID++;
         }
@@ -990,10 +1021,10 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                          VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(iNextShapeId);
+                    poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
             }
             else
-                poFeature = FetchShape(iNextShapeId);
+                poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
 
             iNextShapeId++;
         }
@@ -1015,7 +1046,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToReuse)
+                delete poFeature;
         }
     }
 }
@@ -3851,8 +3883,9 @@ GDALDataset *OGRShapeLayer::GetDataset()
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementation for situations without filters, and with
+// geometries requested as WKB. Only the DBF fields that are not ignored are
+// decoded, and each DBF record is loaded at most once.
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3864,22 +3897,12 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(m_aosArrowArrayStreamOptions))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
-    // If any field is not ignored, use generic implementation
-    const int nFieldCount = poFeatureDefn->GetFieldCount();
-    for (int i = 0; i < nFieldCount; ++i)
-    {
-        if (!poFeatureDefn->GetFieldDefn(i)->IsIgnored())
-            return OGRLayer::GetNextArrowArray(stream, out_array);
-    }
-    if (GetGeomType() != wkbNone &&
-        !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-        return OGRLayer::GetNextArrowArray(stream, out_array);
-
     OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
     if (out_array->release == nullptr)
@@ -3887,16 +3910,44 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return ENOMEM;
     }
 
-    if (!sHelper.m_bIncludeFID)
+    if (sHelper.m_nChildren == 0)
+    {
+        sHelper.ClearArray();
         return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
 
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
-    int nCount = 0;
-    while (iNextShapeId < nTotalShapeCount)
+
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    const int iGeomArrowField =
+        hSHP != nullptr && GetGeomType() != wkbNone
+            ? sHelper.m_mapOGRGeomFieldToArrowField[0]
+            : -1;
+    const OGRwkbGeometryType eLayerGeomType =
+        iGeomArrowField >= 0 ? poFeatureDefn->GetGeomFieldDefn(0)->GetType()
+                             : wkbNone;
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    // Returns false if the memory limit would be exceeded by adding nLen
+    // bytes to the variable-length buffer of psArray.
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const auto FitsInMemLimit =
+        [nMemLimit](const struct ArrowArray *psArray, int iFeat, size_t nLen)
+    {
+        if (iFeat == 0)
+            return true;
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return !(nLen <= nMemLimit && nLen > nMemLimit - nCurLength);
+    };
+
+    int iFeat = 0;
+    while (iNextShapeId < nTotalShapeCount && iFeat < sHelper.m_nMaxBatchSize)
     {
-        const bool bIsDeleted =
-            CPL_TO_BOOL(DBFIsRecordDeleted(hDBF, iNextShapeId));
-        if (bIsDeleted)
+        if (DBFIsRecordDeleted(hDBF, iNextShapeId))
         {
             ++iNextShapeId;
             continue;
@@ -3904,22 +3955,191 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
             VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
         {
-            out_array->release(out_array);
-            memset(out_array, 0, sizeof(*out_array));
+            sHelper.ClearArray();
             return EIO;
         }
-        sHelper.m_panFIDValues[nCount] = iNextShapeId;
-        ++iNextShapeId;
-        ++nCount;
-        if (nCount == sHelper.m_nMaxBatchSize)
+
+        if (sHelper.m_bIncludeFID)
+            sHelper.m_panFIDValues[iFeat] = iNextShapeId;
+
+        if (iGeomArrowField >= 0)
+        {
+            auto psArray = out_array->children[iGeomArrowField];
+            std::unique_ptr<OGRGeometry> poGeom(SHPReadOGRObjectForLayer(
+                hSHP, iNextShapeId, nullptr, eLayerGeomType,
+                m_bHasWarnedWrongWindingOrder));
+            if (poGeom)
+            {
+                const size_t nWKBSize = poGeom->WkbSize();
+                if (!FitsInMemLimit(psArray, iFeat, nWKBSize))
+                    break;
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iGeomArrowField, iFeat))
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+        }
+
+        bool bMemLimitReached = false;
+        for (int iField = 0; iField < nFieldCount; ++iField)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefnUnsafe(iField);
+            auto psArray = out_array->children[iArrowField];
+
+            bool bIsNull = false;
+            switch (poFieldDefn->GetType())
+            {
+                case OFTString:
+                {
+                    const char *pszVal =
+                        DBFReadStringAttribute(hDBF, iNextShapeId, iField);
+                    if (pszVal == nullptr || pszVal[0] == '\0')
+                    {
+                        bIsNull = true;
+                        break;
+                    }
+                    char *pszUTF8 = nullptr;
+                    if (!osEncoding.empty())
+                    {
+                        pszUTF8 = CPLRecode(pszVal, osEncoding, CPL_ENC_UTF8);
+                        pszVal = pszUTF8;
+                    }
+                    const size_t nLen = strlen(pszVal);
+                    if (!FitsInMemLimit(psArray, iFeat, nLen))
+                    {
+                        CPLFree(pszUTF8);
+                        bMemLimitReached = true;
+                        break;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        CPLFree(pszUTF8);
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    memcpy(outPtr, pszVal, nLen);
+                    CPLFree(pszUTF8);
+                    break;
+                }
+
+                case OFTInteger:
+                case OFTInteger64:
+                case OFTReal:
+                {
+                    if (DBFIsAttributeNULL(hDBF, iNextShapeId, iField))
+                    {
+                        bIsNull = true;
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        const char *pszVal =
+                            DBFReadLogicalAttribute(hDBF, iNextShapeId, iField);
+                        if (pszVal[0] == 'T' || pszVal[0] == 't' ||
+                            pszVal[0] == 'Y' || pszVal[0] == 'y')
+                        {
+                            sHelper.SetBoolOn(psArray, iFeat);
+                        }
+                    }
+                    else
+                    {
+                        const char *pszVal =
+                            DBFReadStringAttribute(hDBF, iNextShapeId, iField);
+                        if (poFieldDefn->GetType() == OFTInteger)
+                        {
+                            const long long nVal64 =
+                                std::strtoll(pszVal, nullptr, 10);
+                            sHelper.SetInt32(
+                                psArray, iFeat,
+                                static_cast<int32_t>(std::clamp<long long>(
+                                    nVal64, INT_MIN, INT_MAX)));
+                        }
+                        else if (poFieldDefn->GetType() == OFTInteger64)
+                        {
+                            sHelper.SetInt64(psArray, iFeat,
+                                             CPLAtoGIntBig(pszVal));
+                        }
+                        else
+                        {
+                            sHelper.SetDouble(psArray, iFeat,
+                                              CPLStrtod(pszVal, nullptr));
+                        }
+                    }
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    if (DBFIsAttributeNULL(hDBF, iNextShapeId, iField))
+                    {
+                        bIsNull = true;
+                        break;
+                    }
+
+                    const char *const pszDateValue =
+                        DBFReadStringAttribute(hDBF, iNextShapeId, iField);
+
+                    OGRField sFld;
+                    memset(&sFld, 0, sizeof(sFld));
+
+                    if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
+                        pszDateValue[5] == '/')
+                    {
+                        sFld.Date.Month =
+                            static_cast<GByte>(atoi(pszDateValue + 0));
+                        sFld.Date.Day =
+                            static_cast<GByte>(atoi(pszDateValue + 3));
+                        sFld.Date.Year =
+                            static_cast<GInt16>(atoi(pszDateValue + 6));
+                    }
+                    else
+                    {
+                        const int nFullDate = atoi(pszDateValue);
+                        sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
+                        sFld.Date.Month =
+                            static_cast<GByte>((nFullDate / 100) % 100);
+                        sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
+                    }
+                    sHelper.SetDate(psArray, iFeat, brokenDown, sFld);
+                    break;
+                }
+
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+
+            if (bMemLimitReached)
+                break;
+            if (bIsNull && !sHelper.SetNull(iArrowField, iFeat))
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+        }
+        if (bMemLimitReached)
             break;
+
+        ++iNextShapeId;
+        ++iFeat;
     }
-    sHelper.Shrink(nCount);
-    if (nCount == 0)
-    {
-        out_array->release(out_array);
-        memset(out_array, 0, sizeof(*out_array));
-    }
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+        sHelper.ClearArray();
     return 0;
 }
 
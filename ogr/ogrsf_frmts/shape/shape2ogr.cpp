@@ -1276,6 +1276,53 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                      SHPReadOGRObjectForLayer()                      */
+/************************************************************************/
+
+// Read the geometry of a shape and make its dimension consistent with the
+// geometry type of the layer.
+OGRGeometry *SHPReadOGRObjectForLayer(SHPHandle hSHP, int iShape,
+                                      SHPObject *psShape,
+                                      OGRwkbGeometryType eLayerGeomType,
+                                      bool &bHasWarnedWrongWindingOrder)
+{
+    OGRGeometry *poGeometry =
+        SHPReadOGRObject(hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
+
+    // Two possibilities are expected here (both are tested by
+    // GDAL Autotests):
+    //   1. Read valid geometry and assign it directly.
+    //   2. Read and assign null geometry if it can not be read
+    //      correctly from a shapefile.
+    //
+    // It is NOT required here to test poGeometry == NULL.
+
+    if (poGeometry && eLayerGeomType != wkbUnknown)
+    {
+        // Set/unset flags.
+        const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+        if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+        {
+            poGeometry->set3D(TRUE);
+        }
+        else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+        {
+            poGeometry->set3D(FALSE);
+        }
+        if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+        {
+            poGeometry->setMeasured(TRUE);
+        }
+        else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+        {
+            poGeometry->setMeasured(FALSE);
+        }
+    }
+
+    return poGeometry;
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1283,7 +1330,8 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1307,7 +1355,16 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == poDefn);
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(poDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1316,45 +1373,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         if (!poDefn->IsGeometryIgnored())
         {
-            OGRGeometry *poGeometry = SHPReadOGRObject(
-                hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
-
-            // Two possibilities are expected here (both are tested by
-            // GDAL Autotests):
-            //   1. Read valid geometry and assign it directly.
-            //   2. Read and assign null geometry if it can not be read
-            //      correctly from a shapefile.
-            //
-            // It is NOT required here to test poGeometry == NULL.
-
-            if (poGeometry)
-            {
-                // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
-            }
+            OGRGeometry *poGeometry = SHPReadOGRObjectForLayer(
+                hSHP, iShape, psShape, poDefn->GetGeomFieldDefn(0)->GetType(),
+                bHasWarnedWrongWindingOrder);
 
             poFeature->SetGeometryDirectly(poGeometry);
         }
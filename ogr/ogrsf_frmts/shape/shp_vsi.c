@@ -16,9 +16,14 @@
 #include "cpl_conv.h"
 #include "cpl_vsi_error.h"
 #include <limits.h>
+#include <string.h>
 
 #include "shapefil_private.h"
 
+/* Size of the buffer in which consecutive writes are accumulated before */
+/* being issued to the underlying file. */
+#define SHP_VSI_WRITE_BUFFER_SIZE (256 * 1024)
+
 typedef struct
 {
     VSILFILE *fp;
@@ -26,8 +31,42 @@ typedef struct
     int bEnforce2GBLimit;
     int bHasWarned2GB;
     SAOffset nCurOffset;
+    /* Pending data, that must be written at offset nWriteBufferOffset, */
+    /* which is the current position of fp when nWriteBufferUsed > 0. */
+    /* Only used in update mode. */
+    int bBufferWrites;
+    GByte *pabyWriteBuffer;
+    size_t nWriteBufferUsed;
+    SAOffset nWriteBufferOffset;
 } OGRSHPDBFFile;
 
+/************************************************************************/
+/*                     VSI_SHP_FlushWriteBuffer()                       */
+/************************************************************************/
+
+static int VSI_SHP_FlushWriteBuffer(OGRSHPDBFFile *pFile)
+{
+    const size_t nToWrite = pFile->nWriteBufferUsed;
+    if (nToWrite == 0)
+        return TRUE;
+    pFile->nWriteBufferUsed = 0;
+    if (VSIFWriteL(pFile->pabyWriteBuffer, 1, nToWrite, pFile->fp) !=
+        nToWrite)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failure writing %s",
+                 pFile->pszFilename);
+        pFile->nCurOffset = (SAOffset)VSIFTellL(pFile->fp);
+        return FALSE;
+    }
+    /* The last write may not have been at the end of the buffer */
+    if (pFile->nCurOffset != pFile->nWriteBufferOffset + (SAOffset)nToWrite &&
+        VSIFSeekL(pFile->fp, (vsi_l_offset)pFile->nCurOffset, SEEK_SET) != 0)
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
 /************************************************************************/
 /*                         VSI_SHP_OpenInternal()                       */
 /************************************************************************/
@@ -45,6 +84,8 @@ static SAFile VSI_SHP_OpenInternal(const char *pszFilename,
     pFile->pszFilename = CPLStrdup(pszFilename);
     pFile->bEnforce2GBLimit = bEnforce2GBLimit;
     pFile->nCurOffset = 0;
+    pFile->bBufferWrites = strchr(pszAccess, 'w') != SHPLIB_NULLPTR ||
+                           strchr(pszAccess, '+') != SHPLIB_NULLPTR;
     return (SAFile)pFile;
 }
 
@@ -69,8 +110,10 @@ static SAOffset VSI_SHP_Read(void *p, SAOffset size, SAOffset nmemb,
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
-    SAOffset ret =
-        (SAOffset)VSIFReadL(p, (size_t)size, (size_t)nmemb, pFile->fp);
+    SAOffset ret;
+    if (!VSI_SHP_FlushWriteBuffer(pFile))
+        return 0;
+    ret = (SAOffset)VSIFReadL(p, (size_t)size, (size_t)nmemb, pFile->fp);
     pFile->nCurOffset += ret * size;
     return ret;
 }
@@ -114,8 +157,47 @@ static SAOffset VSI_SHP_Write(const void *p, SAOffset size, SAOffset nmemb,
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
     SAOffset ret;
+    const size_t nBytes = (size_t)(size * nmemb);
     if (!VSI_SHP_WriteMoreDataOK(file, size * nmemb))
         return 0;
+
+    /* Accumulate small writes, which are generally done at the end of */
+    /* the file, one record after another. */
+    if (pFile->bBufferWrites && nBytes < SHP_VSI_WRITE_BUFFER_SIZE)
+    {
+        if (pFile->pabyWriteBuffer == SHPLIB_NULLPTR)
+        {
+            pFile->pabyWriteBuffer =
+                (GByte *)VSI_MALLOC_VERBOSE(SHP_VSI_WRITE_BUFFER_SIZE);
+            if (pFile->pabyWriteBuffer == SHPLIB_NULLPTR)
+                pFile->bBufferWrites = FALSE;
+        }
+        if (pFile->pabyWriteBuffer != SHPLIB_NULLPTR)
+        {
+            size_t nPosInBuffer = 0;
+            if (pFile->nWriteBufferUsed > 0)
+            {
+                nPosInBuffer =
+                    (size_t)(pFile->nCurOffset - pFile->nWriteBufferOffset);
+                if (nPosInBuffer + nBytes > SHP_VSI_WRITE_BUFFER_SIZE)
+                {
+                    if (!VSI_SHP_FlushWriteBuffer(pFile))
+                        return 0;
+                    nPosInBuffer = 0;
+                }
+            }
+            if (pFile->nWriteBufferUsed == 0)
+                pFile->nWriteBufferOffset = pFile->nCurOffset;
+            memcpy(pFile->pabyWriteBuffer + nPosInBuffer, p, nBytes);
+            if (nPosInBuffer + nBytes > pFile->nWriteBufferUsed)
+                pFile->nWriteBufferUsed = nPosInBuffer + nBytes;
+            pFile->nCurOffset += (SAOffset)nBytes;
+            return nmemb;
+        }
+    }
+
+    if (!VSI_SHP_FlushWriteBuffer(pFile))
+        return 0;
     ret = (SAOffset)VSIFWriteL(p, (size_t)size, (size_t)nmemb, pFile->fp);
     pFile->nCurOffset += ret * size;
     return ret;
@@ -129,7 +211,21 @@ static SAOffset VSI_SHP_Seek(SAFile file, SAOffset offset, int whence)
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
-    SAOffset ret = (SAOffset)VSIFSeekL(pFile->fp, (vsi_l_offset)offset, whence);
+    SAOffset ret;
+    /* Seeking within the buffered data, for example to overwrite the */
+    /* end-of-file character of a DBF file when appending a new record, */
+    /* must not interrupt buffered writes */
+    if (whence == SEEK_SET && pFile->nWriteBufferUsed > 0 &&
+        offset >= pFile->nWriteBufferOffset &&
+        offset <= pFile->nWriteBufferOffset +
+                      (SAOffset)pFile->nWriteBufferUsed)
+    {
+        pFile->nCurOffset = offset;
+        return 0;
+    }
+    if (!VSI_SHP_FlushWriteBuffer(pFile))
+        return -1;
+    ret = (SAOffset)VSIFSeekL(pFile->fp, (vsi_l_offset)offset, whence);
     if (whence == 0 && ret == 0)
         pFile->nCurOffset = offset;
     else
@@ -156,6 +252,8 @@ static int VSI_SHP_Flush(SAFile file)
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
+    if (!VSI_SHP_FlushWriteBuffer(pFile))
+        return -1;
     return VSIFFlushL(pFile->fp);
 }
 
@@ -167,7 +265,11 @@ static int VSI_SHP_Close(SAFile file)
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
+    const int bFlushOK = VSI_SHP_FlushWriteBuffer(pFile);
     int ret = VSIFCloseL(pFile->fp);
+    if (!bFlushOK)
+        ret = -1;
+    CPLFree(pFile->pabyWriteBuffer);
     CPLFree(pFile->pszFilename);
     CPLFree(pFile);
     return ret;
@@ -224,6 +326,8 @@ void SASetupDefaultHooks(SAHooks *psHooks)
 VSILFILE *VSI_SHP_GetVSIL(SAFile file)
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
+    /* The caller may directly operate on the file */
+    VSI_SHP_FlushWriteBuffer(pFile);
     return pFile->fp;
 }
 
@@ -185,6 +185,8 @@ class OGRSQLiteLayer CPL_NON_FINAL : public OGRLayer,
     void ClearStatement();
     virtual OGRErr ResetStatement() = 0;
 
+    OGRGeometry *ReadGeometry(OGRSQLiteGeomFieldDefn *poGeomFieldDefn);
+
     bool m_bUseComprGeom = false;
 
     char **m_papszCompressedColumns = nullptr;
@@ -270,6 +272,8 @@ class OGRSQLiteLayer CPL_NON_FINAL : public OGRLayer,
     static OGRErr ExportSpatiaLiteGeometry(const OGRGeometry *, GInt32,
                                            OGRwkbByteOrder, bool,
                                            bool bUseComprGeom, GByte **, int *);
+    static int SpatiaLiteGeometryToWKB(const GByte *pabyData, int nBytes,
+                                       GByte *pabyWKB);
 };
 
 /************************************************************************/
@@ -534,6 +538,8 @@ class OGRSQLiteSelectLayer CPL_NON_FINAL : public OGRSQLiteLayer,
 
     virtual OGRErr ResetStatement() override;
 
+    bool CanUseNativeArrowArray(const CPLStringList &aosOptions);
+
     CPL_DISALLOW_COPY_ASSIGN(OGRSQLiteSelectLayer)
 
   public:
@@ -548,6 +554,9 @@ class OGRSQLiteSelectLayer CPL_NON_FINAL : public OGRSQLiteLayer,
     virtual OGRFeature *GetNextFeature() override;
     virtual GIntBig GetFeatureCount(int) override;
 
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
+
     virtual OGRErr ISetSpatialFilter(int iGeomField,
                                      const OGRGeometry *) override;
     virtual OGRErr SetAttributeFilter(const char *) override;
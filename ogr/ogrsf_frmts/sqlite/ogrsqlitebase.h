@@ -319,6 +319,11 @@ class OGRSQLiteSelectLayerCommonBehaviour
                                         const CPLString &osSQL,
                                         bool bEmptyLayer);
 
+    bool IsEmptyLayer() const
+    {
+        return m_bEmptyLayer;
+    }
+
     void ResetReading();
     OGRFeature *GetNextFeature();
     GIntBig GetFeatureCount(int);
@@ -729,6 +729,77 @@ OGRFeature *OGRSQLiteLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                            ReadGeometry()                            */
+/************************************************************************/
+
+/* Decode the geometry of poGeomFieldDefn from the current row of m_hStmt */
+
+OGRGeometry *
+OGRSQLiteLayer::ReadGeometry(OGRSQLiteGeomFieldDefn *poGeomFieldDefn)
+{
+    OGRGeometry *poGeometry = nullptr;
+    if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKT)
+    {
+        const char *pszWKT = reinterpret_cast<const char *>(
+            sqlite3_column_text(m_hStmt, poGeomFieldDefn->m_iCol));
+        OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeometry);
+    }
+    else if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKB)
+    {
+        const int nBytes =
+            sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
+
+        /* Try as spatialite first since createFromWkb() can sometimes */
+        /* interpret spatialite blobs as WKB for certain SRID values */
+        if (!poGeomFieldDefn->m_bTriedAsSpatiaLite)
+        {
+            /* If the layer is the result of a sql select, we cannot be */
+            /* sure if it is WKB or SpatialLite format */
+            // coverity[tainted_data_return]
+            const GByte *pabyBlob = reinterpret_cast<const GByte *>(
+                sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol));
+            if (ImportSpatiaLiteGeometry(pabyBlob, nBytes, &poGeometry) ==
+                OGRERR_NONE)
+            {
+                poGeomFieldDefn->m_eGeomFormat = OSGF_SpatiaLite;
+            }
+            poGeomFieldDefn->m_bTriedAsSpatiaLite = true;
+        }
+
+        if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKB)
+        {
+            // coverity[tainted_data_return]
+            const void *pabyBlob =
+                sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol);
+            CPL_IGNORE_RET_VAL(OGRGeometryFactory::createFromWkb(
+                pabyBlob, nullptr, &poGeometry, nBytes));
+        }
+    }
+    else if (poGeomFieldDefn->m_eGeomFormat == OSGF_FGF)
+    {
+        const int nBytes =
+            sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
+        // coverity[tainted_data_return]
+        const void *pabyBlob =
+            sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol);
+        OGRGeometryFactory::createFromFgf(pabyBlob, nullptr, &poGeometry,
+                                          nBytes, nullptr);
+    }
+    else if (poGeomFieldDefn->m_eGeomFormat == OSGF_SpatiaLite)
+    {
+        const int nBytes =
+            sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
+        // coverity[tainted_data_return]
+        const GByte *pabyBlob = reinterpret_cast<const GByte *>(
+            sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol));
+        CPL_IGNORE_RET_VAL(
+            ImportSpatiaLiteGeometry(pabyBlob, nBytes, &poGeometry));
+    }
+
+    return poGeometry;
+}
+
 /************************************************************************/
 /*                         GetNextRawFeature()                          */
 /************************************************************************/
@@ -796,67 +867,7 @@ OGRFeature *OGRSQLiteLayer::GetNextRawFeature()
             m_poFeatureDefn->myGetGeomFieldDefn(iField);
         if (!poGeomFieldDefn->IsIgnored())
         {
-            OGRGeometry *poGeometry = nullptr;
-            if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKT)
-            {
-                const char *pszWKT = reinterpret_cast<const char *>(
-                    sqlite3_column_text(m_hStmt, poGeomFieldDefn->m_iCol));
-                OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeometry);
-            }
-            else if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKB)
-            {
-                const int nBytes =
-                    sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
-
-                /* Try as spatialite first since createFromWkb() can sometimes
-                 */
-                /* interpret spatialite blobs as WKB for certain SRID values */
-                if (!poGeomFieldDefn->m_bTriedAsSpatiaLite)
-                {
-                    /* If the layer is the result of a sql select, we cannot be
-                     * sure if it is */
-                    /* WKB or SpatialLite format */
-                    // coverity[tainted_data_return]
-                    const GByte *pabyBlob = reinterpret_cast<const GByte *>(
-                        sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol));
-                    if (ImportSpatiaLiteGeometry(pabyBlob, nBytes,
-                                                 &poGeometry) == OGRERR_NONE)
-                    {
-                        poGeomFieldDefn->m_eGeomFormat = OSGF_SpatiaLite;
-                    }
-                    poGeomFieldDefn->m_bTriedAsSpatiaLite = true;
-                }
-
-                if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKB)
-                {
-                    // coverity[tainted_data_return]
-                    const void *pabyBlob =
-                        sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol);
-                    CPL_IGNORE_RET_VAL(OGRGeometryFactory::createFromWkb(
-                        pabyBlob, nullptr, &poGeometry, nBytes));
-                }
-            }
-            else if (poGeomFieldDefn->m_eGeomFormat == OSGF_FGF)
-            {
-                const int nBytes =
-                    sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
-                // coverity[tainted_data_return]
-                const void *pabyBlob =
-                    sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol);
-                OGRGeometryFactory::createFromFgf(pabyBlob, nullptr,
-                                                  &poGeometry, nBytes, nullptr);
-            }
-            else if (poGeomFieldDefn->m_eGeomFormat == OSGF_SpatiaLite)
-            {
-                const int nBytes =
-                    sqlite3_column_bytes(m_hStmt, poGeomFieldDefn->m_iCol);
-                // coverity[tainted_data_return]
-                const GByte *pabyBlob = reinterpret_cast<const GByte *>(
-                    sqlite3_column_blob(m_hStmt, poGeomFieldDefn->m_iCol));
-                CPL_IGNORE_RET_VAL(
-                    ImportSpatiaLiteGeometry(pabyBlob, nBytes, &poGeometry));
-            }
-
+            OGRGeometry *poGeometry = ReadGeometry(poGeomFieldDefn);
             if (poGeometry != nullptr)
             {
                 if (poGeomFieldDefn->GetSpatialRef() != nullptr)
@@ -2812,6 +2823,138 @@ OGRErr OGRSQLiteLayer::ImportSpatiaLiteGeometry(const GByte *pabyData,
     return eErr;
 }
 
+/************************************************************************/
+/*                        SpatiaLiteBodyToWKB()                         */
+/************************************************************************/
+
+/* Walk a SpatiaLite geometry body, starting at its class type, and */
+/* return the number of bytes it occupies, or -1 if it is not made of */
+/* uncompressed classes only. Those have the layout and type codes of */
+/* ISO WKB, except that the byte order is only in the blob header, and */
+/* that each entity of a collection starts with a 0x69 marker instead. */
+/* When pabyWKB is not null, it must already contain a copy of the body */
+/* shifted by one byte, and the markers are replaced by the byte order. */
+
+static int SpatiaLiteBodyToWKB(const GByte *pabyData, int nBytes,
+                               OGRwkbByteOrder eByteOrder, GByte *pabyWKB,
+                               int nRecLevel)
+{
+    if (nRecLevel == 32 || nBytes < 4)
+        return -1;
+
+    GInt32 nGType = 0;
+    memcpy(&nGType, pabyData, 4);
+    if (NEED_SWAP_SPATIALITE())
+        CPL_SWAP32PTR(&nGType);
+    // Compressed classes (codes above 1000000) are not handled
+    if (nGType < OGRSplitePointXY || nGType > OGRSpliteGeometryCollectionXYZM ||
+        nGType % 1000 < OGRSplitePointXY ||
+        nGType % 1000 > OGRSpliteGeometryCollectionXY)
+        return -1;
+    const int nFlatType = nGType % 1000;
+    const int nDimCode = nGType / 1000;
+    const int nPointSize = (nDimCode == 0 ? 2 : nDimCode == 3 ? 4 : 3) * 8;
+
+    int nOffset = 4;
+    const auto ReadCount = [pabyData, nBytes, eByteOrder, &nOffset](int &nCount)
+    {
+        if (nBytes - nOffset < 4)
+            return false;
+        memcpy(&nCount, pabyData + nOffset, 4);
+        if (NEED_SWAP_SPATIALITE())
+            CPL_SWAP32PTR(&nCount);
+        nOffset += 4;
+        return nCount >= 0;
+    };
+    const auto SkipPoints = [nBytes, nPointSize, &nOffset](int nPoints)
+    {
+        if (nPoints > (nBytes - nOffset) / nPointSize)
+            return false;
+        nOffset += nPoints * nPointSize;
+        return true;
+    };
+
+    if (nFlatType == OGRSplitePointXY)
+    {
+        if (!SkipPoints(1))
+            return -1;
+    }
+    else if (nFlatType == OGRSpliteLineStringXY)
+    {
+        int nPoints = 0;
+        if (!ReadCount(nPoints) || !SkipPoints(nPoints))
+            return -1;
+    }
+    else if (nFlatType == OGRSplitePolygonXY)
+    {
+        int nRings = 0;
+        if (!ReadCount(nRings))
+            return -1;
+        for (int i = 0; i < nRings; ++i)
+        {
+            int nPoints = 0;
+            if (!ReadCount(nPoints) || !SkipPoints(nPoints))
+                return -1;
+        }
+    }
+    else
+    {
+        int nEntities = 0;
+        if (!ReadCount(nEntities))
+            return -1;
+        for (int i = 0; i < nEntities; ++i)
+        {
+            if (nOffset >= nBytes || pabyData[nOffset] != 0x69)
+                return -1;
+            // The entity marker takes the place of the WKB byte order
+            if (pabyWKB)
+                pabyWKB[nOffset + 1] = static_cast<GByte>(eByteOrder);
+            ++nOffset;
+            const int nSubBytes = SpatiaLiteBodyToWKB(
+                pabyData + nOffset, nBytes - nOffset, eByteOrder,
+                pabyWKB ? pabyWKB + nOffset : nullptr, nRecLevel + 1);
+            if (nSubBytes < 0)
+                return -1;
+            nOffset += nSubBytes;
+        }
+    }
+
+    return nOffset;
+}
+
+/************************************************************************/
+/*                      SpatiaLiteGeometryToWKB()                       */
+/************************************************************************/
+
+/* Return the size of the ISO WKB geometry equivalent to a SpatiaLite */
+/* blob, and write it into pabyWKB if not null. Return -1 if the blob */
+/* cannot be converted without going through ImportSpatiaLiteGeometry() */
+
+int OGRSQLiteLayer::SpatiaLiteGeometryToWKB(const GByte *pabyData,
+                                            int nBytes, GByte *pabyWKB)
+{
+    if (!QuickCheckForSpatialiteGeometryValidity(pabyData, nBytes))
+        return -1;
+
+    const OGRwkbByteOrder eByteOrder =
+        static_cast<OGRwkbByteOrder>(pabyData[1]);
+    const int nBodyBytes = SpatiaLiteBodyToWKB(pabyData + 39, nBytes - 39,
+                                               eByteOrder, nullptr, 0);
+    /* The body must only be followed by the end marker, and not by the */
+    /* original curve geometry (see ImportSpatiaLiteGeometry()) */
+    if (nBodyBytes < 0 || 39 + nBodyBytes + 1 != nBytes)
+        return -1;
+
+    if (pabyWKB)
+    {
+        pabyWKB[0] = static_cast<GByte>(eByteOrder);
+        memcpy(pabyWKB + 1, pabyData + 39, nBodyBytes);
+        SpatiaLiteBodyToWKB(pabyData + 39, nBodyBytes, eByteOrder, pabyWKB,
+                            0);
+    }
+    return 1 + nBodyBytes;
+}
+
 /************************************************************************/
 /*                CanBeCompressedSpatialiteGeometry()                   */
 /************************************************************************/
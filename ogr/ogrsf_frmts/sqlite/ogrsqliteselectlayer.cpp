@@ -15,9 +15,14 @@
 #include "cpl_port.h"
 #include "ogr_sqlite.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -25,6 +30,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
+#include "cpl_time.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -33,6 +39,9 @@
 #include "ogrsf_frmts.h"
 #include "sqlite3.h"
 #include "ogr_swq.h"
+#include "ogr_wkb.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 
 /************************************************************************/
 /*                   OGRSQLiteSelectLayerCommonBehaviour()              */
@@ -192,6 +201,453 @@ OGRFeature *OGRSQLiteSelectLayerCommonBehaviour::GetNextFeature()
     return m_poLayer->BaseGetNextFeature();
 }
 
+/************************************************************************/
+/*                       CanUseNativeArrowArray()                       */
+/************************************************************************/
+
+bool OGRSQLiteSelectLayer::CanUseNativeArrowArray(
+    const CPLStringList &aosOptions)
+{
+    if (CPLTestBool(CPLGetConfigOption("OGR_SQLITE_STREAM_BASE_IMPL", "NO")) ||
+        OGRArrowStreamUsesGeoArrowNativeEncoding(aosOptions) ||
+        m_poAttrQuery != nullptr || m_papszCompressedColumns != nullptr)
+    {
+        return false;
+    }
+
+    const bool bDateTimeAsString =
+        aosOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING, false);
+    for (int iField = 0; iField < m_poFeatureDefn->GetFieldCount(); iField++)
+    {
+        const OGRFieldDefn *poFieldDefn =
+            m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+            case OFTInteger64:
+            case OFTReal:
+            case OFTString:
+            case OFTBinary:
+            case OFTDate:
+                break;
+
+            case OFTDateTime:
+                if (bDateTimeAsString)
+                    return false;
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+/* Build Arrow batches directly from the columns of the statement, */
+/* without going through OGRFeature. SpatiaLite and ISO WKB geometry */
+/* blobs are transcoded/copied without instantiating OGRGeometry. */
+
+int OGRSQLiteSelectLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                            struct ArrowArray *out_array)
+{
+    if (!CanUseNativeArrowArray(m_aosArrowArrayStreamOptions))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    int errorErrno = EIO;
+    memset(out_array, 0, sizeof(*out_array));
+
+    if (m_bEOF || m_poBehavior->IsEmptyLayer())
+        return 0;
+
+    if (m_hStmt == nullptr)
+    {
+        ResetStatement();
+        if (m_hStmt == nullptr)
+            return 0;
+    }
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+
+    // Whether appending nBytes to the variable-length buffer of psArray
+    // would exceed the memory limit, in which case the current row is
+    // deferred to the next batch.
+    const auto ExceedsMemLimit =
+        [nMemLimit](const struct ArrowArray *psArray, int iFeat, size_t nBytes)
+    {
+        if (iFeat == 0)
+            return false;
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nBytes <= nMemLimit && nBytes > nMemLimit - nCurLength;
+    };
+
+    // Revert the null counts of the children already processed for a row
+    // that is deferred to the next batch.
+    const auto UndoNullCounts = [out_array](int iFeat)
+    {
+        for (int i = 0; i < static_cast<int>(out_array->n_children); i++)
+        {
+            auto psArray = out_array->children[i];
+            const auto pabyNull =
+                static_cast<const uint8_t *>(psArray->buffers[0]);
+            if (pabyNull && (pabyNull[iFeat / 8] & (1 << (iFeat % 8))) == 0)
+                --psArray->null_count;
+        }
+    };
+
+    // Same logic as GetNextRawFeature()
+    const auto ParseDateTimeField =
+        [this](int iRawField, int nSQLite3Type, OGRField *psField)
+    {
+        if (nSQLite3Type == SQLITE_TEXT)
+        {
+            const char *pszValue = reinterpret_cast<const char *>(
+                sqlite3_column_text(m_hStmt, iRawField));
+            return OGRParseDate(pszValue, psField, 0) != FALSE;
+        }
+        if (nSQLite3Type == SQLITE_FLOAT)
+        {
+            // Julian day, in the range accepted by SQLite strftime()
+            const double dfJulianDay =
+                sqlite3_column_double(m_hStmt, iRawField);
+            if (!(dfJulianDay >= 0 && dfJulianDay <= 5373484.5))
+                return false;
+            const GIntBig nUnixTimeMS = static_cast<GIntBig>(
+                std::floor((dfJulianDay - 2440587.5) * 86400000.0 + 0.5));
+            struct tm sTM;
+            CPLUnixTimeToYMDHMS(static_cast<GIntBig>(std::floor(
+                                    static_cast<double>(nUnixTimeMS) / 1000)),
+                                &sTM);
+            psField->Date.Year = static_cast<GInt16>(sTM.tm_year + 1900);
+            psField->Date.Month = static_cast<GByte>(sTM.tm_mon + 1);
+            psField->Date.Day = static_cast<GByte>(sTM.tm_mday);
+            psField->Date.Hour = static_cast<GByte>(sTM.tm_hour);
+            psField->Date.Minute = static_cast<GByte>(sTM.tm_min);
+            psField->Date.Second = static_cast<float>(sTM.tm_sec);
+            psField->Date.TZFlag = 0;
+            return true;
+        }
+        return false;
+    };
+
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        // Fetch a record (unless otherwise instructed)
+        if (m_bDoStep)
+        {
+            const int rc = sqlite3_step(m_hStmt);
+            if (rc != SQLITE_ROW)
+            {
+                if (rc != SQLITE_DONE)
+                {
+                    sqlite3_reset(m_hStmt);
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "In GetNextArrowArray(): sqlite3_step() : %s",
+                             sqlite3_errmsg(m_poDS->GetDB()));
+                }
+
+                ClearStatement();
+                m_bEOF = true;
+
+                break;
+            }
+        }
+        else
+        {
+            m_bDoStep = true;
+        }
+
+        const GIntBig nFID = m_iFIDCol >= 0
+                                 ? sqlite3_column_int64(m_hStmt, m_iFIDCol)
+                                 : m_iNextShapeId;
+        m_iNextShapeId++;
+        m_nFeaturesRead++;
+
+        // Apply the spatial filter
+        std::unique_ptr<OGRGeometry> poFilterFieldGeom;
+        if (m_poFilterGeom != nullptr)
+        {
+            OGRSQLiteGeomFieldDefn *poGeomFieldDefn =
+                m_poFeatureDefn->myGetGeomFieldDefn(m_iGeomFieldFilter);
+            if (!poGeomFieldDefn->IsIgnored())
+                poFilterFieldGeom.reset(ReadGeometry(poGeomFieldDefn));
+            if (!FilterGeometry(poFilterFieldGeom.get()))
+                continue;
+        }
+
+        if (sHelper.m_panFIDValues)
+        {
+            sHelper.m_panFIDValues[iFeat] = nFID;
+        }
+
+        // Process geometry columns
+        for (int iGeomField = 0; iGeomField < nGeomFieldCount; iGeomField++)
+        {
+            const int iArrowField =
+                sHelper.m_mapOGRGeomFieldToArrowField[iGeomField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            OGRSQLiteGeomFieldDefn *poGeomFieldDefn =
+                m_poFeatureDefn->myGetGeomFieldDefn(iGeomField);
+            const int iCol = poGeomFieldDefn->m_iCol;
+
+            std::unique_ptr<OGRGeometry> poGeom;
+            const GByte *pabyBlob = nullptr;
+            int nBlobSize = 0;
+            size_t nWKBSize = 0;
+            if (poFilterFieldGeom && iGeomField == m_iGeomFieldFilter)
+            {
+                poGeom = std::move(poFilterFieldGeom);
+            }
+            else if (poGeomFieldDefn->m_bTriedAsSpatiaLite &&
+                     sqlite3_column_type(m_hStmt, iCol) == SQLITE_BLOB)
+            {
+                nBlobSize = sqlite3_column_bytes(m_hStmt, iCol);
+                // coverity[tainted_data_return]
+                pabyBlob = static_cast<const GByte *>(
+                    sqlite3_column_blob(m_hStmt, iCol));
+                if (poGeomFieldDefn->m_eGeomFormat == OSGF_SpatiaLite)
+                {
+                    const int nSize =
+                        SpatiaLiteGeometryToWKB(pabyBlob, nBlobSize, nullptr);
+                    if (nSize > 0)
+                        nWKBSize = nSize;
+                }
+                else if (poGeomFieldDefn->m_eGeomFormat == OSGF_WKB)
+                {
+                    // Copy ISO WKB as it is
+                    bool bNeedSwap = false;
+                    uint32_t nType = 0;
+                    OGREnvelope sEnvelope;
+                    if (pabyBlob && OGRWKBGetGeomType(pabyBlob, nBlobSize,
+                                                      bNeedSwap, nType) &&
+                        nType < 4000 &&
+                        OGRWKBGetBoundingBox(pabyBlob, nBlobSize, sEnvelope))
+                    {
+                        nWKBSize = nBlobSize;
+                    }
+                }
+            }
+
+            if (nWKBSize == 0)
+            {
+                pabyBlob = nullptr;
+                if (!poGeom)
+                    poGeom.reset(ReadGeometry(poGeomFieldDefn));
+                if (poGeom)
+                    nWKBSize = poGeom->WkbSize();
+            }
+
+            if (nWKBSize == 0)
+            {
+                if (!sHelper.SetNull(iArrowField, iFeat))
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            if (ExceedsMemLimit(psArray, iFeat, nWKBSize))
+            {
+                UndoNullCounts(iFeat);
+                m_bDoStep = false;
+                m_iNextShapeId--;
+                m_nFeaturesRead--;
+                goto after_loop;
+            }
+
+            GByte *outPtr =
+                sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nWKBSize);
+            if (outPtr == nullptr)
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+            if (poGeom)
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            else if (poGeomFieldDefn->m_eGeomFormat == OSGF_SpatiaLite)
+                SpatiaLiteGeometryToWKB(pabyBlob, nBlobSize, outPtr);
+            else
+                memcpy(outPtr, pabyBlob, nWKBSize);
+        }
+
+        // Process attribute columns
+        for (int iField = 0; iField < sHelper.m_nFieldCount; iField++)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+
+            auto psArray = out_array->children[iArrowField];
+            const int iRawField = m_panFieldOrdinals[iField];
+
+            const int nSQLite3Type = sqlite3_column_type(m_hStmt, iRawField);
+            if (nSQLite3Type == SQLITE_NULL)
+            {
+                if (!sHelper.SetNull(iArrowField, iFeat))
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    const GIntBig nVal =
+                        sqlite3_column_int64(m_hStmt, iRawField);
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (nVal != 0)
+                        {
+                            sHelper.SetBoolOn(psArray, iFeat);
+                        }
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        sHelper.SetInt16(psArray, iFeat,
+                                         static_cast<int16_t>(nVal));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(
+                            psArray, iFeat,
+                            static_cast<int>(std::clamp<GIntBig>(
+                                nVal, INT_MIN, INT_MAX)));
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat,
+                                     sqlite3_column_int64(m_hStmt, iRawField));
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    const double dfVal =
+                        sqlite3_column_double(m_hStmt, iRawField);
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(dfVal));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, dfVal);
+                    }
+                    break;
+                }
+
+                case OFTDate:
+                case OFTDateTime:
+                {
+                    OGRField sField;
+                    if (!ParseDateTimeField(iRawField, nSQLite3Type, &sField))
+                    {
+                        if (!sHelper.SetNull(iArrowField, iFeat))
+                        {
+                            errorErrno = ENOMEM;
+                            goto error;
+                        }
+                    }
+                    else if (poFieldDefn->GetType() == OFTDate)
+                    {
+                        sHelper.SetDate(psArray, iFeat, brokenDown, sField);
+                    }
+                    else
+                    {
+                        sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                            sHelper.m_anTZFlags[iField],
+                                            sField);
+                    }
+                    break;
+                }
+
+                case OFTBinary:
+                case OFTString:
+                {
+                    const bool bIsBinary = poFieldDefn->GetType() == OFTBinary;
+                    // coverity[tainted_data_return]
+                    const void *pData =
+                        bIsBinary ? sqlite3_column_blob(m_hStmt, iRawField)
+                                  : sqlite3_column_text(m_hStmt, iRawField);
+                    const size_t nBytes = static_cast<size_t>(
+                        sqlite3_column_bytes(m_hStmt, iRawField));
+                    if (pData == nullptr || nBytes == 0)
+                    {
+                        sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                        break;
+                    }
+
+                    if (ExceedsMemLimit(psArray, iFeat, nBytes))
+                    {
+                        UndoNullCounts(iFeat);
+                        m_bDoStep = false;
+                        m_iNextShapeId--;
+                        m_nFeaturesRead--;
+                        goto after_loop;
+                    }
+
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nBytes);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    memcpy(outPtr, pData, nBytes);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        ++iFeat;
+    }
+after_loop:
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+        sHelper.ClearArray();
+
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
+
 /************************************************************************/
 /*               OGRGenSQLResultsLayerHasSpecialField()                 */
 /************************************************************************/
@@ -619,6 +1075,8 @@ int OGRSQLiteSelectLayerCommonBehaviour::BuildSQL()
 
 int OGRSQLiteSelectLayer::TestCapability(const char *pszCap)
 {
+    if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return CanUseNativeArrowArray(CPLStringList());
     return m_poBehavior->TestCapability(pszCap);
 }
 
@@ -15,6 +15,7 @@
 #include "cpl_port.h"
 #include "ogrsqlitevirtualogr.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <cstdlib>
@@ -398,6 +399,12 @@ typedef struct
 
     GByte *pabyGeomBLOB;
     int nGeomBLOBLen;
+
+    /* Ignored fields of the layer before OGR2SQLITE_Filter() made the */
+    /* columns not referenced by the statement ignored. Restored on close */
+    bool bIgnoredFieldsSaved;
+    bool bIgnoredFieldsChanged;
+    char **papszSavedIgnoredFields;
 } OGR2SQLITE_vtab_cursor;
 
 #ifdef VIRTUAL_OGR_DYNAMIC_EXTENSION_ENABLED
@@ -785,6 +792,19 @@ static int OGR2SQLITE_ConnectCreate(sqlite3 *hDB, void *pAux, int argc,
     return SQLITE_OK;
 }
 
+/* sqlite3_vtab_in() and friends, to process all values of a IN (...) */
+/* constraint at once, are available since SQLite 3.38 */
+#if SQLITE_VERSION_NUMBER >= 3038000L
+#define OGR2SQLITE_HAS_VTAB_IN
+#endif
+
+/* Pseudo constraint operator stored in idxStr for a column = ? constraint */
+/* that is actually a IN (...) processed at once */
+constexpr int OGR2SQLITE_INDEX_CONSTRAINT_IN_LIST = 1000;
+
+/* Flag of idxNum set when idxStr ends with the colUsed mask */
+constexpr int OGR2SQLITE_IDXNUM_HAS_COLUSED = 1;
+
 /************************************************************************/
 /*                       OGR2SQLITE_IsHandledOp()                       */
 /************************************************************************/
@@ -962,43 +982,62 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
         }
     }
 
-    int *panConstraints = nullptr;
+    // idxStr is [nConstraints, (column, op) * nConstraints] followed, if
+    // idxNum & OGR2SQLITE_IDXNUM_HAS_COLUSED, by the 64 bit mask of the
+    // columns used by the statement, as two 32 bit integers.
+    int *panConstraints = static_cast<int *>(sqlite3_malloc(
+        static_cast<int>(sizeof(int)) * (1 + 2 * nConstraints + 2)));
+    if (panConstraints == nullptr)
+        return SQLITE_NOMEM;
+    panConstraints[0] = nConstraints;
 
-    if (nConstraints)
-    {
-        panConstraints = static_cast<int *>(sqlite3_malloc(
-            static_cast<int>(sizeof(int)) * (1 + 2 * nConstraints)));
-        panConstraints[0] = nConstraints;
+    nConstraints = 0;
 
-        nConstraints = 0;
+#ifdef OGR2SQLITE_HAS_VTAB_IN
+    const bool bCanUseVTabIn = sqlite3_libversion_number() >= 3038000;
+#endif
 
-        for (int i = 0; i < pIndex->nConstraint; i++)
+    for (int i = 0; i < pIndex->nConstraint; i++)
+    {
+        if (pIndex->aConstraintUsage[i].omit)
         {
-            if (pIndex->aConstraintUsage[i].omit)
+            int nOp = pIndex->aConstraint[i].op;
+#ifdef OGR2SQLITE_HAS_VTAB_IN
+            // Ask SQLite to pass us the whole list of values of a
+            // "column IN (...)" constraint, so that it is translated as a
+            // single OGR attribute filter, instead of one per value.
+            if (nOp == SQLITE_INDEX_CONSTRAINT_EQ && bCanUseVTabIn &&
+                sqlite3_vtab_in(pIndex, i, 1))
             {
-                panConstraints[2 * nConstraints + 1] =
-                    pIndex->aConstraint[i].iColumn;
-                panConstraints[2 * nConstraints + 2] =
-                    pIndex->aConstraint[i].op;
-
-                nConstraints++;
+                nOp = OGR2SQLITE_INDEX_CONSTRAINT_IN_LIST;
             }
+#endif
+            panConstraints[2 * nConstraints + 1] =
+                pIndex->aConstraint[i].iColumn;
+            panConstraints[2 * nConstraints + 2] = nOp;
+
+            nConstraints++;
         }
     }
 
     pIndex->orderByConsumed = false;
     pIndex->idxNum = 0;
 
-    if (nConstraints != 0)
-    {
-        pIndex->idxStr = reinterpret_cast<char *>(panConstraints);
-        pIndex->needToFreeIdxStr = true;
-    }
-    else
+#if SQLITE_VERSION_NUMBER >= 3010000L
+    /* SQLite >= 3.10 */
+    if (sqlite3_libversion_number() >= 3010000)
     {
-        pIndex->idxStr = nullptr;
-        pIndex->needToFreeIdxStr = false;
+        const sqlite3_uint64 nColUsed = pIndex->colUsed;
+        panConstraints[2 * nConstraints + 1] =
+            static_cast<int>(static_cast<GUInt32>(nColUsed & 0xFFFFFFFFU));
+        panConstraints[2 * nConstraints + 2] =
+            static_cast<int>(static_cast<GUInt32>(nColUsed >> 32));
+        pIndex->idxNum |= OGR2SQLITE_IDXNUM_HAS_COLUSED;
     }
+#endif
+
+    pIndex->idxStr = reinterpret_cast<char *>(panConstraints);
+    pIndex->needToFreeIdxStr = true;
 
     return SQLITE_OK;
 }
@@ -1080,6 +1119,10 @@ static int OGR2SQLITE_Open(sqlite3_vtab *pVTab, sqlite3_vtab_cursor **ppCursor)
     pCursor->pabyGeomBLOB = nullptr;
     pCursor->nGeomBLOBLen = -1;
 
+    pCursor->bIgnoredFieldsSaved = false;
+    pCursor->bIgnoredFieldsChanged = false;
+    pCursor->papszSavedIgnoredFields = nullptr;
+
     return SQLITE_OK;
 }
 
@@ -1098,6 +1141,13 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
 #endif
     pMyVTab->nMyRef--;
 
+    if (pMyCursor->bIgnoredFieldsChanged)
+    {
+        pMyCursor->poLayer->SetIgnoredFields(
+            pMyCursor->papszSavedIgnoredFields);
+    }
+    CSLDestroy(pMyCursor->papszSavedIgnoredFields);
+
     delete pMyCursor->poFeature;
     delete pMyCursor->poDupDataSource;
 
@@ -1108,13 +1158,148 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
     return SQLITE_OK;
 }
 
+/************************************************************************/
+/*                       OGR2SQLITE_FormatValue()                       */
+/************************************************************************/
+
+/* Format a constraint value as a OGR SQL literal. Return false if it is */
+/* not a integer, real or text value */
+static bool OGR2SQLITE_FormatValue(sqlite3_value *pValue, CPLString &osValue)
+{
+    const auto eSQLiteType = sqlite3_value_type(pValue);
+    if (eSQLiteType == SQLITE_INTEGER)
+    {
+        osValue = CPLSPrintf(CPL_FRMT_GIB, sqlite3_value_int64(pValue));
+    }
+    else if (eSQLiteType == SQLITE_FLOAT)
+    {  // Insure that only Decimal.Points are used, never local settings
+        // such as Decimal.Comma.
+        osValue = CPLSPrintf("%.17g", sqlite3_value_double(pValue));
+    }
+    else if (eSQLiteType == SQLITE_TEXT)
+    {
+        osValue = "'";
+        osValue += SQLEscapeLiteral(
+            reinterpret_cast<const char *>(sqlite3_value_text(pValue)));
+        osValue += "'";
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   OGR2SQLITE_IgnoreUnusedColumns()                   */
+/************************************************************************/
+
+/* Make the fields, geometry fields and style whose columns are not used by */
+/* the statement ignored in the source layer, so that the driver does not */
+/* need to fetch them. Columns on which constraints are pushed as an */
+/* attribute filter are kept. */
+static void
+OGR2SQLITE_IgnoreUnusedColumns(OGR2SQLITE_vtab_cursor *pMyCursor,
+                               GUInt64 nColUsed,
+                               const std::set<int> &oSetConstrainedFields)
+{
+    OGRLayer *poLayer = pMyCursor->poLayer;
+    OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    const int nFieldCount = poFDefn->GetFieldCount();
+    const int nGeomFieldCount = poFDefn->GetGeomFieldCount();
+
+    if (!pMyCursor->bIgnoredFieldsSaved)
+    {
+        CPLStringList aosSaved;
+        for (int i = 0; i < nFieldCount; i++)
+        {
+            const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(i);
+            if (poFieldDefn->IsIgnored())
+                aosSaved.AddString(poFieldDefn->GetNameRef());
+        }
+        for (int i = 0; i < nGeomFieldCount; i++)
+        {
+            const OGRGeomFieldDefn *poGFldDefn = poFDefn->GetGeomFieldDefn(i);
+            if (poGFldDefn->IsIgnored())
+                aosSaved.AddString(i == 0 ? "OGR_GEOMETRY"
+                                          : poGFldDefn->GetNameRef());
+        }
+        if (poFDefn->IsStyleIgnored())
+            aosSaved.AddString("OGR_STYLE");
+        pMyCursor->papszSavedIgnoredFields = aosSaved.StealList();
+        pMyCursor->bIgnoredFieldsSaved = true;
+    }
+
+    // Column of index >= 63 are all represented by the most significant bit
+    const int nOffset = pMyCursor->pVTab->bHasFIDColumn ? 1 : 0;
+    const auto IsColumnUsed = [nColUsed, nOffset](int iCol)
+    {
+        iCol += nOffset;
+        return (nColUsed & (static_cast<GUInt64>(1) << std::min(iCol, 63))) !=
+               0;
+    };
+
+    CPLStringList aosIgnored(
+        CSLDuplicate(pMyCursor->papszSavedIgnoredFields));
+    const int nSavedCount = aosIgnored.size();
+    for (int i = 0; i < nFieldCount; i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(i);
+        if (!IsColumnUsed(i) && oSetConstrainedFields.count(i) == 0 &&
+            aosIgnored.FindString(poFieldDefn->GetNameRef()) < 0)
+        {
+            aosIgnored.AddString(poFieldDefn->GetNameRef());
+        }
+    }
+    if (!IsColumnUsed(nFieldCount) &&
+        aosIgnored.FindString("OGR_STYLE") < 0)
+    {
+        aosIgnored.AddString("OGR_STYLE");
+    }
+    for (int i = 0; i < nGeomFieldCount; i++)
+    {
+        const char *pszName =
+            i == 0 ? "OGR_GEOMETRY"
+                   : poFDefn->GetGeomFieldDefn(i)->GetNameRef();
+        // Skip geometry fields whose name cannot be passed unambiguously
+        // to SetIgnoredFields()
+        if (i > 0 && (pszName[0] == '\0' ||
+                      poFDefn->GetFieldIndex(pszName) >= 0))
+        {
+            continue;
+        }
+        if (!IsColumnUsed(nFieldCount + 1 + i) &&
+            aosIgnored.FindString(pszName) < 0)
+        {
+            aosIgnored.AddString(pszName);
+        }
+    }
+
+    if (aosIgnored.size() != nSavedCount)
+    {
+#ifdef DEBUG_OGR2SQLITE
+        CPLDebug("OGR2SQLITE", "%d ignored fields", aosIgnored.size());
+#endif
+        // On failure, the ignored state may be partially modified
+        pMyCursor->bIgnoredFieldsChanged = true;
+        if (poLayer->SetIgnoredFields(aosIgnored.List()) == OGRERR_NONE)
+            return;
+    }
+
+    if (pMyCursor->bIgnoredFieldsChanged)
+    {
+        poLayer->SetIgnoredFields(pMyCursor->papszSavedIgnoredFields);
+        pMyCursor->bIgnoredFieldsChanged = false;
+    }
+}
+
 /************************************************************************/
 /*                          OGR2SQLITE_Filter()                         */
 /************************************************************************/
 
-static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
-                             CPL_UNUSED int idxNum, const char *idxStr,
-                             int argc, sqlite3_value **argv)
+static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor, int idxNum,
+                             const char *idxStr, int argc,
+                             sqlite3_value **argv)
 {
     OGR2SQLITE_vtab_cursor *pMyCursor =
         reinterpret_cast<OGR2SQLITE_vtab_cursor *>(pCursor);
@@ -1131,6 +1316,7 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
     CPLString osAttributeFilter;
 
     OGRFeatureDefn *poFDefn = pMyCursor->poLayer->GetLayerDefn();
+    std::set<int> oSetConstrainedFields;
 
     for (int i = 0; i < argc; i++)
     {
@@ -1147,6 +1333,7 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
             poFieldDefn = poFDefn->GetFieldDefn(nCol);
             if (poFieldDefn == nullptr)
                 return SQLITE_ERROR;
+            oSetConstrainedFields.insert(nCol);
         }
 
         if (i != 0)
@@ -1236,6 +1423,39 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
                 break;
                 // case SQLITE_INDEX_CONSTRAINT_IS: osAttributeFilter += " IS ";
                 // break;
+#endif
+#ifdef OGR2SQLITE_HAS_VTAB_IN
+            case OGR2SQLITE_INDEX_CONSTRAINT_IN_LIST:
+            {
+                // NULL values never match a IN (...) constraint
+                bExpectRightOperator = false;
+                CPLString osList;
+                sqlite3_value *pValue = nullptr;
+                for (int rc = sqlite3_vtab_in_first(argv[i], &pValue);
+                     rc == SQLITE_OK && pValue != nullptr;
+                     rc = sqlite3_vtab_in_next(argv[i], &pValue))
+                {
+                    CPLString osValue;
+                    if (OGR2SQLITE_FormatValue(pValue, osValue))
+                    {
+                        if (!osList.empty())
+                            osList += ", ";
+                        osList += osValue;
+                    }
+                    else if (sqlite3_value_type(pValue) != SQLITE_NULL)
+                    {
+                        sqlite3_free(pMyCursor->pVTab->zErrMsg);
+                        pMyCursor->pVTab->zErrMsg = sqlite3_mprintf(
+                            "Unhandled constraint data type : %d",
+                            sqlite3_value_type(pValue));
+                        return SQLITE_ERROR;
+                    }
+                }
+                osAttributeFilter += " IN (";
+                osAttributeFilter += osList.empty() ? "NULL" : osList.c_str();
+                osAttributeFilter += ")";
+                break;
+            }
 #endif
             default:
             {
@@ -1250,27 +1470,11 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
         if (bExpectRightOperator)
         {
             const auto eSQLiteType = sqlite3_value_type(argv[i]);
-            if (eSQLiteType == SQLITE_INTEGER)
-            {
-                osAttributeFilter += osOp;
-                osAttributeFilter +=
-                    CPLSPrintf(CPL_FRMT_GIB, sqlite3_value_int64(argv[i]));
-            }
-            else if (eSQLiteType == SQLITE_FLOAT)
-            {  // Insure that only Decimal.Points are used, never local settings
-                // such as Decimal.Comma.
-                osAttributeFilter += osOp;
-                osAttributeFilter +=
-                    CPLSPrintf("%.17g", sqlite3_value_double(argv[i]));
-            }
-            else if (eSQLiteType == SQLITE_TEXT)
+            CPLString osValue;
+            if (OGR2SQLITE_FormatValue(argv[i], osValue))
             {
                 osAttributeFilter += osOp;
-                osAttributeFilter += "'";
-                osAttributeFilter +=
-                    SQLEscapeLiteral(reinterpret_cast<const char *>(
-                        sqlite3_value_text(argv[i])));
-                osAttributeFilter += "'";
+                osAttributeFilter += osValue;
             }
             else if (eSQLiteConstraintOp == SQLITE_INDEX_CONSTRAINT_EQ &&
                      eSQLiteType == SQLITE_NULL)
@@ -1291,6 +1495,17 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
     CPLDebug("OGR2SQLITE", "Attribute filter : %s", osAttributeFilter.c_str());
 #endif
 
+    if ((idxNum & OGR2SQLITE_IDXNUM_HAS_COLUSED) != 0)
+    {
+        const GUInt64 nColUsed =
+            static_cast<GUInt32>(panConstraints[2 * nConstraints + 1]) |
+            (static_cast<GUInt64>(
+                 static_cast<GUInt32>(panConstraints[2 * nConstraints + 2]))
+             << 32);
+        OGR2SQLITE_IgnoreUnusedColumns(pMyCursor, nColUsed,
+                                       oSetConstrainedFields);
+    }
+
     if (pMyCursor->poLayer->SetAttributeFilter(!osAttributeFilter.empty()
                                                    ? osAttributeFilter.c_str()
                                                    : nullptr) != OGRERR_NONE)
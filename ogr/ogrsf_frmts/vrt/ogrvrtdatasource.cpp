@@ -607,6 +607,44 @@ OGRLayer *OGRVRTDataSource::InstantiateUnionLayer(CPLXMLNode *psLTree,
         poLayer->SetFeatureCount(atoi(pszFeatureCount));
     }
 
+    // Set NumThreads if provided.
+    const char *pszNumThreads = CPLGetXMLValue(psLTree, "NumThreads", nullptr);
+    if (pszNumThreads != nullptr)
+    {
+        int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+
+        // Source layers are read by concurrent threads: they must not share
+        // a dataset, which is only guaranteed for OGRVRTLayer elements that
+        // open their own datasource.
+        for (const CPLXMLNode *psSubNode = psLTree->psChild;
+             nNumThreads > 1 && psSubNode != nullptr;
+             psSubNode = psSubNode->psNext)
+        {
+            if (psSubNode->eType != CXT_Element)
+                continue;
+            if ((EQUAL(psSubNode->pszValue, "OGRVRTWarpedLayer") ||
+                 EQUAL(psSubNode->pszValue, "OGRVRTUnionLayer")) ||
+                (EQUAL(psSubNode->pszValue, "OGRVRTLayer") &&
+                 (CPLGetXMLValue(psSubNode, "SrcSQL", nullptr) != nullptr ||
+                  CPLTestBool(CPLGetXMLValue(psSubNode, "SrcDataSource.shared",
+                                             "OFF")))))
+            {
+                CPLDebug("VRT",
+                         "NumThreads ignored for layer %s: one of its "
+                         "source layers is not a OGRVRTLayer with its own "
+                         "datasource",
+                         pszLayerName);
+                nNumThreads = 1;
+            }
+        }
+
+        poLayer->SetNumThreads(
+            nNumThreads,
+            CPLTestBool(CPLGetXMLValue(psLTree, "PreserveSourceOrder", "ON")));
+    }
+
     return poLayer;
 }
 
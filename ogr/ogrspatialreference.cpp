@@ -10162,55 +10162,23 @@ void OSRFreeSRSArray(OGRSpatialReferenceH *pahSRS)
 }
 
 /************************************************************************/
-/*                         FindBestMatch()                              */
+/*                        FindBestMatchUncached()                       */
 /************************************************************************/
 
-/**
- * \brief Try to identify the best match between the passed SRS and a related
- * SRS in a catalog.
- *
- * This is a wrapper over OGRSpatialReference::FindMatches() that takes care
- * of filtering its output.
- * Only matches whose confidence is greater or equal to nMinimumMatchConfidence
- * will be considered. If there is a single match, it is returned.
- * If there are several matches, only return the one under the
- * pszPreferredAuthority, if there is a single one under that authority.
- *
- * @param nMinimumMatchConfidence Minimum match confidence (value between 0 and
- * 100). If set to 0, 90 is used.
- * @param pszPreferredAuthority Preferred CRS authority. If set to nullptr,
- * "EPSG" is used.
- * @param papszOptions NULL terminated list of options or NULL. No option is
- * defined at time of writing.
- *
- * @return a new OGRSpatialReference* object to free with Release(), or nullptr
- *
- * @since GDAL 3.6
- * @see OGRSpatialReference::FindMatches()
- */
-OGRSpatialReference *
-OGRSpatialReference::FindBestMatch(int nMinimumMatchConfidence,
-                                   const char *pszPreferredAuthority,
-                                   CSLConstList papszOptions) const
+static OGRSpatialReference *
+FindBestMatchUncached(const OGRSpatialReference *poThis,
+                      int nMinimumMatchConfidence,
+                      const char *pszPreferredAuthority)
 {
-    TAKE_OPTIONAL_LOCK();
-
-    CPL_IGNORE_RET_VAL(papszOptions);  // ignored for now.
-
-    if (nMinimumMatchConfidence == 0)
-        nMinimumMatchConfidence = 90;
-    if (pszPreferredAuthority == nullptr)
-        pszPreferredAuthority = "EPSG";
-
     // Try to identify the CRS with the database
     int nEntries = 0;
     int *panConfidence = nullptr;
     OGRSpatialReferenceH *pahSRS =
-        FindMatches(nullptr, &nEntries, &panConfidence);
+        poThis->FindMatches(nullptr, &nEntries, &panConfidence);
     if (nEntries == 1 && panConfidence[0] >= nMinimumMatchConfidence)
     {
         std::vector<double> adfTOWGS84(7);
-        if (GetTOWGS84(&adfTOWGS84[0], 7) != OGRERR_NONE)
+        if (poThis->GetTOWGS84(&adfTOWGS84[0], 7) != OGRERR_NONE)
         {
             adfTOWGS84.clear();
         }
@@ -10289,6 +10257,100 @@ OGRSpatialReference::FindBestMatch(int nMinimumMatchConfidence,
     return nullptr;
 }
 
+/************************************************************************/
+/*                         FindBestMatch()                              */
+/************************************************************************/
+
+/**
+ * \brief Try to identify the best match between the passed SRS and a related
+ * SRS in a catalog.
+ *
+ * This is a wrapper over OGRSpatialReference::FindMatches() that takes care
+ * of filtering its output.
+ * Only matches whose confidence is greater or equal to nMinimumMatchConfidence
+ * will be considered. If there is a single match, it is returned.
+ * If there are several matches, only return the one under the
+ * pszPreferredAuthority, if there is a single one under that authority.
+ *
+ * Starting with GDAL 3.11, results are cached for the whole process, so that
+ * identifying again the same CRS, from any thread, is cheap.
+ *
+ * @param nMinimumMatchConfidence Minimum match confidence (value between 0 and
+ * 100). If set to 0, 90 is used.
+ * @param pszPreferredAuthority Preferred CRS authority. If set to nullptr,
+ * "EPSG" is used.
+ * @param papszOptions NULL terminated list of options or NULL. No option is
+ * defined at time of writing.
+ *
+ * @return a new OGRSpatialReference* object to free with Release(), or nullptr
+ *
+ * @since GDAL 3.6
+ * @see OGRSpatialReference::FindMatches()
+ */
+OGRSpatialReference *
+OGRSpatialReference::FindBestMatch(int nMinimumMatchConfidence,
+                                   const char *pszPreferredAuthority,
+                                   CSLConstList papszOptions) const
+{
+    TAKE_OPTIONAL_LOCK();
+
+    CPL_IGNORE_RET_VAL(papszOptions);  // ignored for now.
+
+    if (nMinimumMatchConfidence == 0)
+        nMinimumMatchConfidence = 90;
+    if (pszPreferredAuthority == nullptr)
+        pszPreferredAuthority = "EPSG";
+
+    // Identifying the CRS with the database is costly, and typically done
+    // again and again on the same CRS when opening many shapefiles. Cache
+    // the result, keyed by the WKT2 definition of this CRS.
+    d->refreshProjObj();
+    if (!d->m_pj_crs)
+        return nullptr;
+    auto tlsCache = OSRGetProjTLSCache();
+    std::string osKey;
+    {
+        const char *pszWKT = proj_as_wkt(d->getPROJContext(), d->m_pj_crs,
+                                         PJ_WKT2_2019, nullptr);
+        if (pszWKT)
+        {
+            osKey = CPLSPrintf("%d|%s|", nMinimumMatchConfidence,
+                               pszPreferredAuthority);
+            for (int nAxis : d->m_axisMapping)
+                osKey += CPLSPrintf("%d,", nAxis);
+            osKey += '|';
+            osKey += pszWKT;
+
+            PJ *pj = nullptr;
+            std::vector<int> anMapping;
+            if (tlsCache->GetBestMatch(osKey, pj, anMapping))
+            {
+                if (!pj)
+                    return nullptr;
+                auto poSRS = new OGRSpatialReference();
+                poSRS->d->setPjCRS(pj);
+                if (!anMapping.empty())
+                    poSRS->SetDataAxisToSRSAxisMapping(anMapping);
+                return poSRS;
+            }
+        }
+    }
+
+    auto poRet = FindBestMatchUncached(this, nMinimumMatchConfidence,
+                                       pszPreferredAuthority);
+    if (!osKey.empty())
+    {
+        std::vector<int> anMapping;
+        if (poRet && poRet->GetAxisMappingStrategy() == OAMS_CUSTOM)
+            anMapping = poRet->GetDataAxisToSRSAxisMapping();
+        if (poRet)
+            poRet->d->refreshProjObj();
+        tlsCache->CacheBestMatch(osKey, poRet ? poRet->d->m_pj_crs : nullptr,
+                                 anMapping);
+    }
+    return poRet;
+}
+
 /************************************************************************/
 /*                             SetTOWGS84()                             */
 /************************************************************************/
@@ -10764,6 +10826,7 @@ void OSRCleanup(void)
     CleanupSRSWGS84Mutex();
     OSRCTCleanCache();
     OSRCleanupTLSContext();
+    OSRCleanupGlobalCache();
 }
 
 /************************************************************************/
@@ -37,6 +37,8 @@
 #include "ogr_geometry.h"
 #include "ogrsf_frmts.h"
 
+#include "include_fast_float.h"
+
 // Returns whether a double fits within an int.
 // Unable to put this in cpl_port.h as include limit breaks grib.
 inline bool CPLIsDoubleAnInt(double d)
@@ -450,6 +452,68 @@ const char *OGRWktReadToken(const char *pszInput, char *pszToken)
     return pszInput;
 }
 
+/************************************************************************/
+/*                        OGRWktReadCoordToken()                        */
+/*                                                                      */
+/*      Same as OGRWktReadToken(), but also returns in dfValue the      */
+/*      value of the token when it may be a number. Plain numbers are   */
+/*      directly parsed from the input, which avoids the overhead of    */
+/*      CPLAtof() on the token buffer.                                  */
+/************************************************************************/
+
+static const char *OGRWktReadCoordToken(const char *pszInput, char *pszToken,
+                                        double &dfValue)
+
+{
+    dfValue = 0.0;
+    if (pszInput == nullptr)
+        return nullptr;
+
+    const char *pszStart = pszInput;
+    while (*pszStart == ' ' || *pszStart == '\t' || *pszStart == '\n' ||
+           *pszStart == '\r')
+        ++pszStart;
+
+    if ((*pszStart >= '0' && *pszStart <= '9') || *pszStart == '-' ||
+        *pszStart == '.')
+    {
+        // Only handle tokens made of the characters CPLAtof() would
+        // consider, so that the result is the same.
+        const char *pszEnd = pszStart;
+        while ((*pszEnd >= '0' && *pszEnd <= '9') || *pszEnd == '.' ||
+               *pszEnd == '+' || *pszEnd == '-' || *pszEnd == 'e' ||
+               *pszEnd == 'E')
+        {
+            ++pszEnd;
+        }
+        const size_t nLen = static_cast<size_t>(pszEnd - pszStart);
+        if (nLen < OGR_WKT_TOKEN_MAX - 1 &&
+            !((*pszEnd >= 'a' && *pszEnd <= 'z') ||
+              (*pszEnd >= 'A' && *pszEnd <= 'Z')))
+        {
+            auto answer = fast_float::from_chars(pszStart, pszEnd, dfValue);
+            if (answer.ec == std::errc() && answer.ptr == pszEnd)
+            {
+                memcpy(pszToken, pszStart, nLen);
+                pszToken[nLen] = '\0';
+                while (*pszEnd == ' ' || *pszEnd == '\t' || *pszEnd == '\n' ||
+                       *pszEnd == '\r')
+                    ++pszEnd;
+                return pszEnd;
+            }
+            dfValue = 0.0;
+        }
+    }
+
+    pszInput = OGRWktReadToken(pszInput, pszToken);
+    if (pszToken[0] != '\0' && pszToken[0] != '(' && pszToken[0] != ')' &&
+        pszToken[0] != ',')
+    {
+        dfValue = CPLAtof(pszToken);
+    }
+    return pszInput;
+}
+
 /************************************************************************/
 /*                          OGRWktReadPoints()                          */
 /*                                                                      */
@@ -493,6 +557,7 @@ const char *OGRWktReadPoints(const char *pszInput, OGRRawPoint **ppaoPoints,
     /*      encountered.                                                    */
     /* ==================================================================== */
     char szDelim[OGR_WKT_TOKEN_MAX] = {};
+    double dfDelim = 0;
 
     do
     {
@@ -504,8 +569,10 @@ const char *OGRWktReadPoints(const char *pszInput, OGRRawPoint **ppaoPoints,
         char szTokenX[OGR_WKT_TOKEN_MAX] = {};
         char szTokenY[OGR_WKT_TOKEN_MAX] = {};
 
-        pszInput = OGRWktReadToken(pszInput, szTokenX);
-        pszInput = OGRWktReadToken(pszInput, szTokenY);
+        double dfX = 0;
+        double dfY = 0;
+        pszInput = OGRWktReadCoordToken(pszInput, szTokenX, dfX);
+        pszInput = OGRWktReadCoordToken(pszInput, szTokenY, dfY);
 
         if ((!isdigit(static_cast<unsigned char>(szTokenX[0])) &&
              szTokenX[0] != '-' && szTokenX[0] != '.') ||
@@ -536,15 +603,15 @@ const char *OGRWktReadPoints(const char *pszInput, OGRRawPoint **ppaoPoints,
         /*      Add point to list. */
         /* --------------------------------------------------------------------
          */
-        (*ppaoPoints)[*pnPointsRead].x = CPLAtof(szTokenX);
-        (*ppaoPoints)[*pnPointsRead].y = CPLAtof(szTokenY);
+        (*ppaoPoints)[*pnPointsRead].x = dfX;
+        (*ppaoPoints)[*pnPointsRead].y = dfY;
 
         /* --------------------------------------------------------------------
          */
         /*      Do we have a Z coordinate? */
         /* --------------------------------------------------------------------
          */
-        pszInput = OGRWktReadToken(pszInput, szDelim);
+        pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
 
         if (isdigit(static_cast<unsigned char>(szDelim[0])) ||
             szDelim[0] == '-' || szDelim[0] == '.')
@@ -555,9 +622,9 @@ const char *OGRWktReadPoints(const char *pszInput, OGRRawPoint **ppaoPoints,
                     CPLCalloc(sizeof(double), *pnMaxPoints));
             }
 
-            (*ppadfZ)[*pnPointsRead] = CPLAtof(szDelim);
+            (*ppadfZ)[*pnPointsRead] = dfDelim;
 
-            pszInput = OGRWktReadToken(pszInput, szDelim);
+            pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
         }
         else if (*ppadfZ != nullptr)
         {
@@ -575,7 +642,7 @@ const char *OGRWktReadPoints(const char *pszInput, OGRRawPoint **ppaoPoints,
         if (isdigit(static_cast<unsigned char>(szDelim[0])) ||
             szDelim[0] == '-' || szDelim[0] == '.')
         {
-            pszInput = OGRWktReadToken(pszInput, szDelim);
+            pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
         }
 
         /* --------------------------------------------------------------------
@@ -642,6 +709,7 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
     /*      encountered.                                                    */
     /* ==================================================================== */
     char szDelim[OGR_WKT_TOKEN_MAX] = {};
+    double dfDelim = 0;
 
     do
     {
@@ -653,8 +721,10 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
         char szTokenX[OGR_WKT_TOKEN_MAX] = {};
         char szTokenY[OGR_WKT_TOKEN_MAX] = {};
 
-        pszInput = OGRWktReadToken(pszInput, szTokenX);
-        pszInput = OGRWktReadToken(pszInput, szTokenY);
+        double dfX = 0;
+        double dfY = 0;
+        pszInput = OGRWktReadCoordToken(pszInput, szTokenX, dfX);
+        pszInput = OGRWktReadCoordToken(pszInput, szTokenY, dfY);
 
         if ((!isdigit(static_cast<unsigned char>(szTokenX[0])) &&
              szTokenX[0] != '-' && szTokenX[0] != '.' &&
@@ -693,15 +763,15 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
         /*      Add point to list. */
         /* --------------------------------------------------------------------
          */
-        (*ppaoPoints)[*pnPointsRead].x = CPLAtof(szTokenX);
-        (*ppaoPoints)[*pnPointsRead].y = CPLAtof(szTokenY);
+        (*ppaoPoints)[*pnPointsRead].x = dfX;
+        (*ppaoPoints)[*pnPointsRead].y = dfY;
 
         /* --------------------------------------------------------------------
          */
         /*      Read the next token. */
         /* --------------------------------------------------------------------
          */
-        pszInput = OGRWktReadToken(pszInput, szDelim);
+        pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
 
         /* --------------------------------------------------------------------
          */
@@ -734,8 +804,8 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
             if (isdigit(static_cast<unsigned char>(szDelim[0])) ||
                 szDelim[0] == '-' || szDelim[0] == '.' || EQUAL(szDelim, "nan"))
             {
-                (*ppadfZ)[*pnPointsRead] = CPLAtof(szDelim);
-                pszInput = OGRWktReadToken(pszInput, szDelim);
+                (*ppadfZ)[*pnPointsRead] = dfDelim;
+                pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
             }
             else
             {
@@ -765,7 +835,7 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
             }
             else
             {
-                pszInput = OGRWktReadToken(pszInput, szDelim);
+                pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
             }
         }
 
@@ -786,8 +856,8 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
             if (isdigit(static_cast<unsigned char>(szDelim[0])) ||
                 szDelim[0] == '-' || szDelim[0] == '.' || EQUAL(szDelim, "nan"))
             {
-                (*ppadfM)[*pnPointsRead] = CPLAtof(szDelim);
-                pszInput = OGRWktReadToken(pszInput, szDelim);
+                (*ppadfM)[*pnPointsRead] = dfDelim;
+                pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
             }
             else
             {
@@ -818,8 +888,8 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
                     CPLCalloc(sizeof(double), *pnMaxPoints));
             }
             (*ppadfZ)[*pnPointsRead] = (*ppadfM)[*pnPointsRead];
-            (*ppadfM)[*pnPointsRead] = CPLAtof(szDelim);
-            pszInput = OGRWktReadToken(pszInput, szDelim);
+            (*ppadfM)[*pnPointsRead] = dfDelim;
+            pszInput = OGRWktReadCoordToken(pszInput, szDelim, dfDelim);
         }
 
         /* --------------------------------------------------------------------
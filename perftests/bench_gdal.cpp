@@ -0,0 +1,895 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Benchmark suite of core raster and vector code paths
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_minixml.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "gdal_utils.h"
+#include "ogrsf_frmts.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/************************************************************************/
+/*                            BenchContext                              */
+/************************************************************************/
+
+namespace
+{
+struct BenchContext
+{
+    // Directory where files of benchmarks are created
+    std::string osTmpDir{};
+
+    // Divides the size of synthetic datasets, to quickly check that the
+    // benchmarks run.
+    int nScale = 1;
+};
+
+/** Run one iteration and return the number of processed units. */
+using BenchRunFunc = std::function<double()>;
+
+/************************************************************************/
+/*                              Benchmark                               */
+/************************************************************************/
+
+struct Benchmark
+{
+    std::string osName{};
+
+    // Unit of the throughput: "bytes", "pixels", "features", ...
+    std::string osUnit{};
+
+    // Create the data needed by the benchmark and return the function that
+    // runs one iteration, or an empty function if the benchmark cannot run
+    // in this build (missing driver, ...). Resources are released when the
+    // returned function is destroyed.
+    std::function<BenchRunFunc(const BenchContext &)> setup{};
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       CreateSyntheticRaster()                        */
+/************************************************************************/
+
+/** Create an in-memory raster with reproducible content: a smooth gradient
+ * with pseudo-random noise, generated with a fixed seed. */
+static std::unique_ptr<GDALDataset> CreateSyntheticRaster(GDALDataType eDT,
+                                                          int nXSize,
+                                                          int nYSize,
+                                                          int nBands)
+{
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDriver)
+        return nullptr;
+    std::unique_ptr<GDALDataset> poDS(
+        poMEMDriver->Create("", nXSize, nYSize, nBands, eDT, nullptr));
+    if (!poDS)
+        return nullptr;
+    double adfGT[6] = {0, 1, 0, static_cast<double>(nYSize), 0, -1};
+    poDS->SetGeoTransform(adfGT);
+
+    // Values in [0, 250], to be valid for all data types
+    std::minstd_rand oRand(42);
+    std::vector<double> adfLine(nXSize);
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        auto poBand = poDS->GetRasterBand(iBand);
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                adfLine[iX] = (static_cast<double>(iX) / nXSize * 100 +
+                               static_cast<double>(iY) / nYSize * 100 +
+                               iBand * 10) +
+                              static_cast<double>(oRand() % 21);
+            }
+            if (poBand->RasterIO(GF_Write, 0, iY, nXSize, 1, adfLine.data(),
+                                 nXSize, 1, GDT_Float64, 0, 0,
+                                 nullptr) != CE_None)
+                return nullptr;
+        }
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                        GetDataTypeNameLower()                        */
+/************************************************************************/
+
+static std::string GetDataTypeNameLower(GDALDataType eDT)
+{
+    return CPLString(GDALGetDataTypeName(eDT)).tolower();
+}
+
+/************************************************************************/
+/*                        AddCopyWordsBenchmarks()                      */
+/************************************************************************/
+
+static void AddCopyWordsBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    const std::pair<GDALDataType, GDALDataType> aeDTs[] = {
+        {GDT_Byte, GDT_Byte},       {GDT_Byte, GDT_UInt16},
+        {GDT_Byte, GDT_Float32},    {GDT_UInt16, GDT_Byte},
+        {GDT_UInt16, GDT_Float64},  {GDT_Int16, GDT_Float32},
+        {GDT_Float32, GDT_Byte},    {GDT_Float32, GDT_Int16},
+        {GDT_Float32, GDT_Float64}, {GDT_Float64, GDT_Float32},
+        {GDT_Float64, GDT_Byte},
+    };
+    for (const auto &[eSrcDT, eDstDT] : aeDTs)
+    {
+        for (const bool bStrided : {false, true})
+        {
+            Benchmark oBench;
+            oBench.osName = "copywords/" + GetDataTypeNameLower(eSrcDT) +
+                            "_to_" + GetDataTypeNameLower(eDstDT) +
+                            (bStrided ? "_strided" : "");
+            oBench.osUnit = "words";
+            oBench.setup = [eSrcDT = eSrcDT, eDstDT = eDstDT,
+                            bStrided](const BenchContext &oCtxt)
+            {
+                const size_t nWords = (16 * 1024 * 1024) / oCtxt.nScale;
+                const int nSrcSize = GDALGetDataTypeSizeBytes(eSrcDT);
+                const int nDstSize = GDALGetDataTypeSizeBytes(eDstDT);
+                // Strided output, as when writing a band of a pixel
+                // interleaved buffer of 3 bands.
+                const int nDstStride = bStrided ? 3 * nDstSize : nDstSize;
+                auto pabySrc =
+                    std::make_shared<std::vector<GByte>>(nWords * nSrcSize);
+                auto pabyDst =
+                    std::make_shared<std::vector<GByte>>(nWords * nDstStride);
+                std::minstd_rand oRand(42);
+                std::vector<double> adfVal(nWords);
+                for (auto &dfVal : adfVal)
+                    dfVal = static_cast<double>(oRand() % 251);
+                GDALCopyWords64(adfVal.data(), GDT_Float64, sizeof(double),
+                                pabySrc->data(), eSrcDT, nSrcSize,
+                                static_cast<GPtrDiff_t>(nWords));
+                return BenchRunFunc(
+                    [=]()
+                    {
+                        GDALCopyWords64(pabySrc->data(), eSrcDT, nSrcSize,
+                                        pabyDst->data(), eDstDT, nDstStride,
+                                        static_cast<GPtrDiff_t>(nWords));
+                        return static_cast<double>(nWords);
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+    }
+}
+
+/************************************************************************/
+/*                       AddBlockCacheBenchmarks()                      */
+/************************************************************************/
+
+static void AddBlockCacheBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    std::vector<int> anThreads{1, 4};
+    if (CPLGetNumCPUs() > 4)
+        anThreads.push_back(CPLGetNumCPUs());
+    for (const int nThreads : anThreads)
+    {
+        Benchmark oBench;
+        oBench.osName =
+            "block_cache/read_blocks_threads_" + std::to_string(nThreads);
+        oBench.osUnit = "pixels";
+        oBench.setup = [nThreads](const BenchContext &oCtxt)
+        {
+            const int nSize = 4096 / oCtxt.nScale;
+            auto poGTiffDriver =
+                GetGDALDriverManager()->GetDriverByName("GTiff");
+            if (!poGTiffDriver)
+                return BenchRunFunc();
+            auto poSrcDS = CreateSyntheticRaster(GDT_Byte, nSize, nSize, 1);
+            if (!poSrcDS)
+                return BenchRunFunc();
+            const std::string osFilename = CPLFormFilenameSafe(
+                oCtxt.osTmpDir.c_str(), "block_cache.tif", nullptr);
+            const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=64",
+                                               "BLOCKYSIZE=64", nullptr};
+            std::unique_ptr<GDALDataset>(
+                poGTiffDriver->CreateCopy(osFilename.c_str(), poSrcDS.get(),
+                                          false, apszOptions, nullptr,
+                                          nullptr))
+                .reset();
+
+            // Each thread has its own dataset, but they all share the global
+            // block cache, which is large enough for the raster, so that
+            // after the first iteration, only the cache is exercised.
+            auto apoDS =
+                std::make_shared<std::vector<std::unique_ptr<GDALDataset>>>();
+            for (int i = 0; i < nThreads; ++i)
+            {
+                apoDS->emplace_back(
+                    GDALDataset::Open(osFilename.c_str(),
+                                      GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+                if (!apoDS->back())
+                    return BenchRunFunc();
+            }
+            return BenchRunFunc(
+                [apoDS, nSize]()
+                {
+                    std::vector<std::thread> aoThreads;
+                    for (size_t i = 0; i < apoDS->size(); ++i)
+                    {
+                        aoThreads.emplace_back(
+                            [poDS = (*apoDS)[i].get(), i]()
+                            {
+                                auto poBand = poDS->GetRasterBand(1);
+                                int nBlockXSize = 0;
+                                int nBlockYSize = 0;
+                                poBand->GetBlockSize(&nBlockXSize,
+                                                     &nBlockYSize);
+                                const int nBlocksX =
+                                    poDS->GetRasterXSize() / nBlockXSize;
+                                const int nBlocksY =
+                                    poDS->GetRasterYSize() / nBlockYSize;
+                                // Start at a different block in each thread
+                                const int nBlocks = nBlocksX * nBlocksY;
+                                for (int j = 0; j < nBlocks; ++j)
+                                {
+                                    const int iBlock =
+                                        static_cast<int>((j + i * 7) %
+                                                         nBlocks);
+                                    auto poBlock = poBand->GetLockedBlockRef(
+                                        iBlock % nBlocksX, iBlock / nBlocksX);
+                                    if (poBlock)
+                                        poBlock->DropLock();
+                                }
+                            });
+                    }
+                    for (auto &oThread : aoThreads)
+                        oThread.join();
+                    return static_cast<double>(nSize) * nSize * apoDS->size();
+                });
+        };
+        aoBenchmarks.push_back(std::move(oBench));
+    }
+}
+
+/************************************************************************/
+/*                          AddCOGBenchmarks()                          */
+/************************************************************************/
+
+static void AddCOGBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    for (const char *pszNumThreads : {"1", "ALL_CPUS"})
+    {
+        const std::string osSuffix =
+            std::string("_num_threads_") + CPLString(pszNumThreads).tolower();
+        {
+            Benchmark oBench;
+            oBench.osName = "cog/write_deflate" + osSuffix;
+            oBench.osUnit = "pixels";
+            oBench.setup = [pszNumThreads](const BenchContext &oCtxt)
+            {
+                const int nSize = 4096 / oCtxt.nScale;
+                auto poCOGDriver =
+                    GetGDALDriverManager()->GetDriverByName("COG");
+                if (!poCOGDriver)
+                    return BenchRunFunc();
+                std::shared_ptr<GDALDataset> poSrcDS =
+                    CreateSyntheticRaster(GDT_Byte, nSize, nSize, 3);
+                if (!poSrcDS)
+                    return BenchRunFunc();
+                const std::string osFilename = CPLFormFilenameSafe(
+                    oCtxt.osTmpDir.c_str(), "cog_write.tif", nullptr);
+                return BenchRunFunc(
+                    [poCOGDriver, poSrcDS, osFilename, pszNumThreads, nSize]()
+                    {
+                        CPLStringList aosOptions;
+                        aosOptions.SetNameValue("COMPRESS", "DEFLATE");
+                        aosOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+                        std::unique_ptr<GDALDataset> poDstDS(
+                            poCOGDriver->CreateCopy(
+                                osFilename.c_str(), poSrcDS.get(), false,
+                                aosOptions.List(), nullptr, nullptr));
+                        return poDstDS ? 3.0 * nSize * nSize : 0.0;
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+        {
+            Benchmark oBench;
+            oBench.osName = "cog/read_deflate" + osSuffix;
+            oBench.osUnit = "pixels";
+            oBench.setup = [pszNumThreads](const BenchContext &oCtxt)
+            {
+                const int nSize = 4096 / oCtxt.nScale;
+                auto poCOGDriver =
+                    GetGDALDriverManager()->GetDriverByName("COG");
+                if (!poCOGDriver)
+                    return BenchRunFunc();
+                auto poSrcDS = CreateSyntheticRaster(GDT_Byte, nSize, nSize, 3);
+                if (!poSrcDS)
+                    return BenchRunFunc();
+                const std::string osFilename = CPLFormFilenameSafe(
+                    oCtxt.osTmpDir.c_str(), "cog_read.tif", nullptr);
+                const char *const apszOptions[] = {"COMPRESS=DEFLATE",
+                                                   nullptr};
+                std::unique_ptr<GDALDataset>(
+                    poCOGDriver->CreateCopy(osFilename.c_str(), poSrcDS.get(),
+                                            false, apszOptions, nullptr,
+                                            nullptr))
+                    .reset();
+                auto pabyBuffer =
+                    std::make_shared<std::vector<GByte>>(3 * nSize * nSize);
+                return BenchRunFunc(
+                    [osFilename, pszNumThreads, pabyBuffer, nSize]()
+                    {
+                        const char *const apszOpenOptions[] = {
+                            CPLSPrintf("NUM_THREADS=%s", pszNumThreads),
+                            nullptr};
+                        std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+                            osFilename.c_str(),
+                            GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr,
+                            apszOpenOptions, nullptr));
+                        if (!poDS ||
+                            poDS->RasterIO(GF_Read, 0, 0, nSize, nSize,
+                                           pabyBuffer->data(), nSize, nSize,
+                                           GDT_Byte, 3, nullptr, 0, 0, 0,
+                                           nullptr) != CE_None)
+                            return 0.0;
+                        return 3.0 * nSize * nSize;
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+    }
+}
+
+/************************************************************************/
+/*                         AddWarpBenchmarks()                          */
+/************************************************************************/
+
+static void AddWarpBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    for (const char *pszResampling :
+         {"near", "bilinear", "cubic", "lanczos", "average", "mode"})
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+        {
+            Benchmark oBench;
+            oBench.osName = std::string("warp/") + pszResampling + "_" +
+                            GetDataTypeNameLower(eDT);
+            oBench.osUnit = "pixels";
+            oBench.setup = [pszResampling, eDT](const BenchContext &oCtxt)
+            {
+                const int nSrcSize = 2048 / oCtxt.nScale;
+                // Non-integer factor, so that all kernel weights are
+                // exercised.
+                const int nDstSize = nSrcSize * 3 / 4;
+                auto poSrcDS = std::shared_ptr<GDALDataset>(
+                    CreateSyntheticRaster(eDT, nSrcSize, nSrcSize, 1));
+                if (!poSrcDS)
+                    return BenchRunFunc();
+                CPLStringList aosArgv;
+                aosArgv.AddString("-of");
+                aosArgv.AddString("MEM");
+                aosArgv.AddString("-r");
+                aosArgv.AddString(pszResampling);
+                aosArgv.AddString("-ts");
+                aosArgv.AddString(CPLSPrintf("%d", nDstSize));
+                aosArgv.AddString(CPLSPrintf("%d", nDstSize));
+                auto psOptions = std::shared_ptr<GDALWarpAppOptions>(
+                    GDALWarpAppOptionsNew(aosArgv.List(), nullptr),
+                    GDALWarpAppOptionsFree);
+                if (!psOptions)
+                    return BenchRunFunc();
+                return BenchRunFunc(
+                    [poSrcDS, psOptions, nDstSize]()
+                    {
+                        GDALDatasetH hSrcDS =
+                            GDALDataset::ToHandle(poSrcDS.get());
+                        std::unique_ptr<GDALDataset> poDstDS(
+                            GDALDataset::FromHandle(
+                                GDALWarp("", nullptr, 1, &hSrcDS,
+                                         psOptions.get(), nullptr)));
+                        return poDstDS ? static_cast<double>(nDstSize) *
+                                             nDstSize
+                                       : 0.0;
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+    }
+}
+
+/************************************************************************/
+/*                        AddOverviewBenchmarks()                       */
+/************************************************************************/
+
+static void AddOverviewBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    for (const char *pszResampling :
+         {"NEAREST", "AVERAGE", "BILINEAR", "CUBIC", "LANCZOS", "MODE"})
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+        {
+            Benchmark oBench;
+            oBench.osName = "overview/" +
+                            CPLString(pszResampling).tolower() + "_" +
+                            GetDataTypeNameLower(eDT);
+            oBench.osUnit = "pixels";
+            oBench.setup = [pszResampling, eDT](const BenchContext &oCtxt)
+            {
+                const int nSrcSize = 4096 / oCtxt.nScale;
+                const int nDstSize = nSrcSize / 2;
+                std::shared_ptr<GDALDataset> poSrcDS =
+                    CreateSyntheticRaster(eDT, nSrcSize, nSrcSize, 1);
+                std::shared_ptr<GDALDataset> poDstDS =
+                    CreateSyntheticRaster(eDT, nDstSize, nDstSize, 1);
+                if (!poSrcDS || !poDstDS)
+                    return BenchRunFunc();
+                return BenchRunFunc(
+                    [poSrcDS, poDstDS, pszResampling, nSrcSize]()
+                    {
+                        GDALRasterBandH hDstBand =
+                            GDALRasterBand::ToHandle(poDstDS->GetRasterBand(1));
+                        if (GDALRegenerateOverviewsEx(
+                                GDALRasterBand::ToHandle(
+                                    poSrcDS->GetRasterBand(1)),
+                                1, &hDstBand, pszResampling, nullptr, nullptr,
+                                nullptr) != CE_None)
+                            return 0.0;
+                        return static_cast<double>(nSrcSize) * nSrcSize;
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+    }
+}
+
+/************************************************************************/
+/*                        WriteSyntheticLayer()                         */
+/************************************************************************/
+
+/** Write nFeatures points with a few attribute fields, with reproducible
+ * content, in a new dataset. */
+static bool WriteSyntheticLayer(GDALDriver *poDriver,
+                                const std::string &osFilename, int nFeatures)
+{
+    VSIUnlink(osFilename.c_str());
+    std::unique_ptr<GDALDataset> poDS(
+        poDriver->Create(osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+    if (!poDS)
+        return false;
+    CPLStringList aosLCO;
+    if (EQUAL(poDriver->GetDescription(), "CSV"))
+        aosLCO.SetNameValue("GEOMETRY", "AS_XY");
+    auto poLayer = poDS->CreateLayer("bench", nullptr, wkbPoint, aosLCO.List());
+    if (!poLayer)
+        return false;
+    OGRFieldDefn oFieldInt("int_field", OFTInteger);
+    OGRFieldDefn oFieldReal("real_field", OFTReal);
+    OGRFieldDefn oFieldStr("str_field", OFTString);
+    oFieldStr.SetWidth(32);
+    if (poLayer->CreateField(&oFieldInt) != OGRERR_NONE ||
+        poLayer->CreateField(&oFieldReal) != OGRERR_NONE ||
+        poLayer->CreateField(&oFieldStr) != OGRERR_NONE)
+        return false;
+
+    const bool bTransaction =
+        poDS->TestCapability(ODsCTransactions) &&
+        poDS->StartTransaction() == OGRERR_NONE;
+    std::minstd_rand oRand(42);
+    OGRFeature oFeature(poLayer->GetLayerDefn());
+    for (int i = 0; i < nFeatures; ++i)
+    {
+        oFeature.SetFID(OGRNullFID);
+        oFeature.SetField(0, static_cast<int>(oRand() % 1000000));
+        oFeature.SetField(1, static_cast<double>(oRand() % 1000000) / 1000);
+        oFeature.SetField(2, CPLSPrintf("value_%d", i));
+        oFeature.SetGeometry(std::make_unique<OGRPoint>(
+            static_cast<double>(oRand() % 360000) / 1000 - 180,
+            static_cast<double>(oRand() % 180000) / 1000 - 90));
+        if (poLayer->CreateFeature(&oFeature) != OGRERR_NONE)
+            return false;
+    }
+    if (bTransaction && poDS->CommitTransaction() != OGRERR_NONE)
+        return false;
+    return poDS->Close() == CE_None;
+}
+
+/************************************************************************/
+/*                       AddVectorBenchmarks()                          */
+/************************************************************************/
+
+static void AddVectorBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    const std::pair<const char *, const char *> apszDrivers[] = {
+        {"GPKG", "gpkg"},         {"ESRI Shapefile", "shp"},
+        {"FlatGeobuf", "fgb"},    {"Parquet", "parquet"},
+        {"CSV", "csv"},           {"GeoJSON", "geojson"},
+    };
+    for (const auto &[pszDriver, pszExt] : apszDrivers)
+    {
+        const std::string osShortName =
+            CPLString(pszDriver).tolower().replaceAll(' ', '_');
+        const auto GetFilename =
+            [pszExt = pszExt](const BenchContext &oCtxt, const char *pszBase)
+        {
+            return CPLFormFilenameSafe(oCtxt.osTmpDir.c_str(), pszBase,
+                                       pszExt);
+        };
+        {
+            Benchmark oBench;
+            oBench.osName = "ogr/" + osShortName + "_write";
+            oBench.osUnit = "features";
+            oBench.setup = [pszDriver = pszDriver,
+                            GetFilename](const BenchContext &oCtxt)
+            {
+                auto poDriver =
+                    GetGDALDriverManager()->GetDriverByName(pszDriver);
+                if (!poDriver)
+                    return BenchRunFunc();
+                const int nFeatures = 200 * 1000 / oCtxt.nScale;
+                const std::string osFilename = GetFilename(oCtxt, "write");
+                return BenchRunFunc(
+                    [poDriver, osFilename, nFeatures]()
+                    {
+                        // Removes all files of a shapefile, not only the .shp
+                        GDALDriver::QuietDelete(osFilename.c_str());
+                        return WriteSyntheticLayer(poDriver, osFilename,
+                                                   nFeatures)
+                                   ? static_cast<double>(nFeatures)
+                                   : 0.0;
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+        {
+            Benchmark oBench;
+            oBench.osName = "ogr/" + osShortName + "_read";
+            oBench.osUnit = "features";
+            oBench.setup = [pszDriver = pszDriver,
+                            GetFilename](const BenchContext &oCtxt)
+            {
+                auto poDriver =
+                    GetGDALDriverManager()->GetDriverByName(pszDriver);
+                if (!poDriver)
+                    return BenchRunFunc();
+                const int nFeatures = 200 * 1000 / oCtxt.nScale;
+                const std::string osFilename = GetFilename(oCtxt, "read");
+                GDALDriver::QuietDelete(osFilename.c_str());
+                if (!WriteSyntheticLayer(poDriver, osFilename, nFeatures))
+                    return BenchRunFunc();
+                return BenchRunFunc(
+                    [osFilename]()
+                    {
+                        std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+                            osFilename.c_str(),
+                            GDAL_OF_VECTOR | GDAL_OF_VERBOSE_ERROR));
+                        if (!poDS || poDS->GetLayerCount() != 1)
+                            return 0.0;
+                        GIntBig nCount = 0;
+                        for (auto &&poFeature : poDS->GetLayer(0))
+                        {
+                            // Make sure the geometry is decoded
+                            CPL_IGNORE_RET_VAL(poFeature->GetGeometryRef());
+                            ++nCount;
+                        }
+                        return static_cast<double>(nCount);
+                    });
+            };
+            aoBenchmarks.push_back(std::move(oBench));
+        }
+    }
+}
+
+/************************************************************************/
+/*                          AddVSIBenchmarks()                          */
+/************************************************************************/
+
+static void AddVSIBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    for (const bool bCache : {false, true})
+    {
+        Benchmark oBench;
+        oBench.osName =
+            std::string("vsi/random_read_cache_") + (bCache ? "on" : "off");
+        oBench.osUnit = "bytes";
+        oBench.setup = [bCache](const BenchContext &oCtxt)
+        {
+            const std::string osFilename = CPLFormFilenameSafe(
+                oCtxt.osTmpDir.c_str(), "vsi_read.bin", nullptr);
+            // Smaller than the default VSI_CACHE_SIZE of 25 MB
+            const size_t nFileSize = (16 * 1024 * 1024) / oCtxt.nScale;
+            {
+                std::vector<GByte> abyData(nFileSize);
+                std::minstd_rand oRand(42);
+                for (auto &byVal : abyData)
+                    byVal = static_cast<GByte>(oRand());
+                VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+                if (!fp)
+                    return BenchRunFunc();
+                const bool bOK = VSIFWriteL(abyData.data(), 1, nFileSize,
+                                            fp) == nFileSize;
+                if (VSIFCloseL(fp) != 0 || !bOK)
+                    return BenchRunFunc();
+            }
+            return BenchRunFunc(
+                [osFilename, nFileSize, bCache]()
+                {
+                    CPLConfigOptionSetter oSetter("VSI_CACHE",
+                                                  bCache ? "TRUE" : "FALSE",
+                                                  false);
+                    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+                    if (!fp)
+                        return 0.0;
+                    // Small reads at random offsets, as done by drivers
+                    // reading headers and index structures.
+                    constexpr size_t CHUNK_SIZE = 4096;
+                    constexpr int N_READS = 20000;
+                    GByte abyChunk[CHUNK_SIZE];
+                    std::minstd_rand oRand(42);
+                    double dfRead = 0;
+                    for (int i = 0; i < N_READS; ++i)
+                    {
+                        const vsi_l_offset nOffset =
+                            oRand() % (nFileSize - CHUNK_SIZE);
+                        if (VSIFSeekL(fp, nOffset, SEEK_SET) != 0)
+                            break;
+                        dfRead += static_cast<double>(
+                            VSIFReadL(abyChunk, 1, CHUNK_SIZE, fp));
+                    }
+                    VSIFCloseL(fp);
+                    return dfRead;
+                });
+        };
+        aoBenchmarks.push_back(std::move(oBench));
+    }
+}
+
+/************************************************************************/
+/*                          AddXMLBenchmarks()                          */
+/************************************************************************/
+
+static void AddXMLBenchmarks(std::vector<Benchmark> &aoBenchmarks)
+{
+    Benchmark oBench;
+    oBench.osName = "xml/parse_aux_xml_rat";
+    oBench.osUnit = "bytes";
+    oBench.setup = [](const BenchContext &oCtxt)
+    {
+        // Mimics a .aux.xml file with a large raster attribute table
+        const int nRows = 100000 / oCtxt.nScale;
+        std::string osXML = "<PAMDataset>\n  <PAMRasterBand band=\"1\">\n"
+                            "    <GDALRasterAttributeTable>\n";
+        for (const char *pszName : {"Value", "Count", "Name"})
+        {
+            osXML += "      <FieldDefn index=\"0\">\n        <Name>";
+            osXML += pszName;
+            osXML += "</Name>\n        <Type>0</Type>\n"
+                     "        <Usage>0</Usage>\n      </FieldDefn>\n";
+        }
+        for (int i = 0; i < nRows; ++i)
+        {
+            osXML += CPLSPrintf("      <Row index=\"%d\">\n"
+                                "        <F>%d</F>\n"
+                                "        <F>%d</F>\n"
+                                "        <F>class &amp; %d</F>\n"
+                                "      </Row>\n",
+                                i, i, i * 7, i % 10);
+        }
+        osXML += "    </GDALRasterAttributeTable>\n"
+                 "  </PAMRasterBand>\n</PAMDataset>\n";
+        return BenchRunFunc(
+            [osXML]()
+            {
+                CPLXMLTreeCloser oTree(CPLParseXMLString(osXML.c_str()));
+                return oTree ? static_cast<double>(osXML.size()) : 0.0;
+            });
+    };
+    aoBenchmarks.push_back(std::move(oBench));
+}
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: bench_gdal [--list] [--filter <substring>]... "
+           "[--repeat <n>]\n");
+    printf("                  [--output <file.json>] [--tmpdir <dir>] "
+           "[--quick]\n");
+    printf("\n");
+    printf("Runs benchmarks of core raster and vector code paths on "
+           "synthetic datasets,\n");
+    printf("and reports their timings. --output writes them as JSON, to "
+           "track regressions\n");
+    printf("between versions. --quick runs them on smaller datasets.\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    bool bList = false;
+    std::vector<std::string> aosFilters;
+    int nRepeat = 5;
+    std::string osOutput;
+    BenchContext oCtxt;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (strcmp(argv[iArg], "--list") == 0)
+        {
+            bList = true;
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "--filter") == 0)
+        {
+            aosFilters.push_back(argv[++iArg]);
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "--repeat") == 0)
+        {
+            nRepeat = std::max(1, atoi(argv[++iArg]));
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "--output") == 0)
+        {
+            osOutput = argv[++iArg];
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "--tmpdir") == 0)
+        {
+            oCtxt.osTmpDir = argv[++iArg];
+        }
+        else if (strcmp(argv[iArg], "--quick") == 0)
+        {
+            oCtxt.nScale = 8;
+        }
+        else
+        {
+            Usage();
+        }
+    }
+    CSLDestroy(argv);
+
+    GDALAllRegister();
+
+    std::vector<Benchmark> aoBenchmarks;
+    AddCopyWordsBenchmarks(aoBenchmarks);
+    AddBlockCacheBenchmarks(aoBenchmarks);
+    AddCOGBenchmarks(aoBenchmarks);
+    AddWarpBenchmarks(aoBenchmarks);
+    AddOverviewBenchmarks(aoBenchmarks);
+    AddVectorBenchmarks(aoBenchmarks);
+    AddVSIBenchmarks(aoBenchmarks);
+    AddXMLBenchmarks(aoBenchmarks);
+
+    if (!aosFilters.empty())
+    {
+        aoBenchmarks.erase(
+            std::remove_if(aoBenchmarks.begin(), aoBenchmarks.end(),
+                           [&aosFilters](const Benchmark &oBench)
+                           {
+                               for (const auto &osFilter : aosFilters)
+                               {
+                                   if (oBench.osName.find(osFilter) !=
+                                       std::string::npos)
+                                       return false;
+                               }
+                               return true;
+                           }),
+            aoBenchmarks.end());
+    }
+
+    if (bList)
+    {
+        for (const auto &oBench : aoBenchmarks)
+            printf("%s\n", oBench.osName.c_str());
+        GDALDestroy();
+        return 0;
+    }
+
+    const bool bOwnTmpDir = oCtxt.osTmpDir.empty();
+    if (bOwnTmpDir)
+    {
+        oCtxt.osTmpDir = CPLGenerateTempFilenameSafe("bench_gdal");
+        if (VSIMkdir(oCtxt.osTmpDir.c_str(), 0755) != 0)
+        {
+            fprintf(stderr, "Cannot create %s\n", oCtxt.osTmpDir.c_str());
+            GDALDestroy();
+            return 1;
+        }
+    }
+
+    CPLJSONObject oRoot;
+    oRoot.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+    oRoot.Add("num_cpus", CPLGetNumCPUs());
+    oRoot.Add("repeat", nRepeat);
+    oRoot.Add("quick", oCtxt.nScale > 1);
+    CPLJSONArray oResults;
+
+    int nRet = 0;
+    for (const auto &oBench : aoBenchmarks)
+    {
+        BenchRunFunc run = oBench.setup(oCtxt);
+        if (!run)
+        {
+            printf("%-45s skipped\n", oBench.osName.c_str());
+            continue;
+        }
+
+        // First iteration to warm up caches, not measured
+        double dfUnits = run();
+        std::vector<double> adfSeconds;
+        for (int i = 0; i < nRepeat && dfUnits > 0; ++i)
+        {
+            const auto tStart = std::chrono::steady_clock::now();
+            dfUnits = run();
+            adfSeconds.push_back(std::chrono::duration<double>(
+                                     std::chrono::steady_clock::now() - tStart)
+                                     .count());
+        }
+        run = BenchRunFunc();
+        if (dfUnits <= 0)
+        {
+            printf("%-45s FAILED\n", oBench.osName.c_str());
+            nRet = 1;
+            continue;
+        }
+
+        std::sort(adfSeconds.begin(), adfSeconds.end());
+        const double dfMin = adfSeconds.front();
+        const double dfMedian = adfSeconds[adfSeconds.size() / 2];
+        const double dfThroughput = dfUnits / dfMedian;
+        printf("%-45s median %10.3f ms, min %10.3f ms, %12.4g %s/s\n",
+               oBench.osName.c_str(), dfMedian * 1000, dfMin * 1000,
+               dfThroughput, oBench.osUnit.c_str());
+        fflush(stdout);
+
+        CPLJSONObject oResult;
+        oResult.Add("name", oBench.osName);
+        oResult.Add("iterations", static_cast<int>(adfSeconds.size()));
+        oResult.Add("min_seconds", dfMin);
+        oResult.Add("median_seconds", dfMedian);
+        oResult.Add("max_seconds", adfSeconds.back());
+        oResult.Add("units_per_iteration", dfUnits);
+        oResult.Add("unit", oBench.osUnit);
+        oResult.Add("throughput_per_second", dfThroughput);
+        oResults.Add(oResult);
+    }
+    oRoot.Add("benchmarks", oResults);
+
+    if (!osOutput.empty())
+    {
+        CPLJSONDocument oDoc;
+        oDoc.SetRoot(oRoot);
+        if (!oDoc.Save(osOutput))
+            nRet = 1;
+    }
+
+    if (bOwnTmpDir)
+        VSIRmdirRecursive(oCtxt.osTmpDir.c_str());
+
+    GDALDestroy();
+    return nRet;
+}
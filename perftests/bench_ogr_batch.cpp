@@ -207,6 +207,14 @@ int main(int argc, char *argv[])
 
     poDS.reset();
 
+    if (CPLTestBool(CPLGetConfigOption("OGR_PROFILING_STATS_ENABLED", "NO")))
+    {
+        char *pszReport = OGRProfilingStatsGetAsText(nullptr);
+        if (pszReport)
+            printf("%s", pszReport);
+        CPLFree(pszReport);
+    }
+
     CSLDestroy(argv);
 
     GDALDestroyDriverManager();
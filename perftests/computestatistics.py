@@ -10,6 +10,7 @@ for dt in (
     gdal.GDT_Byte,
     gdal.GDT_UInt16,
     gdal.GDT_Int16,
+    gdal.GDT_Int32,
     gdal.GDT_Float32,
     gdal.GDT_Float64,
 ):
@@ -17,29 +18,41 @@ for dt in (
     tab_ds[dt].GetRasterBand(1).Fill(1)
 
 
-def test(dt):
-    tab_ds[dt].GetRasterBand(1).ComputeStatistics(False)
+def test(dt, nodata=None):
+    band = tab_ds[dt].GetRasterBand(1)
+    if nodata is None:
+        band.DeleteNoDataValue()
+    else:
+        band.SetNoDataValue(nodata)
+    band.ComputeStatistics(False)
 
 
 NITERS = 500
 setup = "from osgeo import gdal; from __main__ import test"
-print(
-    "testByte(): %.3f"
-    % timeit.timeit("test(gdal.GDT_Byte)", setup=setup, number=NITERS)
-)
-print(
-    "testUInt16(): %.3f"
-    % timeit.timeit("test(gdal.GDT_UInt16)", setup=setup, number=NITERS)
-)
-print(
-    "testInt16(): %.3f"
-    % timeit.timeit("test(gdal.GDT_Int16)", setup=setup, number=NITERS)
-)
-print(
-    "testFloat32(): %.3f"
-    % timeit.timeit("test(gdal.GDT_Float32)", setup=setup, number=NITERS)
-)
-print(
-    "testFloat64(): %.3f"
-    % timeit.timeit("test(gdal.GDT_Float64)", setup=setup, number=NITERS)
-)
+for num_threads in ("1", "ALL_CPUS"):
+    # Only the generic code path, used for data types other than Byte and
+    # UInt16, is multithreaded.
+    print("GDAL_NUM_THREADS=%s" % num_threads)
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        for dt_name in ("Byte", "UInt16", "Int16", "Int32", "Float32", "Float64"):
+            print(
+                "test%s(): %.3f"
+                % (
+                    dt_name,
+                    timeit.timeit(
+                        "test(gdal.GDT_%s)" % dt_name, setup=setup, number=NITERS
+                    ),
+                )
+            )
+            if dt_name in ("Int32", "Float32", "Float64"):
+                print(
+                    "test%s(nodata): %.3f"
+                    % (
+                        dt_name,
+                        timeit.timeit(
+                            "test(gdal.GDT_%s, 0)" % dt_name,
+                            setup=setup,
+                            number=NITERS,
+                        ),
+                    )
+                )
@@ -0,0 +1,43 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2025, GDAL contributors
+
+import struct
+import time
+
+from osgeo import gdal
+
+
+def doit(datatype, resampling, levels):
+
+    filename = "/vsimem/test.tif"
+    size = 8000
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename, size, size, 1, datatype, options=["TILED=YES"]
+    )
+    # Land-cover like data: a few classes, in patches
+    fmt = "B" if datatype == gdal.GDT_Byte else "H"
+    lines = [
+        struct.pack(fmt * size, *[((x + shift) // 7) % 12 for x in range(size)])
+        for shift in range(3)
+    ]
+    for y in range(size):
+        ds.GetRasterBand(1).WriteRaster(0, y, size, 1, lines[(y // 5) % 3])
+    ds = None
+
+    ds = gdal.Open(filename, gdal.GA_Update)
+    start = time.time()
+    ds.BuildOverviews(resampling, levels)
+    end = time.time()
+    print(
+        "%s, %s, %s: %.2f"
+        % (gdal.GetDataTypeName(datatype), resampling, str(levels), end - start)
+    )
+    ds = None
+
+    gdal.Unlink(filename)
+
+
+for datatype in (gdal.GDT_Byte, gdal.GDT_UInt16):
+    for levels in ([2], [8]):
+        doit(datatype, "AVERAGE", levels)
+        doit(datatype, "MODE", levels)
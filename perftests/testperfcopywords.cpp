@@ -97,5 +97,43 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // Conversions that have an AVX2 code path, with packed output and
+    // with pixel-interleaved output of 4 bands.
+    const GDALDataType aeTypes[] = {GDT_Byte,  GDT_Int16,   GDT_UInt16,
+                                    GDT_Int32, GDT_Float32, GDT_Float64};
+    for (int k = 0; k < 2; k++)
+    {
+        if (k == 1)
+        {
+            printf("Disabling AVX2\n");
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+        }
+
+        for (const GDALDataType eInType : aeTypes)
+        {
+            for (const GDALDataType eOutType : aeTypes)
+            {
+                if (eInType == eOutType)
+                    continue;
+                const int nInSize = GDALGetDataTypeSizeBytes(eInType);
+                const int nOutSize = GDALGetDataTypeSizeBytes(eOutType);
+                for (int nBands = 1; nBands <= 4; nBands += 3)
+                {
+                    start = clock();
+                    for (i = 0; i < 1000; i++)
+                        GDALCopyWords(in, eInType, nInSize, out, eOutType,
+                                      nOutSize * nBands, 256 * 256 / nBands);
+                    end = clock();
+                    printf("%s -> %s (%s) : %.2f s\n",
+                           GDALGetDataTypeName(eInType),
+                           GDALGetDataTypeName(eOutType),
+                           nBands == 1 ? "packed" : "pixel-interleaved",
+                           (end - start) * 1.0 / CLOCKS_PER_SEC);
+                }
+            }
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
+
     return 0;
 }
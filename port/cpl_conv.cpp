@@ -44,6 +44,7 @@
 #include "cpl_conv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cerrno>
 #include <climits>
@@ -57,6 +58,7 @@
 #endif
 #include <mutex>
 #include <set>
+#include <vector>
 
 #if HAVE_UNISTD_H
 #include <unistd.h>
@@ -96,8 +98,19 @@ void OGRAPISPYCPLSetThreadLocalConfigOption(const char *, const char *);
 // Uncomment to get list of options that have been fetched and set.
 // #define DEBUG_CONFIG_OPTIONS
 
+// Taken by writers of global configuration options. Readers do not take it.
 static CPLMutex *hConfigMutex = nullptr;
-static volatile char **g_papszConfigOptions = nullptr;
+// NULL terminated list of "KEY=VALUE" strings with the global configuration
+// options. A published list is never modified: writers publish a new list,
+// which shares the strings of unmodified options with the previous one.
+static std::atomic<char **> g_papszConfigOptions{nullptr};
+// Number of threads currently looking up g_papszConfigOptions
+static std::atomic<int> gnConfigOptionsReaders{0};
+// Lists and strings no longer published, which are freed once no reader can
+// access them anymore. Protected by hConfigMutex.
+static std::vector<void *> gapRetiredConfigOptions{};
+// Incremented each time a (global or thread-local) option is set.
+static std::atomic<GIntBig> gnConfigOptionsGeneration{0};
 static bool gbIgnoreEnvVariables =
     false;  // if true, only take into account configuration options set through
             // configuration file or
@@ -1735,7 +1748,53 @@ const char *CPL_STDCALL CPLGetConfigOption(const char *pszKey,
 char **CPLGetConfigOptions(void)
 {
     CPLMutexHolderD(&hConfigMutex);
-    return CSLDuplicate(const_cast<char **>(g_papszConfigOptions));
+    return CSLDuplicate(g_papszConfigOptions.load());
+}
+
+/************************************************************************/
+/*                    CPLPublishConfigOptions()                         */
+/************************************************************************/
+
+/* Must be called with hConfigMutex held. The strings of the previous list
+ * that are not in the new one must have been added to
+ * gapRetiredConfigOptions by the caller. */
+static void CPLPublishConfigOptions(char **papszNewConfigOptions)
+{
+    char **papszOld = g_papszConfigOptions.exchange(papszNewConfigOptions);
+    if (papszOld)
+        gapRetiredConfigOptions.push_back(papszOld);
+    ++gnConfigOptionsGeneration;
+
+    // A reader that starts after this point sees the new list, so retired
+    // lists and strings can be freed if there is no reader in progress.
+    // Otherwise they will be by a later call.
+    if (gnConfigOptionsReaders.load() == 0)
+    {
+        for (void *p : gapRetiredConfigOptions)
+            CPLFree(p);
+        gapRetiredConfigOptions.clear();
+    }
+}
+
+/************************************************************************/
+/*                  CPLGetConfigOptionsGeneration()                     */
+/************************************************************************/
+
+/**
+ * Return a counter that is incremented each time a configuration option is
+ * set with CPLSetConfigOption(), CPLSetConfigOptions(),
+ * CPLSetThreadLocalConfigOption() or CPLSetThreadLocalConfigOptions().
+ *
+ * This can be used by code that caches the value of configuration options
+ * to detect that they must be read again. See CPLConfigOptionCache.
+ *
+ * Modifications of environment variables are not taken into account.
+ *
+ * @since GDAL 3.11
+ */
+GIntBig CPLGetConfigOptionsGeneration(void)
+{
+    return gnConfigOptionsGeneration.load(std::memory_order_acquire);
 }
 
 /************************************************************************/
@@ -1761,8 +1820,12 @@ char **CPLGetConfigOptions(void)
 void CPLSetConfigOptions(const char *const *papszConfigOptions)
 {
     CPLMutexHolderD(&hConfigMutex);
-    CSLDestroy(const_cast<char **>(g_papszConfigOptions));
-    g_papszConfigOptions = const_cast<volatile char **>(
+    for (char **papszIter = g_papszConfigOptions.load();
+         papszIter && *papszIter; ++papszIter)
+    {
+        gapRetiredConfigOptions.push_back(*papszIter);
+    }
+    CPLPublishConfigOptions(
         CSLDuplicate(const_cast<char **>(papszConfigOptions)));
 }
 
@@ -1802,6 +1865,8 @@ const char *CPL_STDCALL CPLGetThreadLocalConfigOption(const char *pszKey,
  *  options set with CPLSetThreadLocalConfigOption().
  *  This function should generally not be used by applications, which should
  *  use CPLGetConfigOption() instead.
+ *
+ *  Starting with GDAL 3.11, this function does not take any lock.
  *  @since 3.8 */
 const char *CPL_STDCALL CPLGetGlobalConfigOption(const char *pszKey,
                                                  const char *pszDefault)
@@ -1810,10 +1875,17 @@ const char *CPL_STDCALL CPLGetGlobalConfigOption(const char *pszKey,
     CPLAccessConfigOption(pszKey, TRUE);
 #endif
 
-    CPLMutexHolderD(&hConfigMutex);
+    // Fast path when no global option is set, in which case there is nothing
+    // to protect.
+    if (g_papszConfigOptions.load(std::memory_order_relaxed) == nullptr)
+        return pszDefault;
 
+    // Registering as a reader prevents writers from freeing the list we
+    // look up, and the string we return (until its key is set again).
+    ++gnConfigOptionsReaders;
     const char *pszResult =
-        CSLFetchNameValue(const_cast<char **>(g_papszConfigOptions), pszKey);
+        CSLFetchNameValue(g_papszConfigOptions.load(), pszKey);
+    --gnConfigOptionsReaders;
 
     if (pszResult == nullptr)
         return pszDefault;
@@ -2076,8 +2148,47 @@ void CPL_STDCALL CPLSetConfigOption(const char *pszKey, const char *pszValue)
 
     CPLSetConfigOptionDetectUnknownConfigOption(pszKey, pszValue);
 
-    g_papszConfigOptions = const_cast<volatile char **>(CSLSetNameValue(
-        const_cast<char **>(g_papszConfigOptions), pszKey, pszValue));
+    // Build a new list, in the same way as CSLSetNameValue(), but without
+    // modifying or freeing the current one, which readers may be accessing.
+    char **papszOld = g_papszConfigOptions.load();
+    const int nCount = CSLCount(papszOld);
+    char **papszNew =
+        static_cast<char **>(CPLMalloc((nCount + 2) * sizeof(char *)));
+    const size_t nKeyLen = strlen(pszKey);
+    char *pszNewItem = nullptr;
+    if (pszValue)
+    {
+        const size_t nLen = nKeyLen + strlen(pszValue) + 2;
+        pszNewItem = static_cast<char *>(CPLMalloc(nLen));
+        snprintf(pszNewItem, nLen, "%s=%s", pszKey, pszValue);
+    }
+    int iNew = 0;
+    bool bFound = false;
+    for (int i = 0; i < nCount; ++i)
+    {
+        char *pszItem = papszOld[i];
+        if (!bFound && EQUALN(pszItem, pszKey, nKeyLen) &&
+            (pszItem[nKeyLen] == '=' || pszItem[nKeyLen] == ':'))
+        {
+            bFound = true;
+            gapRetiredConfigOptions.push_back(pszItem);
+            if (pszNewItem)
+                papszNew[iNew++] = pszNewItem;
+        }
+        else
+        {
+            papszNew[iNew++] = pszItem;
+        }
+    }
+    if (!bFound && pszNewItem)
+        papszNew[iNew++] = pszNewItem;
+    papszNew[iNew] = nullptr;
+    if (iNew == 0)
+    {
+        CPLFree(papszNew);
+        papszNew = nullptr;
+    }
+    CPLPublishConfigOptions(papszNew);
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/false);
@@ -2143,6 +2254,7 @@ void CPL_STDCALL CPLSetThreadLocalConfigOption(const char *pszKey,
 
     CPLSetTLSWithFreeFunc(CTLS_CONFIGOPTIONS, papszTLConfigOptions,
                           CPLSetThreadLocalTLSFreeFunc);
+    ++gnConfigOptionsGeneration;
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/true);
@@ -2203,6 +2315,7 @@ void CPLSetThreadLocalConfigOptions(const char *const *papszConfigOptions)
         CSLDuplicate(const_cast<char **>(papszConfigOptions));
     CPLSetTLSWithFreeFunc(CTLS_CONFIGOPTIONS, papszTLConfigOptions,
                           CPLSetThreadLocalTLSFreeFunc);
+    ++gnConfigOptionsGeneration;
 }
 
 /************************************************************************/
@@ -2215,8 +2328,11 @@ void CPL_STDCALL CPLFreeConfig()
     {
         CPLMutexHolderD(&hConfigMutex);
 
-        CSLDestroy(const_cast<char **>(g_papszConfigOptions));
-        g_papszConfigOptions = nullptr;
+        CSLDestroy(g_papszConfigOptions.exchange(nullptr));
+        for (void *p : gapRetiredConfigOptions)
+            CPLFree(p);
+        gapRetiredConfigOptions.clear();
+        ++gnConfigOptionsGeneration;
 
         int bMemoryError = FALSE;
         char **papszTLConfigOptions = reinterpret_cast<char **>(
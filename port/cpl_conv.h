@@ -63,6 +63,7 @@ void CPL_DLL CPLUnsubscribeToSetConfigOption(int nSubscriberId);
 void CPL_DLL CPL_STDCALL CPLFreeConfig(void);
 /*! @endcond */
 char CPL_DLL **CPLGetConfigOptions(void);
+GIntBig CPL_DLL CPLGetConfigOptionsGeneration(void);
 void CPL_DLL CPLSetConfigOptions(const char *const *papszConfigOptions);
 char CPL_DLL **CPLGetThreadLocalConfigOptions(void);
 void CPL_DLL
@@ -430,6 +431,72 @@ extern "C++"
 
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
+extern "C++"
+{
+    /** Value of a configuration option, converted to type T, that is only
+     * read again with CPLGetConfigOption() when configuration options have
+     * been set since the last read, according to
+     * CPLGetConfigOptionsGeneration().
+     *
+     * Meant for hot code paths. Instances should be declared
+     * static thread_local, so that options set with
+     * CPLSetThreadLocalConfigOption() are honoured:
+     * \code{.cpp}
+     * static thread_local CPLConfigOptionCache<int> oChunkSize(
+     *     "MY_CHUNK_SIZE", "65536", atoi);
+     * const int nChunkSize = oChunkSize.Get();
+     * \endcode
+     *
+     * Environment variables modified after the first read are not seen.
+     *
+     * @since GDAL 3.11
+     */
+    template <class T> class CPLConfigOptionCache
+    {
+      public:
+        /** Function converting the value of the option to T */
+        typedef T (*ParseFunc)(const char *);
+
+        /** Constructor.
+         * @param pszKey option name. Must remain valid during the life of
+         *               the object.
+         * @param pszDefault default value, passed to CPLGetConfigOption().
+         *                   Must remain valid during the life of the object.
+         * @param pfnParse conversion function. Receives nullptr if the option
+         *                 is not set and pszDefault is nullptr.
+         */
+        CPLConfigOptionCache(const char *pszKey, const char *pszDefault,
+                             ParseFunc pfnParse)
+            : m_pszKey(pszKey), m_pszDefault(pszDefault), m_pfnParse(pfnParse)
+        {
+        }
+
+        /** Return the (possibly cached) value of the option. */
+        const T &Get()
+        {
+            const GIntBig nGeneration = CPLGetConfigOptionsGeneration();
+            if (nGeneration != m_nGeneration)
+            {
+                m_value =
+                    m_pfnParse(CPLGetConfigOption(m_pszKey, m_pszDefault));
+                m_nGeneration = nGeneration;
+            }
+            return m_value;
+        }
+
+      private:
+        const char *const m_pszKey;
+        const char *const m_pszDefault;
+        const ParseFunc m_pfnParse;
+        GIntBig m_nGeneration = -1;
+        T m_value{};
+    };
+}  // extern "C++"
+
+#endif /* def __cplusplus */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
 extern "C++"
 {
 
@@ -28,6 +28,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_vsi_io_stats.h"
 #include "cpl_vsil_curl_class.h"
 
 // gcc or clang complains about C-style cast in #define like
@@ -70,6 +71,11 @@ static CPLMutex *hSessionMapMutex = nullptr;
 static bool bHasCheckVersion = false;
 static bool bSupportGZip = false;
 static bool bSupportHTTP2 = false;
+
+// Process-wide share handle, holding the DNS and TLS session caches, used by
+// all easy handles.
+static CURLSH *hShareHandle = nullptr;
+static std::array<std::mutex, CURL_LOCK_DATA_LAST> aoShareMutexes;
 #if defined(_WIN32) && defined(HAVE_OPENSSL_CRYPTO)
 static std::vector<X509 *> *poWindowsCertificateList = nullptr;
 
@@ -315,6 +321,60 @@ static void CheckCurlFeatures()
     }
 }
 
+/************************************************************************/
+/*                        CPLHTTPShareLock()                            */
+/************************************************************************/
+
+static void CPLHTTPShareLock(CURL * /* handle */, curl_lock_data data,
+                             curl_lock_access /* access */,
+                             void * /* userptr */)
+{
+    aoShareMutexes[data].lock();
+}
+
+/************************************************************************/
+/*                       CPLHTTPShareUnlock()                           */
+/************************************************************************/
+
+static void CPLHTTPShareUnlock(CURL * /* handle */, curl_lock_data data,
+                               void * /* userptr */)
+{
+    aoShareMutexes[data].unlock();
+}
+
+/************************************************************************/
+/*                      CPLHTTPGetShareHandle()                         */
+/************************************************************************/
+
+// Returns the process-wide share handle, so that all easy handles, whichever
+// thread or multi handle they run on, reuse resolved host names and TLS
+// sessions, or nullptr if GDAL_HTTP_SHARE_CACHE=NO.
+// Connections themselves cannot be shared between concurrent threads by
+// libcurl, and are kept in the connection cache of each multi handle.
+static CURLSH *CPLHTTPGetShareHandle()
+{
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_HTTP_SHARE_CACHE", "YES")))
+        return nullptr;
+
+    CPLMutexHolder oHolder(&hSessionMapMutex);
+    if (hShareHandle == nullptr)
+    {
+        hShareHandle = curl_share_init();
+        if (hShareHandle)
+        {
+            curl_share_setopt(hShareHandle, CURLSHOPT_LOCKFUNC,
+                              CPLHTTPShareLock);
+            curl_share_setopt(hShareHandle, CURLSHOPT_UNLOCKFUNC,
+                              CPLHTTPShareUnlock);
+            curl_share_setopt(hShareHandle, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_DNS);
+            curl_share_setopt(hShareHandle, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_SSL_SESSION);
+        }
+    }
+    return hShareHandle;
+}
+
 /************************************************************************/
 /*                            CPLWriteFct()                             */
 /*                                                                      */
@@ -688,6 +748,7 @@ bool CPLHTTPRetryContext::CanRetry()
     if (m_nRetryCount >= m_oParameters.nMaxRetry)
         return false;
     m_nRetryCount++;
+    cpl::VSIIOStats::LogRetry();
     return true;
 }
 
@@ -709,6 +770,7 @@ bool CPLHTTPRetryContext::CanRetry(int response_code, const char *pszErrBuf,
     if (m_dfNextDelay == 0.0)
         return false;
     m_nRetryCount++;
+    cpl::VSIIOStats::LogRetry();
     return true;
 }
 
@@ -1801,7 +1863,7 @@ CPLHTTPResult **CPLHTTPMultiFetch(const char *const *papszURL, int nURLCount,
             poSessionMultiMap = new std::map<CPLString, CURLM *>;
         if (poSessionMultiMap->count(osSessionName) == 0)
         {
-            (*poSessionMultiMap)[osSessionName] = curl_multi_init();
+            (*poSessionMultiMap)[osSessionName] = VSICURLMultiInit();
             CPLDebug("HTTP", "Establish persistent session named '%s'.",
                      osSessionName.c_str());
         }
@@ -1843,7 +1905,7 @@ CPLHTTPResult **CPLHTTPMultiFetch(const char *const *papszURL, int nURLCount,
     }
     else
     {
-        hCurlMultiHandle = curl_multi_init();
+        hCurlMultiHandle = VSICURLMultiInit();
     }
 
     CPLHTTPResult **papsResults = static_cast<CPLHTTPResult **>(
@@ -2120,6 +2182,9 @@ void *CPLHTTPSetOptions(void *pcurl, const char *pszURL,
 
     unchecked_curl_easy_setopt(http_handle, CURLOPT_URL, pszURL);
 
+    unchecked_curl_easy_setopt(http_handle, CURLOPT_SHARE,
+                               CPLHTTPGetShareHandle());
+
     if (CPLTestBool(CPLGetConfigOption("CPL_CURL_VERBOSE", "NO")))
     {
         unchecked_curl_easy_setopt(http_handle, CURLOPT_VERBOSE, 1);
@@ -2790,6 +2855,10 @@ void CPLHTTPCleanup()
             delete poSessionMultiMap;
             poSessionMultiMap = nullptr;
         }
+        // Fails with CURLSHE_IN_USE if easy handles still refer to it, in
+        // which case it is deliberately leaked.
+        if (hShareHandle && curl_share_cleanup(hShareHandle) == CURLSHE_OK)
+            hShareHandle = nullptr;
     }
 
     // Not quite a safe sequence.
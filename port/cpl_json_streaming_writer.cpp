@@ -15,6 +15,11 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
 
 #include "cpl_conv.h"
 #include "cpl_float.h"
@@ -33,6 +38,53 @@ CPLJSonStreamingWriter::~CPLJSonStreamingWriter()
     CPLAssert(m_states.empty());
 }
 
+/************************************************************************/
+/*                          FormatInteger()                             */
+/************************************************************************/
+
+template <class T> static std::string FormatInteger(T nVal)
+{
+#if defined(__cpp_lib_to_chars)
+    char szBuffer[32];
+    const auto res = std::to_chars(szBuffer, szBuffer + sizeof(szBuffer), nVal);
+    return std::string(szBuffer, res.ptr);
+#else
+    return std::to_string(nVal);
+#endif
+}
+
+/************************************************************************/
+/*                         FormatFloating()                             */
+/************************************************************************/
+
+/** Equivalent of CPLSPrintf("%.{nPrecision}g", dfVal), but
+ * locale-independent and without going through the printf() machinery,
+ * which is significant when writing large arrays of numbers.
+ */
+template <class T> static std::string FormatFloating(T val, int nPrecision)
+{
+#if defined(__cpp_lib_to_chars)
+    if (nPrecision >= 0)
+    {
+        // Enough for a 17 significant digits double and its exponent, but
+        // check the result in case a larger precision was asked.
+        char szBuffer[64];
+        const auto res =
+            std::to_chars(szBuffer, szBuffer + sizeof(szBuffer), val,
+                          std::chars_format::general, nPrecision);
+        if (res.ec == std::errc())
+            return std::string(szBuffer, res.ptr);
+    }
+#endif
+    char szFormatting[10];
+    snprintf(szFormatting, sizeof(szFormatting), "%%.%dg", nPrecision);
+    return CPLSPrintf(szFormatting, val);
+}
+
+/************************************************************************/
+/*                              Print()                                 */
+/************************************************************************/
+
 void CPLJSonStreamingWriter::Print(const std::string &text)
 {
     if (m_pfnSerializationFunc)
@@ -214,13 +266,13 @@ void CPLJSonStreamingWriter::Add(const char *pszStr)
 void CPLJSonStreamingWriter::Add(std::int64_t nVal)
 {
     EmitCommaIfNeeded();
-    Print(CPLSPrintf(CPL_FRMT_GIB, static_cast<GIntBig>(nVal)));
+    Print(FormatInteger(nVal));
 }
 
 void CPLJSonStreamingWriter::Add(std::uint64_t nVal)
 {
     EmitCommaIfNeeded();
-    Print(CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(nVal)));
+    Print(FormatInteger(nVal));
 }
 
 void CPLJSonStreamingWriter::Add(GFloat16 hfVal, int nPrecision)
@@ -236,9 +288,7 @@ void CPLJSonStreamingWriter::Add(GFloat16 hfVal, int nPrecision)
     }
     else
     {
-        char szFormatting[10];
-        snprintf(szFormatting, sizeof(szFormatting), "%%.%dg", nPrecision);
-        Print(CPLSPrintf(szFormatting, float(hfVal)));
+        Print(FormatFloating(float(hfVal), nPrecision));
     }
 }
 
@@ -255,9 +305,7 @@ void CPLJSonStreamingWriter::Add(float fVal, int nPrecision)
     }
     else
     {
-        char szFormatting[10];
-        snprintf(szFormatting, sizeof(szFormatting), "%%.%dg", nPrecision);
-        Print(CPLSPrintf(szFormatting, fVal));
+        Print(FormatFloating(fVal, nPrecision));
     }
 }
 
@@ -274,9 +322,7 @@ void CPLJSonStreamingWriter::Add(double dfVal, int nPrecision)
     }
     else
     {
-        char szFormatting[10];
-        snprintf(szFormatting, sizeof(szFormatting), "%%.%dg", nPrecision);
-        Print(CPLSPrintf(szFormatting, dfVal));
+        Print(FormatFloating(dfVal, nPrecision));
     }
 }
 
@@ -121,6 +121,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_TIMESTAMP", // from cpl_error.cpp
    "CPL_TMPDIR", // from cogdriver.cpp, cpl_path.cpp, gdalwmscache.cpp, ogrgmlasconf.cpp, wcsutils.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
+   "CPL_VSIGS_RMDIR_RECURSIVE_NUM_THREADS", // from cpl_vsil_gs.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
@@ -132,22 +133,37 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_MAX_READAHEAD_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PARALLEL_READ_MAX_CONCURRENT_REQUESTS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_DIR", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_SPAN", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_IO_STATS_ENABLED", // from cpl_vsil_io_stats.cpp
+   "CPL_VSIL_IO_STATS_MAX_FILES", // from cpl_vsil_io_stats.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_SHOW_NETWORK_STATS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_UNIX_DIRECT_IO_THRESHOLD", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_UNIX_IO_URING", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_UNIX_IO_URING_QUEUE_DEPTH", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_LIST_UPLOADS_MAX", // from cpl_vsil_s3.cpp
+   "CPL_VSIS3_RMDIR_RECURSIVE_NUM_THREADS", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_UNLINK_BATCH_SIZE", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_USE_BASE_RMDIR_RECURSIVE", // from cpl_vsil_s3.cpp
+   "CPL_VSISHM_ROOT", // from cpl_vsil_shm.cpp
    "CPL_VSISTDIN_BUFFER_LIMIT", // from cpl_vsil_stdin.cpp
    "CPL_VSISTDIN_FILE", // from cpl_vsil_stdin.cpp
    "CPL_VSISTDIN_FILE_CLOSE", // from cpl_vsil_stdin.cpp
@@ -217,6 +233,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "FGDB_STRING_WIDTH", // from FGdbUtils.cpp
    "FORCE_BLOCKSIZE", // from hfaopen.cpp
    "GDAL_ALLOW_LARGE_LIBJPEG_MEM_ALLOC", // from JPEG_band.cpp, jpgdataset.cpp
+   "GDAL_APPROX_TRANSFORMER_2D", // from gdaltransformer.cpp
    "GDAL_BAG_BLOCK_SIZE", // from bagdataset.cpp
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
@@ -271,6 +288,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HDF5_CHAR_AS_STRING", // from hdf5dataset.cpp
    "GDAL_HDF5_TEMP_ARRAY_ALLOC_SIZE", // from hdf5multidim.cpp
    "GDAL_HFA_OVR_BLOCKSIZE", // from hfaband.cpp
+   "GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS", // from cpl_vsil_curl.cpp
+   "GDAL_HTTP_ADVISE_READ_MAX_GAP", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_AUTH", // from cpl_http.cpp
    "GDAL_HTTP_BEARER", // from cpl_http.cpp
    "GDAL_HTTP_CONNECTTIMEOUT", // from cpl_http.cpp
@@ -283,6 +302,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HTTP_KEYPASSWD", // from cpl_http.cpp
    "GDAL_HTTP_LOW_SPEED_LIMIT", // from cpl_http.cpp
    "GDAL_HTTP_LOW_SPEED_TIME", // from cpl_http.cpp
+   "GDAL_HTTP_MAX_HOST_CONNECTIONS", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MAX_RETRY", // from cpl_http.cpp
    "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MULTIPLEX", // from cpl_vsil_curl.cpp
@@ -293,6 +313,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HTTP_PROXYUSERPWD", // from cpl_http.cpp
    "GDAL_HTTP_RETRY_CODES", // from cpl_http.cpp
    "GDAL_HTTP_RETRY_DELAY", // from cpl_http.cpp
+   "GDAL_HTTP_SHARE_CACHE", // from cpl_http.cpp
    "GDAL_HTTP_SSL_VERIFYSTATUS", // from cpl_http.cpp
    "GDAL_HTTP_SSLCERT", // from cpl_http.cpp
    "GDAL_HTTP_SSLCERTTYPE", // from cpl_http.cpp
@@ -329,15 +350,17 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdaldataset.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdalrasterband.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rasterio.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
+   "GDAL_OPEN_IDENTIFY_STATS", // from gdaldrivermanager.cpp
    "GDAL_OPENGIS_SCHEMAS", // from cpl_xml_validate.cpp
    "GDAL_OVERVIEW_OVERSAMPLING_THRESHOLD", // from rasterio.cpp, vrtwarped.cpp
    "GDAL_OVR_CHUNK_MAX_SIZE", // from overview.cpp
    "GDAL_OVR_CHUNKYSIZE", // from overview.cpp
    "GDAL_OVR_PROPAGATE_NODATA", // from overview.cpp
+   "GDAL_OVR_STREAMING", // from overview.cpp
    "GDAL_OVR_TEMP_DRIVER", // from overview.cpp
    "GDAL_PAM_ENABLE_MARK_DIRTY", // from gdalpamdataset.cpp
    "GDAL_PAM_ENABLED", // from gdalpamdataset.cpp
@@ -363,6 +386,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_PROXY_AUTH", // from cpl_http.cpp
    "GDAL_PYTHON_DRIVER_PATH", // from gdalpythondriverloader.cpp
    "GDAL_RASTERIO_RESAMPLING", // from gdal_misc.cpp
+   "GDAL_RB_CACHE_ALLOCATOR", // from gdalrasterblock.cpp
+   "GDAL_RB_CACHE_HUGE_PAGES", // from gdalrasterblock.cpp
+   "GDAL_RB_CACHE_NUMA", // from gdalrasterblock.cpp
+   "GDAL_RB_CACHE_POLICY", // from gdalrasterblock.cpp
+   "GDAL_RB_CACHE_SHARDS", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_DROP_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_RB_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DETACH_BEFORE_WRITE", // from gdalrasterblock.cpp
@@ -380,25 +408,31 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_SWATH_SIZE", // from gdalmultidim.cpp, rasterio.cpp
    "GDAL_TEMP_DRIVER_NAME", // from nearblack_lib_floodfill.cpp
    "GDAL_TERM_PROGRESS_OSC_9_4", // from cpl_progress.cpp
+   "GDAL_THREAD_POOL_MAX_THREADS", // from gdal_thread_pool.cpp
+   "GDAL_THREAD_SAFE_SHARED_BLOCK_CACHE", // from gdalthreadsafedataset.cpp
    "GDAL_TIFF_DEFLATE_SUBCODEC", // from gtiffdataset.cpp
    "GDAL_TIFF_ENDIANNESS", // from gtiffdataset_write.cpp
    "GDAL_TIFF_INTERNAL_MASK", // from gtiffdataset_write.cpp
    "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", // from gtiffdataset.cpp, gtiffdataset_write.cpp
-   "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
+   "GDAL_TIFF_OVR_BLOCKSIZE", // from cogdriver.cpp, geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
    "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX2", // from cpl_cpu_features.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
    "GDAL_USE_SSSE3", // from cpl_cpu_features.cpp
    "GDAL_VALIDATE_CREATION_OPTIONS", // from gdaldataset.cpp, gdaldriver.cpp
+   "GDAL_VIRTUAL_MEM_READAHEAD", // from gdalvirtualmem.cpp
    "GDAL_VRT_ENABLE_PYTHON", // from vrtderivedrasterband.cpp
    "GDAL_VRT_PYTHON_EXCLUSIVE_LOCK", // from vrtderivedrasterband.cpp
    "GDAL_VRT_PYTHON_TRUSTED_MODULES", // from vrtderivedrasterband.cpp
+   "GDAL_VRT_WARP_NUM_THREADS", // from vrtwarped.cpp
    "GDAL_VRT_WARP_USE_DATASET_RASTERIO", // from vrtwarped.cpp
    "GDAL_WARP_USE_AFFINE_OPTIMIZATION", // from gdalwarpkernel.cpp
    "GDAL_WARP_USE_TRANSLATION_OPTIM", // from gdalwarpoperation.cpp
    "GDAL_WMS_MAX_CONNECTIONS", // from gdalogcapidataset.cpp
+   "GDAL_WRITE_BEHIND_NUM_THREADS", // from gdalrasterblock.cpp
    "GDAL_XML_VALIDATION", // from ogrgmlasconf.cpp, ogrvrtdriver.cpp, pdfcreatefromcomposition.cpp
    "GDAL_ZARR_USE_OPTIMIZED_CODE_PATHS", // from zarr_array.cpp
    "GDALCUTLINE_SKIP_CONTAINMENT_TEST", // from gdalcutline.cpp
@@ -485,7 +519,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GS_OAUTH2_SCOPE", // from cpl_google_cloud.cpp
    "GS_SECRET_ACCESS_KEY", // from cpl_google_cloud.cpp
    "GS_USER_PROJECT", // from cpl_google_cloud.cpp
+   "GTI_IN_MEMORY_INDEX_MAX_FEATURES", // from gdaltileindexdataset.cpp
    "GTI_NUM_THREADS", // from gdaltileindexdataset.cpp
+   "GTI_PREFETCH", // from gdaltileindexdataset.cpp
    "GTIFF_ALLOW_PREAD", // from gtiffdataset_read.cpp
    "GTIFF_ALPHA", // from gtiffdataset_write.cpp, gtiffrasterband_write.cpp
    "GTIFF_DELETE_ON_ERROR", // from gtiffdataset_write.cpp
@@ -494,6 +530,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTIFF_ESRI_CITATION", // from gt_wkt_srs.cpp
    "GTIFF_FORCE_RGBA", // from gtiffdataset_read.cpp
    "GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", // from gtiffdataset_read.cpp
+   "GTIFF_HEADER_CACHE_DIR", // from gtiffheadercache.cpp
    "GTIFF_HONOUR_NEGATIVE_SCALEY", // from gtiffdataset_read.cpp
    "GTIFF_IGNORE_READ_ERRORS", // from gtiffdataset.cpp
    "GTIFF_IMPLICIT_JPEG_OVR", // from gtiffdataset_read.cpp
@@ -502,6 +539,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GTIFF_MAX_CUMULATED_MEM_USAGE", // from tifvsi.cpp
    "GTIFF_POINT_GEO_IGNORE", // from gt_wkt_srs.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp
    "GTIFF_READ_ANGULAR_PARAMS_IN_DEGREE", // from gt_wkt_srs.cpp
+   "GTIFF_READ_MASK_WITH_DATA", // from gtiffdataset_read.cpp
    "GTIFF_REPORT_COMPD_CS", // from gtiffdataset_read.cpp, gtiffdataset_write.cpp
    "GTIFF_SRS_SOURCE", // from gt_wkt_srs.cpp
    "GTIFF_USE_DEFER_STRILE_LOADING", // from gtiffdataset_read.cpp
@@ -665,6 +703,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ARROW_COMPUTE_GEOMETRY_TYPE", // from ogrfeatherlayer.cpp
    "OGR_ARROW_LOAD_FILE_SYSTEM_FACTORIES", // from ogrfeatherdriver.cpp
    "OGR_ARROW_MEM_LIMIT", // from ograrrowarrayhelper.cpp
+   "OGR_ARROW_MEMORY_MAP", // from ogrfeatherdriver.cpp
    "OGR_ARROW_READ_GDAL_FOOTER", // from ogrfeatherlayer.cpp
    "OGR_ARROW_USE_VSI", // from ogrfeatherdriver.cpp
    "OGR_ARROW_WRITE_BBOX", // from ogrfeatherwriterlayer.cpp
@@ -773,6 +812,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_PG_STRING_TYPE", // from ogrpgdumplayer.cpp
    "OGR_PG_UUID_TYPE", // from ogrpgdumplayer.cpp
    "OGR_PMTILES_ITERATOR_THRESHOLD", // from ogrpmtilestileiterator.cpp
+   "OGR_PROFILING_STATS_ENABLED", // from ogr_profiling.cpp
    "OGR_PROMOTE_TO_INTEGER64", // from ogrgeopackagelayer.cpp, ogrsqlitelayer.cpp
    "OGR_S57_OPTIONS", // from ogrs57datasource.cpp
    "OGR_SETFIELD_NUMERIC_WARNING", // from ogrfeature.cpp
@@ -780,6 +820,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_LOCK_DELAY", // from ogrshapedatasource.cpp
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
+   "OGR_SIDECAR_SPATIAL_INDEX", // from ogrspatialindexsidecar.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
    "OGR_SQL_STRICT", // from swq.cpp
@@ -952,6 +993,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "QHULL_LOG_TO_TEMP_FILE", // from delaunay.c
    "RAW_CHECK_FILE_SIZE", // from rawdataset.cpp
    "RAW_MEM_ALLOC_LIMIT_MB", // from rawdataset.cpp
+   "RAW_USE_MMAP", // from rawdataset.cpp
    "REPORT_COMPD_CS", // from dteddataset.cpp, srtmhgtdataset.cpp
    "RESTRICT_OUTPUT_DATASET_UPDATE", // from gdalwarp_lib.cpp
    "RL2_SHOW_ALL_PYRAMID_LEVELS", // from rasterlite2.cpp
@@ -1010,8 +1052,12 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "USERPROFILE", // from cpl_aws.cpp, cpl_azure.cpp, cpl_conv.cpp, cpl_google_cloud.cpp, cpl_path.cpp, gdalwmscache.cpp, ogrgmlasconf.cpp, wcsutils.cpp
    "VRT_ALLOW_MEM_DRIVER", // from vrtrasterband.cpp
    "VRT_MIN_MAX_FROM_SOURCES", // from vrtsourcedrasterband.cpp
+   "VRT_MOSAIC_OVERVIEWS", // from vrtdataset.cpp
    "VRT_NUM_THREADS", // from vrtdataset.cpp
+   "VRT_PROCESSED_DATASET_CACHE_SIZE", // from vrtprocesseddataset.cpp
    "VRT_SHARED_SOURCE", // from vrtsources.cpp
+   "VRT_SOURCE_STREAMING_THRESHOLD", // from vrtdataset.cpp
+   "VRT_VECTORIZED_EXPRESSION", // from pixelfunctions.cpp
    "VRT_VIRTUAL_OVERVIEWS", // from gdalbuildvrt_lib.cpp, vrtdataset.cpp
    "VSI_CACHE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp, cpl_vsil_unix_stdio_64.cpp, cpl_vsil_win32.cpp
    "VSI_CACHE_SIZE", // from cpl_vsil_cache.cpp
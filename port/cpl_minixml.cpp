@@ -96,24 +96,6 @@ static CPL_INLINE char ReadChar(ParseContext *psContext)
     return chReturn;
 }
 
-/************************************************************************/
-/*                             UnreadChar()                             */
-/************************************************************************/
-
-static CPL_INLINE void UnreadChar(ParseContext *psContext, char chToUnread)
-
-{
-    if (chToUnread == '\0')
-        return;
-
-    CPLAssert(chToUnread == psContext->pszInput[psContext->nInputOffset - 1]);
-
-    psContext->nInputOffset--;
-
-    if (chToUnread == 10)
-        psContext->nInputLine--;
-}
-
 /************************************************************************/
 /*                           ReallocToken()                             */
 /************************************************************************/
@@ -169,6 +151,69 @@ static CPL_INLINE bool _AddToToken(ParseContext *psContext, char chNewChar)
     if (!_AddToToken(psContext, chNewChar))                                    \
         goto fail;
 
+/************************************************************************/
+/*                          AddRangeToToken()                           */
+/************************************************************************/
+
+/* Append the nLen next characters of the input to the token, and consume */
+/* them. Much faster than ReadChar() + AddToToken() for long text runs. */
+
+static bool AddRangeToToken(ParseContext *psContext, size_t nLen)
+
+{
+    while (psContext->nTokenSize + nLen + 2 > psContext->nTokenMaxSize)
+    {
+        if (!ReallocToken(psContext))
+            return false;
+    }
+
+    const char *pszStart = psContext->pszInput + psContext->nInputOffset;
+    memcpy(psContext->pszToken + psContext->nTokenSize, pszStart, nLen);
+    psContext->nTokenSize += nLen;
+    psContext->pszToken[psContext->nTokenSize] = '\0';
+
+    psContext->nInputOffset += static_cast<int>(nLen);
+    psContext->nInputLine +=
+        static_cast<int>(std::count(pszStart, pszStart + nLen, 10));
+    return true;
+}
+
+/************************************************************************/
+/*                        AddRangeUntilToToken()                        */
+/************************************************************************/
+
+/* Append the input to the token until pszTerminator (excluded) or the */
+/* end of the input. */
+
+static bool AddRangeUntilToToken(ParseContext *psContext,
+                                 const char *pszTerminator)
+
+{
+    const char *pszStart = psContext->pszInput + psContext->nInputOffset;
+    const char *pszEnd = strstr(pszStart, pszTerminator);
+    return AddRangeToToken(psContext,
+                           pszEnd ? static_cast<size_t>(pszEnd - pszStart)
+                                  : strlen(pszStart));
+}
+
+/************************************************************************/
+/*                       UnescapeTokenIfNeeded()                        */
+/************************************************************************/
+
+static void UnescapeTokenIfNeeded(ParseContext *psContext)
+
+{
+    if (memchr(psContext->pszToken, '&', psContext->nTokenSize) != nullptr)
+    {
+        int nLength = 0;
+        char *pszUnescaped =
+            CPLUnescapeString(psContext->pszToken, &nLength, CPLES_XML);
+        strcpy(psContext->pszToken, pszUnescaped);
+        CPLFree(pszUnescaped);
+        psContext->nTokenSize = strlen(psContext->pszToken);
+    }
+}
+
 /************************************************************************/
 /*                             ReadToken()                              */
 /************************************************************************/
@@ -196,10 +241,8 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         ReadChar(psContext);
         ReadChar(psContext);
 
-        while (!STARTS_WITH_CI(psContext->pszInput + psContext->nInputOffset,
-                               "-->") &&
-               (chNext = ReadChar(psContext)) != '\0')
-            AddToToken(psContext, chNext);
+        if (!AddRangeUntilToToken(psContext, "-->"))
+            goto fail;
 
         // Skip "-->" characters.
         ReadChar(psContext);
@@ -304,10 +347,8 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         ReadChar(psContext);
         ReadChar(psContext);
 
-        while (!STARTS_WITH_CI(psContext->pszInput + psContext->nInputOffset,
-                               "]]>") &&
-               (chNext = ReadChar(psContext)) != '\0')
-            AddToToken(psContext, chNext);
+        if (!AddRangeUntilToToken(psContext, "]]>"))
+            goto fail;
 
         // Skip "]]>" characters.
         ReadChar(psContext);
@@ -368,8 +409,11 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     {
         psContext->eTokenType = TString;
 
-        while ((chNext = ReadChar(psContext)) != '"' && chNext != '\0')
-            AddToToken(psContext, chNext);
+        if (!AddRangeToToken(
+                psContext,
+                strcspn(psContext->pszInput + psContext->nInputOffset, "\"")))
+            goto fail;
+        chNext = ReadChar(psContext);
 
         if (chNext != '"')
         {
@@ -382,22 +426,17 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         }
 
         // Do we need to unescape it?
-        if (strchr(psContext->pszToken, '&') != nullptr)
-        {
-            int nLength = 0;
-            char *pszUnescaped =
-                CPLUnescapeString(psContext->pszToken, &nLength, CPLES_XML);
-            strcpy(psContext->pszToken, pszUnescaped);
-            CPLFree(pszUnescaped);
-            psContext->nTokenSize = strlen(psContext->pszToken);
-        }
+        UnescapeTokenIfNeeded(psContext);
     }
     else if (psContext->bInElement && chNext == '\'')
     {
         psContext->eTokenType = TString;
 
-        while ((chNext = ReadChar(psContext)) != '\'' && chNext != '\0')
-            AddToToken(psContext, chNext);
+        if (!AddRangeToToken(
+                psContext,
+                strcspn(psContext->pszInput + psContext->nInputOffset, "'")))
+            goto fail;
+        chNext = ReadChar(psContext);
 
         if (chNext != '\'')
         {
@@ -410,15 +449,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         }
 
         // Do we need to unescape it?
-        if (strchr(psContext->pszToken, '&') != nullptr)
-        {
-            int nLength = 0;
-            char *pszUnescaped =
-                CPLUnescapeString(psContext->pszToken, &nLength, CPLES_XML);
-            strcpy(psContext->pszToken, pszUnescaped);
-            CPLFree(pszUnescaped);
-            psContext->nTokenSize = strlen(psContext->pszToken);
-        }
+        UnescapeTokenIfNeeded(psContext);
     }
     /* -------------------------------------------------------------------- */
     /*      Collect an unquoted string, terminated by a open angle          */
@@ -429,20 +460,13 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         psContext->eTokenType = TString;
 
         AddToToken(psContext, chNext);
-        while ((chNext = ReadChar(psContext)) != '<' && chNext != '\0')
-            AddToToken(psContext, chNext);
-        UnreadChar(psContext, chNext);
+        if (!AddRangeToToken(
+                psContext,
+                strcspn(psContext->pszInput + psContext->nInputOffset, "<")))
+            goto fail;
 
         // Do we need to unescape it?
-        if (strchr(psContext->pszToken, '&') != nullptr)
-        {
-            int nLength = 0;
-            char *pszUnescaped =
-                CPLUnescapeString(psContext->pszToken, &nLength, CPLES_XML);
-            strcpy(psContext->pszToken, pszUnescaped);
-            CPLFree(pszUnescaped);
-            psContext->nTokenSize = strlen(psContext->pszToken);
-        }
+        UnescapeTokenIfNeeded(psContext);
     }
 
     /* -------------------------------------------------------------------- */
@@ -456,17 +480,12 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         // Add the first character to the token regardless of what it is.
         AddToToken(psContext, chNext);
 
-        for (chNext = ReadChar(psContext);
-             (chNext >= 'A' && chNext <= 'Z') ||
-             (chNext >= 'a' && chNext <= 'z') || chNext == '-' ||
-             chNext == '_' || chNext == '.' || chNext == ':' ||
-             (chNext >= '0' && chNext <= '9');
-             chNext = ReadChar(psContext))
-        {
-            AddToToken(psContext, chNext);
-        }
-
-        UnreadChar(psContext, chNext);
+        if (!AddRangeToToken(
+                psContext,
+                strspn(psContext->pszInput + psContext->nInputOffset,
+                       "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                       "-_.:0123456789")))
+            goto fail;
     }
 
     return psContext->eTokenType;
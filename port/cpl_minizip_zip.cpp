@@ -2446,11 +2446,8 @@ CPLErr CPLAddFileInZip(void *hZip, const char *pszArchiveFilename,
         zi->nChunkSize = nChunkSize;
 
         const char *pszThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
-        if (pszThreads == nullptr || EQUAL(pszThreads, "ALL_CPUS"))
-            zi->nThreads = CPLGetNumCPUs();
-        else
-            zi->nThreads = atoi(pszThreads);
-        zi->nThreads = std::max(1, std::min(128, zi->nThreads));
+        zi->nThreads =
+            CPLParseNumThreads(pszThreads ? pszThreads : "ALL_CPUS", 128);
     }
 
     aosNewsOptions.SetNameValue("ZIP64",
@@ -423,6 +423,37 @@ void CPLCleanupMasterMutex()
 #endif
 }
 
+/************************************************************************/
+/*                         CPLParseNumThreads()                         */
+/************************************************************************/
+
+/**
+ * Return the number of threads corresponding to a NUM_THREADS like value.
+ *
+ * The value may be "ALL_CPUS", for the number of CPUs returned by
+ * CPLGetNumCPUs(), or an integer. The result is clamped to the
+ * [1, nMaxThreads] range, so that it can be directly used to size a thread
+ * pool. A null, empty or invalid value results in 1.
+ *
+ * This is typically used on the value of the GDAL_NUM_THREADS configuration
+ * option, or of NUM_THREADS creation and open options.
+ *
+ * @param pszValue Value to parse, or NULL.
+ * @param nMaxThreads Maximum number of threads. Must be at least 1.
+ * @return number of threads, in the [1, nMaxThreads] range.
+ * @since GDAL 3.11
+ */
+int CPLParseNumThreads(const char *pszValue, int nMaxThreads)
+{
+    if (pszValue == nullptr)
+        return 1;
+    const GIntBig nThreads = EQUAL(pszValue, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : CPLAtoGIntBig(pszValue);
+    return static_cast<int>(
+        std::clamp<GIntBig>(nThreads, 1, std::max(1, nMaxThreads)));
+}
+
 /************************************************************************/
 /*                        CPLCleanupTLSList()                           */
 /*                                                                      */
@@ -23,6 +23,8 @@
 #include "cpl_virtualmem.h"
 
 #include <cassert>
+#include <algorithm>
+
 // TODO(schwehr): Should ucontext.h be included?
 // #include <ucontext.h>
 
@@ -169,6 +171,13 @@ typedef struct
     int nRetry;     // Number of consecutive
                     // retries to that last page.
 
+    int nReadAheadMaxPages;    // Maximum number of pages read ahead.
+    bool bReadAheadMultiPage;  // Whether pfnCachePage accepts ranges of
+                               // several pages.
+    int iReadAheadLastPage;    // Last page of the detected access pattern.
+    int nReadAheadStride;      // Stride, in pages, of the access pattern.
+    int nReadAheadWindow;      // Current number of pages read ahead.
+
     CPLVirtualMemCachePageCbk pfnCachePage;      // Called when a page is
                                                  // mapped.
     CPLVirtualMemUnCachePageCbk pfnUnCachePage;  // Called when a (writable)
@@ -435,6 +444,7 @@ CPLVirtualMem *CPLVirtualMemNew(size_t nSize, size_t nCacheSize,
     ctxt->nLRUSize = 0;
     ctxt->iLastPage = -1;
     ctxt->nRetry = 0;
+    ctxt->iReadAheadLastPage = -1;
     ctxt->pfnCachePage = pfnCachePage;
     ctxt->pfnUnCachePage = pfnUnCachePage;
 
@@ -806,6 +816,121 @@ static void CPLVirtualMemAddPage(CPLVirtualMemVMA *ctxt, void *target_addr,
     // cppcheck-suppress memleak
 }
 
+/************************************************************************/
+/*                     CPLVirtualMemFillPageRange()                     */
+/************************************************************************/
+
+// Fill nPages consecutive still unmapped pages, starting at iFirstPage, with
+// a single call to pfnCachePage, and register them in the LRU.
+static void CPLVirtualMemFillPageRange(CPLVirtualMemVMA *ctxt, int iFirstPage,
+                                       int nPages)
+{
+    const size_t nPageSize = ctxt->sBase.nPageSize;
+    char *const pBase = static_cast<char *>(ctxt->sBase.pData);
+    char *const start_page_addr =
+        pBase + static_cast<size_t>(iFirstPage) * nPageSize;
+    const size_t nRangeSize = static_cast<size_t>(nPages) * nPageSize;
+
+    char *pPagesToFill = nullptr;
+    if (ctxt->sBase.bSingleThreadUsage)
+    {
+        pPagesToFill = start_page_addr;
+        const int nRet =
+            mprotect(pPagesToFill, nRangeSize, PROT_READ | PROT_WRITE);
+        IGNORE_OR_ASSERT_IN_DEBUG(nRet == 0);
+    }
+    else
+    {
+        void *pRet = mmap(nullptr, nRangeSize, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        // Read-ahead is only a best effort.
+        if (pRet == MAP_FAILED)
+            return;
+        pPagesToFill = static_cast<char *>(pRet);
+    }
+
+    size_t nToFill = nRangeSize;
+    if (start_page_addr + nToFill >= pBase + ctxt->sBase.nSize)
+        nToFill = pBase + ctxt->sBase.nSize - start_page_addr;
+
+    ctxt->pfnCachePage(reinterpret_cast<CPLVirtualMem *>(ctxt),
+                       start_page_addr - pBase, pPagesToFill, nToFill,
+                       ctxt->sBase.pCbkUserData);
+
+    for (int i = 0; i < nPages; i++)
+    {
+        CPLVirtualMemAddPage(ctxt, start_page_addr + i * nPageSize,
+                             pPagesToFill + i * nPageSize, OP_LOAD,
+                             pthread_self());
+    }
+}
+
+/************************************************************************/
+/*                        CPLVirtualMemReadAhead()                      */
+/************************************************************************/
+
+// Called by the helper thread once page iPage has been filled after a fault.
+// If that fault continues a sequential or constant-stride access pattern,
+// fill the pages that are expected to be accessed next, doubling the
+// read-ahead window each time the pattern is confirmed.
+static void CPLVirtualMemReadAhead(CPLVirtualMemVMA *ctxt, int iPage)
+{
+#ifndef HAVE_5ARGS_MREMAP
+    // Without mremap(), pages can only be filled in place by pausing the
+    // other threads, which is not worth doing speculatively.
+    if (!ctxt->sBase.bSingleThreadUsage)
+        return;
+#endif
+
+    // Never read ahead more than a quarter of the cache, so that the page
+    // that triggered the fault and the previous window are not evicted.
+    const int nMaxPages =
+        std::min(ctxt->nReadAheadMaxPages, ctxt->nCacheMaxSizeInPages / 4);
+    if (nMaxPages <= 0)
+        return;
+
+    const int nStride = iPage - ctxt->iReadAheadLastPage;
+    ctxt->iReadAheadLastPage = iPage;
+    if (nStride == 0 || nStride != ctxt->nReadAheadStride)
+    {
+        ctxt->nReadAheadStride = nStride;
+        ctxt->nReadAheadWindow = 0;
+        return;
+    }
+    ctxt->nReadAheadWindow =
+        std::min(std::max(2, 2 * ctxt->nReadAheadWindow), nMaxPages);
+
+    const GIntBig nPageCount = static_cast<GIntBig>(
+        (ctxt->sBase.nSize + ctxt->sBase.nPageSize - 1) /
+        ctxt->sBase.nPageSize);
+    const bool bContiguous = nStride == 1 && ctxt->bReadAheadMultiPage;
+    int k = 1;
+    while (k <= ctxt->nReadAheadWindow)
+    {
+        const GIntBig iNext = iPage + static_cast<GIntBig>(k) * nStride;
+        if (iNext < 0 || iNext >= nPageCount)
+            break;
+        int nPages = 1;
+        if (!TEST_BIT(ctxt->pabitMappedPages, iNext))
+        {
+            while (bContiguous && k + nPages <= ctxt->nReadAheadWindow &&
+                   iNext + nPages < nPageCount &&
+                   !TEST_BIT(ctxt->pabitMappedPages, iNext + nPages))
+            {
+                nPages++;
+            }
+#if defined DEBUG_VIRTUALMEM && defined DEBUG_VERBOSE
+            fprintfstderr("reading ahead %d page(s) from page %d\n", nPages,
+                          static_cast<int>(iNext));
+#endif
+            CPLVirtualMemFillPageRange(ctxt, static_cast<int>(iNext), nPages);
+        }
+        ctxt->iReadAheadLastPage = static_cast<int>(
+            iNext + static_cast<GIntBig>(nPages - 1) * nStride);
+        k += nPages;
+    }
+}
+
 /************************************************************************/
 /*                    CPLVirtualMemGetOpTypeImm()                       */
 /************************************************************************/
@@ -1581,6 +1706,25 @@ void CPLVirtualMemPin(CPLVirtualMem *ctxt, void *pAddr, size_t nSize,
     }
 }
 
+/************************************************************************/
+/*                      CPLVirtualMemSetReadAhead()                     */
+/************************************************************************/
+
+void CPLVirtualMemSetReadAhead(CPLVirtualMem *ctxt, size_t nMaxReadAheadSize,
+                               int bMultiPageCachePageCbk)
+{
+    while (ctxt->pVMemBase != nullptr)
+        ctxt = ctxt->pVMemBase;
+    if (ctxt->eType == VIRTUAL_MEM_TYPE_FILE_MEMORY_MAPPED)
+        return;
+
+    CPLVirtualMemVMA *ctxtVMA = reinterpret_cast<CPLVirtualMemVMA *>(ctxt);
+    ctxtVMA->nReadAheadMaxPages = static_cast<int>(
+        std::min(nMaxReadAheadSize / ctxt->nPageSize,
+                 static_cast<size_t>(ctxtVMA->nCacheMaxSizeInPages)));
+    ctxtVMA->bReadAheadMultiPage = CPL_TO_BOOL(bMultiPageCachePageCbk);
+}
+
 /************************************************************************/
 /*                   CPLVirtualMemManagerSIGSEGVHandler()               */
 /************************************************************************/
@@ -1826,6 +1970,8 @@ static void CPLVirtualMemManagerThread(void * /* unused_param */)
                     // register it in the LRU.
                     CPLVirtualMemAddPage(ctxt, start_page_addr, pPageToFill,
                                          msg.opType, msg.hRequesterThread);
+
+                    CPLVirtualMemReadAhead(ctxt, iPage);
                 }
             }
 
@@ -1971,6 +2117,12 @@ void CPLVirtualMemPin(CPLVirtualMem * /* ctxt */, void * /* pAddr */,
 {
 }
 
+void CPLVirtualMemSetReadAhead(CPLVirtualMem * /* ctxt */,
+                               size_t /* nMaxReadAheadSize */,
+                               int /* bMultiPageCachePageCbk */)
+{
+}
+
 void CPLVirtualMemManagerTerminate(void)
 {
 }
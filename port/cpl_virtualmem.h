@@ -350,6 +350,41 @@ void CPL_DLL CPLVirtualMemUnDeclareThread(CPLVirtualMem *ctxt);
 void CPL_DLL CPLVirtualMemPin(CPLVirtualMem *ctxt, void *pAddr, size_t nSize,
                               int bWriteOp);
 
+/** Configure read-ahead on a virtual memory mapping.
+ *
+ * When read-ahead is enabled, the page faults of a mapping created with
+ * CPLVirtualMemNew() are monitored to detect sequential or constant-stride
+ * access patterns (for example scanning a tiled mapping tile row by tile
+ * row, or tile column by tile column). Each time such a pattern is confirmed,
+ * the pages that are expected to be accessed next are filled right after
+ * the page that triggered the fault, so that they no longer trigger faults
+ * of their own. The read-ahead window starts at 2 pages and doubles as long
+ * as the pattern continues, up to nMaxReadAheadSize bytes, and at most a
+ * quarter of the cache size.
+ *
+ * If bMultiPageCachePageCbk is TRUE, ranges of consecutive pages are filled
+ * with a single call to the pfnCachePage callback, whose nToFill argument is
+ * then a multiple of the page size (except at the end of the mapping). This
+ * allows the callback to issue larger I/O requests.
+ *
+ * Read-ahead is disabled by default. It is not available for mappings that
+ * are accessed by several threads on systems where mremap() does not accept
+ * 5 arguments, nor for file mappings.
+ *
+ * This function should be called before the mapping is accessed.
+ *
+ * @param ctxt context returned by CPLVirtualMemNew().
+ * @param nMaxReadAheadSize maximum number of bytes to read ahead, or 0 to
+ *                          disable read-ahead.
+ * @param bMultiPageCachePageCbk whether the pfnCachePage callback accepts
+ *                               ranges of several pages.
+ *
+ * @since GDAL 3.11
+ */
+void CPL_DLL CPLVirtualMemSetReadAhead(CPLVirtualMem *ctxt,
+                                       size_t nMaxReadAheadSize,
+                                       int bMultiPageCachePageCbk);
+
 /** Cleanup any resource and handlers related to virtual memory.
  *
  * This function must be called after the last CPLVirtualMem object has
@@ -481,6 +481,10 @@ GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
 void CPL_DLL VSINetworkStatsReset(void);
 char CPL_DLL *VSINetworkStatsGetAsSerializedJSON(char **papszOptions);
 
+void CPL_DLL VSIIOStatsReset(void);
+char CPL_DLL *VSIIOStatsGetAsSerializedJSON(char **papszOptions);
+char CPL_DLL *VSIIOStatsGetAsPrometheusText(char **papszOptions);
+
 /* ==================================================================== */
 /*      Install special file access handlers.                           */
 /* ==================================================================== */
@@ -513,6 +517,7 @@ void VSIInstallHdfsHandler(void);     /* No reason to export that */
 void VSIInstallWebHdfsHandler(void);  /* No reason to export that */
 void VSIInstallStdoutHandler(void);   /* No reason to export that */
 void CPL_DLL VSIInstallSparseFileHandler(void);
+void VSIInstallShmFileHandler(void); /* No reason to export that */
 void VSIInstallTarFileHandler(void);    /* No reason to export that */
 void VSIInstallCachedFileHandler(void); /* No reason to export that */
 void CPL_DLL VSIInstallCryptFileHandler(void);
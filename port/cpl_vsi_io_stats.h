@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Generic instrumentation of VSI file handles
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSI_IO_STATS_H_INCLUDED
+#define CPL_VSI_IO_STATS_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_vsi_virtual.h"
+
+#include <atomic>
+#include <string>
+
+namespace cpl
+{
+
+/************************************************************************/
+/*                            VSIIOStats                                */
+/************************************************************************/
+
+/** Collects, for all file systems, latency histograms and transferred bytes
+ * of file operations, as well as cache hit/miss and retry counters reported
+ * by the handlers themselves.
+ *
+ * Enabled with the CPL_VSIL_IO_STATS_ENABLED configuration option.
+ */
+class VSIIOStats
+{
+    static std::atomic<int> gnEnabled;
+
+    static void ReadEnabled();
+
+  public:
+    static inline bool IsEnabled()
+    {
+        if (gnEnabled.load() < 0)
+            ReadEnabled();
+        return gnEnabled.load() == TRUE;
+    }
+
+    /** Returns a handle that times the operations done on poBaseHandle and
+     * takes ownership of it. */
+    static VSIVirtualHandle *WrapHandle(VSIVirtualHandle *poBaseHandle,
+                                        const char *pszFilename);
+
+    /** Account for a hit in a handler-level cache, for the file whose
+     * operation is currently running in this thread. */
+    static void LogCacheHit();
+
+    /** Account for a miss in a handler-level cache. */
+    static void LogCacheMiss();
+
+    /** Account for a retry of a failed request (typically network ones). */
+    static void LogRetry();
+
+    static void Reset();
+
+    static std::string GetReportAsSerializedJSON(bool bPerPath);
+
+    static std::string GetReportAsPrometheusText(bool bPerPath);
+};
+
+}  // namespace cpl
+
+#endif  // #ifndef DOXYGEN_SKIP
+
+#endif  // CPL_VSI_IO_STATS_H_INCLUDED
@@ -39,6 +39,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_vsi_io_stats.h"
 #include "cpl_vsil_curl_class.h"
 
 // To avoid aliasing to GetDiskFreeSpace to GetDiskFreeSpaceA on Windows
@@ -532,6 +533,10 @@ char **CPLReadDir(const char *pszPath)
  *     only the pszName and nMode members of VSIDIR are guaranteed to be set.
  *     This is implemented efficiently for the Unix virtual file system.
  * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS: (GDAL >= 3.11) For /vsis3/ and /vsigs/,
+ *     and nRecurseDepth = -1, number of threads used to list concurrently the
+ *     content of the first-level subdirectories. Defaults to 1.
+ * </li>
  * </ul>
  *
  * @return a handle, or NULL in case of error
@@ -994,6 +999,10 @@ int VSICopyFileRestartable(const char *pszSource, const char *pszTarget,
  * <li>NUM_THREADS=integer. (GDAL >= 3.1) Number of threads to use for parallel
  * file copying. Only use for when /vsis3/, /vsigs/, /vsiaz/ or /vsiadls/ is in
  * source or target. The default is 10 since GDAL 3.3</li>
+ * <li>LIST_NUM_THREADS=integer or ALL_CPUS. (GDAL >= 3.11) Number of threads
+ * to use to list the source and target directories, when they are on /vsis3/
+ * or /vsigs/. The content of each first-level subdirectory is listed
+ * concurrently. The default is 1.</li>
  * <li>CHUNK_SIZE=integer. (GDAL >= 3.1) Maximum size of chunk (in bytes) to use
  * to split large objects when downloading them from /vsis3/, /vsigs/, /vsiaz/
  * or /vsiadls/ to local file system, or for upload to /vsis3/, /vsiaz/ or
@@ -1925,6 +1934,25 @@ VSIVirtualHandle *VSIFilesystemHandler::Open(const char *pszFilename,
     return Open(pszFilename, pszAccess, false, nullptr);
 }
 
+/************************************************************************/
+/*                          GetCopyBufferSize()                         */
+/************************************************************************/
+
+// Returns the size of the buffer used to copy pszSource. Reads on network
+// file systems use a larger buffer, so that they can download several parts
+// in parallel.
+static size_t GetCopyBufferSize(const char *pszSource,
+                                vsi_l_offset nSourceSize)
+{
+    constexpr size_t DEFAULT_BUFFER_SIZE = 10 * 4096;
+    if (pszSource == nullptr || VSIIsLocal(pszSource))
+        return DEFAULT_BUFFER_SIZE;
+    constexpr size_t NETWORK_BUFFER_SIZE = 64 * 1024 * 1024;
+    if (nSourceSize < NETWORK_BUFFER_SIZE)
+        return std::max(DEFAULT_BUFFER_SIZE, static_cast<size_t>(nSourceSize));
+    return NETWORK_BUFFER_SIZE;
+}
+
 /************************************************************************/
 /*                             CopyFile()                               */
 /************************************************************************/
@@ -1964,6 +1992,8 @@ int VSIFilesystemHandler::CopyFile(const char *pszSource, const char *pszTarget,
         return -1;
     }
 
+    const size_t nBufferSize = GetCopyBufferSize(pszSource, nSourceSize);
+
     CPLString osMsg;
     if (pszSource)
         osMsg.Printf("Copying of %s", pszSource);
@@ -1971,8 +2001,19 @@ int VSIFilesystemHandler::CopyFile(const char *pszSource, const char *pszTarget,
         pszSource = "(unknown filename)";
 
     int ret = 0;
-    constexpr size_t nBufferSize = 10 * 4096;
-    std::vector<GByte> abyBuffer(nBufferSize, 0);
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(nBufferSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate copy buffer of %u bytes",
+                 static_cast<unsigned>(nBufferSize));
+        VSIFCloseL(fpOut);
+        return -1;
+    }
     GUIntBig nOffset = 0;
     while (true)
     {
@@ -2196,8 +2237,23 @@ bool VSIFilesystemHandler::Sync(const char *pszSource, const char *pszTarget,
     }
 
     bool ret = true;
-    constexpr size_t nBufferSize = 10 * 4096;
-    std::vector<GByte> abyBuffer(nBufferSize, 0);
+    const size_t nBufferSize =
+        GetCopyBufferSize(osSourceWithoutSlash.c_str(),
+                          static_cast<vsi_l_offset>(sSource.st_size));
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(nBufferSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate copy buffer of %u bytes",
+                 static_cast<unsigned>(nBufferSize));
+        VSIFCloseL(fpIn);
+        VSIFCloseL(fpOut);
+        return false;
+    }
     GUIntBig nOffset = 0;
     CPLString osMsg;
     osMsg.Printf("Copying of %s", osSourceWithoutSlash.c_str());
@@ -2686,6 +2742,8 @@ VSILFILE *VSIFOpenEx2L(const char *pszFilename, const char *pszAccess,
 
     VSILFILE *fp = poFSHandler->Open(pszFilename, pszAccess,
                                      CPL_TO_BOOL(bSetError), papszOptions);
+    if (fp && cpl::VSIIOStats::IsEnabled())
+        fp = cpl::VSIIOStats::WrapHandle(fp, pszFilename);
 
     VSIDebug4("VSIFOpenEx2L(%s,%s,%d) = %p", pszFilename, pszAccess, bSetError,
               fp);
@@ -4017,6 +4075,7 @@ VSIFileManager *VSIFileManager::Get()
     VSIInstallHdfsHandler();
     VSIInstallStdoutHandler();
     VSIInstallSparseFileHandler();
+    VSIInstallShmFileHandler();
     VSIInstallTarFileHandler();
     VSIInstallCachedFileHandler();
     VSIInstallCryptFileHandler();
@@ -30,6 +30,7 @@
 #include "cpl_error.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_vsi_io_stats.h"
 #include "cpl_mem_cache.h"
 #include "cpl_noncopyablevector.h"
 
@@ -380,8 +381,13 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
 
     for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
     {
-        if (!m_oCache.contains(iBlock))
+        if (m_oCache.contains(iBlock))
         {
+            cpl::VSIIOStats::LogCacheHit();
+        }
+        else
+        {
+            cpl::VSIIOStats::LogCacheMiss();
             size_t nBlocksToLoad = 1;
             while (iBlock + nBlocksToLoad <= nEndBlock &&
                    !m_oCache.contains(iBlock + nBlocksToLoad))
@@ -184,7 +184,7 @@ size_t VSIChunkedWriteHandle::Write(const void *pBuffer, size_t nSize,
 
     if (m_hCurlMulti == nullptr)
     {
-        m_hCurlMulti = curl_multi_init();
+        m_hCurlMulti = VSICURLMultiInit();
     }
 
     WriteFuncStruct sWriteFuncData;
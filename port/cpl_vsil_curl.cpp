@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -26,10 +27,12 @@
 #include "cpl_json_header.h"
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_vsi_io_stats.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
 
@@ -125,6 +128,7 @@ void VSICurlAuthParametersChanged()
 // Use VSICURLGetDownloadChunkSize() and GetMaxRegions()
 static int N_MAX_REGIONS_DO_NOT_USE_DIRECTLY = 0;
 static int DOWNLOAD_CHUNK_SIZE_DO_NOT_USE_DIRECTLY = 0;
+static int N_MAX_READAHEAD_BLOCKS_DO_NOT_USE_DIRECTLY = 0;
 
 /************************************************************************/
 /*                    VSICURLReadGlobalEnvVariables()                   */
@@ -209,6 +213,27 @@ static void VSICURLReadGlobalEnvVariables()
             N_MAX_REGIONS_DO_NOT_USE_DIRECTLY = std::max(
                 1, static_cast<int>(nCacheSize /
                                     DOWNLOAD_CHUNK_SIZE_DO_NOT_USE_DIRECTLY));
+
+            // Defaults to 128 chunks, that is 2 MB with the default chunk
+            // size.
+            GIntBig nMaxReadaheadSize =
+                128 * static_cast<GIntBig>(nChunkSize);
+            const char *pszMaxReadaheadSize = CPLGetConfigOption(
+                "CPL_VSIL_CURL_MAX_READAHEAD_SIZE", nullptr);
+            if (pszMaxReadaheadSize &&
+                CPLParseMemorySize(pszMaxReadaheadSize, &nMaxReadaheadSize,
+                                   nullptr) != CE_None)
+            {
+                nMaxReadaheadSize = 128 * static_cast<GIntBig>(nChunkSize);
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Could not parse value for "
+                         "CPL_VSIL_CURL_MAX_READAHEAD_SIZE. "
+                         "Using default value of " CPL_FRMT_GIB " instead.",
+                         nMaxReadaheadSize);
+            }
+            N_MAX_READAHEAD_BLOCKS_DO_NOT_USE_DIRECTLY = static_cast<int>(
+                std::clamp<GIntBig>(nMaxReadaheadSize / nChunkSize, 1,
+                                    N_MAX_REGIONS_DO_NOT_USE_DIRECTLY));
         }
     };
 
@@ -235,6 +260,16 @@ static int GetMaxRegions()
     return N_MAX_REGIONS_DO_NOT_USE_DIRECTLY;
 }
 
+/************************************************************************/
+/*                        GetMaxReadaheadBlocks()                       */
+/************************************************************************/
+
+static int GetMaxReadaheadBlocks()
+{
+    VSICURLReadGlobalEnvVariables();
+    return N_MAX_READAHEAD_BLOCKS_DO_NOT_USE_DIRECTLY;
+}
+
 /************************************************************************/
 /*          VSICurlFindStringSensitiveExceptEscapeSequences()           */
 /************************************************************************/
@@ -2298,6 +2333,51 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
     }
 }
 
+/************************************************************************/
+/*                       UpdateBlocksToDownload()                       */
+/************************************************************************/
+
+// Adjusts the number of blocks of the next download to the access pattern
+// observed on this handle.
+void VSICurlHandle::UpdateBlocksToDownload(vsi_l_offset nOffsetToDownload,
+                                           int nDownloadChunkSize)
+{
+    const int nMaxBlocks = GetMaxReadaheadBlocks();
+
+    if (nOffsetToDownload == lastDownloadedOffset)
+    {
+        // In case of consecutive reads (of small size), we use a
+        // heuristic that we will read the file sequentially, so
+        // we double the requested size to decrease the number of
+        // client/server roundtrips. Once the scan is confirmed (e.g.
+        // Parquet or FlatGeobuf features read in order), grow faster to
+        // reach multi-megabyte requests sooner.
+        ++m_nSequentialDownloads;
+        const int nFactor = m_nSequentialDownloads >= 3 ? 4 : 2;
+        nBlocksToDownload = nBlocksToDownload > nMaxBlocks / nFactor
+                                ? nMaxBlocks
+                                : nBlocksToDownload * nFactor;
+    }
+    else if (lastDownloadedOffset != VSI_L_OFFSET_MAX &&
+             nOffsetToDownload > lastDownloadedOffset &&
+             nOffsetToDownload - lastDownloadedOffset <=
+                 static_cast<vsi_l_offset>(nBlocksToDownload) *
+                     nDownloadChunkSize)
+    {
+        // Forward skip smaller than the previous request, e.g. a reader
+        // jumping over a column chunk it is not interested in: this is
+        // still a scan, so keep the current request size.
+        m_nSequentialDownloads = 1;
+        nBlocksToDownload = std::min(nBlocksToDownload, nMaxBlocks);
+    }
+    else
+    {
+        // Random reads, such as COG tiles: request exact ranges.
+        m_nSequentialDownloads = 0;
+        nBlocksToDownload = 1;
+    }
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2323,6 +2403,15 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+
+    // Large reads, e.g. from VSICopyFile() or a reader ingesting the whole
+    // file, are split into parts downloaded in parallel.
+    const size_t nParallelRead =
+        ParallelRead(pBuffer, iterOffset, nBufferRequestSize);
+    pBuffer = static_cast<char *>(pBuffer) + nParallelRead;
+    iterOffset += nParallelRead;
+    nBufferRequestSize -= nParallelRead;
+
     while (nBufferRequestSize)
     {
         // Don't try to read after end of file.
@@ -2346,25 +2435,13 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
         if (psRegion != nullptr)
         {
+            VSIIOStats::LogCacheHit();
             osRegion = *psRegion;
         }
         else
         {
-            if (nOffsetToDownload == lastDownloadedOffset)
-            {
-                // In case of consecutive reads (of small size), we use a
-                // heuristic that we will read the file sequentially, so
-                // we double the requested size to decrease the number of
-                // client/server roundtrips.
-                constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
-                if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
-                    nBlocksToDownload *= 2;
-            }
-            else
-            {
-                // Random reads. Cancel the above heuristics.
-                nBlocksToDownload = 1;
-            }
+            VSIIOStats::LogCacheMiss();
+            UpdateBlocksToDownload(nOffsetToDownload, knDOWNLOAD_CHUNK_SIZE);
 
             // Ensure that we will request at least the number of blocks
             // to satisfy the remaining buffer size to read.
@@ -2399,6 +2476,10 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             if (nBlocksToDownload > knMAX_REGIONS)
                 nBlocksToDownload = knMAX_REGIONS;
 
+            NetworkStatisticsLogger::LogReadahead(
+                m_nSequentialDownloads > 0,
+                static_cast<size_t>(nBlocksToDownload) * knDOWNLOAD_CHUNK_SIZE);
+
             osRegion = DownloadRegion(nOffsetToDownload, nBlocksToDownload);
             if (osRegion.empty())
             {
@@ -2444,6 +2525,96 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     return ret;
 }
 
+/************************************************************************/
+/*                            ParallelRead()                            */
+/************************************************************************/
+
+// Reads [nOffset, nOffset + nSize[ as parts downloaded concurrently, and
+// directly reassembled in order into pBuffer, bypassing the region cache.
+// Returns the number of bytes read, or 0 if a parallel read is not
+// appropriate or failed, in which case the caller should use the regular
+// code path.
+size_t VSICurlHandle::ParallelRead(void *pBuffer, vsi_l_offset nOffset,
+                                   size_t nSize)
+{
+    const int nMaxConcurrentRequests = std::clamp(
+        atoi(CPLGetConfigOption(
+            "CPL_VSIL_CURL_PARALLEL_READ_MAX_CONCURRENT_REQUESTS", "8")),
+        0, 1000);
+    if (nMaxConcurrentRequests <= 1)
+        return 0;
+
+    GIntBig nPartSize = 8 * 1024 * 1024;
+    const char *pszPartSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE", nullptr);
+    if (pszPartSize &&
+        (CPLParseMemorySize(pszPartSize, &nPartSize, nullptr) != CE_None ||
+         nPartSize < VSICURLGetDownloadChunkSize()))
+    {
+        return 0;
+    }
+
+    // Only worth it if it results in at least 2 parts, within the file.
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize || nOffset >= oFileProp.fileSize)
+        return 0;
+    const size_t nToRead = static_cast<size_t>(std::min(
+        static_cast<vsi_l_offset>(nSize), oFileProp.fileSize - nOffset));
+    if (static_cast<GUIntBig>(nToRead) < 2 * static_cast<GUIntBig>(nPartSize))
+        return 0;
+
+    const size_t nPartSizeSizeT = static_cast<size_t>(nPartSize);
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    size_t nRead = 0;
+    while (nRead < nToRead)
+    {
+        apData.clear();
+        anOffsets.clear();
+        anSizes.clear();
+        size_t nBatchSize = 0;
+        for (int i = 0;
+             i < nMaxConcurrentRequests && nRead + nBatchSize < nToRead; ++i)
+        {
+            const size_t nThisPartSize =
+                std::min(nPartSizeSizeT, nToRead - nRead - nBatchSize);
+            apData.push_back(static_cast<GByte *>(pBuffer) + nRead +
+                             nBatchSize);
+            anOffsets.push_back(nOffset + nRead + nBatchSize);
+            anSizes.push_back(nThisPartSize);
+            nBatchSize += nThisPartSize;
+        }
+
+        if (ENABLE_DEBUG)
+        {
+            CPLDebug(poFS->GetDebugKey(),
+                     "Parallel read of " CPL_FRMT_GUIB "-" CPL_FRMT_GUIB
+                     " in %d parts",
+                     static_cast<GUIntBig>(anOffsets.front()),
+                     static_cast<GUIntBig>(anOffsets.front() + nBatchSize - 1),
+                     static_cast<int>(anSizes.size()));
+        }
+
+        if (ReadMultiRangeParallel(static_cast<int>(anSizes.size()),
+                                   apData.data(), anOffsets.data(),
+                                   anSizes.data(),
+                                   /* bMergeConsecutiveRanges = */ false) != 0)
+        {
+            break;
+        }
+        nRead += nBatchSize;
+    }
+
+    if (nRead > 0)
+    {
+        // Subsequent reads following this one are sequential ones.
+        lastDownloadedOffset = nOffset + nRead;
+        m_nSequentialDownloads = std::max(m_nSequentialDownloads, 1);
+    }
+    return nRead;
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2477,6 +2648,24 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                                 panSizes);
     }
 
+    return ReadMultiRangeParallel(
+        nRanges, ppData, panOffsets, panSizes,
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE")));
+}
+
+/************************************************************************/
+/*                       ReadMultiRangeParallel()                       */
+/************************************************************************/
+
+// Issues one request per range (or group of consecutive ranges if
+// bMergeConsecutiveRanges), all run concurrently on the multi handle.
+int VSICurlHandle::ReadMultiRangeParallel(int const nRanges,
+                                          void **const ppData,
+                                          const vsi_l_offset *const panOffsets,
+                                          const size_t *const panSizes,
+                                          bool bMergeConsecutiveRanges)
+{
     UpdateQueryString();
 
     bool bHasExpired = false;
@@ -2490,19 +2679,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     }
 
     CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
-#ifdef CURLPIPE_MULTIPLEX
-    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
-    // used)
-    // Not that this does not enable HTTP/1.1 pipeling, which is not
-    // recommended for example by Google Cloud Storage.
-    // For HTTP/1.1, parallel connections work better since you can get
-    // results out of order.
-    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
-    {
-        curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
-                          CURLPIPE_MULTIPLEX);
-    }
-#endif
 
     std::vector<CURL *> aHandles;
     std::vector<WriteFuncStruct> asWriteFuncData(nRanges);
@@ -2517,9 +2693,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
     std::vector<CurlErrBuffer> asCurlErrors(nRanges);
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
-
     for (int i = 0, iRequest = 0; i < nRanges;)
     {
         size_t nSize = 0;
@@ -3321,20 +3494,31 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    // Ranges separated by up to that number of bytes are fetched with a
+    // single request, the bytes in between being discarded. Clamped to the
+    // limit of bytes that can be fetched, which also prevents overflows in
+    // the offset computations below.
+    constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
+    const long long nMaxGapOption = std::strtoll(
+        CPLGetConfigOption("GDAL_HTTP_ADVISE_READ_MAX_GAP", "0"), nullptr, 10);
+    const vsi_l_offset nMaxGap = std::max<vsi_l_offset>(
+        SIZE_COG_MARKERS,
+        std::min<vsi_l_offset>(
+            nLimit, static_cast<vsi_l_offset>(std::max(0LL, nMaxGapOption))));
 
     try
     {
         m_aoAdviseReadRanges.resize(nRanges);
         int iRequest = 0;
+        size_t nTotalSize = 0;
         for (int i = 0; i < nRanges;)
         {
             int iNext = i;
             // Identify consecutive ranges
-            constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
             auto nEndOffset = panOffsets[iNext] + panSizes[iNext];
             while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
                    panOffsets[iNext + 1] > panOffsets[iNext] &&
-                   panOffsets[iNext] + panSizes[iNext] + SIZE_COG_MARKERS >=
+                   panOffsets[iNext] + panSizes[iNext] + nMaxGap >=
                        panOffsets[iNext + 1] &&
                    panOffsets[iNext + 1] + panSizes[iNext + 1] > nEndOffset)
             {
@@ -3351,6 +3535,16 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 continue;
             }
 
+            // The gaps between merged ranges are downloaded too
+            if (nSize > nLimit - nTotalSize)
+            {
+                CPLDebug(poFS->GetDebugKey(),
+                         "Trying to request too many bytes in AdviseRead()");
+                m_aoAdviseReadRanges.clear();
+                return;
+            }
+            nTotalSize += nSize;
+
             if (m_aoAdviseReadRanges[iRequest] == nullptr)
                 m_aoAdviseReadRanges[iRequest] =
                     std::make_unique<AdviseReadRange>();
@@ -3380,29 +3574,25 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
              static_cast<unsigned>(m_aoAdviseReadRanges.size()));
 #endif
 
+    // Maximum number of ranges being downloaded at the same time. Ranges are
+    // requested in the order they have been specified, so that consumers
+    // reading them in that order can start processing the first ones before
+    // the last ones have been received. 0 means no limit.
+    const size_t nMaxConcurrentRequests = static_cast<size_t>(std::max(
+        0,
+        atoi(CPLGetConfigOption("GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS",
+                                "0"))));
+
     // coverity[uninit_member,copy_constructor_call]
-    const auto task = [this, aosHTTPOptions](const std::string &osURL)
+    const auto task =
+        [this, aosHTTPOptions, nMaxConcurrentRequests](const std::string &osURL)
     {
-        CURLM *hMultiHandle = curl_multi_init();
+        CURLM *hMultiHandle = VSICURLMultiInit();
 
         NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
         NetworkStatisticsFile oContextFile(m_osFilename.c_str());
         NetworkStatisticsAction oContextAction("AdviseRead");
 
-#ifdef CURLPIPE_MULTIPLEX
-        // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
-        // used)
-        // Not that this does not enable HTTP/1.1 pipeling, which is not
-        // recommended for example by Google Cloud Storage.
-        // For HTTP/1.1, parallel connections work better since you can get
-        // results out of order.
-        if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
-        {
-            curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
-                              CURLPIPE_MULTIPLEX);
-        }
-#endif
-
         std::vector<CURL *> aHandles;
         std::vector<WriteFuncStruct> asWriteFuncData(
             m_aoAdviseReadRanges.size());
@@ -3488,9 +3678,28 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
                                        headers);
             aHeaders.push_back(headers);
-            curl_multi_add_handle(hMultiHandle, hCurlHandle);
         }
 
+        size_t iNextHandle = 0;
+        size_t nInFlightRequests = 0;
+        const auto AddPendingHandles =
+            [hMultiHandle, nMaxConcurrentRequests, &aHandles, &iNextHandle,
+             &nInFlightRequests]()
+        {
+            bool bAdded = false;
+            while (iNextHandle < aHandles.size() &&
+                   (nMaxConcurrentRequests == 0 ||
+                    nInFlightRequests < nMaxConcurrentRequests))
+            {
+                curl_multi_add_handle(hMultiHandle, aHandles[iNextHandle]);
+                ++iNextHandle;
+                ++nInFlightRequests;
+                bAdded = true;
+            }
+            return bAdded;
+        };
+        AddPendingHandles();
+
         size_t nTotalDownloaded = 0;
         const auto DealWithRequest =
             [this, &osURL, &nTotalDownloaded, &oMapHandleToIdx, &asCurlErrors,
@@ -3562,7 +3771,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             {
                 // loop
             }
-            if (!still_running)
+            if (!still_running && iNextHandle == aHandles.size())
             {
                 break;
             }
@@ -3575,10 +3784,12 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 if (msg && (msg->msg == CURLMSG_DONE))
                 {
                     DealWithRequest(msg->easy_handle);
+                    --nInFlightRequests;
                 }
             } while (msg);
 
-            CPLMultiPerformWait(hMultiHandle, repeats);
+            if (!AddPendingHandles())
+                CPLMultiPerformWait(hMultiHandle, repeats);
         }
         CPLHTTPRestoreSigPipeHandler(old_handler);
 
@@ -3797,7 +4008,7 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     auto &conn = GetConnectionCache()[this];
     if (conn.hCurlMultiHandle == nullptr)
     {
-        conn.hCurlMultiHandle = curl_multi_init();
+        conn.hCurlMultiHandle = VSICURLMultiInit();
     }
     return conn.hCurlMultiHandle;
 }
@@ -3818,6 +4029,241 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                    GetPersistentCacheFilename()                      */
+/************************************************************************/
+
+// Downloaded regions may also be stored in a persistent on-disk cache,
+// shared by all processes using the same CPL_VSIL_CURL_PERSISTENT_CACHE_DIR.
+// Entries are content-addressed by a hash of the URL, the version of the
+// remote file (its ETag, or its size and modification time) and the offset,
+// so that a modified remote file is never served from stale entries.
+
+constexpr const char *PERSISTENT_CACHE_SIGNATURE = "GDAL_VSICURL_CACHE_V1";
+constexpr const char *PERSISTENT_CACHE_EXTENSION = "bin";
+
+// Returns the cache file for the region of pszURL at nFileOffsetStart, or an
+// empty string if the persistent cache is disabled, or if the version of the
+// remote file is unknown.
+std::string VSICurlFilesystemHandlerBase::GetPersistentCacheFilename(
+    const char *pszURL, vsi_l_offset nFileOffsetStart)
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string();
+
+    FileProp oFileProp;
+    if (!GetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES)
+        return std::string();
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    if (!oFileProp.ETag.empty())
+        osKey += oFileProp.ETag;
+    else if (oFileProp.bHasComputedFileSize && oFileProp.mTime != 0)
+        osKey += CPLSPrintf(CPL_FRMT_GUIB " " CPL_FRMT_GIB,
+                            static_cast<GUIntBig>(oFileProp.fileSize),
+                            static_cast<GIntBig>(oFileProp.mTime));
+    else
+        return std::string();
+    osKey += CPLSPrintf("\n" CPL_FRMT_GUIB "\n%d",
+                        static_cast<GUIntBig>(nFileOffsetStart),
+                        VSICURLGetDownloadChunkSize());
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osFilename =
+        CPLFormFilenameSafe(pszDir, pszHex, PERSISTENT_CACHE_EXTENSION);
+    CPLFree(pszHex);
+    return osFilename;
+}
+
+/************************************************************************/
+/*                     VSICURLReadPersistentCache()                     */
+/************************************************************************/
+
+static std::shared_ptr<std::string>
+VSICURLReadPersistentCache(const std::string &osCacheFilename)
+{
+    VSILFILE *fp = VSIFOpenL(osCacheFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+
+    GByte *pabyContent = nullptr;
+    vsi_l_offset nContentSize = 0;
+    const int nMaxSize = VSICURLGetDownloadChunkSize() + 1024;
+    const bool bOK =
+        VSIIngestFile(fp, nullptr, &pabyContent, &nContentSize, nMaxSize) !=
+        FALSE;
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+    if (!bOK)
+        return nullptr;
+
+    // The file is made of the signature, the size of the region, and the
+    // region itself.
+    std::shared_ptr<std::string> out;
+    const char *pszContent = reinterpret_cast<const char *>(pabyContent);
+    const size_t nSignatureLen = strlen(PERSISTENT_CACHE_SIGNATURE);
+    if (nContentSize > nSignatureLen &&
+        memcmp(pszContent, PERSISTENT_CACHE_SIGNATURE, nSignatureLen) == 0 &&
+        pszContent[nSignatureLen] == '\n')
+    {
+        const char *pszSize = pszContent + nSignatureLen + 1;
+        const char *pszEOL = strchr(pszSize, '\n');
+        if (pszEOL)
+        {
+            const size_t nHeaderSize = pszEOL + 1 - pszContent;
+            const GUIntBig nRegionSize = CPLScanUIntBig(
+                pszSize, static_cast<int>(pszEOL - pszSize));
+            if (nRegionSize == nContentSize - nHeaderSize)
+            {
+                out = std::make_shared<std::string>(
+                    pszContent + nHeaderSize,
+                    static_cast<size_t>(nRegionSize));
+            }
+        }
+    }
+    if (!out)
+    {
+        CPLDebug("VSICURL", "Ignoring invalid persistent cache file %s",
+                 osCacheFilename.c_str());
+    }
+    CPLFree(pabyContent);
+    return out;
+}
+
+/************************************************************************/
+/*                     VSICURLTrimPersistentCache()                     */
+/************************************************************************/
+
+// Removes the oldest entries of the persistent cache until its size is
+// below 90% of nMaxSize. Only one process at a time does it.
+static void VSICURLTrimPersistentCache(const std::string &osDir,
+                                       GIntBig nMaxSize)
+{
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(osDir.c_str(), "trim", nullptr);
+    void *hLock = CPLLockFile(osLockFilename.c_str(), 0);
+    if (hLock == nullptr)
+        return;
+
+    struct Entry
+    {
+        time_t nMTime;
+        GIntBig nSize;
+        std::string osFilename;
+    };
+
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    const CPLStringList aosFiles(VSIReadDir(osDir.c_str()));
+    for (const char *pszFile : aosFiles)
+    {
+        if (!EQUAL(CPLGetExtensionSafe(pszFile).c_str(),
+                   PERSISTENT_CACHE_EXTENSION))
+            continue;
+        std::string osFilename =
+            CPLFormFilenameSafe(osDir.c_str(), pszFile, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            aoEntries.push_back({sStat.st_mtime,
+                                 static_cast<GIntBig>(sStat.st_size),
+                                 std::move(osFilename)});
+        }
+    }
+
+    if (nTotalSize > nMaxSize)
+    {
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        const GIntBig nTargetSize = nMaxSize / 10 * 9;
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oEntry.osFilename.c_str()) == 0)
+                nTotalSize -= oEntry.nSize;
+        }
+        CPLDebug("VSICURL",
+                 "Persistent cache %s trimmed to " CPL_FRMT_GIB " bytes",
+                 osDir.c_str(), nTotalSize);
+    }
+
+    CPLUnlockFile(hLock);
+}
+
+/************************************************************************/
+/*                     VSICURLWritePersistentCache()                    */
+/************************************************************************/
+
+static void VSICURLWritePersistentCache(const std::string &osCacheFilename,
+                                        const char *pData, size_t nSize)
+{
+    const std::string osDir = CPLGetPathSafe(osCacheFilename.c_str());
+
+    // Write to a temporary file that is then renamed, so that concurrent
+    // readers never see a partially written cache file.
+    static std::atomic<GUIntBig> gnTmpCounter{0};
+    const std::string osTmpFilename =
+        osCacheFilename + CPLSPrintf("." CPL_FRMT_GIB "_" CPL_FRMT_GUIB ".tmp",
+                                     CPLGetPID(),
+                                     static_cast<GUIntBig>(++gnTmpCounter));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        VSIMkdirRecursive(osDir.c_str(), 0755);
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if (fp == nullptr)
+        {
+            CPLDebugOnce("VSICURL", "Cannot create persistent cache file %s",
+                         osTmpFilename.c_str());
+            return;
+        }
+    }
+
+    const std::string osHeader =
+        CPLSPrintf("%s\n" CPL_FRMT_GUIB "\n", PERSISTENT_CACHE_SIGNATURE,
+                   static_cast<GUIntBig>(nSize));
+    bool bOK = VSIFWriteL(osHeader.data(), 1, osHeader.size(), fp) ==
+                   osHeader.size() &&
+               VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK ||
+        VSIRename(osTmpFilename.c_str(), osCacheFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    // Check the size of the cache at the first write, and then each time
+    // a tenth of its maximum size has been written by this process.
+    GIntBig nMaxSize = 1024 * 1024 * 1024;
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE", nullptr);
+    if (pszMaxSize &&
+        CPLParseMemorySize(pszMaxSize, &nMaxSize, nullptr) != CE_None)
+    {
+        nMaxSize = 1024 * 1024 * 1024;
+    }
+    static std::atomic<GIntBig> gnBytesSinceLastTrim{-1};
+    const GIntBig nWritten = static_cast<GIntBig>(osHeader.size() + nSize);
+    GIntBig nExpected = gnBytesSinceLastTrim.load();
+    bool bTrim;
+    do
+    {
+        bTrim = nExpected < 0 || nExpected + nWritten > nMaxSize / 10;
+    } while (!gnBytesSinceLastTrim.compare_exchange_weak(
+        nExpected, bTrim ? 0 : nExpected + nWritten));
+    if (bTrim)
+        VSICURLTrimPersistentCache(osDir, nMaxSize);
+}
+
 /************************************************************************/
 /*                          GetRegion()                                 */
 /************************************************************************/
@@ -3826,17 +4272,35 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    const std::string osCacheFilename =
+        GetPersistentCacheFilename(pszURL, nFileOffsetStart);
+    if (!osCacheFilename.empty())
+    {
+        auto out = VSICURLReadPersistentCache(osCacheFilename);
+        if (out)
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out);
+            return out;
+        }
     }
 
     return nullptr;
@@ -3850,6 +4314,12 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
+    // Do the disk I/O before taking the mutex.
+    const std::string osCacheFilename =
+        GetPersistentCacheFilename(pszURL, nFileOffsetStart);
+    if (!osCacheFilename.empty())
+        VSICURLWritePersistentCache(osCacheFilename, pData, nSize);
+
     CPLMutexHolder oHolder(&hMutex);
 
     std::shared_ptr<std::string> value(new std::string());
@@ -4149,7 +4619,14 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "directory listing.' default='YES'/>"                                      \
     "  <Option name='CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT' "            \
     "type='integer' description='Maximum number of bytes AdviseRead() is "     \
-    "allowed to fetch at once' default='104857600'/>"
+    "allowed to fetch at once' default='104857600'/>"                          \
+    "  <Option name='GDAL_HTTP_ADVISE_READ_MAX_GAP' type='integer' "           \
+    "description='Maximum number of bytes between two ranges of "              \
+    "AdviseRead() for them to be fetched with a single request' "              \
+    "default='0'/>"                                                            \
+    "  <Option name='GDAL_HTTP_ADVISE_READ_MAX_CONCURRENT_REQUESTS' "          \
+    "type='integer' description='Maximum number of AdviseRead() ranges "       \
+    "downloaded at the same time. 0 means unlimited' default='0'/>"
 
 const char *VSICurlFilesystemHandlerBase::GetOptionsStatic()
 {
@@ -5928,6 +6405,24 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogReadahead(bool bSequential,
+                                           size_t nRequestedBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        if (bSequential)
+            counters->nSequentialReadahead++;
+        else
+            counters->nRandomReadahead++;
+        counters->nMaxReadaheadBytes =
+            std::max(counters->nMaxReadaheadBytes,
+                     static_cast<GIntBig>(nRequestedBytes));
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5957,6 +6452,14 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nSequentialReadahead || counters.nRandomReadahead)
+    {
+        CPLJSONObject oReadahead;
+        oReadahead.Add("sequential_count", counters.nSequentialReadahead);
+        oReadahead.Add("random_count", counters.nRandomReadahead);
+        oReadahead.Add("max_request_bytes", counters.nMaxReadaheadBytes);
+        oJSON.Add("readahead", oReadahead);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -6110,6 +6613,45 @@ void VSICURLDestroyCacheFileProp()
     poCacheFileProp = nullptr;
 }
 
+/************************************************************************/
+/*                         VSICURLMultiInit()                           */
+/************************************************************************/
+
+// Creates a multi handle, with HTTP/2 multiplexing enabled and the number of
+// concurrent connections per host limited as configured.
+CURLM *VSICURLMultiInit()
+{
+    CURLM *hCurlMultiHandle = curl_multi_init();
+    if (hCurlMultiHandle == nullptr)
+        return nullptr;
+
+#ifdef CURLPIPE_MULTIPLEX
+    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
+    // used)
+    // Not that this does not enable HTTP/1.1 pipeling, which is not
+    // recommended for example by Google Cloud Storage.
+    // For HTTP/1.1, parallel connections work better since you can get
+    // results out of order.
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
+#endif
+
+    // With HTTP/2 multiplexing, transfers to a given host beyond that limit
+    // are multiplexed over the existing connections rather than queued.
+    const long nMaxHostConnections = std::max(
+        0, atoi(CPLGetConfigOption("GDAL_HTTP_MAX_HOST_CONNECTIONS", "0")));
+    if (nMaxHostConnections > 0)
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS,
+                          nMaxHostConnections);
+    }
+
+    return hCurlMultiHandle;
+}
+
 /************************************************************************/
 /*                       VSICURLMultiCleanup()                          */
 /************************************************************************/
@@ -300,6 +300,9 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
                    size_t nSize, const char *pData);
 
+    std::string GetPersistentCacheFilename(const char *pszURL,
+                                           vsi_l_offset nFileOffsetStart);
+
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
                               vsi_l_offset startOffset, int nBlocks);
@@ -375,6 +378,11 @@ class VSICurlHandle : public VSIVirtualHandle
 
     vsi_l_offset lastDownloadedOffset = VSI_L_OFFSET_MAX;
     int nBlocksToDownload = 1;
+    // Number of consecutive downloads that followed the previous one.
+    int m_nSequentialDownloads = 0;
+
+    void UpdateBlocksToDownload(vsi_l_offset nOffsetToDownload,
+                                int nDownloadChunkSize);
 
     bool bStopOnInterruptUntilUninstall = false;
     bool bInterrupted = false;
@@ -411,6 +419,11 @@ class VSICurlHandle : public VSIVirtualHandle
     int ReadMultiRangeSingleGet(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes);
+    int ReadMultiRangeParallel(int nRanges, void **ppData,
+                               const vsi_l_offset *panOffsets,
+                               const size_t *panSizes,
+                               bool bMergeConsecutiveRanges);
+    size_t ParallelRead(void *pBuffer, vsi_l_offset nOffset, size_t nSize);
     std::string GetRedirectURLIfValid(bool &bHasExpired,
                                       CPLStringList &aosHTTPOptions) const;
 
@@ -600,7 +613,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
     virtual int CopyObject(const char *oldpath, const char *newpath,
                            CSLConstList papszMetadata);
 
-    int RmdirRecursiveInternal(const char *pszDirname, int nBatchSize);
+    int RmdirRecursiveInternal(const char *pszDirname, int nBatchSize,
+                               const char *pszNumThreads);
 
     virtual bool
     IsAllowedHeaderForObjectCreation(const char * /* pszHeaderName */)
@@ -1049,6 +1063,9 @@ class NetworkStatisticsLogger
         GIntBig nPUT = 0;
         GIntBig nPOST = 0;
         GIntBig nDELETE = 0;
+        GIntBig nSequentialReadahead = 0;
+        GIntBig nRandomReadahead = 0;
+        GIntBig nMaxReadaheadBytes = 0;
         GIntBig nGETDownloadedBytes = 0;
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
@@ -1132,6 +1149,8 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogReadahead(bool bSequential, size_t nRequestedBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -1198,6 +1217,7 @@ void VSICURLInvalidateCachedFileProp(const char *pszURL);
 void VSICURLInvalidateCachedFilePropPrefix(const char *pszURL);
 void VSICURLDestroyCacheFileProp();
 
+CURLM *VSICURLMultiInit();
 void VSICURLMultiCleanup(CURLM *hCurlMultiHandle);
 
 //! @endcond
@@ -862,7 +862,9 @@ int VSIGSFSHandler::RmdirRecursive(const char *pszDirname)
     const int nBatchSize = std::min(
         100, atoi(CPLGetConfigOption("CPL_VSIGS_UNLINK_BATCH_SIZE", "100")));
 
-    return RmdirRecursiveInternal(pszDirname, nBatchSize);
+    return RmdirRecursiveInternal(
+        pszDirname, nBatchSize,
+        CPLGetConfigOption("CPL_VSIGS_RMDIR_RECURSIVE_NUM_THREADS", nullptr));
 }
 
 /************************************************************************/
@@ -82,6 +82,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -96,6 +97,7 @@
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
@@ -146,6 +148,31 @@ typedef struct
     vsi_l_offset out;
 } GZipSnapshot;
 
+// Size of the deflate sliding window, that must be restored to resume
+// decompression at an access point.
+constexpr int GZIP_INDEX_WINDOW_SIZE = 32768;
+
+// Point of the deflate stream, at a block boundary, from which decompression
+// can be resumed without decompressing what precedes it.
+struct VSIGZipAccessPoint
+{
+    vsi_l_offset in = 0;  // offset in the base file of the first full byte
+    vsi_l_offset out = 0;  // offset in the uncompressed stream
+    int bits = 0;          // number of bits of the previous byte to use
+    GByte prevByte = 0;    // value of the byte preceding "in"
+    // Last GZIP_INDEX_WINDOW_SIZE uncompressed bytes before "out",
+    // deflate compressed.
+    std::string osCompressedWindow{};
+};
+
+// Index of access points of a single member gzip file, as built by
+// VSIGZipHandle::BuildIndex(), and persisted in a .gzidx file.
+struct VSIGZipIndex
+{
+    vsi_l_offset nUncompressedSize = 0;
+    std::vector<VSIGZipAccessPoint> aoPoints{};
+};
+
 class VSIGZipHandle final : public VSIVirtualHandle
 {
     VSIVirtualHandle *m_poBaseHandle = nullptr;
@@ -180,12 +207,21 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{};
+    bool m_bCRCUnknown = false; /* set after resuming at an access point */
+    int m_nThreads = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
     int gzrewind();
     uLong getLong();
 
+    std::shared_ptr<VSIGZipIndex> BuildIndex(vsi_l_offset nSpan);
+    bool SeekToAccessPoint(const VSIGZipAccessPoint &oPoint);
+    size_t ParallelRead(void *pBuffer, size_t nSize);
+
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipHandle)
 
   public:
@@ -239,6 +275,8 @@ class VSIGZipHandle final : public VSIVirtualHandle
     {
         m_bCanSaveInfo = false;
     }
+
+    void LoadOrBuildIndex();
 };
 
 #ifdef ENABLE_DEFLATE64
@@ -409,6 +447,8 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
     }
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
+    poHandle->m_poIndex = m_poIndex;
+    poHandle->m_nThreads = m_nThreads;
 
     // Most important: duplicate the snapshots!
 
@@ -722,6 +762,7 @@ int VSIGZipHandle::gzrewind()
     stream.avail_in = 0;
     stream.next_in = inbuf;
     crc = 0;
+    m_bCRCUnknown = false;
     if (!m_transparent)
         CPL_IGNORE_RET_VAL(inflateReset(&stream));
     in = 0;
@@ -815,6 +856,9 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         if (offset == 0 && m_uncompressed_size != 0)
         {
             out = m_uncompressed_size;
+            // Make sure that subsequent reads do not return data from the
+            // real position of the stream.
+            z_err = Z_STREAM_END;
             return true;
         }
 
@@ -859,8 +903,29 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         return false;
     }
 
-    for (unsigned int i = 0; i < m_compressed_size / snapshot_byte_interval + 1;
-         i++)
+    if (m_poIndex && original_nWhence != SEEK_END)
+    {
+        // Resume decompression at the last access point before the target
+        // offset, if it is after the current position.
+        const vsi_l_offset nTarget = out + offset;
+        const auto &aoPoints = m_poIndex->aoPoints;
+        auto oIter = std::upper_bound(
+            aoPoints.begin(), aoPoints.end(), nTarget,
+            [](vsi_l_offset nVal, const VSIGZipAccessPoint &oPoint)
+            { return nVal < oPoint.out; });
+        if (oIter != aoPoints.begin() && std::prev(oIter)->out > out)
+        {
+            if (!SeekToAccessPoint(*std::prev(oIter)))
+            {
+                CPL_VSIL_GZ_RETURN(FALSE);
+                return false;
+            }
+            offset = nTarget - out;
+        }
+    }
+
+    for (unsigned int i = 0;
+         !m_poIndex && i < m_compressed_size / snapshot_byte_interval + 1; i++)
     {
         if (snapshots[i].posInBaseHandle == 0)
             break;
@@ -1020,6 +1085,14 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
 
     const unsigned len =
         static_cast<unsigned int>(nSize) * static_cast<unsigned int>(nMemb);
+
+    if (m_poIndex && m_nThreads > 1)
+    {
+        const size_t nRead = ParallelRead(buf, len);
+        if (nRead != static_cast<size_t>(-1))
+            return nRead / nSize;
+    }
+
     Bytef *pStart =
         static_cast<Bytef *>(buf);  // Start off point for crc computation.
     // == stream.next_out but not forced far (for MSDOS).
@@ -1089,7 +1162,9 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
             }
             GZipSnapshot *snapshot = &snapshots[(posInBaseHandle - startOff) /
                                                 snapshot_byte_interval];
-            if (snapshot->posInBaseHandle == 0)
+            // Snapshots are useless when an index is available, and would
+            // record an invalid CRC after resuming at an access point.
+            if (!m_poIndex && snapshot->posInBaseHandle == 0)
             {
                 snapshot->crc = crc32(
                     crc, pStart, static_cast<uInt>(stream.next_out - pStart));
@@ -1178,7 +1253,7 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
             else if (m_expected_crc == 0)
             {
                 const uLong read_crc = static_cast<unsigned long>(getLong());
-                if (read_crc != crc)
+                if (!m_bCRCUnknown && read_crc != crc)
                 {
                     CPLError(CE_Failure, CPLE_FileIO,
                              "CRC error. Got %X instead of %X",
@@ -1313,6 +1388,543 @@ int VSIGZipHandle::Close()
     return 0;
 }
 
+constexpr const char GZIP_INDEX_SIGNATURE[] = "GDALGZIX";
+constexpr uint32_t GZIP_INDEX_VERSION = 1;
+
+// Integers of .gzidx files are stored in little endian order.
+template <class T> static void VSIGZipIndexToLSB(T &nVal)
+{
+    if constexpr (sizeof(T) == 4)
+        CPL_LSBPTR32(&nVal);
+    else if constexpr (sizeof(T) == 8)
+        CPL_LSBPTR64(&nVal);
+    else
+        static_assert(sizeof(T) == 1);
+}
+
+/************************************************************************/
+/*                       VSIGZipGetIndexFilename()                      */
+/************************************************************************/
+
+// Returns the name of the .gzidx file storing the index of pszBaseFileName,
+// either next to it, or in CPL_VSIL_GZIP_INDEX_DIR.
+static std::string VSIGZipGetIndexFilename(const char *pszBaseFileName)
+{
+    const char *pszDir = CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string(pszBaseFileName).append(".gzidx");
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(pszBaseFileName, strlen(pszBaseFileName), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osFilename = CPLFormFilenameSafe(pszDir, pszHex, "gzidx");
+    CPLFree(pszHex);
+    return osFilename;
+}
+
+/************************************************************************/
+/*                          VSIGZipReadIndex()                          */
+/************************************************************************/
+
+// Reads the index file osFilename, and returns it if it matches the
+// signature (size and modification time) of the indexed file.
+static std::shared_ptr<VSIGZipIndex>
+VSIGZipReadIndex(const std::string &osFilename, uint64_t nFileSize,
+                 uint64_t nMTime)
+{
+    GByte *pabyData = nullptr;
+    vsi_l_offset nDataSize = 0;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (!VSIIngestFile(nullptr, osFilename.c_str(), &pabyData, &nDataSize,
+                           -1))
+            return nullptr;
+    }
+    std::unique_ptr<GByte, VSIFreeReleaser> oDataHolder(pabyData);
+
+    size_t nPos = 0;
+    const auto ReadUInt = [pabyData, nDataSize, &nPos](auto &nVal)
+    {
+        if (nDataSize - nPos < sizeof(nVal))
+            return false;
+        memcpy(&nVal, pabyData + nPos, sizeof(nVal));
+        VSIGZipIndexToLSB(nVal);
+        nPos += sizeof(nVal);
+        return true;
+    };
+
+    uint32_t nVersion = 0;
+    uint64_t nIndexFileSize = 0;
+    uint64_t nIndexMTime = 0;
+    uint64_t nUncompressedSize = 0;
+    uint64_t nPoints = 0;
+    if (nDataSize < strlen(GZIP_INDEX_SIGNATURE) ||
+        memcmp(pabyData, GZIP_INDEX_SIGNATURE, strlen(GZIP_INDEX_SIGNATURE)) !=
+            0)
+    {
+        return nullptr;
+    }
+    nPos = strlen(GZIP_INDEX_SIGNATURE);
+    if (!ReadUInt(nVersion) || nVersion != GZIP_INDEX_VERSION ||
+        !ReadUInt(nIndexFileSize) || !ReadUInt(nIndexMTime) ||
+        !ReadUInt(nUncompressedSize) || !ReadUInt(nPoints))
+    {
+        return nullptr;
+    }
+    if (nIndexFileSize != nFileSize || nIndexMTime != nMTime)
+    {
+        CPLDebug("GZIP", "%s is out of date", osFilename.c_str());
+        return nullptr;
+    }
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    poIndex->nUncompressedSize = nUncompressedSize;
+    // Each access point takes at least 22 bytes
+    if (nPoints > (nDataSize - nPos) / 22)
+        return nullptr;
+    poIndex->aoPoints.resize(static_cast<size_t>(nPoints));
+    for (auto &oPoint : poIndex->aoPoints)
+    {
+        uint64_t nIn = 0;
+        uint64_t nOut = 0;
+        uint8_t nBits = 0;
+        uint8_t nPrevByte = 0;
+        uint32_t nWindowSize = 0;
+        if (!ReadUInt(nIn) || !ReadUInt(nOut) || !ReadUInt(nBits) ||
+            !ReadUInt(nPrevByte) || !ReadUInt(nWindowSize) || nBits > 7 ||
+            nWindowSize > nDataSize - nPos)
+        {
+            return nullptr;
+        }
+        oPoint.in = nIn;
+        oPoint.out = nOut;
+        oPoint.bits = nBits;
+        oPoint.prevByte = nPrevByte;
+        oPoint.osCompressedWindow.assign(
+            reinterpret_cast<const char *>(pabyData + nPos), nWindowSize);
+        nPos += nWindowSize;
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                         VSIGZipWriteIndex()                          */
+/************************************************************************/
+
+static bool VSIGZipWriteIndex(const std::string &osFilename,
+                              const VSIGZipIndex &oIndex, uint64_t nFileSize,
+                              uint64_t nMTime)
+{
+    std::string osData(GZIP_INDEX_SIGNATURE);
+    const auto WriteUInt = [&osData](auto nVal)
+    {
+        VSIGZipIndexToLSB(nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    WriteUInt(GZIP_INDEX_VERSION);
+    WriteUInt(nFileSize);
+    WriteUInt(nMTime);
+    WriteUInt(static_cast<uint64_t>(oIndex.nUncompressedSize));
+    WriteUInt(static_cast<uint64_t>(oIndex.aoPoints.size()));
+    for (const auto &oPoint : oIndex.aoPoints)
+    {
+        WriteUInt(static_cast<uint64_t>(oPoint.in));
+        WriteUInt(static_cast<uint64_t>(oPoint.out));
+        WriteUInt(static_cast<uint8_t>(oPoint.bits));
+        WriteUInt(static_cast<uint8_t>(oPoint.prevByte));
+        WriteUInt(static_cast<uint32_t>(oPoint.osCompressedWindow.size()));
+        osData += oPoint.osCompressedWindow;
+    }
+
+    // Write to a temporary file that is renamed, so that readers never see
+    // a partially written index.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    const std::string osTmpFilename =
+        std::string(osFilename).append(".tmp").append(
+            std::to_string(CPLGetPID()));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+        return false;
+    bool bRet = VSIFWriteL(osData.data(), 1, osData.size(), fp) ==
+                osData.size();
+    bRet = VSIFCloseL(fp) == 0 && bRet;
+    bRet = bRet && VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+    if (!bRet)
+        VSIUnlink(osTmpFilename.c_str());
+    return bRet;
+}
+
+/************************************************************************/
+/*                  VSIGZipInitStreamAtAccessPoint()                    */
+/************************************************************************/
+
+// Prepares the raw inflate stream psStream, that must have been initialized
+// with inflateInit2(-MAX_WBITS), to decompress data from oPoint.
+static bool VSIGZipInitStreamAtAccessPoint(z_stream *psStream,
+                                           const VSIGZipAccessPoint &oPoint)
+{
+    GByte abyWindow[GZIP_INDEX_WINDOW_SIZE];
+    size_t nWindowSize = 0;
+    if (CPLZLibInflate(oPoint.osCompressedWindow.data(),
+                       oPoint.osCompressedWindow.size(), abyWindow,
+                       sizeof(abyWindow), &nWindowSize) == nullptr ||
+        nWindowSize != sizeof(abyWindow))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Corrupted gzip index");
+        return false;
+    }
+    if (inflateReset(psStream) != Z_OK)
+        return false;
+    if (oPoint.bits &&
+        inflatePrime(psStream, oPoint.bits,
+                     oPoint.prevByte >> (8 - oPoint.bits)) != Z_OK)
+        return false;
+    return inflateSetDictionary(psStream, abyWindow, sizeof(abyWindow)) ==
+           Z_OK;
+}
+
+/************************************************************************/
+/*                            BuildIndex()                              */
+/************************************************************************/
+
+// Decompresses the whole stream and records an access point roughly every
+// nSpan uncompressed bytes. Only single member gzip files are indexed.
+std::shared_ptr<VSIGZipIndex> VSIGZipHandle::BuildIndex(vsi_l_offset nSpan)
+{
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return nullptr;
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    std::vector<GByte> abyIn(Z_BUFSIZE);
+    std::vector<GByte> abyWindow(GZIP_INDEX_WINDOW_SIZE);
+    std::vector<GByte> abyOrderedWindow(GZIP_INDEX_WINDOW_SIZE);
+    vsi_l_offset nTotIn = 0;
+    vsi_l_offset nTotOut = 0;
+    vsi_l_offset nLastPointOut = 0;
+    uLong nCRC = 0;
+    int ret = Z_OK;
+    bool bOK = m_poBaseHandle->Seek(startOff, SEEK_SET) == 0;
+    while (bOK)
+    {
+        if (sStream.avail_in == 0)
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min(static_cast<vsi_l_offset>(Z_BUFSIZE),
+                         offsetEndCompressedData - m_poBaseHandle->Tell()));
+            sStream.avail_in = static_cast<uInt>(
+                m_poBaseHandle->Read(abyIn.data(), 1, nToRead));
+            sStream.next_in = abyIn.data();
+            if (sStream.avail_in == 0)
+            {
+                bOK = false;
+                break;
+            }
+        }
+        if (sStream.avail_out == 0)
+        {
+            sStream.next_out = abyWindow.data();
+            sStream.avail_out = GZIP_INDEX_WINDOW_SIZE;
+        }
+
+        const uInt nAvailInBefore = sStream.avail_in;
+        const uInt nAvailOutBefore = sStream.avail_out;
+        const Bytef *pabyOut = sStream.next_out;
+        // Z_BLOCK makes inflate() return at the end of each deflate block
+        ret = inflate(&sStream, Z_BLOCK);
+        nTotIn += nAvailInBefore - sStream.avail_in;
+        nTotOut += nAvailOutBefore - sStream.avail_out;
+        nCRC = crc32(nCRC, pabyOut, nAvailOutBefore - sStream.avail_out);
+        if (ret == Z_STREAM_END)
+            break;
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            bOK = false;
+            break;
+        }
+
+        // At the end of a block header, which is not the end of the last
+        // block?
+        if ((sStream.data_type & 128) != 0 && (sStream.data_type & 64) == 0 &&
+            nTotOut - nLastPointOut >= nSpan)
+        {
+            VSIGZipAccessPoint oPoint;
+            oPoint.in = startOff + nTotIn;
+            oPoint.out = nTotOut;
+            oPoint.bits = sStream.data_type & 7;
+            oPoint.prevByte = sStream.next_in[-1];
+
+            // abyWindow is used as a circular buffer
+            const size_t nPos = GZIP_INDEX_WINDOW_SIZE - sStream.avail_out;
+            memcpy(abyOrderedWindow.data(), abyWindow.data() + nPos,
+                   GZIP_INDEX_WINDOW_SIZE - nPos);
+            memcpy(abyOrderedWindow.data() + GZIP_INDEX_WINDOW_SIZE - nPos,
+                   abyWindow.data(), nPos);
+            size_t nCompressedSize = 0;
+            void *pCompressed =
+                CPLZLibDeflate(abyOrderedWindow.data(), GZIP_INDEX_WINDOW_SIZE,
+                               -1, nullptr, 0, &nCompressedSize);
+            if (pCompressed == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+            oPoint.osCompressedWindow.assign(
+                static_cast<const char *>(pCompressed), nCompressedSize);
+            VSIFree(pCompressed);
+            poIndex->aoPoints.push_back(std::move(oPoint));
+            nLastPointOut = nTotOut;
+        }
+    }
+    inflateEnd(&sStream);
+
+    if (bOK)
+    {
+        // Check that the stream is followed by the trailer (CRC32 and
+        // uncompressed size), and nothing else.
+        GByte abyTrailer[8];
+        if (offsetEndCompressedData != startOff + nTotIn + sizeof(abyTrailer))
+        {
+            CPLDebug("GZIP", "%s has several members. Not indexed",
+                     m_pszBaseFileName);
+            bOK = false;
+        }
+        else if (m_poBaseHandle->Seek(startOff + nTotIn, SEEK_SET) != 0 ||
+                 m_poBaseHandle->Read(abyTrailer, 1, sizeof(abyTrailer)) !=
+                     sizeof(abyTrailer) ||
+                 CPL_LSBUINT32PTR(abyTrailer) != static_cast<uint32_t>(nCRC))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "CRC error in %s",
+                     m_pszBaseFileName);
+            bOK = false;
+        }
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Decompression of %s failed while building its index",
+                 m_pszBaseFileName);
+    }
+
+    gzrewind();
+    if (!bOK)
+        return nullptr;
+    poIndex->nUncompressedSize = nTotOut;
+    return poIndex;
+}
+
+/************************************************************************/
+/*                          LoadOrBuildIndex()                          */
+/************************************************************************/
+
+// Attaches to the handle the index of access points of the file, read from
+// its .gzidx file, or built (and saved) if there is no valid one.
+void VSIGZipHandle::LoadOrBuildIndex()
+{
+    if (m_transparent || m_pszBaseFileName == nullptr ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+        return;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(m_pszBaseFileName, &sStat) != 0)
+        return;
+    const uint64_t nFileSize = static_cast<uint64_t>(sStat.st_size);
+    const uint64_t nMTime = static_cast<uint64_t>(sStat.st_mtime);
+
+    const std::string osIndexFilename =
+        VSIGZipGetIndexFilename(m_pszBaseFileName);
+    std::shared_ptr<VSIGZipIndex> poIndex =
+        VSIGZipReadIndex(osIndexFilename, nFileSize, nMTime);
+    if (!poIndex)
+    {
+        const char *pszSpan =
+            CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPAN", "4M");
+        vsi_l_offset nSpan = static_cast<vsi_l_offset>(
+            std::max(0.0, CPLAtof(pszSpan)));
+        if (strchr(pszSpan, 'K'))
+            nSpan *= 1024;
+        else if (strchr(pszSpan, 'M'))
+            nSpan *= 1024 * 1024;
+        nSpan = std::max(nSpan, static_cast<vsi_l_offset>(64 * 1024));
+
+        CPLDebug("GZIP", "Building index of %s", m_pszBaseFileName);
+        poIndex = BuildIndex(nSpan);
+        if (!poIndex)
+            return;
+        if (!VSIGZipWriteIndex(osIndexFilename, *poIndex, nFileSize, nMTime))
+        {
+            CPLDebug("GZIP", "Cannot write %s", osIndexFilename.c_str());
+        }
+    }
+    if (m_uncompressed_size == 0)
+        m_uncompressed_size = poIndex->nUncompressedSize;
+    m_poIndex = std::move(poIndex);
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads)
+    {
+        m_nThreads = CPLParseNumThreads(pszThreads, 128);
+    }
+}
+
+/************************************************************************/
+/*                         SeekToAccessPoint()                          */
+/************************************************************************/
+
+bool VSIGZipHandle::SeekToAccessPoint(const VSIGZipAccessPoint &oPoint)
+{
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP", "Resuming at access point in=" CPL_FRMT_GUIB
+                     " out=" CPL_FRMT_GUIB,
+             oPoint.in, oPoint.out);
+#endif
+    if (!VSIGZipInitStreamAtAccessPoint(&stream, oPoint) ||
+        m_poBaseHandle->Seek(oPoint.in, SEEK_SET) != 0)
+    {
+        z_err = Z_DATA_ERROR;
+        return false;
+    }
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    z_err = Z_OK;
+    z_eof = 0;
+    m_bEOF = false;
+    // The CRC of the uncompressed data before the access point is not
+    // known, so it cannot be checked at the end of the stream.
+    crc = 0;
+    m_bCRCUnknown = true;
+    in = oPoint.in - startOff;
+    out = oPoint.out;
+    return true;
+}
+
+/************************************************************************/
+/*                            ParallelRead()                            */
+/************************************************************************/
+
+// Reads nSize bytes at the current position, by decompressing in worker
+// threads the ranges between the access points it contains. Returns the
+// number of bytes read, or static_cast<size_t>(-1) if the request is too
+// small for that.
+size_t VSIGZipHandle::ParallelRead(void *pBuffer, size_t nSize)
+{
+    const vsi_l_offset nStart = out;
+    const vsi_l_offset nEnd = out + nSize;
+    const auto &aoPoints = m_poIndex->aoPoints;
+    // Access points in ]nStart, nEnd[
+    const auto oIterFirst = std::upper_bound(
+        aoPoints.begin(), aoPoints.end(), nStart,
+        [](vsi_l_offset nVal, const VSIGZipAccessPoint &oPoint)
+        { return nVal < oPoint.out; });
+    const auto oIterLast = std::lower_bound(
+        oIterFirst, aoPoints.end(), nEnd,
+        [](const VSIGZipAccessPoint &oPoint, vsi_l_offset nVal)
+        { return oPoint.out < nVal; });
+    // At least one full range between 2 access points
+    if (std::distance(oIterFirst, oIterLast) < 2)
+        return static_cast<size_t>(-1);
+    const VSIGZipAccessPoint &oFirst = *oIterFirst;
+    const VSIGZipAccessPoint &oLast = *std::prev(oIterLast);
+
+    if (!m_poPool)
+    {
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!m_poPool->Setup(m_nThreads, nullptr, nullptr, false))
+        {
+            m_poPool.reset();
+            m_nThreads = 1;
+            return static_cast<size_t>(-1);
+        }
+    }
+
+    // Ingest the compressed data of the ranges processed by worker threads
+    // (plus a few bytes since the last access point may start in the middle
+    // of a byte).
+    const vsi_l_offset nCompressedEnd =
+        std::min(oLast.in + 8, offsetEndCompressedData);
+    std::string osCompressed;
+    try
+    {
+        osCompressed.resize(static_cast<size_t>(nCompressedEnd - oFirst.in));
+    }
+    catch (const std::exception &)
+    {
+        return static_cast<size_t>(-1);
+    }
+    const vsi_l_offset nBasePos = m_poBaseHandle->Tell();
+    const bool bReadOK =
+        m_poBaseHandle->Seek(oFirst.in, SEEK_SET) == 0 &&
+        m_poBaseHandle->Read(osCompressed.data(), 1, osCompressed.size()) ==
+            osCompressed.size();
+    if (m_poBaseHandle->Seek(nBasePos, SEEK_SET) != 0 || !bReadOK)
+        return static_cast<size_t>(-1);
+
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    std::atomic<bool> bOK = true;
+    auto poQueue = m_poPool->CreateJobQueue();
+    for (auto oIter = oIterFirst; oIter + 1 != oIterLast; ++oIter)
+    {
+        const VSIGZipAccessPoint &oPoint = *oIter;
+        const VSIGZipAccessPoint &oNextPoint = *(oIter + 1);
+        poQueue->SubmitJob(
+            [&oPoint, &oNextPoint, &oFirst, &osCompressed, pabyBuffer, nStart,
+             &bOK]()
+            {
+                z_stream sStream;
+                memset(&sStream, 0, sizeof(sStream));
+                if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+                {
+                    bOK = false;
+                    return;
+                }
+                if (VSIGZipInitStreamAtAccessPoint(&sStream, oPoint))
+                {
+                    const size_t nInOffset =
+                        static_cast<size_t>(oPoint.in - oFirst.in);
+                    sStream.next_in = reinterpret_cast<Bytef *>(
+                        const_cast<char *>(osCompressed.data() + nInOffset));
+                    sStream.avail_in =
+                        static_cast<uInt>(osCompressed.size() - nInOffset);
+                    sStream.next_out = pabyBuffer + (oPoint.out - nStart);
+                    sStream.avail_out =
+                        static_cast<uInt>(oNextPoint.out - oPoint.out);
+                    int ret = Z_OK;
+                    while (sStream.avail_out > 0 && ret == Z_OK)
+                        ret = inflate(&sStream, Z_NO_FLUSH);
+                    if (sStream.avail_out > 0)
+                        bOK = false;
+                }
+                else
+                {
+                    bOK = false;
+                }
+                inflateEnd(&sStream);
+            });
+    }
+
+    // Meanwhile, decompress the head of the request from the current
+    // position, and its tail from the last access point.
+    const size_t nHeadSize = static_cast<size_t>(oFirst.out - nStart);
+    size_t nRead = Read(pabyBuffer, 1, nHeadSize);
+    if (nRead == nHeadSize && SeekToAccessPoint(oLast))
+    {
+        const size_t nTailOffset = static_cast<size_t>(oLast.out - nStart);
+        nRead = nTailOffset +
+                Read(pabyBuffer + nTailOffset, 1, nSize - nTailOffset);
+    }
+    poQueue->WaitCompletion();
+
+    if (!bOK && nRead > nHeadSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompression failed in worker thread");
+        z_err = Z_DATA_ERROR;
+        nRead = nHeadSize;
+    }
+    return nRead;
+}
+
 #ifdef ENABLE_DEFLATE64
 
 /************************************************************************/
@@ -2761,11 +3373,8 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
     {
         if (nThreads == 0)
         {
-            if (!pszThreads || EQUAL(pszThreads, "ALL_CPUS"))
-                nThreads = CPLGetNumCPUs();
-            else
-                nThreads = atoi(pszThreads);
-            nThreads = std::max(1, std::min(128, nThreads));
+            nThreads =
+                CPLParseNumThreads(pszThreads ? pszThreads : "ALL_CPUS", 128);
         }
         if (nThreads > 1 || nChunkSize > 0)
         {
@@ -3155,6 +3764,7 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
         delete poHandle;
         return nullptr;
     }
+    poHandle->LoadOrBuildIndex();
     return poHandle;
 }
 
@@ -3318,11 +3928,21 @@ const char *VSIGZipFilesystemHandler::GetOptions()
 {
     return "<Options>"
            "  <Option name='GDAL_NUM_THREADS' type='string' "
-           "description='Number of threads for compression. Either a integer "
-           "or ALL_CPUS'/>"
+           "description='Number of threads for compression, and for "
+           "decompression when an index is used. Either a integer or "
+           "ALL_CPUS'/>"
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX' type='boolean' "
+           "description='Whether to use (and build if needed) an index of "
+           "access points of the file' default='NO'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX_DIR' type='string' "
+           "description='Directory where to store indices. Defaults to "
+           "the directory of the file'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX_SPAN' type='string' "
+           "description='Uncompressed distance between access points. "
+           "Use K(ilobytes) or M(egabytes) suffix' default='4M'/>"
            "</Options>";
 }
 
@@ -3744,6 +4364,159 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                      VSISOZipChunkDecompressor                       */
+/* ==================================================================== */
+/************************************************************************/
+
+// Decompresses independent chunks of the deflate stream of a SOZip file.
+class VSISOZipChunkDecompressor
+{
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_decompressor *pDecompressor_ = nullptr;
+#else
+    z_stream sStream_{};
+#endif
+    bool bOK_ = true;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSISOZipChunkDecompressor)
+
+  public:
+    VSISOZipChunkDecompressor();
+    ~VSISOZipChunkDecompressor();
+
+    bool IsOK() const
+    {
+        return bOK_;
+    }
+
+    bool Decompress(GByte *pabyCompressedData, size_t nCompressedSize,
+                    GByte *pabyOut, size_t nOutSize, vsi_l_offset nPos,
+                    bool bEmitError);
+};
+
+/************************************************************************/
+/*                     VSISOZipChunkDecompressor()                      */
+/************************************************************************/
+
+VSISOZipChunkDecompressor::VSISOZipChunkDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    pDecompressor_ = libdeflate_alloc_decompressor();
+    if (!pDecompressor_)
+        bOK_ = false;
+#else
+    memset(&sStream_, 0, sizeof(sStream_));
+    int err = inflateInit2(&sStream_, -MAX_WBITS);
+    if (err != Z_OK)
+        bOK_ = false;
+#endif
+}
+
+/************************************************************************/
+/*                    ~VSISOZipChunkDecompressor()                      */
+/************************************************************************/
+
+VSISOZipChunkDecompressor::~VSISOZipChunkDecompressor()
+{
+    if (bOK_)
+    {
+#ifdef HAVE_LIBDEFLATE
+        libdeflate_free_decompressor(pDecompressor_);
+#else
+        inflateEnd(&sStream_);
+#endif
+    }
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+// Decompresses the chunk in pabyCompressedData (which is modified) into
+// exactly nOutSize bytes. nPos is the uncompressed offset of the chunk, for
+// error messages, that are only emitted if bEmitError is set.
+bool VSISOZipChunkDecompressor::Decompress(GByte *pabyCompressedData,
+                                           size_t nCompressedSize,
+                                           GByte *pabyOut, size_t nOutSize,
+                                           vsi_l_offset nPos, bool bEmitError)
+{
+    if (nCompressedSize >= 5 &&
+        pabyCompressedData[nCompressedSize - 5] == 0x00 &&
+        memcmp(&pabyCompressedData[nCompressedSize - 4], "\x00\x00\xFF\xFF",
+               4) == 0)
+    {
+        // Tag this flush block as the last one.
+        pabyCompressedData[nCompressedSize - 5] = 0x01;
+    }
+
+#ifdef HAVE_LIBDEFLATE
+    size_t nOut = 0;
+    if (libdeflate_deflate_decompress(pDecompressor_, pabyCompressedData,
+                                      nCompressedSize, pabyOut, nOutSize,
+                                      &nOut) != LIBDEFLATE_SUCCESS)
+    {
+        if (bEmitError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "libdeflate_deflate_decompress() failed at "
+                     "pos " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(nPos));
+        }
+        return false;
+    }
+    if (nOut != nOutSize)
+    {
+        if (bEmitError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                     " whereas %u where expected",
+                     static_cast<unsigned>(nOut), static_cast<GUIntBig>(nPos),
+                     static_cast<unsigned>(nOutSize));
+        }
+        return false;
+    }
+#else
+    sStream_.avail_in = static_cast<uInt>(nCompressedSize);
+    sStream_.next_in = pabyCompressedData;
+    sStream_.avail_out = static_cast<uInt>(nOutSize);
+    sStream_.next_out = pabyOut;
+
+    int err = inflate(&sStream_, Z_FINISH);
+    if ((err != Z_OK && err != Z_STREAM_END))
+    {
+        if (bEmitError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "inflate() failed at pos " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(nPos));
+        }
+        inflateReset(&sStream_);
+        return false;
+    }
+    if (sStream_.avail_in != 0 && bEmitError)
+        CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
+    if (sStream_.avail_out != 0)
+    {
+        if (bEmitError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                     " whereas %u where expected",
+                     static_cast<unsigned>(nOutSize - sStream_.avail_out),
+                     static_cast<GUIntBig>(nPos),
+                     static_cast<unsigned>(nOutSize));
+        }
+        inflateReset(&sStream_);
+        return false;
+    }
+    inflateReset(&sStream_);
+#endif
+    return true;
+}
+
 /************************************************************************/
 /*                         VSISOZipHandle                               */
 /************************************************************************/
@@ -3760,16 +4533,36 @@ class VSISOZipHandle final : public VSIVirtualHandle
     bool bEOF_ = false;
     bool bError_ = false;
     vsi_l_offset nCurPos_ = 0;
-    bool bOK_ = true;
-#ifdef HAVE_LIBDEFLATE
-    struct libdeflate_decompressor *pDecompressor_ = nullptr;
-#else
-    z_stream sStream_{};
-#endif
+    VSISOZipChunkDecompressor oDecompressor_{};
+
+    // Chunk decompressed in advance by a worker thread
+    struct PrefetchedChunk
+    {
+        std::vector<GByte> abyCompressedData{};
+        std::vector<GByte> abyData{};
+        std::atomic<bool> bDone{false};
+        bool bOK = false;
+    };
+
+    int nThreads_ = 1;
+    uint64_t nLastChunkIdx_ = std::numeric_limits<uint64_t>::max();
+    std::unique_ptr<CPLWorkerThreadPool> poPool_{};
+    std::unique_ptr<CPLJobQueue> poJobQueue_{};
+    std::map<uint64_t, std::shared_ptr<PrefetchedChunk>> oMapPrefetched_{};
 
     VSISOZipHandle(const VSISOZipHandle &) = delete;
     VSISOZipHandle &operator=(const VSISOZipHandle &) = delete;
 
+    uint64_t GetChunkCount() const
+    {
+        return 1 + (uncompressed_size_ - 1) / nChunkSize_;
+    }
+
+    uint64_t ReadOffsetInCompressedStream(uint64_t nChunkIdx);
+    void PrefetchChunks(uint64_t nFirstChunkIdx);
+    bool GetPrefetchedChunk(uint64_t nChunkIdx, GByte *pabyOut,
+                            size_t nOutSize);
+
   public:
     VSISOZipHandle(VSIVirtualHandle *poVirtualHandle,
                    vsi_l_offset nPosCompressedStream, uint64_t compressed_size,
@@ -3811,7 +4604,7 @@ class VSISOZipHandle final : public VSIVirtualHandle
 
     bool IsOK() const
     {
-        return bOK_;
+        return oDecompressor_.IsOK();
     }
 };
 
@@ -3830,16 +4623,11 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandle *poVirtualHandle,
       compressed_size_(compressed_size), uncompressed_size_(uncompressed_size),
       indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize)
 {
-#ifdef HAVE_LIBDEFLATE
-    pDecompressor_ = libdeflate_alloc_decompressor();
-    if (!pDecompressor_)
-        bOK_ = false;
-#else
-    memset(&sStream_, 0, sizeof(sStream_));
-    int err = inflateInit2(&sStream_, -MAX_WBITS);
-    if (err != Z_OK)
-        bOK_ = false;
-#endif
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads)
+    {
+        nThreads_ = CPLParseNumThreads(pszThreads, 128);
+    }
 }
 
 /************************************************************************/
@@ -3849,14 +4637,6 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandle *poVirtualHandle,
 VSISOZipHandle::~VSISOZipHandle()
 {
     VSISOZipHandle::Close();
-    if (bOK_)
-    {
-#ifdef HAVE_LIBDEFLATE
-        libdeflate_free_decompressor(pDecompressor_);
-#else
-        inflateEnd(&sStream_);
-#endif
-    }
 }
 
 /************************************************************************/
@@ -3865,6 +4645,9 @@ VSISOZipHandle::~VSISOZipHandle()
 
 int VSISOZipHandle::Close()
 {
+    // Wait for pending jobs
+    poJobQueue_.reset();
+    oMapPrefetched_.clear();
     delete poBaseHandle_;
     poBaseHandle_ = nullptr;
     return 0;
@@ -3886,6 +4669,153 @@ int VSISOZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
     return 0;
 }
 
+/************************************************************************/
+/*                   ReadOffsetInCompressedStream()                     */
+/************************************************************************/
+
+uint64_t VSISOZipHandle::ReadOffsetInCompressedStream(uint64_t nChunkIdx)
+{
+    if (nChunkIdx == 0)
+        return 0;
+    if (nChunkIdx == GetChunkCount())
+        return compressed_size_;
+    constexpr size_t nOffsetSize = 8;
+    if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
+                                (nChunkIdx - 1) * nOffsetSize,
+                            SEEK_SET) != 0)
+        return static_cast<uint64_t>(-1);
+
+    uint64_t nOffset;
+    if (poBaseHandle_->Read(&nOffset, sizeof(nOffset), 1) != 1)
+        return static_cast<uint64_t>(-1);
+    CPL_LSBPTR64(&nOffset);
+    return nOffset;
+}
+
+/************************************************************************/
+/*                          PrefetchChunks()                            */
+/************************************************************************/
+
+// Submits to worker threads the decompression of the chunks following
+// nFirstChunkIdx that are not already prefetched, up to a few per thread.
+void VSISOZipHandle::PrefetchChunks(uint64_t nFirstChunkIdx)
+{
+    if (!poPool_)
+    {
+        poPool_ = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool_->Setup(nThreads_, nullptr, nullptr, false))
+        {
+            poPool_.reset();
+            nThreads_ = 1;
+            return;
+        }
+        poJobQueue_ = poPool_->CreateJobQueue();
+    }
+
+    uint64_t nStartIdx = nFirstChunkIdx;
+    if (!oMapPrefetched_.empty())
+        nStartIdx = std::max(nStartIdx, oMapPrefetched_.rbegin()->first + 1);
+    const uint64_t nEndIdx =
+        std::min(GetChunkCount(),
+                 nFirstChunkIdx + 4 * static_cast<uint64_t>(nThreads_));
+    // Do not bother submitting too small batches
+    if (nStartIdx >= nEndIdx ||
+        (nEndIdx - nStartIdx < static_cast<uint64_t>(nThreads_) &&
+         nEndIdx != GetChunkCount()))
+        return;
+
+    // The compressed data of consecutive chunks is contiguous, so ingest it
+    // at once.
+    std::vector<uint64_t> anOffsets;
+    for (uint64_t nIdx = nStartIdx; nIdx <= nEndIdx; ++nIdx)
+    {
+        const uint64_t nOffset = ReadOffsetInCompressedStream(nIdx);
+        if (nOffset == static_cast<uint64_t>(-1) ||
+            nOffset > compressed_size_ ||
+            (!anOffsets.empty() &&
+             (nOffset <= anOffsets.back() ||
+              nOffset - anOffsets.back() > 13 + 2 * nChunkSize_)))
+        {
+            // Let the regular code path report the error
+            return;
+        }
+        anOffsets.push_back(nOffset);
+    }
+    std::vector<GByte> abyCompressedData(
+        static_cast<size_t>(anOffsets.back() - anOffsets.front()));
+    if (poBaseHandle_->Seek(nPosCompressedStream_ + anOffsets.front(),
+                            SEEK_SET) != 0 ||
+        poBaseHandle_->Read(abyCompressedData.data(), 1,
+                            abyCompressedData.size()) !=
+            abyCompressedData.size())
+    {
+        return;
+    }
+
+    for (uint64_t nIdx = nStartIdx; nIdx < nEndIdx; ++nIdx)
+    {
+        auto poChunk = std::make_shared<PrefetchedChunk>();
+        const size_t i = static_cast<size_t>(nIdx - nStartIdx);
+        poChunk->abyCompressedData.assign(
+            abyCompressedData.begin() +
+                static_cast<size_t>(anOffsets[i] - anOffsets[0]),
+            abyCompressedData.begin() +
+                static_cast<size_t>(anOffsets[i + 1] - anOffsets[0]));
+        const size_t nChunkSize = static_cast<size_t>(
+            std::min(static_cast<uint64_t>(nChunkSize_),
+                     uncompressed_size_ - nIdx * nChunkSize_));
+        oMapPrefetched_[nIdx] = poChunk;
+        poJobQueue_->SubmitJob(
+            [poChunk, nChunkSize]()
+            {
+                try
+                {
+                    VSISOZipChunkDecompressor oDecompressor;
+                    poChunk->abyData.resize(nChunkSize);
+                    poChunk->bOK =
+                        oDecompressor.IsOK() &&
+                        oDecompressor.Decompress(
+                            poChunk->abyCompressedData.data(),
+                            poChunk->abyCompressedData.size(),
+                            poChunk->abyData.data(), nChunkSize, 0, false);
+                }
+                catch (const std::exception &)
+                {
+                }
+                poChunk->bDone = true;
+            });
+    }
+}
+
+/************************************************************************/
+/*                        GetPrefetchedChunk()                          */
+/************************************************************************/
+
+// Copies into pabyOut the chunk nChunkIdx if it has been successfully
+// prefetched, and forgets about the chunks up to it.
+bool VSISOZipHandle::GetPrefetchedChunk(uint64_t nChunkIdx, GByte *pabyOut,
+                                        size_t nOutSize)
+{
+    auto oIter = oMapPrefetched_.find(nChunkIdx);
+    if (oIter == oMapPrefetched_.end())
+    {
+        // Not reading sequentially anymore
+        oMapPrefetched_.clear();
+        return false;
+    }
+    const auto poChunk = oIter->second;
+    oMapPrefetched_.erase(oMapPrefetched_.begin(), std::next(oIter));
+
+    while (!poChunk->bDone && poJobQueue_->WaitEvent())
+    {
+        // Wait for the job decompressing the chunk
+    }
+    if (!poChunk->bOK || poChunk->abyData.size() != nOutSize)
+        return false;
+    memcpy(pabyOut, poChunk->abyData.data(), nOutSize);
+    return true;
+}
+
 /************************************************************************/
 /*                              Read()                                  */
 /************************************************************************/
@@ -3925,157 +4855,93 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         return 0;
     }
 
-    const auto ReadOffsetInCompressedStream =
-        [this](uint64_t nChunkIdx) -> uint64_t
-    {
-        if (nChunkIdx == 0)
-            return 0;
-        if (nChunkIdx == 1 + (uncompressed_size_ - 1) / nChunkSize_)
-            return compressed_size_;
-        constexpr size_t nOffsetSize = 8;
-        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
-                                    (nChunkIdx - 1) * nOffsetSize,
-                                SEEK_SET) != 0)
-            return static_cast<uint64_t>(-1);
-
-        uint64_t nOffset;
-        if (poBaseHandle_->Read(&nOffset, sizeof(nOffset), 1) != 1)
-            return static_cast<uint64_t>(-1);
-        CPL_LSBPTR64(&nOffset);
-        return nOffset;
-    };
-
     size_t nOffsetInOutputBuffer = 0;
     while (true)
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
-        if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nOffsetInCompressedStream");
-            return 0;
-        }
-        uint64_t nNextOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
-        if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nNextOffsetInCompressedStream");
-            return 0;
-        }
+        const size_t nToReadThisIter =
+            std::min(nToRead, static_cast<size_t>(nChunkSize_));
+        GByte *pabyOut = static_cast<GByte *>(pBuffer) + nOffsetInOutputBuffer;
+        const uint64_t nChunkIdx = nCurPos_ / nChunkSize_;
 
-        if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream >
-                13 + 2 * nChunkSize_ ||
-            nNextOffsetInCompressedStream > compressed_size_)
+        // When reading sequentially, the next chunks are decompressed in
+        // advance by worker threads.
+        bool bDone = false;
+        if (nThreads_ > 1)
         {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
-                ") / "
-                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
-                static_cast<GUIntBig>(nOffsetInCompressedStream),
-                static_cast<GUIntBig>(nNextOffsetInCompressedStream));
-            return 0;
+            const bool bSequential = nChunkIdx == nLastChunkIdx_ + 1;
+            nLastChunkIdx_ = nChunkIdx;
+            bDone = GetPrefetchedChunk(nChunkIdx, pabyOut, nToReadThisIter);
+            if (bDone || bSequential)
+                PrefetchChunks(nChunkIdx + 1);
         }
 
-        // CPLDebug("VSIZIP", "Seek to compressed data at offset "
-        // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
-        // nOffsetInCompressedStream));
-        if (poBaseHandle_->Seek(
-                nPosCompressedStream_ + nOffsetInCompressedStream, SEEK_SET) !=
-            0)
+        if (!bDone)
         {
-            bError_ = true;
-            return 0;
-        }
+            uint64_t nOffsetInCompressedStream =
+                ReadOffsetInCompressedStream(nChunkIdx);
+            if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
+            {
+                bError_ = true;
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot read nOffsetInCompressedStream");
+                return 0;
+            }
+            uint64_t nNextOffsetInCompressedStream =
+                ReadOffsetInCompressedStream(1 + nChunkIdx);
+            if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
+            {
+                bError_ = true;
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot read nNextOffsetInCompressedStream");
+                return 0;
+            }
 
-        const int nCompressedToRead = static_cast<int>(
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream);
-        // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
-        if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead, 1) !=
-            1)
-        {
-            bError_ = true;
-            return 0;
-        }
+            if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
+                nNextOffsetInCompressedStream - nOffsetInCompressedStream >
+                    13 + 2 * nChunkSize_ ||
+                nNextOffsetInCompressedStream > compressed_size_)
+            {
+                bError_ = true;
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid values for nOffsetInCompressedStream "
+                         "(" CPL_FRMT_GUIB ") / "
+                         "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
+                         static_cast<GUIntBig>(nOffsetInCompressedStream),
+                         static_cast<GUIntBig>(nNextOffsetInCompressedStream));
+                return 0;
+            }
 
-        size_t nToReadThisIter =
-            std::min(nToRead, static_cast<size_t>(nChunkSize_));
+            // CPLDebug("VSIZIP", "Seek to compressed data at offset "
+            // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
+            // nOffsetInCompressedStream));
+            if (poBaseHandle_->Seek(
+                    nPosCompressedStream_ + nOffsetInCompressedStream,
+                    SEEK_SET) != 0)
+            {
+                bError_ = true;
+                return 0;
+            }
 
-        if (nCompressedToRead >= 5 &&
-            abyCompressedData[nCompressedToRead - 5] == 0x00 &&
-            memcmp(&abyCompressedData[nCompressedToRead - 4],
-                   "\x00\x00\xFF\xFF", 4) == 0)
-        {
-            // Tag this flush block as the last one.
-            abyCompressedData[nCompressedToRead - 5] = 0x01;
-        }
+            const int nCompressedToRead = static_cast<int>(
+                nNextOffsetInCompressedStream - nOffsetInCompressedStream);
+            // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
+            std::vector<GByte> abyCompressedData(nCompressedToRead);
+            if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead,
+                                    1) != 1)
+            {
+                bError_ = true;
+                return 0;
+            }
 
-#ifdef HAVE_LIBDEFLATE
-        size_t nOut = 0;
-        if (libdeflate_deflate_decompress(
-                pDecompressor_, &abyCompressedData[0], nCompressedToRead,
-                static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer,
-                nToReadThisIter, &nOut) != LIBDEFLATE_SUCCESS)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
-                static_cast<GUIntBig>(nCurPos_));
-            return 0;
-        }
-        if (nOut != nToReadThisIter)
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                     " whereas %u where expected",
-                     static_cast<unsigned>(nOut),
-                     static_cast<GUIntBig>(nCurPos_),
-                     static_cast<unsigned>(nToReadThisIter));
-            return 0;
-        }
-#else
-        sStream_.avail_in = nCompressedToRead;
-        sStream_.next_in = &abyCompressedData[0];
-        sStream_.avail_out = static_cast<int>(nToReadThisIter);
-        sStream_.next_out =
-            static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer;
-
-        int err = inflate(&sStream_, Z_FINISH);
-        if ((err != Z_OK && err != Z_STREAM_END))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "inflate() failed at pos " CPL_FRMT_GUIB,
-                     static_cast<GUIntBig>(nCurPos_));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        if (sStream_.avail_in != 0)
-            CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
-        if (sStream_.avail_out != 0)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                " whereas %u where expected",
-                static_cast<unsigned>(nToReadThisIter - sStream_.avail_out),
-                static_cast<GUIntBig>(nCurPos_),
-                static_cast<unsigned>(nToReadThisIter));
-            inflateReset(&sStream_);
-            return 0;
+            if (!oDecompressor_.Decompress(&abyCompressedData[0],
+                                           nCompressedToRead, pabyOut,
+                                           nToReadThisIter, nCurPos_, true))
+            {
+                bError_ = true;
+                return 0;
+            }
         }
-        inflateReset(&sStream_);
-#endif
+
         nOffsetInOutputBuffer += nToReadThisIter;
         nCurPos_ += nToReadThisIter;
         nToRead -= nToReadThisIter;
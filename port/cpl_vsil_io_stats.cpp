@@ -0,0 +1,808 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Generic instrumentation of VSI file handles
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsi_io_stats.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+namespace
+{
+
+/************************************************************************/
+/*                          Operation types                             */
+/************************************************************************/
+
+enum class IOStatsOp
+{
+    READ,
+    SEEK,
+    READ_MULTI_RANGE,
+    PREAD,
+    WRITE,
+};
+
+constexpr int IO_STATS_OP_COUNT = 5;
+
+constexpr const char *apszOpNames[IO_STATS_OP_COUNT] = {
+    "Read", "Seek", "ReadMultiRange", "PRead", "Write"};
+
+// Upper bounds, in microseconds, of the histogram buckets. The last bucket
+// collects everything above the last bound.
+constexpr std::array<uint64_t, 11> anBucketUpperBoundsUS = {
+    10, 100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000};
+
+constexpr int IO_STATS_BUCKET_COUNT =
+    static_cast<int>(anBucketUpperBoundsUS.size()) + 1;
+
+/************************************************************************/
+/*                            OpCounters                                */
+/************************************************************************/
+
+struct OpCounters
+{
+    uint64_t nCount = 0;
+    uint64_t nBytes = 0;
+    uint64_t nTotalTimeUS = 0;
+    std::array<uint64_t, IO_STATS_BUCKET_COUNT> anHistogram{};
+
+    void Add(uint64_t nBytesIn, uint64_t nTimeUS)
+    {
+        ++nCount;
+        nBytes += nBytesIn;
+        nTotalTimeUS += nTimeUS;
+        const auto oIter =
+            std::lower_bound(anBucketUpperBoundsUS.begin(),
+                             anBucketUpperBoundsUS.end(), nTimeUS);
+        ++anHistogram[oIter - anBucketUpperBoundsUS.begin()];
+    }
+};
+
+/************************************************************************/
+/*                             Counters                                 */
+/************************************************************************/
+
+struct Counters
+{
+    std::array<OpCounters, IO_STATS_OP_COUNT> aoOps{};
+    uint64_t nCacheHits = 0;
+    uint64_t nCacheMisses = 0;
+    uint64_t nRetries = 0;
+
+    void AsJSON(CPLJSONObject &oJSON) const;
+};
+
+/************************************************************************/
+/*                        FileSystemCounters                            */
+/************************************************************************/
+
+struct FileSystemCounters
+{
+    Counters oTotal{};
+    std::map<std::string, Counters> oMapFiles{};
+};
+
+/************************************************************************/
+/*                           IOStatsState                               */
+/************************************************************************/
+
+struct IOStatsState
+{
+    std::mutex oMutex{};
+    std::map<std::string, FileSystemCounters> oMapFileSystems{};
+    size_t nFiles = 0;
+    size_t nMaxFiles = 1000;
+};
+
+IOStatsState &GetState()
+{
+    static IOStatsState oState;
+    return oState;
+}
+
+/************************************************************************/
+/*                         GetFileSystemName()                          */
+/************************************************************************/
+
+std::string GetFileSystemName(const char *pszFilename)
+{
+    if (STARTS_WITH(pszFilename, "/vsi"))
+    {
+        const char *pszSlash = strchr(pszFilename + 1, '/');
+        if (pszSlash)
+            return std::string(pszFilename + 1, pszSlash - (pszFilename + 1));
+    }
+    return "local";
+}
+
+/************************************************************************/
+/*                          OperationContext                            */
+/************************************************************************/
+
+// File whose operation is currently running in this thread, so that cache
+// hits/misses and retries reported by lower layers can be attributed to it.
+struct OperationContext
+{
+    const std::string *posFileSystem = nullptr;
+    const std::string *posFilename = nullptr;
+};
+
+thread_local OperationContext gsCurrentContext;
+
+/************************************************************************/
+/*                          GetCountersForFile()                        */
+/************************************************************************/
+
+// Must be called with the mutex held. Returns nullptr once the maximum
+// number of files has been reached, in which case only the per file system
+// totals are updated.
+Counters *GetCountersForFile(IOStatsState &oState, FileSystemCounters &oFS,
+                             const std::string &osFilename)
+{
+    auto oIter = oFS.oMapFiles.find(osFilename);
+    if (oIter != oFS.oMapFiles.end())
+        return &(oIter->second);
+    if (oState.nFiles >= oState.nMaxFiles)
+        return nullptr;
+    ++oState.nFiles;
+    return &(oFS.oMapFiles[osFilename]);
+}
+
+/************************************************************************/
+/*                           LogOperation()                             */
+/************************************************************************/
+
+void LogOperation(const std::string &osFileSystem,
+                  const std::string &osFilename, IOStatsOp eOp,
+                  uint64_t nBytes, uint64_t nTimeUS)
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    auto &oFS = oState.oMapFileSystems[osFileSystem];
+    const int iOp = static_cast<int>(eOp);
+    oFS.oTotal.aoOps[iOp].Add(nBytes, nTimeUS);
+    if (auto poCounters = GetCountersForFile(oState, oFS, osFilename))
+        poCounters->aoOps[iOp].Add(nBytes, nTimeUS);
+}
+
+/************************************************************************/
+/*                            LogCounter()                              */
+/************************************************************************/
+
+void LogCounter(uint64_t Counters::*pnMember)
+{
+    const auto &sContext = gsCurrentContext;
+    if (!sContext.posFileSystem)
+        return;
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    auto &oFS = oState.oMapFileSystems[*(sContext.posFileSystem)];
+    ++(oFS.oTotal.*pnMember);
+    if (auto poCounters =
+            GetCountersForFile(oState, oFS, *(sContext.posFilename)))
+        ++(poCounters->*pnMember);
+}
+
+/************************************************************************/
+/*                         Counters::AsJSON()                           */
+/************************************************************************/
+
+void Counters::AsJSON(CPLJSONObject &oJSON) const
+{
+    CPLJSONObject oOperations;
+    for (int iOp = 0; iOp < IO_STATS_OP_COUNT; ++iOp)
+    {
+        const auto &oOp = aoOps[iOp];
+        if (oOp.nCount == 0)
+            continue;
+        CPLJSONObject oOpJSON;
+        oOpJSON.Add("count", oOp.nCount);
+        if (iOp != static_cast<int>(IOStatsOp::SEEK))
+            oOpJSON.Add("bytes", oOp.nBytes);
+        oOpJSON.Add("total_time_us", oOp.nTotalTimeUS);
+        CPLJSONObject oHistogram;
+        for (int i = 0; i < IO_STATS_BUCKET_COUNT; ++i)
+        {
+            if (oOp.anHistogram[i] == 0)
+                continue;
+            oHistogram.Add(i + 1 < IO_STATS_BUCKET_COUNT
+                               ? std::to_string(anBucketUpperBoundsUS[i])
+                               : std::string("+Inf"),
+                           oOp.anHistogram[i]);
+        }
+        oOpJSON.Add("latency_histogram_us", oHistogram);
+        oOperations.Add(apszOpNames[iOp], oOpJSON);
+    }
+    oJSON.Add("operations", oOperations);
+    if (nCacheHits || nCacheMisses)
+    {
+        CPLJSONObject oCache;
+        oCache.Add("hits", nCacheHits);
+        oCache.Add("misses", nCacheMisses);
+        oCache.Add("hit_ratio", static_cast<double>(nCacheHits) /
+                                    static_cast<double>(nCacheHits +
+                                                        nCacheMisses));
+        oJSON.Add("cache", oCache);
+    }
+    if (nRetries)
+        oJSON.Add("retries", nRetries);
+}
+
+/************************************************************************/
+/*                       EscapePrometheusLabel()                        */
+/************************************************************************/
+
+std::string EscapePrometheusLabel(const std::string &osValue)
+{
+    std::string osRet;
+    osRet.reserve(osValue.size());
+    for (const char ch : osValue)
+    {
+        if (ch == '\\')
+            osRet += "\\\\";
+        else if (ch == '"')
+            osRet += "\\\"";
+        else if (ch == '\n')
+            osRet += "\\n";
+        else
+            osRet += ch;
+    }
+    return osRet;
+}
+
+/************************************************************************/
+/*                          PrometheusWriter                            */
+/************************************************************************/
+
+struct PrometheusWriter
+{
+    std::string osHistograms{};
+    std::string osBytes{};
+    std::string osCacheHits{};
+    std::string osCacheMisses{};
+    std::string osRetries{};
+
+    void Add(const std::string &osLabels, const Counters &oCounters);
+    std::string Get() const;
+};
+
+void PrometheusWriter::Add(const std::string &osLabels,
+                           const Counters &oCounters)
+{
+    for (int iOp = 0; iOp < IO_STATS_OP_COUNT; ++iOp)
+    {
+        const auto &oOp = oCounters.aoOps[iOp];
+        if (oOp.nCount == 0)
+            continue;
+        const std::string osOpLabels =
+            osLabels + ",operation=\"" + apszOpNames[iOp] + '"';
+        uint64_t nCumulated = 0;
+        for (int i = 0; i < IO_STATS_BUCKET_COUNT; ++i)
+        {
+            nCumulated += oOp.anHistogram[i];
+            const std::string osUpperBound =
+                i + 1 < IO_STATS_BUCKET_COUNT
+                    ? CPLSPrintf("%g", static_cast<double>(
+                                           anBucketUpperBoundsUS[i]) /
+                                           1e6)
+                    : "+Inf";
+            osHistograms += CPLSPrintf(
+                "gdal_vsi_operation_duration_seconds_bucket{%s,le=\"%s\"} "
+                "%" PRIu64 "\n",
+                osOpLabels.c_str(), osUpperBound.c_str(), nCumulated);
+        }
+        osHistograms +=
+            CPLSPrintf("gdal_vsi_operation_duration_seconds_sum{%s} %.6f\n",
+                       osOpLabels.c_str(),
+                       static_cast<double>(oOp.nTotalTimeUS) / 1e6);
+        osHistograms += CPLSPrintf(
+            "gdal_vsi_operation_duration_seconds_count{%s} %" PRIu64 "\n",
+            osOpLabels.c_str(), oOp.nCount);
+        if (iOp != static_cast<int>(IOStatsOp::SEEK))
+        {
+            osBytes +=
+                CPLSPrintf("gdal_vsi_operation_bytes_total{%s} %" PRIu64 "\n",
+                           osOpLabels.c_str(), oOp.nBytes);
+        }
+    }
+    osCacheHits += CPLSPrintf("gdal_vsi_cache_hits_total{%s} %" PRIu64 "\n",
+                              osLabels.c_str(), oCounters.nCacheHits);
+    osCacheMisses +=
+        CPLSPrintf("gdal_vsi_cache_misses_total{%s} %" PRIu64 "\n",
+                   osLabels.c_str(), oCounters.nCacheMisses);
+    osRetries += CPLSPrintf("gdal_vsi_retries_total{%s} %" PRIu64 "\n",
+                            osLabels.c_str(), oCounters.nRetries);
+}
+
+std::string PrometheusWriter::Get() const
+{
+    std::string osRet;
+    osRet += "# HELP gdal_vsi_operation_duration_seconds Duration of "
+             "operations on VSI file handles.\n"
+             "# TYPE gdal_vsi_operation_duration_seconds histogram\n";
+    osRet += osHistograms;
+    osRet += "# HELP gdal_vsi_operation_bytes_total Bytes transferred by "
+             "operations on VSI file handles.\n"
+             "# TYPE gdal_vsi_operation_bytes_total counter\n";
+    osRet += osBytes;
+    osRet += "# HELP gdal_vsi_cache_hits_total Hits in file system caches.\n"
+             "# TYPE gdal_vsi_cache_hits_total counter\n";
+    osRet += osCacheHits;
+    osRet +=
+        "# HELP gdal_vsi_cache_misses_total Misses in file system caches.\n"
+        "# TYPE gdal_vsi_cache_misses_total counter\n";
+    osRet += osCacheMisses;
+    osRet += "# HELP gdal_vsi_retries_total Retried requests.\n"
+             "# TYPE gdal_vsi_retries_total counter\n";
+    osRet += osRetries;
+    return osRet;
+}
+
+/************************************************************************/
+/*                          VSIIOStatsHandle                            */
+/************************************************************************/
+
+class VSIIOStatsHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIIOStatsHandle)
+
+    VSIVirtualHandleUniquePtr m_poBase;
+    const std::string m_osFileSystem;
+    const std::string m_osFilename;
+
+    // Times the execution of an operation, and makes the file current
+    // for the running thread while it is in progress.
+    class Timer
+    {
+        CPL_DISALLOW_COPY_ASSIGN(Timer)
+
+        const VSIIOStatsHandle &m_oHandle;
+        const IOStatsOp m_eOp;
+        const OperationContext m_sPrevContext;
+        const std::chrono::steady_clock::time_point m_oStart;
+        uint64_t m_nBytes = 0;
+
+      public:
+        Timer(const VSIIOStatsHandle &oHandle, IOStatsOp eOp)
+            : m_oHandle(oHandle), m_eOp(eOp),
+              m_sPrevContext(gsCurrentContext),
+              m_oStart(std::chrono::steady_clock::now())
+        {
+            gsCurrentContext.posFileSystem = &oHandle.m_osFileSystem;
+            gsCurrentContext.posFilename = &oHandle.m_osFilename;
+        }
+
+        void SetBytes(uint64_t nBytes)
+        {
+            m_nBytes = nBytes;
+        }
+
+        ~Timer()
+        {
+            const auto nTimeUS = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - m_oStart)
+                    .count());
+            gsCurrentContext = m_sPrevContext;
+            LogOperation(m_oHandle.m_osFileSystem, m_oHandle.m_osFilename,
+                         m_eOp, m_nBytes, nTimeUS);
+        }
+    };
+
+  public:
+    VSIIOStatsHandle(VSIVirtualHandle *poBase, const char *pszFilename)
+        : m_poBase(poBase), m_osFileSystem(GetFileSystemName(pszFilename)),
+          m_osFilename(pszFilename)
+    {
+    }
+
+    ~VSIIOStatsHandle() override
+    {
+        VSIIOStatsHandle::Close();
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override
+    {
+        Timer oTimer(*this, IOStatsOp::SEEK);
+        return m_poBase->Seek(nOffset, nWhence);
+    }
+
+    vsi_l_offset Tell() override
+    {
+        return m_poBase->Tell();
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override
+    {
+        Timer oTimer(*this, IOStatsOp::READ);
+        const size_t nRet = m_poBase->Read(pBuffer, nSize, nCount);
+        oTimer.SetBytes(static_cast<uint64_t>(nRet) * nSize);
+        return nRet;
+    }
+
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override
+    {
+        Timer oTimer(*this, IOStatsOp::READ_MULTI_RANGE);
+        const int nRet =
+            m_poBase->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+        if (nRet == 0)
+        {
+            uint64_t nBytes = 0;
+            for (int i = 0; i < nRanges; ++i)
+                nBytes += panSizes[i];
+            oTimer.SetBytes(nBytes);
+        }
+        return nRet;
+    }
+
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override
+    {
+        m_poBase->AdviseRead(nRanges, panOffsets, panSizes);
+    }
+
+    size_t GetAdviseReadTotalBytesLimit() const override
+    {
+        return m_poBase->GetAdviseReadTotalBytesLimit();
+    }
+
+    size_t Write(const void *pBuffer, size_t nSize, size_t nCount) override
+    {
+        Timer oTimer(*this, IOStatsOp::WRITE);
+        const size_t nRet = m_poBase->Write(pBuffer, nSize, nCount);
+        oTimer.SetBytes(static_cast<uint64_t>(nRet) * nSize);
+        return nRet;
+    }
+
+    void ClearErr() override
+    {
+        m_poBase->ClearErr();
+    }
+
+    int Eof() override
+    {
+        return m_poBase->Eof();
+    }
+
+    int Error() override
+    {
+        return m_poBase->Error();
+    }
+
+    int Flush() override
+    {
+        return m_poBase->Flush();
+    }
+
+    int Close() override
+    {
+        if (!m_poBase)
+            return 0;
+        const int nRet = m_poBase->Close();
+        m_poBase.reset();
+        return nRet;
+    }
+
+    int Truncate(vsi_l_offset nNewSize) override
+    {
+        return m_poBase->Truncate(nNewSize);
+    }
+
+    void *GetNativeFileDescriptor() override
+    {
+        return m_poBase->GetNativeFileDescriptor();
+    }
+
+    VSIRangeStatus GetRangeStatus(vsi_l_offset nOffset,
+                                  vsi_l_offset nLength) override
+    {
+        return m_poBase->GetRangeStatus(nOffset, nLength);
+    }
+
+    bool HasPRead() const override
+    {
+        return m_poBase->HasPRead();
+    }
+
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override
+    {
+        Timer oTimer(*this, IOStatsOp::PREAD);
+        const size_t nRet = m_poBase->PRead(pBuffer, nSize, nOffset);
+        oTimer.SetBytes(nRet);
+        return nRet;
+    }
+
+    void Interrupt() override
+    {
+        m_poBase->Interrupt();
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       VSIIOStats::ReadEnabled()                      */
+/************************************************************************/
+
+std::atomic<int> VSIIOStats::gnEnabled{-1};  // unknown state
+
+void VSIIOStats::ReadEnabled()
+{
+    {
+        auto &oState = GetState();
+        std::lock_guard<std::mutex> oLock(oState.oMutex);
+        oState.nMaxFiles = static_cast<size_t>(std::max(
+            0, atoi(CPLGetConfigOption("CPL_VSIL_IO_STATS_MAX_FILES",
+                                       "1000"))));
+    }
+    gnEnabled =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_IO_STATS_ENABLED", "NO"))
+            ? TRUE
+            : FALSE;
+}
+
+/************************************************************************/
+/*                       VSIIOStats::WrapHandle()                       */
+/************************************************************************/
+
+VSIVirtualHandle *VSIIOStats::WrapHandle(VSIVirtualHandle *poBaseHandle,
+                                         const char *pszFilename)
+{
+    if (!poBaseHandle)
+        return nullptr;
+    return new VSIIOStatsHandle(poBaseHandle, pszFilename);
+}
+
+/************************************************************************/
+/*                           VSIIOStats::Log*()                         */
+/************************************************************************/
+
+void VSIIOStats::LogCacheHit()
+{
+    if (IsEnabled())
+        LogCounter(&Counters::nCacheHits);
+}
+
+void VSIIOStats::LogCacheMiss()
+{
+    if (IsEnabled())
+        LogCounter(&Counters::nCacheMisses);
+}
+
+void VSIIOStats::LogRetry()
+{
+    if (IsEnabled())
+        LogCounter(&Counters::nRetries);
+}
+
+/************************************************************************/
+/*                          VSIIOStats::Reset()                         */
+/************************************************************************/
+
+void VSIIOStats::Reset()
+{
+    {
+        auto &oState = GetState();
+        std::lock_guard<std::mutex> oLock(oState.oMutex);
+        oState.oMapFileSystems.clear();
+        oState.nFiles = 0;
+    }
+    gnEnabled = -1;
+}
+
+/************************************************************************/
+/*               VSIIOStats::GetReportAsSerializedJSON()                */
+/************************************************************************/
+
+std::string VSIIOStats::GetReportAsSerializedJSON(bool bPerPath)
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+
+    CPLJSONObject oJSON;
+    CPLJSONObject oFileSystems;
+    oJSON.Add("filesystems", oFileSystems);
+    for (const auto &[osFileSystem, oFS] : oState.oMapFileSystems)
+    {
+        CPLJSONObject oFSJSON;
+        oFS.oTotal.AsJSON(oFSJSON);
+        if (bPerPath && !oFS.oMapFiles.empty())
+        {
+            CPLJSONObject oFiles;
+            for (const auto &[osFilename, oCounters] : oFS.oMapFiles)
+            {
+                CPLJSONObject oFileJSON;
+                oCounters.AsJSON(oFileJSON);
+                oFiles.AddNoSplitName(osFilename, oFileJSON);
+            }
+            oFSJSON.Add("files", oFiles);
+        }
+        oFileSystems.AddNoSplitName(osFileSystem, oFSJSON);
+    }
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+/************************************************************************/
+/*               VSIIOStats::GetReportAsPrometheusText()                */
+/************************************************************************/
+
+std::string VSIIOStats::GetReportAsPrometheusText(bool bPerPath)
+{
+    auto &oState = GetState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+
+    PrometheusWriter oWriter;
+    for (const auto &[osFileSystem, oFS] : oState.oMapFileSystems)
+    {
+        const std::string osFSLabel =
+            "filesystem=\"" + EscapePrometheusLabel(osFileSystem) + '"';
+        if (bPerPath)
+        {
+            for (const auto &[osFilename, oCounters] : oFS.oMapFiles)
+            {
+                oWriter.Add(osFSLabel + ",path=\"" +
+                                EscapePrometheusLabel(osFilename) + '"',
+                            oCounters);
+            }
+        }
+        else
+        {
+            oWriter.Add(osFSLabel, oFS.oTotal);
+        }
+    }
+    return oWriter.Get();
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+/************************************************************************/
+/*                          VSIIOStatsReset()                           */
+/************************************************************************/
+
+/**
+ * \brief Clear I/O statistics collected on file handles.
+ *
+ * The effect of the CPL_VSIL_IO_STATS_ENABLED configuration option
+ * will also be reset. That is, that the next file opening will check its
+ * value again.
+ *
+ * @since GDAL 3.11
+ */
+
+void VSIIOStatsReset(void)
+{
+    cpl::VSIIOStats::Reset();
+}
+
+/************************************************************************/
+/*                     VSIIOStatsGetAsSerializedJSON()                  */
+/************************************************************************/
+
+/**
+ * \brief Return I/O statistics collected on file handles, as a JSON
+ * serialized object.
+ *
+ * Statistics collecting should be enabled with the CPL_VSIL_IO_STATS_ENABLED
+ * configuration option set to YES before files are opened (for efficiency,
+ * reading it is cached on first access, until VSIIOStatsReset() is called).
+ * Only file handles opened with VSIFOpenL() / VSIFOpenExL() / VSIFOpenEx2L()
+ * while statistics are enabled are instrumented. This covers all file
+ * systems, including files opened internally by other file systems (for
+ * example the /vsicurl/ file read by a /vsizip/ one).
+ *
+ * Statistics are aggregated per file system, and optionally per file, up to
+ * CPL_VSIL_IO_STATS_MAX_FILES files (1000 by default).
+ * For each operation (Read, Seek, ReadMultiRange, PRead, Write), the number
+ * of calls, transferred bytes, cumulated time and a latency histogram are
+ * reported. The histogram keys are the upper bounds of each bucket, in
+ * microseconds. File systems that have an internal cache (/vsicurl/ and
+ * derived network file systems, VSICreateCachedFile()) report their hits
+ * and misses, and network file systems report retried requests.
+ *
+ * Example of output:
+ * \code{.js}
+ * {
+ *   "filesystems":{
+ *     "vsicurl":{
+ *       "operations":{
+ *         "Read":{
+ *           "count":3,
+ *           "bytes":49152,
+ *           "total_time_us":20510,
+ *           "latency_histogram_us":{
+ *             "10":2,
+ *             "50000":1
+ *           }
+ *         }
+ *       },
+ *       "cache":{
+ *         "hits":2,
+ *         "misses":1,
+ *         "hit_ratio":0.6666666666666666
+ *       },
+ *       "files":{
+ *         "\/vsicurl\/http:\/\/example.com\/byte.tif":{
+ *           [...]
+ *         }
+ *       }
+ *     }
+ *   }
+ * }
+ * \endcode
+ *
+ * @param papszOptions NULL or NULL-terminated list of options. Supported
+ * options are PER_PATH=YES/NO (default YES), to include per file statistics.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.11
+ */
+
+char *VSIIOStatsGetAsSerializedJSON(char **papszOptions)
+{
+    return CPLStrdup(
+        cpl::VSIIOStats::GetReportAsSerializedJSON(
+            CPLTestBool(CSLFetchNameValueDef(papszOptions, "PER_PATH", "YES")))
+            .c_str());
+}
+
+/************************************************************************/
+/*                     VSIIOStatsGetAsPrometheusText()                  */
+/************************************************************************/
+
+/**
+ * \brief Return I/O statistics collected on file handles, in the Prometheus
+ * text exposition format.
+ *
+ * The returned text can be served as is by a scraping endpoint of the
+ * application. The following metrics are exported, labelled by file system
+ * (and file path if PER_PATH=YES): gdal_vsi_operation_duration_seconds
+ * (histogram, also labelled by operation), gdal_vsi_operation_bytes_total,
+ * gdal_vsi_cache_hits_total, gdal_vsi_cache_misses_total and
+ * gdal_vsi_retries_total.
+ *
+ * See VSIIOStatsGetAsSerializedJSON() for how to enable statistics collection.
+ *
+ * @param papszOptions NULL or NULL-terminated list of options. Supported
+ * options are PER_PATH=YES/NO (default NO), to export per file series
+ * instead of per file system ones. Note that per file series may cause
+ * high cardinality in the monitoring system.
+ * @return a string to free with VSIFree(), or nullptr
+ * @since GDAL 3.11
+ */
+
+char *VSIIOStatsGetAsPrometheusText(char **papszOptions)
+{
+    return CPLStrdup(
+        cpl::VSIIOStats::GetReportAsPrometheusText(
+            CPLTestBool(CSLFetchNameValueDef(papszOptions, "PER_PATH", "NO")))
+            .c_str());
+}
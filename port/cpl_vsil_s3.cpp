@@ -20,10 +20,12 @@
 #include "cpl_time.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <errno.h>
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <set>
@@ -595,6 +597,217 @@ const VSIDIREntry *VSIDIRS3::NextDirEntry()
     }
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSIDIRS3Sharded                             */
+/* ==================================================================== */
+/************************************************************************/
+
+/** Recursive listing of a S3-like directory, where the content of each
+ * first-level subdirectory is listed by a worker thread. This turns the
+ * sequence of paginated listing requests of a flat listing into several
+ * sequences running concurrently.
+ */
+struct VSIDIRS3Sharded final : public VSIDIR
+{
+    struct Shard
+    {
+        std::string osSubdir{};
+        std::vector<std::unique_ptr<VSIDIREntry>> apoEntries{};
+        bool bDone = false;
+        bool bOK = true;
+    };
+
+    IVSIS3LikeFSHandler *m_poFS = nullptr;
+    std::string m_osDirname{};
+    CPLStringList m_aosShardOptions{};
+    int m_nThreads = 1;
+
+    // Entries of the first level
+    std::vector<std::unique_ptr<VSIDIREntry>> m_apoTopEntries{};
+    size_t m_iTopEntry = 0;
+    // Shards indexed as m_apoTopEntries. nullptr for files
+    std::vector<std::unique_ptr<Shard>> m_apoShards{};
+    size_t m_iNextShardToSubmit = 0;
+    Shard *m_poCurShard = nullptr;
+    size_t m_iCurShardEntry = 0;
+
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    VSIDIRS3Sharded() = default;
+    ~VSIDIRS3Sharded() override;
+
+    VSIDIRS3Sharded(const VSIDIRS3Sharded &) = delete;
+    VSIDIRS3Sharded &operator=(const VSIDIRS3Sharded &) = delete;
+
+    bool Init(IVSIS3LikeFSHandler *poFS, const std::string &osDirname,
+              int nThreads, CSLConstList papszOptions);
+
+    const VSIDIREntry *NextDirEntry() override;
+
+  private:
+    void SubmitShards();
+    void ListShard(Shard *poShard);
+};
+
+/************************************************************************/
+/*                         ~VSIDIRS3Sharded()                           */
+/************************************************************************/
+
+VSIDIRS3Sharded::~VSIDIRS3Sharded()
+{
+    // Shards being listed reference this object
+    if (m_poPool)
+        m_poPool->WaitCompletion();
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool VSIDIRS3Sharded::Init(IVSIS3LikeFSHandler *poFS,
+                           const std::string &osDirname, int nThreads,
+                           CSLConstList papszOptions)
+{
+    m_poFS = poFS;
+    m_osDirname = osDirname;
+    m_nThreads = nThreads;
+
+    // PREFIX only applies to the first level, and NUM_THREADS must not
+    // recurse.
+    m_aosShardOptions.Assign(CSLDuplicate(papszOptions), true);
+    m_aosShardOptions.SetNameValue("PREFIX", nullptr);
+    m_aosShardOptions.SetNameValue("NUM_THREADS", nullptr);
+
+    CPLStringList aosTopOptions(CSLDuplicate(papszOptions), true);
+    aosTopOptions.SetNameValue("NUM_THREADS", nullptr);
+    auto poTopDir = std::unique_ptr<VSIDIR>(
+        poFS->OpenDir(osDirname.c_str(), 0, aosTopOptions.List()));
+    if (!poTopDir)
+        return false;
+    while (const auto psEntry = poTopDir->NextDirEntry())
+    {
+        m_apoTopEntries.push_back(std::make_unique<VSIDIREntry>(*psEntry));
+        if (VSI_ISDIR(psEntry->nMode))
+        {
+            auto poShard = std::make_unique<Shard>();
+            poShard->osSubdir = psEntry->pszName;
+            m_apoShards.push_back(std::move(poShard));
+        }
+        else
+        {
+            m_apoShards.push_back(nullptr);
+        }
+    }
+
+    m_poPool = std::make_unique<CPLWorkerThreadPool>();
+    if (!m_poPool->Setup(m_nThreads, nullptr, nullptr, false))
+        return false;
+    SubmitShards();
+    return true;
+}
+
+/************************************************************************/
+/*                           SubmitShards()                             */
+/************************************************************************/
+
+/** Keeps at most twice the number of threads of shards listed ahead of the
+ * one being consumed, to bound memory usage. */
+void VSIDIRS3Sharded::SubmitShards()
+{
+    const size_t nMaxAhead = 2 * static_cast<size_t>(m_nThreads);
+    size_t nAhead = 0;
+    for (size_t i = m_iTopEntry;
+         i < m_iNextShardToSubmit && i < m_apoShards.size(); ++i)
+    {
+        if (m_apoShards[i])
+            ++nAhead;
+    }
+    while (m_iNextShardToSubmit < m_apoShards.size() && nAhead < nMaxAhead)
+    {
+        Shard *poShard = m_apoShards[m_iNextShardToSubmit].get();
+        ++m_iNextShardToSubmit;
+        if (poShard)
+        {
+            m_poPool->SubmitJob([this, poShard]() { ListShard(poShard); });
+            ++nAhead;
+        }
+    }
+}
+
+/************************************************************************/
+/*                             ListShard()                              */
+/************************************************************************/
+
+void VSIDIRS3Sharded::ListShard(Shard *poShard)
+{
+    std::vector<std::unique_ptr<VSIDIREntry>> apoEntries;
+    bool bOK = false;
+    auto poDir = std::unique_ptr<VSIDIR>(m_poFS->OpenDir(
+        (m_osDirname + '/' + poShard->osSubdir).c_str(), -1,
+        m_aosShardOptions.List()));
+    if (poDir)
+    {
+        bOK = true;
+        while (const auto psEntry = poDir->NextDirEntry())
+        {
+            auto poEntry = std::make_unique<VSIDIREntry>(*psEntry);
+            CPLFree(poEntry->pszName);
+            poEntry->pszName = CPLStrdup(
+                (poShard->osSubdir + '/' + psEntry->pszName).c_str());
+            apoEntries.push_back(std::move(poEntry));
+        }
+    }
+
+    std::lock_guard oLock(m_oMutex);
+    poShard->apoEntries = std::move(apoEntries);
+    poShard->bOK = bOK;
+    poShard->bDone = true;
+    m_oCV.notify_one();
+}
+
+/************************************************************************/
+/*                           NextDirEntry()                             */
+/************************************************************************/
+
+const VSIDIREntry *VSIDIRS3Sharded::NextDirEntry()
+{
+    if (m_poCurShard)
+    {
+        if (m_iCurShardEntry < m_poCurShard->apoEntries.size())
+        {
+            return m_poCurShard->apoEntries[m_iCurShardEntry++].get();
+        }
+        // Release memory of the consumed shard
+        m_poCurShard->apoEntries.clear();
+        m_poCurShard = nullptr;
+    }
+
+    if (m_iTopEntry == m_apoTopEntries.size())
+        return nullptr;
+
+    const size_t iEntry = m_iTopEntry++;
+    Shard *poShard = m_apoShards[iEntry].get();
+    if (poShard)
+    {
+        {
+            std::unique_lock oLock(m_oMutex);
+            m_oCV.wait(oLock, [poShard] { return poShard->bDone; });
+        }
+        if (!poShard->bOK)
+        {
+            m_iTopEntry = m_apoTopEntries.size();
+            return nullptr;
+        }
+        m_poCurShard = poShard;
+        m_iCurShardEntry = 0;
+        SubmitShards();
+    }
+    return m_apoTopEntries[iEntry].get();
+}
+
 /************************************************************************/
 /*                          AnalyseS3FileList()                         */
 /************************************************************************/
@@ -2101,11 +2314,20 @@ int VSIS3FSHandler::RmdirRecursive(const char *pszDirname)
     const int nBatchSize =
         atoi(CPLGetConfigOption("CPL_VSIS3_UNLINK_BATCH_SIZE", "1000"));
 
-    return RmdirRecursiveInternal(pszDirname, nBatchSize);
+    return RmdirRecursiveInternal(
+        pszDirname, nBatchSize,
+        CPLGetConfigOption("CPL_VSIS3_RMDIR_RECURSIVE_NUM_THREADS", nullptr));
 }
 
+/** Deletes the content of a directory with batches of nBatchSize objects.
+ *
+ * If pszNumThreads is set to a value greater than 1, the directory is
+ * listed with a sharded listing, and batch deletions run concurrently with
+ * the listing and with each other.
+ */
 int IVSIS3LikeFSHandler::RmdirRecursiveInternal(const char *pszDirname,
-                                                int nBatchSize)
+                                                int nBatchSize,
+                                                const char *pszNumThreads)
 {
     NetworkStatisticsFileSystem oContextFS(GetFSPrefix().c_str());
     NetworkStatisticsAction oContextAction("RmdirRecursive");
@@ -2115,15 +2337,44 @@ int IVSIS3LikeFSHandler::RmdirRecursiveInternal(const char *pszDirname,
         osDirnameWithoutEndSlash.back() == '/')
         osDirnameWithoutEndSlash.pop_back();
 
+    int nThreads = 1;
+#if !defined(CPL_MULTIPROC_STUB)
+    if (pszNumThreads)
+    {
+        nThreads = CPLParseNumThreads(pszNumThreads, 128);
+    }
+#else
+    (void)pszNumThreads;
+#endif
+
     CPLStringList aosOptions;
     aosOptions.SetNameValue("CACHE_ENTRIES", "FALSE");
+    if (nThreads > 1)
+        aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", nThreads));
     auto poDir = std::unique_ptr<VSIDIR>(
         OpenDir(osDirnameWithoutEndSlash.c_str(), -1, aosOptions.List()));
     if (!poDir)
         return -1;
     CPLStringList aosList;
 
-    while (true)
+    std::unique_ptr<CPLWorkerThreadPool> poPool;
+    if (nThreads > 1)
+    {
+        poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(nThreads, nullptr, nullptr, false))
+            poPool.reset();
+    }
+    std::atomic<bool> bSuccess{true};
+
+    const auto DeleteBatch = [this, &bSuccess](const CPLStringList &aosBatch)
+    {
+        int *ret = DeleteObjectBatch(aosBatch.List());
+        if (ret == nullptr)
+            bSuccess = false;
+        CPLFree(ret);
+    };
+
+    while (bSuccess)
     {
         auto entry = poDir->NextDirEntry();
         if (entry)
@@ -2136,19 +2387,33 @@ int IVSIS3LikeFSHandler::RmdirRecursiveInternal(const char *pszDirname,
         }
         if (entry == nullptr || aosList.size() == nBatchSize)
         {
+            if (poPool)
+            {
+                // Wait for all batches before deleting the directory itself
+                poPool->WaitCompletion(entry ? 2 * nThreads : 0);
+            }
             if (entry == nullptr && !osDirnameWithoutEndSlash.empty())
             {
                 aosList.AddString((osDirnameWithoutEndSlash + '/').c_str());
             }
-            int *ret = DeleteObjectBatch(aosList.List());
-            if (ret == nullptr)
-                return -1;
-            CPLFree(ret);
+            if (poPool && entry)
+            {
+                poPool->SubmitJob([DeleteBatch, aosBatch = aosList]()
+                                  { DeleteBatch(aosBatch); });
+            }
+            else
+            {
+                DeleteBatch(aosList);
+            }
             aosList.Clear();
         }
         if (entry == nullptr)
             break;
     }
+    if (poPool)
+        poPool->WaitCompletion();
+    if (!bSuccess)
+        return -1;
     PartialClearCache(osDirnameWithoutEndSlash.c_str());
     return 0;
 }
@@ -3257,6 +3522,33 @@ VSIDIR *IVSIS3LikeFSHandler::OpenDir(const char *pszPath, int nRecurseDepth,
     if (!STARTS_WITH_CI(pszPath, GetFSPrefix().c_str()))
         return nullptr;
 
+#if !defined(CPL_MULTIPROC_STUB)
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (nRecurseDepth < 0 && pszNumThreads &&
+        atoi(CSLFetchNameValueDef(papszOptions, "MAXFILES", "0")) == 0)
+    {
+        const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads);
+        // Listing of the root of the file system is not sharded: buckets
+        // are listed with a different request.
+        const char *pszWithoutPrefix = pszPath + GetFSPrefix().size();
+        if (nThreads > 1 && pszWithoutPrefix[0] != 0 &&
+            strcmp(pszWithoutPrefix, "/") != 0)
+        {
+            std::string osDirname(pszPath);
+            if (osDirname.back() == '/')
+                osDirname.pop_back();
+            auto poDir = std::make_unique<VSIDIRS3Sharded>();
+            if (!poDir->Init(this, osDirname, std::min(nThreads, 128),
+                             papszOptions))
+                return nullptr;
+            return poDir.release();
+        }
+    }
+#endif
+
     NetworkStatisticsFileSystem oContextFS(GetFSPrefix().c_str());
     NetworkStatisticsAction oContextAction("OpenDir");
 
@@ -3997,16 +4289,26 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
          STARTS_WITH(pszSource, "/vsimem/")) &&
         bTargetIsThisFS;
 
+    // Options for the listing of the source and target directories
+    CPLStringList aosSourceDirOptions;
+    aosSourceDirOptions.SetNameValue("SYNTHETIZE_MISSING_DIRECTORIES", "YES");
+    CPLStringList aosTargetDirOptions;
+    if (const char *pszListNumThreads =
+            CSLFetchNameValue(papszOptions, "LIST_NUM_THREADS"))
+    {
+        aosSourceDirOptions.SetNameValue("NUM_THREADS", pszListNumThreads);
+        aosTargetDirOptions.SetNameValue("NUM_THREADS", pszListNumThreads);
+    }
+
     // If the source is likely to be a directory, try to issue a ReadDir()
     // if we haven't stat'ed it yet
     std::unique_ptr<VSIDIR> poSourceDir;
     if (STARTS_WITH(pszSource, GetFSPrefix().c_str()) &&
         (osSource.back() == '/' || osSource.back() == '\\'))
     {
-        const char *const apszOptions[] = {"SYNTHETIZE_MISSING_DIRECTORIES=YES",
-                                           nullptr};
         poSourceDir.reset(VSIOpenDir(osSourceWithoutSlash.c_str(),
-                                     bRecursive ? -1 : 0, apszOptions));
+                                     bRecursive ? -1 : 0,
+                                     aosSourceDirOptions.List()));
     }
 
     VSIStatBufL sSource;
@@ -4253,16 +4555,16 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
 
         if (!poSourceDir)
         {
-            const char *const apszOptions[] = {
-                "SYNTHETIZE_MISSING_DIRECTORIES=YES", nullptr};
             poSourceDir.reset(VSIOpenDir(osSourceWithoutSlash.c_str(),
-                                         bRecursive ? -1 : 0, apszOptions));
+                                         bRecursive ? -1 : 0,
+                                         aosSourceDirOptions.List()));
             if (!poSourceDir)
                 return false;
         }
 
         auto poTargetDir = std::unique_ptr<VSIDIR>(
-            VSIOpenDir(osTargetDir.c_str(), bRecursive ? -1 : 0, nullptr));
+            VSIOpenDir(osTargetDir.c_str(), bRecursive ? -1 : 0,
+                       aosTargetDirOptions.List()));
         std::set<std::string> oSetTargetSubdirs;
         std::map<std::string, VSIDIREntry> oMapExistingTargetFiles;
         // Enumerate existing target files and directories
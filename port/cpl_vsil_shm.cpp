@@ -0,0 +1,306 @@
+/******************************************************************************
+ *
+ * Project:  VSI Virtual File System
+ * Purpose:  Implementation of /vsishm/, files in memory shared between
+ *           processes.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <cerrno>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+
+// Files of /vsishm/ are regular files of a memory backed file system (on
+// Linux, the tmpfs mounted on /dev/shm, where POSIX shm_open() creates its
+// objects), accessed through the local file system handler. Their content
+// thus lives in the page cache and is shared by all processes accessing the
+// same path, and handles support PRead() and GetNativeFileDescriptor(), so
+// that consumers can mmap() them, e.g. with CPLVirtualMemFileMapNew().
+
+constexpr const char *VSISHM_PREFIX = "/vsishm";
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIShmFilesystemHandler                        */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIShmFilesystemHandler final : public VSIFilesystemHandler
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIShmFilesystemHandler)
+
+    static std::string GetRoot();
+    static std::string GetLocalPath(const char *pszFilename);
+
+    static VSIFilesystemHandler *GetLocalHandler()
+    {
+        return VSIFileManager::GetHandler("");
+    }
+
+  public:
+    VSIShmFilesystemHandler() = default;
+    ~VSIShmFilesystemHandler() override = default;
+
+    using VSIFilesystemHandler::Open;
+
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError, CSLConstList papszOptions) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+    int Unlink(const char *pszFilename) override;
+    int Rename(const char *oldpath, const char *newpath) override;
+    int Mkdir(const char *pszDirname, long nMode) override;
+    int Rmdir(const char *pszDirname) override;
+    char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
+    GIntBig GetDiskFreeSpace(const char *pszDirname) override;
+    int SupportsSparseFiles(const char *pszPath) override;
+};
+
+/************************************************************************/
+/*                              GetRoot()                               */
+/************************************************************************/
+
+// Returns the directory of the local file system where the files of
+// /vsishm/ are stored, or an empty string if there is none.
+std::string VSIShmFilesystemHandler::GetRoot()
+{
+#ifdef __linux__
+    // Per-user directory, so that users do not share (or compete for) the
+    // same tree.
+    const std::string osDefaultRoot =
+        CPLSPrintf("/dev/shm/gdal_vsishm_%u", static_cast<unsigned>(geteuid()));
+#else
+    const std::string osDefaultRoot;
+#endif
+    std::string osRoot =
+        CPLGetConfigOption("CPL_VSISHM_ROOT", osDefaultRoot.c_str());
+    if (osRoot.empty())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "/vsishm/ requires the CPL_VSISHM_ROOT configuration option "
+                 "to be set on this platform");
+        return std::string();
+    }
+    while (osRoot.size() > 1 && osRoot.back() == '/')
+        osRoot.pop_back();
+
+    // Only the current user may access the shared files.
+    VSIStatBufL sStat;
+    if (VSIStatL(osRoot.c_str(), &sStat) != 0)
+    {
+        if (VSIMkdirRecursive(osRoot.c_str(), 0700) != 0 ||
+            VSIStatL(osRoot.c_str(), &sStat) != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     osRoot.c_str());
+            return std::string();
+        }
+    }
+#ifndef _WIN32
+    // The directory may have been created beforehand by another user, who
+    // could then read or replace the files.
+    if (!VSI_ISDIR(sStat.st_mode) || sStat.st_uid != geteuid() ||
+        (sStat.st_mode & 077) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s must be a directory owned by the current user, and "
+                 "not accessible to other users (mode 0700)",
+                 osRoot.c_str());
+        return std::string();
+    }
+#endif
+    return osRoot;
+}
+
+/************************************************************************/
+/*                            GetLocalPath()                            */
+/************************************************************************/
+
+std::string VSIShmFilesystemHandler::GetLocalPath(const char *pszFilename)
+{
+    if (!STARTS_WITH(pszFilename, VSISHM_PREFIX))
+        return std::string();
+    const char *pszPath = pszFilename + strlen(VSISHM_PREFIX);
+    if (*pszPath != '\0' && *pszPath != '/')
+        return std::string();
+    // Do not allow escaping from the root
+    if (strstr(pszPath, "/../") != nullptr || EQUAL(pszPath, "/..") ||
+        (strlen(pszPath) >= 3 && EQUAL(pszPath + strlen(pszPath) - 3, "/..")))
+    {
+        return std::string();
+    }
+
+    const std::string osRoot = GetRoot();
+    if (osRoot.empty())
+        return std::string();
+    return osRoot + pszPath;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandle *VSIShmFilesystemHandler::Open(const char *pszFilename,
+                                                const char *pszAccess,
+                                                bool bSetError,
+                                                CSLConstList papszOptions)
+{
+    const std::string osLocalPath = GetLocalPath(pszFilename);
+    if (osLocalPath.empty())
+    {
+        errno = ENOENT;
+        return nullptr;
+    }
+    return GetLocalHandler()->Open(osLocalPath.c_str(), pszAccess, bSetError,
+                                   papszOptions);
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::Stat(const char *pszFilename,
+                                  VSIStatBufL *pStatBuf, int nFlags)
+{
+    const std::string osLocalPath = GetLocalPath(pszFilename);
+    if (osLocalPath.empty())
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    return GetLocalHandler()->Stat(osLocalPath.c_str(), pStatBuf, nFlags);
+}
+
+/************************************************************************/
+/*                               Unlink()                               */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::Unlink(const char *pszFilename)
+{
+    const std::string osLocalPath = GetLocalPath(pszFilename);
+    if (osLocalPath.empty())
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    return GetLocalHandler()->Unlink(osLocalPath.c_str());
+}
+
+/************************************************************************/
+/*                               Rename()                               */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::Rename(const char *oldpath, const char *newpath)
+{
+    const std::string osOldLocalPath = GetLocalPath(oldpath);
+    const std::string osNewLocalPath = GetLocalPath(newpath);
+    if (osOldLocalPath.empty() || osNewLocalPath.empty())
+    {
+        errno = EXDEV;
+        return -1;
+    }
+    return GetLocalHandler()->Rename(osOldLocalPath.c_str(),
+                                     osNewLocalPath.c_str());
+}
+
+/************************************************************************/
+/*                               Mkdir()                                */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::Mkdir(const char *pszDirname, long nMode)
+{
+    const std::string osLocalPath = GetLocalPath(pszDirname);
+    if (osLocalPath.empty())
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    return GetLocalHandler()->Mkdir(osLocalPath.c_str(), nMode);
+}
+
+/************************************************************************/
+/*                               Rmdir()                                */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::Rmdir(const char *pszDirname)
+{
+    const std::string osLocalPath = GetLocalPath(pszDirname);
+    if (osLocalPath.empty())
+    {
+        errno = ENOENT;
+        return -1;
+    }
+    return GetLocalHandler()->Rmdir(osLocalPath.c_str());
+}
+
+/************************************************************************/
+/*                             ReadDirEx()                              */
+/************************************************************************/
+
+char **VSIShmFilesystemHandler::ReadDirEx(const char *pszDirname,
+                                          int nMaxFiles)
+{
+    const std::string osLocalPath = GetLocalPath(pszDirname);
+    if (osLocalPath.empty())
+        return nullptr;
+    return GetLocalHandler()->ReadDirEx(osLocalPath.c_str(), nMaxFiles);
+}
+
+/************************************************************************/
+/*                          GetDiskFreeSpace()                          */
+/************************************************************************/
+
+GIntBig VSIShmFilesystemHandler::GetDiskFreeSpace(const char *pszDirname)
+{
+    const std::string osLocalPath = GetLocalPath(pszDirname);
+    if (osLocalPath.empty())
+        return -1;
+    return GetLocalHandler()->GetDiskFreeSpace(osLocalPath.c_str());
+}
+
+/************************************************************************/
+/*                        SupportsSparseFiles()                         */
+/************************************************************************/
+
+int VSIShmFilesystemHandler::SupportsSparseFiles(const char *pszPath)
+{
+    const std::string osLocalPath = GetLocalPath(pszPath);
+    if (osLocalPath.empty())
+        return FALSE;
+    return GetLocalHandler()->SupportsSparseFiles(osLocalPath.c_str());
+}
+
+/************************************************************************/
+/*                      VSIInstallShmFileHandler()                      */
+/************************************************************************/
+
+/*!
+ \brief Install /vsishm/ virtual file handler.
+
+ \verbatim embed:rst
+ See :ref:`/vsishm/ documentation <vsishm>`
+ \endverbatim
+
+ @since GDAL 3.11
+ */
+
+void VSIInstallShmFileHandler()
+{
+    VSIFileManager::InstallHandler("/vsishm/", new VSIShmFilesystemHandler);
+}
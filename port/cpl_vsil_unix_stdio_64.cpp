@@ -73,8 +73,17 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_LIBURING
+#include <liburing.h>
+#endif
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -127,6 +136,12 @@
 
 #endif /* ndef UNIX_STDIO_64 */
 
+#if defined(O_DIRECT) && defined(HAVE_PREAD64)
+#define VSI_UNIX_HAS_DIRECT_IO
+// Alignment of file offsets, sizes and buffers required by O_DIRECT
+constexpr size_t VSI_UNIX_DIRECT_IO_ALIGNMENT = 4096;
+#endif
+
 #ifndef BUILD_WITHOUT_64BIT_OFFSET
 // Ensure we have working 64 bit API
 static_assert(sizeof(VSI_FTELL64(stdout)) == sizeof(vsi_l_offset),
@@ -139,6 +154,176 @@ static_assert(sizeof(VSIStatBufL::st_size) == sizeof(vsi_l_offset),
               "add the -DBUILD_WITHOUT_64BIT_OFFSET define");
 #endif
 
+#ifdef HAVE_LIBURING
+
+/************************************************************************/
+/* ==================================================================== */
+/*                           VSIUnixIOURing                             */
+/* ==================================================================== */
+/************************************************************************/
+
+/** One read of a batch issued through VSIUnixIOURing */
+struct VSIUnixReadRequest
+{
+    int nFD = -1;
+    GByte *pabyDst = nullptr;
+    vsi_l_offset nOffset = 0;
+    // Number of bytes requested
+    size_t nSize = 0;
+    // Number of bytes that must be read for the request to succeed. May be
+    // lower than nSize for O_DIRECT reads of the end of the file.
+    size_t nMinSize = 0;
+    size_t nDone = 0;
+};
+
+/** Submission and completion queue pair of io_uring, used to issue a batch
+ * of reads with a single system call. */
+class VSIUnixIOURing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIUnixIOURing)
+
+    struct io_uring m_sRing{};
+    unsigned m_nQueueDepth = 0;
+    bool m_bValid = false;
+
+  public:
+    explicit VSIUnixIOURing(unsigned nQueueDepth);
+    ~VSIUnixIOURing();
+
+    bool IsValid() const
+    {
+        return m_bValid;
+    }
+
+    bool Read(std::vector<VSIUnixReadRequest> &aoRequests);
+
+    static bool IsAvailable();
+};
+
+/************************************************************************/
+/*                          VSIUnixIOURing()                            */
+/************************************************************************/
+
+VSIUnixIOURing::VSIUnixIOURing(unsigned nQueueDepth)
+    : m_nQueueDepth(nQueueDepth)
+{
+    const int ret = io_uring_queue_init(m_nQueueDepth, &m_sRing, 0);
+    m_bValid = (ret == 0);
+    if (!m_bValid)
+    {
+        CPLDebug("VSI", "io_uring_queue_init() failed: %s", strerror(-ret));
+    }
+}
+
+/************************************************************************/
+/*                         ~VSIUnixIOURing()                            */
+/************************************************************************/
+
+VSIUnixIOURing::~VSIUnixIOURing()
+{
+    if (m_bValid)
+        io_uring_queue_exit(&m_sRing);
+}
+
+/************************************************************************/
+/*                            IsAvailable()                             */
+/************************************************************************/
+
+/** Returns whether io_uring can be used. It may be disabled in the kernel
+ * or by seccomp filters of containers. */
+bool VSIUnixIOURing::IsAvailable()
+{
+    static const bool bAvailable = VSIUnixIOURing(1).IsValid();
+    return bAvailable;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+/** Issues all the requests, keeping at most m_nQueueDepth of them in
+ * flight, and waits for their completion. Short reads are resubmitted for
+ * their remaining part. */
+bool VSIUnixIOURing::Read(std::vector<VSIUnixReadRequest> &aoRequests)
+{
+    std::vector<VSIUnixReadRequest *> apoPending;
+    apoPending.reserve(aoRequests.size());
+    for (auto oIter = aoRequests.rbegin(); oIter != aoRequests.rend(); ++oIter)
+    {
+        if (oIter->nMinSize > 0)
+            apoPending.push_back(&*oIter);
+    }
+
+    unsigned nInFlight = 0;
+    bool bOK = true;
+    while (nInFlight > 0 || (bOK && !apoPending.empty()))
+    {
+        // Once an error occurred, stop submitting requests, but still wait
+        // for the completion of those in flight, since they write into the
+        // caller buffers.
+        while (bOK && !apoPending.empty() && nInFlight < m_nQueueDepth)
+        {
+            struct io_uring_sqe *sqe = io_uring_get_sqe(&m_sRing);
+            if (!sqe)
+                break;
+            VSIUnixReadRequest *poReq = apoPending.back();
+            apoPending.pop_back();
+            const unsigned nToRead = static_cast<unsigned>(
+                std::min<size_t>(poReq->nSize - poReq->nDone, 1U << 30));
+            io_uring_prep_read(sqe, poReq->nFD, poReq->pabyDst + poReq->nDone,
+                               nToRead, poReq->nOffset + poReq->nDone);
+            io_uring_sqe_set_data(sqe, poReq);
+            ++nInFlight;
+        }
+
+        const int ret = io_uring_submit_and_wait(&m_sRing, 1);
+        if (ret < 0 && ret != -EINTR && ret != -EAGAIN)
+        {
+            CPLDebug("VSI", "io_uring_submit_and_wait() failed: %s",
+                     strerror(-ret));
+            return false;
+        }
+
+        struct io_uring_cqe *cqe = nullptr;
+        unsigned nHead = 0;
+        unsigned nSeen = 0;
+        io_uring_for_each_cqe(&m_sRing, nHead, cqe)
+        {
+            ++nSeen;
+            --nInFlight;
+            auto poReq =
+                static_cast<VSIUnixReadRequest *>(io_uring_cqe_get_data(cqe));
+            if (cqe->res == -EINTR || cqe->res == -EAGAIN)
+            {
+                apoPending.push_back(poReq);
+            }
+            else if (cqe->res < 0)
+            {
+                CPLDebug("VSI", "io_uring read failed: %s",
+                         strerror(-cqe->res));
+                bOK = false;
+            }
+            else if (cqe->res == 0)
+            {
+                // End of file
+                if (poReq->nDone < poReq->nMinSize)
+                    bOK = false;
+            }
+            else
+            {
+                poReq->nDone += static_cast<size_t>(cqe->res);
+                if (poReq->nDone < poReq->nMinSize)
+                    apoPending.push_back(poReq);
+            }
+        }
+        io_uring_cq_advance(&m_sRing, nSeen);
+    }
+
+    return bOK;
+}
+
+#endif  // HAVE_LIBURING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -172,6 +357,9 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
     GIntBig GetDiskFreeSpace(const char *pszDirname) override;
     int SupportsSparseFiles(const char *pszPath) override;
+#ifdef HAVE_LIBURING
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
+#endif
 
     bool IsLocal(const char *pszPath) override;
     bool SupportsSequentialWrite(const char *pszPath,
@@ -218,10 +406,28 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     vsi_l_offset nTotalBytesRead = 0;
     VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #endif
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+    // Reads of at least that many bytes bypass the page cache. 0 to disable.
+    size_t m_nDirectIOThreshold = 0;
+    std::string m_osFilename{};
+    int m_nDirectFD = -1;
+    bool m_bDirectFDFailed = false;
+
+    int GetDirectFD();
+    size_t DirectPRead(void *pBuffer, size_t nSize, vsi_l_offset nOffset);
+#endif
+#ifdef HAVE_LIBURING
+    bool m_bUseIOURing = false;
+    unsigned m_nIOURingQueueDepth = 0;
+    std::unique_ptr<VSIUnixIOURing> m_poIOURing{};
+#endif
+
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, FILE *fpIn,
                        bool bReadOnlyIn, bool bModeAppendReadWriteIn);
 
+    void InitReadOptions(const char *pszFilename);
+
     int Seek(vsi_l_offset nOffsetIn, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
@@ -245,6 +451,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
 #endif
+#ifdef HAVE_LIBURING
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
 };
 
 /************************************************************************/
@@ -266,6 +477,44 @@ VSIUnixStdioHandle::VSIUnixStdioHandle(
 {
 }
 
+/************************************************************************/
+/*                          InitReadOptions()                           */
+/************************************************************************/
+
+void VSIUnixStdioHandle::InitReadOptions(
+#ifndef VSI_UNIX_HAS_DIRECT_IO
+    CPL_UNUSED
+#endif
+        const char *pszFilename)
+{
+#ifdef HAVE_LIBURING
+    m_bUseIOURing =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_UNIX_IO_URING", "NO")) &&
+        VSIUnixIOURing::IsAvailable();
+    if (m_bUseIOURing)
+    {
+        m_nIOURingQueueDepth = static_cast<unsigned>(std::clamp(
+            atoi(CPLGetConfigOption("CPL_VSIL_UNIX_IO_URING_QUEUE_DEPTH",
+                                    "64")),
+            1, 4096));
+    }
+#endif
+
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+    const char *pszThreshold =
+        CPLGetConfigOption("CPL_VSIL_UNIX_DIRECT_IO_THRESHOLD", nullptr);
+    GIntBig nThreshold = 0;
+    if (pszThreshold &&
+        CPLParseMemorySize(pszThreshold, &nThreshold, nullptr) == CE_None &&
+        nThreshold > 0)
+    {
+        m_nDirectIOThreshold = static_cast<size_t>(std::min<GIntBig>(
+            nThreshold, std::numeric_limits<GIntBig>::max() / 2));
+        m_osFilename = pszFilename;
+    }
+#endif
+}
+
 /************************************************************************/
 /*                               Close()                                */
 /************************************************************************/
@@ -282,6 +531,14 @@ int VSIUnixStdioHandle::Close()
     poFS->AddToTotal(nTotalBytesRead);
 #endif
 
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+    if (m_nDirectFD >= 0)
+    {
+        close(m_nDirectFD);
+        m_nDirectFD = -1;
+    }
+#endif
+
     int ret = fclose(fp);
     fp = nullptr;
     return ret;
@@ -444,6 +701,31 @@ size_t VSIUnixStdioHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         }
     }
 
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+    /* -------------------------------------------------------------------- */
+    /*      Large reads may bypass the page cache.                          */
+    /* -------------------------------------------------------------------- */
+    if (m_nDirectIOThreshold > 0 && nSize > 0 &&
+        nCount >= m_nDirectIOThreshold / nSize && GetDirectFD() >= 0)
+    {
+        const size_t nRead = DirectPRead(pBuffer, nSize * nCount, m_nOffset);
+        if (nRead != static_cast<size_t>(-1))
+        {
+#ifdef VSI_COUNT_BYTES_READ
+            nTotalBytesRead += nRead;
+#endif
+            m_nOffset += nRead;
+            // Resynchronize the stdio stream with the new position
+            VSI_FSEEK64(fp, m_nOffset, SEEK_SET);
+            bLastOpWrite = false;
+            bLastOpRead = false;
+            if (nRead < nSize * nCount)
+                bAtEOF = true;
+            return nRead / nSize;
+        }
+    }
+#endif
+
     /* -------------------------------------------------------------------- */
     /*      Perform the read.                                               */
     /* -------------------------------------------------------------------- */
@@ -681,6 +963,179 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
 }
 #endif
 
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+
+/************************************************************************/
+/*                            GetDirectFD()                             */
+/************************************************************************/
+
+/** Returns a file descriptor of the file opened with O_DIRECT, or -1 if the
+ * file system does not support it. */
+int VSIUnixStdioHandle::GetDirectFD()
+{
+    if (m_nDirectFD < 0 && !m_bDirectFDFailed)
+    {
+        m_nDirectFD =
+            open(m_osFilename.c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+        if (m_nDirectFD < 0)
+        {
+            CPLDebug("VSI", "Cannot open %s with O_DIRECT: %s",
+                     m_osFilename.c_str(), strerror(errno));
+            m_bDirectFDFailed = true;
+        }
+    }
+    return m_nDirectFD;
+}
+
+/************************************************************************/
+/*                            DirectPRead()                             */
+/************************************************************************/
+
+/** Reads nSize bytes at nOffset through the O_DIRECT file descriptor, using
+ * an aligned intermediate buffer.
+ *
+ * @return the number of bytes read, or static_cast<size_t>(-1) if the
+ * caller should fallback to buffered I/O.
+ */
+size_t VSIUnixStdioHandle::DirectPRead(void *pBuffer, size_t nSize,
+                                       vsi_l_offset nOffset)
+{
+    constexpr size_t ALIGN = VSI_UNIX_DIRECT_IO_ALIGNMENT;
+    const vsi_l_offset nAlignedOffset = nOffset - nOffset % ALIGN;
+    const size_t nHead = static_cast<size_t>(nOffset - nAlignedOffset);
+    if (nSize > std::numeric_limits<size_t>::max() - nHead - ALIGN)
+        return static_cast<size_t>(-1);
+    const size_t nAlignedSize = (nHead + nSize + ALIGN - 1) / ALIGN * ALIGN;
+    GByte *pabyAligned =
+        static_cast<GByte *>(VSIMallocAligned(ALIGN, nAlignedSize));
+    if (!pabyAligned)
+        return static_cast<size_t>(-1);
+
+    size_t nDone = 0;
+    while (nDone < nAlignedSize)
+    {
+        const ssize_t nRet =
+            pread64(m_nDirectFD, pabyAligned + nDone, nAlignedSize - nDone,
+                    nAlignedOffset + nDone);
+        if (nRet < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            CPLDebug("VSI", "O_DIRECT read of %s failed: %s. Disabling it",
+                     m_osFilename.c_str(), strerror(errno));
+            m_nDirectIOThreshold = 0;
+            VSIFreeAligned(pabyAligned);
+            return static_cast<size_t>(-1);
+        }
+        if (nRet == 0)
+            break;
+        nDone += static_cast<size_t>(nRet);
+        // A read not ending on an aligned offset means end of file
+        if ((nDone % ALIGN) != 0)
+            break;
+    }
+
+    const size_t nRead = nDone > nHead ? std::min(nDone - nHead, nSize) : 0;
+    memcpy(pBuffer, pabyAligned + nHead, nRead);
+    VSIFreeAligned(pabyAligned);
+    return nRead;
+}
+
+#endif  // VSI_UNIX_HAS_DIRECT_IO
+
+#ifdef HAVE_LIBURING
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if (!m_bUseIOURing || nRanges <= 1)
+    {
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+    }
+
+    if (!m_poIOURing)
+    {
+        m_poIOURing = std::make_unique<VSIUnixIOURing>(m_nIOURingQueueDepth);
+        if (!m_poIOURing->IsValid())
+        {
+            m_poIOURing.reset();
+            m_bUseIOURing = false;
+            return VSIVirtualHandle::ReadMultiRange(nRanges, ppData,
+                                                    panOffsets, panSizes);
+        }
+    }
+
+    const int nFD = fileno(fp);
+    std::vector<VSIUnixReadRequest> aoRequests(nRanges);
+    std::vector<std::unique_ptr<GByte, decltype(&VSIFreeAligned)>>
+        apabyDirectBuffers;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        auto &oReq = aoRequests[i];
+        oReq.nFD = nFD;
+        oReq.pabyDst = static_cast<GByte *>(ppData[i]);
+        oReq.nOffset = panOffsets[i];
+        oReq.nSize = panSizes[i];
+        oReq.nMinSize = panSizes[i];
+#ifdef VSI_UNIX_HAS_DIRECT_IO
+        if (m_nDirectIOThreshold > 0 && panSizes[i] >= m_nDirectIOThreshold &&
+            GetDirectFD() >= 0)
+        {
+            constexpr size_t ALIGN = VSI_UNIX_DIRECT_IO_ALIGNMENT;
+            const vsi_l_offset nAlignedOffset =
+                panOffsets[i] - panOffsets[i] % ALIGN;
+            const size_t nHead =
+                static_cast<size_t>(panOffsets[i] - nAlignedOffset);
+            const size_t nAlignedSize =
+                (nHead + panSizes[i] + ALIGN - 1) / ALIGN * ALIGN;
+            GByte *pabyAligned =
+                static_cast<GByte *>(VSIMallocAligned(ALIGN, nAlignedSize));
+            if (pabyAligned)
+            {
+                apabyDirectBuffers.emplace_back(pabyAligned, VSIFreeAligned);
+                oReq.nFD = m_nDirectFD;
+                oReq.pabyDst = pabyAligned;
+                oReq.nOffset = nAlignedOffset;
+                oReq.nSize = nAlignedSize;
+                oReq.nMinSize = nHead + panSizes[i];
+            }
+        }
+#endif
+    }
+
+    const bool bOK = m_poIOURing->Read(aoRequests);
+
+    if (bOK && !apabyDirectBuffers.empty())
+    {
+        for (int i = 0; i < nRanges; ++i)
+        {
+            const auto &oReq = aoRequests[i];
+            if (oReq.pabyDst != ppData[i])
+            {
+                memcpy(ppData[i],
+                       oReq.pabyDst +
+                           static_cast<size_t>(panOffsets[i] - oReq.nOffset),
+                       panSizes[i]);
+            }
+        }
+    }
+
+#ifdef VSI_COUNT_BYTES_READ
+    for (const auto &oReq : aoRequests)
+        nTotalBytesRead += oReq.nDone;
+#endif
+
+    return bOK ? 0 : -1;
+}
+
+#endif  // HAVE_LIBURING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -745,6 +1200,9 @@ VSIUnixStdioFilesystemHandler::Open(const char *pszFilename,
 
     errno = nError;
 
+    if (bReadOnly)
+        poHandle->InitReadOptions(pszFilename);
+
     /* -------------------------------------------------------------------- */
     /*      If VSI_CACHE is set we want to use a cached reader instead      */
     /*      of more direct io on the underlying file.                       */
@@ -958,6 +1416,19 @@ int VSIUnixStdioFilesystemHandler::SupportsSparseFiles(const char *
 #endif
 }
 
+#ifdef HAVE_LIBURING
+/************************************************************************/
+/*                     HasOptimizedReadMultiRange()                     */
+/************************************************************************/
+
+int VSIUnixStdioFilesystemHandler::HasOptimizedReadMultiRange(
+    const char * /* pszPath */)
+{
+    return CPLTestBool(CPLGetConfigOption("CPL_VSIL_UNIX_IO_URING", "NO")) &&
+           VSIUnixIOURing::IsAvailable();
+}
+#endif
+
 /************************************************************************/
 /*                          IsLocal()                                   */
 /************************************************************************/
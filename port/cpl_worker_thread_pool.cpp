@@ -13,6 +13,7 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -31,7 +32,7 @@ static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
  * The pool is in an uninitialized state after this call. The Setup() method
  * must be called.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool()
 {
 }
 
@@ -39,7 +40,7 @@ CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
  *
  * \param nThreads  Number of threads in the pool.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads) : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads)
 {
     Setup(nThreads, nullptr, nullptr);
 }
@@ -132,6 +133,19 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  * @return true in case of success.
  */
 bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
+{
+    return SubmitJob(std::move(task), nullptr, CPLJobPriority::NORMAL, true);
+}
+
+//! @cond Doxygen_Suppress
+
+// bMayRunSynchronously = false must only be used when the caller does not
+// wait for the job afterwards, since the job might then wait for a worker
+// thread to be available.
+bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task,
+                                    const CPLJobQueue *poQueue,
+                                    CPLJobPriority ePriority,
+                                    bool bMayRunSynchronously)
 {
 #ifdef DEBUG
     {
@@ -141,7 +155,7 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
 #endif
 
     bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
-    if (threadLocalCurrentThreadPool == this)
+    if (threadLocalCurrentThreadPool == this && bMayRunSynchronously)
     {
         // If there are waiting threads or we have not started all allowed
         // threads, we can submit this job asynchronously
@@ -188,7 +202,8 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
             aWT.emplace_back(std::move(wt));
     }
 
-    jobQueue.emplace(task);
+    aJobQueues[static_cast<int>(ePriority)].push_back(
+        Job{std::move(task), poQueue});
     nPendingJobs++;
 
     if (psWaitingWorkerThreadsList)
@@ -221,6 +236,8 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
     return true;
 }
 
+//! @endcond
+
 /************************************************************************/
 /*                             SubmitJobs()                              */
 /************************************************************************/
@@ -274,7 +291,8 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
             }
         }
 
-        jobQueue.emplace([=] { pfnFunc(pData); });
+        aJobQueues[static_cast<int>(CPLJobPriority::NORMAL)].push_back(
+            Job{[=] { pfnFunc(pData); }, nullptr});
         nPendingJobs++;
     }
 
@@ -459,14 +477,20 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
         if (eState == CPLWTS_STOP)
             return std::function<void()>();
 
-        if (jobQueue.size())
+        // Pick the oldest job of the highest priority
+        for (auto oIter = aJobQueues.rbegin(); oIter != aJobQueues.rend();
+             ++oIter)
         {
+            auto &jobQueue = *oIter;
+            if (!jobQueue.empty())
+            {
 #if DEBUG_VERBOSE
-            CPLDebug("JOB", "%p got a job", psWorkerThread);
+                CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            auto task = std::move(jobQueue.front());
-            jobQueue.pop();
-            return task;
+                auto task = std::move(jobQueue.front().task);
+                jobQueue.pop_front();
+                return task;
+            }
         }
 
         if (!psWorkerThread->bMarkedAsWaiting)
@@ -508,6 +532,69 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     }
 }
 
+/************************************************************************/
+/*                        RunPendingJobOfQueue()                        */
+/************************************************************************/
+
+// Removes from the pending list the first job that has been submitted
+// through poQueue, and runs it in the calling thread.
+// Returns false if there is no such job.
+bool CPLWorkerThreadPool::RunPendingJobOfQueue(const CPLJobQueue *poQueue)
+{
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        auto &jobQueue = aJobQueues[static_cast<int>(poQueue->GetPriority())];
+        for (auto oIter = jobQueue.begin(); oIter != jobQueue.end(); ++oIter)
+        {
+            if (oIter->poQueue == poQueue)
+            {
+                task = std::move(oIter->task);
+                jobQueue.erase(oIter);
+                break;
+            }
+        }
+    }
+    if (!task)
+        return false;
+
+    task();
+    DeclareJobFinished();
+    return true;
+}
+
+/************************************************************************/
+/*                      RemovePendingJobsOfQueue()                      */
+/************************************************************************/
+
+// Removes from the pending list all jobs that have been submitted through
+// poQueue, without running them. Returns the number of removed jobs.
+int CPLWorkerThreadPool::RemovePendingJobsOfQueue(const CPLJobQueue *poQueue)
+{
+    // Destroyed after releasing the mutex, as destroying a job might have
+    // side effects, such as breaking the promise of a future.
+    std::vector<std::function<void()>> aoRemovedTasks;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        auto &jobQueue = aJobQueues[static_cast<int>(poQueue->GetPriority())];
+        for (auto oIter = jobQueue.begin(); oIter != jobQueue.end();)
+        {
+            if (oIter->poQueue == poQueue)
+            {
+                aoRemovedTasks.push_back(std::move(oIter->task));
+                oIter = jobQueue.erase(oIter);
+            }
+            else
+            {
+                ++oIter;
+            }
+        }
+        nPendingJobs -= static_cast<int>(aoRemovedTasks.size());
+        m_cv.notify_one();
+    }
+    return static_cast<int>(aoRemovedTasks.size());
+}
+
 /************************************************************************/
 /*                         CreateJobQueue()                             */
 /************************************************************************/
@@ -524,6 +611,27 @@ std::unique_ptr<CPLJobQueue> CPLWorkerThreadPool::CreateJobQueue()
     return std::unique_ptr<CPLJobQueue>(new CPLJobQueue(this));
 }
 
+/** Create a new job queue based on this worker thread pool, with a priority
+ * and a maximum number of jobs running at the same time.
+ *
+ * The worker thread pool must remain alive while the returned object is
+ * itself alive.
+ *
+ * @param ePriority Priority of the jobs of the queue, relative to the ones of
+ *                  other queues of the pool.
+ * @param nMaxConcurrency Maximum number of jobs of the queue that may run at
+ *                        the same time, or 0 for no other limit than the
+ *                        number of threads of the pool.
+ * @since GDAL 3.11
+ */
+std::unique_ptr<CPLJobQueue>
+CPLWorkerThreadPool::CreateJobQueue(CPLJobPriority ePriority,
+                                    int nMaxConcurrency)
+{
+    return std::unique_ptr<CPLJobQueue>(
+        new CPLJobQueue(this, ePriority, nMaxConcurrency));
+}
+
 /************************************************************************/
 /*                            CPLJobQueue()                             */
 /************************************************************************/
@@ -533,6 +641,13 @@ CPLJobQueue::CPLJobQueue(CPLWorkerThreadPool *poPool) : m_poPool(poPool)
 {
 }
 
+CPLJobQueue::CPLJobQueue(CPLWorkerThreadPool *poPool, CPLJobPriority ePriority,
+                         int nMaxConcurrency)
+    : m_poPool(poPool), m_ePriority(ePriority),
+      m_nMaxConcurrency(std::max(0, nMaxConcurrency))
+{
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -550,9 +665,43 @@ CPLJobQueue::~CPLJobQueue()
 
 void CPLJobQueue::DeclareJobFinished()
 {
-    std::lock_guard<std::mutex> oGuard(m_mutex);
-    m_nPendingJobs--;
-    m_cv.notify_one();
+    std::function<void()> nextTask;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_nPendingJobs--;
+        m_nSubmittedJobs--;
+        if (!m_aoDeferredJobs.empty())
+        {
+            nextTask = std::move(m_aoDeferredJobs.front());
+            m_aoDeferredJobs.pop_front();
+            m_nSubmittedJobs++;
+        }
+        m_cv.notify_one();
+    }
+
+    // Submit a job held back by m_nMaxConcurrency, now that a slot is free.
+    // As m_nPendingJobs still accounts for it, the queue cannot be destroyed
+    // in the meantime.
+    if (nextTask)
+        SubmitToPool(std::move(nextTask), /* bMayRunSynchronously = */ false);
+}
+
+/************************************************************************/
+/*                            SubmitToPool()                            */
+/************************************************************************/
+
+bool CPLJobQueue::SubmitToPool(std::function<void()> task,
+                               bool bMayRunSynchronously)
+{
+    // coverity[uninit_member,copy_constructor_call]
+    const auto lambda = [this, task]
+    {
+        task();
+        DeclareJobFinished();
+    };
+    // cppcheck-suppress knownConditionTrueFalse
+    return m_poPool->SubmitJob(lambda, this, m_ePriority,
+                               bMayRunSynchronously);
 }
 
 /************************************************************************/
@@ -580,16 +729,48 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
         m_nPendingJobs++;
+        if (m_nMaxConcurrency > 0 && m_nSubmittedJobs >= m_nMaxConcurrency)
+        {
+            // Submitted by DeclareJobFinished() when a running job finishes
+            m_aoDeferredJobs.push_back(std::move(task));
+            return true;
+        }
+        m_nSubmittedJobs++;
     }
 
-    // coverity[uninit_member,copy_constructor_call]
-    const auto lambda = [this, task]
+    return SubmitToPool(std::move(task), /* bMayRunSynchronously = */ true);
+}
+
+/************************************************************************/
+/*                         CancelPendingJobs()                          */
+/************************************************************************/
+
+/** Remove the jobs of this queue that have not started yet, without running
+ * them, and mark the queue as cancelled (see IsCancelled()). Running jobs are
+ * not interrupted, and jobs submitted afterwards are run.
+ *
+ * @return the number of removed jobs.
+ * @since GDAL 3.11
+ */
+int CPLJobQueue::CancelPendingJobs()
+{
+    m_bCancelled = true;
+
+    std::deque<std::function<void()>> aoDeferredJobs;
     {
-        task();
-        DeclareJobFinished();
-    };
-    // cppcheck-suppress knownConditionTrueFalse
-    return m_poPool->SubmitJob(lambda);
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        std::swap(aoDeferredJobs, m_aoDeferredJobs);
+    }
+    const int nRemovedFromPool = m_poPool->RemovePendingJobsOfQueue(this);
+    const int nRemoved =
+        nRemovedFromPool + static_cast<int>(aoDeferredJobs.size());
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_nPendingJobs -= nRemoved;
+        m_nSubmittedJobs -= nRemovedFromPool;
+        m_cv.notify_all();
+    }
+    return nRemoved;
 }
 
 /************************************************************************/
@@ -604,6 +785,23 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    if (threadLocalCurrentThreadPool == m_poPool)
+    {
+        // When called from a worker thread of the pool (nested parallelism,
+        // e.g. a VRT source job reading a multi-threaded GTiff), run our own
+        // pending jobs rather than leaving a worker thread idle.
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> oGuard(m_mutex);
+                if (m_nPendingJobs <= nMaxRemainingJobs)
+                    return;
+            }
+            if (!m_poPool->RunPendingJobOfQueue(this))
+                break;
+        }
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return m_nPendingJobs <= nMaxRemainingJobs; });
@@ -622,6 +820,13 @@ bool CPLJobQueue::WaitEvent()
     // NOTE - This isn't quite right. After nPendingJobsBefore is set but before
     // a notification occurs, jobs could be submitted which would increase
     // nPendingJobs, so a job completion may looks like a spurious wakeup.
+    if (threadLocalCurrentThreadPool == m_poPool &&
+        m_poPool->RunPendingJobOfQueue(this))
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        return m_nPendingJobs > 0;
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     if (m_nPendingJobs == 0)
         return false;
@@ -16,11 +16,16 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <deque>
 #include <queue>
+#include <type_traits>
 #include <vector>
 
 /**
@@ -60,6 +65,20 @@ class CPLJobQueue;
 /// Unique pointer to a job queue.
 using CPLJobQueuePtr = std::unique_ptr<CPLJobQueue>;
 
+/** Priority of jobs. Worker threads pick the oldest pending job of the
+ * highest priority.
+ * @since GDAL 3.11
+ */
+enum class CPLJobPriority
+{
+    /** Bulk processing, such as overview computation */
+    LOW = 0,
+    /** Default priority */
+    NORMAL = 1,
+    /** Latency sensitive requests */
+    HIGH = 2,
+};
+
 /** Pool of worker threads */
 class CPL_DLL CPLWorkerThreadPool
 {
@@ -69,7 +88,15 @@ class CPL_DLL CPLWorkerThreadPool
     mutable std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    std::queue<std::function<void()>> jobQueue;
+
+    struct Job
+    {
+        std::function<void()> task{};
+        const CPLJobQueue *poQueue = nullptr;  // may be null
+    };
+
+    // Pending jobs, indexed by CPLJobPriority
+    std::array<std::deque<Job>, 3> aJobQueues{};
     int nPendingJobs = 0;
 
     CPLList *psWaitingWorkerThreadsList = nullptr;
@@ -82,6 +109,12 @@ class CPL_DLL CPLWorkerThreadPool
     void DeclareJobFinished();
     std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
 
+    friend class CPLJobQueue;
+    bool SubmitJob(std::function<void()> task, const CPLJobQueue *poQueue,
+                   CPLJobPriority ePriority, bool bMayRunSynchronously);
+    bool RunPendingJobOfQueue(const CPLJobQueue *poQueue);
+    int RemovePendingJobsOfQueue(const CPLJobQueue *poQueue);
+
   public:
     CPLWorkerThreadPool();
     explicit CPLWorkerThreadPool(int nThreads);
@@ -92,6 +125,8 @@ class CPL_DLL CPLWorkerThreadPool
                bool bWaitallStarted);
 
     CPLJobQueuePtr CreateJobQueue();
+    CPLJobQueuePtr CreateJobQueue(CPLJobPriority ePriority,
+                                  int nMaxConcurrency = 0);
 
     bool SubmitJob(std::function<void()> task);
     bool SubmitJob(CPLThreadFunc pfnFunc, void *pData);
@@ -112,12 +147,28 @@ class CPL_DLL CPLJobQueue
     std::condition_variable m_cv{};
     int m_nPendingJobs = 0;
 
+    CPLJobPriority m_ePriority = CPLJobPriority::NORMAL;
+
+    // Maximum number of jobs of this queue running at the same time, or 0
+    int m_nMaxConcurrency = 0;
+
+    // Number of jobs of this queue submitted to the pool
+    int m_nSubmittedJobs = 0;
+
+    // Jobs held back because of m_nMaxConcurrency
+    std::deque<std::function<void()>> m_aoDeferredJobs{};
+
+    std::atomic<bool> m_bCancelled{false};
+
     void DeclareJobFinished();
+    bool SubmitToPool(std::function<void()> task, bool bMayRunSynchronously);
 
     //! @cond Doxygen_Suppress
   protected:
     friend class CPLWorkerThreadPool;
     explicit CPLJobQueue(CPLWorkerThreadPool *poPool);
+    CPLJobQueue(CPLWorkerThreadPool *poPool, CPLJobPriority ePriority,
+                int nMaxConcurrency);
     //! @endcond
 
   public:
@@ -129,8 +180,49 @@ class CPL_DLL CPLJobQueue
         return m_poPool;
     }
 
+    /** Return the priority of the jobs of this queue
+     * @since GDAL 3.11
+     */
+    CPLJobPriority GetPriority() const
+    {
+        return m_ePriority;
+    }
+
     bool SubmitJob(CPLThreadFunc pfnFunc, void *pData);
     bool SubmitJob(std::function<void()> task);
+
+    /** Queue a new job, and return a future to its result.
+     *
+     * If the job cannot be run, because of a submission failure or because
+     * it is cancelled by CancelPendingJobs(), getting the result of the future
+     * throws std::future_error.
+     *
+     * @param task Function, without argument, to execute.
+     * @since GDAL 3.11
+     */
+    template <class F>
+    std::future<std::invoke_result_t<F>> SubmitJobWithFuture(F &&task)
+    {
+        // std::function requires a copyable callable
+        auto poTask =
+            std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(
+                std::forward<F>(task));
+        auto oFuture = poTask->get_future();
+        SubmitJob([poTask]() { (*poTask)(); });
+        return oFuture;
+    }
+
+    int CancelPendingJobs();
+
+    /** Return whether CancelPendingJobs() has been called. Long running jobs
+     * may poll it to stop early.
+     * @since GDAL 3.11
+     */
+    bool IsCancelled() const
+    {
+        return m_bCancelled.load();
+    }
+
     void WaitCompletion(int nMaxRemainingJobs = 0);
     bool WaitEvent();
 };
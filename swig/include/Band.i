@@ -297,6 +297,19 @@ public:
 %clear (int*);
 #endif
 
+#if defined(SWIGPYTHON)
+%apply (int *optional_int) {(int*)};
+%feature ("kwargs") ContentHash;
+  GUIntBig ContentHash( int xoff = 0, int yoff = 0, int *xsize = 0, int *ysize = 0) {
+    int nxsize = (xsize!=0) ? *xsize : GDALGetRasterBandXSize( self );
+    int nysize = (ysize!=0) ? *ysize : GDALGetRasterBandYSize( self );
+    GUInt64 nHash = 0;
+    GDALContentHashImage( self, xoff, yoff, nxsize, nysize, &nHash );
+    return nHash;
+  }
+%clear (int*);
+#endif
+
 #if defined(SWIGPYTHON)
 
 %feature("kwargs") ComputeRasterMinMax;
@@ -199,6 +199,9 @@ void CPL_STDCALL PyCPLErrorHandler(CPLErr eErrClass, CPLErrorNum err_no, const c
 %rename (HasThreadSupport) wrapper_HasThreadSupport;
 %rename (NetworkStatsReset) VSINetworkStatsReset;
 %rename (NetworkStatsGetAsSerializedJSON) VSINetworkStatsGetAsSerializedJSON;
+%rename (IOStatsReset) VSIIOStatsReset;
+%rename (IOStatsGetAsSerializedJSON) VSIIOStatsGetAsSerializedJSON;
+%rename (IOStatsGetAsPrometheusText) VSIIOStatsGetAsPrometheusText;
 
 %apply Pointer NONNULL {const char *pszScope};
 retStringAndCPLFree*
@@ -970,6 +973,10 @@ void VSICurlPartialClearCache( const char* utf8_path );
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
 
+void VSIIOStatsReset();
+retStringAndCPLFree* VSIIOStatsGetAsSerializedJSON( char** options = NULL );
+retStringAndCPLFree* VSIIOStatsGetAsPrometheusText( char** options = NULL );
+
 #endif /* !defined(SWIGJAVA) */
 
 %apply (char **CSL) {char **};
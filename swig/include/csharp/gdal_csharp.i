@@ -66,6 +66,8 @@ typedef struct
     double dfXSize;
     /*! Height in pixels of the area of interest. Only valid if bFloatingPointWindowValidity = TRUE */
     double dfYSize;
+    /*! Hint that blocks fetched during the request should not be promoted in the block cache. Only valid if nVersion >= 2 */
+    int bNoCachePromotion;
 } GDALRasterIOExtraArg;
 
 DEFINE_EXTERNAL_CLASS(OGRLayerShadow, OSGeo.OGR.Layer)
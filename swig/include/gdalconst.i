@@ -193,6 +193,7 @@
 %constant char *DMD_EXTENSION          = GDAL_DMD_EXTENSION;
 %constant char *DMD_CONNECTION_PREFIX  = GDAL_DMD_CONNECTION_PREFIX;
 %constant char *DMD_EXTENSIONS         = GDAL_DMD_EXTENSIONS;
+%constant char *DMD_OPEN_SIGNATURES    = GDAL_DMD_OPEN_SIGNATURES;
 %constant char *DMD_CREATIONOPTIONLIST = GDAL_DMD_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST;
@@ -255,6 +256,7 @@
 %constant char *GDAL_DMD_RELATIONSHIP_RELATED_TABLE_TYPES    = GDAL_DMD_RELATIONSHIP_RELATED_TABLE_TYPES;
 %constant char *DCAP_RENAME_LAYERS    = GDAL_DCAP_RENAME_LAYERS;
 %constant char *DCAP_FLUSHCACHE_CONSISTENT_STATE    = GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE;
+%constant char *DCAP_CONCURRENT_READ_BLOCK    = GDAL_DCAP_CONCURRENT_READ_BLOCK;
 
 %constant char *DIM_TYPE_HORIZONTAL_X       = GDAL_DIM_TYPE_HORIZONTAL_X;
 %constant char *DIM_TYPE_HORIZONTAL_Y       = GDAL_DIM_TYPE_HORIZONTAL_Y;
@@ -286,6 +288,8 @@
 #define GDAL_DMD_CONNECTION_PREFIX  "DMD_CONNECTION_PREFIX"
 #define DMD_EXTENSIONS "DMD_EXTENSIONS"
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
+#define DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
+#define GDAL_DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
 #define DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST "DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST"
@@ -409,6 +413,8 @@
 #define GDAL_DCAP_RENAME_LAYERS    "DCAP_RENAME_LAYERS"
 #define DCAP_FLUSHCACHE_CONSISTENT_STATE    "DCAP_FLUSHCACHE_CONSISTENT_STATE"
 #define GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE    "DCAP_FLUSHCACHE_CONSISTENT_STATE"
+#define DCAP_CONCURRENT_READ_BLOCK    "DCAP_CONCURRENT_READ_BLOCK"
+#define GDAL_DCAP_CONCURRENT_READ_BLOCK    "DCAP_CONCURRENT_READ_BLOCK"
 
 #define DIM_TYPE_HORIZONTAL_X "HORIZONTAL_X"
 #define GDAL_DIM_TYPE_HORIZONTAL_X "HORIZONTAL_X"
@@ -117,7 +117,9 @@ typedef enum
 {
     GATDijkstraShortestPath = 1,
     GATKShortestPath = 2,
-    GATConnectedComponents = 3
+    GATConnectedComponents = 3,
+    GATContractionHierarchyShortestPath = 4,
+    GATShortestPathMatrix = 5
 } GNMGraphAlgorithmType;
 
 #define GNMGFID GIntBig
@@ -4591,6 +4591,19 @@ void OGRSetNonLinearGeometriesEnabledFlag( int bFlag );
 %rename (GetNonLinearGeometriesEnabledFlag) OGRGetNonLinearGeometriesEnabledFlag;
 int OGRGetNonLinearGeometriesEnabledFlag(void);
 
+#if !defined(SWIGJAVA)
+
+%rename (ProfilingStatsReset) OGRProfilingStatsReset;
+void OGRProfilingStatsReset();
+
+%rename (ProfilingStatsGetAsSerializedJSON) OGRProfilingStatsGetAsSerializedJSON;
+retStringAndCPLFree* OGRProfilingStatsGetAsSerializedJSON( char** options = NULL );
+
+%rename (ProfilingStatsGetAsText) OGRProfilingStatsGetAsText;
+retStringAndCPLFree* OGRProfilingStatsGetAsText( char** options = NULL );
+
+#endif /* !defined(SWIGJAVA) */
+
 %inline %{
   OGRDataSourceShadow* GetOpenDS(int ds_number) {
     OGRDataSourceShadow* layer = (OGRDataSourceShadow*) OGRGetOpenDS(ds_number);
@@ -58,6 +58,36 @@ See Also
 :py:meth:`SetStatistics`
 ";
 
+%feature("docstring")  ContentHash "
+
+Computes a 64-bit hash of the values of a region of a RasterBand, in its
+native data type, that does not depend on its block layout or compression.
+See :cpp:func:`GDALContentHashImage`.
+
+.. versionadded:: 3.11
+
+Parameters
+----------
+xoff : int, default=0
+   The pixel offset to left side of the region of the band to
+   be read. This would be zero to start from the left side.
+yoff : int, default=0
+   The line offset to top side of the region of the band to
+   be read. This would be zero to start from the top side.
+xsize : int, optional
+     The number of pixels to read in the x direction. By default,
+     equal to the number of columns in the raster.
+ysize : int, optional
+     The number of rows to read in the y direction. By default,
+     equal to the number of rows in the raster.
+
+Returns
+-------
+int
+    hash value, or 0 in case of error
+
+";
+
 %feature("docstring")  CreateMaskBand "
 
 Add a mask band to the current band.
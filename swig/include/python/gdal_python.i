@@ -3507,7 +3507,7 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
               zFactor=None, scale=None, azimuth=None, altitude=None,
               combined=False, multiDirectional=False, igor=False,
               slopeFormat=None, trigonometric=False, zeroForFlat=False,
-              addAlpha=None, colorSelection=None,
+              addAlpha=None, colorSelection=None, numThreads=None,
               callback=None, callback_data=None):
     """Create a DEMProcessingOptions() object that can be passed to gdal.DEMProcessing()
 
@@ -3551,6 +3551,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
         adds an alpha band to the output file (only for processing = 'color-relief')
     colorSelection:
         (color-relief only) Determines how color entries are selected from an input value. Can be "nearest_color_entry", "exact_color_entry" or "linear_interpolation". Defaults to "linear_interpolation"
+    numThreads:
+        number of threads (or 'ALL_CPUS') used to process lines, for all modes except color-relief
     callback:
         callback method
     callback_data:
@@ -3597,6 +3599,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
             new_options += ['-trigonometric']
         if zeroForFlat:
             new_options += ['-zero_for_flat']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
         if colorSelection is not None:
             if colorSelection == 'nearest_color_entry':
                 new_options += ['-nearest_color_entry']
@@ -3654,6 +3658,7 @@ def NearblackOptions(options=None, format=None,
          creationOptions=None, white = False, colors=None,
          maxNonBlack=None, nearDist=None, setAlpha = False, setMask = False,
          alg=None,
+         numThreads=None,
          callback=None, callback_data=None):
     """Create a NearblackOptions() object that can be passed to gdal.Nearblack()
 
@@ -3679,6 +3684,8 @@ def NearblackOptions(options=None, format=None,
         adds a mask band to the output file.
     alg:
         "twopasses" (default), or "floodfill"
+    numThreads:
+        number of threads (or "ALL_CPUS") used to classify pixels
     callback:
         callback method
     callback_data:
@@ -3720,6 +3727,8 @@ def NearblackOptions(options=None, format=None,
             new_options += ['-setmask']
         if alg:
             new_options += ['-alg', alg]
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -3927,6 +3936,7 @@ def ContourOptions(
     layerName="contour",
     polygonize=False,
     groupTransactions=100000,
+    numThreads=None,
     callback=None,
     callback_data=None):
     """Create a ContourOptions() object that can be passed to gdal.Contour()
@@ -3975,6 +3985,8 @@ def ContourOptions(
         Group n features per transaction (default 100 000). Increase the value for better performance when writing into
         DBMS drivers that have transaction support. n can be set to unlimited to load the data into a single transaction.
         If set to 0, no explicit transaction is done.
+    numThreads:
+        Number of threads (or 'ALL_CPUS') used to generate contour lines.
     callback:
         Callback method.
     callback_data:
@@ -4034,6 +4046,8 @@ def ContourOptions(
             new_options += ['-nln', layerName]
         if polygonize:
             new_options += ['-p']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
         if groupTransactions is not None:
             new_options += ['-gt', str(groupTransactions)]
 
@@ -4091,7 +4105,7 @@ def RasterizeOptions(options=None, format=None,
          bands=None, inverse=False, allTouched=False,
          burnValues=None, attribute=None, useZ=False, layers=None,
          SQLStatement=None, SQLDialect=None, where=None, optim=None,
-         add=None,
+         add=None, numThreads=None,
          callback=None, callback_data=None):
     """Create a RasterizeOptions() object that can be passed to gdal.Rasterize()
 
@@ -4158,6 +4172,8 @@ def RasterizeOptions(options=None, format=None,
         optimization mode ('RASTER', 'VECTOR')
     add:
         set to True to use additive mode instead of replace when burning values
+    numThreads:
+        number of threads (or 'ALL_CPUS') used to burn geometries
     callback:
         callback method
     callback_data:
@@ -4243,6 +4259,8 @@ def RasterizeOptions(options=None, format=None,
             new_options += ['-optim', str(optim)]
         if add:
             new_options += ['-add']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -4305,6 +4323,7 @@ def FootprintOptions(options=None,
                      writeAbsolutePath=False,
                      layerCreationOptions=None,
                      datasetCreationOptions=None,
+                     numThreads=None,
                      callback=None, callback_data=None):
     """Create a FootprintOptions() object that can be passed to gdal.Footprint()
 
@@ -4348,6 +4367,8 @@ def FootprintOptions(options=None,
         Enables writing the absolute path of the input dataset. By default, the filename is written in the location field exactly as the dataset name.
     layerName:
         output layer name
+    numThreads:
+        number of threads (or "ALL_CPUS") used to compute the footprint
     callback:
         callback method
     callback_data:
@@ -4416,6 +4437,8 @@ def FootprintOptions(options=None,
             new_options += ['-no_location']
         if writeAbsolutePath:
             new_options += ['-write_absolute_path']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -4541,6 +4564,7 @@ def BuildVRTOptions(options=None,
                     nodataMaxMaskThreshold=None,
                     strict=False,
                     creationOptions=None,
+                    numThreads=None,
                     callback=None, callback_data=None):
     """Create a BuildVRTOptions() object that can be passed to gdal.BuildVRT()
 
@@ -4583,6 +4607,8 @@ def BuildVRTOptions(options=None,
         set to True if warnings should be failures
     creationOptions:
         list or dict of creation options
+    numThreads:
+        number of threads (or "ALL_CPUS") used to open input datasets
     callback:
         callback method.
     callback_data:
@@ -4637,6 +4663,8 @@ def BuildVRTOptions(options=None,
             new_options += ['-strict']
         if creationOptions is not None:
             _addCreationOptions(new_options, creationOptions)
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -4712,7 +4740,11 @@ def TileIndexOptions(options=None,
                      bandCount=None,
                      mask=None,
                      metadataOptions=None,
-                     fetchMD=None):
+                     fetchMD=None,
+                     numThreads=None,
+                     sync=None,
+                     mtimeField=None,
+                     footprint=None):
     """Create a TileIndexOptions() object that can be passed to gdal.TileIndex()
 
     Parameters
@@ -4765,6 +4797,17 @@ def TileIndexOptions(options=None,
         Fetch a metadata item from the raster tile and write it as a field in the
         tile index.
         Tuple (raster metadata item name, target field name, target field type), or list of such tuples, with target field type in "String", "Integer", "Integer64", "Real", "Date", "DateTime";
+    numThreads:
+        number of threads (or "ALL_CPUS") used to open input datasets
+    sync:
+        Whether to synchronize an existing tile index with the input files:
+        entries of files no longer listed are removed, and modified files
+        are re-indexed (when mtimeField is set).
+    mtimeField:
+        Name of the field where the modification time of source files is stored.
+    footprint:
+        Whether to use the footprint of valid pixels of rasters as geometry,
+        instead of their extent.
     """
 
     # Only used for tests
@@ -4855,6 +4898,14 @@ def TileIndexOptions(options=None,
                     new_options += ['-fetch_md', mdItemName, fieldName, fieldType]
             else:
                 new_options += ['-fetch_md', fetchMD[0], fetchMD[1], fetchMD[2]]
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
+        if sync:
+            new_options += ['-sync']
+        if mtimeField is not None:
+            new_options += ['-mtime_field', mtimeField]
+        if footprint:
+            new_options += ['-footprint']
 
     if return_option_list:
         return new_options